@@ -144,6 +144,9 @@ static int gpy2xx_driver_probe(struct platform_device *pdev)
 #ifdef DEBUG_PRINT
 	pr_debug("The msec top allocated gpy211_macsec_dev = %px", driver_data->gdev.macsec_data);
 #endif
+	hash_init(driver_data->secy.rx_sc_hash);
+	mutex_init(&driver_data->stats_lock);
+
 	/* Set this driver data in platform device structure */
 	platform_set_drvdata(pdev, driver_data);
 
@@ -207,18 +210,35 @@ int gpy2xx_module_init(void)
 
 	rc = platform_device_register(&gpy2xx_device);
 
-	if (rc < 0)
+	if (rc < 0) {
 		pr_err("GPY2XX platform device register failed\n");
+		return rc;
+	}
 
 	/* Registering with Kernel */
 	rc = platform_driver_register(&gpy2xx_driver);
 
-	if (rc < 0)
+	if (rc < 0) {
 		pr_err("GPY2XX platform driver register failed\n");
+		goto err_device;
+	}
+
+	rc = gpy211_genl_register();
+
+	if (rc < 0) {
+		pr_err("GPY2XX generic netlink family register failed\n");
+		goto err_driver;
+	}
 
 	//platform_driver_probe(&gpy2xx_driver, gpy2xx_driver_probe);
 
 	return 0;
+
+err_driver:
+	platform_driver_unregister(&gpy2xx_driver);
+err_device:
+	platform_device_unregister(&gpy2xx_device);
+	return rc;
 }
 module_init(gpy2xx_module_init);
 
@@ -226,6 +246,8 @@ void gpy2xx_module_uninit(void)
 {
 	pr_info("Thanks....Exiting GPY2XX platform driver... \n");
 
+	gpy211_genl_unregister();
+
 	/* Unregistering from Kernel */
 	platform_driver_unregister(&gpy2xx_driver);
 
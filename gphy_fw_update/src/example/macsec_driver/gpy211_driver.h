@@ -27,6 +27,8 @@ struct gpy2xx_priv {
 void gpy211_macsec_postdoit(const struct genl_ops *ops,
 			    struct sk_buff *skb,
 			    struct genl_info *info);
+int gpy211_genl_register(void);
+void gpy211_genl_unregister(void);
 int gpy211_macsec_changelink(struct net_device *dev,
 			     struct nlattr *tb[],
 			     struct nlattr *data[]);
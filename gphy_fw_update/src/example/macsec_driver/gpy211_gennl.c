@@ -15,7 +15,7 @@
 #include <linux/printk.h>
 #include <linux/platform_device.h>
 #include <uapi/linux/if_macsec.h>
-//#include <linux/rtnetlink.h>
+#include <linux/rtnetlink.h>
 #include <net/genetlink.h>
 //#include <net/gpy211/gpy211_ops.h>
 
@@ -158,11 +158,13 @@ static bool gpy211_validate_add_rxsa(struct nlattr **attrs)
 	return true;
 }
 
+/* Caller holds RTNL or rcu_read_lock() */
 static struct gpy211_macsec_rx_sc *gpy211_find_rx_sc_rtnl(struct gpy211_macsec_secy *secy, sci_t sci)
 {
 	struct gpy211_macsec_rx_sc *rx_sc;
 
-	for (rx_sc = secy->rx_sc; rx_sc; rx_sc = secy->rx_sc->next) {
+	hash_for_each_possible_rcu(secy->rx_sc_hash, rx_sc, hnode, (__force u64)sci,
+				   lockdep_rtnl_is_held()) {
 		if (rx_sc->sci == sci)
 			return rx_sc;
 	}
@@ -264,6 +266,14 @@ static struct gpy211_macsec_rx_sc *gpy211_create_rx_sc(sci_t sci)
 	struct gpy2xx_priv_data *pdata;
 	pr_debug("Entering %s %d\n", __func__, __LINE__);
 
+	/* Update to private data */
+	pdata = (struct gpy2xx_priv_data *)platform_get_drvdata(gpy212_data.pdev[0]);
+
+	secy = &pdata->secy;
+
+	if (gpy211_find_rx_sc_rtnl(secy, sci))
+		return ERR_PTR(-EEXIST);
+
 	rx_sc = kzalloc(sizeof(*rx_sc), in_atomic() ? GFP_ATOMIC : GFP_KERNEL);
 
 	if (!rx_sc)
@@ -273,12 +283,9 @@ static struct gpy211_macsec_rx_sc *gpy211_create_rx_sc(sci_t sci)
 	rx_sc->active = true;
 	atomic_set(&rx_sc->refcnt, 1);
 
-	/* Update to private data */
-	pdata = (struct gpy2xx_priv_data *)platform_get_drvdata(gpy212_data.pdev[0]);
-
-	secy = &pdata->secy;
 	rx_sc->next = secy->rx_sc;
 	secy->rx_sc = rx_sc;
+	hash_add_rcu(secy->rx_sc_hash, &rx_sc->hnode, (__force u64)sci);
 
 	if (rx_sc->active)
 		secy->n_rx_sc++;
@@ -291,24 +298,28 @@ static struct gpy211_macsec_rx_sc *gpy211_del_rx_sc(struct gpy211_macsec_secy *s
 {
 	struct gpy211_macsec_rx_sc *rx_sc, **rx_scp;
 
-	for (rx_scp = &secy->rx_sc, rx_sc = *rx_scp;
-	     rx_sc;
-	     rx_scp = &rx_sc->next, rx_sc = *rx_scp) {
-		if (rx_sc->sci == sci) {
-			if (rx_sc->active)
-				secy->n_rx_sc--;
+	rx_sc = gpy211_find_rx_sc_rtnl(secy, sci);
 
-			*rx_scp = rx_sc->next;
-			return rx_sc;
-		}
-	}
+	if (!rx_sc)
+		return NULL;
 
-	return NULL;
+	/* Only the SC list is walked here, the lookup is hashed */
+	for (rx_scp = &secy->rx_sc; *rx_scp != rx_sc; rx_scp = &(*rx_scp)->next)
+		;
+
+	if (rx_sc->active)
+		secy->n_rx_sc--;
+
+	*rx_scp = rx_sc->next;
+	hash_del_rcu(&rx_sc->hnode);
+
+	return rx_sc;
 }
 
 static void gpy211_free_rx_sc(struct gpy211_macsec_rx_sc *rx_sc)
 {
-	kfree(rx_sc);
+	/* Hash readers may still see the SC until the grace period ends */
+	kfree_rcu(rx_sc, rcu);
 }
 
 #ifdef SUPPORT_ALL_NLM_CMDS
@@ -567,8 +578,8 @@ int gpy211_upd_rxsc(struct sk_buff *skb, struct genl_info *info)
 	sci = nla_get_u64(tb_rxsc[MACSEC_RXSC_ATTR_SCI]);
 	rx_sc = gpy211_find_rx_sc_rtnl(secy, sci);
 
-	if (IS_ERR(rx_sc))
-		return PTR_ERR(rx_sc);
+	if (!rx_sc)
+		return -ENODEV;
 
 	if (tb_rxsc[MACSEC_RXSC_ATTR_ACTIVE]) {
 		new = !!nla_get_u8(tb_rxsc[MACSEC_RXSC_ATTR_ACTIVE]);
@@ -790,38 +801,21 @@ int gpy211_add_txsa(struct sk_buff *skb, struct genl_info *info)
 	return 0;
 }
 
-int gpy211_add_rxsa(struct sk_buff *skb, struct genl_info *info)
+static int __gpy211_add_rxsa(struct net_device *dev, struct nlattr **tb_rxsc,
+			     struct nlattr **tb_sa)
 {
 	int ret;
 
-	struct net_device *dev;
-	struct nlattr **attrs = info->attrs;
 	struct gpy211_macsec_secy *secy, *dev_secy;
 	struct gpy211_macsec_rx_sc *rx_sc;
 	struct gpy211_macsec_rx_sa *rx_sa;
-	struct nlattr *tb_rxsc[MACSEC_RXSC_ATTR_MAX + 1];
-	struct nlattr *tb_sa[MACSEC_SA_ATTR_MAX + 1];
 	struct gpy2xx_priv_data *pdata;
 	struct gpy211_macsec_data *msec_data;
 	pr_debug("Entering %s %d\n", __func__, __LINE__);
 
-	if (!attrs[MACSEC_ATTR_IFINDEX])
-		return -EINVAL;
-
-	if (gpy211_parse_sa_config(attrs, tb_sa))
-		return -EINVAL;
-
-	if (gpy211_parse_rxsc_config(attrs, tb_rxsc))
-		return -EINVAL;
-
 	if (!gpy211_validate_add_rxsa(tb_sa))
 		return -EINVAL;
 
-	dev = gpy211_get_dev_from_nl(genl_info_net(info), attrs);
-
-	if (IS_ERR(dev))
-		return PTR_ERR(dev);
-
 	dev_secy = netdev_priv(dev);
 
 	pdata = (struct gpy2xx_priv_data *)platform_get_drvdata(gpy212_data.pdev[0]);
@@ -852,8 +846,8 @@ int gpy211_add_rxsa(struct sk_buff *skb, struct genl_info *info)
 	
 	rx_sc = gpy211_find_rx_sc_rtnl(secy, msec_data->ing_data.trans_rec.cp.scid);
 
-	if (IS_ERR(rx_sc))
-		return PTR_ERR(rx_sc);
+	if (!rx_sc)
+		return -ENODEV;
 
 	msec_data->ing_data.trans_rec.ccw.an = nla_get_u8(tb_sa[MACSEC_SA_ATTR_AN]);
 
@@ -994,20 +988,36 @@ int gpy211_add_rxsa(struct sk_buff *skb, struct genl_info *info)
 	return 0;
 }
 
-int gpy211_add_rxsc(struct sk_buff *skb, struct genl_info *info)
+int gpy211_add_rxsa(struct sk_buff *skb, struct genl_info *info)
 {
-	sci_t sci = 0xffffffffffffffffULL;
+	struct net_device *dev;
 	struct nlattr **attrs = info->attrs;
-	struct gpy211_macsec_rx_sc *rx_sc;
 	struct nlattr *tb_rxsc[MACSEC_RXSC_ATTR_MAX + 1];
-	pr_debug("Entering %s %d\n", __func__, __LINE__);
+	struct nlattr *tb_sa[MACSEC_SA_ATTR_MAX + 1];
 
 	if (!attrs[MACSEC_ATTR_IFINDEX])
 		return -EINVAL;
 
+	if (gpy211_parse_sa_config(attrs, tb_sa))
+		return -EINVAL;
+
 	if (gpy211_parse_rxsc_config(attrs, tb_rxsc))
 		return -EINVAL;
 
+	dev = gpy211_get_dev_from_nl(genl_info_net(info), attrs);
+
+	if (IS_ERR(dev))
+		return PTR_ERR(dev);
+
+	return __gpy211_add_rxsa(dev, tb_rxsc, tb_sa);
+}
+
+static int __gpy211_add_rxsc(struct nlattr **tb_rxsc)
+{
+	sci_t sci = 0xffffffffffffffffULL;
+	struct gpy211_macsec_rx_sc *rx_sc;
+	pr_debug("Entering %s %d\n", __func__, __LINE__);
+
 	if (!gpy211_validate_add_rxsc(tb_rxsc))
 		return -EINVAL;
 
@@ -1025,6 +1035,379 @@ int gpy211_add_rxsc(struct sk_buff *skb, struct genl_info *info)
 	return 0;
 }
 
+int gpy211_add_rxsc(struct sk_buff *skb, struct genl_info *info)
+{
+	struct nlattr **attrs = info->attrs;
+	struct nlattr *tb_rxsc[MACSEC_RXSC_ATTR_MAX + 1];
+
+	if (!attrs[MACSEC_ATTR_IFINDEX])
+		return -EINVAL;
+
+	if (gpy211_parse_rxsc_config(attrs, tb_rxsc))
+		return -EINVAL;
+
+	return __gpy211_add_rxsc(tb_rxsc);
+}
+
+static struct genl_family gpy211_genl_family;
+
+static const struct nla_policy gpy211_genl_policy[GPY211_ATTR_MAX + 1] = {
+	[GPY211_ATTR_IFINDEX] = { .type = NLA_U32 },
+	[GPY211_ATTR_BULK_LIST] = { .type = NLA_NESTED },
+	[GPY211_ATTR_MAX_AGE] = { .type = NLA_U32 },
+};
+
+static const struct nla_policy gpy211_bulk_entry_policy[MACSEC_ATTR_MAX + 1] = {
+	[MACSEC_ATTR_RXSC_CONFIG] = { .type = NLA_NESTED },
+	[MACSEC_ATTR_SA_CONFIG] = { .type = NLA_NESTED },
+};
+
+static int gpy211_add_rx_bulk_entry(struct net_device *dev, struct nlattr *entry)
+{
+	struct nlattr *tb_entry[MACSEC_ATTR_MAX + 1];
+	struct nlattr *tb_rxsc[MACSEC_RXSC_ATTR_MAX + 1];
+	struct nlattr *tb_sa[MACSEC_SA_ATTR_MAX + 1];
+
+	if (nla_type(entry) != GPY211_ATTR_BULK_ENTRY)
+		return -EINVAL;
+
+	if (nla_parse_nested(tb_entry, MACSEC_ATTR_MAX, entry,
+			     gpy211_bulk_entry_policy, NULL))
+		return -EINVAL;
+
+	if (gpy211_parse_rxsc_config(tb_entry, tb_rxsc))
+		return -EINVAL;
+
+	if (!tb_entry[MACSEC_ATTR_SA_CONFIG])
+		return __gpy211_add_rxsc(tb_rxsc);
+
+	if (gpy211_parse_sa_config(tb_entry, tb_sa))
+		return -EINVAL;
+
+	return __gpy211_add_rxsa(dev, tb_rxsc, tb_sa);
+}
+
+/* Add many RX SCs/SAs under one RTNL hold. Entries are applied in order,
+ * the reply carries the number applied so a failed request can be resumed. */
+int gpy211_add_rx_bulk(struct sk_buff *skb, struct genl_info *info)
+{
+	struct nlattr **attrs = info->attrs;
+	struct nlattr *entry;
+	struct net_device *dev;
+	struct sk_buff *msg;
+	void *hdr;
+	u32 done = 0;
+	int rem, ret = 0;
+	pr_debug("Entering %s %d\n", __func__, __LINE__);
+
+	if (!attrs[GPY211_ATTR_IFINDEX] || !attrs[GPY211_ATTR_BULK_LIST])
+		return -EINVAL;
+
+	rtnl_lock();
+
+	dev = __dev_get_by_index(genl_info_net(info),
+				 nla_get_u32(attrs[GPY211_ATTR_IFINDEX]));
+
+	if (!dev || !netif_is_macsec(dev)) {
+		ret = -ENODEV;
+		goto unlock;
+	}
+
+	nla_for_each_nested(entry, attrs[GPY211_ATTR_BULK_LIST], rem) {
+		if (done >= GPY211_BULK_MAX_ENTRIES) {
+			ret = -E2BIG;
+			break;
+		}
+
+		ret = gpy211_add_rx_bulk_entry(dev, entry);
+
+		if (ret) {
+			pr_err("macsec: bulk entry %u failed: %d\n", done, ret);
+			break;
+		}
+
+		done++;
+	}
+
+unlock:
+	rtnl_unlock();
+
+	msg = genlmsg_new(nla_total_size(sizeof(u32)), GFP_KERNEL);
+
+	if (!msg)
+		return ret ? ret : -ENOMEM;
+
+	hdr = genlmsg_put_reply(msg, info, &gpy211_genl_family, 0,
+				GPY211_CMD_ADD_RX_BULK);
+
+	if (!hdr || nla_put_u32(msg, GPY211_ATTR_BULK_DONE, done)) {
+		nlmsg_free(msg);
+		return ret ? ret : -EMSGSIZE;
+	}
+
+	genlmsg_end(msg, hdr);
+	genlmsg_reply(msg, info);
+
+	pr_debug("Exiting %s %d\n", __func__, __LINE__);
+	return ret;
+}
+
+/* Refresh the statistics snapshot if older than max_age_ms.
+ * Counters are clear-on-read and accumulated in pdata->stats, so one
+ * refresh serves every dump within max_age_ms. The first fill starts the
+ * harvester in poll mode with thresholds of 1, so every counter that moved
+ * is flagged in the statistics summary without raising an interrupt, and
+ * sweeps all SAs once. Later refreshes only read the SAs flagged in the
+ * summary. Caller holds stats_lock. */
+static int gpy211_stats_refresh(struct gpy2xx_priv_data *pdata, u32 max_age_ms)
+{
+	int ret;
+
+	if (pdata->stats_valid &&
+	    time_before(jiffies, pdata->stats_stamp + msecs_to_jiffies(max_age_ms)))
+		return 0;
+
+	if (pdata->stats_valid) {
+		ret = gpy2xx_msec_harvest_poll(&pdata->gdev, &pdata->stats);
+	} else {
+		pdata->stats.ing_thr.frame_threshold = 1;
+		pdata->stats.ing_thr.octet_threshold = 1;
+		pdata->stats.egr_thr.frame_threshold = 1;
+		pdata->stats.egr_thr.octet_threshold = 1;
+		pdata->stats.poll = 1;
+
+		ret = gpy2xx_msec_harvest_start(&pdata->gdev, &pdata->stats);
+
+		if (ret < 0)
+			return ret;
+
+		ret = gpy2xx_msec_harvest_sync(&pdata->gdev, &pdata->stats);
+	}
+
+	if (ret < 0)
+		return ret;
+
+	pdata->stats_stamp = jiffies;
+	pdata->stats_valid = true;
+
+	return 0;
+}
+
+static int gpy211_fill_secy_stats(struct sk_buff *skb, struct gpy2xx_priv_data *pdata)
+{
+	struct ing_global_stats *ig = &pdata->stats.ing_glb;
+	struct egr_global_stats *eg = &pdata->stats.egr_glb;
+	struct nlattr *nest;
+
+	nest = nla_nest_start(skb, GPY211_ATTR_SECY_STATS);
+
+	if (!nest)
+		return -EMSGSIZE;
+
+	if (nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_OUT_PKTS_UNTAGGED,
+			      eg->OutPktsUntagged, MACSEC_SECY_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_IN_PKTS_UNTAGGED,
+			      ig->InPktsUntagged, MACSEC_SECY_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_OUT_PKTS_TOO_LONG,
+			      eg->OutOverSizePkts, MACSEC_SECY_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_IN_PKTS_NO_TAG,
+			      ig->InPktsNoTag, MACSEC_SECY_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_IN_PKTS_BAD_TAG,
+			      ig->InPktsBadTag, MACSEC_SECY_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_IN_PKTS_UNKNOWN_SCI,
+			      ig->InPktsUnknownSCI, MACSEC_SECY_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_SECY_STATS_ATTR_IN_PKTS_NO_SCI,
+			      ig->InPktsNoSCI, MACSEC_SECY_STATS_ATTR_PAD)) {
+		nla_nest_cancel(skb, nest);
+		return -EMSGSIZE;
+	}
+
+	nla_nest_end(skb, nest);
+	return 0;
+}
+
+static int gpy211_fill_rxsa_stats(struct sk_buff *skb, const struct ing_sa_stats *st)
+{
+	struct nlattr *nest;
+
+	nest = nla_nest_start(skb, GPY211_ATTR_RXSA_STATS);
+
+	if (!nest)
+		return -EMSGSIZE;
+
+	if (nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_OCTETS_DECRYPTED,
+			      st->InOctetsDecrypted, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_UNCHECKED,
+			      st->InPktsUnchecked, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_DELAYED,
+			      st->InPktsDelayed, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_OK,
+			      st->InPktsOK, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_INVALID,
+			      st->InPktsInvalid, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_LATE,
+			      st->InPktsLate, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_NOT_VALID,
+			      st->InPktsNotValid, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_NOT_USING_SA,
+			      st->InPktsNotUsingSA, MACSEC_RXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, MACSEC_RXSC_STATS_ATTR_IN_PKTS_UNUSED_SA,
+			      st->InPktsUnusedSA, MACSEC_RXSC_STATS_ATTR_PAD)) {
+		nla_nest_cancel(skb, nest);
+		return -EMSGSIZE;
+	}
+
+	nla_nest_end(skb, nest);
+	return 0;
+}
+
+static int gpy211_fill_txsa_stats(struct sk_buff *skb, const struct egr_sa_stats *st,
+				  bool encrypt)
+{
+	struct nlattr *nest;
+	int pkts, octets;
+
+	pkts = encrypt ? MACSEC_TXSC_STATS_ATTR_OUT_PKTS_ENCRYPTED :
+	       MACSEC_TXSC_STATS_ATTR_OUT_PKTS_PROTECTED;
+	octets = encrypt ? MACSEC_TXSC_STATS_ATTR_OUT_OCTETS_ENCRYPTED :
+		 MACSEC_TXSC_STATS_ATTR_OUT_OCTETS_PROTECTED;
+
+	nest = nla_nest_start(skb, GPY211_ATTR_TXSA_STATS);
+
+	if (!nest)
+		return -EMSGSIZE;
+
+	if (nla_put_u64_64bit(skb, pkts, st->OutPktsEncrypted,
+			      MACSEC_TXSC_STATS_ATTR_PAD) ||
+	    nla_put_u64_64bit(skb, octets, st->OutOctetsEncrypted,
+			      MACSEC_TXSC_STATS_ATTR_PAD)) {
+		nla_nest_cancel(skb, nest);
+		return -EMSGSIZE;
+	}
+
+	nla_nest_end(skb, nest);
+	return 0;
+}
+
+/* One message per entry: SecY globals, then ingress and egress SAs.
+ * cb->args[0]: snapshot taken, cb->args[1]: next entry */
+static int gpy211_fill_stats_entry(struct sk_buff *skb, struct netlink_callback *cb,
+				   struct gpy2xx_priv_data *pdata, u32 pos)
+{
+	u32 nr = min_t(u32, pdata->gdev.nr_of_sas, MACSEC_MAX_SA_RULES);
+	void *hdr;
+	int ret;
+
+	hdr = genlmsg_put(skb, NETLINK_CB(cb->skb).portid, cb->nlh->nlmsg_seq,
+			  &gpy211_genl_family, NLM_F_MULTI, GPY211_CMD_GET_SA_STATS);
+
+	if (!hdr)
+		return -EMSGSIZE;
+
+	if (nla_put_u32(skb, GPY211_ATTR_STATS_AGE,
+			jiffies_to_msecs(jiffies - pdata->stats_stamp)))
+		goto cancel;
+
+	if (pos == 0)
+		ret = gpy211_fill_secy_stats(skb, pdata);
+	else if (pos <= nr)
+		ret = nla_put_u8(skb, GPY211_ATTR_SA_INDEX, pos - 1) ?:
+		      gpy211_fill_rxsa_stats(skb, &pdata->stats.ing_sa[pos - 1]);
+	else
+		ret = nla_put_u8(skb, GPY211_ATTR_SA_INDEX, pos - nr - 1) ?:
+		      gpy211_fill_txsa_stats(skb, &pdata->stats.egr_sa[pos - nr - 1],
+					     pdata->secy.tx_sc.encrypt);
+
+	if (ret)
+		goto cancel;
+
+	genlmsg_end(skb, hdr);
+	return 0;
+
+cancel:
+	genlmsg_cancel(skb, hdr);
+	return -EMSGSIZE;
+}
+
+int gpy211_dump_sa_stats(struct sk_buff *skb, struct netlink_callback *cb)
+{
+	struct nlattr *tb[GPY211_ATTR_MAX + 1];
+	struct gpy2xx_priv_data *pdata;
+	u32 max_age = GPY211_STATS_DEF_MAX_AGE_MS;
+	u32 pos, nr;
+	int ret;
+
+	pdata = (struct gpy2xx_priv_data *)platform_get_drvdata(gpy212_data.pdev[0]);
+
+	if (!pdata)
+		return -ENODEV;
+
+	mutex_lock(&pdata->stats_lock);
+
+	if (!cb->args[0]) {
+		if (!nlmsg_parse(cb->nlh, GENL_HDRLEN + gpy211_genl_family.hdrsize, tb,
+				 GPY211_ATTR_MAX, gpy211_genl_policy, NULL) &&
+		    tb[GPY211_ATTR_MAX_AGE])
+			max_age = nla_get_u32(tb[GPY211_ATTR_MAX_AGE]);
+
+		ret = gpy211_stats_refresh(pdata, max_age);
+
+		if (ret < 0) {
+			mutex_unlock(&pdata->stats_lock);
+			return ret;
+		}
+
+		cb->args[0] = 1;
+	}
+
+	nr = min_t(u32, pdata->gdev.nr_of_sas, MACSEC_MAX_SA_RULES);
+
+	for (pos = cb->args[1]; pos <= 2 * nr; pos++) {
+		if (gpy211_fill_stats_entry(skb, cb, pdata, pos))
+			break;
+	}
+
+	cb->args[1] = pos;
+	mutex_unlock(&pdata->stats_lock);
+
+	return skb->len;
+}
+
+static const struct genl_ops gpy211_genl_ops[] = {
+	{
+		.cmd = GPY211_CMD_ADD_RX_BULK,
+		.doit = gpy211_add_rx_bulk,
+		.policy = gpy211_genl_policy,
+		.flags = GENL_ADMIN_PERM,
+	},
+	{
+		.cmd = GPY211_CMD_GET_SA_STATS,
+		.dumpit = gpy211_dump_sa_stats,
+		.policy = gpy211_genl_policy,
+	},
+};
+
+static struct genl_family gpy211_genl_family __ro_after_init = {
+	.name = GPY211_GENL_NAME,
+	.hdrsize = 0,
+	.version = GPY211_GENL_VERSION,
+	.maxattr = GPY211_ATTR_MAX,
+	.netnsok = true,
+	.module = THIS_MODULE,
+	.ops = gpy211_genl_ops,
+	.n_ops = ARRAY_SIZE(gpy211_genl_ops),
+};
+
+int gpy211_genl_register(void)
+{
+	return genl_register_family(&gpy211_genl_family);
+}
+
+void gpy211_genl_unregister(void)
+{
+	genl_unregister_family(&gpy211_genl_family);
+}
+
 void gpy211_macsec_postdoit(const struct genl_ops *ops,
 			    struct sk_buff *skb,
 			    struct genl_info *info)
@@ -13,15 +13,72 @@
 
 #include <linux/types.h>
 #include <uapi/linux/if_macsec.h>
+#ifdef __KERNEL__
+#include <linux/hashtable.h>
+#include <linux/mutex.h>
+#include <linux/rcupdate.h>
+#endif
 //#include <net/gpy211/gpy211_ops.h>
 
 #include "gpy211.h"
 #include "gpy211_macsec.h"
+#include "gpy211_macsec_harvest.h"
 
 typedef u64 __bitwise sci_t;
 
 #define MACSEC_VALIDATE_DEFAULT MACSEC_VALIDATE_STRICT
 
+/* RX SCs are hashed by SCI, 2^6 buckets */
+#define GPY211_RX_SC_HASH_BITS 6
+
+/* GPY211 generic netlink family for bulk requests */
+#define GPY211_GENL_NAME "gpy211_macsec"
+#define GPY211_GENL_VERSION 1
+/* Max RX SC/SA entries of one bulk request */
+#define GPY211_BULK_MAX_ENTRIES 512
+/* Default max age (ms) of the SA statistics snapshot served by dumps */
+#define GPY211_STATS_DEF_MAX_AGE_MS 1000
+
+enum gpy211_genl_cmd {
+	GPY211_CMD_UNSPEC,
+	/* Add RX SCs and RX SAs listed in GPY211_ATTR_BULK_LIST */
+	GPY211_CMD_ADD_RX_BULK,
+	/* Dump SecY global and per-SA statistics */
+	GPY211_CMD_GET_SA_STATS,
+	__GPY211_CMD_MAX,
+	GPY211_CMD_MAX = __GPY211_CMD_MAX - 1,
+};
+
+enum gpy211_genl_attr {
+	GPY211_ATTR_UNSPEC,
+	/* u32, ifindex of the MACsec netdev */
+	GPY211_ATTR_IFINDEX,
+	/* nested, list of GPY211_ATTR_BULK_ENTRY */
+	GPY211_ATTR_BULK_LIST,
+	/* u32, number of entries applied (reply) */
+	GPY211_ATTR_BULK_DONE,
+	/* u32, max age (ms) of the statistics snapshot accepted (request) */
+	GPY211_ATTR_MAX_AGE,
+	/* u32, age (ms) of the statistics snapshot dumped */
+	GPY211_ATTR_STATS_AGE,
+	/* u8, hardware SA index */
+	GPY211_ATTR_SA_INDEX,
+	/* nested, MACSEC_RXSC_STATS_ATTR_* of an ingress SA */
+	GPY211_ATTR_RXSA_STATS,
+	/* nested, MACSEC_TXSC_STATS_ATTR_* of an egress SA */
+	GPY211_ATTR_TXSA_STATS,
+	/* nested, MACSEC_SECY_STATS_ATTR_* from global counters */
+	GPY211_ATTR_SECY_STATS,
+	/* pad for 64-bit attributes */
+	GPY211_ATTR_PAD,
+	__GPY211_ATTR_MAX,
+	GPY211_ATTR_MAX = __GPY211_ATTR_MAX - 1,
+};
+
+/* Bulk entry: MACSEC_ATTR_RXSC_CONFIG adds an RX SC, with
+ * MACSEC_ATTR_SA_CONFIG added it installs an RX SA on that SC */
+#define GPY211_ATTR_BULK_ENTRY 1
+
 /**
  * struct gpy211_macsec_key - SA key
  * id: user-provided key identifier
@@ -40,6 +97,8 @@ struct gpy211_macsec_key {
  * active: channel is active
  * sa: array of secure associations
  * stats: per-SC stats
+ * hnode: entry in the SCI hash of the SecY
+ * rcu: deferred free, readers may still walk the hash
  */
 struct gpy211_macsec_rx_sc {
 	struct gpy211_macsec_rx_sc *next;
@@ -48,6 +107,8 @@ struct gpy211_macsec_rx_sc {
 	struct gpy211_macsec_rx_sa *sa[MACSEC_MAX_AN];
 #ifdef __KERNEL__
 	atomic_t refcnt;
+	struct hlist_node hnode;
+	struct rcu_head rcu;
 #endif
 };
 
@@ -119,6 +180,7 @@ struct gpy211_macsec_tx_sc {
  * replay_window: size of the replay window
  * tx_sc: transmit secure channel
  * rx_sc: linked list of receive secure channels
+ * rx_sc_hash: receive secure channels hashed by SCI
  */
 struct gpy211_macsec_secy {
 #ifdef __KERNEL__
@@ -135,6 +197,9 @@ struct gpy211_macsec_secy {
 	u32 replay_window;
 	struct gpy211_macsec_tx_sc tx_sc;
 	struct gpy211_macsec_rx_sc *rx_sc;
+#ifdef __KERNEL__
+	DECLARE_HASHTABLE(rx_sc_hash, GPY211_RX_SC_HASH_BITS);
+#endif
 };
 
 /** \addtogroup GPY211_MSEC_TOP */
@@ -199,6 +264,13 @@ struct gpy2xx_priv_data {
 #endif
 
 	struct gpy211_macsec_secy secy;
+#ifdef __KERNEL__
+	/* Statistics snapshot served by GPY211_CMD_GET_SA_STATS */
+	struct mutex stats_lock;
+	struct msec_harvest stats;
+	unsigned long stats_stamp;
+	bool stats_valid;
+#endif
 #if defined(SUPPORT_GPY2XX_OPS) && SUPPORT_GPY2XX_OPS
 	struct gpy211_gphy_ops ops;
 #endif
@@ -17,6 +17,7 @@
 
 #include "gpy211_common.h"
 #include "gpy211_macsec.h"
+#include "gpy211_macsec_alloc.h"
 #include "gpy211_regs.h"
 
 #if defined(SAFE_C_LIB) && SAFE_C_LIB
@@ -28,10 +29,7 @@ errno_t memcpy_s(void *restrict dest, rsize_t dmax, const void *restrict src,
 //This func def is present in drivers\net\ethernet\intel\macsec\aes_crypto.c
 int derive_aes_hkey(const u8 *key, u8 *output, u32 keylen);
 #else
-//This func def is present in GPY211\ISC-DDK-160-BSD_v2.3\SafeXcel-IP-160_DDK_v2.3\Kit\SABuilder_MACsec\Example_AES\src\aes.c
-void
-AES_Encrypt(const unsigned char *const pInput, unsigned char *const pOutput,
-	    const unsigned char *const pKey, unsigned int nKeyLen);
+#include "gpy211_macsec_aes.h"
 #endif
 
 static int _is_sam_in_flight_safe(struct gpy211_device *phy, enum msec_dir dir)
@@ -1576,11 +1574,6 @@ int gpy2xx_msec_config_ing_tr(struct gpy211_device *phy,
 	u32 le_key[MACSEC_CA256_KEY_LEN_WORD], le_hkey[MACSEC_HKEY_LEN_WORD];
 	u32 le_iv[MACSEC_SCI_LEN_WORD], le_ctx_salt[MACSEC_CSALT_LEN_WORD];
 	u32 *_tr = NULL;
-#ifndef __KERNEL__
-	u8 hkeyinput[1][16] = {
-		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
-	};
-#endif
 	LOG_INFO("Entering func name :- %s\n", __func__);
 
 	if (phy == NULL || in_tr == NULL) {
@@ -1618,11 +1611,22 @@ int gpy2xx_msec_config_ing_tr(struct gpy211_device *phy,
 	ret = _gpy2xx_msec_pop_key(&in_tr->cp, le_key);
 	_key_len = ((in_tr->ccw.ca_type == GCM_AES_128) ||
 		    (in_tr->ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32;
+
+	/* Hash key may be precomputed for bulk SA installs */
+	if (!in_tr->cp.hkey_valid) {
 #ifdef __KERNEL__
-	derive_aes_hkey(in_tr->cp.key, in_tr->cp.hkey, _key_len);
+		ret = derive_aes_hkey(in_tr->cp.key, in_tr->cp.hkey, _key_len);
 #else
-	AES_Encrypt((u8 *)hkeyinput, in_tr->cp.hkey, in_tr->cp.key, _key_len);
+		ret = gpy2xx_msec_derive_hkey(in_tr->cp.key, _key_len, in_tr->cp.hkey);
 #endif
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: hash key derivation fails\n");
+			goto END;
+		}
+	}
+
+	in_tr->cp.hkey_valid = 0;
 	ret = _gpy2xx_msec_pop_hkey(&in_tr->cp, le_hkey);
 
 #if defined(DEBUG_MSEC_PRINT) && DEBUG_MSEC_PRINT
@@ -1807,7 +1811,9 @@ END:
 
 #if !defined(NO_TARGET_TEST)
 	phy->unlock(phy->lock_data);
-	ret = 0;
+
+	if (ret > 0)
+		ret = 0;
 #endif
 
 	LOG_INFO("Exiting func name :- %s\n", __func__);
@@ -1827,11 +1833,6 @@ int gpy2xx_msec_config_egr_tr(struct gpy211_device *phy,
 	u32 le_key[MACSEC_CA256_KEY_LEN_WORD], le_hkey[MACSEC_HKEY_LEN_WORD];
 	u32 le_iv[MACSEC_SCI_LEN_WORD], le_ctx_salt[MACSEC_CSALT_LEN_WORD];
 	u32 *_tr = NULL;
-#ifndef __KERNEL__
-	u8 hkeyinput[1][16] = {
-		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
-	};
-#endif
 	LOG_INFO("Entering func name :- %s\n", __func__);
 
 	if (phy == NULL || in_tr == NULL) {
@@ -1868,11 +1869,22 @@ int gpy2xx_msec_config_egr_tr(struct gpy211_device *phy,
 	ret = _gpy2xx_msec_pop_key(&in_tr->cp, le_key);
 	_key_len = ((in_tr->ccw.ca_type == GCM_AES_128) ||
 		    (in_tr->ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32;
+
+	/* Hash key may be precomputed for bulk SA installs */
+	if (!in_tr->cp.hkey_valid) {
 #ifdef __KERNEL__
-	derive_aes_hkey(in_tr->cp.key, in_tr->cp.hkey, _key_len);
+		ret = derive_aes_hkey(in_tr->cp.key, in_tr->cp.hkey, _key_len);
 #else
-	AES_Encrypt((u8 *)hkeyinput, in_tr->cp.hkey, in_tr->cp.key, _key_len);
+		ret = gpy2xx_msec_derive_hkey(in_tr->cp.key, _key_len, in_tr->cp.hkey);
 #endif
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: hash key derivation fails\n");
+			goto END;
+		}
+	}
+
+	in_tr->cp.hkey_valid = 0;
 	ret = _gpy2xx_msec_pop_hkey(&in_tr->cp, le_hkey);
 #if defined(DEBUG_MSEC_PRINT) && DEBUG_MSEC_PRINT
 	char keystr[MACSEC_KEY_LEN_BYTE * 2 + 1] = "\0";
@@ -2031,7 +2043,9 @@ END:
 
 #if !defined(NO_TARGET_TEST)
 	phy->unlock(phy->lock_data);
-	ret = 0;
+
+	if (ret > 0)
+		ret = 0;
 #endif
 
 	LOG_INFO("Exiting func name :- %s\n", __func__);
@@ -2437,6 +2451,9 @@ int gpy2xx_msec_clear_ing_tr(struct gpy211_device *phy,
 		}
 	}
 
+	/* Keep index allocator consistent */
+	_gpy2xx_msec_idx_release(phy, MSEC_IDX_ING_SA, in_tr->sa_index);
+
 END:
 
 	if (_tr != NULL) {
@@ -2505,6 +2522,9 @@ int gpy2xx_msec_clear_egr_tr(struct gpy211_device *phy,
 		}
 	}
 
+	/* Keep index allocator consistent */
+	_gpy2xx_msec_idx_release(phy, MSEC_IDX_EGR_SA, in_tr->sa_index);
+
 END:
 
 	if (_tr != NULL) {
@@ -2886,6 +2906,9 @@ int gpy2xx_msec_clear_ing_sam_rule(struct gpy211_device *phy,
 		}
 	}
 
+	/* Keep index allocator consistent */
+	_gpy2xx_msec_idx_release(phy, MSEC_IDX_ING_RULE, in_sam->rule_index);
+
 END:
 
 	if (_sam != NULL) {
@@ -2954,6 +2977,9 @@ int gpy2xx_msec_clear_egr_sam_rule(struct gpy211_device *phy,
 		}
 	}
 
+	/* Keep index allocator consistent */
+	_gpy2xx_msec_idx_release(phy, MSEC_IDX_EGR_RULE, in_sam->rule_index);
+
 END:
 
 	if (_sam != NULL) {
@@ -5979,7 +6005,7 @@ int gpy2xx_msec_config_ing_cp_rule(struct gpy211_device *phy,
 		_cpc_rule[1] = ((in_cpc->mac_da[4] << 00) | (in_cpc->mac_da[5] <<  8));
 		_offset = 0;
 	} else if (in_cpc->cpc_type == CPC_ENTRY_ETH) {
-		if ((in_cpc->cpc_index < 10) || (in_cpc->cpc_index < 17)) {
+		if ((in_cpc->cpc_index < 10) || (in_cpc->cpc_index > 17)) {
 			LOG_WARN("WARN: Invalid input (entry_num) - CPC ETH num\n");
 			ret = -EINVAL;
 			goto END;
@@ -6118,7 +6144,7 @@ int gpy2xx_msec_config_egr_cp_rule(struct gpy211_device *phy,
 		_cpc_rule[1] = ((in_cpc->mac_da[4] << 00) | (in_cpc->mac_da[5] <<  8));
 		_offset = 0;
 	} else if (in_cpc->cpc_type == CPC_ENTRY_ETH) {
-		if ((in_cpc->cpc_index < 10) || (in_cpc->cpc_index < 17)) {
+		if ((in_cpc->cpc_index < 10) || (in_cpc->cpc_index > 17)) {
 			LOG_WARN("WARN: Invalid input (entry_num) - CPC ETH num\n");
 			ret = -EINVAL;
 			goto END;
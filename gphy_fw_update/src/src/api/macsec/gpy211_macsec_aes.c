@@ -0,0 +1,519 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef __KERNEL__
+
+#include <pthread.h>
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_aes.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define AES_HW_X86 1
+#elif defined(__aarch64__) && defined(__AARCH64EL__) && defined(__GNUC__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#include <arm_neon.h>
+#define AES_HW_ARM64 1
+#endif
+
+#define AES_GETU32(p) (((u32)(p)[0] << 24) | ((u32)(p)[1] << 16) | \
+		       ((u32)(p)[2] << 8) | ((u32)(p)[3]))
+#define AES_PUTU32(p, v) do { \
+		(p)[0] = (u8)((v) >> 24); \
+		(p)[1] = (u8)((v) >> 16); \
+		(p)[2] = (u8)((v) >> 8); \
+		(p)[3] = (u8)(v); \
+	} while (0)
+#define AES_ROR32(v, n) (((v) >> (n)) | ((v) << (32 - (n))))
+#define AES_XTIME(x) ((u8)(((x) << 1) ^ (((x) & 0x80) ? 0x1B : 0)))
+
+typedef void (*aes_enc_fn)(const struct msec_aes_ctx *ctx, const u8 *in,
+			   u8 *out);
+typedef void (*aes_ctr_fn)(const struct msec_aes_ctx *ctx, u8 *ctr,
+			   const u8 *in, u8 *out, u32 nblk);
+
+static u8 aes_sbox[256];
+static u32 aes_te[4][256];
+static aes_enc_fn aes_enc;
+static aes_ctr_fn aes_ctr;
+static pthread_once_t aes_once = PTHREAD_ONCE_INIT;
+
+static const u8 aes_rcon[10] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+static void _aes_gen_tables(void)
+{
+	u8 p = 1, q = 1, s;
+	u32 i, t;
+
+	/* S-box from multiplicative inverse (p * q = 1, 3 is a generator) */
+	do {
+		p = p ^ AES_XTIME(p);
+		q ^= q << 1;
+		q ^= q << 2;
+		q ^= q << 4;
+
+		if (q & 0x80)
+			q ^= 0x09;
+
+		s = q ^ (u8)((q << 1) | (q >> 7)) ^ (u8)((q << 2) | (q >> 6)) ^
+		    (u8)((q << 3) | (q >> 5)) ^ (u8)((q << 4) | (q >> 4));
+		aes_sbox[p] = s ^ 0x63;
+	} while (p != 1);
+
+	aes_sbox[0] = 0x63;
+
+	/* Te0 = {2s, s, s, 3s}, Te1..Te3 are byte rotations of Te0 */
+	for (i = 0; i < 256; i++) {
+		s = aes_sbox[i];
+		t = ((u32)AES_XTIME(s) << 24) | ((u32)s << 16) | ((u32)s << 8) |
+		    (u32)(AES_XTIME(s) ^ s);
+		aes_te[0][i] = t;
+		aes_te[1][i] = AES_ROR32(t, 8);
+		aes_te[2][i] = AES_ROR32(t, 16);
+		aes_te[3][i] = AES_ROR32(t, 24);
+	}
+}
+
+static void _aes_encrypt_ttable(const struct msec_aes_ctx *ctx, const u8 *in,
+				u8 *out)
+{
+	u32 r, s0, s1, s2, s3, t0, t1, t2, t3;
+	const u32 *rk = ctx->rk;
+
+	s0 = AES_GETU32(in) ^ rk[0];
+	s1 = AES_GETU32(in + 4) ^ rk[1];
+	s2 = AES_GETU32(in + 8) ^ rk[2];
+	s3 = AES_GETU32(in + 12) ^ rk[3];
+
+	for (r = 1; r < ctx->nr; r++) {
+		rk += 4;
+		t0 = aes_te[0][s0 >> 24] ^ aes_te[1][(s1 >> 16) & 0xFF] ^
+		     aes_te[2][(s2 >> 8) & 0xFF] ^ aes_te[3][s3 & 0xFF] ^ rk[0];
+		t1 = aes_te[0][s1 >> 24] ^ aes_te[1][(s2 >> 16) & 0xFF] ^
+		     aes_te[2][(s3 >> 8) & 0xFF] ^ aes_te[3][s0 & 0xFF] ^ rk[1];
+		t2 = aes_te[0][s2 >> 24] ^ aes_te[1][(s3 >> 16) & 0xFF] ^
+		     aes_te[2][(s0 >> 8) & 0xFF] ^ aes_te[3][s1 & 0xFF] ^ rk[2];
+		t3 = aes_te[0][s3 >> 24] ^ aes_te[1][(s0 >> 16) & 0xFF] ^
+		     aes_te[2][(s1 >> 8) & 0xFF] ^ aes_te[3][s2 & 0xFF] ^ rk[3];
+		s0 = t0;
+		s1 = t1;
+		s2 = t2;
+		s3 = t3;
+	}
+
+	/* Last round without MixColumns */
+	rk += 4;
+	t0 = ((u32)aes_sbox[s0 >> 24] << 24) ^ ((u32)aes_sbox[(s1 >> 16) & 0xFF] << 16) ^
+	     ((u32)aes_sbox[(s2 >> 8) & 0xFF] << 8) ^ (u32)aes_sbox[s3 & 0xFF] ^ rk[0];
+	t1 = ((u32)aes_sbox[s1 >> 24] << 24) ^ ((u32)aes_sbox[(s2 >> 16) & 0xFF] << 16) ^
+	     ((u32)aes_sbox[(s3 >> 8) & 0xFF] << 8) ^ (u32)aes_sbox[s0 & 0xFF] ^ rk[1];
+	t2 = ((u32)aes_sbox[s2 >> 24] << 24) ^ ((u32)aes_sbox[(s3 >> 16) & 0xFF] << 16) ^
+	     ((u32)aes_sbox[(s0 >> 8) & 0xFF] << 8) ^ (u32)aes_sbox[s1 & 0xFF] ^ rk[2];
+	t3 = ((u32)aes_sbox[s3 >> 24] << 24) ^ ((u32)aes_sbox[(s0 >> 16) & 0xFF] << 16) ^
+	     ((u32)aes_sbox[(s1 >> 8) & 0xFF] << 8) ^ (u32)aes_sbox[s2 & 0xFF] ^ rk[3];
+
+	AES_PUTU32(out, t0);
+	AES_PUTU32(out + 4, t1);
+	AES_PUTU32(out + 8, t2);
+	AES_PUTU32(out + 12, t3);
+}
+
+/* Increment the last 32-bit word (big-endian) of a counter block */
+static void _aes_inc32(u8 *ctr)
+{
+	u32 c = AES_GETU32(ctr + 12) + 1;
+
+	AES_PUTU32(ctr + 12, c);
+}
+
+static void _aes_ctr_generic(const struct msec_aes_ctx *ctx, u8 *ctr,
+			     const u8 *in, u8 *out, u32 nblk)
+{
+	u32 i;
+	u8 ks[MSEC_AES_BLOCK_LEN];
+
+	for (; nblk > 0; nblk--) {
+		aes_enc(ctx, ctr, ks);
+		_aes_inc32(ctr);
+
+		for (i = 0; i < MSEC_AES_BLOCK_LEN; i++)
+			out[i] = in[i] ^ ks[i];
+
+		in += MSEC_AES_BLOCK_LEN;
+		out += MSEC_AES_BLOCK_LEN;
+	}
+}
+
+#if defined(AES_HW_X86) && AES_HW_X86
+__attribute__((target("aes,ssse3")))
+static void _aes_encrypt_aesni(const struct msec_aes_ctx *ctx, const u8 *in,
+			       u8 *out)
+{
+	u32 r;
+	/* Round keys are stored as big-endian words */
+	const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+					   4, 5, 6, 7, 0, 1, 2, 3);
+	__m128i b = _mm_loadu_si128((const __m128i *)in);
+
+#define AESNI_RK(n) _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&ctx->rk[4 * (n)]), bswap)
+	b = _mm_xor_si128(b, AESNI_RK(0));
+
+	for (r = 1; r < ctx->nr; r++)
+		b = _mm_aesenc_si128(b, AESNI_RK(r));
+
+	b = _mm_aesenclast_si128(b, AESNI_RK(ctx->nr));
+#undef AESNI_RK
+
+	_mm_storeu_si128((__m128i *)out, b);
+}
+
+/* Four blocks in flight to hide the AESENC latency */
+__attribute__((target("aes,ssse3")))
+static void _aes_ctr_aesni(const struct msec_aes_ctx *ctx, u8 *ctr,
+			   const u8 *in, u8 *out, u32 nblk)
+{
+	u32 i, r, c = AES_GETU32(ctr + 12);
+	const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+					   4, 5, 6, 7, 0, 1, 2, 3);
+	__m128i rk[MSEC_AES_MAX_RK_WORDS / 4], b[4];
+	u8 cb[4][MSEC_AES_BLOCK_LEN];
+
+	for (r = 0; r <= ctx->nr; r++)
+		rk[r] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&ctx->rk[4 * r]), bswap);
+
+	for (i = 0; i < 4; i++)
+		memcpy(cb[i], ctr, 12);
+
+	for (; nblk >= 4; nblk -= 4) {
+		for (i = 0; i < 4; i++) {
+			AES_PUTU32(cb[i] + 12, c + i);
+			b[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)cb[i]), rk[0]);
+		}
+
+		for (r = 1; r < ctx->nr; r++) {
+			b[0] = _mm_aesenc_si128(b[0], rk[r]);
+			b[1] = _mm_aesenc_si128(b[1], rk[r]);
+			b[2] = _mm_aesenc_si128(b[2], rk[r]);
+			b[3] = _mm_aesenc_si128(b[3], rk[r]);
+		}
+
+		for (i = 0; i < 4; i++) {
+			b[i] = _mm_aesenclast_si128(b[i], rk[ctx->nr]);
+			b[i] = _mm_xor_si128(b[i], _mm_loadu_si128((const __m128i *)(in + 16 * i)));
+			_mm_storeu_si128((__m128i *)(out + 16 * i), b[i]);
+		}
+
+		c += 4;
+		in += 4 * MSEC_AES_BLOCK_LEN;
+		out += 4 * MSEC_AES_BLOCK_LEN;
+	}
+
+	AES_PUTU32(ctr + 12, c);
+	_aes_ctr_generic(ctx, ctr, in, out, nblk);
+}
+
+static int _aes_hw_supported(void)
+{
+	u32 eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return 0;
+
+	return (ecx & bit_AES) && (ecx & bit_SSSE3);
+}
+
+static aes_enc_fn _aes_hw_fn(void)
+{
+	return _aes_encrypt_aesni;
+}
+
+static aes_ctr_fn _aes_hw_ctr_fn(void)
+{
+	return _aes_ctr_aesni;
+}
+#elif defined(AES_HW_ARM64) && AES_HW_ARM64
+__attribute__((target("+crypto")))
+static void _aes_encrypt_armce(const struct msec_aes_ctx *ctx, const u8 *in,
+			       u8 *out)
+{
+	u32 r;
+	uint8x16_t b = vld1q_u8(in);
+
+	/* Round keys are stored as big-endian words */
+#define ARMCE_RK(n) vrev32q_u8(vld1q_u8((const u8 *)&ctx->rk[4 * (n)]))
+
+	/* AESE = AddRoundKey + SubBytes + ShiftRows */
+	for (r = 0; r < ctx->nr - 1; r++)
+		b = vaesmcq_u8(vaeseq_u8(b, ARMCE_RK(r)));
+
+	b = vaeseq_u8(b, ARMCE_RK(ctx->nr - 1));
+	b = veorq_u8(b, ARMCE_RK(ctx->nr));
+#undef ARMCE_RK
+
+	vst1q_u8(out, b);
+}
+
+/* Four blocks in flight to hide the AESE/AESMC latency */
+__attribute__((target("+crypto")))
+static void _aes_ctr_armce(const struct msec_aes_ctx *ctx, u8 *ctr,
+			   const u8 *in, u8 *out, u32 nblk)
+{
+	u32 i, r, c = AES_GETU32(ctr + 12);
+	uint8x16_t rk[MSEC_AES_MAX_RK_WORDS / 4], b[4];
+	u8 cb[4][MSEC_AES_BLOCK_LEN];
+
+	for (r = 0; r <= ctx->nr; r++)
+		rk[r] = vrev32q_u8(vld1q_u8((const u8 *)&ctx->rk[4 * r]));
+
+	for (i = 0; i < 4; i++)
+		memcpy(cb[i], ctr, 12);
+
+	for (; nblk >= 4; nblk -= 4) {
+		for (i = 0; i < 4; i++) {
+			AES_PUTU32(cb[i] + 12, c + i);
+			b[i] = vld1q_u8(cb[i]);
+		}
+
+		for (r = 0; r < ctx->nr - 1; r++) {
+			b[0] = vaesmcq_u8(vaeseq_u8(b[0], rk[r]));
+			b[1] = vaesmcq_u8(vaeseq_u8(b[1], rk[r]));
+			b[2] = vaesmcq_u8(vaeseq_u8(b[2], rk[r]));
+			b[3] = vaesmcq_u8(vaeseq_u8(b[3], rk[r]));
+		}
+
+		for (i = 0; i < 4; i++) {
+			b[i] = veorq_u8(vaeseq_u8(b[i], rk[ctx->nr - 1]), rk[ctx->nr]);
+			vst1q_u8(out + 16 * i, veorq_u8(b[i], vld1q_u8(in + 16 * i)));
+		}
+
+		c += 4;
+		in += 4 * MSEC_AES_BLOCK_LEN;
+		out += 4 * MSEC_AES_BLOCK_LEN;
+	}
+
+	AES_PUTU32(ctr + 12, c);
+	_aes_ctr_generic(ctx, ctr, in, out, nblk);
+}
+
+static int _aes_hw_supported(void)
+{
+	return (getauxval(AT_HWCAP) & HWCAP_AES) ? 1 : 0;
+}
+
+static aes_enc_fn _aes_hw_fn(void)
+{
+	return _aes_encrypt_armce;
+}
+
+static aes_ctr_fn _aes_hw_ctr_fn(void)
+{
+	return _aes_ctr_armce;
+}
+#else
+static int _aes_hw_supported(void)
+{
+	return 0;
+}
+
+static aes_enc_fn _aes_hw_fn(void)
+{
+	return _aes_encrypt_ttable;
+}
+
+static aes_ctr_fn _aes_hw_ctr_fn(void)
+{
+	return _aes_ctr_generic;
+}
+#endif
+
+static void _aes_init(void)
+{
+	_aes_gen_tables();
+
+	if (_aes_hw_supported()) {
+		aes_ctr = _aes_hw_ctr_fn();
+		aes_enc = _aes_hw_fn();
+	} else {
+		aes_ctr = _aes_ctr_generic;
+		aes_enc = _aes_encrypt_ttable;
+	}
+}
+
+/* Tables and function pointers are published to every caller */
+static void _aes_init_once(void)
+{
+	pthread_once(&aes_once, _aes_init);
+}
+
+int gpy2xx_msec_aes_use_hw(int enable)
+{
+	_aes_init_once();
+
+	if (!enable) {
+		aes_ctr = _aes_ctr_generic;
+		aes_enc = _aes_encrypt_ttable;
+		return 0;
+	}
+
+	if (!_aes_hw_supported())
+		return -ENOTSUP;
+
+	aes_ctr = _aes_hw_ctr_fn();
+	aes_enc = _aes_hw_fn();
+	return 0;
+}
+
+/* Clear key material, not to be optimized away */
+static void _aes_wipe(void *p, u32 len)
+{
+	memset(p, 0, len);
+	__asm__ __volatile__("" : : "r"(p) : "memory");
+}
+
+int gpy2xx_msec_aes_setkey(struct msec_aes_ctx *ctx, const u8 *key, u32 keylen)
+{
+	u32 i, t, nk, nw;
+
+	if (ctx == NULL || key == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate Key length */
+	if ((keylen != 16) && (keylen != 32)) {
+		LOG_WARN("WARN: Invalid input (keylen) - AES key length\n");
+		return -EINVAL;
+	}
+
+	_aes_init_once();
+
+	nk = keylen / 4;
+	ctx->nr = nk + 6;
+	nw = 4 * (ctx->nr + 1);
+
+	for (i = 0; i < nk; i++)
+		ctx->rk[i] = AES_GETU32(key + 4 * i);
+
+	for (i = nk; i < nw; i++) {
+		t = ctx->rk[i - 1];
+
+		if ((i % nk) == 0) {
+			/* SubWord(RotWord(t)) ^ Rcon */
+			t = ((u32)aes_sbox[(t >> 16) & 0xFF] << 24) |
+			    ((u32)aes_sbox[(t >> 8) & 0xFF] << 16) |
+			    ((u32)aes_sbox[t & 0xFF] << 8) |
+			    (u32)aes_sbox[t >> 24];
+			t ^= (u32)aes_rcon[i / nk - 1] << 24;
+		} else if ((nk == 8) && ((i % nk) == 4)) {
+			t = ((u32)aes_sbox[t >> 24] << 24) |
+			    ((u32)aes_sbox[(t >> 16) & 0xFF] << 16) |
+			    ((u32)aes_sbox[(t >> 8) & 0xFF] << 8) |
+			    (u32)aes_sbox[t & 0xFF];
+		}
+
+		ctx->rk[i] = ctx->rk[i - nk] ^ t;
+	}
+
+	return 0;
+}
+
+void gpy2xx_msec_aes_encrypt(const struct msec_aes_ctx *ctx, const u8 *in,
+			     u8 *out)
+{
+	aes_enc(ctx, in, out);
+}
+
+void gpy2xx_msec_aes_ctr32(const struct msec_aes_ctx *ctx, u8 *ctr,
+			   const u8 *in, u8 *out, u32 len)
+{
+	u32 i, nblk = len / MSEC_AES_BLOCK_LEN;
+	u8 ks[MSEC_AES_BLOCK_LEN];
+
+	if (nblk) {
+		aes_ctr(ctx, ctr, in, out, nblk);
+		in += nblk * MSEC_AES_BLOCK_LEN;
+		out += nblk * MSEC_AES_BLOCK_LEN;
+		len -= nblk * MSEC_AES_BLOCK_LEN;
+	}
+
+	if (len) {
+		aes_enc(ctx, ctr, ks);
+		_aes_inc32(ctr);
+
+		for (i = 0; i < len; i++)
+			out[i] = in[i] ^ ks[i];
+
+		_aes_wipe(ks, sizeof(ks));
+	}
+}
+
+int gpy2xx_msec_derive_hkey(const u8 *key, u32 keylen, u8 *hkey)
+{
+	int ret;
+	struct msec_aes_ctx ctx;
+	static const u8 zero_blk[MSEC_AES_BLOCK_LEN];
+
+	if (hkey == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	ret = gpy2xx_msec_aes_setkey(&ctx, key, keylen);
+
+	if (ret < 0)
+		return ret;
+
+	gpy2xx_msec_aes_encrypt(&ctx, zero_blk, hkey);
+	_aes_wipe(&ctx, sizeof(ctx));
+
+	return 0;
+}
+
+int gpy2xx_msec_derive_hkey_batch(struct transform_rec *tr, u32 num)
+{
+	int ret = 0;
+	u32 i, keylen, prev_keylen = 0;
+	struct msec_aes_ctx ctx;
+	const u8 *prev_key = NULL;
+	static const u8 zero_blk[MSEC_AES_BLOCK_LEN];
+
+	if (tr == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < num; i++) {
+		keylen = ((tr[i].ccw.ca_type == GCM_AES_128) ||
+			  (tr[i].ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32;
+
+		/* Expand the key only when it differs from the previous entry */
+		if ((prev_key == NULL) || (keylen != prev_keylen) ||
+		    memcmp(prev_key, tr[i].cp.key, keylen)) {
+			ret = gpy2xx_msec_aes_setkey(&ctx, tr[i].cp.key, keylen);
+
+			if (ret < 0)
+				break;
+
+			prev_key = tr[i].cp.key;
+			prev_keylen = keylen;
+		}
+
+		gpy2xx_msec_aes_encrypt(&ctx, zero_blk, tr[i].cp.hkey);
+		tr[i].cp.hkey_valid = 1;
+	}
+
+	_aes_wipe(&ctx, sizeof(ctx));
+
+	return ret;
+}
+
+#endif /* __KERNEL__ */
@@ -0,0 +1,456 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/module.h>
+#endif
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_alloc.h"
+
+#define IDX_WORD(idx) ((idx) >> 5)
+#define IDX_BIT(idx) (1u << ((idx) & 31))
+
+static struct msec_idx_alloc *_idx_get(struct gpy211_device *phy)
+{
+	return phy->msec_idx;
+}
+
+/* Mask of indices below nr_idx in word w */
+static u32 _idx_valid(const struct msec_idx_alloc *ia, u32 w)
+{
+	u32 base = w * 32;
+
+	if (base + 32 <= ia->nr_idx)
+		return 0xFFFFFFFF;
+
+	if (base >= ia->nr_idx)
+		return 0;
+
+	return IDX_BIT(ia->nr_idx) - 1;
+}
+
+/* Free indices of word w in all pools of pool_mask, taking SecY reservations
+   (secy_rsvd) or unreserved indices (secy_rsvd == 0) */
+static u32 _idx_cand(const struct msec_idx_alloc *ia, u8 secy, u8 pool_mask,
+		     u32 w, u8 secy_rsvd)
+{
+	u32 p, cand = _idx_valid(ia, w);
+
+	for (p = 0; p < MSEC_IDX_POOL_NUM; p++) {
+		if (!(pool_mask & (1 << p)))
+			continue;
+
+		cand &= ~ia->used[p][w];
+
+		if (secy_rsvd)
+			cand &= ia->secy_rsvd[secy][p][w];
+		else
+			cand &= ~ia->rsvd[p][w];
+	}
+
+	return cand;
+}
+
+static int _idx_find(const struct msec_idx_alloc *ia, u8 secy, u8 pool_mask)
+{
+	u32 w, cand;
+
+	/* Reserved indices of the SecY first */
+	for (w = 0; w < MSEC_IDX_WORDS; w++) {
+		cand = _idx_cand(ia, secy, pool_mask, w, 1);
+
+		if (cand)
+			return (w * 32) + __builtin_ctz(cand);
+	}
+
+	for (w = 0; w < MSEC_IDX_WORDS; w++) {
+		cand = _idx_cand(ia, secy, pool_mask, w, 0);
+
+		if (cand)
+			return (w * 32) + __builtin_ctz(cand);
+	}
+
+	return -ENOSPC;
+}
+
+static int _idx_check_req(struct gpy211_device *phy,
+			  const struct msec_idx_req *req)
+{
+	if ((req->secy >= MSEC_IDX_MAX_SECY) || (req->pool_mask == 0) ||
+	    (req->pool_mask >= (1 << MSEC_IDX_POOL_NUM))) {
+		LOG_WARN("WARN: Invalid input (secy/pool_mask)\n");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+void _gpy2xx_msec_idx_release(struct gpy211_device *phy,
+			      enum msec_idx_pool pool, u16 idx)
+{
+	struct msec_idx_alloc *ia = _idx_get(phy);
+	u8 secy;
+
+	if ((ia == NULL) || (pool >= MSEC_IDX_POOL_NUM) || (idx >= ia->nr_idx))
+		return;
+
+	if (!(ia->used[pool][IDX_WORD(idx)] & IDX_BIT(idx)))
+		return;
+
+	secy = ia->owner[pool][idx];
+	ia->used[pool][IDX_WORD(idx)] &= ~IDX_BIT(idx);
+	ia->owner[pool][idx] = MSEC_IDX_NO_SECY;
+
+	if (secy < MSEC_IDX_MAX_SECY)
+		ia->secy_used[secy][pool][IDX_WORD(idx)] &= ~IDX_BIT(idx);
+}
+
+int gpy2xx_msec_idx_init(struct gpy211_device *phy)
+{
+	struct msec_idx_alloc *ia;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (!phy->macsec_supported) {
+		LOG_WARN("ERROR: MACSEC is not supported.\n");
+		return -EINVAL;
+	}
+
+	if (phy->msec_idx != NULL) {
+		LOG_WARN("WARN: Index allocator is already initialized\n");
+		return -EBUSY;
+	}
+
+	ia = os_alloc(sizeof(*ia));
+
+	if (ia == NULL) {
+		LOG_CRIT("Memory alloc failed :- %s\n", __func__);
+		return -ENOMEM;
+	}
+
+	memset(ia, 0, sizeof(*ia));
+	memset(ia->owner, MSEC_IDX_NO_SECY, sizeof(ia->owner));
+	ia->nr_idx = (phy->nr_of_sas > MSEC_IDX_MAX) ? MSEC_IDX_MAX : phy->nr_of_sas;
+
+	phy->lock(phy->lock_data);
+	phy->msec_idx = ia;
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return 0;
+}
+
+int gpy2xx_msec_idx_uninit(struct gpy211_device *phy)
+{
+	struct msec_idx_alloc *ia;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	phy->lock(phy->lock_data);
+	ia = _idx_get(phy);
+
+	if (ia != NULL)
+		phy->msec_idx = NULL;
+
+	phy->unlock(phy->lock_data);
+
+	if (ia == NULL) {
+		LOG_WARN("WARN: Index allocator is not initialized\n");
+		return -EINVAL;
+	}
+
+	os_free(ia);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return 0;
+}
+
+int gpy2xx_msec_idx_alloc(struct gpy211_device *phy, struct msec_idx_req *req)
+{
+	struct msec_idx_alloc *ia;
+	int ret;
+	u32 p;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || req == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	ret = _idx_check_req(phy, req);
+
+	if (ret < 0)
+		return ret;
+
+	phy->lock(phy->lock_data);
+	ia = _idx_get(phy);
+
+	if (ia == NULL) {
+		LOG_WARN("WARN: Index allocator is not initialized\n");
+		ret = -EINVAL;
+		goto END;
+	}
+
+	ret = _idx_find(ia, req->secy, req->pool_mask);
+
+	if (ret < 0) {
+		LOG_WARN("WARN: No free index for SecY %u\n", req->secy);
+		goto END;
+	}
+
+	req->idx = (u16)ret;
+
+	for (p = 0; p < MSEC_IDX_POOL_NUM; p++) {
+		if (!(req->pool_mask & (1 << p)))
+			continue;
+
+		ia->used[p][IDX_WORD(req->idx)] |= IDX_BIT(req->idx);
+		ia->secy_used[req->secy][p][IDX_WORD(req->idx)] |= IDX_BIT(req->idx);
+		ia->owner[p][req->idx] = req->secy;
+	}
+
+	ret = 0;
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_idx_free(struct gpy211_device *phy,
+			 const struct msec_idx_req *req)
+{
+	struct msec_idx_alloc *ia;
+	int ret;
+	u32 p;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || req == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	ret = _idx_check_req(phy, req);
+
+	if (ret < 0)
+		return ret;
+
+	phy->lock(phy->lock_data);
+	ia = _idx_get(phy);
+
+	if (ia == NULL) {
+		LOG_WARN("WARN: Index allocator is not initialized\n");
+		ret = -EINVAL;
+		goto END;
+	}
+
+	if (req->idx >= ia->nr_idx) {
+		LOG_WARN("WARN: Invalid input (idx) - SA rule num\n");
+		ret = -EINVAL;
+		goto END;
+	}
+
+	for (p = 0; p < MSEC_IDX_POOL_NUM; p++) {
+		if (req->pool_mask & (1 << p))
+			_gpy2xx_msec_idx_release(phy, p, req->idx);
+	}
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_idx_reserve(struct gpy211_device *phy,
+			    const struct msec_idx_req *req)
+{
+	struct msec_idx_alloc *ia;
+	int ret, idx;
+	u32 p, w, n, cand;
+	u32 pick[MSEC_IDX_WORDS];
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || req == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	ret = _idx_check_req(phy, req);
+
+	if (ret < 0)
+		return ret;
+
+	phy->lock(phy->lock_data);
+	ia = _idx_get(phy);
+
+	if (ia == NULL) {
+		LOG_WARN("WARN: Index allocator is not initialized\n");
+		ret = -EINVAL;
+		goto END;
+	}
+
+	/* Collect lowest free unreserved indices, commit only if all found */
+	memset(pick, 0, sizeof(pick));
+
+	for (w = 0, n = 0; (w < MSEC_IDX_WORDS) && (n < req->num); w++) {
+		cand = _idx_cand(ia, req->secy, req->pool_mask, w, 0);
+
+		while (cand && (n < req->num)) {
+			idx = __builtin_ctz(cand);
+			cand &= ~(1u << idx);
+			pick[w] |= 1u << idx;
+			n++;
+		}
+	}
+
+	if (n < req->num) {
+		LOG_WARN("WARN: Only %u of %u indices free for SecY %u\n",
+			 n, req->num, req->secy);
+		ret = -ENOSPC;
+		goto END;
+	}
+
+	for (p = 0; p < MSEC_IDX_POOL_NUM; p++) {
+		if (!(req->pool_mask & (1 << p)))
+			continue;
+
+		for (w = 0; w < MSEC_IDX_WORDS; w++) {
+			ia->rsvd[p][w] |= pick[w];
+			ia->secy_rsvd[req->secy][p][w] |= pick[w];
+		}
+	}
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_idx_secy_free(struct gpy211_device *phy, u8 secy, u8 clear_hw)
+{
+	struct msec_idx_alloc *ia;
+	int ret = 0;
+	u32 p, w, bits, idx;
+	u32 used[MSEC_IDX_POOL_NUM][MSEC_IDX_WORDS];
+	struct transform_rec tr;
+	struct sa_match_param sam;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if (secy >= MSEC_IDX_MAX_SECY) {
+		LOG_WARN("WARN: Invalid input (secy)\n");
+		return -EINVAL;
+	}
+
+	phy->lock(phy->lock_data);
+	ia = _idx_get(phy);
+
+	if (ia == NULL) {
+		phy->unlock(phy->lock_data);
+		LOG_WARN("WARN: Index allocator is not initialized\n");
+		return -EINVAL;
+	}
+
+	/* Drop reservations and take over the allocated set */
+	for (p = 0; p < MSEC_IDX_POOL_NUM; p++) {
+		for (w = 0; w < MSEC_IDX_WORDS; w++) {
+			ia->rsvd[p][w] &= ~ia->secy_rsvd[secy][p][w];
+			ia->secy_rsvd[secy][p][w] = 0;
+			used[p][w] = ia->secy_used[secy][p][w];
+		}
+	}
+
+	if (!clear_hw) {
+		for (p = 0; p < MSEC_IDX_POOL_NUM; p++) {
+			for (w = 0; w < MSEC_IDX_WORDS; w++) {
+				for (bits = used[p][w]; bits; bits &= bits - 1)
+					_gpy2xx_msec_idx_release(phy, p, (w * 32) + __builtin_ctz(bits));
+			}
+		}
+	}
+
+	phy->unlock(phy->lock_data);
+
+	if (!clear_hw)
+		goto END;
+
+	/* Clear APIs take the lock and release the index themselves.
+	   SAM rules first, so no flow points to a cleared TR. */
+	memset(&sam, 0, sizeof(sam));
+	memset(&tr, 0, sizeof(tr));
+
+	for (w = 0; w < MSEC_IDX_WORDS; w++) {
+		for (bits = used[MSEC_IDX_ING_RULE][w]; bits; bits &= bits - 1) {
+			sam.rule_index = (w * 32) + __builtin_ctz(bits);
+			ret = gpy2xx_msec_clear_ing_sam_rule(phy, &sam);
+
+			if (ret < 0) {
+				LOG_CRIT("ERROR: api gpy2xx_msec_clear_ing_sam_rule fails\n");
+				goto END;
+			}
+		}
+
+		for (bits = used[MSEC_IDX_EGR_RULE][w]; bits; bits &= bits - 1) {
+			sam.rule_index = (w * 32) + __builtin_ctz(bits);
+			ret = gpy2xx_msec_clear_egr_sam_rule(phy, &sam);
+
+			if (ret < 0) {
+				LOG_CRIT("ERROR: api gpy2xx_msec_clear_egr_sam_rule fails\n");
+				goto END;
+			}
+		}
+	}
+
+	for (w = 0; w < MSEC_IDX_WORDS; w++) {
+		for (bits = used[MSEC_IDX_ING_SA][w]; bits; bits &= bits - 1) {
+			idx = (w * 32) + __builtin_ctz(bits);
+			tr.sa_index = idx;
+			ret = gpy2xx_msec_clear_ing_tr(phy, &tr);
+
+			if (ret < 0) {
+				LOG_CRIT("ERROR: api gpy2xx_msec_clear_ing_tr fails\n");
+				goto END;
+			}
+		}
+
+		for (bits = used[MSEC_IDX_EGR_SA][w]; bits; bits &= bits - 1) {
+			idx = (w * 32) + __builtin_ctz(bits);
+			tr.sa_index = idx;
+			ret = gpy2xx_msec_clear_egr_tr(phy, &tr);
+
+			if (ret < 0) {
+				LOG_CRIT("ERROR: api gpy2xx_msec_clear_egr_tr fails\n");
+				goto END;
+			}
+		}
+	}
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
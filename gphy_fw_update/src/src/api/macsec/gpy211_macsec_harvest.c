@@ -0,0 +1,684 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/module.h>
+#else
+#include <poll.h>
+#endif
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_harvest.h"
+#include <registers/phy/vspec1.h>
+
+/* AIC bits serviced by the harvester */
+#define HARVEST_AIC_BITS(_aic) \
+	do { \
+		(_aic).raw_aic_bits = 0; \
+		(_aic).stat_sa_thr = 1; \
+		(_aic).stat_global_thr = 1; \
+	} while (0)
+
+static void _harvest_acc_ing_sa(struct ing_sa_stats *acc,
+				const struct ing_sa_stats *val)
+{
+	acc->InOctetsDecrypted += val->InOctetsDecrypted;
+	acc->InOctetsDecrypted2 += val->InOctetsDecrypted2;
+	acc->InPktsUnchecked += val->InPktsUnchecked;
+	acc->InPktsDelayed += val->InPktsDelayed;
+	acc->InPktsLate += val->InPktsLate;
+	acc->InPktsOK += val->InPktsOK;
+	acc->InPktsInvalid += val->InPktsInvalid;
+	acc->InPktsNotValid += val->InPktsNotValid;
+	acc->InPktsNotUsingSA += val->InPktsNotUsingSA;
+	acc->InPktsUnusedSA += val->InPktsUnusedSA;
+	acc->InPktsUntaggedHit += val->InPktsUntaggedHit;
+}
+
+static void _harvest_acc_egr_sa(struct egr_sa_stats *acc,
+				const struct egr_sa_stats *val)
+{
+	acc->OutOctetsEncrypted += val->OutOctetsEncrypted;
+	acc->OutOctetsEncrypted2 += val->OutOctetsEncrypted2;
+	acc->OutPktsEncrypted += val->OutPktsEncrypted;
+	acc->OutPktsTooLong += val->OutPktsTooLong;
+}
+
+static void _harvest_acc_ing_glb(struct ing_global_stats *acc,
+				 const struct ing_global_stats *val)
+{
+	acc->TransformErrorPkts += val->TransformErrorPkts;
+	acc->InPktsCtrl += val->InPktsCtrl;
+	acc->InPktsNoTag += val->InPktsNoTag;
+	acc->InPktsUntagged += val->InPktsUntagged;
+	acc->InPktsTagged += val->InPktsTagged;
+	acc->InPktsBadTag += val->InPktsBadTag;
+	acc->InPktsUntaggedMiss += val->InPktsUntaggedMiss;
+	acc->InPktsNoSCI += val->InPktsNoSCI;
+	acc->InPktsUnknownSCI += val->InPktsUnknownSCI;
+	acc->InConsistCheckControlledNotPass += val->InConsistCheckControlledNotPass;
+	acc->InConsistCheckUncontrolledNotPass += val->InConsistCheckUncontrolledNotPass;
+	acc->InConsistCheckControlledPass += val->InConsistCheckControlledPass;
+	acc->InConsistCheckUncontrolledPass += val->InConsistCheckUncontrolledPass;
+	acc->InOverSizePkts += val->InOverSizePkts;
+}
+
+static void _harvest_acc_egr_glb(struct egr_global_stats *acc,
+				 const struct egr_global_stats *val)
+{
+	acc->TransformErrorPkts += val->TransformErrorPkts;
+	acc->OutPktsCtrl += val->OutPktsCtrl;
+	acc->OutPktsUnknownSA += val->OutPktsUnknownSA;
+	acc->OutPktsUntagged += val->OutPktsUntagged;
+	acc->OutOverSizePkts += val->OutOverSizePkts;
+}
+
+static int _harvest_ing_sa(struct gpy211_device *phy, struct msec_harvest *hv,
+			   u8 sa_index)
+{
+	int ret;
+	struct ing_sa_stats sa_stats = {.rule_index = sa_index};
+	struct psa_summary psa_sum = {
+		.rule_index = sa_index,
+		.psa_type = PSA_SUMM_GET_GIVEN,
+		.count_summ_psa = {0xFFFFFFFF},
+	};
+
+	/* Counters are cleared on read */
+	ret = gpy2xx_msec_get_ing_sa_stats(phy, &sa_stats);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_ing_sa_stats fails\n");
+		return ret;
+	}
+
+	_harvest_acc_ing_sa(&hv->ing_sa[sa_index], &sa_stats);
+	hv->ing_sa[sa_index].rule_index = sa_index;
+	hv->blk_reads++;
+
+	/* Clear 'COUNT_SUMMARY_SAx' of harvested SA */
+	ret = gpy2xx_msec_clear_ing_psa_stats_summ(phy, &psa_sum);
+
+	if (ret < 0)
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_ing_psa_stats_summ fails\n");
+
+	return ret;
+}
+
+static int _harvest_egr_sa(struct gpy211_device *phy, struct msec_harvest *hv,
+			   u8 sa_index)
+{
+	int ret;
+	struct egr_sa_stats sa_stats = {.rule_index = sa_index};
+	struct psa_summary psa_sum = {
+		.rule_index = sa_index,
+		.psa_type = PSA_SUMM_GET_GIVEN,
+		.count_summ_psa = {0xFFFFFFFF},
+	};
+
+	/* Counters are cleared on read */
+	ret = gpy2xx_msec_get_egr_sa_stats(phy, &sa_stats);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_egr_sa_stats fails\n");
+		return ret;
+	}
+
+	_harvest_acc_egr_sa(&hv->egr_sa[sa_index], &sa_stats);
+	hv->egr_sa[sa_index].rule_index = sa_index;
+	hv->blk_reads++;
+
+	/* Clear 'COUNT_SUMMARY_SAx' of harvested SA */
+	ret = gpy2xx_msec_clear_egr_psa_stats_summ(phy, &psa_sum);
+
+	if (ret < 0)
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_egr_psa_stats_summ fails\n");
+
+	return ret;
+}
+
+static int _harvest_ing_glb(struct gpy211_device *phy, struct msec_harvest *hv)
+{
+	int ret;
+	struct ing_global_stats glb_stats;
+
+	ret = gpy2xx_msec_get_ing_global_stats(phy, &glb_stats);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_ing_global_stats fails\n");
+		return ret;
+	}
+
+	_harvest_acc_ing_glb(&hv->ing_glb, &glb_stats);
+	hv->blk_reads++;
+
+	return ret;
+}
+
+static int _harvest_egr_glb(struct gpy211_device *phy, struct msec_harvest *hv)
+{
+	int ret;
+	struct egr_global_stats glb_stats;
+
+	ret = gpy2xx_msec_get_egr_global_stats(phy, &glb_stats);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_egr_global_stats fails\n");
+		return ret;
+	}
+
+	_harvest_acc_egr_glb(&hv->egr_glb, &glb_stats);
+	hv->blk_reads++;
+
+	return ret;
+}
+
+/* Enable (enable = 1) or disable the harvester bits in AIC of given direction */
+static int _harvest_aic_cfg(struct gpy211_device *phy, enum msec_dir dir,
+			    u8 enable, u32 *aic_en)
+{
+	int ret;
+	struct aic_control_stat aic_csr;
+	struct aic_bit_assign bits;
+
+	HARVEST_AIC_BITS(bits);
+
+	if (dir == INGRESS_DIR)
+		ret = gpy2xx_msec_get_ing_aic_csr(phy, &aic_csr);
+	else
+		ret = gpy2xx_msec_get_egr_aic_csr(phy, &aic_csr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_xxx_aic_csr fails\n");
+		return ret;
+	}
+
+	if (enable) {
+		aic_csr.enable_ctrl.raw_aic_bits |= bits.raw_aic_bits;
+		aic_csr.enable_set.raw_aic_bits = bits.raw_aic_bits;
+		aic_csr.enable_clr.raw_aic_bits = 0;
+	} else {
+		aic_csr.enable_ctrl.raw_aic_bits &= ~bits.raw_aic_bits;
+		aic_csr.enable_set.raw_aic_bits = 0;
+		aic_csr.enable_clr.raw_aic_bits = bits.raw_aic_bits;
+	}
+
+	/* Drop stale events raised before (re)configuration */
+	aic_csr.ack.raw_aic_bits = bits.raw_aic_bits;
+
+	if (dir == INGRESS_DIR)
+		ret = gpy2xx_msec_config_ing_aic_csr(phy, &aic_csr);
+	else
+		ret = gpy2xx_msec_config_egr_aic_csr(phy, &aic_csr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_config_xxx_aic_csr fails\n");
+		return ret;
+	}
+
+	*aic_en = enable ? bits.raw_aic_bits : 0;
+
+	return ret;
+}
+
+/* Harvest flagged counters of given direction, then clear summary and ack AIC */
+static int _harvest_dir(struct gpy211_device *phy, struct msec_harvest *hv,
+			enum msec_dir dir)
+{
+	int i, j, ret, cnt = 0;
+	u32 *sa_upd;
+	struct aic_control_stat aic_csr;
+	struct stats_summary xxx_summ;
+
+	/* No AIC event to check or acknowledge in poll mode */
+	if (!hv->poll) {
+		if (dir == INGRESS_DIR)
+			ret = gpy2xx_msec_get_ing_aic_csr(phy, &aic_csr);
+		else
+			ret = gpy2xx_msec_get_egr_aic_csr(phy, &aic_csr);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: api gpy2xx_msec_get_xxx_aic_csr fails\n");
+			return ret;
+		}
+
+		aic_csr.ack.raw_aic_bits = aic_csr.enabled_stat.raw_aic_bits &
+					   ((dir == INGRESS_DIR) ? hv->ing_aic_en : hv->egr_aic_en);
+
+		/* Event is not from statistics module of this direction */
+		if (aic_csr.ack.raw_aic_bits == 0)
+			return 0;
+	}
+
+	memset(&xxx_summ, 0, sizeof(xxx_summ));
+
+	if (dir == INGRESS_DIR)
+		ret = gpy2xx_msec_get_ing_stats_summ(phy, &xxx_summ);
+	else
+		ret = gpy2xx_msec_get_egr_stats_summ(phy, &xxx_summ);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_xxx_stats_summ fails\n");
+		return ret;
+	}
+
+	sa_upd = (dir == INGRESS_DIR) ? hv->ing_sa_upd : hv->egr_sa_upd;
+
+	for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
+		sa_upd[i] = xxx_summ.psa_sum_word[i];
+
+		for (j = 0; j < 32; j++) {
+			if (!(xxx_summ.psa_sum_word[i] & (1u << j)))
+				continue;
+
+			if ((i * 32 + j) >= phy->nr_of_sas)
+				break;
+
+			if (dir == INGRESS_DIR)
+				ret = _harvest_ing_sa(phy, hv, i * 32 + j);
+			else
+				ret = _harvest_egr_sa(phy, hv, i * 32 + j);
+
+			if (ret < 0)
+				return ret;
+
+			cnt++;
+		}
+	}
+
+	if (xxx_summ.glb_summ_word) {
+		if (dir == INGRESS_DIR)
+			ret = _harvest_ing_glb(phy, hv);
+		else
+			ret = _harvest_egr_glb(phy, hv);
+
+		if (ret < 0)
+			return ret;
+
+		cnt++;
+	}
+
+	/* Clear only the summary bits harvested above (write 1 to clear) */
+	if (dir == INGRESS_DIR)
+		ret = gpy2xx_msec_clear_ing_stats_summ(phy, &xxx_summ);
+	else
+		ret = gpy2xx_msec_clear_egr_stats_summ(phy, &xxx_summ);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_xxx_stats_summ fails\n");
+		return ret;
+	}
+
+	if (hv->poll)
+		return cnt;
+
+	/* Acknowledge to re-arm, keep enables as they are */
+	aic_csr.enable_set.raw_aic_bits = 0;
+	aic_csr.enable_clr.raw_aic_bits = 0;
+
+	if (dir == INGRESS_DIR)
+		ret = gpy2xx_msec_config_ing_aic_csr(phy, &aic_csr);
+	else
+		ret = gpy2xx_msec_config_egr_aic_csr(phy, &aic_csr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_config_xxx_aic_csr fails\n");
+		return ret;
+	}
+
+	return cnt;
+}
+
+int gpy2xx_msec_harvest_start(struct gpy211_device *phy,
+			      struct msec_harvest *hv)
+{
+	int ret;
+	struct frame_octet_thr ing_thr, egr_thr;
+	struct stats_summary xxx_summ = {
+		.psa_sum_word = {0xFFFFFFFF},
+		.glb_summ_word = 0xFFFFFFFF,
+	};
+	struct psa_summary psa_sum = {
+		.psa_type = PSA_SUMM_GET_ALL,
+	};
+	struct gpy211_phy_extin extin;
+	u8 poll;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || hv == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (!phy->macsec_supported) {
+		LOG_WARN("ERROR: MACSEC is not supported.\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if (hv->ing_thr.frame_threshold == 0 || hv->ing_thr.octet_threshold == 0 ||
+	    hv->egr_thr.frame_threshold == 0 || hv->egr_thr.octet_threshold == 0) {
+		LOG_WARN("WARN: Invalid input (xxx_thr) - Counter threshold\n");
+		return -EINVAL;
+	}
+
+	ing_thr = hv->ing_thr;
+	egr_thr = hv->egr_thr;
+	poll = hv->poll;
+	memset(hv, 0, sizeof(*hv));
+	hv->ing_thr = ing_thr;
+	hv->egr_thr = egr_thr;
+	hv->poll = poll;
+
+	ret = gpy2xx_msec_config_ing_count_thresh(phy, &hv->ing_thr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_config_ing_count_thresh fails\n");
+		goto END;
+	}
+
+	ret = gpy2xx_msec_config_egr_count_thresh(phy, &hv->egr_thr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_config_egr_count_thresh fails\n");
+		goto END;
+	}
+
+	/* Start from clean summaries */
+	memset(psa_sum.count_summ_psa, 0xFF, sizeof(psa_sum.count_summ_psa));
+
+	ret = gpy2xx_msec_clear_ing_psa_stats_summ(phy, &psa_sum);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_ing_psa_stats_summ fails\n");
+		goto END;
+	}
+
+	ret = gpy2xx_msec_clear_egr_psa_stats_summ(phy, &psa_sum);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_egr_psa_stats_summ fails\n");
+		goto END;
+	}
+
+	ret = gpy2xx_msec_clear_ing_stats_summ(phy, &xxx_summ);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_ing_stats_summ fails\n");
+		goto END;
+	}
+
+	ret = gpy2xx_msec_clear_egr_stats_summ(phy, &xxx_summ);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_egr_stats_summ fails\n");
+		goto END;
+	}
+
+	/* Summaries are polled, keep AIC and PHY interrupts off */
+	if (hv->poll)
+		goto END;
+
+	ret = _harvest_aic_cfg(phy, INGRESS_DIR, 1, &hv->ing_aic_en);
+
+	if (ret < 0)
+		goto END;
+
+	ret = _harvest_aic_cfg(phy, EGRESS_DIR, 1, &hv->egr_aic_en);
+
+	if (ret < 0)
+		goto END;
+
+	/* Arm MACsec interrupt of PHY, keep other enabled interrupts */
+	ret = gpy2xx_extin_get(phy, &extin);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_extin_get fails\n");
+		goto END;
+	}
+
+	extin.std_imask |= EXTIN_PHY_MBOX;
+	extin.ext_imask |= EXTIN_IM2_IE_MACSEC;
+
+	ret = gpy2xx_extin_mask(phy, &extin);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_extin_mask fails\n");
+		goto END;
+	}
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_harvest_stop(struct gpy211_device *phy,
+			     struct msec_harvest *hv)
+{
+	int ret;
+	struct gpy211_phy_extin extin;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || hv == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (hv->poll) {
+		ret = 0;
+		goto END;
+	}
+
+	ret = gpy2xx_extin_get(phy, &extin);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_extin_get fails\n");
+		goto END;
+	}
+
+	extin.std_imask |= EXTIN_PHY_MBOX;
+	extin.ext_imask &= ~EXTIN_IM2_IE_MACSEC;
+
+	/* extin_mask does not accept an empty extended mask */
+	if (extin.ext_imask == 0) {
+		phy->lock(phy->lock_data);
+		ret = PHY_WRITE_MMD(phy, MDIO_MMD_VEND1, VSPEC1_IMASK, 0);
+		phy->unlock(phy->lock_data);
+	} else {
+		ret = gpy2xx_extin_mask(phy, &extin);
+	}
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: VSPEC1_IMASK write fails\n");
+		goto END;
+	}
+
+	ret = _harvest_aic_cfg(phy, INGRESS_DIR, 0, &hv->ing_aic_en);
+
+	if (ret < 0)
+		goto END;
+
+	ret = _harvest_aic_cfg(phy, EGRESS_DIR, 0, &hv->egr_aic_en);
+
+	if (ret < 0)
+		goto END;
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_harvest_event(struct gpy211_device *phy,
+			      struct msec_harvest *hv)
+{
+	struct gpy211_phy_extin extin;
+	int ret;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || hv == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	ret = gpy2xx_extin_get(phy, &extin);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_extin_get fails\n");
+		goto END;
+	}
+
+	ret = gpy2xx_msec_harvest_istat(phy, hv, &extin);
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_harvest_istat(struct gpy211_device *phy,
+			      struct msec_harvest *hv,
+			      const struct gpy211_phy_extin *extin)
+{
+	int ret, cnt = 0;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || hv == NULL || extin == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	memset(hv->ing_sa_upd, 0, sizeof(hv->ing_sa_upd));
+	memset(hv->egr_sa_upd, 0, sizeof(hv->egr_sa_upd));
+	hv->extin = *extin;
+
+	if (!(hv->extin.ext_istat & EXTIN_IM2_IE_MACSEC)) {
+		ret = 0;
+		goto END;
+	}
+
+	hv->events++;
+
+	ret = _harvest_dir(phy, hv, INGRESS_DIR);
+
+	if (ret < 0)
+		goto END;
+
+	cnt = ret;
+
+	ret = _harvest_dir(phy, hv, EGRESS_DIR);
+
+	if (ret < 0)
+		goto END;
+
+	ret += cnt;
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_harvest_poll(struct gpy211_device *phy,
+			     struct msec_harvest *hv)
+{
+	int ret, cnt = 0;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || hv == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	memset(hv->ing_sa_upd, 0, sizeof(hv->ing_sa_upd));
+	memset(hv->egr_sa_upd, 0, sizeof(hv->egr_sa_upd));
+
+	ret = _harvest_dir(phy, hv, INGRESS_DIR);
+
+	if (ret < 0)
+		goto END;
+
+	cnt = ret;
+
+	ret = _harvest_dir(phy, hv, EGRESS_DIR);
+
+	if (ret < 0)
+		goto END;
+
+	ret += cnt;
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_harvest_sync(struct gpy211_device *phy,
+			     struct msec_harvest *hv)
+{
+	int i, ret = 0;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || hv == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < phy->nr_of_sas && i < MACSEC_MAX_SA_RULES; i++) {
+		ret = _harvest_ing_sa(phy, hv, i);
+
+		if (ret < 0)
+			goto END;
+
+		ret = _harvest_egr_sa(phy, hv, i);
+
+		if (ret < 0)
+			goto END;
+	}
+
+	ret = _harvest_ing_glb(phy, hv);
+
+	if (ret < 0)
+		goto END;
+
+	ret = _harvest_egr_glb(phy, hv);
+
+	if (ret < 0)
+		goto END;
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+#ifndef __KERNEL__
+int gpy2xx_msec_harvest_wait(int fd, int timeout_ms)
+{
+	int ret;
+	char val[8];
+	struct pollfd pfd = {
+		.fd = fd,
+		.events = POLLPRI | POLLERR,
+	};
+
+	if (fd < 0) {
+		LOG_WARN("WARN: Invalid input (fd) - GPIO value file\n");
+		return -EINVAL;
+	}
+
+	ret = poll(&pfd, 1, timeout_ms);
+
+	if (ret < 0)
+		return -errno;
+
+	if (ret == 0)
+		return 0;
+
+	/* Read back the value to re-arm edge detection */
+	if (lseek(fd, 0, SEEK_SET) < 0 || read(fd, val, sizeof(val)) < 0)
+		return -errno;
+
+	return 1;
+}
+#endif
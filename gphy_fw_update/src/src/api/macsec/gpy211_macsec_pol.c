@@ -0,0 +1,1173 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/errno.h>
+#endif
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_pol.h"
+
+/* Match key: value/mask bytes of every field plus SAM packet types */
+#define POL_K_DA 0
+#define POL_K_SA 6
+#define POL_K_ET 12
+#define POL_K_VID 14
+#define POL_K_SCI 16
+#define POL_K_TCI 24
+#define POL_K_CTRL 25
+#define POL_K_REF 26
+#define POL_KEY_LEN 28
+
+#define POL_NONE 0xFFFF
+#define POL_IDX_NONE 0xFF
+#define POL_MAC_EXACT 0x3F
+#define POL_SAM_PRIO_MAX 15
+#define POL_CC_PRIO_MAX 7
+
+/* Raw SAM mask bits of SA/DA byte i */
+#define POL_SAM_MASK_SA(i) (1U << (i))
+#define POL_SAM_MASK_DA(i) (1U << (6 + (i)))
+
+/* CP write units */
+#define POL_CP_COMB_8 8
+#define POL_CP_RANGE 10
+#define POL_CP_C44 11
+#define POL_CP_C48 12
+#define POL_CP_ET_HI 13
+#define POL_CP_MAX_DA 8
+#define POL_CP_MAX_ET 16
+
+struct pol_key {
+	u8 v[POL_KEY_LEN];
+	u8 m[POL_KEY_LEN];
+	u8 pt;
+};
+
+struct pol_ival {
+	u64 start;
+	u64 end;
+	u16 rule;
+};
+
+struct pol_work {
+	struct pol_key key[MSEC_POL_MAX_RULES];
+	u8 alive[MSEC_POL_MAX_RULES];
+	u8 prio[MSEC_POL_MAX_RULES];
+	/* FLOW rule referred to by a CC rule */
+	u8 refd[MSEC_POL_MAX_RULES];
+	u16 list[MSEC_POL_MAX_RULES];
+	struct pol_ival ival[MSEC_POL_MAX_RULES];
+	u8 sam_idx[MSEC_POL_MAX_RULES];
+	u8 match[MACSEC_MAX_SA_RULES];
+	u8 new_idx[MACSEC_MAX_SA_RULES];
+};
+
+static int _pol_slot_test(const u32 *slots, u32 idx)
+{
+	return (slots[idx / 32] >> (idx % 32)) & 1;
+}
+
+static void _pol_key(const struct msec_pol *pol, const struct msec_pol_rule *r,
+		     struct pol_key *k)
+{
+	u32 i;
+
+	memset(k, 0, sizeof(*k));
+
+	for (i = 0; i < 6; i++) {
+		if ((r->match & MSEC_POL_M_DA) && (r->da_mask & (1 << i))) {
+			k->v[POL_K_DA + i] = r->da[i];
+			k->m[POL_K_DA + i] = 0xFF;
+		}
+
+		if ((r->match & MSEC_POL_M_SA) && (r->sa_mask & (1 << i))) {
+			k->v[POL_K_SA + i] = r->sa[i];
+			k->m[POL_K_SA + i] = 0xFF;
+		}
+	}
+
+	if (r->match & MSEC_POL_M_ETYPE) {
+		k->v[POL_K_ET] = (u8)(r->eth_type >> 8);
+		k->v[POL_K_ET + 1] = (u8)r->eth_type;
+		k->m[POL_K_ET] = 0xFF;
+		k->m[POL_K_ET + 1] = 0xFF;
+	}
+
+	if (r->match & MSEC_POL_M_VLAN) {
+		k->v[POL_K_VID] = (u8)(r->vlan_id >> 8) & 0x0F;
+		k->v[POL_K_VID + 1] = (u8)r->vlan_id;
+		k->m[POL_K_VID] = 0x0F;
+		k->m[POL_K_VID + 1] = 0xFF;
+	}
+
+	if (r->match & MSEC_POL_M_SCI) {
+		memcpy(&k->v[POL_K_SCI], r->sci, MACSEC_SCI_LEN_BYTE);
+		memset(&k->m[POL_K_SCI], 0xFF, MACSEC_SCI_LEN_BYTE);
+	}
+
+	if (r->match & MSEC_POL_M_TCI_AN) {
+		k->v[POL_K_TCI] = r->tci_an & r->tci_an_mask;
+		k->m[POL_K_TCI] = r->tci_an_mask;
+	}
+
+	if (r->match & MSEC_POL_M_CTRL) {
+		k->v[POL_K_CTRL] = r->ctrl ? 1 : 0;
+		k->m[POL_K_CTRL] = 1;
+	}
+
+	if (r->match & MSEC_POL_M_REF) {
+		k->v[POL_K_REF] = (u8)(r->ref >> 8);
+		k->v[POL_K_REF + 1] = (u8)r->ref;
+		k->m[POL_K_REF] = 0xFF;
+		k->m[POL_K_REF + 1] = 0xFF;
+	}
+
+	if (r->act != MSEC_POL_ACT_FLOW)
+		k->pt = MSEC_POL_PKT_ALL;
+	else if (r->pkt_type)
+		k->pt = r->pkt_type & MSEC_POL_PKT_ALL;
+	else
+		k->pt = (pol->dir == INGRESS_DIR) ? MSEC_POL_PKT_TAGGED : MSEC_POL_PKT_UNTAGGED;
+}
+
+/* Some packet matches both */
+static int _pol_intersect(const struct pol_key *a, const struct pol_key *b)
+{
+	u32 i;
+
+	for (i = 0; i < POL_KEY_LEN; i++) {
+		if ((a->v[i] ^ b->v[i]) & a->m[i] & b->m[i])
+			return 0;
+	}
+
+	return (a->pt & b->pt) ? 1 : 0;
+}
+
+/* Every packet matching a matches b */
+static int _pol_subset(const struct pol_key *a, const struct pol_key *b)
+{
+	u32 i;
+
+	for (i = 0; i < POL_KEY_LEN; i++) {
+		if ((b->m[i] & ~a->m[i]) || ((a->v[i] ^ b->v[i]) & b->m[i]))
+			return 0;
+	}
+
+	return (a->pt & ~b->pt) ? 0 : 1;
+}
+
+static int _pol_same_match(const struct pol_key *a, const struct pol_key *b)
+{
+	return !memcmp(a->v, b->v, POL_KEY_LEN) && !memcmp(a->m, b->m, POL_KEY_LEN);
+}
+
+/* Same outcome; rule hit of a referred FLOW rule is an outcome of its own */
+static int _pol_same_act(const struct msec_pol *pol, const struct pol_work *w,
+			 u16 a, u16 b)
+{
+	const struct msec_pol_rule *ra = &pol->rule[a], *rb = &pol->rule[b];
+
+	if (ra->act != rb->act)
+		return 0;
+
+	if (ra->act == MSEC_POL_ACT_FLOW)
+		return (ra->flow_index == rb->flow_index) && !w->refd[a] && !w->refd[b];
+
+	return 1;
+}
+
+/* A rule in list[from+1 .. to-1] with another action than list[to] overlaps k */
+static int _pol_conflict(const struct msec_pol *pol, const struct pol_work *w,
+			 u16 from, u16 to, const struct pol_key *k)
+{
+	u16 n;
+
+	for (n = from + 1; n < to; n++) {
+		if (!_pol_same_act(pol, w, w->list[n], w->list[to]) &&
+		    _pol_intersect(&w->key[w->list[n]], k))
+			return 1;
+	}
+
+	return 0;
+}
+
+static void _pol_diag(struct msec_pol_out *out, struct pol_work *w, u16 r,
+		      u8 diag, u16 ref)
+{
+	out->diag[r] = diag;
+	out->diag_ref[r] = ref;
+	w->alive[r] = 0;
+}
+
+/* Drop covered rules, merge packet types and assign match priorities */
+static int _pol_reduce(const struct msec_pol *pol, struct pol_work *w,
+		       struct msec_pol_out *out, u16 n, u8 prio_max)
+{
+	u16 i, j, ri, rj;
+
+	/* Covered by an earlier rule, or same match as an earlier rule */
+	for (j = 0; j < n; j++) {
+		rj = w->list[j];
+
+		for (i = 0; i < j && w->alive[rj]; i++) {
+			ri = w->list[i];
+
+			if (!w->alive[ri])
+				continue;
+
+			if (_pol_subset(&w->key[rj], &w->key[ri]))
+				_pol_diag(out, w, rj, _pol_same_act(pol, w, ri, rj) ?
+					  MSEC_POL_REDUNDANT : MSEC_POL_SHADOWED, ri);
+		}
+
+		for (i = 0; i < j && w->alive[rj]; i++) {
+			ri = w->list[i];
+
+			if (!w->alive[ri] || !_pol_same_match(&w->key[ri], &w->key[rj]) ||
+			    !_pol_same_act(pol, w, ri, rj) ||
+			    _pol_conflict(pol, w, i, j, &w->key[rj]))
+				continue;
+
+			w->key[ri].pt |= w->key[rj].pt;
+			_pol_diag(out, w, rj, MSEC_POL_MERGED, ri);
+		}
+	}
+
+	/* Covered by a later rule with the same action */
+	for (i = 0; i < n; i++) {
+		ri = w->list[i];
+
+		for (j = i + 1; j < n && w->alive[ri]; j++) {
+			rj = w->list[j];
+
+			if (w->alive[rj] && _pol_same_act(pol, w, ri, rj) &&
+			    _pol_subset(&w->key[ri], &w->key[rj]) &&
+			    !_pol_conflict(pol, w, i, j, &w->key[ri]))
+				_pol_diag(out, w, ri, MSEC_POL_REDUNDANT, rj);
+		}
+	}
+
+	/* Higher priority than every later overlapping rule with another action */
+	for (i = n; i-- > 0;) {
+		ri = w->list[i];
+		w->prio[ri] = 0;
+
+		if (!w->alive[ri])
+			continue;
+
+		for (j = i + 1; j < n; j++) {
+			rj = w->list[j];
+
+			if (w->alive[rj] && (w->prio[rj] >= w->prio[ri]) &&
+			    !_pol_same_act(pol, w, ri, rj) &&
+			    _pol_intersect(&w->key[ri], &w->key[rj]))
+				w->prio[ri] = w->prio[rj] + 1;
+		}
+
+		if (w->prio[ri] > prio_max) {
+			LOG_WARN("WARN: Rule %u overlaps more than %u rules\n", ri, prio_max);
+			return -ERANGE;
+		}
+	}
+
+	return 0;
+}
+
+static int _pol_check_rule(const struct msec_pol *pol, u16 r)
+{
+	const struct msec_pol_rule *rule = &pol->rule[r];
+	u16 allowed;
+
+	switch (rule->act) {
+	case MSEC_POL_ACT_FLOW:
+		allowed = MSEC_POL_M_DA | MSEC_POL_M_SA | MSEC_POL_M_ETYPE |
+			  MSEC_POL_M_VLAN | MSEC_POL_M_CTRL;
+
+		if (pol->dir == INGRESS_DIR)
+			allowed |= MSEC_POL_M_SCI | MSEC_POL_M_TCI_AN;
+
+		break;
+
+	case MSEC_POL_ACT_CONTROL:
+		allowed = MSEC_POL_M_DA | MSEC_POL_M_ETYPE;
+
+		/* DA prefix, exact DA if combined with Ether-type */
+		if ((rule->match & MSEC_POL_M_DA) &&
+		    (((rule->da_mask & (rule->da_mask + 1)) != 0) ||
+		     (rule->da_mask == 0) || (rule->da_mask > POL_MAC_EXACT) ||
+		     ((rule->match & MSEC_POL_M_ETYPE) && (rule->da_mask != POL_MAC_EXACT))))
+			return -EINVAL;
+
+		if (!(rule->match & (MSEC_POL_M_DA | MSEC_POL_M_ETYPE)))
+			return -EINVAL;
+
+		break;
+
+	case MSEC_POL_ACT_PASS:
+	case MSEC_POL_ACT_DROP:
+		if (pol->dir != INGRESS_DIR)
+			return -EINVAL;
+
+		allowed = MSEC_POL_M_ETYPE | MSEC_POL_M_VLAN | MSEC_POL_M_CTRL |
+			  MSEC_POL_M_REF;
+
+		if ((rule->match & MSEC_POL_M_REF) &&
+		    ((rule->ref >= pol->num) ||
+		     (pol->rule[rule->ref].act != MSEC_POL_ACT_FLOW)))
+			return -EINVAL;
+
+		break;
+
+	default:
+		return -EINVAL;
+	}
+
+#if !(defined(SUPPORT_MACSEC_VLAN) && SUPPORT_MACSEC_VLAN)
+	allowed &= ~MSEC_POL_M_VLAN;
+#endif
+
+	if (rule->match & ~allowed)
+		return -EINVAL;
+
+	return 0;
+}
+
+static void _pol_build_sam(const struct msec_pol_rule *r, const struct pol_key *k,
+			   u8 prio, struct sa_match_param *sam)
+{
+	u32 i;
+
+	memset(sam, 0, sizeof(*sam));
+
+	for (i = 0; i < 6; i++) {
+		if (k->m[POL_K_DA + i]) {
+			sam->da_mac[i] = r->da[i];
+			sam->mask_par.mask |= POL_SAM_MASK_DA(i);
+		}
+
+		if (k->m[POL_K_SA + i]) {
+			sam->sa_mac[i] = r->sa[i];
+			sam->mask_par.mask |= POL_SAM_MASK_SA(i);
+		}
+	}
+
+	if (r->match & MSEC_POL_M_ETYPE) {
+		sam->eth_type = r->eth_type;
+		sam->mask_par.mac_etype_mask = 1;
+	}
+
+#if defined(SUPPORT_MACSEC_VLAN) && SUPPORT_MACSEC_VLAN
+
+	if (r->match & MSEC_POL_M_VLAN) {
+		sam->vlan_id = r->vlan_id & 0xFFF;
+		sam->misc_par.vlan_valid = 1;
+		sam->mask_par.vlan_vld_mask = 1;
+		sam->mask_par.vlan_id_mask = 1;
+	}
+
+#endif
+
+	if (r->match & MSEC_POL_M_SCI) {
+		memcpy(sam->sci, r->sci, MACSEC_SCI_LEN_BYTE);
+		sam->mask_par.macsec_sci_mask = 1;
+	}
+
+	if (r->match & MSEC_POL_M_TCI_AN) {
+		sam->misc_par.macsec_tci_an = r->tci_an & r->tci_an_mask;
+		sam->mask_par.tci_an_mask = r->tci_an_mask;
+	}
+
+	if (r->match & MSEC_POL_M_CTRL) {
+		sam->misc_par.control_packet = r->ctrl ? 1 : 0;
+		sam->mask_par.ctrl_packet_mask = 1;
+	}
+
+	sam->misc_par.untagged = (k->pt & MSEC_POL_PKT_UNTAGGED) ? 1 : 0;
+	sam->misc_par.tagged = (k->pt & MSEC_POL_PKT_TAGGED) ? 1 : 0;
+	sam->misc_par.bad_tag = (k->pt & MSEC_POL_PKT_BAD_TAG) ? 1 : 0;
+	sam->misc_par.kay_tag = (k->pt & MSEC_POL_PKT_KAY_TAG) ? 1 : 0;
+	sam->misc_par.match_priority = prio;
+	sam->extn_par.flow_index = r->flow_index;
+}
+
+static void _pol_build_cc(const struct msec_pol_rule *r, u8 sam_idx, u8 prio,
+			  struct icc_match_param *cc)
+{
+	memset(cc, 0, sizeof(*cc));
+
+	if (r->match & MSEC_POL_M_ETYPE) {
+		cc->vlan_eth.payload_e_type = r->eth_type;
+		cc->icc_misc.payl_etype_mask = 1;
+	}
+
+#if defined(SUPPORT_MACSEC_VLAN) && SUPPORT_MACSEC_VLAN
+
+	if (r->match & MSEC_POL_M_VLAN) {
+		cc->vlan_eth.vlan_id = r->vlan_id & 0xFFF;
+		cc->icc_misc.vlan_valid = 1;
+		cc->icc_misc.vlan_valid_mask = 1;
+		cc->icc_misc.vlan_id_mask = 1;
+	}
+
+#endif
+
+	if (r->match & MSEC_POL_M_CTRL) {
+		cc->icc_misc.ctrl_packet = r->ctrl ? 1 : 0;
+		cc->icc_misc.ctrl_packet_mask = 1;
+	}
+
+	if (r->match & MSEC_POL_M_REF) {
+		cc->icc_misc.rule_hit = 1;
+		cc->icc_misc.rule_hit_mask = 1;
+		cc->icc_misc.sa_or_rule_nr = sam_idx;
+		cc->icc_misc.rule_nr_mask = 1;
+	}
+
+	cc->icc_misc.match_priority = prio;
+	cc->icc_misc.match_action = (r->act == MSEC_POL_ACT_PASS) ? 1 : 0;
+}
+
+static int _pol_sam_equal(const struct sa_match_param *a,
+			  const struct sa_match_param *b)
+{
+	return !memcmp(a->sa_mac, b->sa_mac, sizeof(a->sa_mac)) &&
+	       !memcmp(a->da_mac, b->da_mac, sizeof(a->da_mac)) &&
+	       (a->eth_type == b->eth_type) && (a->vlan_id == b->vlan_id) &&
+	       (a->misc_par.misc == b->misc_par.misc) &&
+	       !memcmp(a->sci, b->sci, sizeof(a->sci)) &&
+	       (a->mask_par.mask == b->mask_par.mask) &&
+	       (a->extn_par.extn == b->extn_par.extn);
+}
+
+static int _pol_cc_equal(const struct icc_match_param *a,
+			 const struct icc_match_param *b)
+{
+	return (a->vlan_eth.raw_iccm_vleth == b->vlan_eth.raw_iccm_vleth) &&
+#if defined(SUPPORT_MACSEC_VLAN) && SUPPORT_MACSEC_VLAN
+	       (a->icc_ivl.raw_iccm_ivl == b->icc_ivl.raw_iccm_ivl) &&
+#endif
+	       (a->icc_misc.raw_iccm_misc == b->icc_misc.raw_iccm_misc);
+}
+
+static int _pol_add_op(struct msec_pol_diff *diff, u8 tbl, u8 opc, u8 index,
+		       u8 entry)
+{
+	if (diff->num >= MSEC_POL_MAX_OPS)
+		return -ENOSPC;
+
+	diff->op[diff->num].tbl = tbl;
+	diff->op[diff->num].opc = opc;
+	diff->op[diff->num].index = index;
+	diff->op[diff->num].entry = entry;
+	diff->num++;
+
+	return 0;
+}
+
+/* Assign indices: keep matched old entries, reuse freed ones, then free slots.
+   old_idx[i] is the index of old entry i, w->match[e] the old entry equal to
+   new entry e. Writes are added to diff, freed old indices are returned in
+   clr (POL_IDX_NONE terminated). */
+static int _pol_assign(struct pol_work *w, const u32 *slots, const u8 *old_idx,
+		       u16 n_old, u16 n_new, struct msec_pol_diff *diff, u8 tbl,
+		       u8 *clr)
+{
+	u32 busy[MACSEC_MAX_SA_RULES / 32] = {0};
+	u8 kept[MACSEC_MAX_SA_RULES] = {0};
+	u16 e, o, nr_clr = 0, reuse = 0;
+	u32 idx;
+	int ret;
+
+	for (o = 0; o < n_old; o++)
+		busy[old_idx[o] / 32] |= 1U << (old_idx[o] % 32);
+
+	for (e = 0; e < n_new; e++) {
+		if (w->match[e] != POL_IDX_NONE) {
+			w->new_idx[e] = old_idx[w->match[e]];
+			kept[w->match[e]] = 1;
+		}
+	}
+
+	/* Freed indices */
+	for (o = 0; o < n_old; o++) {
+		if (!kept[o] && _pol_slot_test(slots, old_idx[o]))
+			clr[nr_clr++] = old_idx[o];
+		else if (!kept[o])
+			LOG_WARN("WARN: Installed index %u is outside the policy slots\n",
+				 old_idx[o]);
+	}
+
+	for (e = 0; e < n_new; e++) {
+		if (w->match[e] != POL_IDX_NONE)
+			continue;
+
+		if (reuse < nr_clr) {
+			idx = clr[reuse++];
+		} else {
+			for (idx = 0; idx < MACSEC_MAX_SA_RULES; idx++) {
+				if (_pol_slot_test(slots, idx) && !_pol_slot_test(busy, idx))
+					break;
+			}
+
+			if (idx >= MACSEC_MAX_SA_RULES)
+				return -ENOSPC;
+		}
+
+		busy[idx / 32] |= 1U << (idx % 32);
+		w->new_idx[e] = (u8)idx;
+
+		ret = _pol_add_op(diff, tbl, MSEC_POL_OP_WRITE, (u8)idx, (u8)e);
+
+		if (ret < 0)
+			return ret;
+	}
+
+	/* Left in clr: freed and not reused */
+	memmove(clr, clr + reuse, nr_clr - reuse);
+	clr[nr_clr - reuse] = POL_IDX_NONE;
+
+	return 0;
+}
+
+static u64 _pol_mac64(const u8 *mac)
+{
+	u32 i;
+	u64 val = 0;
+
+	for (i = 0; i < 6; i++)
+		val = (val << 8) | mac[i];
+
+	return val;
+}
+
+static void _pol_mac_put(u64 val, u8 *mac)
+{
+	u32 i;
+
+	for (i = 6; i-- > 0;) {
+		mac[i] = (u8)val;
+		val >>= 8;
+	}
+}
+
+/* Raw match enable bits of a CP write unit */
+static u32 _pol_cp_bits(u32 unit)
+{
+	if (unit < POL_CP_COMB_8)
+		return (1U << unit) | (1U << (8 + unit));
+
+	/* comb_8/9, range, const44, const48, e_type_10~17 */
+	return 1U << (unit + 8);
+}
+
+static int _pol_cp_da(struct msec_pol_cp *cp, u32 *nr_da, u64 da)
+{
+	if (*nr_da < POL_CP_MAX_DA) {
+		_pol_mac_put(da, cp->da[*nr_da]);
+		cp->match_en |= 1U << *nr_da;
+		(*nr_da)++;
+	} else if (!(cp->match_en & _pol_cp_bits(POL_CP_C48))) {
+		_pol_mac_put(da, cp->da[POL_CP_C48]);
+		cp->match_en |= _pol_cp_bits(POL_CP_C48);
+	} else {
+		return -ENOSPC;
+	}
+
+	return 0;
+}
+
+/* Pack control packet rules into the CP classifier */
+static int _pol_compile_cp(const struct msec_pol *pol, struct pol_work *w,
+			   struct msec_pol_out *out)
+{
+	struct msec_pol_cp *cp = &out->cp;
+	const struct msec_pol_rule *r;
+	struct pol_ival t;
+	u16 i, j, n = 0, nr_comb = 0, nr_et = 0, best;
+	u32 nr_da = 0, unit;
+	u64 size;
+	int ret;
+
+	memset(cp, 0, sizeof(*cp));
+
+	/* Ether-type and combined entries, dropping duplicates */
+	for (i = 0; i < pol->num; i++) {
+		r = &pol->rule[i];
+
+		if (r->act != MSEC_POL_ACT_CONTROL)
+			continue;
+
+		for (j = 0; j < i; j++) {
+			if ((pol->rule[j].act == MSEC_POL_ACT_CONTROL) && w->alive[j] &&
+			    _pol_subset(&w->key[i], &w->key[j])) {
+				_pol_diag(out, w, i, MSEC_POL_REDUNDANT, j);
+				break;
+			}
+		}
+
+		if (!w->alive[i] || ((r->match & MSEC_POL_M_DA) && !(r->match & MSEC_POL_M_ETYPE)))
+			continue;
+
+		if (!(r->match & MSEC_POL_M_DA)) {
+			if (nr_et >= POL_CP_MAX_ET)
+				return -ENOSPC;
+
+			/* ET 0~7, then ET 10~17 */
+			unit = (nr_et < 8) ? nr_et : (nr_et + 2);
+			cp->et[unit] = r->eth_type;
+			cp->match_en |= (nr_et < 8) ? (1U << (8 + nr_et)) :
+					_pol_cp_bits(POL_CP_ET_HI + nr_et - 8);
+			nr_et++;
+		} else {
+			if (nr_comb >= 2)
+				return -ENOSPC;
+
+			memcpy(cp->da[POL_CP_COMB_8 + nr_comb], r->da, 6);
+			cp->et[POL_CP_COMB_8 + nr_comb] = r->eth_type;
+			cp->match_en |= _pol_cp_bits(POL_CP_COMB_8 + nr_comb);
+			nr_comb++;
+		}
+	}
+
+	/* DA prefixes as intervals, combined rules covered by one are dropped */
+	for (i = 0; i < pol->num; i++) {
+		r = &pol->rule[i];
+
+		if ((r->act != MSEC_POL_ACT_CONTROL) || !w->alive[i] ||
+		    (r->match & MSEC_POL_M_ETYPE))
+			continue;
+
+		size = 1ULL << (8 * (6 - __builtin_popcount(r->da_mask)));
+		w->ival[n].start = _pol_mac64(r->da) & ~(size - 1);
+		w->ival[n].end = w->ival[n].start + size - 1;
+		w->ival[n].rule = i;
+		n++;
+	}
+
+	/* Sort by start, then merge overlapping or adjacent intervals */
+	for (i = 1; i < n; i++) {
+		t = w->ival[i];
+
+		for (j = i; j > 0 && w->ival[j - 1].start > t.start; j--)
+			w->ival[j] = w->ival[j - 1];
+
+		w->ival[j] = t;
+	}
+
+	for (i = 0, j = 0; i < n; i++) {
+		if ((j > 0) && (w->ival[i].start <= w->ival[j - 1].end + 1)) {
+			if (w->ival[i].end <= w->ival[j - 1].end) {
+				_pol_diag(out, w, w->ival[i].rule, MSEC_POL_REDUNDANT,
+					  w->ival[j - 1].rule);
+			} else {
+				w->ival[j - 1].end = w->ival[i].end;
+				_pol_diag(out, w, w->ival[i].rule, MSEC_POL_MERGED,
+					  w->ival[j - 1].rule);
+			}
+
+			continue;
+		}
+
+		w->ival[j++] = w->ival[i];
+	}
+
+	n = j;
+
+	for (i = 0; i < pol->num; i++) {
+		r = &pol->rule[i];
+
+		if ((r->act != MSEC_POL_ACT_CONTROL) || !w->alive[i] ||
+		    !(r->match & MSEC_POL_M_DA) || !(r->match & MSEC_POL_M_ETYPE))
+			continue;
+
+		for (j = 0; j < n; j++) {
+			if ((_pol_mac64(r->da) >= w->ival[j].start) &&
+			    (_pol_mac64(r->da) <= w->ival[j].end)) {
+				LOG_WARN("WARN: Rule %u is covered by DA rule %u\n", i, w->ival[j].rule);
+				_pol_diag(out, w, i, MSEC_POL_REDUNDANT, w->ival[j].rule);
+				break;
+			}
+		}
+	}
+
+	/* One 16 address aligned block for const44 */
+	for (i = 0; i < n; i++) {
+		if (!(w->ival[i].start & 0xF) && (w->ival[i].end == w->ival[i].start + 15)) {
+			_pol_mac_put(w->ival[i].start, cp->da[POL_CP_C44]);
+			cp->match_en |= _pol_cp_bits(POL_CP_C44);
+			w->ival[i] = w->ival[--n];
+			break;
+		}
+	}
+
+	/* Largest remaining block for the range */
+	best = POL_NONE;
+
+	for (i = 0; i < n; i++) {
+		if ((w->ival[i].end > w->ival[i].start) &&
+		    ((best == POL_NONE) ||
+		     (w->ival[i].end - w->ival[i].start > w->ival[best].end - w->ival[best].start)))
+			best = i;
+	}
+
+	if (best != POL_NONE) {
+		_pol_mac_put(w->ival[best].start, cp->da[POL_CP_RANGE]);
+		_pol_mac_put(w->ival[best].end, cp->da_end);
+		cp->match_en |= _pol_cp_bits(POL_CP_RANGE);
+		w->ival[best] = w->ival[--n];
+	}
+
+	/* Single DAs */
+	for (i = 0; i < n; i++) {
+		if (w->ival[i].end - w->ival[i].start >= POL_CP_MAX_DA + 1)
+			return -ENOSPC;
+
+		for (size = w->ival[i].start; size <= w->ival[i].end; size++) {
+			ret = _pol_cp_da(cp, &nr_da, size);
+
+			if (ret < 0)
+				return ret;
+		}
+	}
+
+	/* Packet Ether-type */
+	cp->match_mode = 0;
+
+	for (i = 0; i < pol->num; i++) {
+		if ((pol->rule[i].act == MSEC_POL_ACT_CONTROL) && w->alive[i])
+			out->diag[i] = MSEC_POL_INSTALLED;
+	}
+
+	return 0;
+}
+
+/* Content of a CP unit is unchanged */
+static int _pol_cp_unit_equal(const struct msec_pol_cp *a,
+			      const struct msec_pol_cp *b, u32 unit)
+{
+	if (unit < POL_CP_RANGE)
+		return !memcmp(a->da[unit], b->da[unit], 6) && (a->et[unit] == b->et[unit]);
+	else if (unit == POL_CP_RANGE)
+		return !memcmp(a->da[unit], b->da[unit], 6) && !memcmp(a->da_end, b->da_end, 6);
+	else if (unit < POL_CP_ET_HI)
+		return !memcmp(a->da[unit], b->da[unit], 6);
+
+	return a->et[unit - 3] == b->et[unit - 3];
+}
+
+static int _pol_diff_cp(const struct msec_pol_cp *old, const struct msec_pol_cp *cp,
+			struct msec_pol_diff *diff)
+{
+	u32 unit, bits, chg = 0;
+	int ret;
+
+	for (unit = 0; unit < MSEC_POL_CP_UNITS; unit++) {
+		bits = _pol_cp_bits(unit);
+
+		if (((old->match_en & bits) == (cp->match_en & bits)) &&
+		    (!(cp->match_en & bits) || _pol_cp_unit_equal(old, cp, unit)) &&
+		    (old->match_mode == cp->match_mode))
+			continue;
+
+		chg |= bits;
+		ret = _pol_add_op(diff, MSEC_POL_TBL_CP, MSEC_POL_OP_WRITE, (u8)unit, 0);
+
+		if (ret < 0)
+			return ret;
+	}
+
+	diff->cp_en_base = old->match_en & cp->match_en & ~chg;
+
+	return 0;
+}
+
+int gpy2xx_msec_pol_compile(const struct msec_pol *pol,
+			    const struct msec_pol_out *old,
+			    struct msec_pol_out *out, struct msec_pol_diff *diff)
+{
+	int ret = 0;
+	u16 i, j, r, n;
+	u8 old_idx[MACSEC_MAX_SA_RULES], clr_sam[MACSEC_MAX_SA_RULES + 1];
+	u8 clr_cc[MACSEC_MAX_SA_RULES + 1];
+	struct msec_pol_cp no_cp;
+	struct pol_work *w = NULL;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (pol == NULL || out == NULL || diff == NULL ||
+	    (pol->num && pol->rule == NULL)) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if ((pol->dir != INGRESS_DIR) && (pol->dir != EGRESS_DIR)) {
+		LOG_WARN("WARN: Invalid input (dir) - Direction\n");
+		return -EINVAL;
+	}
+
+	if (pol->num > MSEC_POL_MAX_RULES) {
+		LOG_WARN("WARN: Invalid input (num) - Max %u rules\n", MSEC_POL_MAX_RULES);
+		return -EINVAL;
+	}
+
+	if ((old != NULL) && ((old->dir != pol->dir) ||
+			      (old->nr_sam > MACSEC_MAX_SA_RULES) ||
+			      (old->nr_cc > MACSEC_MAX_SA_RULES))) {
+		LOG_WARN("WARN: Invalid input (old) - Installed rules\n");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < pol->num; i++) {
+		if (_pol_check_rule(pol, i) < 0) {
+			LOG_WARN("WARN: Invalid input (rule %u) - Match/action\n", i);
+			return -EINVAL;
+		}
+	}
+
+	w = os_alloc(sizeof(*w));
+
+	if (w == NULL) {
+		LOG_CRIT("Memory alloc failed :- %s\n", __func__);
+		return -ENOMEM;
+	}
+
+	memset(w, 0, sizeof(*w));
+	memset(out, 0, sizeof(*out));
+	memset(diff, 0, sizeof(*diff));
+	out->dir = pol->dir;
+
+	for (i = 0; i < pol->num; i++) {
+		_pol_key(pol, &pol->rule[i], &w->key[i]);
+		w->alive[i] = 1;
+
+		if (pol->rule[i].match & MSEC_POL_M_REF)
+			w->refd[pol->rule[i].ref] = 1;
+	}
+
+	/* SAM rules */
+	for (i = 0, n = 0; i < pol->num; i++) {
+		if (pol->rule[i].act == MSEC_POL_ACT_FLOW)
+			w->list[n++] = i;
+	}
+
+	ret = _pol_reduce(pol, w, out, n, POL_SAM_PRIO_MAX);
+
+	if (ret < 0)
+		goto END;
+
+	for (i = 0; i < n; i++) {
+		r = w->list[i];
+
+		if (!w->alive[r])
+			continue;
+
+		if (out->nr_sam >= MACSEC_MAX_SA_RULES) {
+			ret = -ENOSPC;
+			goto END;
+		}
+
+		_pol_build_sam(&pol->rule[r], &w->key[r], w->prio[r], &out->sam[out->nr_sam]);
+		out->sam_rule[out->nr_sam] = r;
+		w->sam_idx[r] = (u8)out->nr_sam;
+		out->nr_sam++;
+	}
+
+	/* Reuse installed SAM rules */
+	for (i = 0; i < out->nr_sam; i++) {
+		w->match[i] = POL_IDX_NONE;
+
+		for (j = 0; old != NULL && j < old->nr_sam; j++) {
+			if (_pol_sam_equal(&out->sam[i], &old->sam[j])) {
+				w->match[i] = (u8)j;
+				break;
+			}
+		}
+	}
+
+	for (j = 0; old != NULL && j < old->nr_sam; j++)
+		old_idx[j] = old->sam[j].rule_index;
+
+	/* CP classifier */
+	ret = _pol_compile_cp(pol, w, out);
+
+	if (ret < 0) {
+		LOG_WARN("WARN: Control packet rules exceed CP classifier entries\n");
+		goto END;
+	}
+
+	memset(&no_cp, 0, sizeof(no_cp));
+	ret = _pol_diff_cp((old != NULL) ? &old->cp : &no_cp, &out->cp, diff);
+
+	if (ret < 0)
+		goto END;
+
+	ret = _pol_assign(w, pol->sam_slots, old_idx, (old != NULL) ? old->nr_sam : 0,
+			  out->nr_sam, diff, MSEC_POL_TBL_SAM, clr_sam);
+
+	if (ret < 0) {
+		LOG_WARN("WARN: Not enough SAM rule slots\n");
+		goto END;
+	}
+
+	for (i = 0; i < out->nr_sam; i++)
+		out->sam[i].rule_index = w->new_idx[i];
+
+	/* CC rules, referring to the surviving SAM rule */
+	for (i = 0, n = 0; i < pol->num; i++) {
+		if ((pol->rule[i].act != MSEC_POL_ACT_PASS) &&
+		    (pol->rule[i].act != MSEC_POL_ACT_DROP))
+			continue;
+
+		if (pol->rule[i].match & MSEC_POL_M_REF) {
+			r = pol->rule[i].ref;
+
+			while (!w->alive[r] && (out->diag[r] != MSEC_POL_SHADOWED))
+				r = out->diag_ref[r];
+
+			if (!w->alive[r]) {
+				_pol_diag(out, w, i, MSEC_POL_SHADOWED, pol->rule[i].ref);
+				continue;
+			}
+
+			w->key[i].v[POL_K_REF] = (u8)(r >> 8);
+			w->key[i].v[POL_K_REF + 1] = (u8)r;
+		}
+
+		w->list[n++] = i;
+	}
+
+	ret = _pol_reduce(pol, w, out, n, POL_CC_PRIO_MAX);
+
+	if (ret < 0)
+		goto END;
+
+	for (i = 0; i < n; i++) {
+		r = w->list[i];
+
+		if (!w->alive[r])
+			continue;
+
+		if (out->nr_cc >= MACSEC_MAX_SA_RULES) {
+			ret = -ENOSPC;
+			goto END;
+		}
+
+		j = (w->key[r].v[POL_K_REF] << 8) | w->key[r].v[POL_K_REF + 1];
+		_pol_build_cc(&pol->rule[r], out->sam[w->sam_idx[j]].rule_index,
+			      w->prio[r], &out->cc[out->nr_cc]);
+		out->cc_rule[out->nr_cc] = r;
+		out->nr_cc++;
+	}
+
+	for (i = 0; i < out->nr_cc; i++) {
+		w->match[i] = POL_IDX_NONE;
+
+		for (j = 0; old != NULL && j < old->nr_cc; j++) {
+			if (_pol_cc_equal(&out->cc[i], &old->cc[j])) {
+				w->match[i] = (u8)j;
+				break;
+			}
+		}
+	}
+
+	for (j = 0; old != NULL && j < old->nr_cc; j++)
+		old_idx[j] = old->cc[j].icc_index;
+
+	ret = _pol_assign(w, pol->cc_slots, old_idx, (old != NULL) ? old->nr_cc : 0,
+			  out->nr_cc, diff, MSEC_POL_TBL_CC, clr_cc);
+
+	if (ret < 0) {
+		LOG_WARN("WARN: Not enough CC rule slots\n");
+		goto END;
+	}
+
+	for (i = 0; i < out->nr_cc; i++)
+		out->cc[i].icc_index = w->new_idx[i];
+
+	/* Clears last, CC before the SAM rules they refer to */
+	for (i = 0; (ret == 0) && (clr_cc[i] != POL_IDX_NONE); i++)
+		ret = _pol_add_op(diff, MSEC_POL_TBL_CC, MSEC_POL_OP_CLEAR, clr_cc[i], 0);
+
+	for (i = 0; (ret == 0) && (clr_sam[i] != POL_IDX_NONE); i++)
+		ret = _pol_add_op(diff, MSEC_POL_TBL_SAM, MSEC_POL_OP_CLEAR, clr_sam[i], 0);
+
+END:
+	os_free(w);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+static int _pol_sam_enable(struct gpy211_device *phy, enum msec_dir dir,
+			   u8 index, u8 enable)
+{
+	struct sam_ee_ctrl eec;
+
+	memset(&eec, 0, sizeof(eec));
+
+	if (enable) {
+		eec.sam_index_set = index;
+		eec.set_enable = 1;
+	} else {
+		eec.sam_index_clear = index;
+		eec.clear_enable = 1;
+	}
+
+	return (dir == INGRESS_DIR) ? gpy2xx_msec_config_ing_sam_eec(phy, &eec) :
+	       gpy2xx_msec_config_egr_sam_eec(phy, &eec);
+}
+
+static int _pol_cc_enable(struct gpy211_device *phy, u8 index, u8 enable)
+{
+	struct icc_ee_ctrl eec;
+
+	memset(&eec, 0, sizeof(eec));
+
+	if (enable) {
+		eec.cc_index_set = index;
+		eec.set_enable = 1;
+	} else {
+		eec.cc_index_clear = index;
+		eec.clear_enable = 1;
+	}
+
+	return gpy2xx_msec_config_ing_cc_eec(phy, &eec);
+}
+
+static int _pol_apply_cp(struct gpy211_device *phy, const struct msec_pol_out *out,
+			 u32 unit, u32 en)
+{
+	struct cp_class_param cpc;
+
+	memset(&cpc, 0, sizeof(cpc));
+
+	if (unit < POL_CP_RANGE) {
+		cpc.cpc_type = CPC_ENTRY_DA_ETH;
+		cpc.cpc_index = (u8)unit;
+		memcpy(cpc.mac_da, out->cp.da[unit], 6);
+		cpc.ether_type = out->cp.et[unit];
+	} else if (unit == POL_CP_RANGE) {
+		cpc.cpc_type = CPC_ENTRY_DA_RANGE;
+		memcpy(cpc.mac_da_start, out->cp.da[unit], 6);
+		memcpy(cpc.mac_da_end, out->cp.da_end, 6);
+	} else if (unit == POL_CP_C44) {
+		cpc.cpc_type = CPC_ENTRY_DA_CONST44;
+		memcpy(cpc.mac_da_const44, out->cp.da[unit], 6);
+	} else if (unit == POL_CP_C48) {
+		cpc.cpc_type = CPC_ENTRY_DA_CONST48;
+		memcpy(cpc.mac_da_const48, out->cp.da[unit], 6);
+	} else {
+		cpc.cpc_type = CPC_ENTRY_ETH;
+		cpc.cpc_index = (u8)(unit - 3);
+		cpc.ether_type = out->cp.et[unit - 3];
+	}
+
+	cpc.cpm_mode.cp_match_mask = out->cp.match_mode;
+	cpc.cpm_enable.cp_match_en = en;
+
+	return (out->dir == INGRESS_DIR) ? gpy2xx_msec_config_ing_cp_rule(phy, &cpc) :
+	       gpy2xx_msec_config_egr_cp_rule(phy, &cpc);
+}
+
+int gpy2xx_msec_pol_apply(struct gpy211_device *phy,
+			  const struct msec_pol_out *out,
+			  const struct msec_pol_diff *diff)
+{
+	int ret = 0;
+	u16 i;
+	u32 en;
+	const struct msec_pol_op *op;
+	struct sa_match_param sam;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || out == NULL || diff == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if (diff->num > MSEC_POL_MAX_OPS) {
+		LOG_WARN("WARN: Invalid input (num) - Diff operations\n");
+		return -EINVAL;
+	}
+
+	en = diff->cp_en_base;
+
+	for (i = 0; i < diff->num; i++) {
+		op = &diff->op[i];
+
+		if (((op->tbl == MSEC_POL_TBL_SAM) && (op->opc == MSEC_POL_OP_WRITE) &&
+		     (op->entry >= out->nr_sam)) ||
+		    ((op->tbl == MSEC_POL_TBL_CC) && (op->opc == MSEC_POL_OP_WRITE) &&
+		     (op->entry >= out->nr_cc)) ||
+		    ((op->tbl == MSEC_POL_TBL_CP) && (op->index >= MSEC_POL_CP_UNITS))) {
+			LOG_WARN("WARN: Invalid input (op %u) - Diff operation\n", i);
+			ret = -EINVAL;
+			goto END;
+		}
+
+		switch (op->tbl) {
+		case MSEC_POL_TBL_SAM:
+			/* Disabled while the rule words are rewritten */
+			ret = _pol_sam_enable(phy, out->dir, op->index, 0);
+
+			if (ret < 0)
+				break;
+
+			if (op->opc == MSEC_POL_OP_WRITE) {
+				ret = (out->dir == INGRESS_DIR) ?
+				      gpy2xx_msec_config_ing_sam_rule(phy, &out->sam[op->entry]) :
+				      gpy2xx_msec_config_egr_sam_rule(phy, &out->sam[op->entry]);
+
+				if (ret == 0)
+					ret = _pol_sam_enable(phy, out->dir, op->index, 1);
+			} else {
+				memset(&sam, 0, sizeof(sam));
+				sam.rule_index = op->index;
+				ret = (out->dir == INGRESS_DIR) ?
+				      gpy2xx_msec_clear_ing_sam_rule(phy, &sam) :
+				      gpy2xx_msec_clear_egr_sam_rule(phy, &sam);
+			}
+
+			break;
+
+		case MSEC_POL_TBL_CP:
+			en |= _pol_cp_bits(op->index) & out->cp.match_en;
+			ret = _pol_apply_cp(phy, out, op->index, en);
+			break;
+
+		case MSEC_POL_TBL_CC:
+			ret = _pol_cc_enable(phy, op->index, 0);
+
+			if ((ret == 0) && (op->opc == MSEC_POL_OP_WRITE)) {
+				ret = gpy2xx_msec_config_ing_cc_rule(phy, &out->cc[op->entry]);
+
+				if (ret == 0)
+					ret = _pol_cc_enable(phy, op->index, 1);
+			}
+
+			break;
+
+		default:
+			ret = -EINVAL;
+			break;
+		}
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: Policy operation %u (table %u, index %u) fails\n",
+				 i, op->tbl, op->index);
+			goto END;
+		}
+	}
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
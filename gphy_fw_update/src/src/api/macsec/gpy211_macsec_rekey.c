@@ -0,0 +1,302 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/math64.h>
+#define REKEY_DIV64(a, b) div64_u64(a, b)
+#else
+#define REKEY_DIV64(a, b) ((a) / (b))
+#endif
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_rekey.h"
+
+/* Max PN of 32-bit and 64-bit (XPN) packet numbering */
+#define REKEY_PN_MAX_32B 0xFFFFFFFFull
+#define REKEY_PN_MAX_64B 0xFFFFFFFFFFFFFFFFull
+
+/* Projected time to exhaustion when no traffic has been sampled */
+#define REKEY_TTL_INFINITE 0xFFFFFFFFFFFFFFFFull
+
+static u64 _rekey_pn_limit(enum crypto_algorithm ca_type)
+{
+	if ((ca_type == GCM_AES_XPN_128) || (ca_type == GCM_AES_XPN_256))
+		return REKEY_PN_MAX_64B;
+
+	return REKEY_PN_MAX_32B;
+}
+
+static u64 _rekey_project_ttl(u64 pn, u64 pn_limit, u64 pn_rate)
+{
+	u64 remain, sec;
+
+	if (pn_rate == 0)
+		return REKEY_TTL_INFINITE;
+
+	remain = (pn >= pn_limit) ? 0 : (pn_limit - pn);
+
+	/* Avoid overflow of (remain * 1000) for 64-bit PN, saturate if even
+	   the TTL in seconds does not fit in milliseconds */
+	if (remain > REKEY_DIV64(REKEY_TTL_INFINITE, 1000)) {
+		sec = REKEY_DIV64(remain, pn_rate);
+
+		if (sec > REKEY_DIV64(REKEY_TTL_INFINITE, 1000))
+			return REKEY_TTL_INFINITE;
+
+		return sec * 1000;
+	}
+
+	return REKEY_DIV64(remain * 1000, pn_rate);
+}
+
+static int _rekey_get_pn(struct gpy211_device *phy, u8 sa_index, u64 *pn)
+{
+	int ret;
+	struct sa_current_pn curr_pn = {.sa_index = sa_index};
+
+	ret = gpy2xx_msec_get_egr_pn(phy, &curr_pn);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_get_egr_pn fails\n");
+		return ret;
+	}
+
+	*pn = curr_pn.curr_pn;
+
+	return ret;
+}
+
+/* Switch-over done: old active slot becomes standby slot */
+static int _rekey_complete(struct gpy211_device *phy, struct msec_rekey *rk,
+			   u64 pn, u64 now_ms)
+{
+	int ret;
+	u8 old_sa = rk->act_sa;
+	struct transform_rec old_tr;
+
+	memset(&old_tr, 0, sizeof(old_tr));
+	old_tr.sa_index = old_sa;
+	old_tr.ccw = rk->act_ccw;
+
+	rk->act_sa = rk->stby_sa;
+	rk->act_ccw = rk->stby_ccw;
+	rk->stby_sa = old_sa;
+	memset(&rk->stby_ccw, 0, sizeof(rk->stby_ccw));
+	rk->stby_pn = 0;
+
+	rk->state = MSEC_REKEY_IDLE;
+	rk->pn_limit = _rekey_pn_limit(rk->act_ccw.ca_type);
+	rk->last_pn = pn;
+	rk->last_ms = now_ms;
+	rk->ttl_ms = _rekey_project_ttl(pn, rk->pn_limit, rk->pn_rate);
+	rk->switches++;
+
+	/* Old key must not stay in the device */
+	ret = gpy2xx_msec_clear_egr_tr(phy, &old_tr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_clear_egr_tr fails\n");
+		return ret;
+	}
+
+	return 1;
+}
+
+int gpy2xx_msec_rekey_init(struct gpy211_device *phy, struct msec_rekey *rk,
+			   const struct transform_rec *act_tr, u8 stby_sa)
+{
+	int ret;
+	u64 pn;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || rk == NULL || act_tr == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	/* Validate SA rule num range */
+	if ((act_tr->sa_index >= phy->nr_of_sas) || (stby_sa >= phy->nr_of_sas) ||
+	    (act_tr->sa_index == stby_sa)) {
+		LOG_WARN("WARN: Invalid input (sa_index) - SA rule num\n");
+		return -EINVAL;
+	}
+
+	/* Validate Crypto Algorithm type range */
+	if ((act_tr->ccw.ca_type < GCM_AES_128) || (act_tr->ccw.ca_type > GCM_AES_XPN_256)) {
+		LOG_WARN("WARN: Invalid input (ca_type) - Crypto Algorithm type\n");
+		return -EINVAL;
+	}
+
+	ret = _rekey_get_pn(phy, act_tr->sa_index, &pn);
+
+	if (ret < 0)
+		goto END;
+
+	rk->state = MSEC_REKEY_IDLE;
+	rk->act_sa = act_tr->sa_index;
+	rk->act_ccw = act_tr->ccw;
+	rk->act_ccw.sn_type = ((act_tr->ccw.ca_type == GCM_AES_128) ||
+			       (act_tr->ccw.ca_type == GCM_AES_256)) ? SN_32_BIT : SN_64_BIT;
+	rk->stby_sa = stby_sa;
+	memset(&rk->stby_ccw, 0, sizeof(rk->stby_ccw));
+	rk->stby_pn = 0;
+	rk->pn_limit = _rekey_pn_limit(rk->act_ccw.ca_type);
+	rk->last_pn = pn;
+	rk->last_ms = 0;
+	rk->pn_rate = 0;
+	rk->ttl_ms = REKEY_TTL_INFINITE;
+	rk->switches = 0;
+
+	if (rk->lead_ms == 0)
+		rk->lead_ms = MSEC_REKEY_DEF_LEAD_MS;
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_rekey_stage(struct gpy211_device *phy, struct msec_rekey *rk,
+			    struct transform_rec *next_tr)
+{
+	int ret;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || rk == NULL || next_tr == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if (rk->state == MSEC_REKEY_ARMED) {
+		LOG_WARN("WARN: Switch-over to standby SA is already armed\n");
+		return -EBUSY;
+	}
+
+	next_tr->sa_index = rk->stby_sa;
+	next_tr->ccw.an = (rk->act_ccw.an + 1) % 4;
+	memset(&next_tr->sa_update, 0, sizeof(next_tr->sa_update));
+
+	if (next_tr->pn_rc.seq_num == 0)
+		next_tr->pn_rc.seq_num = 1;
+
+	/* Full TR build (incl. hash key) happens here, off the critical path */
+	ret = gpy2xx_msec_config_egr_tr(phy, next_tr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_config_egr_tr fails\n");
+		goto END;
+	}
+
+	rk->stby_ccw = next_tr->ccw;
+	rk->stby_pn = next_tr->pn_rc.seq_num;
+	rk->state = MSEC_REKEY_STAGED;
+
+	if (rk->ttl_ms <= rk->lead_ms)
+		ret = gpy2xx_msec_rekey_arm(phy, rk);
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_rekey_arm(struct gpy211_device *phy, struct msec_rekey *rk)
+{
+	int ret;
+	struct transform_rec act_tr;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || rk == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (rk->state == MSEC_REKEY_ARMED)
+		return 0;
+
+	if (rk->state != MSEC_REKEY_STAGED) {
+		LOG_WARN("WARN: No next SA staged\n");
+		return -EINVAL;
+	}
+
+	memset(&act_tr, 0, sizeof(act_tr));
+	act_tr.sa_index = rk->act_sa;
+	act_tr.ccw = rk->act_ccw;
+	act_tr.sa_update.sa_index = rk->stby_sa;
+	act_tr.sa_update.sa_index_valid = 1;
+	act_tr.sa_update.flow_index = rk->flow_index;
+	act_tr.sa_update.sa_ind_update_en = 1;
+	act_tr.sa_update.sa_expired_irq = 1;
+
+	/* Single word write on the critical path */
+	ret = gpy2xx_msec_update_egr_sa_cw(phy, &act_tr);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_update_egr_sa_cw fails\n");
+		goto END;
+	}
+
+	rk->state = MSEC_REKEY_ARMED;
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_msec_rekey_sample(struct gpy211_device *phy, struct msec_rekey *rk,
+			     u64 now_ms)
+{
+	int ret;
+	u64 pn, stby_pn, rate;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || rk == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (rk->state == MSEC_REKEY_ARMED) {
+		/* Flow moved to standby SA once its PN advances */
+		ret = _rekey_get_pn(phy, rk->stby_sa, &stby_pn);
+
+		if (ret < 0)
+			goto END;
+
+		if (stby_pn > rk->stby_pn) {
+			ret = _rekey_complete(phy, rk, stby_pn, now_ms);
+			goto END;
+		}
+	}
+
+	ret = _rekey_get_pn(phy, rk->act_sa, &pn);
+
+	if (ret < 0)
+		goto END;
+
+	if ((rk->last_ms != 0) && (now_ms > rk->last_ms) && (pn >= rk->last_pn)) {
+		rate = REKEY_DIV64((pn - rk->last_pn) * 1000, now_ms - rk->last_ms);
+
+		/* Smooth with 1/4 weight of the new sample */
+		if (rk->pn_rate == 0)
+			rk->pn_rate = rate;
+		else
+			rk->pn_rate = (rk->pn_rate * 3 + rate) / 4;
+	}
+
+	rk->last_pn = pn;
+	rk->last_ms = now_ms;
+	rk->ttl_ms = _rekey_project_ttl(pn, rk->pn_limit, rk->pn_rate);
+
+	if ((rk->state == MSEC_REKEY_STAGED) && (rk->ttl_ms <= rk->lead_ms))
+		ret = gpy2xx_msec_rekey_arm(phy, rk);
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
@@ -0,0 +1,794 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef __KERNEL__
+
+#include <pthread.h>
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_sw.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define GHASH_HW_X86 1
+#elif defined(__aarch64__) && defined(__AARCH64EL__) && defined(__GNUC__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#include <arm_neon.h>
+#define GHASH_HW_ARM64 1
+#endif
+
+#define SW_GETU32(p) (((u32)(p)[0] << 24) | ((u32)(p)[1] << 16) | \
+		      ((u32)(p)[2] << 8) | ((u32)(p)[3]))
+#define SW_PUTU32(p, v) do { \
+		(p)[0] = (u8)((v) >> 24); \
+		(p)[1] = (u8)((v) >> 16); \
+		(p)[2] = (u8)((v) >> 8); \
+		(p)[3] = (u8)(v); \
+	} while (0)
+#define SW_GETU64(p) (((u64)SW_GETU32(p) << 32) | SW_GETU32((p) + 4))
+#define SW_PUTU64(p, v) do { \
+		SW_PUTU32((p), (u32)((v) >> 32)); \
+		SW_PUTU32((p) + 4, (u32)(v)); \
+	} while (0)
+
+/* SL is only used for secure data shorter than 48 bytes */
+#define SW_SL_MAX 48
+#define SW_PN_MAX_32B 0xFFFFFFFFull
+
+typedef void (*ghash_fn)(const struct msec_sw_sa *sa, u8 *y, const u8 *data,
+			 u32 nblk);
+typedef void (*ghash_key_fn)(struct msec_sw_sa *sa, const u8 *h);
+
+static ghash_fn ghash_blocks;
+static ghash_key_fn ghash_key;
+static pthread_once_t ghash_once = PTHREAD_ONCE_INIT;
+
+/* Reduction of the 4 bits shifted out, x^128 = x^7 + x^2 + x + 1 */
+static const u64 ghash_last4[16] = {
+	0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+	0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+/* Shoup's 4-bit tables: hh/hl[i] = i * H */
+static void _ghash_key_table(struct msec_sw_sa *sa, const u8 *h)
+{
+	u32 i, j;
+	u64 vh, vl, t;
+
+	vh = SW_GETU64(h);
+	vl = SW_GETU64(h + 8);
+
+	sa->hh[8] = vh;
+	sa->hl[8] = vl;
+	sa->hh[0] = 0;
+	sa->hl[0] = 0;
+
+	for (i = 4; i > 0; i >>= 1) {
+		t = (vl & 1) * 0xe1000000U;
+		vl = (vh << 63) | (vl >> 1);
+		vh = (vh >> 1) ^ (t << 32);
+		sa->hh[i] = vh;
+		sa->hl[i] = vl;
+	}
+
+	for (i = 2; i <= 8; i *= 2) {
+		vh = sa->hh[i];
+		vl = sa->hl[i];
+
+		for (j = 1; j < i; j++) {
+			sa->hh[i + j] = vh ^ sa->hh[j];
+			sa->hl[i + j] = vl ^ sa->hl[j];
+		}
+	}
+}
+
+/* x = x * H */
+static void _ghash_mult_table(const struct msec_sw_sa *sa, u8 *x)
+{
+	int i;
+	u8 lo, hi, rem;
+	u64 zh, zl;
+
+	lo = x[15] & 0xf;
+	zh = sa->hh[lo];
+	zl = sa->hl[lo];
+
+	for (i = 15; i >= 0; i--) {
+		lo = x[i] & 0xf;
+		hi = (x[i] >> 4) & 0xf;
+
+		if (i != 15) {
+			rem = (u8)(zl & 0xf);
+			zl = (zh << 60) | (zl >> 4);
+			zh = (zh >> 4) ^ (ghash_last4[rem] << 48);
+			zh ^= sa->hh[lo];
+			zl ^= sa->hl[lo];
+		}
+
+		rem = (u8)(zl & 0xf);
+		zl = (zh << 60) | (zl >> 4);
+		zh = (zh >> 4) ^ (ghash_last4[rem] << 48);
+		zh ^= sa->hh[hi];
+		zl ^= sa->hl[hi];
+	}
+
+	SW_PUTU64(x, zh);
+	SW_PUTU64(x + 8, zl);
+}
+
+static void _ghash_blocks_table(const struct msec_sw_sa *sa, u8 *y,
+				const u8 *data, u32 nblk)
+{
+	u32 i;
+
+	for (; nblk > 0; nblk--) {
+		for (i = 0; i < MSEC_AES_BLOCK_LEN; i++)
+			y[i] ^= data[i];
+
+		_ghash_mult_table(sa, y);
+		data += MSEC_AES_BLOCK_LEN;
+	}
+}
+
+#if defined(GHASH_HW_X86) && GHASH_HW_X86
+/* Operands are byte-reflected blocks (Intel CLMUL white paper, gfmul) */
+__attribute__((target("pclmul,ssse3")))
+static inline void _ghash_clmul256(__m128i a, __m128i b, __m128i *lo, __m128i *hi)
+{
+	__m128i t0, t1, m;
+
+	t0 = _mm_clmulepi64_si128(a, b, 0x00);
+	t1 = _mm_clmulepi64_si128(a, b, 0x11);
+	m = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+			  _mm_clmulepi64_si128(a, b, 0x01));
+
+	*lo = _mm_xor_si128(t0, _mm_slli_si128(m, 8));
+	*hi = _mm_xor_si128(t1, _mm_srli_si128(m, 8));
+}
+
+/* Shift the 256-bit product left by one (bit reflection) and reduce */
+__attribute__((target("pclmul,ssse3")))
+static inline __m128i _ghash_clmul_reduce(__m128i lo, __m128i hi)
+{
+	__m128i t2, t4, t5, t7, t8, t9;
+
+	t7 = _mm_srli_epi32(lo, 31);
+	t8 = _mm_srli_epi32(hi, 31);
+	lo = _mm_slli_epi32(lo, 1);
+	hi = _mm_slli_epi32(hi, 1);
+	t9 = _mm_srli_si128(t7, 12);
+	t8 = _mm_slli_si128(t8, 4);
+	t7 = _mm_slli_si128(t7, 4);
+	lo = _mm_or_si128(lo, t7);
+	hi = _mm_or_si128(hi, t8);
+	hi = _mm_or_si128(hi, t9);
+
+	t7 = _mm_slli_epi32(lo, 31);
+	t8 = _mm_slli_epi32(lo, 30);
+	t9 = _mm_slli_epi32(lo, 25);
+	t7 = _mm_xor_si128(t7, t8);
+	t7 = _mm_xor_si128(t7, t9);
+	t8 = _mm_srli_si128(t7, 4);
+	t7 = _mm_slli_si128(t7, 12);
+	lo = _mm_xor_si128(lo, t7);
+
+	t2 = _mm_srli_epi32(lo, 1);
+	t4 = _mm_srli_epi32(lo, 2);
+	t5 = _mm_srli_epi32(lo, 7);
+	t2 = _mm_xor_si128(t2, t4);
+	t2 = _mm_xor_si128(t2, t5);
+	t2 = _mm_xor_si128(t2, t8);
+	lo = _mm_xor_si128(lo, t2);
+
+	return _mm_xor_si128(hi, lo);
+}
+
+__attribute__((target("pclmul,ssse3")))
+static void _ghash_key_clmul(struct msec_sw_sa *sa, const u8 *h)
+{
+	u32 i;
+	__m128i lo, hi, h1, hn;
+	const __m128i rev = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+					 8, 9, 10, 11, 12, 13, 14, 15);
+
+	h1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)h), rev);
+	hn = h1;
+	_mm_storeu_si128((__m128i *)sa->hpow[0], h1);
+
+	for (i = 1; i < 4; i++) {
+		_ghash_clmul256(hn, h1, &lo, &hi);
+		hn = _ghash_clmul_reduce(lo, hi);
+		_mm_storeu_si128((__m128i *)sa->hpow[i], hn);
+	}
+
+	_ghash_key_table(sa, h);
+}
+
+/* Four blocks per reduction: Y = (Y ^ X0)H^4 ^ X1H^3 ^ X2H^2 ^ X3H */
+__attribute__((target("pclmul,ssse3")))
+static void _ghash_blocks_clmul(const struct msec_sw_sa *sa, u8 *y,
+				const u8 *data, u32 nblk)
+{
+	u32 i;
+	__m128i acc, x, lo, hi, l, h, hp[4];
+	const __m128i rev = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+					 8, 9, 10, 11, 12, 13, 14, 15);
+
+	for (i = 0; i < 4; i++)
+		hp[i] = _mm_loadu_si128((const __m128i *)sa->hpow[i]);
+
+	acc = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)y), rev);
+
+	for (; nblk >= 4; nblk -= 4) {
+		x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), rev);
+		_ghash_clmul256(_mm_xor_si128(acc, x), hp[3], &lo, &hi);
+
+		for (i = 1; i < 4; i++) {
+			x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), rev);
+			_ghash_clmul256(x, hp[3 - i], &l, &h);
+			lo = _mm_xor_si128(lo, l);
+			hi = _mm_xor_si128(hi, h);
+		}
+
+		acc = _ghash_clmul_reduce(lo, hi);
+		data += 4 * MSEC_AES_BLOCK_LEN;
+	}
+
+	for (; nblk > 0; nblk--) {
+		x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), rev);
+		_ghash_clmul256(_mm_xor_si128(acc, x), hp[0], &lo, &hi);
+		acc = _ghash_clmul_reduce(lo, hi);
+		data += MSEC_AES_BLOCK_LEN;
+	}
+
+	_mm_storeu_si128((__m128i *)y, _mm_shuffle_epi8(acc, rev));
+}
+
+static int _ghash_hw_supported(void)
+{
+	u32 eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return 0;
+
+	return (ecx & bit_PCLMUL) && (ecx & bit_SSSE3);
+}
+
+static ghash_fn _ghash_hw_fn(void)
+{
+	return _ghash_blocks_clmul;
+}
+
+static ghash_key_fn _ghash_hw_key_fn(void)
+{
+	return _ghash_key_clmul;
+}
+#elif defined(GHASH_HW_ARM64) && GHASH_HW_ARM64
+/* Operands are bit-reflected per byte (RBIT), so bit i of the 128-bit
+   little-endian value is the coefficient of x^i */
+__attribute__((target("+crypto")))
+static inline uint64x2_t _ghash_pmull(uint64x2_t a, int la, uint64x2_t b, int lb)
+{
+	poly64_t x = (poly64_t)(la ? vgetq_lane_u64(a, 1) : vgetq_lane_u64(a, 0));
+	poly64_t y = (poly64_t)(lb ? vgetq_lane_u64(b, 1) : vgetq_lane_u64(b, 0));
+
+	return vreinterpretq_u64_p128(vmull_p64(x, y));
+}
+
+__attribute__((target("+crypto")))
+static inline void _ghash_pmull256(uint64x2_t a, uint64x2_t b, uint64x2_t *lo,
+				   uint64x2_t *hi)
+{
+	const uint64x2_t zero = vdupq_n_u64(0);
+	uint64x2_t t0, t1, m;
+
+	t0 = _ghash_pmull(a, 0, b, 0);
+	t1 = _ghash_pmull(a, 1, b, 1);
+	m = veorq_u64(_ghash_pmull(a, 0, b, 1), _ghash_pmull(a, 1, b, 0));
+
+	*lo = veorq_u64(t0, vextq_u64(zero, m, 1));
+	*hi = veorq_u64(t1, vextq_u64(m, zero, 1));
+}
+
+/* Fold x^128..x^255 twice with x^128 = 0x87 */
+__attribute__((target("+crypto")))
+static inline uint64x2_t _ghash_pmull_reduce(uint64x2_t lo, uint64x2_t hi)
+{
+	const uint64x2_t zero = vdupq_n_u64(0);
+	const poly64_t r = 0x87;
+	uint64x2_t t;
+
+	t = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(hi, 1), r));
+	lo = veorq_u64(lo, vextq_u64(zero, t, 1));
+	hi = veorq_u64(hi, vextq_u64(t, zero, 1));
+
+	t = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(hi, 0), r));
+
+	return veorq_u64(lo, t);
+}
+
+__attribute__((target("+crypto")))
+static inline uint64x2_t _ghash_pmull_load(const u8 *p)
+{
+	return vreinterpretq_u64_u8(vrbitq_u8(vld1q_u8(p)));
+}
+
+__attribute__((target("+crypto")))
+static void _ghash_key_pmull(struct msec_sw_sa *sa, const u8 *h)
+{
+	u32 i;
+	uint64x2_t lo, hi, h1, hn;
+
+	h1 = _ghash_pmull_load(h);
+	hn = h1;
+	vst1q_u64((u64 *)sa->hpow[0], h1);
+
+	for (i = 1; i < 4; i++) {
+		_ghash_pmull256(hn, h1, &lo, &hi);
+		hn = _ghash_pmull_reduce(lo, hi);
+		vst1q_u64((u64 *)sa->hpow[i], hn);
+	}
+
+	_ghash_key_table(sa, h);
+}
+
+/* Four blocks per reduction: Y = (Y ^ X0)H^4 ^ X1H^3 ^ X2H^2 ^ X3H */
+__attribute__((target("+crypto")))
+static void _ghash_blocks_pmull(const struct msec_sw_sa *sa, u8 *y,
+				const u8 *data, u32 nblk)
+{
+	u32 i;
+	uint64x2_t acc, x, lo, hi, l, h, hp[4];
+
+	for (i = 0; i < 4; i++)
+		hp[i] = vld1q_u64((const u64 *)sa->hpow[i]);
+
+	acc = _ghash_pmull_load(y);
+
+	for (; nblk >= 4; nblk -= 4) {
+		x = _ghash_pmull_load(data);
+		_ghash_pmull256(veorq_u64(acc, x), hp[3], &lo, &hi);
+
+		for (i = 1; i < 4; i++) {
+			x = _ghash_pmull_load(data + 16 * i);
+			_ghash_pmull256(x, hp[3 - i], &l, &h);
+			lo = veorq_u64(lo, l);
+			hi = veorq_u64(hi, h);
+		}
+
+		acc = _ghash_pmull_reduce(lo, hi);
+		data += 4 * MSEC_AES_BLOCK_LEN;
+	}
+
+	for (; nblk > 0; nblk--) {
+		x = _ghash_pmull_load(data);
+		_ghash_pmull256(veorq_u64(acc, x), hp[0], &lo, &hi);
+		acc = _ghash_pmull_reduce(lo, hi);
+		data += MSEC_AES_BLOCK_LEN;
+	}
+
+	vst1q_u8(y, vrbitq_u8(vreinterpretq_u8_u64(acc)));
+}
+
+static int _ghash_hw_supported(void)
+{
+	return (getauxval(AT_HWCAP) & HWCAP_PMULL) ? 1 : 0;
+}
+
+static ghash_fn _ghash_hw_fn(void)
+{
+	return _ghash_blocks_pmull;
+}
+
+static ghash_key_fn _ghash_hw_key_fn(void)
+{
+	return _ghash_key_pmull;
+}
+#else
+static int _ghash_hw_supported(void)
+{
+	return 0;
+}
+
+static ghash_fn _ghash_hw_fn(void)
+{
+	return _ghash_blocks_table;
+}
+
+static ghash_key_fn _ghash_hw_key_fn(void)
+{
+	return _ghash_key_table;
+}
+#endif
+
+static void _sw_init(void)
+{
+	if (_ghash_hw_supported()) {
+		ghash_key = _ghash_hw_key_fn();
+		ghash_blocks = _ghash_hw_fn();
+	} else {
+		ghash_key = _ghash_key_table;
+		ghash_blocks = _ghash_blocks_table;
+	}
+}
+
+/* Both function pointers are published to every caller */
+static void _sw_init_once(void)
+{
+	pthread_once(&ghash_once, _sw_init);
+}
+
+/* Clear key material, not to be optimized away */
+static void _sw_wipe(void *p, u32 len)
+{
+	memset(p, 0, len);
+	__asm__ __volatile__("" : : "r"(p) : "memory");
+}
+
+/* GHASH of data, last partial block zero padded */
+static void _ghash_update(const struct msec_sw_sa *sa, u8 *y, const u8 *data,
+			  u32 len)
+{
+	u32 nblk = len / MSEC_AES_BLOCK_LEN;
+	u8 blk[MSEC_AES_BLOCK_LEN];
+
+	if (nblk)
+		ghash_blocks(sa, y, data, nblk);
+
+	len %= MSEC_AES_BLOCK_LEN;
+
+	if (len) {
+		memset(blk, 0, sizeof(blk));
+		memcpy(blk, data + nblk * MSEC_AES_BLOCK_LEN, len);
+		ghash_blocks(sa, y, blk, 1);
+	}
+}
+
+/* Tag = GHASH(A, C, len(A) || len(C)) ^ E(J0) */
+static void _gcm_tag(const struct msec_sw_sa *sa, const u8 *j0, u8 *y,
+		     u32 alen, u32 clen, u8 *tag)
+{
+	u32 i;
+	u8 blk[MSEC_AES_BLOCK_LEN];
+
+	SW_PUTU64(blk, (u64)alen * 8);
+	SW_PUTU64(blk + 8, (u64)clen * 8);
+	ghash_blocks(sa, y, blk, 1);
+
+	gpy2xx_msec_aes_encrypt(&sa->aes, j0, blk);
+
+	for (i = 0; i < MSEC_SW_ICV_LEN; i++)
+		tag[i] = y[i] ^ blk[i];
+}
+
+/* J0 = IV || 0^31 || 1 */
+static void _sw_j0(const struct msec_sw_sa *sa, u64 pn, u8 *j0)
+{
+	u32 i;
+
+	if (sa->xpn) {
+		/* (Salt ^ SSCI) || (Salt ^ PN) */
+		memcpy(j0, sa->salt, 4);
+
+		for (i = 0; i < 8; i++)
+			j0[4 + i] = sa->salt[4 + i] ^ (u8)(pn >> (56 - 8 * i));
+	} else {
+		/* SCI || PN */
+		memcpy(j0, sa->sci, MSEC_SW_SCI_LEN);
+		SW_PUTU32(j0 + 8, (u32)pn);
+	}
+
+	SW_PUTU32(j0 + 12, 1);
+}
+
+int gpy2xx_msec_sw_sa_init(struct msec_sw_sa *sa, enum msec_dir dir,
+			   const struct transform_rec *tr,
+			   const struct sa_match_fca *fca)
+{
+	int ret;
+	u32 i, keylen;
+	u8 h[MSEC_AES_BLOCK_LEN];
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (sa == NULL || tr == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if ((dir != INGRESS_DIR) && (dir != EGRESS_DIR)) {
+		LOG_WARN("WARN: Invalid input (dir) - Direction\n");
+		return -EINVAL;
+	}
+
+	/* Validate Crypto Algorithm type range */
+	if ((tr->ccw.ca_type < GCM_AES_128) || (tr->ccw.ca_type > GCM_AES_XPN_256)) {
+		LOG_WARN("WARN: Invalid input (ca_type) - Crypto Algorithm type\n");
+		return -EINVAL;
+	}
+
+	_sw_init_once();
+
+	memset(sa, 0, sizeof(*sa));
+	sa->dir = dir;
+	sa->xpn = ((tr->ccw.ca_type == GCM_AES_XPN_128) ||
+		   (tr->ccw.ca_type == GCM_AES_XPN_256)) ? 1 : 0;
+	keylen = ((tr->ccw.ca_type == GCM_AES_128) ||
+		  (tr->ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32;
+
+	ret = gpy2xx_msec_aes_setkey(&sa->aes, tr->cp.key, keylen);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_msec_aes_setkey fails\n");
+		goto END;
+	}
+
+	memset(h, 0, sizeof(h));
+	gpy2xx_msec_aes_encrypt(&sa->aes, h, h);
+	ghash_key(sa, h);
+	_sw_wipe(h, sizeof(h));
+
+	sa->an = tr->ccw.an & MSEC_SW_TCI_AN;
+	sa->next_pn = sa->xpn ? tr->pn_rc.seq_num : tr->pn_rc.seq0;
+
+	if (sa->next_pn == 0)
+		sa->next_pn = 1;
+
+	sa->replay_window = tr->pn_rc.mask;
+	memcpy(sa->sci, tr->cp.sci, MACSEC_SCI_LEN_BYTE);
+	memcpy(sa->salt, tr->cp.c_salt.salt, MACSEC_SALT_LEN_BYTE);
+
+	for (i = 0; i < MACSEC_SSCI_LEN_BYTE; i++)
+		sa->salt[i] ^= tr->cp.c_salt.s_sci[i];
+
+	if (fca != NULL) {
+		sa->conf_offset = fca->conf_offset;
+
+		if (dir == EGRESS_DIR) {
+			sa->encrypt = fca->conf_protect;
+			sa->send_sci = fca->include_sci;
+			sa->es = fca->use_es;
+			sa->scb = fca->use_scb;
+		} else {
+			sa->replay_protect = fca->replay_protect;
+			sa->validate = fca->validate_frames;
+		}
+	} else {
+		sa->encrypt = 1;
+		sa->send_sci = 1;
+		sa->replay_protect = 1;
+		sa->validate = SAM_FCA_VALIDATE_STRICT;
+	}
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+void gpy2xx_msec_sw_sa_clear(struct msec_sw_sa *sa)
+{
+	if (sa != NULL)
+		_sw_wipe(sa, sizeof(*sa));
+}
+
+int gpy2xx_msec_sw_get_sectag(const u8 *frame, u32 len,
+			      struct msec_sw_sectag *tag)
+{
+	u8 tci;
+
+	if (frame == NULL || tag == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if ((len < MSEC_SW_MAC_HDR_LEN + MSEC_SW_SECTAG_LEN + MSEC_SW_ICV_LEN) ||
+	    (frame[12] != (MSEC_SW_ETHERTYPE >> 8)) ||
+	    (frame[13] != (MSEC_SW_ETHERTYPE & 0xFF)))
+		return -EINVAL;
+
+	tci = frame[14];
+
+	/* V must be 0, E without C and SL above 47 are invalid */
+	if ((tci & 0x80) || ((tci & MSEC_SW_TCI_E) && !(tci & MSEC_SW_TCI_C)) ||
+	    (frame[15] >= SW_SL_MAX))
+		return -EINVAL;
+
+	tag->tci = tci & ~MSEC_SW_TCI_AN;
+	tag->an = tci & MSEC_SW_TCI_AN;
+	tag->sl = frame[15];
+	tag->pn = SW_GETU32(frame + 16);
+	tag->sci_present = (tci & MSEC_SW_TCI_SC) ? 1 : 0;
+	tag->hdr_len = MSEC_SW_MAC_HDR_LEN + MSEC_SW_SECTAG_LEN;
+
+	if (tag->sci_present) {
+		if (len < tag->hdr_len + MSEC_SW_SCI_LEN + MSEC_SW_ICV_LEN)
+			return -EINVAL;
+
+		memcpy(tag->sci, frame + tag->hdr_len, MSEC_SW_SCI_LEN);
+		tag->hdr_len += MSEC_SW_SCI_LEN;
+	}
+
+	return 0;
+}
+
+int gpy2xx_msec_sw_encrypt(struct msec_sw_sa *sa, const u8 *in, u32 len,
+			   u8 *out, u32 out_size)
+{
+	u32 hdr, dlen, off;
+	u64 pn;
+	u8 j0[MSEC_AES_BLOCK_LEN], ctr[MSEC_AES_BLOCK_LEN], y[MSEC_AES_BLOCK_LEN];
+
+	if (sa == NULL || in == NULL || out == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if ((sa->dir != EGRESS_DIR) || (len < MSEC_SW_MAC_HDR_LEN + 2))
+		return -EINVAL;
+
+	if ((sa->next_pn == 0) || (!sa->xpn && (sa->next_pn > SW_PN_MAX_32B)))
+		return -EOVERFLOW;
+
+	hdr = MSEC_SW_MAC_HDR_LEN + MSEC_SW_SECTAG_LEN +
+	      (sa->send_sci ? MSEC_SW_SCI_LEN : 0);
+	dlen = len - MSEC_SW_MAC_HDR_LEN;
+
+	if (hdr + dlen + MSEC_SW_ICV_LEN > out_size)
+		return -ENOSPC;
+
+	pn = sa->next_pn++;
+
+	/* DA, SA, SecTAG */
+	memcpy(out, in, MSEC_SW_MAC_HDR_LEN);
+	out[12] = MSEC_SW_ETHERTYPE >> 8;
+	out[13] = MSEC_SW_ETHERTYPE & 0xFF;
+	out[14] = (sa->es ? MSEC_SW_TCI_ES : 0) | (sa->send_sci ? MSEC_SW_TCI_SC : 0) |
+		  (sa->scb ? MSEC_SW_TCI_SCB : 0) |
+		  (sa->encrypt ? (MSEC_SW_TCI_E | MSEC_SW_TCI_C) : 0) | sa->an;
+	out[15] = (dlen < SW_SL_MAX) ? (u8)dlen : 0;
+	SW_PUTU32(out + 16, (u32)pn);
+
+	if (sa->send_sci)
+		memcpy(out + 20, sa->sci, MSEC_SW_SCI_LEN);
+
+	_sw_j0(sa, pn, j0);
+	memset(y, 0, sizeof(y));
+
+	if (sa->encrypt) {
+		off = (sa->conf_offset < dlen) ? sa->conf_offset : dlen;
+		memcpy(out + hdr, in + MSEC_SW_MAC_HDR_LEN, off);
+
+		memcpy(ctr, j0, sizeof(ctr));
+		SW_PUTU32(ctr + 12, 2);
+		gpy2xx_msec_aes_ctr32(&sa->aes, ctr, in + MSEC_SW_MAC_HDR_LEN + off,
+				      out + hdr + off, dlen - off);
+
+		_ghash_update(sa, y, out, hdr + off);
+		_ghash_update(sa, y, out + hdr + off, dlen - off);
+		_gcm_tag(sa, j0, y, hdr + off, dlen - off, out + hdr + dlen);
+	} else {
+		memcpy(out + hdr, in + MSEC_SW_MAC_HDR_LEN, dlen);
+
+		_ghash_update(sa, y, out, hdr + dlen);
+		_gcm_tag(sa, j0, y, hdr + dlen, 0, out + hdr + dlen);
+	}
+
+	sa->stats.pkts_ok++;
+	sa->stats.octets += dlen;
+
+	return (int)(hdr + dlen + MSEC_SW_ICV_LEN);
+}
+
+int gpy2xx_msec_sw_decrypt(struct msec_sw_sa *sa, const u8 *in, u32 len,
+			   u8 *out, u32 out_size)
+{
+	int ret;
+	u32 i, hdr, dlen, off, alen;
+	u64 pn, lowest;
+	u8 diff = 0, encrypted;
+	u8 j0[MSEC_AES_BLOCK_LEN], ctr[MSEC_AES_BLOCK_LEN], y[MSEC_AES_BLOCK_LEN];
+	u8 icv[MSEC_SW_ICV_LEN];
+	struct msec_sw_sectag tag;
+
+	if (sa == NULL || in == NULL || out == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (sa->dir != INGRESS_DIR)
+		return -EINVAL;
+
+	ret = gpy2xx_msec_sw_get_sectag(in, len, &tag);
+
+	if (ret < 0) {
+		sa->stats.pkts_bad_tag++;
+		return ret;
+	}
+
+	hdr = tag.hdr_len;
+	dlen = len - hdr - MSEC_SW_ICV_LEN;
+
+	/* SL is set if and only if secure data is shorter than 48 bytes */
+	if ((tag.sl != 0) ? (tag.sl != dlen) : (dlen < SW_SL_MAX)) {
+		sa->stats.pkts_bad_tag++;
+		return -EINVAL;
+	}
+
+	if ((tag.an != sa->an) ||
+	    (tag.sci_present && memcmp(tag.sci, sa->sci, MSEC_SW_SCI_LEN))) {
+		sa->stats.pkts_not_using_sa++;
+		return -ENOENT;
+	}
+
+	lowest = (sa->next_pn > sa->replay_window) ? (sa->next_pn - sa->replay_window) : 1;
+
+	if (sa->xpn) {
+		/* Recover upper half of PN from lowest acceptable PN */
+		pn = (lowest & ~SW_PN_MAX_32B) | tag.pn;
+
+		if (tag.pn < (u32)lowest)
+			pn += SW_PN_MAX_32B + 1;
+	} else {
+		pn = tag.pn;
+	}
+
+	if (pn == 0) {
+		sa->stats.pkts_bad_tag++;
+		return -EINVAL;
+	}
+
+	if (sa->replay_protect && (pn < lowest)) {
+		sa->stats.pkts_late++;
+		return -ERANGE;
+	}
+
+	if (MSEC_SW_MAC_HDR_LEN + dlen > out_size)
+		return -ENOSPC;
+
+	encrypted = (tag.tci & MSEC_SW_TCI_E) ? 1 : 0;
+	off = encrypted ? ((sa->conf_offset < dlen) ? sa->conf_offset : dlen) : dlen;
+	alen = hdr + off;
+
+	_sw_j0(sa, pn, j0);
+	memset(y, 0, sizeof(y));
+	_ghash_update(sa, y, in, alen);
+	_ghash_update(sa, y, in + alen, dlen - off);
+	_gcm_tag(sa, j0, y, alen, dlen - off, icv);
+
+	for (i = 0; i < MSEC_SW_ICV_LEN; i++)
+		diff |= icv[i] ^ in[hdr + dlen + i];
+
+	if (diff) {
+		sa->stats.pkts_invalid++;
+
+		/* Only integrity protected frames pass in Check/Disabled mode */
+		if (encrypted || (sa->validate == SAM_FCA_VALIDATE_STRICT))
+			return -EBADMSG;
+	} else {
+		sa->stats.pkts_ok++;
+		sa->stats.octets += dlen;
+
+		if (pn >= sa->next_pn)
+			sa->next_pn = pn + 1;
+	}
+
+	memcpy(out, in, MSEC_SW_MAC_HDR_LEN);
+	memcpy(out + MSEC_SW_MAC_HDR_LEN, in + hdr, off);
+
+	if (encrypted) {
+		memcpy(ctr, j0, sizeof(ctr));
+		SW_PUTU32(ctr + 12, 2);
+		gpy2xx_msec_aes_ctr32(&sa->aes, ctr, in + alen,
+				      out + MSEC_SW_MAC_HDR_LEN + off, dlen - off);
+	}
+
+	return (int)(MSEC_SW_MAC_HDR_LEN + dlen);
+}
+
+#endif /* __KERNEL__ */
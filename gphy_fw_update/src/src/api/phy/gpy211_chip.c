@@ -13,12 +13,16 @@
 #include "gpy211_chip.h"
 #include "gpy211_regs.h"
 #include "gpy211_phy.h"
+#include "gpy211_ptp.h"
 
 #if defined(SAFE_C_LIB) && SAFE_C_LIB
 errno_t memcpy_s(void *restrict dest, rsize_t dmax, const void *restrict src,
 		 rsize_t smax);
 #endif
 
+extern int __gpy211_ptp_read_phc(struct gpy211_device *phy, enum gpy211_ptp_sysclk clk,
+				 struct gpy211_ptp_xts_sample *smp);
+
 static int __is_rw_done(struct gpy211_device *phy, u32 reg, u32 bit)
 {
 	int retCode = 0;
@@ -2539,9 +2543,8 @@ END:
 
 int gpy2xx_ptp_gettime(struct gpy211_device *phy, struct timespec64 *ts)
 {
-	time64_t _ref_ts;
+	struct gpy211_ptp_xts_sample _smp;
 	int ret = -EINVAL;
-	u32 _gmacf_base_addr;
 	LOG_INFO("Entering func name :- %s\n", __func__);
 
 	if (phy == NULL || ts == NULL) {
@@ -2554,57 +2557,15 @@ int gpy2xx_ptp_gettime(struct gpy211_device *phy, struct timespec64 *ts)
 	/* Acquire lock */
 	phy->lock(phy->lock_data);
 
-	_gmacf_base_addr = phy->gmacf_base_addr;
-
-	/* Reset to zero */
-	ts->tv_sec = 0;
-	/* Get Seconds Part of the System Time */
-	ret = SMDIO_READ(phy, _gmacf_base_addr + GMACF_MAC_SYSTEM_TIME_SECONDS_L);
-
-	if (ret < 0) {
-		LOG_CRIT("ERROR: SYSTEM_TIME_SECONDS_L read fails\n");
-		goto END;
-	}
-
-	_ref_ts = (u16)ret;
-	/* Store Part of the System Timestamp */
-	ts->tv_sec = _ref_ts;
-
-	/* Get Seconds Part of the System Time */
-	ret = SMDIO_READ(phy, _gmacf_base_addr + GMACF_MAC_SYSTEM_TIME_SECONDS_H);
-
-	if (ret < 0) {
-		LOG_CRIT("ERROR: SYSTEM_TIME_SECONDS_H read fails\n");
-		goto END;
-	}
-
-	_ref_ts = (u16)ret;
-	/* Store Part of the System Timestamp */
-	ts->tv_sec |= (_ref_ts << 16);
-
-	/* Get NanoSeconds Part of System Timestamp */
-	ret = SMDIO_READ(phy, _gmacf_base_addr + GMACF_MAC_SYSTEM_TIME_NANOSECONDS_L);
-
-	if (ret < 0) {
-		LOG_CRIT("ERROR: SYSTEM_TIME_NANOSECONDS_L read fails\n");
-		goto END;
-	}
-
-	_ref_ts = (u16)ret;
-	/* Store Part of the System Timestamp */
-	ts->tv_nsec = _ref_ts;
-
-	/* Get NanoSeconds Part of the System Timestamp */
-	ret = SMDIO_READ(phy, _gmacf_base_addr + GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H);
+	/* Carry and seconds rollover safe read, shared with getcrosststamp */
+	ret = __gpy211_ptp_read_phc(phy, GPY211_PTP_SYSCLK_MONOTONIC, &_smp);
 
 	if (ret < 0) {
-		LOG_CRIT("ERROR: SYSTEM_TIME_NANOSECONDS_H read fails\n");
+		LOG_CRIT("ERROR: SYSTEM_TIME read fails\n");
 		goto END;
 	}
 
-	_ref_ts = (u16)ret & GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H_TSSS_MASK;
-	/* Store Part of the Ref Timestamp */
-	ts->tv_nsec |= (_ref_ts << 16);
+	*ts = _smp.phc;
 
 END:
 	phy->unlock(phy->lock_data);
@@ -0,0 +1,446 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/timekeeping.h>
+#else
+#include <time.h>
+#include <poll.h>
+#endif
+
+#include "gpy211_common.h"
+#include "gpy211_mon.h"
+#include "gpy211_macsec_harvest.h"
+#include <registers/phy/phy.h>
+#include <registers/phy/vspec1.h>
+
+#define MON_LOG_MASK (GPY211_MON_LOG_SIZE - 1)
+
+/* Events resolved from PHY_MIISTAT alone */
+#define MON_STD_MIISTAT (GPY211_MON_STD_LINK | EXTIN_PHY_ADSC)
+
+static u64 _mon_now(void)
+{
+#ifdef __KERNEL__
+	return ktime_get_ns();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/* Link state from PHY_MIISTAT, called with the PHY lock held */
+static int _mon_read_miistat(struct gpy211_device *phy)
+{
+	struct gpy211_device *data =
+			phy->shared_data == NULL ? phy : phy->shared_data;
+	int ret;
+
+	ret = PHY_READ(phy, PHY_PHY_MIISTAT);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: PHY_MIISTAT read fails\n");
+		return ret;
+	}
+
+	if (FIELD_GET(ret, PHY_MIISTAT_LS) != CONST_PHY_MIISTAT_LS_ACTIVE) {
+		data->link.link = 0;
+		data->link.speed = SPEED_UNKNOWN;
+		data->link.duplex = DUPLEX_INVALID;
+		return 0;
+	}
+
+	data->link.link = 1;
+
+	switch (FIELD_GET(ret, PHY_MIISTAT_SPEED)) {
+	case CONST_PHY_MIISTAT_SPEED_TEN:
+		data->link.speed = SPEED_10;
+		break;
+
+	case CONST_PHY_MIISTAT_SPEED_FAST:
+		data->link.speed = SPEED_100;
+		break;
+
+	case CONST_PHY_MIISTAT_SPEED_GIGA:
+		data->link.speed = SPEED_1000;
+		break;
+
+	case CONST_PHY_MIISTAT_SPEED_BZ2G5:
+		data->link.speed = SPEED_2500;
+		break;
+
+	default:
+		data->link.speed = SPEED_UNKNOWN;
+		break;
+	}
+
+	if (FIELD_GET(ret, PHY_MIISTAT_DPX) == CONST_PHY_MIISTAT_DPX_FDX)
+		data->link.duplex = DUPLEX_FULL;
+	else
+		data->link.duplex = DUPLEX_HALF;
+
+	return 0;
+}
+
+int gpy2xx_mon_start(struct gpy211_device *phy, struct gpy211_mon *mon)
+{
+	int ret;
+	u16 std_imask, ext_imask;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || mon == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	std_imask = mon->std_imask ? mon->std_imask : GPY211_MON_STD_DEF;
+	ext_imask = mon->ext_imask ? mon->ext_imask : GPY211_MON_EXT_DEF;
+
+	/* Mailbox completion is used internally by the API */
+	if (std_imask & EXTIN_PHY_MBOX) {
+		LOG_WARN("WARN: Invalid input (stdImask) - Interrupt Trigger\n");
+		return -EINVAL;
+	}
+
+	if (ext_imask & ~(EXTIN_IM2_IE_LPI | EXTIN_IM2_IE_TS_FIFO | EXTIN_IM2_IE_MACSEC)) {
+		LOG_WARN("WARN: Invalid input (extImask) - Interrupt Trigger\n");
+		return -EINVAL;
+	}
+
+	/* Baseline, takes the PHY lock itself */
+	ret = gpy2xx_read_status(phy);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: api gpy2xx_read_status fails\n");
+		return ret;
+	}
+
+	/* Acquire lock */
+	phy->lock(phy->lock_data);
+
+	ret = PHY_READ(phy, PHY_PHY_IMASK);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: PHY_IMASK read fails\n");
+		goto END;
+	}
+
+	mon->old_std_imask = (u16)ret;
+
+	ret = PHY_READ_MMD(phy, MDIO_MMD_VEND1, VSPEC1_IMASK);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: VSPEC1_IMASK read fails\n");
+		goto END;
+	}
+
+	mon->old_ext_imask = (u16)ret;
+
+	/* Drop status of events from before the baseline */
+	ret = PHY_READ(phy, PHY_PHY_ISTAT);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: PHY_ISTAT read fails\n");
+		goto END;
+	}
+
+	ret = PHY_READ_MMD(phy, MDIO_MMD_VEND1, VSPEC1_ISTAT);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: VSPEC1_ISTAT read fails\n");
+		goto END;
+	}
+
+	ret = PHY_WRITE(phy, PHY_PHY_IMASK, std_imask);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: PHY_IMASK write fails\n");
+		goto END;
+	}
+
+	ret = PHY_WRITE_MMD(phy, MDIO_MMD_VEND1, VSPEC1_IMASK, ext_imask);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: VSPEC1_IMASK write fails\n");
+		goto END;
+	}
+
+	mon->std_imask = std_imask;
+	mon->ext_imask = ext_imask;
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_mon_stop(struct gpy211_device *phy, struct gpy211_mon *mon)
+{
+	int ret;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || mon == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	// None
+	/* Acquire lock */
+	phy->lock(phy->lock_data);
+
+	ret = PHY_WRITE(phy, PHY_PHY_IMASK, mon->old_std_imask);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: PHY_IMASK write fails\n");
+		goto END;
+	}
+
+	ret = PHY_WRITE_MMD(phy, MDIO_MMD_VEND1, VSPEC1_IMASK, mon->old_ext_imask);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: VSPEC1_IMASK write fails\n");
+		goto END;
+	}
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_mon_subscribe(struct gpy211_mon *mon, u16 std_events,
+			 u16 ext_events, gpy211_mon_cb cb, void *data)
+{
+	int i;
+
+	if (mon == NULL || cb == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < GPY211_MON_MAX_SUBS; i++) {
+		if (mon->sub[i].cb != NULL)
+			continue;
+
+		mon->sub[i].data = data;
+		mon->sub[i].std_events = std_events;
+		mon->sub[i].ext_events = ext_events;
+		mon->sub[i].cb = cb;
+		return i;
+	}
+
+	return -ENOSPC;
+}
+
+int gpy2xx_mon_unsubscribe(struct gpy211_mon *mon, int id)
+{
+	if (mon == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (id < 0 || id >= GPY211_MON_MAX_SUBS || mon->sub[id].cb == NULL) {
+		LOG_WARN("WARN: Invalid input (id) - Subscriber\n");
+		return -EINVAL;
+	}
+
+	memset(&mon->sub[id], 0, sizeof(mon->sub[id]));
+	return 0;
+}
+
+int gpy2xx_mon_event(struct gpy211_device *phy, struct gpy211_mon *mon)
+{
+	struct gpy211_device *data;
+	struct gpy211_mon_evt *evt;
+	u16 std_istat, ext_istat = 0;
+	u64 ts;
+	int i, ret;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || mon == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	data = phy->shared_data == NULL ? phy : phy->shared_data;
+
+	/* Validate input params */
+	// None
+	/* Acquire lock */
+	phy->lock(phy->lock_data);
+
+	ts = _mon_now();
+
+	ret = PHY_READ(phy, PHY_PHY_ISTAT);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: PHY_ISTAT read fails\n");
+		goto END;
+	}
+
+	std_istat = (u16)ret & mon->std_imask;
+
+	/* Extended status only if something can be pending there */
+	if (mon->ext_imask) {
+		ret = PHY_READ_MMD(phy, MDIO_MMD_VEND1, VSPEC1_ISTAT);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: VSPEC1_ISTAT read fails\n");
+			goto END;
+		}
+
+		ext_istat = (u16)ret & mon->ext_imask;
+	}
+
+	if (std_istat == 0 && ext_istat == 0) {
+		mon->spurious++;
+		ret = 0;
+		goto END;
+	}
+
+	if ((std_istat & MON_STD_MIISTAT) && !(std_istat & EXTIN_PHY_ANC)) {
+		ret = _mon_read_miistat(phy);
+
+		if (ret < 0)
+			goto END;
+	}
+
+	ret = 1;
+
+END:
+	phy->unlock(phy->lock_data);
+
+	if (ret <= 0)
+		goto EXIT;
+
+	/* Partner abilities changed, takes the PHY lock itself */
+	if (std_istat & EXTIN_PHY_ANC) {
+		ret = gpy2xx_read_status(phy);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: api gpy2xx_read_status fails\n");
+			goto EXIT;
+		}
+
+		mon->full_reads++;
+		ret = 1;
+	}
+
+	/* Status is consumed above, the harvester must not read it again */
+	if (mon->hv != NULL && (ext_istat & EXTIN_IM2_IE_MACSEC)) {
+		struct gpy211_phy_extin extin = {0};
+
+		extin.std_istat = std_istat;
+		extin.ext_istat = ext_istat;
+		ret = gpy2xx_msec_harvest_istat(phy, mon->hv, &extin);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: api gpy2xx_msec_harvest_istat fails\n");
+			goto EXIT;
+		}
+
+		ret = 1;
+	}
+
+	mon->events++;
+
+	evt = &mon->log[mon->seq & MON_LOG_MASK];
+	evt->ts = ts;
+	evt->seq = mon->seq;
+	evt->std_istat = std_istat;
+	evt->ext_istat = ext_istat;
+	evt->link = data->link.link;
+	evt->speed = data->link.speed;
+	evt->duplex = data->link.duplex;
+	mon->seq++;
+
+	for (i = 0; i < GPY211_MON_MAX_SUBS; i++) {
+		if (mon->sub[i].cb == NULL)
+			continue;
+
+		if ((mon->sub[i].std_events & std_istat) ||
+		    (mon->sub[i].ext_events & ext_istat))
+			mon->sub[i].cb(phy, evt, mon->sub[i].data);
+	}
+
+EXIT:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_mon_log(const struct gpy211_mon *mon, u32 *seq,
+		   struct gpy211_mon_evt *evt, u32 num)
+{
+	u32 n = 0;
+
+	if (mon == NULL || seq == NULL || (evt == NULL && num)) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Oldest entry still in the log */
+	if (mon->seq - *seq > GPY211_MON_LOG_SIZE)
+		*seq = mon->seq - GPY211_MON_LOG_SIZE;
+
+	while (n < num && *seq != mon->seq) {
+		evt[n++] = mon->log[*seq & MON_LOG_MASK];
+		(*seq)++;
+	}
+
+	return (int)n;
+}
+
+#ifndef __KERNEL__
+int gpy2xx_mon_wait(int fd, enum gpy211_mon_line line, int timeout_ms)
+{
+	int ret;
+	u32 cnt = 1;
+	char val[8];
+	struct pollfd pfd = {
+		.fd = fd,
+		.events = (line == GPY211_MON_LINE_UIO) ? POLLIN : (POLLPRI | POLLERR),
+	};
+
+	if (fd < 0 || line > GPY211_MON_LINE_UIO) {
+		LOG_WARN("WARN: Invalid input (fd) - Interrupt line\n");
+		return -EINVAL;
+	}
+
+	if (line == GPY211_MON_LINE_UIO) {
+		/* Interrupt is masked by UIO after each event */
+		if (write(fd, &cnt, sizeof(cnt)) < 0)
+			return -errno;
+	}
+
+	ret = poll(&pfd, 1, timeout_ms);
+
+	if (ret < 0)
+		return -errno;
+
+	if (ret == 0)
+		return 0;
+
+	if (line == GPY211_MON_LINE_UIO) {
+		if (read(fd, &cnt, sizeof(cnt)) < 0)
+			return -errno;
+	} else {
+		/* Read back the value to re-arm edge detection */
+		if (lseek(fd, 0, SEEK_SET) < 0 || read(fd, val, sizeof(val)) < 0)
+			return -errno;
+	}
+
+	return 1;
+}
+#endif
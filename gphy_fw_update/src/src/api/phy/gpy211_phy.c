@@ -13,6 +13,7 @@
 #include "gpy211_phy.h"
 #include "gpy211_regs.h"
 #include "gpy211_macsec.h"
+#include "gpy211_macsec_alloc.h"
 
 #if ENABLE_CHIP_FUNC
 extern int __gpy211_chip_init(struct gpy211_device *phy);
@@ -336,19 +337,20 @@ static int __gpy211_update_link(struct gpy211_device *phy)
 	return 0;
 }
 
-static int __gpy211_read_status(struct gpy211_device *phy)
+/* stat is STD_STAT as read by the caller, not read again to keep the
+ * latched-low link bit
+ */
+static int __gpy211_read_status_full(struct gpy211_device *phy, int stat)
 {
 	struct gpy211_device *data =
 			phy->shared_data == NULL ? phy : phy->shared_data;
 	int ret;
 	int lpa, taf, ssl = 0;
 
-	ret = __gpy211_update_link(phy);
-
-	if (ret < 0) {
-		LOG_CRIT("ERROR: api __gpy211_update_link fail\n");
-		return ret;
-	}
+	if ((stat & STD_STAT_LS_MASK) == 0)
+		data->link.link = 0;
+	else
+		data->link.link = 1;
 
 	data->link.speed = SPEED_UNKNOWN;
 	data->link.duplex = DUPLEX_INVALID;
@@ -540,6 +542,50 @@ static int __gpy211_read_status(struct gpy211_device *phy)
 	return 0;
 }
 
+static int __gpy211_read_status(struct gpy211_device *phy)
+{
+	struct gpy211_device *data =
+			phy->shared_data == NULL ? phy : phy->shared_data;
+	struct gpy211_link_cache *cache = &data->link_cache;
+	int stat, miistat, ret;
+
+	/* Link bit is latched low, a flap since the last call shows here */
+	stat = PHY_READ(phy, STD_STD_STAT);
+
+	if (stat < 0) {
+		LOG_CRIT("ERROR: STD_STAT read fails\n");
+		return stat;
+	}
+
+	stat &= STD_STAT_LS_MASK | STD_STAT_ANOK_MASK;
+
+	miistat = PHY_READ(phy, PHY_PHY_MIISTAT);
+
+	if (miistat < 0) {
+		LOG_CRIT("ERROR: PHY_MIISTAT read fails\n");
+		return miistat;
+	}
+
+	if (cache->valid && cache->stat == stat && cache->miistat == miistat &&
+	    cache->autoneg == (u8)data->link.autoneg)
+		return 0;
+
+	cache->valid = 0;
+
+	ret = __gpy211_read_status_full(phy, stat);
+
+	if (ret < 0)
+		return ret;
+
+	/* A flap reports link down once, the next read differs and refreshes */
+	cache->stat = (u16)stat;
+	cache->miistat = (u16)miistat;
+	cache->autoneg = (u8)data->link.autoneg;
+	cache->valid = 1;
+
+	return 0;
+}
+
 int __gpy211_config_init(struct gpy211_device *phy)
 {
 	struct gpy211_device *data =
@@ -725,6 +771,8 @@ int __gpy211_config_init(struct gpy211_device *phy)
 	else
 		data->link.autoneg = 1;
 
+	data->link_cache.valid = 0;
+
 	ret = __gpy211_read_supported(phy);
 
 	if (ret < 0) {
@@ -829,6 +877,14 @@ int gpy2xx_uninit(struct gpy211_device *phy)
 		return -EINVAL;
 	}
 
+	/* Index allocator is created on first use, release it here */
+	if (phy->msec_idx != NULL) {
+		ret = gpy2xx_msec_idx_uninit(phy);
+
+		if (ret < 0)
+			LOG_CRIT("ERROR: api gpy2xx_msec_idx_uninit fails\n");
+	}
+
 	phy->lock(phy->lock_data);
 
 	phy->priv_data = 0;
@@ -910,6 +966,9 @@ static int __gpy211_config_advert(struct gpy211_device *phy)
 	int adv, oldadv, std_gctrl;
 	int status;
 
+	/* Resolution may change, next status read is a full one */
+	data->link_cache.valid = 0;
+
 	ret = PHY_READ(phy, STD_STD_GCTRL);
 
 	if (ret < 0) {
@@ -1080,6 +1139,8 @@ static int __gpy211_setup_forced(struct gpy211_device *phy)
 			phy->shared_data == NULL ? phy : phy->shared_data;
 	int ctrl1, ctrl2, an_adv, ret, std_gctrl;
 
+	data->link_cache.valid = 0;
+
 	if (data->link.speed == SPEED_UNKNOWN
 	    || data->link.duplex == DUPLEX_INVALID) {
 		LOG_WARN("WARN: Link's Speed or Duplex unknown\n");
@@ -1286,6 +1347,8 @@ static int __gpy211_restart_aneg(struct gpy211_device *phy)
 			phy->shared_data == NULL ? phy : phy->shared_data;
 	int ctrl1, ret;
 
+	data->link_cache.valid = 0;
+
 	ctrl1 = PHY_READ(phy, STD_STD_CTRL);
 
 	if (ctrl1 < 0) {
@@ -5937,6 +6000,185 @@ END:
 	return ret;
 }
 
+/* Half the wrap time in ms of a 32-bit packet counter at 1 Mbps, minimum
+   size frames (64 bytes + 20 bytes preamble and IPG): 2^31 * 672 / 1000 */
+#define GMACF_HALF_WRAP_MS_1M 1443109011u
+
+/* L/H halves of the BM counters, in struct gmacf_counters order */
+static const u32 gmacf_cnt_reg[][2] = {
+	{GMACF_TX_PACKET_COUNT_GOOD_BAD_L, GMACF_TX_PACKET_COUNT_GOOD_BAD_H},
+	{GMACF_TX_UNDERFLOW_ERROR_PACKETS_L, GMACF_TX_UNDERFLOW_ERROR_PACKETS_H},
+	{GMACF_TX_PACKET_COUNT_GOOD_L, GMACF_TX_PACKET_COUNT_GOOD_H},
+	{GMACF_RX_PACKETS_COUNT_GOOD_BAD_L, GMACF_RX_PACKETS_COUNT_GOOD_BAD_H},
+	{GMACF_TX_OSIZE_PACKETS_GOOD_L, GMACF_TX_OSIZE_PACKETS_GOOD_H},
+	{GMACF_RX_CRC_ERROR_PACKETS_L, GMACF_RX_CRC_ERROR_PACKETS_H},
+	{GMACF_RX_UNDERSIZE_PACKETS_GOOD_L, GMACF_RX_UNDERSIZE_PACKETS_GOOD_H},
+	{GMACF_RX_OVERSIZE_PACKETS_GOOD_L, GMACF_RX_OVERSIZE_PACKETS_GOOD_H},
+};
+
+/* Read a 32-bit counter from its halves. Unless frozen, L is read again
+   after H: if it went down, the carry may be in H or not, so H is read
+   again and goes with the second L.
+   Returns 1 if corrected, 0 if not, or <0 error code */
+static int _gmacf_cnt_read(struct gpy211_device *phy, u32 base, u32 idx,
+			   u8 frozen, u32 *val)
+{
+	int ret;
+	u32 lo, hi, lo2;
+
+	ret = PHY_MBOX_HWRD(phy, base + gmacf_cnt_reg[idx][0], &lo);
+
+	if (ret < 0)
+		return ret;
+
+	ret = PHY_MBOX_HWRD(phy, base + gmacf_cnt_reg[idx][1], &hi);
+
+	if (ret < 0)
+		return ret;
+
+	*val = (hi << 16) | lo;
+
+	if (frozen)
+		return 0;
+
+	ret = PHY_MBOX_HWRD(phy, base + gmacf_cnt_reg[idx][0], &lo2);
+
+	if (ret < 0)
+		return ret;
+
+	if (lo2 >= lo)
+		return 0;
+
+	ret = PHY_MBOX_HWRD(phy, base + gmacf_cnt_reg[idx][1], &hi);
+
+	if (ret < 0)
+		return ret;
+
+	*val = (hi << 16) | lo2;
+	return 1;
+}
+
+static int _gmacf_count_acc_read(struct gpy211_device *phy,
+				 struct gmacf_count_acc *acc,
+				 struct gmacf_counters *cnt)
+{
+	int ret, restore = 0;
+	u32 _base_addr, _data = 0;
+	size_t i;
+	u32 *val[] = {
+		&cnt->tx_good_bad, &cnt->tx_uflow_err, &cnt->tx_good,
+		&cnt->rx_good_bad, &cnt->tx_osize_good, &cnt->rx_crc_err,
+		&cnt->rx_usize_good, &cnt->rx_osize_good,
+	};
+	struct gpy211_device *data = phy->shared_data == NULL ? phy : phy->shared_data;
+	int speed = data->link.link ? data->link.speed : SPEED_UNKNOWN;
+
+	/* Link speed from the last status read, max rate (10G) if unknown */
+	if (speed <= 0 || speed > SPEED_10000)
+		speed = SPEED_10000;
+
+	acc->poll_ms = GMACF_HALF_WRAP_MS_1M / (u32)speed;
+
+	/* Acquire lock */
+	phy->lock(phy->lock_data);
+
+	_base_addr = phy->gmacf_base_addr;
+
+	if (acc->freeze) {
+		ret = PHY_MBOX_HWRD(phy, _base_addr + GMACF_MMC_CONTROL_L, &_data);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: MMC_CONTROL_L read fails\n");
+			goto END;
+		}
+
+		ret = PHY_MBOX_HWWR(phy, _base_addr + GMACF_MMC_CONTROL_L,
+				    _data | GMACF_MMC_CONTROL_L_CNTFREEZ_MASK);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: MMC_CONTROL_L write fails\n");
+			goto END;
+		}
+
+		restore = !(_data & GMACF_MMC_CONTROL_L_CNTFREEZ_MASK);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(val); i++) {
+		ret = _gmacf_cnt_read(phy, _base_addr, i, acc->freeze, val[i]);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: BM counter %u read fails\n", (u32)i);
+			goto END;
+		}
+
+		acc->torn += ret;
+	}
+
+	ret = 0;
+
+END:
+
+	if (restore && PHY_MBOX_HWWR(phy, _base_addr + GMACF_MMC_CONTROL_L, _data) < 0) {
+		LOG_CRIT("ERROR: MMC_CONTROL_L write fails\n");
+		ret = -EIO;
+	}
+
+	phy->unlock(phy->lock_data);
+
+	return ret;
+}
+
+int gpy2xx_gmacf_count_acc_init(struct gpy211_device *phy,
+				struct gmacf_count_acc *acc)
+{
+	u8 freeze;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || acc == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	freeze = acc->freeze;
+	memset(acc, 0, sizeof(*acc));
+	acc->freeze = freeze;
+
+	return _gmacf_count_acc_read(phy, acc, &acc->last);
+}
+
+int gpy2xx_gmacf_count_acc_update(struct gpy211_device *phy,
+				  struct gmacf_count_acc *acc)
+{
+	int ret;
+	struct gmacf_counters cnt;
+	struct gmacf_counters64 *t;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || acc == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	ret = _gmacf_count_acc_read(phy, acc, &cnt);
+
+	if (ret < 0)
+		return ret;
+
+	t = &acc->total;
+	t->tx_good_bad += (u32)(cnt.tx_good_bad - acc->last.tx_good_bad);
+	t->tx_uflow_err += (u32)(cnt.tx_uflow_err - acc->last.tx_uflow_err);
+	t->tx_good += (u32)(cnt.tx_good - acc->last.tx_good);
+	t->rx_good_bad += (u32)(cnt.rx_good_bad - acc->last.rx_good_bad);
+	t->tx_osize_good += (u32)(cnt.tx_osize_good - acc->last.tx_osize_good);
+	t->rx_crc_err += (u32)(cnt.rx_crc_err - acc->last.rx_crc_err);
+	t->rx_usize_good += (u32)(cnt.rx_usize_good - acc->last.rx_usize_good);
+	t->rx_osize_good += (u32)(cnt.rx_osize_good - acc->last.rx_osize_good);
+	acc->last = cnt;
+	acc->updates++;
+
+	return 0;
+}
+
 int gpy2xx_usxgmii_reach_cfg(struct gpy211_device *phy,
 			     const struct gpy211_usxgmii_reach *reach_cfg)
 {
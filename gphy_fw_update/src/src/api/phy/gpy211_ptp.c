@@ -0,0 +1,500 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <asm/barrier.h>
+#include <linux/timekeeping.h>
+#else
+#include <time.h>
+#endif
+
+#include "gpy211_common.h"
+#include "gpy211_ptp.h"
+
+#define PTP_NSEC_PER_SEC 1000000000ULL
+/* TS_STAT_0..3 and CRC_STAT_0..1 of one FIFO entry, 4 bytes apart */
+#define PTP_TS_ENT_WORDS 6
+#define PTP_TS_RING_MASK (GPY211_PTP_TS_RING_SIZE - 1)
+/* Depth of the auxiliary snapshot FIFO */
+#define PTP_AUX_FIFO_DEPTH 16
+
+/* Index published by one side and observed by the other */
+#ifdef __KERNEL__
+#define PTP_RING_LOAD(p) smp_load_acquire(p)
+#define PTP_RING_STORE(p, v) smp_store_release(p, v)
+#else
+#define PTP_RING_LOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define PTP_RING_STORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#endif
+
+/* Seconds rollover seen between the two seconds reads: nanoseconds below
+   half a second belong to the new second */
+#define PTP_NSEC_HALF_SEC 500000000
+/* Attempts to read a consistent nanoseconds pair */
+#define PTP_PHC_RETRY 3
+
+static void _ptp_sysclk(enum gpy211_ptp_sysclk clk, struct timespec64 *ts)
+{
+#ifdef __KERNEL__
+
+	if (clk == GPY211_PTP_SYSCLK_MONOTONIC)
+		ktime_get_ts64(ts);
+	else if (clk == GPY211_PTP_SYSCLK_MONOTONIC_RAW)
+		ktime_get_raw_ts64(ts);
+	else
+		ktime_get_real_ts64(ts);
+
+#else
+	struct timespec _ts;
+
+	clock_gettime((clk == GPY211_PTP_SYSCLK_MONOTONIC) ? CLOCK_MONOTONIC :
+		      (clk == GPY211_PTP_SYSCLK_MONOTONIC_RAW) ? CLOCK_MONOTONIC_RAW :
+		      CLOCK_REALTIME, &_ts);
+	ts->tv_sec = _ts.tv_sec;
+	ts->tv_nsec = _ts.tv_nsec;
+#endif
+}
+
+static s64 _ptp_ts_to_ns(const struct timespec64 *ts)
+{
+	return (s64)ts->tv_sec * (s64)PTP_NSEC_PER_SEC + ts->tv_nsec;
+}
+
+/* Rollover-safe PHC read, the system clock is sampled around the read of
+   the nanoseconds low word. There is no latch, the low word wraps every
+   65.5 us, so the high word is read before and after it and the read is
+   repeated on a carry. Also used by gpy2xx_ptp_gettime. Caller holds the lock */
+int __gpy211_ptp_read_phc(struct gpy211_device *phy, enum gpy211_ptp_sysclk clk,
+			  struct gpy211_ptp_xts_sample *smp)
+{
+	int i, ret;
+	u32 _base, _sec, _sec2, _nsec, _nsh, _nsh2;
+
+	_base = phy->gmacf_base_addr;
+
+	ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_SECONDS_L);
+
+	if (ret < 0)
+		return ret;
+
+	_sec = (u16)ret;
+
+	ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_SECONDS_H);
+
+	if (ret < 0)
+		return ret;
+
+	_sec |= (u32)(u16)ret << 16;
+
+	ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H);
+
+	if (ret < 0)
+		return ret;
+
+	_nsh = ret & GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H_TSSS_MASK;
+
+	for (i = 0;; i++) {
+		_ptp_sysclk(clk, &smp->pre);
+		ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_NANOSECONDS_L);
+		_ptp_sysclk(clk, &smp->post);
+
+		if (ret < 0)
+			return ret;
+
+		_nsec = (u16)ret;
+
+		ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H);
+
+		if (ret < 0)
+			return ret;
+
+		_nsh2 = ret & GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H_TSSS_MASK;
+
+		if (_nsh2 == _nsh)
+			break;
+
+		/* Low word carried between the reads, try again with the new
+		   high word. If the bus is too slow to ever see a stable pair,
+		   a low word in the lower half was read after the carry */
+		if (i + 1 == PTP_PHC_RETRY) {
+			if (_nsec < 0x8000)
+				_nsh = _nsh2;
+
+			break;
+		}
+
+		_nsh = _nsh2;
+	}
+
+	_nsec |= _nsh << 16;
+
+	/* Re-read the seconds, high word only if the low word changed */
+	ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_SECONDS_L);
+
+	if (ret < 0)
+		return ret;
+
+	_sec2 = (_sec & 0xFFFF0000) | (u16)ret;
+
+	if ((u16)ret != (u16)_sec) {
+		ret = SMDIO_READ(phy, _base + GMACF_MAC_SYSTEM_TIME_SECONDS_H);
+
+		if (ret < 0)
+			return ret;
+
+		_sec2 = ((u32)(u16)ret << 16) | (_sec2 & 0xFFFF);
+
+		if (_nsec < PTP_NSEC_HALF_SEC)
+			_sec = _sec2;
+	}
+
+	smp->phc.tv_sec = _sec;
+	smp->phc.tv_nsec = _nsec;
+
+	return 0;
+}
+
+/* Pop one FIFO entry, the registers are read in the order of
+   gpy2xx_ptp_getrxts/gpy2xx_ptp_gettxts */
+static int _ptp_read_ent(struct gpy211_device *phy, u32 addr,
+			 struct gpy211_ptp_ts_ent *ent)
+{
+	u32 i;
+	int ret;
+	u16 val[PTP_TS_ENT_WORDS];
+
+	for (i = 0; i < PTP_TS_ENT_WORDS; i++) {
+		ret = SMDIO_READ(phy, addr + i * 4);
+
+		if (ret < 0)
+			return ret;
+
+		val[i] = (u16)ret;
+	}
+
+	ent->ts = (((u32)val[3] << 16) | val[2]) * PTP_NSEC_PER_SEC +
+		  (((u32)val[1] << 16) | val[0]);
+	ent->crc = ((u32)val[5] << 16) | val[4];
+
+	return 0;
+}
+
+/* Pop one auxiliary snapshot, the registers are read in the order of
+   gpy2xx_ptp_getauxts */
+static int _ptp_read_aux(struct gpy211_device *phy, u32 base,
+			 struct gpy211_ptp_ts_ent *ent)
+{
+	static const u16 reg[] = {
+		GMACF_MAC_AUXILIARY_TIMESTAMP_SECONDS_L,
+		GMACF_MAC_AUXILIARY_TIMESTAMP_SECONDS_H,
+		GMACF_MAC_AUXILIARY_TIMESTAMP_NANOSECONDS_L,
+		GMACF_MAC_AUXILIARY_TIMESTAMP_NANOSECONDS_H,
+	};
+	u32 i;
+	int ret;
+	u16 val[4];
+
+	for (i = 0; i < 4; i++) {
+		ret = SMDIO_READ(phy, base + reg[i]);
+
+		if (ret < 0)
+			return ret;
+
+		val[i] = (u16)ret;
+	}
+
+	val[3] &= GMACF_MAC_AUXILIARY_TIMESTAMP_NANOSECONDS_H_AUXTSLO_MASK;
+	ent->ts = (((u32)val[1] << 16) | val[0]) * PTP_NSEC_PER_SEC +
+		  (((u32)val[3] << 16) | val[2]);
+	ent->crc = 0;
+	ent->dir = GPY211_PTP_TS_AUX;
+
+	return 0;
+}
+
+/* Store at head unless full, the caller publishes head */
+static u32 _ptp_ring_put(struct gpy211_ptp_ts_ring *ring, u32 *head, u32 *tail,
+			 const struct gpy211_ptp_ts_ent *ent)
+{
+	if (*head - *tail >= GPY211_PTP_TS_RING_SIZE) {
+		/* Consumer may have moved on meanwhile */
+		*tail = PTP_RING_LOAD(&ring->tail);
+
+		if (*head - *tail >= GPY211_PTP_TS_RING_SIZE) {
+			ring->drops++;
+			return 0;
+		}
+	}
+
+	ring->ent[*head & PTP_TS_RING_MASK] = *ent;
+	(*head)++;
+
+	return 1;
+}
+
+int gpy2xx_ptp_ts_ring_init(struct gpy211_ptp_ts_ring *ring)
+{
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (ring == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	memset(ring, 0, sizeof(*ring));
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return 0;
+}
+
+int gpy2xx_ptp_drain_ts(struct gpy211_device *phy,
+			struct gpy211_ptp_ts_ring *ring)
+{
+	int ret;
+	u32 head, tail, lvl, dir, i, pushed = 0;
+	u32 _pm_base_addr;
+	u16 _clr = 0;
+	struct gpy211_ts_fifo_stat _fifo;
+	struct gpy211_ptp_ts_ent _ent;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || ring == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	// None
+	/* Acquire lock */
+	phy->lock(phy->lock_data);
+
+	_pm_base_addr = phy->pm_base_addr;
+
+	ret = SMDIO_READ(phy, _pm_base_addr + PM_PDI_TS_FIFO_STAT);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: TS_FIFO_STAT read fails\n");
+		goto END;
+	}
+
+	_fifo.raw_fifo_stat = (u16)ret;
+
+	/* Status is only written back if there is something to clear */
+	if (_fifo.rx_ovfl) {
+		ring->rx_ovfl++;
+		FIELD_REPLACE(_clr, 1, PM_PDI_TS_FIFO_STAT_RX_OVF);
+	}
+
+	if (_fifo.tx_ovfl) {
+		ring->tx_ovfl++;
+		FIELD_REPLACE(_clr, 1, PM_PDI_TS_FIFO_STAT_TX_OVF);
+	}
+
+	if (_fifo.rx_udfl)
+		FIELD_REPLACE(_clr, 1, PM_PDI_TS_FIFO_STAT_RX_UDF);
+
+	if (_fifo.tx_udfl)
+		FIELD_REPLACE(_clr, 1, PM_PDI_TS_FIFO_STAT_TX_UDF);
+
+	if (_clr) {
+		ret = SMDIO_WRITE(phy, _pm_base_addr + PM_PDI_TS_FIFO_STAT, _clr);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: TS_FIFO_STAT write fails\n");
+			goto END;
+		}
+	}
+
+	head = ring->head;
+	tail = PTP_RING_LOAD(&ring->tail);
+
+	for (dir = GPY211_PTP_TS_RX; dir <= GPY211_PTP_TS_TX; dir++) {
+		lvl = (dir == GPY211_PTP_TS_RX) ? _fifo.rx_fill_lvl : _fifo.tx_fill_lvl;
+
+		if (lvl > GPY211_PTP_TS_FIFO_DEPTH)
+			lvl = GPY211_PTP_TS_FIFO_DEPTH;
+
+		for (i = 0; i < lvl; i++) {
+			ret = _ptp_read_ent(phy, _pm_base_addr + ((dir == GPY211_PTP_TS_RX) ?
+						PM_PDI_GMAC_RX_TS_STAT_0 : PM_PDI_GMAC_TX_TS_STAT_0),
+					    &_ent);
+
+			if (ret < 0) {
+				LOG_CRIT("ERROR: %s timestamp FIFO read fails\n",
+					 (dir == GPY211_PTP_TS_RX) ? "Rx" : "Tx");
+				goto PUBLISH;
+			}
+
+			_ent.dir = dir;
+			pushed += _ptp_ring_put(ring, &head, &tail, &_ent);
+		}
+	}
+
+	ret = (int)pushed;
+
+PUBLISH:
+	/* Entries read before a failure are still handed over */
+	PTP_RING_STORE(&ring->head, head);
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_ptp_drain_auxts(struct gpy211_device *phy,
+			   struct gpy211_ptp_ts_ring *ring)
+{
+	int ret;
+	u32 head, tail, lvl, i, pushed = 0;
+	u32 _gmacf_base_addr, _stat;
+	struct gpy211_ptp_ts_ent _ent;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || ring == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	// None
+	/* Acquire lock */
+	phy->lock(phy->lock_data);
+
+	_gmacf_base_addr = phy->gmacf_base_addr;
+
+	/* Status low word is cleared on read */
+	ret = PHY_MBOX_HWRD(phy, _gmacf_base_addr + GMACF_MAC_TIMESTAMP_STATUS_L, &_stat);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: TIMESTAMP_STATUS_L read fails\n");
+		goto END;
+	}
+
+	if (FIELD_GET(_stat, GMACF_MAC_TIMESTAMP_STATUS_L_TSSOVF))
+		ring->aux_ovfl++;
+
+	ret = PHY_MBOX_HWRD(phy, _gmacf_base_addr + GMACF_MAC_TIMESTAMP_STATUS_H, &_stat);
+
+	if (ret < 0) {
+		LOG_CRIT("ERROR: TIMESTAMP_STATUS_H read fails\n");
+		goto END;
+	}
+
+	lvl = FIELD_GET(_stat, GMACF_MAC_TIMESTAMP_STATUS_H_ATSNS);
+
+	if (lvl > PTP_AUX_FIFO_DEPTH)
+		lvl = PTP_AUX_FIFO_DEPTH;
+
+	head = ring->head;
+	tail = PTP_RING_LOAD(&ring->tail);
+
+	for (i = 0; i < lvl; i++) {
+		ret = _ptp_read_aux(phy, _gmacf_base_addr, &_ent);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: Auxiliary timestamp FIFO read fails\n");
+			goto PUBLISH;
+		}
+
+		pushed += _ptp_ring_put(ring, &head, &tail, &_ent);
+	}
+
+	ret = (int)pushed;
+
+PUBLISH:
+	PTP_RING_STORE(&ring->head, head);
+
+END:
+	phy->unlock(phy->lock_data);
+
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
+
+int gpy2xx_ptp_ts_ring_pop(struct gpy211_ptp_ts_ring *ring,
+			   struct gpy211_ptp_ts_ent *ent, u32 num)
+{
+	u32 head, tail, i;
+
+	if (ring == NULL || (ent == NULL && num)) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	head = PTP_RING_LOAD(&ring->head);
+	tail = ring->tail;
+
+	for (i = 0; (i < num) && (tail != head); i++, tail++)
+		ent[i] = ring->ent[tail & PTP_TS_RING_MASK];
+
+	PTP_RING_STORE(&ring->tail, tail);
+
+	return (int)i;
+}
+
+int gpy2xx_ptp_getcrosststamp(struct gpy211_device *phy,
+			      struct gpy211_ptp_xts *xts)
+{
+	int ret = 0;
+	u32 i;
+	s64 _delay, _pre;
+	struct gpy211_ptp_xts_sample *_smp;
+	LOG_INFO("Entering func name :- %s\n", __func__);
+
+	if (phy == NULL || xts == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	/* Validate input params */
+	if (xts->n_samples == 0 || xts->n_samples > GPY211_PTP_XTS_MAX_SAMPLES) {
+		LOG_WARN("WARN: Invalid input (n_samples) - Range 1 ~ %u\n",
+			 GPY211_PTP_XTS_MAX_SAMPLES);
+		return -EINVAL;
+	}
+
+	if (xts->clk > GPY211_PTP_SYSCLK_MONOTONIC_RAW) {
+		LOG_WARN("WARN: Invalid input (clk) - System clock\n");
+		return -EINVAL;
+	}
+
+	xts->best = 0;
+	xts->delay = 0;
+
+	for (i = 0; i < xts->n_samples; i++) {
+		_smp = &xts->sample[i];
+
+		/* Lock per sample, keeps timestamp draining going */
+		phy->lock(phy->lock_data);
+		ret = __gpy211_ptp_read_phc(phy, xts->clk, _smp);
+		phy->unlock(phy->lock_data);
+
+		if (ret < 0) {
+			LOG_CRIT("ERROR: SYSTEM_TIME read fails\n");
+			goto END;
+		}
+
+		_delay = _ptp_ts_to_ns(&_smp->post) - _ptp_ts_to_ns(&_smp->pre);
+
+		if (i == 0 || _delay < xts->delay) {
+			xts->best = i;
+			xts->delay = _delay;
+		}
+	}
+
+	_smp = &xts->sample[xts->best];
+	_pre = _ptp_ts_to_ns(&_smp->pre);
+	xts->offset = _ptp_ts_to_ns(&_smp->phc) - (_pre + xts->delay / 2);
+
+END:
+	LOG_INFO("Exiting func name :- %s\n", __func__);
+	return ret;
+}
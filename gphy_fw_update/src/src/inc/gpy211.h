@@ -1100,6 +1100,20 @@ struct gpy211_link {
 		Value 1 to enable auto-negotiation, value 0 to force link */
 	int autoneg;
 };
+
+/** \cond INTERNAL */
+/** \brief Link status registers seen by the last full status read */
+struct gpy211_link_cache {
+	/** \brief STD_STAT link and auto-negotiation complete bits */
+	u16 stat;
+	/** \brief PHY_MIISTAT */
+	u16 miistat;
+	/** \brief \b autoneg of \ref gpy211_link */
+	u8 autoneg;
+	/** \brief Cache is valid */
+	u8 valid;
+};
+/** \endcond */
 /**@}*/ /* GPY211_LINK_API */
 
 /** \addtogroup GPY211_GPIO_API */
@@ -2385,6 +2399,47 @@ struct gmacf_counter_ctrl {
 	u8 count_dropped_bc;
 };
 
+/** \brief Pkt Counters extended to 64 bits (\ref gmacf_counters) */
+struct gmacf_counters64 {
+	/** \brief Tx packet counter that counts both good and bad frames */
+	u64 tx_good_bad;
+	/** \brief Tx Underflow error packet counter */
+	u64 tx_uflow_err;
+	/** \brief Tx packet pounter to count only good frames */
+	u64 tx_good;
+	/** \brief Rx packet counter that counts both good and bad frames */
+	u64 rx_good_bad;
+	/** \brief Tx oversized good-only packet counter */
+	u64 tx_osize_good;
+	/** \brief Rx CRC error packet counter */
+	u64 rx_crc_err;
+	/** \brief Rx undersize good-only packet counter */
+	u64 rx_usize_good;
+	/** \brief Rx oversized good-only packet counter */
+	u64 rx_osize_good;
+};
+
+/** \brief Pkt Counter accumulator, owned by the caller */
+struct gmacf_count_acc {
+	/** \brief (in) Freeze the counters while they are read. Saves the
+	    torn read check, but packets seen during the freeze are not counted. */
+	u8 freeze;
+	/** \brief Totals since \ref gpy2xx_gmacf_count_acc_init */
+	struct gmacf_counters64 total;
+	/** \brief Max interval between updates in ms, so that no counter wraps
+	    twice at the current link speed (half the wrap time at minimum size
+	    frames) */
+	u32 poll_ms;
+	/** \brief Number of updates */
+	u32 updates;
+	/** \brief Number of corrected torn L/H reads */
+	u32 torn;
+	/** \cond INTERNAL */
+	/** \brief Counter values of the last update */
+	struct gmacf_counters last;
+	/** \endcond */
+};
+
 /** \brief Macsec control */
 struct gpy211_macsec {
 	/** \brief Discard packet if CRC error is raised by MACsec */
@@ -2622,7 +2677,7 @@ struct gpy211_device {
 		applications that have multiple processes, a separate address for
 		each process and share the data section. In this case, the user
 		needs to provide the data pointer referring to the shared data. Only fields
-		id, link, and wol_supported of \ref gpy211_device in the shared data are used.
+		id, link, link_cache and wol_supported of \ref gpy211_device in the shared data are used.
 	*/
 	struct gpy211_device *shared_data;
 
@@ -2660,6 +2715,12 @@ struct gpy211_device {
 	/** \brief  Allows forcing of master or slave mode manually. Applicaple when
 		choosing forced link speed of 2.5G or 1G only */
 	u8 mstr_slave;
+	/** \cond INTERNAL */
+	/** \brief Link status cache of \ref gpy2xx_read_status */
+	struct gpy211_link_cache link_cache;
+	/** \brief SA and SAM rule index allocator of \ref gpy2xx_msec_idx_init */
+	struct msec_idx_alloc *msec_idx;
+	/** \endcond */
 };
 /**@}*/ /* GPY211_INIT */
 
@@ -3132,7 +3193,8 @@ int gpy2xx_init(struct gpy211_device *phy);
 	\brief Cleanup.
 	\details This is last API called by the user application for un-initialization purposes.
 	The application has to implement/modify this API to unconfigure/release resources,
-	disable interrupts etc.
+	disable interrupts etc. The MACsec index allocator (\ref gpy2xx_msec_idx_init)
+	is freed here.
 
 	\param phy Pointer to GPHY data (\ref gpy211_device).
 
@@ -3268,6 +3330,9 @@ int gpy2xx_update_link(struct gpy211_device *phy);
 	If autoneg is 0, speed and duplex of \ref gpy211_link are retrieved from PHY.
 	If autoneg is 1, link partner information is updated in lp_advertising,
 	speed, duplex, pause, and asym_pause of \ref gpy211_link.
+	Only STD_STAT and PHY_MIISTAT are read as long as link state, resolved
+	speed/duplex/pause and autoneg are unchanged since the last full read.
+	Link configuration APIs force the next call to do a full read.
 
 	\param phy Pointer to GPHY data (\ref gpy211_device).
 
@@ -4658,6 +4723,40 @@ int gpy2xx_gmacf_pkt_get(struct gpy211_device *phy,
 */
 int gpy2xx_gmacf_count_get(struct gpy211_device *phy,
 			   struct gmacf_counters *counters);
+
+/**
+	\brief This API starts accumulating the BM counters into 64-bit totals.
+	\details Totals are cleared, the current counter values are the baseline
+	and \b poll_ms is set. \b freeze is kept.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param acc Pointer to counter accumulator (\ref gmacf_count_acc).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_gmacf_count_acc_init(struct gpy211_device *phy,
+				struct gmacf_count_acc *acc);
+
+/**
+	\brief This API adds the BM counter increments since the last update
+	to the 64-bit totals.
+	\details All counters are read in one burst under the PHY lock. Each
+	32-bit counter is read as L, H, L again; if the L half wrapped in
+	between, H is read again. Increments are taken modulo 2^32, so one wrap
+	between updates is accounted. Call it at least every \b poll_ms, which
+	is updated from the link speed (\ref gpy2xx_read_status).
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param acc Pointer to counter accumulator (\ref gmacf_count_acc).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_gmacf_count_acc_update(struct gpy211_device *phy,
+				  struct gmacf_count_acc *acc);
 /**
 	\brief This API controls the BM counter control configuration.
 
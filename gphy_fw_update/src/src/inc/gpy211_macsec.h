@@ -560,6 +560,10 @@ struct crypto_params {
 	u8 key[MACSEC_KEY_LEN_BYTE];
 	/** \brief Hash key for authentication operation (derived from key) */
 	u8 hkey[MACSEC_HKEY_LEN_BYTE];
+	/** \brief (in) \b hkey is already derived from \b key, e.g. by
+		\ref gpy2xx_msec_derive_hkey_batch, so the TR config skips the
+		derivation. Cleared once the TR is programmed */
+	u8 hkey_valid;
 	union {
 		/** \brief The SCI that belongs to the specific MACsec SA
 		(NA for 64-bit PN Ingress case) */
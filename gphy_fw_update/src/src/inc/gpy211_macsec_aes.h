@@ -0,0 +1,139 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MACSEC_AES_H_
+#define _GPY211_MACSEC_AES_H_
+
+#include "gpy211_macsec.h"
+
+/** \defgroup GPY211_MACSEC_AES Hash Key Derivation APIs
+	\brief Group of APIs deriving the GHASH key (H = AES-K(0^128)) of a MACsec SA.
+
+	Used by \ref gpy2xx_msec_config_ing_tr and \ref gpy2xx_msec_config_egr_tr
+	in user space, and by the software MACsec engine (\ref GPY211_MACSEC_SW).
+	AES-128/256 block and counter mode encryption is T-table based; the
+	AES-NI (x86) or ARMv8 Crypto Extension (aarch64) instructions are used
+	instead when the CPU supports them (checked once at runtime).
+	Not available in kernel builds, where the kernel crypto API is used.
+*/
+
+#ifndef __KERNEL__
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_AES */
+/**@{*/
+/** \brief AES block size in bytes */
+#define MSEC_AES_BLOCK_LEN 16
+/** \brief Max number of AES-256 round key words */
+#define MSEC_AES_MAX_RK_WORDS 60
+
+/**********************
+	Structures
+ **********************/
+
+/** \brief Expanded AES encryption key */
+struct msec_aes_ctx {
+	/** \brief Round keys (big-endian words) */
+	u32 rk[MSEC_AES_MAX_RK_WORDS];
+	/** \brief Number of rounds (10 or 14) */
+	u32 nr;
+};
+
+/**********************
+	APIs
+ **********************/
+
+/**
+	\brief This API expands an AES-128/256 encryption key.
+
+	\param ctx Pointer to expanded key (\ref msec_aes_ctx).
+	\param key Pointer to key.
+	\param keylen Key length in bytes (16 or 32).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_aes_setkey(struct msec_aes_ctx *ctx, const u8 *key, u32 keylen);
+
+/**
+	\brief This API encrypts a single 16-byte block with an expanded key.
+
+	\param ctx Pointer to expanded key (\ref msec_aes_ctx).
+	\param in Pointer to input block.
+	\param out Pointer to output block (may be same as \b in).
+*/
+void gpy2xx_msec_aes_encrypt(const struct msec_aes_ctx *ctx, const u8 *in,
+			     u8 *out);
+
+/**
+	\brief This API encrypts/decrypts a buffer in GCM counter mode.
+
+	The key stream is generated from \b ctr, whose last 32-bit word
+	(big-endian) is incremented per block (GCM inc32). Several blocks are
+	processed in parallel with AES-NI / ARMv8 Crypto Extension.
+
+	\param ctx Pointer to expanded key (\ref msec_aes_ctx).
+	\param ctr Pointer to 16-byte counter block, advanced past the last
+	block used (a partial last block counts as one).
+	\param in Pointer to input.
+	\param out Pointer to output (may be same as \b in).
+	\param len Length in bytes.
+*/
+void gpy2xx_msec_aes_ctr32(const struct msec_aes_ctx *ctx, u8 *ctr,
+			   const u8 *in, u8 *out, u32 len);
+
+/**
+	\brief This API selects the AES implementation.
+
+	By default the CPU instructions are used when supported. Meant for tests
+	and benchmarks; must not be called while other threads use the AES APIs.
+
+	\param enable 1 to use AES-NI / ARMv8 Crypto Extension, 0 for T-table.
+
+	\return
+	- =0: successful
+	- <0: error code (-ENOTSUP: not supported by the CPU)
+*/
+int gpy2xx_msec_aes_use_hw(int enable);
+
+/**
+	\brief This API derives the hash key of a MACsec SA key.
+
+	\param key Pointer to SA key.
+	\param keylen Key length in bytes (16 or 32).
+	\param hkey Pointer to 16-byte hash key output.
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_derive_hkey(const u8 *key, u32 keylen, u8 *hkey);
+
+/**
+	\brief This API derives \b cp.hkey of an array of transform records.
+
+	The key length is taken from \b ccw.ca_type. The key schedule is reused
+	for consecutive records carrying the same key (e.g. ingress/egress pair
+	of an SA), so bulk SA installs expand each key only once. \b cp.hkey_valid
+	is set, so \ref gpy2xx_msec_config_ing_tr and \ref gpy2xx_msec_config_egr_tr
+	program the derived hash key as is.
+
+	\param tr Pointer to array of TR config (\ref transform_rec).
+	\param num Number of entries in \b tr.
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_derive_hkey_batch(struct transform_rec *tr, u32 num);
+/**@}*/ /* GPY211_MACSEC_AES */
+#endif /* __KERNEL__ */
+
+#endif /* _GPY211_MACSEC_AES_H_ */
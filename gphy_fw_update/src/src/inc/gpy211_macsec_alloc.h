@@ -0,0 +1,196 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MACSEC_ALLOC_H_
+#define _GPY211_MACSEC_ALLOC_H_
+
+#include "gpy211_macsec.h"
+
+/** \defgroup GPY211_MACSEC_ALLOC SA and SAM Rule Index Allocator APIs
+	\brief Group of APIs allocating TR (sa_index) and SAM rule (rule_index) slots.
+
+	The allocator lives in \b msec_idx of \ref gpy211_device and keeps one
+	bitmap per pool (\ref msec_idx_pool). An allocation takes the same index in
+	every pool given in \b pool_mask, so ingress/egress SA and SAM rule of a
+	flow can share one index. Slots can be reserved per SecY; allocations of a
+	SecY take its reserved slots first. \ref gpy2xx_msec_idx_secy_free releases
+	everything owned by a SecY on teardown.
+
+	The clear APIs (\ref gpy2xx_msec_clear_ing_tr, \ref gpy2xx_msec_clear_egr_tr,
+	\ref gpy2xx_msec_clear_ing_sam_rule and \ref gpy2xx_msec_clear_egr_sam_rule)
+	release the cleared index, so the allocator stays consistent when callers
+	clear slots directly.
+*/
+
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_ALLOC */
+/**@{*/
+/** \brief Max number of indices handled per pool */
+#define MSEC_IDX_MAX 256
+/** \brief Max number of SecYs owning indices */
+#define MSEC_IDX_MAX_SECY 32
+/** \cond INTERNAL */
+#define MSEC_IDX_WORDS (MSEC_IDX_MAX / 32)
+#define MSEC_IDX_NO_SECY 0xFF
+/** \endcond */
+
+/** \brief Index pools */
+enum msec_idx_pool {
+	/** \brief Ingress transform records (sa_index) */
+	MSEC_IDX_ING_SA = 0,
+	/** \brief Egress transform records (sa_index) */
+	MSEC_IDX_EGR_SA = 1,
+	/** \brief Ingress SAM rules (rule_index) */
+	MSEC_IDX_ING_RULE = 2,
+	/** \brief Egress SAM rules (rule_index) */
+	MSEC_IDX_EGR_RULE = 3,
+	/** \brief Number of pools */
+	MSEC_IDX_POOL_NUM = 4,
+};
+
+/** \brief Pool mask of ingress SA & SAM rule */
+#define MSEC_IDX_ING_FLOW ((1 << MSEC_IDX_ING_SA) | (1 << MSEC_IDX_ING_RULE))
+/** \brief Pool mask of egress SA & SAM rule */
+#define MSEC_IDX_EGR_FLOW ((1 << MSEC_IDX_EGR_SA) | (1 << MSEC_IDX_EGR_RULE))
+/** \brief Pool mask of paired ingress/egress SA & SAM rule */
+#define MSEC_IDX_ALL_FLOW (MSEC_IDX_ING_FLOW | MSEC_IDX_EGR_FLOW)
+
+/**********************
+	Structures
+ **********************/
+
+/** \brief Index allocation request */
+struct msec_idx_req {
+	/** \brief SecY owning the index (0 ~ MSEC_IDX_MAX_SECY-1) */
+	u8 secy;
+	/** \brief Bit mask of \ref msec_idx_pool to take the same index from */
+	u8 pool_mask;
+	/** \brief Allocated index (output of alloc, input of free) */
+	u16 idx;
+	/** \brief Number of indices to reserve (reserve only) */
+	u16 num;
+};
+
+/** \cond INTERNAL */
+/** \brief Allocator state kept in msec_idx */
+struct msec_idx_alloc {
+	/** \brief Number of valid indices (nr_of_sas) */
+	u16 nr_idx;
+	/** \brief Allocated indices */
+	u32 used[MSEC_IDX_POOL_NUM][MSEC_IDX_WORDS];
+	/** \brief Indices reserved by any SecY */
+	u32 rsvd[MSEC_IDX_POOL_NUM][MSEC_IDX_WORDS];
+	/** \brief SecY owning the allocated index */
+	u8 owner[MSEC_IDX_POOL_NUM][MSEC_IDX_MAX];
+	/** \brief Indices reserved per SecY */
+	u32 secy_rsvd[MSEC_IDX_MAX_SECY][MSEC_IDX_POOL_NUM][MSEC_IDX_WORDS];
+	/** \brief Indices allocated per SecY */
+	u32 secy_used[MSEC_IDX_MAX_SECY][MSEC_IDX_POOL_NUM][MSEC_IDX_WORDS];
+};
+/** \endcond */
+/**@}*/ /* GPY211_MACSEC_ALLOC */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_ALLOC */
+/**@{*/
+/**
+	\brief This API creates the index allocator in \b msec_idx.
+
+	Fails with -EBUSY if the allocator is already created.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_idx_init(struct gpy211_device *phy);
+
+/**
+	\brief This API frees the index allocator of \b msec_idx.
+
+	Also called by \ref gpy2xx_uninit, so only needed to drop the allocator
+	while the PHY stays in use.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_idx_uninit(struct gpy211_device *phy);
+
+/**
+	\brief This API allocates the lowest index free in all pools of \b pool_mask.
+
+	Indices reserved for \b secy are taken first, then unreserved ones.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param req Pointer to request (\ref msec_idx_req), \b idx is returned.
+
+	\return
+	- =0: successful
+	- <0: error code (-ENOSPC: no free index)
+*/
+int gpy2xx_msec_idx_alloc(struct gpy211_device *phy, struct msec_idx_req *req);
+
+/**
+	\brief This API frees an index in all pools of \b pool_mask.
+
+	The reservation of the index, if any, is kept.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param req Pointer to request (\ref msec_idx_req).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_idx_free(struct gpy211_device *phy,
+			 const struct msec_idx_req *req);
+
+/**
+	\brief This API reserves \b num indices free in all pools of \b pool_mask
+	for \b secy.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param req Pointer to request (\ref msec_idx_req).
+
+	\return
+	- =0: successful
+	- <0: error code (-ENOSPC: not enough free indices, nothing reserved)
+*/
+int gpy2xx_msec_idx_reserve(struct gpy211_device *phy,
+			    const struct msec_idx_req *req);
+
+/**
+	\brief This API releases all indices allocated or reserved by a SecY.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param secy SecY to tear down.
+	\param clear_hw Clear also the TRs and SAM rules of the allocated indices.
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_idx_secy_free(struct gpy211_device *phy, u8 secy, u8 clear_hw);
+
+/** \cond INTERNAL */
+/* Release index of one pool, called by clear APIs with lock held */
+void _gpy2xx_msec_idx_release(struct gpy211_device *phy,
+			      enum msec_idx_pool pool, u16 idx);
+/** \endcond */
+/**@}*/ /* GPY211_MACSEC_ALLOC */
+
+#endif /* _GPY211_MACSEC_ALLOC_H_ */
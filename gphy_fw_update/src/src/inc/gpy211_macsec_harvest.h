@@ -0,0 +1,211 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MACSEC_HARVEST_H_
+#define _GPY211_MACSEC_HARVEST_H_
+
+#include "gpy211_macsec.h"
+
+/** \defgroup GPY211_MACSEC_HARVEST Threshold Driven Statistics Harvesting APIs
+	\brief Group of APIs collecting MACsec statistics on counter threshold events.
+
+	The counters of the EIP-160 are cleared on read (COUNT_CONTROL.auto_cntr_reset
+	is set by \ref gpy2xx_msec_init_ing_dev and \ref gpy2xx_msec_init_egr_dev), so
+	a counter only needs to be read once it has crossed the frame or octet threshold.
+	The harvester programs the thresholds, arms the SA/global statistics interrupts
+	in the AIC and the MACsec interrupt of the PHY (\ref EXTIN_IM2_IE_MACSEC). On an
+	event, only the SAs flagged in COUNT_SUMMARY_PSA and the global counters flagged
+	in COUNT_SUMMARY_GL are read and accumulated into 64-bit software counters.
+	The summaries are then cleared and the AIC acknowledged, which re-arms the event.
+	Counters which did not reach the threshold remain in hardware until the next
+	event or \ref gpy2xx_msec_harvest_sync.
+*/
+
+/**********************
+	Structures
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_HARVEST */
+/**@{*/
+/** \brief Harvester context, owned by the caller */
+struct msec_harvest {
+	/** \brief Ingress frame/octet thresholds programmed on start */
+	struct frame_octet_thr ing_thr;
+	/** \brief Egress frame/octet thresholds programmed on start */
+	struct frame_octet_thr egr_thr;
+	/** \brief Poll mode, set before start: no AIC or PHY interrupt is armed,
+		the summaries are read by \ref gpy2xx_msec_harvest_poll only */
+	u8 poll;
+
+	/** \brief Ingress accumulated per-SA statistics */
+	struct ing_sa_stats ing_sa[MACSEC_MAX_SA_RULES];
+	/** \brief Egress accumulated per-SA statistics */
+	struct egr_sa_stats egr_sa[MACSEC_MAX_SA_RULES];
+	/** \brief Ingress accumulated global statistics */
+	struct ing_global_stats ing_glb;
+	/** \brief Egress accumulated global statistics */
+	struct egr_global_stats egr_glb;
+
+	/** \brief Ingress SAs harvested by the last event (bit per SA) */
+	u32 ing_sa_upd[MACSEC_MAX_SA_RULES / 32];
+	/** \brief Egress SAs harvested by the last event (bit per SA) */
+	u32 egr_sa_upd[MACSEC_MAX_SA_RULES / 32];
+
+	/** \brief PHY interrupt status read by the last event.
+		The PHY ISTAT registers are cleared on read, so non-MACsec events
+		reported here must be handled by the caller */
+	struct gpy211_phy_extin extin;
+
+	/** \brief Number of MACsec events serviced */
+	u32 events;
+	/** \brief Number of SA and global counter blocks read */
+	u32 blk_reads;
+
+	/** \cond INTERNAL */
+	/** \brief AIC enable bits owned by the harvester */
+	u32 ing_aic_en;
+	u32 egr_aic_en;
+	/** \endcond */
+};
+/**@}*/ /* GPY211_MACSEC_HARVEST */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_HARVEST */
+/**@{*/
+/**
+	\brief This API starts the threshold driven statistics harvesting.
+
+	Programs \b ing_thr and \b egr_thr, clears the accumulators and all
+	statistics summaries, enables the SA/global statistics threshold
+	interrupts in the ingress and egress AIC and enables \ref EXTIN_IM2_IE_MACSEC
+	in the PHY extended interrupt mask. Other PHY interrupt masks are kept.
+	In poll mode (\b poll set) no interrupt is enabled.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param hv Pointer to harvester context (\ref msec_harvest).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_start(struct gpy211_device *phy,
+			      struct msec_harvest *hv);
+
+/**
+	\brief This API stops the threshold driven statistics harvesting.
+
+	Disables the statistics threshold interrupts in both AICs and
+	\ref EXTIN_IM2_IE_MACSEC in the PHY. Accumulators are kept.
+	Nothing to do in poll mode.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param hv Pointer to harvester context (\ref msec_harvest).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_stop(struct gpy211_device *phy,
+			     struct msec_harvest *hv);
+
+/**
+	\brief This API services a PHY interrupt or GPIO event.
+
+	Reads the PHY interrupt status into \b extin. If the MACsec interrupt is
+	pending, reads only the SA and global counters whose threshold summary bit
+	is set, accumulates them, clears the summaries and acknowledges the AIC.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param hv Pointer to harvester context (\ref msec_harvest).
+
+	\return
+	- >=0: number of SA and global counter blocks harvested
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_event(struct gpy211_device *phy,
+			      struct msec_harvest *hv);
+
+/**
+	\brief This API services a PHY interrupt status already read by the caller.
+
+	Same as \ref gpy2xx_msec_harvest_event, but takes the PHY interrupt status
+	instead of reading it. The PHY ISTAT registers are cleared on read, so a
+	caller which owns the interrupt (e.g. the \ref GPY211_MON monitor) must read
+	them once and hand the status over with this API. Calling
+	\ref gpy2xx_msec_harvest_event next to another ISTAT reader loses events.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param hv Pointer to harvester context (\ref msec_harvest).
+	\param extin PHY interrupt status read by the caller (\ref gpy211_phy_extin).
+
+	\return
+	- >=0: number of SA and global counter blocks harvested
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_istat(struct gpy211_device *phy,
+			      struct msec_harvest *hv,
+			      const struct gpy211_phy_extin *extin);
+
+/**
+	\brief This API harvests the flagged counters without a PHY interrupt.
+
+	Same as \ref gpy2xx_msec_harvest_istat, but checks the SA/global statistics
+	summaries directly instead of the PHY interrupt status, for callers which
+	refresh the counters on demand. Only the SAs flagged in COUNT_SUMMARY_PSA are
+	read. \ref gpy2xx_msec_harvest_start must have been called before, usually
+	in poll mode. Without poll mode, only directions with a pending AIC event
+	are harvested.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param hv Pointer to harvester context (\ref msec_harvest).
+
+	\return
+	- >=0: number of SA and global counter blocks harvested
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_poll(struct gpy211_device *phy,
+			     struct msec_harvest *hv);
+
+/**
+	\brief This API reads all SA and global counters into the accumulators.
+
+	Used to reconcile the counters which have not reached the thresholds yet,
+	e.g. before reporting or before an SA is deleted.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param hv Pointer to harvester context (\ref msec_harvest).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_sync(struct gpy211_device *phy,
+			     struct msec_harvest *hv);
+
+#ifndef __KERNEL__
+/**
+	\brief This API waits for a PHY interrupt line event exported as GPIO.
+
+	\b fd is the opened sysfs GPIO \b value file with \b edge configured.
+	The value is read back to re-arm the edge detection.
+
+	\param fd File descriptor of the GPIO value file.
+	\param timeout_ms Timeout in milliseconds (<0: wait forever).
+
+	\return
+	- =1: event
+	- =0: timeout
+	- <0: error code
+*/
+int gpy2xx_msec_harvest_wait(int fd, int timeout_ms);
+#endif
+/**@}*/ /* GPY211_MACSEC_HARVEST */
+
+#endif /* _GPY211_MACSEC_HARVEST_H_ */
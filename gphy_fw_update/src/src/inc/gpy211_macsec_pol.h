@@ -0,0 +1,282 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MACSEC_POL_H_
+#define _GPY211_MACSEC_POL_H_
+
+#include "gpy211_macsec.h"
+
+/** \defgroup GPY211_MACSEC_POL Classification Policy Compiler APIs
+	\brief Group of APIs compiling a classification policy into SAM, control
+	packet (CP) and consistency check (CC) rules.
+
+	A policy is an ordered list of \ref msec_pol_rule, the first rule
+	matching a packet decides (like an ACL). The compiler
+	- drops rules covered by one earlier rule (\ref MSEC_POL_REDUNDANT with the
+	same action, \ref MSEC_POL_SHADOWED with another action, the latter being
+	a policy error worth reporting),
+	- drops rules covered by one later rule with the same action when no rule
+	in between decides otherwise,
+	- merges rules with the same match values and masks and the same action
+	(packet types are combined into one SAM rule),
+	- assigns the lowest \b match_priority that keeps the policy order between
+	overlapping rules with different actions,
+	- packs control packet DAs into the 44-bit constant, range and single DA
+	entries of the CP classifier.
+
+	Coverage is checked pairwise, a rule covered only by the union of several
+	rules is kept. Passing the previously installed result as \b old lets
+	\ref gpy2xx_msec_pol_compile keep unchanged entries at their index and
+	emit only the changed entries in \ref msec_pol_diff, which is applied with
+	\ref gpy2xx_msec_pol_apply. Flow control actions (\b flow_index) are
+	configured by the caller.
+*/
+
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_POL */
+/**@{*/
+/** \brief Max number of rules in a policy */
+#define MSEC_POL_MAX_RULES 128
+/** \brief Number of CP classifier write units (DA/ET 0~9, range, const44,
+	const48, ET 10~17) */
+#define MSEC_POL_CP_UNITS 21
+/** \brief Max number of operations in a diff */
+#define MSEC_POL_MAX_OPS (2 * MACSEC_MAX_SA_RULES * 2 + MSEC_POL_CP_UNITS)
+
+/** \brief Match on DA bytes selected by \b da_mask */
+#define MSEC_POL_M_DA 0x0001
+/** \brief Match on SA bytes selected by \b sa_mask */
+#define MSEC_POL_M_SA 0x0002
+/** \brief Match on Ether-type (SAM/CP: packet, CC: payload) */
+#define MSEC_POL_M_ETYPE 0x0004
+/** \brief Match on outer VLAN ID (needs SUPPORT_MACSEC_VLAN) */
+#define MSEC_POL_M_VLAN 0x0008
+/** \brief (-i)Match on SCI */
+#define MSEC_POL_M_SCI 0x0010
+/** \brief (-i)Match on TCI/AN bits selected by \b tci_an_mask */
+#define MSEC_POL_M_TCI_AN 0x0020
+/** \brief Match on control packet classification */
+#define MSEC_POL_M_CTRL 0x0040
+/** \brief (-i)CC only: match on hit of the SAM rule of FLOW rule \b ref */
+#define MSEC_POL_M_REF 0x0080
+
+/** \brief SAM packet type: no MACsec tag */
+#define MSEC_POL_PKT_UNTAGGED 0x01
+/** \brief SAM packet type: valid MACsec tag */
+#define MSEC_POL_PKT_TAGGED 0x02
+/** \brief SAM packet type: invalid MACsec tag */
+#define MSEC_POL_PKT_BAD_TAG 0x04
+/** \brief SAM packet type: MACsec tag for KaY */
+#define MSEC_POL_PKT_KAY_TAG 0x08
+/** \brief SAM packet type: any */
+#define MSEC_POL_PKT_ALL 0x0F
+
+/** \brief Policy rule action */
+enum msec_pol_act {
+	/** \brief SAM rule pointing to flow control action \b flow_index */
+	MSEC_POL_ACT_FLOW = 0,
+	/** \brief CP rule classifying the packet as control packet */
+	MSEC_POL_ACT_CONTROL = 1,
+	/** \brief (-i)CC rule passing the packet */
+	MSEC_POL_ACT_PASS = 2,
+	/** \brief (-i)CC rule dropping the packet */
+	MSEC_POL_ACT_DROP = 3,
+};
+
+/** \brief Per-rule compile result */
+enum msec_pol_diag {
+	/** \brief Installed */
+	MSEC_POL_INSTALLED = 0,
+	/** \brief Merged into rule \b diag_ref */
+	MSEC_POL_MERGED = 1,
+	/** \brief Covered by rule \b diag_ref with the same action */
+	MSEC_POL_REDUNDANT = 2,
+	/** \brief Never matches, covered by earlier rule \b diag_ref with
+		another action */
+	MSEC_POL_SHADOWED = 3,
+};
+
+/** \brief Rule tables */
+enum msec_pol_tbl {
+	/** \brief SAM rule, \b index is rule_index */
+	MSEC_POL_TBL_SAM = 0,
+	/** \brief CP classifier, \b index is write unit (0 ~ MSEC_POL_CP_UNITS-1) */
+	MSEC_POL_TBL_CP = 1,
+	/** \brief CC rule, \b index is icc_index */
+	MSEC_POL_TBL_CC = 2,
+};
+
+/** \brief Diff operation codes */
+enum msec_pol_opc {
+	/** \brief Write and enable entry */
+	MSEC_POL_OP_WRITE = 0,
+	/** \brief Disable and clear entry */
+	MSEC_POL_OP_CLEAR = 1,
+};
+
+/**********************
+	Structures
+ **********************/
+
+/** \brief Policy rule */
+struct msec_pol_rule {
+	/** \brief Action. Valid values are defined in \ref msec_pol_act enum */
+	enum msec_pol_act act;
+	/** \brief Match flags (MSEC_POL_M_*) */
+	u16 match;
+	/** \brief Dst MAC */
+	u8 da[6];
+	/** \brief Bytes of \b da compared (bit i: da[i]), 0x3F for exact match.
+		CP rules only accept prefixes (leading bytes) */
+	u8 da_mask;
+	/** \brief Src MAC */
+	u8 sa[6];
+	/** \brief Bytes of \b sa compared (bit i: sa[i]) */
+	u8 sa_mask;
+	/** \brief Ether-type */
+	u16 eth_type;
+	/** \brief VLAN ID */
+	u16 vlan_id;
+	/** \brief (-i)SCI */
+	u8 sci[MACSEC_SCI_LEN_BYTE];
+	/** \brief (-i)TCI/AN compare value */
+	u8 tci_an;
+	/** \brief (-i)TCI/AN bits compared */
+	u8 tci_an_mask;
+	/** \brief Control packet classification compare value */
+	u8 ctrl;
+	/** \brief SAM packet types (MSEC_POL_PKT_*), 0: tagged for ingress and
+		untagged for egress */
+	u8 pkt_type;
+	/** \brief (-i)CC only: index of the FLOW rule in the policy */
+	u16 ref;
+	/** \brief FLOW only: flow control action index */
+	u8 flow_index;
+};
+
+/** \brief Classification policy */
+struct msec_pol {
+	/** \brief Direction. Valid values are defined in \ref msec_dir enum */
+	enum msec_dir dir;
+	/** \brief Number of rules */
+	u16 num;
+	/** \brief Rules in precedence order */
+	const struct msec_pol_rule *rule;
+	/** \brief SAM rule indices usable by the policy */
+	u32 sam_slots[MACSEC_MAX_SA_RULES / 32];
+	/** \brief (-i)CC rule indices usable by the policy */
+	u32 cc_slots[MACSEC_MAX_SA_RULES / 32];
+};
+
+/** \brief Compiled CP classifier */
+struct msec_pol_cp {
+	/** \brief DA of entries 0~9, range start, const44, const48 */
+	u8 da[13][6];
+	/** \brief Range end */
+	u8 da_end[6];
+	/** \brief Ether-type of entries 0~17 (10~12 unused) */
+	u16 et[18];
+	/** \brief Match enable (raw \ref cp_match_enable) */
+	u32 match_en;
+	/** \brief Match mode (raw \ref cp_match_mode) */
+	u32 match_mode;
+};
+
+/** \brief Compile result, also the installed state for the next compile */
+struct msec_pol_out {
+	/** \brief Direction. Valid values are defined in \ref msec_dir enum */
+	enum msec_dir dir;
+	/** \brief Number of SAM rules */
+	u16 nr_sam;
+	/** \brief SAM rules, \b rule_index assigned */
+	struct sa_match_param sam[MACSEC_MAX_SA_RULES];
+	/** \brief Policy rule of each SAM rule */
+	u16 sam_rule[MACSEC_MAX_SA_RULES];
+	/** \brief CP classifier */
+	struct msec_pol_cp cp;
+	/** \brief (-i)Number of CC rules */
+	u16 nr_cc;
+	/** \brief (-i)CC rules, \b icc_index assigned */
+	struct icc_match_param cc[MACSEC_MAX_SA_RULES];
+	/** \brief (-i)Policy rule of each CC rule */
+	u16 cc_rule[MACSEC_MAX_SA_RULES];
+	/** \brief Per-rule result. Valid values are defined in \ref msec_pol_diag enum */
+	u8 diag[MSEC_POL_MAX_RULES];
+	/** \brief Rule referred to by \b diag */
+	u16 diag_ref[MSEC_POL_MAX_RULES];
+};
+
+/** \brief Diff operation */
+struct msec_pol_op {
+	/** \brief Table. Valid values are defined in \ref msec_pol_tbl enum */
+	u8 tbl;
+	/** \brief Operation. Valid values are defined in \ref msec_pol_opc enum */
+	u8 opc;
+	/** \brief Rule index (SAM/CC) or CP write unit */
+	u8 index;
+	/** \brief Entry in \b sam or \b cc of \ref msec_pol_out (SAM/CC write) */
+	u8 entry;
+};
+
+/** \brief Changes between installed and compiled rules */
+struct msec_pol_diff {
+	/** \brief Number of operations */
+	u16 num;
+	/** \brief CP match enable before the first CP write */
+	u32 cp_en_base;
+	/** \brief Operations, writes before clears */
+	struct msec_pol_op op[MSEC_POL_MAX_OPS];
+};
+/**@}*/ /* GPY211_MACSEC_POL */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_POL */
+/**@{*/
+/**
+	\brief This API compiles a policy into SAM, CP and CC rules.
+
+	Rule indices are taken from \b sam_slots and \b cc_slots. With \b old,
+	entries equal to an installed entry keep its index and are not part of
+	\b diff, freed indices are reused first.
+
+	\param pol Pointer to policy (\ref msec_pol).
+	\param old Pointer to installed rules (\ref msec_pol_out), or NULL if none.
+	\param out Pointer to compiled rules (\ref msec_pol_out).
+	\param diff Pointer to changes (\ref msec_pol_diff).
+
+	\return
+	- =0: successful
+	- <0: error code (-ENOSPC: not enough rule entries, -ERANGE: overlap
+	chain longer than match priority levels)
+*/
+int gpy2xx_msec_pol_compile(const struct msec_pol *pol,
+			    const struct msec_pol_out *old,
+			    struct msec_pol_out *out, struct msec_pol_diff *diff);
+
+/**
+	\brief This API programs the changes of a compiled policy.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param out Pointer to compiled rules (\ref msec_pol_out).
+	\param diff Pointer to changes (\ref msec_pol_diff).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_pol_apply(struct gpy211_device *phy,
+			  const struct msec_pol_out *out,
+			  const struct msec_pol_diff *diff);
+/**@}*/ /* GPY211_MACSEC_POL */
+
+#endif /* _GPY211_MACSEC_POL_H_ */
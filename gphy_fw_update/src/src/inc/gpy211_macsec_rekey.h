@@ -0,0 +1,168 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MACSEC_REKEY_H_
+#define _GPY211_MACSEC_REKEY_H_
+
+#include "gpy211_macsec.h"
+
+/** \defgroup GPY211_MACSEC_REKEY Egress Pre-staged Rekey APIs
+	\brief Group of APIs switching an egress secure channel to the next AN
+	without rebuilding the transform record on the critical path.
+
+	Each egress SC owns two TR slots: the active one and a standby one.
+	As soon as the next key is known, \ref gpy2xx_msec_rekey_stage writes the
+	complete next-AN TR (including the hash key derivation) into the standby slot.
+	\ref gpy2xx_msec_rekey_sample is called periodically; it samples the PN of the
+	active SA, keeps a smoothed PN rate and projects the time to PN exhaustion.
+	Once the projection falls below \b lead_ms, \ref gpy2xx_msec_rekey_arm writes
+	the SA Update Control word of the active TR (one word) so the EIP-160 moves
+	the flow to the standby SA when the active PN is exhausted.
+	The switch-over is detected from the PN of the standby SA and the roles of
+	the two slots are exchanged.
+*/
+
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_REKEY */
+/**@{*/
+/** \brief Default lead time (ms) before projected PN exhaustion to arm switch-over */
+#define MSEC_REKEY_DEF_LEAD_MS 2000
+
+/**********************
+	Structures
+ **********************/
+
+/** \brief Rekey state of an egress secure channel */
+enum msec_rekey_state {
+	/** \brief No next key available, standby slot is free */
+	MSEC_REKEY_IDLE = 0,
+	/** \brief Next-AN TR written into the standby slot */
+	MSEC_REKEY_STAGED = 1,
+	/** \brief SA Update Control word of the active TR points to standby slot */
+	MSEC_REKEY_ARMED = 2,
+};
+
+/** \brief Rekey context of an egress secure channel, owned by the caller */
+struct msec_rekey {
+	/** \brief Flow control index (SAM rule index) of the secure channel */
+	u16 flow_index;
+	/** \brief Lead time in ms before projected PN exhaustion to arm switch-over.
+		\ref MSEC_REKEY_DEF_LEAD_MS is used if 0 */
+	u32 lead_ms;
+
+	/** \brief Rekey state. Valid values are defined in \ref msec_rekey_state enum */
+	enum msec_rekey_state state;
+	/** \brief TR index of the active SA */
+	u8 act_sa;
+	/** \brief Context control word of the active SA */
+	struct ctx_ctrl_word act_ccw;
+	/** \brief TR index of the standby SA */
+	u8 stby_sa;
+	/** \brief Context control word of the standby SA */
+	struct ctx_ctrl_word stby_ccw;
+	/** \brief Initial PN written to the standby SA */
+	u64 stby_pn;
+
+	/** \brief PN value at which the active SA is exhausted */
+	u64 pn_limit;
+	/** \brief Last sampled PN of the active SA */
+	u64 last_pn;
+	/** \brief Time stamp (ms) of the last PN sample */
+	u64 last_ms;
+	/** \brief Smoothed PN rate (packets per second) */
+	u64 pn_rate;
+	/** \brief Projected time (ms) to PN exhaustion of the active SA */
+	u64 ttl_ms;
+	/** \brief Number of completed switch-overs */
+	u32 switches;
+};
+/**@}*/ /* GPY211_MACSEC_REKEY */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_REKEY */
+/**@{*/
+/**
+	\brief This API initializes the rekey context of an egress secure channel.
+
+	\b act_tr is the TR already configured for the channel (only \b sa_index and
+	\b ccw are used). \b flow_index and \b lead_ms of \b rk must be set by caller.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param rk Pointer to rekey context (\ref msec_rekey).
+	\param act_tr Pointer to active TR config (\ref transform_rec).
+	\param stby_sa TR index used as standby slot.
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_rekey_init(struct gpy211_device *phy, struct msec_rekey *rk,
+			   const struct transform_rec *act_tr, u8 stby_sa);
+
+/**
+	\brief This API writes the next-AN TR into the standby slot.
+
+	The \b sa_index, \b ccw.an and \b sa_update of \b next_tr are overwritten by
+	the standby slot, the AN following the active one and a cleared SA update
+	control word. The PN starts from 1 if \b pn_rc.seq_num is 0.
+	The switch-over is armed immediately if the PN exhaustion is already
+	projected within \b lead_ms.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param rk Pointer to rekey context (\ref msec_rekey).
+	\param next_tr Pointer to next TR config (\ref transform_rec).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_rekey_stage(struct gpy211_device *phy, struct msec_rekey *rk,
+			    struct transform_rec *next_tr);
+
+/**
+	\brief This API arms the switch-over to the staged standby SA.
+
+	Writes the SA Update Control word of the active TR only. Can also be
+	called directly from the SA PN threshold event handler.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param rk Pointer to rekey context (\ref msec_rekey).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_rekey_arm(struct gpy211_device *phy, struct msec_rekey *rk);
+
+/**
+	\brief This API samples the PN of the active SA and drives the rekey state.
+
+	Updates the PN rate and the projected time to exhaustion, arms the
+	switch-over when due and detects the completed switch-over.
+	After a switch-over the old active TR is cleared and becomes the standby
+	slot, the state goes back to \ref MSEC_REKEY_IDLE waiting for the next key.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param rk Pointer to rekey context (\ref msec_rekey).
+	\param now_ms Monotonic time stamp in ms.
+
+	\return
+	- =1: switch-over to the standby SA completed
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_rekey_sample(struct gpy211_device *phy, struct msec_rekey *rk,
+			     u64 now_ms);
+/**@}*/ /* GPY211_MACSEC_REKEY */
+
+#endif /* _GPY211_MACSEC_REKEY_H_ */
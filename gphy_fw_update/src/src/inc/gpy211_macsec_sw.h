@@ -0,0 +1,234 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MACSEC_SW_H_
+#define _GPY211_MACSEC_SW_H_
+
+#include "gpy211_macsec.h"
+#include "gpy211_macsec_aes.h"
+
+/** \defgroup GPY211_MACSEC_SW Software MACsec Engine APIs
+	\brief Group of APIs performing the IEEE 802.1AE transform in software.
+
+	A software SA (\ref msec_sw_sa) is built from the same \ref transform_rec
+	(and optionally \ref sa_match_fca) used to program the EIP-160. Captures can
+	then be verified on a host without hardware, and SAs beyond \b nr_of_sas can
+	be processed in software. GCM-AES-128/256 and GCM-AES-XPN-128/256 are
+	supported. GHASH uses PCLMULQDQ (x86) or PMULL (aarch64) when the CPU
+	supports them, else a 4-bit table; CTR mode uses \ref gpy2xx_msec_aes_ctr32.
+	The SecTAG is inserted right after the source MAC address (no VLAN bypass).
+	Not available in kernel builds.
+*/
+
+#ifndef __KERNEL__
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_SW */
+/**@{*/
+/** \brief MACsec EtherType */
+#define MSEC_SW_ETHERTYPE 0x88E5
+/** \brief Length of DA + SA */
+#define MSEC_SW_MAC_HDR_LEN 12
+/** \brief SecTAG length without SCI */
+#define MSEC_SW_SECTAG_LEN 8
+/** \brief Explicit SCI length */
+#define MSEC_SW_SCI_LEN 8
+/** \brief ICV length */
+#define MSEC_SW_ICV_LEN 16
+/** \brief Max bytes added to a frame by encryption */
+#define MSEC_SW_MAX_OVERHEAD (MSEC_SW_SECTAG_LEN + MSEC_SW_SCI_LEN + MSEC_SW_ICV_LEN)
+
+/** \brief SecTAG TCI: End Station */
+#define MSEC_SW_TCI_ES 0x40
+/** \brief SecTAG TCI: SCI present */
+#define MSEC_SW_TCI_SC 0x20
+/** \brief SecTAG TCI: Single Copy Broadcast */
+#define MSEC_SW_TCI_SCB 0x10
+/** \brief SecTAG TCI: Encryption */
+#define MSEC_SW_TCI_E 0x08
+/** \brief SecTAG TCI: Changed text */
+#define MSEC_SW_TCI_C 0x04
+/** \brief SecTAG TCI: Association Number mask */
+#define MSEC_SW_TCI_AN 0x03
+
+/**********************
+	Structures
+ **********************/
+
+/** \brief Software SA statistics */
+struct msec_sw_stats {
+	/** \brief Frames encrypted/protected or decrypted/validated */
+	u64 pkts_ok;
+	/** \brief Octets of the secure data of \b pkts_ok */
+	u64 octets;
+	/** \brief Frames failing the ICV check */
+	u64 pkts_invalid;
+	/** \brief Frames failing the replay check */
+	u64 pkts_late;
+	/** \brief Frames with malformed SecTAG */
+	u64 pkts_bad_tag;
+	/** \brief Frames with AN/SCI not belonging to the SA */
+	u64 pkts_not_using_sa;
+};
+
+/** \brief Software SA, owned by the caller */
+struct msec_sw_sa {
+	/** \brief Direction. Valid values are defined in \ref msec_dir enum */
+	enum msec_dir dir;
+	/** \brief Association Number */
+	u8 an;
+	/** \brief Extended packet numbering (XPN cipher suite) */
+	u8 xpn;
+	/** \brief (-e)Confidentiality protection, else integrity only */
+	u8 encrypt;
+	/** \brief (-e)Include explicit SCI */
+	u8 send_sci;
+	/** \brief (-e)ES bit in TCI */
+	u8 es;
+	/** \brief (-e)SCB bit in TCI */
+	u8 scb;
+	/** \brief (-i)Replay protection */
+	u8 replay_protect;
+	/** \brief Confidentiality offset in bytes */
+	u8 conf_offset;
+	/** \brief (-i)Frame validation level. Valid values are defined in
+		\ref sam_fca_fvt enum */
+	enum sam_fca_fvt validate;
+	/** \brief (-i)Replay window */
+	u32 replay_window;
+	/** \brief Next PN to send (-e) or next PN expected (-i) */
+	u64 next_pn;
+	/** \brief SCI of the SA (wire order) */
+	u8 sci[MACSEC_SCI_LEN_BYTE];
+	/** \brief Salt with Short-SCI applied (XPN only) */
+	u8 salt[MACSEC_SALT_LEN_BYTE];
+	/** \brief Statistics */
+	struct msec_sw_stats stats;
+
+	/** \cond INTERNAL */
+	struct msec_aes_ctx aes;
+	/* GHASH 4-bit tables */
+	u64 hl[16];
+	u64 hh[16];
+	/* H^1..H^4 in carry-less multiply layout */
+	u8 hpow[4][MSEC_AES_BLOCK_LEN];
+	/** \endcond */
+};
+
+/** \brief Parsed SecTAG */
+struct msec_sw_sectag {
+	/** \brief TCI bits (without AN) */
+	u8 tci;
+	/** \brief Association Number */
+	u8 an;
+	/** \brief Short Length */
+	u8 sl;
+	/** \brief PN (lower 32 bits for XPN) */
+	u32 pn;
+	/** \brief Explicit SCI present */
+	u8 sci_present;
+	/** \brief Explicit SCI (wire order) */
+	u8 sci[MSEC_SW_SCI_LEN];
+	/** \brief Length of DA + SA + SecTAG (incl. SCI) */
+	u32 hdr_len;
+};
+/**@}*/ /* GPY211_MACSEC_SW */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_MACSEC_SW */
+/**@{*/
+/**
+	\brief This API builds a software SA from a transform record.
+
+	Uses \b ccw.ca_type, \b ccw.an, \b cp.key, \b cp.sci, \b cp.c_salt,
+	\b pn_rc.seq_num (\b seq0 for 32-bit PN, starts from 1 if 0) and \b pn_rc.mask
+	of \b tr.
+	The hash key is derived from the key, \b cp.hkey is not used.
+	From \b fca, egress uses \b conf_protect, \b include_sci, \b use_es,
+	\b use_scb and \b conf_offset; ingress uses \b replay_protect,
+	\b validate_frames and \b conf_offset. If \b fca is NULL, egress encrypts
+	with explicit SCI and ingress validates strictly with replay protection.
+
+	\param sa Pointer to software SA (\ref msec_sw_sa).
+	\param dir Direction (\ref msec_dir).
+	\param tr Pointer to TR config (\ref transform_rec).
+	\param fca Pointer to SAM flow control action (\ref sa_match_fca), or NULL.
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_msec_sw_sa_init(struct msec_sw_sa *sa, enum msec_dir dir,
+			   const struct transform_rec *tr,
+			   const struct sa_match_fca *fca);
+
+/**
+	\brief This API wipes the key material of a software SA.
+
+	\param sa Pointer to software SA (\ref msec_sw_sa).
+*/
+void gpy2xx_msec_sw_sa_clear(struct msec_sw_sa *sa);
+
+/**
+	\brief This API parses the SecTAG of a MACsec frame.
+
+	Used to select the SA (SCI and AN) before \ref gpy2xx_msec_sw_decrypt.
+
+	\param frame Pointer to Ethernet frame (starting at DA, without FCS).
+	\param len Frame length.
+	\param tag Pointer to parsed SecTAG (\ref msec_sw_sectag).
+
+	\return
+	- =0: successful
+	- <0: error code (-EINVAL: not a valid MACsec frame)
+*/
+int gpy2xx_msec_sw_get_sectag(const u8 *frame, u32 len,
+			      struct msec_sw_sectag *tag);
+
+/**
+	\brief This API encrypts (or integrity protects) an Ethernet frame.
+
+	\param sa Pointer to egress software SA (\ref msec_sw_sa).
+	\param in Pointer to Ethernet frame (starting at DA, without FCS).
+	\param len Frame length (at least DA + SA + EtherType).
+	\param out Pointer to output buffer (must not overlap \b in).
+	\param out_size Output buffer size, \b len + \ref MSEC_SW_MAX_OVERHEAD
+	is always enough.
+
+	\return
+	- >0: length of the MACsec frame
+	- <0: error code (-EOVERFLOW: PN exhausted, -ENOSPC: \b out too small)
+*/
+int gpy2xx_msec_sw_encrypt(struct msec_sw_sa *sa, const u8 *in, u32 len,
+			   u8 *out, u32 out_size);
+
+/**
+	\brief This API validates (and decrypts) a MACsec frame.
+
+	\param sa Pointer to ingress software SA (\ref msec_sw_sa).
+	\param in Pointer to MACsec frame (starting at DA, without FCS).
+	\param len Frame length.
+	\param out Pointer to output buffer (must not overlap \b in).
+	\param out_size Output buffer size, \b len is always enough.
+
+	\return
+	- >0: length of the Ethernet frame
+	- <0: error code (-EINVAL: bad SecTAG, -ENOENT: AN/SCI of other SA,
+	-ERANGE: replay check failed, -EBADMSG: ICV check failed,
+	-ENOSPC: \b out too small)
+*/
+int gpy2xx_msec_sw_decrypt(struct msec_sw_sa *sa, const u8 *in, u32 len,
+			   u8 *out, u32 out_size);
+/**@}*/ /* GPY211_MACSEC_SW */
+#endif /* __KERNEL__ */
+
+#endif /* _GPY211_MACSEC_SW_H_ */
@@ -0,0 +1,250 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_MON_H_
+#define _GPY211_MON_H_
+
+#include "gpy211.h"
+
+struct msec_harvest;
+
+/** \defgroup GPY211_MON Link and Event Monitor APIs
+	\brief Group of APIs tracking link state from the PHY interrupt.
+
+	\ref gpy2xx_mon_start enables the link, auto-negotiation, auto-downspeed,
+	WoL and MACsec interrupts. The caller waits for the interrupt line
+	(\ref gpy2xx_mon_wait in user space, an IRQ handler in kernel space) and
+	calls \ref gpy2xx_mon_event, which reads the interrupt status and then
+	only the status registers of the pending events:
+	- link, speed, duplex, MDI and auto-downspeed changes: PHY_MIISTAT,
+	- auto-negotiation complete: full \ref gpy2xx_read_status (partner
+	abilities),
+	- other events: nothing.
+
+	The PHY link state is updated, the event is appended to a timestamped
+	log (\ref gpy2xx_mon_log) and passed to the subscribers registered with
+	\ref gpy2xx_mon_subscribe. Nothing is read while the line is idle.
+
+	The interrupt status registers are cleared on read, so the monitor must
+	be their only reader. MACsec events are handed to the statistics harvester
+	set in \b hv (\ref gpy2xx_msec_harvest_istat) and reported in \b ext_istat.
+	\ref gpy2xx_msec_harvest_event reads the status registers itself and must
+	not be used while the monitor is running.
+*/
+
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_MON */
+/**@{*/
+/** \brief Max number of subscribers */
+#define GPY211_MON_MAX_SUBS 8
+/** \brief Number of entries in the event log, power of 2 */
+#define GPY211_MON_LOG_SIZE 64
+
+/** \brief Standard interrupts changing the link state */
+#define GPY211_MON_STD_LINK (EXTIN_PHY_LSTC | EXTIN_PHY_LSPC | EXTIN_PHY_DXMC | \
+			     EXTIN_PHY_MDIXC | EXTIN_PHY_MDIPC)
+/** \brief Standard auto-negotiation interrupts */
+#define GPY211_MON_STD_ANEG (EXTIN_PHY_ANC | EXTIN_PHY_ANE)
+/** \brief Standard interrupts enabled by default */
+#define GPY211_MON_STD_DEF (GPY211_MON_STD_LINK | GPY211_MON_STD_ANEG | \
+			    EXTIN_PHY_ADSC | EXTIN_PHY_WOL)
+/** \brief Extended interrupts enabled by default */
+#define GPY211_MON_EXT_DEF EXTIN_IM2_IE_MACSEC
+
+/** \brief Interrupt line exported to user space */
+enum gpy211_mon_line {
+	/** \brief sysfs GPIO \b value file with \b edge configured */
+	GPY211_MON_LINE_GPIO = 0,
+	/** \brief UIO device, re-enabled after each event */
+	GPY211_MON_LINE_UIO = 1,
+};
+/**@}*/ /* GPY211_MON */
+
+/**********************
+	Structures
+ **********************/
+
+/** \addtogroup GPY211_MON */
+/**@{*/
+/** \brief Event log entry */
+struct gpy211_mon_evt {
+	/** \brief Monotonic time of the status read in ns */
+	u64 ts;
+	/** \brief Sequence number */
+	u32 seq;
+	/** \brief Standard interrupt status (\ref gpy211_extin_phy_event) */
+	u16 std_istat;
+	/** \brief Extended interrupt status (\ref gpy211_extin_im2_mask) */
+	u16 ext_istat;
+	/** \brief Link state after the event */
+	int link;
+	/** \brief Link speed after the event (\ref GPY211_LINK_SPEED) */
+	int speed;
+	/** \brief Duplex after the event (\ref GPY211_LINK_DUPLEX) */
+	int duplex;
+};
+
+/** \brief Subscriber callback, called without the PHY lock held */
+typedef void (*gpy211_mon_cb)(struct gpy211_device *phy,
+			      const struct gpy211_mon_evt *evt, void *data);
+
+/** \brief Subscriber */
+struct gpy211_mon_sub {
+	/** \brief Callback, NULL if the slot is free */
+	gpy211_mon_cb cb;
+	/** \brief Callback data */
+	void *data;
+	/** \brief Standard events of interest */
+	u16 std_events;
+	/** \brief Extended events of interest */
+	u16 ext_events;
+};
+
+/** \brief Monitor context, owned by the caller */
+struct gpy211_mon {
+	/** \brief (in) Standard interrupts to enable, 0 for \ref GPY211_MON_STD_DEF */
+	u16 std_imask;
+	/** \brief (in) Extended interrupts to enable, 0 for \ref GPY211_MON_EXT_DEF */
+	u16 ext_imask;
+	/** \brief (in) MACsec statistics harvester serviced on \ref EXTIN_IM2_IE_MACSEC,
+		NULL to leave MACsec events to the subscribers */
+	struct msec_harvest *hv;
+
+	/** \brief Subscribers */
+	struct gpy211_mon_sub sub[GPY211_MON_MAX_SUBS];
+	/** \brief Event log, entry \b seq is at \b seq % \ref GPY211_MON_LOG_SIZE */
+	struct gpy211_mon_evt log[GPY211_MON_LOG_SIZE];
+	/** \brief Number of events logged */
+	u32 seq;
+
+	/** \brief Events with interrupt status set */
+	u32 events;
+	/** \brief Events with no interrupt status set */
+	u32 spurious;
+	/** \brief Full status reads (auto-negotiation complete) */
+	u32 full_reads;
+
+	/** \cond INTERNAL */
+	/** \brief Interrupt masks before \ref gpy2xx_mon_start */
+	u16 old_std_imask;
+	u16 old_ext_imask;
+	/** \endcond */
+};
+/**@}*/ /* GPY211_MON */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_MON */
+/**@{*/
+/**
+	\brief This API starts the link and event monitor.
+
+	Reads the link status once with \ref gpy2xx_read_status, clears pending
+	interrupt status and enables \b std_imask and \b ext_imask. The previous
+	masks are restored by \ref gpy2xx_mon_stop. Subscribers are kept.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param mon Pointer to monitor context (\ref gpy211_mon).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_mon_start(struct gpy211_device *phy, struct gpy211_mon *mon);
+
+/**
+	\brief This API stops the link and event monitor.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param mon Pointer to monitor context (\ref gpy211_mon).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_mon_stop(struct gpy211_device *phy, struct gpy211_mon *mon);
+
+/**
+	\brief This API registers a subscriber.
+
+	\param mon Pointer to monitor context (\ref gpy211_mon).
+	\param std_events Standard events of interest (\ref gpy211_extin_phy_event).
+	\param ext_events Extended events of interest (\ref gpy211_extin_im2_mask).
+	\param cb Callback.
+	\param data Callback data.
+
+	\return
+	- >=0: subscriber ID
+	- <0: error code (-ENOSPC: no free slot)
+*/
+int gpy2xx_mon_subscribe(struct gpy211_mon *mon, u16 std_events,
+			 u16 ext_events, gpy211_mon_cb cb, void *data);
+
+/**
+	\brief This API removes a subscriber.
+
+	\param mon Pointer to monitor context (\ref gpy211_mon).
+	\param id Subscriber ID returned by \ref gpy2xx_mon_subscribe.
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_mon_unsubscribe(struct gpy211_mon *mon, int id);
+
+/**
+	\brief This API services a PHY interrupt.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param mon Pointer to monitor context (\ref gpy211_mon).
+
+	\return
+	- =1: event logged and dispatched
+	- =0: no interrupt status set
+	- <0: error code
+*/
+int gpy2xx_mon_event(struct gpy211_device *phy, struct gpy211_mon *mon);
+
+/**
+	\brief This API copies logged events.
+
+	\param mon Pointer to monitor context (\ref gpy211_mon).
+	\param seq Pointer to sequence number of the next event to copy, updated.
+	Events overwritten in the log are skipped.
+	\param evt Pointer to array receiving the events, oldest first.
+	\param num Max number of events to copy.
+
+	\return
+	- >=0: number of events copied
+	- <0: error code
+*/
+int gpy2xx_mon_log(const struct gpy211_mon *mon, u32 *seq,
+		   struct gpy211_mon_evt *evt, u32 num);
+
+#ifndef __KERNEL__
+/**
+	\brief This API waits for the PHY interrupt line.
+
+	\param fd File descriptor of the GPIO value file or UIO device.
+	\param line Type of \b fd (\ref gpy211_mon_line).
+	\param timeout_ms Timeout in milliseconds (<0: wait forever).
+
+	\return
+	- =1: event
+	- =0: timeout
+	- <0: error code
+*/
+int gpy2xx_mon_wait(int fd, enum gpy211_mon_line line, int timeout_ms);
+#endif
+/**@}*/ /* GPY211_MON */
+
+#endif /* _GPY211_MON_H_ */
@@ -0,0 +1,233 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY211_PTP_H_
+#define _GPY211_PTP_H_
+
+#include "gpy211.h"
+
+/** \defgroup GPY211_PTP_BATCH PTP Timestamp Batch APIs
+	\brief Group of APIs moving IEEE 1588 timestamps to a PTP stack.
+
+	\ref gpy2xx_ptp_drain_ts empties the Rx and Tx timestamp FIFOs of the PHY
+	in one locked pass: the FIFO status is read once, every pending entry is
+	popped and the entries are published into a \ref gpy211_ptp_ts_ring.
+	The ring is single-producer/single-consumer: one thread (or the interrupt
+	handler) drains the PHY, one PTP stack thread consumes with
+	\ref gpy2xx_ptp_ts_ring_pop without taking the PHY lock.
+*/
+
+/** \defgroup GPY211_PTP_XTS PTP Clock Cross-Timestamp APIs
+	\brief Group of APIs relating the PHY clock (PHC) to a system clock.
+
+	The system time registers of the GMAC are read as four 16-bit words over
+	MDIO, each read taking up to a few hundred microseconds. The seconds are
+	read again after the nanoseconds, a seconds rollover in between is
+	resolved from the nanoseconds value. Only the read of the nanoseconds
+	low word is bracketed by the system clock samples, which gives the
+	tightest bracket the bus allows (like PTP_SYS_OFFSET_EXTENDED).
+*/
+
+/**********************
+	Constant
+ **********************/
+
+/** \addtogroup GPY211_PTP_BATCH */
+/**@{*/
+/** \brief Number of entries in \ref gpy211_ptp_ts_ring, power of 2 */
+#define GPY211_PTP_TS_RING_SIZE 256
+/** \brief Depth of the Rx/Tx timestamp FIFO of the PHY */
+#define GPY211_PTP_TS_FIFO_DEPTH 16
+/** \brief Cache line size used to separate producer and consumer indices */
+#define GPY211_PTP_CACHE_LINE 64
+
+/** \brief Direction of a timestamp entry */
+enum gpy211_ptp_ts_dir {
+	/** \brief Received frame */
+	GPY211_PTP_TS_RX = 0,
+	/** \brief Transmitted frame */
+	GPY211_PTP_TS_TX = 1,
+	/** \brief Auxiliary snapshot (external event) */
+	GPY211_PTP_TS_AUX = 2,
+};
+/**@}*/ /* GPY211_PTP_BATCH */
+
+/** \addtogroup GPY211_PTP_XTS */
+/**@{*/
+/** \brief Max number of samples of \ref gpy2xx_ptp_getcrosststamp */
+#define GPY211_PTP_XTS_MAX_SAMPLES 25
+
+/** \brief System clock sampled around the PHC read */
+enum gpy211_ptp_sysclk {
+	/** \brief CLOCK_REALTIME */
+	GPY211_PTP_SYSCLK_REALTIME = 0,
+	/** \brief CLOCK_MONOTONIC */
+	GPY211_PTP_SYSCLK_MONOTONIC = 1,
+	/** \brief CLOCK_MONOTONIC_RAW */
+	GPY211_PTP_SYSCLK_MONOTONIC_RAW = 2,
+};
+/**@}*/ /* GPY211_PTP_XTS */
+
+/**********************
+	Structures
+ **********************/
+
+/** \addtogroup GPY211_PTP_BATCH */
+/**@{*/
+/** \brief Timestamp entry */
+struct gpy211_ptp_ts_ent {
+	/** \brief Timestamp in nanoseconds */
+	u64 ts;
+	/** \brief Frame CRC used as ID to match, 0 for auxiliary snapshots */
+	u32 crc;
+	/** \brief Direction. Valid values are defined in \ref gpy211_ptp_ts_dir enum */
+	u32 dir;
+};
+
+/** \brief Single-producer/single-consumer timestamp ring, owned by the caller.
+	Initialize with \ref gpy2xx_ptp_ts_ring_init */
+struct gpy211_ptp_ts_ring {
+	/** \brief Next entry written, updated by the producer only */
+	u32 head;
+	/** \brief Entries dropped because the ring was full (producer) */
+	u32 drops;
+	/** \brief Rx FIFO overflows seen by the producer */
+	u32 rx_ovfl;
+	/** \brief Tx FIFO overflows seen by the producer */
+	u32 tx_ovfl;
+	/** \brief Auxiliary snapshot FIFO overflows seen by the producer */
+	u32 aux_ovfl;
+	/** \brief Padding, keeps \b tail off the producer cache line */
+	u8 pad0[GPY211_PTP_CACHE_LINE - 5 * sizeof(u32)];
+	/** \brief Next entry read, updated by the consumer only */
+	u32 tail;
+	/** \brief Padding, keeps \b ent off the consumer cache line */
+	u8 pad1[GPY211_PTP_CACHE_LINE - sizeof(u32)];
+	/** \brief Entries */
+	struct gpy211_ptp_ts_ent ent[GPY211_PTP_TS_RING_SIZE];
+};
+/**@}*/ /* GPY211_PTP_BATCH */
+
+/** \addtogroup GPY211_PTP_XTS */
+/**@{*/
+/** \brief One cross-timestamp sample */
+struct gpy211_ptp_xts_sample {
+	/** \brief System time before the PHC read */
+	struct timespec64 pre;
+	/** \brief PHC time */
+	struct timespec64 phc;
+	/** \brief System time after the PHC read */
+	struct timespec64 post;
+};
+
+/** \brief Cross-timestamp request and result */
+struct gpy211_ptp_xts {
+	/** \brief (in) Number of samples (1 ~ \ref GPY211_PTP_XTS_MAX_SAMPLES) */
+	u32 n_samples;
+	/** \brief (in) System clock. Valid values are defined in
+		\ref gpy211_ptp_sysclk enum */
+	enum gpy211_ptp_sysclk clk;
+	/** \brief Samples */
+	struct gpy211_ptp_xts_sample sample[GPY211_PTP_XTS_MAX_SAMPLES];
+	/** \brief Index of the sample with the tightest bracket */
+	u32 best;
+	/** \brief Bracket width (post - pre) of the best sample in ns */
+	s64 delay;
+	/** \brief PHC - system time (midpoint of the bracket) of the best
+		sample in ns */
+	s64 offset;
+};
+/**@}*/ /* GPY211_PTP_XTS */
+
+/**********************
+	APIs
+ **********************/
+
+/** \addtogroup GPY211_PTP_BATCH */
+/**@{*/
+/**
+	\brief This API initializes an empty timestamp ring.
+
+	\param ring Pointer to ring (\ref gpy211_ptp_ts_ring).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_ptp_ts_ring_init(struct gpy211_ptp_ts_ring *ring);
+
+/**
+	\brief This API drains the Rx and Tx timestamp FIFOs into a ring.
+	\details Reads the FIFO status once and pops all pending Rx entries, then
+	all pending Tx entries, under one acquisition of the PHY lock. FIFO
+	overflows are counted in the ring and cleared. Entries not fitting into
+	the ring are still popped from the PHY (so the FIFO keeps capturing) and
+	counted in \b drops. The caller is the only producer of \b ring.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param ring Pointer to ring (\ref gpy211_ptp_ts_ring).
+
+	\return
+	- >=0: number of entries published
+	- <0: error code
+*/
+int gpy2xx_ptp_drain_ts(struct gpy211_device *phy,
+			struct gpy211_ptp_ts_ring *ring);
+
+/**
+	\brief This API drains the auxiliary snapshot FIFO into a ring.
+	\details Reads the number of snapshots (ATSNS) once and pops them all
+	under one acquisition of the PHY lock, see \ref gpy2xx_ptp_drain_ts.
+	Entries have direction \ref GPY211_PTP_TS_AUX.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param ring Pointer to ring (\ref gpy211_ptp_ts_ring).
+
+	\return
+	- >=0: number of entries published
+	- <0: error code
+*/
+int gpy2xx_ptp_drain_auxts(struct gpy211_device *phy,
+			   struct gpy211_ptp_ts_ring *ring);
+
+/**
+	\brief This API takes entries from a timestamp ring.
+	\details Lock-free, the caller is the only consumer of \b ring.
+
+	\param ring Pointer to ring (\ref gpy211_ptp_ts_ring).
+	\param ent Pointer to array receiving the entries, oldest first.
+	\param num Max number of entries to take.
+
+	\return
+	- >=0: number of entries taken
+	- <0: error code
+*/
+int gpy2xx_ptp_ts_ring_pop(struct gpy211_ptp_ts_ring *ring,
+			   struct gpy211_ptp_ts_ent *ent, u32 num);
+/**@}*/ /* GPY211_PTP_BATCH */
+
+/** \addtogroup GPY211_PTP_XTS */
+/**@{*/
+/**
+	\brief This API reads the PHC bracketed by system clock samples.
+	\details Takes \b n_samples rollover-safe readings of the PHC, each
+	between two readings of the system clock \b clk, and selects the sample
+	with the tightest bracket. The PHY lock is taken per sample, so timestamp
+	draining can run in between.
+
+	\param phy Pointer to GPHY data (\ref gpy211_device).
+	\param xts Pointer to request and result (\ref gpy211_ptp_xts).
+
+	\return
+	- =0: successful
+	- <0: error code
+*/
+int gpy2xx_ptp_getcrosststamp(struct gpy211_device *phy,
+			      struct gpy211_ptp_xts *xts);
+/**@}*/ /* GPY211_PTP_XTS */
+
+#endif /* _GPY211_PTP_H_ */
@@ -35,9 +35,17 @@ ALL_INC="-I../../src/os/linux -I${GPY211_INC}"
 #echo ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c "${PHY_SRC}/gpy211_phy.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_phy_static.o "${PHY_SRC}/gpy211_phy.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_chip_static.o "${PHY_SRC}/gpy211_chip.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_ptp_static.o "${PHY_SRC}/gpy211_ptp.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_mon_static.o "${PHY_SRC}/gpy211_mon.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_static.o "${MACSEC_SRC}/gpy211_macsec.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_harvest_static.o "${MACSEC_SRC}/gpy211_macsec_harvest.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_rekey_static.o "${MACSEC_SRC}/gpy211_macsec_rekey.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_aes_static.o "${MACSEC_SRC}/gpy211_macsec_aes.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_alloc_static.o "${MACSEC_SRC}/gpy211_macsec_alloc.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_sw_static.o "${MACSEC_SRC}/gpy211_macsec_sw.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_pol_static.o "${MACSEC_SRC}/gpy211_macsec_pol.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all -I${DDKAES_INC} ${ALL_INC} -c -o aes_static.o "${DDKAES_SRC}/aes.c"
-${AR} rcs libgpy2xx_static.a gpy211_phy_static.o gpy211_chip_static.o gpy211_macsec_static.o aes_static.o
+${AR} rcs libgpy2xx_static.a gpy211_phy_static.o gpy211_chip_static.o gpy211_ptp_static.o gpy211_mon_static.o gpy211_macsec_static.o gpy211_macsec_harvest_static.o gpy211_macsec_rekey_static.o gpy211_macsec_aes_static.o gpy211_macsec_alloc_static.o gpy211_macsec_sw_static.o gpy211_macsec_pol_static.o aes_static.o
 
 #dynamic library creation
 #${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -fPIC -o gpy211_phy.o "${PHY_SRC}/gpy211_phy.c"
@@ -0,0 +1,154 @@
+#!/bin/bash
+#
+# Generate gpy2xx_regmap_tab.c from the register headers in src/inc/registers.
+#
+# phy/*.h go to the MDIO table. The PDI map differs per chip family, so
+# there is one PDI table per family: p31g/*.h for P31G, and for P34X the
+# p31g/*.h headers with those of the same name replaced by p34x/*.h, plus
+# the other p34x/*.h. Reserved fields (RES, RESn, RESERVED_n) are dropped.
+#
+# Two registers at the same address in one table are an error, except for
+# the aliases listed in ALIASES which are dropped in favour of the register
+# declared first.
+#
+# usage: ./gen_regmap.sh [register dir] > gpy2xx_regmap_tab.c
+
+REG_DIR=${1:-../../src/inc/registers}
+export LC_ALL=C
+set -o pipefail
+
+# Second register at the same address in the same header
+ALIASES="CHIPID_QRR_HIGH CHIPID_RESERVED"
+
+for d in phy p31g p34x; do
+	if [[ ! -d "${REG_DIR}/${d}" ]]; then
+		echo "${REG_DIR}/${d} not found" >&2
+		exit 1
+	fi
+done
+
+# One line per register: <space> <addr> <width> <name> [<field>:<pos>:<bits>]...
+extract() {
+	awk -v space="$1" '
+	function hex(s,    i, n) {
+		sub(/^0[xX]/, "", s);
+		sub(/[uU]$/, "", s);
+		n = 0;
+		for (i = 1; i <= length(s); i++)
+			n = n * 16 + index("0123456789ABCDEF", toupper(substr(s, i, 1))) - 1;
+		return n;
+	}
+	function flush() {
+		if (reg != "" && addr != "")
+			printf("%s %08X %d %s%s\n", space, addr, width, reg, fields);
+		reg = ""; addr = ""; fields = "";
+	}
+	FNR == 1 { flush(); width = 16 }
+	/^\/\/ Register Width *:/ { width = $NF + 0 }
+	/^\/\/! \\defgroup [A-Za-z0-9_]+ Register [A-Za-z0-9_]+ / { flush(); reg = $3; next }
+	/^\/\/! Register Offset \(absolute\)/ { want_addr = 1; next }
+	want_addr && /^#define / {
+		addr = hex($3); want_addr = 0; next
+	}
+	/^\/\/! Field [A-Za-z0-9_]+ / { fname = $3; next }
+	/^#define [A-Za-z0-9_]+_POS / && fname != "" { fpos = $3 + 0; next }
+	/^#define [A-Za-z0-9_]+_MASK / && fname != "" {
+		m = hex($3);
+		for (bits = 0; m > 0; m = int(m / 2))
+			bits += m % 2;
+		if (fname !~ /^RES[0-9]*$/ && fname !~ /^RESERVED(_[0-9]+)?$/)
+			fields = fields " " fname ":" fpos ":" bits;
+		fname = ""; next
+	}
+	END { flush() }
+	' "${@:2}"
+}
+
+P34X_HDR=()
+for f in "${REG_DIR}"/p31g/*.h; do
+	[[ -e "${REG_DIR}/p34x/${f##*/}" ]] || P34X_HDR+=("$f")
+done
+P34X_HDR+=("${REG_DIR}"/p34x/*.h)
+
+{
+	extract 0 "${REG_DIR}"/phy/*.h
+	extract 1 "${REG_DIR}"/p31g/*.h
+	extract 2 "${P34X_HDR[@]}"
+} | sort -s -k1,1n -k2,2 | awk -v aliases="${ALIASES}" '
+BEGIN {
+	nr_str = 0; str_len = 0; nr_field = 0; nr_reg = 0; failed = 0;
+	split(aliases, a, " ");
+	for (i in a)
+		alias[a[i]] = 1;
+}
+function intern(s) {
+	if (!(s in str_off)) {
+		str_off[s] = str_len;
+		str[nr_str++] = s;
+		str_len += length(s) + 1;
+	}
+	return str_off[s];
+}
+{
+	key = $1 " " $2;
+	if (key in seen) {
+		if (seen[key] == $4 || ($4 in alias))
+			next;
+		printf("gen_regmap.sh: %s and %s at 0x%s in table %s\n", seen[key], $4, $2, $1) > "/dev/stderr";
+		failed = 1;
+		exit 1;
+	}
+	seen[key] = $4;
+
+	# Identical field lists (e.g. a P31G register repeated for P34X) are shared
+	run = "";
+	for (i = 5; i <= NF; i++)
+		run = run " " $i;
+	if (run in run_first) {
+		first = run_first[run];
+	} else {
+		first = nr_field;
+		for (i = 5; i <= NF; i++) {
+			split($i, f, ":");
+			field[nr_field++] = sprintf("\t{ %u, %u, %u },", intern(f[1]), f[2], f[3]);
+		}
+		run_first[run] = first;
+	}
+
+	reg[nr_reg] = sprintf("\t{ 0x%s, %u, %u, %u, %u },", $2, intern($4), NF - 4, $3 == 32, first);
+	space_nr[$1]++;
+	nr_reg++;
+}
+END {
+	if (failed)
+		exit 1;
+	print "/******************************************************************************";
+	print "         Copyright 2020 - 2021 MaxLinear Inc.";
+	print "";
+	print "  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)";
+	print "";
+	print "******************************************************************************/";
+	print "";
+	print "/* Generated by gen_regmap.sh from src/inc/registers, do not edit. */";
+	print "";
+	print "#include \"gpy2xx_regmap.h\"";
+	print "";
+	print "const char gpy2xx_regmap_str[] =";
+	for (i = 0; i < nr_str; i++)
+		printf("\t\"%s\\0\"%s\n", str[i], i + 1 < nr_str ? "" : ";");
+	print "";
+	print "const struct gpy2xx_regmap_field gpy2xx_regmap_field[] = {";
+	for (i = 0; i < nr_field; i++)
+		print field[i];
+	print "};";
+	print "";
+	print "/* MDIO, P31G PDI and P34X PDI registers, each sorted by address */";
+	print "const struct gpy2xx_regmap_reg gpy2xx_regmap_reg[] = {";
+	for (i = 0; i < nr_reg; i++)
+		print reg[i];
+	print "};";
+	print "";
+	printf("const unsigned int gpy2xx_regmap_nr[GPY2XX_REGMAP_SPACES] = { %u, %u, %u };\n",
+	       space_nr[0], space_nr[1], space_nr[2]);
+}
+'
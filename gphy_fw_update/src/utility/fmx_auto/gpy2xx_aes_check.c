@@ -0,0 +1,229 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* AES / hash key derivation checker.
+
+   Checks gpy2xx_msec_aes_encrypt, gpy2xx_msec_derive_hkey,
+   gpy2xx_msec_derive_hkey_batch and gpy2xx_msec_aes_ctr32 with the
+   T-table implementation and, if the CPU supports it, with AES-NI / ARMv8
+   Crypto Extension:
+     - against the FIPS-197 (Appendix B, C.1, C.3) and GCM hash key vectors,
+     - against the reference AES of the DDK (Example_AES) for count random
+       AES-128 and AES-256 keys.
+
+   gpy2xx_aes_check [count=<n>] [seed=<n>]
+
+   Returns 0 if all checks pass.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <gpy211_common.h>
+#include <gpy211_macsec_aes.h>
+#include "aes.h"
+
+#define CHECK_MAX_BLK 8
+
+struct check_vec {
+	const char *name;
+	u32 keylen;
+	u8 key[32];
+	u8 pt[16];
+	u8 ct[16];
+};
+
+static const struct check_vec check_vec[] = {
+	{
+		"FIPS-197 B", 16,
+		{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c},
+		{0x32, 0x43, 0xf6, 0xa8, 0x88, 0x5a, 0x30, 0x8d, 0x31, 0x31, 0x98, 0xa2, 0xe0, 0x37, 0x07, 0x34},
+		{0x39, 0x25, 0x84, 0x1d, 0x02, 0xdc, 0x09, 0xfb, 0xdc, 0x11, 0x85, 0x97, 0x19, 0x6a, 0x0b, 0x32},
+	},
+	{
+		"FIPS-197 C.1", 16,
+		{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f},
+		{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff},
+		{0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a},
+	},
+	{
+		"FIPS-197 C.3", 32,
+		{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f},
+		{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff},
+		{0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89},
+	},
+	/* GCM test cases 1 and 13: H = AES-K(0^128) with K = 0 */
+	{
+		"GCM H 128", 16, {0}, {0},
+		{0x66, 0xe9, 0x4b, 0xd4, 0xef, 0x8a, 0x2c, 0x3b, 0x88, 0x4c, 0xfa, 0x59, 0xca, 0x34, 0x2b, 0x2e},
+	},
+	{
+		"GCM H 256", 32, {0}, {0},
+		{0xdc, 0x95, 0xc0, 0x78, 0xa2, 0x40, 0x89, 0x89, 0xad, 0x48, 0xa2, 0x14, 0x92, 0x84, 0x20, 0x87},
+	},
+};
+
+static u32 check_fail;
+
+static void check_hex(const char *tag, const u8 *p, u32 len)
+{
+	u32 i;
+
+	printf("\t%s ", tag);
+
+	for (i = 0; i < len; i++)
+		printf("%02x", p[i]);
+
+	printf("\n");
+}
+
+static void check_cmp(const char *impl, const char *name, const u8 *key, u32 keylen,
+		      const u8 *got, const u8 *exp, u32 len)
+{
+	if (memcmp(got, exp, len) == 0)
+		return;
+
+	check_fail++;
+	printf("FAIL: %s %s AES-%u\n", impl, name, keylen * 8);
+	check_hex("key", key, keylen);
+	check_hex("got", got, len);
+	check_hex("exp", exp, len);
+}
+
+/* Reference counter mode, GCM inc32 */
+static void check_ref_ctr(const u8 *key, u32 keylen, const u8 *ctr0, const u8 *in, u8 *out, u32 len)
+{
+	u8 ctr[16], ks[16];
+	u32 i, c;
+
+	memcpy(ctr, ctr0, sizeof(ctr));
+
+	for (i = 0; i < len; i++) {
+		if ((i % 16) == 0) {
+			AES_Encrypt(ctr, ks, key, keylen);
+			c = ((u32)ctr[12] << 24 | (u32)ctr[13] << 16 | (u32)ctr[14] << 8 | ctr[15]) + 1;
+			ctr[12] = (u8)(c >> 24);
+			ctr[13] = (u8)(c >> 16);
+			ctr[14] = (u8)(c >> 8);
+			ctr[15] = (u8)c;
+		}
+
+		out[i] = in[i] ^ ks[i % 16];
+	}
+}
+
+static void check_key(const char *impl, const char *name, const u8 *key, u32 keylen,
+		      const u8 *pt, const u8 *ct)
+{
+	static const u8 zero_blk[16];
+	struct msec_aes_ctx ctx;
+	struct transform_rec tr[2];
+	u8 out[16], ref[16], hkey[16];
+	u8 ctr[16], buf[CHECK_MAX_BLK * 16 + 7], exp[sizeof(buf)];
+	u32 i;
+
+	if (gpy2xx_msec_aes_setkey(&ctx, key, keylen) < 0) {
+		check_fail++;
+		printf("FAIL: %s %s setkey\n", impl, name);
+		return;
+	}
+
+	gpy2xx_msec_aes_encrypt(&ctx, pt, out);
+	check_cmp(impl, name, key, keylen, out, ct, sizeof(out));
+
+	AES_Encrypt(zero_blk, ref, key, keylen);
+
+	memset(hkey, 0, sizeof(hkey));
+	gpy2xx_msec_derive_hkey(key, keylen, hkey);
+	check_cmp(impl, name, key, keylen, hkey, ref, sizeof(hkey));
+
+	/* Same key twice, the schedule is reused for the second record */
+	memset(tr, 0, sizeof(tr));
+
+	for (i = 0; i < ARRAY_SIZE(tr); i++) {
+		tr[i].ccw.ca_type = keylen == 16 ? GCM_AES_128 : GCM_AES_256;
+		memcpy(tr[i].cp.key, key, keylen);
+	}
+
+	gpy2xx_msec_derive_hkey_batch(tr, ARRAY_SIZE(tr));
+
+	for (i = 0; i < ARRAY_SIZE(tr); i++)
+		check_cmp(impl, name, key, keylen, tr[i].cp.hkey, ref, sizeof(ref));
+
+	/* Counter wrapping in the last word, partial last block */
+	for (i = 0; i < sizeof(ctr); i++)
+		ctr[i] = (u8)(i == 15 ? 0xFD : i + key[0]);
+
+	for (i = 0; i < sizeof(buf); i++)
+		buf[i] = (u8)(i * 7 + key[1]);
+
+	check_ref_ctr(key, keylen, ctr, buf, exp, sizeof(buf));
+	gpy2xx_msec_aes_ctr32(&ctx, ctr, buf, buf, sizeof(buf));
+	check_cmp(impl, name, key, keylen, buf, exp, sizeof(buf));
+}
+
+static void check_impl(const char *impl, u32 count, u32 seed)
+{
+	u8 key[32], pt[16], ct[16];
+	u32 i, j, keylen;
+
+	for (i = 0; i < ARRAY_SIZE(check_vec); i++)
+		check_key(impl, check_vec[i].name, check_vec[i].key, check_vec[i].keylen,
+			  check_vec[i].pt, check_vec[i].ct);
+
+	srand(seed);
+
+	for (i = 0; i < count; i++) {
+		keylen = (i & 1) ? 32 : 16;
+
+		for (j = 0; j < keylen; j++)
+			key[j] = (u8)rand();
+
+		for (j = 0; j < sizeof(pt); j++)
+			pt[j] = (u8)rand();
+
+		AES_Encrypt(pt, ct, key, keylen);
+		check_key(impl, "random", key, keylen, pt, ct);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	u32 count = 10000, seed = (u32)time(NULL);
+	u32 impls = 1;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "count=", 6) == 0) {
+			count = (u32)strtoul(argv[i] + 6, NULL, 0);
+		} else if (strncmp(argv[i], "seed=", 5) == 0) {
+			seed = (u32)strtoul(argv[i] + 5, NULL, 0);
+		} else {
+			printf("Usage: %s [count=<n>] [seed=<n>]\n", argv[0]);
+			return -1;
+		}
+	}
+
+	printf("seed %u, %u random keys\n", seed, count);
+
+	gpy2xx_msec_aes_use_hw(0);
+	check_impl("T-table", count, seed);
+
+	if (gpy2xx_msec_aes_use_hw(1) == 0) {
+		check_impl("HW", count, seed);
+		impls++;
+	} else {
+		printf("AES instructions not supported, HW path not checked\n");
+	}
+
+	printf("%s: %u implementation(s), %u failure(s)\n", check_fail ? "FAIL" : "PASS", impls, check_fail);
+
+	return check_fail ? 1 : 0;
+}
@@ -0,0 +1,680 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Tunes the PM buffer-manager and GMAC-Lite pause thresholds under load,
+   and applies the tuned profile of the link speed on each speed change.
+
+   Each trial runs the load for dwell ms (or the load command to its end)
+   and counts the drops: GMAC-F Tx underflow and Rx CRC errors (64-bit
+   accumulator) plus the shared-buffer overflow flags and the GMAC-Lite Tx
+   jabber / Rx watchdog timeout flags (sampled every TUNE_SAMPLE_MS). The
+   GMAC-Lite has no packet counters, these flags are all it reports. A trial with less than minPkts packets is an error, so
+   that an idle link never passes.
+
+   The search, at the current link speed:
+     1. MAC frequency tuning (gpy2xx_pm_freq_tune), the lowest of 0, +100
+        and +300 ppm without drops.
+     2. SB0 and SB1 dequeue thresholds (gpy2xx_gmacx_bm_cfg), each the
+        lowest value without drops; less buffering is less latency.
+     3. Pause assert threshold (gpy2xx_gmacl_pause_cfg), the lowest value
+        without drops, deassert keeps its distance (hysteresis). Skipped if
+        Tx flow control is off.
+   A threshold search starts at the current value, doubles it while it
+   drops (up to the buffer size), then bisects down. If a trial fails, the
+   original settings are restored.
+
+   The load is external traffic through the PHY, or loop=<n> sets a PHY
+   test loop (gpy211_test_loop, the host traffic comes back) for the run.
+   The profile is appended to out, one line per PHY and speed, later lines
+   win. apply=<file> sets the profile of the current speed; with watch=<ms>
+   the link is polled and the profile re-applied on every speed change.
+
+   gpy2xx_bm_tune phyId=<n> [dwell=<ms>] [minPkts=<n>] [load=<cmd>]
+                  [loop=<n>] [out=<file>]
+   gpy2xx_bm_tune phyId=<n> apply=<file> [watch=<ms>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/wait.h>
+
+#include "gpy2xx_mdio.h"
+#include <registers/phy/vspec1.h>
+#include <registers/p31g/gmacl_eqos_mac.h>
+
+/* Shared-buffer status sampling period during a trial in ms */
+#define TUNE_SAMPLE_MS 10
+/* Max wait for link up after a loopback change in ms */
+#define TUNE_LINK_MS 10000
+
+struct tune_cfg {
+	int phy_id;
+	u32 dwell_ms;
+	u32 min_pkts;
+	const char *load;
+	int loop;
+	const char *out;
+	const char *apply;
+	u32 watch_ms;
+};
+
+/* Tuned settings of one link speed */
+struct tune_prof {
+	int speed;
+	enum mac_freq_tune ppm;
+	u16 sb0_thresh;
+	u16 sb1_thresh;
+	u16 pause_assert;
+	u16 pause_deassert;
+};
+
+struct tune {
+	const struct tune_cfg *cfg;
+	struct bm_cfg bm;
+	struct pause_cfg pause;
+	struct tune_freq freq;
+	/* pause_deassert_thresh - pause_assert_thresh, kept while tuning */
+	int pause_gap;
+	struct gmacf_count_acc acc;
+	u32 trials;
+};
+
+static struct gpy211_device phy;
+static struct gpy2xx_mdio mdio;
+static volatile sig_atomic_t tune_stop;
+
+static const int tune_ppm[] = {0, 100, 300};
+
+static void tune_sig(int sig)
+{
+	(void)sig;
+	tune_stop = 1;
+}
+
+static u32 tune_ms_since(const struct timespec *t0)
+{
+	struct timespec t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (u32)((t1.tv_sec - t0->tv_sec) * 1000 +
+		     (t1.tv_nsec - t0->tv_nsec) / 1000000);
+}
+
+/* Wait for link up, returns the link speed or <0 error code */
+static int tune_link_wait(u32 ms)
+{
+	struct timespec t0;
+	int ret;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+
+	do {
+		ret = gpy2xx_read_status(&phy);
+
+		if (ret < 0)
+			return ret;
+
+		if (phy.link.link && phy.link.speed != SPEED_UNKNOWN)
+			return phy.link.speed;
+
+		usleep(100000);
+	} while (tune_ms_since(&t0) < ms);
+
+	return -ENOLINK;
+}
+
+/* Start the load command, returns its pid, 0 if none, or <0 error code */
+static pid_t tune_load_start(const char *load)
+{
+	pid_t pid;
+
+	if (load == NULL)
+		return 0;
+
+	pid = fork();
+
+	if (pid == 0) {
+		execl("/bin/sh", "sh", "-c", load, (char *)NULL);
+		_exit(127);
+	}
+
+	return pid < 0 ? -errno : pid;
+}
+
+/* GMAC-Lite Tx jabber and Rx watchdog timeouts since the last call, the
+   flags are cleared on read. P34X has an XGMAC there, not sampled.
+   Returns the number of flags set, or <0 error code */
+static int tune_gmacl_drops(void)
+{
+	u32 val = 0;
+	int ret;
+
+	if (phy.id.family == ID_P34X)
+		return 0;
+
+	ret = gpy2xx_mbox_read16(&phy, phy.gmacl_base_addr + GMACL_MAC_RX_TX_STATUS_L, &val);
+
+	if (ret < 0)
+		return ret;
+
+	return !!(val & GMACL_MAC_RX_TX_STATUS_L_TJT_MASK) +
+	       !!(val & GMACL_MAC_RX_TX_STATUS_L_RWT_MASK);
+}
+
+/* One trial at the current settings.
+   Returns the number of drops, or <0 error code */
+static s64 tune_trial(struct tune *t)
+{
+	struct pm_bm_status bm;
+	struct timespec t0;
+	pid_t pid;
+	u64 ov = 0, pkts;
+	int ret, status, running;
+
+	t->trials++;
+
+	ret = gpy2xx_gmacf_count_acc_init(&phy, &t->acc);
+
+	if (ret < 0)
+		return ret;
+
+	/* Clear the status */
+	ret = gpy2xx_gmacx_bm_status_get(&phy, &bm);
+
+	if (ret < 0)
+		return ret;
+
+	ret = tune_gmacl_drops();
+
+	if (ret < 0)
+		return ret;
+
+	pid = tune_load_start(t->cfg->load);
+
+	if (pid < 0)
+		return pid;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+
+	do {
+		usleep(TUNE_SAMPLE_MS * 1000);
+
+		ret = gpy2xx_gmacx_bm_status_get(&phy, &bm);
+
+		if (ret < 0)
+			break;
+
+		ov += bm.sb0_ov + bm.sb0_tx_reg_ov + bm.sb0_rx_reg_ov +
+		      bm.sb1_ov + bm.sb1_tx_reg_ov + bm.sb1_rx_reg_ov;
+
+		ret = tune_gmacl_drops();
+
+		if (ret < 0)
+			break;
+
+		ov += ret;
+
+		if (pid > 0)
+			running = waitpid(pid, &status, WNOHANG) == 0;
+		else
+			running = tune_ms_since(&t0) < t->cfg->dwell_ms;
+	} while (running && !tune_stop);
+
+	if (pid > 0 && (ret < 0 || tune_stop)) {
+		kill(pid, SIGTERM);
+		waitpid(pid, &status, 0);
+	}
+
+	if (ret < 0)
+		return ret;
+
+	if (tune_stop)
+		return -EINTR;
+
+	ret = gpy2xx_gmacf_count_acc_update(&phy, &t->acc);
+
+	if (ret < 0)
+		return ret;
+
+	pkts = t->acc.total.tx_good_bad + t->acc.total.rx_good_bad;
+
+	if (pkts < t->cfg->min_pkts) {
+		printf("ERROR: no load, %llu packets in trial\n", (unsigned long long)pkts);
+		return -ENODATA;
+	}
+
+	return (s64)(ov + t->acc.total.tx_uflow_err + t->acc.total.rx_crc_err);
+}
+
+static int tune_set_bm(struct tune *t)
+{
+	return gpy2xx_gmacx_bm_cfg(&phy, &t->bm);
+}
+
+static int tune_set_pause(struct tune *t)
+{
+	t->pause.pause_deassert_thresh = (u16)(t->pause.pause_assert_thresh + t->pause_gap);
+
+	return gpy2xx_gmacl_pause_cfg(&phy, &t->pause);
+}
+
+/* Lowest value of *val without drops in [1, max], written with set.
+   Returns the drops at the result (0 unless max drops), or <0 error code */
+static s64 tune_search(struct tune *t, const char *name, u16 *val, u16 max,
+		       int (*set)(struct tune *))
+{
+	u32 lo = 0, hi = *val ? *val : 1;
+	s64 drops;
+	int ret;
+
+	if (hi > max)
+		hi = max;
+
+	/* Grow until it passes */
+	for (;;) {
+		*val = (u16)hi;
+		ret = set(t);
+
+		if (ret < 0)
+			return ret;
+
+		drops = tune_trial(t);
+		printf("\t%s %u: %lld drop(s)\n", name, hi, (long long)drops);
+
+		if (drops <= 0)
+			break;
+
+		if (hi == max)
+			return drops;
+
+		lo = hi;
+		hi = hi * 2 > max ? max : hi * 2;
+	}
+
+	if (drops < 0)
+		return drops;
+
+	/* lo drops (or is 0), hi passes */
+	while (hi - lo > 1) {
+		u32 mid = lo + (hi - lo) / 2;
+
+		*val = (u16)mid;
+		ret = set(t);
+
+		if (ret < 0)
+			return ret;
+
+		drops = tune_trial(t);
+		printf("\t%s %u: %lld drop(s)\n", name, mid, (long long)drops);
+
+		if (drops < 0)
+			return drops;
+
+		if (drops == 0)
+			hi = mid;
+		else
+			lo = mid;
+	}
+
+	*val = (u16)hi;
+	ret = set(t);
+
+	return ret < 0 ? ret : 0;
+}
+
+static s64 tune_run(struct tune *t, struct tune_prof *prof)
+{
+	int i;
+	s64 drops = 0;
+
+	/* 1. MAC frequency */
+	for (i = FREQ_PPM_000; i <= FREQ_PPM_300; i++) {
+		t->freq.ppm = (enum mac_freq_tune)i;
+
+		if (gpy2xx_pm_freq_tune(&phy, &t->freq) < 0)
+			return -EIO;
+
+		drops = tune_trial(t);
+		printf("\tfreq +%dppm: %lld drop(s)\n", tune_ppm[i], (long long)drops);
+
+		if (drops <= 0)
+			break;
+	}
+
+	if (drops < 0)
+		return drops;
+
+	/* 2. Dequeue thresholds */
+	drops = tune_search(t, "sb0_thresh", &t->bm.sb0_pkt_thresh,
+			    (u16)(t->bm.sb0_end - t->bm.sb0_start), tune_set_bm);
+
+	if (drops < 0)
+		return drops;
+
+	drops = tune_search(t, "sb1_thresh", &t->bm.sb1_pkt_thresh,
+			    (u16)(t->bm.sb1_end - t->bm.sb1_start), tune_set_bm);
+
+	if (drops < 0)
+		return drops;
+
+	/* 3. Pause threshold, deassert follows assert */
+	if (t->pause.tx_flow_ctrl) {
+		drops = tune_search(t, "pause_assert", &t->pause.pause_assert_thresh,
+				    (u16)(t->pause_gap > 0 ? 0xFFFF - t->pause_gap : 0xFFFF),
+				    tune_set_pause);
+
+		if (drops < 0)
+			return drops;
+	} else {
+		printf("\tpause: Tx flow control off, skipped\n");
+	}
+
+	prof->speed = phy.link.speed;
+	prof->ppm = t->freq.ppm;
+	prof->sb0_thresh = t->bm.sb0_pkt_thresh;
+	prof->sb1_thresh = t->bm.sb1_pkt_thresh;
+	prof->pause_assert = t->pause.pause_assert_thresh;
+	prof->pause_deassert = t->pause.pause_deassert_thresh;
+
+	return drops;
+}
+
+static void tune_save(const struct tune_cfg *cfg, const struct tune_prof *prof)
+{
+	FILE *f;
+
+	if (cfg->out == NULL)
+		return;
+
+	f = fopen(cfg->out, "a");
+
+	if (f == NULL) {
+		printf("WARN: Could not open \"%s\"\n", cfg->out);
+		return;
+	}
+
+	fprintf(f, "addr=%d speed=%d ppm=%d sb0_thresh=%u sb1_thresh=%u "
+		"pause_assert=%u pause_deassert=%u\n", phy.phy_addr, prof->speed,
+		prof->ppm, prof->sb0_thresh, prof->sb1_thresh, prof->pause_assert,
+		prof->pause_deassert);
+	fclose(f);
+}
+
+/* Find the profile of speed in file, later lines win.
+   Returns 1 if found, 0 if not, or <0 error code */
+static int tune_load(const char *file, int speed, struct tune_prof *prof)
+{
+	char line[256];
+	int addr, found = 0;
+	struct tune_prof p;
+	unsigned int v[5];
+	FILE *f;
+
+	f = fopen(file, "r");
+
+	if (f == NULL) {
+		printf("ERROR: Could not open \"%s\"\n", file);
+		return -ENOENT;
+	}
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		if (sscanf(line, "addr=%d speed=%d ppm=%u sb0_thresh=%u sb1_thresh=%u "
+			   "pause_assert=%u pause_deassert=%u", &addr, &p.speed, &v[0],
+			   &v[1], &v[2], &v[3], &v[4]) != 7 ||
+		    addr != phy.phy_addr || p.speed != speed || v[0] > FREQ_PPM_300)
+			continue;
+
+		p.ppm = (enum mac_freq_tune)v[0];
+		p.sb0_thresh = (u16)v[1];
+		p.sb1_thresh = (u16)v[2];
+		p.pause_assert = (u16)v[3];
+		p.pause_deassert = (u16)v[4];
+		*prof = p;
+		found = 1;
+	}
+
+	fclose(f);
+	return found;
+}
+
+static int tune_apply(const struct tune_prof *prof)
+{
+	struct bm_cfg bm;
+	struct pause_cfg pause;
+	struct tune_freq freq = {.ppm = prof->ppm};
+	int ret;
+
+	ret = gpy2xx_pm_freq_tune(&phy, &freq);
+
+	if (ret < 0)
+		return ret;
+
+	ret = gpy2xx_gmacx_bm_get(&phy, &bm);
+
+	if (ret < 0)
+		return ret;
+
+	bm.sb0_pkt_thresh = prof->sb0_thresh;
+	bm.sb1_pkt_thresh = prof->sb1_thresh;
+	ret = gpy2xx_gmacx_bm_cfg(&phy, &bm);
+
+	if (ret < 0)
+		return ret;
+
+	ret = gpy2xx_gmacl_pause_get(&phy, &pause);
+
+	if (ret < 0)
+		return ret;
+
+	pause.pause_assert_thresh = prof->pause_assert;
+	pause.pause_deassert_thresh = prof->pause_deassert;
+
+	return gpy2xx_gmacl_pause_cfg(&phy, &pause);
+}
+
+/* Apply the profile of the current speed, on each speed change if watch */
+static int tune_watch(const struct tune_cfg *cfg)
+{
+	struct tune_prof prof;
+	int ret, speed = SPEED_UNKNOWN;
+
+	do {
+		ret = gpy2xx_read_status(&phy);
+
+		if (ret < 0)
+			return ret;
+
+		if (phy.link.link && phy.link.speed != speed) {
+			speed = phy.link.speed;
+			ret = tune_load(cfg->apply, speed, &prof);
+
+			if (ret < 0)
+				return ret;
+
+			if (ret == 0) {
+				printf("speed %d: no profile\n", speed);
+			} else {
+				ret = tune_apply(&prof);
+				printf("speed %d: ppm +%d sb0 %u sb1 %u pause %u/%u%s\n", speed,
+				       tune_ppm[prof.ppm], prof.sb0_thresh, prof.sb1_thresh,
+				       prof.pause_assert, prof.pause_deassert,
+				       ret < 0 ? " failed" : "");
+			}
+		} else if (!phy.link.link) {
+			/* Re-apply after link down, the speed may come back the same */
+			speed = SPEED_UNKNOWN;
+		}
+
+		if (cfg->watch_ms)
+			usleep(cfg->watch_ms * 1000);
+	} while (cfg->watch_ms && !tune_stop);
+
+	return 0;
+}
+
+static int tune_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int tune_parse(int argc, char *argv[], struct tune_cfg *cfg)
+{
+	int i;
+	const char *v;
+
+	for (i = 1; i < argc; i++) {
+		if (tune_arg(argv[i], "phyId", &v))
+			cfg->phy_id = (int)strtol(v, NULL, 0);
+		else if (tune_arg(argv[i], "dwell", &v))
+			cfg->dwell_ms = (u32)strtoul(v, NULL, 0);
+		else if (tune_arg(argv[i], "minPkts", &v))
+			cfg->min_pkts = (u32)strtoul(v, NULL, 0);
+		else if (tune_arg(argv[i], "load", &v))
+			cfg->load = v;
+		else if (tune_arg(argv[i], "loop", &v))
+			cfg->loop = (int)strtol(v, NULL, 0);
+		else if (tune_arg(argv[i], "out", &v))
+			cfg->out = v;
+		else if (tune_arg(argv[i], "apply", &v))
+			cfg->apply = v;
+		else if (tune_arg(argv[i], "watch", &v))
+			cfg->watch_ms = (u32)strtoul(v, NULL, 0);
+		else
+			return -1;
+	}
+
+	if (cfg->phy_id < 0 || cfg->dwell_ms == 0 || cfg->loop < TLOOP_OFF)
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct tune t;
+	struct bm_cfg bm;
+	struct pause_cfg pause;
+	struct tune_freq freq;
+	struct tune_prof prof;
+	s64 drops;
+	int ret;
+	struct tune_cfg cfg = {
+		.phy_id = -1,
+		.dwell_ms = 2000,
+		.min_pkts = 1000,
+		.loop = TLOOP_OFF,
+	};
+
+	if (tune_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s phyId=<n> [dwell=<ms>] [minPkts=<n>] [load=<cmd>]\n"
+		       "\t[loop=<n>] [out=<file>]\n"
+		       "       %s phyId=<n> apply=<file> [watch=<ms>]\n", argv[0], argv[0]);
+		return -1;
+	}
+
+	ret = gpy2xx_mdio_phy_init(&phy, &mdio, cfg.phy_id);
+
+	if (ret < 0)
+		goto end;
+
+	signal(SIGINT, tune_sig);
+	signal(SIGTERM, tune_sig);
+
+	if (cfg.apply != NULL) {
+		ret = tune_watch(&cfg);
+		goto end;
+	}
+
+	t.cfg = &cfg;
+
+	if (gpy2xx_gmacx_bm_get(&phy, &bm) < 0 || gpy2xx_gmacl_pause_get(&phy, &pause) < 0) {
+		printf("ERROR: BM/pause settings not available\n");
+		ret = -1;
+		goto end;
+	}
+
+	ret = PHY_READ_MMD(&phy, MDIO_MMD_VEND1, VSPEC1_PM_CTRL);
+
+	if (ret < 0) {
+		printf("ERROR: PM_CTRL read failed (%d)\n", ret);
+		goto end;
+	}
+
+	freq.ppm = (enum mac_freq_tune)FIELD_GET(ret, VSPEC1_PM_CTRL_MAC_FREQ_TUNE);
+
+	if (cfg.loop != TLOOP_OFF) {
+		ret = gpy2xx_loopback_cfg(&phy, (enum gpy211_test_loop)cfg.loop);
+
+		if (ret == 0)
+			ret = gpy2xx_restart_aneg(&phy);
+
+		if (ret < 0) {
+			printf("ERROR: loop %d failed (%d)\n", cfg.loop, ret);
+			goto end;
+		}
+	}
+
+	ret = tune_link_wait(TUNE_LINK_MS);
+
+	if (ret < 0) {
+		printf("ERROR: no link (%d)\n", ret);
+		goto restore;
+	}
+
+	printf("speed %d: sb0 %u sb1 %u pause %u/%u (flow control %s)\n", ret,
+	       bm.sb0_pkt_thresh, bm.sb1_pkt_thresh, pause.pause_assert_thresh,
+	       pause.pause_deassert_thresh, pause.tx_flow_ctrl ? "on" : "off");
+
+	t.bm = bm;
+	t.pause = pause;
+	t.pause_gap = (int)pause.pause_deassert_thresh - pause.pause_assert_thresh;
+	drops = tune_run(&t, &prof);
+
+	if (drops < 0) {
+		printf("ERROR: tuning failed (%lld), original settings restored\n",
+		       (long long)drops);
+		gpy2xx_gmacx_bm_cfg(&phy, &bm);
+		gpy2xx_gmacl_pause_cfg(&phy, &pause);
+		gpy2xx_pm_freq_tune(&phy, &freq);
+		ret = -1;
+		goto restore;
+	}
+
+	printf("speed %d: ppm +%d sb0 %u sb1 %u pause %u/%u, %lld drop(s), %u trials\n",
+	       prof.speed, tune_ppm[prof.ppm], prof.sb0_thresh, prof.sb1_thresh,
+	       prof.pause_assert, prof.pause_deassert, (long long)drops, t.trials);
+
+	if (drops)
+		printf("WARN: drops left at the largest thresholds, profile not saved\n");
+	else
+		tune_save(&cfg, &prof);
+
+	ret = drops ? -1 : 0;
+
+restore:
+	if (cfg.loop != TLOOP_OFF) {
+		gpy2xx_loopback_cfg(&phy, TLOOP_OFF);
+		gpy2xx_restart_aneg(&phy);
+	}
+
+end:
+
+	if (mdio.fd >= 0)
+		close(mdio.fd);
+
+	return ret;
+}
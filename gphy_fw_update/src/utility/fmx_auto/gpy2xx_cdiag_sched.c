@@ -0,0 +1,420 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Runs cable diagnostics (or ABIST) on all PHYs of the scanned buses at
+   once and prints one report.
+
+   The test is started on every port of a wave with gpy2xx_cdiag_start /
+   gpy2xx_abist_start, then all running ports are polled with exponential
+   backoff (from poll ms up to 8 x poll ms). A port is done when the
+   firmware leaves the test mode (PHY_TEST.TM no longer reads CDIAG/ABIST);
+   if it has not after timeout ms, its results are read anyway and marked
+   as timed out. Results are collected with gpy2xx_cdiag_read /
+   gpy2xx_abist_read and the test is stopped (gpy2xx_cdiag_stop).
+
+   The test takes the link down. Ports with link up are handled by policy:
+     idle     skipped (default)
+     all      tested in the first wave with the idle ports
+     stagger  tested after the idle ports, group at a time, so that at most
+              group links are down at once
+   Idle ports all go in the first wave, so a whole box takes one test
+   duration plus the staggered waves.
+
+   gpy2xx_cdiag_sched [xgmacMask=<mask>] [addrMask=<mask>] [smdioAddr=<n>]
+                      [test=cdiag|abist] [abist=<n>] [policy=idle|all|stagger]
+                      [group=<n>] [poll=<ms>] [timeout=<ms>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+
+#include "gpy2xx_mgr.h"
+#include <registers/phy/phy.h>
+
+enum sched_policy {
+	SCHED_IDLE = 0,
+	SCHED_ALL = 1,
+	SCHED_STAGGER = 2,
+};
+
+enum sched_state {
+	SCHED_WAIT = 0,
+	SCHED_RUN,
+	SCHED_DONE,
+	SCHED_TIMEOUT,
+	SCHED_SKIP,
+	SCHED_FAIL,
+};
+
+struct sched_cfg {
+	u32 xgmac_mask;
+	u32 addr_mask;
+	u32 smdio_addr;
+	u32 abist;
+	enum gpy211_abist_test abist_test;
+	enum sched_policy policy;
+	u32 group;
+	u32 poll_ms;
+	u32 timeout_ms;
+};
+
+/* Test of one port */
+struct sched_port {
+	struct gpy2xx_mgr_phy *p;
+	enum sched_state state;
+	/* Link was up before the test */
+	int link;
+	/* Wave, 0 first */
+	u32 wave;
+	int ret;
+	u32 run_ms;
+	struct timespec t0;
+	union {
+		struct gpy211_cdiag_report cdiag;
+		struct gpy211_abist_report abist;
+	} rep;
+};
+
+static const char *const sched_state_name[] = {
+	"wait", "run", "ok", "timeout", "skipped (link up)", "failed",
+};
+
+static u32 sched_ms_since(const struct timespec *t0)
+{
+	struct timespec t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (u32)((t1.tv_sec - t0->tv_sec) * 1000 +
+		     (t1.tv_nsec - t0->tv_nsec) / 1000000);
+}
+
+static int sched_start(const struct sched_cfg *cfg, struct sched_port *port)
+{
+	struct gpy211_abist_param param = {
+		.restart = 0,
+		.uart_report = 0,
+		.test = cfg->abist_test,
+	};
+
+	clock_gettime(CLOCK_MONOTONIC, &port->t0);
+
+	if (cfg->abist)
+		return gpy2xx_abist_start(&port->p->dev, &param);
+
+	return gpy2xx_cdiag_start(&port->p->dev);
+}
+
+/* Returns 1 if the firmware left the test mode, 0 if not, or <0 error code */
+static int sched_done(const struct sched_cfg *cfg, struct sched_port *port)
+{
+	int ret;
+
+	ret = PHY_READ(&port->p->dev, PHY_PHY_TEST);
+
+	if (ret < 0)
+		return ret;
+
+	return FIELD_GET(ret, PHY_TEST_TM) != (cfg->abist ? TEST_ABIST : TEST_CDIAG);
+}
+
+static void sched_finish(const struct sched_cfg *cfg, struct sched_port *port,
+			 enum sched_state state)
+{
+	port->run_ms = sched_ms_since(&port->t0);
+
+	if (cfg->abist)
+		port->ret = gpy2xx_abist_read(&port->p->dev, &port->rep.abist);
+	else
+		port->ret = gpy2xx_cdiag_read(&port->p->dev, &port->rep.cdiag);
+
+	/* Back to normal operation */
+	gpy2xx_cdiag_stop(&port->p->dev);
+	port->state = port->ret < 0 ? SCHED_FAIL : state;
+}
+
+/* Run one wave: start all, poll with backoff until all are done */
+static void sched_wave(const struct sched_cfg *cfg, struct sched_port *port,
+		       u32 nr_port, u32 wave)
+{
+	u32 i, running = 0, delay = cfg->poll_ms;
+	int ret;
+
+	for (i = 0; i < nr_port; i++) {
+		if (port[i].state != SCHED_WAIT || port[i].wave != wave)
+			continue;
+
+		port[i].ret = sched_start(cfg, &port[i]);
+		port[i].state = port[i].ret < 0 ? SCHED_FAIL : SCHED_RUN;
+		running += port[i].state == SCHED_RUN;
+	}
+
+	while (running) {
+		usleep(delay * 1000);
+
+		if (delay < cfg->poll_ms * 8)
+			delay *= 2;
+
+		for (i = 0; i < nr_port; i++) {
+			if (port[i].state != SCHED_RUN)
+				continue;
+
+			ret = sched_done(cfg, &port[i]);
+
+			if (ret == 0 && sched_ms_since(&port[i].t0) < cfg->timeout_ms)
+				continue;
+
+			if (ret < 0) {
+				port[i].ret = ret;
+				port[i].state = SCHED_FAIL;
+				gpy2xx_cdiag_stop(&port[i].p->dev);
+			} else {
+				sched_finish(cfg, &port[i], ret ? SCHED_DONE : SCHED_TIMEOUT);
+			}
+
+			running--;
+		}
+	}
+}
+
+static const char *sched_pair_state(u8 state)
+{
+	if (state & CDIAG_SHORT)
+		return "short";
+
+	if (state & CDIAG_OPEN)
+		return "open";
+
+	if (state & CDIAG_REFLECTION)
+		return "reflect";
+
+	return "ok";
+}
+
+static void sched_report(const struct sched_cfg *cfg, struct gpy2xx_mgr *mgr,
+			 const struct sched_port *port, u32 nr_port)
+{
+	u32 i, j, k;
+
+	printf("\n%-6s %-5s %-5s %-5s %-8s %-18s %s\n", "xgmac", "addr", "link",
+	       "wave", "time(ms)", "status", cfg->abist ? "pair A/B/C/D ICN avg, AGC mean" :
+	       "pair A/B/C/D state@m (first echo)");
+
+	for (i = 0; i < nr_port; i++) {
+		const struct sched_port *pt = &port[i];
+
+		printf("%-6d %-5u %-5s %-5u %-8u %-18s", mgr->bus[pt->p->bus].cfg.xgmac_id,
+		       pt->p->dev.phy_addr, pt->link ? "up" : "down", pt->wave, pt->run_ms,
+		       sched_state_name[pt->state]);
+
+		if (pt->state != SCHED_DONE && pt->state != SCHED_TIMEOUT) {
+			printf(pt->state == SCHED_FAIL ? " (%d)\n" : "\n", pt->ret);
+			continue;
+		}
+
+		for (j = 0; j < 4; j++) {
+			if (cfg->abist) {
+				printf(" %c:%u/%u", 'A' + j, pt->rep.abist.pair[j].icn_gmax.mag_avg,
+				       pt->rep.abist.pair[j].agc_hyb.agc_mean);
+				continue;
+			}
+
+			if (pt->rep.cdiag.pair[j].num_valid_result == 0) {
+				printf(" %c:-", 'A' + j);
+				continue;
+			}
+
+			/* The nearest fault, else the first echo */
+			for (k = 0; k < pt->rep.cdiag.pair[j].num_valid_result; k++) {
+				if (pt->rep.cdiag.pair[j].results[k].state & (CDIAG_OPEN | CDIAG_SHORT))
+					break;
+			}
+
+			if (k == pt->rep.cdiag.pair[j].num_valid_result)
+				k = 0;
+
+			printf(" %c:%s@%u", 'A' + j,
+			       sched_pair_state(pt->rep.cdiag.pair[j].results[k].state),
+			       pt->rep.cdiag.pair[j].results[k].distance);
+		}
+
+		printf("\n");
+	}
+}
+
+static int sched_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int sched_parse(int argc, char *argv[], struct sched_cfg *cfg)
+{
+	int i;
+	const char *v;
+
+	for (i = 1; i < argc; i++) {
+		if (sched_arg(argv[i], "xgmacMask", &v)) {
+			cfg->xgmac_mask = (u32)strtoul(v, NULL, 0);
+		} else if (sched_arg(argv[i], "addrMask", &v)) {
+			cfg->addr_mask = (u32)strtoul(v, NULL, 0);
+		} else if (sched_arg(argv[i], "smdioAddr", &v)) {
+			cfg->smdio_addr = (u32)strtoul(v, NULL, 0);
+		} else if (sched_arg(argv[i], "test", &v)) {
+			if (strcmp(v, "cdiag") == 0)
+				cfg->abist = 0;
+			else if (strcmp(v, "abist") == 0)
+				cfg->abist = 1;
+			else
+				return -1;
+		} else if (sched_arg(argv[i], "abist", &v)) {
+			cfg->abist_test = (enum gpy211_abist_test)strtoul(v, NULL, 0);
+		} else if (sched_arg(argv[i], "policy", &v)) {
+			if (strcmp(v, "idle") == 0)
+				cfg->policy = SCHED_IDLE;
+			else if (strcmp(v, "all") == 0)
+				cfg->policy = SCHED_ALL;
+			else if (strcmp(v, "stagger") == 0)
+				cfg->policy = SCHED_STAGGER;
+			else
+				return -1;
+		} else if (sched_arg(argv[i], "group", &v)) {
+			cfg->group = (u32)strtoul(v, NULL, 0);
+		} else if (sched_arg(argv[i], "poll", &v)) {
+			cfg->poll_ms = (u32)strtoul(v, NULL, 0);
+		} else if (sched_arg(argv[i], "timeout", &v)) {
+			cfg->timeout_ms = (u32)strtoul(v, NULL, 0);
+		} else {
+			return -1;
+		}
+	}
+
+	if (cfg->xgmac_mask == 0 || cfg->addr_mask == 0 || cfg->group == 0 ||
+	    cfg->poll_ms == 0 || cfg->timeout_ms == 0)
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct gpy2xx_mgr mgr;
+	struct gpy2xx_mgr_bus_cfg bus[GPY2XX_MGR_MAX_BUSES];
+	struct sched_port *port = NULL;
+	u32 i, nr_bus = 0, nr_port = 0, waves = 1, staggered = 0;
+	int ret, fd;
+	const char *gsw_dev = "/dev/switch_api/0";
+	struct sched_cfg cfg = {
+		.xgmac_mask = 1u << 2,
+		.addr_mask = 0xFFFFFFFF,
+		.abist_test = ABIST_ANALOG_IPV_0,
+		.policy = SCHED_IDLE,
+		.group = 1,
+		.poll_ms = 100,
+		.timeout_ms = 10000,
+	};
+
+	if (sched_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s [xgmacMask=<mask>] [addrMask=<mask>] [smdioAddr=<n>]\n"
+		       "\t[test=cdiag|abist] [abist=<n>] [policy=idle|all|stagger]\n"
+		       "\t[group=<n>] [poll=<ms>] [timeout=<ms>]\n", argv[0]);
+		return -1;
+	}
+
+	fd = open(gsw_dev, O_RDONLY);
+
+	if (fd < 0) {
+		printf("ERROR: Could not open switch dev node \"%s\"\n", gsw_dev);
+		return -1;
+	}
+
+	for (i = 0; i < 32 && nr_bus < GPY2XX_MGR_MAX_BUSES; i++) {
+		if (!(cfg.xgmac_mask & (1u << i)))
+			continue;
+
+		bus[nr_bus].xgmac_id = i;
+		bus[nr_bus].addr_mask = cfg.addr_mask;
+		bus[nr_bus].smdio_addr = cfg.smdio_addr;
+		bus[nr_bus].ptp_clock = 0x1836E210; //406.25MHz
+		nr_bus++;
+	}
+
+	ret = gpy2xx_mgr_open(&mgr, fd, bus, nr_bus);
+
+	if (ret >= 0)
+		ret = gpy2xx_mgr_init(&mgr);
+
+	if (ret <= 0) {
+		printf("ERROR: No PHY found (%d)\n", ret);
+		ret = -1;
+		goto end;
+	}
+
+	port = calloc(mgr.nr_phy, sizeof(*port));
+
+	if (port == NULL) {
+		ret = -1;
+		goto end;
+	}
+
+	/* Plan the waves from the link state */
+	for (i = 0; i < mgr.nr_phy; i++) {
+		struct sched_port *pt = &port[nr_port];
+
+		if (mgr.phy[i].ret < 0)
+			continue;
+
+		pt->p = &mgr.phy[i];
+		nr_port++;
+
+		if (gpy2xx_read_status(&pt->p->dev) < 0) {
+			pt->state = SCHED_FAIL;
+			pt->ret = -EIO;
+			continue;
+		}
+
+		pt->link = pt->p->dev.link.link;
+
+		if (!pt->link || cfg.policy == SCHED_ALL)
+			continue;
+
+		if (cfg.policy == SCHED_IDLE) {
+			pt->state = SCHED_SKIP;
+			continue;
+		}
+
+		pt->wave = 1 + staggered++ / cfg.group;
+		waves = pt->wave + 1;
+	}
+
+	for (i = 0; i < waves; i++)
+		sched_wave(&cfg, port, nr_port, i);
+
+	sched_report(&cfg, &mgr, port, nr_port);
+
+	ret = 0;
+
+	for (i = 0; i < nr_port; i++) {
+		if (port[i].state == SCHED_FAIL || port[i].state == SCHED_TIMEOUT)
+			ret = -1;
+	}
+
+end:
+	free(port);
+	gpy2xx_mgr_close(&mgr);
+	close(fd);
+
+	return ret;
+}
@@ -15,9 +15,19 @@
 #include <sys/time.h>
 #include<stdlib.h>
 #include<string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 #include "gpy211_utility.h"
 #include "gpy2xx_mdio.h"
+#include "gpy2xx_mgr.h"
+#include "gpy2xx_regmap.h"
 
 struct gpy211_device phy;
 struct gpy2xx_mdio mdio;
@@ -116,7304 +126,9576 @@ static int copy_key_to_dst(char *key_adr_str, u8 size, char *key_adr_ptr)
 	return 0;
 }
 
+static unsigned int t_olower(u32 ch)
+{
+	if (ch >= 'A' && ch <= 'Z')
+		return ch + 'a' - 'A';
+
+	return ch;
+}
+
+static unsigned int xstrncasecmp(const char *s1, const char *s2, unsigned int n)
+{
+	int c1, c2;
+
+	if (!s1 || !s2) return 1;
+
+	for (; n > 0; s1++, s2++, --n) {
+		c1 = t_olower(*s1);
+		c2 = t_olower(*s2);
+
+		if (c1 != c2) {
+			return (c1 - c2);
+		} else if (c1 == '\0') {
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+unsigned uart_hang = 1;
+
+char *var_list[MAX_PARAM];
+char *param_list1[MAX_PARAM];
+
+int system_restart = 0;
+
+unsigned int str_to_hex(unsigned char *str)
+{
+	unsigned int n = 0;
+	int i = 0;
+
+	if (!str)
+		return 0;
+
+	if (str[0] == 0)
+		return 0;
+
+	while (str[i]) {
+		n = n * 16;
+
+		if (('0' <= str[i] && str[i] <= '9')) {
+			n += str[i] - '0';
+		} else if (('A' <= str[i] && str[i] <= 'F')) {
+			n += str[i] - 'A' + 10;
+			;
+		} else if (('a' <= str[i] && str[i] <= 'f')) {
+			n += str[i] - 'a' + 10;
+			;
+		} else
+			printf("Wrong value:%u\n", str[i]);
+
+		i++;
+	}
+
+	return n;
+}
+
+static inline unsigned int hex2int(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (unsigned int)(c - '0');
+	else
+		return (unsigned int)(c - 'a' + 10);
+}
+
+#define UNIX_EPOCH 1970
+int dayofweek(int d, int m, int y)
+{
+	char day;
+	static int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+
+	y -= m < 3;
+	day = (y + y/4 - y/100 + y/400 + t[m-1] + d) % 7;
+
+	//If leap year it will be the remainder-1
+	if (y % 4 == 0)
+		day -= 1;
+
+	return day;
+}
+
+static int print_sys_time(u32 sec, u32 nsec)
+{
+	int year,act_leap = 0,  leap_days = 0, act_mnum, mnum = 0, act_day, day, hour, minute, is_leap = UNIX_EPOCH;
+	char *monName = "January";
+	//PTP Unix time starts from 1st Jan 1970, Thirsday
+	char *dayName[] = {"Thursday", "Friday", "Saturday", "Sunday", "Monday", "Tuesday", "Wednesday"};
+	char *weekDay;
+
+	minute = sec / 60;
+	sec = sec % 60;
+
+	hour = minute / 60;
+	minute = minute % 60;
+
+	day = act_day = hour / 24;
+	weekDay = dayName[day % 7];
+	hour = hour % 24;
+
+	year  = day / 365;
+	//printf("\n\tYrs %d days %d hours %d mins %d secs %d\n", year, day, hour, minute, sec);
+
+	while ((is_leap < (UNIX_EPOCH + year))) {
+		if (is_leap % 4 == 0)
+			act_leap++;
+		is_leap++;
+	};
+	//printf("\n\tLeap days %d\n", act_leap);
+
+	year = (act_day - act_leap) / 365;
+	act_day -= act_leap;
+	day = act_day % 365;
+	mnum = act_mnum = day / 30;
+	//printf("\n\tAct yrs %d, act days %d\n", year, act_day);
+
+	leap_days = 0;
+	is_leap = UNIX_EPOCH;
+	while ((is_leap < (UNIX_EPOCH + year))) {
+		if (is_leap % 4 == 0)
+			leap_days++;
+		is_leap++;
+	};
+
+	//day += (((act_leap == leap_days) ? 0 : 1) + 1); //+1 for the current day
+	day += ((act_leap - leap_days) + 1); //+1 for the current day
+	//printf("\n\tAct yrs %d leap days %d days %d month num %d\n", year, leap_days, day, mnum);
+
+	switch (act_mnum) {
+	case 1:
+		if (day > 31) {
+			monName = "February";
+			mnum += 1;
+			day -= 31;
+		}
+	break;
+	case 2:
+	case 3:
+		monName = "March";
+		if (day > 90) {
+			monName = "April";
+			mnum += 1;
+			day -= 90;
+		} else
+			day -= 59;
+	break;
+	case 4:
+		monName = "April";
+		if (day > 120) {
+			monName = "May";
+			mnum += 1;
+			day -= 120;
+		} else
+			day -= 90;
+	break;
+	case 5:
+		monName = "May";
+		if (day > 151) {
+			monName = "June";
+			mnum += 1;
+			day -= 151;
+		} else
+			day -= 120;
+	break;
+	case 6:
+		monName = "June";
+		if (day > 181) {
+			monName = "July";
+			mnum += 1;
+			day -= 181;
+		} else
+			day -= 151;
+	break;
+	case 7:
+		monName = "July";
+		if (day > 212) {
+			monName = "August";
+			mnum += 1;
+			day -= 212;
+		} else
+			day -= 181;
+	break;
+	case 8:
+		monName = "August";
+		if (day > 243) {
+			monName = "September";
+			mnum += 1;
+			day -= 243;
+		} else
+			day -= 212;
+	break;
+	case 9:
+		monName = "September";
+		if (day > 273) {
+			monName = "October";
+			mnum += 1;
+			day -= 273;
+		} else
+			day -= 243;
+	break;
+	case 10:
+		monName = "October";
+		if (day > 304) {
+			monName = "November";
+			mnum += 1;
+			day -= 304;
+		} else
+			day -= 273;
+	break;
+	case 11:
+		monName = "November";
+		if (day > 334) {
+			monName = "December";
+			mnum += 1;
+			day -= 334;
+		} else
+			day -= 304;
+	break;
+	case 12:
+		monName = "December";
+		day -= 334;
+	break;
+	default:
+	break;
+	}
+
+	//If the current year is leap and beyond feb?
+	if (((UNIX_EPOCH + year) % 4 == 0) && (act_mnum > 1)) {
+		//printf("\n\tThe current year %d is leap", (UNIX_EPOCH + year));
+		day -= 1;
+	}
+
+	//printf("\n\tYr %d day %d mon %d\n", (UNIX_EPOCH + year), day, mnum);
+	printf("\n\tUnix system time: %s %s %d %d %02d:%02d:%02d GMT\n", weekDay, monName, day, (UNIX_EPOCH + year), hour, minute, sec);
+	return 0;
+}
+
+
+/* name=value index of the command line being dispatched */
+static struct {
+	char **argv;
+	int argc;
+	int nr;
+	struct arg_ent {
+		const char *name;
+		size_t len;
+		char *val;
+		int pos;
+	} ent[MAX_PARAM + 3];
+} arg_idx;
+
+static int arg_ent_cmp(const void *a, const void *b)
+{
+	const struct arg_ent *x = a, *y = b;
+	int d = strncasecmp(x->name, y->name, x->len < y->len ? x->len : y->len);
+
+	if (d == 0)
+		d = (int)x->len - (int)y->len;
+
+	/* First occurrence wins, like the linear scan */
+	return d != 0 ? d : x->pos - y->pos;
+}
+
+/* Parse all name=value arguments once, findArgParam() then uses bsearch */
+static void arg_index_build(int argc, char *argv[])
+{
+	char *eq;
+	int i;
+
+	arg_idx.nr = 0;
+
+	for (i = 0; i < argc && arg_idx.nr < (int)ARRAY_SIZE(arg_idx.ent); i++) {
+		eq = strchr(argv[i], '=');
+		if (eq == NULL || eq == argv[i] || eq[1] == 0)
+			continue;
+
+		arg_idx.ent[arg_idx.nr].name = argv[i];
+		arg_idx.ent[arg_idx.nr].len = eq - argv[i];
+		arg_idx.ent[arg_idx.nr].val = eq + 1;
+		arg_idx.ent[arg_idx.nr].pos = i;
+		arg_idx.nr++;
+	}
+
+	qsort(arg_idx.ent, arg_idx.nr, sizeof(arg_idx.ent[0]), arg_ent_cmp);
+	arg_idx.argv = argv;
+	arg_idx.argc = argc;
+}
+
+static void arg_index_clear(void)
+{
+	arg_idx.argv = NULL;
+}
+
+static char *findArgParam(int argc, char *argv[], char *name)
+{
+	int i = 0;
+	size_t len;
+
+	len = strlen(name);
+
+	if (arg_idx.argv == argv && arg_idx.argc == argc) {
+		/* pos -1 sorts before any real argument of the same name */
+		struct arg_ent key = { name, len, NULL, -1 };
+		int lo = 0, hi = arg_idx.nr, mid;
+
+		while (lo < hi) {
+			mid = (lo + hi) / 2;
+
+			if (arg_ent_cmp(&arg_idx.ent[mid], &key) < 0)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		if (lo < arg_idx.nr && arg_idx.ent[lo].len == len
+		    && strncasecmp(arg_idx.ent[lo].name, name, len) == 0)
+			return arg_idx.ent[lo].val;
+
+		return NULL;
+	}
+
+	for (i = 0; i < argc; i++) {
+		if (xstrncasecmp(name, argv[i], len) == 0) {
+			if (strlen(argv[i]) > (len + 1)) {
+
+				if ('=' == argv[i][len]) {
+					return argv[i] + len + 1;
+				}
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* Parse a number or one of the boolean words, 0 if ptr is not a value */
+static int parse_num(char *ptr, unsigned long long int *val)
+{
+	char *endptr;
+
+	/* check if the given parameter value are the boolean "LTQ_TRUE" / "LTQ_FALSE" */
+
+	if (0 == xstrncasecmp(ptr, "LTQ_TRUE", strlen(ptr))
+	    || 0 == xstrncasecmp(ptr, "TRUE", strlen(ptr))
+	    || 0 == xstrncasecmp(ptr, "FULL", strlen(ptr))) {
+		*val = 1;
+	} else if (0 == xstrncasecmp(ptr, "LTQ_FALSE", strlen(ptr))
+		   || 0 == xstrncasecmp(ptr, "FALSE", strlen(ptr))
+		   || 0 == xstrncasecmp(ptr, "HALF", strlen(ptr))) {
+		*val = 0;
+	} else {
+		/* scan for a number */
+		*val = strtoull(ptr, &endptr, 0);
+
+		/* parameter detection does not work in case there are more character after the provided number */
+		if (*endptr != '\0')
+			return 0;
+	}
+
+	return 1;
+}
+
+/* Store val into a field of size bytes */
+static void store_num(unsigned long long int val, unsigned int size, void *param)
+{
+	if (size == 1)
+		*((char *)param) = (char)val;
+	else if (size == 2)
+		*((short *)param) = (short)val;
+	else if (size == 4)
+		*((int *)param) = (int)val;
+	else if (size == 8)
+		*((long long *)param) = (long long)val;
+}
+
+int scanParamArg(int argc, char *argv[], char *name, int size, void *param)
+{
+	unsigned long long int tmp;
+
+	char *ptr = findArgParam(argc, argv, name);
+
+	if (ptr == NULL) return 0;
+
+	if (!parse_num(ptr, &tmp))
+		return 0;
+
+	/* size is in bytes up to 4, in bits beyond */
+	store_num(tmp, size <= 4 ? size : size / 8, param);
+
+	return 1;
+}
+
+int scanMAC_Arg(int argc, char *argv[], char *name, unsigned char *param)
+{
+	char *ptr = findArgParam(argc, argv, name);
+
+	if (ptr == NULL) return 0;
+
+	return convert_mac_adr_str(ptr, param);
+}
+
+int scanKey_Arg(int argc, char *argv[], char *name, u8 size, char *param)
+{
+	char *ptr = findArgParam(argc, argv, name);
+
+	if (ptr == NULL) return 0;
+
+	return copy_key_to_dst(ptr, size, param);
+}
+
 static struct {
-	const char *cmd;
-	const char *brief;
-	const char *desc;
-} help_text[] = {
-	{
-		"exit",
-		"Exit GPY211 utility tool",
-		NULL
-	},
-	{
-		"help",
-		"Print this help page",
-		NULL
-	},
-	{
-		"en_debug",
-		"Enable debugging codes",
-		"en_debug <option>\n"
-		"  option: 0 - disable, 1 -enable\n"
-	},
-	{
-		"gpy2xx_init",
-		"Initialize GPY211 API",
-		NULL
-	},
-	{
-		"gpy2xx_uninit",
-		"Clean up GPY211 API",
-		NULL
-	},
-	{
-		"gpy2xx_get_phy_id",
-		"Read PHY/Chip/Firmware/Driver version number",
-		NULL
-	},
-	{
-		"gpy2xx_soft_reset",
-		"Trigger soft reset via MDIO STD_CTRL",
-		NULL
-	},
-	{
-		"gpy2xx_poll_reset",
-		"Poll soft reset status",
-		NULL
-	},
-#if defined(EN_SMDIO_RW) && EN_SMDIO_RW
-	{
-		"smdio_read",
-		"Read internal register (may be disabled by PHY firmware)",
-		"smdio_read <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"smdio_write",
-		"Write internal register (may be disabled by PHY firmware)",
-		"smdio_write <regaddr=?> <data=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-#endif
-	{
-		"gpy2xx_read",
-		"Read MDIO Clause 22 registers",
-		"gpy2xx_read <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_write",
-		"Write MDIO Clause 22 registers",
-		"gpy2xx_write <regaddr=?> <data=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_read_mmd",
-		"Read MDIO Clause 45 MMD registers",
-		"gpy2xx_read_mmd <devtype=?> <regaddr=?>\n"
-		"  devtype: MMD device type\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_write_mmd",
-		"Write MDIO Clause 45 MMD registers",
-		"gpy2xx_write_mmd <devtype=?> <regaddr=?> <data=?>\n"
-		"  devtype: MMD device type\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-#if defined(P31G_IND_RW) && P31G_IND_RW
-	{
-		"pm_ind_read",
-		"PM's indirect register read",
-		"pm_ind_read <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"pm_ind_write",
-		"PM's indirect register write",
-		"pm_ind_write <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-#endif
-	{
-		"gpy2xx_mbox_read16",
-		"PHY's Mbox 16-bit wide register read",
-		"gpy2xx_mbox_read16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_mbox_write16",
-		"PHY's Mbox 16-bit wide register write",
-		"gpy2xx_mbox_write16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_mbox_read32",
-		"PHY's Mbox 32-bit wide register read",
-		"gpy2xx_mbox_read32 <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_mbox_write32",
-		"PHY's Mbox 32-bit wide register write",
-		"gpy2xx_mbox_write32 <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_xpcs_read16",
-		"PHY's XPCS 16-bit wide register read",
-		"gpy2xx_xpcs_read16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_xpcs_write16",
-		"PHY's XPCS 16-bit wide register write",
-		"gpy2xx_xpcs_write16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_config_advert",
-		"Advertise auto-negotiation parameters",
-		"gpy2xx_config_advert <advertising=?>\n"
-		"  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n"
-		"               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n"
-		"               Autoneg|Pause|Asym_Pause\n"
-	},
-	{
-		"gpy2xx_setup_forced",
-		"Configures/forces speed/duplex",
-		"gpy2xx_setup_forced <speed=?> <duplex=?> <pause=?> <asym_pause=?> <mstr_slave=?>\n"
-		"  speed:      10/100/1000/2500\n"
-		"  duplex:     full/half\n"
-		"  pause:      true/false\n"
-		"  asym_pause: true/false\n"
-		"  mstr_slave: true/false\n"
-	},
-	{
-		"gpy2xx_restart_aneg",
-		"Enable and restart auto-negotiation",
-		NULL
-	},
-	{
-		"gpy2xx_config_aneg",
-		"Restart auto-negotiation or force link",
-		"gpy2xx_config_aneg <autoneg=?> [advertising=?] [<speed=?> <duplex=?> <pause=?> <asym_pause=?>]\n"
-		"  autoneg:     true/false\n"
-		"  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n"
-		"               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n"
-		"               Autoneg|Pause|Asym_Pause\n"
-		"  speed:       10/100/1000/2500\n"
-		"  duplex:      full/half\n"
-		"  pause:       true/false\n"
-		"  asym_pause:  true/false\n"
-	},
-	{
-		"gpy2xx_aneg_done",
-		"Get auto-negotiation status",
-		NULL
-	},
-	{
-		"gpy2xx_update_link",
-		"Get link status (up/down)",
-		NULL
-	},
-	{
-		"gpy2xx_read_status",
-		"Get link status (detail)",
-		NULL
-	},
-	{
-		"gpy2xx_read_fw_info",
-		"Get FW info (detail)",
-		NULL
-	},
-	{
-		"gpy2xx_gpio_cfg",
-		"Configure GPIO pin",
-		"For internal use.\n"
-		"gpy2xx_gpio_cfg <pinid=?> <gpioflags=?>\n"
-		"  pinid:     16-bit pin ID\n"
-		"  gpioflags: GPIO configuration flags\n"
-	},
-	{
-		"gpy2xx_gpio_get",
-		"Get GPIO pin configuration",
-		"For internal use.\n"
-		"gpy2xx_gpio_get <pinid=?>\n"
-		"  pinid:     16-bit pin ID\n"
-	},
-	{
-		"gpy2xx_gpio_output",
-		"Configure GPIO pin output value (low/high)",
-		"For internal use.\n"
-		"gpy2xx_gpio_output <pinid=?> <gpioflags=?>\n"
-		"  pinid:     16-bit pin ID\n"
-		"  gpioflags: 0 - low, 2 - high\n"
-	},
-	{
-		"gpy2xx_gpio_input",
-		"Get GPIO pin input value (low/high)",
-		"For internal use.\n"
-		"gpy2xx_gpio_input <pinid=?>\n"
-		"  pinid:     16-bit pin ID\n"
-	},
-	{
-		"gpy2xx_led_br_cfg",
-		"Configure LED brightness",
-		"For internal use.\n"
-		"gpy2xx_led_br_cfg <brightMode=?> <brightlvlMin=?> <brightlvlMax=?> <swEdgeDetect=?>\n"
-		"  brightMode: 0 - constant level at max brightness\n"
-		"              1 - constant level given by brightlvlmax\n"
-		"  brightlvlMin: (0 to 15) - min level of brightness\n"
-		"  brightlvlMax: (0 to 15) - max level of brightness\n"
-		"  swEdgeDetect: 0 - LED switch edge detection on falling edge\n"
-		"				 1 - LED switch edge detection on rising edge\n"
-	},
-	{
-		"gpy2xx_led_br_get",
-		"Get LED brightness configuration",
-		"For internal use.\n"
-	},
-#if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
-	{
-		"gpy2xx_led_top_cfg",
-		"LED general configuration",
-		"For internal use.\n"
-		"gpy2xx_led_top_cfg <complexscan=?> <complexblink=?> <inversescan=?> <fastblinkfreq=?> <slowblinkfreq=?>\n"
-		"  complexscan:  in which state the 'inverse complex SCAN' is activated, refer to below state table\n"
-		"  complexblink: in which state the 'complex blinking' is activated, refer to below state table\n"
-		"  inversescan:  in which state the 'complex SCAN' is activated, refer to below state table\n"
-		"  fastblinkfreq:the slow-blinking frequency, refer to below frequency table\n"
-		"  slowblinkfreq:the fast-blinking frequency, refer to below frequency table\n"
-		"state table\n"
-		"	0 - disable\n"
-		"	1 - Link is UP\n"
-		"	2 - Device is in power down\n"
-		"	3 - Device is in EEE mode\n"
-		"	4 - ANEG is running\n"
-		"	5 - ABIST is running\n"
-		"	6 - CDIAG is running\n"
-		"	7 - TEST mode is running\n"
-		"frequency table\n"
-		"	0 - 2 Hz blinking frequency\n"
-		"	1 - 4 Hz blinking frequency\n"
-		"	2 - 8 Hz blinking frequency\n"
-		"	3 - 16 Hz blinking frequency\n"
-	},
-	{
-		"gpy2xx_led_top_get",
-		"Get LED general configuration",
-		"For internal use.\n"
-	},
+	const char *name;
+	enum link_mode_bit_indices bit;
+} phy_advert[] = {
+	{"10baseT_Half", LINK_MODE_10baseT_Half_BIT},
+	{"10baseT_Full", LINK_MODE_10baseT_Full_BIT},
+	{"100baseT_Half", LINK_MODE_100baseT_Half_BIT},
+	{"100baseT_Full", LINK_MODE_100baseT_Full_BIT},
+	{"1000baseT_Half", LINK_MODE_1000baseT_Half_BIT},
+	{"1000baseT_Full", LINK_MODE_1000baseT_Full_BIT},
+	{"2500baseT_Full", LINK_MODE_2500baseT_Full_BIT},
+	{"2500baseT_FR", LINK_MODE_2500baseT_FR_BIT},
+	{"5000baseT_Full", LINK_MODE_5000baseT_Full_BIT},
+	{"5000baseT_FR", LINK_MODE_5000baseT_FR_BIT},
+	{"Autoneg", LINK_MODE_Autoneg_BIT},
+	{"Pause", LINK_MODE_Pause_BIT},
+	{"Asym_Pause", LINK_MODE_Asym_Pause_BIT},
+};
+
+/* Parse link mode names separated by '|', ',' or ';', p is modified */
+static void parse_advert(char *p, u64 *param)
+{
+	char *p1, *p2;
+	unsigned int i;
+
+	*param = 0;
+
+	for (p1 = p; *p1 != 0; p1 = p2) {
+		for (p2 = p1; *p2 != 0 && *p2 != ',' && *p2 != '|' && *p2 != ';'; p2++);
+
+		if (*p2 != 0) {
+			*p2 = 0;
+			p2++;
+		}
+
+		if (*p1 == 0)
+			continue;
+
+		for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
+			if (strcasecmp(p1, phy_advert[i].name) == 0) {
+				*param |= (u64)1 << phy_advert[i].bit;
+				break;
+			}
+		}
+	}
+}
+
+static int print_advert(char *buf, unsigned int size, u64 param)
+{
+	char *p = buf;
+	unsigned int flag = 0;
+	unsigned int total_len = 0;
+	unsigned int len;
+	unsigned int i;
+
+	strncpy(buf, "none", size);
+	buf[size - 1] = 0;
+
+	for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
+		if ((param & ((u64)1 << phy_advert[i].bit))) {
+			len = strlen(phy_advert[i].name);
+
+			if (flag == 0) {
+				if (total_len + len + 1 >= size)
+					break;
+
+				flag++;
+			} else {
+				if (total_len + len + 4 >= size)
+					break;
+
+				p[0] = ' ';
+				p[1] = '|';
+				p[2] = ' ';
+				p += 3;
+				total_len += 3;
+			}
+
+			strcpy(p, phy_advert[i].name);
+			p += len;
+			total_len += len;
+		}
+	}
+
+	return (int)total_len;
+}
+
+/*
+ * Command parameter schemas. Each command lists its name=value parameters
+ * with the type and the offset of the field they fill; cli_parse() walks
+ * argv once and stores every known parameter into the handler's struct.
+ * The same table generates the command synopsis printed by help.
+ */
+enum cli_ptype {
+	CLI_P_NUM,	/* number, TRUE/FALSE or FULL/HALF */
+	CLI_P_MAC,	/* xx:xx:xx:xx:xx:xx */
+	CLI_P_KEY,	/* hex string of exactly size bytes */
+	CLI_P_AESKEY,	/* hex string of 16 or 32 bytes */
+	CLI_P_ADVERT,	/* link modes separated by '|', ',' or ';' */
+	CLI_P_STR,	/* pointer to the value in argv */
+};
+
+struct cli_param {
+	const char *name;
+	u8 type;
+	u8 has_def;
+	u16 size;
+	u32 offset;
+	long long def;
+};
+
+#define CLI_FIELD_SIZE(type, field)	sizeof(((type *)0)->field)
+#define CLI_PARAM(t, type, field, name, has_def, def) \
+	{ name, t, has_def, CLI_FIELD_SIZE(type, field), offsetof(type, field), def }
+
+#define CLI_NUM(type, field, name)	CLI_PARAM(CLI_P_NUM, type, field, name, 0, 0)
+#define CLI_NUM_DEF(type, field, name, def) \
+	CLI_PARAM(CLI_P_NUM, type, field, name, 1, def)
+#define CLI_MAC(type, field, name)	CLI_PARAM(CLI_P_MAC, type, field, name, 0, 0)
+#define CLI_KEY(type, field, name)	CLI_PARAM(CLI_P_KEY, type, field, name, 0, 0)
+#define CLI_AESKEY(type, field, name)	CLI_PARAM(CLI_P_AESKEY, type, field, name, 0, 0)
+#define CLI_ADVERT(type, field, name)	CLI_PARAM(CLI_P_ADVERT, type, field, name, 0, 0)
+#define CLI_STR(type, field, name)	CLI_PARAM(CLI_P_STR, type, field, name, 0, 0)
+/* The handler passes a single variable of the given type */
+#define CLI_VAL(type, name)		{ name, CLI_P_NUM, 0, sizeof(type), 0, 0 }
+#define CLI_PARAM_END			{ NULL }
+
+static const struct cli_param cli_p_gpy2xx_abist_start[] = {
+	CLI_NUM(struct gpy211_abist_param, restart, "enRestart"),
+	CLI_NUM(struct gpy211_abist_param, uart_report, "enUartReport"),
+	CLI_NUM(struct gpy211_abist_param, test, "txTestMode"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ads_cfg[] = {
+	CLI_NUM(struct gpy211_ads_ctrl, no_nrg_rst, "advertise_enable"),
+	CLI_NUM(struct gpy211_ads_ctrl, downshift_en, "NBaseT_ds_enable"),
+	CLI_NUM(struct gpy211_ads_ctrl, downshift_thr, "downshift_cnt_thr"),
+	CLI_NUM(struct gpy211_ads_ctrl, force_rst, "force_reset"),
+	CLI_NUM(struct gpy211_ads_ctrl, nrg_rst_cnt, "rst_cntdown_timer"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_config_advert[] = {
+	CLI_ADVERT(struct gpy211_device, link.advertising, "advertising"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_config_aneg[] = {
+	CLI_NUM_DEF(struct gpy211_device, link.autoneg, "autoneg", 1),
+	CLI_ADVERT(struct gpy211_device, link.advertising, "advertising"),
+	CLI_NUM_DEF(struct gpy211_device, link.speed, "speed", SPEED_2500),
+	CLI_NUM_DEF(struct gpy211_device, link.duplex, "duplex", DUPLEX_FULL),
+	CLI_NUM_DEF(struct gpy211_device, link.pause, "pause", 1),
+	CLI_NUM_DEF(struct gpy211_device, link.asym_pause, "asym_pause", 1),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_errcnt_cfg[] = {
+	CLI_VAL(enum gpy211_errcnt_event, "errCountMode"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_extin_clr[] = {
+	CLI_NUM(struct gpy211_phy_extin, std_istat, "stdIstat"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_extin_clr NULL
 #endif
-	{
-		"gpy2xx_led_if_cfg",
-		"Configure LED",
-		"gpy2xx_led_if_cfg <ledid=?> <colormode=?> <slowblinksrc=?> <fastblinksrc=?> <constantlyon=?> <pulseflags=?>\n"
-		"  ledid:        0~3\n"
-		"  colormode:    internal use\n"
-		"  slowblinksrc: event to trigger slow blink, refer to below trigger table\n"
-		"  fastblinksrc: event to trigger fast blink, refer to below trigger table\n"
-		"  constantlyon: event to trigger constant on, refer to below trigger table\n"
-		"  pulseflags:   pulse on LED trigger by combination of following events\n"
-		"                1 - transmit activity\n"
-		"                2 - receive activity\n"
-		"                4 - collision\n"
-		"Trigger Table\n"
-		"   0 - disable\n"
-		"   1 - 10Mbps\n"
-		"   2 - 100Mbps\n"
-		"   4 - 1000Mbps\n"
-		"   8 - 2500Mbps link\n"
-	},
-	{
-		"gpy2xx_led_if_get",
-		"Get LED configuration",
-		"gpy2xx_led_if_get <ledid=?>\n"
-		"  ledid:        0~3\n"
-	},
-#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
-	{
-		"gpy2xx_topin_cfg",
-		"Configure external interrupt",
-		"For internal use."
-	},
-	{
-		"gpy2xx_topin_get",
-		"Get external interrupt configuration",
-		"For internal use.\n"
-	},
-	{
-		"gpy2xx_topin_clr",
-		"Clear external interrupt events",
-		"For internal use.\n"
-	},
-#endif /* EN_SUPPORT_TOP_INT */
-	{
-		"gpy2xx_extin_mask",
-		"Enable/disable external interrupt event",
-		"gpy2xx_extin_mask <stdImask=?> <extImask=?>\n"
-		"  stdImask:  	0x0001 - link state change\n"
-		"               0x0002 - link speed change\n"
-		"               0x0004 - duplex mode change\n"
-		"               0x0008 - MDI/MDIX crossover change\n"
-		"               0x0010 - MDI polarity change\n"
-		"               0x0020 - link's auto-downspeed change\n"
-		"               0x0100 - SyncE lost of reference clock\n"
-		"               0x0200 - mailbox transaction complete\n"
-		"               0x0400 - auto-negotiation complete\n"
-		"               0x0800 - auto-negotiation error\n"
-		"               0x1000 - next page transmitted\n"
-		"               0x2000 - next page received\n"
-		"               0x4000 - master/slave resolution error\n"
-		"               0x8000 - wake-on-lan event\n"
-		"  extImask:	0x0002 - LPI interrupt\n"
-		"				0x0008 - time stamp FIFO interrupt\n"
-		"				0x0010 - MACSEC egress/ingress Interrupt\n"
-	},
-	{
-		"gpy2xx_extin_get",
-		"Get external interrupt event mask",
-		NULL
-	},
+
+static const struct cli_param cli_p_gpy2xx_extin_mask[] = {
+	CLI_NUM(struct gpy211_phy_extin, std_imask, "stdImask"),
+	CLI_NUM(struct gpy211_phy_extin, ext_imask, "extImask"),
+	CLI_PARAM_END
+};
+
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_extin_clr",
-		"Clear external interrupt event",
-		"gpy2xx_extin_clr <std_istat=?>\n"
-		"  std_istat:   0x0001 - link state change\n"
-		"               0x0002 - link speed change\n"
-		"               0x0004 - duplex mode change\n"
-		"               0x0008 - MDI/MDIX crossover change\n"
-		"               0x0020 - MDI polarity change\n"
-		"               0x0040 - link's auto-downspeed change\n"
-		"               0x0100 - SyncE lost of reference clock\n"
-		"               0x0200 - mailbox transaction complete\n"
-		"               0x0400 - auto-negotiation complete\n"
-		"               0x0800 - auto-negotiation error\n"
-		"               0x1000 - next page transmitted\n"
-		"               0x2000 - next page received\n"
-		"               0x4000 - master/slave resolution error\n"
-		"               0x8000 - wake-on-lan event\n"
-	},
+static const struct cli_param cli_p_gpy2xx_gmacf_cfg[] = {
+	CLI_NUM(struct gmac_cfg, re_en, "reEn"),
+	CLI_NUM(struct gmac_cfg, te_en, "teEn"),
+	CLI_NUM(struct gmac_cfg, preamble_len, "preambLen"),
+	CLI_NUM(struct gmac_cfg, loopback_en, "lbmEn"),
+	CLI_NUM(struct gmac_cfg, fulldup_en, "fdupEn"),
+	CLI_NUM(struct gmac_cfg, mac_speed, "macSpeed"),
+	CLI_NUM(struct gmac_cfg, rc_write1_en, "rcWrite1"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_cfg NULL
 #endif
-	{
-		"gpy2xx_test_mode_cfg",
-		"Set test mode",
-		"gpy2xx_test_mode_cfg <testtxmode=?>\n"
-		"  testtxmode: 0 - normal operation\n"
-		"              1 - Test Mode 1 (Transmit Waveform Test)\n"
-		"              2 - Test Mode 2 (Transmit Jitter Test in MASTER Mode)\n"
-		"              3 - Test Mode 3 (Transmit Jitter Test in SLAVE Mode)\n"
-		"              4 - Test Mode 4 (Transmitter Distortion Test)\n"
-	},
-	{
-		"gpy2xx_cdiag_start",
-		"Start cable diagnostic - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_cdiag_read",
-		"Read cable diagnostic result - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_cdiag_stop",
-		"Stop cable diagnostic test",
-		NULL
-	},
-	{
-		"gpy2xx_abist_start",
-		"Start analog self-test (ABIST) - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_abist_read",
-		"Read analog self-test (ABIST) result - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_loopback_cfg",
-		"Configure near/far end loopback",
-		"gpy2xx_loopback_cfg <loopbackmode=?>\n"
-		"  loopbackmode: 0 - disable test loop\n"
-		"                1 - GMII near end test loop\n"
-		"                2 - PCS far end test loop\n"
-		"                3 - DEC (Digital Echo Canceler) test loop\n"
-		"                4 - MDI (RJ45 near end) test loop\n"
-		"                5 - far end test loop\n"
-		"                8 - GMII near end test loop - LB=1\n"
-	},
-	{
-		"gpy2xx_errcnt_cfg",
-		"Configure errors/events to be counted",
-		"gpy2xx_errcnt_cfg <errcountmode=?>\n"
-		"  errcountmode: 0 - receive errors\n"
-		"                1 - receive frames\n"
-		"                2 - ESD errors\n"
-		"                3 - SSD errors\n"
-		"                4 - transmit errors\n"
-		"                5 - transmit frames\n"
-		"                6 - collision events\n"
-		"                8 - link down events\n"
-		"                9 - auto-downspeed events\n"
-	},
-	{
-		"gpy2xx_errcnt_read",
-		"Read error/event counter",
-		NULL
-	},
-	{
-		"gpy2xx_pcs_status_read",
-		"Get PCS status",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_adjfreq",
-		"Adjust frequency of hardware clock",
-		"gpy2xx_ptp_adjfreq <pbbTime=?>\n"
-		"  pbbTime: value\n"
-	},
-	{
-		"gpy2xx_ptp_adjtime",
-		"Adjust the system timestamp",
-		"gpy2xx_ptp_adjtime <deltaTime=?>\n"
-		"  deltaTime: 	value\n"
-	},
-	{
-		"gpy2xx_ptp_settime",
-		"Initialize the system timestamp",
-		"gpy2xx_ptp_settime <initSec=?> <initNsec=?>\n"
-		"  initSec: value\n"
-		"  initNsec:value\n"
-	},
-	{
-		"gpy2xx_ptp_set_tsctrl",
-		"Configures the timestamp control, second/sub-second increment value",
-		"gpy2xx_ptp_set_tsctrl <enEvntMsg=?> <enMstrMsg=?> <snapType=? <gpcSel=?>\n"
-		"  enEvntMsg:  	dis/en\n"
-		"  enMstrMsg: 	dis/en\n"
-		"  snapType: 	value\n"
-		"  gpcSel: 	value\n"
-	},
-	{
-		"gpy2xx_ptp_set_ppsctrl",
-		"Configures the timestamp PPS control params",
-		"gpy2xx_ptp_set_ppsctrl <ppsCtrlLow=?> <targetSec=?> <targetNsc=?> <ppsInterval=?> <ppsWidth=?>\n"
-		"  ppsCtrlLow: 	value\n"
-		"  targetSec:  	value\n"
-		"  targetNsc: 	value\n"
-		"  ppsInterval:	value\n"
-		"  ppsWidth: 	value\n"
-	},
-	{
-		"gpy2xx_ptp_set_ptoctrl",
-		"Configures the timestamp PTO control params",
-		"gpy2xx_ptp_set_ptoctrl <ptoCtrlLow=?> <srcPortID=?> <logmLvlLow=?> <logmLvlHi=?>\n"
-		"  ptoCtrlLow: 	value\n"
-		"  srcPortID:  	value\n"
-		"  logmLvlLow: 	value\n"
-		"  logmLvlHi:	value\n"
-	},
-	{
-		"gpy2xx_ptp_gettime",
-		"Provides the system timestamp",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_enable",
-		"Enable and configure PTP (1588) function",
-		"gpy2xx_ptp_enable <enPhyTxTs=?> <enPhyRxTs=?> <enTxOstCor=?> <txPtpOffset=?> <txPtpProto=?> <txOstCorTime=?>\n"
-		"  enPhyTxTs: 	 value\n"
-		"  enPhyRxTs: 	 value\n"
-		"  enTxOstCor: 	 value\n"
-		"  txPtpOffset:  value\n"
-		"  txPtpProto: 	 value\n"
-		"  txOstCorTime: value\n"
-	},
-	{
-		"gpy2xx_ptp_disable",
-		"Disable and configure PTP (1588) function",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_getcfg",
-		"Get PTP (1588) configuration",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_fifostat",
-		"Get timestamp FIFO status",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_resetfifo",
-		"Resets the timestamp FIFO status",
-		NULL
-	},
+
+struct cli_count_acc_args {
+	u32 interval;
+	u32 count;
+	u32 freeze;
+};
+
+static const struct cli_param cli_p_gpy2xx_gmacf_count_acc[] = {
+	CLI_NUM(struct cli_count_acc_args, interval, "interval"),
+	CLI_NUM_DEF(struct cli_count_acc_args, count, "count", 1),
+	CLI_NUM(struct cli_count_acc_args, freeze, "freeze"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gmacf_count_ctrl_cfg[] = {
+	CLI_NUM(struct gmacf_counter_ctrl, reset_counters, "rstCnt"),
+	CLI_NUM(struct gmacf_counter_ctrl, stop_rollover, "stopRoll"),
+	CLI_NUM(struct gmacf_counter_ctrl, clear_on_read, "conRead"),
+	CLI_NUM(struct gmacf_counter_ctrl, freeze_counters, "frzCnt"),
+	CLI_NUM(struct gmacf_counter_ctrl, preset_counters, "pstCnt"),
+	CLI_NUM(struct gmacf_counter_ctrl, preset_half_full, "psthFull"),
+	CLI_NUM(struct gmacf_counter_ctrl, count_dropped_bc, "cntbcDrop"),
+	CLI_PARAM_END
+};
+
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_ptp_txtsstat",
-		"Get Tx timestamp status",
-		NULL
-	},
+static const struct cli_param cli_p_gpy2xx_gmacf_count_imask_cfg[] = {
+	CLI_NUM(struct counter_imask, tx_good_bad_im, "txGb"),
+	CLI_NUM(struct counter_imask, tx_uflow_err_im, "txUflow"),
+	CLI_NUM(struct counter_imask, tx_good_im, "txGood"),
+	CLI_NUM(struct counter_imask, tx_osize_good_im, "txOsize"),
+	CLI_NUM(struct counter_imask, rx_good_bad_im, "rxGb"),
+	CLI_NUM(struct counter_imask, rx_crc_err_im, "rxCrc"),
+	CLI_NUM(struct counter_imask, rx_usize_good_im, "rxUsize"),
+	CLI_NUM(struct counter_imask, rx_osize_good_im, "rxOsize"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_count_imask_cfg NULL
 #endif
-	{
-		"gpy2xx_ptp_getrxts",
-		"Get RX packet timestamp status and CRC",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_gettxts",
-		"Get TX packet timestamp and CRC status and CRC",
-		NULL
-	},
-	{
-		"gpy2xx_synce_cfg",
-		"Configure SyncE function",
-		"gpy2xx_synce_cfg <enSyncE=?> <synceRefClk=?> <masterSlave=?> <dataRate=?> <gpcSel=?>\n"
-		"  enSyncE: 	0-disable,	  1-enable\n"
-		"  synceRefClk: 0-8KHz,   1-2.048MHz,	2-1.544MHz\n"
-		"  masterSlave:	0-slave mode, 1-master mode\n"
-		"  dataRate: 	0-1G,		  1-2.5G\n"
-		"  gpcSel:		0-GPC1,	1-GPC1,	2-GPC2\n"
-	},
-	{
-		"gpy2xx_synce_get",
-		"Get SyncE configuration",
-		NULL
-	},
-	{
-		"gpy2xx_wol_cfg",
-		"Configure Wake-On-Lan function",
-		"gpy2xx_wol_cfg <woloptions=?> <wolmac=?> <wolpassword=?>\n"
-		"  woloptions:  combination of following flags\n"
-		"               0x20 - wake up when receiving magic packet\n"
-		"               0x40 - password enabled\n"
-		"  wolmac:      6-byte MAC address of magic packet\n"
-		"  wolpassword: 6-byte password\n"
-	},
-	{
-		"gpy2xx_wol_get",
-		"Get Wake-On-Lan configuration",
-		NULL
-	},
-	{
-		"gpy2xx_ads_cfg",
-		"Configure Auto-Down-Speed",
-		"gpy2xx_ads_cfg [<advertise_enable=?>] [<NBaseT_ds_enable=?>] [<downshift_cnt_thr=?>] [<force_reset=?>] [<rst_cntdown_timer=?>]\n"
-		"advertise_enable:  0 Disable / 1 Enable\n"
-		"NBaseT_ds_enable:  0 Disable / 1 Enable\n"
-		"downshift_cnt_thr: value (5bits)\n"
-		"force_reset:       0/1\n"
-		"rst_cntdown_timer: value (8bits)\n"
-	},
-	{
-		"gpy2xx_ads_get",
-		"Get Auto-Down-Speed",
-		NULL
-	},
-	{
-		"gpy2xx_ulp_cfg",
-		"Configure Ultra Low Power",
-		"gpy2xx_ulp_cfg [<ulp_enable=?>] [<ulp_sta_block=?>]\n"
-		"ulp_enable:  0 Disable / 1 Enable\n"
-		"ulp_sta_block:  0 Disable / 1 Enable\n"
-		"ulp_exit:  0 Not Exit / 1 Exit ULP\n"
-		"master_slice:  Slice to become master <0 to 3>\n"
-	},
-	{
-		"gpy2xx_ulp_get",
-		"Get Ultra Low Power",
-		NULL
-	},
-	{
-		"gpy2xx_ads_detected",
-		"Get auto-downspeed event",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_restart_aneg",
-		"Restart SGMII auto-negotiation",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_config_aneg",
-		"Configure SGMII auto-negotiation",
-		"gpy2xx_sgmii_config_aneg <linkcfg_dir=?> [<aneg_mode=?>] [<eee_enable=?>] [<autoneg=?>] [<speed=?>] [fixed2G5=?] [<duplex=?>]\n"
-		"  linkcfg_dir: 0 - SGMII_LINKCFG_TPI / 1 - SGMII_LINKCFG_SGMII\n"
-		"  aneg_mode:   1 - SGMII_ANEG_1000BX\n"
-		"               2 - SGMII_ANEG_CISCO_PHY\n"
-		"               3 - SGMII_ANEG_CISCO_MAC\n"
-		"  eee_enable:  0 - disable / 1 - enable\n"
-		"  autoneg:     0 - disable / 1 - enable\n"
-		"  speed:       10/100/1000/2500\n"
-		"  fixed2G5:    0 - TPI speed / 1 - force 2.5G\n"
-		"  duplex:      DUPLEX_FULL/DUPLEX_HALF\n"
-	},
-	{
-		"gpy2xx_sgmii_aneg_done",
-		"Check SGMII auto-negotiation status",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_read_status",
-		"Get SGMII link status (detail)",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_opmode",
-		"Configure SGMII operation mode",
-		"gpy211_sgmii_opmode <opMode=?>\n"
-		"  opMode: 0 - normal oeration\n"
-		"		   1 - power down\n"
-		"		   2 - loopback\n"
-		"		   3 - reset\n"
-	},
-	{
-		"gpy2xx_pvt_get",
-		"Get SENSOR temparature",
-		NULL
-	},
+
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacx_pm_hw_reset",
-		"Set PM lavel HW reset",
-		NULL
-	},
+static const struct cli_param cli_p_gpy2xx_gmacf_lpi_cfg[] = {
+	CLI_NUM(struct lpi_cfg, lpi_int_en, "lpintEn"),
+	CLI_NUM(struct lpi_cfg, lpi_en, "lpiEn"),
+	CLI_NUM(struct lpi_cfg, phy_link_status, "linkUp"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_auto, "txautoEn"),
+	CLI_NUM(struct lpi_cfg, lpi_timer_en, "timerEn"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_clk_stop_en, "clkStop"),
+	CLI_NUM(struct lpi_cfg, ous_tic_time, "ticTime"),
+	CLI_NUM(struct lpi_cfg, lpi_tw_time, "twTime"),
+	CLI_NUM(struct lpi_cfg, lpi_ls_time, "lsTime"),
+	CLI_NUM(struct lpi_cfg, lpi_entry_time, "entryTime"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_lpi_cfg NULL
+#endif
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_lpi_imask_cfg[] = {
+	CLI_NUM(struct lpi_int_mask, rx_lpi_usc_im, "rxUsc"),
+	CLI_NUM(struct lpi_int_mask, rx_lpi_tc_im, "rxTrc"),
+	CLI_NUM(struct lpi_int_mask, tx_lpi_usc_im, "txUsc"),
+	CLI_NUM(struct lpi_int_mask, tx_lpi_tc_im, "txTrc"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_lpi_imask_cfg NULL
+#endif
+
+static const struct cli_param cli_p_gpy2xx_gmacf_pkt_cfg[] = {
+	CLI_NUM(struct gmac_pkt_cfg, jumbo_en, "jumboEn"),
+	CLI_NUM(struct gmac_pkt_cfg, tx_jabber_dis, "jabberDis"),
+	CLI_NUM(struct gmac_pkt_cfg, watchdog_dis, "wdogDis"),
+	CLI_NUM(struct gmac_pkt_cfg, pad_crc_strip_en, "pcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, crc_strip_en, "crcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, support_2kp, "sup2kp"),
+	CLI_NUM(struct gmac_pkt_cfg, mac_ipg, "macIpg"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_pkt_filter_cfg[] = {
+	CLI_NUM(struct gmac_pktflt_cfg, promiscuous_en, "prEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_all_mc, "passAmc"),
+	CLI_NUM(struct gmac_pktflt_cfg, block_bc, "blockBc"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_ctrl_pkts, "passCtrl"),
+	CLI_NUM(struct gmac_pktflt_cfg, sa_filter_en, "safltrEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, rx_all_en, "rxAll"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_pkt_filter_cfg NULL
+#endif
+
+static const struct cli_param cli_p_gpy2xx_gmacf_pm_cfg[] = {
+	CLI_NUM(struct pm_gmac_cfg, crc_pad_ctrl, "crcPad"),
+	CLI_NUM(struct pm_gmac_cfg, tx_err_input, "txErr"),
+	CLI_NUM(struct pm_gmac_cfg, big_endian, "bigEndian"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_cfg[] = {
+	CLI_NUM(struct gmac_cfg, re_en, "reEn"),
+	CLI_NUM(struct gmac_cfg, te_en, "teEn"),
+	CLI_NUM(struct gmac_cfg, preamble_len, "preambLen"),
+	CLI_NUM(struct gmac_cfg, loopback_en, "lbmEn"),
+	CLI_NUM(struct gmac_cfg, fulldup_en, "fdupEn"),
+	CLI_NUM(struct gmac_cfg, mac_speed, "macSpeed"),
+	CLI_NUM(struct gmac_cfg, rc_write1_en, "rcWrite1"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_cfg NULL
+#endif
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_lpi_cfg[] = {
+	CLI_NUM(struct lpi_cfg, lpi_int_en, "lpintEn"),
+	CLI_NUM(struct lpi_cfg, lpi_en, "lpiEn"),
+	CLI_NUM(struct lpi_cfg, phy_link_status, "linkUp"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_auto, "txautoEn"),
+	CLI_NUM(struct lpi_cfg, lpi_timer_en, "timerEn"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_clk_stop_en, "clkStop"),
+	CLI_NUM(struct lpi_cfg, ous_tic_time, "ticTime"),
+	CLI_NUM(struct lpi_cfg, lpi_tw_time, "twTime"),
+	CLI_NUM(struct lpi_cfg, lpi_ls_time, "lsTime"),
+	CLI_NUM(struct lpi_cfg, lpi_entry_time, "entryTime"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_lpi_cfg NULL
+#endif
+
+static const struct cli_param cli_p_gpy2xx_gmacl_pause_cfg[] = {
+	CLI_NUM(struct pause_cfg, flow_ctrl_busy, "fcBusy"),
+	CLI_NUM(struct pause_cfg, pm_gmacl_fc, "gmaclFc"),
+	CLI_NUM(struct pause_cfg, tx_flow_ctrl, "txfcEn"),
+	CLI_NUM(struct pause_cfg, pause_low_thresh, "plThresh"),
+	CLI_NUM(struct pause_cfg, dis_zquanta_pause, "zqPause"),
+	CLI_NUM(struct pause_cfg, pause_time, "pauseTime"),
+	CLI_MAC(struct pause_cfg, tx_fc_mac, "pauseMac"),
+	CLI_NUM(struct pause_cfg, pause_assert_thresh, "paThresh"),
+	CLI_NUM(struct pause_cfg, pause_deassert_thresh, "pdThresh"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_pkt_cfg[] = {
+	CLI_NUM(struct gmac_pkt_cfg, jumbo_en, "jumboEn"),
+	CLI_NUM(struct gmac_pkt_cfg, tx_jabber_dis, "jabberDis"),
+	CLI_NUM(struct gmac_pkt_cfg, watchdog_dis, "wdogDis"),
+	CLI_NUM(struct gmac_pkt_cfg, pad_crc_strip_en, "pcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, crc_strip_en, "crcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, support_2kp, "sup2kp"),
+	CLI_NUM(struct gmac_pkt_cfg, mac_ipg, "macIpg"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_pkt_cfg NULL
+#endif
+
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_pkt_filter_cfg[] = {
+	CLI_NUM(struct gmac_pktflt_cfg, promiscuous_en, "prEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_all_mc, "passAmc"),
+	CLI_NUM(struct gmac_pktflt_cfg, block_bc, "blockBc"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_ctrl_pkts, "passCtrl"),
+	CLI_NUM(struct gmac_pktflt_cfg, sa_filter_en, "safltrEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, rx_all_en, "rxAll"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_pkt_filter_cfg NULL
+#endif
+
+static const struct cli_param cli_p_gpy2xx_gmacl_pm_cfg[] = {
+	CLI_NUM(struct pm_gmac_cfg, crc_pad_ctrl, "crcPad"),
+	CLI_NUM(struct pm_gmac_cfg, tx_err_input, "txErr"),
+	CLI_NUM(struct pm_gmac_cfg, big_endian, "bigEndian"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gmacx_bm_cfg[] = {
+	CLI_NUM(struct bm_cfg, sb0_start, "sb0Start"),
+	CLI_NUM(struct bm_cfg, sb0_end, "sb0End"),
+	CLI_NUM(struct bm_cfg, sb0_pkt_thresh, "sb0Pthresh"),
+	CLI_NUM(struct bm_cfg, sb1_start, "sb1Start"),
+	CLI_NUM(struct bm_cfg, sb1_end, "sb1End"),
+	CLI_NUM(struct bm_cfg, sb1_pkt_thresh, "sb1Pthresh"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gmacx_pm_pdi_cfg[] = {
+	CLI_NUM(struct pm_config, bypass_gmac, "bpMac"),
+	CLI_NUM(struct pm_config, bypass_macsec, "bpMsec"),
+	CLI_NUM(struct pm_config, drop_on_crc_err, "dropCrc"),
+	CLI_NUM(struct pm_config, drop_on_pkt_err, "dropPerr"),
+	CLI_NUM(struct pm_config, drop_on_sec_fail, "dropSfail"),
+	CLI_NUM(struct pm_config, class_drop, "dropClass"),
+	CLI_NUM(struct pm_config, cust_3g_en, "cust3gEn"),
+	CLI_NUM(struct pm_config, sgmii_lb_en, "sgmiiLb"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gpio_cfg[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_NUM(struct gpy211_gpio, flags, "gpioFlags"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gpio_get[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gpio_input[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_gpio_output[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_led_br_cfg[] = {
+	CLI_NUM(struct gpy211_led_brlvl_cfg, mode, "brightMode"),
+	CLI_NUM(struct gpy211_led_brlvl_cfg, lvl_min, "brightLvlMin"),
+	CLI_NUM(struct gpy211_led_brlvl_cfg, lvl_max, "brightLvlMax"),
+	CLI_NUM(struct gpy211_led_brlvl_cfg, sw_edge, "swEdgeDetect"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_led_if_cfg[] = {
+	CLI_NUM(struct gpy211_led_cfg, id, "ledId"),
+	CLI_NUM(struct gpy211_led_cfg, color_mode, "colorMode"),
+	CLI_NUM(struct gpy211_led_cfg, slow_blink_src, "slowBlinkSrc"),
+	CLI_NUM(struct gpy211_led_cfg, fast_blink_src, "fastBlinkSrc"),
+	CLI_NUM(struct gpy211_led_cfg, const_on, "constantlyOn"),
+	CLI_NUM(struct gpy211_led_cfg, pulse, "pulseFlags"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_led_if_get[] = {
+	CLI_NUM(struct gpy211_led_cfg, id, "ledId"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
+static const struct cli_param cli_p_gpy2xx_led_top_cfg[] = {
+	CLI_NUM(struct gpy211_led_gcfg, complex_scan, "complexScan"),
+	CLI_NUM(struct gpy211_led_gcfg, complex_blink, "complexBlink"),
+	CLI_NUM(struct gpy211_led_gcfg, inverse_scan, "inverseScan"),
+	CLI_NUM(struct gpy211_led_gcfg, fast_blink_freq, "fastBlinkFreq"),
+	CLI_NUM(struct gpy211_led_gcfg, slow_blink_freq, "slowBlinkFreq"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_led_top_cfg NULL
+#endif
+
+static const struct cli_param cli_p_gpy2xx_loopback_cfg[] = {
+	CLI_VAL(enum gpy211_test_loop, "loopbackMode"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_macsec_enable[] = {
+	CLI_NUM(struct gpy211_macsec, drop_on_crc_err, "dropCrc"),
+	CLI_NUM(struct gpy211_macsec, drop_on_pkt_err, "dropPerr"),
+	CLI_NUM(struct gpy211_macsec, drop_on_sec_fail, "dropSfail"),
+	CLI_NUM(struct gpy211_macsec, class_drop, "dropClass"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_mbox_read16[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_mbox_read32[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+
+struct cli_mgr_scan_args {
+	u32 xgmacMask;
+	u32 addrMask;
+	u32 smdioAddr;
+};
+
+static const struct cli_param cli_p_gpy2xx_mgr_scan[] = {
+	CLI_NUM_DEF(struct cli_mgr_scan_args, xgmacMask, "xgmacMask", 1u << 2),
+	CLI_NUM_DEF(struct cli_mgr_scan_args, addrMask, "addrMask", 0xFFFFFFFF),
+	CLI_NUM(struct cli_mgr_scan_args, smdioAddr, "smdioAddr"),
+	CLI_PARAM_END
+};
+
+struct cli_mon_link_args {
+	u32 events;
+	u32 timeout;
+	char *gpio;
+	char *uio;
+};
+
+static const struct cli_param cli_p_gpy2xx_mon_link[] = {
+	CLI_NUM_DEF(struct cli_mon_link_args, events, "events", 1),
+	CLI_NUM_DEF(struct cli_mon_link_args, timeout, "timeout", 1000),
+	CLI_STR(struct cli_mon_link_args, gpio, "gpio"),
+	CLI_STR(struct cli_mon_link_args, uio, "uio"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_pm_freq_tune[] = {
+	CLI_NUM(struct tune_freq, ppm, "ppm"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_adjfreq[] = {
+	CLI_VAL(s32, "pbbTime"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_adjtime[] = {
+	CLI_VAL(s64, "deltaTime"),
+	CLI_PARAM_END
+};
+
+/* The gpy211_ptp_ctrl fields are bit-fields */
+struct cli_ptp_enable_args {
+	u16 enPhyTxTs;
+	u16 enPhyRxTs;
+	u16 txPtpOffset;
+	u16 txPtpProto;
+	u16 enTxOstcEn;
+	time64_t txOstCorTime;
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_enable[] = {
+	CLI_NUM(struct cli_ptp_enable_args, enPhyTxTs, "enPhyTxTs"),
+	CLI_NUM(struct cli_ptp_enable_args, enPhyRxTs, "enPhyRxTs"),
+	CLI_NUM(struct cli_ptp_enable_args, txPtpOffset, "txPtpOffset"),
+	CLI_NUM(struct cli_ptp_enable_args, txPtpProto, "txPtpProto"),
+	CLI_NUM(struct cli_ptp_enable_args, enTxOstcEn, "enTxOstcEn"),
+	CLI_NUM(struct cli_ptp_enable_args, txOstCorTime, "txOstCorTime"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_getcrosststamp[] = {
+	CLI_NUM_DEF(struct gpy211_ptp_xts, n_samples, "samples", 5),
+	CLI_NUM(struct gpy211_ptp_xts, clk, "sysClk"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_set_ppsctrl[] = {
+	CLI_NUM(struct gpy2xx_pps_ctrl, ppsctrl_low.raw_pps_ctrl_low, "ppsCtrlLow"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, sec_tgttime, "targetSec"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, nsec_tgttime, "targetNsc"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, pps0_interal, "ppsInterval"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, pps0_width, "ppsWidth"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, gpc_sel, "gpcSel"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_set_ptoctrl[] = {
+	CLI_NUM(struct gpy2xx_pto_ctrl, ptoctrl_low.raw_pto_ctrl_low, "ptoCtrlLow"),
+	CLI_KEY(struct gpy2xx_pto_ctrl, sport_id, "srcPortID"),
+	CLI_NUM(struct gpy2xx_pto_ctrl, logmsg_lvl.raw_logm_lvl_low, "logmLvlLow"),
+	CLI_NUM(struct gpy2xx_pto_ctrl, logmsg_lvl.raw_logm_lvl_hi, "logmLvlHi"),
+	CLI_PARAM_END
+};
+
+/* The gpy2xx_ts_ctrl fields are bit-fields */
+struct cli_ptp_tsctrl_args {
+	u16 enEvntMsg;
+	u16 enMstrMsg;
+	u16 snapType;
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_set_tsctrl[] = {
+	CLI_NUM(struct cli_ptp_tsctrl_args, enEvntMsg, "enEvntMsg"),
+	CLI_NUM(struct cli_ptp_tsctrl_args, enMstrMsg, "enMstrMsg"),
+	CLI_NUM(struct cli_ptp_tsctrl_args, snapType, "snapType"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_ptp_settime[] = {
+	CLI_NUM(struct timespec64, tv_sec, "initSec"),
+	CLI_NUM(struct timespec64, tv_nsec, "initNsec"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_read[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+
+/* Parameters of the register access commands */
+struct cli_reg_args {
+	u32 devtype;
+	u32 regaddr;
+	u32 data;
+};
+
+static const struct cli_param cli_p_reg_read_mmd[] = {
+	CLI_NUM(struct cli_reg_args, devtype, "devtype"),
+	CLI_NUM(struct cli_reg_args, regaddr, "regaddr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_reg_write[] = {
+	CLI_NUM(struct cli_reg_args, regaddr, "regaddr"),
+	CLI_NUM(struct cli_reg_args, data, "data"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_reg_write_mmd[] = {
+	CLI_NUM(struct cli_reg_args, devtype, "devtype"),
+	CLI_NUM(struct cli_reg_args, regaddr, "regaddr"),
+	CLI_NUM(struct cli_reg_args, data, "data"),
+	CLI_PARAM_END
+};
+
+struct cli_reg_decode_args {
+	char *space;
+	char *reg;
+	char *file;
+	u32 regaddr;
+	u32 data;
+};
+
+static const struct cli_param cli_p_gpy2xx_reg_decode[] = {
+	CLI_STR(struct cli_reg_decode_args, space, "space"),
+	CLI_STR(struct cli_reg_decode_args, reg, "reg"),
+	CLI_NUM(struct cli_reg_decode_args, regaddr, "regaddr"),
+	CLI_NUM(struct cli_reg_decode_args, data, "data"),
+	CLI_STR(struct cli_reg_decode_args, file, "file"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_setup_forced[] = {
+	CLI_NUM_DEF(struct gpy211_device, link.speed, "speed", SPEED_2500),
+	CLI_NUM_DEF(struct gpy211_device, link.duplex, "duplex", DUPLEX_FULL),
+	CLI_NUM_DEF(struct gpy211_device, link.pause, "pause", 1),
+	CLI_NUM_DEF(struct gpy211_device, link.asym_pause, "asym_pause", 1),
+	CLI_NUM_DEF(struct gpy211_device, mstr_slave, "mstr_slave", 1),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_sgmii_config_aneg[] = {
+	CLI_NUM_DEF(struct gpy211_sgmii, linkcfg_dir, "linkcfg_dir", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, aneg_mode, "aneg_mode", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, eee_enable, "eee_enable", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, link.autoneg, "autoneg", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, link.speed, "speed", SPEED_2500),
+	CLI_NUM(struct gpy211_sgmii, link.fixed2g5, "fixed2G5"),
+	CLI_NUM_DEF(struct gpy211_sgmii, link.duplex, "duplex", DUPLEX_FULL),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_sgmii_opmode[] = {
+	CLI_VAL(enum gpy211_sgmii_operation, "opMode"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_SMDIO_RW) && EN_SMDIO_RW
+static const struct cli_param cli_p_gpy2xx_smdio_read[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_smdio_read NULL
 #endif
-	{
-		"gpy2xx_macsec_enable",
-		"Configure Smart-AZ to enable MACsec",
-		"gpy2xx_macsec_enable [dropCrc=?] [dropPerr=?] [dropSfail=?] [dropClass=?]\n"
-		"  dropCrc:    dis/en\n"
-		"  dropPerr:   dis/en\n"
-		"  dropSfail:  dis/en\n"
-		"  dropClass:  dis/en\n"
-	},
-	{
-		"gpy2xx_macsec_disable",
-		"Unconfigure Smart-AZ to disable MACsec",
-		NULL
-	},
-	{
-		"gpy2xx_gmacx_pm_pdi_cfg",
-		"Set PM PDI configuration",
-		"gpy2xx_gmacx_pm_pdi_cfg <bpMac=?> <bpMsec=?> [dropCrc=?] [dropPerr=?] [dropSfail=?] [dropClass=?] [cust3gEn=?] [sgmiiLb=?]\n"
-		"  bpMac:      dis/en\n"
-		"  bpMsec:     dis/en\n"
-		"  dropCrc:    dis/en\n"
-		"  dropPerr:   dis/en\n"
-		"  dropSfail:  dis/en\n"
-		"  dropClass:  dis/en\n"
-		"  cust3gEn:   dis/en\n"
-		"  sgmiiLb:    dis/en\n"
-	},
-	{
-		"gpy2xx_gmacx_pm_pdi_get",
-		"Get PM PDI configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_pm_cfg",
-		"Set PM GMAC-Full configuration",
-		"gpy2xx_gmacf_pm_cfg <crcPad=?> [txErr=?] [bigEndian=?]\n"
-		"  crcPad:     0 - Insert both CRC and Paddding\n"
-		"			   1 - Insert CRC only but no Paddding\n"
-		"			   2 - Do not insert CRC or Paddding\n"
-		"			   3 - Replace CRC but no Paddding\n"
-		"  txErr:      dis/en\n"
-		"  bigEndian:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_pm_get",
-		"Get PM GMAC-Full configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pm_cfg",
-		"Set PM GMAC-Lite configuration",
-		"gpy2xx_gmacl_pm_cfg <crcPad=?> [txErr=?] [bigEndian=?]\n"
-		"  crcPad:     0 - Insert both CRC and Paddding\n"
-		"			   1 - Insert CRC only but no Paddding\n"
-		"			   2 - Do not insert CRC or Paddding\n"
-		"			   3 - Replace CRC but no Paddding\n"
-		"  txErr:      dis/en\n"
-		"  bigEndian:  dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacl_pm_get",
-		"Get PM GMAC-Lite configuration",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacf_lpi_cfg",
-		"Set PM GMAC-Full LPI configuration",
-		"gpy2xx_gmacf_lpi_cfg <lpintEn=?> <lpiEn=?> <linkUp=?> [txautoEn=?] [timerEn=?] [clkStop=?] [ticTime=0196] [twTime=?] [lsTime=?] [entryTime=?]\n"
-		"  lpintEn:    dis/en\n"
-		"  lpiEn:      dis/en\n"
-		"  linkUp:     dis/en\n"
-		"  txautoEn:   dis/en\n"
-		"  timerEn:    dis/en\n"
-		"  clkStop:    dis/en\n"
-		"  ticTime:    value\n"
-		"  twTime:     value\n"
-		"  lsTime:     value\n"
-		"  entryTime:  value\n"
-	},
-	{
-		"gpy2xx_gmacf_lpi_get",
-		"Get PM GMAC-Full LPI configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_lpi_cfg",
-		"Set PM GMAC-Lite LPI configuration",
-		"gpy2xx_gmacl_lpi_cfg <lpintEn=?> <lpiEn=?> <linkUp=?> [txautoEn=?] [timerEn=?] [clkStop=?] [ticTime=0196] [twTime=?] [lsTime=?] [entryTime=?]\n"
-		"  lpintEn:    dis/en\n"
-		"  lpiEn:      dis/en\n"
-		"  linkUp:     dis/en\n"
-		"  txautoEn:   dis/en\n"
-		"  timerEn:    dis/en\n"
-		"  clkStop:    dis/en\n"
-		"  ticTime:    value\n"
-		"  twTime:     value\n"
-		"  lsTime:     value\n"
-		"  entryTime:  value\n"
-	},
-	{
-		"gpy2xx_gmacl_lpi_get",
-		"Get PM GMAC-Lite LPI configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_stat_get",
-		"Get GMAC-Full LPI status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_lpi_stat_get",
-		"Get GMAC-Lite LPI status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_imask_cfg",
-		"Set GMAC-Full's LPI interrupt mask",
-		"gpy2xx_gmacf_lpi_imask_cfg <rxUsc=?> <rxTrc=?> <txUsc=?> <txTrc=?>\n"
-		"  rxUsc:  dis/en\n"
-		"  rxTrc:  dis/en\n"
-		"  txUsc:  dis/en\n"
-		"  txTrc:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_lpi_imask_get",
-		"Get GMAC-Full's LPI interrupt mask",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_istat_get",
-		"Get GMAC-Full's LPI interrupt status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_count_get",
-		"Get GMAC-Full's LPI counters",
-		NULL
-	},
+
+static const struct cli_param cli_p_gpy2xx_synce_cfg[] = {
+	CLI_NUM(struct gpy211_synce, synce_enable, "enSyncE"),
+	CLI_NUM(struct gpy211_synce, synce_refclk, "synceRefClk"),
+	CLI_NUM(struct gpy211_synce, master_sel, "masterSlave"),
+	CLI_NUM(struct gpy211_synce, data_rate, "dataRate"),
+	CLI_NUM(struct gpy211_synce, gpc_sel, "gpcSel"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_test_mode_cfg[] = {
+	CLI_VAL(enum gpy211_test_mode, "testTxMode"),
+	CLI_PARAM_END
+};
+
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+static const struct cli_param cli_p_gpy2xx_topin_cfg[] = {
+	CLI_NUM(struct gpy211_extin, id, "intId"),
+	CLI_NUM(struct gpy211_extin, gpio_flags, "gpioFlags"),
+	CLI_NUM(struct gpy211_extin, ip_char, "ipChar"),
+	CLI_NUM(struct gpy211_extin, im0, "intMod0"),
+	CLI_NUM(struct gpy211_extin, im1, "intMod1"),
+	CLI_NUM(struct gpy211_extin, im2, "intMod2"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_topin_cfg NULL
 #endif
-	{
-		"gpy2xx_gmacx_bm_cfg",
-		"Set PM's Buffer configuration",
-		"gpy2xx_gmacx_bm_cfg [sb0Start=?] [sb0End=?] [sb0Pthresh=?] [sb1Start=?] [sb1End=?] [sb1Pthresh=?]\n"
-		"  sb0Start:   value\n"
-		"  sb0End:     value\n"
-		"  sb0Pthresh: value\n"
-		"  sb1Start:   value\n"
-		"  sb1End:	   value\n"
-		"  sb1Pthresh: value\n"
-	},
-	{
-		"gpy2xx_gmacx_bm_status_get",
-		"Get PMs buffer status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacx_bm_get",
-		"Get PM's Buffer configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pause_cfg",
-		"Set GMAC-Lite's Pause configuration",
-		"gpy2xx_gmacl_pause_cfg <fcBusy=?> <gmaclFc=?> <txfcEn=?> <pauseTime=?> <pauseMac=?> [plThresh=?] [zqPause=?] [paThresh=?] [pdThresh=?]\n"
-		"  fcBusy:   dis/en\n"
-		"  gmaclFc:  dis/en\n"
-		"  txfcEn:   dis/en\n"
-		"  plThresh: 0 - PT-4 slot times\n"
-		"			 1 - PT-28 slot times\n"
-		"			 2 - PT-36 slot times\n"
-		"			 3 - PT-144 slot times\n"
-		"			 4 - PT-256 slot times\n"
-		"			 5 - PT-512 slot times\n"
-		"  zqPause:	 dis/en\n"
-		"  pauseTime:value\n"
-		"  pauseMac: value\n"
-		"  paThresh: value\n"
-		"  pdThresh: value\n"
-	},
-	{
-		"gpy2xx_gmacl_pause_get",
-		"Get GMAC-Lite's Pause configuration",
-		NULL
-	},
-	{
-		"gpy2xx_pm_freq_tune",
-		"Tune the frequency of MACs within GPY in USXGMII Mode",
-		"gpy2xx_pm_freq_tune <ppm=?>\n"
-		"  ppm: 0 - MACs operate at frequency+000ppm\n"
-		"		1 - MACs operate at frequency+100ppm\n"
-		"		2 - MACs operate at frequency+300ppm\n"
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacf_pkt_filter_cfg",
-		"Set GMAC-Full's packet filter control info",
-		"gpy2xx_gmacf_pkt_filter_cfg <prEn=?> [passAmc=?] [blockBc=?] [passCtrl=?] [safltrEn=?] [rxAll=?]\n"
-		"  prEn:       dis/en\n"
-		"  passAmc:    dis/en\n"
-		"  blockBc:    dis/en\n"
-		"  passCtrl:   0 - Block all control packets\n"
-		"			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n"
-		"			   2 - Forwards all control packets even if they fail the Address filter\n"
-		"			   3 - Forwards the control packets that pass the Address filter\n"
-		"  safltrEn:   dis/en\n"
-		"  rxAll:      dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_pkt_filter_get",
-		"Get GMAC-Full's packet filter control info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pkt_filter_cfg",
-		"Set GMAC-Lite's packet filter control info",
-		"gpy2xx_gmacl_pkt_filter_cfg <prEn=?> [passAmc=?] [blockBc=?] [passCtrl=?] [safltrEn=?] [rxAll=?]\n"
-		"  prEn:       dis/en\n"
-		"  passAmc:    dis/en\n"
-		"  blockBc:    dis/en\n"
-		"  passCtrl:   0 - Block all control packets\n"
-		"			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n"
-		"			   2 - Forwards all control packets even if they fail the Address filter\n"
-		"			   3 - Forwards the control packets that pass the Address filter\n"
-		"  safltrEn:   dis/en\n"
-		"  rxAll:      dis/en\n"
-	},
-	{
-		"gpy2xx_gmacl_pkt_filter_get",
-		"Get GMAC-Lite's packet filter control info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_debug_info_get",
-		"Get GMAC-Full's debug info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pkt_cfg",
-		"Set GMAC-Lite's packet config info",
-		"gpy2xx_gmacl_pkt_cfg <pcStrip=?> <crcStrip=?> [jumboEn=?] [jabberDis=?] [wdogDis=?] [sup2kp=?] [macIpg=?]\n"
-		"  jumboEn:    dis/en\n"
-		"  jabberDis:  dis/en\n"
-		"  wdogDis:    dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-		"  sup2kp:     dis/en\n"
-		"  macIpg:     0 - 12 Bytes\n"
-		"  	           1 - 11 Bytes\n"
-		"  	           2 - 10 Bytes\n"
-		"  	           3 - 09 Bytes\n"
-		"  	           4 - 08 Bytes\n"
-		"			   5 - 07 Bytes\n"
-		"			   6 - 06 Bytes\n"
-		"			   7 - 05 Bytes\n"
-	},
-	{
-		"gpy2xx_gmacl_pkt_get",
-		"Get GMAC-Lite's packet config info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_cfg",
-		"Set GMAC-Full's basic config info",
-		"gpy2xx_gmacf_cfg [reEn=?] [teEn=?] [preambLen=<enum>] [lbmEn=?] [fdupEn=?] [macSpeed=<enum>] [rcWrite1=?]\n"
-		"  reEn:       dis/en\n"
-		"  teEn:       dis/en\n"
-		"  preambLen:  0 - 7 bytes of preamble\n"
-		"			   1 - 5 bytes of preamble\n"
-		"			   2 - 3 bytes of preamble\n"
-		"  lbmEn:      dis/en\n"
-		"  fdupEn:     dis/en\n"
-		"  macSpeed:   0 - 1G\n"
-		"			   1 - 2.5G\n"
-		"			   2 - 10M\n"
-		"			   3 - 100MG\n"
-		"  rcWrite1:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_get",
-		"Get GMAC-Full's basic config info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_cfg",
-		"Set GMAC-Lite's basic config info",
-		"gpy2xx_gmacl_cfg [reEn=?] [teEn=?] [preambLen=<enum>] [lbmEn=?] [fdupEn=?] [macSpeed=<enum>] [rcWrite1=?]\n"
-		"  reEn:       dis/en\n"
-		"  teEn:       dis/en\n"
-		"  preambLen:  0 - 7 bytes of preamble\n"
-		"			   1 - 5 bytes of preamble\n"
-		"			   2 - 3 bytes of preamble\n"
-		"  lbmEn:      dis/en\n"
-		"  fdupEn:     dis/en\n"
-		"  macSpeed:   0 - 1G\n"
-		"			   1 - 2.5G\n"
-		"			   2 - 10M\n"
-		"			   3 - 100MG\n"
-		"  rcWrite1:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacl_get",
-		"Get GMAC-Lite's basic config info",
-		NULL
-	},
+
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+static const struct cli_param cli_p_gpy2xx_topin_clr[] = {
+	CLI_NUM(struct gpy211_extin, id, "intId"),
+	CLI_NUM(struct gpy211_extin, im0, "intMod0"),
+	CLI_NUM(struct gpy211_extin, im1, "intMod1"),
+	CLI_NUM(struct gpy211_extin, im2, "intMod2"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_topin_clr NULL
 #endif
-	{
-		"gpy2xx_gmacf_pkt_cfg",
-		"Set GMAC-Full's packet config info",
-		"gpy2xx_gmacf_pkt_cfg <pcStrip=?> <crcStrip=?> [jumboEn=?] [jabberDis=?] [wdogDis=?] [sup2kp=?] [macIpg=?]\n"
-		"  jumboEn:    dis/en\n"
-		"  jabberDis:  dis/en\n"
-		"  wdogDis:    dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-		"  sup2kp:     dis/en\n"
-		"  macIpg:     0 - 12 Bytes\n"
-		"  	           1 - 11 Bytes\n"
-		"  	           2 - 10 Bytes\n"
-		"  	           3 - 09 Bytes\n"
-		"  	           4 - 08 Bytes\n"
-		"  	           5 - 07 Bytes\n"
-		"  	           6 - 06 Bytes\n"
-		"  	           7 - 05 Bytes\n"
-	},
-	{
-		"gpy2xx_gmacf_pkt_get",
-		"Get GMAC-Full's packet config info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_count_ctrl_cfg",
-		"Set GMAC-Full's Rx/Tx counters control info",
-		"gpy2xx_gmacf_count_ctrl_cfg <rstCnt=?> <stopRoll=?> <conRead=?> <frzCnt=?> <pstCnt=?> <psthFull=?> <cntbcDrop=?>\n"
-		"  rstCnt:     dis/en\n"
-		"  stopRoll:   dis/en\n"
-		"  conRead:    dis/en\n"
-		"  frzCnt:     dis/en\n"
-		"  pstCnt:     dis/en\n"
-		"  psthFull:   dis/en\n"
-		"  cntbcDrop:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_count_ctrl_get",
-		"Get GMAC-Full's counters control info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_count_get",
-		"Get GMAC-Full's Rx/Tx counters",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacf_count_imask_cfg",
-		"Set GMAC-Full's counters interrupt mask",
-		"gpy2xx_gmacf_count_imask_cfg <txGb=?> <txUflow=?> <txGood=?> <txOsize=?> <rxGb=?> <rxCrc=?> <rxUsize=?> <rxOsize=?>\n"
-		"  txGb:     dis/en\n"
-		"  txUflow:  dis/en\n"
-		"  txGood:   dis/en\n"
-		"  txOsize:  dis/en\n"
-		"  rxGb:     dis/en\n"
-		"  rxCrc:    dis/en\n"
-		"  rxUsize:  dis/en\n"
-		"  rxOsize:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_count_imask_get",
-		"Get GMAC-Full's counters interrupt mask",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_count_istat_get",
-		"Get GMAC-Full's counters interrupt status",
-		NULL
-	},
+
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+static const struct cli_param cli_p_gpy2xx_topin_get[] = {
+	CLI_NUM(struct gpy211_extin, id, "intId"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_topin_get NULL
 #endif
-	{
-		"gpy2xx_msec_init_ing_dev",
-		"Init macsec ING device",
-		NULL
-	},
-	{
-		"gpy2xx_msec_init_egr_dev",
-		"Init macsec EGR device",
-		NULL
-	},
 
+static const struct cli_param cli_p_gpy2xx_ulp_cfg[] = {
+	CLI_NUM(struct gpy211_ulp_ctrl, ulp_en, "ulp_enable"),
+	CLI_NUM(struct gpy211_ulp_ctrl, ulp_sta_block, "ulp_sta_block"),
+	CLI_NUM(struct gpy211_ulp_ctrl, ulp_exit, "ulp_exit"),
+	CLI_NUM(struct gpy211_ulp_ctrl, master_slice, "master_slice"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_usxgmii_alignmentmarker_set[] = {
+	CLI_VAL(u32, "usxgmii_am_count"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_usxgmii_loopback_cfg[] = {
+	CLI_VAL(enum gpy211_usxgmii_loopback_mode, "mode"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_usxgmii_reach_cfg[] = {
+	CLI_NUM_DEF(struct gpy211_usxgmii_reach, trace_len, "trace_len", -1),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_eq_main, "tx_eq_main"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_eq_pre, "tx_eq_pre"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_eq_post, "tx_eq_post"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_vboost_en, "tx_vboost_en"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_vboost_lvl, "tx_vboost_lvl"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_iboost_lvl, "tx_iboost_lvl"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_att_lvl, "rx_eq_att_lvl"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_vga1_gain, "rx_eq_vga1_gain"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_vga2_gain, "rx_eq_vga2_gain"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_ctle_boost, "rx_eq_ctle_boost"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_ctle_pole, "rx_eq_ctle_pole"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_dfe_tap1, "rx_eq_dfe_tap1"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_afe_adapt_en, "rx_afe_adapt_en"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_dfe_adapt_en, "rx_dfe_adapt_en"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_usxgmii_rx_bert_cfg[] = {
+	CLI_NUM(struct gpy211_usxgmii_rx_bert_config, mode, "mode"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_usxgmii_tx_bert_cfg[] = {
+	CLI_NUM(struct gpy211_usxgmii_tx_bert_config, mode, "mode"),
+	CLI_NUM(struct gpy211_usxgmii_tx_bert_config, nval_sel, "nval_sel"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_wol_cfg[] = {
+	CLI_NUM(struct gpy211_wolinfo, wolopts, "wolOptions"),
+	CLI_MAC(struct gpy211_wolinfo, mac, "wolMAC"),
+	CLI_MAC(struct gpy211_wolinfo, sopass, "wolPassword"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_xpcs_read16[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+
+#if defined(P31G_IND_RW) && P31G_IND_RW
+static const struct cli_param cli_p_pm_ind_read[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_pm_ind_read NULL
+#endif
+
+static const struct cli_param cli_p_test_gpy2xx_ptp_set_ppsctrl[] = {
+	CLI_NUM(struct gpy2xx_pps_ctrl, gpc_sel, "gpcSel"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_msec_clear_cc_int_stat[] = {
+#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
+	CLI_NUM(struct crypto_core_stat, ctx_stat.raw_ctx_stat, "ctx_stat"),
+#endif
+	CLI_NUM(struct crypto_core_stat, int_stat.raw_int_stat, "int_stat"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_NUM(struct psa_summary, count_summ_psa[0], "psa_summ0"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_sa_exp_summ[] = {
+	CLI_NUM(struct sa_exp_summ, sa_expsum_word[0], "saexp_summ0"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_sam_rule[] = {
+	CLI_NUM(struct sa_match_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_stats_summ[] = {
+	CLI_NUM(struct stats_summary, psa_sum_word[0], "psa_summ0"),
+	CLI_NUM(struct stats_summary, glb_summ_word, "glb_summ"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_NUM(struct psa_summary, count_summ_psa[0], "psa_summ0"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_sam_rule[] = {
+	CLI_NUM(struct sa_match_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_stats_summ[] = {
+	CLI_NUM(struct stats_summary, psa_sum_word[0], "psa_summ0"),
+	CLI_NUM(struct stats_summary, glb_summ_word, "glb_summ"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_clear_sa_pn_thr_summ[] = {
+	CLI_NUM(struct sa_pn_thr_summ, pnthr_sum_word[0], "pnthr_summ0"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_aic_csr[] = {
+	CLI_NUM(struct aic_control_stat, enable_ctrl.raw_aic_bits, "enable_ctrl"),
+	CLI_NUM(struct aic_control_stat, ack.raw_aic_bits, "ack"),
+	CLI_NUM(struct aic_control_stat, enable_set.raw_aic_bits, "enable_set"),
+	CLI_NUM(struct aic_control_stat, enable_clr.raw_aic_bits, "enable_clr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_ctrl[] = {
+	CLI_NUM(struct count_control, reset_all, "rst_all"),
+	CLI_NUM(struct count_control, saturate_cntrs, "ctr_saturate"),
+	CLI_NUM(struct count_control, auto_cntr_reset, "ctr_conr"),
+	CLI_NUM(struct count_control, reset_summary, "rst_summary"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_incen[] = {
+	CLI_NUM(struct count_incen, sa_inc_en, "sa_inc"),
+	CLI_NUM(struct count_incen, vlan_inc_en, "vlan_inc"),
+	CLI_NUM(struct count_incen, global_inc_en, "global_inc"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_secfail[] = {
+	CLI_NUM(struct count_secfail, secfail_1.raw_secfail1, "misc_secfail"),
+	CLI_NUM(struct count_secfail, global_secfaill_mask, "global_secfail"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_thresh[] = {
+	CLI_NUM(struct frame_octet_thr, frame_threshold, "frame_thr"),
+	CLI_NUM(struct frame_octet_thr, octet_threshold, "octet_thr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_cp_rule[] = {
+	CLI_NUM(struct cp_class_param, cpc_index, "cpc_index"),
+	CLI_NUM(struct cp_class_param, cpc_type, "entry_type"),
+	CLI_MAC(struct cp_class_param, mac_da, "da_mac"),
+	CLI_MAC(struct cp_class_param, mac_da_end, "da_end"),
+	CLI_NUM(struct cp_class_param, ether_type, "eth_type"),
+	CLI_NUM(struct cp_class_param, cpm_mode, "cpm_mode"),
+	CLI_NUM(struct cp_class_param, cpm_enable, "cpm_en"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_misc_ctrl[] = {
+	CLI_NUM(struct misc_control, mc_latency_fix, "mc_latency"),
+	CLI_NUM(struct misc_control, static_bypass, "static_bp"),
+	CLI_NUM(struct misc_control, nm_macsec_en, "nm_macsec"),
+	CLI_NUM(struct misc_control, validate_frames, "validate_level"),
+	CLI_NUM(struct misc_control, sectag_after_vlan, "sectag_avlan"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sa_nm_cp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
+
+/* The sa_nm_params fields are bit-fields */
+struct cli_sa_nm_ctrl_args {
+	u16 comp_etype;
+	u16 check_ver;
+	u16 check_kay;
+	u16 check_ce;
+	u16 check_sc;
+	u16 check_sl;
+	u16 check_pn;
+	u16 msec_eth;
+};
+
+static const struct cli_param cli_p_msec_sa_nm_ctrl[] = {
+	CLI_NUM(struct cli_sa_nm_ctrl_args, comp_etype, "comp_etype"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_ver, "check_ver"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_kay, "check_kay"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_ce, "check_ce"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_sc, "check_sc"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_sl, "check_sl"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_pn, "check_pn"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, msec_eth, "msec_eth"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sa_nm_ncp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sam_eec[] = {
+	CLI_NUM(struct sam_ee_ctrl, sam_index_set, "sam_ind_set"),
+	CLI_NUM(struct sam_ee_ctrl, set_enable, "set_single"),
+	CLI_NUM(struct sam_ee_ctrl, set_all, "set_all"),
+	CLI_NUM(struct sam_ee_ctrl, sam_index_clear, "sam_ind_clr"),
+	CLI_NUM(struct sam_ee_ctrl, clear_enable, "clr_single"),
+	CLI_NUM(struct sam_ee_ctrl, clear_all, "clr_all"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sam_eex[] = {
+	CLI_NUM(struct raw_sam_ee, eex_type, "eex_type"),
+	CLI_NUM(struct raw_sam_ee, raw_sam_ee[0], "eex_word0"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_NUM(struct sa_match_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_match_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_match_fca, flow_crypt_auth, "crypt_auth"),
+	CLI_NUM(struct sa_match_fca, drop_action, "drop_act"),
+	CLI_NUM(struct sa_match_fca, sa_index, "sa_index"),
+	CLI_NUM(struct sa_match_fca, protect_frame, "frame_protect"),
+	CLI_NUM(struct sa_match_fca, sa_in_use, "sa_inuse"),
+	CLI_NUM(struct sa_match_fca, include_sci, "include_sci"),
+	CLI_NUM(struct sa_match_fca, use_es, "use_es"),
+	CLI_NUM(struct sa_match_fca, use_scb, "use_scb"),
+	CLI_NUM(struct sa_match_fca, tag_bypass_size, "tag_bpsize"),
+	CLI_NUM(struct sa_match_fca, sa_index_update, "sa_indup"),
+	CLI_NUM(struct sa_match_fca, conf_offset, "conf_offset"),
+	CLI_NUM(struct sa_match_fca, conf_protect, "conf_protect"),
+	CLI_NUM(struct sa_match_fca, iv, "ivl_mode"),
+	CLI_NUM(struct sa_match_fca, icv_append, "append_icv"),
+	CLI_NUM(struct sa_match_fca, crypt_auth_bypass_len, "ca_bp_len"),
+	CLI_PARAM_END
+};
+
+struct cli_sam_rule_args {
+	struct sa_match_param match;
+	/* extn_par.flow_index is a bit-field */
+	u8 flow_index;
+};
+
+static const struct cli_param cli_p_msec_sam_rule[] = {
+	CLI_NUM(struct cli_sam_rule_args, match.rule_index, "rule_index"),
+	CLI_MAC(struct cli_sam_rule_args, match.sa_mac, "sa_mac"),
+	CLI_MAC(struct cli_sam_rule_args, match.da_mac, "da_mac"),
+	CLI_NUM(struct cli_sam_rule_args, match.eth_type, "eth_type"),
+	CLI_NUM(struct cli_sam_rule_args, match.vlan_id, "vlan_id"),
+	CLI_NUM(struct cli_sam_rule_args, match.misc_par.misc, "misc"),
+	CLI_KEY(struct cli_sam_rule_args, match.sci, "sci"),
+	CLI_NUM(struct cli_sam_rule_args, match.mask_par.mask, "mask"),
+	CLI_NUM(struct cli_sam_rule_args, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_NUM(struct seq_num_thr, sn_threshold, "sn_thr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_NUM(struct transform_rec, ccw.ca_type, "ca_type"),
+	CLI_NUM(struct transform_rec, ccw.an, "an"),
+	CLI_AESKEY(struct transform_rec, cp.key, "key"),
+	CLI_KEY(struct transform_rec, cp.sci, "sci"),
+	CLI_NUM(struct transform_rec, pn_rc.seq_num, "seq_num"),
+	CLI_KEY(struct transform_rec, cp.c_salt.salt, "salt"),
+	CLI_KEY(struct transform_rec, cp.c_salt.s_sci, "short_sci"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index, "next_sa_ind"),
+	CLI_NUM(struct transform_rec, sa_update.sa_expired_irq, "sa_expirq"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index_valid, "sa_indvalid"),
+	CLI_NUM(struct transform_rec, sa_update.flow_index, "flow_index"),
+	CLI_NUM(struct transform_rec, sa_update.sa_ind_update_en, "sa_indupen"),
+	CLI_PARAM_END
+};
+
+/* The sam_vlan_parse fields are bit-fields */
+struct cli_vlan_parse_args {
+	u8 qinq_en;
+	u8 stag_en;
+	u8 qtag_en;
+};
+
+static const struct cli_param cli_p_msec_vlan_parse[] = {
+	CLI_NUM(struct cli_vlan_parse_args, qinq_en, "qinq_en"),
+	CLI_NUM(struct cli_vlan_parse_args, stag_en, "stag_en"),
+	CLI_NUM(struct cli_vlan_parse_args, qtag_en, "qtag_en"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_aic_csr[] = {
+	CLI_NUM(struct aic_control_stat, enable_ctrl.raw_aic_bits, "enable_ctrl"),
+	CLI_NUM(struct aic_control_stat, ack.raw_aic_bits, "ack"),
+	CLI_NUM(struct aic_control_stat, enable_set.raw_aic_bits, "enable_set"),
+	CLI_NUM(struct aic_control_stat, enable_clr.raw_aic_bits, "enable_clr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_ctrl[] = {
+	CLI_NUM(struct ing_cc_ctrl, nm_act, "nm_act"),
+	CLI_NUM(struct ing_cc_ctrl, nm_ctrl_act, "nm_ctrl_act"),
+	CLI_PARAM_END
+};
+
+/* The icc_ee_ctrl fields are bit-fields */
+struct cli_cc_eec_args {
+	u32 icc_ind_set;
+	u32 set_single;
+	u32 set_all;
+	u32 icc_ind_clr;
+	u32 clr_single;
+	u32 clr_all;
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_eec[] = {
+	CLI_NUM(struct cli_cc_eec_args, icc_ind_set, "icc_ind_set"),
+	CLI_NUM(struct cli_cc_eec_args, set_single, "set_single"),
+	CLI_NUM(struct cli_cc_eec_args, set_all, "set_all"),
+	CLI_NUM(struct cli_cc_eec_args, icc_ind_clr, "icc_ind_clr"),
+	CLI_NUM(struct cli_cc_eec_args, clr_single, "clr_single"),
+	CLI_NUM(struct cli_cc_eec_args, clr_all, "clr_all"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_eef[] = {
+	CLI_NUM(struct raw_icc_ee, raw_icc_ee[0], "eec_word0"),
+	CLI_PARAM_END
+};
+
+struct cli_cc_rule_args {
+	struct icc_match_param match;
+	/* vlan_eth.payload_e_type and icc_misc are bit-fields */
+	u32 eth_type;
+	u32 misc;
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_rule[] = {
+	CLI_NUM(struct cli_cc_rule_args, match.icc_index, "icc_index"),
+	CLI_NUM(struct cli_cc_rule_args, eth_type, "eth_type"),
+	CLI_NUM(struct cli_cc_rule_args, misc, "misc"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_ctrl[] = {
+	CLI_NUM(struct count_control, reset_all, "rst_all"),
+	CLI_NUM(struct count_control, saturate_cntrs, "ctr_saturate"),
+	CLI_NUM(struct count_control, auto_cntr_reset, "ctr_conr"),
+	CLI_NUM(struct count_control, reset_summary, "rst_summary"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_incen[] = {
+	CLI_NUM(struct count_incen, sa_inc_en, "sa_inc"),
+	CLI_NUM(struct count_incen, vlan_inc_en, "vlan_inc"),
+	CLI_NUM(struct count_incen, global_inc_en, "global_inc"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_secfail[] = {
+	CLI_NUM(struct count_secfail, secfail_1.raw_secfail1, "misc_secfail"),
+	CLI_NUM(struct count_secfail, global_secfaill_mask, "global_secfail"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_thresh[] = {
+	CLI_NUM(struct frame_octet_thr, frame_threshold, "frame_thr"),
+	CLI_NUM(struct frame_octet_thr, octet_threshold, "octet_thr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cp_rule[] = {
+	CLI_NUM(struct cp_class_param, cpc_index, "cpc_index"),
+	CLI_NUM(struct cp_class_param, cpc_type, "entry_type"),
+	CLI_MAC(struct cp_class_param, mac_da, "da_mac"),
+	CLI_MAC(struct cp_class_param, mac_da_end, "da_end"),
+	CLI_NUM(struct cp_class_param, ether_type, "eth_type"),
+	CLI_NUM(struct cp_class_param, cpm_mode, "cpm_mode"),
+	CLI_NUM(struct cp_class_param, cpm_enable, "cpm_en"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_misc_ctrl[] = {
+	CLI_NUM(struct misc_control, mc_latency_fix, "mc_latency"),
+	CLI_NUM(struct misc_control, static_bypass, "static_bp"),
+	CLI_NUM(struct misc_control, nm_macsec_en, "nm_macsec"),
+	CLI_NUM(struct misc_control, validate_frames, "validate_level"),
+	CLI_NUM(struct misc_control, sectag_after_vlan, "sectag_avlan"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sa_nm_cp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_non_reserved, "drop_nonres"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sa_nm_ncp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_non_reserved, "drop_nonres"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sam_eec[] = {
+	CLI_NUM(struct sam_ee_ctrl, sam_index_set, "sam_ind_set"),
+	CLI_NUM(struct sam_ee_ctrl, set_enable, "set_single"),
+	CLI_NUM(struct sam_ee_ctrl, set_all, "set_all"),
+	CLI_NUM(struct sam_ee_ctrl, sam_index_clear, "sam_ind_clr"),
+	CLI_NUM(struct sam_ee_ctrl, clear_enable, "clr_single"),
+	CLI_NUM(struct sam_ee_ctrl, clear_all, "clr_all"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sam_eex[] = {
+	CLI_NUM(struct raw_sam_ee, eex_type, "eex_type"),
+	CLI_NUM(struct raw_sam_ee, raw_sam_ee[0], "eex_word0"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_NUM(struct sa_match_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_match_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_match_fca, drop_non_reserved, "drop_nonres"),
+	CLI_NUM(struct sa_match_fca, flow_crypt_auth, "crypt_auth"),
+	CLI_NUM(struct sa_match_fca, drop_action, "drop_act"),
+	CLI_NUM(struct sa_match_fca, sa_index, "sa_index"),
+	CLI_NUM(struct sa_match_fca, replay_protect, "rep_protect"),
+	CLI_NUM(struct sa_match_fca, sa_in_use, "sa_inuse"),
+	CLI_NUM(struct sa_match_fca, validate_frames, "validate_level"),
+	CLI_NUM(struct sa_match_fca, iv, "ivl_mode"),
+	CLI_NUM(struct sa_match_fca, icv_verify, "verify_icv"),
+	CLI_NUM(struct sa_match_fca, crypt_auth_bypass_len, "ca_bp_len"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_NUM(struct seq_num_thr, sn_threshold, "sn_thr"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_NUM(struct transform_rec, ccw.ca_type, "ca_type"),
+	CLI_AESKEY(struct transform_rec, cp.key, "key"),
+	CLI_KEY(struct transform_rec, cp.sci, "sci"),
+	CLI_NUM(struct transform_rec, pn_rc.seq_num, "seq_num"),
+	CLI_KEY(struct transform_rec, cp.c_salt.salt, "salt"),
+	CLI_KEY(struct transform_rec, cp.c_salt.s_sci, "short_sci"),
+	CLI_NUM(struct transform_rec, pn_rc.mask, "rep_window"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_pn[] = {
+	CLI_NUM(struct sa_current_pn, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sa_stats[] = {
+	CLI_NUM(struct egr_sa_stats, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sam_fca[] = {
+	CLI_NUM(struct sam_pkt_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sam_rule[] = {
+	CLI_NUM(struct raw_sam_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_tr[] = {
+	CLI_NUM(struct raw_trans_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_cc_rule[] = {
+	CLI_NUM(struct icc_match_param, icc_index, "icc_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_pn[] = {
+	CLI_NUM(struct sa_current_pn, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sa_stats[] = {
+	CLI_NUM(struct ing_sa_stats, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sam_fca[] = {
+	CLI_NUM(struct sam_pkt_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sam_rule[] = {
+	CLI_NUM(struct raw_sam_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_tr[] = {
+	CLI_NUM(struct raw_trans_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
+
+struct cli_harvest_args {
+	struct frame_octet_thr thr;
+	u32 events;
+	u32 timeout;
+	char *gpio;
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_harvest_stats[] = {
+	CLI_NUM(struct cli_harvest_args, thr.frame_threshold, "frame_thr"),
+	CLI_NUM(struct cli_harvest_args, thr.octet_threshold, "octet_thr"),
+	CLI_NUM_DEF(struct cli_harvest_args, events, "events", 1),
+	CLI_NUM_DEF(struct cli_harvest_args, timeout, "timeout", 1000),
+	CLI_STR(struct cli_harvest_args, gpio, "gpio"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_update_egr_sa_cw[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_NUM(struct transform_rec, ccw.ca_type, "ca_type"),
+	CLI_NUM(struct transform_rec, ccw.sn_type, "sn_type"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index, "next_sa_ind"),
+	CLI_NUM(struct transform_rec, sa_update.sa_expired_irq, "sa_expirq"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index_valid, "sa_indvalid"),
+	CLI_NUM(struct transform_rec, sa_update.flow_index, "flow_index"),
+	CLI_NUM(struct transform_rec, sa_update.sa_ind_update_en, "sa_indupen"),
+	CLI_PARAM_END
+};
+
+/*
+ * Command registry. Commands are dispatched by exact, case-insensitive
+ * name with a binary search over these tables, so a command whose name
+ * is a prefix of another (gpy2xx_usxgmii_vr_reset vs.
+ * gpy2xx_usxgmii_vr_reset_sts) can no longer shadow it. Keep the lists
+ * sorted; each entry needs a matching case in gpy211_main() or
+ * gpy2xx_msec_main(), entries compiled out fall to "Command Not Supported".
+ * X(name, params, brief, desc): params is the cli_param schema or NULL when
+ * the handler takes no or hand-parsed parameters, brief is the help line
+ * and desc the parameter description shown below the generated synopsis.
+ */
+#define GPY211_CMD_LIST(X) \
+	X(gpy2xx_abist_read, NULL, \
+	  "Read analog self-test (ABIST) result - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_abist_start, cli_p_gpy2xx_abist_start, \
+	  "Start analog self-test (ABIST) - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_ads_cfg, cli_p_gpy2xx_ads_cfg, \
+	  "Configure Auto-Down-Speed", \
+	  "advertise_enable:  0 Disable / 1 Enable\n" \
+	  "NBaseT_ds_enable:  0 Disable / 1 Enable\n" \
+	  "downshift_cnt_thr: value (5bits)\n" \
+	  "force_reset:       0/1\n" \
+	  "rst_cntdown_timer: value (8bits)\n") \
+	X(gpy2xx_ads_detected, NULL, \
+	  "Get auto-downspeed event", \
+	  NULL) \
+	X(gpy2xx_ads_get, NULL, \
+	  "Get Auto-Down-Speed", \
+	  NULL) \
+	X(gpy2xx_aneg_done, NULL, \
+	  "Get auto-negotiation status", \
+	  NULL) \
+	X(gpy2xx_cdiag_read, NULL, \
+	  "Read cable diagnostic result - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_cdiag_start, NULL, \
+	  "Start cable diagnostic - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_cdiag_stop, NULL, \
+	  "Stop cable diagnostic test", \
+	  NULL) \
+	X(gpy2xx_config_advert, cli_p_gpy2xx_config_advert, \
+	  "Advertise auto-negotiation parameters", \
+	  "  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n" \
+	  "               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n" \
+	  "               Autoneg|Pause|Asym_Pause\n") \
+	X(gpy2xx_config_aneg, cli_p_gpy2xx_config_aneg, \
+	  "Restart auto-negotiation or force link", \
+	  "  autoneg:     true/false\n" \
+	  "  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n" \
+	  "               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n" \
+	  "               Autoneg|Pause|Asym_Pause\n" \
+	  "  speed:       10/100/1000/2500\n" \
+	  "  duplex:      full/half\n" \
+	  "  pause:       true/false\n" \
+	  "  asym_pause:  true/false\n") \
+	X(gpy2xx_errcnt_cfg, cli_p_gpy2xx_errcnt_cfg, \
+	  "Configure errors/events to be counted", \
+	  "  errcountmode: 0 - receive errors\n" \
+	  "                1 - receive frames\n" \
+	  "                2 - ESD errors\n" \
+	  "                3 - SSD errors\n" \
+	  "                4 - transmit errors\n" \
+	  "                5 - transmit frames\n" \
+	  "                6 - collision events\n" \
+	  "                8 - link down events\n" \
+	  "                9 - auto-downspeed events\n") \
+	X(gpy2xx_errcnt_read, NULL, \
+	  "Read error/event counter", \
+	  NULL) \
+	X(gpy2xx_extin_clr, cli_p_gpy2xx_extin_clr, \
+	  "Clear external interrupt event", \
+	  "  std_istat:   0x0001 - link state change\n" \
+	  "               0x0002 - link speed change\n" \
+	  "               0x0004 - duplex mode change\n" \
+	  "               0x0008 - MDI/MDIX crossover change\n" \
+	  "               0x0020 - MDI polarity change\n" \
+	  "               0x0040 - link's auto-downspeed change\n" \
+	  "               0x0100 - SyncE lost of reference clock\n" \
+	  "               0x0200 - mailbox transaction complete\n" \
+	  "               0x0400 - auto-negotiation complete\n" \
+	  "               0x0800 - auto-negotiation error\n" \
+	  "               0x1000 - next page transmitted\n" \
+	  "               0x2000 - next page received\n" \
+	  "               0x4000 - master/slave resolution error\n" \
+	  "               0x8000 - wake-on-lan event\n") \
+	X(gpy2xx_extin_get, NULL, \
+	  "Get external interrupt event mask", \
+	  NULL) \
+	X(gpy2xx_extin_mask, cli_p_gpy2xx_extin_mask, \
+	  "Enable/disable external interrupt event", \
+	  "  stdImask:  	0x0001 - link state change\n" \
+	  "               0x0002 - link speed change\n" \
+	  "               0x0004 - duplex mode change\n" \
+	  "               0x0008 - MDI/MDIX crossover change\n" \
+	  "               0x0010 - MDI polarity change\n" \
+	  "               0x0020 - link's auto-downspeed change\n" \
+	  "               0x0100 - SyncE lost of reference clock\n" \
+	  "               0x0200 - mailbox transaction complete\n" \
+	  "               0x0400 - auto-negotiation complete\n" \
+	  "               0x0800 - auto-negotiation error\n" \
+	  "               0x1000 - next page transmitted\n" \
+	  "               0x2000 - next page received\n" \
+	  "               0x4000 - master/slave resolution error\n" \
+	  "               0x8000 - wake-on-lan event\n" \
+	  "  extImask:	0x0002 - LPI interrupt\n" \
+	  "				0x0008 - time stamp FIFO interrupt\n" \
+	  "				0x0010 - MACSEC egress/ingress Interrupt\n") \
+	X(gpy2xx_get_phy_id, NULL, \
+	  "Read PHY/Chip/Firmware/Driver version number", \
+	  NULL) \
+	X(gpy2xx_gmacf_cfg, cli_p_gpy2xx_gmacf_cfg, \
+	  "Set GMAC-Full's basic config info", \
+	  "  reEn:       dis/en\n" \
+	  "  teEn:       dis/en\n" \
+	  "  preambLen:  0 - 7 bytes of preamble\n" \
+	  "			   1 - 5 bytes of preamble\n" \
+	  "			   2 - 3 bytes of preamble\n" \
+	  "  lbmEn:      dis/en\n" \
+	  "  fdupEn:     dis/en\n" \
+	  "  macSpeed:   0 - 1G\n" \
+	  "			   1 - 2.5G\n" \
+	  "			   2 - 10M\n" \
+	  "			   3 - 100MG\n" \
+	  "  rcWrite1:   dis/en\n") \
+	X(gpy2xx_gmacf_count_acc, cli_p_gpy2xx_gmacf_count_acc, \
+	  "Accumulate GMAC-Full's Rx/Tx counters into 64-bit totals", \
+	  "  interval:   update interval in ms (default and max: wrap-safe interval at link speed)\n" \
+	  "  count:      number of updates (default 1)\n" \
+	  "  freeze:     freeze counters while reading (default 0)\n") \
+	X(gpy2xx_gmacf_count_ctrl_cfg, cli_p_gpy2xx_gmacf_count_ctrl_cfg, \
+	  "Set GMAC-Full's Rx/Tx counters control info", \
+	  "  rstCnt:     dis/en\n" \
+	  "  stopRoll:   dis/en\n" \
+	  "  conRead:    dis/en\n" \
+	  "  frzCnt:     dis/en\n" \
+	  "  pstCnt:     dis/en\n" \
+	  "  psthFull:   dis/en\n" \
+	  "  cntbcDrop:  dis/en\n") \
+	X(gpy2xx_gmacf_count_ctrl_get, NULL, \
+	  "Get GMAC-Full's counters control info", \
+	  NULL) \
+	X(gpy2xx_gmacf_count_get, NULL, \
+	  "Get GMAC-Full's Rx/Tx counters", \
+	  NULL) \
+	X(gpy2xx_gmacf_count_imask_cfg, cli_p_gpy2xx_gmacf_count_imask_cfg, \
+	  "Set GMAC-Full's counters interrupt mask", \
+	  "  txGb:     dis/en\n" \
+	  "  txUflow:  dis/en\n" \
+	  "  txGood:   dis/en\n" \
+	  "  txOsize:  dis/en\n" \
+	  "  rxGb:     dis/en\n" \
+	  "  rxCrc:    dis/en\n" \
+	  "  rxUsize:  dis/en\n" \
+	  "  rxOsize:  dis/en\n") \
+	X(gpy2xx_gmacf_count_imask_get, NULL, \
+	  "Get GMAC-Full's counters interrupt mask", \
+	  NULL) \
+	X(gpy2xx_gmacf_count_istat_get, NULL, \
+	  "Get GMAC-Full's counters interrupt status", \
+	  NULL) \
+	X(gpy2xx_gmacf_debug_info_get, NULL, \
+	  "Get GMAC-Full's debug info", \
+	  NULL) \
+	X(gpy2xx_gmacf_get, NULL, \
+	  "Get GMAC-Full's basic config info", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_cfg, cli_p_gpy2xx_gmacf_lpi_cfg, \
+	  "Set PM GMAC-Full LPI configuration", \
+	  "  lpintEn:    dis/en\n" \
+	  "  lpiEn:      dis/en\n" \
+	  "  linkUp:     dis/en\n" \
+	  "  txautoEn:   dis/en\n" \
+	  "  timerEn:    dis/en\n" \
+	  "  clkStop:    dis/en\n" \
+	  "  ticTime:    value\n" \
+	  "  twTime:     value\n" \
+	  "  lsTime:     value\n" \
+	  "  entryTime:  value\n") \
+	X(gpy2xx_gmacf_lpi_count_get, NULL, \
+	  "Get GMAC-Full's LPI counters", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_get, NULL, \
+	  "Get PM GMAC-Full LPI configuration", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_imask_cfg, cli_p_gpy2xx_gmacf_lpi_imask_cfg, \
+	  "Set GMAC-Full's LPI interrupt mask", \
+	  "  rxUsc:  dis/en\n" \
+	  "  rxTrc:  dis/en\n" \
+	  "  txUsc:  dis/en\n" \
+	  "  txTrc:  dis/en\n") \
+	X(gpy2xx_gmacf_lpi_imask_get, NULL, \
+	  "Get GMAC-Full's LPI interrupt mask", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_istat_get, NULL, \
+	  "Get GMAC-Full's LPI interrupt status", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_stat_get, NULL, \
+	  "Get GMAC-Full LPI status", \
+	  NULL) \
+	X(gpy2xx_gmacf_pkt_cfg, cli_p_gpy2xx_gmacf_pkt_cfg, \
+	  "Set GMAC-Full's packet config info", \
+	  "  jumboEn:    dis/en\n" \
+	  "  jabberDis:  dis/en\n" \
+	  "  wdogDis:    dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n" \
+	  "  sup2kp:     dis/en\n" \
+	  "  macIpg:     0 - 12 Bytes\n" \
+	  "  	           1 - 11 Bytes\n" \
+	  "  	           2 - 10 Bytes\n" \
+	  "  	           3 - 09 Bytes\n" \
+	  "  	           4 - 08 Bytes\n" \
+	  "  	           5 - 07 Bytes\n" \
+	  "  	           6 - 06 Bytes\n" \
+	  "  	           7 - 05 Bytes\n") \
+	X(gpy2xx_gmacf_pkt_filter_cfg, cli_p_gpy2xx_gmacf_pkt_filter_cfg, \
+	  "Set GMAC-Full's packet filter control info", \
+	  "  prEn:       dis/en\n" \
+	  "  passAmc:    dis/en\n" \
+	  "  blockBc:    dis/en\n" \
+	  "  passCtrl:   0 - Block all control packets\n" \
+	  "			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n" \
+	  "			   2 - Forwards all control packets even if they fail the Address filter\n" \
+	  "			   3 - Forwards the control packets that pass the Address filter\n" \
+	  "  safltrEn:   dis/en\n" \
+	  "  rxAll:      dis/en\n") \
+	X(gpy2xx_gmacf_pkt_filter_get, NULL, \
+	  "Get GMAC-Full's packet filter control info", \
+	  NULL) \
+	X(gpy2xx_gmacf_pkt_get, NULL, \
+	  "Get GMAC-Full's packet config info", \
+	  NULL) \
+	X(gpy2xx_gmacf_pm_cfg, cli_p_gpy2xx_gmacf_pm_cfg, \
+	  "Set PM GMAC-Full configuration", \
+	  "  crcPad:     0 - Insert both CRC and Paddding\n" \
+	  "			   1 - Insert CRC only but no Paddding\n" \
+	  "			   2 - Do not insert CRC or Paddding\n" \
+	  "			   3 - Replace CRC but no Paddding\n" \
+	  "  txErr:      dis/en\n" \
+	  "  bigEndian:  dis/en\n") \
+	X(gpy2xx_gmacf_pm_get, NULL, \
+	  "Get PM GMAC-Full configuration", \
+	  NULL) \
+	X(gpy2xx_gmacl_cfg, cli_p_gpy2xx_gmacl_cfg, \
+	  "Set GMAC-Lite's basic config info", \
+	  "  reEn:       dis/en\n" \
+	  "  teEn:       dis/en\n" \
+	  "  preambLen:  0 - 7 bytes of preamble\n" \
+	  "			   1 - 5 bytes of preamble\n" \
+	  "			   2 - 3 bytes of preamble\n" \
+	  "  lbmEn:      dis/en\n" \
+	  "  fdupEn:     dis/en\n" \
+	  "  macSpeed:   0 - 1G\n" \
+	  "			   1 - 2.5G\n" \
+	  "			   2 - 10M\n" \
+	  "			   3 - 100MG\n" \
+	  "  rcWrite1:   dis/en\n") \
+	X(gpy2xx_gmacl_get, NULL, \
+	  "Get GMAC-Lite's basic config info", \
+	  NULL) \
+	X(gpy2xx_gmacl_lpi_cfg, cli_p_gpy2xx_gmacl_lpi_cfg, \
+	  "Set PM GMAC-Lite LPI configuration", \
+	  "  lpintEn:    dis/en\n" \
+	  "  lpiEn:      dis/en\n" \
+	  "  linkUp:     dis/en\n" \
+	  "  txautoEn:   dis/en\n" \
+	  "  timerEn:    dis/en\n" \
+	  "  clkStop:    dis/en\n" \
+	  "  ticTime:    value\n" \
+	  "  twTime:     value\n" \
+	  "  lsTime:     value\n" \
+	  "  entryTime:  value\n") \
+	X(gpy2xx_gmacl_lpi_get, NULL, \
+	  "Get PM GMAC-Lite LPI configuration", \
+	  NULL) \
+	X(gpy2xx_gmacl_lpi_stat_get, NULL, \
+	  "Get GMAC-Lite LPI status", \
+	  NULL) \
+	X(gpy2xx_gmacl_pause_cfg, cli_p_gpy2xx_gmacl_pause_cfg, \
+	  "Set GMAC-Lite's Pause configuration", \
+	  "  fcBusy:   dis/en\n" \
+	  "  gmaclFc:  dis/en\n" \
+	  "  txfcEn:   dis/en\n" \
+	  "  plThresh: 0 - PT-4 slot times\n" \
+	  "			 1 - PT-28 slot times\n" \
+	  "			 2 - PT-36 slot times\n" \
+	  "			 3 - PT-144 slot times\n" \
+	  "			 4 - PT-256 slot times\n" \
+	  "			 5 - PT-512 slot times\n" \
+	  "  zqPause:	 dis/en\n" \
+	  "  pauseTime:value\n" \
+	  "  pauseMac: value\n" \
+	  "  paThresh: value\n" \
+	  "  pdThresh: value\n") \
+	X(gpy2xx_gmacl_pause_get, NULL, \
+	  "Get GMAC-Lite's Pause configuration", \
+	  NULL) \
+	X(gpy2xx_gmacl_pkt_cfg, cli_p_gpy2xx_gmacl_pkt_cfg, \
+	  "Set GMAC-Lite's packet config info", \
+	  "  jumboEn:    dis/en\n" \
+	  "  jabberDis:  dis/en\n" \
+	  "  wdogDis:    dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n" \
+	  "  sup2kp:     dis/en\n" \
+	  "  macIpg:     0 - 12 Bytes\n" \
+	  "  	           1 - 11 Bytes\n" \
+	  "  	           2 - 10 Bytes\n" \
+	  "  	           3 - 09 Bytes\n" \
+	  "  	           4 - 08 Bytes\n" \
+	  "			   5 - 07 Bytes\n" \
+	  "			   6 - 06 Bytes\n" \
+	  "			   7 - 05 Bytes\n") \
+	X(gpy2xx_gmacl_pkt_filter_cfg, cli_p_gpy2xx_gmacl_pkt_filter_cfg, \
+	  "Set GMAC-Lite's packet filter control info", \
+	  "  prEn:       dis/en\n" \
+	  "  passAmc:    dis/en\n" \
+	  "  blockBc:    dis/en\n" \
+	  "  passCtrl:   0 - Block all control packets\n" \
+	  "			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n" \
+	  "			   2 - Forwards all control packets even if they fail the Address filter\n" \
+	  "			   3 - Forwards the control packets that pass the Address filter\n" \
+	  "  safltrEn:   dis/en\n" \
+	  "  rxAll:      dis/en\n") \
+	X(gpy2xx_gmacl_pkt_filter_get, NULL, \
+	  "Get GMAC-Lite's packet filter control info", \
+	  NULL) \
+	X(gpy2xx_gmacl_pkt_get, NULL, \
+	  "Get GMAC-Lite's packet config info", \
+	  NULL) \
+	X(gpy2xx_gmacl_pm_cfg, cli_p_gpy2xx_gmacl_pm_cfg, \
+	  "Set PM GMAC-Lite configuration", \
+	  "  crcPad:     0 - Insert both CRC and Paddding\n" \
+	  "			   1 - Insert CRC only but no Paddding\n" \
+	  "			   2 - Do not insert CRC or Paddding\n" \
+	  "			   3 - Replace CRC but no Paddding\n" \
+	  "  txErr:      dis/en\n" \
+	  "  bigEndian:  dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n") \
+	X(gpy2xx_gmacl_pm_get, NULL, \
+	  "Get PM GMAC-Lite configuration", \
+	  NULL) \
+	X(gpy2xx_gmacx_bm_cfg, cli_p_gpy2xx_gmacx_bm_cfg, \
+	  "Set PM's Buffer configuration", \
+	  "  sb0Start:   value\n" \
+	  "  sb0End:     value\n" \
+	  "  sb0Pthresh: value\n" \
+	  "  sb1Start:   value\n" \
+	  "  sb1End:	   value\n" \
+	  "  sb1Pthresh: value\n") \
+	X(gpy2xx_gmacx_bm_get, NULL, \
+	  "Get PM's Buffer configuration", \
+	  NULL) \
+	X(gpy2xx_gmacx_bm_status_get, NULL, \
+	  "Get PMs buffer status", \
+	  NULL) \
+	X(gpy2xx_gmacx_pm_hw_reset, NULL, \
+	  "Set PM lavel HW reset", \
+	  NULL) \
+	X(gpy2xx_gmacx_pm_pdi_cfg, cli_p_gpy2xx_gmacx_pm_pdi_cfg, \
+	  "Set PM PDI configuration", \
+	  "  bpMac:      dis/en\n" \
+	  "  bpMsec:     dis/en\n" \
+	  "  dropCrc:    dis/en\n" \
+	  "  dropPerr:   dis/en\n" \
+	  "  dropSfail:  dis/en\n" \
+	  "  dropClass:  dis/en\n" \
+	  "  cust3gEn:   dis/en\n" \
+	  "  sgmiiLb:    dis/en\n") \
+	X(gpy2xx_gmacx_pm_pdi_get, NULL, \
+	  "Get PM PDI configuration", \
+	  NULL) \
+	X(gpy2xx_gpio_cfg, cli_p_gpy2xx_gpio_cfg, \
+	  "Configure GPIO pin", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n" \
+	  "  gpioflags: GPIO configuration flags\n") \
+	X(gpy2xx_gpio_get, cli_p_gpy2xx_gpio_get, \
+	  "Get GPIO pin configuration", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n") \
+	X(gpy2xx_gpio_input, cli_p_gpy2xx_gpio_input, \
+	  "Get GPIO pin input value (low/high)", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n") \
+	X(gpy2xx_gpio_output, cli_p_gpy2xx_gpio_output, \
+	  "Configure GPIO pin output value (low/high)", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n" \
+	  "  gpioflags: 0 - low, 2 - high\n") \
+	X(gpy2xx_led_br_cfg, cli_p_gpy2xx_led_br_cfg, \
+	  "Configure LED brightness", \
+	  "For internal use.\n" \
+	  "  brightMode: 0 - constant level at max brightness\n" \
+	  "              1 - constant level given by brightlvlmax\n" \
+	  "  brightlvlMin: (0 to 15) - min level of brightness\n" \
+	  "  brightlvlMax: (0 to 15) - max level of brightness\n" \
+	  "  swEdgeDetect: 0 - LED switch edge detection on falling edge\n" \
+	  "				 1 - LED switch edge detection on rising edge\n") \
+	X(gpy2xx_led_br_get, NULL, \
+	  "Get LED brightness configuration", \
+	  "For internal use.\n") \
+	X(gpy2xx_led_if_cfg, cli_p_gpy2xx_led_if_cfg, \
+	  "Configure LED", \
+	  "  ledid:        0~3\n" \
+	  "  colormode:    internal use\n" \
+	  "  slowblinksrc: event to trigger slow blink, refer to below trigger table\n" \
+	  "  fastblinksrc: event to trigger fast blink, refer to below trigger table\n" \
+	  "  constantlyon: event to trigger constant on, refer to below trigger table\n" \
+	  "  pulseflags:   pulse on LED trigger by combination of following events\n" \
+	  "                1 - transmit activity\n" \
+	  "                2 - receive activity\n" \
+	  "                4 - collision\n" \
+	  "Trigger Table\n" \
+	  "   0 - disable\n" \
+	  "   1 - 10Mbps\n" \
+	  "   2 - 100Mbps\n" \
+	  "   4 - 1000Mbps\n" \
+	  "   8 - 2500Mbps link\n") \
+	X(gpy2xx_led_if_get, cli_p_gpy2xx_led_if_get, \
+	  "Get LED configuration", \
+	  "  ledid:        0~3\n") \
+	X(gpy2xx_led_top_cfg, cli_p_gpy2xx_led_top_cfg, \
+	  "LED general configuration", \
+	  "For internal use.\n" \
+	  "  complexscan:  in which state the 'inverse complex SCAN' is activated, refer to below state table\n" \
+	  "  complexblink: in which state the 'complex blinking' is activated, refer to below state table\n" \
+	  "  inversescan:  in which state the 'complex SCAN' is activated, refer to below state table\n" \
+	  "  fastblinkfreq:the slow-blinking frequency, refer to below frequency table\n" \
+	  "  slowblinkfreq:the fast-blinking frequency, refer to below frequency table\n" \
+	  "state table\n" \
+	  "	0 - disable\n" \
+	  "	1 - Link is UP\n" \
+	  "	2 - Device is in power down\n" \
+	  "	3 - Device is in EEE mode\n" \
+	  "	4 - ANEG is running\n" \
+	  "	5 - ABIST is running\n" \
+	  "	6 - CDIAG is running\n" \
+	  "	7 - TEST mode is running\n" \
+	  "frequency table\n" \
+	  "	0 - 2 Hz blinking frequency\n" \
+	  "	1 - 4 Hz blinking frequency\n" \
+	  "	2 - 8 Hz blinking frequency\n" \
+	  "	3 - 16 Hz blinking frequency\n") \
+	X(gpy2xx_led_top_get, NULL, \
+	  "Get LED general configuration", \
+	  "For internal use.\n") \
+	X(gpy2xx_loopback_cfg, cli_p_gpy2xx_loopback_cfg, \
+	  "Configure near/far end loopback", \
+	  "  loopbackmode: 0 - disable test loop\n" \
+	  "                1 - GMII near end test loop\n" \
+	  "                2 - PCS far end test loop\n" \
+	  "                3 - DEC (Digital Echo Canceler) test loop\n" \
+	  "                4 - MDI (RJ45 near end) test loop\n" \
+	  "                5 - far end test loop\n" \
+	  "                8 - GMII near end test loop - LB=1\n") \
+	X(gpy2xx_macsec_disable, NULL, \
+	  "Unconfigure Smart-AZ to disable MACsec", \
+	  NULL) \
+	X(gpy2xx_macsec_enable, cli_p_gpy2xx_macsec_enable, \
+	  "Configure Smart-AZ to enable MACsec", \
+	  "  dropCrc:    dis/en\n" \
+	  "  dropPerr:   dis/en\n" \
+	  "  dropSfail:  dis/en\n" \
+	  "  dropClass:  dis/en\n") \
+	X(gpy2xx_mbox_read16, cli_p_gpy2xx_mbox_read16, \
+	  "PHY's Mbox 16-bit wide register read", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_mbox_read32, cli_p_gpy2xx_mbox_read32, \
+	  "PHY's Mbox 32-bit wide register read", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_mbox_write16, cli_p_reg_write, \
+	  "PHY's Mbox 16-bit wide register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_mbox_write32, cli_p_reg_write, \
+	  "PHY's Mbox 32-bit wide register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_mgr_scan, cli_p_gpy2xx_mgr_scan, \
+	  "Scan MDIO buses and bring up all PHYs in parallel", \
+	  "  xgmacMask:  MDIO masters to scan, bit per MAC index (default 0x4)\n" \
+	  "  addrMask:   PHY addresses to scan, bit per address (default 0xFFFFFFFF)\n" \
+	  "  smdioAddr:  pin-strapped SMDIO address (default 0)\n") \
+	X(gpy2xx_mon_link, cli_p_gpy2xx_mon_link, \
+	  "Monitor link and PHY events on the interrupt line", \
+	  "  events:     number of events to service (default 1)\n" \
+	  "  timeout:    event wait/poll interval in ms (default 1000)\n" \
+	  "  gpio:       sysfs GPIO value file of PHY interrupt line\n" \
+	  "  uio:        UIO device of PHY interrupt line,\n" \
+	  "              interrupt status is polled if neither is given\n") \
+	X(gpy2xx_pcs_status_read, NULL, \
+	  "Get PCS status", \
+	  NULL) \
+	X(gpy2xx_pm_freq_tune, cli_p_gpy2xx_pm_freq_tune, \
+	  "Tune the frequency of MACs within GPY in USXGMII Mode", \
+	  "  ppm: 0 - MACs operate at frequency+000ppm\n" \
+	  "		1 - MACs operate at frequency+100ppm\n" \
+	  "		2 - MACs operate at frequency+300ppm\n") \
+	X(gpy2xx_poll_reset, NULL, \
+	  "Poll soft reset status", \
+	  NULL) \
+	X(gpy2xx_ptp_adjfreq, cli_p_gpy2xx_ptp_adjfreq, \
+	  "Adjust frequency of hardware clock", \
+	  "  pbbTime: value\n") \
+	X(gpy2xx_ptp_adjtime, cli_p_gpy2xx_ptp_adjtime, \
+	  "Adjust the system timestamp", \
+	  "  deltaTime: 	value\n") \
+	X(gpy2xx_ptp_disable, NULL, \
+	  "Disable and configure PTP (1588) function", \
+	  NULL) \
+	X(gpy2xx_ptp_drain_ts, NULL, \
+	  "Get all pending RX and TX packet timestamps and CRC", \
+	  NULL) \
+	X(gpy2xx_ptp_enable, cli_p_gpy2xx_ptp_enable, \
+	  "Enable and configure PTP (1588) function", \
+	  "  enPhyTxTs: 	 value\n" \
+	  "  enPhyRxTs: 	 value\n" \
+	  "  enTxOstCor: 	 value\n" \
+	  "  txPtpOffset:  value\n" \
+	  "  txPtpProto: 	 value\n" \
+	  "  txOstCorTime: value\n") \
+	X(gpy2xx_ptp_fifostat, NULL, \
+	  "Get timestamp FIFO status", \
+	  NULL) \
+	X(gpy2xx_ptp_getcfg, NULL, \
+	  "Get PTP (1588) configuration", \
+	  NULL) \
+	X(gpy2xx_ptp_getcrosststamp, cli_p_gpy2xx_ptp_getcrosststamp, \
+	  "Provides the system timestamp bracketed by host clock samples", \
+	  "  samples:	1~25\n" \
+	  "  sysClk:	0-realtime, 1-monotonic, 2-monotonic raw\n") \
+	X(gpy2xx_ptp_getrxts, NULL, \
+	  "Get RX packet timestamp status and CRC", \
+	  NULL) \
+	X(gpy2xx_ptp_gettime, NULL, \
+	  "Provides the system timestamp", \
+	  NULL) \
+	X(gpy2xx_ptp_gettxts, NULL, \
+	  "Get TX packet timestamp and CRC status and CRC", \
+	  NULL) \
+	X(gpy2xx_ptp_resetfifo, NULL, \
+	  "Resets the timestamp FIFO status", \
+	  NULL) \
+	X(gpy2xx_ptp_set_ppsctrl, cli_p_gpy2xx_ptp_set_ppsctrl, \
+	  "Configures the timestamp PPS control params", \
+	  "  ppsCtrlLow: 	value\n" \
+	  "  targetSec:  	value\n" \
+	  "  targetNsc: 	value\n" \
+	  "  ppsInterval:	value\n" \
+	  "  ppsWidth: 	value\n") \
+	X(gpy2xx_ptp_set_ptoctrl, cli_p_gpy2xx_ptp_set_ptoctrl, \
+	  "Configures the timestamp PTO control params", \
+	  "  ptoCtrlLow: 	value\n" \
+	  "  srcPortID:  	value\n" \
+	  "  logmLvlLow: 	value\n" \
+	  "  logmLvlHi:	value\n") \
+	X(gpy2xx_ptp_set_tsctrl, cli_p_gpy2xx_ptp_set_tsctrl, \
+	  "Configures the timestamp control, second/sub-second increment value", \
+	  "  enEvntMsg:  	dis/en\n" \
+	  "  enMstrMsg: 	dis/en\n" \
+	  "  snapType: 	value\n" \
+	  "  gpcSel: 	value\n") \
+	X(gpy2xx_ptp_settime, cli_p_gpy2xx_ptp_settime, \
+	  "Initialize the system timestamp", \
+	  "  initSec: value\n" \
+	  "  initNsec:value\n") \
+	X(gpy2xx_ptp_txtsstat, NULL, \
+	  "Get Tx timestamp status", \
+	  NULL) \
+	X(gpy2xx_pvt_get, NULL, \
+	  "Get SENSOR temparature", \
+	  NULL) \
+	X(gpy2xx_read, cli_p_gpy2xx_read, \
+	  "Read MDIO Clause 22 registers", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_read_fw_info, NULL, \
+	  "Get FW info (detail)", \
+	  NULL) \
+	X(gpy2xx_read_mmd, cli_p_reg_read_mmd, \
+	  "Read MDIO Clause 45 MMD registers", \
+	  "  devtype: MMD device type\n" \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_read_status, NULL, \
+	  "Get link status (detail)", \
+	  NULL) \
+	X(gpy2xx_reg_decode, cli_p_gpy2xx_reg_decode, \
+	  "Decode register value(s) into fields", \
+	  "  space:   mdio - MDIO/MMD registers, regaddr is devad << 21 | reg << 1 (default)\n" \
+	  "           pdi - PDI registers as used with gpy2xx_mbox_read16/32, map of\n" \
+	  "                 the detected chip family\n" \
+	  "           p31g, p34x - PDI registers of the given chip family\n" \
+	  "  regaddr: register address\n" \
+	  "  reg:     register name, e.g. STD_CTRL\n" \
+	  "  data:    value to decode, the register is read from the PHY if not given\n" \
+	  "  file:    decode \"<addr> <value>\" dumps or REG_RD_PRINT/REG_WR_PRINT\n" \
+	  "           traces, \"-\" for stdin (default space pdi)\n") \
+	X(gpy2xx_restart_aneg, NULL, \
+	  "Enable and restart auto-negotiation", \
+	  NULL) \
+	X(gpy2xx_setup_forced, cli_p_gpy2xx_setup_forced, \
+	  "Configures/forces speed/duplex", \
+	  "  speed:      10/100/1000/2500\n" \
+	  "  duplex:     full/half\n" \
+	  "  pause:      true/false\n" \
+	  "  asym_pause: true/false\n" \
+	  "  mstr_slave: true/false\n") \
+	X(gpy2xx_sgmii_aneg_done, NULL, \
+	  "Check SGMII auto-negotiation status", \
+	  NULL) \
+	X(gpy2xx_sgmii_config_aneg, cli_p_gpy2xx_sgmii_config_aneg, \
+	  "Configure SGMII auto-negotiation", \
+	  "  linkcfg_dir: 0 - SGMII_LINKCFG_TPI / 1 - SGMII_LINKCFG_SGMII\n" \
+	  "  aneg_mode:   1 - SGMII_ANEG_1000BX\n" \
+	  "               2 - SGMII_ANEG_CISCO_PHY\n" \
+	  "               3 - SGMII_ANEG_CISCO_MAC\n" \
+	  "  eee_enable:  0 - disable / 1 - enable\n" \
+	  "  autoneg:     0 - disable / 1 - enable\n" \
+	  "  speed:       10/100/1000/2500\n" \
+	  "  fixed2G5:    0 - TPI speed / 1 - force 2.5G\n" \
+	  "  duplex:      DUPLEX_FULL/DUPLEX_HALF\n") \
+	X(gpy2xx_sgmii_opmode, cli_p_gpy2xx_sgmii_opmode, \
+	  "Configure SGMII operation mode", \
+	  "gpy211_sgmii_opmode <opMode=?>\n" \
+	  "  opMode: 0 - normal oeration\n" \
+	  "		   1 - power down\n" \
+	  "		   2 - loopback\n" \
+	  "		   3 - reset\n") \
+	X(gpy2xx_sgmii_read_status, NULL, \
+	  "Get SGMII link status (detail)", \
+	  NULL) \
+	X(gpy2xx_sgmii_restart_aneg, NULL, \
+	  "Restart SGMII auto-negotiation", \
+	  NULL) \
+	X(gpy2xx_smdio_read, cli_p_gpy2xx_smdio_read, \
+	  "Read internal register (may be disabled by PHY firmware)", \
+	  "smdio_read <regaddr=?>\n" \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_smdio_write, cli_p_reg_write, \
+	  "Write internal register (may be disabled by PHY firmware)", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_soft_reset, NULL, \
+	  "Trigger soft reset via MDIO STD_CTRL", \
+	  NULL) \
+	X(gpy2xx_synce_cfg, cli_p_gpy2xx_synce_cfg, \
+	  "Configure SyncE function", \
+	  "  enSyncE: 	0-disable,	  1-enable\n" \
+	  "  synceRefClk: 0-8KHz,   1-2.048MHz,	2-1.544MHz\n" \
+	  "  masterSlave:	0-slave mode, 1-master mode\n" \
+	  "  dataRate: 	0-1G,		  1-2.5G\n" \
+	  "  gpcSel:		0-GPC1,	1-GPC1,	2-GPC2\n") \
+	X(gpy2xx_synce_get, NULL, \
+	  "Get SyncE configuration", \
+	  NULL) \
+	X(gpy2xx_test_mode_cfg, cli_p_gpy2xx_test_mode_cfg, \
+	  "Set test mode", \
+	  "  testtxmode: 0 - normal operation\n" \
+	  "              1 - Test Mode 1 (Transmit Waveform Test)\n" \
+	  "              2 - Test Mode 2 (Transmit Jitter Test in MASTER Mode)\n" \
+	  "              3 - Test Mode 3 (Transmit Jitter Test in SLAVE Mode)\n" \
+	  "              4 - Test Mode 4 (Transmitter Distortion Test)\n") \
+	X(gpy2xx_topin_cfg, cli_p_gpy2xx_topin_cfg, \
+	  "Configure external interrupt", \
+	  "For internal use.") \
+	X(gpy2xx_topin_clr, cli_p_gpy2xx_topin_clr, \
+	  "Clear external interrupt events", \
+	  "For internal use.\n") \
+	X(gpy2xx_topin_get, cli_p_gpy2xx_topin_get, \
+	  "Get external interrupt configuration", \
+	  "For internal use.\n") \
+	X(gpy2xx_ulp_cfg, cli_p_gpy2xx_ulp_cfg, \
+	  "Configure Ultra Low Power", \
+	  "ulp_enable:  0 Disable / 1 Enable\n" \
+	  "ulp_sta_block:  0 Disable / 1 Enable\n" \
+	  "ulp_exit:  0 Not Exit / 1 Exit ULP\n" \
+	  "master_slice:  Slice to become master <0 to 3>\n") \
+	X(gpy2xx_ulp_get, NULL, \
+	  "Get Ultra Low Power", \
+	  NULL) \
+	X(gpy2xx_uninit, NULL, \
+	  "Clean up GPY211 API", \
+	  NULL) \
+	X(gpy2xx_update_link, NULL, \
+	  "Get link status (up/down)", \
+	  NULL) \
+	X(gpy2xx_usxgmii_alignmentmarker_get, NULL, \
+	  "Get AM_COUNT", \
+	  NULL) \
+	X(gpy2xx_usxgmii_alignmentmarker_set, cli_p_gpy2xx_usxgmii_alignmentmarker_set, \
+	  "Configures AM count", \
+	  "AM Count\n" \
+	  "Valid 0x00 - 0x7FFF\n" \
+	  "	usxgmii_am_count\n") \
+	X(gpy2xx_usxgmii_aneg_rst, NULL, \
+	  "Configures ANEG for Port 0 to 3 (based on phy address)", \
+	  "gpy2xx_usxgmii_aneg_rst  [usxgmii_aneg_disable=?] [usxgmii_force_linkspeed_enable=?] [usxgmii_force_linkspeed=?]  [usxgmii_force_duplex=?] [usxgmii_restart_aneg=?]\n" \
+	  "ANEG configuration\n" \
+	  "aneg enable/disable for port 0 to 3 based on phy addr\n" \
+	  "Valid 1 - disabled / 0 - enabled\n" \
+	  "	usxgmii_aneg_disable\n" \
+	  "restart aneg for port 0 to 3 based on phy addr\n" \
+	  "	usxgmii_restart_aneg\n" \
+	  "force link enable for port 0 to 3 based on phy addr\n" \
+	  "Valid 0 - disabled / 1 - enabled\n" \
+	  "	usxgmii_force_linkspeed\n" \
+	  "force link speed for port 0 to 3 based on phy addr\n" \
+	  "	usxgmii_force_linkspeed\n" \
+	  "		SPEED_10	10\n" \
+	  "		SPEED_100	100\n" \
+	  "		SPEED_1000	1000\n" \
+	  "		SPEED_2500	2500\n" \
+	  "		SPEED_UNKNOWN	-1\n" \
+	  "force duplex for port 0 to 3 based on phy addr\n" \
+	  "Valid 0 - Half duplex / 1 - Full duplex\n" \
+	  "	usxgmii_force_duplex\n") \
+	X(gpy2xx_usxgmii_aneg_sts, NULL, \
+	  "Get Port ANEG status (port 0 to 3 ANEG status based on the phy address)", \
+	  NULL) \
+	X(gpy2xx_usxgmii_loopback_cfg, cli_p_gpy2xx_usxgmii_loopback_cfg, \
+	  "Configures the USXGMII serial and parrallel loop back", \
+	  "Loopback Mode\n" \
+	  "enum mode\n" \
+	  "	USXGMII_LOOPBACK_DISABLE = 0,\n" \
+	  "	USXGMII_LOOPBACK_TX2RX   = 1,\n" \
+	  "	USXGMII_LOOPBACK_RX2TX   = 2,\n") \
+	X(gpy2xx_usxgmii_loopback_get, NULL, \
+	  "Get the USXGMII reach loop back setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_mii_linksts, NULL, \
+	  "Get Port mii linkstatus (port 0 to 3 link status based on the phy address)", \
+	  NULL) \
+	X(gpy2xx_usxgmii_pcs_pma_linksts, NULL, \
+	  "Get PMA and PCS link status", \
+	  NULL) \
+	X(gpy2xx_usxgmii_reach_cfg, cli_p_gpy2xx_usxgmii_reach_cfg, \
+	  "Configures the USXGMII reach customer setting according to master slice (slice 0)", \
+	  "trace_len:         0-short, 1-medium, 2-long, 3-custom\n" \
+	  "tx_eq_main:        0x00 - 0x3F\n" \
+	  "tx_eq_pre:         0x00 - 0x3F\n" \
+	  "tx_eq_post:        0x00 - 0x3F\n" \
+	  "tx_vboost_en:      0 - disable, 1 - enable\n" \
+	  "tx_vboost_lvl:     0x00 - 0x07\n" \
+	  "tx_iboost_lvl:     0x00 - 0x07\n" \
+	  "rx_eq_att_lvl:     0x00 - 0x07\n" \
+	  "rx_eq_vga1_gain:   0x00 - 0x0F\n" \
+	  "rx_eq_vga2_gain:   0x00 - 0x0F\n" \
+	  "rx_eq_ctle_boost:  0x00 - 0x1F\n" \
+	  "rx_eq_ctle_pole:   0x00 - 0x07\n" \
+	  "rx_eq_dfe_tap1:    0x00 - 0xFF\n" \
+	  "rx_afe_adapt_en:	0 - disable, 1 - enable\n" \
+	  "rx_dfe_adapt_en:	0 - disable, 1 - enable\n") \
+	X(gpy2xx_usxgmii_reach_get, NULL, \
+	  "Get the USXGMII reach setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_rx_bert_cfg, cli_p_gpy2xx_usxgmii_rx_bert_cfg, \
+	  "Configures RX bert", \
+	  "rx bert mode configuration\n" \
+	  "enum mode\n" \
+	  "	BERT_PSEUDO_RANDOM_RX = 0\n" \
+	  "	BERT_PRBS31_RX = 1\n" \
+	  "	BERT_PRBS9_RX = 2\n" \
+	  "	BERT_RX_MODE_DISABLE = 3\n") \
+	X(gpy2xx_usxgmii_rx_bert_get, NULL, \
+	  "Get RX bert configuration setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_rx_bert_stat, NULL, \
+	  "Get BERT stats", \
+	  NULL) \
+	X(gpy2xx_usxgmii_tx_bert_cfg, cli_p_gpy2xx_usxgmii_tx_bert_cfg, \
+	  "Configures TX bert", \
+	  "tx bert mode configuration\n" \
+	  "enum mode\n" \
+	  "	BERT_SQUAREWAVE_TX = 0\n" \
+	  "	BERT_PSEUDO_RANDOM_TX = 1\n" \
+	  "	BERT_PRBS31_TX = 2\n" \
+	  "	BERT_PRBS9_TX = 3\n" \
+	  "	BERT_TX_MODE_DISABLE = 4\n" \
+	  "Square Wave Control When square wave test pattern generation is enabled\n" \
+	  "enum nval_sel\n" \
+	  "	BERT_TX_NVAL_SEL_4 = 0\n" \
+	  "	BERT_TX_NVAL_SEL_5 = 1\n" \
+	  "	BERT_TX_NVAL_SEL_6 = 2\n" \
+	  "	BERT_TX_NVAL_SEL_7 = 3\n" \
+	  "	BERT_TX_NVAL_SEL_8 = 4\n" \
+	  "	BERT_TX_NVAL_SEL_9 = 5\n" \
+	  "	BERT_TX_NVAL_SEL_10 = 6\n" \
+	  "	BERT_TX_NVAL_SEL_11 = 7\n" \
+	  "	BERT_TX_NVAL_SEL_UNSUPPORTED = 8\n") \
+	X(gpy2xx_usxgmii_tx_bert_get, NULL, \
+	  "Get TX bert configuration setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_vr_reset, NULL, \
+	  "Trigger VR reset", \
+	  NULL) \
+	X(gpy2xx_usxgmii_vr_reset_sts, NULL, \
+	  "Get VR reset complete status", \
+	  NULL) \
+	X(gpy2xx_wol_cfg, cli_p_gpy2xx_wol_cfg, \
+	  "Configure Wake-On-Lan function", \
+	  "  woloptions:  combination of following flags\n" \
+	  "               0x20 - wake up when receiving magic packet\n" \
+	  "               0x40 - password enabled\n" \
+	  "  wolmac:      6-byte MAC address of magic packet\n" \
+	  "  wolpassword: 6-byte password\n") \
+	X(gpy2xx_wol_get, NULL, \
+	  "Get Wake-On-Lan configuration", \
+	  NULL) \
+	X(gpy2xx_write, cli_p_reg_write, \
+	  "Write MDIO Clause 22 registers", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_write_mmd, cli_p_reg_write_mmd, \
+	  "Write MDIO Clause 45 MMD registers", \
+	  "  devtype: MMD device type\n" \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_xpcs_read16, cli_p_gpy2xx_xpcs_read16, \
+	  "PHY's XPCS 16-bit wide register read", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_xpcs_write16, cli_p_reg_write, \
+	  "PHY's XPCS 16-bit wide register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(pm_ind_read, cli_p_pm_ind_read, \
+	  "PM's indirect register read", \
+	  "  regaddr: register address\n") \
+	X(pm_ind_write, cli_p_reg_write, \
+	  "PM's indirect register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(test_gpy2xx_ptp_set_ppsctrl, cli_p_test_gpy2xx_ptp_set_ppsctrl, \
+	  "Arms a PPS pulse 15s after the current PTP time", \
+	  NULL)
+
+#define MSEC_CMD_LIST(X) \
+	X(gpy2xx_msec_clear_egr_cc_int_stat, cli_p_msec_clear_cc_int_stat, \
+	  "Clear crypto-cores's context, HW / SW interrupt status", \
+	  "  ctx_stat:     value\n" \
+	  "  int_stat:     value\n") \
+	X(gpy2xx_msec_clear_egr_psa_stats_summ, cli_p_gpy2xx_msec_clear_egr_psa_stats_summ, \
+	  "Clears egress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n" \
+	  "  psa_summ0:        value\n") \
+	X(gpy2xx_msec_clear_egr_sa_exp_summ, cli_p_gpy2xx_msec_clear_egr_sa_exp_summ, \
+	  "Clear SA expired summary flags", \
+	  "  saexp_summ0:     value\n") \
+	X(gpy2xx_msec_clear_egr_sam_fca, cli_p_gpy2xx_msec_clear_egr_sam_fca, \
+	  "Clears egress SAM flow control parameters", \
+	  "  flow_index:  value\n") \
+	X(gpy2xx_msec_clear_egr_sam_rule, cli_p_gpy2xx_msec_clear_egr_sam_rule, \
+	  "Clears egress SAM rule parameters", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_clear_egr_stats_summ, cli_p_gpy2xx_msec_clear_egr_stats_summ, \
+	  "Configure egress SA expired/pn-thr/psa summary", \
+	  "  psa_summ0:       value\n" \
+	  "  glb_summ:        value\n") \
+	X(gpy2xx_msec_clear_egr_tr, cli_p_gpy2xx_msec_clear_egr_tr, \
+	  "Clears egress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_clear_ing_cc_int_stat, cli_p_msec_clear_cc_int_stat, \
+	  "Clear crypto-cores's context, HW / SW interrupt status", \
+	  "  ctx_stat:     value\n" \
+	  "  int_stat:     value\n") \
+	X(gpy2xx_msec_clear_ing_psa_stats_summ, cli_p_gpy2xx_msec_clear_ing_psa_stats_summ, \
+	  "Clears ingress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n" \
+	  "  psa_summ0:        value\n") \
+	X(gpy2xx_msec_clear_ing_sam_fca, cli_p_gpy2xx_msec_clear_ing_sam_fca, \
+	  "Clears ingress SAM flow control parameters", \
+	  "  flow_index:  value\n") \
+	X(gpy2xx_msec_clear_ing_sam_rule, cli_p_gpy2xx_msec_clear_ing_sam_rule, \
+	  "Clears ingress SAM rule parameters", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_clear_ing_stats_summ, cli_p_gpy2xx_msec_clear_ing_stats_summ, \
+	  "Configure ingress SA expired/pn-thr/psa summary", \
+	  "  psa_summ0:       value\n" \
+	  "  glb_summ:        value\n") \
+	X(gpy2xx_msec_clear_ing_tr, cli_p_gpy2xx_msec_clear_ing_tr, \
+	  "Clears ingress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_clear_sa_pn_thr_summ, cli_p_gpy2xx_msec_clear_sa_pn_thr_summ, \
+	  "Clear OPP's SA PN threshold summary flags", \
+	  "  pnthr_summ0:     value\n") \
+	X(gpy2xx_msec_config_egr_aic_csr, cli_p_gpy2xx_msec_config_egr_aic_csr, \
+	  "Configures the egress interrupt  controll and status options", \
+	  "  enable_ctrl:		value\n" \
+	  "  ack:    			value\n" \
+	  "  enable_set:    	value\n" \
+	  "  enable_clr:     	value\n") \
+	X(gpy2xx_msec_config_egr_count_ctrl, cli_p_gpy2xx_msec_config_egr_count_ctrl, \
+	  "Configure egress count controls", \
+	  "  rst_all:       value\n" \
+	  "  ctr_saturate:  value\n" \
+	  "  ctr_conr:      value\n" \
+	  "  rst_summary:   value\n") \
+	X(gpy2xx_msec_config_egr_count_incen, cli_p_gpy2xx_msec_config_egr_count_incen, \
+	  "Configure egress counter increment enables", \
+	  "  sa_inc:        value\n" \
+	  "  vlan_inc:	  value\n" \
+	  "  global_inc: 	  value\n") \
+	X(gpy2xx_msec_config_egr_count_secfail, cli_p_gpy2xx_msec_config_egr_count_secfail, \
+	  "Configure egress secfail event trigger enables", \
+	  "  misc_secfail:    value\n" \
+	  "  global_secfail:	value\n") \
+	X(gpy2xx_msec_config_egr_count_thresh, cli_p_gpy2xx_msec_config_egr_count_thresh, \
+	  "Configure egress counter packet and octet thresholds", \
+	  "  frame_thr:	 value\n" \
+	  "  octet_thr:	 value\n") \
+	X(gpy2xx_msec_config_egr_cp_rule, cli_p_gpy2xx_msec_config_egr_cp_rule, \
+	  "Configure engress control packet classification rule", \
+	  "  cpc_index:       value\n" \
+	  "  entry_type:      value\n" \
+	  "  da_mac:          value\n" \
+	  "  da_end:          value\n" \
+	  "  eth_type:        value\n" \
+	  "  cpm_mode:        value\n" \
+	  "  cpm_en:          value\n") \
+	X(gpy2xx_msec_config_egr_misc_ctrl, cli_p_gpy2xx_msec_config_egr_misc_ctrl, \
+	  "Configure egress misc control", \
+	  "  mc_latency:       value\n" \
+	  "  static_bp         value\n" \
+	  "  nm_macsec:        value\n" \
+	  "  validate_frames:  value\n" \
+	  "  sectag_avlan:     value\n") \
+	X(gpy2xx_msec_config_egr_sa_nm_cp, cli_p_gpy2xx_msec_config_egr_sa_nm_cp, \
+	  "Configure egress SA non-match flow control action for control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_egr_sa_nm_ctrl, cli_p_msec_sa_nm_ctrl, \
+	  "Configure egress no-match classifier control", \
+	  "  comp_etype:		dis/en\n" \
+	  "  check_ver 		dis/en\n" \
+	  "  check_kay:		dis/en\n" \
+	  "  check_ce: 		dis/en\n" \
+	  "  check_sc: 		dis/en\n" \
+	  "  check_sl: 		dis/en\n" \
+	  "  check_pn: 		dis/en\n" \
+	  "  msec_eth: 		value\n") \
+	X(gpy2xx_msec_config_egr_sa_nm_ncp, cli_p_gpy2xx_msec_config_egr_sa_nm_ncp, \
+	  "Configure egress SA non-match flow control action for non-control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_egr_sam_eec, cli_p_gpy2xx_msec_config_egr_sam_eec, \
+	  "Configure egress SA match entry enable clear", \
+	  "  sam_ind_set: value\n" \
+	  "  set_single:  value\n" \
+	  "  set_all:     value\n" \
+	  "  sam_ind_clr: value\n" \
+	  "  clr_single:  value\n" \
+	  "  clr_all:     value\n") \
+	X(gpy2xx_msec_config_egr_sam_eex, cli_p_gpy2xx_msec_config_egr_sam_eex, \
+	  "Configure egress SA match entry enable flags", \
+	  "  eex_type:  value\n" \
+	  "  eex_word0: value\n") \
+	X(gpy2xx_msec_config_egr_sam_fca, cli_p_gpy2xx_msec_config_egr_sam_fca, \
+	  "Configure egress SA matching rule's flow control action parameters", \
+	  "  flow_index:	 value\n" \
+	  "  flow_type:	 value\n" \
+	  "  dest_port:	 value\n" \
+	  "  drop_nonres:  value\n" \
+	  "  crypt_auth:	 value\n" \
+	  "  drop_act:	 value\n" \
+	  "  sa_index:	 value\n" \
+	  "  frame_protect:value\n" \
+	  "  sa_inuse:	 value\n" \
+	  "  include_sci:  value\n" \
+	  "  use_es:		 value\n" \
+	  "  use_scb: 	 value\n" \
+	  "  tag_bpsize:	 value\n" \
+	  "  sa_indup:	 value\n" \
+	  "  conf_offset:  value\n" \
+	  "  conf_protect: value\n") \
+	X(gpy2xx_msec_config_egr_sam_rule, cli_p_msec_sam_rule, \
+	  "Configure egress SA match rule parameters", \
+	  "  rule_index:value\n" \
+	  "  sa_mac:    value\n" \
+	  "  da_mac:    value\n" \
+	  "  eth_type:  value\n" \
+	  "  vlan_id:   value\n" \
+	  "  misc:      value\n" \
+	  "  sci:       value\n" \
+	  "  mask:      value\n" \
+	  "  flow_index:value\n") \
+	X(gpy2xx_msec_config_egr_sn_thresh, cli_p_gpy2xx_msec_config_egr_sn_thresh, \
+	  "Configures the egress sequence number threshold", \
+	  "  sn_type:    	value\n" \
+	  "  sn_thr:     	value\n") \
+	X(gpy2xx_msec_config_egr_tr, cli_p_gpy2xx_msec_config_egr_tr, \
+	  "Configure egress transform record", \
+	  "  sa_index:    value\n" \
+	  "  ca_type:     value\n" \
+	  "  an:          value\n" \
+	  "  key:         value\n" \
+	  "  sci:         value\n" \
+	  "  seq_num:        value\n" \
+	  "  salt:        value\n" \
+	  "  short_sci:    value\n" \
+	  "  next_sa_ind:   value\n" \
+	  "  sa_expirq: value\n" \
+	  "  sa_indvalid:  value\n" \
+	  "  flow_index:  value\n" \
+	  "  sa_indupen:  value\n") \
+	X(gpy2xx_msec_config_egr_vlan_parse, cli_p_msec_vlan_parse, \
+	  "Configure egress SA match VLAN control parameters", \
+	  "  qinq_en: value\n" \
+	  "  stag_en: value\n" \
+	  "  qtag_en: value\n") \
+	X(gpy2xx_msec_config_ing_aic_csr, cli_p_gpy2xx_msec_config_ing_aic_csr, \
+	  "Configures the ingress interrupt  controll and status options", \
+	  "  enable_ctrl:		value\n" \
+	  "  ack:    			value\n" \
+	  "  enable_set:    	value\n" \
+	  "  enable_clr:     	value\n") \
+	X(gpy2xx_msec_config_ing_cc_ctrl, cli_p_gpy2xx_msec_config_ing_cc_ctrl, \
+	  "Configure ingress consistency check control", \
+	  "  nm_act:        value\n" \
+	  "  nm_ctrl_act:   value\n" \
+	  "  etype_max_len: value\n") \
+	X(gpy2xx_msec_config_ing_cc_eec, cli_p_gpy2xx_msec_config_ing_cc_eec, \
+	  "Configure ingress CC match entry enable clear", \
+	  "  icc_ind_set:value\n" \
+	  "  set_single: value\n" \
+	  "  set_all:    value\n" \
+	  "  icc_ind_clr:value\n" \
+	  "  clr_single: value\n" \
+	  "  clr_all:    value\n") \
+	X(gpy2xx_msec_config_ing_cc_eef, cli_p_gpy2xx_msec_config_ing_cc_eef, \
+	  "Configure ingress consistency check entry enable flags", \
+	  "  eec_word0:	value\n") \
+	X(gpy2xx_msec_config_ing_cc_rule, cli_p_gpy2xx_msec_config_ing_cc_rule, \
+	  "Configure ingress consistency check match parameters", \
+	  "  icc_index:   value\n" \
+	  "  eth_type: 	value\n" \
+	  "  misc:        value\n") \
+	X(gpy2xx_msec_config_ing_count_ctrl, cli_p_gpy2xx_msec_config_ing_count_ctrl, \
+	  "Configure ingress count control", \
+	  "  rst_all:       value\n" \
+	  "  ctr_saturate:  value\n" \
+	  "  ctr_conr:      value\n" \
+	  "  rst_summary:   value\n") \
+	X(gpy2xx_msec_config_ing_count_incen, cli_p_gpy2xx_msec_config_ing_count_incen, \
+	  "Configure ingress counter increment enables", \
+	  "  sa_inc:        value\n" \
+	  "  vlan_inc:      value\n" \
+	  "  global_inc: 	  value\n") \
+	X(gpy2xx_msec_config_ing_count_secfail, cli_p_gpy2xx_msec_config_ing_count_secfail, \
+	  "Configure ingress secfail event trigger enables", \
+	  "  misc_secfail:    value\n" \
+	  "  global_secfail:	value\n") \
+	X(gpy2xx_msec_config_ing_count_thresh, cli_p_gpy2xx_msec_config_ing_count_thresh, \
+	  "Configure ingress counter packet and octet thresholds", \
+	  "  frame_thr:	 value\n" \
+	  "  octet_thr:	 value\n") \
+	X(gpy2xx_msec_config_ing_cp_rule, cli_p_gpy2xx_msec_config_ing_cp_rule, \
+	  "Configure ingress control packet classification rule", \
+	  "  cpc_index:       value\n" \
+	  "  entry_type:      value\n" \
+	  "  da_mac:          value\n" \
+	  "  da_end:          value\n" \
+	  "  eth_type:        value\n" \
+	  "  cpm_mode:        value\n" \
+	  "  cpm_en:          value\n") \
+	X(gpy2xx_msec_config_ing_misc_ctrl, cli_p_gpy2xx_msec_config_ing_misc_ctrl, \
+	  "Configure ingress misc control", \
+	  "  mc_latency:       value\n" \
+	  "  static_bp         value\n" \
+	  "  nm_macsec:        value\n" \
+	  "  validate_frames:  value\n" \
+	  "  sectag_avlan:     value\n") \
+	X(gpy2xx_msec_config_ing_sa_nm_cp, cli_p_gpy2xx_msec_config_ing_sa_nm_cp, \
+	  "Configure ingress SA non-match flow control action for control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_nonres:    value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_ing_sa_nm_ctrl, cli_p_msec_sa_nm_ctrl, \
+	  "Configure ingress no-match classifier control", \
+	  "  comp_etype:      dis/en\n" \
+	  "  check_ver        dis/en\n" \
+	  "  check_kay:       dis/en\n" \
+	  "  check_ce:  		dis/en\n" \
+	  "  check_sc:     	dis/en\n" \
+	  "  check_sl:     	dis/en\n" \
+	  "  check_pn:     	dis/en\n" \
+	  "  msec_eth:        value\n") \
+	X(gpy2xx_msec_config_ing_sa_nm_ncp, cli_p_gpy2xx_msec_config_ing_sa_nm_ncp, \
+	  "Configure ingress SA non-match flow control action for non-control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_nonres:    value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_ing_sam_eec, cli_p_gpy2xx_msec_config_ing_sam_eec, \
+	  "Configure ingress SA match entry enable clear", \
+	  "  sam_ind_set: value\n" \
+	  "  set_single:  value\n" \
+	  "  set_all:     value\n" \
+	  "  sam_ind_clr: value\n" \
+	  "  clr_single:  value\n" \
+	  "  clr_all:     value\n") \
+	X(gpy2xx_msec_config_ing_sam_eex, cli_p_gpy2xx_msec_config_ing_sam_eex, \
+	  "Configure ingress SA match entry enable flags", \
+	  "  eex_type:  value\n" \
+	  "  eex_word0: value\n") \
+	X(gpy2xx_msec_config_ing_sam_fca, cli_p_gpy2xx_msec_config_ing_sam_fca, \
+	  "Configure ingress SA matching rule's flow control action parameters", \
+	  "  flow_index: 	 value\n" \
+	  "  flow_type:    value\n" \
+	  "  dest_port:    value\n" \
+	  "  drop_nonres:  value\n" \
+	  "  crypt_auth:   value\n" \
+	  "  drop_act:   	 value\n" \
+	  "  sa_index:     value\n" \
+	  "  rep_protect:  value\n" \
+	  "  sa_inuse:     value\n" \
+	  "  validate_level:value\n" \
+	  "  conf_offset:  value\n") \
+	X(gpy2xx_msec_config_ing_sam_rule, cli_p_msec_sam_rule, \
+	  "Configure ingress SA match rule parameters", \
+	  "  rule_index:value\n" \
+	  "  sa_mac:    value\n" \
+	  "  da_mac:    value\n" \
+	  "  eth_type:  value\n" \
+	  "  vlan_id:   value\n" \
+	  "  misc:      value\n" \
+	  "  sci:       value\n" \
+	  "  mask:      value\n" \
+	  "  flow_index:value\n") \
+	X(gpy2xx_msec_config_ing_sn_thresh, cli_p_gpy2xx_msec_config_ing_sn_thresh, \
+	  "Configures the ingress sequence number threshold", \
+	  "  sn_type:    	value\n" \
+	  "  sn_thr:     	value\n") \
+	X(gpy2xx_msec_config_ing_tr, cli_p_gpy2xx_msec_config_ing_tr, \
+	  "Configure ingress transform record", \
+	  "  sa_index:   value\n" \
+	  "  ca_type:    value\n" \
+	  "  key:        value\n" \
+	  "  sci:        value\n" \
+	  "  seq_num     value\n" \
+	  "  salt:       value\n" \
+	  "  short_sci:  value\n" \
+	  "  rep_window: value\n") \
+	X(gpy2xx_msec_config_ing_vlan_parse, cli_p_msec_vlan_parse, \
+	  "Configure ingress SA match VLAN control parameters", \
+	  "  qinq_en: value\n" \
+	  "  stag_en: value\n" \
+	  "  qtag_en: value\n") \
+	X(gpy2xx_msec_get_egr_aic_csr, NULL, \
+	  "Gets the egress interrupt  controll and status options", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_cap, NULL, \
+	  "Gets the egress HW capabilities", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_cc_int_stat, NULL, \
+	  "Get crypto-cores's context, HW / SW interrupt status", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_count_thresh, NULL, \
+	  "GEt egress counter packet and octet thresholds", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_debug_stats, NULL, \
+	  "Get egress debug statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_global_stats, NULL, \
+	  "Get egress global statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_pn, cli_p_gpy2xx_msec_get_egr_pn, \
+	  "Get egress current SN from transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_egr_psa_stats_summ, cli_p_gpy2xx_msec_get_egr_psa_stats_summ, \
+	  "Get egress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n") \
+	X(gpy2xx_msec_get_egr_sa_exp_summ, NULL, \
+	  "Gets SA expired summary flags", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_sa_stats, cli_p_gpy2xx_msec_get_egr_sa_stats, \
+	  "Get egress SA statistics", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_get_egr_sam_eef, NULL, \
+	  "Get egress SA match entry enable flags", \
+	  "gpy2xx_msec_get_egr_sam_eef [word_num=?]\n" \
+	  "  word_num: value\n") \
+	X(gpy2xx_msec_get_egr_sam_fca, cli_p_gpy2xx_msec_get_egr_sam_fca, \
+	  "Get ingress SA matching rule's flow control action parameters", \
+	  "  flow_index: 	value\n") \
+	X(gpy2xx_msec_get_egr_sam_rule, cli_p_gpy2xx_msec_get_egr_sam_rule, \
+	  "Get egress SA match rule parameters", \
+	  "  rule_index: value\n") \
+	X(gpy2xx_msec_get_egr_sn_thresh, cli_p_gpy2xx_msec_get_egr_sn_thresh, \
+	  "Gets the ingress squence number threshold", \
+	  "sn_type:	 1 - SN_32_BIT / 2 - SN_64_BIT") \
+	X(gpy2xx_msec_get_egr_stats_summ, NULL, \
+	  "Get egress SA expired/pn-thr/psa summary", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_tr, cli_p_gpy2xx_msec_get_egr_tr, \
+	  "Get egress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_ing_aic_csr, NULL, \
+	  "Gets the ingress interrupt  controll and status options", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_cap, NULL, \
+	  "Gets the ingress HW capabilities", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_cc_eef, NULL, \
+	  "Get ingress consistency check entry enable flags", \
+	  "gpy2xx_msec_get_ing_cc_eef \n") \
+	X(gpy2xx_msec_get_ing_cc_int_stat, NULL, \
+	  "Get crypto-cores's context, HW / SW interrupt status", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_cc_rule, cli_p_gpy2xx_msec_get_ing_cc_rule, \
+	  "Configure ingress consistency check match parameters", \
+	  "  icc_index:	value\n") \
+	X(gpy2xx_msec_get_ing_count_thresh, NULL, \
+	  "Get ingress counter packet and octet thresholds", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_debug_stats, NULL, \
+	  "Get ingress debug statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_global_stats, NULL, \
+	  "Get ingress global statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_pn, cli_p_gpy2xx_msec_get_ing_pn, \
+	  "Get ingress current SN from transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_ing_psa_stats_summ, cli_p_gpy2xx_msec_get_ing_psa_stats_summ, \
+	  "Get ingress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n") \
+	X(gpy2xx_msec_get_ing_sa_stats, cli_p_gpy2xx_msec_get_ing_sa_stats, \
+	  "Get ingress SA statistics", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_get_ing_sam_eef, NULL, \
+	  "Get ingress SA match entry enable flags", \
+	  "gpy2xx_msec_get_ing_sam_eef [word_num=?]\n" \
+	  "  word_num: value\n") \
+	X(gpy2xx_msec_get_ing_sam_fca, cli_p_gpy2xx_msec_get_ing_sam_fca, \
+	  "Get ingress SA matching rule's flow control action parameters", \
+	  "  flow_index: 	value\n") \
+	X(gpy2xx_msec_get_ing_sam_rule, cli_p_gpy2xx_msec_get_ing_sam_rule, \
+	  "Get ingress SA match rule parameters", \
+	  "  rule_index: value\n") \
+	X(gpy2xx_msec_get_ing_sn_thresh, cli_p_gpy2xx_msec_get_ing_sn_thresh, \
+	  "Gets the ingress Sequence Number threshold", \
+	  "sn_type:    1 - SN_32_BIT / 2 - SN_64_BIT") \
+	X(gpy2xx_msec_get_ing_stats_summ, NULL, \
+	  "Get ingress SA expired/pn-thr/psa summary", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_tr, cli_p_gpy2xx_msec_get_ing_tr, \
+	  "Get ingress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_sa_pn_thr_summ, NULL, \
+	  "Get OPP's SA PN threshold summary flags", \
+	  NULL) \
+	X(gpy2xx_msec_harvest_stats, cli_p_gpy2xx_msec_harvest_stats, \
+	  "Collect SA/global statistics on counter threshold events", \
+	  "  frame_thr:  frame threshold (ingress & egress)\n" \
+	  "  octet_thr:  octet threshold (ingress & egress)\n" \
+	  "  events:     number of MACsec events to service (default 1)\n" \
+	  "  timeout:    event wait/poll interval in ms (default 1000)\n" \
+	  "  gpio:       sysfs GPIO value file of PHY interrupt line,\n" \
+	  "              interrupt status is polled if not given\n") \
+	X(gpy2xx_msec_init_egr_dev, NULL, \
+	  "Init macsec EGR device", \
+	  NULL) \
+	X(gpy2xx_msec_init_ing_dev, NULL, \
+	  "Init macsec ING device", \
+	  NULL) \
+	X(gpy2xx_msec_update_egr_sa_cw, cli_p_gpy2xx_msec_update_egr_sa_cw, \
+	  "Update egress SA control word", \
+	  "  sa_index:    value\n" \
+	  "  ca_type:     value\n" \
+	  "  sn_type:     value\n" \
+	  "  next_sa_ind: value\n" \
+	  "  sa_expirq:   value\n" \
+	  "  sa_indvalid: value\n" \
+	  "  flow_index:  value\n" \
+	  "  sa_indupen:  value\n")
+
+#define CLI_CMD_ENUM(name, params, brief, desc)	CLI_CMD_##name,
+#define CLI_CMD_ENTRY(name, params, brief, desc) \
+	{ #name, CLI_CMD_##name, brief, desc, params },
+
+enum cli_cmd_id {
+	CLI_CMD_NONE = -1,
+	GPY211_CMD_LIST(CLI_CMD_ENUM)
+	MSEC_CMD_LIST(CLI_CMD_ENUM)
+};
+
+struct cli_cmd {
+	const char *name;
+	int id;
+	const char *brief;
+	const char *desc;
+	const struct cli_param *params;
+};
+
+static const struct cli_cmd gpy211_cmds[] = {
+	GPY211_CMD_LIST(CLI_CMD_ENTRY)
+};
+
+static const struct cli_cmd msec_cmds[] = {
+	MSEC_CMD_LIST(CLI_CMD_ENTRY)
+};
+
+static int cli_cmd_cmp(const void *a, const void *b)
+{
+	return strcasecmp(((const struct cli_cmd *)a)->name, ((const struct cli_cmd *)b)->name);
+}
+
+static const struct cli_cmd *cli_cmd_lookup(const struct cli_cmd *tab, size_t size, const char *name)
+{
+	struct cli_cmd key = { name, CLI_CMD_NONE };
+
+	if (name == NULL)
+		return NULL;
+
+	return bsearch(&key, tab, size, sizeof(*tab), cli_cmd_cmp);
+}
+
+/* Store one parameter value, 0 if the value does not fit the type */
+static int cli_store(const struct cli_param *p, char *val, void *dst)
+{
+	unsigned long long int num;
+	size_t len;
+
+	switch (p->type) {
+	case CLI_P_NUM:
+		if (!parse_num(val, &num))
+			return 0;
+
+		store_num(num, p->size, dst);
+		return 1;
+
+	case CLI_P_MAC:
+		return convert_mac_adr_str(val, dst);
+
+	case CLI_P_KEY:
+		copy_key_to_dst(val, p->size, dst);
+		return strlen(val) == (size_t)p->size * 2;
+
+	case CLI_P_AESKEY:
+		/* 128 or 256 bit key, the length selects the key size */
+		len = strlen(val);
+		copy_key_to_dst(val, (len == 32 || len == 64) ? len / 2 : p->size, dst);
+		return len == 32 || len == 64;
+
+	case CLI_P_ADVERT:
+		parse_advert(val, dst);
+		return 1;
+
+	case CLI_P_STR:
+		*(char **)dst = val;
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Fill the handler's struct at base from the name=value arguments in a
+ * single pass over argv. Names match case-insensitively and the first
+ * occurrence of a name is used, as with findArgParam(). Parameters not
+ * given keep their value or get their schema default. Returns a mask
+ * with bit n set if params[n] was given with a valid value, so a schema
+ * holds at most 32 parameters.
+ */
+static u32 cli_parse(const struct cli_cmd *cmd, int argc, char *argv[], void *base)
+{
+	const struct cli_param *p;
+	u32 seen = 0, tried = 0;
+	size_t len;
+	char *eq;
+	int i, n;
+
+	if (cmd == NULL || cmd->params == NULL)
+		return 0;
+
+	for (i = 0; i < argc; i++) {
+		eq = strchr(argv[i], '=');
+
+		if (eq == NULL || eq == argv[i] || eq[1] == 0)
+			continue;
+
+		len = eq - argv[i];
+
+		for (p = cmd->params, n = 0; p->name != NULL; p++, n++) {
+			if (strlen(p->name) == len && strncasecmp(p->name, argv[i], len) == 0)
+				break;
+		}
+
+		if (p->name == NULL || (tried & (1u << n)))
+			continue;
+
+		tried |= 1u << n;
+
+		if (cli_store(p, eq + 1, (u8 *)base + p->offset))
+			seen |= 1u << n;
+	}
+
+	for (p = cmd->params, n = 0; p->name != NULL; p++, n++) {
+		if (p->has_def && !(seen & (1u << n)))
+			store_num(p->def, p->size, (u8 *)base + p->offset);
+	}
+
+	return seen;
+}
+
+/* Check in the cli_parse() result if the parameter name was given */
+static int cli_given(const struct cli_cmd *cmd, u32 seen, const char *name)
+{
+	const struct cli_param *p;
+	int n;
+
+	for (p = cmd->params, n = 0; p->name != NULL; p++, n++) {
+		if (strcasecmp(p->name, name) == 0)
+			return (seen >> n) & 1;
+	}
+
+	return 0;
+}
+
+/* Commands handled outside gpy211_main(), listed first by help */
+static const struct cli_cmd cli_builtins[] = {
 	{
-		"gpy2xx_msec_config_ing_tr",
-		"Configure ingress transform record",
-		"gpy2xx_msec_config_ing_tr [sa_index=?] [ca_type=?] [key=?] [sci=?] [seq_num=?] [rep_window=?] [salt=?] [short_sci=?]\n"
-		"  sa_index:   value\n"
-		"  ca_type:    value\n"
-		"  key:        value\n"
-		"  sci:        value\n"
-		"  seq_num     value\n"
-		"  salt:       value\n"
-		"  short_sci:  value\n"
-		"  rep_window: value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_tr",
-		"Configure egress transform record",
-		"gpy2xx_msec_config_egr_tr [sa_index=?] [ca_type=?] [an=?] [key=?] [sci=?] [seq_num=?] [salt=?] [short_sci=?] [next_sa_ind=?] [sa_expirq=?] [sa_indvalid=?] [flow_index=?] [sa_indupen=?]\n"
-		"  sa_index:    value\n"
-		"  ca_type:     value\n"
-		"  an:          value\n"
-		"  key:         value\n"
-		"  sci:         value\n"
-		"  seq_num:        value\n"
-		"  salt:        value\n"
-		"  short_sci:    value\n"
-		"  next_sa_ind:   value\n"
-		"  sa_expirq: value\n"
-		"  sa_indvalid:  value\n"
-		"  flow_index:  value\n"
-		"  sa_indupen:  value\n",
-	},
-	{
-		"gpy2xx_msec_update_egr_sa_cw",
-		"Update egress SA control word",
-		"gpy2xx_msec_update_egr_sa_cw [sa_index=?] [ca_type=?] [sn_type=?] [next_sa_ind=?] [sa_expirq=?] [sa_indvalid=?] [flow_index=?] [sa_indupen=?]\n"
-		"  sa_index:    value\n"
-		"  ca_type:     value\n"
-		"  sn_type:     value\n"
-		"  next_sa_ind: value\n"
-		"  sa_expirq:   value\n"
-		"  sa_indvalid: value\n"
-		"  flow_index:  value\n"
-		"  sa_indupen:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_tr",
-		"Get ingress transform record",
-		"gpy2xx_msec_get_ing_tr sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_tr",
-		"Get egress transform record",
-		"gpy2xx_msec_get_egr_tr sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_pn",
-		"Get ingress current SN from transform record",
-		"gpy2xx_msec_get_ing_pn sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_pn",
-		"Get egress current SN from transform record",
-		"gpy2xx_msec_get_egr_pn sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_rule",
-		"Configure ingress SA match rule parameters",
-		"gpy2xx_msec_config_ing_sam_rule [rule_index=?] [sa_mac=?] [da_mac=?] [eth_type=?] [vlan_id=?] [misc=?] [sci=?] [mask=?] [flow_index=?]\n"
-		"  rule_index:value\n"
-		"  sa_mac:    value\n"
-		"  da_mac:    value\n"
-		"  eth_type:  value\n"
-		"  vlan_id:   value\n"
-		"  misc:      value\n"
-		"  sci:       value\n"
-		"  mask:      value\n"
-		"  flow_index:value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_rule",
-		"Configure egress SA match rule parameters",
-		"gpy2xx_msec_config_egr_sam_rule [rule_index=?] [sa_mac=?] [da_mac=?] [eth_type=?] [vlan_id=?] [misc=?] [sci=?] [mask=?] [flow_index=?]\n"
-		"  rule_index:value\n"
-		"  sa_mac:    value\n"
-		"  da_mac:    value\n"
-		"  eth_type:  value\n"
-		"  vlan_id:   value\n"
-		"  misc:      value\n"
-		"  sci:       value\n"
-		"  mask:      value\n"
-		"  flow_index:value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sam_rule",
-		"Get ingress SA match rule parameters",
-		"gpy2xx_msec_get_ing_sam_rule [rule_index=?]\n"
-		"  rule_index: value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sam_rule",
-		"Get egress SA match rule parameters",
-		"gpy2xx_msec_get_egr_sam_rule [rule_index=?]\n"
-		"  rule_index: value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_fca",
-		"Configure ingress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_config_ing_sam_fca [flow_index=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [crypt_auth=?] [drop_act=?] [sa_index=?] [rep_protect=?] [sa_inuse=?] [validate_level=?] [conf_offset=?]\n"
-		"  flow_index: 	 value\n"
-		"  flow_type:    value\n"
-		"  dest_port:    value\n"
-		"  drop_nonres:  value\n"
-		"  crypt_auth:   value\n"
-		"  drop_act:   	 value\n"
-		"  sa_index:     value\n"
-		"  rep_protect:  value\n"
-		"  sa_inuse:     value\n"
-		"  validate_level:value\n"
-		"  conf_offset:  value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_fca",
-		"Configure egress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_config_egr_sam_fca [flow_index=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [crypt_auth=?] [drop_act=?] [sa_index=?] [frame_protect=?] [sa_inuse=?] [include_sci=?] [use_es=?] [use_scb=?] [tag_bpsize=?] [sa_indup=?] [conf_offset=?] [conf_protect=?]\n"
-		"  flow_index:	 value\n"
-		"  flow_type:	 value\n"
-		"  dest_port:	 value\n"
-		"  drop_nonres:  value\n"
-		"  crypt_auth:	 value\n"
-		"  drop_act:	 value\n"
-		"  sa_index:	 value\n"
-		"  frame_protect:value\n"
-		"  sa_inuse:	 value\n"
-		"  include_sci:  value\n"
-		"  use_es:		 value\n"
-		"  use_scb: 	 value\n"
-		"  tag_bpsize:	 value\n"
-		"  sa_indup:	 value\n"
-		"  conf_offset:  value\n"
-		"  conf_protect: value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sam_fca",
-		"Get ingress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_get_ing_sam_fca [flow_index=?]\n"
-		"  flow_index: 	value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sam_fca",
-		"Get ingress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_get_egr_sam_fca [flow_index=?]\n"
-		"  flow_index: 	value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_tr",
-		"Clears ingress transform record",
-		"gpy2xx_msec_clear_ing_tr [sa_index=?]\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_tr",
-		"Clears egress transform record",
-		"gpy2xx_msec_clear_egr_tr [sa_index=?]\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_sam_rule",
-		"Clears ingress SAM rule parameters",
-		"gpy2xx_msec_clear_ing_sam_rule [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_sam_rule",
-		"Clears egress SAM rule parameters",
-		"gpy2xx_msec_clear_egr_sam_rule [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_sam_fca",
-		"Clears ingress SAM flow control parameters",
-		"gpy2xx_msec_clear_ing_sam_fca [flow_index=?]\n"
-		"  flow_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_sam_fca",
-		"Clears egress SAM flow control parameters",
-		"gpy2xx_msec_clear_egr_sam_fca [flow_index=?]\n"
-		"  flow_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_vlan_parse",
-		"Configure ingress SA match VLAN control parameters",
-		"gpy2xx_msec_config_ing_vlan_parse [qinq_en=?] [stag_en=?] [qtag_en=?]\n"
-		"  qinq_en: value\n"
-		"  stag_en: value\n"
-		"  qtag_en: value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_vlan_parse",
-		"Configure egress SA match VLAN control parameters",
-		"gpy2xx_msec_config_egr_vlan_parse [qinq_en=?] [stag_en=?] [qtag_en=?]\n"
-		"  qinq_en: value\n"
-		"  stag_en: value\n"
-		"  qtag_en: value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_eex",
-		"Configure ingress SA match entry enable flags",
-		"gpy2xx_msec_config_ing_sam_eex [eex_type=?] [eex_word0=?]\n"
-		"  eex_type:  value\n"
-		"  eex_word0: value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_eex",
-		"Configure egress SA match entry enable flags",
-		"gpy2xx_msec_config_egr_sam_eex [eex_type=?] [eex_word0=?]\n"
-		"  eex_type:  value\n"
-		"  eex_word0: value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sam_eef",
-		"Get ingress SA match entry enable flags",
-		"gpy2xx_msec_get_ing_sam_eef [word_num=?]\n"
-		"  word_num: value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sam_eef",
-		"Get egress SA match entry enable flags",
-		"gpy2xx_msec_get_egr_sam_eef [word_num=?]\n"
-		"  word_num: value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_eec",
-		"Configure ingress SA match entry enable clear",
-		"gpy2xx_msec_config_ing_sam_eec [sam_ind_set=?] [set_single=?] [set_all=?] [sam_ind_clr=?] [clr_single=?] [clr_all=?]\n"
-		"  sam_ind_set: value\n"
-		"  set_single:  value\n"
-		"  set_all:     value\n"
-		"  sam_ind_clr: value\n"
-		"  clr_single:  value\n"
-		"  clr_all:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_eec",
-		"Configure egress SA match entry enable clear",
-		"gpy2xx_msec_config_egr_sam_eec [sam_ind_set=?] [set_single=?] [set_all=?] [sam_ind_clr=?] [clr_single=?] [clr_all=?]\n"
-		"  sam_ind_set: value\n"
-		"  set_single:  value\n"
-		"  set_all:     value\n"
-		"  sam_ind_clr: value\n"
-		"  clr_single:  value\n"
-		"  clr_all:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_rule",
-		"Configure ingress consistency check match parameters",
-		"gpy2xx_msec_config_ing_cc_rule [icc_index=?] [eth_type=?] [misc=?] \n"
-		"  icc_index:   value\n"
-		"  eth_type: 	value\n"
-		"  misc:        value\n"
-	},
-	{
-		"gpy2xx_msec_get_ing_cc_rule",
-		"Configure ingress consistency check match parameters",
-		"gpy2xx_msec_get_ing_cc_rule [icc_index=?]\n"
-		"  icc_index:	value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_eef",
-		"Configure ingress consistency check entry enable flags",
-		"gpy2xx_msec_config_ing_cc_eef [eec_word0=?]\n"
-		"  eec_word0:	value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_cc_eef",
-		"Get ingress consistency check entry enable flags",
-		"gpy2xx_msec_get_ing_cc_eef \n"
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_eec",
-		"Configure ingress CC match entry enable clear",
-		"gpy2xx_msec_config_ing_cc_eec [icc_ind_set=?] [set_single=?] [set_all=?] [icc_ind_clr=?] [clr_single=?] [clr_all=?]\n"
-		"  icc_ind_set:value\n"
-		"  set_single: value\n"
-		"  set_all:    value\n"
-		"  icc_ind_clr:value\n"
-		"  clr_single: value\n"
-		"  clr_all:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_ctrl",
-		"Configure ingress consistency check control",
-		"gpy2xx_msec_config_ing_cc_ctrl [nm_act=?] [nm_ctrl_act=?] [etype_max_len=?]\n"
-		"  nm_act:        value\n"
-		"  nm_ctrl_act:   value\n"
-		"  etype_max_len: value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sa_stats",
-		"Get ingress SA statistics",
-		"gpy2xx_msec_get_ing_sa_stats [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sa_stats",
-		"Get egress SA statistics",
-		"gpy2xx_msec_get_egr_sa_stats [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_global_stats",
-		"Get ingress global statistics",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_global_stats",
-		"Get egress global statistics",
-		NULL
-	},
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-	{
-		"gpy2xx_msec_get_ing_debug_stats",
-		"Get ingress debug statistics",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_debug_stats",
-		"Get egress debug statistics",
-		NULL
-	},
-#endif
-	{
-		"gpy2xx_msec_config_ing_count_ctrl",
-		"Configure ingress count control",
-		"gpy2xx_msec_config_ing_count_ctrl [rst_all=?] [ctr_saturate=?] [ctr_conr=?] [rst_summary=?]\n"
-		"  rst_all:       value\n"
-		"  ctr_saturate:  value\n"
-		"  ctr_conr:      value\n"
-		"  rst_summary:   value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_count_ctrl",
-		"Configure egress count controls",
-		"gpy2xx_msec_config_egr_count_ctrl [rst_all=?] [ctr_saturate=?] [ctr_conr=?] [rst_summary=?]\n"
-		"  rst_all:       value\n"
-		"  ctr_saturate:  value\n"
-		"  ctr_conr:      value\n"
-		"  rst_summary:   value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_count_incen",
-		"Configure ingress counter increment enables",
-		"gpy2xx_msec_config_ing_count_incen [sa_inc=?] [vlan_inc=?] [global_inc=?]\n"
-		"  sa_inc:        value\n"
-		"  vlan_inc:      value\n"
-		"  global_inc: 	  value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_count_incen",
-		"Configure egress counter increment enables",
-		"gpy2xx_msec_config_egr_count_incen [sa_inc=?] [vlan_inc=?] [global_inc=?]\n"
-		"  sa_inc:        value\n"
-		"  vlan_inc:	  value\n"
-		"  global_inc: 	  value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_count_secfail",
-		"Configure ingress secfail event trigger enables",
-		"gpy2xx_msec_config_ing_count_secfail [misc_secfail=?] [global_secfail=?]\n"
-		"  misc_secfail:    value\n"
-		"  global_secfail:	value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_count_secfail",
-		"Configure egress secfail event trigger enables",
-		"gpy2xx_msec_config_egr_count_secfail [misc_secfail=?] [global_secfail=?]\n"
-		"  misc_secfail:    value\n"
-		"  global_secfail:	value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_count_thresh",
-		"Configure ingress counter packet and octet thresholds",
-		"gpy2xx_msec_config_ing_count_thresh [frame_thr=?] [octet_thr=?]\n"
-		"  frame_thr:	 value\n"
-		"  octet_thr:	 value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_count_thresh",
-		"Get ingress counter packet and octet thresholds",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_egr_count_thresh",
-		"Configure egress counter packet and octet thresholds",
-		"gpy2xx_msec_config_egr_count_thresh [frame_thr=?] [octet_thr=?]\n"
-		"  frame_thr:	 value\n"
-		"  octet_thr:	 value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_count_thresh",
-		"GEt egress counter packet and octet thresholds",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_ing_misc_ctrl",
-		"Configure ingress misc control",
-		"gpy2xx_msec_config_ing_misc_ctrl [mc_latency=?] [static_bp=?] [nm_macsec=?] [validate_frames=?] [sectag_avlan=?]\n"
-		"  mc_latency:       value\n"
-		"  static_bp         value\n"
-		"  nm_macsec:        value\n"
-		"  validate_frames:  value\n"
-		"  sectag_avlan:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_misc_ctrl",
-		"Configure egress misc control",
-		"gpy2xx_msec_config_egr_misc_ctrl [mc_latency=?] [static_bp=?] [nm_macsec=?] [validate_frames=?] [sectag_avlan=?]\n"
-		"  mc_latency:       value\n"
-		"  static_bp         value\n"
-		"  nm_macsec:        value\n"
-		"  validate_frames:  value\n"
-		"  sectag_avlan:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_ctrl",
-		"Configure ingress no-match classifier control",
-		"gpy2xx_msec_config_ing_sa_nm_ctrl [comp_etype=?] [check_ver=?] [check_kay=?] [check_ce=?] [check_sc=?] [check_sl=?] [check_pn=?] [msec_eth=?]\n"
-		"  comp_etype:      dis/en\n"
-		"  check_ver        dis/en\n"
-		"  check_kay:       dis/en\n"
-		"  check_ce:  		dis/en\n"
-		"  check_sc:     	dis/en\n"
-		"  check_sl:     	dis/en\n"
-		"  check_pn:     	dis/en\n"
-		"  msec_eth:        value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_ctrl",
-		"Configure egress no-match classifier control",
-		"gpy2xx_msec_config_egr_sa_nm_ctrl [comp_etype=?] [check_ver=?] [check_kay=?] [check_ce=?] [check_sc=?] [check_sl=?] [check_pn=?] [msec_eth=?]\n"
-		"  comp_etype:		dis/en\n"
-		"  check_ver 		dis/en\n"
-		"  check_kay:		dis/en\n"
-		"  check_ce: 		dis/en\n"
-		"  check_sc: 		dis/en\n"
-		"  check_sl: 		dis/en\n"
-		"  check_pn: 		dis/en\n"
-		"  msec_eth: 		value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_ncp",
-		"Configure ingress SA non-match flow control action for non-control packet",
-		"gpy2xx_msec_config_ing_sa_nm_ncp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_nonres:    value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_ncp",
-		"Configure egress SA non-match flow control action for non-control packet",
-		"gpy2xx_msec_config_egr_sa_nm_ncp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_cp",
-		"Configure ingress SA non-match flow control action for control packet",
-		"gpy2xx_msec_config_ing_sa_nm_cp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_nonres:    value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_cp",
-		"Configure egress SA non-match flow control action for control packet",
-		"gpy2xx_msec_config_egr_sa_nm_cp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_expl",
-		"Configure ingress SA non-match flow control action for explicitly classified packet",
-		"gpy2xx_msec_config_ing_sa_nm_expl [flow_type=?] [dest_port=?] [drop_nonres=?] [drop_action=?]\n"
-		"  flow_type:      value\n"
-		"  dest_port:      value\n"
-		"  drop_nonres:    value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_expl",
-		"Configure egress SA non-match flow control action for explicitly classified packet",
-		"gpy2xx_msec_config_egr_sa_nm_expl [flow_type=?] [dest_port=?] [drop_nonres==?] [drop_action=?]\n"
-		"  flow_type:       value\n"
-		"  dest_port:       value\n"
-		"  drop_nonres:     value\n"
-		"  drop_action:     value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_stats_summ",
-		"Configure ingress SA expired/pn-thr/psa summary",
-		"gpy2xx_msec_clear_ing_stats_summ [psa_summ0=?] [glb_summ=?]\n"
-		"  psa_summ0:       value\n"
-		"  glb_summ:        value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_stats_summ",
-		"Configure egress SA expired/pn-thr/psa summary",
-		"gpy2xx_msec_clear_egr_stats_summ [psa_summ0=?] [glb_summ=?]\n"
-		"  psa_summ0:       value\n"
-		"  glb_summ:        value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_stats_summ",
-		"Get ingress SA expired/pn-thr/psa summary",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_stats_summ",
-		"Get egress SA expired/pn-thr/psa summary",
-		NULL
-	},
-	{
-		"gpy2xx_msec_clear_ing_psa_stats_summ",
-		"Clears ingress per-SA statistics summary",
-		"gpy2xx_msec_clear_ing_psa_stats_summ [psa_type=?] [rule_index=?] [psa_summ0=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n"
-		"  psa_summ0:        value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_psa_stats_summ",
-		"Get ingress per-SA statistics summary",
-		"gpy2xx_msec_get_ing_psa_stats_summ [psa_type=?] [rule_index=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_psa_stats_summ",
-		"Clears egress per-SA statistics summary",
-		"gpy2xx_msec_clear_egr_psa_stats_summ [psa_type=?] [rule_index=?] [psa_summ0=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n"
-		"  psa_summ0:        value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_psa_stats_summ",
-		"Get egress per-SA statistics summary",
-		"gpy2xx_msec_get_egr_psa_stats_summ [psa_type=?] [rule_index=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cp_rule",
-		"Configure ingress control packet classification rule",
-		"gpy2xx_msec_config_ing_cp_rule [cpc_index=?] [entry_type=?] [da_mac=?] [da_end=?] [eth_type=?] [cpm_mode=?] [cpm_en=?]\n"
-		"  cpc_index:       value\n"
-		"  entry_type:      value\n"
-		"  da_mac:          value\n"
-		"  da_end:          value\n"
-		"  eth_type:        value\n"
-		"  cpm_mode:        value\n"
-		"  cpm_en:          value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_cp_rule",
-		"Configure engress control packet classification rule",
-		"gpy2xx_msec_config_egr_cp_rule [cpc_index=?] [entry_type=?] [da_mac=?] [da_end=?] [eth_type=?] [cpm_mode=?] [cpm_en=?]\n"
-		"  cpc_index:       value\n"
-		"  entry_type:      value\n"
-		"  da_mac:          value\n"
-		"  da_end:          value\n"
-		"  eth_type:        value\n"
-		"  cpm_mode:        value\n"
-		"  cpm_en:          value\n",
-	},
-	{
-		"gpy2xx_msec_clear_sa_pn_thr_summ",
-		"Clear OPP's SA PN threshold summary flags",
-		"gpy2xx_msec_clear_sa_pn_thr_summ [pnthr_summ0=?]\n"
-		"  pnthr_summ0:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_sa_pn_thr_summ",
-		"Get OPP's SA PN threshold summary flags",
+		"exit", CLI_CMD_NONE,
+		"Exit GPY211 utility tool",
+		NULL,
 		NULL
 	},
 	{
-		"gpy2xx_msec_clear_egr_sa_exp_summ",
-		"Clear SA expired summary flags",
-		"gpy2xx_msec_clear_egr_sa_exp_summ [saexp_summ0=?]\n"
-		"  saexp_summ0:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sa_exp_summ",
-		"Gets SA expired summary flags",
+		"help", CLI_CMD_NONE,
+		"Print this help page",
+		NULL,
 		NULL
 	},
 	{
-		"gpy2xx_msec_clear_ing_cc_int_stat",
-		"Clear crypto-cores's context, HW / SW interrupt status",
-		"gpy2xx_msec_clear_ing_cc_int_stat [ctx_stat=?] [int_stat=?]\n"
-		"  ctx_stat:     value\n"
-		"  int_stat:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_cc_int_stat",
-		"Get crypto-cores's context, HW / SW interrupt status",
+		"batch", CLI_CMD_NONE,
+		"Initialize once and run commands from a script or stdin",
+		"batch [file=?] [timing=?] [onError=?]\n"
+		"  file:     script with one command per line, same syntax as the\n"
+		"            command line without the leading \"phyId=?\" (default stdin)\n"
+		"            blank lines and lines starting with '#' are skipped,\n"
+		"            \"phyId=?\" alone on a line switches to another PHY,\n"
+		"            \"exit\" ends the session\n"
+		"  timing:   0 - off (default), 1 - print execution time of each command\n"
+		"  onError:  stop - abort on first failing command (default for file)\n"
+		"            continue - run remaining commands (default for stdin)\n",
 		NULL
 	},
 	{
-		"gpy2xx_msec_clear_egr_cc_int_stat",
-		"Clear crypto-cores's context, HW / SW interrupt status",
-		"gpy2xx_msec_clear_egr_cc_int_stat [ctx_stat=?] [int_stat=?]\n"
-		"  ctx_stat:     value\n"
-		"  int_stat:     value\n",
+		"server", CLI_CMD_NONE,
+		"Own the PHYs and serve commands on a Unix domain socket",
+		"server [sock=?] [poll=?]\n"
+		"  sock:     socket path (default $GPY2XX_CLI_SOCK or /var/run/gpy2xx_cli.sock)\n"
+		"  poll:     event poll interval in ms (default 1000)\n"
+		"  While the server runs, every other gpy2xx_cli invocation forwards\n"
+		"  its command to it. Set GPY2XX_CLI_SOCK=\"\" to access MDIO directly.\n"
+		"  Commands waiting for events (gpy2xx_mon_link, gpy2xx_msec_harvest_stats,\n"
+		"  gpy2xx_gmacf_count_acc) are rejected, use subscribe instead.\n"
+		"  Refuses to start if another server answers on sock.\n",
+		NULL
 	},
 	{
-		"gpy2xx_msec_get_egr_cc_int_stat",
-		"Get crypto-cores's context, HW / SW interrupt status",
+		"complete", CLI_CMD_NONE,
+		"List command names for shell completion",
+		"complete [msec] [prefix]\n"
+		"  msec:     list msec sub-commands instead of top level commands\n"
+		"  prefix:   only list names starting with prefix\n",
 		NULL
 	},
 	{
-		"gpy2xx_msec_config_ing_sn_thresh",
-		"Configures the ingress sequence number threshold",
-		"gpy2xx_msec_config_ing_sn_thresh [sn_type=?] [sn_thr=?]\n"
-		"  sn_type:    	value\n"
-		"  sn_thr:     	value\n",
+		"subscribe", CLI_CMD_NONE,
+		"Print server events until interrupted",
+		"subscribe [link] [counters]\n"
+		"  link:     link up/down, speed and duplex changes\n"
+		"  counters: GMAC-F packet counter totals every poll interval\n"
+		"  Without arguments all events are subscribed. Needs a running server.\n",
+		NULL
 	},
 	{
-		"gpy2xx_msec_get_ing_sn_thresh",
-		"Gets the ingress Sequence Number threshold",
-		"gpy2xx_msec_get_ing_sn_thresh [sn_type=?]\n"
-		"sn_type:    1 - SN_32_BIT / 2 - SN_64_BIT",
+		"en_debug", CLI_CMD_NONE,
+		"Enable debugging codes",
+		"en_debug <option>\n"
+		"  option: 0 - disable, 1 -enable\n",
+		NULL
 	},
 	{
-		"gpy2xx_msec_config_egr_sn_thresh",
-		"Configures the egress sequence number threshold",
-		"gpy2xx_msec_config_egr_sn_thresh [sn_type=?] [sn_thr=?]\n"
-		"  sn_type:    	value\n"
-		"  sn_thr:     	value\n",
+		"gpy2xx_init", CLI_CMD_NONE,
+		"Initialize GPY211 API",
+		NULL,
+		NULL
 	},
-	{
-		"gpy2xx_msec_get_egr_sn_thresh",
-		"Gets the ingress squence number threshold",
-		"gpy2xx_msec_get_egr_sn_thresh [sn_type=?]\n"
-		"sn_type:	 1 - SN_32_BIT / 2 - SN_64_BIT",
+};
+
+/* Print "name [param=type] ..." for the schema, wrapped at 80 columns */
+static void cli_print_synopsis(const struct cli_cmd *cmd)
+{
+	const struct cli_param *p;
+	unsigned int col;
+	char buf[80];
+	int ndef = 0;
+
+	col = printf("%s", cmd->name);
+
+	for (p = cmd->params; p->name != NULL; p++) {
+		switch (p->type) {
+		case CLI_P_MAC:
+			snprintf(buf, sizeof(buf), "[%s=xx:xx:xx:xx:xx:xx]", p->name);
+			break;
+
+		case CLI_P_KEY:
+			snprintf(buf, sizeof(buf), "[%s=hex%u]", p->name, p->size * 2);
+			break;
+
+		case CLI_P_AESKEY:
+			snprintf(buf, sizeof(buf), "[%s=hex32|hex64]", p->name);
+			break;
+
+		case CLI_P_ADVERT:
+			snprintf(buf, sizeof(buf), "[%s=mode|...]", p->name);
+			break;
+
+		case CLI_P_STR:
+			snprintf(buf, sizeof(buf), "[%s=str]", p->name);
+			break;
+
+		default:
+			snprintf(buf, sizeof(buf), "[%s=num]", p->name);
+			break;
+		}
+
+		if (col + 1 + strlen(buf) > 79) {
+			printf("\n   ");
+			col = 3;
+		}
+
+		col += printf(" %s", buf);
+		ndef += p->has_def;
+	}
+
+	printf("\n");
+
+	if (ndef == 0)
+		return;
+
+	printf("  defaults:");
+
+	for (p = cmd->params; p->name != NULL; p++) {
+		if (p->has_def)
+			printf(" %s=%lld", p->name, p->def);
+	}
+
+	printf("\n");
+}
+
+static const struct cli_cmd *cli_help_lookup(const char *name)
+{
+	const struct cli_cmd *cmd;
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(cli_builtins); i++) {
+		if (strcasecmp(name, cli_builtins[i].name) == 0)
+			return &cli_builtins[i];
+	}
+
+	cmd = cli_cmd_lookup(gpy211_cmds, ARRAY_SIZE(gpy211_cmds), name);
+
+	if (cmd == NULL)
+		cmd = cli_cmd_lookup(msec_cmds, ARRAY_SIZE(msec_cmds), name);
+
+	return cmd;
+}
+
+static void gpy211_menu(const char *name)
+{
+	static const struct {
+		const struct cli_cmd *tab;
+		unsigned int size;
+	} tabs[] = {
+		{ cli_builtins, ARRAY_SIZE(cli_builtins) },
+		{ gpy211_cmds, ARRAY_SIZE(gpy211_cmds) },
+		{ msec_cmds, ARRAY_SIZE(msec_cmds) },
+	};
+	const struct cli_cmd *cmd;
+	unsigned int len, max_len;
+	unsigned int i, j;
+
+	if (name == NULL) {
+		printf("\n\n\n\tGPY211 Utility Tool Version   : %s", TOOL_VERSION);
+		printf("\n\t*************************************\n\n");
+
+		max_len = 0;
+
+		for (i = 0; i < ARRAY_SIZE(tabs); i++) {
+			for (j = 0; j < tabs[i].size; j++) {
+				len = strlen(tabs[i].tab[j].name);
+
+				if (max_len < len)
+					max_len = len;
+			}
+		}
+
+		for (i = 0; i < ARRAY_SIZE(tabs); i++) {
+			for (j = 0; j < tabs[i].size; j++)
+				printf("\t %-*s : %s\n", max_len, tabs[i].tab[j].name, tabs[i].tab[j].brief);
+		}
+
+		printf("\n\nIMPORTANT NOTE:\n");
+		printf("\nFor hex decimal input param please add 0x before the hex decimal number or just give decimal number");
+		printf("\nPrefix hex decimal value with 0x or GPY211 command execution will lead to wrong setting or malfunction\n");
+		printf("\n");
+	} else {
+		cmd = cli_help_lookup(name);
+
+		if (cmd == NULL)
+			return;
+
+		if (cmd->params != NULL)
+			cli_print_synopsis(cmd);
+		else if (cmd->desc == NULL)
+			printf("%s does not have parameter.\n", cmd->name);
+
+		if (cmd->desc != NULL)
+			printf("%s", cmd->desc);
+	}
+}
+
+/* Print the names starting with prefix, one per line, for shell completion */
+static void cli_cmd_complete(const struct cli_cmd *tab, size_t size, const char *prefix)
+{
+	size_t len, lo = 0, hi = size, mid;
+
+	if (prefix == NULL)
+		prefix = "";
+
+	len = strlen(prefix);
+
+	/* Lower bound of prefix */
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+
+		if (strncasecmp(tab[mid].name, prefix, len) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for (; lo < size && strncasecmp(tab[lo].name, prefix, len) == 0; lo++)
+		printf("%s\n", tab[lo].name);
+}
+
+int gpy2xx_msec_main(int argc, char *argv[])
+{
+	s32 ret = 0;
+	const struct cli_cmd *cmd = cli_cmd_lookup(msec_cmds, ARRAY_SIZE(msec_cmds), argv[3]);
+
+	switch (cmd != NULL ? cmd->id : CLI_CMD_NONE) {
+	case CLI_CMD_gpy2xx_msec_init_ing_dev: {
+		ret = gpy2xx_msec_init_ing_dev(&phy);
+
+		if (ret < 0) {
+			printf("\nERROR: Init ING dev failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_init_egr_dev: {
+		ret = gpy2xx_msec_init_egr_dev(&phy);
+
+		if (ret < 0) {
+			printf("\nERROR: Init EGR dev failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_tr: {
+		struct transform_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_config_ing_tr(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress TR set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_tr: {
+		struct transform_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_config_egr_tr(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress TR set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_update_egr_sa_cw: {
+		struct transform_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_update_egr_sa_cw(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress SA update set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_tr: {
+		char buf[256];
+		u32 _ca_type, _sn_type;
+		struct raw_trans_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_get_ing_tr(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress TR get failed.\n");
+			return -1;
+		}
+
+		int i;
+
+		for (i = 0; i < ING_MAX_TR_SIZE_WORDS; i++) {
+			printf("\nTRec[%02d] = %8x", i, raw_tr.raw_trans_rec[i]);
+		}
+
+		_sn_type = (raw_tr.raw_trans_rec[0] >> 28) & 0x3;
+		_ca_type = (raw_tr.raw_trans_rec[0] >> 17) & 0x7;
+		//salt= short_sci=7A30C118
+
+		/* Compute Current Sequence Number word offset */
+		if (_ca_type == 5) {
+			if (_sn_type == SN_32_BIT) {
+				struct ing_tr_32bpn_128bak *target_tr =
+					(struct ing_tr_32bpn_128bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_128");
+				printf("\n              SN type = 32_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
+				printf("\n                  Key = %s", buf);
+				printf("\n                   SN = %08x", target_tr->seq);
+				printf("\n   Replay Window size = %08x", target_tr->mask);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
+				printf("\n                  SCI = %s", buf);
+			} else if (_sn_type == SN_64_BIT) {
+				struct ing_tr_64bpn_128bak *target_tr =
+					(struct ing_tr_64bpn_128bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_128");
+				printf("\n              SN type = 32_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
+				printf("\n                  Key = %s", buf);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", target_tr->seq1, target_tr->seq0);
+				printf("\n                   SN = %s", buf);
+				printf("\n   Replay Window size = %08x", target_tr->mask);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1), swap_uint32(target_tr->iv2));
+				printf("\n         Context-Salt = %s", buf);
+			} else {
+				printf("\nERROR: Invalid SN type.\n");
+			}
+		} else if (_ca_type == 7) {
+			if (_sn_type == SN_32_BIT) {
+				struct ing_tr_32bpn_256bak *target_tr =
+					(struct ing_tr_32bpn_256bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_256");
+				printf("\n              SN type = 32_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
+				printf("\n                  Key = %s", buf);
+				printf("\n                   SN = %08x", target_tr->seq);
+				printf("\n   Replay Window size = %08x", target_tr->mask);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
+				printf("\n                  SCI = %s", buf);
+			} else if (_sn_type == SN_64_BIT) {
+				struct ing_tr_64bpn_256bak *target_tr =
+					(struct ing_tr_64bpn_256bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_128");
+				printf("\n              SN type = 64_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
+				printf("\n                  Key = %s", buf);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", target_tr->seq1, target_tr->seq0);
+				printf("\n                   SN = %s", buf);
+				printf("\n   Replay Window size = %08x", target_tr->mask);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1), swap_uint32(target_tr->iv2));
+				printf("\n         Context-Salt = %s", buf);
+			} else {
+				printf("\nERROR: Invalid SN type.\n");
+			}
+		} else {
+			printf("\nERROR: Invalid Crypto-Algorithm type.\n");
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_tr: {
+		char buf[256];
+		u32 _ca_type, _sn_type;
+		struct raw_trans_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_get_egr_tr(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress TR get failed.\n");
+			return -1;
+		}
+
+		int i;
+
+		for (i = 0; i < EGR_MAX_TR_SIZE_WORDS; i++) {
+			printf("\nTRec[%02d] = %8x", i, raw_tr.raw_trans_rec[i]);
+		}
+
+		_sn_type = (raw_tr.raw_trans_rec[0] >> 28) & 0x3;
+		_ca_type = (raw_tr.raw_trans_rec[0] >> 17) & 0x7;
 
-	},
-	{
-		"gpy2xx_msec_config_ing_aic_csr",
-		"Configures the ingress interrupt  controll and status options",
-		"gpy2xx_msec_config_ing_aic_csr [enable_ctrl=?] [ack=?] [enable_set=?] [enable_clr=?]\n"
-		"  enable_ctrl:		value\n"
-		"  ack:    			value\n"
-		"  enable_set:    	value\n"
-		"  enable_clr:     	value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_aic_csr",
-		"Gets the ingress interrupt  controll and status options",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_egr_aic_csr",
-		"Configures the egress interrupt  controll and status options",
-		"gpy2xx_msec_config_egr_aic_csr [enable_ctrl=?] [ack=?] [enable_set=?] [enable_clr=?]\n"
-		"  enable_ctrl:		value\n"
-		"  ack:    			value\n"
-		"  enable_set:    	value\n"
-		"  enable_clr:     	value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_aic_csr",
-		"Gets the egress interrupt  controll and status options",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_ing_cap",
-		"Gets the ingress HW capabilities",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_cap",
-		"Gets the egress HW capabilities",
-		NULL
-	},
-	{
-		"gpy2xx_usxgmii_reach_cfg",
-		"Configures the USXGMII reach customer setting according to master slice (slice 0)",
-		"gpy2xx_usxgmii_reach_cfg trace_len=? [tx_eq_main=?] [tx_eq_pre=?] [tx_eq_post=?] [tx_vboost_en=?] [tx_vboost_lvl=?] [tx_iboost_lvl=?] [rx_eq_att_lvl=?] [rx_eq_vga1_gain=?] [rx_eq_vga2_gain=?] [rx_eq_ctle_boost=?] [rx_eq_ctle_pole=?] [rx_eq_dfe_tap1=?] [rx_afe_adapt_en=?] [rx_dfe_adapt_en=?]\n"
-		"trace_len:         0-short, 1-medium, 2-long, 3-custom\n"
-		"tx_eq_main:        0x00 - 0x3F\n"
-		"tx_eq_pre:         0x00 - 0x3F\n"
-		"tx_eq_post:        0x00 - 0x3F\n"
-		"tx_vboost_en:      0 - disable, 1 - enable\n"
-		"tx_vboost_lvl:     0x00 - 0x07\n"
-		"tx_iboost_lvl:     0x00 - 0x07\n"
-		"rx_eq_att_lvl:     0x00 - 0x07\n"
-		"rx_eq_vga1_gain:   0x00 - 0x0F\n"
-		"rx_eq_vga2_gain:   0x00 - 0x0F\n"
-		"rx_eq_ctle_boost:  0x00 - 0x1F\n"
-		"rx_eq_ctle_pole:   0x00 - 0x07\n"
-		"rx_eq_dfe_tap1:    0x00 - 0xFF\n"
-		"rx_afe_adapt_en:	0 - disable, 1 - enable\n"
-		"rx_dfe_adapt_en:	0 - disable, 1 - enable\n",
-	},
-	{
-		"gpy2xx_usxgmii_reach_get",
-		"Get the USXGMII reach setting",
-		NULL
-	},
+		/* Compute Current Sequence Number word offset */
+		if (_ca_type == 5) {
+			if (_sn_type == SN_32_BIT) {
+				struct egr_tr_32bpn_128bak *target_tr =
+					(struct egr_tr_32bpn_128bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_128");
+				printf("\n              SN type = 32_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
+				printf("\n                  Key = %s", buf);
+				printf("\n                   SN = %08x", target_tr->seq);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
+				printf("\n                  SCI = %s", buf);
 
-	{
-		"gpy2xx_usxgmii_loopback_cfg",
-		"Configures the USXGMII serial and parrallel loop back",
-		"gpy2xx_usxgmii_loopback_cfg [mode=?]\n"
-		"Loopback Mode\n"
-		"enum mode\n"
-		"	USXGMII_LOOPBACK_DISABLE = 0,\n"
-		"	USXGMII_LOOPBACK_TX2RX   = 1,\n"
-		"	USXGMII_LOOPBACK_RX2TX   = 2,\n",
-	},
+				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
+					printf("\n        Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
 
-	{
-		"gpy2xx_usxgmii_loopback_get",
-		"Get the USXGMII reach loop back setting",
-		NULL
-	},
+				printf("\n       SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
+				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
+				printf("\n   SA index update en = %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
+			} else if (_sn_type == SN_64_BIT) {
+				struct egr_tr_64bpn_128bak *target_tr =
+					(struct egr_tr_64bpn_128bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_128");
+				printf("\n				SN type = 32_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
+				printf("\n					Key = %s", buf);
+				printf("\n			         SN = %08x%08x", target_tr->seq1, target_tr->seq0);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
+				printf("\n                  SCI = %s", buf);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->is0), swap_uint32(target_tr->is1), swap_uint32(target_tr->is2));
+				printf("\n         Context-Salt = %s", buf);
 
-	{
-		"gpy2xx_usxgmii_tx_bert_cfg",
-		"Configures TX bert",
-		"gpy2xx_usxgmii_tx_bert_cfg  [mode=?] [nval_sel=?]\n"
-		"tx bert mode configuration\n"
-		"enum mode\n"
-		"	BERT_SQUAREWAVE_TX = 0\n"
-		"	BERT_PSEUDO_RANDOM_TX = 1\n"
-		"	BERT_PRBS31_TX = 2\n"
-		"	BERT_PRBS9_TX = 3\n"
-		"	BERT_TX_MODE_DISABLE = 4\n"
-		"Square Wave Control When square wave test pattern generation is enabled\n"
-		"enum nval_sel\n"
-		"	BERT_TX_NVAL_SEL_4 = 0\n"
-		"	BERT_TX_NVAL_SEL_5 = 1\n"
-		"	BERT_TX_NVAL_SEL_6 = 2\n"
-		"	BERT_TX_NVAL_SEL_7 = 3\n"
-		"	BERT_TX_NVAL_SEL_8 = 4\n"
-		"	BERT_TX_NVAL_SEL_9 = 5\n"
-		"	BERT_TX_NVAL_SEL_10 = 6\n"
-		"	BERT_TX_NVAL_SEL_11 = 7\n"
-		"	BERT_TX_NVAL_SEL_UNSUPPORTED = 8\n",
-	},
+				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
+					printf("\n		  Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
 
-	{
-		"gpy2xx_usxgmii_rx_bert_cfg",
-		"Configures RX bert",
-		"gpy2xx_usxgmii_rx_bert_cfg  [mode=?]\n"
-		"rx bert mode configuration\n"
-		"enum mode\n"
-		"	BERT_PSEUDO_RANDOM_RX = 0\n"
-		"	BERT_PRBS31_RX = 1\n"
-		"	BERT_PRBS9_RX = 2\n"
-		"	BERT_RX_MODE_DISABLE = 3\n",
-	},
+				printf("\n		 SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
+				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
+				printf("\n   SA index update en	= %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
+			} else {
+				printf("\nERROR: Invalid SN type.\n");
+			}
+		} else if (_ca_type == 7) {
+			if (_sn_type == SN_32_BIT) {
+				struct egr_tr_32bpn_256bak *target_tr =
+					(struct egr_tr_32bpn_256bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_256");
+				printf("\n				SN type = 32_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
+				printf("\n					Key = %s", buf);
+				printf("\n					 SN = %08x", target_tr->seq);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
+				printf("\n					SCI = %s", buf);
 
-	{
-		"gpy2xx_usxgmii_tx_bert_get",
-		"Get TX bert configuration setting",
-		NULL
-	},
+				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
+					printf("\n		  Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
 
-	{
-		"gpy2xx_usxgmii_rx_bert_get",
-		"Get RX bert configuration setting",
-		NULL
-	},
+				printf("\n		 SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
+				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
+				printf("\nSA index update en	= %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
+			} else if (_sn_type == SN_64_BIT) {
+				struct egr_tr_64bpn_256bak *target_tr =
+					(struct egr_tr_64bpn_256bak *) raw_tr.raw_trans_rec;
+				printf("\nCrypto-Algorithm type = AES_CTR_128");
+				printf("\n				SN type = 64_BIT");
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
+				printf("\n					Key = %s", buf);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", target_tr->seq1, target_tr->seq0);
+				printf("\n					 SN = %s", buf);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
+				printf("\n					SCI = %s", buf);
+				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->is0), swap_uint32(target_tr->is1), swap_uint32(target_tr->is2));
+				printf("\n		   Context-Salt = %s", buf);
 
-	{
-		"gpy2xx_usxgmii_mii_linksts",
-		"Get Port mii linkstatus (port 0 to 3 link status based on the phy address)",
-		NULL
-	},
+				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
+					printf("\n		  Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
 
-	{
-		"gpy2xx_usxgmii_aneg_sts",
-		"Get Port ANEG status (port 0 to 3 ANEG status based on the phy address)",
-		NULL
-	},
+				printf("\n		 SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
+				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
+				printf("\nSA index update en	= %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
 
-	{
-		"gpy2xx_usxgmii_pcs_pma_linksts",
-		"Get PMA and PCS link status",
-		NULL
-	},
+			} else {
+				printf("\nERROR: Invalid SN type.\n");
+			}
+		} else {
+			printf("\nERROR: Invalid Crypto-Algorithm type.\n");
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_pn: {
+		struct sa_current_pn curr_sn;
+		memset(&curr_sn, 0, sizeof(struct sa_current_pn));
 
-	{
-		"gpy2xx_usxgmii_vr_reset",
-		"Trigger VR reset",
-		NULL
-	},
+		cli_parse(cmd, argc, argv, &curr_sn);
 
-	{
-		"gpy2xx_usxgmii_vr_reset_sts",
-		"Get VR reset complete status",
-		NULL
-	},
+		ret = gpy2xx_msec_get_ing_pn(&phy, &curr_sn);
 
-	{
-		"gpy2xx_usxgmii_aneg_rst",
-		"Configures ANEG for Port 0 to 3 (based on phy address)",
-		"gpy2xx_usxgmii_aneg_rst  [usxgmii_aneg_disable=?] [usxgmii_force_linkspeed_enable=?] [usxgmii_force_linkspeed=?]  [usxgmii_force_duplex=?] [usxgmii_restart_aneg=?]\n"
-		"ANEG configuration\n"
-		"aneg enable/disable for port 0 to 3 based on phy addr\n"
-		"Valid 1 - disabled / 0 - enabled\n"
-		"	usxgmii_aneg_disable\n"
-		"restart aneg for port 0 to 3 based on phy addr\n"
-		"	usxgmii_restart_aneg\n"
-		"force link enable for port 0 to 3 based on phy addr\n"
-		"Valid 0 - disabled / 1 - enabled\n"
-		"	usxgmii_force_linkspeed\n"
-		"force link speed for port 0 to 3 based on phy addr\n"
-		"	usxgmii_force_linkspeed\n"
-		"		SPEED_10	10\n"
-		"		SPEED_100	100\n"
-		"		SPEED_1000	1000\n"
-		"		SPEED_2500	2500\n"
-		"		SPEED_UNKNOWN	-1\n"
-		"force duplex for port 0 to 3 based on phy addr\n"
-		"Valid 0 - Half duplex / 1 - Full duplex\n"
-		"	usxgmii_force_duplex\n",
-	},
+		if (ret < 0) {
+			printf("\nERROR: Ingress current SN get failed.\n");
+			return -1;
+		}
 
-	{
-		"gpy2xx_usxgmii_alignmentmarker_get",
-		"Get AM_COUNT",
-		NULL
-	},
+		printf("\nCurrent SN = 0x%llx", curr_sn.curr_pn);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_pn: {
+		struct sa_current_pn curr_sn;
+		memset(&curr_sn, 0, sizeof(struct sa_current_pn));
+
+		cli_parse(cmd, argc, argv, &curr_sn);
+
+		ret = gpy2xx_msec_get_egr_pn(&phy, &curr_sn);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress current SN get failed.\n");
+			return -1;
+		}
+
+		printf("\nCurrent SN = 0x%llx", curr_sn.curr_pn);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_tr: {
+		struct transform_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_clear_ing_tr(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress TR clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_tr: {
+		struct transform_rec raw_tr;
+		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+
+		cli_parse(cmd, argc, argv, &raw_tr);
+
+		ret = gpy2xx_msec_clear_egr_tr(&phy, &raw_tr);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress TR clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_eex: {
+		struct raw_sam_ee raw_ee;
+		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+
+		cli_parse(cmd, argc, argv, &raw_ee);
+
+		ret = gpy2xx_msec_config_ing_sam_eex(&phy, &raw_ee);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM EE type set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_eex: {
+		struct raw_sam_ee raw_ee;
+		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+
+		cli_parse(cmd, argc, argv, &raw_ee);
+
+		ret = gpy2xx_msec_config_egr_sam_eex(&phy, &raw_ee);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM EE type set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sam_eef: {
+		int i;
+		struct raw_sam_ee raw_ee;
+		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+
+		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+
+		ret = gpy2xx_msec_get_ing_sam_eef(&phy, &raw_ee);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM EE flags get failed.\n");
+			return -1;
+		}
+
+		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
+			printf("\nSAM EE flags[%02d] = %8x", i, raw_ee.raw_sam_ee[i]);
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sam_eef: {
+		int i;
+		struct raw_sam_ee raw_ee;
+		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+
+		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+
+		ret = gpy2xx_msec_get_egr_sam_eef(&phy, &raw_ee);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM EE flags get failed.\n");
+			return -1;
+		}
+
+		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
+			printf("\nSAM EE flags[%02d] = %8x", i, raw_ee.raw_sam_ee[i]);
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_eec: {
+		struct sam_ee_ctrl ee_ctrl;
+		memset(&ee_ctrl, 0, sizeof(struct sam_ee_ctrl));
+
+		cli_parse(cmd, argc, argv, &ee_ctrl);
+
+		ret = gpy2xx_msec_config_ing_sam_eec(&phy, &ee_ctrl);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM EE control set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_eec: {
+		struct sam_ee_ctrl ee_ctrl;
+		memset(&ee_ctrl, 0, sizeof(struct sam_ee_ctrl));
+
+		cli_parse(cmd, argc, argv, &ee_ctrl);
+
+		ret = gpy2xx_msec_config_egr_sam_eec(&phy, &ee_ctrl);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM EE control set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_fca: {
+		struct sa_match_fca sam_fca;
+		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-	{
-		"gpy2xx_usxgmii_alignmentmarker_set",
-		"Configures AM count",
-		"gpy2xx_usxgmii_alignmentmarker_set [usxgmii_am_count=?]\n"
-		"AM Count\n"
-		"Valid 0x00 - 0x7FFF\n"
-		"	usxgmii_am_count\n",
-	},
+		cli_parse(cmd, argc, argv, &sam_fca);
 
-	{
-		"gpy2xx_usxgmii_rx_bert_stat",
-		"Get BERT stats",
-		NULL
-	},
+		ret = gpy2xx_msec_config_ing_sam_fca(&phy, &sam_fca);
 
-};
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM flow control action set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_fca: {
+		struct sa_match_fca sam_fca;
+		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-static void gpy211_menu(const char *cmd)
-{
-	unsigned int len, max_len;
-	unsigned int i;
+		cli_parse(cmd, argc, argv, &sam_fca);
 
-	if (cmd == NULL) {
-		printf("\n\n\n\tGPY211 Utility Tool Version   : %s", TOOL_VERSION);
-		printf("\n\t*************************************\n\n");
+		ret = gpy2xx_msec_config_egr_sam_fca(&phy, &sam_fca);
 
-		max_len = 0;
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM flow control action set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sam_fca: {
+		struct sam_pkt_fca sam_fca;
+		memset(&sam_fca, 0, sizeof(struct sam_pkt_fca));
 
-		for (i = 0; i < ARRAY_SIZE(help_text); i++) {
-			len = strlen(help_text[i].cmd);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
-			if (max_len < len)
-				max_len = len;
-		}
+		ret = gpy2xx_msec_get_ing_sam_fca(&phy, &sam_fca);
 
-		for (i = 0; i < ARRAY_SIZE(help_text); i++) {
-			printf("\t %-*s : %s\n", max_len, help_text[i].cmd, help_text[i].brief);
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM flow control action get failed.\n");
+			return -1;
 		}
 
-		printf("\n\nIMPORTANT NOTE:\n");
-		printf("\nFor hex decimal input param please add 0x before the hex decimal number or just give decimal number");
-		printf("\nPrefix hex decimal value with 0x or GPY211 command execution will lead to wrong setting or malfunction\n");
-		printf("\n");
-	} else {
-		for (i = 0; i < ARRAY_SIZE(help_text) && strcasecmp(cmd, help_text[i].cmd) != 0; i++);
-
-		if (i >= ARRAY_SIZE(help_text))
-			return;
+		printf("\nIngress FCA raw %x", sam_fca.dec_enc.raw_fca_macsec);
 
-		if (help_text[i].desc == NULL) {
-			printf("%s does not have parameter.\n", help_text[i].cmd);
+		if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_BYPASS) {
+			if (sam_fca.dec_enc.flow_crypt_auth == 1) {
+				printf("\nIngress FCA - Crypto_Auth");
+				printf("\nIV mode %x", sam_fca.crypt_auth.iv);
+				printf("\nRetrieve and verify the ICV %x", sam_fca.crypt_auth.icv_verify);
+				printf("\nAAD length %x", sam_fca.crypt_auth.conf_offset);
+			} else {
+				printf("\nIngress FCA - Bypass");
+				printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
+			}
+		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_DROP) {
+			printf("\nIngress FCA - Drop");
+			printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
+		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_INGRESS) {
+			printf("\nIngress FCA - Decryption");
+			printf("\nReplay protection %x, SA in-use %x, Validation level %x, SA ind update %x, Conf offset %x, Conf protection %x",
+			       sam_fca.dec_enc.rep_prot_fr, sam_fca.dec_enc.sa_in_use, sam_fca.dec_enc.vlevel_es_scb, sam_fca.dec_enc.sa_index_update, sam_fca.dec_enc.conf_offset, sam_fca.dec_enc.conf_protect);
 		} else {
-			printf("%s", help_text[i].desc);
+			printf("\nIngress FCA - Invalid");
 		}
-	}
-}
 
-static unsigned int t_olower(u32 ch)
-{
-	if (ch >= 'A' && ch <= 'Z')
-		return ch + 'a' - 'A';
+		printf("\nDst port %x, Drop NR %x, Drop act %x, SA ind %x",
+		       sam_fca.dec_enc.dest_port, sam_fca.dec_enc.drop_non_reserved, sam_fca.dec_enc.drop_action, sam_fca.dec_enc.sa_index);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sam_fca: {
+		struct sam_pkt_fca sam_fca;
+		memset(&sam_fca, 0, sizeof(struct sam_pkt_fca));
 
-	return ch;
-}
+		cli_parse(cmd, argc, argv, &sam_fca);
 
-static unsigned int xstrncasecmp(const char *s1, const char *s2, unsigned int n)
-{
-	int c1, c2;
+		ret = gpy2xx_msec_get_egr_sam_fca(&phy, &sam_fca);
 
-	if (!s1 || !s2) return 1;
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM flow control action get failed.\n");
+			return -1;
+		}
 
-	for (; n > 0; s1++, s2++, --n) {
-		c1 = t_olower(*s1);
-		c2 = t_olower(*s2);
+		printf("\nEgress FCA raw %x", sam_fca.dec_enc.raw_fca_macsec);
 
-		if (c1 != c2) {
-			return (c1 - c2);
-		} else if (c1 == '\0') {
-			return 0;
+		if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_BYPASS) {
+			if (sam_fca.dec_enc.flow_crypt_auth == 1) {
+				printf("\nEgress FCA - Crypto_Auth");
+				printf("\nIV mode %x", sam_fca.crypt_auth.iv);
+				printf("\nAppend the calculated ICV %x", sam_fca.crypt_auth.icv_append);
+				printf("\nAAD length %x", sam_fca.crypt_auth.conf_offset);
+				printf("\nConf protection %x", sam_fca.crypt_auth.conf_protect);
+			} else {
+				printf("\nEgress FCA - Bypass");
+				printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
+			}
+		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_DROP) {
+			printf("\nEgress FCA - Drop");
+			printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
+		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_EGRESS) {
+			printf("\nEgress FCA - Encryption");
+			printf("\nFrame protection %x, SA in-use %x, Expl SCI %x, ES %x, SCB %x, Tag bp size %x, SA ind update %x, Conf offset %x, Conf protection %x",
+			       sam_fca.dec_enc.rep_prot_fr, sam_fca.dec_enc.sa_in_use, sam_fca.dec_enc.include_sci, sam_fca.dec_enc.vlevel_es_scb & 1, (sam_fca.dec_enc.vlevel_es_scb >> 1) & 1, sam_fca.dec_enc.tag_bypass_size, sam_fca.dec_enc.sa_index_update, sam_fca.dec_enc.conf_offset, sam_fca.dec_enc.conf_protect);
+		} else {
+			printf("\nEgress FCA - Invalid");
 		}
-	}
 
-	return 0;
-}
+		printf("\nDst port %x, Drop act %x, SA ind %x",
+		       sam_fca.dec_enc.dest_port, sam_fca.dec_enc.drop_action, sam_fca.dec_enc.sa_index);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_sam_fca: {
+		struct sa_match_fca sam_fca;
+		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-unsigned uart_hang = 1;
+		cli_parse(cmd, argc, argv, &sam_fca);
 
-char *var_list[MAX_PARAM];
-char *param_list1[MAX_PARAM];
+		ret = gpy2xx_msec_clear_ing_sam_fca(&phy, &sam_fca);
 
-int system_restart = 0;
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM flow control clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_sam_fca: {
+		struct sa_match_fca sam_fca;
+		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-unsigned int str_to_hex(unsigned char *str)
-{
-	unsigned int n = 0;
-	int i = 0;
+		cli_parse(cmd, argc, argv, &sam_fca);
 
-	if (!str)
-		return 0;
+		ret = gpy2xx_msec_clear_egr_sam_fca(&phy, &sam_fca);
 
-	if (str[0] == 0)
-		return 0;
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM flow control clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_rule: {
+		struct cli_sam_rule_args a;
+		memset(&a, 0, sizeof(struct cli_sam_rule_args));
 
-	while (str[i]) {
-		n = n * 16;
+		cli_parse(cmd, argc, argv, &a);
+		a.match.extn_par.flow_index = a.flow_index;
 
-		if (('0' <= str[i] && str[i] <= '9')) {
-			n += str[i] - '0';
-		} else if (('A' <= str[i] && str[i] <= 'F')) {
-			n += str[i] - 'A' + 10;
-			;
-		} else if (('a' <= str[i] && str[i] <= 'f')) {
-			n += str[i] - 'a' + 10;
-			;
-		} else
-			printf("Wrong value:%u\n", str[i]);
+		ret = gpy2xx_msec_config_ing_sam_rule(&phy, &a.match);
 
-		i++;
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM set failed.\n");
+			return -1;
+		}
+		break;
 	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_rule: {
+		struct cli_sam_rule_args a;
+		memset(&a, 0, sizeof(struct cli_sam_rule_args));
 
-	return n;
-}
+		cli_parse(cmd, argc, argv, &a);
+		a.match.extn_par.flow_index = a.flow_index;
 
-static inline unsigned int hex2int(char c)
-{
-	if (c >= '0' && c <= '9')
-		return (unsigned int)(c - '0');
-	else
-		return (unsigned int)(c - 'a' + 10);
-}
+		ret = gpy2xx_msec_config_egr_sam_rule(&phy, &a.match);
 
-#define UNIX_EPOCH 1970
-int dayofweek(int d, int m, int y)
-{
-	char day;
-	static int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_sam_rule: {
+		struct sa_match_param match_par;
+		memset(&match_par, 0, sizeof(struct sa_match_param));
 
-	y -= m < 3;
-	day = (y + y/4 - y/100 + y/400 + t[m-1] + d) % 7;
+		cli_parse(cmd, argc, argv, &match_par);
 
-	//If leap year it will be the remainder-1
-	if (y % 4 == 0)
-		day -= 1;
+		ret = gpy2xx_msec_clear_ing_sam_rule(&phy, &match_par);
 
-	return day;
-}
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_sam_rule: {
+		struct sa_match_param match_par;
+		memset(&match_par, 0, sizeof(struct sa_match_param));
 
-static int print_sys_time(u32 sec, u32 nsec)
-{
-	int year,act_leap = 0,  leap_days = 0, act_mnum, mnum = 0, act_day, day, hour, minute, is_leap = UNIX_EPOCH;
-	char *monName = "January";
-	//PTP Unix time starts from 1st Jan 1970, Thirsday
-	char *dayName[] = {"Thursday", "Friday", "Saturday", "Sunday", "Monday", "Tuesday", "Wednesday"};
-	char *weekDay;
+		cli_parse(cmd, argc, argv, &match_par);
 
-	minute = sec / 60;
-	sec = sec % 60;
+		ret = gpy2xx_msec_clear_egr_sam_rule(&phy, &match_par);
 
-	hour = minute / 60;
-	minute = minute % 60;
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_vlan_parse: {
+		struct cli_vlan_parse_args a;
+		struct sam_vlan_parse match_par;
+		memset(&a, 0, sizeof(struct cli_vlan_parse_args));
+		memset(&match_par, 0, sizeof(struct sam_vlan_parse));
 
-	day = act_day = hour / 24;
-	weekDay = dayName[day % 7];
-	hour = hour % 24;
+		cli_parse(cmd, argc, argv, &a);
+		match_par.outer_tag.parse_qinq = a.qinq_en;
+		match_par.outer_tag.parse_stag = a.stag_en;
+		match_par.outer_tag.parse_qtag = a.qtag_en;
 
-	year  = day / 365;
-	//printf("\n\tYrs %d days %d hours %d mins %d secs %d\n", year, day, hour, minute, sec);
+		ret = gpy2xx_msec_config_ing_vlan_parse(&phy, &match_par);
 
-	while ((is_leap < (UNIX_EPOCH + year))) {
-		if (is_leap % 4 == 0)
-			act_leap++;
-		is_leap++;
-	};
-	//printf("\n\tLeap days %d\n", act_leap);
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM VLAN control set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_vlan_parse: {
+		struct cli_vlan_parse_args a;
+		struct sam_vlan_parse match_par;
+		memset(&a, 0, sizeof(struct cli_vlan_parse_args));
+		memset(&match_par, 0, sizeof(struct sam_vlan_parse));
 
-	year = (act_day - act_leap) / 365;
-	act_day -= act_leap;
-	day = act_day % 365;
-	mnum = act_mnum = day / 30;
-	//printf("\n\tAct yrs %d, act days %d\n", year, act_day);
+		cli_parse(cmd, argc, argv, &a);
+		match_par.outer_tag.parse_qinq = a.qinq_en;
+		match_par.outer_tag.parse_stag = a.stag_en;
+		match_par.outer_tag.parse_qtag = a.qtag_en;
 
-	leap_days = 0;
-	is_leap = UNIX_EPOCH;
-	while ((is_leap < (UNIX_EPOCH + year))) {
-		if (is_leap % 4 == 0)
-			leap_days++;
-		is_leap++;
-	};
+		ret = gpy2xx_msec_config_egr_vlan_parse(&phy, &match_par);
+
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM VLAN control set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sam_rule: {
+		int i;
+		struct raw_sam_param raw_sam;
+		memset(&raw_sam, 0, sizeof(struct raw_sam_param));
 
-	//day += (((act_leap == leap_days) ? 0 : 1) + 1); //+1 for the current day
-	day += ((act_leap - leap_days) + 1); //+1 for the current day
-	//printf("\n\tAct yrs %d leap days %d days %d month num %d\n", year, leap_days, day, mnum);
+		cli_parse(cmd, argc, argv, &raw_sam);
 
-	switch (act_mnum) {
-	case 1:
-		if (day > 31) {
-			monName = "February";
-			mnum += 1;
-			day -= 31;
+		ret = gpy2xx_msec_get_ing_sam_rule(&phy, &raw_sam);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress SAM get failed.\n");
+			return -1;
 		}
-	break;
-	case 2:
-	case 3:
-		monName = "March";
-		if (day > 90) {
-			monName = "April";
-			mnum += 1;
-			day -= 90;
-		} else
-			day -= 59;
-	break;
-	case 4:
-		monName = "April";
-		if (day > 120) {
-			monName = "May";
-			mnum += 1;
-			day -= 120;
-		} else
-			day -= 90;
-	break;
-	case 5:
-		monName = "May";
-		if (day > 151) {
-			monName = "June";
-			mnum += 1;
-			day -= 151;
-		} else
-			day -= 120;
-	break;
-	case 6:
-		monName = "June";
-		if (day > 181) {
-			monName = "July";
-			mnum += 1;
-			day -= 181;
-		} else
-			day -= 151;
-	break;
-	case 7:
-		monName = "July";
-		if (day > 212) {
-			monName = "August";
-			mnum += 1;
-			day -= 212;
-		} else
-			day -= 181;
-	break;
-	case 8:
-		monName = "August";
-		if (day > 243) {
-			monName = "September";
-			mnum += 1;
-			day -= 243;
-		} else
-			day -= 212;
-	break;
-	case 9:
-		monName = "September";
-		if (day > 273) {
-			monName = "October";
-			mnum += 1;
-			day -= 273;
-		} else
-			day -= 243;
-	break;
-	case 10:
-		monName = "October";
-		if (day > 304) {
-			monName = "November";
-			mnum += 1;
-			day -= 304;
-		} else
-			day -= 273;
-	break;
-	case 11:
-		monName = "November";
-		if (day > 334) {
-			monName = "December";
-			mnum += 1;
-			day -= 334;
-		} else
-			day -= 304;
-	break;
-	case 12:
-		monName = "December";
-		day -= 334;
-	break;
-	default:
-	break;
-	}
 
-	//If the current year is leap and beyond feb?
-	if (((UNIX_EPOCH + year) % 4 == 0) && (act_mnum > 1)) {
-		//printf("\n\tThe current year %d is leap", (UNIX_EPOCH + year));
-		day -= 1;
+		for (i = 0; i < IE_MAX_SAM_SIZE_WORDS; i++) {
+			printf("\nSAMParam[%02d] = %8x", i, raw_sam.raw_sam_param[i]);
+		}
+		break;
 	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sam_rule: {
+		int i;
+		struct raw_sam_param raw_sam;
+		memset(&raw_sam, 0, sizeof(struct raw_sam_param));
 
-	//printf("\n\tYr %d day %d mon %d\n", (UNIX_EPOCH + year), day, mnum);
-	printf("\n\tUnix system time: %s %s %d %d %02d:%02d:%02d GMT\n", weekDay, monName, day, (UNIX_EPOCH + year), hour, minute, sec);
-	return 0;
-}
+		cli_parse(cmd, argc, argv, &raw_sam);
 
+		ret = gpy2xx_msec_get_egr_sam_rule(&phy, &raw_sam);
 
-static char *findArgParam(int argc, char *argv[], char *name)
-{
-	int i = 0;
-	size_t len;
+		if (ret < 0) {
+			printf("\nERROR: Egress SAM get failed.\n");
+			return -1;
+		}
 
-	len = strlen(name);
+		for (i = 0; i < IE_MAX_SAM_SIZE_WORDS; i++) {
+			printf("\nSAMParam[%02d] = %8x", i, raw_sam.raw_sam_param[i]);
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_rule: {
+		struct cli_cc_rule_args a;
+		memset(&a, 0, sizeof(struct cli_cc_rule_args));
 
-	for (i = 0; i < argc; i++) {
-		if (xstrncasecmp(name, argv[i], len) == 0) {
-			if (strlen(argv[i]) > (len + 1)) {
+		cli_parse(cmd, argc, argv, &a);
+		a.match.vlan_eth.payload_e_type = a.eth_type;
+		a.match.icc_misc.raw_iccm_misc = a.misc;
 
-				if ('=' == argv[i][len]) {
-					return argv[i] + len + 1;
-				}
-			}
+		ret = gpy2xx_msec_config_ing_cc_rule(&phy, &a.match);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress CC rule set failed.\n");
+			return -1;
 		}
+		break;
 	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cc_rule: {
+		struct icc_match_param cc_match;
+		memset(&cc_match, 0, sizeof(struct icc_match_param));
 
-	return NULL;
-}
+		cli_parse(cmd, argc, argv, &cc_match);
 
-int scanParamArg(int argc, char *argv[], char *name, int size, void *param)
-{
-	unsigned long long int tmp;
-	char *endptr;
+		ret = gpy2xx_msec_get_ing_cc_rule(&phy, &cc_match);
 
-	char *ptr = findArgParam(argc, argv, name);
+		if (ret < 0) {
+			printf("\nERROR: Ingress CC rule get failed.\n");
+			return -1;
+		}
 
-	if (ptr == NULL) return 0;
+		printf("\nIngress CC match parameters:\n----------------\n");
+		printf("\nICCParam[00] = %8x", cc_match.vlan_eth.raw_iccm_vleth);
+		printf("\nICCParam[01] = %8x", cc_match.icc_misc.raw_iccm_misc);
+		//printf("\nICCParam[02] = %8x", cc_match.icc_ivl.raw_iccm_ivl);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_eef: {
+		struct raw_icc_ee raw_cc;
+		memset(&raw_cc, 0, sizeof(struct raw_icc_ee));
 
-	/* check if the given parameter value are the boolean "LTQ_TRUE" / "LTQ_FALSE" */
+		cli_parse(cmd, argc, argv, &raw_cc);
 
-	if (0 == xstrncasecmp(ptr, "LTQ_TRUE", strlen(ptr))
-	    || 0 == xstrncasecmp(ptr, "TRUE", strlen(ptr))
-	    || 0 == xstrncasecmp(ptr, "FULL", strlen(ptr))) {
-		tmp = 1;
-	} else if (0 == xstrncasecmp(ptr, "LTQ_FALSE", strlen(ptr))
-		   || 0 == xstrncasecmp(ptr, "FALSE", strlen(ptr))
-		   || 0 == xstrncasecmp(ptr, "HALF", strlen(ptr))) {
-		tmp = 0;
-	} else {
-		/* scan for a number */
-		tmp = strtoull(ptr, &endptr, 0);
+		ret = gpy2xx_msec_config_ing_cc_eef(&phy, &raw_cc);
 
-		/* parameter detection does not work in case there are more character after the provided number */
-		if (*endptr != '\0')
-			return 0;
+		if (ret < 0) {
+			printf("\nERROR: ICC EE flags set failed.\n");
+			return -1;
+		}
+		break;
 	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cc_eef: {
+		int i;
+		struct raw_icc_ee raw_cc;
+		memset(&raw_cc, 0, sizeof(struct raw_icc_ee));
 
-	if (size <= 4)
-		size *= 8;
+		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
 
-	if (size == 8)
-		*((char *)param) = (char)tmp;
-	else if (size == 16)
-		*((short *)param) = (short)tmp;
-	else if (size == 32)
-		*((int *)param) = (int)tmp;
-	else if (size == 64)
-		*((long long *)param) = (long long)tmp;
+		ret = gpy2xx_msec_get_ing_cc_eef(&phy, &raw_cc);
 
-	return 1;
-}
+		if (ret < 0) {
+			printf("\nERROR: ICC EE flags get failed.\n");
+			return -1;
+		}
 
-int scanMAC_Arg(int argc, char *argv[], char *name, unsigned char *param)
-{
-	char *ptr = findArgParam(argc, argv, name);
+		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
+			printf("\nICC EE flags[%02d] = %8x", i, raw_cc.raw_icc_ee[i]);
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_eec: {
+		struct cli_cc_eec_args a;
+		struct icc_ee_ctrl ee_ctrl;
+		memset(&a, 0, sizeof(struct cli_cc_eec_args));
+		memset(&ee_ctrl, 0, sizeof(struct icc_ee_ctrl));
 
-	if (ptr == NULL) return 0;
+		cli_parse(cmd, argc, argv, &a);
+		ee_ctrl.cc_index_set = a.icc_ind_set;
+		ee_ctrl.set_enable = a.set_single;
+		ee_ctrl.set_all = a.set_all;
+		ee_ctrl.cc_index_clear = a.icc_ind_clr;
+		ee_ctrl.clear_enable = a.clr_single;
+		ee_ctrl.clear_all = a.clr_all;
 
-	return convert_mac_adr_str(ptr, param);
-}
+		ret = gpy2xx_msec_config_ing_cc_eec(&phy, &ee_ctrl);
 
-int scanKey_Arg(int argc, char *argv[], char *name, u8 size, char *param)
-{
-	char *ptr = findArgParam(argc, argv, name);
+		if (ret < 0) {
+			printf("\nERROR: Ingress CC EE control set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_ctrl: {
+		struct ing_cc_ctrl cc_ctrl;
+		memset(&cc_ctrl, 0, sizeof(struct ing_cc_ctrl));
 
-	if (ptr == NULL) return 0;
+		cli_parse(cmd, argc, argv, &cc_ctrl);
 
-	return copy_key_to_dst(ptr, size, param);
-}
+		ret = gpy2xx_msec_config_ing_cc_ctrl(&phy, &cc_ctrl);
 
-static struct {
-	const char *name;
-	enum link_mode_bit_indices bit;
-} phy_advert[] = {
-	{"10baseT_Half", LINK_MODE_10baseT_Half_BIT},
-	{"10baseT_Full", LINK_MODE_10baseT_Full_BIT},
-	{"100baseT_Half", LINK_MODE_100baseT_Half_BIT},
-	{"100baseT_Full", LINK_MODE_100baseT_Full_BIT},
-	{"1000baseT_Half", LINK_MODE_1000baseT_Half_BIT},
-	{"1000baseT_Full", LINK_MODE_1000baseT_Full_BIT},
-	{"2500baseT_Full", LINK_MODE_2500baseT_Full_BIT},
-	{"2500baseT_FR", LINK_MODE_2500baseT_FR_BIT},
-	{"5000baseT_Full", LINK_MODE_5000baseT_Full_BIT},
-	{"5000baseT_FR", LINK_MODE_5000baseT_FR_BIT},
-	{"Autoneg", LINK_MODE_Autoneg_BIT},
-	{"Pause", LINK_MODE_Pause_BIT},
-	{"Asym_Pause", LINK_MODE_Asym_Pause_BIT},
-};
+		if (ret < 0) {
+			printf("\nERROR: Ingress CC Control flags set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_stats_summ: {
+		int i;
+		struct stats_summary xxx_summ;
+		struct ing_global_bmap counter_bmap;
+		memset(&xxx_summ, 0, sizeof(struct stats_summary));
 
-static int scan_advert(int argc, char *argv[], char *name, u64 *param)
-{
-	char *p, *p1, *p2;
-	unsigned int i;
+		ret = gpy2xx_msec_get_ing_stats_summ(&phy, &xxx_summ);
+
+		if (ret < 0) {
+			printf("\nERROR: Ingress stats summary get failed.\n");
+			return -1;
+		}
 
-	p = findArgParam(argc, argv, name);
+		printf("\nStatistics summary flags:\n----------------\n");
 
-	if (p == NULL)
-		return 0;
+		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
+			printf("\nPer-SA summary[%02d] = %8x", i, xxx_summ.psa_sum_word[i]);
+		}
 
-	*param = 0;
+		printf("\nGlobal statistics summary = %8x", xxx_summ.glb_summ_word);
+		counter_bmap.raw_global_bmap = xxx_summ.glb_summ_word;
 
-	for (p1 = p; *p1 != 0; p1 = p2) {
-		for (p2 = p1; *p2 != 0 && *p2 != ',' && *p2 != '|' && *p2 != ';'; p2++);
+		if (counter_bmap.TransformErrorPkts)
+			printf("\nTransformErrorPkts counter expired");
 
-		if (*p2 != 0) {
-			*p2 = 0;
-			p2++;
-		}
+		if (counter_bmap.InPktsCtrl)
+			printf("\nInPktsCtrl counter expired");
 
-		if (*p1 == 0)
-			continue;
+		if (counter_bmap.InPktsNoTag)
+			printf("\nInPktsNoTag counter expired");
 
-		for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
-			if (strcasecmp(p1, phy_advert[i].name) == 0) {
-				*param |= (u64)1 << phy_advert[i].bit;
-				break;
-			}
-		}
-	}
+		if (counter_bmap.InPktsUntagged)
+			printf("\nInPktsUntagged counter expired");
 
-	return 1;
-}
+		if (counter_bmap.InPktsTagged)
+			printf("\nInPktsTagged counter expired");
 
-static int print_advert(char *buf, unsigned int size, u64 param)
-{
-	char *p = buf;
-	unsigned int flag = 0;
-	unsigned int total_len = 0;
-	unsigned int len;
-	unsigned int i;
+		if (counter_bmap.InPktsBadTag)
+			printf("\nInPktsBadTag counter expired");
 
-	strncpy(buf, "none", size);
-	buf[size - 1] = 0;
+		if (counter_bmap.InPktsUntaggedMiss)
+			printf("\nInPktsUntaggedMiss counter expired");
 
-	for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
-		if ((param & ((u64)1 << phy_advert[i].bit))) {
-			len = strlen(phy_advert[i].name);
+		if (counter_bmap.InPktsNoSCI)
+			printf("\nInPktsNoSCI counter expired");
 
-			if (flag == 0) {
-				if (total_len + len + 1 >= size)
-					break;
+		if (counter_bmap.InPktsUnknownSCI)
+			printf("\nInPktsUnknownSCI counter expired");
 
-				flag++;
-			} else {
-				if (total_len + len + 4 >= size)
-					break;
+		if (counter_bmap.InConsistCheckControlledNotPass)
+			printf("\nInConsistCheckControlledNotPass counter expired");
 
-				p[0] = ' ';
-				p[1] = '|';
-				p[2] = ' ';
-				p += 3;
-				total_len += 3;
-			}
+		if (counter_bmap.InConsistCheckUncontrolledNotPass)
+			printf("\nInConsistCheckUncontrolledNotPass counter expired");
 
-			strcpy(p, phy_advert[i].name);
-			p += len;
-			total_len += len;
-		}
-	}
+		if (counter_bmap.InConsistCheckControlledPass)
+			printf("\nInConsistCheckControlledPass counter expired");
 
-	return (int)total_len;
-}
+		if (counter_bmap.InConsistCheckUncontrolledPass)
+			printf("\nInConsistCheckUncontrolledPass counter expired");
 
-int gpy2xx_msec_main(int argc, char *argv[])
-{
-	s32 ret = 0;
-	s32 cnt = 0;
+		if (counter_bmap.InOverSizePkts)
+			printf("\nInOverSizePkts counter expired");
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_stats_summ: {
+		int i;
+		struct stats_summary xxx_summ;
+		struct egr_global_bmap counter_bmap;
+		memset(&xxx_summ, 0, sizeof(struct stats_summary));
 
-	if (xstrncasecmp(argv[3], "gpy2xx_msec_init_ing_dev", strlen("gpy2xx_msec_init_ing_dev")) == 0) {
-		ret = gpy2xx_msec_init_ing_dev(&phy);
+		ret = gpy2xx_msec_get_egr_stats_summ(&phy, &xxx_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Init ING dev failed.\n");
+			printf("\nERROR: Ingress stats summary get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_init_egr_dev", strlen("gpy2xx_msec_init_egr_dev")) == 0) {
-		ret = gpy2xx_msec_init_egr_dev(&phy);
 
-		if (ret < 0) {
-			printf("\nERROR: Init EGR dev failed.\n");
-			return -1;
+		printf("\nStatistics summary flags:\n----------------\n");
+
+		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
+			printf("\nPer-SA summary[%02d] = %8x", i, xxx_summ.psa_sum_word[i]);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_tr", strlen("gpy2xx_msec_config_ing_tr")) == 0) {
-		struct transform_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
-		cnt += scanParamArg(argc, argv, "ca_type", sizeof(raw_tr.ccw.ca_type), &raw_tr.ccw.ca_type);
-		cnt += scanKey_Arg(argc, argv, "key", (((raw_tr.ccw.ca_type == GCM_AES_128) || (raw_tr.ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32), (char *)raw_tr.cp.key);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(raw_tr.cp.sci), (char *)raw_tr.cp.sci);
-		//cnt += scanParamArg(argc, argv, "seq0", sizeof(raw_tr.pn_rc.seq0), &raw_tr.pn_rc.seq0);
-		//cnt += scanParamArg(argc, argv, "seq1", sizeof(raw_tr.pn_rc.seq1), &raw_tr.pn_rc.seq1);
-		cnt += scanParamArg(argc, argv, "seq_num", 64, &raw_tr.pn_rc.seq_num);
-		cnt += scanKey_Arg(argc, argv, "salt", sizeof(raw_tr.cp.c_salt.salt), (char *)raw_tr.cp.c_salt.salt);
-		cnt += scanKey_Arg(argc, argv, "short_sci", sizeof(raw_tr.cp.c_salt.s_sci), (char *)raw_tr.cp.c_salt.s_sci);
-		cnt += scanParamArg(argc, argv, "rep_window", sizeof(raw_tr.pn_rc.mask), &raw_tr.pn_rc.mask);
+		printf("\nGlobal statistics summary = %8x", xxx_summ.glb_summ_word);
+		counter_bmap.raw_global_bmap = xxx_summ.glb_summ_word;
 
-		ret = gpy2xx_msec_config_ing_tr(&phy, &raw_tr);
+		if (counter_bmap.TransformErrorPkts)
+			printf("\nTransformErrorPkts counter expired");
 
-		if (ret < 0) {
-			printf("\nERROR: Ingress TR set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_tr", strlen("gpy2xx_msec_config_egr_tr")) == 0) {
-		struct transform_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+		if (counter_bmap.OutPktsCtrl)
+			printf("\nOutPktsCtrl counter expired");
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
-		cnt += scanParamArg(argc, argv, "ca_type", sizeof(raw_tr.ccw.ca_type), &raw_tr.ccw.ca_type);
-		cnt += scanParamArg(argc, argv, "an", sizeof(raw_tr.ccw.an), &raw_tr.ccw.an);
-		cnt += scanKey_Arg(argc, argv, "key", (((raw_tr.ccw.ca_type == GCM_AES_128) || (raw_tr.ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32), (char *)raw_tr.cp.key);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(raw_tr.cp.sci), (char *)raw_tr.cp.sci);
-		//cnt += scanParamArg(argc, argv, "seq0", sizeof(raw_tr.pn_rc.seq0), &raw_tr.pn_rc.seq0);
-		//cnt += scanParamArg(argc, argv, "seq1", sizeof(raw_tr.pn_rc.seq1), &raw_tr.pn_rc.seq1);
-		cnt += scanParamArg(argc, argv, "seq_num", 64, &raw_tr.pn_rc.seq_num);
-		cnt += scanKey_Arg(argc, argv, "salt", sizeof(raw_tr.cp.c_salt.salt), (char *)raw_tr.cp.c_salt.salt);
-		cnt += scanKey_Arg(argc, argv, "short_sci", sizeof(raw_tr.cp.c_salt.s_sci), (char *)raw_tr.cp.c_salt.s_sci);
-		cnt += scanParamArg(argc, argv, "next_sa_ind", sizeof(raw_tr.sa_update.sa_index), &raw_tr.sa_update.sa_index);
-		cnt += scanParamArg(argc, argv, "sa_expirq", sizeof(raw_tr.sa_update.sa_expired_irq), &raw_tr.sa_update.sa_expired_irq);
-		cnt += scanParamArg(argc, argv, "sa_indvalid", sizeof(raw_tr.sa_update.sa_index_valid), &raw_tr.sa_update.sa_index_valid);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(raw_tr.sa_update.flow_index), &raw_tr.sa_update.flow_index);
-		cnt += scanParamArg(argc, argv, "sa_indupen", sizeof(raw_tr.sa_update.sa_ind_update_en), &raw_tr.sa_update.sa_ind_update_en);
+		if (counter_bmap.OutPktsUnknownSA)
+			printf("\nOutPktsUnknownSA counter expired");
 
-		ret = gpy2xx_msec_config_egr_tr(&phy, &raw_tr);
+		if (counter_bmap.OutPktsUntagged)
+			printf("\nOutPktsUntagged counter expired");
 
-		if (ret < 0) {
-			printf("\nERROR: Egress TR set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_update_egr_sa_cw", strlen("gpy2xx_msec_update_egr_sa_cw")) == 0) {
-		struct transform_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+		if (counter_bmap.OutOverSizePkts)
+			printf("\nOutOverSizePkts counter expired");
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sa_stats: {
+		struct ing_sa_stats sa_ctrs;
+		memset(&sa_ctrs, 0, sizeof(struct ing_sa_stats));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
-		cnt += scanParamArg(argc, argv, "ca_type", sizeof(raw_tr.ccw.ca_type), &raw_tr.ccw.ca_type);
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(raw_tr.ccw.sn_type), &raw_tr.ccw.sn_type);
-		cnt += scanParamArg(argc, argv, "next_sa_ind", sizeof(raw_tr.sa_update.sa_index), &raw_tr.sa_update.sa_index);
-		cnt += scanParamArg(argc, argv, "sa_expirq", sizeof(raw_tr.sa_update.sa_expired_irq), &raw_tr.sa_update.sa_expired_irq);
-		cnt += scanParamArg(argc, argv, "sa_indvalid", sizeof(raw_tr.sa_update.sa_index_valid), &raw_tr.sa_update.sa_index_valid);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(raw_tr.sa_update.flow_index), &raw_tr.sa_update.flow_index);
-		cnt += scanParamArg(argc, argv, "sa_indupen", sizeof(raw_tr.sa_update.sa_ind_update_en), &raw_tr.sa_update.sa_ind_update_en);
+		cli_parse(cmd, argc, argv, &sa_ctrs);
 
-		ret = gpy2xx_msec_update_egr_sa_cw(&phy, &raw_tr);
+		ret = gpy2xx_msec_get_ing_sa_stats(&phy, &sa_ctrs);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SA update set failed.\n");
+			printf("\nERROR: SA counters get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_tr", strlen("gpy2xx_msec_get_ing_tr")) == 0) {
-		char buf[256];
-		u32 _ca_type, _sn_type;
-		struct raw_trans_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		printf("\nSA Counters:\n----------------\n");
+		printf("\t%40s:\t0x%llx\n", "InOctetsDecrypted", sa_ctrs.InOctetsDecrypted);
+		printf("\t%40s:\t0x%llx\n", "InOctetsDecrypted2", sa_ctrs.InOctetsDecrypted2);
+		printf("\t%40s:\t0x%llx\n", "InPktsUnchecked", sa_ctrs.InPktsUnchecked);
+		printf("\t%40s:\t0x%llx\n", "InPktsDelayed", sa_ctrs.InPktsDelayed);
+		printf("\t%40s:\t0x%llx\n", "InPktsLate", sa_ctrs.InPktsLate);
+		printf("\t%40s:\t0x%llx\n", "InPktsOK", sa_ctrs.InPktsOK);
+		printf("\t%40s:\t0x%llx\n", "InPktsInvalid", sa_ctrs.InPktsInvalid);
+		printf("\t%40s:\t0x%llx\n", "InPktsNotValid", sa_ctrs.InPktsNotValid);
+		printf("\t%40s:\t0x%llx\n", "InPktsNotUsingSA", sa_ctrs.InPktsNotUsingSA);
+		printf("\t%40s:\t0x%llx\n", "InPktsUnusedSA", sa_ctrs.InPktsUnusedSA);
+		printf("\t%40s:\t0x%llx\n", "InPktsUntaggedHit", sa_ctrs.InPktsUntaggedHit);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sa_stats: {
+		struct egr_sa_stats sa_ctrs;
+		memset(&sa_ctrs, 0, sizeof(struct egr_sa_stats));
+
+		cli_parse(cmd, argc, argv, &sa_ctrs);
 
-		ret = gpy2xx_msec_get_ing_tr(&phy, &raw_tr);
+		ret = gpy2xx_msec_get_egr_sa_stats(&phy, &sa_ctrs);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress TR get failed.\n");
+			printf("\nERROR: SA counters get failed.\n");
 			return -1;
 		}
 
-		int i;
+		printf("\nSA Counters:\n----------------\n");
+		printf("\t%40s:\t0x%llx\n", "OutOctetsEncrypted", sa_ctrs.OutOctetsEncrypted);
+		printf("\t%40s:\t0x%llx\n", "OutOctetsEncrypted2", sa_ctrs.OutOctetsEncrypted2);
+		printf("\t%40s:\t0x%llx\n", "OutPktsEncrypted", sa_ctrs.OutPktsEncrypted);
+		printf("\t%40s:\t0x%llx\n", "OutPktsTooLong", sa_ctrs.OutPktsTooLong);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_global_stats: {
+		struct ing_global_stats global_ctrs;
+		memset(&global_ctrs, 0, sizeof(struct ing_global_stats));
 
-		for (i = 0; i < ING_MAX_TR_SIZE_WORDS; i++) {
-			printf("\nTRec[%02d] = %8x", i, raw_tr.raw_trans_rec[i]);
-		}
+		ret = gpy2xx_msec_get_ing_global_stats(&phy, &global_ctrs);
 
-		_sn_type = (raw_tr.raw_trans_rec[0] >> 28) & 0x3;
-		_ca_type = (raw_tr.raw_trans_rec[0] >> 17) & 0x7;
-		//salt= short_sci=7A30C118
+		if (ret < 0) {
+			printf("\nERROR: GLOBAL counters get failed.\n");
+			return -1;
+		}
 
-		/* Compute Current Sequence Number word offset */
-		if (_ca_type == 5) {
-			if (_sn_type == SN_32_BIT) {
-				struct ing_tr_32bpn_128bak *target_tr =
-					(struct ing_tr_32bpn_128bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_128");
-				printf("\n              SN type = 32_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
-				printf("\n                  Key = %s", buf);
-				printf("\n                   SN = %08x", target_tr->seq);
-				printf("\n   Replay Window size = %08x", target_tr->mask);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
-				printf("\n                  SCI = %s", buf);
-			} else if (_sn_type == SN_64_BIT) {
-				struct ing_tr_64bpn_128bak *target_tr =
-					(struct ing_tr_64bpn_128bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_128");
-				printf("\n              SN type = 32_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
-				printf("\n                  Key = %s", buf);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", target_tr->seq1, target_tr->seq0);
-				printf("\n                   SN = %s", buf);
-				printf("\n   Replay Window size = %08x", target_tr->mask);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1), swap_uint32(target_tr->iv2));
-				printf("\n         Context-Salt = %s", buf);
-			} else {
-				printf("\nERROR: Invalid SN type.\n");
-			}
-		} else if (_ca_type == 7) {
-			if (_sn_type == SN_32_BIT) {
-				struct ing_tr_32bpn_256bak *target_tr =
-					(struct ing_tr_32bpn_256bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_256");
-				printf("\n              SN type = 32_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
-				printf("\n                  Key = %s", buf);
-				printf("\n                   SN = %08x", target_tr->seq);
-				printf("\n   Replay Window size = %08x", target_tr->mask);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
-				printf("\n                  SCI = %s", buf);
-			} else if (_sn_type == SN_64_BIT) {
-				struct ing_tr_64bpn_256bak *target_tr =
-					(struct ing_tr_64bpn_256bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_128");
-				printf("\n              SN type = 64_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
-				printf("\n                  Key = %s", buf);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", target_tr->seq1, target_tr->seq0);
-				printf("\n                   SN = %s", buf);
-				printf("\n   Replay Window size = %08x", target_tr->mask);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1), swap_uint32(target_tr->iv2));
-				printf("\n         Context-Salt = %s", buf);
-			} else {
-				printf("\nERROR: Invalid SN type.\n");
-			}
-		} else {
-			printf("\nERROR: Invalid Crypto-Algorithm type.\n");
+		printf("\nGLOBAL Counters:\n----------------\n");
+		printf("\t%40s:\t0x%llx\n", "TransformErrorPkts", global_ctrs.TransformErrorPkts);
+		printf("\t%40s:\t0x%llx\n", "InPktsCtrl", global_ctrs.InPktsCtrl);
+		printf("\t%40s:\t0x%llx\n", "InPktsNoTag", global_ctrs.InPktsNoTag);
+		printf("\t%40s:\t0x%llx\n", "InPktsUntagged", global_ctrs.InPktsUntagged);
+		printf("\t%40s:\t0x%llx\n", "InPktsTagged", global_ctrs.InPktsTagged);
+		printf("\t%40s:\t0x%llx\n", "InPktsBadTag", global_ctrs.InPktsBadTag);
+		printf("\t%40s:\t0x%llx\n", "InPktsUntaggedMiss", global_ctrs.InPktsUntaggedMiss);
+		printf("\t%40s:\t0x%llx\n", "InPktsNoSCI", global_ctrs.InPktsNoSCI);
+		printf("\t%40s:\t0x%llx\n", "InPktsUnknownSCI", global_ctrs.InPktsUnknownSCI);
+		printf("\t%40s:\t0x%llx\n", "InConsistCheckControlledNotPass", global_ctrs.InConsistCheckControlledNotPass);
+		printf("\t%40s:\t0x%llx\n", "InConsistCheckUncontrolledNotPass", global_ctrs.InConsistCheckUncontrolledNotPass);
+		printf("\t%40s:\t0x%llx\n", "InConsistCheckControlledPass", global_ctrs.InConsistCheckControlledPass);
+		printf("\t%40s:\t0x%llx\n", "InConsistCheckUncontrolledPass", global_ctrs.InConsistCheckUncontrolledPass);
+		printf("\t%40s:\t0x%llx\n", "InOverSizePkts", global_ctrs.InOverSizePkts);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_global_stats: {
+		struct egr_global_stats global_ctrs;
+		memset(&global_ctrs, 0, sizeof(struct egr_global_stats));
+
+		ret = gpy2xx_msec_get_egr_global_stats(&phy, &global_ctrs);
+
+		if (ret < 0) {
+			printf("\nERROR: GLOBAL counters get failed.\n");
+			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_tr", strlen("gpy2xx_msec_get_egr_tr")) == 0) {
-		char buf[256];
-		u32 _ca_type, _sn_type;
-		struct raw_trans_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		printf("\nGLOBAL Counters:\n----------------\n");
+		printf("\t%40s:\t0x%llx\n", "TransformErrorPkts", global_ctrs.TransformErrorPkts);
+		printf("\t%40s:\t0x%llx\n", "OutPktsCtrl", global_ctrs.OutPktsCtrl);
+		printf("\t%40s:\t0x%llx\n", "OutPktsUnknownSA", global_ctrs.OutPktsUnknownSA);
+		printf("\t%40s:\t0x%llx\n", "OutPktsUntagged", global_ctrs.OutPktsUntagged);
+		printf("\t%40s:\t0x%llx\n", "OutOverSizePkts", global_ctrs.OutOverSizePkts);
+#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_debug_stats: {
+		struct stats_debug_regs dbg_ctrs;
+		memset(&dbg_ctrs, 0, sizeof(struct stats_debug_regs));
 
-		ret = gpy2xx_msec_get_egr_tr(&phy, &raw_tr);
+		ret = gpy2xx_msec_get_ing_debug_stats(&phy, &dbg_ctrs);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress TR get failed.\n");
+			printf("\nERROR: Debug counters get failed.\n");
 			return -1;
 		}
 
-		int i;
+		printf("\nDebug Counters:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "SA counters that were incremented", dbg_ctrs.cdb1.sa_inc_mask);
+		printf("\t%40s:\t0x%x\n", "SA octet counters that were incremented", dbg_ctrs.cdb1.sa_octet_inc);
+		printf("\t%40s:\t0x%x\n", "Raw CDB1", dbg_ctrs.cdb1.raw_cdb1);
 
-		for (i = 0; i < EGR_MAX_TR_SIZE_WORDS; i++) {
-			printf("\nTRec[%02d] = %8x", i, raw_tr.raw_trans_rec[i]);
-		}
+		printf("\t%40s:\t0x%x\n", "VLAN counters that were incremented", dbg_ctrs.cdb2.vlan_inc_mask);
+		printf("\t%40s:\t0x%x\n", "VLAN octet counters that were incremented", dbg_ctrs.cdb2.vlan_octet_inc);
+		printf("\t%40s:\t0x%x\n", "Raw CDB2", dbg_ctrs.cdb2.raw_cdb2);
 
-		_sn_type = (raw_tr.raw_trans_rec[0] >> 28) & 0x3;
-		_ca_type = (raw_tr.raw_trans_rec[0] >> 17) & 0x7;
+		printf("\t%40s:\t0x%x\n", "Global counters that were incremented", dbg_ctrs.global_inc_mask);
 
-		/* Compute Current Sequence Number word offset */
-		if (_ca_type == 5) {
-			if (_sn_type == SN_32_BIT) {
-				struct egr_tr_32bpn_128bak *target_tr =
-					(struct egr_tr_32bpn_128bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_128");
-				printf("\n              SN type = 32_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
-				printf("\n                  Key = %s", buf);
-				printf("\n                   SN = %08x", target_tr->seq);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
-				printf("\n                  SCI = %s", buf);
+		printf("\t%40s:\t0x%x\n", "Global octet counters that were incremented", dbg_ctrs.cdb4.global_octet_inc);
+		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG1 written?", dbg_ctrs.cdb4.sa_test);
+		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG2 written?", dbg_ctrs.cdb4.vlan_test);
+		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG3 written?", dbg_ctrs.cdb4.global_test);
+		printf("\t%40s:\t0x%x\n", "SA num for which counters were incremented", dbg_ctrs.cdb4.sa_nr);
+		printf("\t%40s:\t0x%x\n", "VLAN UP for which counters were incremented", dbg_ctrs.cdb4.vlan_up);
+		printf("\t%40s:\t0x%x\n", "Raw CDB4", dbg_ctrs.cdb4.raw_cdb4);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_debug_stats: {
+		struct stats_debug_regs dbg_ctrs;
+		memset(&dbg_ctrs, 0, sizeof(struct stats_debug_regs));
 
-				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
-					printf("\n        Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
+		ret = gpy2xx_msec_get_egr_debug_stats(&phy, &dbg_ctrs);
 
-				printf("\n       SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
-				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
-				printf("\n   SA index update en = %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
-			} else if (_sn_type == SN_64_BIT) {
-				struct egr_tr_64bpn_128bak *target_tr =
-					(struct egr_tr_64bpn_128bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_128");
-				printf("\n				SN type = 32_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]));
-				printf("\n					Key = %s", buf);
-				printf("\n			         SN = %08x%08x", target_tr->seq1, target_tr->seq0);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
-				printf("\n                  SCI = %s", buf);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->is0), swap_uint32(target_tr->is1), swap_uint32(target_tr->is2));
-				printf("\n         Context-Salt = %s", buf);
+		if (ret < 0) {
+			printf("\nERROR: Debug counters get failed.\n");
+			return -1;
+		}
 
-				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
-					printf("\n		  Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
+		printf("\nDebug Counters:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "SA counters that were incremented", dbg_ctrs.cdb1.sa_inc_mask);
+		printf("\t%40s:\t0x%x\n", "SA octet counters that were incremented", dbg_ctrs.cdb1.sa_octet_inc);
+		printf("\t%40s:\t0x%x\n", "Raw CDB1", dbg_ctrs.cdb1.raw_cdb1);
 
-				printf("\n		 SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
-				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
-				printf("\n   SA index update en	= %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
-			} else {
-				printf("\nERROR: Invalid SN type.\n");
-			}
-		} else if (_ca_type == 7) {
-			if (_sn_type == SN_32_BIT) {
-				struct egr_tr_32bpn_256bak *target_tr =
-					(struct egr_tr_32bpn_256bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_256");
-				printf("\n				SN type = 32_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
-				printf("\n					Key = %s", buf);
-				printf("\n					 SN = %08x", target_tr->seq);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
-				printf("\n					SCI = %s", buf);
+		printf("\t%40s:\t0x%x\n", "VLAN counters that were incremented", dbg_ctrs.cdb2.vlan_inc_mask);
+		printf("\t%40s:\t0x%x\n", "VLAN octet counters that were incremented", dbg_ctrs.cdb2.vlan_octet_inc);
+		printf("\t%40s:\t0x%x\n", "Raw CDB2", dbg_ctrs.cdb2.raw_cdb2);
 
-				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
-					printf("\n		  Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
+		printf("\t%40s:\t0x%x\n", "Global counters that were incremented", dbg_ctrs.global_inc_mask);
 
-				printf("\n		 SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
-				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
-				printf("\nSA index update en	= %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
-			} else if (_sn_type == SN_64_BIT) {
-				struct egr_tr_64bpn_256bak *target_tr =
-					(struct egr_tr_64bpn_256bak *) raw_tr.raw_trans_rec;
-				printf("\nCrypto-Algorithm type = AES_CTR_128");
-				printf("\n				SN type = 64_BIT");
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x%08x%08x%08x%08x%08x", swap_uint32(target_tr->key[0]), swap_uint32(target_tr->key[1]), swap_uint32(target_tr->key[2]), swap_uint32(target_tr->key[3]), swap_uint32(target_tr->key[4]), swap_uint32(target_tr->key[5]), swap_uint32(target_tr->key[6]), swap_uint32(target_tr->key[7]));
-				printf("\n					Key = %s", buf);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", target_tr->seq1, target_tr->seq0);
-				printf("\n					 SN = %s", buf);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x", swap_uint32(target_tr->iv0), swap_uint32(target_tr->iv1));
-				printf("\n					SCI = %s", buf);
-				snprintf(buf, ARRAY_SIZE(buf), "%08x%08x%08x", swap_uint32(target_tr->is0), swap_uint32(target_tr->is1), swap_uint32(target_tr->is2));
-				printf("\n		   Context-Salt = %s", buf);
+		printf("\t%40s:\t0x%x\n", "Global octet counters that were incremented", dbg_ctrs.cdb4.global_octet_inc);
+		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG1 written?", dbg_ctrs.cdb4.sa_test);
+		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG2 written?", dbg_ctrs.cdb4.vlan_test);
+		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG3 written?", dbg_ctrs.cdb4.global_test);
+		printf("\t%40s:\t0x%x\n", "SA num for which counters were incremented", dbg_ctrs.cdb4.sa_nr);
+		printf("\t%40s:\t0x%x\n", "VLAN UP for which counters were incremented", dbg_ctrs.cdb4.vlan_up);
+		printf("\t%40s:\t0x%x\n", "Raw CDB4", dbg_ctrs.cdb4.raw_cdb4);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_ctrl: {
+		struct count_control cnt_ctrl;
+		memset(&cnt_ctrl, 0, sizeof(struct count_control));
 
-				if (((target_tr->sa_upd_ctrl >> 15) & 1) == 1)
-					printf("\n		  Next SA index = %x", target_tr->sa_upd_ctrl & 0xFF);
+		cli_parse(cmd, argc, argv, &cnt_ctrl);
 
-				printf("\n		 SA expired IRQ = %d", ((target_tr->sa_upd_ctrl >> 14) & 1));
-				printf("\nFlow index of curr SA = %x", (target_tr->sa_upd_ctrl >> 16) & 0xFF);
-				printf("\nSA index update en	= %d", ((target_tr->sa_upd_ctrl >> 31) & 1));
+		ret = gpy2xx_msec_config_ing_count_ctrl(&phy, &cnt_ctrl);
 
-			} else {
-				printf("\nERROR: Invalid SN type.\n");
-			}
-		} else {
-			printf("\nERROR: Invalid Crypto-Algorithm type.\n");
+		if (ret < 0) {
+			printf("\nERROR: Count Control flags set failed.\n");
+			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_pn", strlen("gpy2xx_msec_get_ing_pn")) == 0) {
-		struct sa_current_pn curr_sn;
-		memset(&curr_sn, 0, sizeof(struct sa_current_pn));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_ctrl: {
+		struct count_control cnt_ctrl;
+		memset(&cnt_ctrl, 0, sizeof(struct count_control));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(curr_sn.sa_index), &curr_sn.sa_index);
+		cli_parse(cmd, argc, argv, &cnt_ctrl);
 
-		ret = gpy2xx_msec_get_ing_pn(&phy, &curr_sn);
+		ret = gpy2xx_msec_config_egr_count_ctrl(&phy, &cnt_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress current SN get failed.\n");
+			printf("\nERROR: Count Control flags set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_incen: {
+		struct count_incen cnt_inx;
+		memset(&cnt_inx, 0, sizeof(struct count_incen));
 
-		printf("\nCurrent SN = 0x%llx", curr_sn.curr_pn);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_pn", strlen("gpy2xx_msec_get_egr_pn")) == 0) {
-		struct sa_current_pn curr_sn;
-		memset(&curr_sn, 0, sizeof(struct sa_current_pn));
+		cli_parse(cmd, argc, argv, &cnt_inx);
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(curr_sn.sa_index), &curr_sn.sa_index);
+		ret = gpy2xx_msec_config_ing_count_incen(&phy, &cnt_inx);
 
-		ret = gpy2xx_msec_get_egr_pn(&phy, &curr_sn);
+		if (ret < 0) {
+			printf("\nERROR: Count Incx flags set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_incen: {
+		struct count_incen cnt_inx;
+		memset(&cnt_inx, 0, sizeof(struct count_incen));
+
+		cli_parse(cmd, argc, argv, &cnt_inx);
+
+		ret = gpy2xx_msec_config_egr_count_incen(&phy, &cnt_inx);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress current SN get failed.\n");
+			printf("\nERROR: Count Incx flags set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_secfail: {
+		struct count_secfail cnt_sfail;
+		memset(&cnt_sfail, 0, sizeof(struct count_secfail));
 
-		printf("\nCurrent SN = 0x%llx", curr_sn.curr_pn);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_ing_tr", strlen("gpy2xx_msec_clear_ing_tr")) == 0) {
-		struct transform_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+		cli_parse(cmd, argc, argv, &cnt_sfail);
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		ret = gpy2xx_msec_config_ing_count_secfail(&phy, &cnt_sfail);
 
-		ret = gpy2xx_msec_clear_ing_tr(&phy, &raw_tr);
+		if (ret < 0) {
+			printf("\nERROR: Count secfail event flags set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_secfail: {
+		struct count_secfail cnt_sfail;
+		memset(&cnt_sfail, 0, sizeof(struct count_secfail));
+
+		cli_parse(cmd, argc, argv, &cnt_sfail);
+
+		ret = gpy2xx_msec_config_egr_count_secfail(&phy, &cnt_sfail);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress TR clear failed.\n");
+			printf("\nERROR: Count secfail event flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_tr", strlen("gpy2xx_msec_clear_egr_tr")) == 0) {
-		struct transform_rec raw_tr;
-		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_thresh: {
+		struct frame_octet_thr cnt_thr;
+		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		cli_parse(cmd, argc, argv, &cnt_thr);
 
-		ret = gpy2xx_msec_clear_egr_tr(&phy, &raw_tr);
+		ret = gpy2xx_msec_config_ing_count_thresh(&phy, &cnt_thr);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress TR clear failed.\n");
+			printf("\nERROR: Counters threshold summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sam_eex", strlen("gpy2xx_msec_config_ing_sam_eex")) == 0) {
-		struct raw_sam_ee raw_ee;
-		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_thresh: {
+		struct frame_octet_thr cnt_thr;
+		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "eex_type", sizeof(raw_ee.eex_type), &raw_ee.eex_type);
-		cnt += scanParamArg(argc, argv, "eex_word0", sizeof(raw_ee.raw_sam_ee[0]), &raw_ee.raw_sam_ee[0]);
+		cli_parse(cmd, argc, argv, &cnt_thr);
 
-		ret = gpy2xx_msec_config_ing_sam_eex(&phy, &raw_ee);
+		ret = gpy2xx_msec_config_egr_count_thresh(&phy, &cnt_thr);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM EE type set failed.\n");
+			printf("\nERROR: Counters threshold summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sam_eex", strlen("gpy2xx_msec_config_egr_sam_eex")) == 0) {
-		struct raw_sam_ee raw_ee;
-		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_count_thresh: {
+		struct frame_octet_thr cnt_thr;
+		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "eex_type", sizeof(raw_ee.eex_type), &raw_ee.eex_type);
-		cnt += scanParamArg(argc, argv, "eex_word0", sizeof(raw_ee.raw_sam_ee[0]), &raw_ee.raw_sam_ee[0]);
+		ret = gpy2xx_msec_get_ing_count_thresh(&phy, &cnt_thr);
 
-		ret = gpy2xx_msec_config_egr_sam_eex(&phy, &raw_ee);
+		if (ret < 0) {
+			printf("\nERROR: Counters threshold summary get failed.\n");
+			return -1;
+		}
+
+		printf("\nFrame threshold summary = %llx", cnt_thr.frame_threshold);
+		printf("\nOctet threshold summary = %llx", cnt_thr.octet_threshold);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_count_thresh: {
+		struct frame_octet_thr cnt_thr;
+		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
+
+		ret = gpy2xx_msec_get_egr_count_thresh(&phy, &cnt_thr);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM EE type set failed.\n");
+			printf("\nERROR: Counters threshold summary get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_sam_eef", strlen("gpy2xx_msec_get_ing_sam_eef")) == 0) {
-		int i;
-		struct raw_sam_ee raw_ee;
-		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+		printf("\nFrame threshold summary = %llx", cnt_thr.frame_threshold);
+		printf("\nOctet threshold summary = %llx", cnt_thr.octet_threshold);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_harvest_stats: {
+		static struct msec_harvest hv;
+		struct cli_harvest_args a;
+		u32 i, j;
+		int fd = -1;
+
+		memset(&hv, 0, sizeof(struct msec_harvest));
+		memset(&a, 0, sizeof(struct cli_harvest_args));
+
+		cli_parse(cmd, argc, argv, &a);
+		hv.ing_thr = a.thr;
+		hv.egr_thr = a.thr;
+
+		if (a.gpio != NULL) {
+			fd = open(a.gpio, O_RDONLY);
 
-		ret = gpy2xx_msec_get_ing_sam_eef(&phy, &raw_ee);
+			if (fd < 0) {
+				printf("\nERROR: Open %s failed.\n", a.gpio);
+				return -1;
+			}
+		}
+
+		ret = gpy2xx_msec_harvest_start(&phy, &hv);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM EE flags get failed.\n");
-			return -1;
+			printf("\nERROR: Statistics harvester start failed.\n");
+			goto HARVEST_END;
 		}
 
-		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nSAM EE flags[%02d] = %8x", i, raw_ee.raw_sam_ee[i]);
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_sam_eef", strlen("gpy2xx_msec_get_egr_sam_eef")) == 0) {
-		int i;
-		struct raw_sam_ee raw_ee;
-		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
+		for (i = 0; i < a.events;) {
+			if (fd >= 0) {
+				ret = gpy2xx_msec_harvest_wait(fd, a.timeout);
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+				if (ret < 0) {
+					printf("\nERROR: GPIO event wait failed.\n");
+					break;
+				}
+			} else {
+				usleep(a.timeout * 1000);
+			}
 
-		ret = gpy2xx_msec_get_egr_sam_eef(&phy, &raw_ee);
+			ret = gpy2xx_msec_harvest_event(&phy, &hv);
 
-		if (ret < 0) {
-			printf("\nERROR: Egress SAM EE flags get failed.\n");
-			return -1;
-		}
+			if (ret < 0) {
+				printf("\nERROR: Statistics harvest failed.\n");
+				break;
+			}
 
-		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nSAM EE flags[%02d] = %8x", i, raw_ee.raw_sam_ee[i]);
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sam_eec", strlen("gpy2xx_msec_config_ing_sam_eec")) == 0) {
-		struct sam_ee_ctrl ee_ctrl;
-		memset(&ee_ctrl, 0, sizeof(struct sam_ee_ctrl));
+			if (!(hv.extin.ext_istat & EXTIN_IM2_IE_MACSEC))
+				continue;
 
-		cnt += scanParamArg(argc, argv, "sam_ind_set", sizeof(ee_ctrl.sam_index_set), &ee_ctrl.sam_index_set);
-		cnt += scanParamArg(argc, argv, "set_single", sizeof(ee_ctrl.set_enable), &ee_ctrl.set_enable);
-		cnt += scanParamArg(argc, argv, "set_all", sizeof(ee_ctrl.set_all), &ee_ctrl.set_all);
-		cnt += scanParamArg(argc, argv, "sam_ind_clr", sizeof(ee_ctrl.sam_index_clear), &ee_ctrl.sam_index_clear);
-		cnt += scanParamArg(argc, argv, "clr_single", sizeof(ee_ctrl.clear_enable), &ee_ctrl.clear_enable);
-		cnt += scanParamArg(argc, argv, "clr_all", sizeof(ee_ctrl.clear_all), &ee_ctrl.clear_all);
+			printf("\nEvent %u: %d counter blocks harvested\n", ++i, ret);
 
-		ret = gpy2xx_msec_config_ing_sam_eec(&phy, &ee_ctrl);
+			for (j = 0; j < MACSEC_MAX_SA_RULES; j++) {
+				if (hv.ing_sa_upd[j / 32] & (1u << (j % 32)))
+					printf("\t%40s:\t%u\n", "Ingress SA", j);
 
-		if (ret < 0) {
-			printf("\nERROR: Ingress SAM EE control set failed.\n");
-			return -1;
+				if (hv.egr_sa_upd[j / 32] & (1u << (j % 32)))
+					printf("\t%40s:\t%u\n", "Egress SA", j);
+			}
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sam_eec", strlen("gpy2xx_msec_config_egr_sam_eec")) == 0) {
-		struct sam_ee_ctrl ee_ctrl;
-		memset(&ee_ctrl, 0, sizeof(struct sam_ee_ctrl));
 
-		cnt += scanParamArg(argc, argv, "sam_ind_set", sizeof(ee_ctrl.sam_index_set), &ee_ctrl.sam_index_set);
-		cnt += scanParamArg(argc, argv, "set_single", sizeof(ee_ctrl.set_enable), &ee_ctrl.set_enable);
-		cnt += scanParamArg(argc, argv, "set_all", sizeof(ee_ctrl.set_all), &ee_ctrl.set_all);
-		cnt += scanParamArg(argc, argv, "sam_ind_clr", sizeof(ee_ctrl.sam_index_clear), &ee_ctrl.sam_index_clear);
-		cnt += scanParamArg(argc, argv, "clr_single", sizeof(ee_ctrl.clear_enable), &ee_ctrl.clear_enable);
-		cnt += scanParamArg(argc, argv, "clr_all", sizeof(ee_ctrl.clear_all), &ee_ctrl.clear_all);
+		if (ret >= 0)
+			ret = gpy2xx_msec_harvest_sync(&phy, &hv);
 
-		ret = gpy2xx_msec_config_egr_sam_eec(&phy, &ee_ctrl);
+		gpy2xx_msec_harvest_stop(&phy, &hv);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM EE control set failed.\n");
-			return -1;
+			printf("\nERROR: Statistics harvest failed.\n");
+			goto HARVEST_END;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sam_fca", strlen("gpy2xx_msec_config_ing_sam_fca")) == 0) {
-		struct sa_match_fca sam_fca;
-		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(sam_fca.flow_type), &sam_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(sam_fca.dest_port), &sam_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(sam_fca.drop_non_reserved), &sam_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "crypt_auth", sizeof(sam_fca.flow_crypt_auth), &sam_fca.flow_crypt_auth);
-		cnt += scanParamArg(argc, argv, "drop_act", sizeof(sam_fca.drop_action), &sam_fca.drop_action);
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(sam_fca.sa_index), &sam_fca.sa_index);
-		cnt += scanParamArg(argc, argv, "rep_protect", sizeof(sam_fca.replay_protect), &sam_fca.replay_protect);
-		cnt += scanParamArg(argc, argv, "sa_inuse", sizeof(sam_fca.sa_in_use), &sam_fca.sa_in_use);
-		cnt += scanParamArg(argc, argv, "validate_level", sizeof(sam_fca.validate_frames), &sam_fca.validate_frames);
-		cnt += scanParamArg(argc, argv, "ivl_mode", sizeof(sam_fca.iv), &sam_fca.iv);
-		cnt += scanParamArg(argc, argv, "verify_icv", sizeof(sam_fca.icv_verify), &sam_fca.icv_verify);
-		cnt += scanParamArg(argc, argv, "ca_bp_len", sizeof(sam_fca.crypt_auth_bypass_len), &sam_fca.crypt_auth_bypass_len);
+		printf("\nHarvested Counters (%u events, %u block reads):\n----------------\n",
+		       hv.events, hv.blk_reads);
 
-		ret = gpy2xx_msec_config_ing_sam_fca(&phy, &sam_fca);
+		for (j = 0; j < phy.nr_of_sas && j < MACSEC_MAX_SA_RULES; j++) {
+			if (hv.ing_sa[j].InPktsOK == 0 && hv.egr_sa[j].OutPktsEncrypted == 0)
+				continue;
 
-		if (ret < 0) {
-			printf("\nERROR: Ingress SAM flow control action set failed.\n");
-			return -1;
+			printf("\tSA %2u: %20s 0x%llx %20s 0x%llx\n", j,
+			       "InPktsOK", hv.ing_sa[j].InPktsOK,
+			       "OutPktsEncrypted", hv.egr_sa[j].OutPktsEncrypted);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sam_fca", strlen("gpy2xx_msec_config_egr_sam_fca")) == 0) {
-		struct sa_match_fca sam_fca;
-		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(sam_fca.flow_type), &sam_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(sam_fca.dest_port), &sam_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "crypt_auth", sizeof(sam_fca.flow_crypt_auth), &sam_fca.flow_crypt_auth);
-		cnt += scanParamArg(argc, argv, "drop_act", sizeof(sam_fca.drop_action), &sam_fca.drop_action);
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(sam_fca.sa_index), &sam_fca.sa_index);
-		cnt += scanParamArg(argc, argv, "frame_protect", sizeof(sam_fca.protect_frame), &sam_fca.protect_frame);
-		cnt += scanParamArg(argc, argv, "sa_inuse", sizeof(sam_fca.sa_in_use), &sam_fca.sa_in_use);
-		cnt += scanParamArg(argc, argv, "include_sci", sizeof(sam_fca.include_sci), &sam_fca.include_sci);
-		cnt += scanParamArg(argc, argv, "use_es", sizeof(sam_fca.use_es), &sam_fca.use_es);
-		cnt += scanParamArg(argc, argv, "use_scb", sizeof(sam_fca.use_scb), &sam_fca.use_scb);
-		cnt += scanParamArg(argc, argv, "tag_bpsize", sizeof(sam_fca.tag_bypass_size), &sam_fca.tag_bypass_size);
-		cnt += scanParamArg(argc, argv, "sa_indup", sizeof(sam_fca.sa_index_update), &sam_fca.sa_index_update);
-		cnt += scanParamArg(argc, argv, "conf_offset", sizeof(sam_fca.conf_offset), &sam_fca.conf_offset);
-		cnt += scanParamArg(argc, argv, "conf_protect", sizeof(sam_fca.conf_protect), &sam_fca.conf_protect);
-		cnt += scanParamArg(argc, argv, "ivl_mode", sizeof(sam_fca.iv), &sam_fca.iv);
-		cnt += scanParamArg(argc, argv, "append_icv", sizeof(sam_fca.icv_append), &sam_fca.icv_append);
-		cnt += scanParamArg(argc, argv, "ca_bp_len", sizeof(sam_fca.crypt_auth_bypass_len), &sam_fca.crypt_auth_bypass_len);
+		printf("\t%40s:\t0x%llx\n", "InPktsTagged", hv.ing_glb.InPktsTagged);
+		printf("\t%40s:\t0x%llx\n", "InPktsUntagged", hv.ing_glb.InPktsUntagged);
+		printf("\t%40s:\t0x%llx\n", "OutPktsUntagged", hv.egr_glb.OutPktsUntagged);
 
-		ret = gpy2xx_msec_config_egr_sam_fca(&phy, &sam_fca);
+HARVEST_END:
 
-		if (ret < 0) {
-			printf("\nERROR: Egress SAM flow control action set failed.\n");
+		if (fd >= 0)
+			close(fd);
+
+		if (ret < 0)
 			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_sam_fca", strlen("gpy2xx_msec_get_ing_sam_fca")) == 0) {
-		struct sam_pkt_fca sam_fca;
-		memset(&sam_fca, 0, sizeof(struct sam_pkt_fca));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_misc_ctrl: {
+		struct misc_control mics_ctrl;
+		memset(&mics_ctrl, 0, sizeof(struct misc_control));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &mics_ctrl);
 
-		ret = gpy2xx_msec_get_ing_sam_fca(&phy, &sam_fca);
+		ret = gpy2xx_msec_config_ing_misc_ctrl(&phy, &mics_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM flow control action get failed.\n");
+			printf("\nERROR: Misc ctrl param set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_misc_ctrl: {
+		struct misc_control mics_ctrl;
+		memset(&mics_ctrl, 0, sizeof(struct misc_control));
 
-		printf("\nIngress FCA raw %x", sam_fca.dec_enc.raw_fca_macsec);
-
-		if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_BYPASS) {
-			if (sam_fca.dec_enc.flow_crypt_auth == 1) {
-				printf("\nIngress FCA - Crypto_Auth");
-				printf("\nIV mode %x", sam_fca.crypt_auth.iv);
-				printf("\nRetrieve and verify the ICV %x", sam_fca.crypt_auth.icv_verify);
-				printf("\nAAD length %x", sam_fca.crypt_auth.conf_offset);
-			} else {
-				printf("\nIngress FCA - Bypass");
-				printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
-			}
-		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_DROP) {
-			printf("\nIngress FCA - Drop");
-			printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
-		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_INGRESS) {
-			printf("\nIngress FCA - Decryption");
-			printf("\nReplay protection %x, SA in-use %x, Validation level %x, SA ind update %x, Conf offset %x, Conf protection %x",
-			       sam_fca.dec_enc.rep_prot_fr, sam_fca.dec_enc.sa_in_use, sam_fca.dec_enc.vlevel_es_scb, sam_fca.dec_enc.sa_index_update, sam_fca.dec_enc.conf_offset, sam_fca.dec_enc.conf_protect);
-		} else {
-			printf("\nIngress FCA - Invalid");
-		}
-
-		printf("\nDst port %x, Drop NR %x, Drop act %x, SA ind %x",
-		       sam_fca.dec_enc.dest_port, sam_fca.dec_enc.drop_non_reserved, sam_fca.dec_enc.drop_action, sam_fca.dec_enc.sa_index);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_sam_fca", strlen("gpy2xx_msec_get_egr_sam_fca")) == 0) {
-		struct sam_pkt_fca sam_fca;
-		memset(&sam_fca, 0, sizeof(struct sam_pkt_fca));
-
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &mics_ctrl);
 
-		ret = gpy2xx_msec_get_egr_sam_fca(&phy, &sam_fca);
+		ret = gpy2xx_msec_config_egr_misc_ctrl(&phy, &mics_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM flow control action get failed.\n");
+			printf("\nERROR: Misc ctrl param set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sa_nm_ctrl: {
+		struct cli_sa_nm_ctrl_args a;
+		struct sa_nm_params nm_ctrl;
+		memset(&a, 0, sizeof(struct cli_sa_nm_ctrl_args));
+		memset(&nm_ctrl, 0, sizeof(struct sa_nm_params));
 
-		printf("\nEgress FCA raw %x", sam_fca.dec_enc.raw_fca_macsec);
+		cli_parse(cmd, argc, argv, &a);
+		nm_ctrl.comp_etype = a.comp_etype;
+		nm_ctrl.check_v = a.check_ver;
+		nm_ctrl.check_kay = a.check_kay;
+		nm_ctrl.check_c_e = a.check_ce;
+		nm_ctrl.check_sc = a.check_sc;
+		nm_ctrl.check_sl = a.check_sl;
+		nm_ctrl.check_pn = a.check_pn;
+		nm_ctrl.msec_tag_value = a.msec_eth;
+		//printf("Utility raw %x\n", nm_ctrl.raw_sanm_ctrl);
 
-		if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_BYPASS) {
-			if (sam_fca.dec_enc.flow_crypt_auth == 1) {
-				printf("\nEgress FCA - Crypto_Auth");
-				printf("\nIV mode %x", sam_fca.crypt_auth.iv);
-				printf("\nAppend the calculated ICV %x", sam_fca.crypt_auth.icv_append);
-				printf("\nAAD length %x", sam_fca.crypt_auth.conf_offset);
-				printf("\nConf protection %x", sam_fca.crypt_auth.conf_protect);
-			} else {
-				printf("\nEgress FCA - Bypass");
-				printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
-			}
-		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_DROP) {
-			printf("\nEgress FCA - Drop");
-			printf("\nSA in-use %x", sam_fca.bypass_drop.sa_in_use);
-		} else if (sam_fca.dec_enc.flow_type == SAM_FCA_FLOW_EGRESS) {
-			printf("\nEgress FCA - Encryption");
-			printf("\nFrame protection %x, SA in-use %x, Expl SCI %x, ES %x, SCB %x, Tag bp size %x, SA ind update %x, Conf offset %x, Conf protection %x",
-			       sam_fca.dec_enc.rep_prot_fr, sam_fca.dec_enc.sa_in_use, sam_fca.dec_enc.include_sci, sam_fca.dec_enc.vlevel_es_scb & 1, (sam_fca.dec_enc.vlevel_es_scb >> 1) & 1, sam_fca.dec_enc.tag_bypass_size, sam_fca.dec_enc.sa_index_update, sam_fca.dec_enc.conf_offset, sam_fca.dec_enc.conf_protect);
-		} else {
-			printf("\nEgress FCA - Invalid");
-		}
+		ret = gpy2xx_msec_config_ing_sa_nm_ctrl(&phy, &nm_ctrl);
 
-		printf("\nDst port %x, Drop act %x, SA ind %x",
-		       sam_fca.dec_enc.dest_port, sam_fca.dec_enc.drop_action, sam_fca.dec_enc.sa_index);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_ing_sam_fca", strlen("gpy2xx_msec_clear_ing_sam_fca")) == 0) {
-		struct sa_match_fca sam_fca;
-		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
+		if (ret < 0) {
+			printf("\nERROR: SA Non-Match ctrl param set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sa_nm_ctrl: {
+		struct cli_sa_nm_ctrl_args a;
+		struct sa_nm_params nm_ctrl;
+		memset(&a, 0, sizeof(struct cli_sa_nm_ctrl_args));
+		memset(&nm_ctrl, 0, sizeof(struct sa_nm_params));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &a);
+		nm_ctrl.comp_etype = a.comp_etype;
+		nm_ctrl.check_v = a.check_ver;
+		nm_ctrl.check_kay = a.check_kay;
+		nm_ctrl.check_c_e = a.check_ce;
+		nm_ctrl.check_sc = a.check_sc;
+		nm_ctrl.check_sl = a.check_sl;
+		nm_ctrl.check_pn = a.check_pn;
+		nm_ctrl.msec_tag_value = a.msec_eth;
+		//printf("Utility raw %x\n", nm_ctrl.raw_sanm_ctrl);
 
-		ret = gpy2xx_msec_clear_ing_sam_fca(&phy, &sam_fca);
+		ret = gpy2xx_msec_config_egr_sa_nm_ctrl(&phy, &nm_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM flow control clear failed.\n");
+			printf("\nERROR: SA Non-Match ctrl param set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_sam_fca", strlen("gpy2xx_msec_clear_egr_sam_fca")) == 0) {
-		struct sa_match_fca sam_fca;
-		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sa_nm_ncp: {
+		struct sa_nonmatch_fca nm_fca;
+		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &nm_fca);
 
-		ret = gpy2xx_msec_clear_egr_sam_fca(&phy, &sam_fca);
+		ret = gpy2xx_msec_config_ing_sa_nm_ncp(&phy, &nm_fca);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM flow control clear failed.\n");
+			printf("\nERROR: SA Non-Match NCP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sam_rule", strlen("gpy2xx_msec_config_ing_sam_rule")) == 0) {
-		u8 in_data;
-		struct sa_match_param match_par;
-		memset(&match_par, 0, sizeof(struct sa_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sa_nm_ncp: {
+		struct sa_nonmatch_fca nm_fca;
+		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
-		cnt += scanMAC_Arg(argc, argv, "sa_mac", match_par.sa_mac);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", match_par.da_mac);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(match_par.eth_type), &match_par.eth_type);
-		cnt += scanParamArg(argc, argv, "vlan_id", sizeof(match_par.vlan_id), &match_par.vlan_id);
-		cnt += scanParamArg(argc, argv, "misc", sizeof(match_par.misc_par.misc), &match_par.misc_par.misc);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(match_par.sci), (char *)match_par.sci);
-		cnt += scanParamArg(argc, argv, "mask", sizeof(match_par.mask_par.mask), &match_par.mask_par.mask);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(in_data), &in_data);
-		match_par.extn_par.flow_index = in_data;
+		cli_parse(cmd, argc, argv, &nm_fca);
 
-		ret = gpy2xx_msec_config_ing_sam_rule(&phy, &match_par);
+		ret = gpy2xx_msec_config_egr_sa_nm_ncp(&phy, &nm_fca);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM set failed.\n");
+			printf("\nERROR: SA Non-Match NCP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sam_rule", strlen("gpy2xx_msec_config_egr_sam_rule")) == 0) {
-		u8 in_data;
-		struct sa_match_param match_par;
-		memset(&match_par, 0, sizeof(struct sa_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sa_nm_cp: {
+		struct sa_nonmatch_fca nm_fca;
+		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
-		cnt += scanMAC_Arg(argc, argv, "sa_mac", match_par.sa_mac);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", match_par.da_mac);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(match_par.eth_type), &match_par.eth_type);
-		cnt += scanParamArg(argc, argv, "vlan_id", sizeof(match_par.vlan_id), &match_par.vlan_id);
-		cnt += scanParamArg(argc, argv, "misc", sizeof(match_par.misc_par.misc), &match_par.misc_par.misc);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(match_par.sci), (char *)match_par.sci);
-		cnt += scanParamArg(argc, argv, "mask", sizeof(match_par.mask_par.mask), &match_par.mask_par.mask);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(in_data), &in_data);
-		match_par.extn_par.flow_index = in_data;
+		cli_parse(cmd, argc, argv, &nm_fca);
 
-		ret = gpy2xx_msec_config_egr_sam_rule(&phy, &match_par);
+		ret = gpy2xx_msec_config_ing_sa_nm_cp(&phy, &nm_fca);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM set failed.\n");
+			printf("\nERROR: SA Non-Match CP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_ing_sam_rule", strlen("gpy2xx_msec_clear_ing_sam_rule")) == 0) {
-		struct sa_match_param match_par;
-		memset(&match_par, 0, sizeof(struct sa_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sa_nm_cp: {
+		struct sa_nonmatch_fca nm_fca;
+		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
+		cli_parse(cmd, argc, argv, &nm_fca);
 
-		ret = gpy2xx_msec_clear_ing_sam_rule(&phy, &match_par);
+		ret = gpy2xx_msec_config_egr_sa_nm_cp(&phy, &nm_fca);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM clear failed.\n");
+			printf("\nERROR: SA Non-Match CP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_sam_rule", strlen("gpy2xx_msec_clear_egr_sam_rule")) == 0) {
-		struct sa_match_param match_par;
-		memset(&match_par, 0, sizeof(struct sa_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_stats_summ: {
+		struct stats_summary xxx_summ;
+		memset(&xxx_summ, 0, sizeof(struct stats_summary));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
-		ret = gpy2xx_msec_clear_egr_sam_rule(&phy, &match_par);
+		ret = gpy2xx_msec_clear_ing_stats_summ(&phy, &xxx_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM clear failed.\n");
+			printf("\nERROR: SA stats summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_vlan_parse", strlen("gpy2xx_msec_config_ing_vlan_parse")) == 0) {
-		u8 in_data;
-		struct sam_vlan_parse match_par;
-		memset(&match_par, 0, sizeof(struct sam_vlan_parse));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_stats_summ: {
+		struct stats_summary xxx_summ;
+		memset(&xxx_summ, 0, sizeof(struct stats_summary));
 
-		cnt += scanParamArg(argc, argv, "qinq_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qinq = in_data;
-		cnt += scanParamArg(argc, argv, "stag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_stag = in_data;
-		cnt += scanParamArg(argc, argv, "qtag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qtag = in_data;
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
-		ret = gpy2xx_msec_config_ing_vlan_parse(&phy, &match_par);
+		ret = gpy2xx_msec_clear_egr_stats_summ(&phy, &xxx_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM VLAN control set failed.\n");
+			printf("\nERROR: SA stats summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_vlan_parse", strlen("gpy2xx_msec_config_egr_vlan_parse")) == 0) {
-		u8 in_data;
-		struct sam_vlan_parse match_par;
-		memset(&match_par, 0, sizeof(struct sam_vlan_parse));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_psa_stats_summ: {
+		struct psa_summary psa_summ;
+		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "qinq_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qinq = in_data;
-		cnt += scanParamArg(argc, argv, "stag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_stag = in_data;
-		cnt += scanParamArg(argc, argv, "qtag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qtag = in_data;
+		cli_parse(cmd, argc, argv, &psa_summ);
 
-		ret = gpy2xx_msec_config_egr_vlan_parse(&phy, &match_par);
+		ret = gpy2xx_msec_clear_ing_psa_stats_summ(&phy, &psa_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Egress SAM VLAN control set failed.\n");
+			printf("\nERROR: Per-SA stats summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_sam_rule", strlen("gpy2xx_msec_get_ing_sam_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_psa_stats_summ: {
 		int i;
-		struct raw_sam_param raw_sam;
-		memset(&raw_sam, 0, sizeof(struct raw_sam_param));
+		struct psa_summary psa_summ;
+		struct ing_psa_bmap counter_bmap;
+		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(raw_sam.rule_index), &raw_sam.rule_index);
+		cli_parse(cmd, argc, argv, &psa_summ);
 
-		ret = gpy2xx_msec_get_ing_sam_rule(&phy, &raw_sam);
+		ret = gpy2xx_msec_get_ing_psa_stats_summ(&phy, &psa_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress SAM get failed.\n");
+			printf("\nERROR: Per-SA stats summary get failed.\n");
 			return -1;
 		}
 
-		for (i = 0; i < IE_MAX_SAM_SIZE_WORDS; i++) {
-			printf("\nSAMParam[%02d] = %8x", i, raw_sam.raw_sam_param[i]);
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_sam_rule", strlen("gpy2xx_msec_get_egr_sam_rule")) == 0) {
-		int i;
-		struct raw_sam_param raw_sam;
-		memset(&raw_sam, 0, sizeof(struct raw_sam_param));
+		printf("\nPer-SA per counter ingress statistics summary flags:\n----------------\n");
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(raw_sam.rule_index), &raw_sam.rule_index);
+		for (i = 0; i < MACSEC_MAX_SA_RULES; i++) {
+			printf("\nPer-SA per counter stats summary[%02d] = %8x", i, psa_summ.count_summ_psa[i]);
+			counter_bmap.raw_psa_bmap = psa_summ.count_summ_psa[i];
 
-		ret = gpy2xx_msec_get_egr_sam_rule(&phy, &raw_sam);
+			if (counter_bmap.InOctetsDecryptedValidated)
+				printf("\nInOctetsDecrypted / InOctetsValidated counter expired");
 
-		if (ret < 0) {
-			printf("\nERROR: Egress SAM get failed.\n");
-			return -1;
-		}
+			if (counter_bmap.InPktsUncheckedHitDropReserved)
+				printf("\nInPktsUnchecked / InPktsHitDropReserved counter expired");
+
+			if (counter_bmap.InPktsDelayed)
+				printf("\nInPktsDelayed counter expired");
+
+			if (counter_bmap.InPktsLate)
+				printf("\nInPktsLate counter expired");
+
+			if (counter_bmap.InPktsOK)
+				printf("\nInPktsOK counter expired");
+
+			if (counter_bmap.InPktsInvalid)
+				printf("\nInPktsInvalid counter expired");
+
+			if (counter_bmap.InPktsNotValid)
+				printf("\nInPktsNotValid counter expired");
+
+			if (counter_bmap.InPktsNotUsingSA)
+				printf("\nInPktsNotUsingSA counter expired");
+
+			if (counter_bmap.InPktsUnusedSA)
+				printf("\nInPktsUnusedSA counter expired");
+
+			if (counter_bmap.InPktsUntaggedHit)
+				printf("\nInPktsUntaggedHit counter expired");
 
-		for (i = 0; i < IE_MAX_SAM_SIZE_WORDS; i++) {
-			printf("\nSAMParam[%02d] = %8x", i, raw_sam.raw_sam_param[i]);
+			if (psa_summ.psa_type == PSA_SUMM_GET_GIVEN)
+				break;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_cc_rule", strlen("gpy2xx_msec_config_ing_cc_rule")) == 0) {
-		u32 data;
-		struct icc_match_param cc_match;
-		memset(&cc_match, 0, sizeof(struct icc_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_psa_stats_summ: {
+		struct psa_summary psa_summ;
+		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "icc_index", sizeof(cc_match.icc_index), &cc_match.icc_index);
-		//cnt += scanParamArg(argc, argv, "ovlan_id", sizeof(data), &data);
-		//cc_match.vlan_eth.vlan_id = data;
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(data), &data);
-		cc_match.vlan_eth.payload_e_type = data;
-		cnt += scanParamArg(argc, argv, "misc", sizeof(data), &data);
-		cc_match.icc_misc.raw_iccm_misc = data;
-		//cnt += scanParamArg(argc, argv, "ivlan_id", sizeof(data), &data);
-		//cc_match.icc_ivl.vlan_id_inner = data;
-		//cnt += scanParamArg(argc, argv, "ivlan_up", sizeof(data), &data);
-		//cc_match.icc_ivl.vlan_up_inner = data;
+		cli_parse(cmd, argc, argv, &psa_summ);
 
-		ret = gpy2xx_msec_config_ing_cc_rule(&phy, &cc_match);
+		ret = gpy2xx_msec_clear_egr_psa_stats_summ(&phy, &psa_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress CC rule set failed.\n");
+			printf("\nERROR: Per-SA stats summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_cc_rule", strlen("gpy2xx_msec_get_ing_cc_rule")) == 0) {
-		struct icc_match_param cc_match;
-		memset(&cc_match, 0, sizeof(struct icc_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_psa_stats_summ: {
+		int i;
+		struct psa_summary psa_summ;
+		struct egr_psa_bmap counter_bmap;
+		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "icc_index", sizeof(cc_match.icc_index), &cc_match.icc_index);
+		cli_parse(cmd, argc, argv, &psa_summ);
 
-		ret = gpy2xx_msec_get_ing_cc_rule(&phy, &cc_match);
+		ret = gpy2xx_msec_get_egr_psa_stats_summ(&phy, &psa_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress CC rule get failed.\n");
+			printf("\nERROR: Per-SA stats summary get failed.\n");
 			return -1;
 		}
 
-		printf("\nIngress CC match parameters:\n----------------\n");
-		printf("\nICCParam[00] = %8x", cc_match.vlan_eth.raw_iccm_vleth);
-		printf("\nICCParam[01] = %8x", cc_match.icc_misc.raw_iccm_misc);
-		//printf("\nICCParam[02] = %8x", cc_match.icc_ivl.raw_iccm_ivl);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_cc_eef", strlen("gpy2xx_msec_config_ing_cc_eef")) == 0) {
-		struct raw_icc_ee raw_cc;
-		memset(&raw_cc, 0, sizeof(struct raw_icc_ee));
+		printf("\nPer-SA per counter egress statistics summary flags:\n----------------\n");
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "eec_word0", sizeof(raw_cc.raw_icc_ee[0]), &raw_cc.raw_icc_ee[0]);
+		for (i = 0; i < MACSEC_MAX_SA_RULES; i++) {
+			printf("\nPer-SA per counter stats summary[%02d] = %8x", i, psa_summ.count_summ_psa[i]);
+			counter_bmap.raw_psa_bmap = psa_summ.count_summ_psa[i];
 
-		ret = gpy2xx_msec_config_ing_cc_eef(&phy, &raw_cc);
+			if (counter_bmap.OutOctetsEncryptedProtected)
+				printf("\nOutOctetsEncrypted / OutOctetsProtected counter expired");
 
-		if (ret < 0) {
-			printf("\nERROR: ICC EE flags set failed.\n");
-			return -1;
+			if (counter_bmap.OutPktsEncryptedProtectedHitDropReserved)
+				printf("\nOutPktsEncrypted / OutPktsProtected / OutPktsHitDropReserved counter expired");
+
+			if (counter_bmap.OutPktsTooLong)
+				printf("\nOutPktsTooLong counter expired");
+
+			if (psa_summ.psa_type == PSA_SUMM_GET_GIVEN)
+				break;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_cc_eef", strlen("gpy2xx_msec_get_ing_cc_eef")) == 0) {
-		int i;
-		struct raw_icc_ee raw_cc;
-		memset(&raw_cc, 0, sizeof(struct raw_icc_ee));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cp_rule: {
+		struct cp_class_param cpc_rule;
+		memset(&cpc_rule, 0, sizeof(struct cp_class_param));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+		cli_parse(cmd, argc, argv, &cpc_rule);
 
-		ret = gpy2xx_msec_get_ing_cc_eef(&phy, &raw_cc);
+		ret = gpy2xx_msec_config_ing_cp_rule(&phy, &cpc_rule);
 
 		if (ret < 0) {
-			printf("\nERROR: ICC EE flags get failed.\n");
+			printf("\nERROR: CPC rule set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_cp_rule: {
+		struct cp_class_param cpc_rule;
+		memset(&cpc_rule, 0, sizeof(struct cp_class_param));
 
-		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nICC EE flags[%02d] = %8x", i, raw_cc.raw_icc_ee[i]);
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_cc_eec", strlen("gpy2xx_msec_config_ing_cc_eec")) == 0) {
-		u32 data;
-		struct icc_ee_ctrl ee_ctrl;
-		memset(&ee_ctrl, 0, sizeof(struct icc_ee_ctrl));
-
-		cnt += scanParamArg(argc, argv, "icc_ind_set", sizeof(data), &data);
-		ee_ctrl.cc_index_set = data;
-		cnt += scanParamArg(argc, argv, "set_single", sizeof(data), &data);
-		ee_ctrl.set_enable = data;
-		cnt += scanParamArg(argc, argv, "set_all", sizeof(data), &data);
-		ee_ctrl.set_all = data;
-		cnt += scanParamArg(argc, argv, "icc_ind_clr", sizeof(data), &data);
-		ee_ctrl.cc_index_clear = data;
-		cnt += scanParamArg(argc, argv, "clr_single", sizeof(data), &data);
-		ee_ctrl.clear_enable = data;
-		cnt += scanParamArg(argc, argv, "clr_all", sizeof(data), &data);
-		ee_ctrl.clear_all = data;
+		cli_parse(cmd, argc, argv, &cpc_rule);
 
-		ret = gpy2xx_msec_config_ing_cc_eec(&phy, &ee_ctrl);
+		ret = gpy2xx_msec_config_egr_cp_rule(&phy, &cpc_rule);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress CC EE control set failed.\n");
+			printf("\nERROR: CPC rule set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_cc_ctrl", strlen("gpy2xx_msec_config_ing_cc_ctrl")) == 0) {
-		struct ing_cc_ctrl cc_ctrl;
-		memset(&cc_ctrl, 0, sizeof(struct ing_cc_ctrl));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_sa_pn_thr_summ: {
+		struct sa_pn_thr_summ xxx_summ;
+		memset(&xxx_summ, 0, sizeof(struct sa_pn_thr_summ));
 
-		cnt += scanParamArg(argc, argv, "nm_act", sizeof(cc_ctrl.nm_act), &cc_ctrl.nm_act);
-		cnt += scanParamArg(argc, argv, "nm_ctrl_act", sizeof(cc_ctrl.nm_ctrl_act), &cc_ctrl.nm_ctrl_act);
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
-		ret = gpy2xx_msec_config_ing_cc_ctrl(&phy, &cc_ctrl);
+		ret = gpy2xx_msec_clear_sa_pn_thr_summ(&phy, &xxx_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress CC Control flags set failed.\n");
+			printf("\nERROR: SA PN Threshold summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_stats_summ", strlen("gpy2xx_msec_get_ing_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_sa_pn_thr_summ: {
 		int i;
-		struct stats_summary xxx_summ;
-		struct ing_global_bmap counter_bmap;
-		memset(&xxx_summ, 0, sizeof(struct stats_summary));
+		struct sa_pn_thr_summ xxx_summ;
+		memset(&xxx_summ, 0, sizeof(struct sa_pn_thr_summ));
 
-		ret = gpy2xx_msec_get_ing_stats_summ(&phy, &xxx_summ);
+		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+		ret = gpy2xx_msec_get_sa_pn_thr_summ(&phy, &xxx_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress stats summary get failed.\n");
+			printf("\nERROR: SA PN Threshold summary get failed.\n");
 			return -1;
 		}
 
-		printf("\nStatistics summary flags:\n----------------\n");
+		printf("\nSA PN Threshold summary flags:\n----------------\n");
 
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nPer-SA summary[%02d] = %8x", i, xxx_summ.psa_sum_word[i]);
+			printf("\nPN threshold summary[%02d] = %8x", i, xxx_summ.pnthr_sum_word[i]);
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_sa_exp_summ: {
+		struct sa_exp_summ xxx_summ;
+		memset(&xxx_summ, 0, sizeof(struct sa_exp_summ));
 
-		printf("\nGlobal statistics summary = %8x", xxx_summ.glb_summ_word);
-		counter_bmap.raw_global_bmap = xxx_summ.glb_summ_word;
-
-		if (counter_bmap.TransformErrorPkts)
-			printf("\nTransformErrorPkts counter expired");
-
-		if (counter_bmap.InPktsCtrl)
-			printf("\nInPktsCtrl counter expired");
-
-		if (counter_bmap.InPktsNoTag)
-			printf("\nInPktsNoTag counter expired");
-
-		if (counter_bmap.InPktsUntagged)
-			printf("\nInPktsUntagged counter expired");
-
-		if (counter_bmap.InPktsTagged)
-			printf("\nInPktsTagged counter expired");
-
-		if (counter_bmap.InPktsBadTag)
-			printf("\nInPktsBadTag counter expired");
-
-		if (counter_bmap.InPktsUntaggedMiss)
-			printf("\nInPktsUntaggedMiss counter expired");
-
-		if (counter_bmap.InPktsNoSCI)
-			printf("\nInPktsNoSCI counter expired");
-
-		if (counter_bmap.InPktsUnknownSCI)
-			printf("\nInPktsUnknownSCI counter expired");
-
-		if (counter_bmap.InConsistCheckControlledNotPass)
-			printf("\nInConsistCheckControlledNotPass counter expired");
-
-		if (counter_bmap.InConsistCheckUncontrolledNotPass)
-			printf("\nInConsistCheckUncontrolledNotPass counter expired");
-
-		if (counter_bmap.InConsistCheckControlledPass)
-			printf("\nInConsistCheckControlledPass counter expired");
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
-		if (counter_bmap.InConsistCheckUncontrolledPass)
-			printf("\nInConsistCheckUncontrolledPass counter expired");
+		ret = gpy2xx_msec_clear_egr_sa_exp_summ(&phy, &xxx_summ);
 
-		if (counter_bmap.InOverSizePkts)
-			printf("\nInOverSizePkts counter expired");
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_stats_summ", strlen("gpy2xx_msec_get_egr_stats_summ")) == 0) {
+		if (ret < 0) {
+			printf("\nERROR: SA expired summary clear failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sa_exp_summ: {
 		int i;
-		struct stats_summary xxx_summ;
-		struct egr_global_bmap counter_bmap;
-		memset(&xxx_summ, 0, sizeof(struct stats_summary));
+		struct sa_exp_summ xxx_summ;
+		memset(&xxx_summ, 0, sizeof(struct sa_exp_summ));
 
-		ret = gpy2xx_msec_get_egr_stats_summ(&phy, &xxx_summ);
+		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
+		ret = gpy2xx_msec_get_egr_sa_exp_summ(&phy, &xxx_summ);
 
 		if (ret < 0) {
-			printf("\nERROR: Ingress stats summary get failed.\n");
+			printf("\nERROR: SA expired summary get failed.\n");
 			return -1;
 		}
 
-		printf("\nStatistics summary flags:\n----------------\n");
+		printf("\nSA PN Threshold summary flags:\n----------------\n");
 
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nPer-SA summary[%02d] = %8x", i, xxx_summ.psa_sum_word[i]);
+			printf("\nPN threshold summary[%02d] = %8x", i, xxx_summ.sa_expsum_word[i]);
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_cc_int_stat: {
+		struct crypto_core_stat cc_stat;
+		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
-		printf("\nGlobal statistics summary = %8x", xxx_summ.glb_summ_word);
-		counter_bmap.raw_global_bmap = xxx_summ.glb_summ_word;
-
-		if (counter_bmap.TransformErrorPkts)
-			printf("\nTransformErrorPkts counter expired");
-
-		if (counter_bmap.OutPktsCtrl)
-			printf("\nOutPktsCtrl counter expired");
-
-		if (counter_bmap.OutPktsUnknownSA)
-			printf("\nOutPktsUnknownSA counter expired");
-
-		if (counter_bmap.OutPktsUntagged)
-			printf("\nOutPktsUntagged counter expired");
-
-		if (counter_bmap.OutOverSizePkts)
-			printf("\nOutOverSizePkts counter expired");
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_sa_stats", strlen("gpy2xx_msec_get_ing_sa_stats")) == 0) {
-		struct ing_sa_stats sa_ctrs;
-		memset(&sa_ctrs, 0, sizeof(struct ing_sa_stats));
-
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(sa_ctrs.rule_index), &sa_ctrs.rule_index);
+		cli_parse(cmd, argc, argv, &cc_stat);
 
-		ret = gpy2xx_msec_get_ing_sa_stats(&phy, &sa_ctrs);
+		ret = gpy2xx_msec_clear_ing_cc_int_stat(&phy, &cc_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: SA counters get failed.\n");
+			printf("\nERROR: Crpypto cores interrupt status clear failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cc_int_stat: {
+		struct crypto_core_stat cc_stat;
+		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
-		printf("\nSA Counters:\n----------------\n");
-		printf("\t%40s:\t0x%llx\n", "InOctetsDecrypted", sa_ctrs.InOctetsDecrypted);
-		printf("\t%40s:\t0x%llx\n", "InOctetsDecrypted2", sa_ctrs.InOctetsDecrypted2);
-		printf("\t%40s:\t0x%llx\n", "InPktsUnchecked", sa_ctrs.InPktsUnchecked);
-		printf("\t%40s:\t0x%llx\n", "InPktsDelayed", sa_ctrs.InPktsDelayed);
-		printf("\t%40s:\t0x%llx\n", "InPktsLate", sa_ctrs.InPktsLate);
-		printf("\t%40s:\t0x%llx\n", "InPktsOK", sa_ctrs.InPktsOK);
-		printf("\t%40s:\t0x%llx\n", "InPktsInvalid", sa_ctrs.InPktsInvalid);
-		printf("\t%40s:\t0x%llx\n", "InPktsNotValid", sa_ctrs.InPktsNotValid);
-		printf("\t%40s:\t0x%llx\n", "InPktsNotUsingSA", sa_ctrs.InPktsNotUsingSA);
-		printf("\t%40s:\t0x%llx\n", "InPktsUnusedSA", sa_ctrs.InPktsUnusedSA);
-		printf("\t%40s:\t0x%llx\n", "InPktsUntaggedHit", sa_ctrs.InPktsUntaggedHit);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_sa_stats", strlen("gpy2xx_msec_get_egr_sa_stats")) == 0) {
-		struct egr_sa_stats sa_ctrs;
-		memset(&sa_ctrs, 0, sizeof(struct egr_sa_stats));
-
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(sa_ctrs.rule_index), &sa_ctrs.rule_index);
-
-		ret = gpy2xx_msec_get_egr_sa_stats(&phy, &sa_ctrs);
+		ret = gpy2xx_msec_get_ing_cc_int_stat(&phy, &cc_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: SA counters get failed.\n");
+			printf("\nERROR: Crpypto cores interrupt status get failed.\n");
 			return -1;
 		}
 
-		printf("\nSA Counters:\n----------------\n");
-		printf("\t%40s:\t0x%llx\n", "OutOctetsEncrypted", sa_ctrs.OutOctetsEncrypted);
-		printf("\t%40s:\t0x%llx\n", "OutOctetsEncrypted2", sa_ctrs.OutOctetsEncrypted2);
-		printf("\t%40s:\t0x%llx\n", "OutPktsEncrypted", sa_ctrs.OutPktsEncrypted);
-		printf("\t%40s:\t0x%llx\n", "OutPktsTooLong", sa_ctrs.OutPktsTooLong);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_global_stats", strlen("gpy2xx_msec_get_ing_global_stats")) == 0) {
-		struct ing_global_stats global_ctrs;
-		memset(&global_ctrs, 0, sizeof(struct ing_global_stats));
+#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
+		printf("\nCC context status (raw) = %8x", cc_stat.ctx_stat.raw_ctx_stat);
+#endif
+		printf("\nCC interrup status (raw) = %8x", cc_stat.int_stat.raw_int_stat);
 
-		ret = gpy2xx_msec_get_ing_global_stats(&phy, &global_ctrs);
+		if (cc_stat.int_stat.input_error)
+			printf("\nInput data does not properly receive all data (e2)");
 
-		if (ret < 0) {
-			printf("\nERROR: GLOBAL counters get failed.\n");
-			return -1;
-		}
+		if (cc_stat.int_stat.processing_error)
+			printf("\nAn error occurred while processing the frame or parsing the token. Combination of errors e0, e1, e3 and e4");
 
-		printf("\nGLOBAL Counters:\n----------------\n");
-		printf("\t%40s:\t0x%llx\n", "TransformErrorPkts", global_ctrs.TransformErrorPkts);
-		printf("\t%40s:\t0x%llx\n", "InPktsCtrl", global_ctrs.InPktsCtrl);
-		printf("\t%40s:\t0x%llx\n", "InPktsNoTag", global_ctrs.InPktsNoTag);
-		printf("\t%40s:\t0x%llx\n", "InPktsUntagged", global_ctrs.InPktsUntagged);
-		printf("\t%40s:\t0x%llx\n", "InPktsTagged", global_ctrs.InPktsTagged);
-		printf("\t%40s:\t0x%llx\n", "InPktsBadTag", global_ctrs.InPktsBadTag);
-		printf("\t%40s:\t0x%llx\n", "InPktsUntaggedMiss", global_ctrs.InPktsUntaggedMiss);
-		printf("\t%40s:\t0x%llx\n", "InPktsNoSCI", global_ctrs.InPktsNoSCI);
-		printf("\t%40s:\t0x%llx\n", "InPktsUnknownSCI", global_ctrs.InPktsUnknownSCI);
-		printf("\t%40s:\t0x%llx\n", "InConsistCheckControlledNotPass", global_ctrs.InConsistCheckControlledNotPass);
-		printf("\t%40s:\t0x%llx\n", "InConsistCheckUncontrolledNotPass", global_ctrs.InConsistCheckUncontrolledNotPass);
-		printf("\t%40s:\t0x%llx\n", "InConsistCheckControlledPass", global_ctrs.InConsistCheckControlledPass);
-		printf("\t%40s:\t0x%llx\n", "InConsistCheckUncontrolledPass", global_ctrs.InConsistCheckUncontrolledPass);
-		printf("\t%40s:\t0x%llx\n", "InOverSizePkts", global_ctrs.InOverSizePkts);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_global_stats", strlen("gpy2xx_msec_get_egr_global_stats")) == 0) {
-		struct egr_global_stats global_ctrs;
-		memset(&global_ctrs, 0, sizeof(struct egr_global_stats));
+		if (cc_stat.int_stat.context_error)
+			printf("\nAn invalid context has been fetched. Combination of errors e5 and e6");
+
+		if (cc_stat.int_stat.seq_threshold)
+			printf("\nIf a sequence number exceeds the programmed sequence number threshold (refer to 0) due to an outbound sequence number increment this interrupt is triggered (e8).");
+
+		if (cc_stat.int_stat.seq_rollover)
+			printf("\nIf a sequence number roll-over (increment from maximum to zero) due to an outbound sequence number increment this interrupt is triggered (e10 egress only)");
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_cc_int_stat: {
+		struct crypto_core_stat cc_stat;
+		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
-		ret = gpy2xx_msec_get_egr_global_stats(&phy, &global_ctrs);
+		cli_parse(cmd, argc, argv, &cc_stat);
+
+		ret = gpy2xx_msec_clear_egr_cc_int_stat(&phy, &cc_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: GLOBAL counters get failed.\n");
+			printf("\nERROR: Crpypto cores interrupt status clear failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_cc_int_stat: {
+		struct crypto_core_stat cc_stat;
+		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
-		printf("\nGLOBAL Counters:\n----------------\n");
-		printf("\t%40s:\t0x%llx\n", "TransformErrorPkts", global_ctrs.TransformErrorPkts);
-		printf("\t%40s:\t0x%llx\n", "OutPktsCtrl", global_ctrs.OutPktsCtrl);
-		printf("\t%40s:\t0x%llx\n", "OutPktsUnknownSA", global_ctrs.OutPktsUnknownSA);
-		printf("\t%40s:\t0x%llx\n", "OutPktsUntagged", global_ctrs.OutPktsUntagged);
-		printf("\t%40s:\t0x%llx\n", "OutOverSizePkts", global_ctrs.OutOverSizePkts);
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_debug_stats", strlen("gpy2xx_msec_get_ing_debug_stats")) == 0) {
-		struct stats_debug_regs dbg_ctrs;
-		memset(&dbg_ctrs, 0, sizeof(struct stats_debug_regs));
-
-		ret = gpy2xx_msec_get_ing_debug_stats(&phy, &dbg_ctrs);
+		ret = gpy2xx_msec_get_egr_cc_int_stat(&phy, &cc_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: Debug counters get failed.\n");
+			printf("\nERROR: Crpypto cores interrupt status get failed.\n");
 			return -1;
 		}
 
-		printf("\nDebug Counters:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "SA counters that were incremented", dbg_ctrs.cdb1.sa_inc_mask);
-		printf("\t%40s:\t0x%x\n", "SA octet counters that were incremented", dbg_ctrs.cdb1.sa_octet_inc);
-		printf("\t%40s:\t0x%x\n", "Raw CDB1", dbg_ctrs.cdb1.raw_cdb1);
+#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
+		printf("\nCC context status (raw) = %8x", cc_stat.ctx_stat.raw_ctx_stat);
+#endif
+		printf("\nCC interrup status (raw) = %8x", cc_stat.int_stat.raw_int_stat);
 
-		printf("\t%40s:\t0x%x\n", "VLAN counters that were incremented", dbg_ctrs.cdb2.vlan_inc_mask);
-		printf("\t%40s:\t0x%x\n", "VLAN octet counters that were incremented", dbg_ctrs.cdb2.vlan_octet_inc);
-		printf("\t%40s:\t0x%x\n", "Raw CDB2", dbg_ctrs.cdb2.raw_cdb2);
+		if (cc_stat.int_stat.input_error)
+			printf("\nInput data does not properly receive all data (e2)");
 
-		printf("\t%40s:\t0x%x\n", "Global counters that were incremented", dbg_ctrs.global_inc_mask);
+		if (cc_stat.int_stat.processing_error)
+			printf("\nAn error occurred while processing the frame or parsing the token. Combination of errors e0, e1, e3 and e4");
 
-		printf("\t%40s:\t0x%x\n", "Global octet counters that were incremented", dbg_ctrs.cdb4.global_octet_inc);
-		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG1 written?", dbg_ctrs.cdb4.sa_test);
-		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG2 written?", dbg_ctrs.cdb4.vlan_test);
-		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG3 written?", dbg_ctrs.cdb4.global_test);
-		printf("\t%40s:\t0x%x\n", "SA num for which counters were incremented", dbg_ctrs.cdb4.sa_nr);
-		printf("\t%40s:\t0x%x\n", "VLAN UP for which counters were incremented", dbg_ctrs.cdb4.vlan_up);
-		printf("\t%40s:\t0x%x\n", "Raw CDB4", dbg_ctrs.cdb4.raw_cdb4);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_debug_stats", strlen("gpy2xx_msec_get_egr_debug_stats")) == 0) {
-		struct stats_debug_regs dbg_ctrs;
-		memset(&dbg_ctrs, 0, sizeof(struct stats_debug_regs));
+		if (cc_stat.int_stat.context_error)
+			printf("\nAn invalid context has been fetched. Combination of errors e5 and e6");
 
-		ret = gpy2xx_msec_get_egr_debug_stats(&phy, &dbg_ctrs);
+		if (cc_stat.int_stat.seq_threshold)
+			printf("\nIf a sequence number exceeds the programmed sequence number threshold (refer to 0) due to an outbound sequence number increment this interrupt is triggered (e8).");
+
+		if (cc_stat.int_stat.seq_rollover)
+			printf("\nIf a sequence number roll-over (increment from maximum to zero) due to an outbound sequence number increment this interrupt is triggered (e10 egress only)");
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sn_thresh: {
+		struct seq_num_thr sn_thr;
+		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
+
+		cli_parse(cmd, argc, argv, &sn_thr);
+
+		ret = gpy2xx_msec_config_ing_sn_thresh(&phy, &sn_thr);
 
 		if (ret < 0) {
-			printf("\nERROR: Debug counters get failed.\n");
+			printf("\nERROR: SN Threshold set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sn_thresh: {
+		struct seq_num_thr sn_thr;
+		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		printf("\nDebug Counters:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "SA counters that were incremented", dbg_ctrs.cdb1.sa_inc_mask);
-		printf("\t%40s:\t0x%x\n", "SA octet counters that were incremented", dbg_ctrs.cdb1.sa_octet_inc);
-		printf("\t%40s:\t0x%x\n", "Raw CDB1", dbg_ctrs.cdb1.raw_cdb1);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
-		printf("\t%40s:\t0x%x\n", "VLAN counters that were incremented", dbg_ctrs.cdb2.vlan_inc_mask);
-		printf("\t%40s:\t0x%x\n", "VLAN octet counters that were incremented", dbg_ctrs.cdb2.vlan_octet_inc);
-		printf("\t%40s:\t0x%x\n", "Raw CDB2", dbg_ctrs.cdb2.raw_cdb2);
+		ret = gpy2xx_msec_get_ing_sn_thresh(&phy, &sn_thr);
 
-		printf("\t%40s:\t0x%x\n", "Global counters that were incremented", dbg_ctrs.global_inc_mask);
+		if (ret < 0) {
+			printf("\nERROR: SN Threshold set failed.\n");
+			return -1;
+		}
 
-		printf("\t%40s:\t0x%x\n", "Global octet counters that were incremented", dbg_ctrs.cdb4.global_octet_inc);
-		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG1 written?", dbg_ctrs.cdb4.sa_test);
-		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG2 written?", dbg_ctrs.cdb4.vlan_test);
-		printf("\t%40s:\t0x%x\n", "COUNT_DEBUG3 written?", dbg_ctrs.cdb4.global_test);
-		printf("\t%40s:\t0x%x\n", "SA num for which counters were incremented", dbg_ctrs.cdb4.sa_nr);
-		printf("\t%40s:\t0x%x\n", "VLAN UP for which counters were incremented", dbg_ctrs.cdb4.vlan_up);
-		printf("\t%40s:\t0x%x\n", "Raw CDB4", dbg_ctrs.cdb4.raw_cdb4);
-#endif
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_count_ctrl", strlen("gpy2xx_msec_config_ing_count_ctrl")) == 0) {
-		struct count_control cnt_ctrl;
-		memset(&cnt_ctrl, 0, sizeof(struct count_control));
+		printf("\nSN threshold = %llx", sn_thr.sn_threshold);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sn_thresh: {
+		struct seq_num_thr sn_thr;
+		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "rst_all", sizeof(cnt_ctrl.reset_all), &cnt_ctrl.reset_all);
-		cnt += scanParamArg(argc, argv, "ctr_saturate", sizeof(cnt_ctrl.saturate_cntrs), &cnt_ctrl.saturate_cntrs);
-		cnt += scanParamArg(argc, argv, "ctr_conr", sizeof(cnt_ctrl.auto_cntr_reset), &cnt_ctrl.auto_cntr_reset);
-		cnt += scanParamArg(argc, argv, "rst_summary", sizeof(cnt_ctrl.reset_summary), &cnt_ctrl.reset_summary);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
-		ret = gpy2xx_msec_config_ing_count_ctrl(&phy, &cnt_ctrl);
+		ret = gpy2xx_msec_config_egr_sn_thresh(&phy, &sn_thr);
 
 		if (ret < 0) {
-			printf("\nERROR: Count Control flags set failed.\n");
+			printf("\nERROR: SN Threshold set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_count_ctrl", strlen("gpy2xx_msec_config_egr_count_ctrl")) == 0) {
-		struct count_control cnt_ctrl;
-		memset(&cnt_ctrl, 0, sizeof(struct count_control));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sn_thresh: {
+		struct seq_num_thr sn_thr;
+		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "rst_all", sizeof(cnt_ctrl.reset_all), &cnt_ctrl.reset_all);
-		cnt += scanParamArg(argc, argv, "ctr_saturate", sizeof(cnt_ctrl.saturate_cntrs), &cnt_ctrl.saturate_cntrs);
-		cnt += scanParamArg(argc, argv, "ctr_conr", sizeof(cnt_ctrl.auto_cntr_reset), &cnt_ctrl.auto_cntr_reset);
-		cnt += scanParamArg(argc, argv, "rst_summary", sizeof(cnt_ctrl.reset_summary), &cnt_ctrl.reset_summary);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
-		ret = gpy2xx_msec_config_egr_count_ctrl(&phy, &cnt_ctrl);
+		ret = gpy2xx_msec_get_egr_sn_thresh(&phy, &sn_thr);
 
 		if (ret < 0) {
-			printf("\nERROR: Count Control flags set failed.\n");
+			printf("\nERROR: SN Threshold set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_count_incen", strlen("gpy2xx_msec_config_ing_count_incen")) == 0) {
-		struct count_incen cnt_inx;
-		memset(&cnt_inx, 0, sizeof(struct count_incen));
 
-		cnt += scanParamArg(argc, argv, "sa_inc", sizeof(cnt_inx.sa_inc_en), &cnt_inx.sa_inc_en);
-		cnt += scanParamArg(argc, argv, "vlan_inc", sizeof(cnt_inx.vlan_inc_en), &cnt_inx.vlan_inc_en);
-		cnt += scanParamArg(argc, argv, "global_inc", sizeof(cnt_inx.global_inc_en), &cnt_inx.global_inc_en);
+		printf("\nSN threshold = %llx", sn_thr.sn_threshold);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_aic_csr: {
+		struct aic_control_stat aic_csr;
+		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
+
+		cli_parse(cmd, argc, argv, &aic_csr);
 
-		ret = gpy2xx_msec_config_ing_count_incen(&phy, &cnt_inx);
+		ret = gpy2xx_msec_config_ing_aic_csr(&phy, &aic_csr);
 
 		if (ret < 0) {
-			printf("\nERROR: Count Incx flags set failed.\n");
+			printf("\nERROR:AIC's CSR set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_count_incen", strlen("gpy2xx_msec_config_egr_count_incen")) == 0) {
-		struct count_incen cnt_inx;
-		memset(&cnt_inx, 0, sizeof(struct count_incen));
-
-		cnt += scanParamArg(argc, argv, "sa_inc", sizeof(cnt_inx.sa_inc_en), &cnt_inx.sa_inc_en);
-		cnt += scanParamArg(argc, argv, "vlan_inc", sizeof(cnt_inx.vlan_inc_en), &cnt_inx.vlan_inc_en);
-		cnt += scanParamArg(argc, argv, "global_inc", sizeof(cnt_inx.global_inc_en), &cnt_inx.global_inc_en);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_aic_csr: {
+		struct aic_control_stat aic_csr;
+		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
-		ret = gpy2xx_msec_config_egr_count_incen(&phy, &cnt_inx);
+		ret = gpy2xx_msec_get_ing_aic_csr(&phy, &aic_csr);
 
 		if (ret < 0) {
-			printf("\nERROR: Count Incx flags set failed.\n");
+			printf("\nERROR:AIC's CSR get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_count_secfail", strlen("gpy2xx_msec_config_ing_count_secfail")) == 0) {
-		struct count_secfail cnt_sfail;
-		memset(&cnt_sfail, 0, sizeof(struct count_secfail));
 
-		cnt += scanParamArg(argc, argv, "misc_secfail", sizeof(cnt_sfail.secfail_1.raw_secfail1), &cnt_sfail.secfail_1.raw_secfail1);
-		cnt += scanParamArg(argc, argv, "global_secfail", sizeof(cnt_sfail.global_secfaill_mask), &cnt_sfail.global_secfaill_mask);
+		printf("\n            Interrupt bit assignments in Advanced Interrupt Controller");
+		printf("\n------------------------------------------------------------------------------------");
+		printf("\n| Bit | Interrupt Name |                      Description                          |");
+		printf("\n------------------------------------------------------------------------------------");
+		printf("\n| [0] | drop_class     | pkt drop pulse from classification logic                  |");
+		printf("\n| [1] | drop_pp        | pkt drop pulse from post-processor logic                  |");
+		printf("\n| [2] | drop_mtu       | pkt drop pulse from MTU checking logic                    |");
+		printf("\n| [3] | eng_irq        | interrupt pulse from EIP-62 MACsec crypto-engine core     |");
+		printf("\n| [4] | stat_sa_thr    | interrupt pulse from statistics module (SA statistics)    |");
+		printf("\n| [5] | stat_global_thr| interrupt pulse from statistics module (global statistics)|");
+		printf("\n| [6] | stat_vlan_thr  | interrupt pulse from statistics module (VLAN statistics)  |");
+		printf("\n| [7] | drop_cc packet | (-i)pkt drop pulse from consistency checking logic        |");
+		printf("\n| [8] | sa_pn_thr      | (-e)pulse from post processor                             |");
+		printf("\n| [9] | sa_expired     | (-e)pulse from classifier                                 |");
+		printf("\n------------------------------------------------------------------------------------");
+
+		printf("\nIndividual 'type (as below)' bits per interrupt input:");
+		printf("\n                                        Type Control = %8x (0b = level detect, 1b = edge detect)", aic_csr.type_ctrl.raw_aic_bits);
+		printf("\n                                    Polarity Control = %8x (0b = low level or falling edge, 1b = high level or rising edge)", aic_csr.pol_ctrl.raw_aic_bits);
+		printf("\n   Raw Interrupt Pending Status (i.e before masking) = %8x (0b = inactive, 1b = pending)", aic_csr.raw_stat.raw_aic_bits);
+		printf("\n Masked Interrupt Pending Status (i.e after masking) = %8x (0b = inactive, 1b = pending)", aic_csr.enabled_stat.raw_aic_bits);
+		printf("\n                            Interrupt Enable Control = %8x (0b = disabled, 1b = enabled)", aic_csr.enable_ctrl.raw_aic_bits);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_aic_csr: {
+		struct aic_control_stat aic_csr;
+		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
+
+		cli_parse(cmd, argc, argv, &aic_csr);
 
-		ret = gpy2xx_msec_config_ing_count_secfail(&phy, &cnt_sfail);
+		ret = gpy2xx_msec_config_egr_aic_csr(&phy, &aic_csr);
 
 		if (ret < 0) {
-			printf("\nERROR: Count secfail event flags set failed.\n");
+			printf("\nERROR:AIC's CSR set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_count_secfail", strlen("gpy2xx_msec_config_egr_count_secfail")) == 0) {
-		struct count_secfail cnt_sfail;
-		memset(&cnt_sfail, 0, sizeof(struct count_secfail));
-
-		cnt += scanParamArg(argc, argv, "misc_secfail", sizeof(cnt_sfail.secfail_1.raw_secfail1), &cnt_sfail.secfail_1.raw_secfail1);
-		cnt += scanParamArg(argc, argv, "global_secfail", sizeof(cnt_sfail.global_secfaill_mask), &cnt_sfail.global_secfaill_mask);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_aic_csr: {
+		struct aic_control_stat aic_csr;
+		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
-		ret = gpy2xx_msec_config_egr_count_secfail(&phy, &cnt_sfail);
+		ret = gpy2xx_msec_get_egr_aic_csr(&phy, &aic_csr);
 
 		if (ret < 0) {
-			printf("\nERROR: Count secfail event flags set failed.\n");
+			printf("\nERROR:AIC's CSR get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_count_thresh", strlen("gpy2xx_msec_config_ing_count_thresh")) == 0) {
-		struct frame_octet_thr cnt_thr;
-		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		cnt += scanParamArg(argc, argv, "frame_thr", 64, &cnt_thr.frame_threshold);
-		cnt += scanParamArg(argc, argv, "octet_thr", 64, &cnt_thr.octet_threshold);
+		printf("\n            Interrupt bit assignments in Advanced Interrupt Controller");
+		printf("\n------------------------------------------------------------------------------------");
+		printf("\n| Bit | Interrupt Name |                      Description                          |");
+		printf("\n------------------------------------------------------------------------------------");
+		printf("\n| [0] | drop_class     | pkt drop pulse from classification logic                  |");
+		printf("\n| [1] | drop_pp        | pkt drop pulse from post-processor logic                  |");
+		printf("\n| [2] | drop_mtu       | pkt drop pulse from MTU checking logic                    |");
+		printf("\n| [3] | eng_irq        | interrupt pulse from EIP-62 MACsec crypto-engine core     |");
+		printf("\n| [4] | stat_sa_thr    | interrupt pulse from statistics module (SA statistics)    |");
+		printf("\n| [5] | stat_global_thr| interrupt pulse from statistics module (global statistics)|");
+		printf("\n| [6] | stat_vlan_thr  | interrupt pulse from statistics module (VLAN statistics)  |");
+		printf("\n| [7] | drop_cc packet | (-i)pkt drop pulse from consistency checking logic        |");
+		printf("\n| [8] | sa_pn_thr      | (-e)pulse from post processor                             |");
+		printf("\n| [9] | sa_expired     | (-e)pulse from classifier                                 |");
+		printf("\n------------------------------------------------------------------------------------");
 
-		ret = gpy2xx_msec_config_ing_count_thresh(&phy, &cnt_thr);
+		printf("\nIndividual 'type (as below)' bits per interrupt input:");
+		printf("\n                                        Type Control = %8x (0b = level detect, 1b = edge detect)", aic_csr.type_ctrl.raw_aic_bits);
+		printf("\n                                    Polarity Control = %8x (0b = low level or falling edge, 1b = high level or rising edge)", aic_csr.pol_ctrl.raw_aic_bits);
+		printf("\n   Raw Interrupt Pending Status (i.e before masking) = %8x (0b = inactive, 1b = pending)", aic_csr.raw_stat.raw_aic_bits);
+		printf("\n Masked Interrupt Pending Status (i.e after masking) = %8x (0b = inactive, 1b = pending)", aic_csr.enabled_stat.raw_aic_bits);
+		printf("\n                            Interrupt Enable Control = %8x (0b = disabled, 1b = enabled)", aic_csr.enable_ctrl.raw_aic_bits);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cap: {
+		struct eip160_hwcap hw_cap;
+		memset(&hw_cap, 0, sizeof(struct eip160_hwcap));
+
+		ret = gpy2xx_msec_get_ing_cap(&phy, &hw_cap);
 
 		if (ret < 0) {
-			printf("\nERROR: Counters threshold summary set failed.\n");
+			printf("\nERROR:Ing HW cap get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_count_thresh", strlen("gpy2xx_msec_config_egr_count_thresh")) == 0) {
-		struct frame_octet_thr cnt_thr;
-		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		cnt += scanParamArg(argc, argv, "frame_thr", 64, &cnt_thr.frame_threshold);
-		cnt += scanParamArg(argc, argv, "octet_thr", 64, &cnt_thr.octet_threshold);
+		printf("\nEIP num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
+		       hw_cap.eip_ver.eip_nr, hw_cap.eip_ver.eip_nr_complement, hw_cap.eip_ver.patch_level, hw_cap.eip_ver.minor_version, hw_cap.eip_ver.major_version);
+		printf("\nSA nums %x CCs %x, match-sci %x",
+		       hw_cap.eip_cfg.nr_of_sas, hw_cap.eip_cfg.consist_checks, hw_cap.eip_cfg.match_sci);
+		//printf("\nRaw CFG2 %x ", hw_cap.eip_cfg2.raw_eip160_cfg2);
+		printf("\nCounters:- SA %x, VL %x, GL %x, Saturate %x, Auto reset %x, SA octet %x, VL octet %x, GL octet %x, IG only %x, EG only %x, Tag bypass %x\n",
+		       hw_cap.eip_cfg2.sa_counters, hw_cap.eip_cfg2.vl_counters, hw_cap.eip_cfg2.global_counters, hw_cap.eip_cfg2.saturate_cntrs,
+		       hw_cap.eip_cfg2.auto_cntr_reset, hw_cap.eip_cfg2.sa_octet_ctrs, hw_cap.eip_cfg2.vl_octet_ctrs, hw_cap.eip_cfg2.glob_octet_ctrs,
+		       hw_cap.eip_cfg2.ingress_only, hw_cap.eip_cfg2.egress_only, hw_cap.eip_cfg2.tag_bypass);
+		printf("\nAIC's number of interrupt inputs %x ", hw_cap.aic_opt.number_of_inputs);
+		printf("\nAIC num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
+		       hw_cap.aic_ver.eip_nr, hw_cap.aic_ver.eip_nr_complement, hw_cap.aic_ver.patch_level, hw_cap.aic_ver.minor_version, hw_cap.aic_ver.major_version);
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_cap: {
+		struct eip160_hwcap hw_cap;
+		memset(&hw_cap, 0, sizeof(struct eip160_hwcap));
 
-		ret = gpy2xx_msec_config_egr_count_thresh(&phy, &cnt_thr);
+		ret = gpy2xx_msec_get_egr_cap(&phy, &hw_cap);
 
 		if (ret < 0) {
-			printf("\nERROR: Counters threshold summary set failed.\n");
+			printf("\nERROR:Egr HW cap get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_count_thresh", strlen("gpy2xx_msec_get_ing_count_thresh")) == 0) {
-		struct frame_octet_thr cnt_thr;
-		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		ret = gpy2xx_msec_get_ing_count_thresh(&phy, &cnt_thr);
+		printf("\nEIP num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
+		       hw_cap.eip_ver.eip_nr, hw_cap.eip_ver.eip_nr_complement, hw_cap.eip_ver.patch_level, hw_cap.eip_ver.minor_version, hw_cap.eip_ver.major_version);
+		printf("\nSA nums %x", hw_cap.eip_cfg.nr_of_sas);
+		//printf("\nRaw CFG2 %x ", hw_cap.eip_cfg2.raw_eip160_cfg2);
+		printf("\nCounters:- SA %x, VL %x, GL %x, Saturate %x, Auto reset %x, SA octet %x, VL octet %x, GL octet %x, IG only %x, EG only %x, Tag bypass %x\n",
+		       hw_cap.eip_cfg2.sa_counters, hw_cap.eip_cfg2.vl_counters, hw_cap.eip_cfg2.global_counters, hw_cap.eip_cfg2.saturate_cntrs,
+		       hw_cap.eip_cfg2.auto_cntr_reset, hw_cap.eip_cfg2.sa_octet_ctrs, hw_cap.eip_cfg2.vl_octet_ctrs, hw_cap.eip_cfg2.glob_octet_ctrs,
+		       hw_cap.eip_cfg2.ingress_only, hw_cap.eip_cfg2.egress_only, hw_cap.eip_cfg2.tag_bypass);
+		printf("\nAIC's number of interrupt inputs %x ", hw_cap.aic_opt.number_of_inputs);
+		printf("\nAIC num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
+		       hw_cap.aic_ver.eip_nr, hw_cap.aic_ver.eip_nr_complement, hw_cap.aic_ver.patch_level, hw_cap.aic_ver.minor_version, hw_cap.aic_ver.major_version);
+		break;
+	}
+	default:
+		printf("Command Not Supported\n");
+		ret = -1;
+		break;
+	}
 
-		if (ret < 0) {
-			printf("\nERROR: Counters threshold summary get failed.\n");
-			return -1;
-		}
+	return ret;
+}
 
-		printf("\nFrame threshold summary = %llx", cnt_thr.frame_threshold);
-		printf("\nOctet threshold summary = %llx", cnt_thr.octet_threshold);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_count_thresh", strlen("gpy2xx_msec_get_egr_count_thresh")) == 0) {
-		struct frame_octet_thr cnt_thr;
-		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
+/* Print the fields of a register value, nothing if the register is not in the map */
+static void print_regmap(enum gpy2xx_regmap_space space, u32 addr, u32 val)
+{
+	const struct gpy2xx_regmap_reg *reg = gpy2xx_regmap_lookup(space, addr);
+	char buf[2048];
+
+	/* 16-bit access to the upper half of a 32-bit PDI register */
+	if (reg == NULL && space != GPY2XX_REGMAP_MDIO && (addr & 2)) {
+		reg = gpy2xx_regmap_lookup(space, addr & ~3u);
+		val <<= 16;
+	}
 
-		ret = gpy2xx_msec_get_egr_count_thresh(&phy, &cnt_thr);
+	if (reg != NULL && gpy2xx_regmap_decode(reg, val, buf, sizeof(buf)) >= 0)
+		printf("\t%s\n", buf);
+}
 
-		if (ret < 0) {
-			printf("\nERROR: Counters threshold summary get failed.\n");
+/* Decode "<addr> <value>" lines and "addr <addr>, value <value>" traces */
+static int regmap_decode_file(enum gpy2xx_regmap_space space, const char *file)
+{
+	FILE *fp = stdin;
+	char line[512];
+	char *p;
+	u32 addr, val;
+	int len;
+
+	if (strcmp(file, "-") != 0) {
+		fp = fopen(file, "r");
+		if (fp == NULL) {
+			printf("ERROR: Could not open \"%s\"\n", file);
 			return -1;
 		}
+	}
 
-		printf("\nFrame threshold summary = %llx", cnt_thr.frame_threshold);
-		printf("\nOctet threshold summary = %llx", cnt_thr.octet_threshold);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_misc_ctrl", strlen("gpy2xx_msec_config_ing_misc_ctrl")) == 0) {
-		struct misc_control mics_ctrl;
-		memset(&mics_ctrl, 0, sizeof(struct misc_control));
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		len = strlen(line);
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+			line[--len] = 0;
 
-		cnt += scanParamArg(argc, argv, "mc_latency", sizeof(mics_ctrl.mc_latency_fix), &mics_ctrl.mc_latency_fix);
-		cnt += scanParamArg(argc, argv, "static_bp", sizeof(mics_ctrl.static_bypass), &mics_ctrl.static_bypass);
-		cnt += scanParamArg(argc, argv, "nm_macsec", sizeof(mics_ctrl.nm_macsec_en), &mics_ctrl.nm_macsec_en);
-		cnt += scanParamArg(argc, argv, "validate_level", sizeof(mics_ctrl.validate_frames), &mics_ctrl.validate_frames);
-		cnt += scanParamArg(argc, argv, "sectag_avlan", sizeof(mics_ctrl.sectag_after_vlan), &mics_ctrl.sectag_after_vlan);
+		if (len == 0)
+			continue;
 
-		ret = gpy2xx_msec_config_ing_misc_ctrl(&phy, &mics_ctrl);
+		printf("%s\n", line);
 
-		if (ret < 0) {
-			printf("\nERROR: Misc ctrl param set failed.\n");
-			return -1;
+		p = strstr(line, "addr ");
+		if (p != NULL) {
+			if (sscanf(p, "addr %x, value %x", &addr, &val) == 2)
+				print_regmap(space, addr, val);
+		} else if (sscanf(line, "%x%*[ \t:=]%x", &addr, &val) == 2) {
+			print_regmap(space, addr, val);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_misc_ctrl", strlen("gpy2xx_msec_config_egr_misc_ctrl")) == 0) {
-		struct misc_control mics_ctrl;
-		memset(&mics_ctrl, 0, sizeof(struct misc_control));
+	}
 
-		cnt += scanParamArg(argc, argv, "mc_latency", sizeof(mics_ctrl.mc_latency_fix), &mics_ctrl.mc_latency_fix);
-		cnt += scanParamArg(argc, argv, "static_bp", sizeof(mics_ctrl.static_bypass), &mics_ctrl.static_bypass);
-		cnt += scanParamArg(argc, argv, "nm_macsec", sizeof(mics_ctrl.nm_macsec_en), &mics_ctrl.nm_macsec_en);
-		cnt += scanParamArg(argc, argv, "validate_level", sizeof(mics_ctrl.validate_frames), &mics_ctrl.validate_frames);
-		cnt += scanParamArg(argc, argv, "sectag_avlan", sizeof(mics_ctrl.sectag_after_vlan), &mics_ctrl.sectag_after_vlan);
+	if (fp != stdin)
+		fclose(fp);
 
-		ret = gpy2xx_msec_config_egr_misc_ctrl(&phy, &mics_ctrl);
+	return 0;
+}
 
-		if (ret < 0) {
-			printf("\nERROR: Misc ctrl param set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sa_nm_ctrl", strlen("gpy2xx_msec_config_ing_sa_nm_ctrl")) == 0) {
-		u16 in_data;
-		struct sa_nm_params nm_ctrl;
-		memset(&nm_ctrl, 0, sizeof(struct sa_nm_params));
+int gpy211_main(int argc, char *argv[])
+{
+	s32 ret = 0;
+	const struct cli_cmd *cmd = cli_cmd_lookup(gpy211_cmds, ARRAY_SIZE(gpy211_cmds), argv[2]);
 
-		cnt += scanParamArg(argc, argv, "comp_etype", sizeof(in_data), &in_data);
-		nm_ctrl.comp_etype = in_data;
-		cnt += scanParamArg(argc, argv, "check_ver", sizeof(in_data), &in_data);
-		nm_ctrl.check_v = in_data;
-		cnt += scanParamArg(argc, argv, "check_kay", sizeof(in_data), &in_data);
-		nm_ctrl.check_kay = in_data;
-		cnt += scanParamArg(argc, argv, "check_ce", sizeof(in_data), &in_data);
-		nm_ctrl.check_c_e = in_data;
-		cnt += scanParamArg(argc, argv, "check_sc", sizeof(in_data), &in_data);
-		nm_ctrl.check_sc = in_data;
-		cnt += scanParamArg(argc, argv, "check_sl", sizeof(in_data), &in_data);
-		nm_ctrl.check_sl = in_data;
-		cnt += scanParamArg(argc, argv, "check_pn", sizeof(in_data), &in_data);
-		nm_ctrl.check_pn = in_data;
-		cnt += scanParamArg(argc, argv, "msec_eth", sizeof(in_data), &in_data);
-		nm_ctrl.msec_tag_value = in_data;
-		//printf("Utility raw %x\n", nm_ctrl.raw_sanm_ctrl);
+	switch (cmd != NULL ? cmd->id : CLI_CMD_NONE) {
+	case CLI_CMD_gpy2xx_uninit: {
+		ret = gpy2xx_uninit(&phy);
 
-		ret = gpy2xx_msec_config_ing_sa_nm_ctrl(&phy, &nm_ctrl);
+		if (ret < 0)
+			printf("\nERROR: GPY211 uinit failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_get_phy_id: {
+		struct gpy211_id phyId = phy.id;
 
-		if (ret < 0) {
-			printf("\nERROR: SA Non-Match ctrl param set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sa_nm_ctrl", strlen("gpy2xx_msec_config_egr_sa_nm_ctrl")) == 0) {
-		u16 in_data;
-		struct sa_nm_params nm_ctrl;
-		memset(&nm_ctrl, 0, sizeof(struct sa_nm_params));
+		printf("\nPopulated PHY ID parameters:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "PHY Organizationally Unique Identifier", phyId.OUI);
+		printf("\t%40s:\t0x%x\n", "PHY Manufacturer's Model Number", phyId.model_no);
+		printf("\t%40s:\t0x%x\n", "PHY Revision Number", phyId.revision);
+		printf("\t%40s:\t0x%x\n", "Chip Manufacturer ID", phyId.manufacturer_id);
+		printf("\t%40s:\t0x%x\n", "Chip Part Number", phyId.part_no);
+		printf("\t%40s:\t0x%x\n", "Chip Version", phyId.version);
+		printf("\t%40s:\t0x%x\n", "Firmware Version", ((phyId.fw_release << 15) | (phyId.fw_major << 8) | (phyId.fw_minor)));
+		printf("\t%40s:\t0x%x\n", "Firmware Major Version Number", phyId.fw_major);
+		printf("\t%40s:\t0x%x\n", "Firmware Minor Version Number", phyId.fw_minor);
+		printf("\t%40s:\t0x%x\n", "Firmware Release Indication", phyId.fw_release);
+		printf("\t%40s:\t%s\n", "The memory target used for firmware execution", (phyId.fw_memory ? ((phyId.fw_memory == 1) ? "OTP" : "FLASH") : "ROM"));
+		printf("\t%40s:\t0x%x\n", "Driver Major Version Number", phyId.drv_major);
+		printf("\t%40s:\t0x%x\n", "Driver Minor Version Number", phyId.drv_minor);
+		printf("\t%40s:\t0x%x\n", "Driver Release Indication", phyId.drv_release);
+		printf("\t%40s:\t0x%x\n", "Driver Patch Indication", phyId.drv_patch);
+		break;
+	}
+	case CLI_CMD_gpy2xx_read_fw_info: {
+		ret = gpy2xx_read_fw_info(&phy);
 
-		cnt += scanParamArg(argc, argv, "comp_etype", sizeof(in_data), &in_data);
-		nm_ctrl.comp_etype = in_data;
-		cnt += scanParamArg(argc, argv, "check_ver", sizeof(in_data), &in_data);
-		nm_ctrl.check_v = in_data;
-		cnt += scanParamArg(argc, argv, "check_kay", sizeof(in_data), &in_data);
-		nm_ctrl.check_kay = in_data;
-		cnt += scanParamArg(argc, argv, "check_ce", sizeof(in_data), &in_data);
-		nm_ctrl.check_c_e = in_data;
-		cnt += scanParamArg(argc, argv, "check_sc", sizeof(in_data), &in_data);
-		nm_ctrl.check_sc = in_data;
-		cnt += scanParamArg(argc, argv, "check_sl", sizeof(in_data), &in_data);
-		nm_ctrl.check_sl = in_data;
-		cnt += scanParamArg(argc, argv, "check_pn", sizeof(in_data), &in_data);
-		nm_ctrl.check_pn = in_data;
-		cnt += scanParamArg(argc, argv, "msec_eth", sizeof(in_data), &in_data);
-		nm_ctrl.msec_tag_value = in_data;
-		//printf("Utility raw %x\n", nm_ctrl.raw_sanm_ctrl);
+		if (ret < 0)
+			printf("\nERROR: Reading FW info failed.\n");
 
-		ret = gpy2xx_msec_config_egr_sa_nm_ctrl(&phy, &nm_ctrl);
+		struct gpy211_id phyId = phy.id;
 
-		if (ret < 0) {
-			printf("\nERROR: SA Non-Match ctrl param set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sa_nm_ncp", strlen("gpy2xx_msec_config_ing_sa_nm_ncp")) == 0) {
-		struct sa_nonmatch_fca nm_fca;
-		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
+		printf("\t%40s:\t0x%x\n", "Firmware Version", ((phyId.fw_release << 15) | (phyId.fw_major << 8) | (phyId.fw_minor)));
+		printf("\t%40s:\t0x%x\n", "Firmware Major Version Number", phyId.fw_major);
+		printf("\t%40s:\t0x%x\n", "Firmware Minor Version Number", phyId.fw_minor);
+		printf("\t%40s:\t0x%x\n", "Firmware Release Indication", phyId.fw_release);
+		printf("\t%40s:\t%s\n", "The memory target used for firmware execution", (phyId.fw_memory ? ((phyId.fw_memory == 1) ? "OTP" : "FLASH") : "ROM"));
+		break;
+	}
+	case CLI_CMD_gpy2xx_soft_reset: {
+		ret = gpy2xx_soft_reset(&phy);
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		if (ret < 0)
+			printf("\nERROR: SW reset failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_poll_reset: {
+		ret = gpy2xx_poll_reset(&phy);
 
-		ret = gpy2xx_msec_config_ing_sa_nm_ncp(&phy, &nm_fca);
+		if (ret > 0)
+			printf("\nSW reset completed.\n");
+		else if (ret == 0)
+			printf("\nSW reset is pending.\n");
+		else
+			printf("\nERROR: SW reset polling failed.\n");
 
-		if (ret < 0) {
-			printf("\nERROR: SA Non-Match NCP pkt action set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sa_nm_ncp", strlen("gpy2xx_msec_config_egr_sa_nm_ncp")) == 0) {
-		struct sa_nonmatch_fca nm_fca;
-		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
+#if defined(EN_SMDIO_RW) && EN_SMDIO_RW
+		break;
+	}
+	case CLI_CMD_gpy2xx_smdio_read: {
+		u32 reg_off;
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		//cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		cli_parse(cmd, argc, argv, &reg_off);
 
-		ret = gpy2xx_msec_config_egr_sa_nm_ncp(&phy, &nm_fca);
+		ret = gpy2xx_smdio_read(&phy, reg_off);
 
 		if (ret < 0) {
-			printf("\nERROR: SA Non-Match NCP pkt action set failed.\n");
-			return -1;
+			printf("\nERROR: SMDIO read failed.\n");
+		} else {
+			printf("\nSmdio rd vale = 0x%x\n", ret);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sa_nm_cp", strlen("gpy2xx_msec_config_ing_sa_nm_cp")) == 0) {
-		struct sa_nonmatch_fca nm_fca;
-		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
+		break;
+	}
+	case CLI_CMD_gpy2xx_smdio_write: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_msec_config_ing_sa_nm_cp(&phy, &nm_fca);
+		ret = gpy2xx_smdio_write(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
-			printf("\nERROR: SA Non-Match CP pkt action set failed.\n");
-			return -1;
+			printf("\nERROR: SMDIO write failed\n");
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sa_nm_cp", strlen("gpy2xx_msec_config_egr_sa_nm_cp")) == 0) {
-		struct sa_nonmatch_fca nm_fca;
-		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		//cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_read_mmd: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		ret = gpy2xx_msec_config_egr_sa_nm_cp(&phy, &nm_fca);
+		cli_parse(cmd, argc, argv, &a);
+
+		ret = gpy2xx_read_mmd(&phy, a.devtype, a.regaddr);
 
 		if (ret < 0) {
-			printf("\nERROR: SA Non-Match CP pkt action set failed.\n");
-			return -1;
+			printf("\nERROR: MMD read failed.\n");
+		} else {
+			printf("\nMmd rd vale = 0x%x\n", ret);
+			print_regmap(GPY2XX_REGMAP_MDIO, GPY2XX_REGMAP_MDIO_ADDR(a.devtype, a.regaddr), ret);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_ing_stats_summ", strlen("gpy2xx_msec_clear_ing_stats_summ")) == 0) {
-		struct stats_summary xxx_summ;
-		memset(&xxx_summ, 0, sizeof(struct stats_summary));
+		break;
+	}
+	case CLI_CMD_gpy2xx_write_mmd: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(xxx_summ.psa_sum_word[0]), &xxx_summ.psa_sum_word[0]);
-		cnt += scanParamArg(argc, argv, "glb_summ", sizeof(xxx_summ.glb_summ_word), &xxx_summ.glb_summ_word);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_msec_clear_ing_stats_summ(&phy, &xxx_summ);
+		ret = gpy2xx_write_mmd(&phy, a.devtype, a.regaddr, a.data);
 
 		if (ret < 0) {
-			printf("\nERROR: SA stats summary clear failed.\n");
-			return -1;
+			printf("\nERROR: MMD write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_stats_summ", strlen("gpy2xx_msec_clear_egr_stats_summ")) == 0) {
-		struct stats_summary xxx_summ;
-		memset(&xxx_summ, 0, sizeof(struct stats_summary));
+		break;
+	}
+	case CLI_CMD_gpy2xx_read_status: {
+		ret = gpy2xx_read_status(&phy);
 
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(xxx_summ.psa_sum_word[0]), &xxx_summ.psa_sum_word[0]);
-		cnt += scanParamArg(argc, argv, "glb_summ", sizeof(xxx_summ.glb_summ_word), &xxx_summ.glb_summ_word);
+		if (ret < 0)
+			printf("\nERROR: Read link status failed.\n");
+		else {
+			struct gpy211_link linkConfig = phy.link;
+			char buf[256];
 
-		ret = gpy2xx_msec_clear_egr_stats_summ(&phy, &xxx_summ);
+			printf("\nPopulated link configuration parameters:\n----------------\n");
+			printf("\t%40s:\t%s\n", "Auto-Negotiation (AN) state", linkConfig.autoneg ? "Enabled" : "Disabled");
+			printf("\t%40s:\t%d\n", "Link Speed or Partner Link Speed (AN)", linkConfig.speed);
+			printf("\t%40s:\t%s\n", "Duplex (Forced) or Partner Duplex (AN)", linkConfig.duplex ? "Full" : "Half");
+			printf("\t%40s:\t%d\n", "Partner Pause (AN)", linkConfig.pause);
+			printf("\t%40s:\t%d\n", "Partner Asym-pause (AN)", linkConfig.asym_pause);
+			printf("\t%40s:\t%s\n", "Most recently read link state", linkConfig.link ? "Up" : "Down");
+			print_advert(buf, sizeof(buf), linkConfig.supported);
+			printf("\t%40s:\t0x%llx (%s)\n", "GPHY supported modes", linkConfig.supported, buf);
+			print_advert(buf, sizeof(buf), linkConfig.advertising);
+			printf("\t%40s:\t0x%llx (%s)\n", "GPHY advertising modes", linkConfig.advertising, buf);
+			print_advert(buf, sizeof(buf), linkConfig.lp_advertising);
+			printf("\t%40s:\t0x%llx (%s)\n", "Link partner advertising modes", linkConfig.lp_advertising, buf);
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_read: {
+		u32 reg_off;
+
+		cli_parse(cmd, argc, argv, &reg_off);
+
+		ret = gpy2xx_read(&phy, reg_off);
 
 		if (ret < 0) {
-			printf("\nERROR: SA stats summary clear failed.\n");
-			return -1;
+			printf("\nERROR: MDIO read failed.\n");
+		} else {
+			printf("\nMdio rd vale = 0x%x\n", ret);
+			print_regmap(GPY2XX_REGMAP_MDIO, GPY2XX_REGMAP_MDIO_ADDR(0, reg_off), ret);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_ing_psa_stats_summ", strlen("gpy2xx_msec_clear_ing_psa_stats_summ")) == 0) {
-		struct psa_summary psa_summ;
-		memset(&psa_summ, 0, sizeof(struct psa_summary));
+		break;
+	}
+	case CLI_CMD_gpy2xx_write: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(psa_summ.count_summ_psa[0]), &psa_summ.count_summ_psa[0]);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_msec_clear_ing_psa_stats_summ(&phy, &psa_summ);
+		ret = gpy2xx_write(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
-			printf("\nERROR: Per-SA stats summary set failed.\n");
-			return -1;
+			printf("\nERROR: MDIO write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_psa_stats_summ", strlen("gpy2xx_msec_get_ing_psa_stats_summ")) == 0) {
-		int i;
-		struct psa_summary psa_summ;
-		struct ing_psa_bmap counter_bmap;
-		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
+#if defined(P31G_IND_RW) && P31G_IND_RW
+		break;
+	}
+	case CLI_CMD_pm_ind_read: {
+		u32 reg_off, data_val;
+
+		cli_parse(cmd, argc, argv, &reg_off);
 
-		ret = gpy2xx_msec_get_ing_psa_stats_summ(&phy, &psa_summ);
+		ret = pm_indirect_read(&phy, reg_off, &data_val);
 
 		if (ret < 0) {
-			printf("\nERROR: Per-SA stats summary get failed.\n");
-			return -1;
+			printf("\nERROR: PM Indirect read failed.\n");
+		} else {
+			printf("\nPM rd vale = 0x%x\n", data_val);
 		}
+		break;
+	}
+	case CLI_CMD_pm_ind_write: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		printf("\nPer-SA per counter ingress statistics summary flags:\n----------------\n");
+		cli_parse(cmd, argc, argv, &a);
 
-		for (i = 0; i < MACSEC_MAX_SA_RULES; i++) {
-			printf("\nPer-SA per counter stats summary[%02d] = %8x", i, psa_summ.count_summ_psa[i]);
-			counter_bmap.raw_psa_bmap = psa_summ.count_summ_psa[i];
+		ret = pm_indirect_write(&phy, a.regaddr, a.data);
 
-			if (counter_bmap.InOctetsDecryptedValidated)
-				printf("\nInOctetsDecrypted / InOctetsValidated counter expired");
+		if (ret < 0) {
+			printf("\nERROR: PM write failed.\n");
+		}
 
-			if (counter_bmap.InPktsUncheckedHitDropReserved)
-				printf("\nInPktsUnchecked / InPktsHitDropReserved counter expired");
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_read16: {
+		u32 reg_off, data_val;
 
-			if (counter_bmap.InPktsDelayed)
-				printf("\nInPktsDelayed counter expired");
+		cli_parse(cmd, argc, argv, &reg_off);
 
-			if (counter_bmap.InPktsLate)
-				printf("\nInPktsLate counter expired");
+		ret = gpy2xx_mbox_read16(&phy, reg_off, &data_val);
 
-			if (counter_bmap.InPktsOK)
-				printf("\nInPktsOK counter expired");
+		if (ret < 0) {
+			printf("\nERROR: PM MBOX read failed.\n");
+		} else {
+			printf("\nMBOX rd vale = 0x%x\n", data_val);
+			print_regmap(gpy2xx_regmap_pdi(&phy), reg_off, data_val);
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_write16: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-			if (counter_bmap.InPktsInvalid)
-				printf("\nInPktsInvalid counter expired");
+		cli_parse(cmd, argc, argv, &a);
 
-			if (counter_bmap.InPktsNotValid)
-				printf("\nInPktsNotValid counter expired");
+		ret = gpy2xx_mbox_write16(&phy, a.regaddr, a.data);
 
-			if (counter_bmap.InPktsNotUsingSA)
-				printf("\nInPktsNotUsingSA counter expired");
+		if (ret < 0) {
+			printf("\nERROR: MBOX write failed.\n");
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_read32: {
+		u32 reg_off, data_val;
 
-			if (counter_bmap.InPktsUnusedSA)
-				printf("\nInPktsUnusedSA counter expired");
+		cli_parse(cmd, argc, argv, &reg_off);
 
-			if (counter_bmap.InPktsUntaggedHit)
-				printf("\nInPktsUntaggedHit counter expired");
+		ret = gpy2xx_mbox_read32(&phy, reg_off, &data_val);
 
-			if (psa_summ.psa_type == PSA_SUMM_GET_GIVEN)
-				break;
+		if (ret < 0) {
+			printf("\nERROR: PM MBOX read failed.\n");
+		} else {
+			printf("\nMBOX rd vale = 0x%x\n", data_val);
+			print_regmap(gpy2xx_regmap_pdi(&phy), reg_off, data_val);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_psa_stats_summ", strlen("gpy2xx_msec_clear_egr_psa_stats_summ")) == 0) {
-		struct psa_summary psa_summ;
-		memset(&psa_summ, 0, sizeof(struct psa_summary));
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_write32: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(psa_summ.count_summ_psa[0]), &psa_summ.count_summ_psa[0]);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_msec_clear_egr_psa_stats_summ(&phy, &psa_summ);
+		ret = gpy2xx_mbox_write32(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
-			printf("\nERROR: Per-SA stats summary set failed.\n");
-			return -1;
+			printf("\nERROR: MBOX write failed.\n");
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_reg_decode: {
+		enum gpy2xx_regmap_space space = GPY2XX_REGMAP_MDIO;
+		const struct gpy2xx_regmap_reg *reg = NULL;
+		struct cli_reg_decode_args a;
+		u32 reg_off, data_val;
+		u32 seen;
+
+		memset(&a, 0, sizeof(struct cli_reg_decode_args));
+		seen = cli_parse(cmd, argc, argv, &a);
+
+		if (a.space != NULL && strcasecmp(a.space, "pdi") == 0)
+			space = gpy2xx_regmap_pdi(&phy);
+		else if (a.space != NULL && strcasecmp(a.space, "p31g") == 0)
+			space = GPY2XX_REGMAP_PDI_P31G;
+		else if (a.space != NULL && strcasecmp(a.space, "p34x") == 0)
+			space = GPY2XX_REGMAP_PDI_P34X;
+		else if (a.space == NULL && a.file != NULL)
+			space = gpy2xx_regmap_pdi(&phy);
+		else if (a.space != NULL && strcasecmp(a.space, "mdio") != 0) {
+			printf("\nERROR: space must be mdio, pdi, p31g or p34x.\n");
+			ret = -1;
+			break;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_psa_stats_summ", strlen("gpy2xx_msec_get_egr_psa_stats_summ")) == 0) {
-		int i;
-		struct psa_summary psa_summ;
-		struct egr_psa_bmap counter_bmap;
-		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
+		if (a.file != NULL) {
+			ret = regmap_decode_file(space, a.file);
+			break;
+		}
 
-		ret = gpy2xx_msec_get_egr_psa_stats_summ(&phy, &psa_summ);
+		if (a.reg != NULL) {
+			reg = gpy2xx_regmap_find(space, a.reg);
+			if (reg == NULL) {
+				printf("\nERROR: register %s not found.\n", a.reg);
+				ret = -1;
+				break;
+			}
 
-		if (ret < 0) {
-			printf("\nERROR: Per-SA stats summary get failed.\n");
-			return -1;
+			reg_off = reg->addr;
+		} else if (cli_given(cmd, seen, "regaddr")) {
+			reg_off = a.regaddr;
+		} else {
+			printf("\nERROR: regaddr, reg or file is required.\n");
+			ret = -1;
+			break;
 		}
 
-		printf("\nPer-SA per counter egress statistics summary flags:\n----------------\n");
-
-		for (i = 0; i < MACSEC_MAX_SA_RULES; i++) {
-			printf("\nPer-SA per counter stats summary[%02d] = %8x", i, psa_summ.count_summ_psa[i]);
-			counter_bmap.raw_psa_bmap = psa_summ.count_summ_psa[i];
+		data_val = a.data;
 
-			if (counter_bmap.OutOctetsEncryptedProtected)
-				printf("\nOutOctetsEncrypted / OutOctetsProtected counter expired");
+		if (!cli_given(cmd, seen, "data")) {
+			if (reg == NULL)
+				reg = gpy2xx_regmap_lookup(space, reg_off);
 
-			if (counter_bmap.OutPktsEncryptedProtectedHitDropReserved)
-				printf("\nOutPktsEncrypted / OutPktsProtected / OutPktsHitDropReserved counter expired");
+			if (space == GPY2XX_REGMAP_MDIO) {
+				if (reg_off >> 21)
+					ret = gpy2xx_read_mmd(&phy, reg_off >> 21, (reg_off >> 1) & 0xFFFF);
+				else
+					ret = gpy2xx_read(&phy, (reg_off >> 1) & 0x1F);
 
-			if (counter_bmap.OutPktsTooLong)
-				printf("\nOutPktsTooLong counter expired");
+				data_val = ret;
+			} else if (reg != NULL && reg->width32) {
+				ret = gpy2xx_mbox_read32(&phy, reg_off, &data_val);
+			} else {
+				ret = gpy2xx_mbox_read16(&phy, reg_off, &data_val);
+			}
 
-			if (psa_summ.psa_type == PSA_SUMM_GET_GIVEN)
+			if (ret < 0) {
+				printf("\nERROR: register read failed.\n");
 				break;
+			}
+
+			ret = 0;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_cp_rule", strlen("gpy2xx_msec_config_ing_cp_rule")) == 0) {
-		struct cp_class_param cpc_rule;
-		memset(&cpc_rule, 0, sizeof(struct cp_class_param));
 
-		cnt += scanParamArg(argc, argv, "cpc_index", sizeof(cpc_rule.cpc_index), &cpc_rule.cpc_index);
-		cnt += scanParamArg(argc, argv, "entry_type", sizeof(cpc_rule.cpc_type), &cpc_rule.cpc_type);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", cpc_rule.mac_da);
-		//cnt += scanMAC_Arg(argc, argv, "da_start", cpc_rule.mac_da_start);
-		cnt += scanMAC_Arg(argc, argv, "da_end", cpc_rule.mac_da_end);
-		//cnt += scanMAC_Arg(argc, argv, "da_const44", cpc_rule.mac_da_const44);
-		//cnt += scanMAC_Arg(argc, argv, "da_const48", cpc_rule.mac_da_const48);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(cpc_rule.ether_type), &cpc_rule.ether_type);
-		cnt += scanParamArg(argc, argv, "cpm_mode", sizeof(cpc_rule.cpm_mode), &cpc_rule.cpm_mode);
-		cnt += scanParamArg(argc, argv, "cpm_en", sizeof(cpc_rule.cpm_enable), &cpc_rule.cpm_enable);
+		printf("\n0x%08x = 0x%x\n", reg_off, data_val);
+		print_regmap(space, reg_off, data_val);
+		break;
+	}
+	case CLI_CMD_gpy2xx_xpcs_read16: {
+		u32 reg_off, data_val;
+
+		cli_parse(cmd, argc, argv, &reg_off);
 
-		ret = gpy2xx_msec_config_ing_cp_rule(&phy, &cpc_rule);
+		ret = PHY_XPCS_HWRD(&phy, reg_off, &data_val);
 
 		if (ret < 0) {
-			printf("\nERROR: CPC rule set failed.\n");
-			return -1;
+			printf("\nERROR: PHY XPCS read failed.\n");
+		} else {
+			printf("\nPHY XPCS rd vale = 0x%x\n", data_val);
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_cp_rule", strlen("gpy2xx_msec_config_egr_cp_rule")) == 0) {
-		struct cp_class_param cpc_rule;
-		memset(&cpc_rule, 0, sizeof(struct cp_class_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_xpcs_write16: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "cpc_index", sizeof(cpc_rule.cpc_index), &cpc_rule.cpc_index);
-		cnt += scanParamArg(argc, argv, "entry_type", sizeof(cpc_rule.cpc_type), &cpc_rule.cpc_type);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", cpc_rule.mac_da);
-		//cnt += scanMAC_Arg(argc, argv, "da_start", cpc_rule.mac_da_start);
-		cnt += scanMAC_Arg(argc, argv, "da_end", cpc_rule.mac_da_end);
-		//cnt += scanMAC_Arg(argc, argv, "da_const44", cpc_rule.mac_da_const44);
-		//cnt += scanMAC_Arg(argc, argv, "da_const48", cpc_rule.mac_da_const48);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(cpc_rule.ether_type), &cpc_rule.ether_type);
-		cnt += scanParamArg(argc, argv, "cpm_mode", sizeof(cpc_rule.cpm_mode), &cpc_rule.cpm_mode);
-		cnt += scanParamArg(argc, argv, "cpm_en", sizeof(cpc_rule.cpm_enable), &cpc_rule.cpm_enable);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_msec_config_egr_cp_rule(&phy, &cpc_rule);
+		ret = PHY_XPCS_HWWR(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
-			printf("\nERROR: CPC rule set failed.\n");
-			return -1;
+			printf("\nERROR: PHY XPCS write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_sa_pn_thr_summ", strlen("gpy2xx_msec_clear_sa_pn_thr_summ")) == 0) {
-		struct sa_pn_thr_summ xxx_summ;
-		memset(&xxx_summ, 0, sizeof(struct sa_pn_thr_summ));
+		break;
+	}
+	case CLI_CMD_gpy2xx_config_advert: {
+		char buf[256];
+		u32 seen;
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "pnthr_summ0", sizeof(xxx_summ.pnthr_sum_word[0]), &xxx_summ.pnthr_sum_word[0]);
+		seen = cli_parse(cmd, argc, argv, &phy);
 
-		ret = gpy2xx_msec_clear_sa_pn_thr_summ(&phy, &xxx_summ);
+		if (!cli_given(cmd, seen, "advertising"))
+			phy.link.advertising = phy.link.supported;
 
-		if (ret < 0) {
-			printf("\nERROR: SA PN Threshold summary clear failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_sa_pn_thr_summ", strlen("gpy2xx_msec_get_sa_pn_thr_summ")) == 0) {
-		int i;
-		struct sa_pn_thr_summ xxx_summ;
-		memset(&xxx_summ, 0, sizeof(struct sa_pn_thr_summ));
+		print_advert(buf, sizeof(buf), phy.link.supported);
+		printf("\t%24s:\t0x%llx (%s)\n", "GPHY supported modes", phy.link.supported, buf);
+		print_advert(buf, sizeof(buf), phy.link.advertising);
+		printf("\t%24s:\t0x%llx (%s)\n", "GPHY advertising modes", phy.link.advertising, buf);
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		ret = gpy2xx_msec_get_sa_pn_thr_summ(&phy, &xxx_summ);
+		ret = gpy2xx_config_advert(&phy);
 
-		if (ret < 0) {
-			printf("\nERROR: SA PN Threshold summary get failed.\n");
-			return -1;
-		}
+		if (ret < 0)
+			printf("\nERROR: Setting Auto-Negotiation's advertisement conf failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_setup_forced: {
+		cli_parse(cmd, argc, argv, &phy);
 
-		printf("\nSA PN Threshold summary flags:\n----------------\n");
+		ret = gpy2xx_setup_forced(&phy);
 
-		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nPN threshold summary[%02d] = %8x", i, xxx_summ.pnthr_sum_word[i]);
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_sa_exp_summ", strlen("gpy2xx_msec_clear_egr_sa_exp_summ")) == 0) {
-		struct sa_exp_summ xxx_summ;
-		memset(&xxx_summ, 0, sizeof(struct sa_exp_summ));
+		if (ret < 0)
+			printf("\nERROR: Setting forceful link speed failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_restart_aneg: {
+		ret = gpy2xx_restart_aneg(&phy);
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "saexp_summ0", sizeof(xxx_summ.sa_expsum_word[0]), &xxx_summ.sa_expsum_word[0]);
+		if (ret < 0)
+			printf("\nERROR: Restarting Auto-Negotiation failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_config_aneg: {
+		char buf[256];
+		u32 seen;
 
-		ret = gpy2xx_msec_clear_egr_sa_exp_summ(&phy, &xxx_summ);
+		seen = cli_parse(cmd, argc, argv, &phy);
 
-		if (ret < 0) {
-			printf("\nERROR: SA expired summary clear failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_sa_exp_summ", strlen("gpy2xx_msec_get_egr_sa_exp_summ")) == 0) {
-		int i;
-		struct sa_exp_summ xxx_summ;
-		memset(&xxx_summ, 0, sizeof(struct sa_exp_summ));
+		if (!cli_given(cmd, seen, "advertising"))
+			phy.link.advertising = phy.link.supported;
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		ret = gpy2xx_msec_get_egr_sa_exp_summ(&phy, &xxx_summ);
+		print_advert(buf, sizeof(buf), phy.link.supported);
+		printf("\t%24s:\t0x%llx (%s)\n", "GPHY supported modes", phy.link.supported, buf);
+		print_advert(buf, sizeof(buf), phy.link.advertising);
+		printf("\t%24s:\t0x%llx (%s)\n", "GPHY advertising modes", phy.link.advertising, buf);
 
-		if (ret < 0) {
-			printf("\nERROR: SA expired summary get failed.\n");
-			return -1;
-		}
+		ret = gpy2xx_config_aneg(&phy);
 
-		printf("\nSA PN Threshold summary flags:\n----------------\n");
+		if (ret < 0)
+			printf("\nERROR: Configuring Auto-Negotiation failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_aneg_done: {
+		ret = gpy2xx_aneg_done(&phy);
 
-		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
-			printf("\nPN threshold summary[%02d] = %8x", i, xxx_summ.sa_expsum_word[i]);
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_ing_cc_int_stat", strlen("gpy2xx_msec_clear_ing_cc_int_stat")) == 0) {
-		struct crypto_core_stat cc_stat;
-		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
+		if (ret == 0)
+			printf("\nAuto-Negotiation pending.\n");
+		else if (ret == 1)
+			printf("\nAuto-Negotiation completed.\n");
+		else
+			printf("\nERROR: Auto-Negotiation polling failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_update_link: {
+		ret = gpy2xx_update_link(&phy);
 
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-		cnt += scanParamArg(argc, argv, "ctx_stat", sizeof(cc_stat.ctx_stat.raw_ctx_stat), &cc_stat.ctx_stat.raw_ctx_stat);
-#endif
-		cnt += scanParamArg(argc, argv, "int_stat", sizeof(cc_stat.int_stat.raw_int_stat), &cc_stat.int_stat.raw_int_stat);
+		if (ret < 0)
+			printf("\nERROR: Updating link status failed.\n");
 
-		ret = gpy2xx_msec_clear_ing_cc_int_stat(&phy, &cc_stat);
+		if (phy.link.link == 0)
+			printf("\nLink Down.\n");
+		else
+			printf("\nLink Up.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_cfg: {
+		struct gpy211_gpio gpioCfg;
+		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		if (ret < 0) {
-			printf("\nERROR: Crpypto cores interrupt status clear failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_cc_int_stat", strlen("gpy2xx_msec_get_ing_cc_int_stat")) == 0) {
-		struct crypto_core_stat cc_stat;
-		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
-		ret = gpy2xx_msec_get_ing_cc_int_stat(&phy, &cc_stat);
+		ret = gpy2xx_gpio_cfg(&phy, &gpioCfg);
+
+		if (ret < 0)
+			printf("\nERROR: Set GPIO configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_get: {
+		struct gpy211_gpio gpioCfg;
+		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
+
+		cli_parse(cmd, argc, argv, &gpioCfg);
+
+		ret = gpy2xx_gpio_get(&phy, &gpioCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Crpypto cores interrupt status get failed.\n");
-			return -1;
+			printf("\nERROR: Get GPIO configuration failed.\n");
+			return ret;
 		}
 
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-		printf("\nCC context status (raw) = %8x", cc_stat.ctx_stat.raw_ctx_stat);
-#endif
-		printf("\nCC interrup status (raw) = %8x", cc_stat.int_stat.raw_int_stat);
-
-		if (cc_stat.int_stat.input_error)
-			printf("\nInput data does not properly receive all data (e2)");
+		printf("\t%60s:\t0x%x\n", "gpioDirection: 0 = In, 1 = Out", gpioCfg.flags & 0x1);
 
-		if (cc_stat.int_stat.processing_error)
-			printf("\nAn error occurred while processing the frame or parsing the token. Combination of errors e0, e1, e3 and e4");
+		if (gpioCfg.flags & 0x1)
+			printf("\t%60s:\t0x%x\n", "gpioOutLevel: 0 = Low, 1 = High", (gpioCfg.flags >> 1) & 0x1);
+		else
+			printf("\t%60s:\t0x%x\n", "gpioInLevel: 0 = Low, 1 = High", (gpioCfg.flags >> 2) & 0x1);
 
-		if (cc_stat.int_stat.context_error)
-			printf("\nAn invalid context has been fetched. Combination of errors e5 and e6");
+		printf("\t%60s:\t0x%x\n", "gpioOpenDrain: 0 = OD, 1 = PP", (gpioCfg.flags >> 3) & 0x1);
+		printf("\t%60s:\t0x%x\n", "gpioPuPd: 2 = Pull-Up, 3 = Pull-Down", (gpioCfg.flags >> 8) & 0x3);
+		printf("\t%60s:\t0x%x\n", "gpioAltFunc: 0 = , 1 = , 2 = , 3 =", (gpioCfg.flags >> 10) & 0x3);
+		printf("\t%60s:\t0x%x\n", "gpioPadStrength: 0 = 2mA, 1 = 4mA, 2 = 8mA, 3 = 12mA", (gpioCfg.flags >> 12) & 0x3);
+		printf("\t%60s:\t0x%x\n", "gpioSlewRate: 0 = Slow, 3 = Fast", (gpioCfg.flags >> 15) & 0x1);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_output: {
+		struct gpy211_gpio gpioCfg;
+		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		if (cc_stat.int_stat.seq_threshold)
-			printf("\nIf a sequence number exceeds the programmed sequence number threshold (refer to 0) due to an outbound sequence number increment this interrupt is triggered (e8).");
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
-		if (cc_stat.int_stat.seq_rollover)
-			printf("\nIf a sequence number roll-over (increment from maximum to zero) due to an outbound sequence number increment this interrupt is triggered (e10 egress only)");
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_clear_egr_cc_int_stat", strlen("gpy2xx_msec_clear_egr_cc_int_stat")) == 0) {
-		struct crypto_core_stat cc_stat;
-		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-		cnt += scanParamArg(argc, argv, "ctx_stat", sizeof(cc_stat.ctx_stat.raw_ctx_stat), &cc_stat.ctx_stat.raw_ctx_stat);
-#endif
-		cnt += scanParamArg(argc, argv, "int_stat", sizeof(cc_stat.int_stat.raw_int_stat), &cc_stat.int_stat.raw_int_stat);
+		ret = gpy2xx_gpio_output(&phy, &gpioCfg);
 
-		ret = gpy2xx_msec_clear_egr_cc_int_stat(&phy, &cc_stat);
+		if (ret < 0)
+			printf("\nERROR: Set GPIO pin as output failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_input: {
+		struct gpy211_gpio gpioCfg;
+		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		if (ret < 0) {
-			printf("\nERROR: Crpypto cores interrupt status clear failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_cc_int_stat", strlen("gpy2xx_msec_get_egr_cc_int_stat")) == 0) {
-		struct crypto_core_stat cc_stat;
-		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
-		ret = gpy2xx_msec_get_egr_cc_int_stat(&phy, &cc_stat);
+		ret = gpy2xx_gpio_input(&phy, &gpioCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Crpypto cores interrupt status get failed.\n");
-			return -1;
+			printf("\nERROR: Get GPIO pin input failed.\n");
+			return ret;
 		}
 
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-		printf("\nCC context status (raw) = %8x", cc_stat.ctx_stat.raw_ctx_stat);
-#endif
-		printf("\nCC interrup status (raw) = %8x", cc_stat.int_stat.raw_int_stat);
-
-		if (cc_stat.int_stat.input_error)
-			printf("\nInput data does not properly receive all data (e2)");
+		printf("\t%40s:\t0x%x\n", "gpioFlags", gpioCfg.flags);
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_br_cfg: {
+		struct gpy211_led_brlvl_cfg brightnessCfg;
+		memset(&brightnessCfg, 0, sizeof(struct gpy211_led_brlvl_cfg));
 
-		if (cc_stat.int_stat.processing_error)
-			printf("\nAn error occurred while processing the frame or parsing the token. Combination of errors e0, e1, e3 and e4");
+		ret = gpy2xx_led_br_get(&phy, &brightnessCfg);
 
-		if (cc_stat.int_stat.context_error)
-			printf("\nAn invalid context has been fetched. Combination of errors e5 and e6");
+		if (ret < 0) {
+			printf("\nERROR: Get LED Brigtness configuration failed.\n");
+			return ret;
+		}
 
-		if (cc_stat.int_stat.seq_threshold)
-			printf("\nIf a sequence number exceeds the programmed sequence number threshold (refer to 0) due to an outbound sequence number increment this interrupt is triggered (e8).");
+		cli_parse(cmd, argc, argv, &brightnessCfg);
 
-		if (cc_stat.int_stat.seq_rollover)
-			printf("\nIf a sequence number roll-over (increment from maximum to zero) due to an outbound sequence number increment this interrupt is triggered (e10 egress only)");
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_sn_thresh", strlen("gpy2xx_msec_config_ing_sn_thresh")) == 0) {
-		struct seq_num_thr sn_thr;
-		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
+		ret = gpy2xx_led_br_cfg(&phy, &brightnessCfg);
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
-		cnt += scanParamArg(argc, argv, "sn_thr", 64, &sn_thr.sn_threshold);
+		if (ret < 0)
+			printf("\nERROR: Set LED Brigtness configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_br_get: {
+		struct gpy211_led_brlvl_cfg brightnessCfg;
+		memset(&brightnessCfg, 0, sizeof(struct gpy211_led_brlvl_cfg));
 
-		ret = gpy2xx_msec_config_ing_sn_thresh(&phy, &sn_thr);
+		printf("calling gpy2xx_led_br_get inside comapre\n");
+		ret = gpy2xx_led_br_get(&phy, &brightnessCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: SN Threshold set failed.\n");
-			return -1;
+			printf("\nERROR: Get LED Brigtness configuration failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_sn_thresh", strlen("gpy2xx_msec_get_ing_sn_thresh")) == 0) {
-		struct seq_num_thr sn_thr;
-		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
 
-		ret = gpy2xx_msec_get_ing_sn_thresh(&phy, &sn_thr);
+		printf("\t%40s:\t0x%x\n", "brightMode", brightnessCfg.mode);
+		printf("\t%40s:\t0x%x\n", "brightLvlMin", brightnessCfg.lvl_min);
+		printf("\t%40s:\t0x%x\n", "brightLvlMax", brightnessCfg.lvl_max);
+		printf("\t%40s:\t0x%x\n", "swEdgeDetect", brightnessCfg.sw_edge);
+#if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_top_cfg: {
+		struct gpy211_led_gcfg genLedCfg;
+		memset(&genLedCfg, 0, sizeof(struct gpy211_led_gcfg));
+
+		ret = gpy2xx_led_top_get(&phy, &genLedCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: SN Threshold set failed.\n");
-			return -1;
+			printf("\nERROR: Get LED's General configuration failed.\n");
+			return ret;
 		}
 
-		printf("\nSN threshold = %llx", sn_thr.sn_threshold);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_sn_thresh", strlen("gpy2xx_msec_config_egr_sn_thresh")) == 0) {
-		struct seq_num_thr sn_thr;
-		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
+		cli_parse(cmd, argc, argv, &genLedCfg);
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
-		cnt += scanParamArg(argc, argv, "sn_thr", 64, &sn_thr.sn_threshold);
+		ret = gpy2xx_led_top_cfg(&phy, &genLedCfg);
 
-		ret = gpy2xx_msec_config_egr_sn_thresh(&phy, &sn_thr);
+		if (ret < 0)
+			printf("\nERROR: Set LED's General configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_top_get: {
+		struct gpy211_led_gcfg genLedCfg;
+		memset(&genLedCfg, 0, sizeof(struct gpy211_led_gcfg));
+
+		ret = gpy2xx_led_top_get(&phy, &genLedCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: SN Threshold set failed.\n");
-			return -1;
+			printf("\nERROR: Get LED's General configuration failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_sn_thresh", strlen("gpy2xx_msec_get_egr_sn_thresh")) == 0) {
-		struct seq_num_thr sn_thr;
-		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
+		printf("\t%40s:\t0x%x\n", "complexScan", genLedCfg.complex_scan);
+		printf("\t%40s:\t0x%x\n", "complexBlink", genLedCfg.complex_blink);
+		printf("\t%40s:\t0x%x\n", "inverseScan", genLedCfg.inverse_scan);
+		printf("\t%40s:\t0x%x\n", "fastBlinkFreq", genLedCfg.fast_blink_freq);
+		printf("\t%40s:\t0x%x\n", "slowBlinkFreq", genLedCfg.slow_blink_freq);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_if_cfg: {
+		struct gpy211_led_cfg genIfCfg;
+		memset(&genIfCfg, 0, sizeof(struct gpy211_led_cfg));
+
+		/* ledId selects the LED, the other parameters update its configuration */
+		cli_parse(cmd, argc, argv, &genIfCfg);
 
-		ret = gpy2xx_msec_get_egr_sn_thresh(&phy, &sn_thr);
+		ret = gpy2xx_led_if_get(&phy, &genIfCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: SN Threshold set failed.\n");
-			return -1;
+			printf("\nERROR: Get LED's IF configuration failed.\n");
+			return ret;
 		}
 
-		printf("\nSN threshold = %llx", sn_thr.sn_threshold);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_ing_aic_csr", strlen("gpy2xx_msec_config_ing_aic_csr")) == 0) {
-		struct aic_control_stat aic_csr;
-		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
+		cli_parse(cmd, argc, argv, &genIfCfg);
 
-		cnt += scanParamArg(argc, argv, "enable_ctrl", sizeof(aic_csr.enable_ctrl.raw_aic_bits), &aic_csr.enable_ctrl.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "ack", sizeof(aic_csr.ack.raw_aic_bits), &aic_csr.ack.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_set", sizeof(aic_csr.enable_set.raw_aic_bits), &aic_csr.enable_set.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_clr", sizeof(aic_csr.enable_clr.raw_aic_bits), &aic_csr.enable_clr.raw_aic_bits);
+		ret = gpy2xx_led_if_cfg(&phy, &genIfCfg);
 
-		ret = gpy2xx_msec_config_ing_aic_csr(&phy, &aic_csr);
+		if (ret < 0)
+			printf("\nERROR: Set LED's IF configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_if_get: {
+		struct gpy211_led_cfg genIfCfg;
+		memset(&genIfCfg, 0, sizeof(struct gpy211_led_cfg));
 
-		if (ret < 0) {
-			printf("\nERROR:AIC's CSR set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_aic_csr", strlen("gpy2xx_msec_get_ing_aic_csr")) == 0) {
-		struct aic_control_stat aic_csr;
-		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
+		cli_parse(cmd, argc, argv, &genIfCfg);
 
-		ret = gpy2xx_msec_get_ing_aic_csr(&phy, &aic_csr);
+		ret = gpy2xx_led_if_get(&phy, &genIfCfg);
 
 		if (ret < 0) {
-			printf("\nERROR:AIC's CSR get failed.\n");
-			return -1;
+			printf("\nERROR: Get LED's IF configuration failed.\n");
+			return ret;
 		}
 
-		printf("\n            Interrupt bit assignments in Advanced Interrupt Controller");
-		printf("\n------------------------------------------------------------------------------------");
-		printf("\n| Bit | Interrupt Name |                      Description                          |");
-		printf("\n------------------------------------------------------------------------------------");
-		printf("\n| [0] | drop_class     | pkt drop pulse from classification logic                  |");
-		printf("\n| [1] | drop_pp        | pkt drop pulse from post-processor logic                  |");
-		printf("\n| [2] | drop_mtu       | pkt drop pulse from MTU checking logic                    |");
-		printf("\n| [3] | eng_irq        | interrupt pulse from EIP-62 MACsec crypto-engine core     |");
-		printf("\n| [4] | stat_sa_thr    | interrupt pulse from statistics module (SA statistics)    |");
-		printf("\n| [5] | stat_global_thr| interrupt pulse from statistics module (global statistics)|");
-		printf("\n| [6] | stat_vlan_thr  | interrupt pulse from statistics module (VLAN statistics)  |");
-		printf("\n| [7] | drop_cc packet | (-i)pkt drop pulse from consistency checking logic        |");
-		printf("\n| [8] | sa_pn_thr      | (-e)pulse from post processor                             |");
-		printf("\n| [9] | sa_expired     | (-e)pulse from classifier                                 |");
-		printf("\n------------------------------------------------------------------------------------");
-
-		printf("\nIndividual 'type (as below)' bits per interrupt input:");
-		printf("\n                                        Type Control = %8x (0b = level detect, 1b = edge detect)", aic_csr.type_ctrl.raw_aic_bits);
-		printf("\n                                    Polarity Control = %8x (0b = low level or falling edge, 1b = high level or rising edge)", aic_csr.pol_ctrl.raw_aic_bits);
-		printf("\n   Raw Interrupt Pending Status (i.e before masking) = %8x (0b = inactive, 1b = pending)", aic_csr.raw_stat.raw_aic_bits);
-		printf("\n Masked Interrupt Pending Status (i.e after masking) = %8x (0b = inactive, 1b = pending)", aic_csr.enabled_stat.raw_aic_bits);
-		printf("\n                            Interrupt Enable Control = %8x (0b = disabled, 1b = enabled)", aic_csr.enable_ctrl.raw_aic_bits);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_config_egr_aic_csr", strlen("gpy2xx_msec_config_egr_aic_csr")) == 0) {
-		struct aic_control_stat aic_csr;
-		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
+		printf("\t%40s:\t0x%x\n", "ledId", genIfCfg.id);
+		printf("\t%40s:\t0x%x\n", "colorMode", genIfCfg.color_mode);
+		printf("\t%40s:\t0x%x\n", "slowBlinkSrc", genIfCfg.slow_blink_src);
+		printf("\t%40s:\t0x%x\n", "fastBlinkSrc", genIfCfg.fast_blink_src);
+		printf("\t%40s:\t0x%x\n", "constantlyOn", genIfCfg.const_on);
+		printf("\t%40s:\t0x%x\n", "pulseFlags", genIfCfg.pulse);
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+		break;
+	}
+	case CLI_CMD_gpy2xx_topin_cfg: {
+		struct gpy211_extin intTopCfg;
+		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
 
-		cnt += scanParamArg(argc, argv, "enable_ctrl", sizeof(aic_csr.enable_ctrl.raw_aic_bits), &aic_csr.enable_ctrl.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "ack", sizeof(aic_csr.ack.raw_aic_bits), &aic_csr.ack.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_set", sizeof(aic_csr.enable_set.raw_aic_bits), &aic_csr.enable_set.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_clr", sizeof(aic_csr.enable_clr.raw_aic_bits), &aic_csr.enable_clr.raw_aic_bits);
+		/* intId selects the interrupt, the other parameters update its configuration */
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
-		ret = gpy2xx_msec_config_egr_aic_csr(&phy, &aic_csr);
+		ret = gpy2xx_topin_get(&phy, &intTopCfg);
 
 		if (ret < 0) {
-			printf("\nERROR:AIC's CSR set failed.\n");
-			return -1;
+			printf("\nERROR: Get Global/Top Interrupt global/top configuration failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_aic_csr", strlen("gpy2xx_msec_get_egr_aic_csr")) == 0) {
-		struct aic_control_stat aic_csr;
-		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
-		ret = gpy2xx_msec_get_egr_aic_csr(&phy, &aic_csr);
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
-		if (ret < 0) {
-			printf("\nERROR:AIC's CSR get failed.\n");
-			return -1;
-		}
+		ret = gpy2xx_topin_cfg(&phy, &intTopCfg);
 
-		printf("\n            Interrupt bit assignments in Advanced Interrupt Controller");
-		printf("\n------------------------------------------------------------------------------------");
-		printf("\n| Bit | Interrupt Name |                      Description                          |");
-		printf("\n------------------------------------------------------------------------------------");
-		printf("\n| [0] | drop_class     | pkt drop pulse from classification logic                  |");
-		printf("\n| [1] | drop_pp        | pkt drop pulse from post-processor logic                  |");
-		printf("\n| [2] | drop_mtu       | pkt drop pulse from MTU checking logic                    |");
-		printf("\n| [3] | eng_irq        | interrupt pulse from EIP-62 MACsec crypto-engine core     |");
-		printf("\n| [4] | stat_sa_thr    | interrupt pulse from statistics module (SA statistics)    |");
-		printf("\n| [5] | stat_global_thr| interrupt pulse from statistics module (global statistics)|");
-		printf("\n| [6] | stat_vlan_thr  | interrupt pulse from statistics module (VLAN statistics)  |");
-		printf("\n| [7] | drop_cc packet | (-i)pkt drop pulse from consistency checking logic        |");
-		printf("\n| [8] | sa_pn_thr      | (-e)pulse from post processor                             |");
-		printf("\n| [9] | sa_expired     | (-e)pulse from classifier                                 |");
-		printf("\n------------------------------------------------------------------------------------");
+		if (ret < 0)
+			printf("\nERROR: Set Global/Top Interrupt configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_topin_get: {
+		struct gpy211_extin intTopCfg;
+		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
 
-		printf("\nIndividual 'type (as below)' bits per interrupt input:");
-		printf("\n                                        Type Control = %8x (0b = level detect, 1b = edge detect)", aic_csr.type_ctrl.raw_aic_bits);
-		printf("\n                                    Polarity Control = %8x (0b = low level or falling edge, 1b = high level or rising edge)", aic_csr.pol_ctrl.raw_aic_bits);
-		printf("\n   Raw Interrupt Pending Status (i.e before masking) = %8x (0b = inactive, 1b = pending)", aic_csr.raw_stat.raw_aic_bits);
-		printf("\n Masked Interrupt Pending Status (i.e after masking) = %8x (0b = inactive, 1b = pending)", aic_csr.enabled_stat.raw_aic_bits);
-		printf("\n                            Interrupt Enable Control = %8x (0b = disabled, 1b = enabled)", aic_csr.enable_ctrl.raw_aic_bits);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_ing_cap", strlen("gpy2xx_msec_get_ing_cap")) == 0) {
-		struct eip160_hwcap hw_cap;
-		memset(&hw_cap, 0, sizeof(struct eip160_hwcap));
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
-		ret = gpy2xx_msec_get_ing_cap(&phy, &hw_cap);
+		ret = gpy2xx_topin_get(&phy, &intTopCfg);
 
 		if (ret < 0) {
-			printf("\nERROR:Ing HW cap get failed.\n");
-			return -1;
+			printf("\nERROR: Get Global/Top Interrupt global/top configuration failed.\n");
+			return ret;
 		}
 
-		printf("\nEIP num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
-		       hw_cap.eip_ver.eip_nr, hw_cap.eip_ver.eip_nr_complement, hw_cap.eip_ver.patch_level, hw_cap.eip_ver.minor_version, hw_cap.eip_ver.major_version);
-		printf("\nSA nums %x CCs %x, match-sci %x",
-		       hw_cap.eip_cfg.nr_of_sas, hw_cap.eip_cfg.consist_checks, hw_cap.eip_cfg.match_sci);
-		//printf("\nRaw CFG2 %x ", hw_cap.eip_cfg2.raw_eip160_cfg2);
-		printf("\nCounters:- SA %x, VL %x, GL %x, Saturate %x, Auto reset %x, SA octet %x, VL octet %x, GL octet %x, IG only %x, EG only %x, Tag bypass %x\n",
-		       hw_cap.eip_cfg2.sa_counters, hw_cap.eip_cfg2.vl_counters, hw_cap.eip_cfg2.global_counters, hw_cap.eip_cfg2.saturate_cntrs,
-		       hw_cap.eip_cfg2.auto_cntr_reset, hw_cap.eip_cfg2.sa_octet_ctrs, hw_cap.eip_cfg2.vl_octet_ctrs, hw_cap.eip_cfg2.glob_octet_ctrs,
-		       hw_cap.eip_cfg2.ingress_only, hw_cap.eip_cfg2.egress_only, hw_cap.eip_cfg2.tag_bypass);
-		printf("\nAIC's number of interrupt inputs %x ", hw_cap.aic_opt.number_of_inputs);
-		printf("\nAIC num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
-		       hw_cap.aic_ver.eip_nr, hw_cap.aic_ver.eip_nr_complement, hw_cap.aic_ver.patch_level, hw_cap.aic_ver.minor_version, hw_cap.aic_ver.major_version);
-	} else if (xstrncasecmp(argv[3], "gpy2xx_msec_get_egr_cap", strlen("gpy2xx_msec_get_egr_cap")) == 0) {
-		struct eip160_hwcap hw_cap;
-		memset(&hw_cap, 0, sizeof(struct eip160_hwcap));
+		printf("\t%40s:\t0x%x\n", "intId", intTopCfg.id);
+		printf("\t%40s:\t0x%x\n", "gpioFlags", intTopCfg.gpio_flags);
+		printf("\t%40s:\t0x%x\n", "ipChar", intTopCfg.ip_char);
+		printf("\t%40s:\t0x%x\n", "intMod0", intTopCfg.im0);
+		printf("\t%40s:\t0x%x\n", "intMod1", intTopCfg.im1);
+		printf("\t%40s:\t0x%x\n", "intMod2", intTopCfg.im2);
+		break;
+	}
+	case CLI_CMD_gpy2xx_topin_clr: {
+		struct gpy211_extin intTopCfg;
+		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
 
-		ret = gpy2xx_msec_get_egr_cap(&phy, &hw_cap);
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr HW cap get failed.\n");
-			return -1;
-		}
+		ret = gpy2xx_topin_clr(&phy, &intTopCfg);
 
-		printf("\nEIP num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
-		       hw_cap.eip_ver.eip_nr, hw_cap.eip_ver.eip_nr_complement, hw_cap.eip_ver.patch_level, hw_cap.eip_ver.minor_version, hw_cap.eip_ver.major_version);
-		printf("\nSA nums %x", hw_cap.eip_cfg.nr_of_sas);
-		//printf("\nRaw CFG2 %x ", hw_cap.eip_cfg2.raw_eip160_cfg2);
-		printf("\nCounters:- SA %x, VL %x, GL %x, Saturate %x, Auto reset %x, SA octet %x, VL octet %x, GL octet %x, IG only %x, EG only %x, Tag bypass %x\n",
-		       hw_cap.eip_cfg2.sa_counters, hw_cap.eip_cfg2.vl_counters, hw_cap.eip_cfg2.global_counters, hw_cap.eip_cfg2.saturate_cntrs,
-		       hw_cap.eip_cfg2.auto_cntr_reset, hw_cap.eip_cfg2.sa_octet_ctrs, hw_cap.eip_cfg2.vl_octet_ctrs, hw_cap.eip_cfg2.glob_octet_ctrs,
-		       hw_cap.eip_cfg2.ingress_only, hw_cap.eip_cfg2.egress_only, hw_cap.eip_cfg2.tag_bypass);
-		printf("\nAIC's number of interrupt inputs %x ", hw_cap.aic_opt.number_of_inputs);
-		printf("\nAIC num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
-		       hw_cap.aic_ver.eip_nr, hw_cap.aic_ver.eip_nr_complement, hw_cap.aic_ver.patch_level, hw_cap.aic_ver.minor_version, hw_cap.aic_ver.major_version);
-	} else	{
-		printf("Command Not Supported\n");
-	}
+		if (ret < 0)
+			printf("\nERROR: Clear Global/Top Interrupt status failed.\n");
 
-	return ret;
-}
+#endif /* EN_SUPPORT_TOP_INT */
+		break;
+	}
+	case CLI_CMD_gpy2xx_extin_mask: {
+		struct gpy211_phy_extin extInterrupt;
+		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
 
-int gpy211_main(int argc, char *argv[])
-{
-	s32 ret = 0;
+		cli_parse(cmd, argc, argv, &extInterrupt);
 
-	if (xstrncasecmp(argv[2], "gpy2xx_uninit", strlen("gpy2xx_uninit")) == 0) {
-		ret = gpy2xx_uninit(&phy);
+		ret = gpy2xx_extin_mask(&phy, &extInterrupt);
 
 		if (ret < 0)
-			printf("\nERROR: GPY211 uinit failed.\n");
-	}  else if (xstrncasecmp(argv[2], "gpy2xx_get_phy_id", strlen("gpy2xx_get_phy_id")) == 0) {
-		struct gpy211_id phyId = phy.id;
+			printf("\nERROR: Set External Interrupt configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_extin_get: {
+		struct gpy211_phy_extin extInterrupt;
+		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
 
-		printf("\nPopulated PHY ID parameters:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "PHY Organizationally Unique Identifier", phyId.OUI);
-		printf("\t%40s:\t0x%x\n", "PHY Manufacturer's Model Number", phyId.model_no);
-		printf("\t%40s:\t0x%x\n", "PHY Revision Number", phyId.revision);
-		printf("\t%40s:\t0x%x\n", "Chip Manufacturer ID", phyId.manufacturer_id);
-		printf("\t%40s:\t0x%x\n", "Chip Part Number", phyId.part_no);
-		printf("\t%40s:\t0x%x\n", "Chip Version", phyId.version);
-		printf("\t%40s:\t0x%x\n", "Firmware Version", ((phyId.fw_release << 15) | (phyId.fw_major << 8) | (phyId.fw_minor)));
-		printf("\t%40s:\t0x%x\n", "Firmware Major Version Number", phyId.fw_major);
-		printf("\t%40s:\t0x%x\n", "Firmware Minor Version Number", phyId.fw_minor);
-		printf("\t%40s:\t0x%x\n", "Firmware Release Indication", phyId.fw_release);
-		printf("\t%40s:\t%s\n", "The memory target used for firmware execution", (phyId.fw_memory ? ((phyId.fw_memory == 1) ? "OTP" : "FLASH") : "ROM"));
-		printf("\t%40s:\t0x%x\n", "Driver Major Version Number", phyId.drv_major);
-		printf("\t%40s:\t0x%x\n", "Driver Minor Version Number", phyId.drv_minor);
-		printf("\t%40s:\t0x%x\n", "Driver Release Indication", phyId.drv_release);
-		printf("\t%40s:\t0x%x\n", "Driver Patch Indication", phyId.drv_patch);
-	}	else if (xstrncasecmp(argv[2], "gpy2xx_read_fw_info", strlen("gpy2xx_read_fw_info")) == 0) {
-		ret = gpy2xx_read_fw_info(&phy);
+		ret = gpy2xx_extin_get(&phy, &extInterrupt);
 
-		if (ret < 0)
-			printf("\nERROR: Reading FW info failed.\n");
+		if (ret < 0) {
+			printf("\nERROR: Get External Interrupt configuration failed.\n");
+			return ret;
+		}
 
-		struct gpy211_id phyId = phy.id;
+		printf("\t%40s:\t0x%x\n", "Standard interrupt mask", extInterrupt.std_imask);
+		printf("\t%40s:\t0x%x\n", "Standard interrupt status", extInterrupt.std_istat);
+		printf("\t%40s:\t0x%x\n", "Exntended interrupt mask", extInterrupt.ext_imask);
+		printf("\t%40s:\t0x%x\n", "Exntended interrupt status", extInterrupt.ext_istat);
+		break;
+	}
+	case CLI_CMD_gpy2xx_mon_link: {
+		static struct gpy211_mon mon;
+		struct gpy211_mon_evt evt;
+		enum gpy211_mon_line line = GPY211_MON_LINE_GPIO;
+		struct cli_mon_link_args a;
+		u32 i, seq = 0;
+		char *dev;
+		int fd = -1;
 
-		printf("\t%40s:\t0x%x\n", "Firmware Version", ((phyId.fw_release << 15) | (phyId.fw_major << 8) | (phyId.fw_minor)));
-		printf("\t%40s:\t0x%x\n", "Firmware Major Version Number", phyId.fw_major);
-		printf("\t%40s:\t0x%x\n", "Firmware Minor Version Number", phyId.fw_minor);
-		printf("\t%40s:\t0x%x\n", "Firmware Release Indication", phyId.fw_release);
-		printf("\t%40s:\t%s\n", "The memory target used for firmware execution", (phyId.fw_memory ? ((phyId.fw_memory == 1) ? "OTP" : "FLASH") : "ROM"));
-	} else if (xstrncasecmp(argv[2], "gpy2xx_soft_reset", strlen("gpy2xx_soft_reset")) == 0) {
-		ret = gpy2xx_soft_reset(&phy);
+		memset(&mon, 0, sizeof(struct gpy211_mon));
+		memset(&a, 0, sizeof(struct cli_mon_link_args));
 
-		if (ret < 0)
-			printf("\nERROR: SW reset failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_poll_reset", strlen("gpy2xx_poll_reset")) == 0) {
-		ret = gpy2xx_poll_reset(&phy);
+		cli_parse(cmd, argc, argv, &a);
+		dev = a.gpio;
 
-		if (ret > 0)
-			printf("\nSW reset completed.\n");
-		else if (ret == 0)
-			printf("\nSW reset is pending.\n");
-		else
-			printf("\nERROR: SW reset polling failed.\n");
+		if (dev == NULL) {
+			dev = a.uio;
+			line = GPY211_MON_LINE_UIO;
+		}
 
-#if defined(EN_SMDIO_RW) && EN_SMDIO_RW
-	} else if (xstrncasecmp(argv[2], "gpy2xx_smdio_read", strlen("gpy2xx_smdio_read")) == 0) {
-		int cnt = 0;
-		u32 reg_off;
+		if (dev != NULL) {
+			fd = open(dev, (line == GPY211_MON_LINE_UIO) ? O_RDWR : O_RDONLY);
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+			if (fd < 0) {
+				printf("\nERROR: Open %s failed.\n", dev);
+				return -1;
+			}
+		}
 
-		ret = gpy2xx_smdio_read(&phy, reg_off);
+		ret = gpy2xx_mon_start(&phy, &mon);
 
 		if (ret < 0) {
-			printf("\nERROR: SMDIO read failed.\n");
-		} else {
-			printf("\nSmdio rd vale = 0x%x\n", ret);
+			printf("\nERROR: Link monitor start failed.\n");
+			goto MON_END;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_smdio_write", strlen("gpy2xx_smdio_write")) == 0) {
-		int cnt = 0;
-		u32 reg_off;
-		u16 data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		printf("\t%40s:\t%s %d Mbps\n", "Link", phy.link.link ? "up" : "down", phy.link.speed);
 
-		ret = gpy2xx_smdio_write(&phy, reg_off, data_val);
+		for (i = 0; i < a.events;) {
+			if (fd >= 0) {
+				ret = gpy2xx_mon_wait(fd, line, a.timeout);
 
-		if (ret < 0) {
-			printf("\nERROR: SMDIO write failed\n");
-		}
+				if (ret < 0) {
+					printf("\nERROR: Interrupt line wait failed.\n");
+					break;
+				}
 
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_read_mmd", strlen("gpy2xx_read_mmd")) == 0) {
-		int cnt = 0;
-		int dev_id;
-		u32 reg_off;
+				if (ret == 0)
+					continue;
+			} else {
+				usleep(a.timeout * 1000);
+			}
 
-		cnt += scanParamArg(argc, argv, "devtype", sizeof(dev_id), &dev_id);
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+			ret = gpy2xx_mon_event(&phy, &mon);
 
-		ret = gpy2xx_read_mmd(&phy, dev_id, reg_off);
+			if (ret < 0) {
+				printf("\nERROR: Link monitor event failed.\n");
+				break;
+			}
 
-		if (ret < 0) {
-			printf("\nERROR: MMD read failed.\n");
-		} else {
-			printf("\nMmd rd vale = 0x%x\n", ret);
+			while (gpy2xx_mon_log(&mon, &seq, &evt, 1) == 1) {
+				printf("\nEvent %u: %llu.%09llu std 0x%04x ext 0x%04x link %s %d Mbps %s duplex\n",
+				       ++i, (unsigned long long)(evt.ts / 1000000000ULL),
+				       (unsigned long long)(evt.ts % 1000000000ULL), evt.std_istat,
+				       evt.ext_istat, evt.link ? "up" : "down", evt.speed,
+				       (evt.duplex == DUPLEX_FULL) ? "full" : "half");
+			}
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_write_mmd", strlen("gpy2xx_write_mmd")) == 0) {
-		int cnt = 0;
-		int dev_id;
-		u32 reg_off;
-		u16 data_val;
 
-		cnt += scanParamArg(argc, argv, "devtype", sizeof(dev_id), &dev_id);
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		gpy2xx_mon_stop(&phy, &mon);
 
-		ret = gpy2xx_write_mmd(&phy, dev_id, reg_off, data_val);
+		printf("\t%40s:\t%u\n", "Events", mon.events);
+		printf("\t%40s:\t%u\n", "Spurious", mon.spurious);
+		printf("\t%40s:\t%u\n", "Full status reads", mon.full_reads);
 
-		if (ret < 0) {
-			printf("\nERROR: MMD write failed.\n");
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_read_status", strlen("gpy2xx_read_status")) == 0) {
-		ret = gpy2xx_read_status(&phy);
+MON_END:
 
-		if (ret < 0)
-			printf("\nERROR: Read link status failed.\n");
-		else {
-			struct gpy211_link linkConfig = phy.link;
-			char buf[256];
+		if (fd >= 0)
+			close(fd);
+		break;
+	}
+	case CLI_CMD_gpy2xx_mgr_scan: {
+		static struct gpy2xx_mgr mgr;
+		struct gpy2xx_mgr_bus_cfg cfg[GPY2XX_MGR_MAX_BUSES];
+		struct gpy2xx_mgr_phy *p;
+		struct cli_mgr_scan_args a;
+		u32 i, nr_bus = 0;
 
-			printf("\nPopulated link configuration parameters:\n----------------\n");
-			printf("\t%40s:\t%s\n", "Auto-Negotiation (AN) state", linkConfig.autoneg ? "Enabled" : "Disabled");
-			printf("\t%40s:\t%d\n", "Link Speed or Partner Link Speed (AN)", linkConfig.speed);
-			printf("\t%40s:\t%s\n", "Duplex (Forced) or Partner Duplex (AN)", linkConfig.duplex ? "Full" : "Half");
-			printf("\t%40s:\t%d\n", "Partner Pause (AN)", linkConfig.pause);
-			printf("\t%40s:\t%d\n", "Partner Asym-pause (AN)", linkConfig.asym_pause);
-			printf("\t%40s:\t%s\n", "Most recently read link state", linkConfig.link ? "Up" : "Down");
-			print_advert(buf, sizeof(buf), linkConfig.supported);
-			printf("\t%40s:\t0x%llx (%s)\n", "GPHY supported modes", linkConfig.supported, buf);
-			print_advert(buf, sizeof(buf), linkConfig.advertising);
-			printf("\t%40s:\t0x%llx (%s)\n", "GPHY advertising modes", linkConfig.advertising, buf);
-			print_advert(buf, sizeof(buf), linkConfig.lp_advertising);
-			printf("\t%40s:\t0x%llx (%s)\n", "Link partner advertising modes", linkConfig.lp_advertising, buf);
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_read", strlen("gpy2xx_read")) == 0) {
-		int cnt = 0;
-		u32 reg_off;
+		memset(&a, 0, sizeof(struct cli_mgr_scan_args));
+		cli_parse(cmd, argc, argv, &a);
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		for (i = 0; i < 32 && nr_bus < GPY2XX_MGR_MAX_BUSES; i++) {
+			if (!(a.xgmacMask & (1u << i)))
+				continue;
 
-		ret = gpy2xx_read(&phy, reg_off);
+			cfg[nr_bus].xgmac_id = i;
+			cfg[nr_bus].addr_mask = a.addrMask;
+			cfg[nr_bus].smdio_addr = a.smdioAddr;
+			cfg[nr_bus].ptp_clock = phy.ptp_clock;
+			nr_bus++;
+		}
+
+		ret = gpy2xx_mgr_open(&mgr, mdio.fd, cfg, nr_bus);
 
 		if (ret < 0) {
-			printf("\nERROR: MDIO read failed.\n");
-		} else {
-			printf("\nMdio rd vale = 0x%x\n", ret);
+			printf("\nERROR: PHY scan failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_write", strlen("gpy2xx_write")) == 0) {
-		int cnt = 0;
-		u32 reg_off;
-		u16 data_val;
-
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
 
-		ret = gpy2xx_write(&phy, reg_off, data_val);
+		ret = gpy2xx_mgr_init(&mgr);
 
 		if (ret < 0) {
-			printf("\nERROR: MDIO write failed.\n");
+			printf("\nERROR: PHY bring-up failed.\n");
+			gpy2xx_mgr_close(&mgr);
+			return ret;
 		}
 
-#if defined(P31G_IND_RW) && P31G_IND_RW
-	} else if (xstrncasecmp(argv[2], "pm_ind_read", strlen("pm_ind_read")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		printf("\n\t%-6s %-6s %-6s %-6s %-8s %-6s %-10s\n",
+		       "xgmac", "addr", "chip", "slice", "family", "ret", "init (us)");
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		for (i = 0; i < mgr.nr_phy; i++) {
+			p = &mgr.phy[i];
+			printf("\t%-6d %-6u %-6u %-6u 0x%-6x %-6d %-10u\n",
+			       mgr.bus[p->bus].cfg.xgmac_id, p->dev.phy_addr, p->chip,
+			       p->slice, p->dev.id.family, p->ret, p->init_us);
+		}
 
-		ret = pm_indirect_read(&phy, reg_off, &data_val);
+		for (i = 0; i < mgr.nr_bus; i++)
+			printf("\t%40s:\t%u PHYs, %u accesses, %u us\n", "MDIO bus",
+			       mgr.bus[i].num, mgr.bus[i].accesses, mgr.bus[i].init_us);
 
-		if (ret < 0) {
-			printf("\nERROR: PM Indirect read failed.\n");
-		} else {
-			printf("\nPM rd vale = 0x%x\n", data_val);
-		}
-	} else if (xstrncasecmp(argv[2], "pm_ind_write", strlen("pm_ind_write")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		printf("\t%40s:\t%d/%u\n", "PHYs initialized", ret, mgr.nr_phy);
+		printf("\t%40s:\t%u\n", "Chips", mgr.nr_chip);
+		printf("\t%40s:\t%u us\n", "Bring-up time", mgr.init_us);
+
+		gpy2xx_mgr_close(&mgr);
+		ret = 0;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+		break;
+	}
+	case CLI_CMD_gpy2xx_extin_clr: {
+		struct gpy211_phy_extin extInterrupt;
+		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &extInterrupt);
 
-		ret = pm_indirect_write(&phy, reg_off, data_val);
+		ret = gpy2xx_extin_clr(&phy, &extInterrupt);
 
-		if (ret < 0) {
-			printf("\nERROR: PM write failed.\n");
-		}
+		if (ret < 0)
+			printf("\nERROR: Clear External Interrupt Status failed.\n");
 
 #endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_mbox_read16", strlen("gpy2xx_mbox_read16")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_test_mode_cfg: {
+		enum gpy211_test_mode testMode;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &testMode);
+		ret = gpy2xx_test_mode_cfg(&phy, testMode);
 
-		ret = gpy2xx_mbox_read16(&phy, reg_off, &data_val);
+		if (ret < 0)
+			printf("\nERROR: Set Test Transmitter mode failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_cdiag_start: {
+		ret = gpy2xx_cdiag_start(&phy);
 
-		if (ret < 0) {
-			printf("\nERROR: PM MBOX read failed.\n");
-		} else {
-			printf("\nMBOX rd vale = 0x%x\n", data_val);
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_mbox_write16", strlen("gpy2xx_mbox_write16")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		if (ret < 0)
+			printf("\nERROR: Set Cable diagnostic (CDIAG) start failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_cdiag_stop: {
+		ret = gpy2xx_cdiag_stop(&phy);
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		if (ret < 0)
+			printf("\nERROR: Cable diagnostic (CDIAG) test stop failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_cdiag_read: {
+		u8 pairState, cableLength, validResults;
+		int i = 0;
+		struct gpy211_cdiag_report cdiagReport;
+		memset(&cdiagReport, 0, sizeof(struct gpy211_cdiag_report));
 
-		ret = gpy2xx_mbox_write16(&phy, reg_off, data_val);
+		ret = gpy2xx_cdiag_read(&phy, &cdiagReport);
 
 		if (ret < 0) {
-			printf("\nERROR: MBOX write failed.\n");
+			printf("\nERROR: CDIAG test result read failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_mbox_read32", strlen("gpy2xx_mbox_read32")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		printf("\nReturned values:\n----------------\n");
 
-		ret = gpy2xx_mbox_read32(&phy, reg_off, &data_val);
+		for (i = 0; i < 4; i++) {
+			printf("\nThe CDIAG test results for DSP = %s.\n", ((i == 0) ? "A" : (i == 1) ? "B" : (i == 2) ? "C" : "D"));
+			printf("\nTotal valid diagnostic reports = %d.\n", cdiagReport.pair[i].num_valid_result);
+			validResults = cdiagReport.pair[i].num_valid_result;
 
-		if (ret < 0) {
-			printf("\nERROR: PM MBOX read failed.\n");
-		} else {
-			printf("\nMBOX rd vale = 0x%x\n", data_val);
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_mbox_write32", strlen("gpy2xx_mbox_write32")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+			if (validResults) {
+				cableLength = cdiagReport.pair[i].results[validResults - 1].distance - cdiagReport.pair[i].results[0].distance;
+				printf("\t%40s:\t%d\n", "Estimated distance of cable (in meters)", cableLength);
+				pairState = cdiagReport.pair[i].results[validResults - 1].state;
+				printf("\t%40s:\t%s\n", "Detected echo", ((pairState == 1) ? "REFLECTION" : (pairState == 2) ? "OPEN" : (pairState == 4) ? "SHORT" : (pairState == 8) ? "MATCHED" : "ERROR"));
+				printf("\t%40s:\t%d\n", "Echo coefficient of first detected peak", (s16)(cdiagReport.pair[i].results[validResults - 1].peak));
+			}
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+			int k = 0;
 
-		ret = gpy2xx_mbox_write32(&phy, reg_off, data_val);
+			for (k = 0; k < 3; k++) {
+				printf("\tThe sum-of-square of all XC%1d coefficients :\t%d\n", k, cdiagReport.pair[i].xc_pwr[k]);
+			}
 
-		if (ret < 0) {
-			printf("\nERROR: MBOX write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_xpcs_read16", strlen("gpy2xx_xpcs_read16")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_abist_start: {
+		struct gpy211_abist_param abisTest;
+		memset(&abisTest, 0, sizeof(struct gpy211_abist_param));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &abisTest);
 
-		ret = PHY_XPCS_HWRD(&phy, reg_off, &data_val);
+		ret = gpy2xx_abist_start(&phy, &abisTest);
+
+		if (ret < 0)
+			printf("\nERROR: ABIS test start failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_abist_read: {
+		int i = 0, j = 0;
+		struct gpy211_abist_report abistReport;
+		memset(&abistReport, 0, sizeof(struct gpy211_abist_report));
+
+		ret = gpy2xx_abist_read(&phy, &abistReport);
 
 		if (ret < 0) {
-			printf("\nERROR: PHY XPCS read failed.\n");
-		} else {
-			printf("\nPHY XPCS rd vale = 0x%x\n", data_val);
+			printf("\nERROR: ABIS test result read failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_xpcs_write16", strlen("gpy2xx_xpcs_write16")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		printf("\nReturned ABIS test results:\n----------------------------\n");
+
+		for (i = 0; i < 4; i++) {
+			printf("The ABIS test results for ASP %s\n", ((i == 0) ? "A" : (i == 1) ? "B" : (i == 2) ? "C" : "D"));
+			printf("\nIdle-Channel Noice GMax values\n");
+			printf("\t%40s:\t0x%x\n", "Magnetude Max", abistReport.pair[i].icn_gmax.mag_max);
+			printf("\t%40s:\t0x%x\n", "Magnetude Min", abistReport.pair[i].icn_gmax.mag_min);
+			printf("\t%40s:\t0x%x\n", "Magnetude Avg", abistReport.pair[i].icn_gmax.mag_avg);
+			printf("\t%40s:\t0x%x\n", "Magnetude DC", abistReport.pair[i].icn_gmax.mag_dc);
+			printf("\nIdle-Channel Noice GMin values\n");
+			printf("\t%40s:\t0x%x\n", "Magnetude Max", abistReport.pair[i].icn_gmin.mag_max);
+			printf("\t%40s:\t0x%x\n", "Magnetude Min", abistReport.pair[i].icn_gmin.mag_min);
+			printf("\t%40s:\t0x%x\n", "Magnetude Avg", abistReport.pair[i].icn_gmin.mag_avg);
+			printf("\t%40s:\t0x%x\n", "Magnetude DC", abistReport.pair[i].icn_gmin.mag_dc);
 
-		ret = PHY_XPCS_HWWR(&phy, reg_off, data_val);
+			printf("\nAnalog Gain Control values\n");
 
-		if (ret < 0) {
-			printf("\nERROR: PHY XPCS write failed.\n");
+			for (j = 0; j < 6; j++) {
+				printf("\t%38s-%d:\t0x%x\n", "Agc-Pwr-", j, abistReport.pair[i].agc_hyb.agc_pwr[j]);
+			}
+
+			printf("\t%38s:\t0x%x\n", "Agc-Pwr-Mean", abistReport.pair[i].agc_hyb.agc_mean);
+			printf("\t%38s:\t0x%x\n", "Agc-Pwr-Std", abistReport.pair[i].agc_hyb.agc_std);
+
+			printf("\n10BT details with hybrid OFF\n");
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_10bt.dc_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_10bt.nyq_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_10bt.k1_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_10bt.k2_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_10bt.k3_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_10bt.k4_mag);
+
+			printf("\n100BT details with hybrid OFF\n");
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_100bt.dc_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_100bt.nyq_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_100bt.k1_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_100bt.k2_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_100bt.k3_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_100bt.k4_mag);
+
+			printf("\n1000BT details with hybrid ON\n");
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].hyb_1000bt.dc_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].hyb_1000bt.nyq_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].hyb_1000bt.k1_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].hyb_1000bt.k2_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].hyb_1000bt.k3_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].hyb_1000bt.k4_mag);
+
+			printf("\n1000BT details with hybrid OFF\n");
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_1000bt.dc_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_1000bt.nyq_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_1000bt.k1_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_1000bt.k2_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_1000bt.k3_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_1000bt.k4_mag);
+
+			printf("\n2500BT details with hybrid ON\n");
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].hyb_2500bt.dc_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].hyb_2500bt.nyq_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].hyb_2500bt.k1_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].hyb_2500bt.k2_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].hyb_2500bt.k3_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].hyb_2500bt.k4_mag);
+
+			printf("\n2500BT details with hybrid OFF\n");
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_2500bt.dc_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_2500bt.nyq_mag);
+			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_2500bt.k1_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_2500bt.k2_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_2500bt.k3_mag);
+			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_2500bt.k4_mag);
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_config_advert", strlen("gpy2xx_config_advert")) == 0) {
-		char buf[256];
+		break;
+	}
+	case CLI_CMD_gpy2xx_loopback_cfg: {
+		enum gpy211_test_loop loopMode;
 
-		if (scan_advert(argc, argv, "advertising", &phy.link.advertising) == 0)
-			phy.link.advertising = phy.link.supported;
+		cli_parse(cmd, argc, argv, &loopMode);
+		ret = gpy2xx_loopback_cfg(&phy, loopMode);
 
-		print_advert(buf, sizeof(buf), phy.link.supported);
-		printf("\t%24s:\t0x%llx (%s)\n", "GPHY supported modes", phy.link.supported, buf);
-		print_advert(buf, sizeof(buf), phy.link.advertising);
-		printf("\t%24s:\t0x%llx (%s)\n", "GPHY advertising modes", phy.link.advertising, buf);
+		if (ret < 0)
+			printf("\nERROR: Set Loopback test mode failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_errcnt_cfg: {
+		enum gpy211_errcnt_event cntMode;
 
-		ret = gpy2xx_config_advert(&phy);
+		cli_parse(cmd, argc, argv, &cntMode);
+		ret = gpy2xx_errcnt_cfg(&phy, cntMode);
 
 		if (ret < 0)
-			printf("\nERROR: Setting Auto-Negotiation's advertisement conf failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_setup_forced", strlen("gpy2xx_setup_forced")) == 0) {
-		if (scanParamArg(argc, argv, "speed", sizeof(phy.link.speed), &phy.link.speed) == 0)
-			phy.link.speed = SPEED_2500;
+			printf("\nERROR: Set Error or Event count mode failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_errcnt_read: {
+		ret = gpy2xx_errcnt_read(&phy);
+
+		if (ret >= 0)
+			printf("\nError or Event counter = 0x%x.\n", ret);
+		else
+			printf("\nERROR: Get Error or Event count failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_pcs_status_read: {
+		struct gpy211_pcs_status pcsStatus;
+		memset(&pcsStatus, 0, sizeof(struct gpy211_pcs_status));
 
-		if (scanParamArg(argc, argv, "duplex", sizeof(phy.link.duplex), &phy.link.duplex) == 0)
-			phy.link.duplex = DUPLEX_FULL;
+		ret = gpy2xx_pcs_status_read(&phy, &pcsStatus);
 
-		if (scanParamArg(argc, argv, "pause", sizeof(phy.link.pause), &phy.link.pause) == 0)
-			phy.link.pause = 1;
+		if (ret < 0) {
+			printf("\nERROR: PCS status read failed.\n");
+			return ret;
+		}
 
-		if (scanParamArg(argc, argv, "asym_pause", sizeof(phy.link.asym_pause), &phy.link.asym_pause) == 0)
-			phy.link.asym_pause = 1;
+		printf("\nBASE-R or 10GBASE-T PCS Status:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Bit Error Rate (BER)", pcsStatus.ber);
+		printf("\t%40s:\t0x%x\n", "Number of Errored Blocks", pcsStatus.errored_block);
+		printf("\t%40s:\t0x%x\n", "Reporting high BER status", pcsStatus.high_ber);
+		printf("\t%40s:\t0x%x\n", "Received Block Lock status", pcsStatus.block_lock);
+		printf("\t%40s:\t0x%x\n", "Receive link status", pcsStatus.rcv_link_up);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_adjfreq: {
+		s32 pbb = 0;
 
-		if (scanParamArg(argc, argv, "mstr_slave", sizeof(phy.mstr_slave), &phy.mstr_slave) == 0)
-			phy.mstr_slave = 1;
+		cli_parse(cmd, argc, argv, &pbb);
 
-		ret = gpy2xx_setup_forced(&phy);
+		ret = gpy2xx_ptp_adjfreq(&phy, pbb);
 
 		if (ret < 0)
-			printf("\nERROR: Setting forceful link speed failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_restart_aneg", strlen("gpy2xx_restart_aneg")) == 0) {
-		ret = gpy2xx_restart_aneg(&phy);
+			printf("\nERROR: Set PTP Frequency adjusting/modify failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_adjtime: {
+		s64 delta;
+
+		cli_parse(cmd, argc, argv, &delta);
+
+		ret = gpy2xx_ptp_adjtime(&phy, delta);
 
 		if (ret < 0)
-			printf("\nERROR: Restarting Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_config_aneg", strlen("gpy2xx_config_aneg")) == 0) {
-		char buf[256];
+			printf("\nERROR: Adjust PTP System Time failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_gettime: {
+		struct timespec64 refTime;
+		memset(&refTime, 0, sizeof(struct timespec64));
 
-		if (scanParamArg(argc, argv, "autoneg", sizeof(phy.link.autoneg), &phy.link.autoneg) == 0)
-			phy.link.autoneg = 1;
+		ret = gpy2xx_ptp_gettime(&phy, &refTime);
 
-		if (scan_advert(argc, argv, "advertising", &phy.link.advertising) == 0)
-			phy.link.advertising = phy.link.supported;
+		if (ret < 0) {
+			printf("\nGet PTP System Time failed.\n");
+			return ret;
+		}
 
-		if (scanParamArg(argc, argv, "speed", sizeof(phy.link.speed), &phy.link.speed) == 0)
-			phy.link.speed = SPEED_2500;
+		printf("\t%s: %llx, \t%lx\n", "PTP system time sec n nsec", refTime.tv_sec, refTime.tv_nsec);
+		print_sys_time(refTime.tv_sec, refTime.tv_nsec);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_getcrosststamp: {
+		u32 i;
+		static struct gpy211_ptp_xts xts;
+		memset(&xts, 0, sizeof(xts));
 
-		if (scanParamArg(argc, argv, "duplex", sizeof(phy.link.duplex), &phy.link.duplex) == 0)
-			phy.link.duplex = DUPLEX_FULL;
+		cli_parse(cmd, argc, argv, &xts);
 
-		if (scanParamArg(argc, argv, "pause", sizeof(phy.link.pause), &phy.link.pause) == 0)
-			phy.link.pause = 1;
+		ret = gpy2xx_ptp_getcrosststamp(&phy, &xts);
 
-		if (scanParamArg(argc, argv, "asym_pause", sizeof(phy.link.asym_pause), &phy.link.asym_pause) == 0)
-			phy.link.asym_pause = 1;
+		if (ret < 0) {
+			printf("\nERROR: Get PTP cross timestamp failed.\n");
+			return ret;
+		}
 
-		print_advert(buf, sizeof(buf), phy.link.supported);
-		printf("\t%24s:\t0x%llx (%s)\n", "GPHY supported modes", phy.link.supported, buf);
-		print_advert(buf, sizeof(buf), phy.link.advertising);
-		printf("\t%24s:\t0x%llx (%s)\n", "GPHY advertising modes", phy.link.advertising, buf);
+		for (i = 0; i < xts.n_samples; i++)
+			printf("\t%2u: pre %lld.%09ld  phc %lld.%09ld  post %lld.%09ld%s\n", i,
+			       (long long)xts.sample[i].pre.tv_sec, (long)xts.sample[i].pre.tv_nsec,
+			       (long long)xts.sample[i].phc.tv_sec, (long)xts.sample[i].phc.tv_nsec,
+			       (long long)xts.sample[i].post.tv_sec, (long)xts.sample[i].post.tv_nsec,
+			       (i == xts.best) ? "  *" : "");
 
-		ret = gpy2xx_config_aneg(&phy);
+		printf("\t%s:\t%lld ns\n", "Bracket width", (long long)xts.delay);
+		printf("\t%s:\t%lld ns\n", "PHC - system time", (long long)xts.offset);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_settime: {
+		struct timespec64 ts;
+		memset(&ts, 0, sizeof(struct timespec64));
 
-		if (ret < 0)
-			printf("\nERROR: Configuring Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_aneg_done", strlen("gpy2xx_aneg_done")) == 0) {
-		ret = gpy2xx_aneg_done(&phy);
+		cli_parse(cmd, argc, argv, &ts);
 
-		if (ret == 0)
-			printf("\nAuto-Negotiation pending.\n");
-		else if (ret == 1)
-			printf("\nAuto-Negotiation completed.\n");
-		else
-			printf("\nERROR: Auto-Negotiation polling failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_update_link", strlen("gpy2xx_update_link")) == 0) {
-		ret = gpy2xx_update_link(&phy);
+		ret = gpy2xx_ptp_settime(&phy, &ts);
 
+		printf("\nInfo: Current Unix Epoch Clock from \"https://www.epochconverter.com/clock\"\n");
 		if (ret < 0)
-			printf("\nERROR: Updating link status failed.\n");
-
-		if (phy.link.link == 0)
-			printf("\nLink Down.\n");
-		else
-			printf("\nLink Up.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gpio_cfg", strlen("gpy2xx_gpio_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_gpio gpioCfg;
-		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
+			printf("\nERROR: Set PTP System Time failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_enable: {
+		struct cli_ptp_enable_args a;
+		struct gpy211_ptp_ctrl ptpCfg;
+		memset(&a, 0, sizeof(struct cli_ptp_enable_args));
+		memset(&ptpCfg, 0, sizeof(struct gpy211_ptp_ctrl));
 
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
-		cnt += scanParamArg(argc, argv, "gpioFlags", sizeof(gpioCfg.flags), &gpioCfg.flags);
+		cli_parse(cmd, argc, argv, &a);
+		ptpCfg.tx_ts_phy = a.enPhyTxTs;
+		ptpCfg.rx_ts_phy = a.enPhyRxTs;
+		ptpCfg.tx_ptp_off = a.txPtpOffset;
+		ptpCfg.tx_ptp_tpt = a.txPtpProto;
+		ptpCfg.ts_ostc_en = a.enTxOstcEn;
+		ptpCfg.tx_ost_corr = a.txOstCorTime;
 
-		ret = gpy2xx_gpio_cfg(&phy, &gpioCfg);
+		ret = gpy2xx_ptp_enable(&phy, &ptpCfg);
 
 		if (ret < 0)
-			printf("\nERROR: Set GPIO configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gpio_get", strlen("gpy2xx_gpio_get")) == 0) {
-		int cnt = 0;
-		struct gpy211_gpio gpioCfg;
-		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
+			printf("\nERROR: PTP enable failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_disable: {
+		ret = gpy2xx_ptp_disable(&phy);
 
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
+		if (ret < 0)
+			printf("\nERROR: PTP disable failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_getcfg: {
+		struct gpy211_ptp_cfg ptpCfg;
+		memset(&ptpCfg, 0, sizeof(struct gpy211_ptp_cfg));
 
-		ret = gpy2xx_gpio_get(&phy, &gpioCfg);
+		ret = gpy2xx_ptp_getcfg(&phy, &ptpCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Get GPIO configuration failed.\n");
+			printf("\nERROR: Get PTP TS configuration failed.\n");
 			return ret;
 		}
 
-		printf("\t%60s:\t0x%x\n", "gpioDirection: 0 = In, 1 = Out", gpioCfg.flags & 0x1);
-
-		if (gpioCfg.flags & 0x1)
-			printf("\t%60s:\t0x%x\n", "gpioOutLevel: 0 = Low, 1 = High", (gpioCfg.flags >> 1) & 0x1);
-		else
-			printf("\t%60s:\t0x%x\n", "gpioInLevel: 0 = Low, 1 = High", (gpioCfg.flags >> 2) & 0x1);
-
-		printf("\t%60s:\t0x%x\n", "gpioOpenDrain: 0 = OD, 1 = PP", (gpioCfg.flags >> 3) & 0x1);
-		printf("\t%60s:\t0x%x\n", "gpioPuPd: 2 = Pull-Up, 3 = Pull-Down", (gpioCfg.flags >> 8) & 0x3);
-		printf("\t%60s:\t0x%x\n", "gpioAltFunc: 0 = , 1 = , 2 = , 3 =", (gpioCfg.flags >> 10) & 0x3);
-		printf("\t%60s:\t0x%x\n", "gpioPadStrength: 0 = 2mA, 1 = 4mA, 2 = 8mA, 3 = 12mA", (gpioCfg.flags >> 12) & 0x3);
-		printf("\t%60s:\t0x%x\n", "gpioSlewRate: 0 = Slow, 3 = Fast", (gpioCfg.flags >> 15) & 0x1);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gpio_output", strlen("gpy2xx_gpio_output")) == 0) {
-		int cnt = 0;
-		struct gpy211_gpio gpioCfg;
-		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
-
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
+		printf("\t%40s:\t0x%x\n", "enPhyTxTs", ptpCfg.ptp_ctrl.tx_ts_phy);
+		printf("\t%40s:\t0x%x\n", "enPhyRxTs", ptpCfg.ptp_ctrl.rx_ts_phy);
+		printf("\t%40s:\t0x%x\n", "txPtpOffset", ptpCfg.ptp_ctrl.tx_ptp_off);
+		printf("\t%40s:\t0x%x\n", "txPtpProto", ptpCfg.ptp_ctrl.tx_ptp_tpt);
+		printf("\t%40s:\t0x%x\n", "enTxOstcEn", ptpCfg.ptp_ctrl.ts_ostc_en);
+		printf("\t%40s:\t0x%llx\n", "txOstCorTime", ptpCfg.ptp_ctrl.tx_ost_corr);
 
-		ret = gpy2xx_gpio_output(&phy, &gpioCfg);
+		printf("\t%40s:\t0x%x\n", "enEvntMsg", ptpCfg.ts_ctrl.ts_evtmsg_en);
+		printf("\t%40s:\t0x%x\n", "enMstrMsg", ptpCfg.ts_ctrl.ts_master_en);
+		printf("\t%40s:\t0x%x\n", "snapType", ptpCfg.ts_ctrl.snap_type);
 
-		if (ret < 0)
-			printf("\nERROR: Set GPIO pin as output failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gpio_input", strlen("gpy2xx_gpio_input")) == 0) {
-		int cnt = 0;
-		struct gpy211_gpio gpioCfg;
-		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
+		printf("\t%40s:\t0x%x\n", "ppsCtrlLow", ptpCfg.pps_ctrl.ppsctrl_low.raw_pps_ctrl_low);
+		printf("\t%40s:\t0x%x\n", "targetSec", ptpCfg.pps_ctrl.sec_tgttime);
+		printf("\t%40s:\t0x%x\n", "targetNsc", ptpCfg.pps_ctrl.nsec_tgttime);
+		printf("\t%40s:\t0x%x\n", "ppsInterval", ptpCfg.pps_ctrl.pps0_interal);
+		printf("\t%40s:\t0x%x\n", "ppsWidth", ptpCfg.pps_ctrl.pps0_width);
 
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
+		printf("\t%40s:\t0x%x\n", "ptoCtrlLow", ptpCfg.pto_ctrl.ptoctrl_low.raw_pto_ctrl_low);
+		printf("\t%40s:\t%2x%2x%2x%2x%2x%2x%2x%2x%2x%2x\n", "srcPortID", ptpCfg.pto_ctrl.sport_id[0], ptpCfg.pto_ctrl.sport_id[1], ptpCfg.pto_ctrl.sport_id[2], ptpCfg.pto_ctrl.sport_id[3], ptpCfg.pto_ctrl.sport_id[4], ptpCfg.pto_ctrl.sport_id[5], ptpCfg.pto_ctrl.sport_id[6], ptpCfg.pto_ctrl.sport_id[7], ptpCfg.pto_ctrl.sport_id[8], ptpCfg.pto_ctrl.sport_id[9]);
+		printf("\t%40s:\t0x%x\n", "logmLvlLow", ptpCfg.pto_ctrl.logmsg_lvl.raw_logm_lvl_low);
+		printf("\t%40s:\t0x%x\n", "logmLvlHi", ptpCfg.pto_ctrl.logmsg_lvl.raw_logm_lvl_hi);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_set_tsctrl: {
+		struct cli_ptp_tsctrl_args a;
+		struct gpy2xx_ts_ctrl tsCfg;
+		memset(&a, 0, sizeof(struct cli_ptp_tsctrl_args));
+		memset(&tsCfg, 0, sizeof(struct gpy2xx_ts_ctrl));
 
-		ret = gpy2xx_gpio_input(&phy, &gpioCfg);
+		cli_parse(cmd, argc, argv, &a);
+		tsCfg.ts_evtmsg_en = a.enEvntMsg;
+		tsCfg.ts_master_en = a.enMstrMsg;
+		tsCfg.snap_type = a.snapType;
 
-		if (ret < 0) {
-			printf("\nERROR: Get GPIO pin input failed.\n");
-			return ret;
-		}
+		ret = gpy2xx_ptp_set_tsctrl(&phy, &tsCfg);
 
-		printf("\t%40s:\t0x%x\n", "gpioFlags", gpioCfg.flags);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_led_br_cfg", strlen("gpy2xx_led_br_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_led_brlvl_cfg brightnessCfg;
-		memset(&brightnessCfg, 0, sizeof(struct gpy211_led_brlvl_cfg));
+		if (ret < 0)
+			printf("\nERROR: Set PTP TS configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_set_ppsctrl: {
+		struct gpy2xx_pps_ctrl ppsCfg;
+		memset(&ppsCfg, 0, sizeof(struct gpy2xx_pps_ctrl));
 
-		ret = gpy2xx_led_br_get(&phy, &brightnessCfg);
+		ret = gpy2xx_ptp_get_ppsctrl(&phy, &ppsCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Get LED Brigtness configuration failed.\n");
+			LOG_CRIT("ERROR: api gpy2xx_ptp_get_ppsctrl fails\n");
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "brightMode", sizeof(brightnessCfg.mode), &brightnessCfg.mode);
-		cnt += scanParamArg(argc, argv, "brightLvlMin", sizeof(brightnessCfg.lvl_min), &brightnessCfg.lvl_min);
-		cnt += scanParamArg(argc, argv, "brightLvlMax", sizeof(brightnessCfg.lvl_max), &brightnessCfg.lvl_max);
-		cnt += scanParamArg(argc, argv, "swEdgeDetect", sizeof(brightnessCfg.sw_edge), &brightnessCfg.sw_edge);
+		cli_parse(cmd, argc, argv, &ppsCfg);
 
-		ret = gpy2xx_led_br_cfg(&phy, &brightnessCfg);
+		ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppsCfg);
 
 		if (ret < 0)
-			printf("\nERROR: Set LED Brigtness configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_led_br_get", strlen("gpy2xx_led_br_get")) == 0) {
-		struct gpy211_led_brlvl_cfg brightnessCfg;
-		memset(&brightnessCfg, 0, sizeof(struct gpy211_led_brlvl_cfg));
+			printf("\nERROR: Set PPS configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_test_gpy2xx_ptp_set_ppsctrl: {
+		struct gpy2xx_pps_ctrl ppsCfg;
+		memset(&ppsCfg, 0, sizeof(struct gpy2xx_pps_ctrl));
+		struct timespec64 refTime;
+		memset(&refTime, 0, sizeof(struct timespec64));
 
-		printf("calling gpy2xx_led_br_get inside comapre\n");
-		ret = gpy2xx_led_br_get(&phy, &brightnessCfg);
+		ret = gpy2xx_ptp_gettime(&phy, &refTime);
 
 		if (ret < 0) {
-			printf("\nERROR: Get LED Brigtness configuration failed.\n");
+			printf("\nGet PTP System Time failed.\n");
 			return ret;
 		}
 
-
-		printf("\t%40s:\t0x%x\n", "brightMode", brightnessCfg.mode);
-		printf("\t%40s:\t0x%x\n", "brightLvlMin", brightnessCfg.lvl_min);
-		printf("\t%40s:\t0x%x\n", "brightLvlMax", brightnessCfg.lvl_max);
-		printf("\t%40s:\t0x%x\n", "swEdgeDetect", brightnessCfg.sw_edge);
-#if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
-	} else if (xstrncasecmp(argv[2], "gpy2xx_led_top_cfg", strlen("gpy2xx_led_top_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_led_gcfg genLedCfg;
-		memset(&genLedCfg, 0, sizeof(struct gpy211_led_gcfg));
-
-		ret = gpy2xx_led_top_get(&phy, &genLedCfg);
+		ret = gpy2xx_ptp_get_ppsctrl(&phy, &ppsCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Get LED's General configuration failed.\n");
+			LOG_CRIT("ERROR: api gpy2xx_ptp_get_ppsctrl fails\n");
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "complexScan", sizeof(genLedCfg.complex_scan), &genLedCfg.complex_scan);
-		cnt += scanParamArg(argc, argv, "complexBlink", sizeof(genLedCfg.complex_blink), &genLedCfg.complex_blink);
-		cnt += scanParamArg(argc, argv, "inverseScan", sizeof(genLedCfg.inverse_scan), &genLedCfg.inverse_scan);
-		cnt += scanParamArg(argc, argv, "fastBlinkFreq", sizeof(genLedCfg.fast_blink_freq), &genLedCfg.fast_blink_freq);
-		cnt += scanParamArg(argc, argv, "slowBlinkFreq", sizeof(genLedCfg.slow_blink_freq), &genLedCfg.slow_blink_freq);
-
-		ret = gpy2xx_led_top_cfg(&phy, &genLedCfg);
+		ppsCfg.sec_tgttime = refTime.tv_sec + 15;
+		ppsCfg.nsec_tgttime = 0x0; //refTime.tv_nsec;
+		printf("\n\t%s: %x, \t%x\n", "Set time sec n nsec", ppsCfg.sec_tgttime, ppsCfg.nsec_tgttime);
+		cli_parse(cmd, argc, argv, &ppsCfg);
+		ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppsCfg);
 
 		if (ret < 0)
-			printf("\nERROR: Set LED's General configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_led_top_get", strlen("gpy2xx_led_top_get")) == 0) {
-		struct gpy211_led_gcfg genLedCfg;
-		memset(&genLedCfg, 0, sizeof(struct gpy211_led_gcfg));
+			printf("\nERROR: Test PPS configuration feature failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_set_ptoctrl: {
+		struct gpy2xx_pto_ctrl ptoCfg;
+		memset(&ptoCfg, 0, sizeof(struct gpy2xx_pto_ctrl));
 
-		ret = gpy2xx_led_top_get(&phy, &genLedCfg);
+		cli_parse(cmd, argc, argv, &ptoCfg);
+
+		ret = gpy2xx_ptp_set_ptoctrl(&phy, &ptoCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Get LED's General configuration failed.\n");
-			return ret;
+			printf("\nERROR: Set PTO configuration failed.\n");
+			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_fifostat: {
+		struct gpy211_ts_fifo_stat fifoStatus;
+		memset(&fifoStatus, 0, sizeof(struct gpy211_ts_fifo_stat));
 
-		printf("\t%40s:\t0x%x\n", "complexScan", genLedCfg.complex_scan);
-		printf("\t%40s:\t0x%x\n", "complexBlink", genLedCfg.complex_blink);
-		printf("\t%40s:\t0x%x\n", "inverseScan", genLedCfg.inverse_scan);
-		printf("\t%40s:\t0x%x\n", "fastBlinkFreq", genLedCfg.fast_blink_freq);
-		printf("\t%40s:\t0x%x\n", "slowBlinkFreq", genLedCfg.slow_blink_freq);
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_led_if_cfg", strlen("gpy2xx_led_if_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_led_cfg genIfCfg;
-		memset(&genIfCfg, 0, sizeof(struct gpy211_led_cfg));
-
-		cnt += scanParamArg(argc, argv, "ledId", sizeof(genIfCfg.id), &genIfCfg.id);
-
-		ret = gpy2xx_led_if_get(&phy, &genIfCfg);
+		ret = gpy2xx_ptp_fifostat(&phy, &fifoStatus);
 
 		if (ret < 0) {
-			printf("\nERROR: Get LED's IF configuration failed.\n");
+			printf("\nERROR: Get PTP TS Status failed.\n");
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "colorMode", sizeof(genIfCfg.color_mode), &genIfCfg.color_mode);
-		cnt += scanParamArg(argc, argv, "slowBlinkSrc", sizeof(genIfCfg.slow_blink_src), &genIfCfg.slow_blink_src);
-		cnt += scanParamArg(argc, argv, "fastBlinkSrc", sizeof(genIfCfg.fast_blink_src), &genIfCfg.fast_blink_src);
-		cnt += scanParamArg(argc, argv, "constantlyOn", sizeof(genIfCfg.const_on), &genIfCfg.const_on);
-		cnt += scanParamArg(argc, argv, "pulseFlags", sizeof(genIfCfg.pulse), &genIfCfg.pulse);
-
-		ret = gpy2xx_led_if_cfg(&phy, &genIfCfg);
+		printf("\t%40s:\t0x%x\n", "rxOverflow", fifoStatus.rx_ovfl);
+		printf("\t%40s:\t0x%x\n", "rxUnderflow", fifoStatus.rx_udfl);
+		printf("\t%40s:\t0x%x\n", "rxFillLevel", fifoStatus.rx_fill_lvl);
+		printf("\t%40s:\t0x%x\n", "txFillLevel", fifoStatus.tx_fill_lvl);
+		printf("\t%40s:\t0x%x\n", "txOverflow", fifoStatus.tx_ovfl);
+		printf("\t%40s:\t0x%x\n", "txUnderflow", fifoStatus.tx_udfl);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_resetfifo: {
+		ret = gpy2xx_ptp_resetfifo(&phy);
 
 		if (ret < 0)
-			printf("\nERROR: Set LED's IF configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_led_if_get", strlen("gpy2xx_led_if_get")) == 0) {
-		int cnt = 0;
-		struct gpy211_led_cfg genIfCfg;
-		memset(&genIfCfg, 0, sizeof(struct gpy211_led_cfg));
+			printf("\nERROR: TS's FIFO reset failed.\n");
 
-		cnt += scanParamArg(argc, argv, "ledId", sizeof(genIfCfg.id), &genIfCfg.id);
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_txtsstat: {
+		struct gpy211_ts_stat tsStatus;
+		memset(&tsStatus, 0, sizeof(struct gpy211_ts_stat));
 
-		ret = gpy2xx_led_if_get(&phy, &genIfCfg);
+		ret = gpy2xx_ptp_txtsstat(&phy, &tsStatus);
 
 		if (ret < 0) {
-			printf("\nERROR: Get LED's IF configuration failed.\n");
+			printf("\nERROR: Get PTP Tx TS Status failed.\n");
 			return ret;
 		}
 
-		printf("\t%40s:\t0x%x\n", "ledId", genIfCfg.id);
-		printf("\t%40s:\t0x%x\n", "colorMode", genIfCfg.color_mode);
-		printf("\t%40s:\t0x%x\n", "slowBlinkSrc", genIfCfg.slow_blink_src);
-		printf("\t%40s:\t0x%x\n", "fastBlinkSrc", genIfCfg.fast_blink_src);
-		printf("\t%40s:\t0x%x\n", "constantlyOn", genIfCfg.const_on);
-		printf("\t%40s:\t0x%x\n", "pulseFlags", genIfCfg.pulse);
-#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
-	} else if (xstrncasecmp(argv[2], "gpy2xx_topin_cfg", strlen("gpy2xx_topin_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_extin intTopCfg;
-		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
-
-		cnt += scanParamArg(argc, argv, "intId", sizeof(intTopCfg.id), &intTopCfg.id);
+		printf("\t%40s:\t0x%x\n", "Tx TS Stat low", tsStatus.tss_low.raw_ts_stat_low);
+		printf("\t%40s:\t0x%x\n", "Tx TS Stat low", tsStatus.tss_high.raw_ts_stat_hi);
+		printf("\t%40s:\t0x%llx\n", "Tx TS (in nsec)", (u64)(tsStatus.txts_stat.txtss_sec * 0x3B9ACA00 + tsStatus.txts_stat.txtss_nsec));
+		printf("\t%40s:\t0x%x\n", "Tx TS Stat missed", tsStatus.txts_stat.txtss_mis);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_getrxts: {
+		struct gpy211_rx_ts rxTs;
+		memset(&rxTs, 0, sizeof(struct gpy211_rx_ts));
 
-		ret = gpy2xx_topin_get(&phy, &intTopCfg);
+		ret = gpy2xx_ptp_getrxts(&phy, &rxTs);
 
 		if (ret < 0) {
-			printf("\nERROR: Get Global/Top Interrupt global/top configuration failed.\n");
+			printf("\nERROR: Get PTP Receive Packet TimeStamp status and CRC failed.\n");
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "gpioFlags", sizeof(intTopCfg.gpio_flags), &intTopCfg.gpio_flags);
-		cnt += scanParamArg(argc, argv, "ipChar", sizeof(intTopCfg.ip_char), &intTopCfg.ip_char);
-		cnt += scanParamArg(argc, argv, "intMod0", sizeof(intTopCfg.im0), &intTopCfg.im0);
-		cnt += scanParamArg(argc, argv, "intMod1", sizeof(intTopCfg.im1), &intTopCfg.im1);
-		cnt += scanParamArg(argc, argv, "intMod2", sizeof(intTopCfg.im2), &intTopCfg.im2);
-
-		ret = gpy2xx_topin_cfg(&phy, &intTopCfg);
-
-		if (ret < 0)
-			printf("\nERROR: Set Global/Top Interrupt configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_topin_get", strlen("gpy2xx_topin_get")) == 0) {
-		int cnt = 0;
-		struct gpy211_extin intTopCfg;
-		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
-
-		cnt += scanParamArg(argc, argv, "intId", sizeof(intTopCfg.id), &intTopCfg.id);
+		printf("\t%s:\t0x%llx\n", "PTP Receive Packet TimeStamp status", rxTs.rx_ts_stat);
+		print_sys_time(rxTs.rx_ts_stat / 1000000000ULL, rxTs.rx_ts_stat % 1000000000ULL);
+		printf("\t%s:\t0x%x\n", "PTP Receive Packet CRC ", rxTs.rx_crc_stat);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_gettxts: {
+		struct gpy211_tx_ts txTs;
+		memset(&txTs, 0, sizeof(struct gpy211_tx_ts));
 
-		ret = gpy2xx_topin_get(&phy, &intTopCfg);
+		ret = gpy2xx_ptp_gettxts(&phy, &txTs);
 
 		if (ret < 0) {
-			printf("\nERROR: Get Global/Top Interrupt global/top configuration failed.\n");
+			printf("\nERROR: Get PTP Trasmit Packet TimeStamp status and CRC failed.\n");
 			return ret;
 		}
 
-		printf("\t%40s:\t0x%x\n", "intId", intTopCfg.id);
-		printf("\t%40s:\t0x%x\n", "gpioFlags", intTopCfg.gpio_flags);
-		printf("\t%40s:\t0x%x\n", "ipChar", intTopCfg.ip_char);
-		printf("\t%40s:\t0x%x\n", "intMod0", intTopCfg.im0);
-		printf("\t%40s:\t0x%x\n", "intMod1", intTopCfg.im1);
-		printf("\t%40s:\t0x%x\n", "intMod2", intTopCfg.im2);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_topin_clr", strlen("gpy2xx_topin_clr")) == 0) {
-		int cnt = 0;
-		struct gpy211_extin intTopCfg;
-		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
-
-		cnt += scanParamArg(argc, argv, "intId", sizeof(intTopCfg.id), &intTopCfg.id);
-		cnt += scanParamArg(argc, argv, "intMod0", sizeof(intTopCfg.im0), &intTopCfg.im0);
-		cnt += scanParamArg(argc, argv, "intMod1", sizeof(intTopCfg.im1), &intTopCfg.im1);
-		cnt += scanParamArg(argc, argv, "intMod2", sizeof(intTopCfg.im2), &intTopCfg.im2);
+		printf("\t%s:\t0x%llx\n", "PTP Trasmit Packet TimeStamp status", txTs.tx_ts_stat);
+		print_sys_time(txTs.tx_ts_stat / 1000000000ULL, txTs.tx_ts_stat % 1000000000ULL);
+		printf("\t%s:\t0x%x\n", "PTP Trasmit Packet CRC ", txTs.tx_crc_stat);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_drain_ts: {
+		static struct gpy211_ptp_ts_ring tsRing;
+		struct gpy211_ptp_ts_ent tsEnt[GPY211_PTP_TS_FIFO_DEPTH * 2];
+		int i, num;
 
-		ret = gpy2xx_topin_clr(&phy, &intTopCfg);
+		gpy2xx_ptp_ts_ring_init(&tsRing);
+		ret = gpy2xx_ptp_drain_ts(&phy, &tsRing);
 
-		if (ret < 0)
-			printf("\nERROR: Clear Global/Top Interrupt status failed.\n");
+		if (ret < 0) {
+			printf("\nERROR: Drain PTP Packet TimeStamp FIFO failed.\n");
+			return ret;
+		}
 
-#endif /* EN_SUPPORT_TOP_INT */
-	} else if (xstrncasecmp(argv[2], "gpy2xx_extin_mask", strlen("gpy2xx_extin_mask")) == 0) {
-		int cnt = 0;
-		struct gpy211_phy_extin extInterrupt;
-		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
+		num = gpy2xx_ptp_ts_ring_pop(&tsRing, tsEnt, ARRAY_SIZE(tsEnt));
 
-		cnt += scanParamArg(argc, argv, "stdImask", sizeof(extInterrupt.std_imask), &extInterrupt.std_imask);
-		cnt += scanParamArg(argc, argv, "extImask", sizeof(extInterrupt.ext_imask), &extInterrupt.ext_imask);
+		for (i = 0; i < num; i++) {
+			printf("\t%s %2d:\t0x%llx\tCRC 0x%08x\n",
+			       (tsEnt[i].dir == GPY211_PTP_TS_RX) ? "RX" : "TX", i, tsEnt[i].ts, tsEnt[i].crc);
+			print_sys_time(tsEnt[i].ts / 1000000000ULL, tsEnt[i].ts % 1000000000ULL);
+		}
 
-		ret = gpy2xx_extin_mask(&phy, &extInterrupt);
+		printf("\t%s:\t%u/%u\n", "RX/TX FIFO overflow", tsRing.rx_ovfl, tsRing.tx_ovfl);
+		break;
+	}
+	case CLI_CMD_gpy2xx_synce_cfg: {
+		struct gpy211_synce synceCfg;
+		memset(&synceCfg, 0, sizeof(struct gpy211_synce));
 
-		if (ret < 0)
-			printf("\nERROR: Set External Interrupt configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_extin_get", strlen("gpy2xx_extin_get")) == 0) {
-		struct gpy211_phy_extin extInterrupt;
-		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
+		cli_parse(cmd, argc, argv, &synceCfg);
 
-		ret = gpy2xx_extin_get(&phy, &extInterrupt);
+		ret = gpy2xx_synce_cfg(&phy, &synceCfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Get External Interrupt configuration failed.\n");
+			printf("\nERROR: Set SyncE configuration failed.\n");
 			return ret;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_synce_get: {
+		struct gpy211_synce synceCfg;
+		memset(&synceCfg, 0, sizeof(struct gpy211_synce));
 
-		printf("\t%40s:\t0x%x\n", "Standard interrupt mask", extInterrupt.std_imask);
-		printf("\t%40s:\t0x%x\n", "Standard interrupt status", extInterrupt.std_istat);
-		printf("\t%40s:\t0x%x\n", "Exntended interrupt mask", extInterrupt.ext_imask);
-		printf("\t%40s:\t0x%x\n", "Exntended interrupt status", extInterrupt.ext_istat);
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[2], "gpy2xx_extin_clr", strlen("gpy2xx_extin_clr")) == 0) {
-		int cnt = 0;
-		struct gpy211_phy_extin extInterrupt;
-		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
-
-		cnt += scanParamArg(argc, argv, "stdIstat", sizeof(extInterrupt.std_istat), &extInterrupt.std_istat);
-
-		ret = gpy2xx_extin_clr(&phy, &extInterrupt);
+		ret = gpy2xx_synce_get(&phy, &synceCfg);
 
 		if (ret < 0)
-			printf("\nERROR: Clear External Interrupt Status failed.\n");
-
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_test_mode_cfg", strlen("gpy2xx_test_mode_cfg")) == 0) {
-		int cnt = 0;
-		enum gpy211_test_mode testMode;
+			printf("\nERROR: Get SyncE configuration failed.\n");
 
-		cnt += scanParamArg(argc, argv, "testTxMode", sizeof(testMode), &testMode);
-		ret = gpy2xx_test_mode_cfg(&phy, testMode);
+		printf("\t%40s:\t0x%x\n", "enSyncE", synceCfg.synce_enable);
+		printf("\t%40s:\t0x%x\n", "synceRefClk", synceCfg.synce_refclk);
+		printf("\t%40s:\t0x%x\n", "masterSlave", synceCfg.master_sel);
+		printf("\t%40s:\t0x%x\n", "dataRate", synceCfg.data_rate);
+		printf("\t%40s:\t0x%x\n", "gpcSel", synceCfg.gpc_sel);
+		break;
+	}
+	case CLI_CMD_gpy2xx_wol_cfg: {
+		struct gpy211_wolinfo wolInfo;
+		memset(&wolInfo, 0, sizeof(struct gpy211_wolinfo));
 
-		if (ret < 0)
-			printf("\nERROR: Set Test Transmitter mode failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_cdiag_start", strlen("gpy2xx_cdiag_start")) == 0) {
-		ret = gpy2xx_cdiag_start(&phy);
+		cli_parse(cmd, argc, argv, &wolInfo);
 
-		if (ret < 0)
-			printf("\nERROR: Set Cable diagnostic (CDIAG) start failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_cdiag_stop", strlen("gpy2xx_cdiag_stop")) == 0) {
-		ret = gpy2xx_cdiag_stop(&phy);
+		ret = gpy2xx_wol_cfg(&phy, &wolInfo);
 
 		if (ret < 0)
-			printf("\nERROR: Cable diagnostic (CDIAG) test stop failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_cdiag_read", strlen("gpy2xx_cdiag_read")) == 0) {
-		u8 pairState, cableLength, validResults;
-		int i = 0;
-		struct gpy211_cdiag_report cdiagReport;
-		memset(&cdiagReport, 0, sizeof(struct gpy211_cdiag_report));
+			printf("\nERROR: Set WOL configuration failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_wol_get: {
+		struct gpy211_wolinfo wolInfo;
+		memset(&wolInfo, 0, sizeof(struct gpy211_wolinfo));
 
-		ret = gpy2xx_cdiag_read(&phy, &cdiagReport);
+		ret = gpy2xx_wol_get(&phy, &wolInfo);
 
 		if (ret < 0) {
-			printf("\nERROR: CDIAG test result read failed.\n");
+			printf("\nERROR: Get WOL configuration failed.\n");
 			return ret;
 		}
 
-		printf("\nReturned values:\n----------------\n");
+		printf("\nWake-On-Lan configuration parameters:\n----------------\n");
+		printf("\t%s:\t0x%x\n", "WOL flags supported", phy.wol_supported);
+		printf("\t%s:\t0x%x\n", "WOL flags set", wolInfo.wolopts);
+		printf("\t%s:\t", "WOL device MAC");
+		printMAC_Address(wolInfo.mac);
+		printf("\n");
+		printf("\t%s:\t", "WOL device SecureOn password");
+		printMAC_Address(wolInfo.sopass);
+		printf("\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ads_cfg: {
+		struct gpy211_ads_ctrl ads;
+		memset(&ads, 0, sizeof(struct gpy211_ads_ctrl));
 
-		for (i = 0; i < 4; i++) {
-			printf("\nThe CDIAG test results for DSP = %s.\n", ((i == 0) ? "A" : (i == 1) ? "B" : (i == 2) ? "C" : "D"));
-			printf("\nTotal valid diagnostic reports = %d.\n", cdiagReport.pair[i].num_valid_result);
-			validResults = cdiagReport.pair[i].num_valid_result;
+		cli_parse(cmd, argc, argv, &ads);
 
-			if (validResults) {
-				cableLength = cdiagReport.pair[i].results[validResults - 1].distance - cdiagReport.pair[i].results[0].distance;
-				printf("\t%40s:\t%d\n", "Estimated distance of cable (in meters)", cableLength);
-				pairState = cdiagReport.pair[i].results[validResults - 1].state;
-				printf("\t%40s:\t%s\n", "Detected echo", ((pairState == 1) ? "REFLECTION" : (pairState == 2) ? "OPEN" : (pairState == 4) ? "SHORT" : (pairState == 8) ? "MATCHED" : "ERROR"));
-				printf("\t%40s:\t%d\n", "Echo coefficient of first detected peak", (s16)(cdiagReport.pair[i].results[validResults - 1].peak));
-			}
+		ret = gpy2xx_ads_cfg(&phy, &ads);
 
-			int k = 0;
+		if (ret < 0)
+			printf("\nERROR: Set Link's Auto Down Speed (ADS) mode failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ads_get: {
+		struct gpy211_ads_sta ads;
+		memset(&ads, 0, sizeof(struct gpy211_ads_sta));
 
-			for (k = 0; k < 3; k++) {
-				printf("\tThe sum-of-square of all XC%1d coefficients :\t%d\n", k, cdiagReport.pair[i].xc_pwr[k]);
-			}
+		ret = gpy2xx_ads_get(&phy, &ads);
 
+		if (ret < 0) {
+			printf("\nERROR: Get Link's Auto Down Speed (ADS) mode failed.\n");
+			return ret;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_abist_start", strlen("gpy2xx_abist_start")) == 0) {
-		int cnt = 0;
-		struct gpy211_abist_param abisTest;
-		memset(&abisTest, 0, sizeof(struct gpy211_abist_param));
 
-		cnt += scanParamArg(argc, argv, "enRestart", sizeof(abisTest.restart), &abisTest.restart);
-		cnt += scanParamArg(argc, argv, "enUartReport", sizeof(abisTest.uart_report), &abisTest.uart_report);
-		cnt += scanParamArg(argc, argv, "txTestMode", sizeof(abisTest.test), &abisTest.test);
+		printf("%s:\n", "Auto Downspeed Configur");
+		printf("\t%40s:\t%s\n", "Advertise all Speeds if No Energy Detected = ", ((ads.ads_ctrl.no_nrg_rst == 0) ? "Disable" : "Enable"));
+		printf("\t%40s:\t%s\n", "NBASE-T Downshift Enable = ", ((ads.ads_ctrl.downshift_en == 0) ? "Disable" : "Enable"));
+		printf("\t%40s:\t0x%x\n", "NBASE-T Downshift Training Counter Threshold = ", ads.ads_ctrl.downshift_thr);
+		printf("\t%40s:\t0x%x\n", "Force Reset of Downwshift Process = ", ads.ads_ctrl.force_rst);
+		printf("\t%40s:\t0x%x\n", "Timer to Reset the Downshift process = ", ads.ads_ctrl.nrg_rst_cnt);
+		printf("\n");
+		printf("%s:\n", "Auto Downspeed Status");
+		printf("\t%40s:\t0x%x\n", "ADS Training attempt counter = ", ads.downshift_cnt);
+		printf("\t%40s:\t0x%x\n", "ADS Downshift from 2G5 to lower speed = ", ads.downshift_2G5);
+		printf("\t%40s:\t0x%x\n", "ADS Downshift from 1G to lower speed = ", ads.downshift_1G);
+		break;
+	}
+	case CLI_CMD_gpy2xx_ulp_cfg: {
+		struct gpy211_ulp_ctrl ulp;
+		memset(&ulp, 0, sizeof(struct gpy211_ulp_ctrl));
 
-		ret = gpy2xx_abist_start(&phy, &abisTest);
+		cli_parse(cmd, argc, argv, &ulp);
+
+		ret = gpy2xx_ulp_cfg(&phy, &ulp);
 
 		if (ret < 0)
-			printf("\nERROR: ABIS test start failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_abist_read", strlen("gpy2xx_abist_read")) == 0) {
-		int i = 0, j = 0;
-		struct gpy211_abist_report abistReport;
-		memset(&abistReport, 0, sizeof(struct gpy211_abist_report));
+			printf("\nERROR: Set ULP mode failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_ulp_get: {
+		struct gpy211_ulp_ctrl ulp;
+		memset(&ulp, 0, sizeof(struct gpy211_ulp_ctrl));
 
-		ret = gpy2xx_abist_read(&phy, &abistReport);
+		ret = gpy2xx_ulp_get(&phy, &ulp);
 
 		if (ret < 0) {
-			printf("\nERROR: ABIS test result read failed.\n");
+			printf("\nERROR: ULP mode failed.\n");
 			return ret;
 		}
 
-		printf("\nReturned ABIS test results:\n----------------------------\n");
-
-		for (i = 0; i < 4; i++) {
-			printf("The ABIS test results for ASP %s\n", ((i == 0) ? "A" : (i == 1) ? "B" : (i == 2) ? "C" : "D"));
-			printf("\nIdle-Channel Noice GMax values\n");
-			printf("\t%40s:\t0x%x\n", "Magnetude Max", abistReport.pair[i].icn_gmax.mag_max);
-			printf("\t%40s:\t0x%x\n", "Magnetude Min", abistReport.pair[i].icn_gmax.mag_min);
-			printf("\t%40s:\t0x%x\n", "Magnetude Avg", abistReport.pair[i].icn_gmax.mag_avg);
-			printf("\t%40s:\t0x%x\n", "Magnetude DC", abistReport.pair[i].icn_gmax.mag_dc);
-			printf("\nIdle-Channel Noice GMin values\n");
-			printf("\t%40s:\t0x%x\n", "Magnetude Max", abistReport.pair[i].icn_gmin.mag_max);
-			printf("\t%40s:\t0x%x\n", "Magnetude Min", abistReport.pair[i].icn_gmin.mag_min);
-			printf("\t%40s:\t0x%x\n", "Magnetude Avg", abistReport.pair[i].icn_gmin.mag_avg);
-			printf("\t%40s:\t0x%x\n", "Magnetude DC", abistReport.pair[i].icn_gmin.mag_dc);
-
-			printf("\nAnalog Gain Control values\n");
-
-			for (j = 0; j < 6; j++) {
-				printf("\t%38s-%d:\t0x%x\n", "Agc-Pwr-", j, abistReport.pair[i].agc_hyb.agc_pwr[j]);
-			}
-
-			printf("\t%38s:\t0x%x\n", "Agc-Pwr-Mean", abistReport.pair[i].agc_hyb.agc_mean);
-			printf("\t%38s:\t0x%x\n", "Agc-Pwr-Std", abistReport.pair[i].agc_hyb.agc_std);
+		printf("\t%40s:\t%s\n", "ULP enable = ", ((ulp.ulp_en == 0) ? "Disable" : "Enable"));
+		printf("\t%40s:\t%s\n", "ULP station block = ", ((ulp.ulp_sta_block == 0) ? "Disable" : "Enable"));
+		break;
+	}
+	case CLI_CMD_gpy2xx_ads_detected: {
+		ret = gpy2xx_ads_detected(&phy);
 
-			printf("\n10BT details with hybrid OFF\n");
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_10bt.dc_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_10bt.nyq_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_10bt.k1_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_10bt.k2_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_10bt.k3_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_10bt.k4_mag);
+		if (ret == 1)
+			printf("\nLink Auto Down Speed detected.\n");
+		else if (ret == 0)
+			printf("\nLink Auto Down Speed not detected.\n");
+		else
+			printf("\nERROR: Link ADS detected state get failed.\n");
 
-			printf("\n100BT details with hybrid OFF\n");
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_100bt.dc_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_100bt.nyq_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_100bt.k1_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_100bt.k2_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_100bt.k3_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_100bt.k4_mag);
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_restart_aneg: {
+		int ret;
 
-			printf("\n1000BT details with hybrid ON\n");
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].hyb_1000bt.dc_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].hyb_1000bt.nyq_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].hyb_1000bt.k1_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].hyb_1000bt.k2_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].hyb_1000bt.k3_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].hyb_1000bt.k4_mag);
+		ret = gpy2xx_sgmii_restart_aneg(&phy);
 
-			printf("\n1000BT details with hybrid OFF\n");
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_1000bt.dc_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_1000bt.nyq_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_1000bt.k1_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_1000bt.k2_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_1000bt.k3_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_1000bt.k4_mag);
+		if (ret < 0)
+			printf("\nERROR: Restarting SGMII Auto-Negotiation failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_aneg_done: {
+		ret = gpy2xx_sgmii_aneg_done(&phy);
 
-			printf("\n2500BT details with hybrid ON\n");
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].hyb_2500bt.dc_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].hyb_2500bt.nyq_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].hyb_2500bt.k1_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].hyb_2500bt.k2_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].hyb_2500bt.k3_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].hyb_2500bt.k4_mag);
+		if (ret == 0)
+			printf("\nSGMII Auto-Negotiation pending.\n");
+		else if (ret == 1)
+			printf("\nSGMII Auto-Negotiation completed.\n");
+		else
+			printf("\nERROR: SGMII Auto-Negotiation polling failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_config_aneg: {
+		//char buf[256];
+		struct gpy211_sgmii sgmiiConfig;
+		memset(&sgmiiConfig, 0, sizeof(struct gpy211_sgmii));
 
-			printf("\n2500BT details with hybrid OFF\n");
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at DC", abistReport.pair[i].nohyb_2500bt.dc_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnitude at nyquist frequency", abistReport.pair[i].nohyb_2500bt.nyq_mag);
-			printf("\t%38s:\t0x%x\n", "FFT magnetude at fundamental frequency", abistReport.pair[i].nohyb_2500bt.k1_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K2", abistReport.pair[i].nohyb_2500bt.k2_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_2500bt.k3_mag);
-			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_2500bt.k4_mag);
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_loopback_cfg", strlen("gpy2xx_loopback_cfg")) == 0) {
-		int cnt = 0;
-		enum gpy211_test_loop loopMode;
+		cli_parse(cmd, argc, argv, &sgmiiConfig);
 
-		cnt += scanParamArg(argc, argv, "loopbackMode", sizeof(loopMode), &loopMode);
-		ret = gpy2xx_loopback_cfg(&phy, loopMode);
+		ret = gpy2xx_sgmii_config_aneg(&phy, &sgmiiConfig);
 
 		if (ret < 0)
-			printf("\nERROR: Set Loopback test mode failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_errcnt_cfg", strlen("gpy2xx_errcnt_cfg")) == 0) {
-		int cnt = 0;
-		enum gpy211_errcnt_event cntMode;
-
-		cnt += scanParamArg(argc, argv, "errCountMode", sizeof(cntMode), &cntMode);
-		ret = gpy2xx_errcnt_cfg(&phy, cntMode);
+			printf("\nERROR: Configuring SGMII Auto-Negotiation failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_read_status: {
+		char buf[256];
+		struct gpy211_sgmii sgmiiConfig;
+		memset(&sgmiiConfig, 0, sizeof(struct gpy211_sgmii));
+		ret = gpy2xx_sgmii_read_status(&phy, &sgmiiConfig);
 
 		if (ret < 0)
-			printf("\nERROR: Set Error or Event count mode failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_errcnt_read", strlen("gpy2xx_errcnt_read")) == 0) {
-		ret = gpy2xx_errcnt_read(&phy);
+			printf("\nERROR: Read SGMII link status failed.\n");
 
-		if (ret >= 0)
-			printf("\nError or Event counter = 0x%x.\n", ret);
-		else
-			printf("\nERROR: Get Error or Event count failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_pcs_status_read", strlen("gpy2xx_pcs_status_read")) == 0) {
-		struct gpy211_pcs_status pcsStatus;
-		memset(&pcsStatus, 0, sizeof(struct gpy211_pcs_status));
+		printf("\t%40s:\t%d\n", "SGMII Link configuration direction", sgmiiConfig.linkcfg_dir);
+		printf("\t%40s:\t%d\n", "SGMII ANEG Mode", sgmiiConfig.aneg_mode);
+		printf("\t%40s:\t%d\n", "EEE SGMII Capability is advertised in ANEG", sgmiiConfig.eee_enable);
 
-		ret = gpy2xx_pcs_status_read(&phy, &pcsStatus);
+		printf("\nPopulated link configuration parameters:\n----------------\n");
+		printf("\t%40s:\t%s\n", "Auto-Negotiation (AN) state", sgmiiConfig.link.autoneg ? "Enabled" : "Disabled");
+		printf("\t%40s:\t%d\n", "Link Speed or Partner Link Speed (AN)", sgmiiConfig.link.speed);
+		printf("\t%40s:\t%s\n", "Rate Adaptation (SGMII Fixed 2.5G)", sgmiiConfig.link.fixed2g5 ? "Enabled" : "Disabled");
 
-		if (ret < 0) {
-			printf("\nERROR: PCS status read failed.\n");
-			return ret;
+		if (sgmiiConfig.link.autoneg == 0) {
+			printf("\t%40s:\t%s\n", "Duplex (Forced) or Partner Duplex (AN)", sgmiiConfig.link.duplex ? "Full" : "Half");
 		}
 
-		printf("\nBASE-R or 10GBASE-T PCS Status:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Bit Error Rate (BER)", pcsStatus.ber);
-		printf("\t%40s:\t0x%x\n", "Number of Errored Blocks", pcsStatus.errored_block);
-		printf("\t%40s:\t0x%x\n", "Reporting high BER status", pcsStatus.high_ber);
-		printf("\t%40s:\t0x%x\n", "Received Block Lock status", pcsStatus.block_lock);
-		printf("\t%40s:\t0x%x\n", "Receive link status", pcsStatus.rcv_link_up);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_adjfreq", strlen("gpy2xx_ptp_adjfreq")) == 0) {
-		int cnt = 0;
-		s32 pbb = 0;
-
-		cnt += scanParamArg(argc, argv, "pbbTime", sizeof(int), &pbb);
+		printf("\t%40s:\t%s\n", "Most recently read link state", sgmiiConfig.link.link ? "Up" : "Down");
+		print_advert(buf, sizeof(buf), sgmiiConfig.link.supported);
+		printf("\t%40s:\t0x%llx (%s)\n", "GPHY supported modes", sgmiiConfig.link.supported, buf);
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_opmode: {
+		enum gpy211_sgmii_operation opMode = 0;
 
-		ret = gpy2xx_ptp_adjfreq(&phy, pbb);
+		cli_parse(cmd, argc, argv, &opMode);
+		ret = gpy2xx_sgmii_opmode(&phy, opMode);
 
 		if (ret < 0)
-			printf("\nERROR: Set PTP Frequency adjusting/modify failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_adjtime", strlen("gpy2xx_ptp_adjtime")) == 0) {
-		int cnt = 0;
-		s64 delta;
+			printf("\nERROR: Set SGMII operation mode failed.\n");
+		break;
+	}
+	case CLI_CMD_gpy2xx_pvt_get: {
+		struct gpy211_pvt sensInfo;
 
-		cnt += scanParamArg(argc, argv, "deltaTime", sizeof(delta), &delta);
+		memset(&sensInfo, 0, sizeof(struct gpy211_pvt));
+		ret = gpy2xx_pvt_get(&phy, &sensInfo);
 
-		ret = gpy2xx_ptp_adjtime(&phy, delta);
+		if (ret < 0)
+			printf("\nERROR: Get SENSOR temparature failed.\n");
+
+		printf("\t%s:\t%d\n", "Sensor temparature", sensInfo.temperature);
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_pm_hw_reset: {
+		ret = gpy2xx_gmacx_pm_hw_reset(&phy);
 
 		if (ret < 0)
-			printf("\nERROR: Adjust PTP System Time failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_gettime", strlen("gpy2xx_ptp_gettime")) == 0) {
-		struct timespec64 refTime;
-		memset(&refTime, 0, sizeof(struct timespec64));
+			printf("\nERROR: PM level HW reset failed.\n");
 
-		ret = gpy2xx_ptp_gettime(&phy, &refTime);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_macsec_enable: {
+		struct gpy211_macsec msec_cfg;
+		memset(&msec_cfg, 0, sizeof(struct gpy211_macsec));
+
+		cli_parse(cmd, argc, argv, &msec_cfg);
+
+		ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
 
 		if (ret < 0) {
-			printf("\nGet PTP System Time failed.\n");
-			return ret;
+			printf("\nERROR: MACsec enable failed.\n");
+			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_macsec_disable: {
+		ret = gpy2xx_macsec_disable(&phy);
 
-		printf("\t%s: %llx, \t%lx\n", "PTP system time sec n nsec", refTime.tv_sec, refTime.tv_nsec);
-		print_sys_time(refTime.tv_sec, refTime.tv_nsec);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_settime", strlen("gpy2xx_ptp_settime")) == 0) {
-		int cnt = 0;
-		struct timespec64 ts;
-		memset(&ts, 0, sizeof(struct timespec64));
+		if (ret < 0) {
+			printf("\nERROR: MACsec disable set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_pm_pdi_cfg: {
+		struct pm_config pm_cfg;
+		memset(&pm_cfg, 0, sizeof(struct pm_config));
 
-		cnt += scanParamArg(argc, argv, "initSec", 64, &ts.tv_sec);
-		cnt += scanParamArg(argc, argv, "initNsec", sizeof(ts.tv_nsec), &ts.tv_nsec);
+		ret = gpy2xx_gmacx_pm_pdi_get(&phy, &pm_cfg);
 
-		ret = gpy2xx_ptp_settime(&phy, &ts);
+		if (ret < 0) {
+			printf("\nERROR: PM cfg info get failed.\n");
+			return -1;
+		}
 
-		printf("\nInfo: Current Unix Epoch Clock from \"https://www.epochconverter.com/clock\"\n");
-		if (ret < 0)
-			printf("\nERROR: Set PTP System Time failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_enable", strlen("gpy2xx_ptp_enable")) == 0) {
-		u16 data;
-		time64_t corr_time;
-		int cnt = 0;
-		struct gpy211_ptp_ctrl ptpCfg;
-		memset(&ptpCfg, 0, sizeof(struct gpy211_ptp_ctrl));
+		cli_parse(cmd, argc, argv, &pm_cfg);
 
-		cnt += scanParamArg(argc, argv, "enPhyTxTs", sizeof(data), &data);
-		ptpCfg.tx_ts_phy = data;
-		cnt += scanParamArg(argc, argv, "enPhyRxTs", sizeof(data), &data);
-		ptpCfg.rx_ts_phy = data;
-		cnt += scanParamArg(argc, argv, "txPtpOffset", sizeof(data), &data);
-		ptpCfg.tx_ptp_off = data;
-		cnt += scanParamArg(argc, argv, "txPtpProto", sizeof(data), &data);
-		ptpCfg.tx_ptp_tpt = data;
-		cnt += scanParamArg(argc, argv, "enTxOstcEn", sizeof(data), &data);
-		ptpCfg.ts_ostc_en = data;
-		cnt += scanParamArg(argc, argv, "txOstCorTime", sizeof(corr_time), &corr_time);
-		ptpCfg.tx_ost_corr = corr_time;
+		ret = gpy2xx_gmacx_pm_pdi_cfg(&phy, &pm_cfg);
 
-		ret = gpy2xx_ptp_enable(&phy, &ptpCfg);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full MAC cfg info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_pm_pdi_get: {
+		struct pm_config pm_cfg;
+		memset(&pm_cfg, 0, sizeof(struct pm_config));
 
-		if (ret < 0)
-			printf("\nERROR: PTP enable failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_disable", strlen("gpy2xx_ptp_disable")) == 0) {
-		ret = gpy2xx_ptp_disable(&phy);
+		ret = gpy2xx_gmacx_pm_pdi_get(&phy, &pm_cfg);
 
-		if (ret < 0)
-			printf("\nERROR: PTP disable failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_getcfg", strlen("gpy2xx_ptp_getcfg")) == 0) {
-		struct gpy211_ptp_cfg ptpCfg;
-		memset(&ptpCfg, 0, sizeof(struct gpy211_ptp_cfg));
+		if (ret < 0) {
+			printf("\nERROR: PM cfg info get failed.\n");
+			return -1;
+		}
 
-		ret = gpy2xx_ptp_getcfg(&phy, &ptpCfg);
+		printf("\t%40s:\t0x%x\n", "Bypass GMAC", pm_cfg.bypass_gmac);
+		printf("\t%40s:\t0x%x\n", "Bypass MACSec", pm_cfg.bypass_macsec);
+		printf("\t%40s:\t0x%x\n", "Discard CRC error pkts", pm_cfg.drop_on_crc_err);
+		printf("\t%40s:\t0x%x\n", "Discard PKT error pkts", pm_cfg.drop_on_pkt_err);
+		printf("\t%40s:\t0x%x\n", "Discard SEC fail pkts", pm_cfg.drop_on_sec_fail);
+		printf("\t%40s:\t0x%x\n", "Classification Drop pkts", pm_cfg.class_drop);
+		printf("\t%40s:\t0x%x\n", "Custom3G Speed enable", pm_cfg.cust_3g_en);
+		printf("\t%40s:\t0x%x\n", "SGMII Loopback enable", pm_cfg.sgmii_lb_en);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pm_cfg: {
+		struct pm_gmac_cfg gmac_ctrl;
+		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
+
+		ret = gpy2xx_gmacf_pm_get(&phy, &gmac_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Get PTP TS configuration failed.\n");
-			return ret;
+			printf("\nERROR: PM GMAC-Full info get failed.\n");
+			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "enPhyTxTs", ptpCfg.ptp_ctrl.tx_ts_phy);
-		printf("\t%40s:\t0x%x\n", "enPhyRxTs", ptpCfg.ptp_ctrl.rx_ts_phy);
-		printf("\t%40s:\t0x%x\n", "txPtpOffset", ptpCfg.ptp_ctrl.tx_ptp_off);
-		printf("\t%40s:\t0x%x\n", "txPtpProto", ptpCfg.ptp_ctrl.tx_ptp_tpt);
-		printf("\t%40s:\t0x%x\n", "enTxOstcEn", ptpCfg.ptp_ctrl.ts_ostc_en);
-		printf("\t%40s:\t0x%llx\n", "txOstCorTime", ptpCfg.ptp_ctrl.tx_ost_corr);
-
-		printf("\t%40s:\t0x%x\n", "enEvntMsg", ptpCfg.ts_ctrl.ts_evtmsg_en);
-		printf("\t%40s:\t0x%x\n", "enMstrMsg", ptpCfg.ts_ctrl.ts_master_en);
-		printf("\t%40s:\t0x%x\n", "snapType", ptpCfg.ts_ctrl.snap_type);
+		cli_parse(cmd, argc, argv, &gmac_ctrl);
 
-		printf("\t%40s:\t0x%x\n", "ppsCtrlLow", ptpCfg.pps_ctrl.ppsctrl_low.raw_pps_ctrl_low);
-		printf("\t%40s:\t0x%x\n", "targetSec", ptpCfg.pps_ctrl.sec_tgttime);
-		printf("\t%40s:\t0x%x\n", "targetNsc", ptpCfg.pps_ctrl.nsec_tgttime);
-		printf("\t%40s:\t0x%x\n", "ppsInterval", ptpCfg.pps_ctrl.pps0_interal);
-		printf("\t%40s:\t0x%x\n", "ppsWidth", ptpCfg.pps_ctrl.pps0_width);
+		ret = gpy2xx_gmacf_pm_cfg(&phy, &gmac_ctrl);
 
-		printf("\t%40s:\t0x%x\n", "ptoCtrlLow", ptpCfg.pto_ctrl.ptoctrl_low.raw_pto_ctrl_low);
-		printf("\t%40s:\t%2x%2x%2x%2x%2x%2x%2x%2x%2x%2x\n", "srcPortID", ptpCfg.pto_ctrl.sport_id[0], ptpCfg.pto_ctrl.sport_id[1], ptpCfg.pto_ctrl.sport_id[2], ptpCfg.pto_ctrl.sport_id[3], ptpCfg.pto_ctrl.sport_id[4], ptpCfg.pto_ctrl.sport_id[5], ptpCfg.pto_ctrl.sport_id[6], ptpCfg.pto_ctrl.sport_id[7], ptpCfg.pto_ctrl.sport_id[8], ptpCfg.pto_ctrl.sport_id[9]);
-		printf("\t%40s:\t0x%x\n", "logmLvlLow", ptpCfg.pto_ctrl.logmsg_lvl.raw_logm_lvl_low);
-		printf("\t%40s:\t0x%x\n", "logmLvlHi", ptpCfg.pto_ctrl.logmsg_lvl.raw_logm_lvl_hi);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_set_tsctrl", strlen("gpy2xx_ptp_set_tsctrl")) == 0) {
-		u16 data;
-		int cnt = 0;
-		struct gpy2xx_ts_ctrl tsCfg;
-		memset(&tsCfg, 0, sizeof(struct gpy2xx_ts_ctrl));
+		if (ret < 0) {
+			printf("\nERROR: PM GMAC-Full info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pm_get: {
+		struct pm_gmac_cfg gmac_ctrl;
+		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
-		cnt += scanParamArg(argc, argv, "enEvntMsg", sizeof(data), &data);
-		tsCfg.ts_evtmsg_en = data;
-		cnt += scanParamArg(argc, argv, "enMstrMsg", sizeof(data), &data);
-		tsCfg.ts_master_en = data;
-		cnt += scanParamArg(argc, argv, "snapType", sizeof(data), &data);
-		tsCfg.snap_type = data;
+		ret = gpy2xx_gmacf_pm_get(&phy, &gmac_ctrl);
 
-		ret = gpy2xx_ptp_set_tsctrl(&phy, &tsCfg);
+		if (ret < 0) {
+			printf("\nERROR: PM GMAC-Full info get failed.\n");
+			return -1;
+		}
 
-		if (ret < 0)
-			printf("\nERROR: Set PTP TS configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_set_ppsctrl", strlen("gpy2xx_ptp_set_ppsctrl")) == 0) {
-		int cnt = 0;
-		struct gpy2xx_pps_ctrl ppsCfg;
-		memset(&ppsCfg, 0, sizeof(struct gpy2xx_pps_ctrl));
+		printf("\t%40s:\t0x%x\n", "GMAC CRC and Pad Control", gmac_ctrl.crc_pad_ctrl);
+		printf("\t%40s:\t0x%x\n", "GMAC Tx Error Input", gmac_ctrl.tx_err_input);
+		printf("\t%40s:\t0x%x\n", "Data Endianness", gmac_ctrl.big_endian);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pm_cfg: {
+		struct pm_gmac_cfg gmac_ctrl;
+		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
-		ret = gpy2xx_ptp_get_ppsctrl(&phy, &ppsCfg);
+		ret = gpy2xx_gmacl_pm_get(&phy, &gmac_ctrl);
 
 		if (ret < 0) {
-			LOG_CRIT("ERROR: api gpy2xx_ptp_get_ppsctrl fails\n");
-			return ret;
+			printf("\nERROR: PM GMAC-Full info get failed.\n");
+			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "ppsCtrlLow", sizeof(ppsCfg.ppsctrl_low.raw_pps_ctrl_low), &ppsCfg.ppsctrl_low.raw_pps_ctrl_low);
-		cnt += scanParamArg(argc, argv, "targetSec", sizeof(ppsCfg.sec_tgttime), &ppsCfg.sec_tgttime);
-		cnt += scanParamArg(argc, argv, "targetNsc", sizeof(ppsCfg.nsec_tgttime), &ppsCfg.nsec_tgttime);
-		cnt += scanParamArg(argc, argv, "ppsInterval", sizeof(ppsCfg.pps0_interal), &ppsCfg.pps0_interal);
-		cnt += scanParamArg(argc, argv, "ppsWidth", sizeof(ppsCfg.pps0_width), &ppsCfg.pps0_width);
-		cnt += scanParamArg(argc, argv, "gpcSel", sizeof(ppsCfg.gpc_sel), &ppsCfg.gpc_sel);
+		cli_parse(cmd, argc, argv, &gmac_ctrl);
 
-		ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppsCfg);
+		ret = gpy2xx_gmacl_pm_cfg(&phy, &gmac_ctrl);
 
-		if (ret < 0)
-			printf("\nERROR: Set PPS configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "test_gpy2xx_ptp_set_ppsctrl", strlen("test_gpy2xx_ptp_set_ppsctrl")) == 0) {
-		int cnt = 0;
-		struct gpy2xx_pps_ctrl ppsCfg;
-		memset(&ppsCfg, 0, sizeof(struct gpy2xx_pps_ctrl));
-		struct timespec64 refTime;
-		memset(&refTime, 0, sizeof(struct timespec64));
+		if (ret < 0) {
+			printf("\nERROR: PM GMAC-Full info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pm_get: {
+		struct pm_gmac_cfg gmac_ctrl;
+		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
-		ret = gpy2xx_ptp_gettime(&phy, &refTime);
+		ret = gpy2xx_gmacl_pm_get(&phy, &gmac_ctrl);
 
 		if (ret < 0) {
-			printf("\nGet PTP System Time failed.\n");
-			return ret;
+			printf("\nERROR: PM GMAC-Full info get failed.\n");
+			return -1;
 		}
 
-		ret = gpy2xx_ptp_get_ppsctrl(&phy, &ppsCfg);
+		printf("\t%40s:\t0x%x\n", "GMAC CRC and Pad Control", gmac_ctrl.crc_pad_ctrl);
+		printf("\t%40s:\t0x%x\n", "GMAC Tx Error Input", gmac_ctrl.tx_err_input);
+		printf("\t%40s:\t0x%x\n", "Data Endianness", gmac_ctrl.big_endian);
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_cfg: {
+		struct lpi_cfg lpi_ctrl;
+		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
+
+		ret = gpy2xx_gmacf_lpi_get(&phy, &lpi_ctrl);
 
 		if (ret < 0) {
-			LOG_CRIT("ERROR: api gpy2xx_ptp_get_ppsctrl fails\n");
-			return ret;
+			printf("\nERROR: PM GMAC-Full LPI info get failed.\n");
+			return -1;
 		}
 
-		ppsCfg.sec_tgttime = refTime.tv_sec + 15;
-		ppsCfg.nsec_tgttime = 0x0; //refTime.tv_nsec;
-		printf("\n\t%s: %x, \t%x\n", "Set time sec n nsec", ppsCfg.sec_tgttime, ppsCfg.nsec_tgttime);
-		cnt += scanParamArg(argc, argv, "gpcSel", sizeof(ppsCfg.gpc_sel), &ppsCfg.gpc_sel);
-		ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppsCfg);
+		cli_parse(cmd, argc, argv, &lpi_ctrl);
 
-		if (ret < 0)
-			printf("\nERROR: Test PPS configuration feature failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_set_ptoctrl", strlen("gpy2xx_ptp_set_ptoctrl")) == 0) {
-		int cnt = 0;
-		struct gpy2xx_pto_ctrl ptoCfg;
-		memset(&ptoCfg, 0, sizeof(struct gpy2xx_pto_ctrl));
+		ret = gpy2xx_gmacf_lpi_cfg(&phy, &lpi_ctrl);
 
-		cnt += scanParamArg(argc, argv, "ptoCtrlLow", sizeof(ptoCfg.ptoctrl_low.raw_pto_ctrl_low), &ptoCfg.ptoctrl_low.raw_pto_ctrl_low);
-		cnt += scanKey_Arg(argc, argv, "srcPortID", 10, (char *)ptoCfg.sport_id);
-		cnt += scanParamArg(argc, argv, "logmLvlLow", sizeof(ptoCfg.logmsg_lvl.raw_logm_lvl_low), &ptoCfg.logmsg_lvl.raw_logm_lvl_low);
-		cnt += scanParamArg(argc, argv, "logmLvlHi", sizeof(ptoCfg.logmsg_lvl.raw_logm_lvl_hi), &ptoCfg.logmsg_lvl.raw_logm_lvl_hi);
+		if (ret < 0) {
+			printf("\nERROR: PM GMAC-Full LPI info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_get: {
+		struct lpi_cfg lpi_ctrl;
+		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
-		ret = gpy2xx_ptp_set_ptoctrl(&phy, &ptoCfg);
+		ret = gpy2xx_gmacf_lpi_get(&phy, &lpi_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Set PTO configuration failed.\n");
+			printf("\nERROR: PM GMAC-Full LPI info get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_fifostat", strlen("gpy2xx_ptp_fifostat")) == 0) {
-		struct gpy211_ts_fifo_stat fifoStatus;
-		memset(&fifoStatus, 0, sizeof(struct gpy211_ts_fifo_stat));
 
-		ret = gpy2xx_ptp_fifostat(&phy, &fifoStatus);
+		printf("\t%40s:\t0x%x\n", "LPI Interrupt Enable", lpi_ctrl.lpi_int_en);
+		printf("\t%40s:\t0x%x\n", "LPI Enable", lpi_ctrl.lpi_en);
+		printf("\t%40s:\t0x%x\n", "PHY Link Status", lpi_ctrl.phy_link_status);
+		printf("\t%40s:\t0x%x\n", "LPI Tx Automate", lpi_ctrl.lpi_tx_auto);
+		printf("\t%40s:\t0x%x\n", "LPI Timer Enable", lpi_ctrl.lpi_timer_en);
+		printf("\t%40s:\t0x%x\n", "LPI Tx Clock Stop Enable", lpi_ctrl.lpi_tx_clk_stop_en);
+		printf("\t%40s:\t0x%x\n", "1US TIC Counter", lpi_ctrl.ous_tic_time);
+		printf("\t%40s:\t0x%x\n", "LPI TW Timer (in milliseconds)", lpi_ctrl.lpi_tw_time);
+		printf("\t%40s:\t0x%x\n", "LPI LS Timer (in milliseconds)", lpi_ctrl.lpi_ls_time);
+		printf("\t%40s:\t0x%x\n", "LPI Entry Timer (in milliseconds)", lpi_ctrl.lpi_entry_time);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_lpi_cfg: {
+		struct lpi_cfg lpi_ctrl;
+		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
+
+		ret = gpy2xx_gmacl_lpi_get(&phy, &lpi_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Get PTP TS Status failed.\n");
-			return ret;
+			printf("\nERROR: PM GMAC-Lite LPI info get failed.\n");
+			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "rxOverflow", fifoStatus.rx_ovfl);
-		printf("\t%40s:\t0x%x\n", "rxUnderflow", fifoStatus.rx_udfl);
-		printf("\t%40s:\t0x%x\n", "rxFillLevel", fifoStatus.rx_fill_lvl);
-		printf("\t%40s:\t0x%x\n", "txFillLevel", fifoStatus.tx_fill_lvl);
-		printf("\t%40s:\t0x%x\n", "txOverflow", fifoStatus.tx_ovfl);
-		printf("\t%40s:\t0x%x\n", "txUnderflow", fifoStatus.tx_udfl);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_resetfifo", strlen("gpy2xx_ptp_resetfifo")) == 0) {
-		ret = gpy2xx_ptp_resetfifo(&phy);
+		cli_parse(cmd, argc, argv, &lpi_ctrl);
 
-		if (ret < 0)
-			printf("\nERROR: TS's FIFO reset failed.\n");
+		ret = gpy2xx_gmacl_lpi_cfg(&phy, &lpi_ctrl);
 
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_txtsstat", strlen("gpy2xx_ptp_txtsstat")) == 0) {
-		struct gpy211_ts_stat tsStatus;
-		memset(&tsStatus, 0, sizeof(struct gpy211_ts_stat));
+		if (ret < 0) {
+			printf("\nERROR: PM GMAC-Lite LPI info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_lpi_get: {
+		struct lpi_cfg lpi_ctrl;
+		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
-		ret = gpy2xx_ptp_txtsstat(&phy, &tsStatus);
+		ret = gpy2xx_gmacl_lpi_get(&phy, &lpi_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: Get PTP Tx TS Status failed.\n");
-			return ret;
+			printf("\nERROR: PM GMAC-Lite LPI info get failed.\n");
+			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Tx TS Stat low", tsStatus.tss_low.raw_ts_stat_low);
-		printf("\t%40s:\t0x%x\n", "Tx TS Stat low", tsStatus.tss_high.raw_ts_stat_hi);
-		printf("\t%40s:\t0x%llx\n", "Tx TS (in nsec)", (u64)(tsStatus.txts_stat.txtss_sec * 0x3B9ACA00 + tsStatus.txts_stat.txtss_nsec));
-		printf("\t%40s:\t0x%x\n", "Tx TS Stat missed", tsStatus.txts_stat.txtss_mis);
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_getrxts", strlen("gpy2xx_ptp_getrxts")) == 0) {
-		struct gpy211_rx_ts rxTs;
-		memset(&rxTs, 0, sizeof(struct gpy211_rx_ts));
+		printf("\t%40s:\t0x%x\n", "LPI Interrupt Enable", lpi_ctrl.lpi_int_en);
+		printf("\t%40s:\t0x%x\n", "LPI Enable", lpi_ctrl.lpi_en);
+		printf("\t%40s:\t0x%x\n", "PHY Link Status", lpi_ctrl.phy_link_status);
+		printf("\t%40s:\t0x%x\n", "LPI Tx Automate", lpi_ctrl.lpi_tx_auto);
+		printf("\t%40s:\t0x%x\n", "LPI Timer Enable", lpi_ctrl.lpi_timer_en);
+		printf("\t%40s:\t0x%x\n", "LPI Tx Clock Stop Enable", lpi_ctrl.lpi_tx_clk_stop_en);
+		printf("\t%40s:\t0x%x\n", "1US TIC Counter", lpi_ctrl.ous_tic_time);
+		printf("\t%40s:\t0x%x\n", "LPI TW Timer (in milliseconds)", lpi_ctrl.lpi_tw_time);
+		printf("\t%40s:\t0x%x\n", "LPI LS Timer (in milliseconds)", lpi_ctrl.lpi_ls_time);
+		printf("\t%40s:\t0x%x\n", "LPI Entry Timer (in milliseconds)", lpi_ctrl.lpi_entry_time);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_stat_get: {
+		struct lpi_status lpi_stat;
+		memset(&lpi_stat, 0, sizeof(struct lpi_status));
 
-		ret = gpy2xx_ptp_getrxts(&phy, &rxTs);
+		ret = gpy2xx_gmacf_lpi_stat_get(&phy, &lpi_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: Get PTP Receive Packet TimeStamp status and CRC failed.\n");
-			return ret;
+			printf("\nERROR: GMAC-Full LPI status get failed.\n");
+			return -1;
 		}
 
-		printf("\t%s:\t0x%llx\n", "PTP Receive Packet TimeStamp status", rxTs.rx_ts_stat);
-		print_sys_time(rxTs.rx_ts_stat / 1000000000ULL, rxTs.rx_ts_stat % 1000000000ULL);
-		printf("\t%s:\t0x%x\n", "PTP Receive Packet CRC ", rxTs.rx_crc_stat);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ptp_gettxts", strlen("gpy2xx_ptp_gettxts")) == 0) {
-		struct gpy211_tx_ts txTs;
-		memset(&txTs, 0, sizeof(struct gpy211_tx_ts));
+		printf("\t%40s:\t0x%x\n", "LPI Interrupt Status", lpi_stat.lpi_int_status);
+		printf("\t%40s:\t0x%x\n", "Tx LPI Entry hit", lpi_stat.tx_lpi_entry);
+		printf("\t%40s:\t0x%x\n", "Tx LPI Exit hit", lpi_stat.tx_lpi_exit);
+		printf("\t%40s:\t0x%x\n", "Rx LPI Entry hit", lpi_stat.rx_lpi_entry);
+		printf("\t%40s:\t0x%x\n", "Rx LPI Exit hit", lpi_stat.rx_lpi_exit);
+		printf("\t%40s:\t0x%x\n", "Tx LPI State", lpi_stat.tx_lpi_state);
+		printf("\t%40s:\t0x%x\n", "Rx LPI State", lpi_stat.rx_lpi_state);
+		printf("\t%40s:\t0x%x\n", "GMAC-Full's LPI state", lpi_stat.full_lpi_status);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_lpi_stat_get: {
+		struct lpi_status lpi_stat;
+		memset(&lpi_stat, 0, sizeof(struct lpi_status));
 
-		ret = gpy2xx_ptp_gettxts(&phy, &txTs);
+		ret = gpy2xx_gmacl_lpi_stat_get(&phy, &lpi_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: Get PTP Trasmit Packet TimeStamp status and CRC failed.\n");
-			return ret;
+			printf("\nERROR: GMAC-Lite LPI status get failed.\n");
+			return -1;
 		}
 
-		printf("\t%s:\t0x%llx\n", "PTP Trasmit Packet TimeStamp status", txTs.tx_ts_stat);
-		print_sys_time(txTs.tx_ts_stat / 1000000000ULL, txTs.tx_ts_stat % 1000000000ULL);
-		printf("\t%s:\t0x%x\n", "PTP Trasmit Packet CRC ", txTs.tx_crc_stat);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_synce_cfg", strlen("gpy2xx_synce_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_synce synceCfg;
-		memset(&synceCfg, 0, sizeof(struct gpy211_synce));
-
-		cnt += scanParamArg(argc, argv, "enSyncE", sizeof(synceCfg.synce_enable), &synceCfg.synce_enable);
-		cnt += scanParamArg(argc, argv, "synceRefClk", sizeof(synceCfg.synce_refclk), &synceCfg.synce_refclk);
-		cnt += scanParamArg(argc, argv, "masterSlave", sizeof(synceCfg.master_sel), &synceCfg.master_sel);
-		cnt += scanParamArg(argc, argv, "dataRate", sizeof(synceCfg.data_rate), &synceCfg.data_rate);
-		cnt += scanParamArg(argc, argv, "gpcSel", sizeof(synceCfg.gpc_sel), &synceCfg.gpc_sel);
+		printf("\t%40s:\t0x%x\n", "LPI Interrupt Status", lpi_stat.lpi_int_status);
+		printf("\t%40s:\t0x%x\n", "Tx LPI Entry hit", lpi_stat.tx_lpi_entry);
+		printf("\t%40s:\t0x%x\n", "Tx LPI Exit hit", lpi_stat.tx_lpi_exit);
+		printf("\t%40s:\t0x%x\n", "Rx LPI Entry hit", lpi_stat.rx_lpi_entry);
+		printf("\t%40s:\t0x%x\n", "Rx LPI Exit hit", lpi_stat.rx_lpi_exit);
+		printf("\t%40s:\t0x%x\n", "Tx LPI State", lpi_stat.tx_lpi_state);
+		printf("\t%40s:\t0x%x\n", "Rx LPI State", lpi_stat.rx_lpi_state);
+		printf("\t%40s:\t0x%x\n", "GMAC-Lite's LPI state", lpi_stat.lite_lpi_status);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_imask_cfg: {
+		struct lpi_int_mask lpi_imask;
+		memset(&lpi_imask, 0, sizeof(struct lpi_int_mask));
 
-		ret = gpy2xx_synce_cfg(&phy, &synceCfg);
+		ret = gpy2xx_gmacf_lpi_imask_get(&phy, &lpi_imask);
 
 		if (ret < 0) {
-			printf("\nERROR: Set SyncE configuration failed.\n");
-			return ret;
+			printf("\nERROR: GMAC-Full LPI interrupt mask get failed.\n");
+			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_synce_get", strlen("gpy2xx_synce_get")) == 0) {
-		struct gpy211_synce synceCfg;
-		memset(&synceCfg, 0, sizeof(struct gpy211_synce));
 
-		ret = gpy2xx_synce_get(&phy, &synceCfg);
+		cli_parse(cmd, argc, argv, &lpi_imask);
 
-		if (ret < 0)
-			printf("\nERROR: Get SyncE configuration failed.\n");
+		ret = gpy2xx_gmacf_lpi_imask_cfg(&phy, &lpi_imask);
 
-		printf("\t%40s:\t0x%x\n", "enSyncE", synceCfg.synce_enable);
-		printf("\t%40s:\t0x%x\n", "synceRefClk", synceCfg.synce_refclk);
-		printf("\t%40s:\t0x%x\n", "masterSlave", synceCfg.master_sel);
-		printf("\t%40s:\t0x%x\n", "dataRate", synceCfg.data_rate);
-		printf("\t%40s:\t0x%x\n", "gpcSel", synceCfg.gpc_sel);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_wol_cfg", strlen("gpy2xx_wol_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_wolinfo wolInfo;
-		memset(&wolInfo, 0, sizeof(struct gpy211_wolinfo));
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full LPI interrupt mask set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_imask_get: {
+		struct lpi_int_mask lpi_imask;
+		memset(&lpi_imask, 0, sizeof(struct lpi_int_mask));
 
-		cnt += scanParamArg(argc, argv, "wolOptions", sizeof(wolInfo.wolopts), &wolInfo.wolopts);
-		cnt += scanMAC_Arg(argc, argv, "wolMAC", wolInfo.mac);
-		cnt += scanMAC_Arg(argc, argv, "wolPassword", wolInfo.sopass);
+		ret = gpy2xx_gmacf_lpi_imask_get(&phy, &lpi_imask);
 
-		ret = gpy2xx_wol_cfg(&phy, &wolInfo);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full LPI interrupt mask get failed.\n");
+			return -1;
+		}
 
-		if (ret < 0)
-			printf("\nERROR: Set WOL configuration failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_wol_get", strlen("gpy2xx_wol_get")) == 0) {
-		struct gpy211_wolinfo wolInfo;
-		memset(&wolInfo, 0, sizeof(struct gpy211_wolinfo));
+		printf("\t%40s:\t0x%x\n", "Rx LPI microsecond counter interrupt mask", lpi_imask.rx_lpi_usc_im);
+		printf("\t%40s:\t0x%x\n", "Rx LPI transition counter interrupt mask", lpi_imask.rx_lpi_tc_im);
+		printf("\t%40s:\t0x%x\n", "Tx LPI microsecond counter interrupt mask", lpi_imask.tx_lpi_usc_im);
+		printf("\t%40s:\t0x%x\n", "Tx LPI transition counter interrupt mask", lpi_imask.tx_lpi_tc_im);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_istat_get: {
+		struct lpi_int_status lpi_istat;
+		memset(&lpi_istat, 0, sizeof(struct lpi_int_status));
 
-		ret = gpy2xx_wol_get(&phy, &wolInfo);
+		ret = gpy2xx_gmacf_lpi_istat_get(&phy, &lpi_istat);
 
 		if (ret < 0) {
-			printf("\nERROR: Get WOL configuration failed.\n");
-			return ret;
+			printf("\nERROR: GMAC-Full LPI interrupt status get failed.\n");
+			return -1;
 		}
 
-		printf("\nWake-On-Lan configuration parameters:\n----------------\n");
-		printf("\t%s:\t0x%x\n", "WOL flags supported", phy.wol_supported);
-		printf("\t%s:\t0x%x\n", "WOL flags set", wolInfo.wolopts);
-		printf("\t%s:\t", "WOL device MAC");
-		printMAC_Address(wolInfo.mac);
-		printf("\n");
-		printf("\t%s:\t", "WOL device SecureOn password");
-		printMAC_Address(wolInfo.sopass);
-		printf("\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ads_cfg", strlen("gpy2xx_ads_cfg")) == 0) {
-		struct gpy211_ads_ctrl ads;
-		memset(&ads, 0, sizeof(struct gpy211_ads_ctrl));
-
-		if (scanParamArg(argc, argv, "advertise_enable", sizeof(ads.no_nrg_rst), &ads.no_nrg_rst) == 0)
-			ads.no_nrg_rst = 0;
-
-		if (scanParamArg(argc, argv, "NBaseT_ds_enable", sizeof(ads.downshift_en), &ads.downshift_en) == 0)
-			ads.downshift_en = 0;
+		printf("\t%40s:\t0x%x\n", "Rx LPI microsecond counter interrupt status", lpi_istat.rx_lpi_usc_is);
+		printf("\t%40s:\t0x%x\n", "Rx LPI transition counter interrupt status", lpi_istat.rx_lpi_tc_is);
+		printf("\t%40s:\t0x%x\n", "Tx LPI microsecond counter interrupt status", lpi_istat.tx_lpi_usc_is);
+		printf("\t%40s:\t0x%x\n", "Tx LPI transition counter interrupt status", lpi_istat.tx_lpi_tc_is);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_count_get: {
+		struct lpi_counters lpi_cntr;
+		memset(&lpi_cntr, 0, sizeof(struct lpi_counters));
 
+		ret = gpy2xx_gmacf_lpi_count_get(&phy, &lpi_cntr);
 
-		if (scanParamArg(argc, argv, "downshift_cnt_thr", sizeof(ads.downshift_thr), &ads.downshift_thr) == 0)
-			ads.downshift_thr = 0;
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full LPI counters get failed.\n");
+			return -1;
+		}
 
-		if (scanParamArg(argc, argv, "force_reset", sizeof(ads.force_rst), &ads.force_rst) == 0)
-			ads.force_rst = 0;
+		printf("\t%40s:\t0x%x\n", "Tx LPI Microseconds Counter", lpi_cntr.tx_lpi_usc);
+		printf("\t%40s:\t0x%x\n", "Tx LPI Transition Counters", lpi_cntr.tx_lpi_usc);
+		printf("\t%40s:\t0x%x\n", "Rx LPI Microseconds Counter", lpi_cntr.rx_lpi_usc);
+		printf("\t%40s:\t0x%x\n", "Rx LPI Transition Counter", lpi_cntr.rx_lpi_trc);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_cfg: {
+		struct gmac_cfg mac_cfg;
+		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
-		if (scanParamArg(argc, argv, "rst_cntdown_timer", sizeof(ads.nrg_rst_cnt), &ads.nrg_rst_cnt) == 0)
-			ads.nrg_rst_cnt = 0;
+		ret = gpy2xx_gmacf_get(&phy, &mac_cfg);
 
-		ret = gpy2xx_ads_cfg(&phy, &ads);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full MAC cfg info get failed.\n");
+			return -1;
+		}
 
-		if (ret < 0)
-			printf("\nERROR: Set Link's Auto Down Speed (ADS) mode failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ads_get", strlen("gpy2xx_ads_get")) == 0) {
-		struct gpy211_ads_sta ads;
-		memset(&ads, 0, sizeof(struct gpy211_ads_sta));
+		cli_parse(cmd, argc, argv, &mac_cfg);
 
-		ret = gpy2xx_ads_get(&phy, &ads);
+		ret = gpy2xx_gmacf_cfg(&phy, &mac_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: Get Link's Auto Down Speed (ADS) mode failed.\n");
-			return ret;
+			printf("\nERROR: GMAC-Full MAC cfg info set failed.\n");
+			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_get: {
+		struct gmac_cfg mac_cfg;
+		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
-		printf("%s:\n", "Auto Downspeed Configur");
-		printf("\t%40s:\t%s\n", "Advertise all Speeds if No Energy Detected = ", ((ads.ads_ctrl.no_nrg_rst == 0) ? "Disable" : "Enable"));
-		printf("\t%40s:\t%s\n", "NBASE-T Downshift Enable = ", ((ads.ads_ctrl.downshift_en == 0) ? "Disable" : "Enable"));
-		printf("\t%40s:\t0x%x\n", "NBASE-T Downshift Training Counter Threshold = ", ads.ads_ctrl.downshift_thr);
-		printf("\t%40s:\t0x%x\n", "Force Reset of Downwshift Process = ", ads.ads_ctrl.force_rst);
-		printf("\t%40s:\t0x%x\n", "Timer to Reset the Downshift process = ", ads.ads_ctrl.nrg_rst_cnt);
-		printf("\n");
-		printf("%s:\n", "Auto Downspeed Status");
-		printf("\t%40s:\t0x%x\n", "ADS Training attempt counter = ", ads.downshift_cnt);
-		printf("\t%40s:\t0x%x\n", "ADS Downshift from 2G5 to lower speed = ", ads.downshift_2G5);
-		printf("\t%40s:\t0x%x\n", "ADS Downshift from 1G to lower speed = ", ads.downshift_1G);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ulp_cfg", strlen("gpy2xx_ulp_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_ulp_ctrl ulp;
-		memset(&ulp, 0, sizeof(struct gpy211_ulp_ctrl));
-
-		cnt += scanParamArg(argc, argv, "ulp_enable", sizeof(ulp.ulp_en), &ulp.ulp_en);
-		cnt += scanParamArg(argc, argv, "ulp_sta_block", sizeof(ulp.ulp_sta_block), &ulp.ulp_sta_block);
-		cnt += scanParamArg(argc, argv, "ulp_exit", sizeof(ulp.ulp_exit), &ulp.ulp_exit);
-		cnt += scanParamArg(argc, argv, "master_slice", sizeof(ulp.master_slice), &ulp.master_slice);
+		ret = gpy2xx_gmacf_get(&phy, &mac_cfg);
 
-		ret = gpy2xx_ulp_cfg(&phy, &ulp);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full MAC cfg info get failed.\n");
+			return -1;
+		}
 
-		if (ret < 0)
-			printf("\nERROR: Set ULP mode failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ulp_get", strlen("gpy2xx_ulp_get")) == 0) {
-		struct gpy211_ulp_ctrl ulp;
-		memset(&ulp, 0, sizeof(struct gpy211_ulp_ctrl));
+		printf("\t%40s:\t0x%x\n", "Receiver Enable", mac_cfg.re_en);
+		printf("\t%40s:\t0x%x\n", "Transmitter Enable", mac_cfg.te_en);
+		printf("\t%40s:\t0x%x\n", "Preamble Length in Bytes", mac_cfg.preamble_len);
+		printf("\t%40s:\t0x%x\n", "Loopback Enable", mac_cfg.loopback_en);
+		printf("\t%40s:\t0x%x\n", "Full-duplex Enable", mac_cfg.fulldup_en);
+		printf("\t%40s:\t0x%x\n", "MAC speed", mac_cfg.mac_speed);
+		printf("\t%40s:\t0x%x\n", "Register Clear on Write 1 Enable", mac_cfg.rc_write1_en);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_cfg: {
+		struct gmac_cfg mac_cfg;
+		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
-		ret = gpy2xx_ulp_get(&phy, &ulp);
+		ret = gpy2xx_gmacl_get(&phy, &mac_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: ULP mode failed.\n");
-			return ret;
+			printf("\nERROR: GMAC-Lite MAC cfg info get failed.\n");
+			return -1;
 		}
 
-		printf("\t%40s:\t%s\n", "ULP enable = ", ((ulp.ulp_en == 0) ? "Disable" : "Enable"));
-		printf("\t%40s:\t%s\n", "ULP station block = ", ((ulp.ulp_sta_block == 0) ? "Disable" : "Enable"));
-	} else if (xstrncasecmp(argv[2], "gpy2xx_ads_detected", strlen("gpy2xx_ads_detected")) == 0) {
-		ret = gpy2xx_ads_detected(&phy);
+		cli_parse(cmd, argc, argv, &mac_cfg);
 
-		if (ret == 1)
-			printf("\nLink Auto Down Speed detected.\n");
-		else if (ret == 0)
-			printf("\nLink Auto Down Speed not detected.\n");
-		else
-			printf("\nERROR: Link ADS detected state get failed.\n");
+		ret = gpy2xx_gmacl_cfg(&phy, &mac_cfg);
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_sgmii_restart_aneg", strlen("gpy2xx_sgmii_restart_aneg")) == 0) {
-		int ret;
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite MAC cfg info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_get: {
+		struct gmac_cfg mac_cfg;
+		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
-		ret = gpy2xx_sgmii_restart_aneg(&phy);
+		ret = gpy2xx_gmacl_get(&phy, &mac_cfg);
 
-		if (ret < 0)
-			printf("\nERROR: Restarting SGMII Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_sgmii_aneg_done", strlen("gpy2xx_sgmii_aneg_done")) == 0) {
-		ret = gpy2xx_sgmii_aneg_done(&phy);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite MAC cfg info get failed.\n");
+			return -1;
+		}
 
-		if (ret == 0)
-			printf("\nSGMII Auto-Negotiation pending.\n");
-		else if (ret == 1)
-			printf("\nSGMII Auto-Negotiation completed.\n");
-		else
-			printf("\nERROR: SGMII Auto-Negotiation polling failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_sgmii_config_aneg", strlen("gpy2xx_sgmii_config_aneg")) == 0) {
-		//char buf[256];
-		struct gpy211_sgmii sgmiiConfig;
-		memset(&sgmiiConfig, 0, sizeof(struct gpy211_sgmii));
+		printf("\t%40s:\t0x%x\n", "Receiver Enable", mac_cfg.re_en);
+		printf("\t%40s:\t0x%x\n", "Transmitter Enable", mac_cfg.te_en);
+		printf("\t%40s:\t0x%x\n", "Preamble Length in Bytes", mac_cfg.preamble_len);
+		printf("\t%40s:\t0x%x\n", "Loopback Enable", mac_cfg.loopback_en);
+		printf("\t%40s:\t0x%x\n", "Full-duplex Enable", mac_cfg.fulldup_en);
+		printf("\t%40s:\t0x%x\n", "MAC speed", mac_cfg.mac_speed);
+		printf("\t%40s:\t0x%x\n", "Register Clear on Write 1 Enable", mac_cfg.rc_write1_en);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_cfg: {
+		struct gmac_pkt_cfg pkt_cfg;
+		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
-		if (scanParamArg(argc, argv, "linkcfg_dir", sizeof(sgmiiConfig.linkcfg_dir), &sgmiiConfig.linkcfg_dir) == 0)
-			sgmiiConfig.linkcfg_dir = 1;
+		ret = gpy2xx_gmacl_pkt_get(&phy, &pkt_cfg);
 
-		if (scanParamArg(argc, argv, "aneg_mode", sizeof(sgmiiConfig.aneg_mode), &sgmiiConfig.aneg_mode) == 0)
-			sgmiiConfig.aneg_mode = 1;
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite packet cfg info get failed.\n");
+			return -1;
+		}
 
-		if (scanParamArg(argc, argv, "eee_enable", sizeof(sgmiiConfig.eee_enable), &sgmiiConfig.eee_enable) == 0)
-			sgmiiConfig.eee_enable = 1;
+		cli_parse(cmd, argc, argv, &pkt_cfg);
 
-		if (scanParamArg(argc, argv, "autoneg", sizeof(sgmiiConfig.link.autoneg), &sgmiiConfig.link.autoneg) == 0)
-			sgmiiConfig.link.autoneg = 1;
+		ret = gpy2xx_gmacl_pkt_cfg(&phy, &pkt_cfg);
 
-		if (scanParamArg(argc, argv, "speed", sizeof(sgmiiConfig.link.speed), &sgmiiConfig.link.speed) == 0)
-			sgmiiConfig.link.speed = SPEED_2500;
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite packet cfg info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_get: {
+		struct gmac_pkt_cfg pkt_cfg;
+		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
-		if (scanParamArg(argc, argv, "fixed2G5", sizeof(sgmiiConfig.link.fixed2g5), &sgmiiConfig.link.fixed2g5) == 0)
-			sgmiiConfig.link.fixed2g5 = 0;
+		ret = gpy2xx_gmacl_pkt_get(&phy, &pkt_cfg);
 
-		if (scanParamArg(argc, argv, "duplex", sizeof(sgmiiConfig.link.duplex), &sgmiiConfig.link.duplex) == 0)
-			sgmiiConfig.link.duplex = DUPLEX_FULL;
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite packet cfg info get failed.\n");
+			return -1;
+		}
 
-		ret = gpy2xx_sgmii_config_aneg(&phy, &sgmiiConfig);
+		printf("\t%40s:\t0x%x\n", "Jumbo Packet Enable", pkt_cfg.jumbo_en);
+		printf("\t%40s:\t0x%x\n", "Jabber Disable", pkt_cfg.tx_jabber_dis);
+		printf("\t%40s:\t0x%x\n", "Watchdog Disable", pkt_cfg.watchdog_dis);
+		printf("\t%40s:\t0x%x\n", "Pad or CRC Stripping for Ether 'Length' packets", pkt_cfg.pad_crc_strip_en);
+		printf("\t%40s:\t0x%x\n", "CRC Stripping for Ether 'Type' packets", pkt_cfg.crc_strip_en);
+		printf("\t%40s:\t0x%x\n", "802.3as Support for 2K Packets", pkt_cfg.support_2kp);
+		printf("\t%40s:\t0x%x\n", "Inter-Packet Gap in Bytes", (12 - pkt_cfg.mac_ipg));
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_filter_cfg: {
+		struct gmac_pktflt_cfg flt_cfg;
+		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
-		if (ret < 0)
-			printf("\nERROR: Configuring SGMII Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_sgmii_read_status", strlen("gpy2xx_sgmii_read_status")) == 0) {
-		char buf[256];
-		struct gpy211_sgmii sgmiiConfig;
-		memset(&sgmiiConfig, 0, sizeof(struct gpy211_sgmii));
-		ret = gpy2xx_sgmii_read_status(&phy, &sgmiiConfig);
+		ret = gpy2xx_gmacf_pkt_filter_get(&phy, &flt_cfg);
 
-		if (ret < 0)
-			printf("\nERROR: Read SGMII link status failed.\n");
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full packet filter info get failed.\n");
+			return -1;
+		}
 
-		printf("\t%40s:\t%d\n", "SGMII Link configuration direction", sgmiiConfig.linkcfg_dir);
-		printf("\t%40s:\t%d\n", "SGMII ANEG Mode", sgmiiConfig.aneg_mode);
-		printf("\t%40s:\t%d\n", "EEE SGMII Capability is advertised in ANEG", sgmiiConfig.eee_enable);
+		cli_parse(cmd, argc, argv, &flt_cfg);
 
-		printf("\nPopulated link configuration parameters:\n----------------\n");
-		printf("\t%40s:\t%s\n", "Auto-Negotiation (AN) state", sgmiiConfig.link.autoneg ? "Enabled" : "Disabled");
-		printf("\t%40s:\t%d\n", "Link Speed or Partner Link Speed (AN)", sgmiiConfig.link.speed);
-		printf("\t%40s:\t%s\n", "Rate Adaptation (SGMII Fixed 2.5G)", sgmiiConfig.link.fixed2g5 ? "Enabled" : "Disabled");
+		ret = gpy2xx_gmacf_pkt_filter_cfg(&phy, &flt_cfg);
 
-		if (sgmiiConfig.link.autoneg == 0) {
-			printf("\t%40s:\t%s\n", "Duplex (Forced) or Partner Duplex (AN)", sgmiiConfig.link.duplex ? "Full" : "Half");
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full packet filter info set failed.\n");
+			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_filter_get: {
+		struct gmac_pktflt_cfg flt_cfg;
+		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
-		printf("\t%40s:\t%s\n", "Most recently read link state", sgmiiConfig.link.link ? "Up" : "Down");
-		print_advert(buf, sizeof(buf), sgmiiConfig.link.supported);
-		printf("\t%40s:\t0x%llx (%s)\n", "GPHY supported modes", sgmiiConfig.link.supported, buf);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_sgmii_opmode", strlen("gpy2xx_sgmii_opmode")) == 0) {
-		int cnt = 0;
-		enum gpy211_sgmii_operation opMode = 0;
-
-		cnt += scanParamArg(argc, argv, "opMode", sizeof(opMode), &opMode);
-		ret = gpy2xx_sgmii_opmode(&phy, opMode);
+		ret = gpy2xx_gmacf_pkt_filter_get(&phy, &flt_cfg);
 
-		if (ret < 0)
-			printf("\nERROR: Set SGMII operation mode failed.\n");
-	} else if (xstrncasecmp(argv[2], "gpy2xx_pvt_get", strlen("gpy2xx_pvt_get")) == 0) {
-		struct gpy211_pvt sensInfo;
+		if (ret < 0) {
+			printf("\nERROR: GMAC-full packet filter info get failed.\n");
+			return -1;
+		}
 
-		memset(&sensInfo, 0, sizeof(struct gpy211_pvt));
-		ret = gpy2xx_pvt_get(&phy, &sensInfo);
+		printf("\t%40s:\t0x%x\n", "Promiscuous Mode", flt_cfg.promiscuous_en);
+		printf("\t%40s:\t0x%x\n", "Pass All Multicast", flt_cfg.pass_all_mc);
+		printf("\t%40s:\t0x%x\n", "Block all BC incoming frames", flt_cfg.block_bc);
+		printf("\t%40s:\t0x%x\n", "Pass Control Packets mode", flt_cfg.pass_ctrl_pkts);
+		printf("\t%40s:\t0x%x\n", "Source Address Filter Enable", flt_cfg.sa_filter_en);
+		printf("\t%40s:\t0x%x\n", "Receive All", flt_cfg.rx_all_en);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_filter_cfg: {
+		struct gmac_pktflt_cfg flt_cfg;
+		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
-		if (ret < 0)
-			printf("\nERROR: Get SENSOR temparature failed.\n");
+		ret = gpy2xx_gmacl_pkt_filter_get(&phy, &flt_cfg);
 
-		printf("\t%s:\t%d\n", "Sensor temparature", sensInfo.temperature);
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacx_pm_hw_reset", strlen("gpy2xx_gmacx_pm_hw_reset")) == 0) {
-		ret = gpy2xx_gmacx_pm_hw_reset(&phy);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite packet filter info get failed.\n");
+			return -1;
+		}
 
-		if (ret < 0)
-			printf("\nERROR: PM level HW reset failed.\n");
+		cli_parse(cmd, argc, argv, &flt_cfg);
 
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_macsec_enable", strlen("gpy2xx_macsec_enable")) == 0) {
-		int cnt = 0;
-		struct gpy211_macsec msec_cfg;
-		memset(&msec_cfg, 0, sizeof(struct gpy211_macsec));
+		ret = gpy2xx_gmacl_pkt_filter_cfg(&phy, &flt_cfg);
 
-		cnt += scanParamArg(argc, argv, "dropCrc", sizeof(msec_cfg.drop_on_crc_err), &msec_cfg.drop_on_crc_err);
-		cnt += scanParamArg(argc, argv, "dropPerr", sizeof(msec_cfg.drop_on_pkt_err), &msec_cfg.drop_on_pkt_err);
-		cnt += scanParamArg(argc, argv, "dropSfail", sizeof(msec_cfg.drop_on_sec_fail), &msec_cfg.drop_on_sec_fail);
-		cnt += scanParamArg(argc, argv, "dropClass", sizeof(msec_cfg.class_drop), &msec_cfg.class_drop);
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Lite packet filter info set failed.\n");
+			return -1;
+		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_filter_get: {
+		struct gmac_pktflt_cfg flt_cfg;
+		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
-		ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
+		ret = gpy2xx_gmacl_pkt_filter_get(&phy, &flt_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: MACsec enable failed.\n");
+			printf("\nERROR: GMAC-Lite packet filter info get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_macsec_disable", strlen("gpy2xx_macsec_disable")) == 0) {
-		ret = gpy2xx_macsec_disable(&phy);
+
+		printf("\t%40s:\t0x%x\n", "Promiscuous Mode", flt_cfg.promiscuous_en);
+		printf("\t%40s:\t0x%x\n", "Pass All Multicast", flt_cfg.pass_all_mc);
+		printf("\t%40s:\t0x%x\n", "Block all BC incoming frames", flt_cfg.block_bc);
+		printf("\t%40s:\t0x%x\n", "Pass Control Packets mode", flt_cfg.pass_ctrl_pkts);
+		printf("\t%40s:\t0x%x\n", "Source Address Filter Enable", flt_cfg.sa_filter_en);
+		printf("\t%40s:\t0x%x\n", "Receive All", flt_cfg.rx_all_en);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_debug_info_get: {
+		struct gmac_debug_info dbg_info;
+		memset(&dbg_info, 0, sizeof(struct gmac_debug_info));
+
+		ret = gpy2xx_gmacf_debug_info_get(&phy, &dbg_info);
 
 		if (ret < 0) {
-			printf("\nERROR: MACsec disable set failed.\n");
+			printf("\nERROR: GMAC-Full debug info get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacx_pm_pdi_cfg", strlen("gpy2xx_gmacx_pm_pdi_cfg")) == 0) {
-		int cnt = 0;
-		struct pm_config pm_cfg;
-		memset(&pm_cfg, 0, sizeof(struct pm_config));
 
-		ret = gpy2xx_gmacx_pm_pdi_get(&phy, &pm_cfg);
+		printf("\t%40s:\t0x%x\n", "Synopsys-defined Version", dbg_info.synop_ver);
+		printf("\t%40s:\t0x%x\n", "User-defined Version", dbg_info.user_ver);
+		printf("\t%40s:\t0x%x\n", "Tx Jabber Timeout", dbg_info.tx_jabber_to);
+		printf("\t%40s:\t0x%x\n", "Rx Watchdog Timeout", dbg_info.rx_wdog_to);
+		printf("\t%40s:\t0x%x\n", "GMII or MII Receive Protocol Engine Status", dbg_info.gmii_rpe_stat);
+		printf("\t%40s:\t0x%x\n", "Receive Packet Controller FIFO Status", dbg_info.rpc_fifo_stat);
+		printf("\t%40s:\t0x%x\n", "GMII or MII Transmit Protocol Engine Status", dbg_info.gmii_tpe_stat);
+		printf("\t%40s:\t0x%x\n", "Transmit Packet Controller FIFO Status", dbg_info.tpc_fifo_stat);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_cfg: {
+		struct gmac_pkt_cfg pkt_cfg;
+		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
+
+		ret = gpy2xx_gmacf_pkt_get(&phy, &pkt_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: PM cfg info get failed.\n");
+			printf("\nERROR: GMAC-Full packet cfg info get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "bpMac", sizeof(pm_cfg.bypass_gmac), &pm_cfg.bypass_gmac);
-		cnt += scanParamArg(argc, argv, "bpMsec", sizeof(pm_cfg.bypass_macsec), &pm_cfg.bypass_macsec);
-		cnt += scanParamArg(argc, argv, "dropCrc", sizeof(pm_cfg.drop_on_crc_err), &pm_cfg.drop_on_crc_err);
-		cnt += scanParamArg(argc, argv, "dropPerr", sizeof(pm_cfg.drop_on_pkt_err), &pm_cfg.drop_on_pkt_err);
-		cnt += scanParamArg(argc, argv, "dropSfail", sizeof(pm_cfg.drop_on_sec_fail), &pm_cfg.drop_on_sec_fail);
-		cnt += scanParamArg(argc, argv, "dropClass", sizeof(pm_cfg.class_drop), &pm_cfg.class_drop);
-		cnt += scanParamArg(argc, argv, "cust3gEn", sizeof(pm_cfg.cust_3g_en), &pm_cfg.cust_3g_en);
-		cnt += scanParamArg(argc, argv, "sgmiiLb", sizeof(pm_cfg.sgmii_lb_en), &pm_cfg.sgmii_lb_en);
+		cli_parse(cmd, argc, argv, &pkt_cfg);
 
-		ret = gpy2xx_gmacx_pm_pdi_cfg(&phy, &pm_cfg);
+		ret = gpy2xx_gmacf_pkt_cfg(&phy, &pkt_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full MAC cfg info set failed.\n");
+			printf("\nERROR: GMAC-Full packet cfg info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacx_pm_pdi_get", strlen("gpy2xx_gmacx_pm_pdi_get")) == 0) {
-		struct pm_config pm_cfg;
-		memset(&pm_cfg, 0, sizeof(struct pm_config));
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_get: {
+		struct gmac_pkt_cfg pkt_cfg;
+		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
-		ret = gpy2xx_gmacx_pm_pdi_get(&phy, &pm_cfg);
+		ret = gpy2xx_gmacf_pkt_get(&phy, &pkt_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: PM cfg info get failed.\n");
+			printf("\nERROR: GMAC-Fullpacket cfg info get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Bypass GMAC", pm_cfg.bypass_gmac);
-		printf("\t%40s:\t0x%x\n", "Bypass MACSec", pm_cfg.bypass_macsec);
-		printf("\t%40s:\t0x%x\n", "Discard CRC error pkts", pm_cfg.drop_on_crc_err);
-		printf("\t%40s:\t0x%x\n", "Discard PKT error pkts", pm_cfg.drop_on_pkt_err);
-		printf("\t%40s:\t0x%x\n", "Discard SEC fail pkts", pm_cfg.drop_on_sec_fail);
-		printf("\t%40s:\t0x%x\n", "Classification Drop pkts", pm_cfg.class_drop);
-		printf("\t%40s:\t0x%x\n", "Custom3G Speed enable", pm_cfg.cust_3g_en);
-		printf("\t%40s:\t0x%x\n", "SGMII Loopback enable", pm_cfg.sgmii_lb_en);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_pm_cfg", strlen("gpy2xx_gmacf_pm_cfg")) == 0) {
-		int cnt = 0;
-		struct pm_gmac_cfg gmac_ctrl;
-		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
+		printf("\t%40s:\t0x%x\n", "Jumbo Packet Enable", pkt_cfg.jumbo_en);
+		printf("\t%40s:\t0x%x\n", "Jabber Disable", pkt_cfg.tx_jabber_dis);
+		printf("\t%40s:\t0x%x\n", "Watchdog Disable", pkt_cfg.watchdog_dis);
+		printf("\t%40s:\t0x%x\n", "Pad or CRC Stripping for Ether 'Length' packets", pkt_cfg.pad_crc_strip_en);
+		printf("\t%40s:\t0x%x\n", "CRC Stripping for Ether 'Type' packets", pkt_cfg.crc_strip_en);
+		printf("\t%40s:\t0x%x\n", "802.3as Support for 2K Packets", pkt_cfg.support_2kp);
+		printf("\t%40s:\t0x%x\n", "Inter-Packet Gap in Bytes", pkt_cfg.mac_ipg);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_ctrl_cfg: {
+		struct gmacf_counter_ctrl cnt_ctrl;
+		memset(&cnt_ctrl, 0, sizeof(struct gmacf_counter_ctrl));
 
-		ret = gpy2xx_gmacf_pm_get(&phy, &gmac_ctrl);
+		ret = gpy2xx_gmacf_count_ctrl_get(&phy, &cnt_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full info get failed.\n");
+			printf("\nERROR: GMAC-Full counters control info get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "crcPad", sizeof(gmac_ctrl.crc_pad_ctrl), &gmac_ctrl.crc_pad_ctrl);
-		cnt += scanParamArg(argc, argv, "txErr", sizeof(gmac_ctrl.tx_err_input), &gmac_ctrl.tx_err_input);
-		cnt += scanParamArg(argc, argv, "bigEndian", sizeof(gmac_ctrl.big_endian), &gmac_ctrl.big_endian);
+		cli_parse(cmd, argc, argv, &cnt_ctrl);
 
-		ret = gpy2xx_gmacf_pm_cfg(&phy, &gmac_ctrl);
+		ret = gpy2xx_gmacf_count_ctrl_cfg(&phy, &cnt_ctrl);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full info set failed.\n");
+			printf("\nERROR: GMAC-Full counters control info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_pm_get", strlen("gpy2xx_gmacf_pm_get")) == 0) {
-		struct pm_gmac_cfg gmac_ctrl;
-		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_ctrl_get: {
+		struct gmacf_counter_ctrl cnt_ctrl;
+		memset(&cnt_ctrl, 0, sizeof(struct gmacf_counter_ctrl));
 
-		ret = gpy2xx_gmacf_pm_get(&phy, &gmac_ctrl);
+		ret = gpy2xx_gmacf_count_ctrl_get(&phy, &cnt_ctrl);
+
+		if (ret < 0) {
+			printf("\nERROR: GMAC-Full counters control info get failed.\n");
+			return -1;
+		}
+
+		printf("\t%40s:\t0x%x\n", "Counters Reset", cnt_ctrl.reset_counters);
+		printf("\t%40s:\t0x%x\n", "Counter Stop Rollover", cnt_ctrl.stop_rollover);
+		printf("\t%40s:\t0x%x\n", "Reset on Read", cnt_ctrl.clear_on_read);
+		printf("\t%40s:\t0x%x\n", "Counters Freeze", cnt_ctrl.freeze_counters);
+		printf("\t%40s:\t0x%x\n", "Counters Preset", cnt_ctrl.preset_counters);
+		printf("\t%40s:\t0x%x\n", "Full-Half Preset", cnt_ctrl.preset_half_full);
+		printf("\t%40s:\t0x%x\n", "Update Counters for Dropped BC Packets", cnt_ctrl.count_dropped_bc);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_get: {
+		struct gmacf_counters full_ctrs;
+		memset(&full_ctrs, 0, sizeof(struct gmacf_counters));
+
+		ret = gpy2xx_gmacf_count_get(&phy, &full_ctrs);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full info get failed.\n");
+			printf("\nERROR: GMAC-Full counters get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "GMAC CRC and Pad Control", gmac_ctrl.crc_pad_ctrl);
-		printf("\t%40s:\t0x%x\n", "GMAC Tx Error Input", gmac_ctrl.tx_err_input);
-		printf("\t%40s:\t0x%x\n", "Data Endianness", gmac_ctrl.big_endian);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pm_cfg", strlen("gpy2xx_gmacl_pm_cfg")) == 0) {
-		int cnt = 0;
-		struct pm_gmac_cfg gmac_ctrl;
-		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
-
-		ret = gpy2xx_gmacl_pm_get(&phy, &gmac_ctrl);
+		printf("\nTx Counters:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Tx Good & Bad frame count", full_ctrs.tx_good_bad);
+		printf("\t%40s:\t0x%x\n", "Tx Underflow error frame count", full_ctrs.tx_uflow_err);
+		printf("\t%40s:\t0x%x\n", "Tx Good frame count", full_ctrs.tx_good);
+		printf("\t%40s:\t0x%x\n", "Tx Oversize Good frame count", full_ctrs.tx_osize_good);
+		printf("\nRx Counters:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Rx Good & Bad frame count", full_ctrs.rx_good_bad);
+		printf("\t%40s:\t0x%x\n", "Rx CRC error frame count", full_ctrs.rx_crc_err);
+		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame count", full_ctrs.rx_usize_good);
+		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame count", full_ctrs.rx_osize_good);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_acc: {
+		struct gmacf_count_acc acc;
+		struct cli_count_acc_args a;
+		u32 i;
 
-		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full info get failed.\n");
-			return -1;
-		}
+		memset(&acc, 0, sizeof(struct gmacf_count_acc));
+		memset(&a, 0, sizeof(struct cli_count_acc_args));
 
-		cnt += scanParamArg(argc, argv, "crcPad", sizeof(gmac_ctrl.crc_pad_ctrl), &gmac_ctrl.crc_pad_ctrl);
-		cnt += scanParamArg(argc, argv, "txErr", sizeof(gmac_ctrl.tx_err_input), &gmac_ctrl.tx_err_input);
-		cnt += scanParamArg(argc, argv, "bigEndian", sizeof(gmac_ctrl.big_endian), &gmac_ctrl.big_endian);
+		cli_parse(cmd, argc, argv, &a);
+		acc.freeze = a.freeze ? 1 : 0;
 
-		ret = gpy2xx_gmacl_pm_cfg(&phy, &gmac_ctrl);
+		gpy2xx_read_status(&phy);
+		ret = gpy2xx_gmacf_count_acc_init(&phy, &acc);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full info set failed.\n");
+			printf("\nERROR: GMAC-Full counters accumulator init failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pm_get", strlen("gpy2xx_gmacl_pm_get")) == 0) {
-		struct pm_gmac_cfg gmac_ctrl;
-		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
-		ret = gpy2xx_gmacl_pm_get(&phy, &gmac_ctrl);
+		if (a.interval == 0 || a.interval > acc.poll_ms)
+			a.interval = acc.poll_ms;
 
-		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full info get failed.\n");
-			return -1;
+		printf("\t%40s:\t%u ms (max %u ms)\n", "Update interval", a.interval, acc.poll_ms);
+
+		for (i = 0; i < a.count; i++) {
+			usleep(a.interval * 1000);
+			ret = gpy2xx_gmacf_count_acc_update(&phy, &acc);
+
+			if (ret < 0) {
+				printf("\nERROR: GMAC-Full counters accumulator update failed.\n");
+				return -1;
+			}
 		}
 
-		printf("\t%40s:\t0x%x\n", "GMAC CRC and Pad Control", gmac_ctrl.crc_pad_ctrl);
-		printf("\t%40s:\t0x%x\n", "GMAC Tx Error Input", gmac_ctrl.tx_err_input);
-		printf("\t%40s:\t0x%x\n", "Data Endianness", gmac_ctrl.big_endian);
+		printf("\nTx Counters:\n----------------\n");
+		printf("\t%40s:\t%llu\n", "Tx Good & Bad frame count", (unsigned long long)acc.total.tx_good_bad);
+		printf("\t%40s:\t%llu\n", "Tx Underflow error frame count", (unsigned long long)acc.total.tx_uflow_err);
+		printf("\t%40s:\t%llu\n", "Tx Good frame count", (unsigned long long)acc.total.tx_good);
+		printf("\t%40s:\t%llu\n", "Tx Oversize Good frame count", (unsigned long long)acc.total.tx_osize_good);
+		printf("\nRx Counters:\n----------------\n");
+		printf("\t%40s:\t%llu\n", "Rx Good & Bad frame count", (unsigned long long)acc.total.rx_good_bad);
+		printf("\t%40s:\t%llu\n", "Rx CRC error frame count", (unsigned long long)acc.total.rx_crc_err);
+		printf("\t%40s:\t%llu\n", "Rx Undesize Good frame count", (unsigned long long)acc.total.rx_usize_good);
+		printf("\t%40s:\t%llu\n", "Rx Oversize Good frame count", (unsigned long long)acc.total.rx_osize_good);
+		printf("\t%40s:\t%u\n", "Torn reads corrected", acc.torn);
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_cfg", strlen("gpy2xx_gmacf_lpi_cfg")) == 0) {
-		int cnt = 0;
-		struct lpi_cfg lpi_ctrl;
-		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_imask_cfg: {
+		struct counter_imask cnt_imask;
+		memset(&cnt_imask, 0, sizeof(struct counter_imask));
 
-		ret = gpy2xx_gmacf_lpi_get(&phy, &lpi_ctrl);
+		ret = gpy2xx_gmacf_count_imask_get(&phy, &cnt_imask);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full LPI info get failed.\n");
+			printf("\nERROR: GMAC-Full counters interrupt mask get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "lpintEn", sizeof(lpi_ctrl.lpi_int_en), &lpi_ctrl.lpi_int_en);
-		cnt += scanParamArg(argc, argv, "lpiEn", sizeof(lpi_ctrl.lpi_en), &lpi_ctrl.lpi_en);
-		cnt += scanParamArg(argc, argv, "linkUp", sizeof(lpi_ctrl.phy_link_status), &lpi_ctrl.phy_link_status);
-		cnt += scanParamArg(argc, argv, "txautoEn", sizeof(lpi_ctrl.lpi_tx_auto), &lpi_ctrl.lpi_tx_auto);
-		cnt += scanParamArg(argc, argv, "timerEn", sizeof(lpi_ctrl.lpi_timer_en), &lpi_ctrl.lpi_timer_en);
-		cnt += scanParamArg(argc, argv, "clkStop", sizeof(lpi_ctrl.lpi_tx_clk_stop_en), &lpi_ctrl.lpi_tx_clk_stop_en);
-		cnt += scanParamArg(argc, argv, "ticTime", sizeof(lpi_ctrl.ous_tic_time), &lpi_ctrl.ous_tic_time);
-		cnt += scanParamArg(argc, argv, "twTime", sizeof(lpi_ctrl.lpi_tw_time), &lpi_ctrl.lpi_tw_time);
-		cnt += scanParamArg(argc, argv, "lsTime", sizeof(lpi_ctrl.lpi_ls_time), &lpi_ctrl.lpi_ls_time);
-		cnt += scanParamArg(argc, argv, "entryTime", sizeof(lpi_ctrl.lpi_entry_time), &lpi_ctrl.lpi_entry_time);
+		cli_parse(cmd, argc, argv, &cnt_imask);
 
-		ret = gpy2xx_gmacf_lpi_cfg(&phy, &lpi_ctrl);
+		ret = gpy2xx_gmacf_count_imask_cfg(&phy, &cnt_imask);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full LPI info set failed.\n");
+			printf("\nERROR: GMAC-Full counters interrupt mask set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_get", strlen("gpy2xx_gmacf_lpi_get")) == 0) {
-		struct lpi_cfg lpi_ctrl;
-		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_imask_get: {
+		struct counter_imask cnt_imask;
+		memset(&cnt_imask, 0, sizeof(struct counter_imask));
 
-		ret = gpy2xx_gmacf_lpi_get(&phy, &lpi_ctrl);
+		ret = gpy2xx_gmacf_count_imask_get(&phy, &cnt_imask);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Full LPI info get failed.\n");
+			printf("\nERROR: GMAC-Full counters interrupt mask get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "LPI Interrupt Enable", lpi_ctrl.lpi_int_en);
-		printf("\t%40s:\t0x%x\n", "LPI Enable", lpi_ctrl.lpi_en);
-		printf("\t%40s:\t0x%x\n", "PHY Link Status", lpi_ctrl.phy_link_status);
-		printf("\t%40s:\t0x%x\n", "LPI Tx Automate", lpi_ctrl.lpi_tx_auto);
-		printf("\t%40s:\t0x%x\n", "LPI Timer Enable", lpi_ctrl.lpi_timer_en);
-		printf("\t%40s:\t0x%x\n", "LPI Tx Clock Stop Enable", lpi_ctrl.lpi_tx_clk_stop_en);
-		printf("\t%40s:\t0x%x\n", "1US TIC Counter", lpi_ctrl.ous_tic_time);
-		printf("\t%40s:\t0x%x\n", "LPI TW Timer (in milliseconds)", lpi_ctrl.lpi_tw_time);
-		printf("\t%40s:\t0x%x\n", "LPI LS Timer (in milliseconds)", lpi_ctrl.lpi_ls_time);
-		printf("\t%40s:\t0x%x\n", "LPI Entry Timer (in milliseconds)", lpi_ctrl.lpi_entry_time);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_lpi_cfg", strlen("gpy2xx_gmacl_lpi_cfg")) == 0) {
-		int cnt = 0;
-		struct lpi_cfg lpi_ctrl;
-		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
+		printf("\nTx counters interrupt mask:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Tx Good & Bad frame imask", cnt_imask.tx_good_bad_im);
+		printf("\t%40s:\t0x%x\n", "Tx Underflow error frame imask", cnt_imask.tx_uflow_err_im);
+		printf("\t%40s:\t0x%x\n", "Tx Good frame imask", cnt_imask.tx_good_im);
+		printf("\t%40s:\t0x%x\n", "Tx Oversize Good frame imask", cnt_imask.tx_osize_good_im);
+		printf("\nRx counters interrupt mask:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Rx Good & Bad frame imask", cnt_imask.rx_good_bad_im);
+		printf("\t%40s:\t0x%x\n", "Rx CRC error frame imask", cnt_imask.rx_crc_err_im);
+		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame imask", cnt_imask.rx_usize_good_im);
+		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame imask", cnt_imask.rx_osize_good_im);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_istat_get: {
+		struct counter_istat cnt_istat;
+		memset(&cnt_istat, 0, sizeof(struct counter_istat));
 
-		ret = gpy2xx_gmacl_lpi_get(&phy, &lpi_ctrl);
+		ret = gpy2xx_gmacf_count_istat_get(&phy, &cnt_istat);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Lite LPI info get failed.\n");
+			printf("\nERROR: GMAC-Full counters interrupt status get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "lpintEn", sizeof(lpi_ctrl.lpi_int_en), &lpi_ctrl.lpi_int_en);
-		cnt += scanParamArg(argc, argv, "lpiEn", sizeof(lpi_ctrl.lpi_en), &lpi_ctrl.lpi_en);
-		cnt += scanParamArg(argc, argv, "linkUp", sizeof(lpi_ctrl.phy_link_status), &lpi_ctrl.phy_link_status);
-		cnt += scanParamArg(argc, argv, "txautoEn", sizeof(lpi_ctrl.lpi_tx_auto), &lpi_ctrl.lpi_tx_auto);
-		cnt += scanParamArg(argc, argv, "timerEn", sizeof(lpi_ctrl.lpi_timer_en), &lpi_ctrl.lpi_timer_en);
-		cnt += scanParamArg(argc, argv, "clkStop", sizeof(lpi_ctrl.lpi_tx_clk_stop_en), &lpi_ctrl.lpi_tx_clk_stop_en);
-		cnt += scanParamArg(argc, argv, "ticTime", sizeof(lpi_ctrl.ous_tic_time), &lpi_ctrl.ous_tic_time);
-		cnt += scanParamArg(argc, argv, "twTime", sizeof(lpi_ctrl.lpi_tw_time), &lpi_ctrl.lpi_tw_time);
-		cnt += scanParamArg(argc, argv, "lsTime", sizeof(lpi_ctrl.lpi_ls_time), &lpi_ctrl.lpi_ls_time);
-		cnt += scanParamArg(argc, argv, "entryTime", sizeof(lpi_ctrl.lpi_entry_time), &lpi_ctrl.lpi_entry_time);
+		printf("\nTx counters interrupt status:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Tx Good & Bad frame istatus", cnt_istat.tx_good_bad_is);
+		printf("\t%40s:\t0x%x\n", "Tx Underflow error frame istatus", cnt_istat.tx_uflow_err_is);
+		printf("\t%40s:\t0x%x\n", "Tx Good frame istatus", cnt_istat.tx_good_is);
+		printf("\t%40s:\t0x%x\n", "Tx Oversize Good frame istatus", cnt_istat.tx_osize_good_is);
+		printf("\nRx counters interrupt status:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "Rx Good & Bad frame istatus", cnt_istat.rx_good_bad_is);
+		printf("\t%40s:\t0x%x\n", "Rx CRC error frame istatus", cnt_istat.rx_crc_err_is);
+		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame istatus", cnt_istat.rx_usize_good_is);
+		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame istatus", cnt_istat.rx_osize_good_is);
+#endif
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_bm_cfg: {
+		struct bm_cfg bmcfg;
+		memset(&bmcfg, 0, sizeof(struct bm_cfg));
 
-		ret = gpy2xx_gmacl_lpi_cfg(&phy, &lpi_ctrl);
+		ret = gpy2xx_gmacx_bm_get(&phy, &bmcfg);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Lite LPI info set failed.\n");
+			printf("\nERROR: PM's Buffer info get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_lpi_get", strlen("gpy2xx_gmacl_lpi_get")) == 0) {
-		struct lpi_cfg lpi_ctrl;
-		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
-		ret = gpy2xx_gmacl_lpi_get(&phy, &lpi_ctrl);
+		cli_parse(cmd, argc, argv, &bmcfg);
+
+		ret = gpy2xx_gmacx_bm_cfg(&phy, &bmcfg);
 
 		if (ret < 0) {
-			printf("\nERROR: PM GMAC-Lite LPI info get failed.\n");
+			printf("\nERROR: PM's Buffer info set failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_bm_get: {
+		struct bm_cfg bmcfg;
+		memset(&bmcfg, 0, sizeof(struct bm_cfg));
 
-		printf("\t%40s:\t0x%x\n", "LPI Interrupt Enable", lpi_ctrl.lpi_int_en);
-		printf("\t%40s:\t0x%x\n", "LPI Enable", lpi_ctrl.lpi_en);
-		printf("\t%40s:\t0x%x\n", "PHY Link Status", lpi_ctrl.phy_link_status);
-		printf("\t%40s:\t0x%x\n", "LPI Tx Automate", lpi_ctrl.lpi_tx_auto);
-		printf("\t%40s:\t0x%x\n", "LPI Timer Enable", lpi_ctrl.lpi_timer_en);
-		printf("\t%40s:\t0x%x\n", "LPI Tx Clock Stop Enable", lpi_ctrl.lpi_tx_clk_stop_en);
-		printf("\t%40s:\t0x%x\n", "1US TIC Counter", lpi_ctrl.ous_tic_time);
-		printf("\t%40s:\t0x%x\n", "LPI TW Timer (in milliseconds)", lpi_ctrl.lpi_tw_time);
-		printf("\t%40s:\t0x%x\n", "LPI LS Timer (in milliseconds)", lpi_ctrl.lpi_ls_time);
-		printf("\t%40s:\t0x%x\n", "LPI Entry Timer (in milliseconds)", lpi_ctrl.lpi_entry_time);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_stat_get", strlen("gpy2xx_gmacf_lpi_stat_get")) == 0) {
-		struct lpi_status lpi_stat;
-		memset(&lpi_stat, 0, sizeof(struct lpi_status));
-
-		ret = gpy2xx_gmacf_lpi_stat_get(&phy, &lpi_stat);
+		ret = gpy2xx_gmacx_bm_get(&phy, &bmcfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full LPI status get failed.\n");
+			printf("\nERROR: PM's Buffer info get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "LPI Interrupt Status", lpi_stat.lpi_int_status);
-		printf("\t%40s:\t0x%x\n", "Tx LPI Entry hit", lpi_stat.tx_lpi_entry);
-		printf("\t%40s:\t0x%x\n", "Tx LPI Exit hit", lpi_stat.tx_lpi_exit);
-		printf("\t%40s:\t0x%x\n", "Rx LPI Entry hit", lpi_stat.rx_lpi_entry);
-		printf("\t%40s:\t0x%x\n", "Rx LPI Exit hit", lpi_stat.rx_lpi_exit);
-		printf("\t%40s:\t0x%x\n", "Tx LPI State", lpi_stat.tx_lpi_state);
-		printf("\t%40s:\t0x%x\n", "Rx LPI State", lpi_stat.rx_lpi_state);
-		printf("\t%40s:\t0x%x\n", "GMAC-Full's LPI state", lpi_stat.full_lpi_status);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_lpi_stat_get", strlen("gpy2xx_gmacl_lpi_stat_get")) == 0) {
-		struct lpi_status lpi_stat;
-		memset(&lpi_stat, 0, sizeof(struct lpi_status));
+		printf("\t%40s:\t0x%x\n", "SB 0 Start location", bmcfg.sb0_start);
+		printf("\t%40s:\t0x%x\n", "SB 0 End location", bmcfg.sb0_end);
+		printf("\t%40s:\t0x%x\n", "SB 0 Packet Threshold to start the dequeue", bmcfg.sb0_pkt_thresh);
+		printf("\t%40s:\t0x%x\n", "SB 1 Start location", bmcfg.sb1_start);
+		printf("\t%40s:\t0x%x\n", "SB 1 End location", bmcfg.sb1_end);
+		printf("\t%40s:\t0x%x\n", "SB 1 Packet Threshold to start the dequeue", bmcfg.sb1_pkt_thresh);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_bm_status_get: {
+		struct pm_bm_status bm_stat;
+		memset(&bm_stat, 0, sizeof(struct pm_bm_status));
 
-		ret = gpy2xx_gmacl_lpi_stat_get(&phy, &lpi_stat);
+		ret = gpy2xx_gmacx_bm_status_get(&phy, &bm_stat);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite LPI status get failed.\n");
+			printf("\nERROR: PM's Buffer status get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "LPI Interrupt Status", lpi_stat.lpi_int_status);
-		printf("\t%40s:\t0x%x\n", "Tx LPI Entry hit", lpi_stat.tx_lpi_entry);
-		printf("\t%40s:\t0x%x\n", "Tx LPI Exit hit", lpi_stat.tx_lpi_exit);
-		printf("\t%40s:\t0x%x\n", "Rx LPI Entry hit", lpi_stat.rx_lpi_entry);
-		printf("\t%40s:\t0x%x\n", "Rx LPI Exit hit", lpi_stat.rx_lpi_exit);
-		printf("\t%40s:\t0x%x\n", "Tx LPI State", lpi_stat.tx_lpi_state);
-		printf("\t%40s:\t0x%x\n", "Rx LPI State", lpi_stat.rx_lpi_state);
-		printf("\t%40s:\t0x%x\n", "GMAC-Lite's LPI state", lpi_stat.lite_lpi_status);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_imask_cfg", strlen("gpy2xx_gmacf_lpi_imask_cfg")) == 0) {
-		int cnt = 0;
-		struct lpi_int_mask lpi_imask;
-		memset(&lpi_imask, 0, sizeof(struct lpi_int_mask));
+		printf("\nSB-0 Buffer Status:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "SB 0 Overflow Indicator", bm_stat.sb0_ov);
+		printf("\t%40s:\t0x%x\n", "SB 0 Tx Register Overflow Indicator", bm_stat.sb0_tx_reg_ov);
+		printf("\t%40s:\t0x%x\n", "SB 0 Rx Register Overflow Indicator", bm_stat.sb0_rx_reg_ov);
+		printf("\t%40s:\t0x%x\n", "SB 0 Retry Indicator", bm_stat.sb0_retry);
+		printf("\t%40s:\t0x%x\n", "SB 0 Sent Indicator", bm_stat.sb0_sent);
+		printf("\t%40s:\t0x%x\n", "SB 0 Complete Indicator", bm_stat.sb0_complete);
 
-		ret = gpy2xx_gmacf_lpi_imask_get(&phy, &lpi_imask);
+		printf("\nSB-1 Buffer Status:\n----------------\n");
+		printf("\t%40s:\t0x%x\n", "SB 1 Overflow Indicator", bm_stat.sb1_ov);
+		printf("\t%40s:\t0x%x\n", "SB 1 Tx Register Overflow Indicator", bm_stat.sb1_tx_reg_ov);
+		printf("\t%40s:\t0x%x\n", "SB 1 Rx Register Overflow Indicator", bm_stat.sb1_rx_reg_ov);
+		printf("\t%40s:\t0x%x\n", "SB 1 Retry Indicator", bm_stat.sb1_retry);
+		printf("\t%40s:\t0x%x\n", "SB 1 Sent Indicator", bm_stat.sb1_sent);
+		printf("\t%40s:\t0x%x\n", "SB 1 Complete Indicator", bm_stat.sb1_complete);
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pause_cfg: {
+		struct pause_cfg pcfg;
+		memset(&pcfg, 0, sizeof(struct pause_cfg));
+
+		ret = gpy2xx_gmacl_pause_get(&phy, &pcfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full LPI interrupt mask get failed.\n");
+			printf("\nERROR: PM's Buffer info get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "rxUsc", sizeof(lpi_imask.rx_lpi_usc_im), &lpi_imask.rx_lpi_usc_im);
-		cnt += scanParamArg(argc, argv, "rxTrc", sizeof(lpi_imask.rx_lpi_tc_im), &lpi_imask.rx_lpi_tc_im);
-		cnt += scanParamArg(argc, argv, "txUsc", sizeof(lpi_imask.tx_lpi_usc_im), &lpi_imask.tx_lpi_usc_im);
-		cnt += scanParamArg(argc, argv, "txTrc", sizeof(lpi_imask.tx_lpi_tc_im), &lpi_imask.tx_lpi_tc_im);
+		cli_parse(cmd, argc, argv, &pcfg);
 
-		ret = gpy2xx_gmacf_lpi_imask_cfg(&phy, &lpi_imask);
+		ret = gpy2xx_gmacl_pause_cfg(&phy, &pcfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full LPI interrupt mask set failed.\n");
+			printf("\nERROR: PM's Buffer info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_imask_get", strlen("gpy2xx_gmacf_lpi_imask_get")) == 0) {
-		struct lpi_int_mask lpi_imask;
-		memset(&lpi_imask, 0, sizeof(struct lpi_int_mask));
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pause_get: {
+		struct pause_cfg pcfg;
+		memset(&pcfg, 0, sizeof(struct pause_cfg));
 
-		ret = gpy2xx_gmacf_lpi_imask_get(&phy, &lpi_imask);
+		ret = gpy2xx_gmacl_pause_get(&phy, &pcfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full LPI interrupt mask get failed.\n");
+			printf("\nERROR: PM's Buffer info get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Rx LPI microsecond counter interrupt mask", lpi_imask.rx_lpi_usc_im);
-		printf("\t%40s:\t0x%x\n", "Rx LPI transition counter interrupt mask", lpi_imask.rx_lpi_tc_im);
-		printf("\t%40s:\t0x%x\n", "Tx LPI microsecond counter interrupt mask", lpi_imask.tx_lpi_usc_im);
-		printf("\t%40s:\t0x%x\n", "Tx LPI transition counter interrupt mask", lpi_imask.tx_lpi_tc_im);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_istat_get", strlen("gpy2xx_gmacf_lpi_istat_get")) == 0) {
-		struct lpi_int_status lpi_istat;
-		memset(&lpi_istat, 0, sizeof(struct lpi_int_status));
-
-		ret = gpy2xx_gmacf_lpi_istat_get(&phy, &lpi_istat);
-
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full LPI interrupt status get failed.\n");
-			return -1;
-		}
+		printf("\t%40s:\t0x%x\n", "Flow Control Busy", pcfg.flow_ctrl_busy);
+		printf("\t%40s:\t0x%x\n", "PM's GMAC Flow Control Enable", pcfg.pm_gmacl_fc);
+		printf("\t%40s:\t0x%x\n", "Tx Flow Control Enable", pcfg.tx_flow_ctrl);
+		printf("\t%40s:\t0x%x\n", "Pause Low Threshold", pcfg.pause_low_thresh);
+		printf("\t%40s:\t0x%x\n", "Disable Zero-Quanta Paus", pcfg.dis_zquanta_pause);
+		printf("\t%40s:\t0x%x\n", "Pause Time", pcfg.pause_time);
+		printf("\t%s:\t", "Pause frame's Src MAC to sent with");
+		printMAC_Address(pcfg.tx_fc_mac);
+		printf("\n");
+		printf("\t%40s:\t0x%x\n", "Pause Assesrt Threshold", pcfg.pause_assert_thresh);
+		printf("\t%40s:\t0x%x\n", "Pause De-Assesrt Threshold", pcfg.pause_deassert_thresh);
+		break;
+	}
+	case CLI_CMD_gpy2xx_pm_freq_tune: {
+		struct tune_freq freq;
+		memset(&freq, 0, sizeof(struct tune_freq));
 
-		printf("\t%40s:\t0x%x\n", "Rx LPI microsecond counter interrupt status", lpi_istat.rx_lpi_usc_is);
-		printf("\t%40s:\t0x%x\n", "Rx LPI transition counter interrupt status", lpi_istat.rx_lpi_tc_is);
-		printf("\t%40s:\t0x%x\n", "Tx LPI microsecond counter interrupt status", lpi_istat.tx_lpi_usc_is);
-		printf("\t%40s:\t0x%x\n", "Tx LPI transition counter interrupt status", lpi_istat.tx_lpi_tc_is);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_lpi_count_get", strlen("gpy2xx_gmacf_lpi_count_get")) == 0) {
-		struct lpi_counters lpi_cntr;
-		memset(&lpi_cntr, 0, sizeof(struct lpi_counters));
+		cli_parse(cmd, argc, argv, &freq);
 
-		ret = gpy2xx_gmacf_lpi_count_get(&phy, &lpi_cntr);
+		ret = gpy2xx_pm_freq_tune(&phy, &freq);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full LPI counters get failed.\n");
+			printf("\nERROR: PM's frequency tuning failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_reach_cfg: {
+		struct gpy211_usxgmii_reach reach_cfg;
+		memset(&reach_cfg, 0, sizeof(struct gpy211_usxgmii_reach));
 
-		printf("\t%40s:\t0x%x\n", "Tx LPI Microseconds Counter", lpi_cntr.tx_lpi_usc);
-		printf("\t%40s:\t0x%x\n", "Tx LPI Transition Counters", lpi_cntr.tx_lpi_usc);
-		printf("\t%40s:\t0x%x\n", "Rx LPI Microseconds Counter", lpi_cntr.rx_lpi_usc);
-		printf("\t%40s:\t0x%x\n", "Rx LPI Transition Counter", lpi_cntr.rx_lpi_trc);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_cfg", strlen("gpy2xx_gmacf_cfg")) == 0) {
-		int cnt = 0;
-		struct gmac_cfg mac_cfg;
-		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
-
-		ret = gpy2xx_gmacf_get(&phy, &mac_cfg);
+		ret = gpy2xx_usxgmii_reach_get(&phy, &reach_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full MAC cfg info get failed.\n");
+			printf("\nERROR:Egr USXGMII reach get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "reEn", sizeof(mac_cfg.re_en), &mac_cfg.re_en);
-		cnt += scanParamArg(argc, argv, "teEn", sizeof(mac_cfg.te_en), &mac_cfg.te_en);
-		cnt += scanParamArg(argc, argv, "preambLen", sizeof(mac_cfg.preamble_len), &mac_cfg.preamble_len);
-		cnt += scanParamArg(argc, argv, "lbmEn", sizeof(mac_cfg.loopback_en), &mac_cfg.loopback_en);
-		cnt += scanParamArg(argc, argv, "fdupEn", sizeof(mac_cfg.fulldup_en), &mac_cfg.fulldup_en);
-		cnt += scanParamArg(argc, argv, "macSpeed", sizeof(mac_cfg.mac_speed), &mac_cfg.mac_speed);
-		cnt += scanParamArg(argc, argv, "rcWrite1", sizeof(mac_cfg.rc_write1_en), &mac_cfg.rc_write1_en);
+		cli_parse(cmd, argc, argv, &reach_cfg);
 
-		ret = gpy2xx_gmacf_cfg(&phy, &mac_cfg);
+		ret = gpy2xx_usxgmii_reach_cfg(&phy, &reach_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full MAC cfg info set failed.\n");
+			printf("\nERROR:Egr USXGMII reach configure failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_get", strlen("gpy2xx_gmacf_get")) == 0) {
-		struct gmac_cfg mac_cfg;
-		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_reach_get: {
+		struct gpy211_usxgmii_reach reach_cfg;
+		memset(&reach_cfg, 0, sizeof(struct gpy211_usxgmii_reach));
 
-		ret = gpy2xx_gmacf_get(&phy, &mac_cfg);
+		ret = gpy2xx_usxgmii_reach_get(&phy, &reach_cfg);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full MAC cfg info get failed.\n");
+			printf("\nERROR:Egr usxgmii reach get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Receiver Enable", mac_cfg.re_en);
-		printf("\t%40s:\t0x%x\n", "Transmitter Enable", mac_cfg.te_en);
-		printf("\t%40s:\t0x%x\n", "Preamble Length in Bytes", mac_cfg.preamble_len);
-		printf("\t%40s:\t0x%x\n", "Loopback Enable", mac_cfg.loopback_en);
-		printf("\t%40s:\t0x%x\n", "Full-duplex Enable", mac_cfg.fulldup_en);
-		printf("\t%40s:\t0x%x\n", "MAC speed", mac_cfg.mac_speed);
-		printf("\t%40s:\t0x%x\n", "Register Clear on Write 1 Enable", mac_cfg.rc_write1_en);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_cfg", strlen("gpy2xx_gmacl_cfg")) == 0) {
-		int cnt = 0;
-		struct gmac_cfg mac_cfg;
-		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
+		printf("\t%40s:\t%s\n", "trace_len", (reach_cfg.trace_len) == 0 ? "SHORT" : ((reach_cfg.trace_len) == 1 ? "MEDIUM" : ((reach_cfg.trace_len) == 2 ? "LONG" : "CUSTOM")));
+		printf("\t%40s:\t0x%x\n", "tx_eq_main", reach_cfg.tx_eq_main);
+		printf("\t%40s:\t0x%x\n", "tx_eq_pre", reach_cfg.tx_eq_pre);
+		printf("\t%40s:\t0x%x\n", "tx_eq_post", reach_cfg.tx_eq_post);
+		printf("\t%40s:\t%s\n", "tx_vboost_en", (reach_cfg.tx_vboost_en == 0) ? "Disabled" : "Enabled");
+		printf("\t%40s:\t0x%x\n", "tx_vboost_lvl", reach_cfg.tx_vboost_lvl);
+		printf("\t%40s:\t0x%x\n", "tx_iboost_lvl", reach_cfg.tx_iboost_lvl);
+		printf("\t%40s:\t0x%x\n", "rx_eq_att_lvl", reach_cfg.rx_eq_att_lvl);
+		printf("\t%40s:\t0x%x\n", "rx_eq_vga1_gain", reach_cfg.rx_eq_vga1_gain);
+		printf("\t%40s:\t0x%x\n", "rx_eq_vga2_gain", reach_cfg.rx_eq_vga2_gain);
+		printf("\t%40s:\t0x%x\n", "rx_eq_ctle_boost", reach_cfg.rx_eq_ctle_boost);
+		printf("\t%40s:\t0x%x\n", "rx_eq_ctle_pole", reach_cfg.rx_eq_ctle_pole);
+		printf("\t%40s:\t0x%x\n", "rx_eq_dfe_tap1", reach_cfg.rx_eq_dfe_tap1);
+		printf("\t%40s:\t%s\n", "rx_afe_adapt_en", (reach_cfg.rx_afe_adapt_en == 0) ? "Disabled" : "Enabled");
+		printf("\t%40s:\t%s\n", "rx_dfe_adapt_en", (reach_cfg.rx_dfe_adapt_en == 0) ? "Disabled" : "Enabled");
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_aneg_sts: {
+		struct gpy211_usxgmii_aneg_status status;
+		memset(&status, 0, sizeof(struct gpy211_usxgmii_aneg_status));
 
-		ret = gpy2xx_gmacl_get(&phy, &mac_cfg);
+		ret = gpy2xx_usxgmii_aneg_sts(&phy, &status);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite MAC cfg info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_aneg_sts failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "reEn", sizeof(mac_cfg.re_en), &mac_cfg.re_en);
-		cnt += scanParamArg(argc, argv, "teEn", sizeof(mac_cfg.te_en), &mac_cfg.te_en);
-		cnt += scanParamArg(argc, argv, "preambLen", sizeof(mac_cfg.preamble_len), &mac_cfg.preamble_len);
-		cnt += scanParamArg(argc, argv, "lbmEn", sizeof(mac_cfg.loopback_en), &mac_cfg.loopback_en);
-		cnt += scanParamArg(argc, argv, "fdupEn", sizeof(mac_cfg.fulldup_en), &mac_cfg.fulldup_en);
-		cnt += scanParamArg(argc, argv, "macSpeed", sizeof(mac_cfg.mac_speed), &mac_cfg.mac_speed);
-		cnt += scanParamArg(argc, argv, "rcWrite1", sizeof(mac_cfg.rc_write1_en), &mac_cfg.rc_write1_en);
+		printf("\t%40s:\t0x%x\n", "phy_addr", phy.phy_addr);
+		printf("\t%40s:\t%s\n", "phy_side", status.phy_side ? "usxgmii_phy" : "usxgmii_mac");
+		printf("\t%40s:\t%s\n", "force_mode", status.force_mode ? "Enabled" : "Disabled");
+		printf("\t%40s:\t%s\n", "aneg_enable", status.aneg_enable ? "Enabled" : "Disabled");
+		printf("\t%40s:\t%s\n", "aneg_complete", status.aneg_complete ? "Complete" : "Not Complete");
+		printf("\t%40s:\t%s\n", "aneg_linksts", status.aneg_linksts ? "Link Up" : "Link Down");
+		printf("\t%40s:\t%d\n", "aneg_speed", status.aneg_speed);
+		printf("\t%40s:\t%s\n", "aneg_duplex", status.aneg_duplex ? "Full Duplex" : "Half Duplex");
+		printf("\t%40s:\t%s\n", "mii_linksts", status.mii_linksts ? "Link Up" : "Link Down");
+		printf("\t%40s:\t%d\n", "mii_speed", status.mii_speed);
+		printf("\t%40s:\t%s\n", "mii_duplex", status.mii_duplex ? "Full Duplex" : "Half Duplex");
 
-		ret = gpy2xx_gmacl_cfg(&phy, &mac_cfg);
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_aneg_rst: {
+		ret = gpy2xx_usxgmii_aneg_rst(&phy);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite MAC cfg info set failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_aneg_rst failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_get", strlen("gpy2xx_gmacl_get")) == 0) {
-		struct gmac_cfg mac_cfg;
-		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
-		ret = gpy2xx_gmacl_get(&phy, &mac_cfg);
+		printf("\t%40s:\t0x%x\n", "Usxgmii Aneg configuration applied for phy_addr", phy.phy_addr);
+
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_pcs_pma_linksts: {
+		struct gpy211_usxgmii_pcs_pma_linksts linkstatus;
+		memset(&linkstatus, 0, sizeof(struct gpy211_usxgmii_pcs_pma_linksts));
+
+		ret = gpy2xx_usxgmii_pcs_pma_linksts(&phy, &linkstatus);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite MAC cfg info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_pcs_pma_linksts failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Receiver Enable", mac_cfg.re_en);
-		printf("\t%40s:\t0x%x\n", "Transmitter Enable", mac_cfg.te_en);
-		printf("\t%40s:\t0x%x\n", "Preamble Length in Bytes", mac_cfg.preamble_len);
-		printf("\t%40s:\t0x%x\n", "Loopback Enable", mac_cfg.loopback_en);
-		printf("\t%40s:\t0x%x\n", "Full-duplex Enable", mac_cfg.fulldup_en);
-		printf("\t%40s:\t0x%x\n", "MAC speed", mac_cfg.mac_speed);
-		printf("\t%40s:\t0x%x\n", "Register Clear on Write 1 Enable", mac_cfg.rc_write1_en);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pkt_cfg", strlen("gpy2xx_gmacl_pkt_cfg")) == 0) {
-		int cnt = 0;
-		struct gmac_pkt_cfg pkt_cfg;
-		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
+		printf("\t%40s:\t%s\n", "pma_latched_linksts", linkstatus.pma_latched_linksts ? "Link Up" : "Link Down");
+		printf("\t%40s:\t%s\n", "pma_linksts", linkstatus.pma_linksts ? "Link Up" : "Link Down");
+		printf("\t%40s:\t%s\n", "pcs_latched_linksts", linkstatus.pcs_latched_linksts ? "Link Up" : "Link Down");
+		printf("\t%40s:\t%s\n", "pcs_linksts", linkstatus.pcs_linksts ? "Link Up" : "Link Down");
 
-		ret = gpy2xx_gmacl_pkt_get(&phy, &pkt_cfg);
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_mii_linksts: {
+		struct gpy211_usxgmii_mii_linksts linkstatus;
+		memset(&linkstatus, 0, sizeof(struct gpy211_usxgmii_mii_linksts));
+
+		ret = gpy2xx_usxgmii_mii_linksts(&phy, &linkstatus);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite packet cfg info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_mii_linksts failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "jumboEn", sizeof(pkt_cfg.jumbo_en), &pkt_cfg.jumbo_en);
-		cnt += scanParamArg(argc, argv, "jabberDis", sizeof(pkt_cfg.tx_jabber_dis), &pkt_cfg.tx_jabber_dis);
-		cnt += scanParamArg(argc, argv, "wdogDis", sizeof(pkt_cfg.watchdog_dis), &pkt_cfg.watchdog_dis);
-		cnt += scanParamArg(argc, argv, "pcStrip", sizeof(pkt_cfg.pad_crc_strip_en), &pkt_cfg.pad_crc_strip_en);
-		cnt += scanParamArg(argc, argv, "crcStrip", sizeof(pkt_cfg.crc_strip_en), &pkt_cfg.crc_strip_en);
-		cnt += scanParamArg(argc, argv, "sup2kp", sizeof(pkt_cfg.support_2kp), &pkt_cfg.support_2kp);
-		cnt += scanParamArg(argc, argv, "macIpg", sizeof(pkt_cfg.mac_ipg), &pkt_cfg.mac_ipg);
+		printf("\t%40s:\t0x%x\n", "phy_addr", phy.phy_addr);
+		printf("\t%40s:\t%s\n", "latched_linksts", linkstatus.latched_linksts ? "Link Up" : "Link Down");
+		printf("\t%40s:\t%s\n", "linksts", linkstatus.linksts ? "Link Up" : "Link Down");
+
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_alignmentmarker_set: {
+		u32 am = 0;
 
-		ret = gpy2xx_gmacl_pkt_cfg(&phy, &pkt_cfg);
+		cli_parse(cmd, argc, argv, &am);
+		ret = gpy2xx_usxgmii_alignmentmarker_set(&phy, am);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite packet cfg info set failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_alignmentmarker_set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pkt_get", strlen("gpy2xx_gmacl_pkt_get")) == 0) {
-		struct gmac_pkt_cfg pkt_cfg;
-		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
-		ret = gpy2xx_gmacl_pkt_get(&phy, &pkt_cfg);
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_alignmentmarker_get: {
+		u32 am = 0;
+
+		ret = gpy2xx_usxgmii_alignmentmarker_get(&phy, &am);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite packet cfg info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_alignmentmarker_get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Jumbo Packet Enable", pkt_cfg.jumbo_en);
-		printf("\t%40s:\t0x%x\n", "Jabber Disable", pkt_cfg.tx_jabber_dis);
-		printf("\t%40s:\t0x%x\n", "Watchdog Disable", pkt_cfg.watchdog_dis);
-		printf("\t%40s:\t0x%x\n", "Pad or CRC Stripping for Ether 'Length' packets", pkt_cfg.pad_crc_strip_en);
-		printf("\t%40s:\t0x%x\n", "CRC Stripping for Ether 'Type' packets", pkt_cfg.crc_strip_en);
-		printf("\t%40s:\t0x%x\n", "802.3as Support for 2K Packets", pkt_cfg.support_2kp);
-		printf("\t%40s:\t0x%x\n", "Inter-Packet Gap in Bytes", (12 - pkt_cfg.mac_ipg));
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_pkt_filter_cfg", strlen("gpy2xx_gmacf_pkt_filter_cfg")) == 0) {
-		int cnt = 0;
-		struct gmac_pktflt_cfg flt_cfg;
-		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
+		printf("\t%40s:\t0x%x\n", "usxgmii_am_count", am);
 
-		ret = gpy2xx_gmacf_pkt_filter_get(&phy, &flt_cfg);
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_vr_reset: {
+		ret = gpy2xx_usxgmii_vr_reset(&phy);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full packet filter info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_vr_reset failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_vr_reset_sts: {
+		int success = 0;
 
-		cnt += scanParamArg(argc, argv, "prEn", sizeof(flt_cfg.promiscuous_en), &flt_cfg.promiscuous_en);
-		cnt += scanParamArg(argc, argv, "passAmc", sizeof(flt_cfg.pass_all_mc), &flt_cfg.pass_all_mc);
-		cnt += scanParamArg(argc, argv, "blockBc", sizeof(flt_cfg.block_bc), &flt_cfg.block_bc);
-		cnt += scanParamArg(argc, argv, "passCtrl", sizeof(flt_cfg.pass_ctrl_pkts), &flt_cfg.pass_ctrl_pkts);
-		cnt += scanParamArg(argc, argv, "safltrEn", sizeof(flt_cfg.sa_filter_en), &flt_cfg.sa_filter_en);
-		cnt += scanParamArg(argc, argv, "rxAll", sizeof(flt_cfg.rx_all_en), &flt_cfg.rx_all_en);
-
-		ret = gpy2xx_gmacf_pkt_filter_cfg(&phy, &flt_cfg);
+		ret = gpy2xx_usxgmii_vr_reset_sts(&phy, &success);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full packet filter info set failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_vr_reset_sts failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_pkt_filter_get", strlen("gpy2xx_gmacf_pkt_filter_get")) == 0) {
-		struct gmac_pktflt_cfg flt_cfg;
-		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
-		ret = gpy2xx_gmacf_pkt_filter_get(&phy, &flt_cfg);
+		printf("\t%40s:\t%s\n", "VR reset ", success ? "complete/sucessfull" : "not complete/unsucessfull");
+
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_tx_bert_cfg: {
+		struct gpy211_usxgmii_tx_bert_config bert_tx_config;
+		memset(&bert_tx_config, 0, sizeof(struct gpy211_usxgmii_tx_bert_config));
+
+		cli_parse(cmd, argc, argv, &bert_tx_config);
+
+		ret = gpy2xx_usxgmii_tx_bert_cfg(&phy, &bert_tx_config);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-full packet filter info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_tx_bert_cfg failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_tx_bert_get: {
+		struct gpy211_usxgmii_tx_bert_config bert_tx_config;
+		memset(&bert_tx_config, 0, sizeof(struct gpy211_usxgmii_tx_bert_config));
 
-		printf("\t%40s:\t0x%x\n", "Promiscuous Mode", flt_cfg.promiscuous_en);
-		printf("\t%40s:\t0x%x\n", "Pass All Multicast", flt_cfg.pass_all_mc);
-		printf("\t%40s:\t0x%x\n", "Block all BC incoming frames", flt_cfg.block_bc);
-		printf("\t%40s:\t0x%x\n", "Pass Control Packets mode", flt_cfg.pass_ctrl_pkts);
-		printf("\t%40s:\t0x%x\n", "Source Address Filter Enable", flt_cfg.sa_filter_en);
-		printf("\t%40s:\t0x%x\n", "Receive All", flt_cfg.rx_all_en);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pkt_filter_cfg", strlen("gpy2xx_gmacl_pkt_filter_cfg")) == 0) {
-		int cnt = 0;
-		struct gmac_pktflt_cfg flt_cfg;
-		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
-
-		ret = gpy2xx_gmacl_pkt_filter_get(&phy, &flt_cfg);
+		ret = gpy2xx_usxgmii_tx_bert_get(&phy, &bert_tx_config);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite packet filter info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_tx_bert_get failed.\n");
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "prEn", sizeof(flt_cfg.promiscuous_en), &flt_cfg.promiscuous_en);
-		cnt += scanParamArg(argc, argv, "passAmc", sizeof(flt_cfg.pass_all_mc), &flt_cfg.pass_all_mc);
-		cnt += scanParamArg(argc, argv, "blockBc", sizeof(flt_cfg.block_bc), &flt_cfg.block_bc);
-		cnt += scanParamArg(argc, argv, "passCtrl", sizeof(flt_cfg.pass_ctrl_pkts), &flt_cfg.pass_ctrl_pkts);
-		cnt += scanParamArg(argc, argv, "safltrEn", sizeof(flt_cfg.sa_filter_en), &flt_cfg.sa_filter_en);
-		cnt += scanParamArg(argc, argv, "rxAll", sizeof(flt_cfg.rx_all_en), &flt_cfg.rx_all_en);
+		switch (bert_tx_config.mode) {
+		case BERT_SQUAREWAVE_TX:
+			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_SQUAREWAVE_TX");
 
-		ret = gpy2xx_gmacl_pkt_filter_cfg(&phy, &flt_cfg);
+			if (bert_tx_config.nval_sel == 0)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_4");
+			else if (bert_tx_config.nval_sel == 1)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_5");
+			else if (bert_tx_config.nval_sel == 2)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_6");
+			else if (bert_tx_config.nval_sel == 3)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_7");
+			else if (bert_tx_config.nval_sel == 4)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_8");
+			else if (bert_tx_config.nval_sel == 5)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_9");
+			else if (bert_tx_config.nval_sel == 6)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_10");
+			else if (bert_tx_config.nval_sel == 7)
+				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_11");
+			else
+				printf("\t%40s:\t%40s\n", "NVAL", "Un-Supported NVAL");
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite packet filter info set failed.\n");
-			return -1;
+			break;
+
+		case BERT_PRBS31_TX:
+			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_PRBS31_TX");
+			break;
+
+		case BERT_PRBS9_TX:
+			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_PRBS9_TX");
+			break;
+
+		case BERT_TX_MODE_DISABLE:
+			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_TX_MODE_DISABLE");
+			break;
+
+		case BERT_PSEUDO_RANDOM_TX:
+			printf("ERROR: BERT_PSEUDO_RANDOM_TX mode not supported\n");
+			break;
+
+		default:
+			printf("ERROR: Un-supported TX BERT mode\n");
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pkt_filter_get", strlen("gpy2xx_gmacl_pkt_filter_get")) == 0) {
-		struct gmac_pktflt_cfg flt_cfg;
-		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_rx_bert_cfg: {
+		struct gpy211_usxgmii_rx_bert_config bert_rx_config;
+		memset(&bert_rx_config, 0, sizeof(struct gpy211_usxgmii_rx_bert_config));
 
-		ret = gpy2xx_gmacl_pkt_filter_get(&phy, &flt_cfg);
+		cli_parse(cmd, argc, argv, &bert_rx_config);
+
+		ret = gpy2xx_usxgmii_rx_bert_cfg(&phy, &bert_rx_config);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Lite packet filter info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_cfg failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_rx_bert_get: {
+		struct gpy211_usxgmii_rx_bert_config bert_rx_config;
+		memset(&bert_rx_config, 0, sizeof(struct gpy211_usxgmii_rx_bert_config));
 
-		printf("\t%40s:\t0x%x\n", "Promiscuous Mode", flt_cfg.promiscuous_en);
-		printf("\t%40s:\t0x%x\n", "Pass All Multicast", flt_cfg.pass_all_mc);
-		printf("\t%40s:\t0x%x\n", "Block all BC incoming frames", flt_cfg.block_bc);
-		printf("\t%40s:\t0x%x\n", "Pass Control Packets mode", flt_cfg.pass_ctrl_pkts);
-		printf("\t%40s:\t0x%x\n", "Source Address Filter Enable", flt_cfg.sa_filter_en);
-		printf("\t%40s:\t0x%x\n", "Receive All", flt_cfg.rx_all_en);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_debug_info_get", strlen("gpy2xx_gmacf_debug_info_get")) == 0) {
-		struct gmac_debug_info dbg_info;
-		memset(&dbg_info, 0, sizeof(struct gmac_debug_info));
-
-		ret = gpy2xx_gmacf_debug_info_get(&phy, &dbg_info);
+		ret = gpy2xx_usxgmii_rx_bert_get(&phy, &bert_rx_config);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full debug info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_get failed.\n");
 			return -1;
 		}
 
-		printf("\t%40s:\t0x%x\n", "Synopsys-defined Version", dbg_info.synop_ver);
-		printf("\t%40s:\t0x%x\n", "User-defined Version", dbg_info.user_ver);
-		printf("\t%40s:\t0x%x\n", "Tx Jabber Timeout", dbg_info.tx_jabber_to);
-		printf("\t%40s:\t0x%x\n", "Rx Watchdog Timeout", dbg_info.rx_wdog_to);
-		printf("\t%40s:\t0x%x\n", "GMII or MII Receive Protocol Engine Status", dbg_info.gmii_rpe_stat);
-		printf("\t%40s:\t0x%x\n", "Receive Packet Controller FIFO Status", dbg_info.rpc_fifo_stat);
-		printf("\t%40s:\t0x%x\n", "GMII or MII Transmit Protocol Engine Status", dbg_info.gmii_tpe_stat);
-		printf("\t%40s:\t0x%x\n", "Transmit Packet Controller FIFO Status", dbg_info.tpc_fifo_stat);
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_pkt_cfg", strlen("gpy2xx_gmacf_pkt_cfg")) == 0) {
-		int cnt = 0;
-		struct gmac_pkt_cfg pkt_cfg;
-		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
+		switch (bert_rx_config.mode) {
+		case BERT_PRBS31_RX:
+			printf("\t%40s:\t%40s\n", "RX bert mode", "BERT_PRBS31_RX");
+			break;
+
+		case BERT_PRBS9_RX:
+			printf("\t%40s:\t%40s\n", "RX bert mode", "BERT_PRBS9_RX");
+			break;
+
+		case BERT_RX_MODE_DISABLE:
+			printf("\t%40s:\t%40s\n", "RX bert mode", "BERT_RX_MODE_DISABLE");
+			break;
 
-		ret = gpy2xx_gmacf_pkt_get(&phy, &pkt_cfg);
+		case BERT_PSEUDO_RANDOM_RX:
+			printf("ERROR: BERT_PSEUDO_RANDOM_RX mode not supported\n");
+			break;
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full packet cfg info get failed.\n");
-			return -1;
+		default:
+			printf("ERROR: Un-supported RX BERT mode\n");
 		}
-
-		cnt += scanParamArg(argc, argv, "jumboEn", sizeof(pkt_cfg.jumbo_en), &pkt_cfg.jumbo_en);
-		cnt += scanParamArg(argc, argv, "jabberDis", sizeof(pkt_cfg.tx_jabber_dis), &pkt_cfg.tx_jabber_dis);
-		cnt += scanParamArg(argc, argv, "wdogDis", sizeof(pkt_cfg.watchdog_dis), &pkt_cfg.watchdog_dis);
-		cnt += scanParamArg(argc, argv, "pcStrip", sizeof(pkt_cfg.pad_crc_strip_en), &pkt_cfg.pad_crc_strip_en);
-		cnt += scanParamArg(argc, argv, "crcStrip", sizeof(pkt_cfg.crc_strip_en), &pkt_cfg.crc_strip_en);
-		cnt += scanParamArg(argc, argv, "sup2kp", sizeof(pkt_cfg.support_2kp), &pkt_cfg.support_2kp);
-		cnt += scanParamArg(argc, argv, "macIpg", sizeof(pkt_cfg.mac_ipg), &pkt_cfg.mac_ipg);
-
-		ret = gpy2xx_gmacf_pkt_cfg(&phy, &pkt_cfg);
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_rx_bert_stat: {
+		struct gpy211_usxgmii_rx_bert_statistics rx_bert_statistics;
+		memset(&rx_bert_statistics, 0, sizeof(struct gpy211_usxgmii_rx_bert_statistics));
+		ret = gpy2xx_usxgmii_rx_bert_stat(&phy, &rx_bert_statistics);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full packet cfg info set failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_stat failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_pkt_get", strlen("gpy2xx_gmacf_pkt_get")) == 0) {
-		struct gmac_pkt_cfg pkt_cfg;
-		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
-		ret = gpy2xx_gmacf_pkt_get(&phy, &pkt_cfg);
+		printf("\t%40s:\t0x%x\n", "tp_error_count", rx_bert_statistics.tp_error_count);
+		printf("\t%40s:\t0x%x\n", "error_block_count", rx_bert_statistics.error_block_count);
+		printf("\t%40s:\t0x%x\n", "bit_error_rate_counter", rx_bert_statistics.bit_error_rate_counter);
+		printf("\t%40s:\t0x%x\n", "latched_high_bit_err_rate", rx_bert_statistics.latched_high_bit_err_rate);
+		printf("\t%40s:\t0x%x\n", "latched_block_lock", rx_bert_statistics.latched_block_lock);
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Fullpacket cfg info get failed.\n");
-			return -1;
-		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_loopback_cfg: {
+		enum gpy211_usxgmii_loopback_mode mode = USXGMII_LOOPBACK_DISABLE;
 
-		printf("\t%40s:\t0x%x\n", "Jumbo Packet Enable", pkt_cfg.jumbo_en);
-		printf("\t%40s:\t0x%x\n", "Jabber Disable", pkt_cfg.tx_jabber_dis);
-		printf("\t%40s:\t0x%x\n", "Watchdog Disable", pkt_cfg.watchdog_dis);
-		printf("\t%40s:\t0x%x\n", "Pad or CRC Stripping for Ether 'Length' packets", pkt_cfg.pad_crc_strip_en);
-		printf("\t%40s:\t0x%x\n", "CRC Stripping for Ether 'Type' packets", pkt_cfg.crc_strip_en);
-		printf("\t%40s:\t0x%x\n", "802.3as Support for 2K Packets", pkt_cfg.support_2kp);
-		printf("\t%40s:\t0x%x\n", "Inter-Packet Gap in Bytes", pkt_cfg.mac_ipg);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_count_ctrl_cfg", strlen("gpy2xx_gmacf_count_ctrl_cfg")) == 0) {
-		int cnt = 0;
-		struct gmacf_counter_ctrl cnt_ctrl;
-		memset(&cnt_ctrl, 0, sizeof(struct gmacf_counter_ctrl));
+		cli_parse(cmd, argc, argv, &mode);
 
-		ret = gpy2xx_gmacf_count_ctrl_get(&phy, &cnt_ctrl);
+		ret = gpy2xx_usxgmii_loopback_cfg(&phy, mode);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters control info get failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_loopback_cfg failed.\n");
 			return -1;
 		}
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_loopback_get: {
+		enum gpy211_usxgmii_loopback_mode mode = USXGMII_LOOPBACK_INVALID;
 
-		cnt += scanParamArg(argc, argv, "rstCnt", sizeof(cnt_ctrl.reset_counters), &cnt_ctrl.reset_counters);
-		cnt += scanParamArg(argc, argv, "stopRoll", sizeof(cnt_ctrl.stop_rollover), &cnt_ctrl.stop_rollover);
-		cnt += scanParamArg(argc, argv, "conRead", sizeof(cnt_ctrl.clear_on_read), &cnt_ctrl.clear_on_read);
-		cnt += scanParamArg(argc, argv, "frzCnt", sizeof(cnt_ctrl.freeze_counters), &cnt_ctrl.freeze_counters);
-		cnt += scanParamArg(argc, argv, "pstCnt", sizeof(cnt_ctrl.preset_counters), &cnt_ctrl.preset_counters);
-		cnt += scanParamArg(argc, argv, "psthFull", sizeof(cnt_ctrl.preset_half_full), &cnt_ctrl.preset_half_full);
-		cnt += scanParamArg(argc, argv, "cntbcDrop", sizeof(cnt_ctrl.count_dropped_bc), &cnt_ctrl.count_dropped_bc);
-
-		ret = gpy2xx_gmacf_count_ctrl_cfg(&phy, &cnt_ctrl);
+		ret = gpy2xx_usxgmii_loopback_get(&phy, &mode);
 
 		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters control info set failed.\n");
+			printf("\nERROR:Egr gpy2xx_usxgmii_loopback_get failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_count_ctrl_get", strlen("gpy2xx_gmacf_count_ctrl_get")) == 0) {
-		struct gmacf_counter_ctrl cnt_ctrl;
-		memset(&cnt_ctrl, 0, sizeof(struct gmacf_counter_ctrl));
 
-		ret = gpy2xx_gmacf_count_ctrl_get(&phy, &cnt_ctrl);
+		printf("\tmode:\t");
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters control info get failed.\n");
-			return -1;
-		}
+		switch (mode) {
+		case USXGMII_LOOPBACK_DISABLE:
+			printf("disabled\n");
+			break;
 
-		printf("\t%40s:\t0x%x\n", "Counters Reset", cnt_ctrl.reset_counters);
-		printf("\t%40s:\t0x%x\n", "Counter Stop Rollover", cnt_ctrl.stop_rollover);
-		printf("\t%40s:\t0x%x\n", "Reset on Read", cnt_ctrl.clear_on_read);
-		printf("\t%40s:\t0x%x\n", "Counters Freeze", cnt_ctrl.freeze_counters);
-		printf("\t%40s:\t0x%x\n", "Counters Preset", cnt_ctrl.preset_counters);
-		printf("\t%40s:\t0x%x\n", "Full-Half Preset", cnt_ctrl.preset_half_full);
-		printf("\t%40s:\t0x%x\n", "Update Counters for Dropped BC Packets", cnt_ctrl.count_dropped_bc);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_count_get", strlen("gpy2xx_gmacf_count_get")) == 0) {
-		struct gmacf_counters full_ctrs;
-		memset(&full_ctrs, 0, sizeof(struct gmacf_counters));
+		case USXGMII_LOOPBACK_TX2RX:
+			printf("Tx to Rx Serial Loopback\n");
+			break;
 
-		ret = gpy2xx_gmacf_count_get(&phy, &full_ctrs);
+		case USXGMII_LOOPBACK_RX2TX:
+			printf("Rx to Tx Parallel Loopback\n");
+			break;
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters get failed.\n");
-			return -1;
+		default:
+			printf("invalid configuration\n");
 		}
+		break;
+	}
+	default:
+		printf("Command Not Supported\n");
+		ret = -1;
+		break;
+	}
+	return ret;
+}
 
-		printf("\nTx Counters:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Tx Good & Bad frame count", full_ctrs.tx_good_bad);
-		printf("\t%40s:\t0x%x\n", "Tx Underflow error frame count", full_ctrs.tx_uflow_err);
-		printf("\t%40s:\t0x%x\n", "Tx Good frame count", full_ctrs.tx_good);
-		printf("\t%40s:\t0x%x\n", "Tx Oversize Good frame count", full_ctrs.tx_osize_good);
-		printf("\nRx Counters:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Rx Good & Bad frame count", full_ctrs.rx_good_bad);
-		printf("\t%40s:\t0x%x\n", "Rx CRC error frame count", full_ctrs.rx_crc_err);
-		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame count", full_ctrs.rx_usize_good);
-		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame count", full_ctrs.rx_osize_good);
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_count_imask_cfg", strlen("gpy2xx_gmacf_count_imask_cfg")) == 0) {
-		int cnt = 0;
-		struct counter_imask cnt_imask;
-		memset(&cnt_imask, 0, sizeof(struct counter_imask));
+static u32 rand_val(size_t size)
+{
+	if (size < 16)
+		return rand() & ((1 << size) - 1);
+	else if (size < 31)
+		return ((rand() << 15) | rand()) & ((1 << size) - 1);
+	else
+		return (rand() << 30) | (rand() << 15) | rand();
+}
 
-		ret = gpy2xx_gmacf_count_imask_get(&phy, &cnt_imask);
+static u64 rand_val64()
+{
+	u64 val = rand();
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters interrupt mask get failed.\n");
-			return -1;
-		}
+	val = (val << 15) | rand();
+	val = (val << 15) | rand();
+	val = (val << 15) | rand();
+	return (val << 4) | (rand() * 3 / RAND_MAX);
+}
 
-		cnt += scanParamArg(argc, argv, "txGb", sizeof(cnt_imask.tx_good_bad_im), &cnt_imask.tx_good_bad_im);
-		cnt += scanParamArg(argc, argv, "txUflow", sizeof(cnt_imask.tx_uflow_err_im), &cnt_imask.tx_uflow_err_im);
-		cnt += scanParamArg(argc, argv, "txGood", sizeof(cnt_imask.tx_good_im), &cnt_imask.tx_good_im);
-		cnt += scanParamArg(argc, argv, "txOsize", sizeof(cnt_imask.tx_osize_good_im), &cnt_imask.tx_osize_good_im);
+static void rand_array(u8 *p, size_t size)
+{
+	size_t i;
 
-		cnt += scanParamArg(argc, argv, "rxGb", sizeof(cnt_imask.rx_good_bad_im), &cnt_imask.rx_good_bad_im);
-		cnt += scanParamArg(argc, argv, "rxCrc", sizeof(cnt_imask.rx_crc_err_im), &cnt_imask.rx_crc_err_im);
-		cnt += scanParamArg(argc, argv, "rxUsize", sizeof(cnt_imask.rx_usize_good_im), &cnt_imask.rx_usize_good_im);
-		cnt += scanParamArg(argc, argv, "rxOsize", sizeof(cnt_imask.rx_osize_good_im), &cnt_imask.rx_osize_good_im);
+	for (i = 0; i < size; i++)
+		p[i] = rand() * 0xFF / RAND_MAX;
+}
 
-		ret = gpy2xx_gmacf_count_imask_cfg(&phy, &cnt_imask);
+static void random_input(void)
+{
+	int ret;
+	u32 val1, val2, val3;
+	struct gpy211_link link = phy.link;
+	struct gpy211_led_brlvl_cfg brightnesscfg;
+	struct gpy211_led_cfg genifcfg;
+	struct gpy211_phy_extin extint;
+	struct timespec64 ts;
+	struct gpy211_ptp_ctrl ptpcfg;
+	struct gpy2xx_ts_ctrl tscfg;
+	struct gpy2xx_pps_ctrl ppscfg;
+	struct gpy211_synce syncecfg;
+	struct gpy211_wolinfo wolinfo;
+	struct gpy211_ads_ctrl ads;
+	struct gpy211_sgmii sgmiicfg;
+	struct gpy211_macsec msec_cfg;
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters interrupt mask set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_count_imask_get", strlen("gpy2xx_gmacf_count_imask_get")) == 0) {
-		struct counter_imask cnt_imask;
-		memset(&cnt_imask, 0, sizeof(struct counter_imask));
+	srand(time(NULL));
 
-		ret = gpy2xx_gmacf_count_imask_get(&phy, &cnt_imask);
+	val1 = rand_val(sizeof(u32) * 8);
+	ret = gpy2xx_smdio_read(&phy, val1);
+	printf("LOG: gpy2xx_smdio_read addr 0x%x returns %d\n", val1, ret);
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters interrupt mask get failed.\n");
-			return -1;
-		}
+	val1 = rand_val(sizeof(u32) * 8);
+	val2 = rand_val(sizeof(u16) * 8);
+	ret = gpy2xx_smdio_write(&phy, val1, val2);
+	printf("LOG: gpy2xx_smdio_write addr 0x%x with 0x%x returns %d\n", val1, val2, ret);
 
-		printf("\nTx counters interrupt mask:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Tx Good & Bad frame imask", cnt_imask.tx_good_bad_im);
-		printf("\t%40s:\t0x%x\n", "Tx Underflow error frame imask", cnt_imask.tx_uflow_err_im);
-		printf("\t%40s:\t0x%x\n", "Tx Good frame imask", cnt_imask.tx_good_im);
-		printf("\t%40s:\t0x%x\n", "Tx Oversize Good frame imask", cnt_imask.tx_osize_good_im);
-		printf("\nRx counters interrupt mask:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Rx Good & Bad frame imask", cnt_imask.rx_good_bad_im);
-		printf("\t%40s:\t0x%x\n", "Rx CRC error frame imask", cnt_imask.rx_crc_err_im);
-		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame imask", cnt_imask.rx_usize_good_im);
-		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame imask", cnt_imask.rx_osize_good_im);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacf_count_istat_get", strlen("gpy2xx_gmacf_count_istat_get")) == 0) {
-		struct counter_istat cnt_istat;
-		memset(&cnt_istat, 0, sizeof(struct counter_istat));
+	val1 = rand_val(sizeof(u32) * 8);
+	val2 = rand_val(sizeof(u32) * 8);
+	ret = gpy2xx_read_mmd(&phy, (int)val1, val2);
+	printf("LOG: gpy2xx_read_mmd dev 0x%x addr 0x%x returns %d\n", val1, val2, ret);
 
-		ret = gpy2xx_gmacf_count_istat_get(&phy, &cnt_istat);
+	val1 = rand_val(sizeof(u32) * 8);
+	val2 = rand_val(sizeof(u32) * 8);
+	val3 = rand_val(sizeof(u16) * 8);
+	ret = gpy2xx_write_mmd(&phy, (int)val1, val2, val3);
+	printf("LOG: gpy2xx_write_mmd dev 0x%x addr 0x%x with 0x%x returns %d\n", val1, val2, val3, ret);
 
-		if (ret < 0) {
-			printf("\nERROR: GMAC-Full counters interrupt status get failed.\n");
-			return -1;
-		}
+	val1 = rand_val(sizeof(u32) * 8);
+	ret = gpy2xx_mbox_read16(&phy, val1, &val2);
+	printf("LOG: gpy2xx_mbox_read16 addr 0x%x data 0x%x returns %d\n", val1, val2, ret);
 
-		printf("\nTx counters interrupt status:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Tx Good & Bad frame istatus", cnt_istat.tx_good_bad_is);
-		printf("\t%40s:\t0x%x\n", "Tx Underflow error frame istatus", cnt_istat.tx_uflow_err_is);
-		printf("\t%40s:\t0x%x\n", "Tx Good frame istatus", cnt_istat.tx_good_is);
-		printf("\t%40s:\t0x%x\n", "Tx Oversize Good frame istatus", cnt_istat.tx_osize_good_is);
-		printf("\nRx counters interrupt status:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "Rx Good & Bad frame istatus", cnt_istat.rx_good_bad_is);
-		printf("\t%40s:\t0x%x\n", "Rx CRC error frame istatus", cnt_istat.rx_crc_err_is);
-		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame istatus", cnt_istat.rx_usize_good_is);
-		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame istatus", cnt_istat.rx_osize_good_is);
-#endif
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacx_bm_cfg", strlen("gpy2xx_gmacx_bm_cfg")) == 0) {
-		int cnt = 0;
-		struct bm_cfg bmcfg;
-		memset(&bmcfg, 0, sizeof(struct bm_cfg));
+	val1 = rand_val(sizeof(u32) * 8);
+	val2 = rand_val(sizeof(u32) * 8);
+	ret = gpy2xx_mbox_write16(&phy, val1, val2);
+	printf("LOG: gpy2xx_mbox_write16 addr 0x%x with 0x%x returns %d\n", val1, val2, ret);
 
-		ret = gpy2xx_gmacx_bm_get(&phy, &bmcfg);
+	val1 = rand_val(sizeof(u32) * 8);
+	ret = gpy2xx_mbox_read32(&phy, val1, &val2);
+	printf("LOG: gpy2xx_mbox_read32 addr 0x%x data 0x%x returns %d\n", val1, val2, ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer info get failed.\n");
-			return -1;
-		}
+	val1 = rand_val(sizeof(u32) * 8);
+	val2 = rand_val(sizeof(u32) * 8);
+	ret = gpy2xx_mbox_write32(&phy, val1, val2);
+	printf("LOG: gpy2xx_mbox_write32 addr 0x%x with 0x%x returns %d\n", val1, val2, ret);
 
-		cnt += scanParamArg(argc, argv, "sb0Start", sizeof(bmcfg.sb0_start), &bmcfg.sb0_start);
-		cnt += scanParamArg(argc, argv, "sb0End", sizeof(bmcfg.sb0_end), &bmcfg.sb0_end);
-		cnt += scanParamArg(argc, argv, "sb0Pthresh", sizeof(bmcfg.sb0_pkt_thresh), &bmcfg.sb0_pkt_thresh);
-		cnt += scanParamArg(argc, argv, "sb1Start", sizeof(bmcfg.sb1_start), &bmcfg.sb1_start);
-		cnt += scanParamArg(argc, argv, "sb1End", sizeof(bmcfg.sb1_end), &bmcfg.sb1_end);
-		cnt += scanParamArg(argc, argv, "sb1Pthresh", sizeof(bmcfg.sb1_pkt_thresh), &bmcfg.sb1_pkt_thresh);
+	phy.link.advertising = rand_val64();
+	ret = gpy2xx_config_advert(&phy);
+	printf("LOG: gpy2xx_config_advert returns %d\n", ret);
+	phy.link = link;
 
-		ret = gpy2xx_gmacx_bm_cfg(&phy, &bmcfg);
+	phy.link.speed = rand_val(sizeof(int) * 8);
+	phy.link.duplex = rand_val(sizeof(int) * 8);
+	phy.link.pause = rand_val(sizeof(int) * 8);
+	phy.link.asym_pause = rand_val(sizeof(int) * 8);
+	ret = gpy2xx_setup_forced(&phy);
+	printf("LOG: gpy2xx_setup_forced returns %d\n", ret);
+	phy.link = link;
+
+	phy.link.autoneg = rand_val(1);
+	phy.link.speed = rand_val64();
+	phy.link.duplex = rand_val(sizeof(int) * 8);
+	phy.link.pause = rand_val(sizeof(int) * 8);
+	phy.link.asym_pause = rand_val(sizeof(int) * 8);
+	phy.link.supported = rand_val64();
+	phy.link.advertising = rand_val64();
+	ret = gpy2xx_config_aneg(&phy);
+	printf("LOG: gpy2xx_config_aneg returns %d\n", ret);
+	phy.link = link;
+
+	rand_array((u8 *)&brightnesscfg, sizeof(brightnesscfg));
+	ret = gpy2xx_led_br_cfg(&phy, &brightnesscfg);
+	printf("LOG: gpy2xx_led_br_cfg returns %d\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer info set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacx_bm_get", strlen("gpy2xx_gmacx_bm_get")) == 0) {
-		struct bm_cfg bmcfg;
-		memset(&bmcfg, 0, sizeof(struct bm_cfg));
+	rand_array((u8 *)&genifcfg, sizeof(genifcfg));
+	ret = gpy2xx_led_if_cfg(&phy, &genifcfg);
+	printf("LOG: gpy2xx_led_if_cfg returns %d\n", ret);
 
-		ret = gpy2xx_gmacx_bm_get(&phy, &bmcfg);
+	rand_array((u8 *)&extint, sizeof(extint));
+	ret = gpy2xx_extin_mask(&phy, &extint);
+	printf("LOG: gpy2xx_extin_mask returns %d\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer info get failed.\n");
-			return -1;
-		}
+	val1 = rand_val(8);
+	ret = gpy2xx_test_mode_cfg(&phy, val1);
+	printf("LOG: gpy2xx_test_mode_cfg returns %d\n", ret);
 
-		printf("\t%40s:\t0x%x\n", "SB 0 Start location", bmcfg.sb0_start);
-		printf("\t%40s:\t0x%x\n", "SB 0 End location", bmcfg.sb0_end);
-		printf("\t%40s:\t0x%x\n", "SB 0 Packet Threshold to start the dequeue", bmcfg.sb0_pkt_thresh);
-		printf("\t%40s:\t0x%x\n", "SB 1 Start location", bmcfg.sb1_start);
-		printf("\t%40s:\t0x%x\n", "SB 1 End location", bmcfg.sb1_end);
-		printf("\t%40s:\t0x%x\n", "SB 1 Packet Threshold to start the dequeue", bmcfg.sb1_pkt_thresh);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacx_bm_status_get", strlen("gpy2xx_gmacx_bm_status_get")) == 0) {
-		struct pm_bm_status bm_stat;
-		memset(&bm_stat, 0, sizeof(struct pm_bm_status));
+	val1 = rand_val(8);
+	ret = gpy2xx_loopback_cfg(&phy, val1);
+	printf("LOG: gpy2xx_loopback_cfg returns %d\n", ret);
 
-		ret = gpy2xx_gmacx_bm_status_get(&phy, &bm_stat);
+	val1 = rand_val(8);
+	ret = gpy2xx_errcnt_cfg(&phy, val1);
+	printf("LOG: gpy2xx_errcnt_cfg returns %d\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer status get failed.\n");
-			return -1;
-		}
+	val1 = rand_val(sizeof(int) * 8);
+	ret = gpy2xx_ptp_adjtime(&phy, val1);
+	printf("LOG: gpy2xx_ptp_adjtime returns %d\n", ret);
 
-		printf("\nSB-0 Buffer Status:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "SB 0 Overflow Indicator", bm_stat.sb0_ov);
-		printf("\t%40s:\t0x%x\n", "SB 0 Tx Register Overflow Indicator", bm_stat.sb0_tx_reg_ov);
-		printf("\t%40s:\t0x%x\n", "SB 0 Rx Register Overflow Indicator", bm_stat.sb0_rx_reg_ov);
-		printf("\t%40s:\t0x%x\n", "SB 0 Retry Indicator", bm_stat.sb0_retry);
-		printf("\t%40s:\t0x%x\n", "SB 0 Sent Indicator", bm_stat.sb0_sent);
-		printf("\t%40s:\t0x%x\n", "SB 0 Complete Indicator", bm_stat.sb0_complete);
+	rand_array((u8 *)&ts, sizeof(ts));
+	ret = gpy2xx_ptp_settime(&phy, &ts);
+	printf("LOG: gpy2xx_ptp_settime returns %d\n", ret);
 
-		printf("\nSB-1 Buffer Status:\n----------------\n");
-		printf("\t%40s:\t0x%x\n", "SB 1 Overflow Indicator", bm_stat.sb1_ov);
-		printf("\t%40s:\t0x%x\n", "SB 1 Tx Register Overflow Indicator", bm_stat.sb1_tx_reg_ov);
-		printf("\t%40s:\t0x%x\n", "SB 1 Rx Register Overflow Indicator", bm_stat.sb1_rx_reg_ov);
-		printf("\t%40s:\t0x%x\n", "SB 1 Retry Indicator", bm_stat.sb1_retry);
-		printf("\t%40s:\t0x%x\n", "SB 1 Sent Indicator", bm_stat.sb1_sent);
-		printf("\t%40s:\t0x%x\n", "SB 1 Complete Indicator", bm_stat.sb1_complete);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pause_cfg", strlen("gpy2xx_gmacl_pause_cfg")) == 0) {
-		int cnt = 0;
-		struct pause_cfg pcfg;
-		memset(&pcfg, 0, sizeof(struct pause_cfg));
+	rand_array((u8 *)&ptpcfg, sizeof(ptpcfg));
+	ret = gpy2xx_ptp_enable(&phy, &ptpcfg);
+	printf("LOG: gpy2xx_ptp_enable returns %d\n", ret);
 
-		ret = gpy2xx_gmacl_pause_get(&phy, &pcfg);
+	rand_array((u8 *)&tscfg, sizeof(tscfg));
+	ret = gpy2xx_ptp_set_tsctrl(&phy, &tscfg);
+	printf("LOG: gpy2xx_ptp_set_tsctrl returns %d\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer info get failed.\n");
-			return -1;
-		}
+	rand_array((u8 *)&ppscfg, sizeof(ppscfg));
+	ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppscfg);
+	printf("LOG: gpy2xx_ptp_set_ppsctrl returns %d\n", ret);
 
-		cnt += scanParamArg(argc, argv, "fcBusy", sizeof(pcfg.flow_ctrl_busy), &pcfg.flow_ctrl_busy);
-		cnt += scanParamArg(argc, argv, "gmaclFc", sizeof(pcfg.pm_gmacl_fc), &pcfg.pm_gmacl_fc);
-		cnt += scanParamArg(argc, argv, "txfcEn", sizeof(pcfg.tx_flow_ctrl), &pcfg.tx_flow_ctrl);
-		cnt += scanParamArg(argc, argv, "plThresh", sizeof(pcfg.pause_low_thresh), &pcfg.pause_low_thresh);
-		cnt += scanParamArg(argc, argv, "zqPause", sizeof(pcfg.dis_zquanta_pause), &pcfg.dis_zquanta_pause);
-		cnt += scanParamArg(argc, argv, "pauseTime", sizeof(pcfg.pause_time), &pcfg.pause_time);
-		cnt += scanMAC_Arg(argc, argv, "pauseMac", pcfg.tx_fc_mac);
-		cnt += scanParamArg(argc, argv, "paThresh", sizeof(pcfg.pause_assert_thresh), &pcfg.pause_assert_thresh);
-		cnt += scanParamArg(argc, argv, "pdThresh", sizeof(pcfg.pause_deassert_thresh), &pcfg.pause_deassert_thresh);
+	gpy2xx_ptp_disable(&phy);
 
-		ret = gpy2xx_gmacl_pause_cfg(&phy, &pcfg);
+	rand_array((u8 *)&syncecfg, sizeof(syncecfg));
+	ret = gpy2xx_synce_cfg(&phy, &syncecfg);
+	printf("LOG: gpy2xx_synce_cfg returns %d\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer info set failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_gmacl_pause_get", strlen("gpy2xx_gmacl_pause_get")) == 0) {
-		struct pause_cfg pcfg;
-		memset(&pcfg, 0, sizeof(struct pause_cfg));
+	rand_array((u8 *)&wolinfo, sizeof(wolinfo));
+	ret = gpy2xx_wol_cfg(&phy, &wolinfo);
+	printf("LOG: gpy2xx_wol_cfg returns %d\n", ret);
 
-		ret = gpy2xx_gmacl_pause_get(&phy, &pcfg);
+	rand_array((u8 *)&ads, sizeof(ads));
+	ret = gpy2xx_ads_cfg(&phy, &ads);
+	printf("LOG: gpy2xx_ads_cfg returns %d\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's Buffer info get failed.\n");
-			return -1;
-		}
+	rand_array((u8 *)&sgmiicfg, sizeof(sgmiicfg));
+	ret = gpy2xx_sgmii_config_aneg(&phy, &sgmiicfg);
+	printf("LOG: gpy2xx_sgmii_config_aneg returns %d\n", ret);
 
-		printf("\t%40s:\t0x%x\n", "Flow Control Busy", pcfg.flow_ctrl_busy);
-		printf("\t%40s:\t0x%x\n", "PM's GMAC Flow Control Enable", pcfg.pm_gmacl_fc);
-		printf("\t%40s:\t0x%x\n", "Tx Flow Control Enable", pcfg.tx_flow_ctrl);
-		printf("\t%40s:\t0x%x\n", "Pause Low Threshold", pcfg.pause_low_thresh);
-		printf("\t%40s:\t0x%x\n", "Disable Zero-Quanta Paus", pcfg.dis_zquanta_pause);
-		printf("\t%40s:\t0x%x\n", "Pause Time", pcfg.pause_time);
-		printf("\t%s:\t", "Pause frame's Src MAC to sent with");
-		printMAC_Address(pcfg.tx_fc_mac);
-		printf("\n");
-		printf("\t%40s:\t0x%x\n", "Pause Assesrt Threshold", pcfg.pause_assert_thresh);
-		printf("\t%40s:\t0x%x\n", "Pause De-Assesrt Threshold", pcfg.pause_deassert_thresh);
-	} else if (xstrncasecmp(argv[2], "gpy2xx_pm_freq_tune", strlen("gpy2xx_pm_freq_tune")) == 0) {
-		int cnt = 0;
-		struct tune_freq freq;
-		memset(&freq, 0, sizeof(struct tune_freq));
+	ret = gpy2xx_sgmii_opmode(&phy, rand_val(8));
+	printf("LOG: gpy2xx_sgmii_opmode returns %d\n", ret);
 
-		cnt += scanParamArg(argc, argv, "ppm", sizeof(freq.ppm), &freq.ppm);
+	rand_array((u8 *)&msec_cfg, sizeof(msec_cfg));
+	ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
+	printf("LOG: gpy2xx_macsec_enable returns %d\n", ret);
 
-		ret = gpy2xx_pm_freq_tune(&phy, &freq);
+	gpy2xx_macsec_disable(&phy);
 
-		if (ret < 0) {
-			printf("\nERROR: PM's frequency tuning failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_reach_cfg", strlen("gpy2xx_usxgmii_reach_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_usxgmii_reach reach_cfg;
-		memset(&reach_cfg, 0, sizeof(struct gpy211_usxgmii_reach));
+	memset(&msec_cfg, 0, sizeof(msec_cfg));
+	ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
 
-		ret = gpy2xx_usxgmii_reach_get(&phy, &reach_cfg);
+	ret = gpy2xx_uninit(&phy);
+	printf("LOG: GPY211 uninit returned %d\n", ret);
+}
 
-		if (ret < 0) {
-			printf("\nERROR:Egr USXGMII reach get failed.\n");
-			return -1;
-		}
+static void reset_rd_std_ctrl(void)
+{
+	int ret;
 
-		if (scanParamArg(argc, argv, "trace_len", sizeof(reach_cfg.trace_len), &reach_cfg.trace_len) == 0)
-			reach_cfg.trace_len = -1;
+#if 0
+	phy.phy_addr = 0x7;
+        ret = gpy2xx_write(&phy, 0x0, 0xb040);
 
-		cnt += scanParamArg(argc, argv, "tx_eq_main", sizeof(reach_cfg.tx_eq_main), &reach_cfg.tx_eq_main);
-		cnt += scanParamArg(argc, argv, "tx_eq_pre", sizeof(reach_cfg.tx_eq_pre), &reach_cfg.tx_eq_pre);
-		cnt += scanParamArg(argc, argv, "tx_eq_post", sizeof(reach_cfg.tx_eq_post), &reach_cfg.tx_eq_post);
-		cnt += scanParamArg(argc, argv, "tx_vboost_en", sizeof(reach_cfg.tx_vboost_en), &reach_cfg.tx_vboost_en);
-		cnt += scanParamArg(argc, argv, "tx_vboost_lvl", sizeof(reach_cfg.tx_vboost_lvl), &reach_cfg.tx_vboost_lvl);
-		cnt += scanParamArg(argc, argv, "tx_iboost_lvl", sizeof(reach_cfg.tx_iboost_lvl), &reach_cfg.tx_iboost_lvl);
-		cnt += scanParamArg(argc, argv, "rx_eq_att_lvl", sizeof(reach_cfg.rx_eq_att_lvl), &reach_cfg.rx_eq_att_lvl);
-		cnt += scanParamArg(argc, argv, "rx_eq_vga1_gain", sizeof(reach_cfg.rx_eq_vga1_gain), &reach_cfg.rx_eq_vga1_gain);
-		cnt += scanParamArg(argc, argv, "rx_eq_vga2_gain", sizeof(reach_cfg.rx_eq_vga2_gain), &reach_cfg.rx_eq_vga2_gain);
-		cnt += scanParamArg(argc, argv, "rx_eq_ctle_boost", sizeof(reach_cfg.rx_eq_ctle_boost), &reach_cfg.rx_eq_ctle_boost);
-		cnt += scanParamArg(argc, argv, "rx_eq_ctle_pole", sizeof(reach_cfg.rx_eq_ctle_pole), &reach_cfg.rx_eq_ctle_pole);
-		cnt += scanParamArg(argc, argv, "rx_eq_dfe_tap1", sizeof(reach_cfg.rx_eq_dfe_tap1), &reach_cfg.rx_eq_dfe_tap1);
-		cnt += scanParamArg(argc, argv, "rx_afe_adapt_en", sizeof(reach_cfg.rx_afe_adapt_en), &reach_cfg.rx_afe_adapt_en);
-		cnt += scanParamArg(argc, argv, "rx_dfe_adapt_en", sizeof(reach_cfg.rx_dfe_adapt_en), &reach_cfg.rx_dfe_adapt_en);
+        if (ret < 0) {
+                printf("\nERROR: MDIO write failed.\n");
+        }
 
-		ret = gpy2xx_usxgmii_reach_cfg(&phy, &reach_cfg);
+	phy.phy_addr = 0x6;
+	ret = gpy2xx_write(&phy, 0x0, 0xb040);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr USXGMII reach configure failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_reach_get", strlen("gpy2xx_usxgmii_getch_get")) == 0) {
-		struct gpy211_usxgmii_reach reach_cfg;
-		memset(&reach_cfg, 0, sizeof(struct gpy211_usxgmii_reach));
+	if (ret < 0) {
+		printf("\nERROR: MDIO write failed.\n");
+	}
 
-		ret = gpy2xx_usxgmii_reach_get(&phy, &reach_cfg);
+        phy.phy_addr = 0x5;
+        ret = gpy2xx_write(&phy, 0x0, 0xb040);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr usxgmii reach get failed.\n");
-			return -1;
-		}
+        if (ret < 0) {
+                printf("\nERROR: MDIO write failed.\n");
+        }
 
-		printf("\t%40s:\t%s\n", "trace_len", (reach_cfg.trace_len) == 0 ? "SHORT" : ((reach_cfg.trace_len) == 1 ? "MEDIUM" : ((reach_cfg.trace_len) == 2 ? "LONG" : "CUSTOM")));
-		printf("\t%40s:\t0x%x\n", "tx_eq_main", reach_cfg.tx_eq_main);
-		printf("\t%40s:\t0x%x\n", "tx_eq_pre", reach_cfg.tx_eq_pre);
-		printf("\t%40s:\t0x%x\n", "tx_eq_post", reach_cfg.tx_eq_post);
-		printf("\t%40s:\t%s\n", "tx_vboost_en", (reach_cfg.tx_vboost_en == 0) ? "Disabled" : "Enabled");
-		printf("\t%40s:\t0x%x\n", "tx_vboost_lvl", reach_cfg.tx_vboost_lvl);
-		printf("\t%40s:\t0x%x\n", "tx_iboost_lvl", reach_cfg.tx_iboost_lvl);
-		printf("\t%40s:\t0x%x\n", "rx_eq_att_lvl", reach_cfg.rx_eq_att_lvl);
-		printf("\t%40s:\t0x%x\n", "rx_eq_vga1_gain", reach_cfg.rx_eq_vga1_gain);
-		printf("\t%40s:\t0x%x\n", "rx_eq_vga2_gain", reach_cfg.rx_eq_vga2_gain);
-		printf("\t%40s:\t0x%x\n", "rx_eq_ctle_boost", reach_cfg.rx_eq_ctle_boost);
-		printf("\t%40s:\t0x%x\n", "rx_eq_ctle_pole", reach_cfg.rx_eq_ctle_pole);
-		printf("\t%40s:\t0x%x\n", "rx_eq_dfe_tap1", reach_cfg.rx_eq_dfe_tap1);
-		printf("\t%40s:\t%s\n", "rx_afe_adapt_en", (reach_cfg.rx_afe_adapt_en == 0) ? "Disabled" : "Enabled");
-		printf("\t%40s:\t%s\n", "rx_dfe_adapt_en", (reach_cfg.rx_dfe_adapt_en == 0) ? "Disabled" : "Enabled");
-	}  else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_aneg_sts", strlen("gpy2xx_usxgmii_aneg_sts")) == 0) {
-		struct gpy211_usxgmii_aneg_status status;
-		memset(&status, 0, sizeof(struct gpy211_usxgmii_aneg_status));
+        phy.phy_addr = 0x4;
+        ret = gpy2xx_write(&phy, 0x0, 0xb040);
 
-		ret = gpy2xx_usxgmii_aneg_sts(&phy, &status);
+        if (ret < 0) {
+                printf("\nERROR: MDIO write failed.\n");
+        }
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_aneg_sts failed.\n");
-			return -1;
-		}
+	//udelay(1500u);
 
-		printf("\t%40s:\t0x%x\n", "phy_addr", phy.phy_addr);
-		printf("\t%40s:\t%s\n", "phy_side", status.phy_side ? "usxgmii_phy" : "usxgmii_mac");
-		printf("\t%40s:\t%s\n", "force_mode", status.force_mode ? "Enabled" : "Disabled");
-		printf("\t%40s:\t%s\n", "aneg_enable", status.aneg_enable ? "Enabled" : "Disabled");
-		printf("\t%40s:\t%s\n", "aneg_complete", status.aneg_complete ? "Complete" : "Not Complete");
-		printf("\t%40s:\t%s\n", "aneg_linksts", status.aneg_linksts ? "Link Up" : "Link Down");
-		printf("\t%40s:\t%d\n", "aneg_speed", status.aneg_speed);
-		printf("\t%40s:\t%s\n", "aneg_duplex", status.aneg_duplex ? "Full Duplex" : "Half Duplex");
-		printf("\t%40s:\t%s\n", "mii_linksts", status.mii_linksts ? "Link Up" : "Link Down");
-		printf("\t%40s:\t%d\n", "mii_speed", status.mii_speed);
-		printf("\t%40s:\t%s\n", "mii_duplex", status.mii_duplex ? "Full Duplex" : "Half Duplex");
+	phy.phy_addr = 0x4;
+	ret = gpy2xx_read(&phy, 0x0);
 
-	}  else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_aneg_rst", strlen("gpy2xx_usxgmii_aneg_rst")) == 0) {
-		ret = gpy2xx_usxgmii_aneg_rst(&phy);
+	if (ret < 0) {
+		printf("\nERROR: MDIO read failed.\n");
+	} else
+		printf("\nValue of STD_CTRL is %x\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_aneg_rst failed.\n");
-			return -1;
-		}
+	ret = gpy2xx_read(&phy, 0x0);
 
-		printf("\t%40s:\t0x%x\n", "Usxgmii Aneg configuration applied for phy_addr", phy.phy_addr);
+        if (ret < 0) {
+                printf("\nERROR: MDIO read failed.\n");
+        } else
+                printf("\nValue of STD_CTRL is %x\n", ret);
+#endif
+#if 0
+        phy.phy_addr = 0x7;
+        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_pcs_pma_linksts", strlen("gpy2xx_usxgmii_pcs_pma_linksts")) == 0) {
-		struct gpy211_usxgmii_pcs_pma_linksts linkstatus;
-		memset(&linkstatus, 0, sizeof(struct gpy211_usxgmii_pcs_pma_linksts));
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		ret = gpy2xx_usxgmii_pcs_pma_linksts(&phy, &linkstatus);
+        phy.phy_addr = 0x6;
+        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_pcs_pma_linksts failed.\n");
-			return -1;
-		}
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		printf("\t%40s:\t%s\n", "pma_latched_linksts", linkstatus.pma_latched_linksts ? "Link Up" : "Link Down");
-		printf("\t%40s:\t%s\n", "pma_linksts", linkstatus.pma_linksts ? "Link Up" : "Link Down");
-		printf("\t%40s:\t%s\n", "pcs_latched_linksts", linkstatus.pcs_latched_linksts ? "Link Up" : "Link Down");
-		printf("\t%40s:\t%s\n", "pcs_linksts", linkstatus.pcs_linksts ? "Link Up" : "Link Down");
+        phy.phy_addr = 0x5;
+        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
 
-	}  else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_mii_linksts", strlen("gpy2xx_usxgmii_mii_linksts")) == 0) {
-		struct gpy211_usxgmii_mii_linksts linkstatus;
-		memset(&linkstatus, 0, sizeof(struct gpy211_usxgmii_mii_linksts));
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		ret = gpy2xx_usxgmii_mii_linksts(&phy, &linkstatus);
+        phy.phy_addr = 0x4;
+        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_mii_linksts failed.\n");
-			return -1;
-		}
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		printf("\t%40s:\t0x%x\n", "phy_addr", phy.phy_addr);
-		printf("\t%40s:\t%s\n", "latched_linksts", linkstatus.latched_linksts ? "Link Up" : "Link Down");
-		printf("\t%40s:\t%s\n", "linksts", linkstatus.linksts ? "Link Up" : "Link Down");
+        //udelay(1500u);
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_alignmentmarker_set", strlen("gpy2xx_usxgmii_alignmentmarker_set")) == 0) {
-		int cnt = 0;
-		u32 am = 0;
+        phy.phy_addr = 0x4;
+        ret = gpy2xx_read_mmd(&phy, 0x1, 0x0);
 
-		cnt += scanParamArg(argc, argv, "usxgmii_am_count", sizeof(am), &am);
-		ret = gpy2xx_usxgmii_alignmentmarker_set(&phy, am);
+        if (ret < 0) {
+                printf("\nERROR: MMD read failed.\n");
+        } else
+                printf("\nValue of PMA_CTRL1 is %x\n", ret);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_alignmentmarker_set failed.\n");
-			return -1;
-		}
+        ret = gpy2xx_read_mmd(&phy, 0x1, 0x0);
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_alignmentmarker_get", strlen("gpy2xx_usxgmii_alignmentmarker_get")) == 0) {
-		u32 am = 0;
+        if (ret < 0) {
+                printf("\nERROR: MMD read failed.\n");
+        } else
+                printf("\nValue of PMA_CTRL1 is %x\n", ret);
+#endif
+#if 1
+       phy.phy_addr = 0x7;
+        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
 
-		ret = gpy2xx_usxgmii_alignmentmarker_get(&phy, &am);
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_alignmentmarker_get failed.\n");
-			return -1;
-		}
+        phy.phy_addr = 0x6;
+        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
 
-		printf("\t%40s:\t0x%x\n", "usxgmii_am_count", am);
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_vr_reset", strlen("gpy2xx_usxgmii_vr_reset")) == 0) {
-		ret = gpy2xx_usxgmii_vr_reset(&phy);
+        phy.phy_addr = 0x5;
+        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_vr_reset failed.\n");
-			return -1;
-		}
-	}  else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_vr_reset_sts", strlen("gpy2xx_usxgmii_vr_reset_sts")) == 0) {
-		int success = 0;
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		ret = gpy2xx_usxgmii_vr_reset_sts(&phy, &success);
+        phy.phy_addr = 0x4;
+        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_vr_reset_sts failed.\n");
-			return -1;
-		}
+        if (ret < 0) {
+                printf("\nERROR: MMD write failed.\n");
+        }
 
-		printf("\t%40s:\t%s\n", "VR reset ", success ? "complete/sucessfull" : "not complete/unsucessfull");
+        //udelay(1500u);
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_tx_bert_cfg", strlen("gpy2xx_usxgmii_tx_bert_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_usxgmii_tx_bert_config bert_tx_config;
-		memset(&bert_tx_config, 0, sizeof(struct gpy211_usxgmii_tx_bert_config));
+        phy.phy_addr = 0x4;
+        ret = gpy2xx_read_mmd(&phy, 0x3, 0x0);
 
-		cnt += scanParamArg(argc, argv, "mode", sizeof(bert_tx_config.mode), &bert_tx_config.mode);
-		cnt += scanParamArg(argc, argv, "nval_sel", sizeof(bert_tx_config.nval_sel), &bert_tx_config.nval_sel);
+        if (ret < 0) {
+                printf("\nERROR: MMD read failed.\n");
+        } else
+                printf("\nValue of PCS_CTRL1 is %x\n", ret);
 
-		ret = gpy2xx_usxgmii_tx_bert_cfg(&phy, &bert_tx_config);
+        ret = gpy2xx_read_mmd(&phy, 0x3, 0x0);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_tx_bert_cfg failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_tx_bert_get", strlen("gpy2xx_usxgmii_tx_bert_get")) == 0) {
-		struct gpy211_usxgmii_tx_bert_config bert_tx_config;
-		memset(&bert_tx_config, 0, sizeof(struct gpy211_usxgmii_tx_bert_config));
+        if (ret < 0) {
+                printf("\nERROR: MMD read failed.\n");
+        } else
+                printf("\nValue of PCS_CTRL1 is %x\n", ret);
+#endif
+}
 
-		ret = gpy2xx_usxgmii_tx_bert_get(&phy, &bert_tx_config);
+int cmdProcessor(int argc, char *argv[])
+{
+	int ret = 0;
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_tx_bert_get failed.\n");
-			return -1;
-		}
+	arg_index_build(argc, argv);
 
-		switch (bert_tx_config.mode) {
-		case BERT_SQUAREWAVE_TX:
-			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_SQUAREWAVE_TX");
+	if (xstrncasecmp(argv[2], "help", 4) == 0) {
+		gpy211_menu(argc > 2 ? argv[3] : NULL);
+	} else if (xstrncasecmp(argv[2], "msec", strlen("msec")) == 0) {
+		ret = gpy2xx_msec_main(argc, argv);
+	} else if (strcasecmp(argv[2], "complete") == 0) {
+		if (argc > 3 && strcasecmp(argv[3], "msec") == 0)
+			cli_cmd_complete(msec_cmds, ARRAY_SIZE(msec_cmds), argc > 4 ? argv[4] : NULL);
+		else
+			cli_cmd_complete(gpy211_cmds, ARRAY_SIZE(gpy211_cmds), argc > 3 ? argv[3] : NULL);
+	} else if (xstrncasecmp(argv[2], "random", 6) == 0) {
+		random_input();
+	} else if (xstrncasecmp(argv[2], "resetrd", 7) == 0) {
+		reset_rd_std_ctrl();
+	} else {
+		ret = gpy211_main(argc, argv);
+	}
 
-			if (bert_tx_config.nval_sel == 0)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_4");
-			else if (bert_tx_config.nval_sel == 1)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_5");
-			else if (bert_tx_config.nval_sel == 2)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_6");
-			else if (bert_tx_config.nval_sel == 3)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_7");
-			else if (bert_tx_config.nval_sel == 4)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_8");
-			else if (bert_tx_config.nval_sel == 5)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_9");
-			else if (bert_tx_config.nval_sel == 6)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_10");
-			else if (bert_tx_config.nval_sel == 7)
-				printf("\t%40s:\t%40s\n", "NVAL", "BERT_TX_NVAL_SEL_11");
-			else
-				printf("\t%40s:\t%40s\n", "NVAL", "Un-Supported NVAL");
+	arg_index_clear();
+	return ret;
+}
 
-			break;
+int Search_in_File(char *fname, char *str) {
+	FILE *fp;
+	int line_num = 1;
+	int find_result = 0,found =0,i,j,count;
+	unsigned int num;
+	char temp[512];
+	char temp1[512];
+	
+	if((fp = fopen(fname, "r")) == NULL) {
+		printf("\nSorry, config file not found.\n");
+		exit(0);
+	}
 
-		case BERT_PRBS31_TX:
-			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_PRBS31_TX");
+	while(fgets(temp, 512, fp) != NULL) {
+		if((strstr(temp, str)) != NULL) {
+			find_result =1;
+			for(i=0,j=0,count=0;temp[i] != '\0';i++)
+			{
+				if(found)
+				{
+					temp1[j] = temp[i];
+					j++;
+				}
+					
+				if(temp[i] == ' '){
+					count++;
+					if(count == 2)
+						found = 1;
+				}
+			}
+			temp1[j] = '\0';
 			break;
+		}
+		line_num++;
+	}
 
-		case BERT_PRBS9_TX:
-			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_PRBS9_TX");
-			break;
+	num = (int)strtol(temp1, NULL, 10); 
+	if(find_result == 0) {
+		printf("\nSorry, couldn't find a match.\n");
+		return(0);
+	}
+	
+	if(fp) {
+		fclose(fp);
+	}
+   	return(num);
+}
 
-		case BERT_TX_MODE_DISABLE:
-			printf("\t%40s:\t%40s\n", "TX bert mode", "BERT_TX_MODE_DISABLE");
-			break;
+void Usage(char *filename) {
+	printf("Usage: %s <file> <string>\n", filename);
+	printf("%s version 1.0 \nCopyright(c) CodingUnit.com\n", filename);
+}
 
-		case BERT_PSEUDO_RANDOM_TX:
-			printf("ERROR: BERT_PSEUDO_RANDOM_TX mode not supported\n");
-			break;
 
-		default:
-			printf("ERROR: Un-supported TX BERT mode\n");
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_rx_bert_cfg", strlen("gpy2xx_usxgmii_rx_bert_cfg")) == 0) {
-		int cnt = 0;
-		struct gpy211_usxgmii_rx_bert_config bert_rx_config;
-		memset(&bert_rx_config, 0, sizeof(struct gpy211_usxgmii_rx_bert_config));
+int init(int phyId)
+{
+	int ret=0;
+	const char *gsw_dev = "/dev/switch_api/0";
+		
+	mdio.xgmac_id = 2;
+	mdio.fd = open(gsw_dev, O_RDONLY);
+	phy.lock = NULL;
+	phy.unlock = NULL;
+	phy.lock_data = NULL;
+	phy.mdiobus_read = gpy211_mdio_read; 
+	phy.mdiobus_write = gpy211_mdio_write;
+	phy.mdiobus_data = &mdio;
+	phy.smdio_addr = 0;
+	phy.phy_addr = phyId;
+	phy.priv_data = NULL;
+	phy.shared_data =NULL;
+	phy.wol_supported =0x60;
+	phy.ptp_clock = 0x1836E210ull; //406.25MHz
+	phy.macsec_supported = 0;
+	phy.nr_of_sas = 32;
 
-		cnt += scanParamArg(argc, argv, "mode", sizeof(bert_rx_config.mode), &bert_rx_config.mode);
+	if (mdio.fd < 0) {
+		printf("ERROR: Could not open switch dev node \"%s\"\n", gsw_dev);
+		ret = -1;
+	}
 
-		ret = gpy2xx_usxgmii_rx_bert_cfg(&phy, &bert_rx_config);
+	ret = gpy2xx_init(&phy);
+	if (ret < 0) {
+		printf("api gpy2xx_init failed: %d\n", ret);
+		return ret;
+	}
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_cfg failed.\n");
-			return -1;
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_rx_bert_get", strlen("gpy2xx_usxgmii_rx_bert_get")) == 0) {
-		struct gpy211_usxgmii_rx_bert_config bert_rx_config;
-		memset(&bert_rx_config, 0, sizeof(struct gpy211_usxgmii_rx_bert_config));
+	return ret;			   
+}	
 
-		ret = gpy2xx_usxgmii_rx_bert_get(&phy, &bert_rx_config);
+static int split_buffer(char *buffer, char *array[], int max_param_num)
+{
+	int num = 0;
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_get failed.\n");
-			return -1;
-		}
+	while (*buffer != 0 && num < max_param_num) {
+		while (xisspace(*buffer) || *buffer == '\r')
+			buffer++;
 
-		switch (bert_rx_config.mode) {
-		case BERT_PRBS31_RX:
-			printf("\t%40s:\t%40s\n", "RX bert mode", "BERT_PRBS31_RX");
+		if (*buffer == 0)
 			break;
 
-		case BERT_PRBS9_RX:
-			printf("\t%40s:\t%40s\n", "RX bert mode", "BERT_PRBS9_RX");
-			break;
+		array[num++] = buffer;
 
-		case BERT_RX_MODE_DISABLE:
-			printf("\t%40s:\t%40s\n", "RX bert mode", "BERT_RX_MODE_DISABLE");
-			break;
+		while (*buffer != 0 && !xisspace(*buffer) && *buffer != '\r')
+			buffer++;
+
+		if (*buffer != 0)
+			*buffer++ = 0;
+	}
+
+	return num;
+}
+
+static u64 batch_time_us(void)
+{
+	struct timespec ts;
 
-		case BERT_PSEUDO_RANDOM_RX:
-			printf("ERROR: BERT_PSEUDO_RANDOM_RX mode not supported\n");
-			break;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
 
-		default:
-			printf("ERROR: Un-supported RX BERT mode\n");
-		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_rx_bert_stat", strlen("gpy2xx_usxgmii_rx_bert_stat")) == 0) {
-		struct gpy211_usxgmii_rx_bert_statistics rx_bert_statistics;
-		memset(&rx_bert_statistics, 0, sizeof(struct gpy211_usxgmii_rx_bert_statistics));
-		ret = gpy2xx_usxgmii_rx_bert_stat(&phy, &rx_bert_statistics);
+#define CLI_SOCK_PATH		"/var/run/gpy2xx_cli.sock"
+#define CLI_SOCK_ENV		"GPY2XX_CLI_SOCK"
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_stat failed.\n");
-			return -1;
-		}
+static const char *cli_sock_path(int argc, char *argv[])
+{
+	char *path = findArgParam(argc, argv, "sock");
 
-		printf("\t%40s:\t0x%x\n", "tp_error_count", rx_bert_statistics.tp_error_count);
-		printf("\t%40s:\t0x%x\n", "error_block_count", rx_bert_statistics.error_block_count);
-		printf("\t%40s:\t0x%x\n", "bit_error_rate_counter", rx_bert_statistics.bit_error_rate_counter);
-		printf("\t%40s:\t0x%x\n", "latched_high_bit_err_rate", rx_bert_statistics.latched_high_bit_err_rate);
-		printf("\t%40s:\t0x%x\n", "latched_block_lock", rx_bert_statistics.latched_block_lock);
+	if (path == NULL)
+		path = getenv(CLI_SOCK_ENV);
 
-	} else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_loopback_cfg", strlen("gpy2xx_usxgmii_loopback_cfg")) == 0) {
-		int cnt = 0;
-		enum gpy211_usxgmii_loopback_mode mode = USXGMII_LOOPBACK_DISABLE;
+	return path != NULL ? path : CLI_SOCK_PATH;
+}
 
-		cnt += scanParamArg(argc, argv, "mode", sizeof(mode), &mode);
+/* Returns connected socket or -1 if no server is running */
+static int client_connect(const char *path)
+{
+	struct sockaddr_un addr;
+	int fd;
 
-		ret = gpy2xx_usxgmii_loopback_cfg(&phy, mode);
+	if (path[0] == 0 || strlen(path) >= sizeof(addr.sun_path))
+		return -1;
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_loopback_cfg failed.\n");
-			return -1;
-		}
-	}  else if (xstrncasecmp(argv[2], "gpy2xx_usxgmii_loopback_get", strlen("gpy2xx_usxgmii_loopback_get")) == 0) {
-		enum gpy211_usxgmii_loopback_mode mode = USXGMII_LOOPBACK_INVALID;
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
 
-		ret = gpy2xx_usxgmii_loopback_get(&phy, &mode);
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
 
-		if (ret < 0) {
-			printf("\nERROR:Egr gpy2xx_usxgmii_loopback_get failed.\n");
-			return -1;
-		}
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		close(fd);
+		return -1;
+	}
 
-		printf("\tmode:\t");
+	return fd;
+}
 
-		switch (mode) {
-		case USXGMII_LOOPBACK_DISABLE:
-			printf("disabled\n");
-			break;
+/*
+ * Server replies are the command output followed by "\0ret <n>\n".
+ * Events are sent as "\0event <text>\n" between replies. The NUL byte
+ * can not appear in command output, so the framing needs no escaping.
+ */
+static int client_recv(int fd, int follow)
+{
+	char buf[4096];
+	char hdr[256];
+	int hlen = -1;
+	int n, i;
+
+	while ((n = read(fd, buf, sizeof(buf))) > 0) {
+		for (i = 0; i < n; i++) {
+			if (hlen < 0) {
+				if (buf[i] == 0)
+					hlen = 0;
+				else
+					putchar(buf[i]);
+
+				continue;
+			}
 
-		case USXGMII_LOOPBACK_TX2RX:
-			printf("Tx to Rx Serial Loopback\n");
-			break;
+			if (buf[i] != '\n') {
+				if (hlen < (int)sizeof(hdr) - 1)
+					hdr[hlen++] = buf[i];
 
-		case USXGMII_LOOPBACK_RX2TX:
-			printf("Rx to Tx Parallel Loopback\n");
-			break;
+				continue;
+			}
 
-		default:
-			printf("invalid configuration\n");
+			hdr[hlen] = 0;
+			hlen = -1;
+
+			if (strncmp(hdr, "ret ", 4) == 0) {
+				if (!follow) {
+					fflush(stdout);
+					return strtol(hdr + 4, NULL, 0);
+				}
+			} else if (strncmp(hdr, "event ", 6) == 0) {
+				printf("%s\n", hdr + 6);
+			}
 		}
-	}else	{
-		printf("Command Not Supported\n");
+
+		fflush(stdout);
 	}
-	return ret;
-}
 
-static u32 rand_val(size_t size)
-{
-	if (size < 16)
-		return rand() & ((1 << size) - 1);
-	else if (size < 31)
-		return ((rand() << 15) | rand()) & ((1 << size) - 1);
-	else
-		return (rand() << 30) | (rand() << 15) | rand();
+	printf("ERROR: connection to gpy2xx_cli server lost\n");
+	return -EPIPE;
 }
 
-static u64 rand_val64()
+/* Send argv[1..argc-1] as one request line and print the reply */
+static int client_cmd(int fd, int argc, char *argv[], int follow)
 {
-	u64 val = rand();
+	char line[CMD_LINE_BUFFER_SIZE];
+	int len = 0;
+	int i, n;
 
-	val = (val << 15) | rand();
-	val = (val << 15) | rand();
-	val = (val << 15) | rand();
-	return (val << 4) | (rand() * 3 / RAND_MAX);
-}
+	for (i = 1; i < argc; i++) {
+		n = snprintf(line + len, sizeof(line) - len, "%s%s", argv[i],
+			     i + 1 < argc ? " " : "\n");
+		if (n < 0 || n >= (int)sizeof(line) - len) {
+			printf("ERROR: command line too long\n");
+			return -1;
+		}
 
-static void rand_array(u8 *p, size_t size)
-{
-	size_t i;
+		len += n;
+	}
 
-	for (i = 0; i < size; i++)
-		p[i] = rand() * 0xFF / RAND_MAX;
+	for (i = 0; i < len; i += n) {
+		n = write(fd, line + i, len - i);
+		if (n <= 0) {
+			printf("ERROR: connection to gpy2xx_cli server lost\n");
+			return -EPIPE;
+		}
+	}
+
+	return client_recv(fd, follow);
 }
 
-static void random_input(void)
+/* The current PHY stays open until the new one is initialised */
+static int batch_switch_phy(int phyId)
 {
+	struct gpy211_device old_phy = phy, new_phy;
+	struct gpy2xx_mdio old_mdio = mdio, new_mdio;
 	int ret;
-	u32 val1, val2, val3;
-	struct gpy211_link link = phy.link;
-	struct gpy211_led_brlvl_cfg brightnesscfg;
-	struct gpy211_led_cfg genifcfg;
-	struct gpy211_phy_extin extint;
-	struct timespec64 ts;
-	struct gpy211_ptp_ctrl ptpcfg;
-	struct gpy2xx_ts_ctrl tscfg;
-	struct gpy2xx_pps_ctrl ppscfg;
-	struct gpy211_synce syncecfg;
-	struct gpy211_wolinfo wolinfo;
-	struct gpy211_ads_ctrl ads;
-	struct gpy211_sgmii sgmiicfg;
-	struct gpy211_macsec msec_cfg;
 
-	srand(time(NULL));
+	ret = init(phyId);
+	new_phy = phy;
+	new_mdio = mdio;
+	phy = old_phy;
+	mdio = old_mdio;
 
-	val1 = rand_val(sizeof(u32) * 8);
-	ret = gpy2xx_smdio_read(&phy, val1);
-	printf("LOG: gpy2xx_smdio_read addr 0x%x returns %d\n", val1, ret);
+	if (ret < 0) {
+		if (new_mdio.fd >= 0)
+			close(new_mdio.fd);
 
-	val1 = rand_val(sizeof(u32) * 8);
-	val2 = rand_val(sizeof(u16) * 8);
-	ret = gpy2xx_smdio_write(&phy, val1, val2);
-	printf("LOG: gpy2xx_smdio_write addr 0x%x with 0x%x returns %d\n", val1, val2, ret);
+		return ret;
+	}
 
-	val1 = rand_val(sizeof(u32) * 8);
-	val2 = rand_val(sizeof(u32) * 8);
-	ret = gpy2xx_read_mmd(&phy, (int)val1, val2);
-	printf("LOG: gpy2xx_read_mmd dev 0x%x addr 0x%x returns %d\n", val1, val2, ret);
+	gpy2xx_uninit(&phy);
+	close(mdio.fd);
+	phy = new_phy;
+	mdio = new_mdio;
 
-	val1 = rand_val(sizeof(u32) * 8);
-	val2 = rand_val(sizeof(u32) * 8);
-	val3 = rand_val(sizeof(u16) * 8);
-	ret = gpy2xx_write_mmd(&phy, (int)val1, val2, val3);
-	printf("LOG: gpy2xx_write_mmd dev 0x%x addr 0x%x with 0x%x returns %d\n", val1, val2, val3, ret);
+	return 0;
+}
 
-	val1 = rand_val(sizeof(u32) * 8);
-	ret = gpy2xx_mbox_read16(&phy, val1, &val2);
-	printf("LOG: gpy2xx_mbox_read16 addr 0x%x data 0x%x returns %d\n", val1, val2, ret);
+/*
+ * Run commands line by line on the already initialized PHY, so that
+ * scripts do not pay the device open and gpy2xx_init cost per command.
+ * Each line takes the same arguments as the one-shot command line after
+ * "phyId=?", e.g. "gpy2xx_read_status" or "gpy2xx_config_advert advert=0x1".
+ * With a running server (srv_fd >= 0) the lines are forwarded to it instead.
+ */
+static int batch_main(int argc, char *argv[], int phyId, int srv_fd)
+{
+	char line[CMD_LINE_BUFFER_SIZE];
+	char phy_arg[32];
+	char *file, *on_error;
+	char *cmd_argv[MAX_PARAM + 3];
+	u32 timing = 0;
+	int stop_on_error;
+	int interactive;
+	int cmd_argc, num, lineno = 0;
+	u32 nr_cmd = 0, nr_err = 0;
+	u64 start, t0, t;
+	FILE *fp = stdin;
+	int ret = 0;
+
+	file = findArgParam(argc, argv, "file");
+	on_error = findArgParam(argc, argv, "onError");
+	scanParamArg(argc, argv, "timing", sizeof(timing), &timing);
+
+	if (file != NULL) {
+		fp = fopen(file, "r");
+		if (fp == NULL) {
+			printf("ERROR: Could not open script \"%s\"\n", file);
+			return -1;
+		}
+	}
 
-	val1 = rand_val(sizeof(u32) * 8);
-	val2 = rand_val(sizeof(u32) * 8);
-	ret = gpy2xx_mbox_write16(&phy, val1, val2);
-	printf("LOG: gpy2xx_mbox_write16 addr 0x%x with 0x%x returns %d\n", val1, val2, ret);
+	interactive = fp == stdin && isatty(fileno(stdin));
 
-	val1 = rand_val(sizeof(u32) * 8);
-	ret = gpy2xx_mbox_read32(&phy, val1, &val2);
-	printf("LOG: gpy2xx_mbox_read32 addr 0x%x data 0x%x returns %d\n", val1, val2, ret);
+	if (on_error == NULL)
+		stop_on_error = fp != stdin;
+	else if (strcasecmp(on_error, "stop") == 0)
+		stop_on_error = 1;
+	else if (strcasecmp(on_error, "continue") == 0)
+		stop_on_error = 0;
+	else {
+		printf("ERROR: onError must be \"stop\" or \"continue\"\n");
+		ret = -1;
+		goto END;
+	}
 
-	val1 = rand_val(sizeof(u32) * 8);
-	val2 = rand_val(sizeof(u32) * 8);
-	ret = gpy2xx_mbox_write32(&phy, val1, val2);
-	printf("LOG: gpy2xx_mbox_write32 addr 0x%x with 0x%x returns %d\n", val1, val2, ret);
+	snprintf(phy_arg, sizeof(phy_arg), "phyId=%d", phyId);
+	start = batch_time_us();
 
-	phy.link.advertising = rand_val64();
-	ret = gpy2xx_config_advert(&phy);
-	printf("LOG: gpy2xx_config_advert returns %d\n", ret);
-	phy.link = link;
+	while (1) {
+		if (interactive) {
+			printf("gpy2xx[%d]> ", phyId);
+			fflush(stdout);
+		}
 
-	phy.link.speed = rand_val(sizeof(int) * 8);
-	phy.link.duplex = rand_val(sizeof(int) * 8);
-	phy.link.pause = rand_val(sizeof(int) * 8);
-	phy.link.asym_pause = rand_val(sizeof(int) * 8);
-	ret = gpy2xx_setup_forced(&phy);
-	printf("LOG: gpy2xx_setup_forced returns %d\n", ret);
-	phy.link = link;
+		if (fgets(line, sizeof(line), fp) == NULL)
+			break;
 
-	phy.link.autoneg = rand_val(1);
-	phy.link.speed = rand_val64();
-	phy.link.duplex = rand_val(sizeof(int) * 8);
-	phy.link.pause = rand_val(sizeof(int) * 8);
-	phy.link.asym_pause = rand_val(sizeof(int) * 8);
-	phy.link.supported = rand_val64();
-	phy.link.advertising = rand_val64();
-	ret = gpy2xx_config_aneg(&phy);
-	printf("LOG: gpy2xx_config_aneg returns %d\n", ret);
-	phy.link = link;
+		lineno++;
+		num = split_buffer(line, &cmd_argv[2], MAX_PARAM);
+		if (num == 0 || cmd_argv[2][0] == '#')
+			continue;
 
-	rand_array((u8 *)&brightnesscfg, sizeof(brightnesscfg));
-	ret = gpy2xx_led_br_cfg(&phy, &brightnesscfg);
-	printf("LOG: gpy2xx_led_br_cfg returns %d\n", ret);
+		if (strcasecmp(cmd_argv[2], "exit") == 0
+		    || strcasecmp(cmd_argv[2], "quit") == 0)
+			break;
 
-	rand_array((u8 *)&genifcfg, sizeof(genifcfg));
-	ret = gpy2xx_led_if_cfg(&phy, &genifcfg);
-	printf("LOG: gpy2xx_led_if_cfg returns %d\n", ret);
+		/* Accept lines copied from one-shot invocations */
+		if (xstrncasecmp(cmd_argv[2], "phyId=", 6) == 0) {
+			int id = strtol(cmd_argv[2] + 6, NULL, 0);
 
-	rand_array((u8 *)&extint, sizeof(extint));
-	ret = gpy2xx_extin_mask(&phy, &extint);
-	printf("LOG: gpy2xx_extin_mask returns %d\n", ret);
+			if (id != phyId && srv_fd < 0) {
+				ret = batch_switch_phy(id);
+				if (ret < 0) {
+					/* Also with onError=continue, the next lines are for phyId=id */
+					printf("ERROR: line %d: init of phyId=%d failed, stop\n", lineno, id);
+					nr_err++;
+					break;
+				}
+			}
 
-	val1 = rand_val(8);
-	ret = gpy2xx_test_mode_cfg(&phy, val1);
-	printf("LOG: gpy2xx_test_mode_cfg returns %d\n", ret);
+			phyId = id;
+			snprintf(phy_arg, sizeof(phy_arg), "phyId=%d", phyId);
 
-	val1 = rand_val(8);
-	ret = gpy2xx_loopback_cfg(&phy, val1);
-	printf("LOG: gpy2xx_loopback_cfg returns %d\n", ret);
+			if (num == 1)
+				continue;
 
-	val1 = rand_val(8);
-	ret = gpy2xx_errcnt_cfg(&phy, val1);
-	printf("LOG: gpy2xx_errcnt_cfg returns %d\n", ret);
+			memmove(&cmd_argv[2], &cmd_argv[3], (num - 1) * sizeof(cmd_argv[0]));
+			num--;
+		}
 
-	val1 = rand_val(sizeof(int) * 8);
-	ret = gpy2xx_ptp_adjtime(&phy, val1);
-	printf("LOG: gpy2xx_ptp_adjtime returns %d\n", ret);
+		cmd_argv[0] = argv[0];
+		cmd_argv[1] = phy_arg;
+		cmd_argc = num + 2;
+		cmd_argv[cmd_argc] = NULL;
 
-	rand_array((u8 *)&ts, sizeof(ts));
-	ret = gpy2xx_ptp_settime(&phy, &ts);
-	printf("LOG: gpy2xx_ptp_settime returns %d\n", ret);
+		t0 = batch_time_us();
+		if (srv_fd >= 0)
+			ret = client_cmd(srv_fd, cmd_argc, cmd_argv, 0);
+		else
+			ret = cmdProcessor(cmd_argc, cmd_argv);
+		t = batch_time_us() - t0;
+		fflush(stdout);
 
-	rand_array((u8 *)&ptpcfg, sizeof(ptpcfg));
-	ret = gpy2xx_ptp_enable(&phy, &ptpcfg);
-	printf("LOG: gpy2xx_ptp_enable returns %d\n", ret);
+		nr_cmd++;
+		if (ret < 0)
+			nr_err++;
 
-	rand_array((u8 *)&tscfg, sizeof(tscfg));
-	ret = gpy2xx_ptp_set_tsctrl(&phy, &tscfg);
-	printf("LOG: gpy2xx_ptp_set_tsctrl returns %d\n", ret);
+		if (timing)
+			printf("[%s] ret=%d time=%llu.%03llu ms\n", cmd_argv[2], ret,
+			       (unsigned long long)(t / 1000), (unsigned long long)(t % 1000));
 
-	rand_array((u8 *)&ppscfg, sizeof(ppscfg));
-	ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppscfg);
-	printf("LOG: gpy2xx_ptp_set_ppsctrl returns %d\n", ret);
+		if (ret < 0 && stop_on_error) {
+			printf("ERROR: line %d: \"%s\" failed (%d), stop\n", lineno, cmd_argv[2], ret);
+			break;
+		}
+	}
 
-	gpy2xx_ptp_disable(&phy);
+	t = batch_time_us() - start;
 
-	rand_array((u8 *)&syncecfg, sizeof(syncecfg));
-	ret = gpy2xx_synce_cfg(&phy, &syncecfg);
-	printf("LOG: gpy2xx_synce_cfg returns %d\n", ret);
+	if (timing || !interactive)
+		printf("batch: %u command(s), %u failed, total %llu.%03llu ms\n",
+		       nr_cmd, nr_err, (unsigned long long)(t / 1000), (unsigned long long)(t % 1000));
 
-	rand_array((u8 *)&wolinfo, sizeof(wolinfo));
-	ret = gpy2xx_wol_cfg(&phy, &wolinfo);
-	printf("LOG: gpy2xx_wol_cfg returns %d\n", ret);
+	ret = nr_err ? -1 : 0;
 
-	rand_array((u8 *)&ads, sizeof(ads));
-	ret = gpy2xx_ads_cfg(&phy, &ads);
-	printf("LOG: gpy2xx_ads_cfg returns %d\n", ret);
+END:
+	if (fp != stdin)
+		fclose(fp);
 
-	rand_array((u8 *)&sgmiicfg, sizeof(sgmiicfg));
-	ret = gpy2xx_sgmii_config_aneg(&phy, &sgmiicfg);
-	printf("LOG: gpy2xx_sgmii_config_aneg returns %d\n", ret);
+	return ret;
+}
 
-	ret = gpy2xx_sgmii_opmode(&phy, rand_val(8));
-	printf("LOG: gpy2xx_sgmii_opmode returns %d\n", ret);
+#define SRV_MAX_CLIENTS		16
+#define SRV_MAX_PHY		32
+#define SRV_EV_LINK		(1u << 0)
+#define SRV_EV_COUNTERS		(1u << 1)
+/* A client not reading its socket for this long is dropped */
+#define SRV_SNDTIMEO_MS		1000
+
+struct srv_client {
+	int fd;
+	int len;
+	/* SRV_EV_* bits per PHY */
+	u32 events[SRV_MAX_PHY];
+	char buf[CMD_LINE_BUFFER_SIZE];
+};
 
-	rand_array((u8 *)&msec_cfg, sizeof(msec_cfg));
-	ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
-	printf("LOG: gpy2xx_macsec_enable returns %d\n", ret);
+struct srv_phy {
+	int valid;
+	struct gpy211_device dev;
+	int link, speed, duplex;
+	int acc_valid;
+	struct gmacf_count_acc acc;
+};
 
-	gpy2xx_macsec_disable(&phy);
+static struct srv_phy srv_phy[SRV_MAX_PHY];
+static struct srv_client srv_client[SRV_MAX_CLIENTS];
+static pthread_mutex_t srv_lock;
+static volatile sig_atomic_t srv_stop;
+/* Command output is collected here and sent once the command is done */
+static FILE *srv_out;
+
+/* Commands waiting for events, they would stall every other client */
+static const char *const srv_rejected[] = {
+	"batch",
+	"server",
+	"gpy2xx_gmacf_count_acc",
+	"gpy2xx_mon_link",
+	"gpy2xx_msec_harvest_stats",
+};
 
-	memset(&msec_cfg, 0, sizeof(msec_cfg));
-	ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
+static void srv_lock_fn(void *lock_data)
+{
+	pthread_mutex_lock(lock_data);
+}
 
-	ret = gpy2xx_uninit(&phy);
-	printf("LOG: GPY211 uninit returned %d\n", ret);
+static void srv_unlock_fn(void *lock_data)
+{
+	pthread_mutex_unlock(lock_data);
 }
 
-static void reset_rd_std_ctrl(void)
+static void srv_sig(int sig)
 {
-	int ret;
+	(void)sig;
+	srv_stop = 1;
+}
 
-#if 0
-	phy.phy_addr = 0x7;
-        ret = gpy2xx_write(&phy, 0x0, 0xb040);
+/*
+ * All PHYs sit on the same MDIO master, so every context shares one
+ * recursive bus lock. A CLI command holds it for its whole duration and
+ * the library APIs it calls take it again, so multi-frame sequences of
+ * one request are never interleaved with another request or an event
+ * poll.
+ */
+static void srv_phy_save(int id)
+{
+	phy.lock = srv_lock_fn;
+	phy.unlock = srv_unlock_fn;
+	phy.lock_data = &srv_lock;
+	srv_phy[id].dev = phy;
+	srv_phy[id].valid = 1;
+	srv_phy[id].link = -1;
+}
 
-        if (ret < 0) {
-                printf("\nERROR: MDIO write failed.\n");
-        }
+static struct srv_phy *srv_phy_get(int id)
+{
+	if (id < 0 || id >= SRV_MAX_PHY)
+		return NULL;
 
-	phy.phy_addr = 0x6;
-	ret = gpy2xx_write(&phy, 0x0, 0xb040);
+	if (!srv_phy[id].valid) {
+		close(mdio.fd);
+		if (init(id) < 0)
+			return NULL;
 
-	if (ret < 0) {
-		printf("\nERROR: MDIO write failed.\n");
+		srv_phy_save(id);
 	}
 
-        phy.phy_addr = 0x5;
-        ret = gpy2xx_write(&phy, 0x0, 0xb040);
+	phy = srv_phy[id].dev;
+	return &srv_phy[id];
+}
 
-        if (ret < 0) {
-                printf("\nERROR: MDIO write failed.\n");
-        }
+static void srv_send(struct srv_client *c, const char *msg, int len)
+{
+	if (c->fd >= 0 && send(c->fd, msg, len, MSG_NOSIGNAL) != len) {
+		close(c->fd);
+		c->fd = -1;
+	}
+}
 
-        phy.phy_addr = 0x4;
-        ret = gpy2xx_write(&phy, 0x0, 0xb040);
+static void srv_event(int id, u32 ev, const char *fmt, ...)
+{
+	char msg[256];
+	va_list ap;
+	int len, i;
 
-        if (ret < 0) {
-                printf("\nERROR: MDIO write failed.\n");
-        }
+	msg[0] = 0;
+	va_start(ap, fmt);
+	len = vsnprintf(msg + 1, sizeof(msg) - 1, fmt, ap) + 1;
+	va_end(ap);
 
-	//udelay(1500u);
+	if (len >= (int)sizeof(msg))
+		len = sizeof(msg) - 1;
 
-	phy.phy_addr = 0x4;
-	ret = gpy2xx_read(&phy, 0x0);
+	for (i = 0; i < SRV_MAX_CLIENTS; i++) {
+		if (srv_client[i].fd >= 0 && (srv_client[i].events[id] & ev))
+			srv_send(&srv_client[i], msg, len);
+	}
+}
 
-	if (ret < 0) {
-		printf("\nERROR: MDIO read failed.\n");
-	} else
-		printf("\nValue of STD_CTRL is %x\n", ret);
+static void srv_poll_events(void)
+{
+	u32 ev;
+	int id, i;
 
-	ret = gpy2xx_read(&phy, 0x0);
+	for (id = 0; id < SRV_MAX_PHY; id++) {
+		if (!srv_phy[id].valid)
+			continue;
 
-        if (ret < 0) {
-                printf("\nERROR: MDIO read failed.\n");
-        } else
-                printf("\nValue of STD_CTRL is %x\n", ret);
-#endif
-#if 0
-        phy.phy_addr = 0x7;
-        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
+		for (ev = 0, i = 0; i < SRV_MAX_CLIENTS; i++) {
+			if (srv_client[i].fd >= 0)
+				ev |= srv_client[i].events[id];
+		}
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+		if (ev == 0)
+			continue;
 
-        phy.phy_addr = 0x6;
-        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
+		phy = srv_phy[id].dev;
+
+		if ((ev & SRV_EV_LINK) && gpy2xx_read_status(&phy) >= 0
+		    && (phy.link.link != srv_phy[id].link
+			|| phy.link.speed != srv_phy[id].speed
+			|| phy.link.duplex != srv_phy[id].duplex)) {
+			srv_phy[id].link = phy.link.link;
+			srv_phy[id].speed = phy.link.speed;
+			srv_phy[id].duplex = phy.link.duplex;
+			srv_event(id, SRV_EV_LINK, "event link phyId=%d link=%d speed=%d duplex=%d\n",
+				  id, phy.link.link, phy.link.speed, phy.link.duplex);
+		}
+
+		if (ev & SRV_EV_COUNTERS) {
+			struct gmacf_counters64 *t = &srv_phy[id].acc.total;
+
+			if (!srv_phy[id].acc_valid) {
+				srv_phy[id].acc_valid = gpy2xx_gmacf_count_acc_init(&phy, &srv_phy[id].acc) == 0;
+			} else if (gpy2xx_gmacf_count_acc_update(&phy, &srv_phy[id].acc) == 0) {
+				srv_event(id, SRV_EV_COUNTERS,
+					  "event counters phyId=%d tx=%llu tx_uflow=%llu rx=%llu rx_crc=%llu\n",
+					  id, (unsigned long long)t->tx_good_bad,
+					  (unsigned long long)t->tx_uflow_err,
+					  (unsigned long long)t->rx_good_bad,
+					  (unsigned long long)t->rx_crc_err);
+			}
+		}
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+		srv_phy[id].dev = phy;
+	}
+}
 
-        phy.phy_addr = 0x5;
-        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
+/* subscribe|unsubscribe [link] [counters], no event name means all */
+static int srv_subscribe(struct srv_client *c, int id, int argc, char *argv[])
+{
+	int on = strcasecmp(argv[2], "subscribe") == 0;
+	u32 ev = 0;
+	int i;
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+	for (i = 3; i < argc; i++) {
+		if (strcasecmp(argv[i], "link") == 0)
+			ev |= SRV_EV_LINK;
+		else if (strcasecmp(argv[i], "counters") == 0)
+			ev |= SRV_EV_COUNTERS;
+		else {
+			printf("ERROR: unknown event \"%s\"\n", argv[i]);
+			return -1;
+		}
+	}
 
-        phy.phy_addr = 0x4;
-        ret = gpy2xx_write_mmd(&phy, 0x1, 0x0, 0xa058);
+	if (ev == 0)
+		ev = SRV_EV_LINK | SRV_EV_COUNTERS;
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+	if (on) {
+		c->events[id] |= ev;
+		/* Report the current link state to every link subscriber */
+		if (ev & SRV_EV_LINK)
+			srv_phy[id].link = -1;
+	} else {
+		c->events[id] &= ~ev;
+	}
 
-        //udelay(1500u);
+	return 0;
+}
 
-        phy.phy_addr = 0x4;
-        ret = gpy2xx_read_mmd(&phy, 0x1, 0x0);
+static void srv_request(struct srv_client *c, char *line, int phyId)
+{
+	char *cmd_argv[MAX_PARAM + 3];
+	char phy_arg[32];
+	char msg[512];
+	struct srv_phy *p;
+	int num, id = phyId;
+	int out, n, i, ret = -1;
+
+	/* Every request line is answered with a "ret" frame, the client waits for it */
+	num = split_buffer(line, &cmd_argv[2], MAX_PARAM);
+	if (num == 0 || cmd_argv[2][0] == '#') {
+		ret = 0;
+		goto end;
+	}
 
-        if (ret < 0) {
-                printf("\nERROR: MMD read failed.\n");
-        } else
-                printf("\nValue of PMA_CTRL1 is %x\n", ret);
+	if (xstrncasecmp(cmd_argv[2], "phyId=", 6) == 0) {
+		id = strtol(cmd_argv[2] + 6, NULL, 0);
+		memmove(&cmd_argv[2], &cmd_argv[3], (num - 1) * sizeof(cmd_argv[0]));
+		num--;
+	}
 
-        ret = gpy2xx_read_mmd(&phy, 0x1, 0x0);
+	snprintf(phy_arg, sizeof(phy_arg), "phyId=%d", id);
+	cmd_argv[0] = "gpy2xx_cli";
+	cmd_argv[1] = phy_arg;
+	cmd_argv[num + 2] = NULL;
 
-        if (ret < 0) {
-                printf("\nERROR: MMD read failed.\n");
-        } else
-                printf("\nValue of PMA_CTRL1 is %x\n", ret);
-#endif
-#if 1
-       phy.phy_addr = 0x7;
-        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
+	for (i = 0; num > 0 && i < (int)ARRAY_SIZE(srv_rejected); i++) {
+		if (strcasecmp(cmd_argv[2], srv_rejected[i]) == 0)
+			break;
+	}
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+	/* Collect command output, so a client not reading does not block the bus */
+	fflush(stdout);
+	rewind(srv_out);
+	if (ftruncate(fileno(srv_out), 0) < 0 || (out = dup(STDOUT_FILENO)) < 0) {
+		srv_send(c, msg, snprintf(msg, sizeof(msg), "ERROR: output capture failed: %s\n",
+					  strerror(errno)));
+		goto end;
+	}
 
-        phy.phy_addr = 0x6;
-        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
+	dup2(fileno(srv_out), STDOUT_FILENO);
+
+	if (num == 0) {
+		ret = 0;
+	} else if ((p = srv_phy_get(id)) == NULL) {
+		printf("ERROR: init of phyId=%d failed\n", id);
+	} else if (strcasecmp(cmd_argv[2], "subscribe") == 0
+		   || strcasecmp(cmd_argv[2], "unsubscribe") == 0) {
+		ret = srv_subscribe(c, id, num + 2, cmd_argv);
+	} else if (i < (int)ARRAY_SIZE(srv_rejected)) {
+		printf("ERROR: \"%s\" is not available over the server\n", cmd_argv[2]);
+	} else {
+		phy.lock(phy.lock_data);
+		ret = cmdProcessor(num + 2, cmd_argv);
+		phy.unlock(phy.lock_data);
+		p->dev = phy;
+	}
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+	fflush(stdout);
+	dup2(out, STDOUT_FILENO);
+	close(out);
+	clearerr(stdout);
 
-        phy.phy_addr = 0x5;
-        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
+	lseek(fileno(srv_out), 0, SEEK_SET);
+	while (c->fd >= 0 && (n = read(fileno(srv_out), msg, sizeof(msg))) > 0)
+		srv_send(c, msg, n);
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+end:
+	msg[0] = 0;
+	srv_send(c, msg, snprintf(msg + 1, sizeof(msg) - 1, "ret %d\n", ret) + 1);
+}
 
-        phy.phy_addr = 0x4;
-        ret = gpy2xx_write_mmd(&phy, 0x3, 0x0, 0xa05c);
+/* Handle all complete lines, so pipelined requests are run in order */
+static void srv_read(struct srv_client *c, int phyId)
+{
+	char *nl;
+	int n, off;
+
+	n = read(c->fd, c->buf + c->len, sizeof(c->buf) - 1 - c->len);
+	if (n <= 0) {
+		close(c->fd);
+		c->fd = -1;
+		return;
+	}
 
-        if (ret < 0) {
-                printf("\nERROR: MMD write failed.\n");
-        }
+	c->len += n;
+	c->buf[c->len] = 0;
 
-        //udelay(1500u);
+	for (off = 0; c->fd >= 0 && (nl = strchr(c->buf + off, '\n')) != NULL; off = nl + 1 - c->buf) {
+		*nl = 0;
+		srv_request(c, c->buf + off, phyId);
+	}
 
-        phy.phy_addr = 0x4;
-        ret = gpy2xx_read_mmd(&phy, 0x3, 0x0);
+	if (c->fd < 0)
+		return;
 
-        if (ret < 0) {
-                printf("\nERROR: MMD read failed.\n");
-        } else
-                printf("\nValue of PCS_CTRL1 is %x\n", ret);
+	c->len -= off;
+	memmove(c->buf, c->buf + off, c->len);
 
-        ret = gpy2xx_read_mmd(&phy, 0x3, 0x0);
+	if (c->len == (int)sizeof(c->buf) - 1) {
+		char msg[] = "ERROR: request too long\n\0ret -1\n";
 
-        if (ret < 0) {
-                printf("\nERROR: MMD read failed.\n");
-        } else
-                printf("\nValue of PCS_CTRL1 is %x\n", ret);
-#endif
+		srv_send(c, msg, sizeof(msg) - 1);
+		c->len = 0;
+	}
 }
 
-int cmdProcessor(int argc, char *argv[])
+/*
+ * Own the PHY contexts and serve CLI requests on a Unix domain socket.
+ * One-shot and batch invocations of gpy2xx_cli forward to this server
+ * automatically while it is running, so concurrent users no longer race
+ * on the MDIO bus and init runs only once per PHY.
+ */
+static int server_main(int argc, char *argv[], int phyId)
 {
-	if (xstrncasecmp(argv[2], "help", 4) == 0) {
-		gpy211_menu(argc > 2 ? argv[3] : NULL);
-	} else if (xstrncasecmp(argv[2], "msec", strlen("msec")) == 0) {
-		gpy2xx_msec_main(argc, argv);
-	} else if (xstrncasecmp(argv[2], "random", 6) == 0) {
-		random_input();
-	} else if (xstrncasecmp(argv[2], "resetrd", 7) == 0) {
-		reset_rd_std_ctrl();
-	} else {
-		gpy211_main(argc, argv);
+	const char *path = cli_sock_path(argc, argv);
+	struct pollfd pfd[SRV_MAX_CLIENTS + 1];
+	struct sockaddr_un addr;
+	pthread_mutexattr_t attr;
+	u32 poll_ms = 1000;
+	u64 next, now;
+	int lfd, fd, n, i, timeout;
+	int ret = 0;
+
+	scanParamArg(argc, argv, "poll", sizeof(poll_ms), &poll_ms);
+	if (poll_ms == 0)
+		poll_ms = 1000;
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		printf("ERROR: socket path too long \"%s\"\n", path);
+		return -1;
 	}
-	return 0;
-}
 
-int Search_in_File(char *fname, char *str) {
-	FILE *fp;
-	int line_num = 1;
-	int find_result = 0,found =0,i,j,count;
-	unsigned int num;
-	char temp[512];
-	char temp1[512];
-	
-	if((fp = fopen(fname, "r")) == NULL) {
-		printf("\nSorry, config file not found.\n");
-		exit(0);
+	/* Only a socket nobody answers on is stale and may be replaced */
+	fd = client_connect(path);
+	if (fd >= 0) {
+		close(fd);
+		printf("ERROR: a server is already running on \"%s\"\n", path);
+		return -1;
 	}
 
-	while(fgets(temp, 512, fp) != NULL) {
-		if((strstr(temp, str)) != NULL) {
-			find_result =1;
-			for(i=0,j=0,count=0;temp[i] != '\0';i++)
-			{
-				if(found)
-				{
-					temp1[j] = temp[i];
-					j++;
-				}
-					
-				if(temp[i] == ' '){
-					count++;
-					if(count == 2)
-						found = 1;
-				}
-			}
-			temp1[j] = '\0';
-			break;
-		}
-		line_num++;
+	srv_out = tmpfile();
+	if (srv_out == NULL) {
+		printf("ERROR: tmpfile failed: %s\n", strerror(errno));
+		return -1;
 	}
 
-	num = (int)strtol(temp1, NULL, 10); 
-	if(find_result == 0) {
-		printf("\nSorry, couldn't find a match.\n");
-		return(0);
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&srv_lock, &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	for (i = 0; i < SRV_MAX_CLIENTS; i++)
+		srv_client[i].fd = -1;
+
+	srv_phy_save(phyId);
+
+	lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (lfd < 0) {
+		printf("ERROR: socket failed: %s\n", strerror(errno));
+		ret = -1;
+		goto END;
 	}
-	
-	if(fp) {
-		fclose(fp);
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	unlink(path);
+
+	if (bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(lfd, SRV_MAX_CLIENTS) < 0) {
+		printf("ERROR: could not listen on \"%s\": %s\n", path, strerror(errno));
+		close(lfd);
+		ret = -1;
+		goto END;
 	}
-   	return(num);
-}
 
-void Usage(char *filename) {
-	printf("Usage: %s <file> <string>\n", filename);
-	printf("%s version 1.0 \nCopyright(c) CodingUnit.com\n", filename);
-}
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, srv_sig);
+	signal(SIGTERM, srv_sig);
 
+	printf("gpy2xx_cli server on %s, phyId=%d, poll %u ms\n", path, phyId, poll_ms);
+	fflush(stdout);
 
-int init(int phyId)
-{
-	int ret=0;
-	const char *gsw_dev = "/dev/switch_api/0";
-		
-	mdio.xgmac_id = 2;
-	mdio.fd = open(gsw_dev, O_RDONLY);
-	phy.lock = NULL;
-	phy.unlock = NULL;
-	phy.lock_data = NULL;
-	phy.mdiobus_read = gpy211_mdio_read; 
-	phy.mdiobus_write = gpy211_mdio_write;
-	phy.mdiobus_data = &mdio;
-	phy.smdio_addr = 0;
-	phy.phy_addr = phyId;
-	phy.priv_data = NULL;
-	phy.shared_data =NULL;
-	phy.wol_supported =0x60;
-	phy.ptp_clock = 0x1836E210ull; //406.25MHz
-	phy.macsec_supported = 0;
-	phy.nr_of_sas = 32;
+	next = batch_time_us() + poll_ms * 1000ull;
 
-	if (mdio.fd < 0) {
-		printf("ERROR: Could not open switch dev node \"%s\"\n", gsw_dev);
-		ret = -1;
+	while (!srv_stop) {
+		pfd[0].fd = lfd;
+		pfd[0].events = POLLIN;
+
+		for (i = 0; i < SRV_MAX_CLIENTS; i++) {
+			pfd[i + 1].fd = srv_client[i].fd;
+			pfd[i + 1].events = POLLIN;
+			pfd[i + 1].revents = 0;
+		}
+
+		now = batch_time_us();
+		timeout = now >= next ? 0 : (int)((next - now + 999) / 1000);
+
+		n = poll(pfd, SRV_MAX_CLIENTS + 1, timeout);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+
+			printf("ERROR: poll failed: %s\n", strerror(errno));
+			ret = -1;
+			break;
+		}
+
+		if (pfd[0].revents & POLLIN) {
+			fd = accept(lfd, NULL, NULL);
+
+			for (i = 0; fd >= 0 && i < SRV_MAX_CLIENTS && srv_client[i].fd >= 0; i++);
+
+			if (fd >= 0 && i == SRV_MAX_CLIENTS) {
+				close(fd);
+			} else if (fd >= 0) {
+				struct timeval tv = {
+					.tv_sec = SRV_SNDTIMEO_MS / 1000,
+					.tv_usec = (SRV_SNDTIMEO_MS % 1000) * 1000,
+				};
+
+				setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+				memset(&srv_client[i], 0, sizeof(srv_client[i]));
+				srv_client[i].fd = fd;
+			}
+		}
+
+		for (i = 0; i < SRV_MAX_CLIENTS; i++) {
+			if (srv_client[i].fd >= 0 && pfd[i + 1].fd == srv_client[i].fd
+			    && (pfd[i + 1].revents & (POLLIN | POLLHUP | POLLERR)))
+				srv_read(&srv_client[i], phyId);
+		}
+
+		now = batch_time_us();
+		if (now >= next) {
+			srv_poll_events();
+			next = now + poll_ms * 1000ull;
+		}
 	}
 
-	ret = gpy2xx_init(&phy);
-	if (ret < 0) {
-		printf("api gpy2xx_init failed: %d\n", ret);
-		return ret;
+	for (i = 0; i < SRV_MAX_CLIENTS; i++) {
+		if (srv_client[i].fd >= 0)
+			close(srv_client[i].fd);
 	}
 
-	return ret;			   
-}	
+	close(lfd);
+	unlink(path);
+
+END:
+	pthread_mutex_destroy(&srv_lock);
+	fclose(srv_out);
+	return ret;
+}
 
 int main(int argc, char *argv[])
 {
 	int ret;
 	int phyId = 0;
+	int srv_fd = -1;
 
 	if (xstrncasecmp(argv[1], "phyId", 5) != 0) {
 		printf("ERROR: phyId missing\"%s\"\n");
@@ -7422,11 +9704,32 @@ int main(int argc, char *argv[])
 
 	/* scan for device node index */
 	scanParamArg(argc, argv, "phyId", 32, &phyId);
+
+	/* Forward to the server if one owns the PHYs */
+	if (argc > 2 && xstrncasecmp(argv[2], "server", 6) != 0)
+		srv_fd = client_connect(cli_sock_path(argc, argv));
+
+	if (srv_fd >= 0) {
+		ret = 0;
+		if (xstrncasecmp(argv[2], "batch", 5) == 0)
+			ret = batch_main(argc, argv, phyId, srv_fd);
+		else if (client_cmd(srv_fd, argc, argv, strcasecmp(argv[2], "subscribe") == 0) == -EPIPE)
+			ret = -1;
+
+		close(srv_fd);
+		return ret;
+	}
+
 	ret = init(phyId);
 	if (ret < 0)
 		goto end;
 
-	cmdProcessor(argc, argv);
+	if (argc > 2 && xstrncasecmp(argv[2], "batch", 5) == 0)
+		ret = batch_main(argc, argv, phyId, -1);
+	else if (argc > 2 && xstrncasecmp(argv[2], "server", 6) == 0)
+		ret = server_main(argc, argv, phyId);
+	else
+		cmdProcessor(argc, argv);
 end:
 
 	close(mdio.fd);
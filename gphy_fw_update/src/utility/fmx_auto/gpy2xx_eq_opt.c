@@ -0,0 +1,635 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Searches the USXGMII Tx EQ (main/pre/post) for the largest error-free
+   margin, using the XPCS PRBS31 BERT.
+
+   Each point of the EQ grid is set with gpy2xx_usxgmii_reach_cfg (custom
+   reach) and measured for dwell ms. The result is the error-free point
+   farthest (Chebyshev distance in grid steps) from any erroring point, i.e.
+   the center of the widest zero-error region, not the first passing point.
+   Ties go to the point with the least errors nearby. The chosen point is
+   then verified for verify ms; if it has errors, or no point is error-free,
+   the original EQ is restored.
+
+   The USXGMII lane is shared by the slices of a GPY24X, so there is one
+   search per chip (on its first slice); the chips found on the scanned
+   buses are searched concurrently (gpy2xx_mgr).
+
+   lb=1 uses the SerDes Tx to Rx loopback. With lb=0 (default) the link
+   partner must loop the PRBS31 pattern back.
+
+   Results are appended to out with the board ID, one line per chip, and
+   written back at boot with apply=<file>.
+
+   gpy2xx_eq_opt [xgmacMask=<mask>] [addrMask=<mask>] [smdioAddr=<n>]
+                 [main=<min:max>] [pre=<min:max>] [post=<min:max>]
+                 [step=<n>] [dwell=<ms>] [verify=<ms>] [lb=0|1]
+                 [board=<id>] [out=<file>]
+   gpy2xx_eq_opt apply=<file> [board=<id>] [xgmacMask=<mask>] [addrMask=<mask>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <limits.h>
+
+#include "gpy2xx_mgr.h"
+#include <registers/phy/vspec1.h>
+
+/* Tx EQ field range (gpy211_usxgmii_reach) */
+#define EQ_MAX 0x3F
+/* Settling time after an EQ change in us */
+#define EQ_SETTLE_US 10000
+
+enum eq_axis {
+	EQ_MAIN = 0,
+	EQ_PRE,
+	EQ_POST,
+	EQ_AXES,
+};
+
+struct eq_cfg {
+	u32 xgmac_mask;
+	u32 addr_mask;
+	u32 smdio_addr;
+	/* min/max per axis, -1 min: keep the current value */
+	int min[EQ_AXES];
+	int max[EQ_AXES];
+	u32 step;
+	u32 dwell_ms;
+	u32 verify_ms;
+	u32 lb;
+	const char *board;
+	const char *out;
+	const char *apply;
+};
+
+/* Search of one chip */
+struct eq_job {
+	const struct eq_cfg *cfg;
+	struct gpy2xx_mgr_phy *p;
+	struct gpy211_usxgmii_reach orig;
+	int base[EQ_AXES];
+	u32 n[EQ_AXES];
+	/* Errors per grid point, <0 if the point could not be measured */
+	int *err;
+	u32 points;
+	u32 zero;
+	/* Best point */
+	int best[EQ_AXES];
+	int margin;
+	int verify_err;
+	int ret;
+};
+
+static const char *const eq_axis_name[EQ_AXES] = {"main", "pre", "post"};
+
+static int eq_val(const struct eq_job *job, u32 axis, u32 i)
+{
+	return job->base[axis] + (int)(i * job->cfg->step);
+}
+
+static u32 eq_idx(const struct eq_job *job, const u32 *i)
+{
+	return (i[EQ_MAIN] * job->n[EQ_PRE] + i[EQ_PRE]) * job->n[EQ_POST] + i[EQ_POST];
+}
+
+static void eq_pos(const struct eq_job *job, u32 idx, u32 *i)
+{
+	i[EQ_POST] = idx % job->n[EQ_POST];
+	idx /= job->n[EQ_POST];
+	i[EQ_PRE] = idx % job->n[EQ_PRE];
+	i[EQ_MAIN] = idx / job->n[EQ_PRE];
+}
+
+static int eq_set(struct eq_job *job, const int *v)
+{
+	struct gpy211_usxgmii_reach r = job->orig;
+
+	r.trace_len = CONST_VSPEC1_SGMII_CTRL_USXGMII_REACH_CUSTOM;
+	r.tx_eq_main = (u16)v[EQ_MAIN];
+	r.tx_eq_pre = (u16)v[EQ_PRE];
+	r.tx_eq_post = (u16)v[EQ_POST];
+
+	return gpy2xx_usxgmii_reach_cfg(&job->p->dev, &r);
+}
+
+/* Test pattern errors in ms, counters are cleared on read */
+static int eq_bert(struct eq_job *job, u32 ms)
+{
+	int ret;
+	struct gpy211_usxgmii_rx_bert_statistics st;
+
+	usleep(EQ_SETTLE_US);
+	ret = gpy2xx_usxgmii_rx_bert_stat(&job->p->dev, &st);
+
+	if (ret < 0)
+		return ret;
+
+	usleep(ms * 1000);
+	ret = gpy2xx_usxgmii_rx_bert_stat(&job->p->dev, &st);
+
+	if (ret < 0)
+		return ret;
+
+	return st.tp_error_count < 0 ? INT_MAX : st.tp_error_count;
+}
+
+static int eq_bert_mode(struct eq_job *job, int on)
+{
+	int ret;
+	struct gpy211_usxgmii_tx_bert_config tx = {
+		.mode = on ? BERT_PRBS31_TX : BERT_TX_MODE_DISABLE,
+		.nval_sel = BERT_TX_NVAL_SEL_4,
+	};
+	struct gpy211_usxgmii_rx_bert_config rx = {
+		.mode = on ? BERT_PRBS31_RX : BERT_RX_MODE_DISABLE,
+	};
+
+	ret = gpy2xx_usxgmii_tx_bert_cfg(&job->p->dev, &tx);
+
+	if (ret < 0)
+		return ret;
+
+	return gpy2xx_usxgmii_rx_bert_cfg(&job->p->dev, &rx);
+}
+
+/* Margin of each error-free point: Chebyshev distance to the nearest
+   erroring point. Points just outside the swept range count as erroring,
+   as they are not measured. Ties: least errors weighted by 1/d^2 */
+static void eq_pick(struct eq_job *job)
+{
+	u32 a, b, k, i[EQ_AXES], j[EQ_AXES];
+	int d, dk, margin;
+	double pot, best_pot = 0;
+
+	job->margin = -1;
+
+	for (a = 0; a < job->points; a++) {
+		if (job->err[a] != 0)
+			continue;
+
+		eq_pos(job, a, i);
+		margin = INT_MAX;
+		pot = 0;
+
+		for (k = 0; k < EQ_AXES; k++) {
+			if (job->n[k] == 1)
+				continue;
+
+			dk = (int)i[k] + 1 < (int)(job->n[k] - i[k]) ?
+			     (int)i[k] + 1 : (int)(job->n[k] - i[k]);
+			margin = dk < margin ? dk : margin;
+		}
+
+		for (b = 0; b < job->points; b++) {
+			if (job->err[b] == 0)
+				continue;
+
+			eq_pos(job, b, j);
+			d = 0;
+
+			for (k = 0; k < EQ_AXES; k++) {
+				dk = abs((int)i[k] - (int)j[k]);
+				d = dk > d ? dk : d;
+			}
+
+			margin = d < margin ? d : margin;
+			pot += (double)(job->err[b] < 0 ? INT_MAX : job->err[b]) / ((double)d * d);
+		}
+
+		/* Single point grid */
+		if (margin == INT_MAX)
+			margin = 0;
+
+		if (margin > job->margin || (margin == job->margin && pot < best_pot)) {
+			job->margin = margin;
+			best_pot = pot;
+
+			for (k = 0; k < EQ_AXES; k++)
+				job->best[k] = eq_val(job, k, i[k]);
+		}
+	}
+}
+
+static void *eq_search(void *arg)
+{
+	struct eq_job *job = arg;
+	struct gpy211_device *dev = &job->p->dev;
+	enum gpy211_usxgmii_loopback_mode lb = USXGMII_LOOPBACK_DISABLE;
+	u32 a, k, i[EQ_AXES];
+	int v[EQ_AXES];
+	int ret;
+
+	job->margin = -1;
+	job->verify_err = -1;
+
+	ret = gpy2xx_usxgmii_loopback_get(dev, &lb);
+
+	if (ret < 0)
+		goto END;
+
+	if (job->cfg->lb) {
+		ret = gpy2xx_usxgmii_loopback_cfg(dev, USXGMII_LOOPBACK_TX2RX);
+
+		if (ret < 0)
+			goto END;
+	}
+
+	ret = eq_bert_mode(job, 1);
+
+	if (ret < 0)
+		goto RESTORE;
+
+	for (a = 0; a < job->points; a++) {
+		eq_pos(job, a, i);
+
+		for (k = 0; k < EQ_AXES; k++)
+			v[k] = eq_val(job, k, i[k]);
+
+		ret = eq_set(job, v);
+		job->err[a] = ret < 0 ? ret : eq_bert(job, job->cfg->dwell_ms);
+
+		if (job->err[a] == 0)
+			job->zero++;
+	}
+
+	eq_pick(job);
+
+	if (job->margin >= 0) {
+		ret = eq_set(job, job->best);
+
+		if (ret == 0)
+			job->verify_err = eq_bert(job, job->cfg->verify_ms);
+	}
+
+RESTORE:
+	eq_bert_mode(job, 0);
+
+	if (job->margin < 0 || job->verify_err != 0) {
+		gpy2xx_usxgmii_reach_cfg(dev, &job->orig);
+		ret = ret < 0 ? ret : -EIO;
+	} else {
+		ret = 0;
+	}
+
+	if (job->cfg->lb)
+		gpy2xx_usxgmii_loopback_cfg(dev, lb);
+
+END:
+	job->ret = ret;
+	return NULL;
+}
+
+static int eq_prepare(struct eq_job *job)
+{
+	int ret, cur[EQ_AXES];
+	u32 k;
+	const struct eq_cfg *cfg = job->cfg;
+
+	ret = gpy2xx_usxgmii_reach_get(&job->p->dev, &job->orig);
+
+	if (ret < 0)
+		return ret;
+
+	cur[EQ_MAIN] = job->orig.tx_eq_main;
+	cur[EQ_PRE] = job->orig.tx_eq_pre;
+	cur[EQ_POST] = job->orig.tx_eq_post;
+	job->points = 1;
+
+	for (k = 0; k < EQ_AXES; k++) {
+		if (cfg->min[k] < 0) {
+			job->base[k] = cur[k];
+			job->n[k] = 1;
+		} else {
+			job->base[k] = cfg->min[k];
+			job->n[k] = (u32)(cfg->max[k] - cfg->min[k]) / cfg->step + 1;
+		}
+
+		job->points *= job->n[k];
+	}
+
+	job->err = calloc(job->points, sizeof(*job->err));
+
+	return job->err == NULL ? -ENOMEM : 0;
+}
+
+static void eq_save(const struct eq_cfg *cfg, struct gpy2xx_mgr *mgr,
+		    const struct eq_job *job)
+{
+	FILE *f;
+
+	if (cfg->out == NULL || job->ret < 0)
+		return;
+
+	f = fopen(cfg->out, "a");
+
+	if (f == NULL) {
+		printf("WARN: Could not open \"%s\"\n", cfg->out);
+		return;
+	}
+
+	fprintf(f, "board=%s xgmac=%d addr=%u main=%d pre=%d post=%d margin=%d zero=%u/%u\n",
+		cfg->board, mgr->bus[job->p->bus].cfg.xgmac_id, job->p->dev.phy_addr,
+		job->best[EQ_MAIN], job->best[EQ_PRE], job->best[EQ_POST],
+		job->margin, job->zero, job->points);
+	fclose(f);
+}
+
+static void eq_report(struct gpy2xx_mgr *mgr, const struct eq_job *job)
+{
+	u32 a, k, i[EQ_AXES];
+
+	printf("\nxgmac %d addr %u: ", mgr->bus[job->p->bus].cfg.xgmac_id,
+	       job->p->dev.phy_addr);
+
+	if (job->margin < 0) {
+		printf("no error-free point (%d)\n", job->ret);
+		return;
+	}
+
+	printf("main %d pre %d post %d, margin %d step(s), %u/%u points error-free, "
+	       "verify %d error(s)%s\n", job->best[EQ_MAIN], job->best[EQ_PRE],
+	       job->best[EQ_POST], job->margin, job->zero, job->points,
+	       job->verify_err, job->ret < 0 ? ", original EQ restored" : "");
+
+	/* pre x post map of the best main, '.' error-free */
+	if (job->n[EQ_PRE] == 1 || job->n[EQ_POST] == 1)
+		return;
+
+	i[EQ_MAIN] = (u32)(job->best[EQ_MAIN] - job->base[EQ_MAIN]) / job->cfg->step;
+
+	for (i[EQ_PRE] = 0; i[EQ_PRE] < job->n[EQ_PRE]; i[EQ_PRE]++) {
+		printf("\tpre %2d ", eq_val(job, EQ_PRE, i[EQ_PRE]));
+
+		for (i[EQ_POST] = 0; i[EQ_POST] < job->n[EQ_POST]; i[EQ_POST]++) {
+			a = eq_idx(job, i);
+			k = eq_val(job, EQ_PRE, i[EQ_PRE]) == job->best[EQ_PRE] &&
+			    eq_val(job, EQ_POST, i[EQ_POST]) == job->best[EQ_POST];
+			printf("%c", k ? '*' : job->err[a] == 0 ? '.' : job->err[a] < 0 ? '?' : 'x');
+		}
+
+		printf("\n");
+	}
+}
+
+/* Write saved EQ of the board to the PHYs found */
+static int eq_apply(const struct eq_cfg *cfg, struct gpy2xx_mgr *mgr)
+{
+	char line[256], board[64];
+	int xgmac, addr, v[EQ_AXES], cnt = 0;
+	struct gpy211_usxgmii_reach r;
+	FILE *f;
+	u32 i;
+
+	f = fopen(cfg->apply, "r");
+
+	if (f == NULL) {
+		printf("ERROR: Could not open \"%s\"\n", cfg->apply);
+		return -1;
+	}
+
+	/* Later lines win */
+	while (fgets(line, sizeof(line), f) != NULL) {
+		if (sscanf(line, "board=%63s xgmac=%d addr=%d main=%d pre=%d post=%d",
+			   board, &xgmac, &addr, &v[EQ_MAIN], &v[EQ_PRE], &v[EQ_POST]) != 6 ||
+		    strcmp(board, cfg->board) != 0)
+			continue;
+
+		for (i = 0; i < mgr->nr_phy; i++) {
+			struct gpy2xx_mgr_phy *p = &mgr->phy[i];
+
+			if (p->ret < 0 || mgr->bus[p->bus].cfg.xgmac_id != xgmac ||
+			    p->dev.phy_addr != addr)
+				continue;
+
+			if (gpy2xx_usxgmii_reach_get(&p->dev, &r) < 0)
+				break;
+
+			r.trace_len = CONST_VSPEC1_SGMII_CTRL_USXGMII_REACH_CUSTOM;
+			r.tx_eq_main = (u16)v[EQ_MAIN];
+			r.tx_eq_pre = (u16)v[EQ_PRE];
+			r.tx_eq_post = (u16)v[EQ_POST];
+
+			if (gpy2xx_usxgmii_reach_cfg(&p->dev, &r) < 0) {
+				printf("ERROR: xgmac %d addr %d EQ set failed\n", xgmac, addr);
+				break;
+			}
+
+			printf("xgmac %d addr %d: main %d pre %d post %d\n", xgmac, addr,
+			       v[EQ_MAIN], v[EQ_PRE], v[EQ_POST]);
+			cnt++;
+			break;
+		}
+	}
+
+	fclose(f);
+	return cnt;
+}
+
+static int eq_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int eq_range(const char *v, int *min, int *max)
+{
+	char *end;
+
+	*min = (int)strtol(v, &end, 0);
+	*max = *end == ':' ? (int)strtol(end + 1, NULL, 0) : *min;
+
+	return (*min < 0 || *max < *min || *max > EQ_MAX) ? -1 : 0;
+}
+
+static int eq_parse(int argc, char *argv[], struct eq_cfg *cfg)
+{
+	int i, k;
+	const char *v;
+
+	for (i = 1; i < argc; i++) {
+		for (k = 0; k < EQ_AXES; k++) {
+			if (eq_arg(argv[i], eq_axis_name[k], &v))
+				break;
+		}
+
+		if (k < EQ_AXES) {
+			if (eq_range(v, &cfg->min[k], &cfg->max[k]) < 0)
+				return -1;
+		} else if (eq_arg(argv[i], "xgmacMask", &v)) {
+			cfg->xgmac_mask = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "addrMask", &v)) {
+			cfg->addr_mask = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "smdioAddr", &v)) {
+			cfg->smdio_addr = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "step", &v)) {
+			cfg->step = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "dwell", &v)) {
+			cfg->dwell_ms = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "verify", &v)) {
+			cfg->verify_ms = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "lb", &v)) {
+			cfg->lb = (u32)strtoul(v, NULL, 0);
+		} else if (eq_arg(argv[i], "board", &v)) {
+			cfg->board = v;
+		} else if (eq_arg(argv[i], "out", &v)) {
+			cfg->out = v;
+		} else if (eq_arg(argv[i], "apply", &v)) {
+			cfg->apply = v;
+		} else {
+			return -1;
+		}
+	}
+
+	if (cfg->step == 0 || cfg->dwell_ms == 0 || cfg->xgmac_mask == 0 ||
+	    cfg->addr_mask == 0 || strchr(cfg->board, ' ') != NULL)
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct gpy2xx_mgr mgr;
+	struct gpy2xx_mgr_bus_cfg bus[GPY2XX_MGR_MAX_BUSES];
+	struct eq_job *job = NULL;
+	pthread_t *tid = NULL;
+	u32 i, nr_bus = 0, nr_job = 0;
+	int ret, fd, last_chip = -1;
+	const char *gsw_dev = "/dev/switch_api/0";
+	struct eq_cfg cfg = {
+		.xgmac_mask = 1u << 2,
+		.addr_mask = 0xFFFFFFFF,
+		.min = {-1, 0, 0},
+		.max = {-1, EQ_MAX, EQ_MAX},
+		.step = 4,
+		.dwell_ms = 200,
+		.verify_ms = 2000,
+		.board = "default",
+	};
+
+	if (eq_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s [xgmacMask=<mask>] [addrMask=<mask>] [smdioAddr=<n>]\n"
+		       "\t[main=<min:max>] [pre=<min:max>] [post=<min:max>] [step=<n>]\n"
+		       "\t[dwell=<ms>] [verify=<ms>] [lb=0|1] [board=<id>] [out=<file>]\n"
+		       "\tmain defaults to the current value, pre/post to 0:%d\n"
+		       "%s apply=<file> [board=<id>] [xgmacMask=<mask>] [addrMask=<mask>]\n",
+		       argv[0], EQ_MAX, argv[0]);
+		return -1;
+	}
+
+	fd = open(gsw_dev, O_RDONLY);
+
+	if (fd < 0) {
+		printf("ERROR: Could not open switch dev node \"%s\"\n", gsw_dev);
+		return -1;
+	}
+
+	for (i = 0; i < 32 && nr_bus < GPY2XX_MGR_MAX_BUSES; i++) {
+		if (!(cfg.xgmac_mask & (1u << i)))
+			continue;
+
+		bus[nr_bus].xgmac_id = i;
+		bus[nr_bus].addr_mask = cfg.addr_mask;
+		bus[nr_bus].smdio_addr = cfg.smdio_addr;
+		bus[nr_bus].ptp_clock = 0x1836E210; //406.25MHz
+		nr_bus++;
+	}
+
+	ret = gpy2xx_mgr_open(&mgr, fd, bus, nr_bus);
+
+	if (ret >= 0)
+		ret = gpy2xx_mgr_init(&mgr);
+
+	if (ret <= 0) {
+		printf("ERROR: No PHY found (%d)\n", ret);
+		ret = -1;
+		goto end;
+	}
+
+	if (cfg.apply != NULL) {
+		ret = eq_apply(&cfg, &mgr) > 0 ? 0 : -1;
+		goto end;
+	}
+
+	job = calloc(mgr.nr_chip, sizeof(*job));
+	tid = calloc(mgr.nr_chip, sizeof(*tid));
+
+	if (job == NULL || tid == NULL) {
+		ret = -1;
+		goto end;
+	}
+
+	/* First slice of each GPY24X */
+	for (i = 0; i < mgr.nr_phy; i++) {
+		struct gpy2xx_mgr_phy *p = &mgr.phy[i];
+
+		if (p->ret < 0 || p->dev.id.family != ID_P34X || (int)p->chip == last_chip)
+			continue;
+
+		last_chip = (int)p->chip;
+		job[nr_job].cfg = &cfg;
+		job[nr_job].p = p;
+
+		if (eq_prepare(&job[nr_job]) < 0) {
+			printf("ERROR: xgmac %d addr %u not in USXGMII mode\n",
+			       mgr.bus[p->bus].cfg.xgmac_id, p->dev.phy_addr);
+			free(job[nr_job].err);
+			continue;
+		}
+
+		nr_job++;
+	}
+
+	if (nr_job == 0) {
+		printf("ERROR: No GPY24X in USXGMII mode found\n");
+		ret = -1;
+		goto end;
+	}
+
+	printf("%u chip(s), %u point(s) each, about %u s\n", nr_job, job[0].points,
+	       (job[0].points * (cfg.dwell_ms + EQ_SETTLE_US / 1000) + cfg.verify_ms) / 1000);
+
+	for (i = 0; i < nr_job; i++) {
+		if (pthread_create(&tid[i], NULL, eq_search, &job[i]) != 0) {
+			eq_search(&job[i]);
+			tid[i] = pthread_self();
+		}
+	}
+
+	ret = 0;
+
+	for (i = 0; i < nr_job; i++) {
+		if (!pthread_equal(tid[i], pthread_self()))
+			pthread_join(tid[i], NULL);
+
+		eq_report(&mgr, &job[i]);
+		eq_save(&cfg, &mgr, &job[i]);
+
+		if (job[i].ret < 0)
+			ret = -1;
+
+		free(job[i].err);
+	}
+
+end:
+	free(job);
+	free(tid);
+	gpy2xx_mgr_close(&mgr);
+	close(fd);
+
+	return ret;
+}
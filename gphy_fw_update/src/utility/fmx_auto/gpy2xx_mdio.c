@@ -1,3 +1,6 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
 #include <sys/ioctl.h>
 
 #include "gpy2xx_mdio.h"
@@ -221,3 +224,34 @@ int gpy211_mdio_write(void *busdata, u16 phyaddr, u32 regnum, u16 data)
 		return _gpy211_c22mdio_write(busdata, phyaddr, regnum, data);
 	}
 }
+
+int gpy2xx_mdio_phy_init(struct gpy211_device *phy, struct gpy2xx_mdio *mdio, u16 phy_addr)
+{
+	int ret;
+	const char *gsw_dev = "/dev/switch_api/0";
+
+	mdio->xgmac_id = 2;
+	mdio->fd = open(gsw_dev, O_RDONLY);
+
+	if (mdio->fd < 0) {
+		printf("ERROR: Could not open switch dev node \"%s\"\n", gsw_dev);
+		return -1;
+	}
+
+	memset(phy, 0, sizeof(*phy));
+	phy->mdiobus_read = gpy211_mdio_read;
+	phy->mdiobus_write = gpy211_mdio_write;
+	phy->mdiobus_data = mdio;
+	phy->smdio_addr = 0;
+	phy->phy_addr = phy_addr;
+	phy->wol_supported = 0x60;
+	phy->ptp_clock = 0x1836E210ull; //406.25MHz
+	phy->nr_of_sas = 32;
+
+	ret = gpy2xx_init(phy);
+
+	if (ret < 0)
+		printf("api gpy2xx_init failed: %d\n", ret);
+
+	return ret;
+}
@@ -1,6 +1,17 @@
+#ifndef _GPY2XX_MDIO_H_
+#define _GPY2XX_MDIO_H_
+
 #include <gpy211.h>
 #include <gpy211_common.h>
+#include <gpy211_ptp.h>
+#include <gpy211_mon.h>
 #include <gpy211_macsec.h>
+#include <gpy211_macsec_harvest.h>
+#include <gpy211_macsec_rekey.h>
+#include <gpy211_macsec_aes.h>
+#include <gpy211_macsec_alloc.h>
+#include <gpy211_macsec_sw.h>
+#include <gpy211_macsec_pol.h>
 #include <registers/phy/std.h>
 #include <registers/p31g/pmu_pdi_registers.h>
 #include <registers/p31g/smdio_pdi_smdio_registers.h>
@@ -12,3 +23,12 @@ struct gpy2xx_mdio {
 
 int gpy211_mdio_read(void *busdata, u16 phyaddr, u32 regnum);
 int gpy211_mdio_write(void *busdata, u16 phyaddr, u32 regnum, u16 data);
+
+/* Open the switch device, XGMAC 2, and init the PHY at phy_addr with the
+   board defaults (WoL, 406.25MHz PTP clock, 32 SAs). Single-PHY tools;
+   gpy2xx_mgr handles several buses and PHYs. The caller closes mdio->fd,
+   which is <0 if the switch device could not be opened.
+   Returns the gpy2xx_init result, -1 if the switch device cannot be opened. */
+int gpy2xx_mdio_phy_init(struct gpy211_device *phy, struct gpy2xx_mdio *mdio, u16 phy_addr);
+
+#endif /* _GPY2XX_MDIO_H_ */
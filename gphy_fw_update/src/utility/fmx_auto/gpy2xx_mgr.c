@@ -0,0 +1,313 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#include "gpy2xx_mgr.h"
+
+static u32 _mgr_us_since(const struct timespec *t0)
+{
+	struct timespec t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (u32)((t1.tv_sec - t0->tv_sec) * 1000000 +
+		     (t1.tv_nsec - t0->tv_nsec) / 1000);
+}
+
+static void _mgr_bus_get(struct gpy2xx_mgr_bus *bus)
+{
+	u32 ticket;
+
+	pthread_mutex_lock(&bus->lock);
+	ticket = bus->next++;
+
+	while (bus->serving != ticket)
+		pthread_cond_wait(&bus->turn, &bus->lock);
+
+	bus->accesses++;
+	pthread_mutex_unlock(&bus->lock);
+}
+
+static void _mgr_bus_put(struct gpy2xx_mgr_bus *bus)
+{
+	pthread_mutex_lock(&bus->lock);
+	bus->serving++;
+	pthread_cond_broadcast(&bus->turn);
+	pthread_mutex_unlock(&bus->lock);
+}
+
+static int _mgr_mdio_read(void *busdata, u16 phyaddr, u32 regnum)
+{
+	int ret;
+	struct gpy2xx_mgr_bus *bus = busdata;
+
+	_mgr_bus_get(bus);
+	ret = gpy211_mdio_read(&bus->mdio, phyaddr, regnum);
+	_mgr_bus_put(bus);
+
+	return ret;
+}
+
+static int _mgr_mdio_write(void *busdata, u16 phyaddr, u32 regnum, u16 data)
+{
+	int ret;
+	struct gpy2xx_mgr_bus *bus = busdata;
+
+	_mgr_bus_get(bus);
+	ret = gpy211_mdio_write(&bus->mdio, phyaddr, regnum, data);
+	_mgr_bus_put(bus);
+
+	return ret;
+}
+
+static void _mgr_lock(void *lock_data)
+{
+	pthread_mutex_lock(lock_data);
+}
+
+static void _mgr_unlock(void *lock_data)
+{
+	pthread_mutex_unlock(lock_data);
+}
+
+static void *_mgr_phy_init(void *arg)
+{
+	struct gpy2xx_mgr_phy *p = arg;
+	struct timespec t0;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	p->ret = gpy2xx_init(&p->dev);
+	p->init_us = _mgr_us_since(&t0);
+
+	return NULL;
+}
+
+struct mgr_bus_job {
+	struct gpy2xx_mgr *mgr;
+	u32 bus;
+};
+
+/* Bus worker, runs the init sequences of its devices side by side */
+static void *_mgr_bus_init(void *arg)
+{
+	struct mgr_bus_job *job = arg;
+	struct gpy2xx_mgr_bus *bus = &job->mgr->bus[job->bus];
+	pthread_t tid[GPY2XX_MGR_MAX_ADDR];
+	struct timespec t0;
+	u32 i, started = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	bus->accesses = 0;
+
+	for (i = 0; i < bus->num; i++) {
+		struct gpy2xx_mgr_phy *p = &job->mgr->phy[bus->first + i];
+
+		if (pthread_create(&tid[i], NULL, _mgr_phy_init, p) != 0) {
+			/* Run it on this thread */
+			_mgr_phy_init(p);
+			tid[i] = pthread_self();
+			continue;
+		}
+
+		started |= 1u << i;
+	}
+
+	for (i = 0; i < bus->num; i++) {
+		if (started & (1u << i))
+			pthread_join(tid[i], NULL);
+	}
+
+	bus->init_us = _mgr_us_since(&t0);
+
+	return NULL;
+}
+
+/* Slices of a GPY24X are at the addresses of one aligned group of SLICE_NUM */
+static void _mgr_group(struct gpy2xx_mgr *mgr)
+{
+	u32 i;
+	struct gpy2xx_mgr_phy *p, *prev = NULL;
+
+	mgr->nr_chip = 0;
+
+	for (i = 0; i < mgr->nr_phy; i++) {
+		p = &mgr->phy[i];
+		p->slice = 0;
+
+		if (p->ret == 0 && p->dev.id.family == ID_P34X) {
+			p->slice = PHYADDR2INDEX(p->dev.phy_addr);
+
+			if (prev != NULL && prev->ret == 0 && prev->bus == p->bus &&
+			    prev->dev.id.family == ID_P34X &&
+			    (prev->dev.phy_addr & ~(SLICE_NUM - 1)) ==
+			    (p->dev.phy_addr & ~(SLICE_NUM - 1))) {
+				p->chip = prev->chip;
+				prev = p;
+				continue;
+			}
+		}
+
+		p->chip = mgr->nr_chip++;
+		prev = p;
+	}
+}
+
+int gpy2xx_mgr_open(struct gpy2xx_mgr *mgr, int fd,
+		    const struct gpy2xx_mgr_bus_cfg *cfg, u32 nr_bus)
+{
+	u8 addr[GPY2XX_MGR_MAX_BUSES][GPY2XX_MGR_MAX_ADDR];
+	struct gpy2xx_mgr_bus *bus;
+	struct gpy2xx_mgr_phy *p;
+	u32 b, a, n = 0;
+	int ret;
+
+	if (mgr == NULL || cfg == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	if (fd < 0 || nr_bus == 0 || nr_bus > GPY2XX_MGR_MAX_BUSES) {
+		LOG_WARN("WARN: Invalid input (fd/nrBus)\n");
+		return -EINVAL;
+	}
+
+	memset(mgr, 0, sizeof(*mgr));
+	mgr->nr_bus = nr_bus;
+
+	for (b = 0; b < nr_bus; b++) {
+		bus = &mgr->bus[b];
+		bus->cfg = cfg[b];
+		bus->mdio.fd = fd;
+		bus->mdio.xgmac_id = cfg[b].xgmac_id;
+		pthread_mutex_init(&bus->lock, NULL);
+		pthread_cond_init(&bus->turn, NULL);
+		bus->first = n;
+
+		/* One read per address, nothing else responds with a valid ID */
+		for (a = 0; a < GPY2XX_MGR_MAX_ADDR; a++) {
+			if (!(cfg[b].addr_mask & (1u << a)))
+				continue;
+
+			ret = gpy211_mdio_read(&bus->mdio, (u16)a, STD_STD_PHYID1 / 2);
+
+			if (ret <= 0 || ret >= 0xFFFF)
+				continue;
+
+			addr[b][bus->num++] = (u8)a;
+		}
+
+		n += bus->num;
+	}
+
+	if (n == 0)
+		return 0;
+
+	/* All contexts from one allocation */
+	mgr->phy = calloc(n, sizeof(*mgr->phy));
+
+	if (mgr->phy == NULL)
+		return -ENOMEM;
+
+	mgr->nr_phy = n;
+
+	for (b = 0; b < nr_bus; b++) {
+		bus = &mgr->bus[b];
+
+		for (a = 0; a < bus->num; a++) {
+			p = &mgr->phy[bus->first + a];
+			p->bus = b;
+			p->ret = -ENODEV;
+			pthread_mutex_init(&p->lock, NULL);
+			p->dev.lock = _mgr_lock;
+			p->dev.unlock = _mgr_unlock;
+			p->dev.lock_data = &p->lock;
+			p->dev.mdiobus_read = _mgr_mdio_read;
+			p->dev.mdiobus_write = _mgr_mdio_write;
+			p->dev.mdiobus_data = bus;
+			p->dev.smdio_addr = bus->cfg.smdio_addr;
+			p->dev.phy_addr = addr[b][a];
+			p->dev.wol_supported = 0x60;
+			p->dev.ptp_clock = bus->cfg.ptp_clock;
+			p->dev.nr_of_sas = 32;
+		}
+	}
+
+	return (int)n;
+}
+
+int gpy2xx_mgr_init(struct gpy2xx_mgr *mgr)
+{
+	pthread_t tid[GPY2XX_MGR_MAX_BUSES];
+	struct mgr_bus_job job[GPY2XX_MGR_MAX_BUSES];
+	struct timespec t0;
+	u32 b, i, started = 0;
+	int cnt = 0;
+
+	if (mgr == NULL) {
+		LOG_WARN("WARN: NULL input pointer(s)\n");
+		return -EINVAL;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+
+	for (b = 0; b < mgr->nr_bus; b++) {
+		job[b].mgr = mgr;
+		job[b].bus = b;
+
+		if (mgr->bus[b].num == 0)
+			continue;
+
+		if (pthread_create(&tid[b], NULL, _mgr_bus_init, &job[b]) != 0) {
+			_mgr_bus_init(&job[b]);
+			continue;
+		}
+
+		started |= 1u << b;
+	}
+
+	for (b = 0; b < mgr->nr_bus; b++) {
+		if (started & (1u << b))
+			pthread_join(tid[b], NULL);
+	}
+
+	mgr->init_us = _mgr_us_since(&t0);
+
+	_mgr_group(mgr);
+
+	for (i = 0; i < mgr->nr_phy; i++) {
+		if (mgr->phy[i].ret == 0)
+			cnt++;
+	}
+
+	return cnt;
+}
+
+void gpy2xx_mgr_close(struct gpy2xx_mgr *mgr)
+{
+	u32 i;
+
+	if (mgr == NULL)
+		return;
+
+	for (i = 0; i < mgr->nr_phy; i++) {
+		if (mgr->phy[i].ret == 0)
+			gpy2xx_uninit(&mgr->phy[i].dev);
+
+		pthread_mutex_destroy(&mgr->phy[i].lock);
+	}
+
+	for (i = 0; i < mgr->nr_bus; i++) {
+		pthread_mutex_destroy(&mgr->bus[i].lock);
+		pthread_cond_destroy(&mgr->bus[i].turn);
+	}
+
+	free(mgr->phy);
+	memset(mgr, 0, sizeof(*mgr));
+}
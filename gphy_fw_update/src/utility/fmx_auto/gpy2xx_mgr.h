@@ -0,0 +1,99 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY2XX_MGR_H_
+#define _GPY2XX_MGR_H_
+
+#include <pthread.h>
+
+#include "gpy2xx_mdio.h"
+
+/* Multi-PHY device manager.
+
+   gpy2xx_mgr_open scans the PHY addresses of each configured MDIO bus
+   (STD_PHYID1 only) and allocates all device contexts from one arena.
+   gpy2xx_mgr_init then runs gpy2xx_init for all PHYs: one worker per bus,
+   and on a bus one init sequence per PHY. The sequences of a bus take
+   turns on the bus per MDIO access, so the mailbox latency of one PHY is
+   overlapped with the accesses of the others. Bring-up time scales with
+   the PHYs of the busiest bus instead of all PHYs.
+
+   After init, the slices of a GPY24X share one chip index. Each device has
+   its own lock, set as lock/unlock of gpy211_device. */
+
+#define GPY2XX_MGR_MAX_BUSES 4
+#define GPY2XX_MGR_MAX_ADDR 32
+
+/* Bus configuration */
+struct gpy2xx_mgr_bus_cfg {
+	/* MDIO master (MAC index) */
+	int xgmac_id;
+	/* PHY addresses to scan, bit per address */
+	u32 addr_mask;
+	/* Pin-strapped SMDIO address of the PHYs on the bus */
+	int smdio_addr;
+	/* PTP clock (in Hz) */
+	u32 ptp_clock;
+};
+
+/* Bus, MDIO accesses of its devices take turns in request order (ticket
+   lock), so the init sequences on a bus interleave per access */
+struct gpy2xx_mgr_bus {
+	struct gpy2xx_mdio mdio;
+	struct gpy2xx_mgr_bus_cfg cfg;
+	pthread_mutex_t lock;
+	pthread_cond_t turn;
+	u32 next;
+	u32 serving;
+	/* Devices of the bus in the arena */
+	u32 first;
+	u32 num;
+	/* Init time of the bus in us */
+	u32 init_us;
+	/* MDIO accesses during init */
+	u32 accesses;
+};
+
+/* Device context */
+struct gpy2xx_mgr_phy {
+	struct gpy211_device dev;
+	pthread_mutex_t lock;
+	u32 bus;
+	/* Chip index, shared by the slices of a GPY24X */
+	u32 chip;
+	/* Slice in the chip */
+	u32 slice;
+	/* Result of gpy2xx_init */
+	int ret;
+	/* Init time in us */
+	u32 init_us;
+};
+
+struct gpy2xx_mgr {
+	u32 nr_bus;
+	struct gpy2xx_mgr_bus bus[GPY2XX_MGR_MAX_BUSES];
+	/* Arena of nr_phy devices, ordered by bus and address */
+	u32 nr_phy;
+	struct gpy2xx_mgr_phy *phy;
+	u32 nr_chip;
+	/* Init time of all buses in us */
+	u32 init_us;
+};
+
+/* Scan the buses and allocate the devices.
+   Returns number of PHYs found, or <0 error code */
+int gpy2xx_mgr_open(struct gpy2xx_mgr *mgr, int fd,
+		    const struct gpy2xx_mgr_bus_cfg *cfg, u32 nr_bus);
+
+/* Initialize all devices in parallel.
+   Returns number of devices initialized, or <0 error code */
+int gpy2xx_mgr_init(struct gpy2xx_mgr *mgr);
+
+/* Uninitialize and free all devices */
+void gpy2xx_mgr_close(struct gpy2xx_mgr *mgr);
+
+#endif /* _GPY2XX_MGR_H_ */
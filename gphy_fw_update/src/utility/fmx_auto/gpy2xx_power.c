@@ -0,0 +1,640 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* PHY power agent: thermal and utilisation driven power policy for all
+   PHYs of the scanned buses, reporting to ppmd.
+
+   Every period the agent reads the link status of each port, its packet
+   rate (GMAC-F counter accumulator) and the die temperature once per chip
+   (gpy2xx_pvt_get). The hottest chip sets the tier:
+     normal  below warm
+     warm    from warm
+     hot     from hot
+     crit    from crit
+   A tier is left when the temperature is hyst degrees below its entry.
+
+   Actions, with the mode set by ppmd (see below):
+     - ULP (gpy2xx_ulp_cfg) on ports with link down for idle ms, in
+       balance and lowpower mode.
+     - Controlled down-speed: from hot (from warm in lowpower mode, then
+       only links below lowPps), 2.5G is removed from the advertisement.
+       Ports with link down change at once (no link flap), 2.5G links one
+       per step ms, the least loaded first. The advertisement is restored
+       the same way once back to normal. At crit all ports are capped at
+       once, as the last step before emergency throttling.
+   EEE stays with ppmd (ethtool, pm_policy.json), the agent does not
+   touch it.
+
+   IPC with ppmd:
+     - The state is written to state every period (JSON, replaced
+       atomically), and sent as ubus event "gpy2xx.power" on each tier or
+       port change if ubus=1.
+     - The mode is read from policy every period: performance, balance or
+       lowpower (ppmd_profile_helper.sh gphy_agent <mode>).
+   On exit the advertisement and ULP of all ports are restored.
+
+   gpy2xx_power [xgmacMask=<mask>] [addrMask=<mask>] [smdioAddr=<n>]
+                [period=<ms>] [warm=<C>] [hot=<C>] [crit=<C>] [hyst=<C>]
+                [idle=<ms>] [lowPps=<n>] [step=<ms>] [state=<file>]
+                [policy=<file>] [ubus=0|1] [count=<n>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+
+#include "gpy2xx_mgr.h"
+
+/* Link modes removed by the down-speed */
+#define POWER_CAP_MODES (GPY2XX_ADVERTISED_2500baseT_Full | GPY2XX_ADVERTISED_2500baseT_FR)
+/* Max length of the JSON state */
+#define POWER_JSON_MAX 8192
+
+enum power_tier {
+	POWER_NORMAL = 0,
+	POWER_WARM,
+	POWER_HOT,
+	POWER_CRIT,
+	POWER_TIER_NUM,
+};
+
+enum power_mode {
+	POWER_PERFORMANCE = 0,
+	POWER_BALANCE,
+	POWER_LOWPOWER,
+	POWER_MODE_NUM,
+};
+
+struct power_cfg {
+	u32 xgmac_mask;
+	u32 addr_mask;
+	u32 smdio_addr;
+	u32 period_ms;
+	int temp[POWER_TIER_NUM];
+	int hyst;
+	u32 idle_ms;
+	u32 low_pps;
+	u32 step_ms;
+	const char *state;
+	const char *policy;
+	u32 ubus;
+	u32 count;
+};
+
+/* Agent state of one port */
+struct power_port {
+	struct gpy2xx_mgr_phy *p;
+	struct gmacf_count_acc acc;
+	/* acc is usable */
+	int acc_ok;
+	u64 pkts;
+	/* Packets per second, UINT_MAX if unknown */
+	u32 pps;
+	int link;
+	int speed;
+	/* Time with link down in ms */
+	u32 down_ms;
+	/* Advertisement at start */
+	u64 adv;
+	/* 2.5G removed from the advertisement */
+	int capped;
+	/* ULP enabled by the agent */
+	int ulp;
+};
+
+struct power {
+	const struct power_cfg *cfg;
+	struct gpy2xx_mgr *mgr;
+	struct power_port *port;
+	u32 nr_port;
+	/* Temperature per chip */
+	int *temp;
+	int temp_max;
+	enum power_tier tier;
+	enum power_mode mode;
+	/* Time since the last controlled speed change in ms */
+	u32 step_ms;
+	/* Tier or port state changed in this period */
+	int changed;
+	u32 seq;
+};
+
+static const char *const power_tier_name[POWER_TIER_NUM] = {
+	"normal", "warm", "hot", "crit",
+};
+
+static const char *const power_mode_name[POWER_MODE_NUM] = {
+	"performance", "balance", "lowpower",
+};
+
+static volatile sig_atomic_t power_stop;
+
+static void power_sig(int sig)
+{
+	(void)sig;
+	power_stop = 1;
+}
+
+static void power_read_mode(struct power *pw)
+{
+	char buf[32];
+	FILE *f;
+	int m;
+
+	f = fopen(pw->cfg->policy, "r");
+
+	if (f == NULL)
+		return;
+
+	if (fgets(buf, sizeof(buf), f) != NULL) {
+		buf[strcspn(buf, " \t\r\n")] = 0;
+
+		for (m = 0; m < POWER_MODE_NUM; m++) {
+			if (strcmp(buf, power_mode_name[m]) == 0 && pw->mode != (enum power_mode)m) {
+				pw->mode = (enum power_mode)m;
+				pw->changed = 1;
+			}
+		}
+	}
+
+	fclose(f);
+}
+
+/* Sample temperature, link and packet rate */
+static void power_sample(struct power *pw)
+{
+	struct gpy211_pvt pvt;
+	u32 i, c;
+
+	for (c = 0; c < pw->mgr->nr_chip; c++)
+		pw->temp[c] = INT_MIN;
+
+	pw->temp_max = INT_MIN;
+
+	for (i = 0; i < pw->nr_port; i++) {
+		struct power_port *pt = &pw->port[i];
+		u64 pkts;
+
+		/* One PVT read per chip */
+		c = pt->p->chip;
+
+		if (pw->temp[c] == INT_MIN && gpy2xx_pvt_get(&pt->p->dev, &pvt) == 0) {
+			pw->temp[c] = pvt.temperature;
+
+			if (pvt.temperature > pw->temp_max)
+				pw->temp_max = pvt.temperature;
+		}
+
+		if (gpy2xx_read_status(&pt->p->dev) < 0)
+			continue;
+
+		if (pt->link != pt->p->dev.link.link || pt->speed != pt->p->dev.link.speed)
+			pw->changed = 1;
+
+		pt->link = pt->p->dev.link.link;
+		pt->speed = pt->p->dev.link.speed;
+		pt->down_ms = pt->link ? 0 : pt->down_ms + pw->cfg->period_ms;
+		pt->pps = UINT_MAX;
+
+		if (!pt->acc_ok || gpy2xx_gmacf_count_acc_update(&pt->p->dev, &pt->acc) < 0)
+			continue;
+
+		pkts = pt->acc.total.tx_good_bad + pt->acc.total.rx_good_bad;
+		pt->pps = (u32)((pkts - pt->pkts) * 1000 / pw->cfg->period_ms);
+		pt->pkts = pkts;
+	}
+}
+
+static void power_tier(struct power *pw)
+{
+	enum power_tier tier = pw->tier;
+	const int *temp = pw->cfg->temp;
+
+	if (pw->temp_max == INT_MIN)
+		return;
+
+	/* Up at once, down one tier below its entry minus hysteresis */
+	while (tier + 1 < POWER_TIER_NUM && pw->temp_max >= temp[tier + 1])
+		tier++;
+
+	while (tier > POWER_NORMAL && pw->temp_max < temp[tier] - pw->cfg->hyst)
+		tier--;
+
+	if (tier != pw->tier) {
+		printf("tier %s -> %s at %d C\n", power_tier_name[pw->tier],
+		       power_tier_name[tier], pw->temp_max);
+		pw->tier = tier;
+		pw->changed = 1;
+	}
+}
+
+static int power_adv(struct power_port *pt, int cap)
+{
+	struct gpy211_device *dev = &pt->p->dev;
+	int ret;
+
+	dev->link.advertising = cap ? pt->adv & ~(u64)POWER_CAP_MODES : pt->adv;
+	ret = gpy2xx_config_advert(dev);
+
+	if (ret > 0)
+		ret = gpy2xx_restart_aneg(dev);
+
+	if (ret < 0) {
+		printf("WARN: addr %u advertisement failed (%d)\n", dev->phy_addr, ret);
+		return ret;
+	}
+
+	pt->capped = cap;
+
+	return 0;
+}
+
+/* Link up port to change next: the least loaded */
+static struct power_port *power_pick(struct power *pw, int capped, u32 max_pps)
+{
+	struct power_port *best = NULL;
+	u32 i;
+
+	for (i = 0; i < pw->nr_port; i++) {
+		struct power_port *pt = &pw->port[i];
+
+		if (!pt->link || pt->capped != capped || pt->pps > max_pps)
+			continue;
+
+		/* Capping gains only on links at 2.5G */
+		if (!capped && pt->speed != SPEED_2500)
+			continue;
+
+		if (best == NULL || pt->pps < best->pps)
+			best = pt;
+	}
+
+	return best;
+}
+
+static void power_speed(struct power *pw)
+{
+	struct power_port *pt;
+	int cap;
+	u32 i, max_pps = UINT_MAX;
+
+	pw->step_ms += pw->cfg->period_ms;
+
+	if (pw->tier == POWER_HOT || pw->tier == POWER_CRIT) {
+		cap = 1;
+	} else if (pw->tier == POWER_WARM && pw->mode == POWER_LOWPOWER) {
+		cap = 1;
+		max_pps = pw->cfg->low_pps;
+	} else if (pw->tier == POWER_NORMAL) {
+		cap = 0;
+	} else {
+		return;
+	}
+
+	/* Links down change without a flap, all at once; at crit all ports */
+	for (i = 0; i < pw->nr_port; i++) {
+		pt = &pw->port[i];
+
+		if (pt->capped == cap || !(pt->adv & POWER_CAP_MODES) ||
+		    (pt->link && pw->tier != POWER_CRIT))
+			continue;
+
+		if (power_adv(pt, cap) == 0)
+			pw->changed = 1;
+	}
+
+	/* Links up one per step */
+	if (pw->step_ms < pw->cfg->step_ms)
+		return;
+
+	pt = power_pick(pw, !cap, max_pps);
+
+	if (pt == NULL || !(pt->adv & POWER_CAP_MODES) || power_adv(pt, cap) < 0)
+		return;
+
+	printf("addr %u: 2.5G %s (%u pps)\n", pt->p->dev.phy_addr, cap ? "off" : "on",
+	       pt->pps);
+	pw->step_ms = 0;
+	pw->changed = 1;
+}
+
+static void power_ulp(struct power *pw)
+{
+	struct gpy211_ulp_ctrl ulp;
+	u32 i;
+	int on;
+
+	for (i = 0; i < pw->nr_port; i++) {
+		struct power_port *pt = &pw->port[i];
+
+		on = pw->mode != POWER_PERFORMANCE && !pt->link && pt->down_ms >= pw->cfg->idle_ms;
+
+		/* Left on at link up, ULP is only entered without link */
+		if (on == pt->ulp || (!on && pw->mode != POWER_PERFORMANCE))
+			continue;
+
+		if (gpy2xx_ulp_get(&pt->p->dev, &ulp) < 0)
+			continue;
+
+		ulp.ulp_en = (u8)on;
+
+		if (gpy2xx_ulp_cfg(&pt->p->dev, &ulp) < 0)
+			continue;
+
+		pt->ulp = on;
+		pw->changed = 1;
+	}
+}
+
+static int power_json(struct power *pw, char *buf, size_t size)
+{
+	int n;
+	u32 i, c, capped = 0, ulp = 0;
+
+	for (i = 0; i < pw->nr_port; i++) {
+		capped += pw->port[i].capped;
+		ulp += pw->port[i].ulp;
+	}
+
+	n = snprintf(buf, size, "{\"seq\":%u,\"mode\":\"%s\",\"tier\":\"%s\",\"temp_max\":%d,"
+		     "\"capped\":%u,\"ulp\":%u,\"temp\":[", pw->seq, power_mode_name[pw->mode],
+		     power_tier_name[pw->tier], pw->temp_max, capped, ulp);
+
+	for (c = 0; c < pw->mgr->nr_chip && n < (int)size; c++) {
+		if (pw->temp[c] == INT_MIN)
+			n += snprintf(buf + n, size - n, "%snull", c ? "," : "");
+		else
+			n += snprintf(buf + n, size - n, "%s%d", c ? "," : "", pw->temp[c]);
+	}
+
+	if (n < (int)size)
+		n += snprintf(buf + n, size - n, "],\"ports\":[");
+
+	for (i = 0; i < pw->nr_port && n < (int)size; i++) {
+		const struct power_port *pt = &pw->port[i];
+
+		n += snprintf(buf + n, size - n, "%s{\"xgmac\":%d,\"addr\":%u,\"link\":%d,"
+			      "\"speed\":%d,\"pps\":%lld,\"capped\":%d,\"ulp\":%d}",
+			      i ? "," : "", pw->mgr->bus[pt->p->bus].cfg.xgmac_id,
+			      pt->p->dev.phy_addr, pt->link, pt->speed,
+			      pt->pps == UINT_MAX ? -1LL : (long long)pt->pps, pt->capped, pt->ulp);
+	}
+
+	if (n < (int)size)
+		n += snprintf(buf + n, size - n, "]}\n");
+
+	return n < (int)size ? n : -ENOSPC;
+}
+
+static void power_report(struct power *pw)
+{
+	static char buf[POWER_JSON_MAX];
+	char tmp[PATH_MAX];
+	pid_t pid;
+	FILE *f;
+	int n;
+
+	pw->seq++;
+	n = power_json(pw, buf, sizeof(buf));
+
+	if (n < 0)
+		return;
+
+	snprintf(tmp, sizeof(tmp), "%s.tmp", pw->cfg->state);
+	f = fopen(tmp, "w");
+
+	if (f != NULL) {
+		fputs(buf, f);
+
+		if (fclose(f) == 0)
+			rename(tmp, pw->cfg->state);
+	}
+
+	if (!pw->changed || !pw->cfg->ubus)
+		return;
+
+	/* Event to ppmd, not waited for */
+	buf[n - 1] = 0;
+	pid = fork();
+
+	if (pid == 0) {
+		execlp("ubus", "ubus", "send", "gpy2xx.power", buf, (char *)NULL);
+		_exit(127);
+	}
+}
+
+static void power_restore(struct power *pw)
+{
+	struct gpy211_ulp_ctrl ulp;
+	u32 i;
+
+	for (i = 0; i < pw->nr_port; i++) {
+		struct power_port *pt = &pw->port[i];
+
+		if (pt->capped)
+			power_adv(pt, 0);
+
+		if (pt->ulp && gpy2xx_ulp_get(&pt->p->dev, &ulp) == 0) {
+			ulp.ulp_en = 0;
+			gpy2xx_ulp_cfg(&pt->p->dev, &ulp);
+			pt->ulp = 0;
+		}
+	}
+}
+
+static int power_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int power_parse(int argc, char *argv[], struct power_cfg *cfg)
+{
+	int i;
+	const char *v;
+
+	for (i = 1; i < argc; i++) {
+		if (power_arg(argv[i], "xgmacMask", &v))
+			cfg->xgmac_mask = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "addrMask", &v))
+			cfg->addr_mask = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "smdioAddr", &v))
+			cfg->smdio_addr = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "period", &v))
+			cfg->period_ms = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "warm", &v))
+			cfg->temp[POWER_WARM] = (int)strtol(v, NULL, 0);
+		else if (power_arg(argv[i], "hot", &v))
+			cfg->temp[POWER_HOT] = (int)strtol(v, NULL, 0);
+		else if (power_arg(argv[i], "crit", &v))
+			cfg->temp[POWER_CRIT] = (int)strtol(v, NULL, 0);
+		else if (power_arg(argv[i], "hyst", &v))
+			cfg->hyst = (int)strtol(v, NULL, 0);
+		else if (power_arg(argv[i], "idle", &v))
+			cfg->idle_ms = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "lowPps", &v))
+			cfg->low_pps = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "step", &v))
+			cfg->step_ms = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "state", &v))
+			cfg->state = v;
+		else if (power_arg(argv[i], "policy", &v))
+			cfg->policy = v;
+		else if (power_arg(argv[i], "ubus", &v))
+			cfg->ubus = (u32)strtoul(v, NULL, 0);
+		else if (power_arg(argv[i], "count", &v))
+			cfg->count = (u32)strtoul(v, NULL, 0);
+		else
+			return -1;
+	}
+
+	if (cfg->xgmac_mask == 0 || cfg->addr_mask == 0 || cfg->period_ms == 0 ||
+	    cfg->hyst < 0 || cfg->temp[POWER_WARM] > cfg->temp[POWER_HOT] ||
+	    cfg->temp[POWER_HOT] > cfg->temp[POWER_CRIT])
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct gpy2xx_mgr mgr;
+	static struct power pw;
+	struct gpy2xx_mgr_bus_cfg bus[GPY2XX_MGR_MAX_BUSES];
+	u32 i, nr_bus = 0, rounds = 0;
+	int ret, fd;
+	char dir[PATH_MAX];
+	const char *gsw_dev = "/dev/switch_api/0";
+	struct power_cfg cfg = {
+		.xgmac_mask = 1u << 2,
+		.addr_mask = 0xFFFFFFFF,
+		.period_ms = 1000,
+		.temp = {
+			[POWER_NORMAL] = INT_MIN,
+			[POWER_WARM] = 95,
+			[POWER_HOT] = 105,
+			[POWER_CRIT] = 115,
+		},
+		.hyst = 5,
+		.idle_ms = 30000,
+		.low_pps = 1000,
+		.step_ms = 10000,
+		.state = "/tmp/ppmd/gpy2xx_power.json",
+		.policy = "/tmp/ppmd/gpy2xx_power.policy",
+	};
+
+	if (power_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s [xgmacMask=<mask>] [addrMask=<mask>] [smdioAddr=<n>]\n"
+		       "\t[period=<ms>] [warm=<C>] [hot=<C>] [crit=<C>] [hyst=<C>]\n"
+		       "\t[idle=<ms>] [lowPps=<n>] [step=<ms>] [state=<file>]\n"
+		       "\t[policy=<file>] [ubus=0|1] [count=<n>]\n", argv[0]);
+		return -1;
+	}
+
+	fd = open(gsw_dev, O_RDONLY);
+
+	if (fd < 0) {
+		printf("ERROR: Could not open switch dev node \"%s\"\n", gsw_dev);
+		return -1;
+	}
+
+	for (i = 0; i < 32 && nr_bus < GPY2XX_MGR_MAX_BUSES; i++) {
+		if (!(cfg.xgmac_mask & (1u << i)))
+			continue;
+
+		bus[nr_bus].xgmac_id = i;
+		bus[nr_bus].addr_mask = cfg.addr_mask;
+		bus[nr_bus].smdio_addr = cfg.smdio_addr;
+		bus[nr_bus].ptp_clock = 0x1836E210; //406.25MHz
+		nr_bus++;
+	}
+
+	ret = gpy2xx_mgr_open(&mgr, fd, bus, nr_bus);
+
+	if (ret >= 0)
+		ret = gpy2xx_mgr_init(&mgr);
+
+	if (ret <= 0) {
+		printf("ERROR: No PHY found (%d)\n", ret);
+		ret = -1;
+		goto end;
+	}
+
+	pw.cfg = &cfg;
+	pw.mgr = &mgr;
+	pw.mode = POWER_BALANCE;
+	pw.step_ms = cfg.step_ms;
+	pw.port = calloc(mgr.nr_phy, sizeof(*pw.port));
+	pw.temp = calloc(mgr.nr_chip, sizeof(*pw.temp));
+
+	if (pw.port == NULL || pw.temp == NULL) {
+		ret = -1;
+		goto end;
+	}
+
+	for (i = 0; i < mgr.nr_phy; i++) {
+		struct power_port *pt = &pw.port[pw.nr_port];
+
+		if (mgr.phy[i].ret < 0)
+			continue;
+
+		pt->p = &mgr.phy[i];
+		pt->adv = pt->p->dev.link.advertising;
+		gpy2xx_read_status(&pt->p->dev);
+		pt->acc_ok = gpy2xx_gmacf_count_acc_init(&pt->p->dev, &pt->acc) == 0;
+		pw.nr_port++;
+	}
+
+	/* The state directory is shared with ppmd, may not exist yet */
+	snprintf(dir, sizeof(dir), "%s", cfg.state);
+
+	if (strrchr(dir, '/') != NULL && strrchr(dir, '/') != dir) {
+		*strrchr(dir, '/') = 0;
+		mkdir(dir, 0755);
+	}
+
+	signal(SIGINT, power_sig);
+	signal(SIGTERM, power_sig);
+	/* No zombies from the ubus events */
+	signal(SIGCHLD, SIG_IGN);
+
+	while (!power_stop && (cfg.count == 0 || rounds < cfg.count)) {
+		pw.changed = 0;
+		power_read_mode(&pw);
+		power_sample(&pw);
+		power_tier(&pw);
+		power_speed(&pw);
+		power_ulp(&pw);
+		power_report(&pw);
+		rounds++;
+
+		usleep(cfg.period_ms * 1000);
+	}
+
+	power_restore(&pw);
+	ret = 0;
+
+end:
+	free(pw.port);
+	free(pw.temp);
+	gpy2xx_mgr_close(&mgr);
+	close(fd);
+
+	return ret;
+}
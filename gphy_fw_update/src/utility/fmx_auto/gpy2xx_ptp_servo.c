@@ -0,0 +1,566 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Disciplines the PHY clock (PHC) to a reference with a PI servo.
+
+   ref=sys  PHC follows CLOCK_REALTIME (+ utc_offset), measured with
+            gpy2xx_ptp_getcrosststamp. The path delay is the width of the
+            tightest system clock bracket around the PHC read.
+   ref=pps  PHC follows an external 1PPS captured on the auxiliary snapshot
+            input, collected with gpy2xx_ptp_drain_auxts. The PHC is set
+            from CLOCK_REALTIME (+ utc_offset) once at start, the servo only
+            aligns the second boundary.
+
+   MDIO use is bounded: frequency is written only when it moves by at least
+   freq_db ppb, the clock is stepped only above step ns and at most once per
+   step_gap seconds, otherwise the correction is slewed within max_ppb.
+
+   gpy2xx_ptp_servo phyId=<n> [ref=sys|pps] [interval=<ms>] [samples=<n>]
+                    [kp=<f>] [ki=<f>] [step=<ns>] [step_gap=<s>]
+                    [max_ppb=<n>] [freq_db=<ppb>] [utc_offset=<s>] [pin=<n>]
+                    [report=<s>] [stats=<file>] [count=<n>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <math.h>
+#include <time.h>
+
+#include "gpy2xx_mdio.h"
+
+#define SERVO_NSEC_PER_SEC 1000000000LL
+/* Limit of gpy2xx_ptp_adjtime, larger offsets are set */
+#define SERVO_MAX_ADJTIME 86399999999999LL
+
+enum servo_ref {
+	SERVO_REF_SYS = 0,
+	SERVO_REF_PPS = 1,
+};
+
+enum servo_state {
+	SERVO_UNLOCKED = 0,
+	SERVO_DRIFT = 1,
+	SERVO_LOCKED = 2,
+};
+
+struct servo_cfg {
+	int phy_id;
+	enum servo_ref ref;
+	u32 interval_ms;
+	u32 samples;
+	double kp;
+	double ki;
+	s64 step_ns;
+	u32 step_gap_s;
+	s32 max_ppb;
+	s32 freq_db;
+	s32 utc_offset;
+	u16 pin;
+	u32 report_s;
+	const char *stats;
+	u32 count;
+};
+
+struct servo_pi {
+	enum servo_state state;
+	s64 offset0;
+	s64 t0;
+	s64 t_last;
+	double drift;
+	/* Frequency written to the PHY, in adjfreq sign */
+	s32 freq;
+	s64 last_step;
+};
+
+/* Statistics of one report period */
+struct servo_stats {
+	u32 n;
+	double off_sq;
+	s64 off_max;
+	double freq_sum;
+	u32 n_delay;
+	double delay_sum;
+	s64 delay_max;
+	u32 steps;
+	u32 freq_writes;
+	u32 lost;
+};
+
+static struct gpy211_device phy;
+static struct gpy2xx_mdio mdio;
+static volatile sig_atomic_t servo_stop;
+static struct gpy211_ptp_ts_ring servo_ring;
+
+static void servo_sig(int sig)
+{
+	(void)sig;
+	servo_stop = 1;
+}
+
+static s64 servo_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (s64)ts.tv_sec * SERVO_NSEC_PER_SEC + ts.tv_nsec;
+}
+
+/* Set the PHC to CLOCK_REALTIME + utc_offset */
+static int servo_set_phc(const struct servo_cfg *cfg)
+{
+	struct timespec rt;
+	struct timespec64 ts;
+
+	clock_gettime(CLOCK_REALTIME, &rt);
+	ts.tv_sec = rt.tv_sec + cfg->utc_offset;
+	ts.tv_nsec = rt.tv_nsec;
+
+	return gpy2xx_ptp_settime(&phy, &ts);
+}
+
+/* Remove offset from the PHC, rate-limited by step_gap.
+   Returns 1 if stepped, 0 if the gap has not elapsed yet */
+static int servo_step(const struct servo_cfg *cfg, struct servo_pi *pi,
+		      s64 offset, s64 now)
+{
+	int ret;
+
+	if (pi->last_step &&
+	    now - pi->last_step < (s64)cfg->step_gap_s * SERVO_NSEC_PER_SEC)
+		return 0;
+
+	if (llabs(offset) > SERVO_MAX_ADJTIME)
+		ret = servo_set_phc(cfg);
+	else
+		ret = gpy2xx_ptp_adjtime(&phy, -offset);
+
+	if (ret < 0)
+		return ret;
+
+	pi->last_step = now;
+	return 1;
+}
+
+static int servo_set_freq(const struct servo_cfg *cfg, struct servo_pi *pi,
+			  struct servo_stats *st, double ppb)
+{
+	int ret;
+	s32 freq;
+
+	if (ppb > cfg->max_ppb)
+		ppb = cfg->max_ppb;
+	else if (ppb < -cfg->max_ppb)
+		ppb = -cfg->max_ppb;
+
+	/* PI output is the PHC error, the PHY is adjusted against it */
+	freq = (s32)lround(-ppb);
+
+	if (abs(freq - pi->freq) < cfg->freq_db)
+		return 0;
+
+	ret = gpy2xx_ptp_adjfreq(&phy, freq);
+
+	if (ret < 0)
+		return ret;
+
+	pi->freq = freq;
+	st->freq_writes++;
+	return 0;
+}
+
+/* One PI servo update with offset = PHC - reference at time t (ns).
+   Returns 1 if the PHC was stepped */
+static int servo_sample(const struct servo_cfg *cfg, struct servo_pi *pi,
+			struct servo_stats *st, s64 offset, s64 t)
+{
+	int ret = 0;
+	double dt, ki_term, ppb;
+
+	switch (pi->state) {
+	case SERVO_UNLOCKED:
+		pi->offset0 = offset;
+		pi->t0 = t;
+		pi->state = SERVO_DRIFT;
+		break;
+
+	case SERVO_DRIFT:
+		if (t <= pi->t0)
+			break;
+
+		/* Frequency error (ppb) from the first two samples */
+		pi->drift += (double)(offset - pi->offset0) * 1e9 / (double)(t - pi->t0);
+
+		if (pi->drift > cfg->max_ppb)
+			pi->drift = cfg->max_ppb;
+		else if (pi->drift < -cfg->max_ppb)
+			pi->drift = -cfg->max_ppb;
+
+		ret = servo_set_freq(cfg, pi, st, pi->drift);
+
+		if (ret < 0)
+			return ret;
+
+		if (llabs(offset) > cfg->step_ns) {
+			ret = servo_step(cfg, pi, offset, servo_now());
+
+			if (ret < 0)
+				return ret;
+
+			st->steps += ret;
+		}
+
+		pi->state = SERVO_LOCKED;
+		break;
+
+	case SERVO_LOCKED:
+		if (llabs(offset) > cfg->step_ns) {
+			ret = servo_step(cfg, pi, offset, servo_now());
+
+			if (ret < 0)
+				return ret;
+
+			if (ret) {
+				st->steps++;
+				break;
+			}
+		}
+
+		dt = (double)(t - pi->t_last) / 1e9;
+
+		if (dt <= 0 || dt > 60)
+			dt = cfg->interval_ms / 1000.0;
+
+		ki_term = cfg->ki * dt * offset;
+		ppb = cfg->kp * offset + pi->drift + ki_term;
+
+		/* Integrate only while not saturated */
+		if (ppb < cfg->max_ppb && ppb > -cfg->max_ppb)
+			pi->drift += ki_term;
+
+		ret = servo_set_freq(cfg, pi, st, ppb);
+
+		if (ret < 0)
+			return ret;
+
+		break;
+	}
+
+	pi->t_last = t;
+
+	st->n++;
+	st->off_sq += (double)offset * offset;
+
+	if (llabs(offset) > st->off_max)
+		st->off_max = llabs(offset);
+
+	st->freq_sum += pi->freq;
+
+	return ret;
+}
+
+static void servo_report(const struct servo_cfg *cfg, const struct servo_pi *pi,
+			 const struct servo_stats *st)
+{
+	FILE *fp;
+	char tmp[256];
+	double rms = st->n ? sqrt(st->off_sq / st->n) : 0;
+	double freq = st->n ? st->freq_sum / st->n : pi->freq;
+	double delay = st->n_delay ? st->delay_sum / st->n_delay : 0;
+
+	printf("state %u samples %u offset rms %.0f max %lld ns freq %+.0f ppb "
+	       "delay %.0f max %lld ns steps %u writes %u lost %u\n",
+	       pi->state, st->n, rms, (long long)st->off_max, freq, delay,
+	       (long long)st->delay_max, st->steps, st->freq_writes, st->lost);
+	fflush(stdout);
+
+	if (cfg->stats == NULL)
+		return;
+
+	/* Readers never see a partial file */
+	snprintf(tmp, sizeof(tmp), "%s.tmp", cfg->stats);
+	fp = fopen(tmp, "w");
+
+	if (fp == NULL)
+		return;
+
+	fprintf(fp, "state %u\n", pi->state);
+	fprintf(fp, "samples %u\n", st->n);
+	fprintf(fp, "offset_rms_ns %.0f\n", rms);
+	fprintf(fp, "offset_max_ns %lld\n", (long long)st->off_max);
+	fprintf(fp, "freq_ppb %.0f\n", freq);
+	fprintf(fp, "delay_ns %.0f\n", delay);
+	fprintf(fp, "delay_max_ns %lld\n", (long long)st->delay_max);
+	fprintf(fp, "steps %u\n", st->steps);
+	fprintf(fp, "freq_writes %u\n", st->freq_writes);
+	fprintf(fp, "lost %u\n", st->lost);
+	fclose(fp);
+	rename(tmp, cfg->stats);
+}
+
+/* PHC against system time. Returns number of samples taken */
+static int servo_poll_sys(const struct servo_cfg *cfg, struct servo_pi *pi,
+			  struct servo_stats *st)
+{
+	int ret;
+	s64 offset, t;
+	struct gpy211_ptp_xts xts;
+
+	memset(&xts, 0, sizeof(xts));
+	xts.n_samples = cfg->samples;
+	xts.clk = GPY211_PTP_SYSCLK_REALTIME;
+
+	ret = gpy2xx_ptp_getcrosststamp(&phy, &xts);
+
+	if (ret < 0)
+		return ret;
+
+	offset = xts.offset - (s64)cfg->utc_offset * SERVO_NSEC_PER_SEC;
+	t = (s64)xts.sample[xts.best].pre.tv_sec * SERVO_NSEC_PER_SEC +
+	    xts.sample[xts.best].pre.tv_nsec + xts.delay / 2;
+
+	st->n_delay++;
+	st->delay_sum += xts.delay;
+
+	if (xts.delay > st->delay_max)
+		st->delay_max = xts.delay;
+
+	ret = servo_sample(cfg, pi, st, offset, t);
+
+	return ret < 0 ? ret : 1;
+}
+
+/* PHC against 1PPS snapshots. Returns number of samples taken */
+static int servo_poll_pps(const struct servo_cfg *cfg, struct servo_pi *pi,
+			  struct servo_stats *st)
+{
+	int ret, n = 0;
+	u32 lost;
+	s64 offset;
+	struct gpy211_ptp_ts_ent ent;
+
+	lost = servo_ring.drops + servo_ring.aux_ovfl;
+	ret = gpy2xx_ptp_drain_auxts(&phy, &servo_ring);
+
+	if (ret < 0)
+		return ret;
+
+	st->lost += servo_ring.drops + servo_ring.aux_ovfl - lost;
+
+	while (gpy2xx_ptp_ts_ring_pop(&servo_ring, &ent, 1) == 1) {
+		offset = (s64)(ent.ts % SERVO_NSEC_PER_SEC);
+
+		if (offset >= SERVO_NSEC_PER_SEC / 2)
+			offset -= SERVO_NSEC_PER_SEC;
+
+		ret = servo_sample(cfg, pi, st, offset, (s64)ent.ts);
+
+		if (ret < 0)
+			return ret;
+
+		n++;
+
+		if (ret) {
+			/* Pulses captured before the step are stale */
+			while (gpy2xx_ptp_ts_ring_pop(&servo_ring, &ent, 1) == 1)
+				;
+
+			break;
+		}
+	}
+
+	return n;
+}
+
+static int servo_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int servo_parse(int argc, char *argv[], struct servo_cfg *cfg)
+{
+	int i;
+	const char *v;
+
+	for (i = 1; i < argc; i++) {
+		if (servo_arg(argv[i], "phyId", &v)) {
+			cfg->phy_id = (int)strtol(v, NULL, 0);
+		} else if (servo_arg(argv[i], "ref", &v)) {
+			if (strcmp(v, "sys") == 0)
+				cfg->ref = SERVO_REF_SYS;
+			else if (strcmp(v, "pps") == 0)
+				cfg->ref = SERVO_REF_PPS;
+			else
+				return -1;
+		} else if (servo_arg(argv[i], "interval", &v)) {
+			cfg->interval_ms = (u32)strtoul(v, NULL, 0);
+		} else if (servo_arg(argv[i], "samples", &v)) {
+			cfg->samples = (u32)strtoul(v, NULL, 0);
+		} else if (servo_arg(argv[i], "kp", &v)) {
+			cfg->kp = strtod(v, NULL);
+		} else if (servo_arg(argv[i], "ki", &v)) {
+			cfg->ki = strtod(v, NULL);
+		} else if (servo_arg(argv[i], "step", &v)) {
+			cfg->step_ns = strtoll(v, NULL, 0);
+		} else if (servo_arg(argv[i], "step_gap", &v)) {
+			cfg->step_gap_s = (u32)strtoul(v, NULL, 0);
+		} else if (servo_arg(argv[i], "max_ppb", &v)) {
+			cfg->max_ppb = (s32)strtol(v, NULL, 0);
+		} else if (servo_arg(argv[i], "freq_db", &v)) {
+			cfg->freq_db = (s32)strtol(v, NULL, 0);
+		} else if (servo_arg(argv[i], "utc_offset", &v)) {
+			cfg->utc_offset = (s32)strtol(v, NULL, 0);
+		} else if (servo_arg(argv[i], "pin", &v)) {
+			cfg->pin = (u16)strtoul(v, NULL, 0);
+		} else if (servo_arg(argv[i], "report", &v)) {
+			cfg->report_s = (u32)strtoul(v, NULL, 0);
+		} else if (servo_arg(argv[i], "stats", &v)) {
+			cfg->stats = v;
+		} else if (servo_arg(argv[i], "count", &v)) {
+			cfg->count = (u32)strtoul(v, NULL, 0);
+		} else {
+			return -1;
+		}
+	}
+
+	if (cfg->phy_id < 0 || cfg->interval_ms == 0 || cfg->samples == 0 ||
+	    cfg->samples > GPY211_PTP_XTS_MAX_SAMPLES || cfg->kp < 0 || cfg->ki < 0 ||
+	    cfg->step_ns <= 0 || cfg->max_ppb <= 0 || cfg->max_ppb > 1000000000 ||
+	    cfg->freq_db < 1 || cfg->pin > 3 || cfg->report_s == 0)
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int ret;
+	u32 taken = 0;
+	s64 next_report;
+	struct timespec next;
+	struct servo_pi pi;
+	struct servo_stats st;
+	struct gpy211_aux_cfg aux;
+	struct servo_cfg cfg = {
+		.phy_id = -1,
+		.ref = SERVO_REF_SYS,
+		.interval_ms = 1000,
+		.samples = 5,
+		.kp = 0.7,
+		.ki = 0.3,
+		.step_ns = 20000,
+		.step_gap_s = 10,
+		.max_ppb = 500000,
+		.freq_db = 1,
+		.utc_offset = 0,
+		.pin = 1,
+		.report_s = 10,
+	};
+
+	if (servo_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s phyId=<n> [ref=sys|pps] [interval=<ms>] [samples=<1~%u>]\n"
+		       "\t[kp=<f>] [ki=<f>] [step=<ns>] [step_gap=<s>] [max_ppb=<n>]\n"
+		       "\t[freq_db=<ppb>] [utc_offset=<s>] [pin=<0~3>] [report=<s>]\n"
+		       "\t[stats=<file>] [count=<n>]\n",
+		       argv[0], GPY211_PTP_XTS_MAX_SAMPLES);
+		return -1;
+	}
+
+	ret = gpy2xx_mdio_phy_init(&phy, &mdio, cfg.phy_id);
+
+	if (ret < 0)
+		goto end;
+
+	memset(&pi, 0, sizeof(pi));
+	memset(&st, 0, sizeof(st));
+
+	/* Start from the nominal frequency */
+	ret = gpy2xx_ptp_adjfreq(&phy, 0);
+
+	if (ret < 0)
+		goto end;
+
+	if (cfg.ref == SERVO_REF_PPS) {
+		ret = servo_set_phc(&cfg);
+
+		if (ret < 0)
+			goto end;
+
+		gpy2xx_ptp_ts_ring_init(&servo_ring);
+		aux.aux_enable = 1;
+		aux.aux_trigger_port = cfg.pin;
+		ret = gpy2xx_ptp_aux_cfg(&phy, &aux);
+
+		if (ret < 0) {
+			printf("ERROR: Auxiliary snapshot not supported (%d)\n", ret);
+			goto end;
+		}
+
+		/* Drop snapshots taken before the PHC was set */
+		ret = gpy2xx_ptp_drain_auxts(&phy, &servo_ring);
+
+		if (ret < 0)
+			goto end;
+
+		gpy2xx_ptp_ts_ring_init(&servo_ring);
+	}
+
+	signal(SIGINT, servo_sig);
+	signal(SIGTERM, servo_sig);
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	next_report = servo_now() + (s64)cfg.report_s * SERVO_NSEC_PER_SEC;
+
+	while (!servo_stop) {
+		if (cfg.ref == SERVO_REF_SYS)
+			ret = servo_poll_sys(&cfg, &pi, &st);
+		else
+			ret = servo_poll_pps(&cfg, &pi, &st);
+
+		if (ret < 0) {
+			printf("ERROR: Servo update failed (%d)\n", ret);
+			break;
+		}
+
+		taken += ret;
+
+		if (servo_now() >= next_report) {
+			servo_report(&cfg, &pi, &st);
+			memset(&st, 0, sizeof(st));
+			next_report += (s64)cfg.report_s * SERVO_NSEC_PER_SEC;
+		}
+
+		if (cfg.count && taken >= cfg.count)
+			break;
+
+		next.tv_nsec += (long)(cfg.interval_ms % 1000) * 1000000;
+		next.tv_sec += cfg.interval_ms / 1000 + next.tv_nsec / SERVO_NSEC_PER_SEC;
+		next.tv_nsec %= SERVO_NSEC_PER_SEC;
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+	}
+
+	servo_report(&cfg, &pi, &st);
+
+	if (cfg.ref == SERVO_REF_PPS) {
+		aux.aux_enable = 0;
+		gpy2xx_ptp_aux_cfg(&phy, &aux);
+	}
+
+end:
+	if (mdio.fd >= 0)
+		close(mdio.fd);
+
+	return ret < 0 ? ret : 0;
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <strings.h>
+#include <errno.h>
+
+#include "gpy2xx_regmap.h"
+
+static const struct gpy2xx_regmap_reg *regmap_first(enum gpy2xx_regmap_space space)
+{
+	const struct gpy2xx_regmap_reg *tab = gpy2xx_regmap_reg;
+	unsigned int i;
+
+	for (i = 0; i < space; i++)
+		tab += gpy2xx_regmap_nr[i];
+
+	return tab;
+}
+
+const struct gpy2xx_regmap_reg *gpy2xx_regmap_lookup(enum gpy2xx_regmap_space space, u32 addr)
+{
+	const struct gpy2xx_regmap_reg *tab;
+	u32 lo = 0, hi, mid;
+
+	if (space >= GPY2XX_REGMAP_SPACES)
+		return NULL;
+
+	tab = regmap_first(space);
+	hi = gpy2xx_regmap_nr[space];
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+
+		if (tab[mid].addr == addr)
+			return &tab[mid];
+
+		if (tab[mid].addr < addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return NULL;
+}
+
+const struct gpy2xx_regmap_reg *gpy2xx_regmap_find(enum gpy2xx_regmap_space space, const char *name)
+{
+	const struct gpy2xx_regmap_reg *tab;
+	u32 i;
+
+	if (space >= GPY2XX_REGMAP_SPACES || name == NULL)
+		return NULL;
+
+	tab = regmap_first(space);
+
+	for (i = 0; i < gpy2xx_regmap_nr[space]; i++) {
+		if (strcasecmp(gpy2xx_regmap_name(tab[i].name), name) == 0)
+			return &tab[i];
+	}
+
+	return NULL;
+}
+
+int gpy2xx_regmap_decode(const struct gpy2xx_regmap_reg *reg, u32 val, char *buf, size_t size)
+{
+	const struct gpy2xx_regmap_field *f;
+	const char *name;
+	size_t len;
+	int n;
+	u32 i;
+
+	if (reg == NULL || (buf == NULL && size != 0))
+		return -EINVAL;
+
+	name = gpy2xx_regmap_name(reg->name);
+	n = snprintf(buf, size, "%s=0x%0*x", name, reg->width32 ? 8 : 4, val);
+	if (n < 0)
+		return -EINVAL;
+
+	len = n;
+
+	for (i = 0, f = &gpy2xx_regmap_field[reg->field]; i < reg->nr_field; i++, f++) {
+		u32 mask = f->bits >= 32 ? ~0u : (1u << f->bits) - 1;
+
+		n = snprintf(len < size ? buf + len : NULL, len < size ? size - len : 0,
+			     " %s.%s=0x%x", name, gpy2xx_regmap_name(f->name), (val >> f->pos) & mask);
+		if (n < 0)
+			return -EINVAL;
+
+		len += n;
+	}
+
+	return len;
+}
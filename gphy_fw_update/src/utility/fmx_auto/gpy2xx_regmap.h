@@ -0,0 +1,82 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY2XX_REGMAP_H_
+#define _GPY2XX_REGMAP_H_
+
+#include <stddef.h>
+
+#include "gpy2xx_mdio.h"
+
+/* Register map decoder.
+
+   The tables in gpy2xx_regmap_tab.c are generated by gen_regmap.sh from
+   src/inc/registers and must be regenerated when the headers change.
+   Registers are sorted by address per address space, names of registers
+   and fields are interned in one string pool. Reserved fields are not
+   listed.
+
+   MDIO addresses use the encoding of registers/phy/\*.h, i.e.
+   GPY2XX_REGMAP_MDIO_ADDR(devad, reg), devad 0 for the standard registers.
+   PDI addresses are the absolute addresses of registers/p31g and p34x, as
+   used with gpy2xx_mbox_read16/32. The PDI map differs per chip family
+   (e.g. CGU), gpy2xx_regmap_pdi() selects the table of the detected chip. */
+
+enum gpy2xx_regmap_space {
+	GPY2XX_REGMAP_MDIO = 0,
+	GPY2XX_REGMAP_PDI_P31G,
+	GPY2XX_REGMAP_PDI_P34X,
+	GPY2XX_REGMAP_SPACES,
+};
+
+#define GPY2XX_REGMAP_MDIO_ADDR(devad, reg) (((u32)(devad) << 21) | ((u32)(reg) << 1))
+
+struct gpy2xx_regmap_field {
+	/* Offset in gpy2xx_regmap_str */
+	u32 name : 18;
+	u32 pos : 5;
+	u32 bits : 6;
+};
+
+struct gpy2xx_regmap_reg {
+	u32 addr;
+	/* Offset in gpy2xx_regmap_str */
+	u32 name : 18;
+	u32 nr_field : 6;
+	/* 32-bit register, 16-bit otherwise */
+	u32 width32 : 1;
+	/* First field in gpy2xx_regmap_field */
+	u16 field;
+};
+
+extern const char gpy2xx_regmap_str[];
+extern const struct gpy2xx_regmap_field gpy2xx_regmap_field[];
+extern const struct gpy2xx_regmap_reg gpy2xx_regmap_reg[];
+extern const unsigned int gpy2xx_regmap_nr[GPY2XX_REGMAP_SPACES];
+
+static inline const char *gpy2xx_regmap_name(u32 name)
+{
+	return gpy2xx_regmap_str + name;
+}
+
+/* PDI table of the chip family in phy->id.family (ID_P31G, ID_P34X) */
+static inline enum gpy2xx_regmap_space gpy2xx_regmap_pdi(const struct gpy211_device *phy)
+{
+	return phy->id.family == ID_P34X ? GPY2XX_REGMAP_PDI_P34X : GPY2XX_REGMAP_PDI_P31G;
+}
+
+/* Register at addr, binary search. NULL if not in the map. */
+const struct gpy2xx_regmap_reg *gpy2xx_regmap_lookup(enum gpy2xx_regmap_space space, u32 addr);
+
+/* Register by name (case-insensitive, linear search). NULL if not found. */
+const struct gpy2xx_regmap_reg *gpy2xx_regmap_find(enum gpy2xx_regmap_space space, const char *name);
+
+/* Format "REG=0x... REG.FIELD=0x... ..." into buf like snprintf.
+   Returns the length of the full string or -EINVAL. */
+int gpy2xx_regmap_decode(const struct gpy2xx_regmap_reg *reg, u32 val, char *buf, size_t size);
+
+#endif /* _GPY2XX_REGMAP_H_ */
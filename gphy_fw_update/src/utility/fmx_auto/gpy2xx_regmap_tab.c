@@ -0,0 +1,15221 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Generated by gen_regmap.sh from src/inc/registers, do not edit. */
+
+#include "gpy2xx_regmap.h"
+
+const char gpy2xx_regmap_str[] =
+	"SSM\0"
+	"COL\0"
+	"DPLX\0"
+	"ANRS\0"
+	"ISOL\0"
+	"PD\0"
+	"ANEN\0"
+	"SSL\0"
+	"LB\0"
+	"RST\0"
+	"STD_CTRL\0"
+	"XCAP\0"
+	"JD\0"
+	"LS\0"
+	"ANAB\0"
+	"RF\0"
+	"ANOK\0"
+	"MFPS\0"
+	"EXT\0"
+	"CBT2H\0"
+	"CBT2F\0"
+	"XBTH\0"
+	"XBTF\0"
+	"CBTXH\0"
+	"CBTXF\0"
+	"CBT4\0"
+	"STD_STAT\0"
+	"OUI\0"
+	"STD_PHYID1\0"
+	"LDRN\0"
+	"LDN\0"
+	"STD_PHYID2\0"
+	"SF\0"
+	"TAF\0"
+	"XNP\0"
+	"NP\0"
+	"STD_AN_ADV\0"
+	"ACK\0"
+	"STD_AN_LPA\0"
+	"LPANC\0"
+	"PR\0"
+	"NPC\0"
+	"LPNPC\0"
+	"PDF\0"
+	"RNPSL\0"
+	"RNPLA\0"
+	"STD_AN_EXP\0"
+	"MCF\0"
+	"TOGG\0"
+	"ACK2\0"
+	"MP\0"
+	"STD_AN_NPTX\0"
+	"STD_AN_NPRX\0"
+	"MBTHD\0"
+	"MBTFD\0"
+	"MSPT\0"
+	"MS\0"
+	"MSEN\0"
+	"TM\0"
+	"STD_GCTRL\0"
+	"IEC\0"
+	"RRXSTAT\0"
+	"LRXSTAT\0"
+	"MSRES\0"
+	"MSFAULT\0"
+	"STD_GSTAT\0"
+	"STD_RES1\0"
+	"STD_RES2\0"
+	"DEVAD\0"
+	"RESL\0"
+	"RESH\0"
+	"ACTYPE\0"
+	"STD_MMDCTRL\0"
+	"ADDR_DATA\0"
+	"STD_MMDDATA\0"
+	"MBTH\0"
+	"MBTF\0"
+	"MBXH\0"
+	"MBXF\0"
+	"STD_XSTAT\0"
+	"LEN\0"
+	"FREQ\0"
+	"PHY_PERF\0"
+	"FW_MEM\0"
+	"LSADS\0"
+	"PHY_STAT1\0"
+	"PHY_RES\0"
+	"AMDIX\0"
+	"MDIAB\0"
+	"MDICD\0"
+	"POLA\0"
+	"POLB\0"
+	"POLC\0"
+	"POLD\0"
+	"TXADJ\0"
+	"TXOFF\0"
+	"TLOOP\0"
+	"PHY_CTL1\0"
+	"LPI\0"
+	"ANPD\0"
+	"PSCL\0"
+	"ULP\0"
+	"ULP_STA_BLOCK\0"
+	"STICKY\0"
+	"SDETP\0"
+	"PHY_CTL2\0"
+	"COUNT\0"
+	"SEL\0"
+	"PHY_ERRCNT\0"
+	"PHY_RES1\0"
+	"PHY_RES2\0"
+	"SPEED\0"
+	"DPX\0"
+	"PS\0"
+	"EEE\0"
+	"PHY_MIISTAT\0"
+	"LSTC\0"
+	"LSPC\0"
+	"DXMC\0"
+	"MDIXC\0"
+	"MDIPC\0"
+	"ADSC\0"
+	"TEMP\0"
+	"LOR\0"
+	"MBOX\0"
+	"ANC\0"
+	"ANE\0"
+	"NPTX\0"
+	"NPRX\0"
+	"MSRE\0"
+	"WOL\0"
+	"PHY_IMASK\0"
+	"PHY_ISTAT\0"
+	"LED0DA\0"
+	"LED1DA\0"
+	"LED2DA\0"
+	"LED3DA\0"
+	"LED0EN\0"
+	"LED1EN\0"
+	"LED2EN\0"
+	"LED3EN\0"
+	"INV\0"
+	"PHY_LED\0"
+	"EN\0"
+	"START\0"
+	"SIZE\0"
+	"TYPE\0"
+	"IPGL\0"
+	"MODE\0"
+	"CHSEL\0"
+	"PHY_TPGCTRL\0"
+	"DATA\0"
+	"SA\0"
+	"DA\0"
+	"PHY_TPGDATA\0"
+	"MINOR\0"
+	"MAJOR\0"
+	"REL\0"
+	"PHY_FWV\0"
+	"ABOPT\0"
+	"ABSEL\0"
+	"ABRET\0"
+	"ABUART\0"
+	"PHY_TEST\0"
+	"NS2\0"
+	"NS1\0"
+	"SPEED_SEL\0"
+	"LOW_POWER\0"
+	"PMA_CTRL1\0"
+	"LOW_POWER_ABILITY\0"
+	"RX_LINK_STATUS\0"
+	"FAULT\0"
+	"PMA_STAT1\0"
+	"PMA_DEVID1\0"
+	"PMA_DEVID2\0"
+	"CAP_10G_CAP\0"
+	"CAP_2BASE_TL\0"
+	"R10PASS_TS_CAPABLE\0"
+	"CAP_1000M\0"
+	"CAP_100M\0"
+	"CAP_10M\0"
+	"CAP_10_1G\0"
+	"CAP_40G\0"
+	"CAP_100G\0"
+	"CAP_2G5\0"
+	"CAP_5G\0"
+	"PMA_SPEED_ABILITY\0"
+	"CLAUSE_22\0"
+	"PMD_PMA\0"
+	"WIS\0"
+	"PCS\0"
+	"PHY_XS\0"
+	"DTE_XS\0"
+	"TC\0"
+	"ANEG\0"
+	"SEP_PMA_1\0"
+	"SEP_PMA_2\0"
+	"SEP_PMA_3\0"
+	"SEP_PMA_4\0"
+	"PMA_DIP1\0"
+	"CLA_22_EXT\0"
+	"VSPEC1\0"
+	"VSPEC2\0"
+	"PMA_DIP2\0"
+	"PMA_PMD_TYPE_SEL\0"
+	"PMA_CTL2\0"
+	"PMA_LOCAL_LOOPBACK\0"
+	"RMGBT_EW_ABILITY\0"
+	"RMGBT_LW_ABILITY\0"
+	"RMGBT_SW_ABILITY\0"
+	"RMGBT_LX4_ABILITY\0"
+	"RMGBT_ER_ABILITY\0"
+	"RMGBT_LR_ABILITY\0"
+	"RMGBT_SR_ABILITY\0"
+	"PMD_TX_DISABLE\0"
+	"EXT_ABILITIES\0"
+	"RX_FAULT\0"
+	"TX_FAULT\0"
+	"RX_FAULT_ABILITY\0"
+	"TX_FAULT_ABILITY\0"
+	"DEVICE_PRESENT\0"
+	"PMA_STAT2\0"
+	"RMGBT_CX4_ABILITY\0"
+	"RMGBT_LRM_ABILITY\0"
+	"RMGBT_ABILITY\0"
+	"RMGBT_KX4_ABILITY\0"
+	"RMGBT_KR_ABILITY\0"
+	"R1000BASE_T_ABILITY\0"
+	"R1000BASE_KX_ABILITY\0"
+	"R100BASE_TX_ABILITY\0"
+	"R10BASE_T_ABILITY\0"
+	"P2MP_ABILITY\0"
+	"R40G_100G_EXT_ABILITIES\0"
+	"R2G5_EXT_ABILITIES\0"
+	"PMA_EXT_ABILITY\0"
+	"PMA_PACKID1\0"
+	"PMA_PACKID2\0"
+	"AB2G5\0"
+	"AB5G\0"
+	"PMA_MGBT_EXTAB\0"
+	"LP_INFORMATION_VALID\0"
+	"PMA_MGBT_STAT\0"
+	"MDI_MDI_X\0"
+	"PAIR_A_POLARITY\0"
+	"PAIR_B_POLARITY\0"
+	"PAIR_C_POLARITY\0"
+	"PAIR_D_POLARITY\0"
+	"PMA_MGBT_POLARITY\0"
+	"SHORT_REACH_MODE\0"
+	"TX_POWER_BACKOFF\0"
+	"LP_TX\0"
+	"PMA_MGBT_TX_PBO\0"
+	"TXTER_TEST\0"
+	"TEST_MODE_CTL\0"
+	"PMA_MGBT_TEST_MODE\0"
+	"OPMARGIN_A\0"
+	"PMA_MGBT_SNR_OPMARGIN_A\0"
+	"OPMARGIN_B\0"
+	"PMA_MGBT_SNR_OPMARGIN_B\0"
+	"OPMARGIN_C\0"
+	"PMA_MGBT_SNR_OPMARGIN_C\0"
+	"OPMARGIN_D\0"
+	"PMA_MGBT_SNR_OPMARGIN_D\0"
+	"MINMARGIN_A\0"
+	"PMA_MGBT_MINMARGIN_A\0"
+	"MINMARGIN_B\0"
+	"PMA_MGBT_MINMARGIN_B\0"
+	"MINMARGIN_C\0"
+	"PMA_MGBT_MINMARGIN_C\0"
+	"MINMARGIN_D\0"
+	"PMA_MGBT_MINMARGIN_D\0"
+	"POWER_A\0"
+	"PMA_MGBT_POWER_A\0"
+	"POWER_B\0"
+	"PMA_MGBT_POWER_B\0"
+	"POWER_C\0"
+	"PMA_MGBT_POWER_C\0"
+	"POWER_D\0"
+	"PMA_MGBT_POWER_D\0"
+	"SKEW_DELAY_B\0"
+	"PMA_MGBT_SKEW_DELAY_0\0"
+	"SKEW_DELAY_C\0"
+	"SKEW_DELAY_D\0"
+	"PMA_MGBT_SKEW_DELAY_1\0"
+	"FAST_RETRAIN_ENABLE\0"
+	"FAST_RETRAIN_SIG_TYPE\0"
+	"FAST_RETRAIN_NEGOTIATED\0"
+	"FAST_RETRAIN_ABILITY\0"
+	"LD_FAST_RETRAIN_COUNT\0"
+	"LP_FAST_RETRAIN_COUNT\0"
+	"PMA_MGBT_FAST_RETRAIN_STA_CTRL\0"
+	"RXDEL\0"
+	"TXDEL\0"
+	"PMA_TIMESYNC_CAP\0"
+	"RXCKST\0"
+	"LOOPBACK\0"
+	"PCS_CTRL1\0"
+	"PCS_RX_LINK_STATUS\0"
+	"TXCKST\0"
+	"RX_LPI_INDICATION\0"
+	"TX_LPI_INDICATION\0"
+	"RX_LPI_RXD\0"
+	"TX_LPI_RXD\0"
+	"PCS_STAT1\0"
+	"PCS_DEVID1\0"
+	"PCS_DEVID2\0"
+	"R10G_CAPABLE\0"
+	"R10PASS_TS_2BASE_TL\0"
+	"R40G_CAPABLE\0"
+	"R100G_CAPABLE\0"
+	"R2G5_CAPABLE\0"
+	"PCS_SPEED_ABILITY\0"
+	"CL22\0"
+	"WIS_PRESENT\0"
+	"SEPARATED_PMA_1\0"
+	"SEPARATED_PMA_2\0"
+	"SEPARATED_PMA_4\0"
+	"PCS_DIP1\0"
+	"CLAUSE_22_EXTENSION\0"
+	"VENDOR_SPECIFIC_DEVICE_1\0"
+	"VENDOR_SPECIFIC_DEVICE_2\0"
+	"PCS_DIP2\0"
+	"PCS_TYPE_SEL\0"
+	"PCS_CTRL2\0"
+	"R10GBASE_R_CAPABLE\0"
+	"R10GBASE_X_CAPABLE\0"
+	"R10GBASE_W_CAPABLE\0"
+	"R10GBASE_T_CAPABLE\0"
+	"R40GBASE_R_CAPABLE\0"
+	"R100GBASE_R_CAPABLE\0"
+	"PCS_STAT2\0"
+	"PCS_PACKID1\0"
+	"PCS_PACKID2\0"
+	"R100BASE_TX_EEE\0"
+	"R1000BASE_T_EEE\0"
+	"R10GBASE_T_EEE\0"
+	"R1000BASE_KX_EEE\0"
+	"R10GBASE_KX4_EEE\0"
+	"R10GBASE_KR_EEE\0"
+	"PCS_EEE_CAP\0"
+	"AB2G5EEE\0"
+	"AB5GEEE\0"
+	"PCS_EEE_CAP2\0"
+	"ERRCNT\0"
+	"PCS_EEE_WAKERR\0"
+	"PCS2G5_BLO_LOCK\0"
+	"PCS2G5_HI_BER\0"
+	"PCS2G5_PAT_TEST_AB\0"
+	"PCS2G5_LINK_STATUS\0"
+	"PCS_2G5_STAT1\0"
+	"ERRED_BLK\0"
+	"BER\0"
+	"LATCHED_HIGH_BER\0"
+	"LATCHED_BLOCK_LOCK\0"
+	"PCS_2G5_STAT2\0"
+	"TIMESYNC_RX_PATH_DATA_DELAY\0"
+	"TIMESYNC_TX_PATH_DATA_DELAY\0"
+	"PCS_TIMESYNC_CAP\0"
+	"ANEG_RESTART\0"
+	"ANEG_ENAB\0"
+	"ANEG_CTRL\0"
+	"LP_ANEG_ABLE\0"
+	"LINKSTA\0"
+	"ANEG_ABLE\0"
+	"ANEG_RF\0"
+	"ANEG_COMPLETE\0"
+	"XNPS\0"
+	"ANEG_STAT\0"
+	"ANEG_DEVID1\0"
+	"ANEG_DEVID2\0"
+	"PMAPMD\0"
+	"PHYXS\0"
+	"DTEXS\0"
+	"PMA1\0"
+	"PMA2\0"
+	"PMA3\0"
+	"PMA4\0"
+	"ANEG_DIP1\0"
+	"CL22EXT\0"
+	"ANEG_DIP2\0"
+	"ANEG_PACKID1\0"
+	"ANEG_PACKID2\0"
+	"ANEG_ADV\0"
+	"ANEG_LP_BP_AB\0"
+	"ANEG_XNP_TX1\0"
+	"UCF1\0"
+	"ANEG_XNP_TX2\0"
+	"UCF2\0"
+	"ANEG_XNP_TX3\0"
+	"ANEG_LP_XNP_AB1\0"
+	"ANEG_LP_XNP_AB2\0"
+	"ANEG_LP_XNP_AB3\0"
+	"LDL\0"
+	"FR\0"
+	"LDPMA\0"
+	"FR_2G5BT\0"
+	"FR_5GBT\0"
+	"AB_2G5BT\0"
+	"AB_5GBT\0"
+	"AB_10GBT\0"
+	"PT\0"
+	"MSCV\0"
+	"MS_MAN_EN\0"
+	"ANEG_MGBT_AN_CTRL\0"
+	"ANEG_MGBT_AN_STA\0"
+	"EEE_100BTX\0"
+	"EEE_1000BT\0"
+	"EEE_10GBT\0"
+	"EEE_1000BKX\0"
+	"EEE_10GBKX4\0"
+	"EEE_10GBKR\0"
+	"ANEG_EEE_AN_ADV1\0"
+	"ANEG_EEE_AN_LPAB1\0"
+	"EEE2G5\0"
+	"ANEG_EEE_AN_ADV2\0"
+	"ANEG_EEE_LP_AB2\0"
+	"THPBYP2G5\0"
+	"ANEG_MGBT_AN_CTRL2\0"
+	"NACS\0"
+	"SBF\0"
+	"FBF\0"
+	"CBLINK\0"
+	"SCAN\0"
+	"VSPEC1_LEDC\0"
+	"BLINKF\0"
+	"CON\0"
+	"PULSE\0"
+	"BLINKS\0"
+	"VSPEC1_LED0\0"
+	"VSPEC1_LED1\0"
+	"VSPEC1_LED2\0"
+	"VSPEC1_LED3\0"
+	"VSPEC1_MBOX_DATA\0"
+	"ADDRLO\0"
+	"VSPEC1_MBOX_ADDRLO\0"
+	"ADDRHI\0"
+	"CMD\0"
+	"FAIL\0"
+	"READY\0"
+	"VSPEC1_MBOX_CMD\0"
+	"ANMODE\0"
+	"CFGDIR\0"
+	"USXGMII_REACH\0"
+	"SGMII_FIXED2G5\0"
+	"EEE_CAP\0"
+	"RXINV\0"
+	"VSPEC1_SGMII_CTRL\0"
+	"DR\0"
+	"MACSEC_CAP\0"
+	"VSPEC1_SGMII_STAT\0"
+	"NO_NRG_RST\0"
+	"DOWNSHIFT_EN\0"
+	"DOWNSHIFT_THR\0"
+	"FORCE_RST\0"
+	"NRG_RST_CNT\0"
+	"VSPEC1_NBT_DS_CTRL\0"
+	"DOWNSHIFT_CNT\0"
+	"DOWNSHIFT_10G\0"
+	"DOWNSHIFT_5G\0"
+	"DOWNSHIFT_2G5\0"
+	"DOWNSHIFT_1G\0"
+	"VSPEC1_NBT_DS_STA\0"
+	"PM_EN\0"
+	"MACSEC_EN\0"
+	"PTP_1588_EN\0"
+	"PTP_1588_STEP\0"
+	"SYNCE_EN\0"
+	"SYNCE_CLK\0"
+	"MAC_FREQ_TUNE\0"
+	"VSPEC1_PM_CTRL\0"
+	"VSPEC1_MBOX_DATA_HIGH\0"
+	"TEMP_DATA\0"
+	"VSPEC1_TEMP_STA\0"
+	"BASE\0"
+	"TBT\0"
+	"HUNDREDBT\0"
+	"GIGA\0"
+	"GIGA2_5\0"
+	"DVS_EN\0"
+	"VSPEC1_DCDC1\0"
+	"QUIET_100\0"
+	"QUIET_1G\0"
+	"QUIET_2G5\0"
+	"REFRESH_2G5\0"
+	"VSPEC1_DCDC2\0"
+	"GMACL_TS\0"
+	"PM_LPI\0"
+	"MCI\0"
+	"TS_FIFO\0"
+	"MACSEC\0"
+	"VSPEC1_IMASK\0"
+	"VSPEC1_ISTAT\0"
+	"DSM_TARGET\0"
+	"DSM_DONE\0"
+	"VSPEC1_DCDC3\0"
+	"LANE_A\0"
+	"LANE_B\0"
+	"LANE_C\0"
+	"LANE_D\0"
+	"VSPEC1_LANE_ASP_MAP\0"
+	"SPWD_EN\0"
+	"VPSPEC2_WOL_CTL\0"
+	"AD0\0"
+	"AD1\0"
+	"VPSPEC2_WOL_AD01\0"
+	"AD2\0"
+	"AD3\0"
+	"VPSPEC2_WOL_AD23\0"
+	"AD4\0"
+	"AD5\0"
+	"VPSPEC2_WOL_AD45\0"
+	"PW0\0"
+	"PW1\0"
+	"VPSPEC2_WOL_PW01\0"
+	"PW2\0"
+	"PW3\0"
+	"VPSPEC2_WOL_PW23\0"
+	"PW4\0"
+	"PW5\0"
+	"VPSPEC2_WOL_PW45\0"
+	"INIT\0"
+	"LFUPD\0"
+	"TXRX\0"
+	"TST\0"
+	"VSPEC2_TGU_PDI_TGU_CTL\0"
+	"SWRES\0"
+	"HWRES\0"
+	"FXVL_EN\0"
+	"P31G_MDIO_PDI_GLOB_CTRL\0"
+	"REGAD\0"
+	"PHYAD\0"
+	"OP\0"
+	"MBUSY\0"
+	"P31G_MDIO_PDI_MDIO_CTRL\0"
+	"RDATA\0"
+	"P31G_MDIO_PDI_MDIO_READ\0"
+	"WDATA\0"
+	"P31G_MDIO_PDI_MDIO_WRITE\0"
+	"MCEN\0"
+	"P31G_MDIO_PDI_MDC_CFG_1\0"
+	"POS\0"
+	"PM_PDI_PCH_CTL_TTSE_GPHY_POSL\0"
+	"PM_PDI_PCH_CTL_TTSE_GPHY_POSH\0"
+	"PM_PDI_PCH_CTL_TTSE_GMAC_POSL\0"
+	"PM_PDI_PCH_CTL_TTSE_GMAC_POSH\0"
+	"PM_PDI_PCH_CTL_OSTC_POSL\0"
+	"PM_PDI_PCH_CTL_OSTC_POSH\0"
+	"MAC_SA_MATCH_47_16\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_0\0"
+	"MAC_SA_MATCH_15_0\0"
+	"ETHER_TYPE\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_0\0"
+	"MAC_DA_MATCH_47_16\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_0\0"
+	"MAC_DA_MATCH_15_0\0"
+	"VLAN_ID\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_0\0"
+	"VLAN_VALID\0"
+	"QINQ_FOUND\0"
+	"STAG_VALID\0"
+	"QTAG_VALID\0"
+	"VLAN_UP\0"
+	"CONTROL_PACKET\0"
+	"UNTAGGED\0"
+	"TAGGED\0"
+	"BAD_TAG\0"
+	"KAY_TAG\0"
+	"SOURCE_PORT\0"
+	"MATCH_PRIORITY\0"
+	"MACSEC_TCI_AN\0"
+	"EIPI_SAM_MAC_MISC_MATCH_0\0"
+	"MACSEC_SCI_MATCH_63_32\0"
+	"EIPI_SAM_SCI_MATCH_LO_0\0"
+	"MACSEC_SCI_MATCH_31_0\0"
+	"EIPI_SAM_SCI_MATCH_HI_0\0"
+	"MAC_SA_0_MASK\0"
+	"MAC_SA_1_MASK\0"
+	"MAC_SA_2_MASK\0"
+	"MAC_SA_3_MASK\0"
+	"MAC_SA_4_MASK\0"
+	"MAC_SA_5_MASK\0"
+	"MAC_DA_0_MASK\0"
+	"MAC_DA_1_MASK\0"
+	"MAC_DA_2_MASK\0"
+	"MAC_DA_3_MASK\0"
+	"MAC_DA_4_MASK\0"
+	"MAC_DA_5_MASK\0"
+	"MAC_ETYPE_MASK\0"
+	"VLAN_VLD_MASK\0"
+	"QINQ_FOUND_MASK\0"
+	"STAG_VLD_MASK\0"
+	"QTAG_VLD_MASK\0"
+	"VLAN_UP_MASK\0"
+	"VLAN_ID_MASK\0"
+	"SOURCE_PORT_MASK\0"
+	"CTRL_PACKET_MASK\0"
+	"VLAN_UP_INNER_MASK\0"
+	"VLAN_ID_INNER_MASK\0"
+	"MACSEC_SCI_MASK\0"
+	"TCI_AN_MASK\0"
+	"EIPI_SAM_MASK_0\0"
+	"VLAN_ID_INNER\0"
+	"VLAN_UP_INNER\0"
+	"FLOW_INDEX\0"
+	"EIPI_SAM_EXT_MATCH_0\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_1\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_1\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_1\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_1\0"
+	"EIPI_SAM_MAC_MISC_MATCH_1\0"
+	"EIPI_SAM_SCI_MATCH_LO_1\0"
+	"EIPI_SAM_SCI_MATCH_HI_1\0"
+	"EIPI_SAM_MASK_1\0"
+	"EIPI_SAM_EXT_MATCH_1\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_2\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_2\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_2\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_2\0"
+	"EIPI_SAM_MAC_MISC_MATCH_2\0"
+	"EIPI_SAM_SCI_MATCH_LO_2\0"
+	"EIPI_SAM_SCI_MATCH_HI_2\0"
+	"EIPI_SAM_MASK_2\0"
+	"EIPI_SAM_EXT_MATCH_2\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_3\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_3\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_3\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_3\0"
+	"EIPI_SAM_MAC_MISC_MATCH_3\0"
+	"EIPI_SAM_SCI_MATCH_LO_3\0"
+	"EIPI_SAM_SCI_MATCH_HI_3\0"
+	"EIPI_SAM_MASK_3\0"
+	"EIPI_SAM_EXT_MATCH_3\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_4\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_4\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_4\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_4\0"
+	"EIPI_SAM_MAC_MISC_MATCH_4\0"
+	"EIPI_SAM_SCI_MATCH_LO_4\0"
+	"EIPI_SAM_SCI_MATCH_HI_4\0"
+	"EIPI_SAM_MASK_4\0"
+	"EIPI_SAM_EXT_MATCH_4\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_5\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_5\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_5\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_5\0"
+	"EIPI_SAM_MAC_MISC_MATCH_5\0"
+	"EIPI_SAM_SCI_MATCH_LO_5\0"
+	"EIPI_SAM_SCI_MATCH_HI_5\0"
+	"EIPI_SAM_MASK_5\0"
+	"EIPI_SAM_EXT_MATCH_5\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_6\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_6\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_6\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_6\0"
+	"EIPI_SAM_MAC_MISC_MATCH_6\0"
+	"EIPI_SAM_SCI_MATCH_LO_6\0"
+	"EIPI_SAM_SCI_MATCH_HI_6\0"
+	"EIPI_SAM_MASK_6\0"
+	"EIPI_SAM_EXT_MATCH_6\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_7\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_7\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_7\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_7\0"
+	"EIPI_SAM_MAC_MISC_MATCH_7\0"
+	"EIPI_SAM_SCI_MATCH_LO_7\0"
+	"EIPI_SAM_SCI_MATCH_HI_7\0"
+	"EIPI_SAM_MASK_7\0"
+	"EIPI_SAM_EXT_MATCH_7\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_8\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_8\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_8\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_8\0"
+	"EIPI_SAM_MAC_MISC_MATCH_8\0"
+	"EIPI_SAM_SCI_MATCH_LO_8\0"
+	"EIPI_SAM_SCI_MATCH_HI_8\0"
+	"EIPI_SAM_MASK_8\0"
+	"EIPI_SAM_EXT_MATCH_8\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_9\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_9\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_9\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_9\0"
+	"EIPI_SAM_MAC_MISC_MATCH_9\0"
+	"EIPI_SAM_SCI_MATCH_LO_9\0"
+	"EIPI_SAM_SCI_MATCH_HI_9\0"
+	"EIPI_SAM_MASK_9\0"
+	"EIPI_SAM_EXT_MATCH_9\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_10\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_10\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_10\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_10\0"
+	"EIPI_SAM_MAC_MISC_MATCH_10\0"
+	"EIPI_SAM_SCI_MATCH_LO_10\0"
+	"EIPI_SAM_SCI_MATCH_HI_10\0"
+	"EIPI_SAM_MASK_10\0"
+	"EIPI_SAM_EXT_MATCH_10\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_11\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_11\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_11\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_11\0"
+	"EIPI_SAM_MAC_MISC_MATCH_11\0"
+	"EIPI_SAM_SCI_MATCH_LO_11\0"
+	"EIPI_SAM_SCI_MATCH_HI_11\0"
+	"EIPI_SAM_MASK_11\0"
+	"EIPI_SAM_EXT_MATCH_11\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_12\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_12\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_12\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_12\0"
+	"EIPI_SAM_MAC_MISC_MATCH_12\0"
+	"EIPI_SAM_SCI_MATCH_LO_12\0"
+	"EIPI_SAM_SCI_MATCH_HI_12\0"
+	"EIPI_SAM_MASK_12\0"
+	"EIPI_SAM_EXT_MATCH_12\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_13\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_13\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_13\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_13\0"
+	"EIPI_SAM_MAC_MISC_MATCH_13\0"
+	"EIPI_SAM_SCI_MATCH_LO_13\0"
+	"EIPI_SAM_SCI_MATCH_HI_13\0"
+	"EIPI_SAM_MASK_13\0"
+	"EIPI_SAM_EXT_MATCH_13\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_14\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_14\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_14\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_14\0"
+	"EIPI_SAM_MAC_MISC_MATCH_14\0"
+	"EIPI_SAM_SCI_MATCH_LO_14\0"
+	"EIPI_SAM_SCI_MATCH_HI_14\0"
+	"EIPI_SAM_MASK_14\0"
+	"EIPI_SAM_EXT_MATCH_14\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_15\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_15\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_15\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_15\0"
+	"EIPI_SAM_MAC_MISC_MATCH_15\0"
+	"EIPI_SAM_SCI_MATCH_LO_15\0"
+	"EIPI_SAM_SCI_MATCH_HI_15\0"
+	"EIPI_SAM_MASK_15\0"
+	"EIPI_SAM_EXT_MATCH_15\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_16\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_16\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_16\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_16\0"
+	"EIPI_SAM_MAC_MISC_MATCH_16\0"
+	"EIPI_SAM_SCI_MATCH_LO_16\0"
+	"EIPI_SAM_SCI_MATCH_HI_16\0"
+	"EIPI_SAM_MASK_16\0"
+	"EIPI_SAM_EXT_MATCH_16\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_17\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_17\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_17\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_17\0"
+	"EIPI_SAM_MAC_MISC_MATCH_17\0"
+	"EIPI_SAM_SCI_MATCH_LO_17\0"
+	"EIPI_SAM_SCI_MATCH_HI_17\0"
+	"EIPI_SAM_MASK_17\0"
+	"EIPI_SAM_EXT_MATCH_17\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_18\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_18\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_18\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_18\0"
+	"EIPI_SAM_MAC_MISC_MATCH_18\0"
+	"EIPI_SAM_SCI_MATCH_LO_18\0"
+	"EIPI_SAM_SCI_MATCH_HI_18\0"
+	"EIPI_SAM_MASK_18\0"
+	"EIPI_SAM_EXT_MATCH_18\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_19\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_19\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_19\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_19\0"
+	"EIPI_SAM_MAC_MISC_MATCH_19\0"
+	"EIPI_SAM_SCI_MATCH_LO_19\0"
+	"EIPI_SAM_SCI_MATCH_HI_19\0"
+	"EIPI_SAM_MASK_19\0"
+	"EIPI_SAM_EXT_MATCH_19\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_20\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_20\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_20\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_20\0"
+	"EIPI_SAM_MAC_MISC_MATCH_20\0"
+	"EIPI_SAM_SCI_MATCH_LO_20\0"
+	"EIPI_SAM_SCI_MATCH_HI_20\0"
+	"EIPI_SAM_MASK_20\0"
+	"EIPI_SAM_EXT_MATCH_20\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_21\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_21\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_21\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_21\0"
+	"EIPI_SAM_MAC_MISC_MATCH_21\0"
+	"EIPI_SAM_SCI_MATCH_LO_21\0"
+	"EIPI_SAM_SCI_MATCH_HI_21\0"
+	"EIPI_SAM_MASK_21\0"
+	"EIPI_SAM_EXT_MATCH_21\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_22\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_22\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_22\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_22\0"
+	"EIPI_SAM_MAC_MISC_MATCH_22\0"
+	"EIPI_SAM_SCI_MATCH_LO_22\0"
+	"EIPI_SAM_SCI_MATCH_HI_22\0"
+	"EIPI_SAM_MASK_22\0"
+	"EIPI_SAM_EXT_MATCH_22\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_23\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_23\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_23\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_23\0"
+	"EIPI_SAM_MAC_MISC_MATCH_23\0"
+	"EIPI_SAM_SCI_MATCH_LO_23\0"
+	"EIPI_SAM_SCI_MATCH_HI_23\0"
+	"EIPI_SAM_MASK_23\0"
+	"EIPI_SAM_EXT_MATCH_23\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_24\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_24\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_24\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_24\0"
+	"EIPI_SAM_MAC_MISC_MATCH_24\0"
+	"EIPI_SAM_SCI_MATCH_LO_24\0"
+	"EIPI_SAM_SCI_MATCH_HI_24\0"
+	"EIPI_SAM_MASK_24\0"
+	"EIPI_SAM_EXT_MATCH_24\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_25\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_25\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_25\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_25\0"
+	"EIPI_SAM_MAC_MISC_MATCH_25\0"
+	"EIPI_SAM_SCI_MATCH_LO_25\0"
+	"EIPI_SAM_SCI_MATCH_HI_25\0"
+	"EIPI_SAM_MASK_25\0"
+	"EIPI_SAM_EXT_MATCH_25\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_26\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_26\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_26\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_26\0"
+	"EIPI_SAM_MAC_MISC_MATCH_26\0"
+	"EIPI_SAM_SCI_MATCH_LO_26\0"
+	"EIPI_SAM_SCI_MATCH_HI_26\0"
+	"EIPI_SAM_MASK_26\0"
+	"EIPI_SAM_EXT_MATCH_26\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_27\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_27\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_27\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_27\0"
+	"EIPI_SAM_MAC_MISC_MATCH_27\0"
+	"EIPI_SAM_SCI_MATCH_LO_27\0"
+	"EIPI_SAM_SCI_MATCH_HI_27\0"
+	"EIPI_SAM_MASK_27\0"
+	"EIPI_SAM_EXT_MATCH_27\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_28\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_28\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_28\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_28\0"
+	"EIPI_SAM_MAC_MISC_MATCH_28\0"
+	"EIPI_SAM_SCI_MATCH_LO_28\0"
+	"EIPI_SAM_SCI_MATCH_HI_28\0"
+	"EIPI_SAM_MASK_28\0"
+	"EIPI_SAM_EXT_MATCH_28\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_29\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_29\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_29\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_29\0"
+	"EIPI_SAM_MAC_MISC_MATCH_29\0"
+	"EIPI_SAM_SCI_MATCH_LO_29\0"
+	"EIPI_SAM_SCI_MATCH_HI_29\0"
+	"EIPI_SAM_MASK_29\0"
+	"EIPI_SAM_EXT_MATCH_29\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_30\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_30\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_30\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_30\0"
+	"EIPI_SAM_MAC_MISC_MATCH_30\0"
+	"EIPI_SAM_SCI_MATCH_LO_30\0"
+	"EIPI_SAM_SCI_MATCH_HI_30\0"
+	"EIPI_SAM_MASK_30\0"
+	"EIPI_SAM_EXT_MATCH_30\0"
+	"EIPI_SAM_MAC_SA_MATCH_LO_31\0"
+	"EIPI_SAM_MAC_SA_MATCH_HI_31\0"
+	"EIPI_SAM_MAC_DA_MATCH_LO_31\0"
+	"EIPI_SAM_MAC_DA_MATCH_HI_31\0"
+	"EIPI_SAM_MAC_MISC_MATCH_31\0"
+	"EIPI_SAM_SCI_MATCH_LO_31\0"
+	"EIPI_SAM_SCI_MATCH_HI_31\0"
+	"EIPI_SAM_MASK_31\0"
+	"EIPI_SAM_EXT_MATCH_31\0"
+	"ENABLE_31_0\0"
+	"EIPI_SAM_ENTRY_ENABLE1\0"
+	"TOGGLE_31_0\0"
+	"EIPI_SAM_ENTRY_TOGGLE1\0"
+	"SET_31_0\0"
+	"EIPI_SAM_ENTRY_SET1\0"
+	"CLEAR_31_0\0"
+	"EIPI_SAM_ENTRY_CLEAR1\0"
+	"SAM_INDEX_SET\0"
+	"SET_ENABLE\0"
+	"SET_ALL\0"
+	"SAM_INDEX_CLEAR\0"
+	"CLEAR_ENABLE\0"
+	"CLEAR_ALL\0"
+	"EIPI_SAM_ENTRY_ENABLE_CTRL\0"
+	"UNSAFE\0"
+	"IN_FLIGHT\0"
+	"LOAD_UNSAFE\0"
+	"EIPI_SAM_IN_FLIGHT\0"
+	"FLOW_TYPE\0"
+	"DEST_PORT\0"
+	"DROP_NON_RESERVED\0"
+	"FLOW_CRYPT_AUTH\0"
+	"DROP_ACTION\0"
+	"SA_INDEX\0"
+	"REPLAY_PROTECT\0"
+	"SA_IN_USE\0"
+	"VALIDATE_FRAMES\0"
+	"CONFIDENTIALITY_OFFSET\0"
+	"EIPI_SAM_FLOW_CTRL_0\0"
+	"EIPI_SAM_FLOW_CTRL_1\0"
+	"EIPI_SAM_FLOW_CTRL_2\0"
+	"EIPI_SAM_FLOW_CTRL_3\0"
+	"EIPI_SAM_FLOW_CTRL_4\0"
+	"EIPI_SAM_FLOW_CTRL_5\0"
+	"EIPI_SAM_FLOW_CTRL_6\0"
+	"EIPI_SAM_FLOW_CTRL_7\0"
+	"EIPI_SAM_FLOW_CTRL_8\0"
+	"EIPI_SAM_FLOW_CTRL_9\0"
+	"EIPI_SAM_FLOW_CTRL_10\0"
+	"EIPI_SAM_FLOW_CTRL_11\0"
+	"EIPI_SAM_FLOW_CTRL_12\0"
+	"EIPI_SAM_FLOW_CTRL_13\0"
+	"EIPI_SAM_FLOW_CTRL_14\0"
+	"EIPI_SAM_FLOW_CTRL_15\0"
+	"EIPI_SAM_FLOW_CTRL_16\0"
+	"EIPI_SAM_FLOW_CTRL_17\0"
+	"EIPI_SAM_FLOW_CTRL_18\0"
+	"EIPI_SAM_FLOW_CTRL_19\0"
+	"EIPI_SAM_FLOW_CTRL_20\0"
+	"EIPI_SAM_FLOW_CTRL_21\0"
+	"EIPI_SAM_FLOW_CTRL_22\0"
+	"EIPI_SAM_FLOW_CTRL_23\0"
+	"EIPI_SAM_FLOW_CTRL_24\0"
+	"EIPI_SAM_FLOW_CTRL_25\0"
+	"EIPI_SAM_FLOW_CTRL_26\0"
+	"EIPI_SAM_FLOW_CTRL_27\0"
+	"EIPI_SAM_FLOW_CTRL_28\0"
+	"EIPI_SAM_FLOW_CTRL_29\0"
+	"EIPI_SAM_FLOW_CTRL_30\0"
+	"EIPI_SAM_FLOW_CTRL_31\0"
+	"EIPI_CP_MAC_DA_MATCH_0\0"
+	"ETHER_TYPE_MATCH\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_0\0"
+	"EIPI_CP_MAC_DA_MATCH_1\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_1\0"
+	"EIPI_CP_MAC_DA_MATCH_2\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_2\0"
+	"EIPI_CP_MAC_DA_MATCH_3\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_3\0"
+	"EIPI_CP_MAC_DA_MATCH_4\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_4\0"
+	"EIPI_CP_MAC_DA_MATCH_5\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_5\0"
+	"EIPI_CP_MAC_DA_MATCH_6\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_6\0"
+	"EIPI_CP_MAC_DA_MATCH_7\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_7\0"
+	"EIPI_CP_MAC_DA_MATCH_8\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_8\0"
+	"EIPI_CP_MAC_DA_MATCH_9\0"
+	"EIPI_CP_MAC_DA_ET_MATCH_9\0"
+	"EIPI_CP_MAC_ET_MATCH_10\0"
+	"EIPI_CP_MAC_ET_MATCH_11\0"
+	"EIPI_CP_MAC_ET_MATCH_12\0"
+	"EIPI_CP_MAC_ET_MATCH_13\0"
+	"EIPI_CP_MAC_ET_MATCH_14\0"
+	"EIPI_CP_MAC_ET_MATCH_15\0"
+	"EIPI_CP_MAC_ET_MATCH_16\0"
+	"EIPI_CP_MAC_ET_MATCH_17\0"
+	"EIPI_CP_MAC_DA_START_LO\0"
+	"EIPI_CP_MAC_DA_START_HI\0"
+	"EIPI_CP_MAC_DA_END_LO\0"
+	"EIPI_CP_MAC_DA_END_HI\0"
+	"EIPI_CP_MAC_DA_44_BITS_LO\0"
+	"MAC_DA_MATCH_15_8\0"
+	"MAC_DA_MATCH_7_4\0"
+	"EIPI_CP_MAC_DA_44_BITS_HI\0"
+	"EIPI_CP_MAC_DA_48_BITS_LO\0"
+	"EIPI_CP_MAC_DA_48_BITS_HI\0"
+	"VLAN_SEL_0\0"
+	"VLAN_SEL_1\0"
+	"VLAN_SEL_2\0"
+	"VLAN_SEL_3\0"
+	"VLAN_SEL_4\0"
+	"VLAN_SEL_5\0"
+	"VLAN_SEL_6\0"
+	"VLAN_SEL_7\0"
+	"E_TYPE_SEL_0\0"
+	"E_TYPE_SEL_1\0"
+	"E_TYPE_SEL_2\0"
+	"E_TYPE_SEL_3\0"
+	"E_TYPE_SEL_4\0"
+	"E_TYPE_SEL_5\0"
+	"E_TYPE_SEL_6\0"
+	"E_TYPE_SEL_7\0"
+	"E_TYPE_SEL_8\0"
+	"E_TYPE_SEL_9\0"
+	"E_TYPE_SEL_10\0"
+	"E_TYPE_SEL_11\0"
+	"E_TYPE_SEL_12\0"
+	"E_TYPE_SEL_13\0"
+	"E_TYPE_SEL_14\0"
+	"E_TYPE_SEL_15\0"
+	"E_TYPE_SEL_16\0"
+	"E_TYPE_SEL_17\0"
+	"EIPI_CP_MATCH_MODE\0"
+	"MAC_DA_0\0"
+	"MAC_DA_1\0"
+	"MAC_DA_2\0"
+	"MAC_DA_3\0"
+	"MAC_DA_4\0"
+	"MAC_DA_5\0"
+	"MAC_DA_6\0"
+	"MAC_DA_7\0"
+	"E_TYPE_0\0"
+	"E_TYPE_1\0"
+	"E_TYPE_2\0"
+	"E_TYPE_3\0"
+	"E_TYPE_4\0"
+	"E_TYPE_5\0"
+	"E_TYPE_6\0"
+	"E_TYPE_7\0"
+	"COMB_8\0"
+	"COMB_9\0"
+	"RANGE\0"
+	"CONST_44\0"
+	"CONST_48\0"
+	"E_TYPE_10\0"
+	"E_TYPE_11\0"
+	"E_TYPE_12\0"
+	"E_TYPE_13\0"
+	"E_TYPE_14\0"
+	"E_TYPE_15\0"
+	"E_TYPE_16\0"
+	"E_TYPE_17\0"
+	"EIPI_CP_MATCH_ENABLE\0"
+	"MAP_TBL\0"
+	"DEF_UP\0"
+	"STAG_UP_EN\0"
+	"QTAG_UP_EN\0"
+	"PARSE_QINQ\0"
+	"PARSE_STAG\0"
+	"PARSE_QTAG\0"
+	"EIPI_SAM_CP_TAG\0"
+	"QTAG_VALUE\0"
+	"STAG_VALUE\0"
+	"EIPI_SAM_PP_TAGS\0"
+	"STAG_VALUE2\0"
+	"STAG_VALUE3\0"
+	"EIPI_SAM_PP_TAGS2\0"
+	"MAP_TBL2\0"
+	"EIPI_SAM_CP_TAG2\0"
+	"COMP_ETYPE\0"
+	"CHECK_V\0"
+	"CHECK_KAY\0"
+	"CHECK_C_E\0"
+	"CHECK_SC\0"
+	"CHECK_SL\0"
+	"CHECK_PN\0"
+	"MSEC_TAG_VALUE\0"
+	"EIPI_SAM_NM_PARAMS\0"
+	"FLOW_TYPE0\0"
+	"DEST_PORT0\0"
+	"DROP_NON_RESERVED0\0"
+	"DROP_ACTION0\0"
+	"FLOW_TYPE1\0"
+	"DEST_PORT1\0"
+	"DROP_NON_RESERVED1\0"
+	"DROP_ACTION1\0"
+	"FLOW_TYPE2\0"
+	"DEST_PORT2\0"
+	"DROP_NON_RESERVED2\0"
+	"DROP_ACTION2\0"
+	"FLOW_TYPE3\0"
+	"DEST_PORT3\0"
+	"DROP_NON_RESERVED3\0"
+	"DROP_ACTION3\0"
+	"EIPI_SAM_NM_FLOW_NCP\0"
+	"EIPI_SAM_NM_FLOW_CP\0"
+	"EIPI_SAM_NM_FLOW_EXPL\0"
+	"MC_LATENCY_FIX_7_0\0"
+	"STATIC_BYPASS\0"
+	"NM_MACSEC_EN\0"
+	"SECTAG_AFTER_VLAN\0"
+	"XFORM_REC_SIZE\0"
+	"MC_LATENCY_FIX_13_8\0"
+	"EIPI_MISC_CONTROL\0"
+	"BYPASS_LEN\0"
+	"EIPI_CRYPT_AUTH_CTRL\0"
+	"EIPI_CP_MATCH_DEBUG\0"
+	"SA_NR\0"
+	"RULE_NR\0"
+	"MACSEC_CLASS\0"
+	"RULE_HIT\0"
+	"SA_HIT\0"
+	"EIPI_SAM_DEBUG\0"
+	"MACSEC_SECTAG_VALID\0"
+	"MACSEC_SCI_VALID\0"
+	"MACSEC_TAG_VALID\0"
+	"EIPI_SECTAG_DEBUG\0"
+	"MATCH_31_0\0"
+	"EIPI_SAM_MATCH_DEBUG1\0"
+	"PARSED_ETHERTYPE\0"
+	"PARSED_VLAN\0"
+	"PARSED_UP\0"
+	"EIPI_SAM_PP_DEBUG1\0"
+	"LPIDLE_PKT\0"
+	"ONE_WORD_PKT\0"
+	"SINGLE_STEP_EN\0"
+	"EIPI_SAM_PP_DEBUG2\0"
+	"PARSED_VLAN_INNER\0"
+	"PARSED_UP_INNER\0"
+	"EIPI_SAM_PP_DEBUG3\0"
+	"PARSED_MAC_DA_31_0\0"
+	"EIPI_DBG_PARSED_DA_LO\0"
+	"PARSED_MAC_DA_47_32\0"
+	"ORIG_ETH_TYPE\0"
+	"EIPI_DBG_PARSED_DA_HI\0"
+	"PARSED_MAC_SA_31_0\0"
+	"EIPI_DBG_PARSED_SA_LO\0"
+	"PARSED_MAC_SA_47_32\0"
+	"EIPI_DBG_PARSED_SA_HI\0"
+	"PARSED_SECTAG_31_0\0"
+	"EIPI_DBG_PARSED_SECTAG_LO\0"
+	"PARSED_SECTAG_63_32\0"
+	"EIPI_DBG_PARSED_SECTAG_HI\0"
+	"PARSED_SCI_31_0\0"
+	"EIPI_DBG_PARSED_SCI_LO\0"
+	"PARSED_SCI_63_32\0"
+	"EIPI_DBG_PARSED_SCI_HI\0"
+	"FLOW_LOOKUP_RES\0"
+	"EIPI_DBG_FLOW_LOOKUP\0"
+	"SA_UPDATE_CTRL_WORD\0"
+	"EIPI_DBG_SA_UPDATE\0"
+	"ATOK_WORD\0"
+	"EIPI_CRYPTO_ATOK_DEBUG_0\0"
+	"COMMAND_TOKEN_WORDS\0"
+	"EIPI_CRYPTO_CMMD_DEBUG_0\0"
+	"EIPI_CRYPTO_CMMD_DEBUG_1\0"
+	"EIPI_CRYPTO_CMMD_DEBUG_2\0"
+	"EIPI_CRYPTO_CMMD_DEBUG_3\0"
+	"MAC_SA_0_MATCH\0"
+	"MAC_SA_1_MATCH\0"
+	"MAC_SA_2_MATCH\0"
+	"MAC_SA_3_MATCH\0"
+	"MAC_SA_4_MATCH\0"
+	"MAC_SA_5_MATCH\0"
+	"MAC_DA_0_MATCH\0"
+	"MAC_DA_1_MATCH\0"
+	"MAC_DA_2_MATCH\0"
+	"MAC_DA_3_MATCH\0"
+	"MAC_DA_4_MATCH\0"
+	"MAC_DA_5_MATCH\0"
+	"MAC_ETYPE_MATCH\0"
+	"VLAN_VLD_MATCH\0"
+	"QINQ_FOUND_MATCH\0"
+	"STAG_VLD_MATCH\0"
+	"QTAG_VLD_MATCH\0"
+	"VLAN_UP_MATCH\0"
+	"VLAN_ID_MATCH\0"
+	"SOURCE_PORT_MATCH\0"
+	"CTRL_PACKET_MATCH\0"
+	"MACSEC_TAG_MATCH\0"
+	"MACSEC_SCI_MATCH\0"
+	"TCI_AN_MATCH\0"
+	"EIPI_DBG_SA_MATCHES1_0\0"
+	"VLAN_UP_INNER_MATCH\0"
+	"VLAN_ID_INNER_MATCH\0"
+	"EIPI_DBG_SA_MATCHES2_0\0"
+	"EIPI_DBG_SA_MATCHES1_1\0"
+	"EIPI_DBG_SA_MATCHES2_1\0"
+	"EIPI_DBG_SA_MATCHES1_2\0"
+	"EIPI_DBG_SA_MATCHES2_2\0"
+	"EIPI_DBG_SA_MATCHES1_3\0"
+	"EIPI_DBG_SA_MATCHES2_3\0"
+	"EIPI_DBG_SA_MATCHES1_4\0"
+	"EIPI_DBG_SA_MATCHES2_4\0"
+	"EIPI_DBG_SA_MATCHES1_5\0"
+	"EIPI_DBG_SA_MATCHES2_5\0"
+	"EIPI_DBG_SA_MATCHES1_6\0"
+	"EIPI_DBG_SA_MATCHES2_6\0"
+	"EIPI_DBG_SA_MATCHES1_7\0"
+	"EIPI_DBG_SA_MATCHES2_7\0"
+	"EIPI_DBG_SA_MATCHES1_8\0"
+	"EIPI_DBG_SA_MATCHES2_8\0"
+	"EIPI_DBG_SA_MATCHES1_9\0"
+	"EIPI_DBG_SA_MATCHES2_9\0"
+	"EIPI_DBG_SA_MATCHES1_10\0"
+	"EIPI_DBG_SA_MATCHES2_10\0"
+	"EIPI_DBG_SA_MATCHES1_11\0"
+	"EIPI_DBG_SA_MATCHES2_11\0"
+	"EIPI_DBG_SA_MATCHES1_12\0"
+	"EIPI_DBG_SA_MATCHES2_12\0"
+	"EIPI_DBG_SA_MATCHES1_13\0"
+	"EIPI_DBG_SA_MATCHES2_13\0"
+	"EIPI_DBG_SA_MATCHES1_14\0"
+	"EIPI_DBG_SA_MATCHES2_14\0"
+	"EIPI_DBG_SA_MATCHES1_15\0"
+	"EIPI_DBG_SA_MATCHES2_15\0"
+	"SAM_SET_16_SEL\0"
+	"EIPI_DBG_SA_MATCH_SEL\0"
+	"COUNTER\0"
+	"EIPI_SA_0_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_0_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_0_RESERVED2\0"
+	"EIPI_SA_0_RESERVED3\0"
+	"EIPI_SA_0_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_0_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_0_INPKTSDELAYED_LO\0"
+	"EIPI_SA_0_INPKTSDELAYED_HI\0"
+	"EIPI_SA_0_INPKTSLATE_LO\0"
+	"EIPI_SA_0_INPKTSLATE_HI\0"
+	"EIPI_SA_0_INPKTSOK_LO\0"
+	"EIPI_SA_0_INPKTSOK_HI\0"
+	"EIPI_SA_0_INPKTSINVALID_LO\0"
+	"EIPI_SA_0_INPKTSINVALID_HI\0"
+	"EIPI_SA_0_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_0_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_0_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_0_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_0_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_0_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_0_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_0_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_1_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_1_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_1_RESERVED2\0"
+	"EIPI_SA_1_RESERVED3\0"
+	"EIPI_SA_1_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_1_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_1_INPKTSDELAYED_LO\0"
+	"EIPI_SA_1_INPKTSDELAYED_HI\0"
+	"EIPI_SA_1_INPKTSLATE_LO\0"
+	"EIPI_SA_1_INPKTSLATE_HI\0"
+	"EIPI_SA_1_INPKTSOK_LO\0"
+	"EIPI_SA_1_INPKTSOK_HI\0"
+	"EIPI_SA_1_INPKTSINVALID_LO\0"
+	"EIPI_SA_1_INPKTSINVALID_HI\0"
+	"EIPI_SA_1_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_1_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_1_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_1_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_1_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_1_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_1_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_1_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_2_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_2_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_2_RESERVED2\0"
+	"EIPI_SA_2_RESERVED3\0"
+	"EIPI_SA_2_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_2_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_2_INPKTSDELAYED_LO\0"
+	"EIPI_SA_2_INPKTSDELAYED_HI\0"
+	"EIPI_SA_2_INPKTSLATE_LO\0"
+	"EIPI_SA_2_INPKTSLATE_HI\0"
+	"EIPI_SA_2_INPKTSOK_LO\0"
+	"EIPI_SA_2_INPKTSOK_HI\0"
+	"EIPI_SA_2_INPKTSINVALID_LO\0"
+	"EIPI_SA_2_INPKTSINVALID_HI\0"
+	"EIPI_SA_2_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_2_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_2_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_2_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_2_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_2_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_2_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_2_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_3_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_3_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_3_RESERVED2\0"
+	"EIPI_SA_3_RESERVED3\0"
+	"EIPI_SA_3_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_3_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_3_INPKTSDELAYED_LO\0"
+	"EIPI_SA_3_INPKTSDELAYED_HI\0"
+	"EIPI_SA_3_INPKTSLATE_LO\0"
+	"EIPI_SA_3_INPKTSLATE_HI\0"
+	"EIPI_SA_3_INPKTSOK_LO\0"
+	"EIPI_SA_3_INPKTSOK_HI\0"
+	"EIPI_SA_3_INPKTSINVALID_LO\0"
+	"EIPI_SA_3_INPKTSINVALID_HI\0"
+	"EIPI_SA_3_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_3_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_3_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_3_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_3_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_3_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_3_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_3_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_4_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_4_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_4_RESERVED2\0"
+	"EIPI_SA_4_RESERVED3\0"
+	"EIPI_SA_4_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_4_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_4_INPKTSDELAYED_LO\0"
+	"EIPI_SA_4_INPKTSDELAYED_HI\0"
+	"EIPI_SA_4_INPKTSLATE_LO\0"
+	"EIPI_SA_4_INPKTSLATE_HI\0"
+	"EIPI_SA_4_INPKTSOK_LO\0"
+	"EIPI_SA_4_INPKTSOK_HI\0"
+	"EIPI_SA_4_INPKTSINVALID_LO\0"
+	"EIPI_SA_4_INPKTSINVALID_HI\0"
+	"EIPI_SA_4_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_4_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_4_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_4_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_4_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_4_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_4_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_4_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_5_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_5_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_5_RESERVED2\0"
+	"EIPI_SA_5_RESERVED3\0"
+	"EIPI_SA_5_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_5_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_5_INPKTSDELAYED_LO\0"
+	"EIPI_SA_5_INPKTSDELAYED_HI\0"
+	"EIPI_SA_5_INPKTSLATE_LO\0"
+	"EIPI_SA_5_INPKTSLATE_HI\0"
+	"EIPI_SA_5_INPKTSOK_LO\0"
+	"EIPI_SA_5_INPKTSOK_HI\0"
+	"EIPI_SA_5_INPKTSINVALID_LO\0"
+	"EIPI_SA_5_INPKTSINVALID_HI\0"
+	"EIPI_SA_5_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_5_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_5_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_5_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_5_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_5_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_5_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_5_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_6_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_6_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_6_RESERVED2\0"
+	"EIPI_SA_6_RESERVED3\0"
+	"EIPI_SA_6_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_6_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_6_INPKTSDELAYED_LO\0"
+	"EIPI_SA_6_INPKTSDELAYED_HI\0"
+	"EIPI_SA_6_INPKTSLATE_LO\0"
+	"EIPI_SA_6_INPKTSLATE_HI\0"
+	"EIPI_SA_6_INPKTSOK_LO\0"
+	"EIPI_SA_6_INPKTSOK_HI\0"
+	"EIPI_SA_6_INPKTSINVALID_LO\0"
+	"EIPI_SA_6_INPKTSINVALID_HI\0"
+	"EIPI_SA_6_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_6_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_6_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_6_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_6_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_6_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_6_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_6_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_7_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_7_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_7_RESERVED2\0"
+	"EIPI_SA_7_RESERVED3\0"
+	"EIPI_SA_7_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_7_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_7_INPKTSDELAYED_LO\0"
+	"EIPI_SA_7_INPKTSDELAYED_HI\0"
+	"EIPI_SA_7_INPKTSLATE_LO\0"
+	"EIPI_SA_7_INPKTSLATE_HI\0"
+	"EIPI_SA_7_INPKTSOK_LO\0"
+	"EIPI_SA_7_INPKTSOK_HI\0"
+	"EIPI_SA_7_INPKTSINVALID_LO\0"
+	"EIPI_SA_7_INPKTSINVALID_HI\0"
+	"EIPI_SA_7_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_7_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_7_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_7_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_7_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_7_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_7_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_7_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_8_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_8_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_8_RESERVED2\0"
+	"EIPI_SA_8_RESERVED3\0"
+	"EIPI_SA_8_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_8_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_8_INPKTSDELAYED_LO\0"
+	"EIPI_SA_8_INPKTSDELAYED_HI\0"
+	"EIPI_SA_8_INPKTSLATE_LO\0"
+	"EIPI_SA_8_INPKTSLATE_HI\0"
+	"EIPI_SA_8_INPKTSOK_LO\0"
+	"EIPI_SA_8_INPKTSOK_HI\0"
+	"EIPI_SA_8_INPKTSINVALID_LO\0"
+	"EIPI_SA_8_INPKTSINVALID_HI\0"
+	"EIPI_SA_8_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_8_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_8_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_8_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_8_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_8_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_8_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_8_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_9_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_9_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_9_RESERVED2\0"
+	"EIPI_SA_9_RESERVED3\0"
+	"EIPI_SA_9_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_9_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_9_INPKTSDELAYED_LO\0"
+	"EIPI_SA_9_INPKTSDELAYED_HI\0"
+	"EIPI_SA_9_INPKTSLATE_LO\0"
+	"EIPI_SA_9_INPKTSLATE_HI\0"
+	"EIPI_SA_9_INPKTSOK_LO\0"
+	"EIPI_SA_9_INPKTSOK_HI\0"
+	"EIPI_SA_9_INPKTSINVALID_LO\0"
+	"EIPI_SA_9_INPKTSINVALID_HI\0"
+	"EIPI_SA_9_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_9_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_9_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_9_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_9_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_9_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_9_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_9_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_10_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_10_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_10_RESERVED2\0"
+	"EIPI_SA_10_RESERVED3\0"
+	"EIPI_SA_10_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_10_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_10_INPKTSDELAYED_LO\0"
+	"EIPI_SA_10_INPKTSDELAYED_HI\0"
+	"EIPI_SA_10_INPKTSLATE_LO\0"
+	"EIPI_SA_10_INPKTSLATE_HI\0"
+	"EIPI_SA_10_INPKTSOK_LO\0"
+	"EIPI_SA_10_INPKTSOK_HI\0"
+	"EIPI_SA_10_INPKTSINVALID_LO\0"
+	"EIPI_SA_10_INPKTSINVALID_HI\0"
+	"EIPI_SA_10_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_10_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_10_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_10_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_10_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_10_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_10_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_10_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_11_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_11_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_11_RESERVED2\0"
+	"EIPI_SA_11_RESERVED3\0"
+	"EIPI_SA_11_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_11_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_11_INPKTSDELAYED_LO\0"
+	"EIPI_SA_11_INPKTSDELAYED_HI\0"
+	"EIPI_SA_11_INPKTSLATE_LO\0"
+	"EIPI_SA_11_INPKTSLATE_HI\0"
+	"EIPI_SA_11_INPKTSOK_LO\0"
+	"EIPI_SA_11_INPKTSOK_HI\0"
+	"EIPI_SA_11_INPKTSINVALID_LO\0"
+	"EIPI_SA_11_INPKTSINVALID_HI\0"
+	"EIPI_SA_11_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_11_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_11_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_11_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_11_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_11_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_11_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_11_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_12_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_12_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_12_RESERVED2\0"
+	"EIPI_SA_12_RESERVED3\0"
+	"EIPI_SA_12_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_12_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_12_INPKTSDELAYED_LO\0"
+	"EIPI_SA_12_INPKTSDELAYED_HI\0"
+	"EIPI_SA_12_INPKTSLATE_LO\0"
+	"EIPI_SA_12_INPKTSLATE_HI\0"
+	"EIPI_SA_12_INPKTSOK_LO\0"
+	"EIPI_SA_12_INPKTSOK_HI\0"
+	"EIPI_SA_12_INPKTSINVALID_LO\0"
+	"EIPI_SA_12_INPKTSINVALID_HI\0"
+	"EIPI_SA_12_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_12_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_12_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_12_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_12_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_12_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_12_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_12_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_13_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_13_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_13_RESERVED2\0"
+	"EIPI_SA_13_RESERVED3\0"
+	"EIPI_SA_13_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_13_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_13_INPKTSDELAYED_LO\0"
+	"EIPI_SA_13_INPKTSDELAYED_HI\0"
+	"EIPI_SA_13_INPKTSLATE_LO\0"
+	"EIPI_SA_13_INPKTSLATE_HI\0"
+	"EIPI_SA_13_INPKTSOK_LO\0"
+	"EIPI_SA_13_INPKTSOK_HI\0"
+	"EIPI_SA_13_INPKTSINVALID_LO\0"
+	"EIPI_SA_13_INPKTSINVALID_HI\0"
+	"EIPI_SA_13_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_13_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_13_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_13_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_13_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_13_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_13_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_13_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_14_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_14_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_14_RESERVED2\0"
+	"EIPI_SA_14_RESERVED3\0"
+	"EIPI_SA_14_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_14_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_14_INPKTSDELAYED_LO\0"
+	"EIPI_SA_14_INPKTSDELAYED_HI\0"
+	"EIPI_SA_14_INPKTSLATE_LO\0"
+	"EIPI_SA_14_INPKTSLATE_HI\0"
+	"EIPI_SA_14_INPKTSOK_LO\0"
+	"EIPI_SA_14_INPKTSOK_HI\0"
+	"EIPI_SA_14_INPKTSINVALID_LO\0"
+	"EIPI_SA_14_INPKTSINVALID_HI\0"
+	"EIPI_SA_14_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_14_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_14_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_14_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_14_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_14_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_14_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_14_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_15_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_15_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_15_RESERVED2\0"
+	"EIPI_SA_15_RESERVED3\0"
+	"EIPI_SA_15_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_15_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_15_INPKTSDELAYED_LO\0"
+	"EIPI_SA_15_INPKTSDELAYED_HI\0"
+	"EIPI_SA_15_INPKTSLATE_LO\0"
+	"EIPI_SA_15_INPKTSLATE_HI\0"
+	"EIPI_SA_15_INPKTSOK_LO\0"
+	"EIPI_SA_15_INPKTSOK_HI\0"
+	"EIPI_SA_15_INPKTSINVALID_LO\0"
+	"EIPI_SA_15_INPKTSINVALID_HI\0"
+	"EIPI_SA_15_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_15_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_15_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_15_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_15_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_15_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_15_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_15_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_16_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_16_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_16_RESERVED2\0"
+	"EIPI_SA_16_RESERVED3\0"
+	"EIPI_SA_16_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_16_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_16_INPKTSDELAYED_LO\0"
+	"EIPI_SA_16_INPKTSDELAYED_HI\0"
+	"EIPI_SA_16_INPKTSLATE_LO\0"
+	"EIPI_SA_16_INPKTSLATE_HI\0"
+	"EIPI_SA_16_INPKTSOK_LO\0"
+	"EIPI_SA_16_INPKTSOK_HI\0"
+	"EIPI_SA_16_INPKTSINVALID_LO\0"
+	"EIPI_SA_16_INPKTSINVALID_HI\0"
+	"EIPI_SA_16_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_16_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_16_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_16_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_16_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_16_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_16_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_16_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_17_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_17_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_17_RESERVED2\0"
+	"EIPI_SA_17_RESERVED3\0"
+	"EIPI_SA_17_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_17_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_17_INPKTSDELAYED_LO\0"
+	"EIPI_SA_17_INPKTSDELAYED_HI\0"
+	"EIPI_SA_17_INPKTSLATE_LO\0"
+	"EIPI_SA_17_INPKTSLATE_HI\0"
+	"EIPI_SA_17_INPKTSOK_LO\0"
+	"EIPI_SA_17_INPKTSOK_HI\0"
+	"EIPI_SA_17_INPKTSINVALID_LO\0"
+	"EIPI_SA_17_INPKTSINVALID_HI\0"
+	"EIPI_SA_17_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_17_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_17_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_17_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_17_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_17_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_17_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_17_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_18_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_18_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_18_RESERVED2\0"
+	"EIPI_SA_18_RESERVED3\0"
+	"EIPI_SA_18_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_18_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_18_INPKTSDELAYED_LO\0"
+	"EIPI_SA_18_INPKTSDELAYED_HI\0"
+	"EIPI_SA_18_INPKTSLATE_LO\0"
+	"EIPI_SA_18_INPKTSLATE_HI\0"
+	"EIPI_SA_18_INPKTSOK_LO\0"
+	"EIPI_SA_18_INPKTSOK_HI\0"
+	"EIPI_SA_18_INPKTSINVALID_LO\0"
+	"EIPI_SA_18_INPKTSINVALID_HI\0"
+	"EIPI_SA_18_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_18_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_18_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_18_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_18_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_18_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_18_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_18_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_19_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_19_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_19_RESERVED2\0"
+	"EIPI_SA_19_RESERVED3\0"
+	"EIPI_SA_19_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_19_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_19_INPKTSDELAYED_LO\0"
+	"EIPI_SA_19_INPKTSDELAYED_HI\0"
+	"EIPI_SA_19_INPKTSLATE_LO\0"
+	"EIPI_SA_19_INPKTSLATE_HI\0"
+	"EIPI_SA_19_INPKTSOK_LO\0"
+	"EIPI_SA_19_INPKTSOK_HI\0"
+	"EIPI_SA_19_INPKTSINVALID_LO\0"
+	"EIPI_SA_19_INPKTSINVALID_HI\0"
+	"EIPI_SA_19_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_19_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_19_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_19_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_19_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_19_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_19_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_19_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_20_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_20_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_20_RESERVED2\0"
+	"EIPI_SA_20_RESERVED3\0"
+	"EIPI_SA_20_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_20_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_20_INPKTSDELAYED_LO\0"
+	"EIPI_SA_20_INPKTSDELAYED_HI\0"
+	"EIPI_SA_20_INPKTSLATE_LO\0"
+	"EIPI_SA_20_INPKTSLATE_HI\0"
+	"EIPI_SA_20_INPKTSOK_LO\0"
+	"EIPI_SA_20_INPKTSOK_HI\0"
+	"EIPI_SA_20_INPKTSINVALID_LO\0"
+	"EIPI_SA_20_INPKTSINVALID_HI\0"
+	"EIPI_SA_20_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_20_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_20_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_20_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_20_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_20_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_20_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_20_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_21_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_21_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_21_RESERVED2\0"
+	"EIPI_SA_21_RESERVED3\0"
+	"EIPI_SA_21_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_21_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_21_INPKTSDELAYED_LO\0"
+	"EIPI_SA_21_INPKTSDELAYED_HI\0"
+	"EIPI_SA_21_INPKTSLATE_LO\0"
+	"EIPI_SA_21_INPKTSLATE_HI\0"
+	"EIPI_SA_21_INPKTSOK_LO\0"
+	"EIPI_SA_21_INPKTSOK_HI\0"
+	"EIPI_SA_21_INPKTSINVALID_LO\0"
+	"EIPI_SA_21_INPKTSINVALID_HI\0"
+	"EIPI_SA_21_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_21_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_21_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_21_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_21_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_21_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_21_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_21_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_22_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_22_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_22_RESERVED2\0"
+	"EIPI_SA_22_RESERVED3\0"
+	"EIPI_SA_22_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_22_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_22_INPKTSDELAYED_LO\0"
+	"EIPI_SA_22_INPKTSDELAYED_HI\0"
+	"EIPI_SA_22_INPKTSLATE_LO\0"
+	"EIPI_SA_22_INPKTSLATE_HI\0"
+	"EIPI_SA_22_INPKTSOK_LO\0"
+	"EIPI_SA_22_INPKTSOK_HI\0"
+	"EIPI_SA_22_INPKTSINVALID_LO\0"
+	"EIPI_SA_22_INPKTSINVALID_HI\0"
+	"EIPI_SA_22_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_22_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_22_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_22_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_22_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_22_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_22_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_22_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_23_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_23_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_23_RESERVED2\0"
+	"EIPI_SA_23_RESERVED3\0"
+	"EIPI_SA_23_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_23_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_23_INPKTSDELAYED_LO\0"
+	"EIPI_SA_23_INPKTSDELAYED_HI\0"
+	"EIPI_SA_23_INPKTSLATE_LO\0"
+	"EIPI_SA_23_INPKTSLATE_HI\0"
+	"EIPI_SA_23_INPKTSOK_LO\0"
+	"EIPI_SA_23_INPKTSOK_HI\0"
+	"EIPI_SA_23_INPKTSINVALID_LO\0"
+	"EIPI_SA_23_INPKTSINVALID_HI\0"
+	"EIPI_SA_23_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_23_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_23_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_23_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_23_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_23_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_23_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_23_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_24_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_24_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_24_RESERVED2\0"
+	"EIPI_SA_24_RESERVED3\0"
+	"EIPI_SA_24_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_24_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_24_INPKTSDELAYED_LO\0"
+	"EIPI_SA_24_INPKTSDELAYED_HI\0"
+	"EIPI_SA_24_INPKTSLATE_LO\0"
+	"EIPI_SA_24_INPKTSLATE_HI\0"
+	"EIPI_SA_24_INPKTSOK_LO\0"
+	"EIPI_SA_24_INPKTSOK_HI\0"
+	"EIPI_SA_24_INPKTSINVALID_LO\0"
+	"EIPI_SA_24_INPKTSINVALID_HI\0"
+	"EIPI_SA_24_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_24_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_24_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_24_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_24_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_24_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_24_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_24_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_25_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_25_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_25_RESERVED2\0"
+	"EIPI_SA_25_RESERVED3\0"
+	"EIPI_SA_25_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_25_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_25_INPKTSDELAYED_LO\0"
+	"EIPI_SA_25_INPKTSDELAYED_HI\0"
+	"EIPI_SA_25_INPKTSLATE_LO\0"
+	"EIPI_SA_25_INPKTSLATE_HI\0"
+	"EIPI_SA_25_INPKTSOK_LO\0"
+	"EIPI_SA_25_INPKTSOK_HI\0"
+	"EIPI_SA_25_INPKTSINVALID_LO\0"
+	"EIPI_SA_25_INPKTSINVALID_HI\0"
+	"EIPI_SA_25_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_25_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_25_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_25_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_25_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_25_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_25_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_25_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_26_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_26_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_26_RESERVED2\0"
+	"EIPI_SA_26_RESERVED3\0"
+	"EIPI_SA_26_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_26_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_26_INPKTSDELAYED_LO\0"
+	"EIPI_SA_26_INPKTSDELAYED_HI\0"
+	"EIPI_SA_26_INPKTSLATE_LO\0"
+	"EIPI_SA_26_INPKTSLATE_HI\0"
+	"EIPI_SA_26_INPKTSOK_LO\0"
+	"EIPI_SA_26_INPKTSOK_HI\0"
+	"EIPI_SA_26_INPKTSINVALID_LO\0"
+	"EIPI_SA_26_INPKTSINVALID_HI\0"
+	"EIPI_SA_26_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_26_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_26_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_26_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_26_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_26_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_26_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_26_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_27_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_27_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_27_RESERVED2\0"
+	"EIPI_SA_27_RESERVED3\0"
+	"EIPI_SA_27_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_27_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_27_INPKTSDELAYED_LO\0"
+	"EIPI_SA_27_INPKTSDELAYED_HI\0"
+	"EIPI_SA_27_INPKTSLATE_LO\0"
+	"EIPI_SA_27_INPKTSLATE_HI\0"
+	"EIPI_SA_27_INPKTSOK_LO\0"
+	"EIPI_SA_27_INPKTSOK_HI\0"
+	"EIPI_SA_27_INPKTSINVALID_LO\0"
+	"EIPI_SA_27_INPKTSINVALID_HI\0"
+	"EIPI_SA_27_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_27_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_27_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_27_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_27_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_27_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_27_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_27_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_28_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_28_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_28_RESERVED2\0"
+	"EIPI_SA_28_RESERVED3\0"
+	"EIPI_SA_28_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_28_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_28_INPKTSDELAYED_LO\0"
+	"EIPI_SA_28_INPKTSDELAYED_HI\0"
+	"EIPI_SA_28_INPKTSLATE_LO\0"
+	"EIPI_SA_28_INPKTSLATE_HI\0"
+	"EIPI_SA_28_INPKTSOK_LO\0"
+	"EIPI_SA_28_INPKTSOK_HI\0"
+	"EIPI_SA_28_INPKTSINVALID_LO\0"
+	"EIPI_SA_28_INPKTSINVALID_HI\0"
+	"EIPI_SA_28_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_28_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_28_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_28_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_28_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_28_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_28_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_28_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_29_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_29_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_29_RESERVED2\0"
+	"EIPI_SA_29_RESERVED3\0"
+	"EIPI_SA_29_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_29_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_29_INPKTSDELAYED_LO\0"
+	"EIPI_SA_29_INPKTSDELAYED_HI\0"
+	"EIPI_SA_29_INPKTSLATE_LO\0"
+	"EIPI_SA_29_INPKTSLATE_HI\0"
+	"EIPI_SA_29_INPKTSOK_LO\0"
+	"EIPI_SA_29_INPKTSOK_HI\0"
+	"EIPI_SA_29_INPKTSINVALID_LO\0"
+	"EIPI_SA_29_INPKTSINVALID_HI\0"
+	"EIPI_SA_29_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_29_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_29_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_29_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_29_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_29_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_29_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_29_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_30_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_30_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_30_RESERVED2\0"
+	"EIPI_SA_30_RESERVED3\0"
+	"EIPI_SA_30_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_30_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_30_INPKTSDELAYED_LO\0"
+	"EIPI_SA_30_INPKTSDELAYED_HI\0"
+	"EIPI_SA_30_INPKTSLATE_LO\0"
+	"EIPI_SA_30_INPKTSLATE_HI\0"
+	"EIPI_SA_30_INPKTSOK_LO\0"
+	"EIPI_SA_30_INPKTSOK_HI\0"
+	"EIPI_SA_30_INPKTSINVALID_LO\0"
+	"EIPI_SA_30_INPKTSINVALID_HI\0"
+	"EIPI_SA_30_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_30_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_30_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_30_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_30_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_30_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_30_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_30_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_SA_31_INOCTETSDECRYPTEDVALIDATED_LO\0"
+	"EIPI_SA_31_INOCTETSDECRYPTEDVALIDATED_HI\0"
+	"EIPI_SA_31_RESERVED2\0"
+	"EIPI_SA_31_RESERVED3\0"
+	"EIPI_SA_31_INPKTSUNCHECKED_LO\0"
+	"EIPI_SA_31_INPKTSUNCHECKED_HI\0"
+	"EIPI_SA_31_INPKTSDELAYED_LO\0"
+	"EIPI_SA_31_INPKTSDELAYED_HI\0"
+	"EIPI_SA_31_INPKTSLATE_LO\0"
+	"EIPI_SA_31_INPKTSLATE_HI\0"
+	"EIPI_SA_31_INPKTSOK_LO\0"
+	"EIPI_SA_31_INPKTSOK_HI\0"
+	"EIPI_SA_31_INPKTSINVALID_LO\0"
+	"EIPI_SA_31_INPKTSINVALID_HI\0"
+	"EIPI_SA_31_INPKTSNOTVALID_LO\0"
+	"EIPI_SA_31_INPKTSNOTVALID_HI\0"
+	"EIPI_SA_31_INPKTSNOTUSINGSA_LO\0"
+	"EIPI_SA_31_INPKTSNOTUSINGSA_HI\0"
+	"EIPI_SA_31_INPKTSUNUSEDSA_LO\0"
+	"EIPI_SA_31_INPKTSUNUSEDSA_HI\0"
+	"EIPI_SA_31_INPKTSUNTAGGEDHIT_LO\0"
+	"EIPI_SA_31_INPKTSUNTAGGEDHIT_HI\0"
+	"EIPI_VLAN_UP_0_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_0_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_0_RESERVED2\0"
+	"EIPI_VLAN_UP_0_RESERVED3\0"
+	"EIPI_VLAN_UP_0_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_0_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_0_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_0_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_0_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_0_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_1_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_1_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_1_RESERVED2\0"
+	"EIPI_VLAN_UP_1_RESERVED3\0"
+	"EIPI_VLAN_UP_1_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_1_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_1_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_1_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_1_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_1_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_2_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_2_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_2_RESERVED2\0"
+	"EIPI_VLAN_UP_2_RESERVED3\0"
+	"EIPI_VLAN_UP_2_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_2_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_2_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_2_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_2_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_2_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_3_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_3_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_3_RESERVED2\0"
+	"EIPI_VLAN_UP_3_RESERVED3\0"
+	"EIPI_VLAN_UP_3_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_3_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_3_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_3_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_3_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_3_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_4_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_4_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_4_RESERVED2\0"
+	"EIPI_VLAN_UP_4_RESERVED3\0"
+	"EIPI_VLAN_UP_4_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_4_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_4_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_4_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_4_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_4_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_5_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_5_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_5_RESERVED2\0"
+	"EIPI_VLAN_UP_5_RESERVED3\0"
+	"EIPI_VLAN_UP_5_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_5_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_5_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_5_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_5_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_5_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_6_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_6_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_6_RESERVED2\0"
+	"EIPI_VLAN_UP_6_RESERVED3\0"
+	"EIPI_VLAN_UP_6_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_6_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_6_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_6_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_6_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_6_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_VLAN_UP_7_INOCTETSVL_LO\0"
+	"EIPI_VLAN_UP_7_INOCTETSVL_HI\0"
+	"EIPI_VLAN_UP_7_RESERVED2\0"
+	"EIPI_VLAN_UP_7_RESERVED3\0"
+	"EIPI_VLAN_UP_7_INPKTSVL_LO\0"
+	"EIPI_VLAN_UP_7_INPKTSVL_HI\0"
+	"EIPI_VLAN_UP_7_INDROPPEDPKTSVL_LO\0"
+	"EIPI_VLAN_UP_7_INDROPPEDPKTSVL_HI\0"
+	"EIPI_VLAN_UP_7_INOVERSIZEPKTSVL_LO\0"
+	"EIPI_VLAN_UP_7_INOVERSIZEPKTSVL_HI\0"
+	"EIPI_TRANSFORMERRORPKTS_LO\0"
+	"EIPI_TRANSFORMERRORPKTS_HI\0"
+	"EIPI_INPKTSCTRL_LO\0"
+	"EIPI_INPKTSCTRL_HI\0"
+	"EIPI_INPKTSNOTAG_LO\0"
+	"EIPI_INPKTSNOTAG_HI\0"
+	"EIPI_INPKTSUNTAGGED_LO\0"
+	"EIPI_INPKTSUNTAGGED_HI\0"
+	"EIPI_INPKTSTAGGED_LO\0"
+	"EIPI_INPKTSTAGGED_HI\0"
+	"EIPI_INPKTSBADTAG_LO\0"
+	"EIPI_INPKTSBADTAG_HI\0"
+	"EIPI_INPKTSUNTAGGEDMISS_LO\0"
+	"EIPI_INPKTSUNTAGGEDMISS_HI\0"
+	"EIPI_INPKTSNOSCI_LO\0"
+	"EIPI_INPKTSNOSCI_HI\0"
+	"EIPI_INPKTSUNKNOWNSCI_LO\0"
+	"EIPI_INPKTSUNKNOWNSCI_HI\0"
+	"EIPI_INCONSISTCHECKCONTROLLEDNOTPASS_LO\0"
+	"EIPI_INCONSISTCHECKCONTROLLEDNOTPASS_HI\0"
+	"EIPI_INCONSISTCHECKUNCONTROLLEDNOTPASS_LO\0"
+	"EIPI_INCONSISTCHECKUNCONTROLLEDNOTPASS_HI\0"
+	"EIPI_INCONSISTCHECKCONTROLLEDPASS_LO\0"
+	"EIPI_INCONSISTCHECKCONTROLLEDPASS_HI\0"
+	"EIPI_INCONSISTCHECKUNCONTROLLEDPASS_LO\0"
+	"EIPI_INCONSISTCHECKUNCONTROLLEDPASS_HI\0"
+	"EIPI_INOVERSIZEPKTS_LO\0"
+	"EIPI_INOVERSIZEPKTS_HI\0"
+	"SA_INCREMENT_MASK\0"
+	"SA_OCTET_INCREMENT\0"
+	"EIPI_COUNT_DEBUG1\0"
+	"VLAN_INCREMENT_MASK\0"
+	"VLAN_OCTET_INCREMENT\0"
+	"EIPI_COUNT_DEBUG2\0"
+	"GLOBAL_INCREMENT_MASK\0"
+	"EIPI_COUNT_DEBUG3\0"
+	"SA_TEST\0"
+	"VLAN_TEST\0"
+	"GLOBAL_TEST\0"
+	"GLOBAL_OCTET_INCREMENT\0"
+	"EIPI_COUNT_DEBUG4\0"
+	"RESET_ALL\0"
+	"DEBUG_ACCESS\0"
+	"SATURATE_CNTRS\0"
+	"AUTO_CNTR_RESET\0"
+	"RESET_SUMMARY\0"
+	"EIPI_COUNT_CONTROL\0"
+	"SA_INCREMENT_ENABLE\0"
+	"VLAN_INCREMENT_ENABLE\0"
+	"EIPI_COUNT_INCEN1\0"
+	"GLOBAL_INCREMENT_ENABLE\0"
+	"EIPI_COUNT_INCEN2\0"
+	"COUNT_FRAME_THR_31_0\0"
+	"EIPI_COUNT_FRAME_THR1\0"
+	"COUNT_FRAME_THR_63_32\0"
+	"EIPI_COUNT_FRAME_THR2\0"
+	"COUNT_OCTET_THR_31_0\0"
+	"EIPI_COUNT_OCTET_THR1\0"
+	"COUNT_OCTET_THR_63_32\0"
+	"EIPI_COUNT_OCTET_THR2\0"
+	"GLOBAL_CNT\0"
+	"EIPI_COUNT_SUMMARY_GL\0"
+	"VLAN_CNT0\0"
+	"VLAN_CNT1\0"
+	"VLAN_CNT2\0"
+	"VLAN_CNT3\0"
+	"EIPI_COUNT_SUMMARY_VL1\0"
+	"VLAN_CNT4\0"
+	"EIPI_COUNT_SUMMARY_VL2\0"
+	"SA_31_0\0"
+	"EIPI_COUNT_SUMMARY_PSA1\0"
+	"SA_CNT\0"
+	"EIPI_COUNT_SUMMARY_SA0\0"
+	"EIPI_COUNT_SUMMARY_SA1\0"
+	"EIPI_COUNT_SUMMARY_SA2\0"
+	"EIPI_COUNT_SUMMARY_SA3\0"
+	"EIPI_COUNT_SUMMARY_SA4\0"
+	"EIPI_COUNT_SUMMARY_SA5\0"
+	"EIPI_COUNT_SUMMARY_SA6\0"
+	"EIPI_COUNT_SUMMARY_SA7\0"
+	"EIPI_COUNT_SUMMARY_SA8\0"
+	"EIPI_COUNT_SUMMARY_SA9\0"
+	"EIPI_COUNT_SUMMARY_SA10\0"
+	"EIPI_COUNT_SUMMARY_SA11\0"
+	"EIPI_COUNT_SUMMARY_SA12\0"
+	"EIPI_COUNT_SUMMARY_SA13\0"
+	"EIPI_COUNT_SUMMARY_SA14\0"
+	"EIPI_COUNT_SUMMARY_SA15\0"
+	"EIPI_COUNT_SUMMARY_SA16\0"
+	"EIPI_COUNT_SUMMARY_SA17\0"
+	"EIPI_COUNT_SUMMARY_SA18\0"
+	"EIPI_COUNT_SUMMARY_SA19\0"
+	"EIPI_COUNT_SUMMARY_SA20\0"
+	"EIPI_COUNT_SUMMARY_SA21\0"
+	"EIPI_COUNT_SUMMARY_SA22\0"
+	"EIPI_COUNT_SUMMARY_SA23\0"
+	"EIPI_COUNT_SUMMARY_SA24\0"
+	"EIPI_COUNT_SUMMARY_SA25\0"
+	"EIPI_COUNT_SUMMARY_SA26\0"
+	"EIPI_COUNT_SUMMARY_SA27\0"
+	"EIPI_COUNT_SUMMARY_SA28\0"
+	"EIPI_COUNT_SUMMARY_SA29\0"
+	"EIPI_COUNT_SUMMARY_SA30\0"
+	"EIPI_COUNT_SUMMARY_SA31\0"
+	"PAYLOAD_E_TYPE\0"
+	"EIPI_IG_CC_ENTRY_LO_0\0"
+	"SAI_HIT\0"
+	"ETYPE_VALID\0"
+	"CTRL_PACKET\0"
+	"SA_HIT_MASK\0"
+	"SA_NR_MASK\0"
+	"VLAN_VALID_MASK\0"
+	"ETYPE_VALID_MASK\0"
+	"PAYL_ETYPE_MASK\0"
+	"RULE_NR_MASK\0"
+	"MATCH_ACTION\0"
+	"SA_OR_RULE_NR\0"
+	"RULE_HIT_MASK\0"
+	"EIPI_IG_CC_ENTRY_HI_0\0"
+	"EIPI_IG_CC_ENTRY2_0\0"
+	"EIPI_IG_CC_ENTRY_LO_1\0"
+	"EIPI_IG_CC_ENTRY_HI_1\0"
+	"EIPI_IG_CC_ENTRY2_1\0"
+	"EIPI_IG_CC_ENTRY_LO_2\0"
+	"EIPI_IG_CC_ENTRY_HI_2\0"
+	"EIPI_IG_CC_ENTRY2_2\0"
+	"EIPI_IG_CC_ENTRY_LO_3\0"
+	"EIPI_IG_CC_ENTRY_HI_3\0"
+	"EIPI_IG_CC_ENTRY2_3\0"
+	"EIPI_IG_CC_ENTRY_LO_4\0"
+	"EIPI_IG_CC_ENTRY_HI_4\0"
+	"EIPI_IG_CC_ENTRY2_4\0"
+	"EIPI_IG_CC_ENTRY_LO_5\0"
+	"EIPI_IG_CC_ENTRY_HI_5\0"
+	"EIPI_IG_CC_ENTRY2_5\0"
+	"EIPI_IG_CC_ENTRY_LO_6\0"
+	"EIPI_IG_CC_ENTRY_HI_6\0"
+	"EIPI_IG_CC_ENTRY2_6\0"
+	"EIPI_IG_CC_ENTRY_LO_7\0"
+	"EIPI_IG_CC_ENTRY_HI_7\0"
+	"EIPI_IG_CC_ENTRY2_7\0"
+	"EIPI_IG_CC_ENTRY_LO_8\0"
+	"EIPI_IG_CC_ENTRY_HI_8\0"
+	"EIPI_IG_CC_ENTRY2_8\0"
+	"EIPI_IG_CC_ENTRY_LO_9\0"
+	"EIPI_IG_CC_ENTRY_HI_9\0"
+	"EIPI_IG_CC_ENTRY2_9\0"
+	"EIPI_IG_CC_ENTRY_LO_10\0"
+	"EIPI_IG_CC_ENTRY_HI_10\0"
+	"EIPI_IG_CC_ENTRY2_10\0"
+	"EIPI_IG_CC_ENTRY_LO_11\0"
+	"EIPI_IG_CC_ENTRY_HI_11\0"
+	"EIPI_IG_CC_ENTRY2_11\0"
+	"EIPI_IG_CC_ENTRY_LO_12\0"
+	"EIPI_IG_CC_ENTRY_HI_12\0"
+	"EIPI_IG_CC_ENTRY2_12\0"
+	"EIPI_IG_CC_ENTRY_LO_13\0"
+	"EIPI_IG_CC_ENTRY_HI_13\0"
+	"EIPI_IG_CC_ENTRY2_13\0"
+	"EIPI_IG_CC_ENTRY_LO_14\0"
+	"EIPI_IG_CC_ENTRY_HI_14\0"
+	"EIPI_IG_CC_ENTRY2_14\0"
+	"EIPI_IG_CC_ENTRY_LO_15\0"
+	"EIPI_IG_CC_ENTRY_HI_15\0"
+	"EIPI_IG_CC_ENTRY2_15\0"
+	"EIPI_IG_CC_ENTRY_LO_16\0"
+	"EIPI_IG_CC_ENTRY_HI_16\0"
+	"EIPI_IG_CC_ENTRY2_16\0"
+	"EIPI_IG_CC_ENTRY_LO_17\0"
+	"EIPI_IG_CC_ENTRY_HI_17\0"
+	"EIPI_IG_CC_ENTRY2_17\0"
+	"EIPI_IG_CC_ENTRY_LO_18\0"
+	"EIPI_IG_CC_ENTRY_HI_18\0"
+	"EIPI_IG_CC_ENTRY2_18\0"
+	"EIPI_IG_CC_ENTRY_LO_19\0"
+	"EIPI_IG_CC_ENTRY_HI_19\0"
+	"EIPI_IG_CC_ENTRY2_19\0"
+	"EIPI_IG_CC_ENTRY_LO_20\0"
+	"EIPI_IG_CC_ENTRY_HI_20\0"
+	"EIPI_IG_CC_ENTRY2_20\0"
+	"EIPI_IG_CC_ENTRY_LO_21\0"
+	"EIPI_IG_CC_ENTRY_HI_21\0"
+	"EIPI_IG_CC_ENTRY2_21\0"
+	"EIPI_IG_CC_ENTRY_LO_22\0"
+	"EIPI_IG_CC_ENTRY_HI_22\0"
+	"EIPI_IG_CC_ENTRY2_22\0"
+	"EIPI_IG_CC_ENTRY_LO_23\0"
+	"EIPI_IG_CC_ENTRY_HI_23\0"
+	"EIPI_IG_CC_ENTRY2_23\0"
+	"EIPI_IG_CC_ENTRY_LO_24\0"
+	"EIPI_IG_CC_ENTRY_HI_24\0"
+	"EIPI_IG_CC_ENTRY2_24\0"
+	"EIPI_IG_CC_ENTRY_LO_25\0"
+	"EIPI_IG_CC_ENTRY_HI_25\0"
+	"EIPI_IG_CC_ENTRY2_25\0"
+	"EIPI_IG_CC_ENTRY_LO_26\0"
+	"EIPI_IG_CC_ENTRY_HI_26\0"
+	"EIPI_IG_CC_ENTRY2_26\0"
+	"EIPI_IG_CC_ENTRY_LO_27\0"
+	"EIPI_IG_CC_ENTRY_HI_27\0"
+	"EIPI_IG_CC_ENTRY2_27\0"
+	"EIPI_IG_CC_ENTRY_LO_28\0"
+	"EIPI_IG_CC_ENTRY_HI_28\0"
+	"EIPI_IG_CC_ENTRY2_28\0"
+	"EIPI_IG_CC_ENTRY_LO_29\0"
+	"EIPI_IG_CC_ENTRY_HI_29\0"
+	"EIPI_IG_CC_ENTRY2_29\0"
+	"EIPI_IG_CC_ENTRY_LO_30\0"
+	"EIPI_IG_CC_ENTRY_HI_30\0"
+	"EIPI_IG_CC_ENTRY2_30\0"
+	"EIPI_IG_CC_ENTRY_LO_31\0"
+	"EIPI_IG_CC_ENTRY_HI_31\0"
+	"EIPI_IG_CC_ENTRY2_31\0"
+	"EIPI_IG_CC_ENABLE1\0"
+	"NON_MATCH_CTRL_ACT\0"
+	"NON_MATCH_ACT\0"
+	"EIPI_IG_CC_CONTROL\0"
+	"CP_ETYPE_MAX_LEN\0"
+	"EIPI_IG_CC_TAGS\0"
+	"CC_INDEX_SET\0"
+	"CC_INDEX_CLEAR\0"
+	"EIPI_CC_ENTRY_ENABLE_CTRL\0"
+	"STAQ_UP_EN\0"
+	"EIPI_IG_CP_TAG\0"
+	"EIPI_IG_PP_TAGS\0"
+	"EIPI_IG_PP_TAGS2\0"
+	"EIPI_IG_CP_TAG2\0"
+	"EIPI_IG_CC_DEBUG_1\0"
+	"CONTROL_PKT\0"
+	"PARSED_ETYPE_VALID\0"
+	"CC_HIT\0"
+	"ACTION_TAKEN\0"
+	"MATCH_INDEX\0"
+	"EIPI_IG_CC_DEBUG_2\0"
+	"SA_ID\0"
+	"EIPI_IG_CC_DEBUG_3\0"
+	"EIPI_IG_CC_DEBUG_MATCH1\0"
+	"MTU_COMPARE\0"
+	"MTU_COMP_DROP\0"
+	"EIPI_VLAN_MTU_CHECK_0\0"
+	"EIPI_VLAN_MTU_CHECK_1\0"
+	"EIPI_VLAN_MTU_CHECK_2\0"
+	"EIPI_VLAN_MTU_CHECK_3\0"
+	"EIPI_VLAN_MTU_CHECK_4\0"
+	"EIPI_VLAN_MTU_CHECK_5\0"
+	"EIPI_VLAN_MTU_CHECK_6\0"
+	"EIPI_VLAN_MTU_CHECK_7\0"
+	"EIPI_NON_VLAN_MTU_CHECK\0"
+	"SA_SECFAIL_MASK\0"
+	"VLAN_CNTR_UPDATE\0"
+	"GATE_CONS_CHECK\0"
+	"ERROR_MASK\0"
+	"EIPI_COUNT_SECFAIL1\0"
+	"GLOBAL_SECFAIL_MASK\0"
+	"EIPI_COUNT_SECFAIL2\0"
+	"RESULT_TOKEN_WORDS\0"
+	"EIPI_CRYPTO_RSLT_DEBUG_0\0"
+	"EIPI_CRYPTO_RSLT_DEBUG_1\0"
+	"EIPI_CRYPTO_RSLT_DEBUG_2\0"
+	"PACKET_COUNT\0"
+	"PP_RESULTACTION\0"
+	"EIPI_CRYPTO_DEBUG_CNTR\0"
+	"IG_DROP_ENABLE\0"
+	"EG_DROP_ENABLE\0"
+	"GL_DROP_ENABLE\0"
+	"EIPI_DBG_PP_DROP_ENABLE\0"
+	"IG_DROP_FLAGS\0"
+	"EG_DROP_FLAGS\0"
+	"OID_DROP_OPERATION\0"
+	"TRANSFORM_ERROR\0"
+	"RES_OUT\0"
+	"EIPI_DBG_PP_DROP_STATUS\0"
+	"TOKEN_LOCATION_AVAILABLE\0"
+	"EIPI_EIP62_TOKEN_CTRL_STAT\0"
+	"HASH_ONLY_NULL\0"
+	"ENCRYPT_ONLY\0"
+	"HASH_ENCRYPT\0"
+	"HASH_DECRYPT\0"
+	"ENCRYPT_HASH\0"
+	"DECRYPT_HASH\0"
+	"KEY_128_BIT\0"
+	"KEY_256_BIT\0"
+	"AES_ECB\0"
+	"AES_CBC\0"
+	"AES_CTR_ICM\0"
+	"AES_OFB\0"
+	"AES_CFB\0"
+	"AES_XCBC_MAC\0"
+	"GCM_HASH\0"
+	"EIPI_EIP62_PROT_ALG_EN\0"
+	"CONTEXT_SIZE\0"
+	"ADDRESS_MODE\0"
+	"CONTROL_MODE\0"
+	"MACSEC_ETHERTYPE\0"
+	"EIPI_EIP62_CONTEXT_CTRL\0"
+	"ERROR\0"
+	"ACTIVE_TOKENS\0"
+	"ACTIVE_CONTEXT\0"
+	"NEXT_CONTEXT\0"
+	"RESULT_CONTEXT\0"
+	"ERROR_RECOVERY\0"
+	"INPUT_FRAME_CURRENT_STATE\0"
+	"EIPI_EIP62_CONTEXT_STAT\0"
+	"INPUT_ERROR\0"
+	"OUTPUT_ERROR\0"
+	"PROCESSING\0"
+	"CONTEXT_ERROR\0"
+	"OUTB_SEQNUM_THRESHOLD\0"
+	"OUTB_SEQNUM_ROLLOVER\0"
+	"FATAL_ERROR\0"
+	"INTERRUPT_OUT\0"
+	"INPUT_ERROR_EN\0"
+	"OUTPUT_ERROR_EN\0"
+	"PROCESSING_EN\0"
+	"CONTEXT_ERROR_EN\0"
+	"OUTB_SEQNUM_THRESHOLD_EN\0"
+	"OUTB_SEQNUM_ROLLOVER_EN\0"
+	"FATAL_ERROR_EN\0"
+	"INTERRUPT_OUT_EN\0"
+	"EIPI_EIP62_INT_CTRL_STAT\0"
+	"SW_INTERRUPT\0"
+	"EIPI_EIP62_SW_INTERRUPT\0"
+	"EIPI_EIP62_SEQ_NUM_THRESHOLD\0"
+	"EIPI_EIP62_SEQ_NUM_THRESHOLD64_LO\0"
+	"EIPI_EIP62_SEQ_NUM_THRESHOLD64_HI\0"
+	"BLOCK_CONTEXT_UPDATES\0"
+	"EIPI_EIP62_CONTEXT_UPD_CTRL\0"
+	"EIPI_EIP62_NEXTPN_LO\0"
+	"EIPI_EIP62_NEXTPN_HI\0"
+	"EIPI_EIP62_NEXTPN_CTX_ID\0"
+	"ENABLE_UPDATE\0"
+	"NEXTPN_WRITTEN\0"
+	"SEQUENCE_NUMBER_SIZE\0"
+	"NEXTPN_CONTEXT_ADDRESS\0"
+	"EIPI_EIP62_NEXTPN_CTRL\0"
+	"UPDATE_THRESHOLD\0"
+	"THRESHOLD_EN\0"
+	"EIPI_EIP62_UPDATE_CTRL\0"
+	"MINOR_VERSION\0"
+	"MAJOR_VERSION\0"
+	"FPGA_SOLUTION\0"
+	"ASIC_AES_GF_SBOX\0"
+	"ASIC_AES_LU_SBOX\0"
+	"MACSEC_AES_ONLY\0"
+	"AES\0"
+	"AES_FB\0"
+	"AES_SPEED\0"
+	"AES192\0"
+	"AES256\0"
+	"EOP_PARAM_BITS\0"
+	"IPSEC\0"
+	"HDR_EXTENSIONS\0"
+	"GHASH_AVAILABLE\0"
+	"GHASH_SPEED\0"
+	"EIPI_EIP62_TYPE_REG\0"
+	"EIP_NUMBER\0"
+	"EIP_NUMBER_COMPL\0"
+	"PATCH_LEVEL\0"
+	"EIPI_EIP62_VERSION\0"
+	"POLARITY_CONTROL_0\0"
+	"POLARITY_CONTROL_1\0"
+	"POLARITY_CONTROL_2\0"
+	"POLARITY_CONTROL_3\0"
+	"POLARITY_CONTROL_4\0"
+	"POLARITY_CONTROL_5\0"
+	"POLARITY_CONTROL_6\0"
+	"POLARITY_CONTROL_7\0"
+	"POLARITY_CONTROL_8\0"
+	"POLARITY_CONTROL_9\0"
+	"EIPI_AIC_POL_CTRL\0"
+	"TYPE_CONTROL_0\0"
+	"TYPE_CONTROL_1\0"
+	"TYPE_CONTROL_2\0"
+	"TYPE_CONTROL_3\0"
+	"TYPE_CONTROL_4\0"
+	"TYPE_CONTROL_5\0"
+	"TYPE_CONTROL_6\0"
+	"TYPE_CONTROL_7\0"
+	"TYPE_CONTROL_8\0"
+	"TYPE_CONTROL_9\0"
+	"EIPI_AIC_TYPE_CTRL\0"
+	"ENABLE_CONTROL\0"
+	"EIPI_AIC_ENABLE_CTRL\0"
+	"RAW_STATUS_ENABLE_SET\0"
+	"EIPI_AIC_RAW_STAT_ENABLE_SET\0"
+	"ENABLED_STATUS_ACK\0"
+	"EIPI_AIC_ENABLED_STAT_ACK\0"
+	"ENABLE_CLR\0"
+	"EIPI_AIC_ENABLE_CLR\0"
+	"NR_OF_INPUTS\0"
+	"EIPI_AIC_OPTIONS\0"
+	"EIPI_AIC_VERSION\0"
+	"SA_COUNTERS\0"
+	"VL_COUNTERS\0"
+	"GLOBAL_COUNTERS\0"
+	"SA_OCTET_CTRS\0"
+	"VL_OCTET_CTRS\0"
+	"GLOB_OCTET_CTRS\0"
+	"INGRESS_ONLY\0"
+	"EGRESS_ONLY\0"
+	"TAG_BYPASS\0"
+	"EIPI_EIP160_CONFIG2\0"
+	"NR_OF_SAS\0"
+	"CONSIST_CHECKS\0"
+	"MATCH_SCI\0"
+	"EIPI_EIP160_CONFIG\0"
+	"EIPI_EIP160_VERSION\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_0\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_0\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_0\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_0\0"
+	"EIPE_SAM_MAC_MISC_MATCH_0\0"
+	"EIPE_SAM_MASK_0\0"
+	"EIPE_SAM_EXT_MATCH_0\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_1\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_1\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_1\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_1\0"
+	"EIPE_SAM_MAC_MISC_MATCH_1\0"
+	"EIPE_SAM_MASK_1\0"
+	"EIPE_SAM_EXT_MATCH_1\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_2\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_2\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_2\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_2\0"
+	"EIPE_SAM_MAC_MISC_MATCH_2\0"
+	"EIPE_SAM_MASK_2\0"
+	"EIPE_SAM_EXT_MATCH_2\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_3\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_3\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_3\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_3\0"
+	"EIPE_SAM_MAC_MISC_MATCH_3\0"
+	"EIPE_SAM_MASK_3\0"
+	"EIPE_SAM_EXT_MATCH_3\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_4\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_4\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_4\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_4\0"
+	"EIPE_SAM_MAC_MISC_MATCH_4\0"
+	"EIPE_SAM_MASK_4\0"
+	"EIPE_SAM_EXT_MATCH_4\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_5\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_5\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_5\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_5\0"
+	"EIPE_SAM_MAC_MISC_MATCH_5\0"
+	"EIPE_SAM_MASK_5\0"
+	"EIPE_SAM_EXT_MATCH_5\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_6\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_6\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_6\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_6\0"
+	"EIPE_SAM_MAC_MISC_MATCH_6\0"
+	"EIPE_SAM_MASK_6\0"
+	"EIPE_SAM_EXT_MATCH_6\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_7\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_7\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_7\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_7\0"
+	"EIPE_SAM_MAC_MISC_MATCH_7\0"
+	"EIPE_SAM_MASK_7\0"
+	"EIPE_SAM_EXT_MATCH_7\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_8\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_8\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_8\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_8\0"
+	"EIPE_SAM_MAC_MISC_MATCH_8\0"
+	"EIPE_SAM_MASK_8\0"
+	"EIPE_SAM_EXT_MATCH_8\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_9\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_9\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_9\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_9\0"
+	"EIPE_SAM_MAC_MISC_MATCH_9\0"
+	"EIPE_SAM_MASK_9\0"
+	"EIPE_SAM_EXT_MATCH_9\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_10\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_10\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_10\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_10\0"
+	"EIPE_SAM_MAC_MISC_MATCH_10\0"
+	"EIPE_SAM_MASK_10\0"
+	"EIPE_SAM_EXT_MATCH_10\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_11\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_11\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_11\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_11\0"
+	"EIPE_SAM_MAC_MISC_MATCH_11\0"
+	"EIPE_SAM_MASK_11\0"
+	"EIPE_SAM_EXT_MATCH_11\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_12\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_12\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_12\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_12\0"
+	"EIPE_SAM_MAC_MISC_MATCH_12\0"
+	"EIPE_SAM_MASK_12\0"
+	"EIPE_SAM_EXT_MATCH_12\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_13\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_13\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_13\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_13\0"
+	"EIPE_SAM_MAC_MISC_MATCH_13\0"
+	"EIPE_SAM_MASK_13\0"
+	"EIPE_SAM_EXT_MATCH_13\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_14\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_14\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_14\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_14\0"
+	"EIPE_SAM_MAC_MISC_MATCH_14\0"
+	"EIPE_SAM_MASK_14\0"
+	"EIPE_SAM_EXT_MATCH_14\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_15\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_15\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_15\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_15\0"
+	"EIPE_SAM_MAC_MISC_MATCH_15\0"
+	"EIPE_SAM_MASK_15\0"
+	"EIPE_SAM_EXT_MATCH_15\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_16\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_16\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_16\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_16\0"
+	"EIPE_SAM_MAC_MISC_MATCH_16\0"
+	"EIPE_SAM_MASK_16\0"
+	"EIPE_SAM_EXT_MATCH_16\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_17\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_17\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_17\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_17\0"
+	"EIPE_SAM_MAC_MISC_MATCH_17\0"
+	"EIPE_SAM_MASK_17\0"
+	"EIPE_SAM_EXT_MATCH_17\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_18\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_18\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_18\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_18\0"
+	"EIPE_SAM_MAC_MISC_MATCH_18\0"
+	"EIPE_SAM_MASK_18\0"
+	"EIPE_SAM_EXT_MATCH_18\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_19\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_19\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_19\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_19\0"
+	"EIPE_SAM_MAC_MISC_MATCH_19\0"
+	"EIPE_SAM_MASK_19\0"
+	"EIPE_SAM_EXT_MATCH_19\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_20\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_20\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_20\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_20\0"
+	"EIPE_SAM_MAC_MISC_MATCH_20\0"
+	"EIPE_SAM_MASK_20\0"
+	"EIPE_SAM_EXT_MATCH_20\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_21\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_21\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_21\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_21\0"
+	"EIPE_SAM_MAC_MISC_MATCH_21\0"
+	"EIPE_SAM_MASK_21\0"
+	"EIPE_SAM_EXT_MATCH_21\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_22\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_22\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_22\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_22\0"
+	"EIPE_SAM_MAC_MISC_MATCH_22\0"
+	"EIPE_SAM_MASK_22\0"
+	"EIPE_SAM_EXT_MATCH_22\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_23\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_23\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_23\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_23\0"
+	"EIPE_SAM_MAC_MISC_MATCH_23\0"
+	"EIPE_SAM_MASK_23\0"
+	"EIPE_SAM_EXT_MATCH_23\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_24\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_24\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_24\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_24\0"
+	"EIPE_SAM_MAC_MISC_MATCH_24\0"
+	"EIPE_SAM_MASK_24\0"
+	"EIPE_SAM_EXT_MATCH_24\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_25\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_25\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_25\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_25\0"
+	"EIPE_SAM_MAC_MISC_MATCH_25\0"
+	"EIPE_SAM_MASK_25\0"
+	"EIPE_SAM_EXT_MATCH_25\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_26\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_26\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_26\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_26\0"
+	"EIPE_SAM_MAC_MISC_MATCH_26\0"
+	"EIPE_SAM_MASK_26\0"
+	"EIPE_SAM_EXT_MATCH_26\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_27\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_27\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_27\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_27\0"
+	"EIPE_SAM_MAC_MISC_MATCH_27\0"
+	"EIPE_SAM_MASK_27\0"
+	"EIPE_SAM_EXT_MATCH_27\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_28\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_28\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_28\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_28\0"
+	"EIPE_SAM_MAC_MISC_MATCH_28\0"
+	"EIPE_SAM_MASK_28\0"
+	"EIPE_SAM_EXT_MATCH_28\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_29\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_29\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_29\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_29\0"
+	"EIPE_SAM_MAC_MISC_MATCH_29\0"
+	"EIPE_SAM_MASK_29\0"
+	"EIPE_SAM_EXT_MATCH_29\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_30\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_30\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_30\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_30\0"
+	"EIPE_SAM_MAC_MISC_MATCH_30\0"
+	"EIPE_SAM_MASK_30\0"
+	"EIPE_SAM_EXT_MATCH_30\0"
+	"EIPE_SAM_MAC_SA_MATCH_LO_31\0"
+	"EIPE_SAM_MAC_SA_MATCH_HI_31\0"
+	"EIPE_SAM_MAC_DA_MATCH_LO_31\0"
+	"EIPE_SAM_MAC_DA_MATCH_HI_31\0"
+	"EIPE_SAM_MAC_MISC_MATCH_31\0"
+	"EIPE_SAM_MASK_31\0"
+	"EIPE_SAM_EXT_MATCH_31\0"
+	"EIPE_SAM_ENTRY_ENABLE1\0"
+	"EIPE_SAM_ENTRY_TOGGLE1\0"
+	"EIPE_SAM_ENTRY_SET1\0"
+	"EIPE_SAM_ENTRY_CLEAR1\0"
+	"EIPE_SAM_ENTRY_ENABLE_CTRL\0"
+	"EIPE_SAM_IN_FLIGHT\0"
+	"PROTECT_FRAME\0"
+	"INCLUDE_SCI\0"
+	"USE_ES\0"
+	"USE_SCB\0"
+	"TAG_BYPASS_LEN\0"
+	"SA_INDEX_UPDATE\0"
+	"CONF_PROTECT\0"
+	"EIPE_SAM_FLOW_CTRL_0\0"
+	"EIPE_SAM_FLOW_CTRL_1\0"
+	"EIPE_SAM_FLOW_CTRL_2\0"
+	"EIPE_SAM_FLOW_CTRL_3\0"
+	"EIPE_SAM_FLOW_CTRL_4\0"
+	"EIPE_SAM_FLOW_CTRL_5\0"
+	"EIPE_SAM_FLOW_CTRL_6\0"
+	"EIPE_SAM_FLOW_CTRL_7\0"
+	"EIPE_SAM_FLOW_CTRL_8\0"
+	"EIPE_SAM_FLOW_CTRL_9\0"
+	"EIPE_SAM_FLOW_CTRL_10\0"
+	"EIPE_SAM_FLOW_CTRL_11\0"
+	"EIPE_SAM_FLOW_CTRL_12\0"
+	"EIPE_SAM_FLOW_CTRL_13\0"
+	"EIPE_SAM_FLOW_CTRL_14\0"
+	"EIPE_SAM_FLOW_CTRL_15\0"
+	"EIPE_SAM_FLOW_CTRL_16\0"
+	"EIPE_SAM_FLOW_CTRL_17\0"
+	"EIPE_SAM_FLOW_CTRL_18\0"
+	"EIPE_SAM_FLOW_CTRL_19\0"
+	"EIPE_SAM_FLOW_CTRL_20\0"
+	"EIPE_SAM_FLOW_CTRL_21\0"
+	"EIPE_SAM_FLOW_CTRL_22\0"
+	"EIPE_SAM_FLOW_CTRL_23\0"
+	"EIPE_SAM_FLOW_CTRL_24\0"
+	"EIPE_SAM_FLOW_CTRL_25\0"
+	"EIPE_SAM_FLOW_CTRL_26\0"
+	"EIPE_SAM_FLOW_CTRL_27\0"
+	"EIPE_SAM_FLOW_CTRL_28\0"
+	"EIPE_SAM_FLOW_CTRL_29\0"
+	"EIPE_SAM_FLOW_CTRL_30\0"
+	"EIPE_SAM_FLOW_CTRL_31\0"
+	"EIPE_CP_MAC_DA_MATCH_0\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_0\0"
+	"EIPE_CP_MAC_DA_MATCH_1\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_1\0"
+	"EIPE_CP_MAC_DA_MATCH_2\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_2\0"
+	"EIPE_CP_MAC_DA_MATCH_3\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_3\0"
+	"EIPE_CP_MAC_DA_MATCH_4\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_4\0"
+	"EIPE_CP_MAC_DA_MATCH_5\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_5\0"
+	"EIPE_CP_MAC_DA_MATCH_6\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_6\0"
+	"EIPE_CP_MAC_DA_MATCH_7\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_7\0"
+	"EIPE_CP_MAC_DA_MATCH_8\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_8\0"
+	"EIPE_CP_MAC_DA_MATCH_9\0"
+	"EIPE_CP_MAC_DA_ET_MATCH_9\0"
+	"EIPE_CP_MAC_ET_MATCH_10\0"
+	"EIPE_CP_MAC_ET_MATCH_11\0"
+	"EIPE_CP_MAC_ET_MATCH_12\0"
+	"EIPE_CP_MAC_ET_MATCH_13\0"
+	"EIPE_CP_MAC_ET_MATCH_14\0"
+	"EIPE_CP_MAC_ET_MATCH_15\0"
+	"EIPE_CP_MAC_ET_MATCH_16\0"
+	"EIPE_CP_MAC_ET_MATCH_17\0"
+	"EIPE_CP_MAC_DA_START_LO\0"
+	"EIPE_CP_MAC_DA_START_HI\0"
+	"EIPE_CP_MAC_DA_END_LO\0"
+	"EIPE_CP_MAC_DA_END_HI\0"
+	"EIPE_CP_MAC_DA_44_BITS_LO\0"
+	"EIPE_CP_MAC_DA_44_BITS_HI\0"
+	"EIPE_CP_MAC_DA_48_BITS_LO\0"
+	"EIPE_CP_MAC_DA_48_BITS_HI\0"
+	"EIPE_CP_MATCH_MODE\0"
+	"EIPE_CP_MATCH_ENABLE\0"
+	"EIPE_SAM_CP_TAG\0"
+	"EIPE_SAM_PP_TAGS\0"
+	"EIPE_SAM_PP_TAGS2\0"
+	"EIPE_SAM_CP_TAG2\0"
+	"EIPE_SAM_NM_PARAMS\0"
+	"EIPE_SAM_NM_FLOW_NCP\0"
+	"EIPE_SAM_NM_FLOW_CP\0"
+	"EIPE_SAM_NM_FLOW_EXPL\0"
+	"EIPE_MISC_CONTROL\0"
+	"EIPE_CRYPT_AUTH_CTRL\0"
+	"EIPE_SA_EXP_SUMMARY1\0"
+	"EIPE_CP_MATCH_DEBUG\0"
+	"EIPE_SAM_DEBUG\0"
+	"EIPE_SECTAG_DEBUG\0"
+	"EIPE_SAM_MATCH_DEBUG1\0"
+	"EIPE_SAM_PP_DEBUG1\0"
+	"EIPE_SAM_PP_DEBUG2\0"
+	"EIPE_SAM_PP_DEBUG3\0"
+	"EIPE_DBG_PARSED_DA_LO\0"
+	"EIPE_DBG_PARSED_DA_HI\0"
+	"EIPE_DBG_PARSED_SA_LO\0"
+	"EIPE_DBG_PARSED_SA_HI\0"
+	"EIPE_DBG_PARSED_SECTAG_LO\0"
+	"EIPE_DBG_PARSED_SECTAG_HI\0"
+	"EIPE_DBG_PARSED_SCI_LO\0"
+	"EIPE_DBG_PARSED_SCI_HI\0"
+	"EIPE_DBG_FLOW_LOOKUP\0"
+	"EIPE_DBG_SA_UPDATE\0"
+	"EIPE_CRYPTO_ATOK_DEBUG_0\0"
+	"EIPE_CRYPTO_CMMD_DEBUG_0\0"
+	"EIPE_CRYPTO_CMMD_DEBUG_1\0"
+	"EIPE_CRYPTO_CMMD_DEBUG_2\0"
+	"EIPE_CRYPTO_CMMD_DEBUG_3\0"
+	"EIPE_DBG_SA_MATCHES1_0\0"
+	"EIPE_DBG_SA_MATCHES2_0\0"
+	"EIPE_DBG_SA_MATCHES1_1\0"
+	"EIPE_DBG_SA_MATCHES2_1\0"
+	"EIPE_DBG_SA_MATCHES1_2\0"
+	"EIPE_DBG_SA_MATCHES2_2\0"
+	"EIPE_DBG_SA_MATCHES1_3\0"
+	"EIPE_DBG_SA_MATCHES2_3\0"
+	"EIPE_DBG_SA_MATCHES1_4\0"
+	"EIPE_DBG_SA_MATCHES2_4\0"
+	"EIPE_DBG_SA_MATCHES1_5\0"
+	"EIPE_DBG_SA_MATCHES2_5\0"
+	"EIPE_DBG_SA_MATCHES1_6\0"
+	"EIPE_DBG_SA_MATCHES2_6\0"
+	"EIPE_DBG_SA_MATCHES1_7\0"
+	"EIPE_DBG_SA_MATCHES2_7\0"
+	"EIPE_DBG_SA_MATCHES1_8\0"
+	"EIPE_DBG_SA_MATCHES2_8\0"
+	"EIPE_DBG_SA_MATCHES1_9\0"
+	"EIPE_DBG_SA_MATCHES2_9\0"
+	"EIPE_DBG_SA_MATCHES1_10\0"
+	"EIPE_DBG_SA_MATCHES2_10\0"
+	"EIPE_DBG_SA_MATCHES1_11\0"
+	"EIPE_DBG_SA_MATCHES2_11\0"
+	"EIPE_DBG_SA_MATCHES1_12\0"
+	"EIPE_DBG_SA_MATCHES2_12\0"
+	"EIPE_DBG_SA_MATCHES1_13\0"
+	"EIPE_DBG_SA_MATCHES2_13\0"
+	"EIPE_DBG_SA_MATCHES1_14\0"
+	"EIPE_DBG_SA_MATCHES2_14\0"
+	"EIPE_DBG_SA_MATCHES1_15\0"
+	"EIPE_DBG_SA_MATCHES2_15\0"
+	"EIPE_DBG_SA_MATCH_SEL\0"
+	"EIPE_SA_0_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_0_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_0_RESERVED2\0"
+	"EIPE_SA_0_RESERVED3\0"
+	"EIPE_SA_0_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_0_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_0_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_0_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_1_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_1_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_1_RESERVED2\0"
+	"EIPE_SA_1_RESERVED3\0"
+	"EIPE_SA_1_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_1_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_1_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_1_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_2_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_2_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_2_RESERVED2\0"
+	"EIPE_SA_2_RESERVED3\0"
+	"EIPE_SA_2_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_2_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_2_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_2_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_3_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_3_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_3_RESERVED2\0"
+	"EIPE_SA_3_RESERVED3\0"
+	"EIPE_SA_3_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_3_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_3_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_3_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_4_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_4_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_4_RESERVED2\0"
+	"EIPE_SA_4_RESERVED3\0"
+	"EIPE_SA_4_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_4_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_4_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_4_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_5_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_5_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_5_RESERVED2\0"
+	"EIPE_SA_5_RESERVED3\0"
+	"EIPE_SA_5_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_5_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_5_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_5_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_6_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_6_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_6_RESERVED2\0"
+	"EIPE_SA_6_RESERVED3\0"
+	"EIPE_SA_6_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_6_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_6_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_6_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_7_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_7_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_7_RESERVED2\0"
+	"EIPE_SA_7_RESERVED3\0"
+	"EIPE_SA_7_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_7_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_7_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_7_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_8_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_8_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_8_RESERVED2\0"
+	"EIPE_SA_8_RESERVED3\0"
+	"EIPE_SA_8_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_8_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_8_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_8_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_9_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_9_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_9_RESERVED2\0"
+	"EIPE_SA_9_RESERVED3\0"
+	"EIPE_SA_9_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_9_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_9_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_9_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_10_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_10_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_10_RESERVED2\0"
+	"EIPE_SA_10_RESERVED3\0"
+	"EIPE_SA_10_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_10_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_10_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_10_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_11_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_11_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_11_RESERVED2\0"
+	"EIPE_SA_11_RESERVED3\0"
+	"EIPE_SA_11_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_11_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_11_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_11_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_12_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_12_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_12_RESERVED2\0"
+	"EIPE_SA_12_RESERVED3\0"
+	"EIPE_SA_12_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_12_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_12_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_12_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_13_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_13_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_13_RESERVED2\0"
+	"EIPE_SA_13_RESERVED3\0"
+	"EIPE_SA_13_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_13_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_13_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_13_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_14_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_14_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_14_RESERVED2\0"
+	"EIPE_SA_14_RESERVED3\0"
+	"EIPE_SA_14_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_14_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_14_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_14_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_15_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_15_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_15_RESERVED2\0"
+	"EIPE_SA_15_RESERVED3\0"
+	"EIPE_SA_15_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_15_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_15_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_15_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_16_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_16_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_16_RESERVED2\0"
+	"EIPE_SA_16_RESERVED3\0"
+	"EIPE_SA_16_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_16_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_16_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_16_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_17_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_17_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_17_RESERVED2\0"
+	"EIPE_SA_17_RESERVED3\0"
+	"EIPE_SA_17_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_17_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_17_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_17_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_18_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_18_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_18_RESERVED2\0"
+	"EIPE_SA_18_RESERVED3\0"
+	"EIPE_SA_18_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_18_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_18_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_18_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_19_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_19_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_19_RESERVED2\0"
+	"EIPE_SA_19_RESERVED3\0"
+	"EIPE_SA_19_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_19_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_19_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_19_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_20_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_20_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_20_RESERVED2\0"
+	"EIPE_SA_20_RESERVED3\0"
+	"EIPE_SA_20_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_20_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_20_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_20_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_21_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_21_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_21_RESERVED2\0"
+	"EIPE_SA_21_RESERVED3\0"
+	"EIPE_SA_21_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_21_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_21_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_21_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_22_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_22_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_22_RESERVED2\0"
+	"EIPE_SA_22_RESERVED3\0"
+	"EIPE_SA_22_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_22_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_22_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_22_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_23_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_23_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_23_RESERVED2\0"
+	"EIPE_SA_23_RESERVED3\0"
+	"EIPE_SA_23_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_23_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_23_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_23_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_24_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_24_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_24_RESERVED2\0"
+	"EIPE_SA_24_RESERVED3\0"
+	"EIPE_SA_24_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_24_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_24_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_24_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_25_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_25_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_25_RESERVED2\0"
+	"EIPE_SA_25_RESERVED3\0"
+	"EIPE_SA_25_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_25_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_25_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_25_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_26_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_26_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_26_RESERVED2\0"
+	"EIPE_SA_26_RESERVED3\0"
+	"EIPE_SA_26_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_26_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_26_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_26_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_27_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_27_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_27_RESERVED2\0"
+	"EIPE_SA_27_RESERVED3\0"
+	"EIPE_SA_27_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_27_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_27_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_27_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_28_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_28_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_28_RESERVED2\0"
+	"EIPE_SA_28_RESERVED3\0"
+	"EIPE_SA_28_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_28_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_28_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_28_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_29_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_29_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_29_RESERVED2\0"
+	"EIPE_SA_29_RESERVED3\0"
+	"EIPE_SA_29_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_29_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_29_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_29_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_30_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_30_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_30_RESERVED2\0"
+	"EIPE_SA_30_RESERVED3\0"
+	"EIPE_SA_30_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_30_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_30_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_30_OUTPKTSTOOLONG_HI\0"
+	"EIPE_SA_31_OUTOCTETSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_31_OUTOCTETSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_31_RESERVED2\0"
+	"EIPE_SA_31_RESERVED3\0"
+	"EIPE_SA_31_OUTPKTSENCRYPTEDPROTECTED_LO\0"
+	"EIPE_SA_31_OUTPKTSENCRYPTEDPROTECTED_HI\0"
+	"EIPE_SA_31_OUTPKTSTOOLONG_LO\0"
+	"EIPE_SA_31_OUTPKTSTOOLONG_HI\0"
+	"EIPE_VLAN_UP_0_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_0_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_0_RESERVED2\0"
+	"EIPE_VLAN_UP_0_RESERVED3\0"
+	"EIPE_VLAN_UP_0_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_0_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_0_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_0_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_0_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_0_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_1_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_1_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_1_RESERVED2\0"
+	"EIPE_VLAN_UP_1_RESERVED3\0"
+	"EIPE_VLAN_UP_1_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_1_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_1_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_1_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_1_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_1_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_2_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_2_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_2_RESERVED2\0"
+	"EIPE_VLAN_UP_2_RESERVED3\0"
+	"EIPE_VLAN_UP_2_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_2_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_2_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_2_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_2_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_2_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_3_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_3_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_3_RESERVED2\0"
+	"EIPE_VLAN_UP_3_RESERVED3\0"
+	"EIPE_VLAN_UP_3_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_3_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_3_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_3_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_3_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_3_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_4_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_4_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_4_RESERVED2\0"
+	"EIPE_VLAN_UP_4_RESERVED3\0"
+	"EIPE_VLAN_UP_4_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_4_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_4_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_4_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_4_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_4_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_5_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_5_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_5_RESERVED2\0"
+	"EIPE_VLAN_UP_5_RESERVED3\0"
+	"EIPE_VLAN_UP_5_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_5_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_5_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_5_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_5_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_5_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_6_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_6_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_6_RESERVED2\0"
+	"EIPE_VLAN_UP_6_RESERVED3\0"
+	"EIPE_VLAN_UP_6_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_6_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_6_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_6_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_6_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_6_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_VLAN_UP_7_OUTOCTETSVL_LO\0"
+	"EIPE_VLAN_UP_7_OUTOCTETSVL_HI\0"
+	"EIPE_VLAN_UP_7_RESERVED2\0"
+	"EIPE_VLAN_UP_7_RESERVED3\0"
+	"EIPE_VLAN_UP_7_OUTPKTSVL_LO\0"
+	"EIPE_VLAN_UP_7_OUTPKTSVL_HI\0"
+	"EIPE_VLAN_UP_7_OUTDROPPEDPKTSVL_LO\0"
+	"EIPE_VLAN_UP_7_OUTDROPPEDPKTSVL_HI\0"
+	"EIPE_VLAN_UP_7_OUTOVERSIZEPKTSVL_LO\0"
+	"EIPE_VLAN_UP_7_OUTOVERSIZEPKTSVL_HI\0"
+	"EIPE_TRANSFORMERRORPKTS_LO\0"
+	"EIPE_TRANSFORMERRORPKTS_HI\0"
+	"EIPE_OUTPKTSCTRL_LO\0"
+	"EIPE_OUTPKTSCTRL_HI\0"
+	"EIPE_OUTPKTSUNKNOWNSA_LO\0"
+	"EIPE_OUTPKTSUNKNOWNSA_HI\0"
+	"EIPE_OUTPKTSUNTAGGED_LO\0"
+	"EIPE_OUTPKTSUNTAGGED_HI\0"
+	"EIPE_OUTOVERSIZEPKTS_LO\0"
+	"EIPE_OUTOVERSIZEPKTS_HI\0"
+	"EIPE_COUNT_DEBUG1\0"
+	"EIPE_COUNT_DEBUG2\0"
+	"EIPE_COUNT_DEBUG3\0"
+	"EIPE_COUNT_DEBUG4\0"
+	"EIPE_COUNT_CONTROL\0"
+	"EIPE_COUNT_INCEN1\0"
+	"EIPE_COUNT_INCEN2\0"
+	"EIPE_COUNT_FRAME_THR1\0"
+	"EIPE_COUNT_FRAME_THR2\0"
+	"EIPE_COUNT_OCTET_THR1\0"
+	"EIPE_COUNT_OCTET_THR2\0"
+	"EIPE_COUNT_SUMMARY_GL\0"
+	"EIPE_COUNT_SUMMARY_VL1\0"
+	"EIPE_COUNT_SUMMARY_VL2\0"
+	"EIPE_COUNT_SUMMARY_PSA1\0"
+	"EIPE_COUNT_SUMMARY_SA0\0"
+	"EIPE_COUNT_SUMMARY_SA1\0"
+	"EIPE_COUNT_SUMMARY_SA2\0"
+	"EIPE_COUNT_SUMMARY_SA3\0"
+	"EIPE_COUNT_SUMMARY_SA4\0"
+	"EIPE_COUNT_SUMMARY_SA5\0"
+	"EIPE_COUNT_SUMMARY_SA6\0"
+	"EIPE_COUNT_SUMMARY_SA7\0"
+	"EIPE_COUNT_SUMMARY_SA8\0"
+	"EIPE_COUNT_SUMMARY_SA9\0"
+	"EIPE_COUNT_SUMMARY_SA10\0"
+	"EIPE_COUNT_SUMMARY_SA11\0"
+	"EIPE_COUNT_SUMMARY_SA12\0"
+	"EIPE_COUNT_SUMMARY_SA13\0"
+	"EIPE_COUNT_SUMMARY_SA14\0"
+	"EIPE_COUNT_SUMMARY_SA15\0"
+	"EIPE_COUNT_SUMMARY_SA16\0"
+	"EIPE_COUNT_SUMMARY_SA17\0"
+	"EIPE_COUNT_SUMMARY_SA18\0"
+	"EIPE_COUNT_SUMMARY_SA19\0"
+	"EIPE_COUNT_SUMMARY_SA20\0"
+	"EIPE_COUNT_SUMMARY_SA21\0"
+	"EIPE_COUNT_SUMMARY_SA22\0"
+	"EIPE_COUNT_SUMMARY_SA23\0"
+	"EIPE_COUNT_SUMMARY_SA24\0"
+	"EIPE_COUNT_SUMMARY_SA25\0"
+	"EIPE_COUNT_SUMMARY_SA26\0"
+	"EIPE_COUNT_SUMMARY_SA27\0"
+	"EIPE_COUNT_SUMMARY_SA28\0"
+	"EIPE_COUNT_SUMMARY_SA29\0"
+	"EIPE_COUNT_SUMMARY_SA30\0"
+	"EIPE_COUNT_SUMMARY_SA31\0"
+	"EIPE_SA_PN_THR_SUMMARY1\0"
+	"EIPE_VLAN_MTU_CHECK_0\0"
+	"EIPE_VLAN_MTU_CHECK_1\0"
+	"EIPE_VLAN_MTU_CHECK_2\0"
+	"EIPE_VLAN_MTU_CHECK_3\0"
+	"EIPE_VLAN_MTU_CHECK_4\0"
+	"EIPE_VLAN_MTU_CHECK_5\0"
+	"EIPE_VLAN_MTU_CHECK_6\0"
+	"EIPE_VLAN_MTU_CHECK_7\0"
+	"EIPE_NON_VLAN_MTU_CHECK\0"
+	"EIPE_COUNT_SECFAIL1\0"
+	"EIPE_COUNT_SECFAIL2\0"
+	"EIPE_CRYPTO_RSLT_DEBUG_0\0"
+	"EIPE_CRYPTO_RSLT_DEBUG_1\0"
+	"EIPE_CRYPTO_RSLT_DEBUG_2\0"
+	"EIPE_CRYPTO_DEBUG_CNTR\0"
+	"EIPE_DBG_PP_DROP_ENABLE\0"
+	"EIPE_DBG_PP_DROP_STATUS\0"
+	"EIPE_EIP62_TOKEN_CTRL_STAT\0"
+	"EIPE_EIP62_PROT_ALG_EN\0"
+	"EIPE_EIP62_CONTEXT_CTRL\0"
+	"EIPE_EIP62_CONTEXT_STAT\0"
+	"EIPE_EIP62_INT_CTRL_STAT\0"
+	"EIPE_EIP62_SW_INTERRUPT\0"
+	"EIPE_EIP62_SEQ_NUM_THRESHOLD\0"
+	"EIPE_EIP62_SEQ_NUM_THRESHOLD64_LO\0"
+	"EIPE_EIP62_SEQ_NUM_THRESHOLD64_HI\0"
+	"EIPE_EIP62_CONTEXT_UPD_CTRL\0"
+	"EIPE_EIP62_NEXTPN_LO\0"
+	"EIPE_EIP62_NEXTPN_HI\0"
+	"EIPE_EIP62_NEXTPN_CTX_ID\0"
+	"EIPE_EIP62_NEXTPN_CTRL\0"
+	"EIPE_EIP62_UPDATE_CTRL\0"
+	"EIPE_EIP62_TYPE_REG\0"
+	"EIPE_EIP62_VERSION\0"
+	"EIPE_AIC_POL_CTRL\0"
+	"EIPE_AIC_TYPE_CTRL\0"
+	"EIPE_AIC_ENABLE_CTRL\0"
+	"EIPE_AIC_RAW_STAT_ENABLE_SET\0"
+	"EIPE_AIC_ENABLED_STAT_ACK\0"
+	"EIPE_AIC_ENABLE_CLR\0"
+	"EIPE_AIC_OPTIONS\0"
+	"EIPE_AIC_VERSION\0"
+	"EIPE_EIP160_CONFIG2\0"
+	"EIPE_EIP160_CONFIG\0"
+	"EIPE_EIP160_VERSION\0"
+	"MANUF\0"
+	"CHIPID_MPS_MANID\0"
+	"V1\0"
+	"MANID\0"
+	"PNUML\0"
+	"CHIPID_MPS_CHIPID_L\0"
+	"PNUMM\0"
+	"VERSION\0"
+	"V0\0"
+	"CHIPID_MPS_CHIPID_M\0"
+	"DD\0"
+	"MM\0"
+	"YYYYY\0"
+	"CHIPID_MPS_CHIP_LOC0\0"
+	"CHIP_X\0"
+	"CHIP_Y\0"
+	"CHIPID_MPS_CHIP_LOC1\0"
+	"WAFER_ID\0"
+	"FUTURE_USE\0"
+	"CODING_T\0"
+	"CHIPID_MPS_CHIP_LOC2\0"
+	"LOTID0\0"
+	"CHIPID_FAB_LOT_ID0\0"
+	"LOTID1\0"
+	"CHIPID_FAB_LOT_ID1\0"
+	"LOTID2\0"
+	"CHIPID_FAB_LOT_ID2\0"
+	"LOTID3\0"
+	"PARITY\0"
+	"CHIPID_FAB_LOT_ID3\0"
+	"BELOTID0\0"
+	"CHIPID_FAB_BELOT_ID0\0"
+	"BELOTID1\0"
+	"CHIPID_FAB_BELOT_ID1\0"
+	"BELOTID2\0"
+	"CHIPID_FAB_BELOT_ID2\0"
+	"PVT\0"
+	"CHIPID_FAB_PVT\0"
+	"PVT_DVS\0"
+	"CHIPID_FAB_PVT_DVS\0"
+	"PVT_DVF\0"
+	"CHIPID_FAB_PVT_DVF\0"
+	"FXVL\0"
+	"SEC_EN\0"
+	"G2_5_DIS\0"
+	"G2_5_DIS0\0"
+	"G2_5_DIS1\0"
+	"G2_5_DIS2\0"
+	"G2_5_DIS3\0"
+	"SLICE_DIS1\0"
+	"SLICE_DIS2\0"
+	"SLICE_DIS3\0"
+	"MACSEC_DIS\0"
+	"MACSEC_DIS0\0"
+	"MACSEC_DIS1\0"
+	"MACSEC_DIS2\0"
+	"MACSEC_DIS3\0"
+	"CHIPID_ID_CFG\0"
+	"RM0\0"
+	"RME0\0"
+	"RM1\0"
+	"RME1\0"
+	"CHIPID_RM_RME_CTRL\0"
+	"FUSE\0"
+	"CHIPID_MPS_FUSE_0\0"
+	"CHIPID_MPS_FUSE_1\0"
+	"CHIPID_MPS_FUSE_2\0"
+	"CHIPID_MPS_FUSE_3\0"
+	"CHIPID_MPS_FUSE_4\0"
+	"CHIPID_MPS_FUSE_5\0"
+	"CHIPID_MPS_FUSE_6\0"
+	"CHIPID_MPS_FUSE_7\0"
+	"CHIPID_MPS_FUSE_8\0"
+	"GAIN_CORR\0"
+	"OFFSET_CORR\0"
+	"CHIPID_DCDC_TRIM\0"
+	"JTAG_ID\0"
+	"CHIP_LOCK\0"
+	"QRR_FUSE_SEL\0"
+	"CHIPID_CTRL\0"
+	"OFFMSK0\0"
+	"OFFMSK1\0"
+	"OFFMSK2\0"
+	"OFFMSK3\0"
+	"ONMSK0\0"
+	"ONMSK1\0"
+	"ONMSK2\0"
+	"ONMSK3\0"
+	"BCON_EN\0"
+	"ULP_EN\0"
+	"PMU_EN\0"
+	"BCON_TOG\0"
+	"PIN0_POL\0"
+	"PIN1_POL\0"
+	"PIN2_POL\0"
+	"DCPM_PD\0"
+	"PMU_PDI_REGISTERS_PMU_ULP\0"
+	"WMSKA\0"
+	"WMSKB\0"
+	"WMSKC\0"
+	"WMSKD\0"
+	"BMSKAP\0"
+	"BMSKBP\0"
+	"BMSKCP\0"
+	"BMSKDP\0"
+	"BMSKAN\0"
+	"BMSKBN\0"
+	"BMSKCN\0"
+	"BMSKDN\0"
+	"CLKSEL\0"
+	"ISO_OFF\0"
+	"DCDC_OFF_DIS\0"
+	"PMU_PDI_REGISTERS_PMU_CFG\0"
+	"WAKE0\0"
+	"WAKE1\0"
+	"WAKE2\0"
+	"WAKE3\0"
+	"STRAP_DONE\0"
+	"PMU_PDI_REGISTERS_PMU_STAT\0"
+	"BWIDTH\0"
+	"BITVL\0"
+	"PMU_PDI_REGISTERS_BCON_CFG\0"
+	"BWCNT\0"
+	"BICNT\0"
+	"PMU_PDI_REGISTERS_BCON_STAT\0"
+	"TOG_CFG\0"
+	"TOG_CNT\0"
+	"PMU_PDI_REGISTERS_BCON_TOG\0"
+	"TRIM\0"
+	"BYP\0"
+	"PMU_PDI_REGISTERS_CLK_TRIM\0"
+	"PMU_PDI_REGISTERS_PS\0"
+	"PMU_PDI_REGISTERS_PS2\0"
+	"WP_RAMP\0"
+	"PMU_PDI_REGISTERS_DCDC_CFG\0"
+	"RW\0"
+	"PMU_PDI_REGISTERS_DCDC_CTRL_CFG\0"
+	"DONE\0"
+	"PMU_PDI_REGISTERS_DCDC_CTRL_ISR\0"
+	"PMU_PDI_REGISTERS_DCDC_CTRL_IER\0"
+	"ADDR\0"
+	"PMU_PDI_REGISTERS_DCDC_CTRL_ADDR\0"
+	"PMU_PDI_REGISTERS_DCDC_CTRL_DATA\0"
+	"BFDEV\0"
+	"PMU_PDI_REGISTERS_GPHY_GPS0\0"
+	"CHIP_ID\0"
+	"CHIP_VER\0"
+	"MDIO_PHY_ADDR\0"
+	"MDIO_INT_POL\0"
+	"LED_EN\0"
+	"PMU_PDI_REGISTERS_GPHY_GPS1\0"
+	"RCAL\0"
+	"RC_COUNT\0"
+	"MDIO_I2C\0"
+	"RJ45_TAP\0"
+	"PMU_PDI_REGISTERS_GPHY_GPS2\0"
+	"STORE\0"
+	"PMU_PDI_REGISTERS_STORAGE_0\0"
+	"PMU_PDI_REGISTERS_STORAGE_1\0"
+	"PMU_PDI_REGISTERS_STORAGE_2\0"
+	"PMU_PDI_REGISTERS_STORAGE_3\0"
+	"PMU_PDI_REGISTERS_STORAGE_4\0"
+	"PMU_PDI_REGISTERS_STORAGE_5\0"
+	"PMU_PDI_REGISTERS_STORAGE_6\0"
+	"PMU_PDI_REGISTERS_STORAGE_7\0"
+	"PMU_PDI_REGISTERS_STORAGE_8\0"
+	"PMU_PDI_REGISTERS_STORAGE_9\0"
+	"PMU_PDI_REGISTERS_STORAGE_10\0"
+	"FAILCODE\0"
+	"BOOTROM_EXIT\0"
+	"BOOTLOADER_EXIT\0"
+	"PMU_PDI_REGISTERS_BOOTSTAT\0"
+	"GWIDTH\0"
+	"GUARD_EN\0"
+	"PMU_PDI_REGISTERS_GUARD_CFG\0"
+	"BEACON_AP_O\0"
+	"BEACON_AN_O\0"
+	"BEACON_BP_O\0"
+	"BEACON_BN_O\0"
+	"BEACON_CP_O\0"
+	"BEACON_CN_O\0"
+	"BEACON_DP_O\0"
+	"BEACON_DN_O\0"
+	"BEACON_A_WAKE\0"
+	"BEACON_B_WAKE\0"
+	"BEACON_C_WAKE\0"
+	"BEACON_D_WAKE\0"
+	"BEACON_TEST\0"
+	"PMU_PDI_REGISTERS_BEACON_TEST\0"
+	"NCO1_CFG\0"
+	"NCO1_SEL\0"
+	"NCO2_CFG\0"
+	"NCO2_SEL\0"
+	"CGU_PDI_CGU_CFG\0"
+	"SCLK_SEL\0"
+	"INTIMER_SEL\0"
+	"CGU_PDI_SYNCE_CONF\0"
+	"DETECT\0"
+	"CGU_PDI_GPC0_CONF\0"
+	"CGU_PDI_GPC1_CONF\0"
+	"CGU_PDI_GPC2_CONF\0"
+	"NCO1_LSB\0"
+	"CGU_PDI_NCO1_LSB_2500\0"
+	"NCO1_MSB\0"
+	"CGU_PDI_NCO1_MSB_2500\0"
+	"CGU_PDI_NCO1_LSB_1000\0"
+	"CGU_PDI_NCO1_MSB_1000\0"
+	"NCO2_LSB\0"
+	"CGU_PDI_NCO2_LSB_2500\0"
+	"NCO2_MSB\0"
+	"CGU_PDI_NCO2_MSB_2500\0"
+	"CGU_PDI_NCO2_LSB_1000\0"
+	"CGU_PDI_NCO2_MSB_1000\0"
+	"SGMIISEL\0"
+	"FORCE1\0"
+	"FORCE2\0"
+	"FORCE3\0"
+	"NCO1_GATE\0"
+	"NCO2_GATE\0"
+	"CGU_PDI_NCO_CTRL\0"
+	"NCO3_CFG0\0"
+	"NCO3_CFG1\0"
+	"CGU_PDI_NCO3_CFG\0"
+	"RE\0"
+	"TE\0"
+	"PRELEN\0"
+	"DC\0"
+	"BL\0"
+	"DCRS\0"
+	"DO\0"
+	"ECRSFD\0"
+	"LM\0"
+	"DM\0"
+	"FES\0"
+	"GMACF_MAC_CONFIGURATION_L\0"
+	"JE\0"
+	"BE\0"
+	"WD\0"
+	"ACS\0"
+	"CST\0"
+	"S2KP\0"
+	"GPSLCE\0"
+	"IPG\0"
+	"IPC\0"
+	"RESERVED_SARC\0"
+	"RESERVED_ARPEN\0"
+	"GMACF_MAC_CONFIGURATION_H\0"
+	"GPSL\0"
+	"RESERVED_15_14\0"
+	"GMACF_MAC_EXT_CONFIGURATION_L\0"
+	"DCRCC\0"
+	"SPEN\0"
+	"USP\0"
+	"RESERVED_PDC\0"
+	"RESERVED_HDSMS\0"
+	"EIPGEN\0"
+	"EIPG\0"
+	"RESERVED_31_30\0"
+	"GMACF_MAC_EXT_CONFIGURATION_H\0"
+	"RESERVED_HUC\0"
+	"RESERVED_HMC\0"
+	"DAIF\0"
+	"PM\0"
+	"DBF\0"
+	"PCF\0"
+	"SAIF\0"
+	"SAF\0"
+	"RESERVED_HPF\0"
+	"RESERVED_15_11\0"
+	"GMACF_MAC_PACKET_FILTER_L\0"
+	"VTFE\0"
+	"RESERVED_19_17\0"
+	"RESERVED_IPFE\0"
+	"RESERVED_DNTU\0"
+	"RESERVED_30_22\0"
+	"RA\0"
+	"GMACF_MAC_PACKET_FILTER_H\0"
+	"WTO\0"
+	"RESERVED_7_4\0"
+	"PWE\0"
+	"RESERVED_31_9\0"
+	"GMACF_MAC_WATCHDOG_TIMEOUT_L\0"
+	"GMACF_MAC_WATCHDOG_TIMEOUT_H\0"
+	"VL\0"
+	"GMACF_MAC_VLAN_TAG_L\0"
+	"ETV\0"
+	"VTIM\0"
+	"ESVL\0"
+	"ERSVLM\0"
+	"DOVLTC\0"
+	"EVLS\0"
+	"EVLRXS\0"
+	"RESERVED_VTHM\0"
+	"EDVLP\0"
+	"ERIVLT\0"
+	"EIVLS\0"
+	"EIVLRXS\0"
+	"GMACF_MAC_VLAN_TAG_H\0"
+	"FCB_BPA\0"
+	"TFE\0"
+	"RESERVED_3_2\0"
+	"PLT\0"
+	"DZPQ\0"
+	"RESERVED_15_8\0"
+	"GMACF_MAC_Q0_TX_FLOW_CTRL_L\0"
+	"GMACF_MAC_Q0_TX_FLOW_CTRL_H\0"
+	"RFE\0"
+	"UP\0"
+	"RESERVED_7_2\0"
+	"RESERVED_PFCE\0"
+	"GMACF_MAC_RX_FLOW_CTRL_L\0"
+	"GMACF_MAC_RX_FLOW_CTRL_H\0"
+	"RESERVED_RGSMIIIS\0"
+	"RESERVED_PCSLCHGIS\0"
+	"RESERVED_PCSANCIS\0"
+	"PHYIS\0"
+	"RESERVED_PMTIS\0"
+	"LPIIS\0"
+	"RESERVED_7_6\0"
+	"MMCIS\0"
+	"MMCRXIS\0"
+	"MMCTXIS\0"
+	"RESERVED_MMCRXIPIS\0"
+	"TSIS\0"
+	"TXSTSIS\0"
+	"RXSTSIS\0"
+	"RESERVED_GPIIS\0"
+	"GMACF_MAC_INTERRUPT_STATUS_L\0"
+	"RESERVED_FPEIS\0"
+	"RESERVED_MDIOIS\0"
+	"RESERVED_MFTIS\0"
+	"RESERVED_MFRIS\0"
+	"RESERVED_31_21\0"
+	"GMACF_MAC_INTERRUPT_STATUS_H\0"
+	"RESERVED_RGSMIIIE\0"
+	"RESERVED_PCSLCHGIE\0"
+	"RESERVED_PCSANCIE\0"
+	"PHYIE\0"
+	"RESERVED_PMTIE\0"
+	"LPIIE\0"
+	"RESERVED_11_6\0"
+	"TSIE\0"
+	"TXSTSIE\0"
+	"RXSTSIE\0"
+	"GMACF_MAC_INTERRUPT_ENABLE_L\0"
+	"RESERVED_FPEIE\0"
+	"RESERVED_MDIOIE\0"
+	"RESERVED_31_19\0"
+	"GMACF_MAC_INTERRUPT_ENABLE_H\0"
+	"TJT\0"
+	"RESERVED_NCARR\0"
+	"RESERVED_LCARR\0"
+	"RESERVED_EXDEF\0"
+	"RESERVED_LCOL\0"
+	"RESERVED_EXCOL\0"
+	"RWT\0"
+	"GMACF_MAC_RX_TX_STATUS_L\0"
+	"GMACF_MAC_RX_TX_STATUS_H\0"
+	"TLPIEN\0"
+	"TLPIEX\0"
+	"RLPIEN\0"
+	"RLPIEX\0"
+	"TLPIST\0"
+	"RLPIST\0"
+	"RESERVED_15_10\0"
+	"GMACF_MAC_LPI_CONTROL_STATUS_L\0"
+	"LPIEN\0"
+	"PLS\0"
+	"RESERVED_PLSEN\0"
+	"LPITXA\0"
+	"LPIATE\0"
+	"LPITCSE\0"
+	"RESERVED_31_22\0"
+	"GMACF_MAC_LPI_CONTROL_STATUS_H\0"
+	"TWT\0"
+	"GMACF_MAC_LPI_TIMERS_CONTROL_L\0"
+	"LST\0"
+	"RESERVED_31_26\0"
+	"GMACF_MAC_LPI_TIMERS_CONTROL_H\0"
+	"RESERVED_2_0\0"
+	"LPIET\0"
+	"GMACF_MAC_LPI_ENTRY_TIMER_L\0"
+	"RESERVED_31_20\0"
+	"GMACF_MAC_LPI_ENTRY_TIMER_H\0"
+	"TIC_1US_CNTR\0"
+	"RESERVED_31_12\0"
+	"GMACF_MAC_1US_TIC_COUNTER_L\0"
+	"GMACF_MAC_1US_TIC_COUNTER_H\0"
+	"SNPSVER\0"
+	"USERVER\0"
+	"GMACF_MAC_VERSION_L\0"
+	"RESERVED_31_16\0"
+	"GMACF_MAC_VERSION_H\0"
+	"RPESTS\0"
+	"RFCFCSTS\0"
+	"RESERVED_15_3\0"
+	"GMACF_MAC_DEBUG_L\0"
+	"TPESTS\0"
+	"TFCSTS\0"
+	"GMACF_MAC_DEBUG_H\0"
+	"MIISEL\0"
+	"GMIISEL\0"
+	"HDSEL\0"
+	"PCSSEL\0"
+	"VLHASH\0"
+	"SMASEL\0"
+	"RWKSEL\0"
+	"MGKSEL\0"
+	"MMCSEL\0"
+	"ARPOFFSEL\0"
+	"RESERVED_11_10\0"
+	"TSSEL\0"
+	"EEESEL\0"
+	"TXCOESEL\0"
+	"GMACF_MAC_HW_FEATURE0_L\0"
+	"RXCOESEL\0"
+	"ADDMACADRSEL\0"
+	"MACADR32SEL\0"
+	"MACADR64SEL\0"
+	"TSSTSSEL\0"
+	"SAVLANINS\0"
+	"ACTPHYSEL\0"
+	"GMACF_MAC_HW_FEATURE0_H\0"
+	"RXFIFOSIZE\0"
+	"SPRAM\0"
+	"TXFIFOSIZE\0"
+	"OSTEN\0"
+	"PTOEN\0"
+	"ADVTHWORD\0"
+	"ADDR64\0"
+	"GMACF_MAC_HW_FEATURE1_L\0"
+	"DCBEN\0"
+	"SPHEN\0"
+	"TSOEN\0"
+	"DBGMEMA\0"
+	"AVSEL\0"
+	"RAVSEL\0"
+	"POUOST\0"
+	"HASHTBLSZ\0"
+	"L3L4FNUM\0"
+	"GMACF_MAC_HW_FEATURE1_H\0"
+	"RXQCNT\0"
+	"RESERVED_5_4\0"
+	"TXQCNT\0"
+	"RXCHCNT\0"
+	"GMACF_MAC_HW_FEATURE2_L\0"
+	"RESERVED_17_16\0"
+	"TXCHCNT\0"
+	"RESERVED_23_22\0"
+	"PPSOUTNUM\0"
+	"AUXSNAPNUM\0"
+	"GMACF_MAC_HW_FEATURE2_H\0"
+	"NRVF\0"
+	"CBTISEL\0"
+	"DVLAN\0"
+	"DBGSSEL\0"
+	"PDUPSEL\0"
+	"GMACF_MAC_HW_FEATURE3_L\0"
+	"ESTSEL\0"
+	"ESTDEP\0"
+	"ESTWID\0"
+	"ESTTISW\0"
+	"FPESEL\0"
+	"TBSSEL\0"
+	"RESERVED_31_28\0"
+	"GMACF_MAC_HW_FEATURE3_H\0"
+	"RCWE\0"
+	"RESERVED_7_1\0"
+	"RESERVED_SEEN\0"
+	"GMACF_MAC_CSR_SW_CTRL_L\0"
+	"GMACF_MAC_CSR_SW_CTRL_H\0"
+	"GMACF_MAC_ADDRESS0_HIGH_L\0"
+	"RESERVED_DCS\0"
+	"RESERVED_30_Y\0"
+	"AE\0"
+	"GMACF_MAC_ADDRESS0_HIGH_H\0"
+	"GMACF_MAC_ADDRESS0_LOW_L\0"
+	"GMACF_MAC_ADDRESS0_LOW_H\0"
+	"CNTRST\0"
+	"CNTSTOPRO\0"
+	"RSTONRD\0"
+	"CNTFREEZ\0"
+	"CNTPRST\0"
+	"CNTPRSTLVL\0"
+	"UCDBC\0"
+	"GMACF_MMC_CONTROL_L\0"
+	"GMACF_MMC_CONTROL_H\0"
+	"RXGBPKTIS\0"
+	"RESERVED_RXGBOCTIS\0"
+	"RESERVED_RXGOCTIS\0"
+	"RESERVED_RXBCGPIS\0"
+	"RESERVED_RXMCGPIS\0"
+	"RXCRCERPIS\0"
+	"RESERVED_RXALGNERPIS\0"
+	"RESERVED_RXRUNTPIS\0"
+	"RESERVED_RXJABERPIS\0"
+	"RXUSIZEGPIS\0"
+	"RXOSIZEGPIS\0"
+	"RESERVED_RX64OCTGBPIS\0"
+	"RESERVED_RX65T127OCTGBPIS\0"
+	"RESERVED_RX128T255OCTGBPIS\0"
+	"RESERVED_RX256T511OCTGBPIS\0"
+	"RESERVED_RX512T1023OCTGBPIS\0"
+	"GMACF_MMC_RX_INTERRUPT_L\0"
+	"RESERVED_RX1024TMAXOCTGBPIS\0"
+	"RESERVED_RXUCGPIS\0"
+	"RESERVED_RXLENERPIS\0"
+	"RESERVED_RXORANGEPIS\0"
+	"RESERVED_RXPAUSPIS\0"
+	"RESERVED_RXFOVPIS\0"
+	"RESERVED_RXVLANGBPIS\0"
+	"RESERVED_RXWDOGPIS\0"
+	"RESERVED_RXRCVERRPIS\0"
+	"RESERVED_RXCTRLPIS\0"
+	"RXLPIUSCIS\0"
+	"RXLPITRCIS\0"
+	"GMACF_MMC_RX_INTERRUPT_H\0"
+	"RESERVED_TXGBOCTIS\0"
+	"TXGBPKTIS\0"
+	"RESERVED_TXBCGPIS\0"
+	"RESERVED_TXMCGPIS\0"
+	"RESERVED_TX64OCTGBPIS\0"
+	"RESERVED_TX65T127OCTGBPIS\0"
+	"RESERVED_TX128T255OCTGBPIS\0"
+	"RESERVED_TX256T511OCTGBPIS\0"
+	"RESERVED_TX512T1023OCTGBPIS\0"
+	"RESERVED_TX1024TMAXOCTGBPIS\0"
+	"RESERVED_TXUCGBPIS\0"
+	"RESERVED_TXMCGBPIS\0"
+	"RESERVED_TXBCGBPIS\0"
+	"TXUFLOWERPIS\0"
+	"RESERVED_TXSCOLGPIS\0"
+	"RESERVED_TXMCOLGPIS\0"
+	"GMACF_MMC_TX_INTERRUPT_L\0"
+	"RESERVED_TXDEFPIS\0"
+	"RESERVED_TXLATCOLPIS\0"
+	"RESERVED_TXEXCOLPIS\0"
+	"RESERVED_TXCARERPIS\0"
+	"RESERVED_TXGOCTIS\0"
+	"TXGPKTIS\0"
+	"RESERVED_TXEXDEFPIS\0"
+	"RESERVED_TXPAUSPIS\0"
+	"RESERVED_TXVLANGPIS\0"
+	"TXOSIZEGPIS\0"
+	"TXLPIUSCIS\0"
+	"TXLPITRCIS\0"
+	"GMACF_MMC_TX_INTERRUPT_H\0"
+	"RXGBPKTIM\0"
+	"RESERVED_RXGBOCTIM\0"
+	"RESERVED_RXGOCTIM\0"
+	"RESERVED_RXBCGPIM\0"
+	"RESERVED_RXMCGPIM\0"
+	"RXCRCERPIM\0"
+	"RESERVED_RXALGNERPIM\0"
+	"RESERVED_RXRUNTPIM\0"
+	"RESERVED_RXJABERPIM\0"
+	"RXUSIZEGPIM\0"
+	"RXOSIZEGPIM\0"
+	"RESERVED_RX64OCTGBPIM\0"
+	"RESERVED_RX65T127OCTGBPIM\0"
+	"RESERVED_RX128T255OCTGBPIM\0"
+	"RESERVED_RX256T511OCTGBPIM\0"
+	"RESERVED_RX512T1023OCTGBPIM\0"
+	"GMACF_MMC_RX_INTERRUPT_MASK_L\0"
+	"RESERVED_RX1024TMAXOCTGBPIM\0"
+	"RESERVED_RXUCGPIM\0"
+	"RESERVED_RXLENERPIM\0"
+	"RESERVED_RXORANGEPIM\0"
+	"RESERVED_RXPAUSPIM\0"
+	"RESERVED_RXFOVPIM\0"
+	"RESERVED_RXVLANGBPIM\0"
+	"RESERVED_RXWDOGPIM\0"
+	"RESERVED_RXRCVERRPIM\0"
+	"RESERVED_RXCTRLPIM\0"
+	"RXLPIUSCIM\0"
+	"RXLPITRCIM\0"
+	"GMACF_MMC_RX_INTERRUPT_MASK_H\0"
+	"RESERVED_TXGBOCTIM\0"
+	"TXGBPKTIM\0"
+	"RESERVED_TXBCGPIM\0"
+	"RESERVED_TXMCGPIM\0"
+	"RESERVED_TX64OCTGBPIM\0"
+	"RESERVED_TX65T127OCTGBPIM\0"
+	"RESERVED_TX128T255OCTGBPIM\0"
+	"RESERVED_TX256T511OCTGBPIM\0"
+	"RESERVED_TX512T1023OCTGBPIM\0"
+	"RESERVED_TX1024TMAXOCTGBPIM\0"
+	"RESERVED_TXUCGBPIM\0"
+	"RESERVED_TXMCGBPIM\0"
+	"RESERVED_TXBCGBPIM\0"
+	"TXUFLOWERPIM\0"
+	"RESERVED_TXSCOLGPIM\0"
+	"RESERVED_TXMCOLGPIM\0"
+	"GMACF_MMC_TX_INTERRUPT_MASK_L\0"
+	"RESERVED_TXDEFPIM\0"
+	"RESERVED_TXLATCOLPIM\0"
+	"RESERVED_TXEXCOLPIM\0"
+	"RESERVED_TXCARERPIM\0"
+	"RESERVED_TXGOCTIM\0"
+	"TXGPKTIM\0"
+	"RESERVED_TXEXDEFPIM\0"
+	"RESERVED_TXPAUSPIM\0"
+	"RESERVED_TXVLANGPIM\0"
+	"TXOSIZEGPIM\0"
+	"TXLPIUSCIM\0"
+	"TXLPITRCIM\0"
+	"GMACF_MMC_TX_INTERRUPT_MASK_H\0"
+	"TXPKTGB\0"
+	"GMACF_TX_PACKET_COUNT_GOOD_BAD_L\0"
+	"GMACF_TX_PACKET_COUNT_GOOD_BAD_H\0"
+	"TXUNDRFLW\0"
+	"GMACF_TX_UNDERFLOW_ERROR_PACKETS_L\0"
+	"GMACF_TX_UNDERFLOW_ERROR_PACKETS_H\0"
+	"TXPKTG\0"
+	"GMACF_TX_PACKET_COUNT_GOOD_L\0"
+	"GMACF_TX_PACKET_COUNT_GOOD_H\0"
+	"TXOSIZG\0"
+	"GMACF_TX_OSIZE_PACKETS_GOOD_L\0"
+	"GMACF_TX_OSIZE_PACKETS_GOOD_H\0"
+	"RXPKTGB\0"
+	"GMACF_RX_PACKETS_COUNT_GOOD_BAD_L\0"
+	"GMACF_RX_PACKETS_COUNT_GOOD_BAD_H\0"
+	"RXCRCERR\0"
+	"GMACF_RX_CRC_ERROR_PACKETS_L\0"
+	"GMACF_RX_CRC_ERROR_PACKETS_H\0"
+	"RXUNDERSZG\0"
+	"GMACF_RX_UNDERSIZE_PACKETS_GOOD_L\0"
+	"GMACF_RX_UNDERSIZE_PACKETS_GOOD_H\0"
+	"RXOVERSZG\0"
+	"GMACF_RX_OVERSIZE_PACKETS_GOOD_L\0"
+	"GMACF_RX_OVERSIZE_PACKETS_GOOD_H\0"
+	"TXLPIUSC\0"
+	"GMACF_TX_LPI_USEC_CNTR_L\0"
+	"GMACF_TX_LPI_USEC_CNTR_H\0"
+	"TXLPITRC\0"
+	"GMACF_TX_LPI_TRAN_CNTR_L\0"
+	"GMACF_TX_LPI_TRAN_CNTR_H\0"
+	"RXLPIUSC\0"
+	"GMACF_RX_LPI_USEC_CNTR_L\0"
+	"GMACF_RX_LPI_USEC_CNTR_H\0"
+	"RXLPITRC\0"
+	"GMACF_RX_LPI_TRAN_CNTR_L\0"
+	"GMACF_RX_LPI_TRAN_CNTR_H\0"
+	"TSENA\0"
+	"TSCFUPDT\0"
+	"TSINIT\0"
+	"TSUPDT\0"
+	"RESERVED_TSTRIG\0"
+	"TSADDREG\0"
+	"TSENALL\0"
+	"TSCTRLSSR\0"
+	"TSVER2ENA\0"
+	"TSIPENA\0"
+	"TSIPV6ENA\0"
+	"TSIPV4ENA\0"
+	"TSEVNTENA\0"
+	"TSMSTRENA\0"
+	"GMACF_MAC_TIMESTAMP_CONTROL_L\0"
+	"SNAPTYPSEL\0"
+	"TSENMACADDR\0"
+	"CSC\0"
+	"RESERVED_ESTI\0"
+	"RESERVED_23_21\0"
+	"TXTSSTSM\0"
+	"RESERVED_27_25\0"
+	"AV8021ASMEN\0"
+	"RESERVED_31_29\0"
+	"GMACF_MAC_TIMESTAMP_CONTROL_H\0"
+	"RESERVED_7_0\0"
+	"SNSINC\0"
+	"GMACF_MAC_SUB_SECOND_INCREMENT_L\0"
+	"SSINC\0"
+	"RESERVED_31_24\0"
+	"GMACF_MAC_SUB_SECOND_INCREMENT_H\0"
+	"TSS\0"
+	"GMACF_MAC_SYSTEM_TIME_SECONDS_L\0"
+	"GMACF_MAC_SYSTEM_TIME_SECONDS_H\0"
+	"TSSS\0"
+	"GMACF_MAC_SYSTEM_TIME_NANOSECONDS_L\0"
+	"GMACF_MAC_SYSTEM_TIME_NANOSECONDS_H\0"
+	"GMACF_MAC_SYSTEM_TIME_SECONDS_UPDATE_L\0"
+	"GMACF_MAC_SYSTEM_TIME_SECONDS_UPDATE_H\0"
+	"GMACF_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE_L\0"
+	"ADDSUB\0"
+	"GMACF_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE_H\0"
+	"TSAR\0"
+	"GMACF_MAC_TIMESTAMP_ADDEND_L\0"
+	"GMACF_MAC_TIMESTAMP_ADDEND_H\0"
+	"TSHWR\0"
+	"GMACF_MAC_SYSTEM_TIME_HIGHER_WORD_SECONDS_L\0"
+	"GMACF_MAC_SYSTEM_TIME_HIGHER_WORD_SECONDS_H\0"
+	"TSSOVF\0"
+	"TSTARGT0\0"
+	"AUXTSTRIG\0"
+	"TSTRGTERR0\0"
+	"TSTARGT1\0"
+	"TSTRGTERR1\0"
+	"TSTARGT2\0"
+	"TSTRGTERR2\0"
+	"TSTARGT3\0"
+	"TSTRGTERR3\0"
+	"RESERVED_14_10\0"
+	"TXTSSIS\0"
+	"GMACF_MAC_TIMESTAMP_STATUS_L\0"
+	"ATSSTN\0"
+	"RESERVED_23_20\0"
+	"ATSSTM\0"
+	"ATSNS\0"
+	"GMACF_MAC_TIMESTAMP_STATUS_H\0"
+	"TXTSSLO\0"
+	"GMACF_MAC_TX_TIMESTAMP_STATUS_NANOSECONDS_L\0"
+	"TXTSSMIS\0"
+	"GMACF_MAC_TX_TIMESTAMP_STATUS_NANOSECONDS_H\0"
+	"TXTSSHI\0"
+	"GMACF_MAC_TX_TIMESTAMP_STATUS_SECONDS_L\0"
+	"GMACF_MAC_TX_TIMESTAMP_STATUS_SECONDS_H\0"
+	"ATSFC\0"
+	"RESERVED_3_1\0"
+	"ATSEN0\0"
+	"ATSEN1\0"
+	"ATSEN2\0"
+	"ATSEN3\0"
+	"RESERVED_31_8\0"
+	"GMACF_MAC_AUXILIARY_CONTROL_L\0"
+	"GMACF_MAC_AUXILIARY_CONTROL_H\0"
+	"AUXTSLO\0"
+	"GMACF_MAC_AUXILIARY_TIMESTAMP_NANOSECONDS_L\0"
+	"GMACF_MAC_AUXILIARY_TIMESTAMP_NANOSECONDS_H\0"
+	"AUXTSHI\0"
+	"GMACF_MAC_AUXILIARY_TIMESTAMP_SECONDS_L\0"
+	"GMACF_MAC_AUXILIARY_TIMESTAMP_SECONDS_H\0"
+	"OSTIAC\0"
+	"GMACF_MAC_TIMESTAMP_INGRESS_ASYM_CORR_L\0"
+	"GMACF_MAC_TIMESTAMP_INGRESS_ASYM_CORR_H\0"
+	"OSTEAC\0"
+	"GMACF_MAC_TIMESTAMP_EGRESS_ASYM_CORR_L\0"
+	"GMACF_MAC_TIMESTAMP_EGRESS_ASYM_CORR_H\0"
+	"TSIC\0"
+	"GMACF_MAC_TIMESTAMP_INGRESS_CORR_NANOSECOND_L\0"
+	"GMACF_MAC_TIMESTAMP_INGRESS_CORR_NANOSECOND_H\0"
+	"TSEC\0"
+	"GMACF_MAC_TIMESTAMP_EGRESS_CORR_NANOSECOND_L\0"
+	"GMACF_MAC_TIMESTAMP_EGRESS_CORR_NANOSECOND_H\0"
+	"TSICSNS\0"
+	"GMACF_MAC_TIMESTAMP_INGRESS_CORR_SUBNANOSEC_L\0"
+	"GMACF_MAC_TIMESTAMP_INGRESS_CORR_SUBNANOSEC_H\0"
+	"TSECSNS\0"
+	"GMACF_MAC_TIMESTAMP_EGRESS_CORR_SUBNANOSEC_L\0"
+	"GMACF_MAC_TIMESTAMP_EGRESS_CORR_SUBNANOSEC_H\0"
+	"PPSCTRL_PPSCMD\0"
+	"PPSEN0\0"
+	"TRGTMODSEL0\0"
+	"RESERVED_PPSCMD1\0"
+	"RESERVED_12_11\0"
+	"RESERVED_TRGTMODSEL1\0"
+	"GMACF_MAC_PPS_CONTROL_L\0"
+	"RESERVED_PPSCMD2\0"
+	"RESERVED_20_19\0"
+	"RESERVED_TRGTMODSEL2\0"
+	"RESERVED_PPSCMD3\0"
+	"RESERVED_28_27\0"
+	"RESERVED_TRGTMODSEL3\0"
+	"GMACF_MAC_PPS_CONTROL_H\0"
+	"TSTRH0\0"
+	"GMACF_MAC_PPS0_TARGET_TIME_SECONDS_L\0"
+	"GMACF_MAC_PPS0_TARGET_TIME_SECONDS_H\0"
+	"TTSL0\0"
+	"GMACF_MAC_PPS0_TARGET_TIME_NANOSECONDS_L\0"
+	"TRGTBUSY0\0"
+	"GMACF_MAC_PPS0_TARGET_TIME_NANOSECONDS_H\0"
+	"PPSINT0\0"
+	"GMACF_MAC_PPS0_INTERVAL_L\0"
+	"GMACF_MAC_PPS0_INTERVAL_H\0"
+	"PPSWIDTH0\0"
+	"GMACF_MAC_PPS0_WIDTH_L\0"
+	"GMACF_MAC_PPS0_WIDTH_H\0"
+	"ASYNCEN\0"
+	"APDREQEN\0"
+	"ASYNCTRIG\0"
+	"APDREQTRIG\0"
+	"DRRDIS\0"
+	"PDRDIS\0"
+	"DN\0"
+	"GMACF_MAC_PTO_CONTROL_L\0"
+	"GMACF_MAC_PTO_CONTROL_H\0"
+	"SPI0\0"
+	"GMACF_MAC_SOURCE_PORT_IDENTITY0_L\0"
+	"GMACF_MAC_SOURCE_PORT_IDENTITY0_H\0"
+	"SPI1\0"
+	"GMACF_MAC_SOURCE_PORT_IDENTITY1_L\0"
+	"GMACF_MAC_SOURCE_PORT_IDENTITY1_H\0"
+	"SPI2\0"
+	"GMACF_MAC_SOURCE_PORT_IDENTITY2_L\0"
+	"GMACF_MAC_SOURCE_PORT_IDENTITY2_H\0"
+	"LSI\0"
+	"DRSYNCR\0"
+	"RESERVED_23_11\0"
+	"GMACF_MAC_LOG_MESSAGE_INTERVAL_L\0"
+	"LMPDRI\0"
+	"GMACF_MAC_LOG_MESSAGE_INTERVAL_H\0"
+	"GMACL_MAC_CONFIGURATION_L\0"
+	"GMACL_MAC_CONFIGURATION_H\0"
+	"GMACL_MAC_EXT_CONFIGURATION_L\0"
+	"GMACL_MAC_EXT_CONFIGURATION_H\0"
+	"GMACL_MAC_PACKET_FILTER_L\0"
+	"GMACL_MAC_PACKET_FILTER_H\0"
+	"GMACL_MAC_WATCHDOG_TIMEOUT_L\0"
+	"GMACL_MAC_WATCHDOG_TIMEOUT_H\0"
+	"GMACL_MAC_VLAN_TAG_L\0"
+	"GMACL_MAC_VLAN_TAG_H\0"
+	"GMACL_MAC_Q0_TX_FLOW_CTRL_L\0"
+	"GMACL_MAC_Q0_TX_FLOW_CTRL_H\0"
+	"GMACL_MAC_RX_FLOW_CTRL_L\0"
+	"GMACL_MAC_RX_FLOW_CTRL_H\0"
+	"RESERVED_MMCIS\0"
+	"RESERVED_MMCRXIS\0"
+	"RESERVED_MMCTXIS\0"
+	"GMACL_MAC_INTERRUPT_STATUS_L\0"
+	"GMACL_MAC_INTERRUPT_STATUS_H\0"
+	"GMACL_MAC_INTERRUPT_ENABLE_L\0"
+	"GMACL_MAC_INTERRUPT_ENABLE_H\0"
+	"GMACL_MAC_RX_TX_STATUS_L\0"
+	"GMACL_MAC_RX_TX_STATUS_H\0"
+	"GMACL_MAC_LPI_CONTROL_STATUS_L\0"
+	"GMACL_MAC_LPI_CONTROL_STATUS_H\0"
+	"GMACL_MAC_LPI_TIMERS_CONTROL_L\0"
+	"GMACL_MAC_LPI_TIMERS_CONTROL_H\0"
+	"GMACL_MAC_LPI_ENTRY_TIMER_L\0"
+	"GMACL_MAC_LPI_ENTRY_TIMER_H\0"
+	"GMACL_MAC_1US_TIC_COUNTER_L\0"
+	"GMACL_MAC_1US_TIC_COUNTER_H\0"
+	"GMACL_MAC_VERSION_L\0"
+	"GMACL_MAC_VERSION_H\0"
+	"GMACL_MAC_DEBUG_L\0"
+	"GMACL_MAC_DEBUG_H\0"
+	"GMACL_MAC_HW_FEATURE0_L\0"
+	"GMACL_MAC_HW_FEATURE0_H\0"
+	"GMACL_MAC_HW_FEATURE1_L\0"
+	"GMACL_MAC_HW_FEATURE1_H\0"
+	"GMACL_MAC_HW_FEATURE2_L\0"
+	"GMACL_MAC_HW_FEATURE2_H\0"
+	"GMACL_MAC_HW_FEATURE3_L\0"
+	"GMACL_MAC_HW_FEATURE3_H\0"
+	"GMACL_MAC_CSR_SW_CTRL_L\0"
+	"GMACL_MAC_CSR_SW_CTRL_H\0"
+	"GMACL_MAC_ADDRESS0_HIGH_L\0"
+	"GMACL_MAC_ADDRESS0_HIGH_H\0"
+	"GMACL_MAC_ADDRESS0_LOW_L\0"
+	"GMACL_MAC_ADDRESS0_LOW_H\0"
+	"TSTRIG\0"
+	"GMACL_MAC_TIMESTAMP_CONTROL_L\0"
+	"GMACL_MAC_TIMESTAMP_CONTROL_H\0"
+	"RESERVED_SNSINC\0"
+	"GMACL_MAC_SUB_SECOND_INCREMENT_L\0"
+	"GMACL_MAC_SUB_SECOND_INCREMENT_H\0"
+	"GMACL_MAC_SYSTEM_TIME_SECONDS_L\0"
+	"GMACL_MAC_SYSTEM_TIME_SECONDS_H\0"
+	"GMACL_MAC_SYSTEM_TIME_NANOSECONDS_L\0"
+	"GMACL_MAC_SYSTEM_TIME_NANOSECONDS_H\0"
+	"GMACL_MAC_SYSTEM_TIME_SECONDS_UPDATE_L\0"
+	"GMACL_MAC_SYSTEM_TIME_SECONDS_UPDATE_H\0"
+	"GMACL_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE_L\0"
+	"GMACL_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE_H\0"
+	"GMACL_MAC_TIMESTAMP_ADDEND_L\0"
+	"GMACL_MAC_TIMESTAMP_ADDEND_H\0"
+	"RESERVED_AUXTSTRIG\0"
+	"RESERVED_TXTSSIS\0"
+	"GMACL_MAC_TIMESTAMP_STATUS_L\0"
+	"RESERVED_ATSSTN\0"
+	"RESERVED_ATSSTM\0"
+	"RESERVED_ATSNS\0"
+	"GMACL_MAC_TIMESTAMP_STATUS_H\0"
+	"GMACL_MAC_TIMESTAMP_INGRESS_CORR_NANOSECOND_L\0"
+	"GMACL_MAC_TIMESTAMP_INGRESS_CORR_NANOSECOND_H\0"
+	"GMACL_MAC_TIMESTAMP_EGRESS_CORR_NANOSECOND_L\0"
+	"GMACL_MAC_TIMESTAMP_EGRESS_CORR_NANOSECOND_H\0"
+	"RESERVED_PPSEN0\0"
+	"RESERVED_TRGTMODSEL0\0"
+	"GMACL_MAC_PPS_CONTROL_L\0"
+	"GMACL_MAC_PPS_CONTROL_H\0"
+	"GMACL_MAC_PPS0_TARGET_TIME_SECONDS_L\0"
+	"GMACL_MAC_PPS0_TARGET_TIME_SECONDS_H\0"
+	"GMACL_MAC_PPS0_TARGET_TIME_NANOSECONDS_L\0"
+	"GMACL_MAC_PPS0_TARGET_TIME_NANOSECONDS_H\0"
+	"GMAC_BYP\0"
+	"GMACL_BYP\0"
+	"MACSECE_BYP\0"
+	"MACSECI_BYP\0"
+	"MACSEC_RST\0"
+	"CRC_ERR\0"
+	"PKT_ERR\0"
+	"SEC_FAIL\0"
+	"CLASS_DROP\0"
+	"CUST_3G\0"
+	"SGMII_LOOP\0"
+	"SB0_EQ_RST\0"
+	"SB0_DQ_RST\0"
+	"SB1_EQ_RST\0"
+	"SB1_DQ_RST\0"
+	"PM_PDI_CFG\0"
+	"GMAC_CRC_PAD\0"
+	"GMAC_ERR\0"
+	"GMAC_FLW_CTRL\0"
+	"GMAC_ENDIAN\0"
+	"GMAC_PTP_DET\0"
+	"PM_PDI_GMAC_CFG\0"
+	"GMACL_CRC_PAD\0"
+	"GMACL_ERR\0"
+	"GMACL_FLW_CTRL\0"
+	"GMACL_ENDIAN\0"
+	"GMACL_PTP_DET\0"
+	"PM_PEN\0"
+	"PM_PDI_GMACL_CFG\0"
+	"TXSTAT\0"
+	"PM_PDI_GMAC_TXSTAT_0\0"
+	"PM_PDI_GMAC_TXSTAT_1\0"
+	"RXSTAT\0"
+	"PM_PDI_GMAC_RXSTAT_0\0"
+	"PM_PDI_GMAC_RXSTAT_1\0"
+	"PM_PDI_GMAC_RXSTAT_2\0"
+	"PM_PDI_GMAC_RXSTAT_3\0"
+	"PM_PDI_GMAC_RXSTAT_4\0"
+	"PM_PDI_GMAC_RXSTAT_5\0"
+	"PM_PDI_GMAC_RXSTAT_6\0"
+	"PM_PDI_GMACL_TXSTAT_0\0"
+	"PM_PDI_GMACL_TXSTAT_1\0"
+	"PM_PDI_GMACL_RXSTAT_0\0"
+	"PM_PDI_GMACL_RXSTAT_1\0"
+	"PM_PDI_GMACL_RXSTAT_2\0"
+	"PM_PDI_GMACL_RXSTAT_3\0"
+	"PM_PDI_GMACL_RXSTAT_4\0"
+	"PM_PDI_GMACL_RXSTAT_5\0"
+	"PM_PDI_GMACL_RXSTAT_6\0"
+	"GMAC_LPI\0"
+	"GMACL_LPI\0"
+	"PM_PDI_LPI_STAT\0"
+	"TS_RESN\0"
+	"TX_OST_EN\0"
+	"TSL_RESN\0"
+	"TX_FIFO_EN\0"
+	"RX_FIFO_EN\0"
+	"TX_FIFO_RSTN\0"
+	"RX_FIFO_RSTN\0"
+	"PHY_TXTS\0"
+	"PHY_RXTS\0"
+	"PM_PDI_TS_CFG\0"
+	"TX_FILL_LVL\0"
+	"TX_OVF\0"
+	"TX_UDF\0"
+	"RX_FILL_LVL\0"
+	"RX_OVF\0"
+	"RX_UDF\0"
+	"PM_PDI_TS_FIFO_STAT\0"
+	"PTP_OFFSET\0"
+	"PTP_TPT\0"
+	"PM_PDI_GMAC_PTP_CFG\0"
+	"SPARE\0"
+	"PM_PDI_SPARE\0"
+	"MTI_TS\0"
+	"PM_PDI_GMAC_TX_TS_STAT_0\0"
+	"PM_PDI_GMAC_TX_TS_STAT_1\0"
+	"PM_PDI_GMAC_TX_TS_STAT_2\0"
+	"PM_PDI_GMAC_TX_TS_STAT_3\0"
+	"CRC_L\0"
+	"PM_PDI_GMAC_TX_CRC_STAT_0\0"
+	"CRC_U\0"
+	"PM_PDI_GMAC_TX_CRC_STAT_1\0"
+	"PM_PDI_GMACL_TX_TS_STAT_0\0"
+	"PM_PDI_GMACL_TX_TS_STAT_1\0"
+	"PM_PDI_GMACL_TX_TS_STAT_2\0"
+	"PM_PDI_GMACL_TX_TS_STAT_3\0"
+	"MRI_TS\0"
+	"PM_PDI_GMAC_RX_TS_STAT_0\0"
+	"PM_PDI_GMAC_RX_TS_STAT_1\0"
+	"PM_PDI_GMAC_RX_TS_STAT_2\0"
+	"PM_PDI_GMAC_RX_TS_STAT_3\0"
+	"PM_PDI_GMAC_RX_CRC_STAT_0\0"
+	"PM_PDI_GMAC_RX_CRC_STAT_1\0"
+	"PM_PDI_GMACL_RX_TS_STAT_0\0"
+	"PM_PDI_GMACL_RX_TS_STAT_1\0"
+	"PM_PDI_GMACL_RX_TS_STAT_2\0"
+	"PM_PDI_GMACL_RX_TS_STAT_3\0"
+	"MTI_OST\0"
+	"PM_PDI_TX_OST_CFG_0\0"
+	"PM_PDI_TX_OST_CFG_1\0"
+	"PM_PDI_TX_OST_CFG_2\0"
+	"PM_PDI_TX_OST_CFG_3\0"
+	"PTP_TS\0"
+	"PM_PDI_GMAC_PTP_TS_STAT_0\0"
+	"PM_PDI_GMAC_PTP_TS_STAT_1\0"
+	"PM_PDI_GMAC_PTP_TS_STAT_2\0"
+	"PM_PDI_GMAC_PTP_TS_STAT_3\0"
+	"PM_PDI_GMACL_PTP_TS_STAT_0\0"
+	"PM_PDI_GMACL_PTP_TS_STAT_1\0"
+	"PM_PDI_GMACL_PTP_TS_STAT_2\0"
+	"PM_PDI_GMACL_PTP_TS_STAT_3\0"
+	"SB0_OV\0"
+	"SB0_TX_REG_OV\0"
+	"SB0_RX_REG_OV\0"
+	"SB1_OV\0"
+	"SB1_TX_REG_OV\0"
+	"SB1_RX_REG_OV\0"
+	"SB0_RETRY\0"
+	"SB0_SENT\0"
+	"SB1_RETRY\0"
+	"SB1_SENT\0"
+	"SB0_COMPLETE\0"
+	"SB1_COMPLETE\0"
+	"PM_PDI_BM_STAT\0"
+	"PM_PDI_SB0_START\0"
+	"PM_PDI_SB1_START\0"
+	"END\0"
+	"PM_PDI_SB0_END\0"
+	"PM_PDI_SB1_END\0"
+	"SB0_WPTR\0"
+	"PM_PDI_SB0_WPTR\0"
+	"SB0_RPTR\0"
+	"PM_PDI_SB0_RPTR\0"
+	"SB1_WPTR\0"
+	"PM_PDI_SB1_WPTR\0"
+	"SB1_RPTR\0"
+	"PM_PDI_SB1_RPTR\0"
+	"SOP_PTR\0"
+	"PM_PDI_SB0_SOP_RPTR\0"
+	"PM_PDI_SB1_SOP_RPTR\0"
+	"PM_PDI_SB0_SOP_WPTR\0"
+	"PM_PDI_SB1_SOP_WPTR\0"
+	"PKT_THRES\0"
+	"PM_PDI_SB0_PKT_THRES\0"
+	"PM_PDI_SB1_PKT_THRES\0"
+	"PM_PDI_SB0_TXREG_DATA_0\0"
+	"PM_PDI_SB0_TXREG_DATA_1\0"
+	"PM_PDI_SB0_TXREG_DATA_2\0"
+	"PM_PDI_SB0_TXREG_DATA_3\0"
+	"PM_PDI_SB0_TXREG_DATA_4\0"
+	"PM_PDI_SB0_TXREG_DATA_5\0"
+	"PM_PDI_SB0_TXREG_DATA_6\0"
+	"PM_PDI_SB0_TXREG_DATA_7\0"
+	"EOP\0"
+	"SOP\0"
+	"TS\0"
+	"C\0"
+	"PM_PDI_SB0_TXREG_CTRL\0"
+	"PM_PDI_SB1_TXREG_DATA_0\0"
+	"PM_PDI_SB1_TXREG_DATA_1\0"
+	"PM_PDI_SB1_TXREG_DATA_2\0"
+	"PM_PDI_SB1_TXREG_DATA_3\0"
+	"PM_PDI_SB1_TXREG_DATA_4\0"
+	"PM_PDI_SB1_TXREG_DATA_5\0"
+	"PM_PDI_SB1_TXREG_DATA_6\0"
+	"PM_PDI_SB1_TXREG_DATA_7\0"
+	"PM_PDI_SB1_TXREG_CTRL\0"
+	"PM_PDI_SB0_RXREG_DATA_0\0"
+	"PM_PDI_SB0_RXREG_DATA_1\0"
+	"PM_PDI_SB0_RXREG_DATA_2\0"
+	"PM_PDI_SB0_RXREG_DATA_3\0"
+	"PM_PDI_SB0_RXREG_DATA_4\0"
+	"PM_PDI_SB0_RXREG_DATA_5\0"
+	"PM_PDI_SB0_RXREG_DATA_6\0"
+	"PM_PDI_SB0_RXREG_DATA_7\0"
+	"PM_PDI_SB0_RXREG_CTRL\0"
+	"PM_PDI_SB1_RXREG_DATA_0\0"
+	"PM_PDI_SB1_RXREG_DATA_1\0"
+	"PM_PDI_SB1_RXREG_DATA_2\0"
+	"PM_PDI_SB1_RXREG_DATA_3\0"
+	"PM_PDI_SB1_RXREG_DATA_4\0"
+	"PM_PDI_SB1_RXREG_DATA_5\0"
+	"PM_PDI_SB1_RXREG_DATA_6\0"
+	"PM_PDI_SB1_RXREG_DATA_7\0"
+	"PM_PDI_SB1_RXREG_CTRL\0"
+	"PAUSE_THRES\0"
+	"PM_PDI_PAUSE_THRES\0"
+	"PAUSE_OFF_THRES\0"
+	"PM_PDI_PAUSE_DEASSERT_THRES\0"
+	"REN\0"
+	"WEN\0"
+	"PM_PDI_CTRL\0"
+	"ADDRL\0"
+	"PM_PDI_ADDRL\0"
+	"ADDRH\0"
+	"PM_PDI_ADDRH\0"
+	"DATAL\0"
+	"PM_PDI_DATAL\0"
+	"DATAH\0"
+	"PM_PDI_DATAH\0"
+	"GPIO\0"
+	"GPIO_PDI_REGISTERS_GPIO_OUT\0"
+	"GPIO_PDI_REGISTERS_GPIO_IN\0"
+	"GPIO_PDI_REGISTERS_GPIO_DIR\0"
+	"GPIO_PDI_REGISTERS_GPIO_ALTSEL0\0"
+	"GPIO_PDI_REGISTERS_GPIO_ALTSEL1\0"
+	"GPIO_PDI_REGISTERS_GPIO_OD\0"
+	"GPIO_PDI_REGISTERS_GPIO_PUDSEL\0"
+	"GPIO_PDI_REGISTERS_GPIO_PUDEN\0"
+	"GPIO_PDI_REGISTERS_GPIO2_OUT\0"
+	"GPIO_PDI_REGISTERS_GPIO2_IN\0"
+	"GPIO_PDI_REGISTERS_GPIO2_DIR\0"
+	"GPIO_PDI_REGISTERS_GPIO2_ALTSEL0\0"
+	"GPIO_PDI_REGISTERS_GPIO2_ALTSEL1\0"
+	"GPIO_PDI_REGISTERS_GPIO2_OD\0"
+	"GPIO_PDI_REGISTERS_GPIO2_PUDSEL\0"
+	"GPIO_PDI_REGISTERS_GPIO2_PUDEN\0"
+	"GPIO_PDI_REGISTERS_GPIO_DRIVE0_CFG\0"
+	"GPIO_PDI_REGISTERS_GPIO_DRIVE1_CFG\0"
+	"GPIO_PDI_REGISTERS_GPIO_SLEW_CFG\0"
+	"PAD_VOL\0"
+	"GPIO_PDI_REGISTERS_GPIO_VOL_CFG\0"
+	"GPIO2\0"
+	"GPIO_PDI_REGISTERS_GPIO2_DRIVE0_CFG\0"
+	"GPIO_PDI_REGISTERS_GPIO2_DRIVE1_CFG\0"
+	"GPIO_PDI_REGISTERS_GPIO2_SLEW_CFG\0"
+	"LED0\0"
+	"LED1\0"
+	"LED2\0"
+	"LED3\0"
+	"LED4\0"
+	"LED5\0"
+	"LED6\0"
+	"LED7\0"
+	"LED8\0"
+	"LED9\0"
+	"LED10\0"
+	"LED11\0"
+	"LED12\0"
+	"LED_BCTRL_PDI_REGISTERS_LED_MD_CFG\0"
+	"TWOSWEN\0"
+	"EDGE_DET\0"
+	"MINLEVEL\0"
+	"MAXLEVEL\0"
+	"LED_BCTRL_PDI_REGISTERS_LED_BRT_CTRL\0"
+	"PERIOD\0"
+	"SENS_EN\0"
+	"CURLEVEL\0"
+	"TD\0"
+	"LED_BCTRL_PDI_REGISTERS_LED_LSENS_CTRL\0"
+	"PREN\0"
+	"GPHYISO\0"
+	"SMDIO_PDI_SMDIO_REGISTERS_SMDIO_CFG\0"
+	"SMDIO_PDI_SMDIO_REGISTERS_SMDIO_BADR\0"
+	"PAREN\0"
+	"STOP\0"
+	"CR_DIS\0"
+	"LF_DIS\0"
+	"UART_PDI_REGISTERS_UART_CFG\0"
+	"BD\0"
+	"UART_PDI_REGISTERS_UART_BD\0"
+	"FDIV\0"
+	"UART_PDI_REGISTERS_UART_FDIV\0"
+	"PROMPT0\0"
+	"PROMPT1\0"
+	"UART_PDI_REGISTERS_UART_PROMPT\0"
+	"UART_PDI_REGISTERS_UART_ERRCNT\0"
+	"SS_5_2\0"
+	"SS6\0"
+	"RESERVED_10_7\0"
+	"LPM\0"
+	"SS13\0"
+	"XPCS_SR_PMA_CTRL1\0"
+	"LPMS\0"
+	"RLU\0"
+	"RESERVED_6_3\0"
+	"FLT\0"
+	"XPCS_SR_PMA_STATUS1\0"
+	"PMA_DEV_OUI_3_18\0"
+	"XPCS_SR_PMA_DEV_ID_1\0"
+	"PMA_DEV_RN_3_0\0"
+	"PMA_DEV_MMN_5_0\0"
+	"PMA_DEV_OUI_19_24\0"
+	"XPCS_SR_PMA_DEV_ID_2\0"
+	"XGC\0"
+	"GC\0"
+	"RESERVED_15_5\0"
+	"XPCS_SR_PMA_SPD_ABL\0"
+	"CLS22\0"
+	"PMA_PMD\0"
+	"AN\0"
+	"XPCS_SR_PMA_DEV_PKG1\0"
+	"RESERVED_13_0\0"
+	"VSD1\0"
+	"VSD2\0"
+	"XPCS_SR_PMA_DEV_PKG2\0"
+	"PMA_TYPE\0"
+	"RESERVED_15_6\0"
+	"XPCS_SR_PMA_CTRL2\0"
+	"PMA_LOOP\0"
+	"XGEWEN\0"
+	"XGLWEN\0"
+	"XGSWEN\0"
+	"LX4_ABL\0"
+	"ER_ABL\0"
+	"LR_ABL\0"
+	"SR_ABL\0"
+	"TD_ABL\0"
+	"EXT_ABL\0"
+	"TF\0"
+	"PRFA\0"
+	"PTFA\0"
+	"DP\0"
+	"XPCS_SR_PMA_STATUS2\0"
+	"GTD\0"
+	"PMA_TX_DIS_0\0"
+	"PMA_TX_DIS_3_1\0"
+	"XPCS_SR_PMA_TX_DIS\0"
+	"RX_DET\0"
+	"PMA_RX_DET_0\0"
+	"PMA_RX_DET_3_1\0"
+	"XPCS_SR_PMA_RX_SIG_DET\0"
+	"XGBCX4_ABL\0"
+	"XGBLRM_ABL\0"
+	"XGBT_ABL\0"
+	"XGKX4_ABL\0"
+	"XGBKR_ABL\0"
+	"GBT_ABL\0"
+	"R_100BKX_ABL\0"
+	"R_100BT_ABL\0"
+	"R_10BT_ABL\0"
+	"RESERVED_15_9\0"
+	"XPCS_SR_PMA_EXT_ABL\0"
+	"PMA_PKG_OUI_3_18\0"
+	"XPCS_SR_PMA_PKG1\0"
+	"PMA_PKG_RN_3_0\0"
+	"PMA_PKG_MMN_5_0\0"
+	"PMA_PKG_OUI_19_24\0"
+	"XPCS_SR_PMA_PKG2\0"
+	"ABL_2PT5GT\0"
+	"ABL_5GT\0"
+	"ABL_2PT5GKX\0"
+	"ABL_5GKR\0"
+	"RESERVED_15_4\0"
+	"XPCS_SR_PMA_2PT5G_5G_EXT_ABL\0"
+	"RS_TR\0"
+	"TR_EN\0"
+	"RESERVE_15_2\0"
+	"XPCS_SR_PMA_KR_PMD_CTRL\0"
+	"RCV_STS\0"
+	"FRM_LCK\0"
+	"SU_PR_DTD\0"
+	"TR_FAIL\0"
+	"XPCS_SR_PMA_KR_PMD_STS\0"
+	"LP_CFF_UPDTM1\0"
+	"LP_CFF_UPDT0\0"
+	"LP_CFF_UPDT1\0"
+	"LP_INIT\0"
+	"PRST\0"
+	"XPCS_SR_PMA_KR_LP_CEU\0"
+	"LP_CFF_STSM0\0"
+	"LP_CFF_STS0\0"
+	"LP_CFF_STS1\0"
+	"RESERVED_14_6\0"
+	"LP_RR\0"
+	"XPCS_SR_PMA_KR_LP_CESTS\0"
+	"CFF_UPDTM1\0"
+	"CFF_UPDT0\0"
+	"CFF_UPDT1\0"
+	"XPCS_SR_PMA_KR_LD_CEU\0"
+	"CFF_STSM0\0"
+	"CFF_STS0\0"
+	"CFF_STS1\0"
+	"RR\0"
+	"XPCS_SR_PMA_KR_LD_CESTS\0"
+	"TOC\0"
+	"RESERVED_15_1\0"
+	"XPCS_SR_PMA_KX_CTRL\0"
+	"SD\0"
+	"PMA_TDA\0"
+	"RX_F\0"
+	"TX_F\0"
+	"RFA\0"
+	"TFA\0"
+	"XPCS_SR_PMA_KX_STS\0"
+	"FEC_ABL\0"
+	"ERR_IND_ABL\0"
+	"RESERVED_15_2\0"
+	"XPCS_SR_PMA_KR_FEC_ABL\0"
+	"FEC_EN\0"
+	"EN_ERR_IND\0"
+	"XPCS_SR_PMA_KR_FEC_CTRL\0"
+	"CORR_B_CNT1\0"
+	"XPCS_SR_PMA_KR_FEC_CORR_BLK1\0"
+	"CORR_B_CNT2\0"
+	"XPCS_SR_PMA_KR_FEC_CORR_BLK2\0"
+	"UCORR_B_CNT1\0"
+	"XPCS_SR_PMA_KR_FEC_UCORR_BLK1\0"
+	"UCORR_B_CNT2\0"
+	"XPCS_SR_PMA_KR_FEC_UCORR_BLK2\0"
+	"PMA_RX_DLY_ABL\0"
+	"PMA_TX_DLY_ABL\0"
+	"XPCS_SR_PMA_TIME_SYNC_PMA_ABL\0"
+	"PMA_TX_MAX_DLY_LWR\0"
+	"XPCS_SR_PMA_TIME_SYNC_TX_MAX_DLY_LWR\0"
+	"PMA_TX_MAX_DLY_UPR\0"
+	"XPCS_SR_PMA_TIME_SYNC_TX_MAX_DLY_UPR\0"
+	"PMA_TX_MIN_DLY_LWR\0"
+	"XPCS_SR_PMA_TIME_SYNC_TX_MIN_DLY_LWR\0"
+	"PMA_TX_MIN_DLY_UPR\0"
+	"XPCS_SR_PMA_TIME_SYNC_TX_MIN_DLY_UPR\0"
+	"PMA_RX_MAX_DLY_LWR\0"
+	"XPCS_SR_PMA_TIME_SYNC_RX_MAX_DLY_LWR\0"
+	"PMA_RX_MAX_DLY_UPR\0"
+	"XPCS_SR_PMA_TIME_SYNC_RX_MAX_DLY_UPR\0"
+	"PMA_RX_MIN_DLY_LWR\0"
+	"XPCS_SR_PMA_TIME_SYNC_RX_MIN_DLY_LWR\0"
+	"PMA_RX_MIN_DLY_UPR\0"
+	"XPCS_SR_PMA_TIME_SYNC_RX_MIN_DLY_UPR\0"
+	"CL72_AUTO\0"
+	"BYP_PWRUP\0"
+	"DTXLANED_0\0"
+	"DTXLANED_3_1\0"
+	"RESERVED_10_8\0"
+	"PWRSV\0"
+	"RESERVED_14_12\0"
+	"VR_RST\0"
+	"XPCS_VR_PMA_DIG_CTRL1\0"
+	"PRBS_MODE_EN\0"
+	"PRBS31_EN\0"
+	"XPCS_VR_PMA_KRTR_PRBS_CTRL0\0"
+	"PRBS_TIM_LMT\0"
+	"XPCS_VR_PMA_KRTR_PRBS_CTRL1\0"
+	"PRBS_ERR_LMT\0"
+	"XPCS_VR_PMA_KRTR_PRBS_CTRL2\0"
+	"MAX_WAIT_TIME\0"
+	"XPCS_VR_PMA_KRTR_TIMER_CTRL0\0"
+	"WAIT_TIME\0"
+	"XPCS_VR_PMA_KRTR_TIMER_CTRL1\0"
+	"RX_TRAIN_TIME\0"
+	"XPCS_VR_PMA_KRTR_TIMER_CTRL2\0"
+	"RR_RDY\0"
+	"RESERVED_14_9\0"
+	"RX_EQ_MM\0"
+	"XPCS_VR_PMA_KRTR_RX_EQ_CTRL\0"
+	"CFF_STSM1\0"
+	"TX_EQ_MM\0"
+	"XPCS_VR_PMA_KRTR_TX_EQ_STS_CTRL\0"
+	"CFF_INIT\0"
+	"CFF_PRST\0"
+	"XPCS_VR_PMA_KRTR_TX_EQ_CFF_CTRL\0"
+	"EQ_STSM1\0"
+	"EQ_STS0\0"
+	"EQ_STS1\0"
+	"STSM1_VLD\0"
+	"STS0_VLD\0"
+	"STS1_VLD\0"
+	"XPCS_VR_PMA_PHY_TX_EQ_STS\0"
+	"CFF_UPDTM1_VLD\0"
+	"CFF_UPDT0_VLD\0"
+	"CFF_UPDT1_VLD\0"
+	"XPCS_VR_PMA_PHY_RX_EQ_CEU\0"
+	"LB_ACTIVE\0"
+	"PSEQ_STATE\0"
+	"XPCS_VR_PMA_DIG_STS\0"
+	"RESERVED_3_0\0"
+	"SIG_DET_0\0"
+	"SIG_DET_3_1\0"
+	"RX_PLL_STATE_0\0"
+	"RX_PLL_STATE_3_1\0"
+	"RX_VALID_0\0"
+	"RX_VALID_3_1\0"
+	"XPCS_VR_XS_PMA_RX_LSTS\0"
+	"TXBCN_EN_0\0"
+	"TXBCN_EN_3_1\0"
+	"TX_INV_0\0"
+	"TX_INV_3_1\0"
+	"TX_RST_0\0"
+	"TX_RST_3_1\0"
+	"TX_DT_EN_0\0"
+	"TX_DT_EN_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_GENCTRL0\0"
+	"DET_RX_REQ_0\0"
+	"DET_RX_REQ_3_1\0"
+	"VBOOST_EN_0\0"
+	"VBOOST_EN_3_1\0"
+	"VBOOST_LVL\0"
+	"TX_CLK_RDY_0\0"
+	"TX_CLK_RDY_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_GENCTRL1\0"
+	"TX_REQ_0\0"
+	"TX_REQ_3_1\0"
+	"TX_LPD_0\0"
+	"TX_LPD_3_1\0"
+	"TX0_WIDTH\0"
+	"TX1_WIDTH\0"
+	"TX2_WIDTH\0"
+	"TX3_WIDTH\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_TX_GENCTRL2\0"
+	"TX0_IBOOST\0"
+	"TX1_IBOOST\0"
+	"TX2_IBOOST\0"
+	"TX3_IBOOST\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_BOOST_CTRL\0"
+	"TX0_RATE\0"
+	"TX1_RATE\0"
+	"TX2_RATE\0"
+	"TX3_RATE\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_RATE_CTRL\0"
+	"TX0_PSTATE\0"
+	"TX1_PSTATE\0"
+	"TX2_PSTATE\0"
+	"TX3_PSTATE\0"
+	"TX_DISABLE_0\0"
+	"TX_DISABLE_3_1\0"
+	"RESERVED_15_12\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_POWER_STATE_CTRL\0"
+	"TX_EQ_PRE\0"
+	"TX_EQ_MAIN\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_EQ_CTRL0\0"
+	"TX_EQ_POST\0"
+	"TX_EQ_OVR_RIDE\0"
+	"TX_EQ_DEF_CTRL\0"
+	"CA_TX_EQ\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_EQ_CTRL1\0"
+	"PRE_MAX_LMT\0"
+	"POST_MAX_LMT\0"
+	"LMAIN_MIN_LMT\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_EQ_CTRL2\0"
+	"NATTEN_MAX_LMT\0"
+	"MISC_LMT\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_EQ_CTRL3\0"
+	"PRE_INIT\0"
+	"LMAIN_INIT\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_EQ_INIT_CTRL0\0"
+	"POST_INIT\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_EQ_INIT_CTRL1\0"
+	"TX_ACK_0\0"
+	"TX_ACK_3_1\0"
+	"DETRX_RSLT_0\0"
+	"DETRX_RSLT_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_TX_STS\0"
+	"RX_TERM_EN_0\0"
+	"RX_TERM_EN_3_1\0"
+	"RX_ALIGN_EN_0\0"
+	"RX_ALIGN_EN_3_1\0"
+	"RX_DT_EN_0\0"
+	"RX_DT_EN_3_1\0"
+	"RX_CLKSFT_0\0"
+	"RX_CLKSFT_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_GENCTRL0\0"
+	"RX_INV_0\0"
+	"RX_INV_3_1\0"
+	"RX_RST_0\0"
+	"RX_RST_3_1\0"
+	"RX_TERM_ACDC_0\0"
+	"RX_TERM_ACDC_3_1\0"
+	"RX_DIV16P5_CLK_EN_0\0"
+	"RX_DIV16P5_CLK_EN_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_GENCTRL1\0"
+	"RX_REQ_0\0"
+	"RX_REQ_3_1\0"
+	"RX_LPD_0\0"
+	"RX_LPD_3_1\0"
+	"RX0_WIDTH\0"
+	"RX1_WIDTH\0"
+	"RX2_WIDTH\0"
+	"RX3_WIDTH\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_RX_GENCTRL2\0"
+	"LOS_TRSHLD_0\0"
+	"LOS_TRSHLD_1\0"
+	"LOS_TRSHLD_2\0"
+	"LOS_TRSHLD_3\0"
+	"LOS_LFPS_EN_0\0"
+	"LOS_LFPS_EN_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_RX_GENCTRL3\0"
+	"RX0_RATE\0"
+	"RX1_RATE\0"
+	"RX2_RATE\0"
+	"RX3_RATE\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_RATE_CTRL\0"
+	"RX0_PSTATE\0"
+	"RX1_PSTATE\0"
+	"RX2_PSTATE\0"
+	"RX3_PSTATE\0"
+	"RX_DISABLE_0\0"
+	"RX_DISABLE_3_1\0"
+	"EEE_OVR_RIDE\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_POWER_STATE_CTRL\0"
+	"CDR_TRACK_EN_0\0"
+	"CDR_TRACK_EN_3_1\0"
+	"CDR_SSC_EN_0\0"
+	"CDR_SSC_EN_3_1\0"
+	"VCO_LOW_FREQ_0\0"
+	"VCO_LOW_FREQ_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_CDR_CTRL\0"
+	"RX0_EQ_ATT_LVL\0"
+	"RX1_EQ_ATT_LVL\0"
+	"RX2_EQ_ATT_LVL\0"
+	"RX3_EQ_ATT_LVL\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_ATTN_CTRL\0"
+	"CTLE_BOOST_0\0"
+	"CTLE_POLE_0\0"
+	"VGA2_GAIN_0\0"
+	"VGA1_GAIN_0\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_RX_EQ_CTRL0\0"
+	"CONT_ADAPT_0\0"
+	"CONT_ADAPT_3_1\0"
+	"CONT_OFF_CAN_0\0"
+	"CONT_OFF_CAN_3_1\0"
+	"SEQ_EQ_EN\0"
+	"PING_PONG_EN\0"
+	"SELF_MAIN_EN\0"
+	"RX_EQ_STRT_CTRL\0"
+	"RX_AD_REQ\0"
+	"RESERVED_15_13\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_EQ_CTRL4\0"
+	"AFE_EN_0\0"
+	"AFE_EN_3_1\0"
+	"DFE_EN_0\0"
+	"DFE_EN_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_AFE_DFE_EN_CTRL\0"
+	"DFE_TAP1_0\0"
+	"DFE_TAP1_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_DFE_TAP_CTRL0\0"
+	"RX_ACK_0\0"
+	"RX_ACK_3_1\0"
+	"LF_SD_0\0"
+	"LF_SD_3_1\0"
+	"HF_SD_0\0"
+	"HF_SD_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_RX_STS\0"
+	"MPLL_EN_0\0"
+	"MPLL_EN_3_1\0"
+	"MPLLB_SEL_0\0"
+	"MPLLB_SEL_3_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_CMN_CTRL\0"
+	"MPLLA_MULTIPLIER\0"
+	"MPLLA_SSC_CLK_SEL\0"
+	"FRAC_EN\0"
+	"FR_CFG_UP_EN\0"
+	"PMIX_EN\0"
+	"MPLLA_CAL_DISABLE\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_MPLLA_CTRL0\0"
+	"MPLLA_SSC_EN\0"
+	"MPLLA_SSC_RANGE\0"
+	"MPLLA_FRACN_CTRL\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_MPLLA_CTRL1\0"
+	"MPLLA_DIV_MULT\0"
+	"MPLLA_DIV_CLK_EN\0"
+	"MPLLA_DIV8_CLK_EN\0"
+	"MPLLA_DIV10_CLK_EN\0"
+	"MPLLA_DIV16P5_CLK_EN\0"
+	"MPLLA_TX_CLK_DIV\0"
+	"MPLLA_RECAL_BANK_SEL\0"
+	"MPLLA_WRD_DIV2_EN\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_MPLLA_CTRL2\0"
+	"MPLLB_MULTIPLIER\0"
+	"MPLLB_SSC_CLK_SEL\0"
+	"MPLLB_CAL_DISABLE\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_MPLLB_CTRL0\0"
+	"MPLLB_SSC_EN\0"
+	"MPLLB_SSC_RANGE\0"
+	"MPLLB_FRACN_CTRL\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_MPLLB_CTRL1\0"
+	"MPLLB_DIV_MULT\0"
+	"MPLLB_DIV_CLK_EN\0"
+	"MPLLB_DIV8_CLK_EN\0"
+	"MPLLB_DIV10_CLK_EN\0"
+	"MPLLB_TX_CLK_DIV\0"
+	"MPLLB_RECAL_BANK_SEL\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_MPLLB_CTRL2\0"
+	"MPLLA_BANDWIDTH\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_MPLLA_CTRL3\0"
+	"MPLLB_BANDWIDTH\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_MPLLB_CTRL3\0"
+	"TX2RX_LB_EN_0\0"
+	"TX2RX_LB_EN_3_1\0"
+	"RX2TX_LB_EN_0\0"
+	"RX2TX_LB_EN_3_1\0"
+	"RX_VREF_CTRL\0"
+	"RTUNE_REQ\0"
+	"CR_PARA_SEL\0"
+	"PLL_CTRL\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_MISC_CTRL0\0"
+	"REF_CLK_EN\0"
+	"REF_USE_PAD\0"
+	"REF_CLK_DIV2\0"
+	"REF_RANGE\0"
+	"REF_MPLLA_DIV2\0"
+	"REF_MPLLB_DIV2\0"
+	"REF_RPT_CLK_EN\0"
+	"ALT_LP_CLK_SEL\0"
+	"REF_MPLLA_DIV\0"
+	"REF_MPLLB_DIV\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_REF_CLK_CTRL\0"
+	"VCO_LD_VAL_0\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_VCO_CAL_LD0\0"
+	"VCO_REF_LD_0\0"
+	"VCO_REF_LD_1\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_VCO_CAL_REF0\0"
+	"FOM\0"
+	"RTUNE_ACK\0"
+	"MPLLA_STS\0"
+	"MPLLB_STS\0"
+	"REF_CLKDET_RESULT\0"
+	"RX_ADPT_ACK\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_MISC_STS\0"
+	"RX_LNK_UP_TIME\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_MISC_CTRL1\0"
+	"MIN_QUIET_COUNT\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_EEE_CTRL\0"
+	"INIT_DN\0"
+	"EXT_LD_DN\0"
+	"BTLD_BYP\0"
+	"XPCS_VR_XS_PMA_SNPS_MP_12G_16G_25G_SRAM\0"
+	"START_BUSY\0"
+	"WR_RDN\0"
+	"XPCS_VR_XS_PMA_SNPS_CR_CTRL\0"
+	"ADDRESS\0"
+	"XPCS_VR_XS_PMA_SNPS_CR_ADDR\0"
+	"XPCS_VR_XS_PMA_SNPS_CR_DATA\0"
+	"RESERVED_1_0\0"
+	"RESERVED_8_7\0"
+	"XAUI_STOP\0"
+	"CS_EN\0"
+	"LBE\0"
+	"XPCS_SR_XS_PCS_CTRL1\0"
+	"RESERVED_5_3\0"
+	"RXLPII\0"
+	"TXLPII\0"
+	"RXLPIR\0"
+	"TXLPIR\0"
+	"XPCS_SR_XS_PCS_STS1\0"
+	"PCS_DEV_OUI_3_18\0"
+	"XPCS_SR_XS_PCS_DEV_ID1\0"
+	"PCS_DEV_RN_3_0\0"
+	"PCS_DEV_MMN_5_0\0"
+	"PCS_DEV_OUI_19_24\0"
+	"XPCS_SR_XS_PCS_DEV_ID2\0"
+	"XPCS_SR_XS_PCS_SPD_ABL\0"
+	"XPCS_SR_XS_PCS_DEV_PKG1\0"
+	"XPCS_SR_XS_PCS_DEV_PKG2\0"
+	"XPCS_SR_XS_PCS_CTRL2\0"
+	"CAP_EN\0"
+	"CAP_10_1GC\0"
+	"CAP_10GBW\0"
+	"CAP_10GBT\0"
+	"RESERVED_9_4\0"
+	"RESERVED_13_12\0"
+	"DS\0"
+	"XPCS_SR_XS_PCS_STS2\0"
+	"CAP_200GR\0"
+	"CAP_400GR\0"
+	"CAP_2PT5GX\0"
+	"CAP_5GR\0"
+	"XPCS_SR_XS_PCS_STS3\0"
+	"PCS_PKG_OUI_3_18\0"
+	"XPCS_SR_XS_PCS_PKG1\0"
+	"PCS_PKG_RN_3_0\0"
+	"PCS_PKG_MMN_5_0\0"
+	"PCS_PKG_OUI_19_24\0"
+	"XPCS_SR_XS_PCS_PKG2\0"
+	"XS\0"
+	"EN_100TEE\0"
+	"EN_1GTEEE\0"
+	"TEEE\0"
+	"KXEEE\0"
+	"KX4EEE\0"
+	"KREEE\0"
+	"RESERVED_15_7\0"
+	"XPCS_SR_XS_PCS_EEE_ABL\0"
+	"EEE_2PT5GT\0"
+	"EEE_5GT\0"
+	"EEE_25GT\0"
+	"EEE_2PT5GKX\0"
+	"EEE_5GKR\0"
+	"XPCS_SR_XS_PCS_EEE_ABL2\0"
+	"EEE_WEC\0"
+	"XPCS_SR_XS_PCS_EEE_WKERR\0"
+	"LNS\0"
+	"LBA\0"
+	"TPA\0"
+	"LA\0"
+	"XPCS_SR_XS_PCS_LSTS\0"
+	"TP\0"
+	"TPE\0"
+	"XPCS_SR_XS_PCS_TCTRL\0"
+	"RPCS_BKLK\0"
+	"RPCS_HIBER\0"
+	"PRBS31ABL\0"
+	"PRBS9ABL\0"
+	"RESERVED_11_4\0"
+	"PLU\0"
+	"XPCS_SR_XS_PCS_KR_STS1\0"
+	"ERR_BLK\0"
+	"BER_CNT\0"
+	"LAT_HBER\0"
+	"LAT_BL\0"
+	"XPCS_SR_XS_PCS_KR_STS2\0"
+	"TP_SA0\0"
+	"XPCS_SR_XS_PCS_TP_A0\0"
+	"TP_SA1\0"
+	"XPCS_SR_XS_PCS_TP_A1\0"
+	"TP_SA2\0"
+	"XPCS_SR_XS_PCS_TP_A2\0"
+	"TP_SA3\0"
+	"XPCS_SR_XS_PCS_TP_A3\0"
+	"TP_SB0\0"
+	"XPCS_SR_XS_PCS_TP_B0\0"
+	"TP_SB1\0"
+	"XPCS_SR_XS_PCS_TP_B1\0"
+	"TP_SB2\0"
+	"XPCS_SR_XS_PCS_TP_B2\0"
+	"TP_SB3\0"
+	"XPCS_SR_XS_PCS_TP_B3\0"
+	"DP_SEL\0"
+	"TP_SEL\0"
+	"RTP_EN\0"
+	"TTP_EN\0"
+	"PRBS31T_EN\0"
+	"PRBS31R_EN\0"
+	"PRBS9T_EN\0"
+	"XPCS_SR_XS_PCS_TP_CTRL\0"
+	"TP_ERR_CNT\0"
+	"XPCS_SR_XS_PCS_TP_ERRCTR\0"
+	"PCS_RX_DLY_ABL\0"
+	"PCS_TX_DLY_ABL\0"
+	"XPCS_SR_PCS_TIME_SYNC_PCS_ABL\0"
+	"PCS_TX_MAX_DLY_LWR\0"
+	"XPCS_SR_PCS_TIME_SYNC_TX_MAX_DLY_LWR\0"
+	"PCS_TX_MAX_DLY_UPR\0"
+	"XPCS_SR_PCS_TIME_SYNC_TX_MAX_DLY_UPR\0"
+	"PCS_TX_MIN_DLY_LWR\0"
+	"XPCS_SR_PCS_TIME_SYNC_TX_MIN_DLY_LWR\0"
+	"PCS_TX_MIN_DLY_UPR\0"
+	"XPCS_SR_PCS_TIME_SYNC_TX_MIN_DLY_UPR\0"
+	"PCS_RX_MAX_DLY_LWR\0"
+	"XPCS_SR_PCS_TIME_SYNC_RX_MAX_DLY_LWR\0"
+	"PCS_RX_MAX_DLY_UPR\0"
+	"XPCS_SR_PCS_TIME_SYNC_RX_MAX_DLY_UPR\0"
+	"PCS_RX_MIN_DLY_LWR\0"
+	"XPCS_SR_PCS_TIME_SYNC_RX_MIN_DLY_LWR\0"
+	"PCS_RX_MIN_DLY_UPR\0"
+	"XPCS_SR_PCS_TIME_SYNC_RX_MIN_DLY_UPR\0"
+	"DSKBYP\0"
+	"EN_2_5G_MODE\0"
+	"CR_CJN\0"
+	"USXG_EN\0"
+	"USRA_RST\0"
+	"CL37_BP\0"
+	"EN_VSMMD1\0"
+	"R2TLBE\0"
+	"XPCS_VR_XS_PCS_DIG_CTRL1\0"
+	"RX_POL_INV_0\0"
+	"RX_POL_INV_3_1\0"
+	"TX_POL_INV_0\0"
+	"TX_POL_INV_3_1\0"
+	"PRX_LN_DIS_3_1\0"
+	"PTX_LN_DIS_3_1\0"
+	"XPCS_VR_XS_PCS_DIG_CTRL2\0"
+	"COR\0"
+	"INV_EC_EN\0"
+	"CHKEND_EC_EN\0"
+	"DSKW_EC_EN\0"
+	"TP_MIS_EN\0"
+	"XPCS_VR_XS_PCS_DIG_ERRCNT_SEL\0"
+	"XAUI_MODE\0"
+	"MRVL_RXAUI\0"
+	"XPCS_VR_XS_PCS_XAUI_CTRL\0"
+	"RESTAR_SYNC_0\0"
+	"RESTAR_SYNC_3_1\0"
+	"SUPRESS_LOS_DET\0"
+	"SUPRESS_EEE_LOS_DET\0"
+	"RX_DT_EN_CTL\0"
+	"RX_SYNC_CTL\0"
+	"TX_PMBL_CTL\0"
+	"RX_PMBL_CTL\0"
+	"XPCS_VR_XS_PCS_DEBUG_CTRL\0"
+	"LTX_EN\0"
+	"LRX_EN\0"
+	"TX_QUIET_EN\0"
+	"RX_QUIET_EN\0"
+	"TX_EN_CTRL\0"
+	"EEE_SLR_BYP\0"
+	"SIGN_BIT\0"
+	"RX_EN_CTRL\0"
+	"MULT_FACT_100NS\0"
+	"CLKSTOP\0"
+	"XPCS_VR_XS_PCS_EEE_MCTRL0\0"
+	"VR_TP_EN\0"
+	"PR_DATA\0"
+	"NVAL_SEL\0"
+	"PRBS9RXEN\0"
+	"DIS_SCR\0"
+	"DIS_DESCR\0"
+	"USXG_MODE\0"
+	"USXG_2PT5G_GMII\0"
+	"XPCS_VR_XS_PCS_KR_CTRL\0"
+	"TSL_RES\0"
+	"T1U_RES\0"
+	"TWL_RES\0"
+	"XPCS_VR_XS_PCS_EEE_TXTIMER\0"
+	"RES_100U\0"
+	"TWR_RES\0"
+	"XPCS_VR_XS_PCS_EEE_RXTIMER\0"
+	"AM_COUNT\0"
+	"XPCS_VR_XS_PCS_AM_CTRL\0"
+	"TRN_LPI\0"
+	"XPCS_VR_XS_PCS_EEE_MCTRL1\0"
+	"RXFIFO_UNDF\0"
+	"RXFIFO_OVF\0"
+	"INV_XGM_SOP\0"
+	"INV_XGM_T\0"
+	"INV_XGM_CHAR\0"
+	"LRX_STATE\0"
+	"LTX_STATE\0"
+	"XPCS_VR_XS_PCS_DIG_STS\0"
+	"EC0\0"
+	"EC1\0"
+	"XPCS_VR_XS_PCS_ICG_ERRCNT1\0"
+	"GPIO_IN\0"
+	"GPIO_OUT\0"
+	"XPCS_VR_XS_PCS_GPIO\0"
+	"RESERVED_8_0\0"
+	"RSTRT_AN\0"
+	"AN_EN\0"
+	"EXT_NP_CTL\0"
+	"AN_RST\0"
+	"XPCS_SR_AN_CTRL\0"
+	"LP_AN_ABL\0"
+	"AN_LS\0"
+	"AN_ABL\0"
+	"AN_RF\0"
+	"EXT_NP_STS\0"
+	"XPCS_SR_AN_STS\0"
+	"AN_DEV_OUI_3_18\0"
+	"XPCS_SR_AN_DEV_ID1\0"
+	"AN_DEV_RN_3_0\0"
+	"AN_DEV_MMN_5_0\0"
+	"AN_DEV_OUI_19_24\0"
+	"XPCS_SR_AN_DEV_ID2\0"
+	"XPCS_SR_AN_DEV_PKG1\0"
+	"XPCS_SR_AN_DEV_PKG2\0"
+	"AN_PKG_OUI_3_18\0"
+	"XPCS_SR_AN_PKG1\0"
+	"AN_PKG_RN_3_0\0"
+	"AN_PKG_MMN_5_0\0"
+	"AN_PKG_OUI_19_24\0"
+	"XPCS_SR_AN_PKG2\0"
+	"AN_ADV_SF\0"
+	"AN_ADV_RF_13\0"
+	"AN_ADV_ACK\0"
+	"AN_ADV_NP\0"
+	"XPCS_SR_AN_ADV1\0"
+	"DATA_31_16\0"
+	"XPCS_SR_AN_ADV2\0"
+	"DATA_47_32\0"
+	"XPCS_SR_AN_ADV3\0"
+	"AN_LP_ADV_SF\0"
+	"AN_LP_ADV_RF\0"
+	"AN_LP_ADV_ACK\0"
+	"AN_LP_ADV_NP\0"
+	"XPCS_SR_AN_LP_ABL1\0"
+	"XPCS_SR_AN_LP_ABL2\0"
+	"XPCS_SR_AN_LP_ABL3\0"
+	"TB\0"
+	"AN_XNP_ACK2\0"
+	"AN_XNP_MP\0"
+	"AN_XNP_NP\0"
+	"XPCS_SR_AN_XNP_TX1\0"
+	"UMCF1\0"
+	"XPCS_SR_AN_XNP_TX2\0"
+	"UMCF2\0"
+	"XPCS_SR_AN_XNP_TX3\0"
+	"AN_LP_XNP_ACK2\0"
+	"AN_LP_XNP_MP\0"
+	"AN_LP_XNP_ACK\0"
+	"AN_LP_XNP_NP\0"
+	"XPCS_SR_AN_LP_XNP_ABL1\0"
+	"XPCS_SR_AN_LP_XNP_ABL2\0"
+	"XPCS_SR_AN_LP_XNP_ABL3\0"
+	"BP_AN_ABL\0"
+	"AN_COMP_KX\0"
+	"AN_COMP_KX4\0"
+	"AN_COMP_KR\0"
+	"AN_COMP_FEC\0"
+	"RESERVED_13_5\0"
+	"AN_COMP_2PT5G\0"
+	"AN_COMP_5G\0"
+	"XPCS_SR_AN_COMP_STS\0"
+	"XPCS_SR_AN_EEE_ABL1\0"
+	"LP_100TEE\0"
+	"LP_1GTEEE\0"
+	"LP_TEEE\0"
+	"LP_KXEEE\0"
+	"LP_KX4EEE\0"
+	"LP_KREEE\0"
+	"XPCS_SR_AN_EEE_LP_ABL1\0"
+	"XPCS_SR_AN_EEE_ABL2\0"
+	"LP_2PT5GKXEEE\0"
+	"LP_5GKREEE\0"
+	"XPCS_SR_AN_EEE_LP_ABL2\0"
+	"BYP_NONCE_MAT\0"
+	"CL73_TMR_OVR_RIDE\0"
+	"RESERVED_10_4\0"
+	"XPCS_VR_AN_DIG_CTRL1\0"
+	"AN_INT_CMPLT_IE\0"
+	"AN_INC_LINK_IE\0"
+	"AN_PG_RCV_IE\0"
+	"XPCS_VR_AN_INTR_MSK\0"
+	"AN_INT_CMPLT\0"
+	"AN_INC_LINK\0"
+	"AN_PG_RCV\0"
+	"XPCS_VR_AN_INTR\0"
+	"PDET_EN\0"
+	"XPCS_VR_AN_KR_MODE_CTRL\0"
+	"BRK_LINK_TIME\0"
+	"XPCS_VR_AN_TIMER_CTRL0\0"
+	"INHBT_OR_WAIT_TIME\0"
+	"XPCS_VR_AN_TIMER_CTRL1\0"
+	"RESERVED_4_0\0"
+	"SS5\0"
+	"DUPLEX_MODE\0"
+	"RESTART_AN\0"
+	"AN_ENABLE\0"
+	"XPCS_SR_MII_1_CTRL\0"
+	"EXT_REG_CAP\0"
+	"LINK_STS\0"
+	"AN_CMPL\0"
+	"MF_PRE_SUP\0"
+	"UN_DIR_ABL\0"
+	"EXT_STS_ABL\0"
+	"HD100T\0"
+	"FD100T\0"
+	"HD10ABL\0"
+	"FD10ABL\0"
+	"HD100ABL\0"
+	"FD100ABL\0"
+	"ABL100T4\0"
+	"XPCS_SR_MII_1_STS\0"
+	"VS_MII_DEV_OUI_3_18\0"
+	"XPCS_SR_MII_1_DEV_ID1\0"
+	"VS_MMD_DEV_RN_3_0\0"
+	"VS_MMD_DEV_MMN_5_0\0"
+	"VS_MMD_DEV_OUI_19_24\0"
+	"XPCS_SR_MII_1_DEV_ID2\0"
+	"FD\0"
+	"HD\0"
+	"PAUSE\0"
+	"RESERVED_11_9\0"
+	"XPCS_SR_MII_1_AN_ADV\0"
+	"LP_FD\0"
+	"LP_HD\0"
+	"LP_PAUSE\0"
+	"LP_RF\0"
+	"LP_ACK\0"
+	"LP_NP\0"
+	"XPCS_SR_MII_1_LP_BABL\0"
+	"PG_RCVD\0"
+	"LD_NP_ABL\0"
+	"XPCS_SR_MII_1_AN_EXPN\0"
+	"RESERVED_11_0\0"
+	"CAP_1G_T_HD\0"
+	"CAP_1G_T_FD\0"
+	"CAP_1G_X_HD\0"
+	"CAP_1G_X_FD\0"
+	"XPCS_SR_MII_1_EXT_STS\0"
+	"PHY_MODE_CTRL\0"
+	"CL37_TMR_OVR_RIDE\0"
+	"PRE_EMP\0"
+	"MSK_RD_ERR\0"
+	"MAC_AUTO_SW\0"
+	"XPCS_VR_MII_1_DIG_CTRL1\0"
+	"MII_AN_INTR_EN\0"
+	"PCS_MODE\0"
+	"TX_CONFIG\0"
+	"SGMII_LINK_STS\0"
+	"RESERVED_7_5\0"
+	"MII_CTRL\0"
+	"XPCS_VR_MII_1_AN_CTRL\0"
+	"CL37_ANCMPLT_INTR\0"
+	"CL37_ANSGM_STS\0"
+	"LP_EEE_CAP\0"
+	"LP_CK_STP\0"
+	"USXG_AN_STS\0"
+	"XPCS_VR_MII_1_AN_INTR_STS\0"
+	"RESTAR_SYNC\0"
+	"XPCS_VR_MII_1_DBG_CTRL\0"
+	"CL37_LINK_TIME\0"
+	"XPCS_VR_MII_1_LINK_TIMER_CTRL\0"
+	"XPCS_VR_MII_1_DIG_STS\0"
+	"XPCS_VR_MII_1_ICG_ERRCNT1\0"
+	"XPCS_VR_MII_1_DIG_ERRCNT_SEL\0"
+	"XPCS_SR_MII_2_CTRL\0"
+	"XPCS_SR_MII_2_STS\0"
+	"XPCS_SR_MII_2_DEV_ID1\0"
+	"XPCS_SR_MII_2_DEV_ID2\0"
+	"XPCS_SR_MII_2_AN_ADV\0"
+	"XPCS_SR_MII_2_LP_BABL\0"
+	"XPCS_SR_MII_2_AN_EXPN\0"
+	"XPCS_SR_MII_2_EXT_STS\0"
+	"XPCS_VR_MII_2_DIG_CTRL1\0"
+	"XPCS_VR_MII_2_AN_CTRL\0"
+	"XPCS_VR_MII_2_AN_INTR_STS\0"
+	"XPCS_VR_MII_2_DBG_CTRL\0"
+	"XPCS_VR_MII_2_LINK_TIMER_CTRL\0"
+	"XPCS_VR_MII_2_DIG_STS\0"
+	"XPCS_VR_MII_2_ICG_ERRCNT1\0"
+	"XPCS_VR_MII_2_DIG_ERRCNT_SEL\0"
+	"XPCS_SR_MII_3_CTRL\0"
+	"XPCS_SR_MII_3_STS\0"
+	"XPCS_SR_MII_3_DEV_ID1\0"
+	"XPCS_SR_MII_3_DEV_ID2\0"
+	"XPCS_SR_MII_3_AN_ADV\0"
+	"XPCS_SR_MII_3_LP_BABL\0"
+	"XPCS_SR_MII_3_AN_EXPN\0"
+	"XPCS_SR_MII_3_EXT_STS\0"
+	"XPCS_VR_MII_3_DIG_CTRL1\0"
+	"XPCS_VR_MII_3_AN_CTRL\0"
+	"XPCS_VR_MII_3_AN_INTR_STS\0"
+	"XPCS_VR_MII_3_DBG_CTRL\0"
+	"XPCS_VR_MII_3_LINK_TIMER_CTRL\0"
+	"XPCS_VR_MII_3_DIG_STS\0"
+	"XPCS_VR_MII_3_ICG_ERRCNT1\0"
+	"XPCS_VR_MII_3_DIG_ERRCNT_SEL\0"
+	"PMADOUI_3_18\0"
+	"XPCS_SR_VSMMD_PMA_ID1\0"
+	"PMADRN_3_0\0"
+	"PMADMMN_5_0\0"
+	"PMADOUI_19_24\0"
+	"XPCS_SR_VSMMD_PMA_ID2\0"
+	"VSDOUI_3_18\0"
+	"XPCS_SR_VSMMD_DEV_ID1\0"
+	"VSDRN_3_0\0"
+	"VSDMMN_5_0\0"
+	"VSDOUI_19_24\0"
+	"XPCS_SR_VSMMD_DEV_ID2\0"
+	"PCSDOUI_3_18\0"
+	"XPCS_SR_VSMMD_PCS_ID1\0"
+	"PCSDRN_3_0\0"
+	"PCSDMMN_5_0\0"
+	"PCSDOUI_19_24\0"
+	"XPCS_SR_VSMMD_PCS_ID2\0"
+	"ANDOUI_3_18\0"
+	"XPCS_SR_VSMMD_AN_ID1\0"
+	"ANDRN_3_0\0"
+	"ANDMMN_5_0\0"
+	"ANDOUI_19_24\0"
+	"XPCS_SR_VSMMD_AN_ID2\0"
+	"VSDP\0"
+	"XPCS_SR_VSMMD_STS\0"
+	"AN_MMD_EN\0"
+	"PCS_XS_MMD_EN\0"
+	"MII_MMD_EN\0"
+	"PMA_MMD_EN\0"
+	"FASTSIM\0"
+	"PD_CTRL\0"
+	"XPCS_SR_VSMMD_CTRL\0"
+	"MMDPOUI_3_18\0"
+	"XPCS_SR_VSMMD_PKGID1\0"
+	"MMDPRN_3_0\0"
+	"MMDPMMN_5_0\0"
+	"MMDPOUI_19_24\0"
+	"XPCS_SR_VSMMD_PKGID2\0"
+	"XPCS_SR_MII_CTRL\0"
+	"XPCS_SR_MII_STS\0"
+	"XPCS_SR_MII_DEV_ID1\0"
+	"XPCS_SR_MII_DEV_ID2\0"
+	"XPCS_SR_MII_AN_ADV\0"
+	"XPCS_SR_MII_LP_BABL\0"
+	"XPCS_SR_MII_AN_EXPN\0"
+	"XPCS_SR_MII_EXT_STS\0"
+	"XPCS_VR_MII_DIG_CTRL1\0"
+	"XPCS_VR_MII_AN_CTRL\0"
+	"XPCS_VR_MII_AN_INTR_STS\0"
+	"XPCS_VR_MII_LINK_TIMER_CTRL\0"
+	"DDIC\0"
+	"ISM\0"
+	"ISR\0"
+	"IFP\0"
+	"RESERVED_TC\0"
+	"RESERVED_LUD\0"
+	"XGMAC_MAC_TX_CONFIGURATION_L\0"
+	"PCHM\0"
+	"PEN\0"
+	"RESERVED_VNE\0"
+	"RESERVED_VNM\0"
+	"RESERVED_GT9WH\0"
+	"RESERVED_G9991EN\0"
+	"SS\0"
+	"XGMAC_MAC_TX_CONFIGURATION_H\0"
+	"PRXM\0"
+	"XGMAC_MAC_RX_CONFIGURATION_L\0"
+	"RESERVED_ELEN\0"
+	"XGMAC_MAC_RX_CONFIGURATION_H\0"
+	"RESERVED_SAIF\0"
+	"RESERVED_SAF\0"
+	"XGMAC_MAC_PACKET_FILTER_L\0"
+	"RESERVED_VUCC\0"
+	"RESERVED_30_23\0"
+	"XGMAC_MAC_PACKET_FILTER_H\0"
+	"XGMAC_MAC_WATCHDOG_TIMEOUT_L\0"
+	"XGMAC_MAC_WATCHDOG_TIMEOUT_H\0"
+	"VID\0"
+	"XGMAC_MAC_VLAN_TAG_L\0"
+	"RESERVED_EDVLP\0"
+	"RESERVED_ERIVLT\0"
+	"RESERVED_EIVLS\0"
+	"RESERVED_EIVLRXS\0"
+	"XGMAC_MAC_VLAN_TAG_H\0"
+	"ET\0"
+	"XGMAC_MAC_RX_ETH_TYPE_MATCH_L\0"
+	"XGMAC_MAC_RX_ETH_TYPE_MATCH_H\0"
+	"FCB\0"
+	"XGMAC_MAC_Q0_TX_FLOW_CTRL_L\0"
+	"XGMAC_MAC_Q0_TX_FLOW_CTRL_H\0"
+	"XGMAC_MAC_RX_FLOW_CTRL_L\0"
+	"XGMAC_MAC_RX_FLOW_CTRL_H\0"
+	"SMI\0"
+	"RESERVED_8_6\0"
+	"TXESIS\0"
+	"RXESIS\0"
+	"GPIIS\0"
+	"XGMAC_MAC_INTERRUPT_STATUS_L\0"
+	"RESERVED_23_16\0"
+	"XGMAC_MAC_INTERRUPT_STATUS_H\0"
+	"TXESIE\0"
+	"RXESIE\0"
+	"RESERVED_31_15\0"
+	"XGMAC_MAC_INTERRUPT_ENABLE_L\0"
+	"XGMAC_MAC_INTERRUPT_ENABLE_H\0"
+	"XGMAC_MAC_RX_TX_STATUS_L\0"
+	"XGMAC_MAC_RX_TX_STATUS_H\0"
+	"RXRSTP\0"
+	"TXRSTP\0"
+	"XGMAC_MAC_LPI_CONTROL_STATUS_L\0"
+	"LPITXEN\0"
+	"PLSDIS\0"
+	"XGMAC_MAC_LPI_CONTROL_STATUS_H\0"
+	"XGMAC_MAC_LPI_TIMERS_CONTROL_L\0"
+	"XGMAC_MAC_LPI_TIMERS_CONTROL_H\0"
+	"XGMAC_MAC_LPI_AUTO_ENTRY_TIMER_L\0"
+	"XGMAC_MAC_LPI_AUTO_ENTRY_TIMER_H\0"
+	"XGMAC_MAC_1US_TIC_COUNTER_L\0"
+	"XGMAC_MAC_1US_TIC_COUNTER_H\0"
+	"DEVID\0"
+	"XGMAC_MAC_VERSION_L\0"
+	"XGMAC_MAC_VERSION_H\0"
+	"XGMAC_MAC_DEBUG_L\0"
+	"XGMAC_MAC_DEBUG_H\0"
+	"RGMIISEL\0"
+	"XGMAC_MAC_HW_FEATURE0_L\0"
+	"RESERVED_PHYSEL\0"
+	"VXN\0"
+	"EDIFFC\0"
+	"EDMA\0"
+	"XGMAC_MAC_HW_FEATURE0_H\0"
+	"PFCEN\0"
+	"XGMAC_MAC_HW_FEATURE1_L\0"
+	"RSSEN\0"
+	"NUMTC\0"
+	"XGMAC_MAC_HW_FEATURE1_H\0"
+	"XGMAC_MAC_HW_FEATURE2_L\0"
+	"XGMAC_MAC_HW_FEATURE2_H\0"
+	"XGMAC_MAC_HW_FEATURE3_L\0"
+	"TTSFD\0"
+	"XGMAC_MAC_HW_FEATURE3_H\0"
+	"XGMAC_MAC_EXTENDED_CONFIGURATION_L\0"
+	"RESERVED_SBDIOEN\0"
+	"RESERVED_31_17\0"
+	"XGMAC_MAC_EXTENDED_CONFIGURATION_H\0"
+	"XGMAC_MAC_ADDRESS0_HIGH_L\0"
+	"XGMAC_MAC_ADDRESS0_HIGH_H\0"
+	"XGMAC_MAC_ADDRESS0_LOW_L\0"
+	"XGMAC_MAC_ADDRESS0_LOW_H\0"
+	"MCT\0"
+	"XGMAC_MMC_CONTROL_L\0"
+	"RESERVED_PRMMCSEL\0"
+	"XGMAC_MMC_CONTROL_H\0"
+	"RXGBOCTIS\0"
+	"RXGOCTIS\0"
+	"RXBCGPIS\0"
+	"RXMCGPIS\0"
+	"RXRUNTPIS\0"
+	"RXJABERPIS\0"
+	"RX64OCTGBPIS\0"
+	"RX65T127OCTGBPIS\0"
+	"RX128T255OCTGBPIS\0"
+	"RX256T511OCTGBPIS\0"
+	"RX512T1023OCTGBPIS\0"
+	"RX1024TMAXOCTGBPIS\0"
+	"XGMAC_MMC_RX_INTERRUPT_L\0"
+	"RXUCGPIS\0"
+	"RXLENERPIS\0"
+	"RXORANGEPIS\0"
+	"RXPAUSPIS\0"
+	"RXFOVPIS\0"
+	"RXVLANGBPIS\0"
+	"RXWDOGPIS\0"
+	"RXDISPCGBIS\0"
+	"RXDISOCGBIS\0"
+	"RXALEPIS\0"
+	"RESERVED_30_28\0"
+	"RXPRMMCIS\0"
+	"XGMAC_MMC_RX_INTERRUPT_H\0"
+	"TXGBOCTIS\0"
+	"TXBCGPIS\0"
+	"TXMCGPIS\0"
+	"TX64OCTGBPIS\0"
+	"TX65T127OCTGBPIS\0"
+	"TX128T255OCTGBPIS\0"
+	"TX256T511OCTGBPIS\0"
+	"TX512T1023OCTGBPIS\0"
+	"TX1024TMAXOCTGBPIS\0"
+	"TXUCGBPIS\0"
+	"TXMCGBPIS\0"
+	"TXBCGBPIS\0"
+	"TXGOCTIS\0"
+	"XGMAC_MMC_TX_INTERRUPT_L\0"
+	"TXPAUSPIS\0"
+	"TXVLANGPIS\0"
+	"RESERVED_30_20\0"
+	"TXPRMMCIS\0"
+	"XGMAC_MMC_TX_INTERRUPT_H\0"
+	"RXGBPKTIE\0"
+	"RXGBOCTIE\0"
+	"RXGOCTIE\0"
+	"RESERVED_RXBCGPIE\0"
+	"RESERVED_RXMCGPIE\0"
+	"RXCRCERPIE\0"
+	"RESERVED_RXRUNTPIE\0"
+	"RESERVED_RXJABERPIE\0"
+	"RESERVED_RXUSIZEGPIE\0"
+	"RESERVED_RXOSIZEGPIE\0"
+	"RESERVED_RX64OCTGBPIE\0"
+	"RESERVED_RX65T127OCTGBPIE\0"
+	"RESERVED_RX128T255OCTGBPIE\0"
+	"RESERVED_RX256T511OCTGBPIE\0"
+	"RESERVED_RX512T1023OCTGBPIE\0"
+	"RESERVED_RX1024TMAXOCTGBPIE\0"
+	"XGMAC_MMC_RECEIVE_INTERRUPT_ENABLE_L\0"
+	"RESERVED_RXUCGPIE\0"
+	"RESERVED_RXLENERPIE\0"
+	"RESERVED_RXORANGEPIE\0"
+	"RESERVED_RXPAUSPIE\0"
+	"RESERVED_RXFOVPIE\0"
+	"RESERVED_RXVLANGBPIE\0"
+	"RESERVED_RXWDOGPIE\0"
+	"RESERVED_RXDISPCGBIE\0"
+	"RESERVED_RXDISOCGBIE\0"
+	"RESERVED_RXLPIUSCIE\0"
+	"RESERVED_RXLPITRCIE\0"
+	"RESERVED_RXALEPIE\0"
+	"RESERVED_RXPRMMCIE\0"
+	"XGMAC_MMC_RECEIVE_INTERRUPT_ENABLE_H\0"
+	"TXGBOCTIE\0"
+	"TXGBPKTIE\0"
+	"RESERVED_TXBCGPIE\0"
+	"RESERVED_TXMCGPIE\0"
+	"RESERVED_TX64OCTGBPIE\0"
+	"RESERVED_TX65T127OCTGBPIE\0"
+	"RESERVED_TX128T255OCTGBPIE\0"
+	"RESERVED_TX256T511OCTGBPIE\0"
+	"RESERVED_TX512T1023OCTGBPIE\0"
+	"RESERVED_TX1024TMAXOCTGBPIE\0"
+	"RESERVED_TXUCGBPIE\0"
+	"RESERVED_TXMCGBPIE\0"
+	"RESERVED_TXBCGBPIE\0"
+	"RESERVED_TXUFLOWERPIE\0"
+	"TXGOCTIE\0"
+	"TXGPKTIE\0"
+	"XGMAC_MMC_TRANSMIT_INTERRUPT_ENABLE_L\0"
+	"TXPAUSPIE\0"
+	"RESERVED_TXVLANGPIE\0"
+	"RESERVED_TXLPIUSCIE\0"
+	"RESERVED_TXLPITRCIE\0"
+	"RESERVED_TXPRMMCIE\0"
+	"XGMAC_MMC_TRANSMIT_INTERRUPT_ENABLE_H\0"
+	"TXOCTGBLO\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_BAD_LOW_L\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_BAD_LOW_H\0"
+	"TXOCTGBHI\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_BAD_HIGH_L\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_BAD_HIGH_H\0"
+	"TXPKTGBLO\0"
+	"XGMAC_TX_PACKET_COUNT_GOOD_BAD_LOW_L\0"
+	"XGMAC_TX_PACKET_COUNT_GOOD_BAD_LOW_H\0"
+	"TXOCTGLO\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_LOW_L\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_LOW_H\0"
+	"TXOCTGHI\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_HIGH_L\0"
+	"XGMAC_TX_OCTET_COUNT_GOOD_HIGH_H\0"
+	"TXPKTGLO\0"
+	"XGMAC_TX_PACKET_COUNT_GOOD_LOW_L\0"
+	"XGMAC_TX_PACKET_COUNT_GOOD_LOW_H\0"
+	"TXPAUSEGLO\0"
+	"XGMAC_TX_PAUSE_PACKETS_LOW_L\0"
+	"XGMAC_TX_PAUSE_PACKETS_LOW_H\0"
+	"RXPKTGBLO\0"
+	"XGMAC_RX_PACKET_COUNT_GOOD_BAD_LOW_L\0"
+	"XGMAC_RX_PACKET_COUNT_GOOD_BAD_LOW_H\0"
+	"RXOCTGBLO\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_BAD_LOW_L\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_BAD_LOW_H\0"
+	"RXOCTGBHI\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_BAD_HIGH_L\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_BAD_HIGH_H\0"
+	"RXOCTGLO\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_LOW_L\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_LOW_H\0"
+	"RXOCTGHI\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_HIGH_L\0"
+	"XGMAC_RX_OCTET_COUNT_GOOD_HIGH_H\0"
+	"RXCRCERLO\0"
+	"XGMAC_RX_CRC_ERROR_PACKETS_LOW_L\0"
+	"XGMAC_RX_CRC_ERROR_PACKETS_LOW_H\0"
+	"XGMAC_MAC_TIMESTAMP_CONTROL_L\0"
+	"XGMAC_MAC_TIMESTAMP_CONTROL_H\0"
+	"XGMAC_MAC_SUB_SECOND_INCREMENT_L\0"
+	"XGMAC_MAC_SUB_SECOND_INCREMENT_H\0"
+	"XGMAC_MAC_SYSTEM_TIME_SECONDS_L\0"
+	"XGMAC_MAC_SYSTEM_TIME_SECONDS_H\0"
+	"XGMAC_MAC_SYSTEM_TIME_NANOSECONDS_L\0"
+	"XGMAC_MAC_SYSTEM_TIME_NANOSECONDS_H\0"
+	"XGMAC_MAC_SYSTEM_TIME_SECONDS_UPDATE_L\0"
+	"XGMAC_MAC_SYSTEM_TIME_SECONDS_UPDATE_H\0"
+	"XGMAC_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE_L\0"
+	"XGMAC_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE_H\0"
+	"XGMAC_MAC_TIMESTAMP_ADDEND_L\0"
+	"XGMAC_MAC_TIMESTAMP_ADDEND_H\0"
+	"TTSNS\0"
+	"TXTSC\0"
+	"XGMAC_MAC_TIMESTAMP_STATUS_L\0"
+	"XGMAC_MAC_TIMESTAMP_STATUS_H\0"
+	"RPCMC\0"
+	"XGMAC_MAC_RX_PCH_CRC_MISMATCH_COUNTER_L\0"
+	"XGMAC_MAC_RX_PCH_CRC_MISMATCH_COUNTER_H\0"
+	"XGMAC_MAC_TX_TIMESTAMP_STATUS_NANOSECONDS_L\0"
+	"XGMAC_MAC_TX_TIMESTAMP_STATUS_NANOSECONDS_H\0"
+	"TXTSSTSHI\0"
+	"XGMAC_MAC_TX_TIMESTAMP_STATUS_SECONDS_L\0"
+	"XGMAC_MAC_TX_TIMESTAMP_STATUS_SECONDS_H\0"
+	"PKTID\0"
+	"RESERVED_31_10\0"
+	"XGMAC_MAC_TX_TIMESTAMP_STATUS_PKTID_L\0"
+	"XGMAC_MAC_TX_TIMESTAMP_STATUS_PKTID_H\0"
+	"XGMAC_MAC_TIMESTAMP_INGRESS_ASYM_CORR_L\0"
+	"XGMAC_MAC_TIMESTAMP_INGRESS_ASYM_CORR_H\0"
+	"XGMAC_MAC_TIMESTAMP_EGRESS_ASYM_CORR_L\0"
+	"XGMAC_MAC_TIMESTAMP_EGRESS_ASYM_CORR_H\0"
+	"XGMAC_MAC_TIMESTAMP_INGRESS_CORR_NANOSECOND_L\0"
+	"XGMAC_MAC_TIMESTAMP_INGRESS_CORR_NANOSECOND_H\0"
+	"XGMAC_MAC_TIMESTAMP_EGRESS_CORR_NANOSECOND_L\0"
+	"XGMAC_MAC_TIMESTAMP_EGRESS_CORR_NANOSECOND_H\0"
+	"PPSCTRL0_PPSCMD0\0"
+	"XGMAC_MAC_PPS_CONTROL_L\0"
+	"XGMAC_MAC_PPS_CONTROL_H\0"
+	"XGMAC_MAC_PPS0_TARGET_TIME_SECONDS_L\0"
+	"XGMAC_MAC_PPS0_TARGET_TIME_SECONDS_H\0"
+	"XGMAC_MAC_PPS0_TARGET_TIME_NANOSECONDS_L\0"
+	"XGMAC_MAC_PPS0_TARGET_TIME_NANOSECONDS_H\0"
+	"SLICE_CGU_PDI_CFG\0"
+	"SLICE_CGU_PDI_SYNCE_CONF\0"
+	"SLICE_CGU_PDI_NCO1_LSB_2500\0"
+	"SLICE_CGU_PDI_NCO1_MSB_2500\0"
+	"SLICE_CGU_PDI_NCO1_LSB_1000\0"
+	"SLICE_CGU_PDI_NCO1_MSB_1000\0"
+	"SLICE_CGU_PDI_NCO2_LSB_2500\0"
+	"SLICE_CGU_PDI_NCO2_MSB_2500\0"
+	"SLICE_CGU_PDI_NCO2_LSB_1000\0"
+	"SLICE_CGU_PDI_NCO2_MSB_1000\0"
+	"SLICE_CGU_PDI_NCO_CTRL\0"
+	"SLICE_CGU_PDI_NCO3_CFG\0"
+	"SPI_SECURE_EN\0"
+	"DATA_IF_MODE\0"
+	"TOP_CHIP_CFG\0"
+	"MDINT_SLICE0\0"
+	"MDINT_SLICE1\0"
+	"MDINT_SLICE2\0"
+	"MDINT_SLICE3\0"
+	"LP_SLICE0\0"
+	"LP_SLICE1\0"
+	"LP_SLICE2\0"
+	"LP_SLICE3\0"
+	"TOP_STATUS\0"
+	"IF_SLICE\0"
+	"LP_WAKE0\0"
+	"LP_WAKE1\0"
+	"LP_WAKE2\0"
+	"LP_WAKE3\0"
+	"TOP_SLICE_IF\0"
+	"FCR\0"
+	"BOOTSEL\0"
+	"TOP_FCR\0"
+	"NOWAIT\0"
+	"TOP_CFG\0"
+	"TOP_INDICATOR\0"
+	"MASTER_SLICE\0"
+	"TOP_SLICE_MASTER\0"
+	"CGU_PDI_GPC0_OUT_CONF\0"
+	"CGU_PDI_GPC1_OUT_CONF\0"
+	"CGU_PDI_GPC2_OUT_CONF\0"
+	"PLLEN\0"
+	"LOCK\0"
+	"FRACL\0"
+	"LJPLL_CFG0L\0"
+	"FRACH\0"
+	"DSMEN\0"
+	"DACEN\0"
+	"UNLOCKED_EVENT\0"
+	"LJPLL_CFG0H\0"
+	"POST_DIV0A\0"
+	"POST_DIV0B\0"
+	"POST_DIV1A\0"
+	"POST_DIV1B\0"
+	"POST_DIV2A\0"
+	"LJPLL_CFG1L\0"
+	"POST_DIV2BH\0"
+	"FOUT0EN\0"
+	"FOUT1EN\0"
+	"FOUT2EN\0"
+	"FOUT3EN\0"
+	"POST_DIV3A\0"
+	"POST_DIV3B\0"
+	"POST_DIV0PRE\0"
+	"LJPLL_CFG1H\0"
+	"FBDIV\0"
+	"LJPLL_CFG2L\0"
+	"REFDIV\0"
+	"BYPASS0\0"
+	"BYPASS1\0"
+	"BYPASS2\0"
+	"BYPASS3\0"
+	"FREFCMLEN\0"
+	"LJPLL_CFG2H\0"
+	"DSKCAIN\0"
+	"DSKCALOUTL\0"
+	"LJPLL_CFG3L\0"
+	"DSKCALOUTH\0"
+	"DSKEWEN\0"
+	"DSKEWCALBP\0"
+	"FASTDSKEWCALEN\0"
+	"DSKEWCALCNT\0"
+	"LJPLL_CFG3H\0"
+	"SPREAD\0"
+	"DIVVAL\0"
+	"DOWNSPREAD\0"
+	"EXT_MAXADDRL\0"
+	"LJPLL_SSC_CTRLL\0"
+	"EXT_MAXADDRH\0"
+	"EXT_WAVEVAL\0"
+	"SEL_EXTWAVE\0"
+	"LJPLL_SSC_CTRLH\0"
+	"CGU_PDI_CLK_OBSERVATION\0"
+	"USXGMII_CLK_EN\0"
+	"CGU_PDI_CLK_EN\0"
+	"BYTE0\0"
+	"BYTE1\0"
+	"USXGMII_PDI_INDIRECT_0\0"
+	"USXGMII_PDI_INDIRECT_1\0"
+	"USXGMII_PDI_INDIRECT_2\0"
+	"USXGMII_PDI_INDIRECT_3\0"
+	"USXGMII_PDI_INDIRECT_4\0"
+	"USXGMII_PDI_INDIRECT_5\0"
+	"USXGMII_PDI_INDIRECT_6\0"
+	"USXGMII_PDI_INDIRECT_7\0"
+	"USXGMII_PDI_INDIRECT_8\0"
+	"USXGMII_PDI_INDIRECT_9\0"
+	"USXGMII_PDI_INDIRECT_10\0"
+	"USXGMII_PDI_INDIRECT_11\0"
+	"USXGMII_PDI_INDIRECT_12\0"
+	"USXGMII_PDI_INDIRECT_13\0"
+	"USXGMII_PDI_INDIRECT_14\0"
+	"USXGMII_PDI_INDIRECT_15\0"
+	"USXGMII_PDI_INDIRECT_16\0"
+	"USXGMII_PDI_INDIRECT_17\0"
+	"USXGMII_PDI_INDIRECT_18\0"
+	"USXGMII_PDI_INDIRECT_19\0"
+	"USXGMII_PDI_INDIRECT_20\0"
+	"USXGMII_PDI_INDIRECT_21\0"
+	"USXGMII_PDI_INDIRECT_22\0"
+	"USXGMII_PDI_INDIRECT_23\0"
+	"USXGMII_PDI_INDIRECT_24\0"
+	"USXGMII_PDI_INDIRECT_25\0"
+	"USXGMII_PDI_INDIRECT_26\0"
+	"USXGMII_PDI_INDIRECT_27\0"
+	"USXGMII_PDI_INDIRECT_28\0"
+	"USXGMII_PDI_INDIRECT_29\0"
+	"USXGMII_PDI_INDIRECT_30\0"
+	"USXGMII_PDI_INDIRECT_31\0"
+	"USXGMII_PDI_INDIRECT_32\0"
+	"USXGMII_PDI_INDIRECT_33\0"
+	"USXGMII_PDI_INDIRECT_34\0"
+	"USXGMII_PDI_INDIRECT_35\0"
+	"USXGMII_PDI_INDIRECT_36\0"
+	"USXGMII_PDI_INDIRECT_37\0"
+	"USXGMII_PDI_INDIRECT_38\0"
+	"USXGMII_PDI_INDIRECT_39\0"
+	"USXGMII_PDI_INDIRECT_40\0"
+	"USXGMII_PDI_INDIRECT_41\0"
+	"USXGMII_PDI_INDIRECT_42\0"
+	"USXGMII_PDI_INDIRECT_43\0"
+	"USXGMII_PDI_INDIRECT_44\0"
+	"USXGMII_PDI_INDIRECT_45\0"
+	"USXGMII_PDI_INDIRECT_46\0"
+	"USXGMII_PDI_INDIRECT_47\0"
+	"USXGMII_PDI_INDIRECT_48\0"
+	"USXGMII_PDI_INDIRECT_49\0"
+	"USXGMII_PDI_INDIRECT_50\0"
+	"USXGMII_PDI_INDIRECT_51\0"
+	"USXGMII_PDI_INDIRECT_52\0"
+	"USXGMII_PDI_INDIRECT_53\0"
+	"USXGMII_PDI_INDIRECT_54\0"
+	"USXGMII_PDI_INDIRECT_55\0"
+	"USXGMII_PDI_INDIRECT_56\0"
+	"USXGMII_PDI_INDIRECT_57\0"
+	"USXGMII_PDI_INDIRECT_58\0"
+	"USXGMII_PDI_INDIRECT_59\0"
+	"USXGMII_PDI_INDIRECT_60\0"
+	"USXGMII_PDI_INDIRECT_61\0"
+	"USXGMII_PDI_INDIRECT_62\0"
+	"USXGMII_PDI_INDIRECT_63\0"
+	"USXGMII_PDI_INDIRECT_64\0"
+	"USXGMII_PDI_INDIRECT_65\0"
+	"USXGMII_PDI_INDIRECT_66\0"
+	"USXGMII_PDI_INDIRECT_67\0"
+	"USXGMII_PDI_INDIRECT_68\0"
+	"USXGMII_PDI_INDIRECT_69\0"
+	"USXGMII_PDI_INDIRECT_70\0"
+	"USXGMII_PDI_INDIRECT_71\0"
+	"USXGMII_PDI_INDIRECT_72\0"
+	"USXGMII_PDI_INDIRECT_73\0"
+	"USXGMII_PDI_INDIRECT_74\0"
+	"USXGMII_PDI_INDIRECT_75\0"
+	"USXGMII_PDI_INDIRECT_76\0"
+	"USXGMII_PDI_INDIRECT_77\0"
+	"USXGMII_PDI_INDIRECT_78\0"
+	"USXGMII_PDI_INDIRECT_79\0"
+	"USXGMII_PDI_INDIRECT_80\0"
+	"USXGMII_PDI_INDIRECT_81\0"
+	"USXGMII_PDI_INDIRECT_82\0"
+	"USXGMII_PDI_INDIRECT_83\0"
+	"USXGMII_PDI_INDIRECT_84\0"
+	"USXGMII_PDI_INDIRECT_85\0"
+	"USXGMII_PDI_INDIRECT_86\0"
+	"USXGMII_PDI_INDIRECT_87\0"
+	"USXGMII_PDI_INDIRECT_88\0"
+	"USXGMII_PDI_INDIRECT_89\0"
+	"USXGMII_PDI_INDIRECT_90\0"
+	"USXGMII_PDI_INDIRECT_91\0"
+	"USXGMII_PDI_INDIRECT_92\0"
+	"USXGMII_PDI_INDIRECT_93\0"
+	"USXGMII_PDI_INDIRECT_94\0"
+	"USXGMII_PDI_INDIRECT_95\0"
+	"USXGMII_PDI_INDIRECT_96\0"
+	"USXGMII_PDI_INDIRECT_97\0"
+	"USXGMII_PDI_INDIRECT_98\0"
+	"USXGMII_PDI_INDIRECT_99\0"
+	"USXGMII_PDI_INDIRECT_100\0"
+	"USXGMII_PDI_INDIRECT_101\0"
+	"USXGMII_PDI_INDIRECT_102\0"
+	"USXGMII_PDI_INDIRECT_103\0"
+	"USXGMII_PDI_INDIRECT_104\0"
+	"USXGMII_PDI_INDIRECT_105\0"
+	"USXGMII_PDI_INDIRECT_106\0"
+	"USXGMII_PDI_INDIRECT_107\0"
+	"USXGMII_PDI_INDIRECT_108\0"
+	"USXGMII_PDI_INDIRECT_109\0"
+	"USXGMII_PDI_INDIRECT_110\0"
+	"USXGMII_PDI_INDIRECT_111\0"
+	"USXGMII_PDI_INDIRECT_112\0"
+	"USXGMII_PDI_INDIRECT_113\0"
+	"USXGMII_PDI_INDIRECT_114\0"
+	"USXGMII_PDI_INDIRECT_115\0"
+	"USXGMII_PDI_INDIRECT_116\0"
+	"USXGMII_PDI_INDIRECT_117\0"
+	"USXGMII_PDI_INDIRECT_118\0"
+	"USXGMII_PDI_INDIRECT_119\0"
+	"USXGMII_PDI_INDIRECT_120\0"
+	"USXGMII_PDI_INDIRECT_121\0"
+	"USXGMII_PDI_INDIRECT_122\0"
+	"USXGMII_PDI_INDIRECT_123\0"
+	"USXGMII_PDI_INDIRECT_124\0"
+	"USXGMII_PDI_INDIRECT_125\0"
+	"USXGMII_PDI_INDIRECT_126\0"
+	"USXGMII_PDI_INDIRECT_127\0"
+	"USXGMII_PDI_INDIRECT_128\0"
+	"USXGMII_PDI_INDIRECT_129\0"
+	"USXGMII_PDI_INDIRECT_130\0"
+	"USXGMII_PDI_INDIRECT_131\0"
+	"USXGMII_PDI_INDIRECT_132\0"
+	"USXGMII_PDI_INDIRECT_133\0"
+	"USXGMII_PDI_INDIRECT_134\0"
+	"USXGMII_PDI_INDIRECT_135\0"
+	"USXGMII_PDI_INDIRECT_136\0"
+	"USXGMII_PDI_INDIRECT_137\0"
+	"USXGMII_PDI_INDIRECT_138\0"
+	"USXGMII_PDI_INDIRECT_139\0"
+	"USXGMII_PDI_INDIRECT_140\0"
+	"USXGMII_PDI_INDIRECT_141\0"
+	"USXGMII_PDI_INDIRECT_142\0"
+	"USXGMII_PDI_INDIRECT_143\0"
+	"USXGMII_PDI_INDIRECT_144\0"
+	"USXGMII_PDI_INDIRECT_145\0"
+	"USXGMII_PDI_INDIRECT_146\0"
+	"USXGMII_PDI_INDIRECT_147\0"
+	"USXGMII_PDI_INDIRECT_148\0"
+	"USXGMII_PDI_INDIRECT_149\0"
+	"USXGMII_PDI_INDIRECT_150\0"
+	"USXGMII_PDI_INDIRECT_151\0"
+	"USXGMII_PDI_INDIRECT_152\0"
+	"USXGMII_PDI_INDIRECT_153\0"
+	"USXGMII_PDI_INDIRECT_154\0"
+	"USXGMII_PDI_INDIRECT_155\0"
+	"USXGMII_PDI_INDIRECT_156\0"
+	"USXGMII_PDI_INDIRECT_157\0"
+	"USXGMII_PDI_INDIRECT_158\0"
+	"USXGMII_PDI_INDIRECT_159\0"
+	"USXGMII_PDI_INDIRECT_160\0"
+	"USXGMII_PDI_INDIRECT_161\0"
+	"USXGMII_PDI_INDIRECT_162\0"
+	"USXGMII_PDI_INDIRECT_163\0"
+	"USXGMII_PDI_INDIRECT_164\0"
+	"USXGMII_PDI_INDIRECT_165\0"
+	"USXGMII_PDI_INDIRECT_166\0"
+	"USXGMII_PDI_INDIRECT_167\0"
+	"USXGMII_PDI_INDIRECT_168\0"
+	"USXGMII_PDI_INDIRECT_169\0"
+	"USXGMII_PDI_INDIRECT_170\0"
+	"USXGMII_PDI_INDIRECT_171\0"
+	"USXGMII_PDI_INDIRECT_172\0"
+	"USXGMII_PDI_INDIRECT_173\0"
+	"USXGMII_PDI_INDIRECT_174\0"
+	"USXGMII_PDI_INDIRECT_175\0"
+	"USXGMII_PDI_INDIRECT_176\0"
+	"USXGMII_PDI_INDIRECT_177\0"
+	"USXGMII_PDI_INDIRECT_178\0"
+	"USXGMII_PDI_INDIRECT_179\0"
+	"USXGMII_PDI_INDIRECT_180\0"
+	"USXGMII_PDI_INDIRECT_181\0"
+	"USXGMII_PDI_INDIRECT_182\0"
+	"USXGMII_PDI_INDIRECT_183\0"
+	"USXGMII_PDI_INDIRECT_184\0"
+	"USXGMII_PDI_INDIRECT_185\0"
+	"USXGMII_PDI_INDIRECT_186\0"
+	"USXGMII_PDI_INDIRECT_187\0"
+	"USXGMII_PDI_INDIRECT_188\0"
+	"USXGMII_PDI_INDIRECT_189\0"
+	"USXGMII_PDI_INDIRECT_190\0"
+	"USXGMII_PDI_INDIRECT_191\0"
+	"USXGMII_PDI_INDIRECT_192\0"
+	"USXGMII_PDI_INDIRECT_193\0"
+	"USXGMII_PDI_INDIRECT_194\0"
+	"USXGMII_PDI_INDIRECT_195\0"
+	"USXGMII_PDI_INDIRECT_196\0"
+	"USXGMII_PDI_INDIRECT_197\0"
+	"USXGMII_PDI_INDIRECT_198\0"
+	"USXGMII_PDI_INDIRECT_199\0"
+	"USXGMII_PDI_INDIRECT_200\0"
+	"USXGMII_PDI_INDIRECT_201\0"
+	"USXGMII_PDI_INDIRECT_202\0"
+	"USXGMII_PDI_INDIRECT_203\0"
+	"USXGMII_PDI_INDIRECT_204\0"
+	"USXGMII_PDI_INDIRECT_205\0"
+	"USXGMII_PDI_INDIRECT_206\0"
+	"USXGMII_PDI_INDIRECT_207\0"
+	"USXGMII_PDI_INDIRECT_208\0"
+	"USXGMII_PDI_INDIRECT_209\0"
+	"USXGMII_PDI_INDIRECT_210\0"
+	"USXGMII_PDI_INDIRECT_211\0"
+	"USXGMII_PDI_INDIRECT_212\0"
+	"USXGMII_PDI_INDIRECT_213\0"
+	"USXGMII_PDI_INDIRECT_214\0"
+	"USXGMII_PDI_INDIRECT_215\0"
+	"USXGMII_PDI_INDIRECT_216\0"
+	"USXGMII_PDI_INDIRECT_217\0"
+	"USXGMII_PDI_INDIRECT_218\0"
+	"USXGMII_PDI_INDIRECT_219\0"
+	"USXGMII_PDI_INDIRECT_220\0"
+	"USXGMII_PDI_INDIRECT_221\0"
+	"USXGMII_PDI_INDIRECT_222\0"
+	"USXGMII_PDI_INDIRECT_223\0"
+	"USXGMII_PDI_INDIRECT_224\0"
+	"USXGMII_PDI_INDIRECT_225\0"
+	"USXGMII_PDI_INDIRECT_226\0"
+	"USXGMII_PDI_INDIRECT_227\0"
+	"USXGMII_PDI_INDIRECT_228\0"
+	"USXGMII_PDI_INDIRECT_229\0"
+	"USXGMII_PDI_INDIRECT_230\0"
+	"USXGMII_PDI_INDIRECT_231\0"
+	"USXGMII_PDI_INDIRECT_232\0"
+	"USXGMII_PDI_INDIRECT_233\0"
+	"USXGMII_PDI_INDIRECT_234\0"
+	"USXGMII_PDI_INDIRECT_235\0"
+	"USXGMII_PDI_INDIRECT_236\0"
+	"USXGMII_PDI_INDIRECT_237\0"
+	"USXGMII_PDI_INDIRECT_238\0"
+	"USXGMII_PDI_INDIRECT_239\0"
+	"USXGMII_PDI_INDIRECT_240\0"
+	"USXGMII_PDI_INDIRECT_241\0"
+	"USXGMII_PDI_INDIRECT_242\0"
+	"USXGMII_PDI_INDIRECT_243\0"
+	"USXGMII_PDI_INDIRECT_244\0"
+	"USXGMII_PDI_INDIRECT_245\0"
+	"USXGMII_PDI_INDIRECT_246\0"
+	"USXGMII_PDI_INDIRECT_247\0"
+	"USXGMII_PDI_INDIRECT_248\0"
+	"USXGMII_PDI_INDIRECT_249\0"
+	"USXGMII_PDI_INDIRECT_250\0"
+	"USXGMII_PDI_INDIRECT_251\0"
+	"USXGMII_PDI_INDIRECT_252\0"
+	"USXGMII_PDI_INDIRECT_253\0"
+	"USXGMII_PDI_INDIRECT_254\0"
+	"BADDR\0"
+	"USXGMII_PDI_BASEADRR\0";
+
+const struct gpy2xx_regmap_field gpy2xx_regmap_field[] = {
+	{ 0, 6, 1 },
+	{ 4, 7, 1 },
+	{ 8, 8, 1 },
+	{ 13, 9, 1 },
+	{ 18, 10, 1 },
+	{ 23, 11, 1 },
+	{ 26, 12, 1 },
+	{ 31, 13, 1 },
+	{ 35, 14, 1 },
+	{ 38, 15, 1 },
+	{ 51, 0, 1 },
+	{ 56, 1, 1 },
+	{ 59, 2, 1 },
+	{ 62, 3, 1 },
+	{ 67, 4, 1 },
+	{ 70, 5, 1 },
+	{ 75, 6, 1 },
+	{ 80, 8, 1 },
+	{ 84, 9, 1 },
+	{ 90, 10, 1 },
+	{ 96, 11, 1 },
+	{ 101, 12, 1 },
+	{ 106, 13, 1 },
+	{ 112, 14, 1 },
+	{ 118, 15, 1 },
+	{ 132, 0, 16 },
+	{ 147, 0, 4 },
+	{ 152, 4, 6 },
+	{ 132, 10, 6 },
+	{ 167, 0, 5 },
+	{ 170, 5, 7 },
+	{ 174, 12, 1 },
+	{ 67, 13, 1 },
+	{ 178, 15, 1 },
+	{ 167, 0, 5 },
+	{ 170, 5, 7 },
+	{ 174, 12, 1 },
+	{ 67, 13, 1 },
+	{ 192, 14, 1 },
+	{ 178, 15, 1 },
+	{ 207, 0, 1 },
+	{ 213, 1, 1 },
+	{ 216, 2, 1 },
+	{ 220, 3, 1 },
+	{ 226, 4, 1 },
+	{ 230, 5, 1 },
+	{ 236, 6, 1 },
+	{ 253, 0, 11 },
+	{ 257, 11, 1 },
+	{ 262, 12, 1 },
+	{ 267, 13, 1 },
+	{ 178, 15, 1 },
+	{ 253, 0, 11 },
+	{ 257, 11, 1 },
+	{ 262, 12, 1 },
+	{ 267, 13, 1 },
+	{ 192, 14, 1 },
+	{ 178, 15, 1 },
+	{ 294, 8, 1 },
+	{ 300, 9, 1 },
+	{ 306, 10, 1 },
+	{ 311, 11, 1 },
+	{ 314, 12, 1 },
+	{ 319, 13, 3 },
+	{ 332, 0, 8 },
+	{ 294, 10, 1 },
+	{ 300, 11, 1 },
+	{ 336, 12, 1 },
+	{ 344, 13, 1 },
+	{ 352, 14, 1 },
+	{ 358, 15, 1 },
+	{ 394, 0, 5 },
+	{ 400, 5, 3 },
+	{ 405, 8, 6 },
+	{ 410, 14, 2 },
+	{ 429, 0, 16 },
+	{ 400, 0, 8 },
+	{ 405, 8, 4 },
+	{ 451, 12, 1 },
+	{ 456, 13, 1 },
+	{ 461, 14, 1 },
+	{ 466, 15, 1 },
+	{ 481, 0, 4 },
+	{ 485, 8, 8 },
+	{ 499, 2, 2 },
+	{ 506, 8, 1 },
+	{ 530, 0, 1 },
+	{ 536, 2, 1 },
+	{ 542, 3, 1 },
+	{ 548, 4, 1 },
+	{ 553, 5, 1 },
+	{ 558, 6, 1 },
+	{ 563, 7, 1 },
+	{ 568, 8, 4 },
+	{ 574, 12, 1 },
+	{ 580, 13, 3 },
+	{ 595, 0, 1 },
+	{ 599, 1, 1 },
+	{ 604, 2, 1 },
+	{ 609, 3, 1 },
+	{ 613, 4, 1 },
+	{ 627, 8, 1 },
+	{ 634, 9, 1 },
+	{ 649, 0, 8 },
+	{ 655, 8, 4 },
+	{ 688, 0, 3 },
+	{ 694, 3, 1 },
+	{ 698, 4, 2 },
+	{ 701, 8, 1 },
+	{ 352, 9, 1 },
+	{ 59, 10, 1 },
+	{ 717, 0, 1 },
+	{ 722, 1, 1 },
+	{ 727, 2, 1 },
+	{ 732, 3, 1 },
+	{ 738, 4, 1 },
+	{ 744, 5, 1 },
+	{ 749, 6, 1 },
+	{ 609, 7, 1 },
+	{ 754, 8, 1 },
+	{ 758, 9, 1 },
+	{ 763, 10, 1 },
+	{ 767, 11, 1 },
+	{ 771, 12, 1 },
+	{ 776, 13, 1 },
+	{ 781, 14, 1 },
+	{ 786, 15, 1 },
+	{ 717, 0, 1 },
+	{ 722, 1, 1 },
+	{ 727, 2, 1 },
+	{ 732, 3, 1 },
+	{ 738, 4, 1 },
+	{ 744, 5, 1 },
+	{ 749, 6, 1 },
+	{ 609, 7, 1 },
+	{ 754, 8, 1 },
+	{ 763, 10, 1 },
+	{ 767, 11, 1 },
+	{ 771, 12, 1 },
+	{ 776, 13, 1 },
+	{ 781, 14, 1 },
+	{ 786, 15, 1 },
+	{ 810, 0, 1 },
+	{ 817, 1, 1 },
+	{ 824, 2, 1 },
+	{ 831, 3, 1 },
+	{ 838, 8, 1 },
+	{ 845, 9, 1 },
+	{ 852, 10, 1 },
+	{ 859, 11, 1 },
+	{ 866, 12, 4 },
+	{ 878, 0, 1 },
+	{ 881, 1, 1 },
+	{ 887, 4, 3 },
+	{ 892, 8, 2 },
+	{ 897, 10, 2 },
+	{ 902, 13, 1 },
+	{ 907, 14, 2 },
+	{ 925, 0, 8 },
+	{ 930, 8, 4 },
+	{ 933, 12, 4 },
+	{ 948, 0, 8 },
+	{ 954, 8, 7 },
+	{ 960, 15, 1 },
+	{ 972, 0, 4 },
+	{ 978, 4, 2 },
+	{ 984, 6, 1 },
+	{ 990, 7, 1 },
+	{ 319, 13, 3 },
+	{ 1006, 0, 1 },
+	{ 1010, 1, 1 },
+	{ 1014, 2, 4 },
+	{ 0, 6, 1 },
+	{ 1024, 11, 1 },
+	{ 31, 13, 1 },
+	{ 38, 15, 1 },
+	{ 1044, 1, 1 },
+	{ 1062, 2, 1 },
+	{ 1077, 7, 1 },
+	{ 1115, 0, 1 },
+	{ 1127, 1, 1 },
+	{ 1140, 2, 1 },
+	{ 1159, 4, 1 },
+	{ 1169, 5, 1 },
+	{ 1178, 6, 1 },
+	{ 1186, 7, 1 },
+	{ 1196, 8, 1 },
+	{ 1204, 9, 1 },
+	{ 1213, 13, 1 },
+	{ 1221, 14, 1 },
+	{ 1246, 0, 1 },
+	{ 1256, 1, 1 },
+	{ 1264, 2, 1 },
+	{ 1268, 3, 1 },
+	{ 1272, 4, 1 },
+	{ 1279, 5, 1 },
+	{ 1286, 6, 1 },
+	{ 1289, 7, 1 },
+	{ 1294, 8, 1 },
+	{ 1304, 9, 1 },
+	{ 1314, 10, 1 },
+	{ 1324, 11, 1 },
+	{ 1343, 13, 1 },
+	{ 1354, 14, 1 },
+	{ 1361, 15, 1 },
+	{ 1377, 0, 6 },
+	{ 1403, 0, 1 },
+	{ 1422, 1, 1 },
+	{ 1439, 2, 1 },
+	{ 1456, 3, 1 },
+	{ 1473, 4, 1 },
+	{ 1491, 5, 1 },
+	{ 1508, 6, 1 },
+	{ 1525, 7, 1 },
+	{ 1542, 8, 1 },
+	{ 1557, 9, 1 },
+	{ 1571, 10, 1 },
+	{ 1580, 11, 1 },
+	{ 1589, 12, 1 },
+	{ 1606, 13, 1 },
+	{ 1623, 14, 2 },
+	{ 1648, 0, 1 },
+	{ 1666, 1, 1 },
+	{ 1684, 2, 1 },
+	{ 1698, 3, 1 },
+	{ 1716, 4, 1 },
+	{ 1733, 5, 1 },
+	{ 1753, 6, 1 },
+	{ 1774, 7, 1 },
+	{ 1794, 8, 1 },
+	{ 1812, 9, 1 },
+	{ 1825, 10, 1 },
+	{ 1849, 14, 1 },
+	{ 1908, 0, 1 },
+	{ 1914, 1, 1 },
+	{ 1934, 0, 1 },
+	{ 1969, 0, 2 },
+	{ 1979, 8, 1 },
+	{ 1995, 9, 1 },
+	{ 2011, 10, 1 },
+	{ 2027, 11, 1 },
+	{ 2061, 0, 1 },
+	{ 2078, 10, 3 },
+	{ 2095, 13, 3 },
+	{ 2117, 10, 3 },
+	{ 2128, 13, 3 },
+	{ 2161, 0, 16 },
+	{ 2196, 0, 16 },
+	{ 2231, 0, 16 },
+	{ 2266, 0, 16 },
+	{ 2301, 0, 16 },
+	{ 2334, 0, 16 },
+	{ 2367, 0, 16 },
+	{ 2400, 0, 16 },
+	{ 2433, 0, 16 },
+	{ 2458, 0, 16 },
+	{ 2483, 0, 16 },
+	{ 2508, 0, 16 },
+	{ 2533, 8, 7 },
+	{ 2568, 0, 7 },
+	{ 2581, 8, 7 },
+	{ 2616, 0, 1 },
+	{ 2636, 1, 2 },
+	{ 2658, 3, 1 },
+	{ 2682, 4, 1 },
+	{ 2703, 6, 5 },
+	{ 2725, 11, 5 },
+	{ 2778, 0, 1 },
+	{ 2784, 1, 1 },
+	{ 1014, 2, 4 },
+	{ 0, 6, 1 },
+	{ 2807, 10, 1 },
+	{ 1024, 11, 1 },
+	{ 31, 13, 1 },
+	{ 2814, 14, 1 },
+	{ 38, 15, 1 },
+	{ 1044, 1, 1 },
+	{ 2833, 2, 1 },
+	{ 2852, 6, 1 },
+	{ 1077, 7, 1 },
+	{ 2859, 8, 1 },
+	{ 2877, 9, 1 },
+	{ 2895, 10, 1 },
+	{ 2906, 11, 1 },
+	{ 2949, 0, 1 },
+	{ 2962, 1, 1 },
+	{ 2982, 2, 1 },
+	{ 2995, 3, 1 },
+	{ 3009, 6, 1 },
+	{ 3040, 0, 1 },
+	{ 1256, 1, 1 },
+	{ 3045, 2, 1 },
+	{ 1268, 3, 1 },
+	{ 1272, 4, 1 },
+	{ 1279, 5, 1 },
+	{ 1286, 6, 1 },
+	{ 1289, 7, 1 },
+	{ 3057, 8, 1 },
+	{ 3073, 9, 1 },
+	{ 1314, 10, 1 },
+	{ 3089, 11, 1 },
+	{ 3114, 13, 1 },
+	{ 3134, 14, 1 },
+	{ 3159, 15, 1 },
+	{ 3193, 0, 4 },
+	{ 3216, 0, 1 },
+	{ 3235, 1, 1 },
+	{ 3254, 2, 1 },
+	{ 3273, 3, 1 },
+	{ 3292, 4, 1 },
+	{ 3311, 5, 1 },
+	{ 1571, 10, 1 },
+	{ 1580, 11, 1 },
+	{ 3009, 12, 1 },
+	{ 1623, 14, 2 },
+	{ 3365, 1, 1 },
+	{ 3381, 2, 1 },
+	{ 3397, 3, 1 },
+	{ 3412, 4, 1 },
+	{ 3429, 5, 1 },
+	{ 3446, 6, 1 },
+	{ 3474, 0, 1 },
+	{ 3483, 1, 1 },
+	{ 3504, 0, 16 },
+	{ 3526, 0, 1 },
+	{ 3542, 1, 1 },
+	{ 3556, 3, 1 },
+	{ 3575, 12, 1 },
+	{ 3608, 0, 8 },
+	{ 3618, 8, 6 },
+	{ 3622, 14, 1 },
+	{ 3639, 15, 1 },
+	{ 3672, 0, 1 },
+	{ 3700, 1, 1 },
+	{ 3745, 9, 1 },
+	{ 3758, 12, 1 },
+	{ 174, 13, 1 },
+	{ 38, 15, 1 },
+	{ 3778, 0, 1 },
+	{ 3791, 2, 1 },
+	{ 3799, 3, 1 },
+	{ 3809, 4, 1 },
+	{ 3817, 5, 1 },
+	{ 213, 6, 1 },
+	{ 3831, 7, 1 },
+	{ 226, 9, 1 },
+	{ 3040, 0, 1 },
+	{ 3870, 1, 1 },
+	{ 1264, 2, 1 },
+	{ 1268, 3, 1 },
+	{ 3877, 4, 1 },
+	{ 3883, 5, 1 },
+	{ 1286, 6, 1 },
+	{ 1289, 7, 1 },
+	{ 3889, 8, 1 },
+	{ 3894, 9, 1 },
+	{ 3899, 10, 1 },
+	{ 3904, 11, 1 },
+	{ 3919, 13, 1 },
+	{ 1354, 14, 1 },
+	{ 1361, 15, 1 },
+	{ 3999, 0, 16 },
+	{ 4017, 0, 16 },
+	{ 4083, 0, 1 },
+	{ 4087, 1, 1 },
+	{ 4090, 2, 1 },
+	{ 4096, 5, 1 },
+	{ 4105, 6, 1 },
+	{ 4113, 7, 1 },
+	{ 4122, 8, 1 },
+	{ 4130, 12, 1 },
+	{ 4139, 13, 1 },
+	{ 4142, 14, 1 },
+	{ 4147, 15, 1 },
+	{ 4096, 3, 1 },
+	{ 4105, 4, 1 },
+	{ 4113, 5, 1 },
+	{ 4122, 6, 1 },
+	{ 4192, 1, 1 },
+	{ 4203, 2, 1 },
+	{ 4214, 3, 1 },
+	{ 4224, 4, 1 },
+	{ 4236, 5, 1 },
+	{ 4248, 6, 1 },
+	{ 4294, 0, 1 },
+	{ 4334, 3, 1 },
+	{ 4363, 0, 3 },
+	{ 4368, 4, 2 },
+	{ 4372, 6, 2 },
+	{ 4376, 8, 3 },
+	{ 4383, 11, 3 },
+	{ 4400, 0, 4 },
+	{ 4407, 4, 4 },
+	{ 4411, 8, 4 },
+	{ 4417, 12, 4 },
+	{ 925, 0, 16 },
+	{ 4489, 0, 16 },
+	{ 4515, 0, 8 },
+	{ 4522, 8, 4 },
+	{ 4526, 14, 1 },
+	{ 4531, 15, 1 },
+	{ 4553, 0, 2 },
+	{ 4560, 2, 1 },
+	{ 4567, 3, 2 },
+	{ 4581, 5, 1 },
+	{ 0, 6, 1 },
+	{ 4596, 7, 1 },
+	{ 8, 8, 1 },
+	{ 13, 9, 1 },
+	{ 4604, 10, 1 },
+	{ 23, 11, 1 },
+	{ 26, 12, 1 },
+	{ 31, 13, 1 },
+	{ 35, 14, 1 },
+	{ 38, 15, 1 },
+	{ 4628, 0, 2 },
+	{ 59, 2, 1 },
+	{ 62, 3, 1 },
+	{ 67, 4, 1 },
+	{ 70, 5, 1 },
+	{ 4631, 15, 1 },
+	{ 4660, 0, 1 },
+	{ 4671, 1, 1 },
+	{ 4684, 2, 5 },
+	{ 4698, 7, 1 },
+	{ 4708, 8, 8 },
+	{ 4739, 0, 5 },
+	{ 4753, 5, 1 },
+	{ 4767, 6, 1 },
+	{ 4780, 7, 1 },
+	{ 4794, 8, 1 },
+	{ 4825, 0, 1 },
+	{ 4831, 1, 1 },
+	{ 4841, 2, 1 },
+	{ 4853, 3, 1 },
+	{ 4867, 4, 1 },
+	{ 4876, 5, 2 },
+	{ 4886, 7, 2 },
+	{ 4937, 0, 10 },
+	{ 4963, 0, 2 },
+	{ 1289, 2, 2 },
+	{ 4968, 4, 2 },
+	{ 4972, 6, 2 },
+	{ 4982, 8, 2 },
+	{ 4987, 10, 2 },
+	{ 4995, 15, 1 },
+	{ 5015, 0, 2 },
+	{ 5025, 2, 2 },
+	{ 5034, 4, 2 },
+	{ 5044, 6, 2 },
+	{ 5069, 0, 1 },
+	{ 5078, 1, 1 },
+	{ 5085, 2, 1 },
+	{ 5089, 3, 1 },
+	{ 5097, 4, 1 },
+	{ 5130, 0, 11 },
+	{ 5141, 15, 1 },
+	{ 5163, 0, 2 },
+	{ 5170, 2, 2 },
+	{ 5177, 4, 2 },
+	{ 5184, 6, 2 },
+	{ 878, 0, 1 },
+	{ 5211, 2, 1 },
+	{ 5235, 0, 8 },
+	{ 5239, 8, 8 },
+	{ 5260, 0, 8 },
+	{ 5264, 8, 8 },
+	{ 5285, 0, 8 },
+	{ 5289, 8, 8 },
+	{ 5310, 0, 8 },
+	{ 5314, 8, 8 },
+	{ 5335, 0, 8 },
+	{ 5339, 8, 8 },
+	{ 5360, 0, 8 },
+	{ 5364, 8, 8 },
+	{ 878, 0, 1 },
+	{ 5385, 1, 1 },
+	{ 5390, 2, 1 },
+	{ 5396, 3, 1 },
+	{ 5401, 4, 1 },
+	{ 35, 5, 1 },
+	{ 80, 6, 2 },
+	{ 5428, 0, 1 },
+	{ 5434, 1, 1 },
+	{ 5440, 8, 1 },
+	{ 4825, 9, 1 },
+	{ 5472, 0, 5 },
+	{ 5478, 5, 5 },
+	{ 5484, 10, 2 },
+	{ 5487, 12, 1 },
+	{ 5517, 0, 16 },
+	{ 5547, 0, 16 },
+	{ 485, 0, 8 },
+	{ 5578, 8, 1 },
+	{ 5607, 0, 16 },
+	{ 5781, 0, 32 },
+	{ 5827, 0, 16 },
+	{ 5845, 16, 16 },
+	{ 5883, 0, 32 },
+	{ 5929, 0, 16 },
+	{ 5947, 16, 12 },
+	{ 5982, 0, 1 },
+	{ 5993, 1, 1 },
+	{ 6004, 2, 1 },
+	{ 6015, 3, 1 },
+	{ 6026, 4, 3 },
+	{ 6034, 7, 1 },
+	{ 6049, 8, 1 },
+	{ 6058, 9, 1 },
+	{ 6065, 10, 1 },
+	{ 6073, 11, 1 },
+	{ 6081, 12, 2 },
+	{ 6093, 16, 4 },
+	{ 6108, 24, 8 },
+	{ 6148, 0, 32 },
+	{ 6195, 0, 32 },
+	{ 6241, 0, 1 },
+	{ 6255, 1, 1 },
+	{ 6269, 2, 1 },
+	{ 6283, 3, 1 },
+	{ 6297, 4, 1 },
+	{ 6311, 5, 1 },
+	{ 6325, 6, 1 },
+	{ 6339, 7, 1 },
+	{ 6353, 8, 1 },
+	{ 6367, 9, 1 },
+	{ 6381, 10, 1 },
+	{ 6395, 11, 1 },
+	{ 6409, 12, 1 },
+	{ 6424, 13, 1 },
+	{ 6438, 14, 1 },
+	{ 6454, 15, 1 },
+	{ 6468, 16, 1 },
+	{ 6482, 17, 1 },
+	{ 6495, 18, 1 },
+	{ 6508, 19, 1 },
+	{ 6525, 20, 1 },
+	{ 6542, 21, 1 },
+	{ 6561, 22, 1 },
+	{ 6580, 23, 1 },
+	{ 6596, 24, 8 },
+	{ 6624, 0, 12 },
+	{ 6638, 12, 3 },
+	{ 6652, 16, 5 },
+	{ 13671, 0, 32 },
+	{ 13706, 0, 32 },
+	{ 13741, 0, 32 },
+	{ 13770, 0, 32 },
+	{ 13803, 0, 5 },
+	{ 13817, 14, 1 },
+	{ 13828, 15, 1 },
+	{ 13836, 16, 5 },
+	{ 13852, 30, 1 },
+	{ 13865, 31, 1 },
+	{ 13902, 0, 6 },
+	{ 13909, 8, 6 },
+	{ 13919, 31, 1 },
+	{ 13950, 0, 2 },
+	{ 13960, 2, 2 },
+	{ 13970, 4, 1 },
+	{ 13988, 5, 1 },
+	{ 14004, 6, 2 },
+	{ 14016, 8, 5 },
+	{ 14025, 16, 1 },
+	{ 14040, 17, 1 },
+	{ 14050, 19, 2 },
+	{ 14066, 24, 7 },
+	{ 5929, 0, 16 },
+	{ 14806, 16, 16 },
+	{ 14806, 16, 16 },
+	{ 5929, 0, 16 },
+	{ 15600, 0, 8 },
+	{ 15618, 12, 4 },
+	{ 15713, 0, 1 },
+	{ 15724, 1, 1 },
+	{ 15735, 2, 1 },
+	{ 15746, 3, 1 },
+	{ 15757, 4, 1 },
+	{ 15768, 5, 1 },
+	{ 15779, 6, 1 },
+	{ 15790, 7, 1 },
+	{ 15801, 8, 1 },
+	{ 15814, 9, 1 },
+	{ 15827, 10, 1 },
+	{ 15840, 11, 1 },
+	{ 15853, 12, 1 },
+	{ 15866, 13, 1 },
+	{ 15879, 14, 1 },
+	{ 15892, 15, 1 },
+	{ 15905, 16, 1 },
+	{ 15918, 17, 1 },
+	{ 15931, 21, 1 },
+	{ 15945, 22, 1 },
+	{ 15959, 23, 1 },
+	{ 15973, 24, 1 },
+	{ 15987, 25, 1 },
+	{ 16001, 26, 1 },
+	{ 16015, 27, 1 },
+	{ 16029, 28, 1 },
+	{ 16062, 0, 1 },
+	{ 16071, 1, 1 },
+	{ 16080, 2, 1 },
+	{ 16089, 3, 1 },
+	{ 16098, 4, 1 },
+	{ 16107, 5, 1 },
+	{ 16116, 6, 1 },
+	{ 16125, 7, 1 },
+	{ 16134, 8, 1 },
+	{ 16143, 9, 1 },
+	{ 16152, 10, 1 },
+	{ 16161, 11, 1 },
+	{ 16170, 12, 1 },
+	{ 16179, 13, 1 },
+	{ 16188, 14, 1 },
+	{ 16197, 15, 1 },
+	{ 16206, 16, 1 },
+	{ 16213, 17, 1 },
+	{ 16220, 18, 1 },
+	{ 16226, 19, 1 },
+	{ 16235, 20, 1 },
+	{ 16244, 21, 1 },
+	{ 16254, 22, 1 },
+	{ 16264, 23, 1 },
+	{ 16274, 24, 1 },
+	{ 16284, 25, 1 },
+	{ 16294, 26, 1 },
+	{ 16304, 27, 1 },
+	{ 16314, 28, 1 },
+	{ 16345, 0, 24 },
+	{ 16353, 24, 3 },
+	{ 16360, 27, 1 },
+	{ 16371, 28, 1 },
+	{ 16382, 29, 1 },
+	{ 16393, 30, 1 },
+	{ 16404, 31, 1 },
+	{ 16431, 0, 16 },
+	{ 16442, 16, 16 },
+	{ 16470, 0, 16 },
+	{ 16482, 16, 16 },
+	{ 16512, 0, 24 },
+	{ 16538, 0, 1 },
+	{ 16549, 1, 1 },
+	{ 16557, 2, 1 },
+	{ 16567, 3, 1 },
+	{ 16577, 4, 1 },
+	{ 16586, 5, 1 },
+	{ 16595, 6, 1 },
+	{ 16604, 16, 16 },
+	{ 16638, 0, 1 },
+	{ 16649, 2, 2 },
+	{ 16660, 4, 1 },
+	{ 16679, 6, 2 },
+	{ 16692, 8, 1 },
+	{ 16703, 10, 2 },
+	{ 16714, 12, 1 },
+	{ 16733, 14, 2 },
+	{ 16746, 16, 1 },
+	{ 16757, 18, 2 },
+	{ 16768, 20, 1 },
+	{ 16787, 22, 2 },
+	{ 16800, 24, 1 },
+	{ 16811, 26, 2 },
+	{ 16822, 28, 1 },
+	{ 16841, 30, 2 },
+	{ 16638, 0, 1 },
+	{ 16649, 2, 2 },
+	{ 16660, 4, 1 },
+	{ 16679, 6, 2 },
+	{ 16917, 0, 8 },
+	{ 16936, 8, 1 },
+	{ 16950, 9, 1 },
+	{ 14050, 10, 2 },
+	{ 16963, 12, 1 },
+	{ 16981, 24, 2 },
+	{ 16996, 26, 6 },
+	{ 17034, 0, 8 },
+	{ 17086, 0, 5 },
+	{ 17092, 16, 5 },
+	{ 6081, 24, 2 },
+	{ 17100, 26, 2 },
+	{ 6034, 28, 1 },
+	{ 17113, 29, 1 },
+	{ 17122, 30, 1 },
+	{ 17100, 0, 2 },
+	{ 17144, 2, 1 },
+	{ 17164, 3, 1 },
+	{ 17181, 4, 1 },
+	{ 17216, 0, 32 },
+	{ 17249, 0, 16 },
+	{ 17266, 16, 12 },
+	{ 17278, 28, 3 },
+	{ 5982, 0, 1 },
+	{ 5993, 1, 1 },
+	{ 6004, 2, 1 },
+	{ 6015, 3, 1 },
+	{ 17307, 4, 1 },
+	{ 17318, 5, 1 },
+	{ 17331, 31, 1 },
+	{ 17365, 0, 12 },
+	{ 17383, 12, 3 },
+	{ 17418, 0, 32 },
+	{ 17459, 0, 16 },
+	{ 17479, 16, 16 },
+	{ 17515, 0, 32 },
+	{ 17556, 0, 16 },
+	{ 17598, 0, 32 },
+	{ 17643, 0, 32 },
+	{ 17689, 0, 32 },
+	{ 17728, 0, 32 },
+	{ 17768, 0, 32 },
+	{ 17805, 0, 32 },
+	{ 17844, 0, 32 },
+	{ 17879, 0, 32 },
+	{ 17999, 0, 1 },
+	{ 18014, 1, 1 },
+	{ 18029, 2, 1 },
+	{ 18044, 3, 1 },
+	{ 18059, 4, 1 },
+	{ 18074, 5, 1 },
+	{ 18089, 6, 1 },
+	{ 18104, 7, 1 },
+	{ 18119, 8, 1 },
+	{ 18134, 9, 1 },
+	{ 18149, 10, 1 },
+	{ 18164, 11, 1 },
+	{ 18179, 12, 1 },
+	{ 18195, 13, 1 },
+	{ 18210, 14, 1 },
+	{ 18227, 15, 1 },
+	{ 18242, 16, 1 },
+	{ 18257, 17, 1 },
+	{ 18271, 18, 1 },
+	{ 18285, 19, 1 },
+	{ 18303, 20, 1 },
+	{ 18321, 21, 1 },
+	{ 18338, 23, 1 },
+	{ 18355, 24, 8 },
+	{ 18391, 0, 1 },
+	{ 18411, 1, 1 },
+	{ 19156, 0, 1 },
+	{ 19193, 0, 32 },
+	{ 42437, 0, 11 },
+	{ 42455, 16, 15 },
+	{ 42492, 0, 5 },
+	{ 42512, 16, 15 },
+	{ 42551, 0, 14 },
+	{ 42591, 0, 1 },
+	{ 42599, 1, 1 },
+	{ 42609, 2, 1 },
+	{ 17086, 4, 5 },
+	{ 6026, 12, 3 },
+	{ 42621, 16, 15 },
+	{ 42662, 0, 1 },
+	{ 42672, 1, 1 },
+	{ 42685, 2, 1 },
+	{ 42700, 3, 1 },
+	{ 42716, 4, 1 },
+	{ 42749, 0, 11 },
+	{ 42769, 16, 5 },
+	{ 42809, 0, 14 },
+	{ 42851, 0, 32 },
+	{ 42894, 0, 32 },
+	{ 42938, 0, 32 },
+	{ 42981, 0, 32 },
+	{ 43025, 0, 14 },
+	{ 43058, 0, 8 },
+	{ 43068, 8, 8 },
+	{ 43078, 16, 8 },
+	{ 43088, 24, 8 },
+	{ 43121, 0, 8 },
+	{ 43154, 0, 32 },
+	{ 43186, 0, 11 },
+	{ 5947, 0, 12 },
+	{ 43951, 16, 16 },
+	{ 43988, 0, 1 },
+	{ 5982, 1, 1 },
+	{ 43996, 2, 1 },
+	{ 44008, 3, 1 },
+	{ 44020, 4, 1 },
+	{ 44032, 5, 1 },
+	{ 44043, 6, 1 },
+	{ 6495, 7, 1 },
+	{ 44059, 8, 1 },
+	{ 44076, 9, 1 },
+	{ 6525, 10, 1 },
+	{ 44092, 11, 1 },
+	{ 6093, 12, 3 },
+	{ 44105, 15, 1 },
+	{ 44118, 16, 5 },
+	{ 6542, 24, 1 },
+	{ 6561, 25, 1 },
+	{ 17113, 26, 1 },
+	{ 44132, 27, 1 },
+	{ 6624, 0, 12 },
+	{ 6638, 12, 3 },
+	{ 46257, 14, 1 },
+	{ 46276, 15, 1 },
+	{ 46309, 16, 16 },
+	{ 46342, 0, 5 },
+	{ 13817, 14, 1 },
+	{ 13828, 15, 1 },
+	{ 46355, 16, 5 },
+	{ 13852, 30, 1 },
+	{ 13865, 31, 1 },
+	{ 16345, 0, 24 },
+	{ 16353, 24, 3 },
+	{ 46396, 27, 1 },
+	{ 16371, 28, 1 },
+	{ 16382, 29, 1 },
+	{ 16393, 30, 1 },
+	{ 16404, 31, 1 },
+	{ 5947, 0, 12 },
+	{ 6026, 12, 3 },
+	{ 43951, 16, 16 },
+	{ 17113, 0, 1 },
+	{ 5982, 1, 1 },
+	{ 43996, 2, 1 },
+	{ 46490, 3, 1 },
+	{ 6004, 4, 1 },
+	{ 6015, 5, 1 },
+	{ 46502, 6, 1 },
+	{ 5993, 7, 1 },
+	{ 17122, 8, 1 },
+	{ 46521, 14, 1 },
+	{ 46528, 15, 1 },
+	{ 17092, 16, 5 },
+	{ 46541, 24, 5 },
+	{ 17365, 0, 12 },
+	{ 17383, 12, 3 },
+	{ 46572, 16, 5 },
+	{ 46621, 0, 15 },
+	{ 46633, 15, 1 },
+	{ 46847, 0, 11 },
+	{ 46863, 15, 1 },
+	{ 46880, 16, 1 },
+	{ 46896, 17, 15 },
+	{ 46927, 0, 14 },
+	{ 46967, 0, 32 },
+	{ 47061, 0, 31 },
+	{ 47074, 31, 1 },
+	{ 47113, 0, 5 },
+	{ 47128, 16, 4 },
+	{ 47143, 24, 2 },
+	{ 47182, 0, 5 },
+	{ 47196, 16, 4 },
+	{ 47210, 24, 1 },
+	{ 47229, 25, 1 },
+	{ 47245, 29, 3 },
+	{ 47277, 2, 1 },
+	{ 47329, 0, 1 },
+	{ 47344, 1, 1 },
+	{ 47357, 2, 1 },
+	{ 47370, 3, 1 },
+	{ 47383, 4, 1 },
+	{ 47396, 5, 1 },
+	{ 47409, 6, 1 },
+	{ 47421, 7, 1 },
+	{ 47433, 8, 1 },
+	{ 47441, 9, 1 },
+	{ 47449, 10, 1 },
+	{ 47461, 11, 1 },
+	{ 47469, 12, 1 },
+	{ 47477, 30, 1 },
+	{ 47490, 31, 1 },
+	{ 47522, 0, 5 },
+	{ 47535, 8, 1 },
+	{ 47548, 9, 1 },
+	{ 47561, 16, 16 },
+	{ 47602, 0, 15 },
+	{ 47608, 16, 2 },
+	{ 47622, 18, 1 },
+	{ 47637, 19, 1 },
+	{ 47650, 20, 1 },
+	{ 47665, 21, 1 },
+	{ 47680, 28, 4 },
+	{ 47730, 0, 1 },
+	{ 47742, 1, 1 },
+	{ 47755, 2, 1 },
+	{ 47766, 3, 1 },
+	{ 47780, 4, 1 },
+	{ 47802, 5, 1 },
+	{ 47823, 14, 1 },
+	{ 47835, 15, 1 },
+	{ 47849, 16, 1 },
+	{ 47864, 17, 1 },
+	{ 47880, 18, 1 },
+	{ 47894, 19, 1 },
+	{ 47911, 20, 1 },
+	{ 47936, 21, 1 },
+	{ 47960, 30, 1 },
+	{ 47975, 31, 1 },
+	{ 48017, 0, 31 },
+	{ 48151, 0, 2 },
+	{ 48268, 0, 1 },
+	{ 48282, 1, 1 },
+	{ 48297, 2, 1 },
+	{ 48318, 4, 28 },
+	{ 48364, 0, 8 },
+	{ 48381, 31, 1 },
+	{ 48417, 0, 4 },
+	{ 48431, 4, 4 },
+	{ 48445, 8, 1 },
+	{ 48459, 9, 1 },
+	{ 48476, 10, 1 },
+	{ 48493, 11, 1 },
+	{ 48509, 12, 1 },
+	{ 48513, 13, 1 },
+	{ 48520, 14, 4 },
+	{ 48530, 18, 1 },
+	{ 48537, 19, 1 },
+	{ 48544, 20, 5 },
+	{ 48559, 25, 1 },
+	{ 48565, 26, 1 },
+	{ 48580, 30, 1 },
+	{ 48596, 31, 1 },
+	{ 48628, 0, 8 },
+	{ 48639, 8, 8 },
+	{ 48656, 16, 4 },
+	{ 48417, 20, 4 },
+	{ 48431, 24, 4 },
+	{ 48687, 0, 1 },
+	{ 48706, 1, 1 },
+	{ 48725, 2, 1 },
+	{ 48744, 3, 1 },
+	{ 48763, 4, 1 },
+	{ 48782, 5, 1 },
+	{ 48801, 6, 1 },
+	{ 48820, 7, 1 },
+	{ 48839, 8, 1 },
+	{ 48858, 9, 1 },
+	{ 48895, 0, 1 },
+	{ 48910, 1, 1 },
+	{ 48925, 2, 1 },
+	{ 48940, 3, 1 },
+	{ 48955, 4, 1 },
+	{ 48970, 5, 1 },
+	{ 48985, 6, 1 },
+	{ 49000, 7, 1 },
+	{ 49015, 8, 1 },
+	{ 49030, 9, 1 },
+	{ 49064, 0, 10 },
+	{ 49100, 0, 10 },
+	{ 49151, 0, 10 },
+	{ 49196, 0, 10 },
+	{ 49227, 0, 6 },
+	{ 49274, 0, 4 },
+	{ 49286, 4, 4 },
+	{ 49298, 8, 6 },
+	{ 42685, 14, 1 },
+	{ 42700, 15, 1 },
+	{ 49314, 16, 2 },
+	{ 49328, 18, 2 },
+	{ 49342, 20, 4 },
+	{ 49358, 24, 1 },
+	{ 49371, 25, 1 },
+	{ 49383, 27, 1 },
+	{ 49414, 0, 8 },
+	{ 49424, 8, 8 },
+	{ 49439, 16, 1 },
+	{ 6241, 0, 1 },
+	{ 6255, 1, 1 },
+	{ 6269, 2, 1 },
+	{ 6283, 3, 1 },
+	{ 6297, 4, 1 },
+	{ 6311, 5, 1 },
+	{ 6325, 6, 1 },
+	{ 6339, 7, 1 },
+	{ 6353, 8, 1 },
+	{ 6367, 9, 1 },
+	{ 6381, 10, 1 },
+	{ 6395, 11, 1 },
+	{ 6409, 12, 1 },
+	{ 6424, 13, 1 },
+	{ 6438, 14, 1 },
+	{ 6454, 15, 1 },
+	{ 6468, 16, 1 },
+	{ 6482, 17, 1 },
+	{ 6495, 18, 1 },
+	{ 6508, 19, 1 },
+	{ 6525, 20, 1 },
+	{ 6542, 21, 1 },
+	{ 6561, 22, 1 },
+	{ 6596, 24, 8 },
+	{ 13950, 0, 2 },
+	{ 13960, 2, 2 },
+	{ 13988, 5, 1 },
+	{ 14004, 6, 2 },
+	{ 14016, 8, 5 },
+	{ 55248, 16, 1 },
+	{ 14040, 17, 1 },
+	{ 55262, 18, 1 },
+	{ 55274, 19, 1 },
+	{ 55281, 20, 1 },
+	{ 55289, 21, 2 },
+	{ 55304, 23, 1 },
+	{ 14066, 24, 7 },
+	{ 55320, 31, 1 },
+	{ 16638, 0, 1 },
+	{ 16649, 2, 2 },
+	{ 16679, 6, 2 },
+	{ 16692, 8, 1 },
+	{ 16703, 10, 2 },
+	{ 16733, 14, 2 },
+	{ 16746, 16, 1 },
+	{ 16757, 18, 2 },
+	{ 16787, 22, 2 },
+	{ 16800, 24, 1 },
+	{ 16811, 26, 2 },
+	{ 16841, 30, 2 },
+	{ 16638, 0, 1 },
+	{ 16649, 2, 2 },
+	{ 16679, 6, 2 },
+	{ 17999, 0, 1 },
+	{ 18014, 1, 1 },
+	{ 18029, 2, 1 },
+	{ 18044, 3, 1 },
+	{ 18059, 4, 1 },
+	{ 18074, 5, 1 },
+	{ 18089, 6, 1 },
+	{ 18104, 7, 1 },
+	{ 18119, 8, 1 },
+	{ 18134, 9, 1 },
+	{ 18149, 10, 1 },
+	{ 18164, 11, 1 },
+	{ 18179, 12, 1 },
+	{ 18195, 13, 1 },
+	{ 18210, 14, 1 },
+	{ 18227, 15, 1 },
+	{ 18242, 16, 1 },
+	{ 18257, 17, 1 },
+	{ 18271, 18, 1 },
+	{ 18285, 19, 1 },
+	{ 18303, 20, 1 },
+	{ 18321, 21, 1 },
+	{ 18355, 24, 8 },
+	{ 42437, 0, 4 },
+	{ 42455, 16, 15 },
+	{ 42551, 0, 5 },
+	{ 42749, 0, 4 },
+	{ 42769, 16, 5 },
+	{ 42809, 0, 5 },
+	{ 43025, 0, 5 },
+	{ 43058, 0, 8 },
+	{ 43078, 16, 8 },
+	{ 43088, 24, 8 },
+	{ 43186, 0, 4 },
+	{ 46847, 0, 4 },
+	{ 46863, 15, 1 },
+	{ 46896, 17, 15 },
+	{ 46927, 0, 5 },
+	{ 71605, 5, 11 },
+	{ 71628, 0, 1 },
+	{ 71631, 1, 11 },
+	{ 71637, 12, 4 },
+	{ 71663, 0, 12 },
+	{ 71669, 12, 3 },
+	{ 71677, 15, 1 },
+	{ 71700, 1, 5 },
+	{ 71703, 6, 4 },
+	{ 71706, 10, 5 },
+	{ 71733, 0, 7 },
+	{ 71740, 7, 7 },
+	{ 71768, 0, 5 },
+	{ 71777, 5, 8 },
+	{ 71788, 13, 3 },
+	{ 71818, 0, 16 },
+	{ 71844, 0, 16 },
+	{ 71870, 0, 16 },
+	{ 71896, 0, 12 },
+	{ 71903, 12, 1 },
+	{ 71929, 0, 16 },
+	{ 71959, 0, 16 },
+	{ 71989, 0, 16 },
+	{ 72019, 0, 10 },
+	{ 72038, 0, 11 },
+	{ 72065, 0, 11 },
+	{ 72092, 0, 2 },
+	{ 72097, 2, 1 },
+	{ 72104, 3, 1 },
+	{ 72113, 3, 1 },
+	{ 72123, 4, 1 },
+	{ 72133, 5, 1 },
+	{ 72143, 6, 1 },
+	{ 72153, 7, 1 },
+	{ 72164, 8, 1 },
+	{ 72175, 9, 1 },
+	{ 72186, 11, 1 },
+	{ 72197, 11, 1 },
+	{ 72209, 12, 1 },
+	{ 72221, 13, 1 },
+	{ 72233, 14, 1 },
+	{ 72259, 0, 2 },
+	{ 72263, 2, 1 },
+	{ 72268, 3, 2 },
+	{ 72272, 5, 1 },
+	{ 72296, 0, 16 },
+	{ 72463, 0, 8 },
+	{ 72473, 8, 8 },
+	{ 72502, 0, 2 },
+	{ 72510, 3, 1 },
+	{ 72520, 4, 1 },
+	{ 72545, 0, 1 },
+	{ 72553, 1, 1 },
+	{ 72561, 2, 1 },
+	{ 72569, 3, 1 },
+	{ 72577, 4, 1 },
+	{ 72584, 5, 1 },
+	{ 72591, 6, 1 },
+	{ 72598, 7, 1 },
+	{ 72605, 8, 1 },
+	{ 72613, 9, 1 },
+	{ 72620, 10, 1 },
+	{ 72627, 11, 1 },
+	{ 72636, 12, 1 },
+	{ 72645, 13, 1 },
+	{ 72654, 14, 1 },
+	{ 72663, 15, 1 },
+	{ 72697, 0, 1 },
+	{ 72703, 1, 1 },
+	{ 72709, 2, 1 },
+	{ 72715, 3, 1 },
+	{ 72721, 4, 1 },
+	{ 72728, 5, 1 },
+	{ 72735, 6, 1 },
+	{ 72742, 7, 1 },
+	{ 72749, 8, 1 },
+	{ 72756, 9, 1 },
+	{ 72763, 10, 1 },
+	{ 72770, 11, 1 },
+	{ 72777, 12, 2 },
+	{ 72784, 14, 1 },
+	{ 72792, 15, 1 },
+	{ 72831, 0, 1 },
+	{ 72837, 1, 1 },
+	{ 72843, 2, 1 },
+	{ 72849, 3, 1 },
+	{ 72855, 4, 1 },
+	{ 72893, 0, 4 },
+	{ 72900, 4, 12 },
+	{ 72933, 0, 4 },
+	{ 72939, 4, 12 },
+	{ 72973, 0, 8 },
+	{ 72981, 8, 8 },
+	{ 73016, 0, 4 },
+	{ 73021, 4, 1 },
+	{ 698, 0, 16 },
+	{ 698, 0, 3 },
+	{ 73095, 0, 2 },
+	{ 73130, 0, 1 },
+	{ 881, 1, 1 },
+	{ 73165, 0, 1 },
+	{ 73234, 0, 16 },
+	{ 925, 0, 8 },
+	{ 73305, 0, 16 },
+	{ 73339, 0, 4 },
+	{ 73347, 4, 4 },
+	{ 73356, 8, 5 },
+	{ 73370, 13, 1 },
+	{ 72104, 14, 1 },
+	{ 73383, 15, 1 },
+	{ 73418, 0, 4 },
+	{ 73423, 4, 10 },
+	{ 73432, 14, 1 },
+	{ 73441, 15, 1 },
+	{ 73478, 0, 16 },
+	{ 73793, 0, 2 },
+	{ 73802, 2, 2 },
+	{ 73815, 4, 2 },
+	{ 73858, 0, 10 },
+	{ 73865, 15, 1 },
+	{ 73902, 0, 1 },
+	{ 73914, 1, 1 },
+	{ 73926, 2, 1 },
+	{ 73938, 3, 1 },
+	{ 73950, 4, 1 },
+	{ 73962, 5, 1 },
+	{ 73974, 6, 1 },
+	{ 73986, 7, 1 },
+	{ 73998, 8, 1 },
+	{ 74012, 9, 1 },
+	{ 74026, 10, 1 },
+	{ 74040, 11, 1 },
+	{ 74054, 15, 1 },
+	{ 74096, 0, 3 },
+	{ 74105, 3, 1 },
+	{ 74114, 4, 3 },
+	{ 74123, 7, 1 },
+	{ 74148, 0, 2 },
+	{ 74157, 4, 2 },
+	{ 655, 0, 3 },
+	{ 74188, 4, 3 },
+	{ 74249, 0, 16 },
+	{ 74280, 0, 8 },
+	{ 74355, 0, 16 },
+	{ 74386, 0, 8 },
+	{ 74461, 1, 1 },
+	{ 74470, 3, 1 },
+	{ 74477, 4, 1 },
+	{ 74484, 5, 1 },
+	{ 74491, 6, 1 },
+	{ 74501, 7, 1 },
+	{ 74528, 0, 8 },
+	{ 74538, 8, 8 },
+	{ 74565, 0, 1 },
+	{ 74568, 1, 1 },
+	{ 74571, 2, 2 },
+	{ 74578, 4, 1 },
+	{ 74581, 5, 2 },
+	{ 4628, 8, 1 },
+	{ 74584, 9, 1 },
+	{ 74589, 10, 1 },
+	{ 74592, 11, 1 },
+	{ 74599, 12, 1 },
+	{ 74602, 13, 1 },
+	{ 74605, 14, 1 },
+	{ 698, 15, 1 },
+	{ 74635, 0, 1 },
+	{ 56, 1, 1 },
+	{ 74638, 2, 1 },
+	{ 74641, 3, 1 },
+	{ 74644, 4, 1 },
+	{ 74648, 5, 1 },
+	{ 74652, 6, 1 },
+	{ 74657, 7, 1 },
+	{ 74664, 8, 3 },
+	{ 74668, 11, 1 },
+	{ 74672, 12, 3 },
+	{ 74686, 15, 1 },
+	{ 74727, 0, 14 },
+	{ 74732, 14, 2 },
+	{ 74777, 0, 1 },
+	{ 74783, 1, 1 },
+	{ 74788, 2, 1 },
+	{ 74792, 3, 1 },
+	{ 74805, 4, 3 },
+	{ 74820, 8, 1 },
+	{ 74827, 9, 5 },
+	{ 74832, 14, 2 },
+	{ 213, 0, 1 },
+	{ 74877, 1, 1 },
+	{ 74890, 2, 1 },
+	{ 74903, 3, 1 },
+	{ 74908, 4, 1 },
+	{ 74911, 5, 1 },
+	{ 74915, 6, 2 },
+	{ 74919, 8, 1 },
+	{ 74924, 9, 1 },
+	{ 74928, 10, 1 },
+	{ 74941, 11, 5 },
+	{ 74982, 0, 1 },
+	{ 74987, 1, 3 },
+	{ 75002, 4, 1 },
+	{ 75016, 5, 1 },
+	{ 75030, 6, 9 },
+	{ 75045, 15, 1 },
+	{ 75074, 0, 4 },
+	{ 75078, 4, 4 },
+	{ 75091, 8, 1 },
+	{ 75095, 9, 7 },
+	{ 75095, 0, 16 },
+	{ 75167, 0, 16 },
+	{ 75191, 0, 1 },
+	{ 75195, 1, 1 },
+	{ 75200, 2, 1 },
+	{ 75205, 3, 1 },
+	{ 75212, 4, 1 },
+	{ 75219, 5, 2 },
+	{ 75224, 8, 1 },
+	{ 75231, 9, 1 },
+	{ 75245, 10, 1 },
+	{ 75251, 11, 1 },
+	{ 75258, 12, 2 },
+	{ 75264, 15, 1 },
+	{ 75293, 0, 1 },
+	{ 75301, 1, 1 },
+	{ 75305, 2, 2 },
+	{ 75318, 4, 3 },
+	{ 75322, 7, 1 },
+	{ 75327, 8, 8 },
+	{ 4139, 0, 16 },
+	{ 75397, 0, 1 },
+	{ 75401, 1, 1 },
+	{ 75404, 2, 6 },
+	{ 75417, 8, 1 },
+	{ 75095, 9, 7 },
+	{ 75481, 0, 1 },
+	{ 75499, 1, 1 },
+	{ 75518, 2, 1 },
+	{ 75536, 3, 1 },
+	{ 75542, 4, 1 },
+	{ 75557, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 75576, 8, 1 },
+	{ 75582, 9, 1 },
+	{ 75590, 10, 1 },
+	{ 75598, 11, 1 },
+	{ 75617, 12, 1 },
+	{ 75622, 13, 1 },
+	{ 75630, 14, 1 },
+	{ 75638, 15, 1 },
+	{ 75682, 1, 1 },
+	{ 75697, 2, 1 },
+	{ 75713, 3, 1 },
+	{ 75728, 4, 1 },
+	{ 75743, 5, 11 },
+	{ 75787, 0, 1 },
+	{ 75805, 1, 1 },
+	{ 75824, 2, 1 },
+	{ 75842, 3, 1 },
+	{ 75848, 4, 1 },
+	{ 75863, 5, 1 },
+	{ 75869, 6, 6 },
+	{ 75883, 12, 1 },
+	{ 75888, 13, 1 },
+	{ 75896, 14, 1 },
+	{ 75933, 1, 1 },
+	{ 75948, 2, 1 },
+	{ 75964, 3, 13 },
+	{ 76008, 0, 1 },
+	{ 76012, 1, 1 },
+	{ 76027, 2, 1 },
+	{ 76042, 3, 1 },
+	{ 76057, 4, 1 },
+	{ 76071, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 76086, 8, 1 },
+	{ 75095, 9, 7 },
+	{ 76140, 0, 1 },
+	{ 76147, 1, 1 },
+	{ 76154, 2, 1 },
+	{ 76161, 3, 1 },
+	{ 75078, 4, 4 },
+	{ 76168, 8, 1 },
+	{ 76175, 9, 1 },
+	{ 76182, 10, 6 },
+	{ 76228, 0, 1 },
+	{ 76234, 1, 1 },
+	{ 76238, 2, 1 },
+	{ 76253, 3, 1 },
+	{ 76260, 4, 1 },
+	{ 76267, 5, 1 },
+	{ 76275, 6, 10 },
+	{ 76321, 0, 16 },
+	{ 76356, 0, 10 },
+	{ 76360, 10, 6 },
+	{ 76406, 0, 3 },
+	{ 76419, 3, 13 },
+	{ 76419, 0, 4 },
+	{ 76453, 4, 12 },
+	{ 76496, 0, 12 },
+	{ 76509, 12, 4 },
+	{ 76509, 0, 16 },
+	{ 76580, 0, 8 },
+	{ 76588, 8, 8 },
+	{ 76616, 0, 16 },
+	{ 76651, 0, 1 },
+	{ 76658, 1, 2 },
+	{ 76667, 3, 13 },
+	{ 76699, 0, 1 },
+	{ 76706, 1, 2 },
+	{ 75964, 3, 13 },
+	{ 76731, 0, 1 },
+	{ 76738, 1, 1 },
+	{ 76746, 2, 1 },
+	{ 76752, 3, 1 },
+	{ 76759, 4, 1 },
+	{ 76766, 5, 1 },
+	{ 76773, 6, 1 },
+	{ 76780, 7, 1 },
+	{ 76787, 8, 1 },
+	{ 76794, 9, 1 },
+	{ 76804, 10, 2 },
+	{ 76819, 12, 1 },
+	{ 76825, 13, 1 },
+	{ 76832, 14, 1 },
+	{ 76865, 0, 1 },
+	{ 76874, 2, 5 },
+	{ 76887, 7, 1 },
+	{ 76899, 8, 1 },
+	{ 76911, 9, 2 },
+	{ 76920, 11, 1 },
+	{ 76930, 12, 3 },
+	{ 76964, 0, 5 },
+	{ 76975, 5, 1 },
+	{ 76981, 6, 5 },
+	{ 76992, 11, 1 },
+	{ 76998, 12, 1 },
+	{ 77004, 13, 1 },
+	{ 77014, 14, 2 },
+	{ 77045, 0, 1 },
+	{ 77051, 1, 1 },
+	{ 77057, 2, 1 },
+	{ 77063, 3, 1 },
+	{ 77071, 4, 1 },
+	{ 77077, 5, 1 },
+	{ 77084, 7, 1 },
+	{ 77091, 8, 2 },
+	{ 77101, 11, 4 },
+	{ 77134, 0, 4 },
+	{ 77141, 4, 2 },
+	{ 77154, 6, 4 },
+	{ 76804, 10, 2 },
+	{ 77161, 12, 4 },
+	{ 77193, 0, 2 },
+	{ 77208, 2, 4 },
+	{ 77216, 6, 2 },
+	{ 77231, 8, 3 },
+	{ 77241, 12, 3 },
+	{ 77276, 0, 3 },
+	{ 77281, 4, 1 },
+	{ 77289, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 77295, 8, 1 },
+	{ 77303, 9, 1 },
+	{ 76182, 10, 6 },
+	{ 77335, 0, 1 },
+	{ 77342, 1, 3 },
+	{ 77349, 4, 2 },
+	{ 77356, 7, 2 },
+	{ 77364, 10, 1 },
+	{ 77371, 11, 1 },
+	{ 77378, 12, 4 },
+	{ 77417, 0, 1 },
+	{ 77422, 1, 7 },
+	{ 77435, 8, 1 },
+	{ 75095, 9, 7 },
+	{ 4515, 0, 16 },
+	{ 77523, 0, 1 },
+	{ 77536, 1, 14 },
+	{ 77550, 15, 1 },
+	{ 77629, 0, 1 },
+	{ 77636, 1, 1 },
+	{ 77646, 2, 1 },
+	{ 77654, 3, 1 },
+	{ 77663, 4, 1 },
+	{ 77671, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 77682, 8, 1 },
+	{ 75095, 9, 7 },
+	{ 77728, 0, 1 },
+	{ 77738, 1, 1 },
+	{ 77757, 2, 1 },
+	{ 77775, 3, 1 },
+	{ 77793, 4, 1 },
+	{ 77811, 5, 1 },
+	{ 77822, 6, 1 },
+	{ 77843, 7, 1 },
+	{ 77862, 8, 1 },
+	{ 77882, 9, 1 },
+	{ 77894, 10, 1 },
+	{ 77906, 11, 1 },
+	{ 77928, 12, 1 },
+	{ 77954, 13, 1 },
+	{ 77981, 14, 1 },
+	{ 78008, 15, 1 },
+	{ 78061, 0, 1 },
+	{ 78089, 1, 1 },
+	{ 78107, 2, 1 },
+	{ 78127, 3, 1 },
+	{ 78148, 4, 1 },
+	{ 78167, 5, 1 },
+	{ 78185, 6, 1 },
+	{ 78206, 7, 1 },
+	{ 78225, 8, 1 },
+	{ 78246, 9, 1 },
+	{ 78265, 10, 1 },
+	{ 78276, 11, 1 },
+	{ 77378, 12, 4 },
+	{ 78312, 0, 1 },
+	{ 78331, 1, 1 },
+	{ 78341, 2, 1 },
+	{ 78359, 3, 1 },
+	{ 78377, 4, 1 },
+	{ 78399, 5, 1 },
+	{ 78425, 6, 1 },
+	{ 78452, 7, 1 },
+	{ 78479, 8, 1 },
+	{ 78507, 9, 1 },
+	{ 78535, 10, 1 },
+	{ 78554, 11, 1 },
+	{ 78573, 12, 1 },
+	{ 78592, 13, 1 },
+	{ 78605, 14, 1 },
+	{ 78625, 15, 1 },
+	{ 78670, 0, 1 },
+	{ 78688, 1, 1 },
+	{ 78709, 2, 1 },
+	{ 78729, 3, 1 },
+	{ 78749, 4, 1 },
+	{ 78767, 5, 1 },
+	{ 78776, 6, 1 },
+	{ 78796, 7, 1 },
+	{ 78815, 8, 1 },
+	{ 78835, 9, 1 },
+	{ 78847, 10, 1 },
+	{ 78858, 11, 1 },
+	{ 77378, 12, 4 },
+	{ 78894, 0, 1 },
+	{ 78904, 1, 1 },
+	{ 78923, 2, 1 },
+	{ 78941, 3, 1 },
+	{ 78959, 4, 1 },
+	{ 78977, 5, 1 },
+	{ 78988, 6, 1 },
+	{ 79009, 7, 1 },
+	{ 79028, 8, 1 },
+	{ 79048, 9, 1 },
+	{ 79060, 10, 1 },
+	{ 79072, 11, 1 },
+	{ 79094, 12, 1 },
+	{ 79120, 13, 1 },
+	{ 79147, 14, 1 },
+	{ 79174, 15, 1 },
+	{ 79232, 0, 1 },
+	{ 79260, 1, 1 },
+	{ 79278, 2, 1 },
+	{ 79298, 3, 1 },
+	{ 79319, 4, 1 },
+	{ 79338, 5, 1 },
+	{ 79356, 6, 1 },
+	{ 79377, 7, 1 },
+	{ 79396, 8, 1 },
+	{ 79417, 9, 1 },
+	{ 79436, 10, 1 },
+	{ 79447, 11, 1 },
+	{ 77378, 12, 4 },
+	{ 79488, 0, 1 },
+	{ 79507, 1, 1 },
+	{ 79517, 2, 1 },
+	{ 79535, 3, 1 },
+	{ 79553, 4, 1 },
+	{ 79575, 5, 1 },
+	{ 79601, 6, 1 },
+	{ 79628, 7, 1 },
+	{ 79655, 8, 1 },
+	{ 79683, 9, 1 },
+	{ 79711, 10, 1 },
+	{ 79730, 11, 1 },
+	{ 79749, 12, 1 },
+	{ 79768, 13, 1 },
+	{ 79781, 14, 1 },
+	{ 79801, 15, 1 },
+	{ 79851, 0, 1 },
+	{ 79869, 1, 1 },
+	{ 79890, 2, 1 },
+	{ 79910, 3, 1 },
+	{ 79930, 4, 1 },
+	{ 79948, 5, 1 },
+	{ 79957, 6, 1 },
+	{ 79977, 7, 1 },
+	{ 79996, 8, 1 },
+	{ 80016, 9, 1 },
+	{ 80028, 10, 1 },
+	{ 80039, 11, 1 },
+	{ 77378, 12, 4 },
+	{ 80080, 0, 16 },
+	{ 80154, 0, 16 },
+	{ 80234, 0, 16 },
+	{ 80299, 0, 16 },
+	{ 80367, 0, 16 },
+	{ 80443, 0, 16 },
+	{ 80510, 0, 16 },
+	{ 80589, 0, 16 },
+	{ 80665, 0, 16 },
+	{ 80724, 0, 16 },
+	{ 80783, 0, 16 },
+	{ 80842, 0, 16 },
+	{ 80901, 0, 1 },
+	{ 80907, 1, 1 },
+	{ 80916, 2, 1 },
+	{ 80923, 3, 1 },
+	{ 80930, 4, 1 },
+	{ 80946, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 80955, 8, 1 },
+	{ 80963, 9, 1 },
+	{ 80973, 10, 1 },
+	{ 80983, 11, 1 },
+	{ 80991, 12, 1 },
+	{ 81001, 13, 1 },
+	{ 81011, 14, 1 },
+	{ 81021, 15, 1 },
+	{ 81061, 0, 2 },
+	{ 81072, 2, 1 },
+	{ 81084, 3, 1 },
+	{ 81088, 4, 1 },
+	{ 81102, 5, 3 },
+	{ 81117, 8, 1 },
+	{ 81126, 9, 3 },
+	{ 81141, 12, 1 },
+	{ 81153, 13, 3 },
+	{ 81198, 0, 8 },
+	{ 81211, 8, 8 },
+	{ 81251, 0, 8 },
+	{ 81257, 8, 8 },
+	{ 81305, 0, 16 },
+	{ 81373, 0, 16 },
+	{ 81373, 0, 15 },
+	{ 81373, 0, 15 },
+	{ 81571, 15, 1 },
+	{ 81621, 0, 16 },
+	{ 81684, 0, 16 },
+	{ 81778, 0, 1 },
+	{ 81785, 1, 1 },
+	{ 81794, 2, 1 },
+	{ 81804, 3, 1 },
+	{ 81815, 4, 1 },
+	{ 81824, 5, 1 },
+	{ 81835, 6, 1 },
+	{ 81844, 7, 1 },
+	{ 81855, 8, 1 },
+	{ 81864, 9, 1 },
+	{ 81875, 10, 5 },
+	{ 81890, 15, 1 },
+	{ 81927, 0, 4 },
+	{ 81934, 4, 4 },
+	{ 81949, 8, 1 },
+	{ 81956, 9, 5 },
+	{ 74832, 14, 2 },
+	{ 81991, 0, 16 },
+	{ 81991, 0, 15 },
+	{ 82043, 15, 1 },
+	{ 82096, 0, 16 },
+	{ 82184, 0, 1 },
+	{ 82190, 1, 3 },
+	{ 82203, 4, 1 },
+	{ 82210, 5, 1 },
+	{ 82217, 6, 1 },
+	{ 82224, 7, 1 },
+	{ 82231, 8, 8 },
+	{ 82231, 0, 16 },
+	{ 82305, 0, 16 },
+	{ 82305, 0, 15 },
+	{ 82401, 0, 16 },
+	{ 82489, 0, 16 },
+	{ 82576, 0, 16 },
+	{ 82661, 0, 16 },
+	{ 82758, 0, 16 },
+	{ 81198, 0, 8 },
+	{ 82853, 8, 8 },
+	{ 81198, 0, 8 },
+	{ 82953, 8, 8 },
+	{ 83051, 0, 4 },
+	{ 83066, 4, 1 },
+	{ 83073, 5, 2 },
+	{ 83085, 8, 3 },
+	{ 83102, 11, 2 },
+	{ 83117, 13, 2 },
+	{ 83162, 0, 3 },
+	{ 83179, 3, 2 },
+	{ 83194, 5, 2 },
+	{ 83215, 8, 3 },
+	{ 83232, 11, 2 },
+	{ 83247, 13, 2 },
+	{ 83292, 0, 16 },
+	{ 83373, 0, 16 },
+	{ 83373, 0, 15 },
+	{ 83420, 15, 1 },
+	{ 83471, 0, 16 },
+	{ 83531, 0, 16 },
+	{ 76998, 0, 1 },
+	{ 83587, 1, 1 },
+	{ 83595, 2, 1 },
+	{ 83604, 4, 1 },
+	{ 83614, 5, 1 },
+	{ 83625, 6, 1 },
+	{ 83632, 7, 1 },
+	{ 83639, 8, 8 },
+	{ 83690, 0, 16 },
+	{ 83763, 0, 16 },
+	{ 83836, 0, 16 },
+	{ 83909, 0, 8 },
+	{ 83913, 8, 3 },
+	{ 83921, 11, 5 },
+	{ 83921, 0, 8 },
+	{ 83969, 8, 8 },
+	{ 75481, 0, 1 },
+	{ 75499, 1, 1 },
+	{ 75518, 2, 1 },
+	{ 75536, 3, 1 },
+	{ 75542, 4, 1 },
+	{ 75557, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 84379, 8, 1 },
+	{ 84394, 9, 1 },
+	{ 84411, 10, 1 },
+	{ 75598, 11, 1 },
+	{ 75617, 12, 1 },
+	{ 75622, 13, 1 },
+	{ 75630, 14, 1 },
+	{ 75638, 15, 1 },
+	{ 80901, 0, 1 },
+	{ 80907, 1, 1 },
+	{ 80916, 2, 1 },
+	{ 80923, 3, 1 },
+	{ 85248, 4, 1 },
+	{ 80946, 5, 1 },
+	{ 75563, 6, 2 },
+	{ 80955, 8, 1 },
+	{ 80963, 9, 1 },
+	{ 80973, 10, 1 },
+	{ 80983, 11, 1 },
+	{ 80991, 12, 1 },
+	{ 81001, 13, 1 },
+	{ 81011, 14, 1 },
+	{ 81021, 15, 1 },
+	{ 81198, 0, 8 },
+	{ 85315, 8, 8 },
+	{ 81778, 0, 1 },
+	{ 81785, 1, 1 },
+	{ 85755, 2, 1 },
+	{ 81804, 3, 1 },
+	{ 81815, 4, 1 },
+	{ 81824, 5, 1 },
+	{ 81835, 6, 1 },
+	{ 81844, 7, 1 },
+	{ 81855, 8, 1 },
+	{ 81864, 9, 1 },
+	{ 81875, 10, 5 },
+	{ 85774, 15, 1 },
+	{ 85820, 0, 4 },
+	{ 81934, 4, 4 },
+	{ 85836, 8, 1 },
+	{ 85852, 9, 5 },
+	{ 74832, 14, 2 },
+	{ 83051, 0, 4 },
+	{ 86078, 4, 1 },
+	{ 86094, 5, 2 },
+	{ 83085, 8, 3 },
+	{ 83102, 11, 2 },
+	{ 83117, 13, 2 },
+	{ 86319, 0, 1 },
+	{ 86328, 1, 1 },
+	{ 86338, 2, 1 },
+	{ 86350, 3, 1 },
+	{ 86362, 4, 1 },
+	{ 86373, 5, 1 },
+	{ 86381, 6, 1 },
+	{ 86389, 7, 1 },
+	{ 86398, 8, 1 },
+	{ 86409, 9, 1 },
+	{ 86417, 10, 1 },
+	{ 38, 11, 1 },
+	{ 86428, 12, 1 },
+	{ 86439, 13, 1 },
+	{ 86450, 14, 1 },
+	{ 86461, 15, 1 },
+	{ 86483, 0, 2 },
+	{ 86496, 2, 1 },
+	{ 86505, 3, 1 },
+	{ 86519, 4, 1 },
+	{ 86531, 5, 1 },
+	{ 86560, 0, 2 },
+	{ 86574, 2, 1 },
+	{ 86584, 3, 1 },
+	{ 86599, 4, 1 },
+	{ 86612, 5, 1 },
+	{ 86626, 6, 1 },
+	{ 86650, 0, 16 },
+	{ 86699, 0, 16 },
+	{ 87051, 0, 1 },
+	{ 87060, 1, 1 },
+	{ 87086, 0, 1 },
+	{ 87094, 1, 1 },
+	{ 87104, 2, 1 },
+	{ 87113, 4, 1 },
+	{ 87124, 5, 1 },
+	{ 87135, 6, 1 },
+	{ 87148, 7, 1 },
+	{ 87161, 8, 1 },
+	{ 87170, 9, 1 },
+	{ 87193, 0, 5 },
+	{ 87205, 6, 1 },
+	{ 87212, 7, 1 },
+	{ 87219, 8, 5 },
+	{ 87231, 14, 1 },
+	{ 87238, 15, 1 },
+	{ 87265, 0, 14 },
+	{ 87276, 14, 2 },
+	{ 87304, 0, 16 },
+	{ 87323, 0, 16 },
+	{ 87430, 0, 16 },
+	{ 87462, 0, 16 },
+	{ 87598, 0, 16 },
+	{ 87861, 0, 16 },
+	{ 87949, 0, 16 },
+	{ 88168, 0, 1 },
+	{ 88175, 1, 1 },
+	{ 88189, 2, 1 },
+	{ 88203, 4, 1 },
+	{ 88210, 5, 1 },
+	{ 88224, 6, 1 },
+	{ 88238, 8, 1 },
+	{ 88248, 9, 1 },
+	{ 88257, 10, 1 },
+	{ 88267, 11, 1 },
+	{ 88276, 12, 1 },
+	{ 88289, 13, 1 },
+	{ 881, 4, 12 },
+	{ 88351, 4, 12 },
+	{ 88385, 4, 12 },
+	{ 88410, 4, 12 },
+	{ 88435, 4, 12 },
+	{ 88460, 4, 12 },
+	{ 88485, 4, 12 },
+	{ 88573, 4, 12 },
+	{ 74638, 0, 4 },
+	{ 88817, 4, 1 },
+	{ 88821, 5, 1 },
+	{ 88825, 6, 1 },
+	{ 88828, 7, 1 },
+	{ 89494, 0, 16 },
+	{ 89525, 0, 16 },
+	{ 89569, 0, 1 },
+	{ 89573, 1, 1 },
+	{ 89589, 0, 16 },
+	{ 89608, 0, 16 },
+	{ 89627, 0, 16 },
+	{ 89646, 0, 16 },
+	{ 89665, 0, 16 },
+	{ 89665, 0, 3 },
+	{ 90251, 0, 4 },
+	{ 90291, 0, 3 },
+	{ 90403, 0, 1 },
+	{ 90408, 1, 1 },
+	{ 90413, 2, 1 },
+	{ 90418, 3, 1 },
+	{ 90423, 4, 1 },
+	{ 90428, 5, 1 },
+	{ 90433, 6, 1 },
+	{ 90438, 7, 1 },
+	{ 90443, 8, 1 },
+	{ 90448, 9, 1 },
+	{ 90453, 10, 1 },
+	{ 90459, 11, 1 },
+	{ 90465, 12, 1 },
+	{ 90506, 4, 1 },
+	{ 878, 5, 1 },
+	{ 90514, 6, 1 },
+	{ 90523, 8, 4 },
+	{ 90532, 12, 4 },
+	{ 90578, 0, 3 },
+	{ 90585, 3, 1 },
+	{ 90593, 4, 4 },
+	{ 90602, 8, 6 },
+	{ 878, 0, 1 },
+	{ 90644, 1, 1 },
+	{ 90649, 2, 1 },
+	{ 73234, 4, 5 },
+	{ 38, 15, 1 },
+	{ 878, 0, 1 },
+	{ 90730, 1, 1 },
+	{ 90736, 4, 4 },
+	{ 90741, 8, 1 },
+	{ 90748, 9, 1 },
+	{ 90783, 0, 16 },
+	{ 90813, 0, 8 },
+	{ 90847, 0, 8 },
+	{ 90855, 8, 8 },
+	{ 35, 0, 1 },
+	{ 90925, 2, 4 },
+	{ 90932, 6, 1 },
+	{ 90936, 7, 4 },
+	{ 90950, 11, 1 },
+	{ 90954, 13, 1 },
+	{ 38, 15, 1 },
+	{ 90977, 1, 1 },
+	{ 90982, 2, 1 },
+	{ 90986, 3, 4 },
+	{ 90999, 7, 1 },
+	{ 75327, 8, 8 },
+	{ 91023, 0, 16 },
+	{ 91061, 0, 4 },
+	{ 91076, 4, 6 },
+	{ 91092, 10, 6 },
+	{ 91131, 0, 1 },
+	{ 82190, 1, 3 },
+	{ 91135, 4, 1 },
+	{ 91138, 5, 11 },
+	{ 91172, 0, 1 },
+	{ 91178, 1, 1 },
+	{ 1264, 2, 1 },
+	{ 1268, 3, 1 },
+	{ 3877, 4, 1 },
+	{ 3883, 5, 1 },
+	{ 1286, 6, 1 },
+	{ 91186, 7, 1 },
+	{ 75327, 8, 8 },
+	{ 91210, 0, 14 },
+	{ 91224, 14, 1 },
+	{ 91229, 15, 1 },
+	{ 91255, 0, 6 },
+	{ 91264, 6, 10 },
+	{ 91296, 0, 1 },
+	{ 91305, 1, 1 },
+	{ 91312, 2, 1 },
+	{ 91319, 3, 1 },
+	{ 91326, 4, 1 },
+	{ 91334, 5, 1 },
+	{ 91341, 6, 1 },
+	{ 91348, 7, 1 },
+	{ 91355, 8, 1 },
+	{ 91362, 9, 1 },
+	{ 67, 10, 1 },
+	{ 91370, 11, 1 },
+	{ 91373, 12, 1 },
+	{ 91378, 13, 1 },
+	{ 91383, 14, 2 },
+	{ 91406, 0, 1 },
+	{ 91410, 1, 1 },
+	{ 91423, 2, 3 },
+	{ 91138, 5, 11 },
+	{ 91457, 0, 1 },
+	{ 91464, 1, 1 },
+	{ 91477, 2, 3 },
+	{ 91138, 5, 11 },
+	{ 91515, 0, 1 },
+	{ 91526, 1, 1 },
+	{ 91537, 2, 1 },
+	{ 91546, 3, 1 },
+	{ 91556, 4, 1 },
+	{ 91566, 5, 1 },
+	{ 91574, 6, 1 },
+	{ 91587, 7, 1 },
+	{ 91599, 8, 1 },
+	{ 91610, 9, 7 },
+	{ 91644, 0, 16 },
+	{ 91678, 0, 4 },
+	{ 91693, 4, 6 },
+	{ 91709, 10, 6 },
+	{ 91744, 0, 1 },
+	{ 91755, 1, 1 },
+	{ 91763, 2, 1 },
+	{ 91775, 3, 1 },
+	{ 91784, 4, 12 },
+	{ 91827, 0, 1 },
+	{ 91833, 1, 1 },
+	{ 91839, 2, 14 },
+	{ 91876, 0, 1 },
+	{ 91884, 1, 1 },
+	{ 91892, 2, 1 },
+	{ 91902, 3, 1 },
+	{ 91784, 4, 12 },
+	{ 91933, 0, 2 },
+	{ 91947, 2, 2 },
+	{ 91960, 4, 2 },
+	{ 75869, 6, 6 },
+	{ 91973, 12, 1 },
+	{ 91981, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 92008, 0, 2 },
+	{ 92021, 2, 2 },
+	{ 92033, 4, 2 },
+	{ 92045, 6, 9 },
+	{ 92059, 15, 1 },
+	{ 92089, 0, 2 },
+	{ 92100, 2, 2 },
+	{ 92110, 4, 2 },
+	{ 75869, 6, 6 },
+	{ 5385, 12, 1 },
+	{ 91981, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 92142, 0, 2 },
+	{ 92152, 2, 2 },
+	{ 92161, 4, 2 },
+	{ 92045, 6, 9 },
+	{ 92170, 15, 1 },
+	{ 92197, 0, 1 },
+	{ 92201, 1, 15 },
+	{ 92235, 0, 1 },
+	{ 77422, 1, 7 },
+	{ 92238, 8, 1 },
+	{ 92246, 10, 1 },
+	{ 92251, 11, 1 },
+	{ 92256, 12, 1 },
+	{ 92260, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 92283, 0, 1 },
+	{ 92291, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 92340, 0, 1 },
+	{ 92347, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 92382, 0, 16 },
+	{ 92423, 0, 16 },
+	{ 92464, 0, 16 },
+	{ 92507, 0, 16 },
+	{ 92550, 0, 1 },
+	{ 92565, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 92610, 0, 16 },
+	{ 92666, 0, 16 },
+	{ 92722, 0, 16 },
+	{ 92778, 0, 16 },
+	{ 92834, 0, 16 },
+	{ 92890, 0, 16 },
+	{ 92946, 0, 16 },
+	{ 93002, 0, 16 },
+	{ 93058, 0, 1 },
+	{ 93068, 1, 1 },
+	{ 75305, 2, 2 },
+	{ 93078, 4, 1 },
+	{ 93089, 5, 3 },
+	{ 93102, 8, 3 },
+	{ 93116, 11, 1 },
+	{ 93122, 12, 3 },
+	{ 93137, 15, 1 },
+	{ 93166, 0, 1 },
+	{ 93179, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 93217, 0, 16 },
+	{ 93258, 0, 16 },
+	{ 93299, 0, 16 },
+	{ 93342, 0, 16 },
+	{ 93381, 0, 16 },
+	{ 92089, 0, 2 },
+	{ 92100, 2, 2 },
+	{ 92110, 4, 2 },
+	{ 5385, 6, 1 },
+	{ 91981, 7, 1 },
+	{ 93424, 8, 1 },
+	{ 93431, 9, 6 },
+	{ 93445, 15, 1 },
+	{ 93482, 0, 2 },
+	{ 92152, 2, 2 },
+	{ 92161, 4, 2 },
+	{ 92045, 6, 9 },
+	{ 93492, 15, 1 },
+	{ 92089, 0, 2 },
+	{ 92100, 2, 2 },
+	{ 92110, 4, 2 },
+	{ 75869, 6, 6 },
+	{ 93533, 12, 1 },
+	{ 93542, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 93583, 0, 2 },
+	{ 93592, 2, 2 },
+	{ 93600, 4, 2 },
+	{ 75563, 6, 2 },
+	{ 93608, 8, 1 },
+	{ 93618, 9, 1 },
+	{ 93627, 10, 1 },
+	{ 74941, 11, 5 },
+	{ 92089, 0, 2 },
+	{ 92100, 2, 2 },
+	{ 92110, 4, 2 },
+	{ 75563, 6, 2 },
+	{ 93662, 8, 1 },
+	{ 93677, 9, 1 },
+	{ 93691, 10, 1 },
+	{ 74941, 11, 5 },
+	{ 93731, 1, 1 },
+	{ 93741, 2, 3 },
+	{ 91138, 5, 11 },
+	{ 93772, 0, 4 },
+	{ 93785, 4, 1 },
+	{ 93795, 5, 3 },
+	{ 93807, 8, 1 },
+	{ 93822, 9, 3 },
+	{ 93839, 12, 1 },
+	{ 93850, 13, 3 },
+	{ 93886, 0, 1 },
+	{ 93897, 1, 3 },
+	{ 93910, 4, 1 },
+	{ 93919, 5, 3 },
+	{ 93930, 8, 1 },
+	{ 93939, 9, 3 },
+	{ 93950, 12, 1 },
+	{ 93961, 13, 3 },
+	{ 94021, 0, 1 },
+	{ 94034, 1, 3 },
+	{ 94049, 4, 1 },
+	{ 94061, 5, 3 },
+	{ 94075, 8, 3 },
+	{ 94086, 12, 1 },
+	{ 94099, 13, 3 },
+	{ 94161, 0, 1 },
+	{ 94170, 1, 3 },
+	{ 94181, 4, 1 },
+	{ 94190, 5, 3 },
+	{ 94201, 8, 2 },
+	{ 94211, 10, 2 },
+	{ 94221, 12, 2 },
+	{ 94231, 14, 2 },
+	{ 94284, 0, 4 },
+	{ 94295, 4, 4 },
+	{ 94306, 8, 4 },
+	{ 94317, 12, 4 },
+	{ 94377, 0, 3 },
+	{ 94386, 4, 3 },
+	{ 94395, 8, 3 },
+	{ 94404, 12, 3 },
+	{ 94461, 0, 2 },
+	{ 94472, 2, 2 },
+	{ 94483, 4, 2 },
+	{ 94494, 6, 2 },
+	{ 94505, 8, 1 },
+	{ 94518, 9, 3 },
+	{ 94533, 12, 4 },
+	{ 94603, 0, 6 },
+	{ 75563, 6, 2 },
+	{ 94613, 8, 6 },
+	{ 74732, 14, 2 },
+	{ 94671, 0, 6 },
+	{ 94682, 6, 1 },
+	{ 94697, 7, 1 },
+	{ 94712, 8, 1 },
+	{ 91610, 9, 7 },
+	{ 94768, 0, 4 },
+	{ 94780, 4, 4 },
+	{ 94793, 8, 6 },
+	{ 74732, 14, 2 },
+	{ 94854, 0, 6 },
+	{ 75563, 6, 2 },
+	{ 94869, 8, 6 },
+	{ 74732, 14, 2 },
+	{ 94925, 0, 6 },
+	{ 75563, 6, 2 },
+	{ 94934, 8, 8 },
+	{ 94994, 0, 6 },
+	{ 91264, 6, 10 },
+	{ 95053, 0, 1 },
+	{ 95062, 1, 3 },
+	{ 95073, 4, 1 },
+	{ 95086, 5, 3 },
+	{ 75327, 8, 8 },
+	{ 95143, 0, 1 },
+	{ 95156, 1, 3 },
+	{ 95171, 4, 1 },
+	{ 95185, 5, 3 },
+	{ 95201, 8, 1 },
+	{ 95212, 9, 3 },
+	{ 95225, 12, 1 },
+	{ 95237, 13, 3 },
+	{ 95298, 0, 1 },
+	{ 95307, 1, 3 },
+	{ 95318, 4, 1 },
+	{ 95327, 5, 3 },
+	{ 95338, 8, 1 },
+	{ 95353, 9, 3 },
+	{ 95370, 12, 1 },
+	{ 95390, 13, 3 },
+	{ 95459, 0, 1 },
+	{ 95468, 1, 3 },
+	{ 95479, 4, 1 },
+	{ 95488, 5, 3 },
+	{ 95499, 8, 2 },
+	{ 95509, 10, 2 },
+	{ 95519, 12, 2 },
+	{ 95529, 14, 2 },
+	{ 95582, 0, 3 },
+	{ 95595, 3, 3 },
+	{ 95608, 6, 3 },
+	{ 95621, 9, 3 },
+	{ 95634, 12, 1 },
+	{ 95648, 13, 3 },
+	{ 95707, 0, 2 },
+	{ 95716, 4, 2 },
+	{ 95725, 8, 2 },
+	{ 95734, 12, 2 },
+	{ 95791, 0, 2 },
+	{ 95802, 2, 2 },
+	{ 95813, 4, 2 },
+	{ 95824, 6, 2 },
+	{ 95835, 8, 1 },
+	{ 95848, 9, 3 },
+	{ 95863, 12, 1 },
+	{ 94533, 13, 3 },
+	{ 95931, 0, 1 },
+	{ 95946, 1, 3 },
+	{ 95963, 4, 1 },
+	{ 95976, 5, 3 },
+	{ 95991, 8, 1 },
+	{ 96006, 9, 3 },
+	{ 94533, 12, 4 },
+	{ 96070, 0, 3 },
+	{ 96085, 4, 3 },
+	{ 96100, 8, 3 },
+	{ 96115, 12, 3 },
+	{ 96178, 0, 5 },
+	{ 96191, 5, 3 },
+	{ 96203, 8, 4 },
+	{ 96215, 12, 4 },
+	{ 96266, 0, 1 },
+	{ 96279, 1, 3 },
+	{ 96294, 4, 1 },
+	{ 96309, 5, 3 },
+	{ 96326, 8, 1 },
+	{ 96336, 9, 1 },
+	{ 96349, 10, 1 },
+	{ 96362, 11, 1 },
+	{ 96378, 12, 1 },
+	{ 96388, 13, 3 },
+	{ 96450, 0, 1 },
+	{ 96459, 1, 3 },
+	{ 96470, 4, 1 },
+	{ 96479, 5, 3 },
+	{ 75327, 8, 8 },
+	{ 96533, 0, 8 },
+	{ 96544, 8, 8 },
+	{ 96604, 0, 1 },
+	{ 96613, 1, 3 },
+	{ 96624, 4, 1 },
+	{ 96632, 5, 3 },
+	{ 96642, 8, 1 },
+	{ 96650, 9, 3 },
+	{ 94533, 12, 4 },
+	{ 96702, 0, 1 },
+	{ 96712, 1, 3 },
+	{ 96724, 4, 1 },
+	{ 96736, 5, 3 },
+	{ 75327, 8, 8 },
+	{ 96794, 0, 8 },
+	{ 96811, 8, 3 },
+	{ 96829, 12, 1 },
+	{ 96837, 13, 1 },
+	{ 96850, 14, 1 },
+	{ 96858, 15, 1 },
+	{ 96919, 0, 1 },
+	{ 96932, 1, 3 },
+	{ 96811, 4, 3 },
+	{ 96948, 7, 9 },
+	{ 97004, 0, 7 },
+	{ 97019, 7, 1 },
+	{ 97036, 8, 1 },
+	{ 97054, 9, 1 },
+	{ 97073, 10, 1 },
+	{ 97094, 11, 2 },
+	{ 97111, 13, 2 },
+	{ 97132, 15, 1 },
+	{ 97193, 0, 8 },
+	{ 97210, 8, 3 },
+	{ 96829, 12, 1 },
+	{ 96837, 13, 1 },
+	{ 96850, 14, 1 },
+	{ 97228, 15, 1 },
+	{ 97289, 0, 1 },
+	{ 97302, 1, 3 },
+	{ 97210, 4, 3 },
+	{ 97318, 7, 9 },
+	{ 97374, 0, 7 },
+	{ 97389, 7, 1 },
+	{ 97406, 8, 1 },
+	{ 97424, 9, 1 },
+	{ 97443, 11, 2 },
+	{ 97460, 13, 2 },
+	{ 97524, 0, 11 },
+	{ 74941, 11, 5 },
+	{ 97579, 0, 11 },
+	{ 74941, 11, 5 },
+	{ 97634, 0, 1 },
+	{ 97648, 1, 3 },
+	{ 97664, 4, 1 },
+	{ 97678, 5, 3 },
+	{ 97694, 8, 5 },
+	{ 97707, 13, 1 },
+	{ 97717, 14, 1 },
+	{ 97729, 15, 1 },
+	{ 97784, 0, 1 },
+	{ 97795, 1, 1 },
+	{ 97807, 2, 1 },
+	{ 97820, 3, 3 },
+	{ 97830, 6, 1 },
+	{ 97845, 7, 1 },
+	{ 97860, 8, 1 },
+	{ 97875, 9, 1 },
+	{ 97890, 10, 3 },
+	{ 97904, 13, 3 },
+	{ 97966, 0, 13 },
+	{ 96388, 13, 3 },
+	{ 98026, 0, 6 },
+	{ 98039, 8, 6 },
+	{ 74732, 14, 2 },
+	{ 98092, 0, 8 },
+	{ 98096, 8, 1 },
+	{ 98106, 9, 1 },
+	{ 98116, 10, 1 },
+	{ 98126, 11, 1 },
+	{ 98144, 12, 1 },
+	{ 96388, 13, 3 },
+	{ 98200, 0, 16 },
+	{ 98261, 0, 8 },
+	{ 75327, 8, 8 },
+	{ 98321, 0, 1 },
+	{ 98329, 1, 1 },
+	{ 98339, 2, 1 },
+	{ 76667, 3, 13 },
+	{ 98388, 0, 1 },
+	{ 98399, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 98434, 0, 16 },
+	{ 98498, 0, 2 },
+	{ 90925, 2, 4 },
+	{ 90932, 6, 1 },
+	{ 98511, 7, 2 },
+	{ 98524, 9, 1 },
+	{ 98534, 10, 1 },
+	{ 90950, 11, 1 },
+	{ 90954, 13, 1 },
+	{ 98540, 14, 1 },
+	{ 38, 15, 1 },
+	{ 90977, 1, 1 },
+	{ 90982, 2, 1 },
+	{ 98565, 3, 3 },
+	{ 81084, 6, 1 },
+	{ 90999, 7, 1 },
+	{ 98578, 8, 1 },
+	{ 98585, 9, 1 },
+	{ 98592, 10, 1 },
+	{ 98599, 11, 1 },
+	{ 94533, 12, 4 },
+	{ 98626, 0, 16 },
+	{ 98666, 0, 4 },
+	{ 98681, 4, 6 },
+	{ 98697, 10, 6 },
+	{ 91131, 0, 1 },
+	{ 92201, 1, 15 },
+	{ 3193, 0, 4 },
+	{ 91784, 4, 12 },
+	{ 98830, 0, 1 },
+	{ 98837, 1, 1 },
+	{ 98848, 2, 1 },
+	{ 98858, 3, 1 },
+	{ 98868, 4, 6 },
+	{ 67, 10, 1 },
+	{ 91370, 11, 1 },
+	{ 98881, 12, 2 },
+	{ 98896, 14, 2 },
+	{ 98919, 0, 1 },
+	{ 98929, 1, 1 },
+	{ 98939, 2, 1 },
+	{ 98950, 3, 1 },
+	{ 91784, 4, 12 },
+	{ 98978, 0, 16 },
+	{ 99015, 0, 4 },
+	{ 99030, 4, 6 },
+	{ 99046, 10, 6 },
+	{ 99084, 0, 1 },
+	{ 99087, 1, 1 },
+	{ 99097, 2, 1 },
+	{ 99107, 3, 1 },
+	{ 99112, 4, 1 },
+	{ 99118, 5, 1 },
+	{ 99125, 6, 1 },
+	{ 99131, 7, 9 },
+	{ 99168, 0, 1 },
+	{ 99179, 1, 1 },
+	{ 99187, 2, 1 },
+	{ 90986, 3, 4 },
+	{ 99196, 7, 1 },
+	{ 99208, 8, 1 },
+	{ 91610, 9, 7 },
+	{ 99241, 0, 16 },
+	{ 99274, 0, 4 },
+	{ 98868, 4, 6 },
+	{ 99278, 10, 1 },
+	{ 99282, 11, 1 },
+	{ 99286, 12, 1 },
+	{ 96388, 13, 3 },
+	{ 99309, 0, 2 },
+	{ 99312, 2, 1 },
+	{ 76667, 3, 13 },
+	{ 99337, 0, 1 },
+	{ 99347, 1, 1 },
+	{ 99358, 2, 1 },
+	{ 99368, 3, 1 },
+	{ 99377, 4, 8 },
+	{ 99391, 12, 1 },
+	{ 96388, 13, 3 },
+	{ 99418, 0, 8 },
+	{ 99426, 8, 6 },
+	{ 99434, 14, 1 },
+	{ 99443, 15, 1 },
+	{ 99473, 0, 16 },
+	{ 99501, 0, 16 },
+	{ 99529, 0, 16 },
+	{ 99557, 0, 10 },
+	{ 76182, 10, 6 },
+	{ 99585, 0, 16 },
+	{ 99613, 0, 16 },
+	{ 99641, 0, 16 },
+	{ 99669, 0, 10 },
+	{ 76182, 10, 6 },
+	{ 99697, 0, 1 },
+	{ 99704, 1, 1 },
+	{ 99711, 2, 1 },
+	{ 99718, 3, 1 },
+	{ 99725, 4, 1 },
+	{ 99736, 5, 1 },
+	{ 99747, 6, 1 },
+	{ 99131, 7, 9 },
+	{ 99780, 0, 16 },
+	{ 99816, 0, 1 },
+	{ 99831, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 99876, 0, 16 },
+	{ 99932, 0, 16 },
+	{ 99988, 0, 16 },
+	{ 100044, 0, 16 },
+	{ 100100, 0, 16 },
+	{ 100156, 0, 16 },
+	{ 100212, 0, 16 },
+	{ 100268, 0, 16 },
+	{ 100324, 0, 1 },
+	{ 93068, 1, 1 },
+	{ 100331, 2, 1 },
+	{ 100344, 3, 1 },
+	{ 93078, 4, 1 },
+	{ 93089, 5, 3 },
+	{ 5385, 8, 1 },
+	{ 100351, 9, 1 },
+	{ 100359, 10, 1 },
+	{ 93116, 11, 1 },
+	{ 100368, 12, 1 },
+	{ 100376, 13, 1 },
+	{ 100386, 14, 1 },
+	{ 93137, 15, 1 },
+	{ 100418, 0, 1 },
+	{ 100431, 1, 3 },
+	{ 100446, 4, 1 },
+	{ 100459, 5, 3 },
+	{ 100474, 9, 3 },
+	{ 100489, 13, 3 },
+	{ 100529, 0, 1 },
+	{ 82190, 1, 3 },
+	{ 100533, 4, 1 },
+	{ 100543, 5, 1 },
+	{ 100556, 6, 1 },
+	{ 100567, 7, 1 },
+	{ 75327, 8, 8 },
+	{ 100607, 0, 1 },
+	{ 100617, 1, 1 },
+	{ 92303, 2, 14 },
+	{ 100653, 0, 1 },
+	{ 100667, 1, 3 },
+	{ 100683, 4, 1 },
+	{ 100699, 5, 1 },
+	{ 100719, 6, 1 },
+	{ 100732, 7, 1 },
+	{ 100744, 8, 1 },
+	{ 100756, 9, 1 },
+	{ 76182, 10, 6 },
+	{ 100794, 0, 1 },
+	{ 100801, 1, 1 },
+	{ 100808, 2, 1 },
+	{ 100820, 3, 1 },
+	{ 100832, 4, 1 },
+	{ 100843, 5, 1 },
+	{ 100855, 6, 1 },
+	{ 100864, 7, 1 },
+	{ 100875, 8, 4 },
+	{ 100891, 12, 4 },
+	{ 100925, 0, 1 },
+	{ 100934, 1, 3 },
+	{ 100942, 4, 3 },
+	{ 100951, 7, 1 },
+	{ 100961, 8, 1 },
+	{ 100969, 9, 1 },
+	{ 100979, 10, 3 },
+	{ 100989, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 101028, 0, 6 },
+	{ 101036, 6, 2 },
+	{ 101044, 8, 5 },
+	{ 96388, 13, 3 },
+	{ 101079, 0, 8 },
+	{ 101088, 8, 6 },
+	{ 74732, 14, 2 },
+	{ 101123, 0, 15 },
+	{ 101155, 0, 1 },
+	{ 92201, 1, 15 },
+	{ 93731, 1, 1 },
+	{ 93741, 2, 3 },
+	{ 101189, 5, 1 },
+	{ 101201, 6, 1 },
+	{ 101212, 7, 1 },
+	{ 101224, 8, 1 },
+	{ 101234, 9, 1 },
+	{ 101247, 10, 3 },
+	{ 101257, 13, 3 },
+	{ 101290, 0, 8 },
+	{ 101294, 8, 8 },
+	{ 101325, 0, 8 },
+	{ 101333, 8, 8 },
+	{ 101362, 0, 9 },
+	{ 101375, 9, 1 },
+	{ 90950, 11, 1 },
+	{ 101384, 12, 1 },
+	{ 101390, 13, 1 },
+	{ 101401, 15, 1 },
+	{ 101424, 0, 1 },
+	{ 101434, 2, 1 },
+	{ 101440, 3, 1 },
+	{ 101447, 4, 1 },
+	{ 763, 5, 1 },
+	{ 213, 6, 1 },
+	{ 101453, 7, 1 },
+	{ 226, 9, 1 },
+	{ 76182, 10, 6 },
+	{ 101479, 0, 16 },
+	{ 101514, 0, 4 },
+	{ 101528, 4, 6 },
+	{ 101543, 10, 6 },
+	{ 101619, 0, 16 },
+	{ 101651, 0, 4 },
+	{ 101665, 4, 6 },
+	{ 101680, 10, 6 },
+	{ 101713, 0, 5 },
+	{ 925, 5, 7 },
+	{ 101723, 13, 1 },
+	{ 101736, 14, 1 },
+	{ 101747, 15, 1 },
+	{ 101773, 0, 16 },
+	{ 101800, 0, 16 },
+	{ 101827, 0, 5 },
+	{ 925, 5, 7 },
+	{ 101840, 13, 1 },
+	{ 101853, 14, 1 },
+	{ 101867, 15, 1 },
+	{ 253, 0, 11 },
+	{ 101937, 11, 1 },
+	{ 101940, 12, 1 },
+	{ 101952, 13, 1 },
+	{ 101962, 15, 1 },
+	{ 101991, 0, 16 },
+	{ 102016, 0, 16 },
+	{ 253, 0, 11 },
+	{ 101937, 11, 1 },
+	{ 102041, 12, 1 },
+	{ 102056, 13, 1 },
+	{ 102069, 14, 1 },
+	{ 102083, 15, 1 },
+	{ 102165, 0, 1 },
+	{ 102175, 1, 1 },
+	{ 102186, 2, 1 },
+	{ 102198, 3, 1 },
+	{ 102209, 4, 1 },
+	{ 102221, 5, 9 },
+	{ 102235, 14, 1 },
+	{ 102249, 15, 1 },
+	{ 99087, 1, 1 },
+	{ 99097, 2, 1 },
+	{ 99107, 3, 1 },
+	{ 99112, 4, 1 },
+	{ 99118, 5, 1 },
+	{ 99125, 6, 1 },
+	{ 99131, 7, 9 },
+	{ 102300, 1, 1 },
+	{ 102310, 2, 1 },
+	{ 102320, 3, 1 },
+	{ 102328, 4, 1 },
+	{ 102337, 5, 1 },
+	{ 102347, 6, 1 },
+	{ 99131, 7, 9 },
+	{ 99168, 0, 1 },
+	{ 99179, 1, 1 },
+	{ 99196, 2, 1 },
+	{ 99208, 3, 1 },
+	{ 91784, 4, 12 },
+	{ 98498, 0, 2 },
+	{ 102399, 2, 1 },
+	{ 102413, 3, 1 },
+	{ 91784, 4, 12 },
+	{ 93068, 1, 1 },
+	{ 102447, 2, 1 },
+	{ 102461, 3, 1 },
+	{ 102479, 4, 7 },
+	{ 93116, 11, 1 },
+	{ 93122, 12, 3 },
+	{ 93137, 15, 1 },
+	{ 102514, 0, 1 },
+	{ 102530, 1, 1 },
+	{ 102545, 2, 1 },
+	{ 76667, 3, 13 },
+	{ 102578, 0, 1 },
+	{ 102591, 1, 1 },
+	{ 102603, 2, 1 },
+	{ 76667, 3, 13 },
+	{ 102629, 0, 1 },
+	{ 92201, 1, 15 },
+	{ 102661, 0, 16 },
+	{ 102698, 0, 16 },
+	{ 102740, 0, 5 },
+	{ 102753, 5, 1 },
+	{ 90932, 6, 1 },
+	{ 102757, 8, 1 },
+	{ 102769, 9, 1 },
+	{ 90950, 11, 1 },
+	{ 102780, 12, 1 },
+	{ 90954, 13, 1 },
+	{ 98540, 14, 1 },
+	{ 38, 15, 1 },
+	{ 102809, 0, 1 },
+	{ 102821, 2, 1 },
+	{ 101440, 3, 1 },
+	{ 67, 4, 1 },
+	{ 102830, 5, 1 },
+	{ 102838, 6, 1 },
+	{ 102849, 7, 1 },
+	{ 102860, 8, 1 },
+	{ 102872, 9, 1 },
+	{ 102879, 10, 1 },
+	{ 102886, 11, 1 },
+	{ 102894, 12, 1 },
+	{ 102902, 13, 1 },
+	{ 102911, 14, 1 },
+	{ 102920, 15, 1 },
+	{ 102947, 0, 16 },
+	{ 102989, 0, 4 },
+	{ 103007, 4, 6 },
+	{ 103026, 10, 6 },
+	{ 102740, 0, 5 },
+	{ 103069, 5, 1 },
+	{ 103072, 6, 1 },
+	{ 103075, 7, 2 },
+	{ 103081, 9, 3 },
+	{ 67, 12, 2 },
+	{ 178, 15, 1 },
+	{ 102740, 0, 5 },
+	{ 103116, 5, 1 },
+	{ 103122, 6, 1 },
+	{ 103128, 7, 2 },
+	{ 103081, 9, 3 },
+	{ 103137, 12, 2 },
+	{ 103143, 14, 1 },
+	{ 103150, 15, 1 },
+	{ 103178, 1, 1 },
+	{ 103186, 2, 1 },
+	{ 76667, 3, 13 },
+	{ 103218, 0, 12 },
+	{ 103232, 12, 1 },
+	{ 103244, 13, 1 },
+	{ 103256, 14, 1 },
+	{ 103268, 15, 1 },
+	{ 103302, 0, 1 },
+	{ 93068, 1, 1 },
+	{ 100331, 2, 1 },
+	{ 103316, 3, 1 },
+	{ 93078, 4, 1 },
+	{ 100359, 5, 1 },
+	{ 103334, 6, 1 },
+	{ 103342, 7, 1 },
+	{ 5385, 8, 1 },
+	{ 103353, 9, 1 },
+	{ 98534, 10, 1 },
+	{ 93116, 11, 1 },
+	{ 100368, 12, 1 },
+	{ 100376, 13, 1 },
+	{ 100386, 14, 1 },
+	{ 93137, 15, 1 },
+	{ 103389, 0, 1 },
+	{ 103404, 1, 2 },
+	{ 103413, 3, 1 },
+	{ 103423, 4, 1 },
+	{ 103438, 5, 3 },
+	{ 103451, 8, 1 },
+	{ 91610, 9, 7 },
+	{ 103482, 0, 1 },
+	{ 103500, 1, 4 },
+	{ 103515, 5, 1 },
+	{ 103526, 6, 1 },
+	{ 103536, 8, 7 },
+	{ 103574, 0, 1 },
+	{ 100683, 4, 1 },
+	{ 100699, 5, 1 },
+	{ 100719, 6, 1 },
+	{ 100732, 7, 1 },
+	{ 100744, 8, 1 },
+	{ 91610, 9, 7 },
+	{ 103609, 0, 16 },
+	{ 101290, 0, 8 },
+	{ 75327, 8, 8 },
+	{ 100529, 0, 1 },
+	{ 82190, 1, 3 },
+	{ 100533, 4, 1 },
+	{ 91138, 5, 11 },
+	{ 104471, 0, 16 },
+	{ 104506, 0, 4 },
+	{ 104517, 4, 6 },
+	{ 104529, 10, 6 },
+	{ 104565, 0, 16 },
+	{ 104599, 0, 4 },
+	{ 104609, 4, 6 },
+	{ 104620, 10, 6 },
+	{ 104655, 0, 16 },
+	{ 104690, 0, 4 },
+	{ 104701, 4, 6 },
+	{ 104713, 10, 6 },
+	{ 104749, 0, 16 },
+	{ 104782, 0, 4 },
+	{ 104792, 4, 6 },
+	{ 104803, 10, 6 },
+	{ 91210, 0, 14 },
+	{ 104837, 14, 2 },
+	{ 104860, 0, 1 },
+	{ 104870, 1, 1 },
+	{ 104884, 2, 1 },
+	{ 104895, 3, 1 },
+	{ 104906, 4, 1 },
+	{ 104914, 5, 1 },
+	{ 91264, 6, 10 },
+	{ 104941, 0, 16 },
+	{ 104975, 0, 4 },
+	{ 104986, 4, 6 },
+	{ 104998, 10, 6 },
+	{ 103302, 0, 1 },
+	{ 93068, 1, 1 },
+	{ 100331, 2, 1 },
+	{ 103316, 3, 1 },
+	{ 93078, 4, 1 },
+	{ 103334, 6, 1 },
+	{ 103342, 7, 1 },
+	{ 5385, 8, 1 },
+	{ 103353, 9, 1 },
+	{ 98534, 10, 1 },
+	{ 93116, 11, 1 },
+	{ 100368, 12, 1 },
+	{ 100376, 13, 1 },
+	{ 100386, 14, 1 },
+	{ 93137, 15, 1 },
+	{ 74568, 0, 1 },
+	{ 105279, 1, 1 },
+	{ 105284, 3, 1 },
+	{ 105288, 4, 4 },
+	{ 74664, 8, 3 },
+	{ 105292, 11, 1 },
+	{ 105296, 12, 1 },
+	{ 105308, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 56, 0, 1 },
+	{ 105350, 2, 1 },
+	{ 105355, 3, 1 },
+	{ 74672, 4, 3 },
+	{ 105359, 8, 1 },
+	{ 105372, 9, 1 },
+	{ 105385, 11, 1 },
+	{ 105400, 12, 1 },
+	{ 105417, 13, 3 },
+	{ 74565, 0, 1 },
+	{ 74644, 1, 1 },
+	{ 74648, 2, 1 },
+	{ 74777, 3, 1 },
+	{ 74783, 4, 1 },
+	{ 74788, 5, 1 },
+	{ 74657, 6, 1 },
+	{ 74641, 7, 1 },
+	{ 74635, 8, 1 },
+	{ 74668, 9, 1 },
+	{ 74599, 10, 1 },
+	{ 74652, 11, 1 },
+	{ 74805, 12, 3 },
+	{ 105449, 15, 1 },
+	{ 74727, 0, 14 },
+	{ 105483, 14, 1 },
+	{ 74686, 15, 1 },
+	{ 213, 0, 1 },
+	{ 74877, 1, 1 },
+	{ 74890, 2, 1 },
+	{ 74903, 3, 1 },
+	{ 74908, 4, 1 },
+	{ 74911, 5, 1 },
+	{ 74915, 6, 2 },
+	{ 105526, 8, 1 },
+	{ 105540, 9, 1 },
+	{ 74928, 10, 1 },
+	{ 74941, 11, 5 },
+	{ 74982, 0, 1 },
+	{ 74987, 1, 3 },
+	{ 75002, 4, 1 },
+	{ 75016, 5, 1 },
+	{ 105579, 6, 1 },
+	{ 105593, 7, 8 },
+	{ 75045, 15, 1 },
+	{ 105692, 0, 16 },
+	{ 75191, 0, 1 },
+	{ 75195, 1, 1 },
+	{ 75200, 2, 1 },
+	{ 75205, 3, 1 },
+	{ 75212, 4, 1 },
+	{ 75219, 5, 2 },
+	{ 75224, 8, 1 },
+	{ 75231, 9, 1 },
+	{ 105717, 10, 1 },
+	{ 105732, 11, 1 },
+	{ 105748, 12, 2 },
+	{ 105763, 15, 1 },
+	{ 105801, 0, 16 },
+	{ 105864, 0, 1 },
+	{ 75301, 1, 1 },
+	{ 75305, 2, 2 },
+	{ 75318, 4, 3 },
+	{ 75322, 7, 1 },
+	{ 75327, 8, 8 },
+	{ 83909, 0, 1 },
+	{ 105974, 1, 1 },
+	{ 75305, 2, 2 },
+	{ 75542, 4, 1 },
+	{ 75557, 5, 1 },
+	{ 105978, 6, 3 },
+	{ 75582, 9, 1 },
+	{ 75590, 10, 1 },
+	{ 75617, 12, 1 },
+	{ 105991, 13, 1 },
+	{ 105998, 14, 1 },
+	{ 106005, 15, 1 },
+	{ 106040, 0, 8 },
+	{ 59, 8, 2 },
+	{ 76360, 10, 6 },
+	{ 93772, 0, 4 },
+	{ 75848, 4, 1 },
+	{ 75863, 5, 1 },
+	{ 75869, 6, 6 },
+	{ 75883, 12, 1 },
+	{ 106084, 13, 1 },
+	{ 106091, 14, 1 },
+	{ 106098, 15, 1 },
+	{ 106098, 0, 16 },
+	{ 76008, 0, 1 },
+	{ 77422, 1, 7 },
+	{ 76086, 8, 1 },
+	{ 75095, 9, 7 },
+	{ 76140, 0, 1 },
+	{ 76147, 1, 1 },
+	{ 76154, 2, 1 },
+	{ 76161, 3, 1 },
+	{ 75078, 4, 4 },
+	{ 76168, 8, 1 },
+	{ 76175, 9, 1 },
+	{ 106221, 10, 1 },
+	{ 106228, 11, 1 },
+	{ 94533, 12, 4 },
+	{ 106266, 0, 1 },
+	{ 76234, 1, 1 },
+	{ 106274, 2, 1 },
+	{ 76253, 3, 1 },
+	{ 76260, 4, 1 },
+	{ 76267, 5, 1 },
+	{ 76275, 6, 10 },
+	{ 76580, 0, 8 },
+	{ 106496, 8, 8 },
+	{ 76588, 0, 8 },
+	{ 81257, 8, 8 },
+	{ 106578, 0, 1 },
+	{ 76738, 1, 1 },
+	{ 75305, 2, 2 },
+	{ 76759, 4, 1 },
+	{ 76766, 5, 1 },
+	{ 76773, 6, 1 },
+	{ 76780, 7, 1 },
+	{ 76787, 8, 1 },
+	{ 76794, 9, 1 },
+	{ 77077, 10, 1 },
+	{ 77071, 11, 1 },
+	{ 76819, 12, 1 },
+	{ 76825, 13, 1 },
+	{ 76832, 14, 1 },
+	{ 76865, 0, 1 },
+	{ 76874, 2, 5 },
+	{ 106611, 7, 2 },
+	{ 76911, 9, 2 },
+	{ 76920, 11, 1 },
+	{ 106627, 13, 1 },
+	{ 106631, 14, 1 },
+	{ 106638, 15, 1 },
+	{ 76964, 0, 5 },
+	{ 106667, 5, 1 },
+	{ 76981, 6, 5 },
+	{ 76992, 11, 1 },
+	{ 76998, 12, 1 },
+	{ 77004, 13, 1 },
+	{ 77014, 14, 2 },
+	{ 77045, 0, 1 },
+	{ 77051, 1, 1 },
+	{ 77057, 2, 1 },
+	{ 77063, 3, 1 },
+	{ 106697, 4, 1 },
+	{ 106703, 5, 3 },
+	{ 77091, 8, 2 },
+	{ 77101, 11, 4 },
+	{ 77276, 0, 3 },
+	{ 77281, 4, 1 },
+	{ 103438, 5, 3 },
+	{ 77084, 8, 1 },
+	{ 103081, 9, 3 },
+	{ 77289, 13, 1 },
+	{ 74732, 14, 2 },
+	{ 106805, 0, 3 },
+	{ 75964, 3, 13 },
+	{ 74827, 0, 7 },
+	{ 99131, 7, 9 },
+	{ 106870, 0, 1 },
+	{ 106887, 1, 15 },
+	{ 77536, 0, 15 },
+	{ 77550, 15, 1 },
+	{ 77629, 0, 1 },
+	{ 77636, 1, 1 },
+	{ 77646, 2, 1 },
+	{ 253, 3, 1 },
+	{ 107039, 4, 2 },
+	{ 77663, 7, 1 },
+	{ 75327, 8, 8 },
+	{ 107063, 0, 3 },
+	{ 75964, 3, 13 },
+	{ 77728, 0, 1 },
+	{ 107101, 1, 1 },
+	{ 107111, 2, 1 },
+	{ 107120, 3, 1 },
+	{ 107129, 4, 1 },
+	{ 77811, 5, 1 },
+	{ 107138, 6, 1 },
+	{ 107148, 7, 1 },
+	{ 77882, 8, 1 },
+	{ 77894, 9, 1 },
+	{ 107159, 10, 1 },
+	{ 107172, 11, 1 },
+	{ 107189, 12, 1 },
+	{ 107207, 13, 1 },
+	{ 107225, 14, 1 },
+	{ 107244, 15, 1 },
+	{ 107288, 0, 1 },
+	{ 107297, 1, 1 },
+	{ 107308, 2, 1 },
+	{ 107320, 3, 1 },
+	{ 107330, 4, 1 },
+	{ 107339, 5, 1 },
+	{ 107351, 6, 1 },
+	{ 107361, 7, 1 },
+	{ 107373, 8, 1 },
+	{ 78265, 9, 1 },
+	{ 78276, 10, 1 },
+	{ 107385, 11, 1 },
+	{ 107394, 12, 3 },
+	{ 107409, 15, 1 },
+	{ 107444, 0, 1 },
+	{ 78331, 1, 1 },
+	{ 107454, 2, 1 },
+	{ 107463, 3, 1 },
+	{ 107472, 4, 1 },
+	{ 107485, 5, 1 },
+	{ 107502, 6, 1 },
+	{ 107520, 7, 1 },
+	{ 107538, 8, 1 },
+	{ 107557, 9, 1 },
+	{ 107576, 10, 1 },
+	{ 107586, 11, 1 },
+	{ 107596, 12, 1 },
+	{ 78592, 13, 1 },
+	{ 107606, 14, 1 },
+	{ 78767, 15, 1 },
+	{ 107640, 0, 1 },
+	{ 107650, 1, 1 },
+	{ 78847, 2, 1 },
+	{ 78858, 3, 1 },
+	{ 107661, 4, 11 },
+	{ 107676, 15, 1 },
+	{ 107711, 0, 1 },
+	{ 107721, 1, 1 },
+	{ 107731, 2, 1 },
+	{ 107740, 3, 1 },
+	{ 107758, 4, 1 },
+	{ 107776, 5, 1 },
+	{ 107787, 6, 1 },
+	{ 107806, 7, 1 },
+	{ 107826, 8, 1 },
+	{ 107847, 9, 1 },
+	{ 107868, 10, 1 },
+	{ 107890, 11, 1 },
+	{ 107916, 12, 1 },
+	{ 107943, 13, 1 },
+	{ 107970, 14, 1 },
+	{ 107998, 15, 1 },
+	{ 108063, 0, 1 },
+	{ 108081, 1, 1 },
+	{ 108101, 2, 1 },
+	{ 108122, 3, 1 },
+	{ 108141, 4, 1 },
+	{ 108159, 5, 1 },
+	{ 108180, 6, 1 },
+	{ 108199, 7, 1 },
+	{ 108220, 8, 1 },
+	{ 108241, 9, 1 },
+	{ 108261, 10, 1 },
+	{ 108281, 11, 1 },
+	{ 107394, 12, 3 },
+	{ 108299, 15, 1 },
+	{ 108355, 0, 1 },
+	{ 108365, 1, 1 },
+	{ 108375, 2, 1 },
+	{ 108393, 3, 1 },
+	{ 108411, 4, 1 },
+	{ 108433, 5, 1 },
+	{ 108459, 6, 1 },
+	{ 108486, 7, 1 },
+	{ 108513, 8, 1 },
+	{ 108541, 9, 1 },
+	{ 108569, 10, 1 },
+	{ 108588, 11, 1 },
+	{ 108607, 12, 1 },
+	{ 108626, 13, 1 },
+	{ 108648, 14, 1 },
+	{ 108657, 15, 1 },
+	{ 108704, 0, 1 },
+	{ 108714, 1, 1 },
+	{ 108734, 2, 1 },
+	{ 108754, 3, 1 },
+	{ 107661, 4, 11 },
+	{ 108774, 15, 1 },
+	{ 108831, 0, 16 },
+	{ 108913, 0, 16 },
+	{ 108997, 0, 16 },
+	{ 109081, 0, 16 },
+	{ 109154, 0, 16 },
+	{ 109229, 0, 16 },
+	{ 109304, 0, 16 },
+	{ 109373, 0, 16 },
+	{ 109457, 0, 16 },
+	{ 109539, 0, 16 },
+	{ 109623, 0, 16 },
+	{ 109696, 0, 16 },
+	{ 109771, 0, 16 },
+	{ 81778, 0, 1 },
+	{ 81785, 1, 1 },
+	{ 81794, 2, 1 },
+	{ 81804, 3, 1 },
+	{ 81815, 4, 1 },
+	{ 81824, 5, 1 },
+	{ 81835, 6, 1 },
+	{ 81844, 7, 1 },
+	{ 81855, 8, 1 },
+	{ 81864, 9, 1 },
+	{ 110331, 10, 5 },
+	{ 110337, 15, 1 },
+	{ 110401, 0, 16 },
+	{ 110575, 0, 16 },
+	{ 110665, 0, 10 },
+	{ 110671, 10, 6 },
+	{ 110671, 0, 16 },
+	{ 111102, 0, 4 },
+	{ 86078, 4, 1 },
+	{ 86094, 5, 2 },
+	{ 83085, 8, 3 },
+	{ 83102, 11, 2 },
+	{ 83117, 13, 2 },
+	{ 74148, 0, 3 },
+	{ 74157, 3, 2 },
+	{ 74188, 5, 3 },
+	{ 111636, 0, 1 },
+	{ 111650, 1, 2 },
+	{ 111676, 0, 1 },
+	{ 111689, 1, 1 },
+	{ 111702, 2, 1 },
+	{ 111715, 3, 1 },
+	{ 111728, 4, 1 },
+	{ 111738, 5, 1 },
+	{ 111748, 6, 1 },
+	{ 111758, 7, 1 },
+	{ 111779, 0, 2 },
+	{ 111788, 2, 1 },
+	{ 111797, 3, 1 },
+	{ 111806, 4, 1 },
+	{ 111815, 5, 1 },
+	{ 111837, 0, 14 },
+	{ 111841, 14, 2 },
+	{ 111857, 1, 1 },
+	{ 73793, 0, 5 },
+	{ 73802, 5, 3 },
+	{ 73815, 8, 3 },
+	{ 111886, 0, 2 },
+	{ 655, 0, 4 },
+	{ 111982, 0, 1 },
+	{ 111988, 1, 1 },
+	{ 111993, 2, 14 },
+	{ 112011, 0, 10 },
+	{ 112017, 10, 1 },
+	{ 112023, 11, 1 },
+	{ 112029, 12, 1 },
+	{ 112056, 0, 3 },
+	{ 112067, 3, 3 },
+	{ 112078, 6, 3 },
+	{ 112089, 9, 3 },
+	{ 112100, 12, 3 },
+	{ 112123, 0, 3 },
+	{ 112135, 3, 1 },
+	{ 112143, 4, 1 },
+	{ 112151, 5, 1 },
+	{ 112159, 6, 1 },
+	{ 112167, 7, 3 },
+	{ 112178, 10, 3 },
+	{ 112189, 13, 1 },
+	{ 112214, 0, 12 },
+	{ 112232, 0, 6 },
+	{ 112239, 6, 1 },
+	{ 112247, 7, 1 },
+	{ 112255, 8, 1 },
+	{ 112263, 9, 1 },
+	{ 112271, 10, 1 },
+	{ 112293, 0, 12 },
+	{ 112301, 12, 4 },
+	{ 112324, 0, 8 },
+	{ 112335, 8, 1 },
+	{ 112343, 9, 1 },
+	{ 112354, 10, 1 },
+	{ 112369, 11, 3 },
+	{ 878, 0, 1 },
+	{ 5385, 1, 1 },
+	{ 112393, 2, 5 },
+	{ 112400, 8, 4 },
+	{ 112407, 12, 1 },
+	{ 112418, 13, 3 },
+	{ 112447, 0, 5 },
+	{ 112460, 5, 8 },
+	{ 112472, 13, 1 },
+	{ 112524, 0, 1 },
+	{ 112554, 0, 4 },
+	{ 112560, 4, 4 },
+	{ 118831, 0, 16 },
+};
+
+/* MDIO, P31G PDI and P34X PDI registers, each sorted by address */
+const struct gpy2xx_regmap_reg gpy2xx_regmap_reg[] = {
+	{ 0x00000000, 42, 10, 0, 0 },
+	{ 0x00000002, 123, 15, 0, 10 },
+	{ 0x00000004, 136, 1, 0, 25 },
+	{ 0x00000006, 156, 3, 0, 26 },
+	{ 0x00000008, 181, 5, 0, 29 },
+	{ 0x0000000A, 196, 6, 0, 34 },
+	{ 0x0000000C, 242, 7, 0, 40 },
+	{ 0x0000000E, 270, 5, 0, 47 },
+	{ 0x00000010, 282, 6, 0, 52 },
+	{ 0x00000012, 322, 6, 0, 58 },
+	{ 0x00000014, 366, 7, 0, 64 },
+	{ 0x00000016, 376, 0, 0, 71 },
+	{ 0x00000018, 385, 0, 0, 71 },
+	{ 0x0000001A, 417, 4, 0, 71 },
+	{ 0x0000001C, 439, 1, 0, 75 },
+	{ 0x0000001E, 471, 6, 0, 76 },
+	{ 0x00000020, 490, 2, 0, 82 },
+	{ 0x00000022, 512, 2, 0, 84 },
+	{ 0x00000024, 522, 0, 0, 71 },
+	{ 0x00000026, 586, 10, 0, 86 },
+	{ 0x00000028, 640, 7, 0, 96 },
+	{ 0x0000002A, 659, 2, 0, 103 },
+	{ 0x0000002C, 670, 0, 0, 71 },
+	{ 0x0000002E, 679, 0, 0, 71 },
+	{ 0x00000030, 705, 6, 0, 105 },
+	{ 0x00000032, 790, 16, 0, 111 },
+	{ 0x00000034, 800, 15, 0, 127 },
+	{ 0x00000036, 870, 9, 0, 142 },
+	{ 0x00000038, 913, 7, 0, 151 },
+	{ 0x0000003A, 936, 3, 0, 158 },
+	{ 0x0000003C, 964, 3, 0, 161 },
+	{ 0x0000003E, 997, 5, 0, 164 },
+	{ 0x00200000, 1034, 7, 0, 169 },
+	{ 0x00200002, 1083, 3, 0, 176 },
+	{ 0x00200004, 1093, 1, 0, 25 },
+	{ 0x00200006, 1104, 3, 0, 26 },
+	{ 0x00200008, 1228, 11, 0, 179 },
+	{ 0x0020000A, 1334, 12, 0, 190 },
+	{ 0x0020000C, 1368, 3, 0, 202 },
+	{ 0x0020000E, 1394, 1, 0, 205 },
+	{ 0x00200010, 1638, 15, 0, 206 },
+	{ 0x00200016, 1868, 12, 0, 221 },
+	{ 0x0020001C, 1884, 1, 0, 25 },
+	{ 0x0020001E, 1896, 3, 0, 26 },
+	{ 0x0020002A, 1919, 2, 0, 233 },
+	{ 0x00200102, 1955, 1, 0, 235 },
+	{ 0x00200104, 2043, 5, 0, 236 },
+	{ 0x00200106, 2101, 3, 0, 241 },
+	{ 0x00200108, 2142, 2, 0, 244 },
+	{ 0x0020010A, 2172, 1, 0, 246 },
+	{ 0x0020010C, 2207, 1, 0, 247 },
+	{ 0x0020010E, 2242, 1, 0, 248 },
+	{ 0x00200110, 2277, 1, 0, 249 },
+	{ 0x00200112, 2313, 1, 0, 250 },
+	{ 0x00200114, 2346, 1, 0, 251 },
+	{ 0x00200116, 2379, 1, 0, 252 },
+	{ 0x00200118, 2412, 1, 0, 253 },
+	{ 0x0020011A, 2441, 1, 0, 254 },
+	{ 0x0020011C, 2466, 1, 0, 255 },
+	{ 0x0020011E, 2491, 1, 0, 256 },
+	{ 0x00200120, 2516, 1, 0, 257 },
+	{ 0x00200122, 2546, 1, 0, 258 },
+	{ 0x00200124, 2594, 2, 0, 259 },
+	{ 0x00200126, 2747, 6, 0, 261 },
+	{ 0x00200E10, 2790, 2, 0, 267 },
+	{ 0x00600000, 2823, 7, 0, 269 },
+	{ 0x00600002, 2917, 8, 0, 276 },
+	{ 0x00600004, 2927, 0, 0, 71 },
+	{ 0x00600006, 2938, 3, 0, 26 },
+	{ 0x00600008, 3022, 5, 0, 284 },
+	{ 0x0060000A, 3105, 12, 0, 289 },
+	{ 0x0060000C, 3184, 3, 0, 301 },
+	{ 0x0060000E, 3206, 1, 0, 304 },
+	{ 0x00600010, 3331, 10, 0, 305 },
+	{ 0x0060001C, 3341, 0, 0, 71 },
+	{ 0x0060001E, 3353, 3, 0, 26 },
+	{ 0x00600028, 3462, 6, 0, 315 },
+	{ 0x0060002A, 3491, 2, 0, 321 },
+	{ 0x0060002C, 3511, 1, 0, 323 },
+	{ 0x00600040, 3594, 4, 0, 324 },
+	{ 0x00600042, 3658, 4, 0, 328 },
+	{ 0x00600E10, 3728, 2, 0, 332 },
+	{ 0x00E00000, 3768, 4, 0, 334 },
+	{ 0x00E00002, 3836, 8, 0, 338 },
+	{ 0x00E00004, 3846, 1, 0, 25 },
+	{ 0x00E00006, 3858, 3, 0, 26 },
+	{ 0x00E0000A, 3909, 12, 0, 346 },
+	{ 0x00E0000C, 3927, 3, 0, 358 },
+	{ 0x00E0001C, 3937, 1, 0, 25 },
+	{ 0x00E0001E, 3950, 3, 0, 26 },
+	{ 0x00E00020, 3963, 5, 0, 29 },
+	{ 0x00E00026, 3972, 6, 0, 34 },
+	{ 0x00E0002C, 3986, 5, 0, 47 },
+	{ 0x00E0002E, 4004, 1, 0, 361 },
+	{ 0x00E00030, 4022, 1, 0, 362 },
+	{ 0x00E00032, 4035, 6, 0, 52 },
+	{ 0x00E00034, 4051, 1, 0, 361 },
+	{ 0x00E00036, 4067, 1, 0, 362 },
+	{ 0x00E00040, 4157, 11, 0, 363 },
+	{ 0x00E00042, 4175, 4, 0, 374 },
+	{ 0x00E00078, 4259, 6, 0, 378 },
+	{ 0x00E0007A, 4276, 6, 0, 378 },
+	{ 0x00E0007C, 4301, 1, 0, 384 },
+	{ 0x00E0007E, 4318, 1, 0, 384 },
+	{ 0x00E00080, 4344, 1, 0, 385 },
+	{ 0x03C00000, 4388, 5, 0, 386 },
+	{ 0x03C00002, 4424, 4, 0, 391 },
+	{ 0x03C00004, 4436, 4, 0, 391 },
+	{ 0x03C00006, 4448, 4, 0, 391 },
+	{ 0x03C00008, 4460, 4, 0, 391 },
+	{ 0x03C0000A, 4472, 1, 0, 395 },
+	{ 0x03C0000C, 4496, 1, 0, 396 },
+	{ 0x03C0000E, 4537, 4, 0, 397 },
+	{ 0x03C00010, 4610, 14, 0, 401 },
+	{ 0x03C00012, 4642, 6, 0, 415 },
+	{ 0x03C00014, 4720, 5, 0, 421 },
+	{ 0x03C00016, 4807, 5, 0, 426 },
+	{ 0x03C00018, 4900, 7, 0, 431 },
+	{ 0x03C0001A, 4915, 1, 0, 395 },
+	{ 0x03C0001C, 4947, 1, 0, 438 },
+	{ 0x03C0001E, 5002, 7, 0, 439 },
+	{ 0x03C00020, 5056, 4, 0, 446 },
+	{ 0x03C00022, 5104, 5, 0, 450 },
+	{ 0x03C00024, 5117, 5, 0, 450 },
+	{ 0x03C00026, 5150, 2, 0, 455 },
+	{ 0x03C00028, 5191, 4, 0, 457 },
+	{ 0x03E01C0C, 5219, 2, 0, 461 },
+	{ 0x03E01C10, 5243, 2, 0, 463 },
+	{ 0x03E01C12, 5268, 2, 0, 465 },
+	{ 0x03E01C14, 5293, 2, 0, 467 },
+	{ 0x03E01C16, 5318, 2, 0, 469 },
+	{ 0x03E01C18, 5343, 2, 0, 471 },
+	{ 0x03E01C1A, 5368, 2, 0, 473 },
+	{ 0x03E01F20, 5405, 7, 0, 475 },
+	{ 0x0001E800, 5448, 4, 0, 482 },
+	{ 0x0001E810, 5493, 4, 0, 486 },
+	{ 0x0001E812, 5523, 1, 0, 490 },
+	{ 0x0001E814, 5553, 1, 0, 491 },
+	{ 0x0001E818, 5583, 2, 0, 492 },
+	{ 0x00A381D0, 5611, 1, 1, 494 },
+	{ 0x00A381D4, 5641, 1, 1, 494 },
+	{ 0x00A381D8, 5671, 1, 1, 494 },
+	{ 0x00A381DC, 5701, 1, 1, 494 },
+	{ 0x00A381E0, 5731, 1, 1, 494 },
+	{ 0x00A381E4, 5756, 1, 1, 494 },
+	{ 0x00B04000, 5800, 1, 1, 495 },
+	{ 0x00B04004, 5856, 2, 1, 496 },
+	{ 0x00B04008, 5902, 1, 1, 498 },
+	{ 0x00B0400C, 5955, 2, 1, 499 },
+	{ 0x00B04010, 6122, 13, 1, 501 },
+	{ 0x00B04014, 6171, 1, 1, 514 },
+	{ 0x00B04018, 6217, 1, 1, 515 },
+	{ 0x00B0401C, 6608, 25, 1, 516 },
+	{ 0x00B04020, 6663, 3, 1, 541 },
+	{ 0x00B04040, 6684, 1, 1, 495 },
+	{ 0x00B04044, 6711, 2, 1, 496 },
+	{ 0x00B04048, 6738, 1, 1, 498 },
+	{ 0x00B0404C, 6765, 2, 1, 499 },
+	{ 0x00B04050, 6792, 13, 1, 501 },
+	{ 0x00B04054, 6818, 1, 1, 514 },
+	{ 0x00B04058, 6842, 1, 1, 515 },
+	{ 0x00B0405C, 6866, 25, 1, 516 },
+	{ 0x00B04060, 6882, 3, 1, 541 },
+	{ 0x00B04080, 6903, 1, 1, 495 },
+	{ 0x00B04084, 6930, 2, 1, 496 },
+	{ 0x00B04088, 6957, 1, 1, 498 },
+	{ 0x00B0408C, 6984, 2, 1, 499 },
+	{ 0x00B04090, 7011, 13, 1, 501 },
+	{ 0x00B04094, 7037, 1, 1, 514 },
+	{ 0x00B04098, 7061, 1, 1, 515 },
+	{ 0x00B0409C, 7085, 25, 1, 516 },
+	{ 0x00B040A0, 7101, 3, 1, 541 },
+	{ 0x00B040C0, 7122, 1, 1, 495 },
+	{ 0x00B040C4, 7149, 2, 1, 496 },
+	{ 0x00B040C8, 7176, 1, 1, 498 },
+	{ 0x00B040CC, 7203, 2, 1, 499 },
+	{ 0x00B040D0, 7230, 13, 1, 501 },
+	{ 0x00B040D4, 7256, 1, 1, 514 },
+	{ 0x00B040D8, 7280, 1, 1, 515 },
+	{ 0x00B040DC, 7304, 25, 1, 516 },
+	{ 0x00B040E0, 7320, 3, 1, 541 },
+	{ 0x00B04100, 7341, 1, 1, 495 },
+	{ 0x00B04104, 7368, 2, 1, 496 },
+	{ 0x00B04108, 7395, 1, 1, 498 },
+	{ 0x00B0410C, 7422, 2, 1, 499 },
+	{ 0x00B04110, 7449, 13, 1, 501 },
+	{ 0x00B04114, 7475, 1, 1, 514 },
+	{ 0x00B04118, 7499, 1, 1, 515 },
+	{ 0x00B0411C, 7523, 25, 1, 516 },
+	{ 0x00B04120, 7539, 3, 1, 541 },
+	{ 0x00B04140, 7560, 1, 1, 495 },
+	{ 0x00B04144, 7587, 2, 1, 496 },
+	{ 0x00B04148, 7614, 1, 1, 498 },
+	{ 0x00B0414C, 7641, 2, 1, 499 },
+	{ 0x00B04150, 7668, 13, 1, 501 },
+	{ 0x00B04154, 7694, 1, 1, 514 },
+	{ 0x00B04158, 7718, 1, 1, 515 },
+	{ 0x00B0415C, 7742, 25, 1, 516 },
+	{ 0x00B04160, 7758, 3, 1, 541 },
+	{ 0x00B04180, 7779, 1, 1, 495 },
+	{ 0x00B04184, 7806, 2, 1, 496 },
+	{ 0x00B04188, 7833, 1, 1, 498 },
+	{ 0x00B0418C, 7860, 2, 1, 499 },
+	{ 0x00B04190, 7887, 13, 1, 501 },
+	{ 0x00B04194, 7913, 1, 1, 514 },
+	{ 0x00B04198, 7937, 1, 1, 515 },
+	{ 0x00B0419C, 7961, 25, 1, 516 },
+	{ 0x00B041A0, 7977, 3, 1, 541 },
+	{ 0x00B041C0, 7998, 1, 1, 495 },
+	{ 0x00B041C4, 8025, 2, 1, 496 },
+	{ 0x00B041C8, 8052, 1, 1, 498 },
+	{ 0x00B041CC, 8079, 2, 1, 499 },
+	{ 0x00B041D0, 8106, 13, 1, 501 },
+	{ 0x00B041D4, 8132, 1, 1, 514 },
+	{ 0x00B041D8, 8156, 1, 1, 515 },
+	{ 0x00B041DC, 8180, 25, 1, 516 },
+	{ 0x00B041E0, 8196, 3, 1, 541 },
+	{ 0x00B04200, 8217, 1, 1, 495 },
+	{ 0x00B04204, 8244, 2, 1, 496 },
+	{ 0x00B04208, 8271, 1, 1, 498 },
+	{ 0x00B0420C, 8298, 2, 1, 499 },
+	{ 0x00B04210, 8325, 13, 1, 501 },
+	{ 0x00B04214, 8351, 1, 1, 514 },
+	{ 0x00B04218, 8375, 1, 1, 515 },
+	{ 0x00B0421C, 8399, 25, 1, 516 },
+	{ 0x00B04220, 8415, 3, 1, 541 },
+	{ 0x00B04240, 8436, 1, 1, 495 },
+	{ 0x00B04244, 8463, 2, 1, 496 },
+	{ 0x00B04248, 8490, 1, 1, 498 },
+	{ 0x00B0424C, 8517, 2, 1, 499 },
+	{ 0x00B04250, 8544, 13, 1, 501 },
+	{ 0x00B04254, 8570, 1, 1, 514 },
+	{ 0x00B04258, 8594, 1, 1, 515 },
+	{ 0x00B0425C, 8618, 25, 1, 516 },
+	{ 0x00B04260, 8634, 3, 1, 541 },
+	{ 0x00B04280, 8655, 1, 1, 495 },
+	{ 0x00B04284, 8683, 2, 1, 496 },
+	{ 0x00B04288, 8711, 1, 1, 498 },
+	{ 0x00B0428C, 8739, 2, 1, 499 },
+	{ 0x00B04290, 8767, 13, 1, 501 },
+	{ 0x00B04294, 8794, 1, 1, 514 },
+	{ 0x00B04298, 8819, 1, 1, 515 },
+	{ 0x00B0429C, 8844, 25, 1, 516 },
+	{ 0x00B042A0, 8861, 3, 1, 541 },
+	{ 0x00B042C0, 8883, 1, 1, 495 },
+	{ 0x00B042C4, 8911, 2, 1, 496 },
+	{ 0x00B042C8, 8939, 1, 1, 498 },
+	{ 0x00B042CC, 8967, 2, 1, 499 },
+	{ 0x00B042D0, 8995, 13, 1, 501 },
+	{ 0x00B042D4, 9022, 1, 1, 514 },
+	{ 0x00B042D8, 9047, 1, 1, 515 },
+	{ 0x00B042DC, 9072, 25, 1, 516 },
+	{ 0x00B042E0, 9089, 3, 1, 541 },
+	{ 0x00B04300, 9111, 1, 1, 495 },
+	{ 0x00B04304, 9139, 2, 1, 496 },
+	{ 0x00B04308, 9167, 1, 1, 498 },
+	{ 0x00B0430C, 9195, 2, 1, 499 },
+	{ 0x00B04310, 9223, 13, 1, 501 },
+	{ 0x00B04314, 9250, 1, 1, 514 },
+	{ 0x00B04318, 9275, 1, 1, 515 },
+	{ 0x00B0431C, 9300, 25, 1, 516 },
+	{ 0x00B04320, 9317, 3, 1, 541 },
+	{ 0x00B04340, 9339, 1, 1, 495 },
+	{ 0x00B04344, 9367, 2, 1, 496 },
+	{ 0x00B04348, 9395, 1, 1, 498 },
+	{ 0x00B0434C, 9423, 2, 1, 499 },
+	{ 0x00B04350, 9451, 13, 1, 501 },
+	{ 0x00B04354, 9478, 1, 1, 514 },
+	{ 0x00B04358, 9503, 1, 1, 515 },
+	{ 0x00B0435C, 9528, 25, 1, 516 },
+	{ 0x00B04360, 9545, 3, 1, 541 },
+	{ 0x00B04380, 9567, 1, 1, 495 },
+	{ 0x00B04384, 9595, 2, 1, 496 },
+	{ 0x00B04388, 9623, 1, 1, 498 },
+	{ 0x00B0438C, 9651, 2, 1, 499 },
+	{ 0x00B04390, 9679, 13, 1, 501 },
+	{ 0x00B04394, 9706, 1, 1, 514 },
+	{ 0x00B04398, 9731, 1, 1, 515 },
+	{ 0x00B0439C, 9756, 25, 1, 516 },
+	{ 0x00B043A0, 9773, 3, 1, 541 },
+	{ 0x00B043C0, 9795, 1, 1, 495 },
+	{ 0x00B043C4, 9823, 2, 1, 496 },
+	{ 0x00B043C8, 9851, 1, 1, 498 },
+	{ 0x00B043CC, 9879, 2, 1, 499 },
+	{ 0x00B043D0, 9907, 13, 1, 501 },
+	{ 0x00B043D4, 9934, 1, 1, 514 },
+	{ 0x00B043D8, 9959, 1, 1, 515 },
+	{ 0x00B043DC, 9984, 25, 1, 516 },
+	{ 0x00B043E0, 10001, 3, 1, 541 },
+	{ 0x00B04400, 10023, 1, 1, 495 },
+	{ 0x00B04404, 10051, 2, 1, 496 },
+	{ 0x00B04408, 10079, 1, 1, 498 },
+	{ 0x00B0440C, 10107, 2, 1, 499 },
+	{ 0x00B04410, 10135, 13, 1, 501 },
+	{ 0x00B04414, 10162, 1, 1, 514 },
+	{ 0x00B04418, 10187, 1, 1, 515 },
+	{ 0x00B0441C, 10212, 25, 1, 516 },
+	{ 0x00B04420, 10229, 3, 1, 541 },
+	{ 0x00B04440, 10251, 1, 1, 495 },
+	{ 0x00B04444, 10279, 2, 1, 496 },
+	{ 0x00B04448, 10307, 1, 1, 498 },
+	{ 0x00B0444C, 10335, 2, 1, 499 },
+	{ 0x00B04450, 10363, 13, 1, 501 },
+	{ 0x00B04454, 10390, 1, 1, 514 },
+	{ 0x00B04458, 10415, 1, 1, 515 },
+	{ 0x00B0445C, 10440, 25, 1, 516 },
+	{ 0x00B04460, 10457, 3, 1, 541 },
+	{ 0x00B04480, 10479, 1, 1, 495 },
+	{ 0x00B04484, 10507, 2, 1, 496 },
+	{ 0x00B04488, 10535, 1, 1, 498 },
+	{ 0x00B0448C, 10563, 2, 1, 499 },
+	{ 0x00B04490, 10591, 13, 1, 501 },
+	{ 0x00B04494, 10618, 1, 1, 514 },
+	{ 0x00B04498, 10643, 1, 1, 515 },
+	{ 0x00B0449C, 10668, 25, 1, 516 },
+	{ 0x00B044A0, 10685, 3, 1, 541 },
+	{ 0x00B044C0, 10707, 1, 1, 495 },
+	{ 0x00B044C4, 10735, 2, 1, 496 },
+	{ 0x00B044C8, 10763, 1, 1, 498 },
+	{ 0x00B044CC, 10791, 2, 1, 499 },
+	{ 0x00B044D0, 10819, 13, 1, 501 },
+	{ 0x00B044D4, 10846, 1, 1, 514 },
+	{ 0x00B044D8, 10871, 1, 1, 515 },
+	{ 0x00B044DC, 10896, 25, 1, 516 },
+	{ 0x00B044E0, 10913, 3, 1, 541 },
+	{ 0x00B04500, 10935, 1, 1, 495 },
+	{ 0x00B04504, 10963, 2, 1, 496 },
+	{ 0x00B04508, 10991, 1, 1, 498 },
+	{ 0x00B0450C, 11019, 2, 1, 499 },
+	{ 0x00B04510, 11047, 13, 1, 501 },
+	{ 0x00B04514, 11074, 1, 1, 514 },
+	{ 0x00B04518, 11099, 1, 1, 515 },
+	{ 0x00B0451C, 11124, 25, 1, 516 },
+	{ 0x00B04520, 11141, 3, 1, 541 },
+	{ 0x00B04540, 11163, 1, 1, 495 },
+	{ 0x00B04544, 11191, 2, 1, 496 },
+	{ 0x00B04548, 11219, 1, 1, 498 },
+	{ 0x00B0454C, 11247, 2, 1, 499 },
+	{ 0x00B04550, 11275, 13, 1, 501 },
+	{ 0x00B04554, 11302, 1, 1, 514 },
+	{ 0x00B04558, 11327, 1, 1, 515 },
+	{ 0x00B0455C, 11352, 25, 1, 516 },
+	{ 0x00B04560, 11369, 3, 1, 541 },
+	{ 0x00B04580, 11391, 1, 1, 495 },
+	{ 0x00B04584, 11419, 2, 1, 496 },
+	{ 0x00B04588, 11447, 1, 1, 498 },
+	{ 0x00B0458C, 11475, 2, 1, 499 },
+	{ 0x00B04590, 11503, 13, 1, 501 },
+	{ 0x00B04594, 11530, 1, 1, 514 },
+	{ 0x00B04598, 11555, 1, 1, 515 },
+	{ 0x00B0459C, 11580, 25, 1, 516 },
+	{ 0x00B045A0, 11597, 3, 1, 541 },
+	{ 0x00B045C0, 11619, 1, 1, 495 },
+	{ 0x00B045C4, 11647, 2, 1, 496 },
+	{ 0x00B045C8, 11675, 1, 1, 498 },
+	{ 0x00B045CC, 11703, 2, 1, 499 },
+	{ 0x00B045D0, 11731, 13, 1, 501 },
+	{ 0x00B045D4, 11758, 1, 1, 514 },
+	{ 0x00B045D8, 11783, 1, 1, 515 },
+	{ 0x00B045DC, 11808, 25, 1, 516 },
+	{ 0x00B045E0, 11825, 3, 1, 541 },
+	{ 0x00B04600, 11847, 1, 1, 495 },
+	{ 0x00B04604, 11875, 2, 1, 496 },
+	{ 0x00B04608, 11903, 1, 1, 498 },
+	{ 0x00B0460C, 11931, 2, 1, 499 },
+	{ 0x00B04610, 11959, 13, 1, 501 },
+	{ 0x00B04614, 11986, 1, 1, 514 },
+	{ 0x00B04618, 12011, 1, 1, 515 },
+	{ 0x00B0461C, 12036, 25, 1, 516 },
+	{ 0x00B04620, 12053, 3, 1, 541 },
+	{ 0x00B04640, 12075, 1, 1, 495 },
+	{ 0x00B04644, 12103, 2, 1, 496 },
+	{ 0x00B04648, 12131, 1, 1, 498 },
+	{ 0x00B0464C, 12159, 2, 1, 499 },
+	{ 0x00B04650, 12187, 13, 1, 501 },
+	{ 0x00B04654, 12214, 1, 1, 514 },
+	{ 0x00B04658, 12239, 1, 1, 515 },
+	{ 0x00B0465C, 12264, 25, 1, 516 },
+	{ 0x00B04660, 12281, 3, 1, 541 },
+	{ 0x00B04680, 12303, 1, 1, 495 },
+	{ 0x00B04684, 12331, 2, 1, 496 },
+	{ 0x00B04688, 12359, 1, 1, 498 },
+	{ 0x00B0468C, 12387, 2, 1, 499 },
+	{ 0x00B04690, 12415, 13, 1, 501 },
+	{ 0x00B04694, 12442, 1, 1, 514 },
+	{ 0x00B04698, 12467, 1, 1, 515 },
+	{ 0x00B0469C, 12492, 25, 1, 516 },
+	{ 0x00B046A0, 12509, 3, 1, 541 },
+	{ 0x00B046C0, 12531, 1, 1, 495 },
+	{ 0x00B046C4, 12559, 2, 1, 496 },
+	{ 0x00B046C8, 12587, 1, 1, 498 },
+	{ 0x00B046CC, 12615, 2, 1, 499 },
+	{ 0x00B046D0, 12643, 13, 1, 501 },
+	{ 0x00B046D4, 12670, 1, 1, 514 },
+	{ 0x00B046D8, 12695, 1, 1, 515 },
+	{ 0x00B046DC, 12720, 25, 1, 516 },
+	{ 0x00B046E0, 12737, 3, 1, 541 },
+	{ 0x00B04700, 12759, 1, 1, 495 },
+	{ 0x00B04704, 12787, 2, 1, 496 },
+	{ 0x00B04708, 12815, 1, 1, 498 },
+	{ 0x00B0470C, 12843, 2, 1, 499 },
+	{ 0x00B04710, 12871, 13, 1, 501 },
+	{ 0x00B04714, 12898, 1, 1, 514 },
+	{ 0x00B04718, 12923, 1, 1, 515 },
+	{ 0x00B0471C, 12948, 25, 1, 516 },
+	{ 0x00B04720, 12965, 3, 1, 541 },
+	{ 0x00B04740, 12987, 1, 1, 495 },
+	{ 0x00B04744, 13015, 2, 1, 496 },
+	{ 0x00B04748, 13043, 1, 1, 498 },
+	{ 0x00B0474C, 13071, 2, 1, 499 },
+	{ 0x00B04750, 13099, 13, 1, 501 },
+	{ 0x00B04754, 13126, 1, 1, 514 },
+	{ 0x00B04758, 13151, 1, 1, 515 },
+	{ 0x00B0475C, 13176, 25, 1, 516 },
+	{ 0x00B04760, 13193, 3, 1, 541 },
+	{ 0x00B04780, 13215, 1, 1, 495 },
+	{ 0x00B04784, 13243, 2, 1, 496 },
+	{ 0x00B04788, 13271, 1, 1, 498 },
+	{ 0x00B0478C, 13299, 2, 1, 499 },
+	{ 0x00B04790, 13327, 13, 1, 501 },
+	{ 0x00B04794, 13354, 1, 1, 514 },
+	{ 0x00B04798, 13379, 1, 1, 515 },
+	{ 0x00B0479C, 13404, 25, 1, 516 },
+	{ 0x00B047A0, 13421, 3, 1, 541 },
+	{ 0x00B047C0, 13443, 1, 1, 495 },
+	{ 0x00B047C4, 13471, 2, 1, 496 },
+	{ 0x00B047C8, 13499, 1, 1, 498 },
+	{ 0x00B047CC, 13527, 2, 1, 499 },
+	{ 0x00B047D0, 13555, 13, 1, 501 },
+	{ 0x00B047D4, 13582, 1, 1, 514 },
+	{ 0x00B047D8, 13607, 1, 1, 515 },
+	{ 0x00B047DC, 13632, 25, 1, 516 },
+	{ 0x00B047E0, 13649, 3, 1, 541 },
+	{ 0x00B06000, 13683, 1, 1, 544 },
+	{ 0x00B06040, 13718, 1, 1, 545 },
+	{ 0x00B06080, 13750, 1, 1, 546 },
+	{ 0x00B060C0, 13781, 1, 1, 547 },
+	{ 0x00B06100, 13875, 6, 1, 548 },
+	{ 0x00B06104, 13931, 3, 1, 554 },
+	{ 0x00B07000, 14089, 10, 1, 557 },
+	{ 0x00B07004, 14110, 10, 1, 557 },
+	{ 0x00B07008, 14131, 10, 1, 557 },
+	{ 0x00B0700C, 14152, 10, 1, 557 },
+	{ 0x00B07010, 14173, 10, 1, 557 },
+	{ 0x00B07014, 14194, 10, 1, 557 },
+	{ 0x00B07018, 14215, 10, 1, 557 },
+	{ 0x00B0701C, 14236, 10, 1, 557 },
+	{ 0x00B07020, 14257, 10, 1, 557 },
+	{ 0x00B07024, 14278, 10, 1, 557 },
+	{ 0x00B07028, 14299, 10, 1, 557 },
+	{ 0x00B0702C, 14321, 10, 1, 557 },
+	{ 0x00B07030, 14343, 10, 1, 557 },
+	{ 0x00B07034, 14365, 10, 1, 557 },
+	{ 0x00B07038, 14387, 10, 1, 557 },
+	{ 0x00B0703C, 14409, 10, 1, 557 },
+	{ 0x00B07040, 14431, 10, 1, 557 },
+	{ 0x00B07044, 14453, 10, 1, 557 },
+	{ 0x00B07048, 14475, 10, 1, 557 },
+	{ 0x00B0704C, 14497, 10, 1, 557 },
+	{ 0x00B07050, 14519, 10, 1, 557 },
+	{ 0x00B07054, 14541, 10, 1, 557 },
+	{ 0x00B07058, 14563, 10, 1, 557 },
+	{ 0x00B0705C, 14585, 10, 1, 557 },
+	{ 0x00B07060, 14607, 10, 1, 557 },
+	{ 0x00B07064, 14629, 10, 1, 557 },
+	{ 0x00B07068, 14651, 10, 1, 557 },
+	{ 0x00B0706C, 14673, 10, 1, 557 },
+	{ 0x00B07070, 14695, 10, 1, 557 },
+	{ 0x00B07074, 14717, 10, 1, 557 },
+	{ 0x00B07078, 14739, 10, 1, 557 },
+	{ 0x00B0707C, 14761, 10, 1, 557 },
+	{ 0x00B07800, 14783, 1, 1, 498 },
+	{ 0x00B07804, 14823, 2, 1, 567 },
+	{ 0x00B07808, 14849, 1, 1, 498 },
+	{ 0x00B0780C, 14872, 2, 1, 567 },
+	{ 0x00B07810, 14898, 1, 1, 498 },
+	{ 0x00B07814, 14921, 2, 1, 567 },
+	{ 0x00B07818, 14947, 1, 1, 498 },
+	{ 0x00B0781C, 14970, 2, 1, 567 },
+	{ 0x00B07820, 14996, 1, 1, 498 },
+	{ 0x00B07824, 15019, 2, 1, 567 },
+	{ 0x00B07828, 15045, 1, 1, 498 },
+	{ 0x00B0782C, 15068, 2, 1, 567 },
+	{ 0x00B07830, 15094, 1, 1, 498 },
+	{ 0x00B07834, 15117, 2, 1, 567 },
+	{ 0x00B07838, 15143, 1, 1, 498 },
+	{ 0x00B0783C, 15166, 2, 1, 567 },
+	{ 0x00B07840, 15192, 1, 1, 498 },
+	{ 0x00B07844, 15215, 2, 1, 567 },
+	{ 0x00B07848, 15241, 1, 1, 498 },
+	{ 0x00B0784C, 15264, 2, 1, 567 },
+	{ 0x00B07850, 15290, 1, 1, 569 },
+	{ 0x00B07854, 15314, 1, 1, 569 },
+	{ 0x00B07858, 15338, 1, 1, 569 },
+	{ 0x00B0785C, 15362, 1, 1, 569 },
+	{ 0x00B07860, 15386, 1, 1, 569 },
+	{ 0x00B07864, 15410, 1, 1, 569 },
+	{ 0x00B07868, 15434, 1, 1, 569 },
+	{ 0x00B0786C, 15458, 1, 1, 569 },
+	{ 0x00B07880, 15482, 1, 1, 498 },
+	{ 0x00B07884, 15506, 1, 1, 570 },
+	{ 0x00B07888, 15530, 1, 1, 498 },
+	{ 0x00B0788C, 15552, 1, 1, 570 },
+	{ 0x00B07890, 15574, 1, 1, 498 },
+	{ 0x00B07894, 15635, 2, 1, 571 },
+	{ 0x00B07898, 15661, 1, 1, 498 },
+	{ 0x00B0789C, 15687, 1, 1, 570 },
+	{ 0x00B078F8, 16043, 26, 1, 573 },
+	{ 0x00B078FC, 16324, 29, 1, 599 },
+	{ 0x00B07900, 16415, 7, 1, 628 },
+	{ 0x00B07904, 16453, 2, 1, 635 },
+	{ 0x00B07908, 16494, 2, 1, 637 },
+	{ 0x00B0790C, 16521, 1, 1, 639 },
+	{ 0x00B07940, 16619, 8, 1, 640 },
+	{ 0x00B07944, 16854, 16, 1, 648 },
+	{ 0x00B07948, 16875, 16, 1, 648 },
+	{ 0x00B0794C, 16895, 4, 1, 664 },
+	{ 0x00B0797C, 17016, 7, 1, 668 },
+	{ 0x00B07984, 17045, 1, 1, 675 },
+	{ 0x00B07C00, 17066, 29, 1, 599 },
+	{ 0x00B07C20, 17129, 7, 1, 676 },
+	{ 0x00B07C24, 17198, 4, 1, 683 },
+	{ 0x00B07C40, 17227, 1, 1, 687 },
+	{ 0x00B07C80, 17288, 3, 1, 688 },
+	{ 0x00B07C84, 17346, 7, 1, 691 },
+	{ 0x00B07C88, 17399, 2, 1, 698 },
+	{ 0x00B07D00, 17437, 1, 1, 700 },
+	{ 0x00B07D04, 17493, 2, 1, 701 },
+	{ 0x00B07D08, 17534, 1, 1, 703 },
+	{ 0x00B07D0C, 17576, 1, 1, 704 },
+	{ 0x00B07D10, 17617, 1, 1, 705 },
+	{ 0x00B07D14, 17663, 1, 1, 706 },
+	{ 0x00B07D18, 17705, 1, 1, 707 },
+	{ 0x00B07D1C, 17745, 1, 1, 708 },
+	{ 0x00B07D20, 17784, 1, 1, 709 },
+	{ 0x00B07D24, 17825, 1, 1, 710 },
+	{ 0x00B07D28, 17854, 1, 1, 711 },
+	{ 0x00B07D30, 17899, 1, 1, 712 },
+	{ 0x00B07D34, 17924, 1, 1, 712 },
+	{ 0x00B07D38, 17949, 1, 1, 712 },
+	{ 0x00B07D3C, 17974, 1, 1, 712 },
+	{ 0x00B07E00, 18368, 24, 1, 713 },
+	{ 0x00B07E04, 18431, 2, 1, 737 },
+	{ 0x00B07E08, 18454, 24, 1, 713 },
+	{ 0x00B07E0C, 18477, 2, 1, 737 },
+	{ 0x00B07E10, 18500, 24, 1, 713 },
+	{ 0x00B07E14, 18523, 2, 1, 737 },
+	{ 0x00B07E18, 18546, 24, 1, 713 },
+	{ 0x00B07E1C, 18569, 2, 1, 737 },
+	{ 0x00B07E20, 18592, 24, 1, 713 },
+	{ 0x00B07E24, 18615, 2, 1, 737 },
+	{ 0x00B07E28, 18638, 24, 1, 713 },
+	{ 0x00B07E2C, 18661, 2, 1, 737 },
+	{ 0x00B07E30, 18684, 24, 1, 713 },
+	{ 0x00B07E34, 18707, 2, 1, 737 },
+	{ 0x00B07E38, 18730, 24, 1, 713 },
+	{ 0x00B07E3C, 18753, 2, 1, 737 },
+	{ 0x00B07E40, 18776, 24, 1, 713 },
+	{ 0x00B07E44, 18799, 2, 1, 737 },
+	{ 0x00B07E48, 18822, 24, 1, 713 },
+	{ 0x00B07E4C, 18845, 2, 1, 737 },
+	{ 0x00B07E50, 18868, 24, 1, 713 },
+	{ 0x00B07E54, 18892, 2, 1, 737 },
+	{ 0x00B07E58, 18916, 24, 1, 713 },
+	{ 0x00B07E5C, 18940, 2, 1, 737 },
+	{ 0x00B07E60, 18964, 24, 1, 713 },
+	{ 0x00B07E64, 18988, 2, 1, 737 },
+	{ 0x00B07E68, 19012, 24, 1, 713 },
+	{ 0x00B07E6C, 19036, 2, 1, 737 },
+	{ 0x00B07E70, 19060, 24, 1, 713 },
+	{ 0x00B07E74, 19084, 2, 1, 737 },
+	{ 0x00B07E78, 19108, 24, 1, 713 },
+	{ 0x00B07E7C, 19132, 2, 1, 737 },
+	{ 0x00B07FFC, 19171, 1, 1, 739 },
+	{ 0x00B08000, 19201, 1, 1, 740 },
+	{ 0x00B08004, 19241, 1, 1, 740 },
+	{ 0x00B08008, 19281, 1, 1, 740 },
+	{ 0x00B0800C, 19301, 1, 1, 740 },
+	{ 0x00B08010, 19321, 1, 1, 740 },
+	{ 0x00B08014, 19350, 1, 1, 740 },
+	{ 0x00B08018, 19379, 1, 1, 740 },
+	{ 0x00B0801C, 19406, 1, 1, 740 },
+	{ 0x00B08020, 19433, 1, 1, 740 },
+	{ 0x00B08024, 19457, 1, 1, 740 },
+	{ 0x00B08028, 19481, 1, 1, 740 },
+	{ 0x00B0802C, 19503, 1, 1, 740 },
+	{ 0x00B08030, 19525, 1, 1, 740 },
+	{ 0x00B08034, 19552, 1, 1, 740 },
+	{ 0x00B08038, 19579, 1, 1, 740 },
+	{ 0x00B0803C, 19607, 1, 1, 740 },
+	{ 0x00B08040, 19635, 1, 1, 740 },
+	{ 0x00B08044, 19665, 1, 1, 740 },
+	{ 0x00B08048, 19695, 1, 1, 740 },
+	{ 0x00B0804C, 19723, 1, 1, 740 },
+	{ 0x00B08050, 19751, 1, 1, 740 },
+	{ 0x00B08054, 19782, 1, 1, 740 },
+	{ 0x00B08080, 19813, 1, 1, 740 },
+	{ 0x00B08084, 19853, 1, 1, 740 },
+	{ 0x00B08088, 19893, 1, 1, 740 },
+	{ 0x00B0808C, 19913, 1, 1, 740 },
+	{ 0x00B08090, 19933, 1, 1, 740 },
+	{ 0x00B08094, 19962, 1, 1, 740 },
+	{ 0x00B08098, 19991, 1, 1, 740 },
+	{ 0x00B0809C, 20018, 1, 1, 740 },
+	{ 0x00B080A0, 20045, 1, 1, 740 },
+	{ 0x00B080A4, 20069, 1, 1, 740 },
+	{ 0x00B080A8, 20093, 1, 1, 740 },
+	{ 0x00B080AC, 20115, 1, 1, 740 },
+	{ 0x00B080B0, 20137, 1, 1, 740 },
+	{ 0x00B080B4, 20164, 1, 1, 740 },
+	{ 0x00B080B8, 20191, 1, 1, 740 },
+	{ 0x00B080BC, 20219, 1, 1, 740 },
+	{ 0x00B080C0, 20247, 1, 1, 740 },
+	{ 0x00B080C4, 20277, 1, 1, 740 },
+	{ 0x00B080C8, 20307, 1, 1, 740 },
+	{ 0x00B080CC, 20335, 1, 1, 740 },
+	{ 0x00B080D0, 20363, 1, 1, 740 },
+	{ 0x00B080D4, 20394, 1, 1, 740 },
+	{ 0x00B08100, 20425, 1, 1, 740 },
+	{ 0x00B08104, 20465, 1, 1, 740 },
+	{ 0x00B08108, 20505, 1, 1, 740 },
+	{ 0x00B0810C, 20525, 1, 1, 740 },
+	{ 0x00B08110, 20545, 1, 1, 740 },
+	{ 0x00B08114, 20574, 1, 1, 740 },
+	{ 0x00B08118, 20603, 1, 1, 740 },
+	{ 0x00B0811C, 20630, 1, 1, 740 },
+	{ 0x00B08120, 20657, 1, 1, 740 },
+	{ 0x00B08124, 20681, 1, 1, 740 },
+	{ 0x00B08128, 20705, 1, 1, 740 },
+	{ 0x00B0812C, 20727, 1, 1, 740 },
+	{ 0x00B08130, 20749, 1, 1, 740 },
+	{ 0x00B08134, 20776, 1, 1, 740 },
+	{ 0x00B08138, 20803, 1, 1, 740 },
+	{ 0x00B0813C, 20831, 1, 1, 740 },
+	{ 0x00B08140, 20859, 1, 1, 740 },
+	{ 0x00B08144, 20889, 1, 1, 740 },
+	{ 0x00B08148, 20919, 1, 1, 740 },
+	{ 0x00B0814C, 20947, 1, 1, 740 },
+	{ 0x00B08150, 20975, 1, 1, 740 },
+	{ 0x00B08154, 21006, 1, 1, 740 },
+	{ 0x00B08180, 21037, 1, 1, 740 },
+	{ 0x00B08184, 21077, 1, 1, 740 },
+	{ 0x00B08188, 21117, 1, 1, 740 },
+	{ 0x00B0818C, 21137, 1, 1, 740 },
+	{ 0x00B08190, 21157, 1, 1, 740 },
+	{ 0x00B08194, 21186, 1, 1, 740 },
+	{ 0x00B08198, 21215, 1, 1, 740 },
+	{ 0x00B0819C, 21242, 1, 1, 740 },
+	{ 0x00B081A0, 21269, 1, 1, 740 },
+	{ 0x00B081A4, 21293, 1, 1, 740 },
+	{ 0x00B081A8, 21317, 1, 1, 740 },
+	{ 0x00B081AC, 21339, 1, 1, 740 },
+	{ 0x00B081B0, 21361, 1, 1, 740 },
+	{ 0x00B081B4, 21388, 1, 1, 740 },
+	{ 0x00B081B8, 21415, 1, 1, 740 },
+	{ 0x00B081BC, 21443, 1, 1, 740 },
+	{ 0x00B081C0, 21471, 1, 1, 740 },
+	{ 0x00B081C4, 21501, 1, 1, 740 },
+	{ 0x00B081C8, 21531, 1, 1, 740 },
+	{ 0x00B081CC, 21559, 1, 1, 740 },
+	{ 0x00B081D0, 21587, 1, 1, 740 },
+	{ 0x00B081D4, 21618, 1, 1, 740 },
+	{ 0x00B08200, 21649, 1, 1, 740 },
+	{ 0x00B08204, 21689, 1, 1, 740 },
+	{ 0x00B08208, 21729, 1, 1, 740 },
+	{ 0x00B0820C, 21749, 1, 1, 740 },
+	{ 0x00B08210, 21769, 1, 1, 740 },
+	{ 0x00B08214, 21798, 1, 1, 740 },
+	{ 0x00B08218, 21827, 1, 1, 740 },
+	{ 0x00B0821C, 21854, 1, 1, 740 },
+	{ 0x00B08220, 21881, 1, 1, 740 },
+	{ 0x00B08224, 21905, 1, 1, 740 },
+	{ 0x00B08228, 21929, 1, 1, 740 },
+	{ 0x00B0822C, 21951, 1, 1, 740 },
+	{ 0x00B08230, 21973, 1, 1, 740 },
+	{ 0x00B08234, 22000, 1, 1, 740 },
+	{ 0x00B08238, 22027, 1, 1, 740 },
+	{ 0x00B0823C, 22055, 1, 1, 740 },
+	{ 0x00B08240, 22083, 1, 1, 740 },
+	{ 0x00B08244, 22113, 1, 1, 740 },
+	{ 0x00B08248, 22143, 1, 1, 740 },
+	{ 0x00B0824C, 22171, 1, 1, 740 },
+	{ 0x00B08250, 22199, 1, 1, 740 },
+	{ 0x00B08254, 22230, 1, 1, 740 },
+	{ 0x00B08280, 22261, 1, 1, 740 },
+	{ 0x00B08284, 22301, 1, 1, 740 },
+	{ 0x00B08288, 22341, 1, 1, 740 },
+	{ 0x00B0828C, 22361, 1, 1, 740 },
+	{ 0x00B08290, 22381, 1, 1, 740 },
+	{ 0x00B08294, 22410, 1, 1, 740 },
+	{ 0x00B08298, 22439, 1, 1, 740 },
+	{ 0x00B0829C, 22466, 1, 1, 740 },
+	{ 0x00B082A0, 22493, 1, 1, 740 },
+	{ 0x00B082A4, 22517, 1, 1, 740 },
+	{ 0x00B082A8, 22541, 1, 1, 740 },
+	{ 0x00B082AC, 22563, 1, 1, 740 },
+	{ 0x00B082B0, 22585, 1, 1, 740 },
+	{ 0x00B082B4, 22612, 1, 1, 740 },
+	{ 0x00B082B8, 22639, 1, 1, 740 },
+	{ 0x00B082BC, 22667, 1, 1, 740 },
+	{ 0x00B082C0, 22695, 1, 1, 740 },
+	{ 0x00B082C4, 22725, 1, 1, 740 },
+	{ 0x00B082C8, 22755, 1, 1, 740 },
+	{ 0x00B082CC, 22783, 1, 1, 740 },
+	{ 0x00B082D0, 22811, 1, 1, 740 },
+	{ 0x00B082D4, 22842, 1, 1, 740 },
+	{ 0x00B08300, 22873, 1, 1, 740 },
+	{ 0x00B08304, 22913, 1, 1, 740 },
+	{ 0x00B08308, 22953, 1, 1, 740 },
+	{ 0x00B0830C, 22973, 1, 1, 740 },
+	{ 0x00B08310, 22993, 1, 1, 740 },
+	{ 0x00B08314, 23022, 1, 1, 740 },
+	{ 0x00B08318, 23051, 1, 1, 740 },
+	{ 0x00B0831C, 23078, 1, 1, 740 },
+	{ 0x00B08320, 23105, 1, 1, 740 },
+	{ 0x00B08324, 23129, 1, 1, 740 },
+	{ 0x00B08328, 23153, 1, 1, 740 },
+	{ 0x00B0832C, 23175, 1, 1, 740 },
+	{ 0x00B08330, 23197, 1, 1, 740 },
+	{ 0x00B08334, 23224, 1, 1, 740 },
+	{ 0x00B08338, 23251, 1, 1, 740 },
+	{ 0x00B0833C, 23279, 1, 1, 740 },
+	{ 0x00B08340, 23307, 1, 1, 740 },
+	{ 0x00B08344, 23337, 1, 1, 740 },
+	{ 0x00B08348, 23367, 1, 1, 740 },
+	{ 0x00B0834C, 23395, 1, 1, 740 },
+	{ 0x00B08350, 23423, 1, 1, 740 },
+	{ 0x00B08354, 23454, 1, 1, 740 },
+	{ 0x00B08380, 23485, 1, 1, 740 },
+	{ 0x00B08384, 23525, 1, 1, 740 },
+	{ 0x00B08388, 23565, 1, 1, 740 },
+	{ 0x00B0838C, 23585, 1, 1, 740 },
+	{ 0x00B08390, 23605, 1, 1, 740 },
+	{ 0x00B08394, 23634, 1, 1, 740 },
+	{ 0x00B08398, 23663, 1, 1, 740 },
+	{ 0x00B0839C, 23690, 1, 1, 740 },
+	{ 0x00B083A0, 23717, 1, 1, 740 },
+	{ 0x00B083A4, 23741, 1, 1, 740 },
+	{ 0x00B083A8, 23765, 1, 1, 740 },
+	{ 0x00B083AC, 23787, 1, 1, 740 },
+	{ 0x00B083B0, 23809, 1, 1, 740 },
+	{ 0x00B083B4, 23836, 1, 1, 740 },
+	{ 0x00B083B8, 23863, 1, 1, 740 },
+	{ 0x00B083BC, 23891, 1, 1, 740 },
+	{ 0x00B083C0, 23919, 1, 1, 740 },
+	{ 0x00B083C4, 23949, 1, 1, 740 },
+	{ 0x00B083C8, 23979, 1, 1, 740 },
+	{ 0x00B083CC, 24007, 1, 1, 740 },
+	{ 0x00B083D0, 24035, 1, 1, 740 },
+	{ 0x00B083D4, 24066, 1, 1, 740 },
+	{ 0x00B08400, 24097, 1, 1, 740 },
+	{ 0x00B08404, 24137, 1, 1, 740 },
+	{ 0x00B08408, 24177, 1, 1, 740 },
+	{ 0x00B0840C, 24197, 1, 1, 740 },
+	{ 0x00B08410, 24217, 1, 1, 740 },
+	{ 0x00B08414, 24246, 1, 1, 740 },
+	{ 0x00B08418, 24275, 1, 1, 740 },
+	{ 0x00B0841C, 24302, 1, 1, 740 },
+	{ 0x00B08420, 24329, 1, 1, 740 },
+	{ 0x00B08424, 24353, 1, 1, 740 },
+	{ 0x00B08428, 24377, 1, 1, 740 },
+	{ 0x00B0842C, 24399, 1, 1, 740 },
+	{ 0x00B08430, 24421, 1, 1, 740 },
+	{ 0x00B08434, 24448, 1, 1, 740 },
+	{ 0x00B08438, 24475, 1, 1, 740 },
+	{ 0x00B0843C, 24503, 1, 1, 740 },
+	{ 0x00B08440, 24531, 1, 1, 740 },
+	{ 0x00B08444, 24561, 1, 1, 740 },
+	{ 0x00B08448, 24591, 1, 1, 740 },
+	{ 0x00B0844C, 24619, 1, 1, 740 },
+	{ 0x00B08450, 24647, 1, 1, 740 },
+	{ 0x00B08454, 24678, 1, 1, 740 },
+	{ 0x00B08480, 24709, 1, 1, 740 },
+	{ 0x00B08484, 24749, 1, 1, 740 },
+	{ 0x00B08488, 24789, 1, 1, 740 },
+	{ 0x00B0848C, 24809, 1, 1, 740 },
+	{ 0x00B08490, 24829, 1, 1, 740 },
+	{ 0x00B08494, 24858, 1, 1, 740 },
+	{ 0x00B08498, 24887, 1, 1, 740 },
+	{ 0x00B0849C, 24914, 1, 1, 740 },
+	{ 0x00B084A0, 24941, 1, 1, 740 },
+	{ 0x00B084A4, 24965, 1, 1, 740 },
+	{ 0x00B084A8, 24989, 1, 1, 740 },
+	{ 0x00B084AC, 25011, 1, 1, 740 },
+	{ 0x00B084B0, 25033, 1, 1, 740 },
+	{ 0x00B084B4, 25060, 1, 1, 740 },
+	{ 0x00B084B8, 25087, 1, 1, 740 },
+	{ 0x00B084BC, 25115, 1, 1, 740 },
+	{ 0x00B084C0, 25143, 1, 1, 740 },
+	{ 0x00B084C4, 25173, 1, 1, 740 },
+	{ 0x00B084C8, 25203, 1, 1, 740 },
+	{ 0x00B084CC, 25231, 1, 1, 740 },
+	{ 0x00B084D0, 25259, 1, 1, 740 },
+	{ 0x00B084D4, 25290, 1, 1, 740 },
+	{ 0x00B08500, 25321, 1, 1, 740 },
+	{ 0x00B08504, 25362, 1, 1, 740 },
+	{ 0x00B08508, 25403, 1, 1, 740 },
+	{ 0x00B0850C, 25424, 1, 1, 740 },
+	{ 0x00B08510, 25445, 1, 1, 740 },
+	{ 0x00B08514, 25475, 1, 1, 740 },
+	{ 0x00B08518, 25505, 1, 1, 740 },
+	{ 0x00B0851C, 25533, 1, 1, 740 },
+	{ 0x00B08520, 25561, 1, 1, 740 },
+	{ 0x00B08524, 25586, 1, 1, 740 },
+	{ 0x00B08528, 25611, 1, 1, 740 },
+	{ 0x00B0852C, 25634, 1, 1, 740 },
+	{ 0x00B08530, 25657, 1, 1, 740 },
+	{ 0x00B08534, 25685, 1, 1, 740 },
+	{ 0x00B08538, 25713, 1, 1, 740 },
+	{ 0x00B0853C, 25742, 1, 1, 740 },
+	{ 0x00B08540, 25771, 1, 1, 740 },
+	{ 0x00B08544, 25802, 1, 1, 740 },
+	{ 0x00B08548, 25833, 1, 1, 740 },
+	{ 0x00B0854C, 25862, 1, 1, 740 },
+	{ 0x00B08550, 25891, 1, 1, 740 },
+	{ 0x00B08554, 25923, 1, 1, 740 },
+	{ 0x00B08580, 25955, 1, 1, 740 },
+	{ 0x00B08584, 25996, 1, 1, 740 },
+	{ 0x00B08588, 26037, 1, 1, 740 },
+	{ 0x00B0858C, 26058, 1, 1, 740 },
+	{ 0x00B08590, 26079, 1, 1, 740 },
+	{ 0x00B08594, 26109, 1, 1, 740 },
+	{ 0x00B08598, 26139, 1, 1, 740 },
+	{ 0x00B0859C, 26167, 1, 1, 740 },
+	{ 0x00B085A0, 26195, 1, 1, 740 },
+	{ 0x00B085A4, 26220, 1, 1, 740 },
+	{ 0x00B085A8, 26245, 1, 1, 740 },
+	{ 0x00B085AC, 26268, 1, 1, 740 },
+	{ 0x00B085B0, 26291, 1, 1, 740 },
+	{ 0x00B085B4, 26319, 1, 1, 740 },
+	{ 0x00B085B8, 26347, 1, 1, 740 },
+	{ 0x00B085BC, 26376, 1, 1, 740 },
+	{ 0x00B085C0, 26405, 1, 1, 740 },
+	{ 0x00B085C4, 26436, 1, 1, 740 },
+	{ 0x00B085C8, 26467, 1, 1, 740 },
+	{ 0x00B085CC, 26496, 1, 1, 740 },
+	{ 0x00B085D0, 26525, 1, 1, 740 },
+	{ 0x00B085D4, 26557, 1, 1, 740 },
+	{ 0x00B08600, 26589, 1, 1, 740 },
+	{ 0x00B08604, 26630, 1, 1, 740 },
+	{ 0x00B08608, 26671, 1, 1, 740 },
+	{ 0x00B0860C, 26692, 1, 1, 740 },
+	{ 0x00B08610, 26713, 1, 1, 740 },
+	{ 0x00B08614, 26743, 1, 1, 740 },
+	{ 0x00B08618, 26773, 1, 1, 740 },
+	{ 0x00B0861C, 26801, 1, 1, 740 },
+	{ 0x00B08620, 26829, 1, 1, 740 },
+	{ 0x00B08624, 26854, 1, 1, 740 },
+	{ 0x00B08628, 26879, 1, 1, 740 },
+	{ 0x00B0862C, 26902, 1, 1, 740 },
+	{ 0x00B08630, 26925, 1, 1, 740 },
+	{ 0x00B08634, 26953, 1, 1, 740 },
+	{ 0x00B08638, 26981, 1, 1, 740 },
+	{ 0x00B0863C, 27010, 1, 1, 740 },
+	{ 0x00B08640, 27039, 1, 1, 740 },
+	{ 0x00B08644, 27070, 1, 1, 740 },
+	{ 0x00B08648, 27101, 1, 1, 740 },
+	{ 0x00B0864C, 27130, 1, 1, 740 },
+	{ 0x00B08650, 27159, 1, 1, 740 },
+	{ 0x00B08654, 27191, 1, 1, 740 },
+	{ 0x00B08680, 27223, 1, 1, 740 },
+	{ 0x00B08684, 27264, 1, 1, 740 },
+	{ 0x00B08688, 27305, 1, 1, 740 },
+	{ 0x00B0868C, 27326, 1, 1, 740 },
+	{ 0x00B08690, 27347, 1, 1, 740 },
+	{ 0x00B08694, 27377, 1, 1, 740 },
+	{ 0x00B08698, 27407, 1, 1, 740 },
+	{ 0x00B0869C, 27435, 1, 1, 740 },
+	{ 0x00B086A0, 27463, 1, 1, 740 },
+	{ 0x00B086A4, 27488, 1, 1, 740 },
+	{ 0x00B086A8, 27513, 1, 1, 740 },
+	{ 0x00B086AC, 27536, 1, 1, 740 },
+	{ 0x00B086B0, 27559, 1, 1, 740 },
+	{ 0x00B086B4, 27587, 1, 1, 740 },
+	{ 0x00B086B8, 27615, 1, 1, 740 },
+	{ 0x00B086BC, 27644, 1, 1, 740 },
+	{ 0x00B086C0, 27673, 1, 1, 740 },
+	{ 0x00B086C4, 27704, 1, 1, 740 },
+	{ 0x00B086C8, 27735, 1, 1, 740 },
+	{ 0x00B086CC, 27764, 1, 1, 740 },
+	{ 0x00B086D0, 27793, 1, 1, 740 },
+	{ 0x00B086D4, 27825, 1, 1, 740 },
+	{ 0x00B08700, 27857, 1, 1, 740 },
+	{ 0x00B08704, 27898, 1, 1, 740 },
+	{ 0x00B08708, 27939, 1, 1, 740 },
+	{ 0x00B0870C, 27960, 1, 1, 740 },
+	{ 0x00B08710, 27981, 1, 1, 740 },
+	{ 0x00B08714, 28011, 1, 1, 740 },
+	{ 0x00B08718, 28041, 1, 1, 740 },
+	{ 0x00B0871C, 28069, 1, 1, 740 },
+	{ 0x00B08720, 28097, 1, 1, 740 },
+	{ 0x00B08724, 28122, 1, 1, 740 },
+	{ 0x00B08728, 28147, 1, 1, 740 },
+	{ 0x00B0872C, 28170, 1, 1, 740 },
+	{ 0x00B08730, 28193, 1, 1, 740 },
+	{ 0x00B08734, 28221, 1, 1, 740 },
+	{ 0x00B08738, 28249, 1, 1, 740 },
+	{ 0x00B0873C, 28278, 1, 1, 740 },
+	{ 0x00B08740, 28307, 1, 1, 740 },
+	{ 0x00B08744, 28338, 1, 1, 740 },
+	{ 0x00B08748, 28369, 1, 1, 740 },
+	{ 0x00B0874C, 28398, 1, 1, 740 },
+	{ 0x00B08750, 28427, 1, 1, 740 },
+	{ 0x00B08754, 28459, 1, 1, 740 },
+	{ 0x00B08780, 28491, 1, 1, 740 },
+	{ 0x00B08784, 28532, 1, 1, 740 },
+	{ 0x00B08788, 28573, 1, 1, 740 },
+	{ 0x00B0878C, 28594, 1, 1, 740 },
+	{ 0x00B08790, 28615, 1, 1, 740 },
+	{ 0x00B08794, 28645, 1, 1, 740 },
+	{ 0x00B08798, 28675, 1, 1, 740 },
+	{ 0x00B0879C, 28703, 1, 1, 740 },
+	{ 0x00B087A0, 28731, 1, 1, 740 },
+	{ 0x00B087A4, 28756, 1, 1, 740 },
+	{ 0x00B087A8, 28781, 1, 1, 740 },
+	{ 0x00B087AC, 28804, 1, 1, 740 },
+	{ 0x00B087B0, 28827, 1, 1, 740 },
+	{ 0x00B087B4, 28855, 1, 1, 740 },
+	{ 0x00B087B8, 28883, 1, 1, 740 },
+	{ 0x00B087BC, 28912, 1, 1, 740 },
+	{ 0x00B087C0, 28941, 1, 1, 740 },
+	{ 0x00B087C4, 28972, 1, 1, 740 },
+	{ 0x00B087C8, 29003, 1, 1, 740 },
+	{ 0x00B087CC, 29032, 1, 1, 740 },
+	{ 0x00B087D0, 29061, 1, 1, 740 },
+	{ 0x00B087D4, 29093, 1, 1, 740 },
+	{ 0x00B08800, 29125, 1, 1, 740 },
+	{ 0x00B08804, 29166, 1, 1, 740 },
+	{ 0x00B08808, 29207, 1, 1, 740 },
+	{ 0x00B0880C, 29228, 1, 1, 740 },
+	{ 0x00B08810, 29249, 1, 1, 740 },
+	{ 0x00B08814, 29279, 1, 1, 740 },
+	{ 0x00B08818, 29309, 1, 1, 740 },
+	{ 0x00B0881C, 29337, 1, 1, 740 },
+	{ 0x00B08820, 29365, 1, 1, 740 },
+	{ 0x00B08824, 29390, 1, 1, 740 },
+	{ 0x00B08828, 29415, 1, 1, 740 },
+	{ 0x00B0882C, 29438, 1, 1, 740 },
+	{ 0x00B08830, 29461, 1, 1, 740 },
+	{ 0x00B08834, 29489, 1, 1, 740 },
+	{ 0x00B08838, 29517, 1, 1, 740 },
+	{ 0x00B0883C, 29546, 1, 1, 740 },
+	{ 0x00B08840, 29575, 1, 1, 740 },
+	{ 0x00B08844, 29606, 1, 1, 740 },
+	{ 0x00B08848, 29637, 1, 1, 740 },
+	{ 0x00B0884C, 29666, 1, 1, 740 },
+	{ 0x00B08850, 29695, 1, 1, 740 },
+	{ 0x00B08854, 29727, 1, 1, 740 },
+	{ 0x00B08880, 29759, 1, 1, 740 },
+	{ 0x00B08884, 29800, 1, 1, 740 },
+	{ 0x00B08888, 29841, 1, 1, 740 },
+	{ 0x00B0888C, 29862, 1, 1, 740 },
+	{ 0x00B08890, 29883, 1, 1, 740 },
+	{ 0x00B08894, 29913, 1, 1, 740 },
+	{ 0x00B08898, 29943, 1, 1, 740 },
+	{ 0x00B0889C, 29971, 1, 1, 740 },
+	{ 0x00B088A0, 29999, 1, 1, 740 },
+	{ 0x00B088A4, 30024, 1, 1, 740 },
+	{ 0x00B088A8, 30049, 1, 1, 740 },
+	{ 0x00B088AC, 30072, 1, 1, 740 },
+	{ 0x00B088B0, 30095, 1, 1, 740 },
+	{ 0x00B088B4, 30123, 1, 1, 740 },
+	{ 0x00B088B8, 30151, 1, 1, 740 },
+	{ 0x00B088BC, 30180, 1, 1, 740 },
+	{ 0x00B088C0, 30209, 1, 1, 740 },
+	{ 0x00B088C4, 30240, 1, 1, 740 },
+	{ 0x00B088C8, 30271, 1, 1, 740 },
+	{ 0x00B088CC, 30300, 1, 1, 740 },
+	{ 0x00B088D0, 30329, 1, 1, 740 },
+	{ 0x00B088D4, 30361, 1, 1, 740 },
+	{ 0x00B08900, 30393, 1, 1, 740 },
+	{ 0x00B08904, 30434, 1, 1, 740 },
+	{ 0x00B08908, 30475, 1, 1, 740 },
+	{ 0x00B0890C, 30496, 1, 1, 740 },
+	{ 0x00B08910, 30517, 1, 1, 740 },
+	{ 0x00B08914, 30547, 1, 1, 740 },
+	{ 0x00B08918, 30577, 1, 1, 740 },
+	{ 0x00B0891C, 30605, 1, 1, 740 },
+	{ 0x00B08920, 30633, 1, 1, 740 },
+	{ 0x00B08924, 30658, 1, 1, 740 },
+	{ 0x00B08928, 30683, 1, 1, 740 },
+	{ 0x00B0892C, 30706, 1, 1, 740 },
+	{ 0x00B08930, 30729, 1, 1, 740 },
+	{ 0x00B08934, 30757, 1, 1, 740 },
+	{ 0x00B08938, 30785, 1, 1, 740 },
+	{ 0x00B0893C, 30814, 1, 1, 740 },
+	{ 0x00B08940, 30843, 1, 1, 740 },
+	{ 0x00B08944, 30874, 1, 1, 740 },
+	{ 0x00B08948, 30905, 1, 1, 740 },
+	{ 0x00B0894C, 30934, 1, 1, 740 },
+	{ 0x00B08950, 30963, 1, 1, 740 },
+	{ 0x00B08954, 30995, 1, 1, 740 },
+	{ 0x00B08980, 31027, 1, 1, 740 },
+	{ 0x00B08984, 31068, 1, 1, 740 },
+	{ 0x00B08988, 31109, 1, 1, 740 },
+	{ 0x00B0898C, 31130, 1, 1, 740 },
+	{ 0x00B08990, 31151, 1, 1, 740 },
+	{ 0x00B08994, 31181, 1, 1, 740 },
+	{ 0x00B08998, 31211, 1, 1, 740 },
+	{ 0x00B0899C, 31239, 1, 1, 740 },
+	{ 0x00B089A0, 31267, 1, 1, 740 },
+	{ 0x00B089A4, 31292, 1, 1, 740 },
+	{ 0x00B089A8, 31317, 1, 1, 740 },
+	{ 0x00B089AC, 31340, 1, 1, 740 },
+	{ 0x00B089B0, 31363, 1, 1, 740 },
+	{ 0x00B089B4, 31391, 1, 1, 740 },
+	{ 0x00B089B8, 31419, 1, 1, 740 },
+	{ 0x00B089BC, 31448, 1, 1, 740 },
+	{ 0x00B089C0, 31477, 1, 1, 740 },
+	{ 0x00B089C4, 31508, 1, 1, 740 },
+	{ 0x00B089C8, 31539, 1, 1, 740 },
+	{ 0x00B089CC, 31568, 1, 1, 740 },
+	{ 0x00B089D0, 31597, 1, 1, 740 },
+	{ 0x00B089D4, 31629, 1, 1, 740 },
+	{ 0x00B08A00, 31661, 1, 1, 740 },
+	{ 0x00B08A04, 31702, 1, 1, 740 },
+	{ 0x00B08A08, 31743, 1, 1, 740 },
+	{ 0x00B08A0C, 31764, 1, 1, 740 },
+	{ 0x00B08A10, 31785, 1, 1, 740 },
+	{ 0x00B08A14, 31815, 1, 1, 740 },
+	{ 0x00B08A18, 31845, 1, 1, 740 },
+	{ 0x00B08A1C, 31873, 1, 1, 740 },
+	{ 0x00B08A20, 31901, 1, 1, 740 },
+	{ 0x00B08A24, 31926, 1, 1, 740 },
+	{ 0x00B08A28, 31951, 1, 1, 740 },
+	{ 0x00B08A2C, 31974, 1, 1, 740 },
+	{ 0x00B08A30, 31997, 1, 1, 740 },
+	{ 0x00B08A34, 32025, 1, 1, 740 },
+	{ 0x00B08A38, 32053, 1, 1, 740 },
+	{ 0x00B08A3C, 32082, 1, 1, 740 },
+	{ 0x00B08A40, 32111, 1, 1, 740 },
+	{ 0x00B08A44, 32142, 1, 1, 740 },
+	{ 0x00B08A48, 32173, 1, 1, 740 },
+	{ 0x00B08A4C, 32202, 1, 1, 740 },
+	{ 0x00B08A50, 32231, 1, 1, 740 },
+	{ 0x00B08A54, 32263, 1, 1, 740 },
+	{ 0x00B08A80, 32295, 1, 1, 740 },
+	{ 0x00B08A84, 32336, 1, 1, 740 },
+	{ 0x00B08A88, 32377, 1, 1, 740 },
+	{ 0x00B08A8C, 32398, 1, 1, 740 },
+	{ 0x00B08A90, 32419, 1, 1, 740 },
+	{ 0x00B08A94, 32449, 1, 1, 740 },
+	{ 0x00B08A98, 32479, 1, 1, 740 },
+	{ 0x00B08A9C, 32507, 1, 1, 740 },
+	{ 0x00B08AA0, 32535, 1, 1, 740 },
+	{ 0x00B08AA4, 32560, 1, 1, 740 },
+	{ 0x00B08AA8, 32585, 1, 1, 740 },
+	{ 0x00B08AAC, 32608, 1, 1, 740 },
+	{ 0x00B08AB0, 32631, 1, 1, 740 },
+	{ 0x00B08AB4, 32659, 1, 1, 740 },
+	{ 0x00B08AB8, 32687, 1, 1, 740 },
+	{ 0x00B08ABC, 32716, 1, 1, 740 },
+	{ 0x00B08AC0, 32745, 1, 1, 740 },
+	{ 0x00B08AC4, 32776, 1, 1, 740 },
+	{ 0x00B08AC8, 32807, 1, 1, 740 },
+	{ 0x00B08ACC, 32836, 1, 1, 740 },
+	{ 0x00B08AD0, 32865, 1, 1, 740 },
+	{ 0x00B08AD4, 32897, 1, 1, 740 },
+	{ 0x00B08B00, 32929, 1, 1, 740 },
+	{ 0x00B08B04, 32970, 1, 1, 740 },
+	{ 0x00B08B08, 33011, 1, 1, 740 },
+	{ 0x00B08B0C, 33032, 1, 1, 740 },
+	{ 0x00B08B10, 33053, 1, 1, 740 },
+	{ 0x00B08B14, 33083, 1, 1, 740 },
+	{ 0x00B08B18, 33113, 1, 1, 740 },
+	{ 0x00B08B1C, 33141, 1, 1, 740 },
+	{ 0x00B08B20, 33169, 1, 1, 740 },
+	{ 0x00B08B24, 33194, 1, 1, 740 },
+	{ 0x00B08B28, 33219, 1, 1, 740 },
+	{ 0x00B08B2C, 33242, 1, 1, 740 },
+	{ 0x00B08B30, 33265, 1, 1, 740 },
+	{ 0x00B08B34, 33293, 1, 1, 740 },
+	{ 0x00B08B38, 33321, 1, 1, 740 },
+	{ 0x00B08B3C, 33350, 1, 1, 740 },
+	{ 0x00B08B40, 33379, 1, 1, 740 },
+	{ 0x00B08B44, 33410, 1, 1, 740 },
+	{ 0x00B08B48, 33441, 1, 1, 740 },
+	{ 0x00B08B4C, 33470, 1, 1, 740 },
+	{ 0x00B08B50, 33499, 1, 1, 740 },
+	{ 0x00B08B54, 33531, 1, 1, 740 },
+	{ 0x00B08B80, 33563, 1, 1, 740 },
+	{ 0x00B08B84, 33604, 1, 1, 740 },
+	{ 0x00B08B88, 33645, 1, 1, 740 },
+	{ 0x00B08B8C, 33666, 1, 1, 740 },
+	{ 0x00B08B90, 33687, 1, 1, 740 },
+	{ 0x00B08B94, 33717, 1, 1, 740 },
+	{ 0x00B08B98, 33747, 1, 1, 740 },
+	{ 0x00B08B9C, 33775, 1, 1, 740 },
+	{ 0x00B08BA0, 33803, 1, 1, 740 },
+	{ 0x00B08BA4, 33828, 1, 1, 740 },
+	{ 0x00B08BA8, 33853, 1, 1, 740 },
+	{ 0x00B08BAC, 33876, 1, 1, 740 },
+	{ 0x00B08BB0, 33899, 1, 1, 740 },
+	{ 0x00B08BB4, 33927, 1, 1, 740 },
+	{ 0x00B08BB8, 33955, 1, 1, 740 },
+	{ 0x00B08BBC, 33984, 1, 1, 740 },
+	{ 0x00B08BC0, 34013, 1, 1, 740 },
+	{ 0x00B08BC4, 34044, 1, 1, 740 },
+	{ 0x00B08BC8, 34075, 1, 1, 740 },
+	{ 0x00B08BCC, 34104, 1, 1, 740 },
+	{ 0x00B08BD0, 34133, 1, 1, 740 },
+	{ 0x00B08BD4, 34165, 1, 1, 740 },
+	{ 0x00B08C00, 34197, 1, 1, 740 },
+	{ 0x00B08C04, 34238, 1, 1, 740 },
+	{ 0x00B08C08, 34279, 1, 1, 740 },
+	{ 0x00B08C0C, 34300, 1, 1, 740 },
+	{ 0x00B08C10, 34321, 1, 1, 740 },
+	{ 0x00B08C14, 34351, 1, 1, 740 },
+	{ 0x00B08C18, 34381, 1, 1, 740 },
+	{ 0x00B08C1C, 34409, 1, 1, 740 },
+	{ 0x00B08C20, 34437, 1, 1, 740 },
+	{ 0x00B08C24, 34462, 1, 1, 740 },
+	{ 0x00B08C28, 34487, 1, 1, 740 },
+	{ 0x00B08C2C, 34510, 1, 1, 740 },
+	{ 0x00B08C30, 34533, 1, 1, 740 },
+	{ 0x00B08C34, 34561, 1, 1, 740 },
+	{ 0x00B08C38, 34589, 1, 1, 740 },
+	{ 0x00B08C3C, 34618, 1, 1, 740 },
+	{ 0x00B08C40, 34647, 1, 1, 740 },
+	{ 0x00B08C44, 34678, 1, 1, 740 },
+	{ 0x00B08C48, 34709, 1, 1, 740 },
+	{ 0x00B08C4C, 34738, 1, 1, 740 },
+	{ 0x00B08C50, 34767, 1, 1, 740 },
+	{ 0x00B08C54, 34799, 1, 1, 740 },
+	{ 0x00B08C80, 34831, 1, 1, 740 },
+	{ 0x00B08C84, 34872, 1, 1, 740 },
+	{ 0x00B08C88, 34913, 1, 1, 740 },
+	{ 0x00B08C8C, 34934, 1, 1, 740 },
+	{ 0x00B08C90, 34955, 1, 1, 740 },
+	{ 0x00B08C94, 34985, 1, 1, 740 },
+	{ 0x00B08C98, 35015, 1, 1, 740 },
+	{ 0x00B08C9C, 35043, 1, 1, 740 },
+	{ 0x00B08CA0, 35071, 1, 1, 740 },
+	{ 0x00B08CA4, 35096, 1, 1, 740 },
+	{ 0x00B08CA8, 35121, 1, 1, 740 },
+	{ 0x00B08CAC, 35144, 1, 1, 740 },
+	{ 0x00B08CB0, 35167, 1, 1, 740 },
+	{ 0x00B08CB4, 35195, 1, 1, 740 },
+	{ 0x00B08CB8, 35223, 1, 1, 740 },
+	{ 0x00B08CBC, 35252, 1, 1, 740 },
+	{ 0x00B08CC0, 35281, 1, 1, 740 },
+	{ 0x00B08CC4, 35312, 1, 1, 740 },
+	{ 0x00B08CC8, 35343, 1, 1, 740 },
+	{ 0x00B08CCC, 35372, 1, 1, 740 },
+	{ 0x00B08CD0, 35401, 1, 1, 740 },
+	{ 0x00B08CD4, 35433, 1, 1, 740 },
+	{ 0x00B08D00, 35465, 1, 1, 740 },
+	{ 0x00B08D04, 35506, 1, 1, 740 },
+	{ 0x00B08D08, 35547, 1, 1, 740 },
+	{ 0x00B08D0C, 35568, 1, 1, 740 },
+	{ 0x00B08D10, 35589, 1, 1, 740 },
+	{ 0x00B08D14, 35619, 1, 1, 740 },
+	{ 0x00B08D18, 35649, 1, 1, 740 },
+	{ 0x00B08D1C, 35677, 1, 1, 740 },
+	{ 0x00B08D20, 35705, 1, 1, 740 },
+	{ 0x00B08D24, 35730, 1, 1, 740 },
+	{ 0x00B08D28, 35755, 1, 1, 740 },
+	{ 0x00B08D2C, 35778, 1, 1, 740 },
+	{ 0x00B08D30, 35801, 1, 1, 740 },
+	{ 0x00B08D34, 35829, 1, 1, 740 },
+	{ 0x00B08D38, 35857, 1, 1, 740 },
+	{ 0x00B08D3C, 35886, 1, 1, 740 },
+	{ 0x00B08D40, 35915, 1, 1, 740 },
+	{ 0x00B08D44, 35946, 1, 1, 740 },
+	{ 0x00B08D48, 35977, 1, 1, 740 },
+	{ 0x00B08D4C, 36006, 1, 1, 740 },
+	{ 0x00B08D50, 36035, 1, 1, 740 },
+	{ 0x00B08D54, 36067, 1, 1, 740 },
+	{ 0x00B08D80, 36099, 1, 1, 740 },
+	{ 0x00B08D84, 36140, 1, 1, 740 },
+	{ 0x00B08D88, 36181, 1, 1, 740 },
+	{ 0x00B08D8C, 36202, 1, 1, 740 },
+	{ 0x00B08D90, 36223, 1, 1, 740 },
+	{ 0x00B08D94, 36253, 1, 1, 740 },
+	{ 0x00B08D98, 36283, 1, 1, 740 },
+	{ 0x00B08D9C, 36311, 1, 1, 740 },
+	{ 0x00B08DA0, 36339, 1, 1, 740 },
+	{ 0x00B08DA4, 36364, 1, 1, 740 },
+	{ 0x00B08DA8, 36389, 1, 1, 740 },
+	{ 0x00B08DAC, 36412, 1, 1, 740 },
+	{ 0x00B08DB0, 36435, 1, 1, 740 },
+	{ 0x00B08DB4, 36463, 1, 1, 740 },
+	{ 0x00B08DB8, 36491, 1, 1, 740 },
+	{ 0x00B08DBC, 36520, 1, 1, 740 },
+	{ 0x00B08DC0, 36549, 1, 1, 740 },
+	{ 0x00B08DC4, 36580, 1, 1, 740 },
+	{ 0x00B08DC8, 36611, 1, 1, 740 },
+	{ 0x00B08DCC, 36640, 1, 1, 740 },
+	{ 0x00B08DD0, 36669, 1, 1, 740 },
+	{ 0x00B08DD4, 36701, 1, 1, 740 },
+	{ 0x00B08E00, 36733, 1, 1, 740 },
+	{ 0x00B08E04, 36774, 1, 1, 740 },
+	{ 0x00B08E08, 36815, 1, 1, 740 },
+	{ 0x00B08E0C, 36836, 1, 1, 740 },
+	{ 0x00B08E10, 36857, 1, 1, 740 },
+	{ 0x00B08E14, 36887, 1, 1, 740 },
+	{ 0x00B08E18, 36917, 1, 1, 740 },
+	{ 0x00B08E1C, 36945, 1, 1, 740 },
+	{ 0x00B08E20, 36973, 1, 1, 740 },
+	{ 0x00B08E24, 36998, 1, 1, 740 },
+	{ 0x00B08E28, 37023, 1, 1, 740 },
+	{ 0x00B08E2C, 37046, 1, 1, 740 },
+	{ 0x00B08E30, 37069, 1, 1, 740 },
+	{ 0x00B08E34, 37097, 1, 1, 740 },
+	{ 0x00B08E38, 37125, 1, 1, 740 },
+	{ 0x00B08E3C, 37154, 1, 1, 740 },
+	{ 0x00B08E40, 37183, 1, 1, 740 },
+	{ 0x00B08E44, 37214, 1, 1, 740 },
+	{ 0x00B08E48, 37245, 1, 1, 740 },
+	{ 0x00B08E4C, 37274, 1, 1, 740 },
+	{ 0x00B08E50, 37303, 1, 1, 740 },
+	{ 0x00B08E54, 37335, 1, 1, 740 },
+	{ 0x00B08E80, 37367, 1, 1, 740 },
+	{ 0x00B08E84, 37408, 1, 1, 740 },
+	{ 0x00B08E88, 37449, 1, 1, 740 },
+	{ 0x00B08E8C, 37470, 1, 1, 740 },
+	{ 0x00B08E90, 37491, 1, 1, 740 },
+	{ 0x00B08E94, 37521, 1, 1, 740 },
+	{ 0x00B08E98, 37551, 1, 1, 740 },
+	{ 0x00B08E9C, 37579, 1, 1, 740 },
+	{ 0x00B08EA0, 37607, 1, 1, 740 },
+	{ 0x00B08EA4, 37632, 1, 1, 740 },
+	{ 0x00B08EA8, 37657, 1, 1, 740 },
+	{ 0x00B08EAC, 37680, 1, 1, 740 },
+	{ 0x00B08EB0, 37703, 1, 1, 740 },
+	{ 0x00B08EB4, 37731, 1, 1, 740 },
+	{ 0x00B08EB8, 37759, 1, 1, 740 },
+	{ 0x00B08EBC, 37788, 1, 1, 740 },
+	{ 0x00B08EC0, 37817, 1, 1, 740 },
+	{ 0x00B08EC4, 37848, 1, 1, 740 },
+	{ 0x00B08EC8, 37879, 1, 1, 740 },
+	{ 0x00B08ECC, 37908, 1, 1, 740 },
+	{ 0x00B08ED0, 37937, 1, 1, 740 },
+	{ 0x00B08ED4, 37969, 1, 1, 740 },
+	{ 0x00B08F00, 38001, 1, 1, 740 },
+	{ 0x00B08F04, 38042, 1, 1, 740 },
+	{ 0x00B08F08, 38083, 1, 1, 740 },
+	{ 0x00B08F0C, 38104, 1, 1, 740 },
+	{ 0x00B08F10, 38125, 1, 1, 740 },
+	{ 0x00B08F14, 38155, 1, 1, 740 },
+	{ 0x00B08F18, 38185, 1, 1, 740 },
+	{ 0x00B08F1C, 38213, 1, 1, 740 },
+	{ 0x00B08F20, 38241, 1, 1, 740 },
+	{ 0x00B08F24, 38266, 1, 1, 740 },
+	{ 0x00B08F28, 38291, 1, 1, 740 },
+	{ 0x00B08F2C, 38314, 1, 1, 740 },
+	{ 0x00B08F30, 38337, 1, 1, 740 },
+	{ 0x00B08F34, 38365, 1, 1, 740 },
+	{ 0x00B08F38, 38393, 1, 1, 740 },
+	{ 0x00B08F3C, 38422, 1, 1, 740 },
+	{ 0x00B08F40, 38451, 1, 1, 740 },
+	{ 0x00B08F44, 38482, 1, 1, 740 },
+	{ 0x00B08F48, 38513, 1, 1, 740 },
+	{ 0x00B08F4C, 38542, 1, 1, 740 },
+	{ 0x00B08F50, 38571, 1, 1, 740 },
+	{ 0x00B08F54, 38603, 1, 1, 740 },
+	{ 0x00B08F80, 38635, 1, 1, 740 },
+	{ 0x00B08F84, 38676, 1, 1, 740 },
+	{ 0x00B08F88, 38717, 1, 1, 740 },
+	{ 0x00B08F8C, 38738, 1, 1, 740 },
+	{ 0x00B08F90, 38759, 1, 1, 740 },
+	{ 0x00B08F94, 38789, 1, 1, 740 },
+	{ 0x00B08F98, 38819, 1, 1, 740 },
+	{ 0x00B08F9C, 38847, 1, 1, 740 },
+	{ 0x00B08FA0, 38875, 1, 1, 740 },
+	{ 0x00B08FA4, 38900, 1, 1, 740 },
+	{ 0x00B08FA8, 38925, 1, 1, 740 },
+	{ 0x00B08FAC, 38948, 1, 1, 740 },
+	{ 0x00B08FB0, 38971, 1, 1, 740 },
+	{ 0x00B08FB4, 38999, 1, 1, 740 },
+	{ 0x00B08FB8, 39027, 1, 1, 740 },
+	{ 0x00B08FBC, 39056, 1, 1, 740 },
+	{ 0x00B08FC0, 39085, 1, 1, 740 },
+	{ 0x00B08FC4, 39116, 1, 1, 740 },
+	{ 0x00B08FC8, 39147, 1, 1, 740 },
+	{ 0x00B08FCC, 39176, 1, 1, 740 },
+	{ 0x00B08FD0, 39205, 1, 1, 740 },
+	{ 0x00B08FD4, 39237, 1, 1, 740 },
+	{ 0x00B0C000, 39269, 1, 1, 740 },
+	{ 0x00B0C004, 39298, 1, 1, 740 },
+	{ 0x00B0C008, 39327, 1, 1, 740 },
+	{ 0x00B0C00C, 39352, 1, 1, 740 },
+	{ 0x00B0C010, 39377, 1, 1, 740 },
+	{ 0x00B0C014, 39404, 1, 1, 740 },
+	{ 0x00B0C018, 39431, 1, 1, 740 },
+	{ 0x00B0C01C, 39465, 1, 1, 740 },
+	{ 0x00B0C020, 39499, 1, 1, 740 },
+	{ 0x00B0C024, 39534, 1, 1, 740 },
+	{ 0x00B0C080, 39569, 1, 1, 740 },
+	{ 0x00B0C084, 39598, 1, 1, 740 },
+	{ 0x00B0C088, 39627, 1, 1, 740 },
+	{ 0x00B0C08C, 39652, 1, 1, 740 },
+	{ 0x00B0C090, 39677, 1, 1, 740 },
+	{ 0x00B0C094, 39704, 1, 1, 740 },
+	{ 0x00B0C098, 39731, 1, 1, 740 },
+	{ 0x00B0C09C, 39765, 1, 1, 740 },
+	{ 0x00B0C0A0, 39799, 1, 1, 740 },
+	{ 0x00B0C0A4, 39834, 1, 1, 740 },
+	{ 0x00B0C100, 39869, 1, 1, 740 },
+	{ 0x00B0C104, 39898, 1, 1, 740 },
+	{ 0x00B0C108, 39927, 1, 1, 740 },
+	{ 0x00B0C10C, 39952, 1, 1, 740 },
+	{ 0x00B0C110, 39977, 1, 1, 740 },
+	{ 0x00B0C114, 40004, 1, 1, 740 },
+	{ 0x00B0C118, 40031, 1, 1, 740 },
+	{ 0x00B0C11C, 40065, 1, 1, 740 },
+	{ 0x00B0C120, 40099, 1, 1, 740 },
+	{ 0x00B0C124, 40134, 1, 1, 740 },
+	{ 0x00B0C180, 40169, 1, 1, 740 },
+	{ 0x00B0C184, 40198, 1, 1, 740 },
+	{ 0x00B0C188, 40227, 1, 1, 740 },
+	{ 0x00B0C18C, 40252, 1, 1, 740 },
+	{ 0x00B0C190, 40277, 1, 1, 740 },
+	{ 0x00B0C194, 40304, 1, 1, 740 },
+	{ 0x00B0C198, 40331, 1, 1, 740 },
+	{ 0x00B0C19C, 40365, 1, 1, 740 },
+	{ 0x00B0C1A0, 40399, 1, 1, 740 },
+	{ 0x00B0C1A4, 40434, 1, 1, 740 },
+	{ 0x00B0C200, 40469, 1, 1, 740 },
+	{ 0x00B0C204, 40498, 1, 1, 740 },
+	{ 0x00B0C208, 40527, 1, 1, 740 },
+	{ 0x00B0C20C, 40552, 1, 1, 740 },
+	{ 0x00B0C210, 40577, 1, 1, 740 },
+	{ 0x00B0C214, 40604, 1, 1, 740 },
+	{ 0x00B0C218, 40631, 1, 1, 740 },
+	{ 0x00B0C21C, 40665, 1, 1, 740 },
+	{ 0x00B0C220, 40699, 1, 1, 740 },
+	{ 0x00B0C224, 40734, 1, 1, 740 },
+	{ 0x00B0C280, 40769, 1, 1, 740 },
+	{ 0x00B0C284, 40798, 1, 1, 740 },
+	{ 0x00B0C288, 40827, 1, 1, 740 },
+	{ 0x00B0C28C, 40852, 1, 1, 740 },
+	{ 0x00B0C290, 40877, 1, 1, 740 },
+	{ 0x00B0C294, 40904, 1, 1, 740 },
+	{ 0x00B0C298, 40931, 1, 1, 740 },
+	{ 0x00B0C29C, 40965, 1, 1, 740 },
+	{ 0x00B0C2A0, 40999, 1, 1, 740 },
+	{ 0x00B0C2A4, 41034, 1, 1, 740 },
+	{ 0x00B0C300, 41069, 1, 1, 740 },
+	{ 0x00B0C304, 41098, 1, 1, 740 },
+	{ 0x00B0C308, 41127, 1, 1, 740 },
+	{ 0x00B0C30C, 41152, 1, 1, 740 },
+	{ 0x00B0C310, 41177, 1, 1, 740 },
+	{ 0x00B0C314, 41204, 1, 1, 740 },
+	{ 0x00B0C318, 41231, 1, 1, 740 },
+	{ 0x00B0C31C, 41265, 1, 1, 740 },
+	{ 0x00B0C320, 41299, 1, 1, 740 },
+	{ 0x00B0C324, 41334, 1, 1, 740 },
+	{ 0x00B0C380, 41369, 1, 1, 740 },
+	{ 0x00B0C384, 41398, 1, 1, 740 },
+	{ 0x00B0C388, 41427, 1, 1, 740 },
+	{ 0x00B0C38C, 41452, 1, 1, 740 },
+	{ 0x00B0C390, 41477, 1, 1, 740 },
+	{ 0x00B0C394, 41504, 1, 1, 740 },
+	{ 0x00B0C398, 41531, 1, 1, 740 },
+	{ 0x00B0C39C, 41565, 1, 1, 740 },
+	{ 0x00B0C3A0, 41599, 1, 1, 740 },
+	{ 0x00B0C3A4, 41634, 1, 1, 740 },
+	{ 0x00B0C400, 41669, 1, 1, 740 },
+	{ 0x00B0C404, 41696, 1, 1, 740 },
+	{ 0x00B0C408, 41723, 1, 1, 740 },
+	{ 0x00B0C40C, 41742, 1, 1, 740 },
+	{ 0x00B0C410, 41761, 1, 1, 740 },
+	{ 0x00B0C414, 41781, 1, 1, 740 },
+	{ 0x00B0C418, 41801, 1, 1, 740 },
+	{ 0x00B0C41C, 41824, 1, 1, 740 },
+	{ 0x00B0C420, 41847, 1, 1, 740 },
+	{ 0x00B0C424, 41868, 1, 1, 740 },
+	{ 0x00B0C428, 41889, 1, 1, 740 },
+	{ 0x00B0C42C, 41910, 1, 1, 740 },
+	{ 0x00B0C430, 41931, 1, 1, 740 },
+	{ 0x00B0C434, 41958, 1, 1, 740 },
+	{ 0x00B0C438, 41985, 1, 1, 740 },
+	{ 0x00B0C43C, 42005, 1, 1, 740 },
+	{ 0x00B0C440, 42025, 1, 1, 740 },
+	{ 0x00B0C444, 42050, 1, 1, 740 },
+	{ 0x00B0C448, 42075, 1, 1, 740 },
+	{ 0x00B0C44C, 42115, 1, 1, 740 },
+	{ 0x00B0C450, 42155, 1, 1, 740 },
+	{ 0x00B0C454, 42197, 1, 1, 740 },
+	{ 0x00B0C458, 42239, 1, 1, 740 },
+	{ 0x00B0C45C, 42276, 1, 1, 740 },
+	{ 0x00B0C460, 42313, 1, 1, 740 },
+	{ 0x00B0C464, 42352, 1, 1, 740 },
+	{ 0x00B0C468, 42391, 1, 1, 740 },
+	{ 0x00B0C46C, 42414, 1, 1, 740 },
+	{ 0x00B0C800, 42474, 2, 1, 741 },
+	{ 0x00B0C804, 42533, 2, 1, 743 },
+	{ 0x00B0C808, 42573, 1, 1, 745 },
+	{ 0x00B0C80C, 42644, 6, 1, 746 },
+	{ 0x00B0C810, 42730, 5, 1, 752 },
+	{ 0x00B0C814, 42791, 2, 1, 757 },
+	{ 0x00B0C818, 42833, 1, 1, 759 },
+	{ 0x00B0C820, 42872, 1, 1, 760 },
+	{ 0x00B0C824, 42916, 1, 1, 761 },
+	{ 0x00B0C830, 42959, 1, 1, 762 },
+	{ 0x00B0C834, 43003, 1, 1, 763 },
+	{ 0x00B0C840, 43036, 1, 1, 764 },
+	{ 0x00B0C844, 43098, 4, 1, 765 },
+	{ 0x00B0C848, 43131, 1, 1, 769 },
+	{ 0x00B0C850, 43162, 1, 1, 770 },
+	{ 0x00B0C900, 43193, 1, 1, 771 },
+	{ 0x00B0C904, 43216, 1, 1, 771 },
+	{ 0x00B0C908, 43239, 1, 1, 771 },
+	{ 0x00B0C90C, 43262, 1, 1, 771 },
+	{ 0x00B0C910, 43285, 1, 1, 771 },
+	{ 0x00B0C914, 43308, 1, 1, 771 },
+	{ 0x00B0C918, 43331, 1, 1, 771 },
+	{ 0x00B0C91C, 43354, 1, 1, 771 },
+	{ 0x00B0C920, 43377, 1, 1, 771 },
+	{ 0x00B0C924, 43400, 1, 1, 771 },
+	{ 0x00B0C928, 43423, 1, 1, 771 },
+	{ 0x00B0C92C, 43447, 1, 1, 771 },
+	{ 0x00B0C930, 43471, 1, 1, 771 },
+	{ 0x00B0C934, 43495, 1, 1, 771 },
+	{ 0x00B0C938, 43519, 1, 1, 771 },
+	{ 0x00B0C93C, 43543, 1, 1, 771 },
+	{ 0x00B0C940, 43567, 1, 1, 771 },
+	{ 0x00B0C944, 43591, 1, 1, 771 },
+	{ 0x00B0C948, 43615, 1, 1, 771 },
+	{ 0x00B0C94C, 43639, 1, 1, 771 },
+	{ 0x00B0C950, 43663, 1, 1, 771 },
+	{ 0x00B0C954, 43687, 1, 1, 771 },
+	{ 0x00B0C958, 43711, 1, 1, 771 },
+	{ 0x00B0C95C, 43735, 1, 1, 771 },
+	{ 0x00B0C960, 43759, 1, 1, 771 },
+	{ 0x00B0C964, 43783, 1, 1, 771 },
+	{ 0x00B0C968, 43807, 1, 1, 771 },
+	{ 0x00B0C96C, 43831, 1, 1, 771 },
+	{ 0x00B0C970, 43855, 1, 1, 771 },
+	{ 0x00B0C974, 43879, 1, 1, 771 },
+	{ 0x00B0C978, 43903, 1, 1, 771 },
+	{ 0x00B0C97C, 43927, 1, 1, 771 },
+	{ 0x00B0E000, 43966, 2, 1, 772 },
+	{ 0x00B0E004, 44146, 19, 1, 774 },
+	{ 0x00B0E008, 44168, 2, 1, 793 },
+	{ 0x00B0E010, 44188, 2, 1, 772 },
+	{ 0x00B0E014, 44210, 19, 1, 774 },
+	{ 0x00B0E018, 44232, 2, 1, 793 },
+	{ 0x00B0E020, 44252, 2, 1, 772 },
+	{ 0x00B0E024, 44274, 19, 1, 774 },
+	{ 0x00B0E028, 44296, 2, 1, 793 },
+	{ 0x00B0E030, 44316, 2, 1, 772 },
+	{ 0x00B0E034, 44338, 19, 1, 774 },
+	{ 0x00B0E038, 44360, 2, 1, 793 },
+	{ 0x00B0E040, 44380, 2, 1, 772 },
+	{ 0x00B0E044, 44402, 19, 1, 774 },
+	{ 0x00B0E048, 44424, 2, 1, 793 },
+	{ 0x00B0E050, 44444, 2, 1, 772 },
+	{ 0x00B0E054, 44466, 19, 1, 774 },
+	{ 0x00B0E058, 44488, 2, 1, 793 },
+	{ 0x00B0E060, 44508, 2, 1, 772 },
+	{ 0x00B0E064, 44530, 19, 1, 774 },
+	{ 0x00B0E068, 44552, 2, 1, 793 },
+	{ 0x00B0E070, 44572, 2, 1, 772 },
+	{ 0x00B0E074, 44594, 19, 1, 774 },
+	{ 0x00B0E078, 44616, 2, 1, 793 },
+	{ 0x00B0E080, 44636, 2, 1, 772 },
+	{ 0x00B0E084, 44658, 19, 1, 774 },
+	{ 0x00B0E088, 44680, 2, 1, 793 },
+	{ 0x00B0E090, 44700, 2, 1, 772 },
+	{ 0x00B0E094, 44722, 19, 1, 774 },
+	{ 0x00B0E098, 44744, 2, 1, 793 },
+	{ 0x00B0E0A0, 44764, 2, 1, 772 },
+	{ 0x00B0E0A4, 44787, 19, 1, 774 },
+	{ 0x00B0E0A8, 44810, 2, 1, 793 },
+	{ 0x00B0E0B0, 44831, 2, 1, 772 },
+	{ 0x00B0E0B4, 44854, 19, 1, 774 },
+	{ 0x00B0E0B8, 44877, 2, 1, 793 },
+	{ 0x00B0E0C0, 44898, 2, 1, 772 },
+	{ 0x00B0E0C4, 44921, 19, 1, 774 },
+	{ 0x00B0E0C8, 44944, 2, 1, 793 },
+	{ 0x00B0E0D0, 44965, 2, 1, 772 },
+	{ 0x00B0E0D4, 44988, 19, 1, 774 },
+	{ 0x00B0E0D8, 45011, 2, 1, 793 },
+	{ 0x00B0E0E0, 45032, 2, 1, 772 },
+	{ 0x00B0E0E4, 45055, 19, 1, 774 },
+	{ 0x00B0E0E8, 45078, 2, 1, 793 },
+	{ 0x00B0E0F0, 45099, 2, 1, 772 },
+	{ 0x00B0E0F4, 45122, 19, 1, 774 },
+	{ 0x00B0E0F8, 45145, 2, 1, 793 },
+	{ 0x00B0E100, 45166, 2, 1, 772 },
+	{ 0x00B0E104, 45189, 19, 1, 774 },
+	{ 0x00B0E108, 45212, 2, 1, 793 },
+	{ 0x00B0E110, 45233, 2, 1, 772 },
+	{ 0x00B0E114, 45256, 19, 1, 774 },
+	{ 0x00B0E118, 45279, 2, 1, 793 },
+	{ 0x00B0E120, 45300, 2, 1, 772 },
+	{ 0x00B0E124, 45323, 19, 1, 774 },
+	{ 0x00B0E128, 45346, 2, 1, 793 },
+	{ 0x00B0E130, 45367, 2, 1, 772 },
+	{ 0x00B0E134, 45390, 19, 1, 774 },
+	{ 0x00B0E138, 45413, 2, 1, 793 },
+	{ 0x00B0E140, 45434, 2, 1, 772 },
+	{ 0x00B0E144, 45457, 19, 1, 774 },
+	{ 0x00B0E148, 45480, 2, 1, 793 },
+	{ 0x00B0E150, 45501, 2, 1, 772 },
+	{ 0x00B0E154, 45524, 19, 1, 774 },
+	{ 0x00B0E158, 45547, 2, 1, 793 },
+	{ 0x00B0E160, 45568, 2, 1, 772 },
+	{ 0x00B0E164, 45591, 19, 1, 774 },
+	{ 0x00B0E168, 45614, 2, 1, 793 },
+	{ 0x00B0E170, 45635, 2, 1, 772 },
+	{ 0x00B0E174, 45658, 19, 1, 774 },
+	{ 0x00B0E178, 45681, 2, 1, 793 },
+	{ 0x00B0E180, 45702, 2, 1, 772 },
+	{ 0x00B0E184, 45725, 19, 1, 774 },
+	{ 0x00B0E188, 45748, 2, 1, 793 },
+	{ 0x00B0E190, 45769, 2, 1, 772 },
+	{ 0x00B0E194, 45792, 19, 1, 774 },
+	{ 0x00B0E198, 45815, 2, 1, 793 },
+	{ 0x00B0E1A0, 45836, 2, 1, 772 },
+	{ 0x00B0E1A4, 45859, 19, 1, 774 },
+	{ 0x00B0E1A8, 45882, 2, 1, 793 },
+	{ 0x00B0E1B0, 45903, 2, 1, 772 },
+	{ 0x00B0E1B4, 45926, 19, 1, 774 },
+	{ 0x00B0E1B8, 45949, 2, 1, 793 },
+	{ 0x00B0E1C0, 45970, 2, 1, 772 },
+	{ 0x00B0E1C4, 45993, 19, 1, 774 },
+	{ 0x00B0E1C8, 46016, 2, 1, 793 },
+	{ 0x00B0E1D0, 46037, 2, 1, 772 },
+	{ 0x00B0E1D4, 46060, 19, 1, 774 },
+	{ 0x00B0E1D8, 46083, 2, 1, 793 },
+	{ 0x00B0E1E0, 46104, 2, 1, 772 },
+	{ 0x00B0E1E4, 46127, 19, 1, 774 },
+	{ 0x00B0E1E8, 46150, 2, 1, 793 },
+	{ 0x00B0E1F0, 46171, 2, 1, 772 },
+	{ 0x00B0E1F4, 46194, 19, 1, 774 },
+	{ 0x00B0E1F8, 46217, 2, 1, 793 },
+	{ 0x00B0E800, 46238, 1, 1, 544 },
+	{ 0x00B0E840, 46290, 2, 1, 795 },
+	{ 0x00B0E844, 46326, 1, 1, 797 },
+	{ 0x00B0E848, 46370, 6, 1, 798 },
+	{ 0x00B0E850, 46407, 7, 1, 804 },
+	{ 0x00B0E854, 46422, 2, 1, 635 },
+	{ 0x00B0E858, 46438, 2, 1, 637 },
+	{ 0x00B0E85C, 46455, 1, 1, 639 },
+	{ 0x00B0EC00, 46471, 3, 1, 811 },
+	{ 0x00B0EC04, 46553, 13, 1, 814 },
+	{ 0x00B0EC08, 46578, 3, 1, 827 },
+	{ 0x00B0EC40, 46597, 1, 1, 687 },
+	{ 0x00B0F100, 46647, 2, 1, 830 },
+	{ 0x00B0F104, 46669, 2, 1, 830 },
+	{ 0x00B0F108, 46691, 2, 1, 830 },
+	{ 0x00B0F10C, 46713, 2, 1, 830 },
+	{ 0x00B0F110, 46735, 2, 1, 830 },
+	{ 0x00B0F114, 46757, 2, 1, 830 },
+	{ 0x00B0F118, 46779, 2, 1, 830 },
+	{ 0x00B0F11C, 46801, 2, 1, 830 },
+	{ 0x00B0F120, 46823, 2, 1, 830 },
+	{ 0x00B0F124, 46907, 4, 1, 832 },
+	{ 0x00B0F128, 46947, 1, 1, 836 },
+	{ 0x00B0F130, 46986, 1, 1, 837 },
+	{ 0x00B0F134, 47011, 1, 1, 837 },
+	{ 0x00B0F138, 47036, 1, 1, 837 },
+	{ 0x00B0F13C, 47090, 2, 1, 838 },
+	{ 0x00B0F140, 47158, 3, 1, 840 },
+	{ 0x00B0F144, 47253, 5, 1, 843 },
+	{ 0x00B0F400, 47302, 1, 1, 848 },
+	{ 0x00B0F404, 47499, 15, 1, 849 },
+	{ 0x00B0F408, 47578, 4, 1, 864 },
+	{ 0x00B0F40C, 47706, 7, 1, 868 },
+	{ 0x00B0F410, 47992, 16, 1, 875 },
+	{ 0x00B0F414, 48030, 1, 1, 891 },
+	{ 0x00B0F420, 48054, 0, 1, 71 },
+	{ 0x00B0F424, 48083, 0, 1, 71 },
+	{ 0x00B0F428, 48117, 0, 1, 71 },
+	{ 0x00B0F430, 48173, 1, 1, 892 },
+	{ 0x00B0F480, 48201, 0, 1, 71 },
+	{ 0x00B0F484, 48222, 0, 1, 71 },
+	{ 0x00B0F488, 48243, 0, 1, 71 },
+	{ 0x00B0F48C, 48341, 4, 1, 893 },
+	{ 0x00B0F4C0, 48394, 2, 1, 897 },
+	{ 0x00B0F7F8, 48608, 16, 1, 899 },
+	{ 0x00B0F7FC, 48668, 5, 1, 915 },
+	{ 0x00B0F800, 48877, 10, 1, 920 },
+	{ 0x00B0F804, 49045, 10, 1, 930 },
+	{ 0x00B0F808, 49079, 1, 1, 940 },
+	{ 0x00B0F80C, 49122, 1, 1, 941 },
+	{ 0x00B0F810, 49170, 1, 1, 942 },
+	{ 0x00B0F814, 49207, 1, 1, 943 },
+	{ 0x00B0F818, 49240, 1, 1, 944 },
+	{ 0x00B0F81C, 49257, 5, 1, 915 },
+	{ 0x00B0FFF4, 49394, 11, 1, 945 },
+	{ 0x00B0FFF8, 49449, 3, 1, 956 },
+	{ 0x00B0FFFC, 49468, 5, 1, 915 },
+	{ 0x00B24000, 49488, 1, 1, 495 },
+	{ 0x00B24004, 49515, 2, 1, 496 },
+	{ 0x00B24008, 49542, 1, 1, 498 },
+	{ 0x00B2400C, 49569, 2, 1, 499 },
+	{ 0x00B24010, 49596, 13, 1, 501 },
+	{ 0x00B2401C, 49622, 24, 1, 959 },
+	{ 0x00B24020, 49638, 3, 1, 541 },
+	{ 0x00B24040, 49659, 1, 1, 495 },
+	{ 0x00B24044, 49686, 2, 1, 496 },
+	{ 0x00B24048, 49713, 1, 1, 498 },
+	{ 0x00B2404C, 49740, 2, 1, 499 },
+	{ 0x00B24050, 49767, 13, 1, 501 },
+	{ 0x00B2405C, 49793, 24, 1, 959 },
+	{ 0x00B24060, 49809, 3, 1, 541 },
+	{ 0x00B24080, 49830, 1, 1, 495 },
+	{ 0x00B24084, 49857, 2, 1, 496 },
+	{ 0x00B24088, 49884, 1, 1, 498 },
+	{ 0x00B2408C, 49911, 2, 1, 499 },
+	{ 0x00B24090, 49938, 13, 1, 501 },
+	{ 0x00B2409C, 49964, 24, 1, 959 },
+	{ 0x00B240A0, 49980, 3, 1, 541 },
+	{ 0x00B240C0, 50001, 1, 1, 495 },
+	{ 0x00B240C4, 50028, 2, 1, 496 },
+	{ 0x00B240C8, 50055, 1, 1, 498 },
+	{ 0x00B240CC, 50082, 2, 1, 499 },
+	{ 0x00B240D0, 50109, 13, 1, 501 },
+	{ 0x00B240DC, 50135, 24, 1, 959 },
+	{ 0x00B240E0, 50151, 3, 1, 541 },
+	{ 0x00B24100, 50172, 1, 1, 495 },
+	{ 0x00B24104, 50199, 2, 1, 496 },
+	{ 0x00B24108, 50226, 1, 1, 498 },
+	{ 0x00B2410C, 50253, 2, 1, 499 },
+	{ 0x00B24110, 50280, 13, 1, 501 },
+	{ 0x00B2411C, 50306, 24, 1, 959 },
+	{ 0x00B24120, 50322, 3, 1, 541 },
+	{ 0x00B24140, 50343, 1, 1, 495 },
+	{ 0x00B24144, 50370, 2, 1, 496 },
+	{ 0x00B24148, 50397, 1, 1, 498 },
+	{ 0x00B2414C, 50424, 2, 1, 499 },
+	{ 0x00B24150, 50451, 13, 1, 501 },
+	{ 0x00B2415C, 50477, 24, 1, 959 },
+	{ 0x00B24160, 50493, 3, 1, 541 },
+	{ 0x00B24180, 50514, 1, 1, 495 },
+	{ 0x00B24184, 50541, 2, 1, 496 },
+	{ 0x00B24188, 50568, 1, 1, 498 },
+	{ 0x00B2418C, 50595, 2, 1, 499 },
+	{ 0x00B24190, 50622, 13, 1, 501 },
+	{ 0x00B2419C, 50648, 24, 1, 959 },
+	{ 0x00B241A0, 50664, 3, 1, 541 },
+	{ 0x00B241C0, 50685, 1, 1, 495 },
+	{ 0x00B241C4, 50712, 2, 1, 496 },
+	{ 0x00B241C8, 50739, 1, 1, 498 },
+	{ 0x00B241CC, 50766, 2, 1, 499 },
+	{ 0x00B241D0, 50793, 13, 1, 501 },
+	{ 0x00B241DC, 50819, 24, 1, 959 },
+	{ 0x00B241E0, 50835, 3, 1, 541 },
+	{ 0x00B24200, 50856, 1, 1, 495 },
+	{ 0x00B24204, 50883, 2, 1, 496 },
+	{ 0x00B24208, 50910, 1, 1, 498 },
+	{ 0x00B2420C, 50937, 2, 1, 499 },
+	{ 0x00B24210, 50964, 13, 1, 501 },
+	{ 0x00B2421C, 50990, 24, 1, 959 },
+	{ 0x00B24220, 51006, 3, 1, 541 },
+	{ 0x00B24240, 51027, 1, 1, 495 },
+	{ 0x00B24244, 51054, 2, 1, 496 },
+	{ 0x00B24248, 51081, 1, 1, 498 },
+	{ 0x00B2424C, 51108, 2, 1, 499 },
+	{ 0x00B24250, 51135, 13, 1, 501 },
+	{ 0x00B2425C, 51161, 24, 1, 959 },
+	{ 0x00B24260, 51177, 3, 1, 541 },
+	{ 0x00B24280, 51198, 1, 1, 495 },
+	{ 0x00B24284, 51226, 2, 1, 496 },
+	{ 0x00B24288, 51254, 1, 1, 498 },
+	{ 0x00B2428C, 51282, 2, 1, 499 },
+	{ 0x00B24290, 51310, 13, 1, 501 },
+	{ 0x00B2429C, 51337, 24, 1, 959 },
+	{ 0x00B242A0, 51354, 3, 1, 541 },
+	{ 0x00B242C0, 51376, 1, 1, 495 },
+	{ 0x00B242C4, 51404, 2, 1, 496 },
+	{ 0x00B242C8, 51432, 1, 1, 498 },
+	{ 0x00B242CC, 51460, 2, 1, 499 },
+	{ 0x00B242D0, 51488, 13, 1, 501 },
+	{ 0x00B242DC, 51515, 24, 1, 959 },
+	{ 0x00B242E0, 51532, 3, 1, 541 },
+	{ 0x00B24300, 51554, 1, 1, 495 },
+	{ 0x00B24304, 51582, 2, 1, 496 },
+	{ 0x00B24308, 51610, 1, 1, 498 },
+	{ 0x00B2430C, 51638, 2, 1, 499 },
+	{ 0x00B24310, 51666, 13, 1, 501 },
+	{ 0x00B2431C, 51693, 24, 1, 959 },
+	{ 0x00B24320, 51710, 3, 1, 541 },
+	{ 0x00B24340, 51732, 1, 1, 495 },
+	{ 0x00B24344, 51760, 2, 1, 496 },
+	{ 0x00B24348, 51788, 1, 1, 498 },
+	{ 0x00B2434C, 51816, 2, 1, 499 },
+	{ 0x00B24350, 51844, 13, 1, 501 },
+	{ 0x00B2435C, 51871, 24, 1, 959 },
+	{ 0x00B24360, 51888, 3, 1, 541 },
+	{ 0x00B24380, 51910, 1, 1, 495 },
+	{ 0x00B24384, 51938, 2, 1, 496 },
+	{ 0x00B24388, 51966, 1, 1, 498 },
+	{ 0x00B2438C, 51994, 2, 1, 499 },
+	{ 0x00B24390, 52022, 13, 1, 501 },
+	{ 0x00B2439C, 52049, 24, 1, 959 },
+	{ 0x00B243A0, 52066, 3, 1, 541 },
+	{ 0x00B243C0, 52088, 1, 1, 495 },
+	{ 0x00B243C4, 52116, 2, 1, 496 },
+	{ 0x00B243C8, 52144, 1, 1, 498 },
+	{ 0x00B243CC, 52172, 2, 1, 499 },
+	{ 0x00B243D0, 52200, 13, 1, 501 },
+	{ 0x00B243DC, 52227, 24, 1, 959 },
+	{ 0x00B243E0, 52244, 3, 1, 541 },
+	{ 0x00B24400, 52266, 1, 1, 495 },
+	{ 0x00B24404, 52294, 2, 1, 496 },
+	{ 0x00B24408, 52322, 1, 1, 498 },
+	{ 0x00B2440C, 52350, 2, 1, 499 },
+	{ 0x00B24410, 52378, 13, 1, 501 },
+	{ 0x00B2441C, 52405, 24, 1, 959 },
+	{ 0x00B24420, 52422, 3, 1, 541 },
+	{ 0x00B24440, 52444, 1, 1, 495 },
+	{ 0x00B24444, 52472, 2, 1, 496 },
+	{ 0x00B24448, 52500, 1, 1, 498 },
+	{ 0x00B2444C, 52528, 2, 1, 499 },
+	{ 0x00B24450, 52556, 13, 1, 501 },
+	{ 0x00B2445C, 52583, 24, 1, 959 },
+	{ 0x00B24460, 52600, 3, 1, 541 },
+	{ 0x00B24480, 52622, 1, 1, 495 },
+	{ 0x00B24484, 52650, 2, 1, 496 },
+	{ 0x00B24488, 52678, 1, 1, 498 },
+	{ 0x00B2448C, 52706, 2, 1, 499 },
+	{ 0x00B24490, 52734, 13, 1, 501 },
+	{ 0x00B2449C, 52761, 24, 1, 959 },
+	{ 0x00B244A0, 52778, 3, 1, 541 },
+	{ 0x00B244C0, 52800, 1, 1, 495 },
+	{ 0x00B244C4, 52828, 2, 1, 496 },
+	{ 0x00B244C8, 52856, 1, 1, 498 },
+	{ 0x00B244CC, 52884, 2, 1, 499 },
+	{ 0x00B244D0, 52912, 13, 1, 501 },
+	{ 0x00B244DC, 52939, 24, 1, 959 },
+	{ 0x00B244E0, 52956, 3, 1, 541 },
+	{ 0x00B24500, 52978, 1, 1, 495 },
+	{ 0x00B24504, 53006, 2, 1, 496 },
+	{ 0x00B24508, 53034, 1, 1, 498 },
+	{ 0x00B2450C, 53062, 2, 1, 499 },
+	{ 0x00B24510, 53090, 13, 1, 501 },
+	{ 0x00B2451C, 53117, 24, 1, 959 },
+	{ 0x00B24520, 53134, 3, 1, 541 },
+	{ 0x00B24540, 53156, 1, 1, 495 },
+	{ 0x00B24544, 53184, 2, 1, 496 },
+	{ 0x00B24548, 53212, 1, 1, 498 },
+	{ 0x00B2454C, 53240, 2, 1, 499 },
+	{ 0x00B24550, 53268, 13, 1, 501 },
+	{ 0x00B2455C, 53295, 24, 1, 959 },
+	{ 0x00B24560, 53312, 3, 1, 541 },
+	{ 0x00B24580, 53334, 1, 1, 495 },
+	{ 0x00B24584, 53362, 2, 1, 496 },
+	{ 0x00B24588, 53390, 1, 1, 498 },
+	{ 0x00B2458C, 53418, 2, 1, 499 },
+	{ 0x00B24590, 53446, 13, 1, 501 },
+	{ 0x00B2459C, 53473, 24, 1, 959 },
+	{ 0x00B245A0, 53490, 3, 1, 541 },
+	{ 0x00B245C0, 53512, 1, 1, 495 },
+	{ 0x00B245C4, 53540, 2, 1, 496 },
+	{ 0x00B245C8, 53568, 1, 1, 498 },
+	{ 0x00B245CC, 53596, 2, 1, 499 },
+	{ 0x00B245D0, 53624, 13, 1, 501 },
+	{ 0x00B245DC, 53651, 24, 1, 959 },
+	{ 0x00B245E0, 53668, 3, 1, 541 },
+	{ 0x00B24600, 53690, 1, 1, 495 },
+	{ 0x00B24604, 53718, 2, 1, 496 },
+	{ 0x00B24608, 53746, 1, 1, 498 },
+	{ 0x00B2460C, 53774, 2, 1, 499 },
+	{ 0x00B24610, 53802, 13, 1, 501 },
+	{ 0x00B2461C, 53829, 24, 1, 959 },
+	{ 0x00B24620, 53846, 3, 1, 541 },
+	{ 0x00B24640, 53868, 1, 1, 495 },
+	{ 0x00B24644, 53896, 2, 1, 496 },
+	{ 0x00B24648, 53924, 1, 1, 498 },
+	{ 0x00B2464C, 53952, 2, 1, 499 },
+	{ 0x00B24650, 53980, 13, 1, 501 },
+	{ 0x00B2465C, 54007, 24, 1, 959 },
+	{ 0x00B24660, 54024, 3, 1, 541 },
+	{ 0x00B24680, 54046, 1, 1, 495 },
+	{ 0x00B24684, 54074, 2, 1, 496 },
+	{ 0x00B24688, 54102, 1, 1, 498 },
+	{ 0x00B2468C, 54130, 2, 1, 499 },
+	{ 0x00B24690, 54158, 13, 1, 501 },
+	{ 0x00B2469C, 54185, 24, 1, 959 },
+	{ 0x00B246A0, 54202, 3, 1, 541 },
+	{ 0x00B246C0, 54224, 1, 1, 495 },
+	{ 0x00B246C4, 54252, 2, 1, 496 },
+	{ 0x00B246C8, 54280, 1, 1, 498 },
+	{ 0x00B246CC, 54308, 2, 1, 499 },
+	{ 0x00B246D0, 54336, 13, 1, 501 },
+	{ 0x00B246DC, 54363, 24, 1, 959 },
+	{ 0x00B246E0, 54380, 3, 1, 541 },
+	{ 0x00B24700, 54402, 1, 1, 495 },
+	{ 0x00B24704, 54430, 2, 1, 496 },
+	{ 0x00B24708, 54458, 1, 1, 498 },
+	{ 0x00B2470C, 54486, 2, 1, 499 },
+	{ 0x00B24710, 54514, 13, 1, 501 },
+	{ 0x00B2471C, 54541, 24, 1, 959 },
+	{ 0x00B24720, 54558, 3, 1, 541 },
+	{ 0x00B24740, 54580, 1, 1, 495 },
+	{ 0x00B24744, 54608, 2, 1, 496 },
+	{ 0x00B24748, 54636, 1, 1, 498 },
+	{ 0x00B2474C, 54664, 2, 1, 499 },
+	{ 0x00B24750, 54692, 13, 1, 501 },
+	{ 0x00B2475C, 54719, 24, 1, 959 },
+	{ 0x00B24760, 54736, 3, 1, 541 },
+	{ 0x00B24780, 54758, 1, 1, 495 },
+	{ 0x00B24784, 54786, 2, 1, 496 },
+	{ 0x00B24788, 54814, 1, 1, 498 },
+	{ 0x00B2478C, 54842, 2, 1, 499 },
+	{ 0x00B24790, 54870, 13, 1, 501 },
+	{ 0x00B2479C, 54897, 24, 1, 959 },
+	{ 0x00B247A0, 54914, 3, 1, 541 },
+	{ 0x00B247C0, 54936, 1, 1, 495 },
+	{ 0x00B247C4, 54964, 2, 1, 496 },
+	{ 0x00B247C8, 54992, 1, 1, 498 },
+	{ 0x00B247CC, 55020, 2, 1, 499 },
+	{ 0x00B247D0, 55048, 13, 1, 501 },
+	{ 0x00B247DC, 55075, 24, 1, 959 },
+	{ 0x00B247E0, 55092, 3, 1, 541 },
+	{ 0x00B26000, 55114, 1, 1, 544 },
+	{ 0x00B26040, 55137, 1, 1, 545 },
+	{ 0x00B26080, 55160, 1, 1, 546 },
+	{ 0x00B260C0, 55180, 1, 1, 547 },
+	{ 0x00B26100, 55202, 6, 1, 548 },
+	{ 0x00B26104, 55229, 3, 1, 554 },
+	{ 0x00B27000, 55333, 14, 1, 983 },
+	{ 0x00B27004, 55354, 14, 1, 983 },
+	{ 0x00B27008, 55375, 14, 1, 983 },
+	{ 0x00B2700C, 55396, 14, 1, 983 },
+	{ 0x00B27010, 55417, 14, 1, 983 },
+	{ 0x00B27014, 55438, 14, 1, 983 },
+	{ 0x00B27018, 55459, 14, 1, 983 },
+	{ 0x00B2701C, 55480, 14, 1, 983 },
+	{ 0x00B27020, 55501, 14, 1, 983 },
+	{ 0x00B27024, 55522, 14, 1, 983 },
+	{ 0x00B27028, 55543, 14, 1, 983 },
+	{ 0x00B2702C, 55565, 14, 1, 983 },
+	{ 0x00B27030, 55587, 14, 1, 983 },
+	{ 0x00B27034, 55609, 14, 1, 983 },
+	{ 0x00B27038, 55631, 14, 1, 983 },
+	{ 0x00B2703C, 55653, 14, 1, 983 },
+	{ 0x00B27040, 55675, 14, 1, 983 },
+	{ 0x00B27044, 55697, 14, 1, 983 },
+	{ 0x00B27048, 55719, 14, 1, 983 },
+	{ 0x00B2704C, 55741, 14, 1, 983 },
+	{ 0x00B27050, 55763, 14, 1, 983 },
+	{ 0x00B27054, 55785, 14, 1, 983 },
+	{ 0x00B27058, 55807, 14, 1, 983 },
+	{ 0x00B2705C, 55829, 14, 1, 983 },
+	{ 0x00B27060, 55851, 14, 1, 983 },
+	{ 0x00B27064, 55873, 14, 1, 983 },
+	{ 0x00B27068, 55895, 14, 1, 983 },
+	{ 0x00B2706C, 55917, 14, 1, 983 },
+	{ 0x00B27070, 55939, 14, 1, 983 },
+	{ 0x00B27074, 55961, 14, 1, 983 },
+	{ 0x00B27078, 55983, 14, 1, 983 },
+	{ 0x00B2707C, 56005, 14, 1, 983 },
+	{ 0x00B27800, 56027, 1, 1, 498 },
+	{ 0x00B27804, 56050, 2, 1, 567 },
+	{ 0x00B27808, 56076, 1, 1, 498 },
+	{ 0x00B2780C, 56099, 2, 1, 567 },
+	{ 0x00B27810, 56125, 1, 1, 498 },
+	{ 0x00B27814, 56148, 2, 1, 567 },
+	{ 0x00B27818, 56174, 1, 1, 498 },
+	{ 0x00B2781C, 56197, 2, 1, 567 },
+	{ 0x00B27820, 56223, 1, 1, 498 },
+	{ 0x00B27824, 56246, 2, 1, 567 },
+	{ 0x00B27828, 56272, 1, 1, 498 },
+	{ 0x00B2782C, 56295, 2, 1, 567 },
+	{ 0x00B27830, 56321, 1, 1, 498 },
+	{ 0x00B27834, 56344, 2, 1, 567 },
+	{ 0x00B27838, 56370, 1, 1, 498 },
+	{ 0x00B2783C, 56393, 2, 1, 567 },
+	{ 0x00B27840, 56419, 1, 1, 498 },
+	{ 0x00B27844, 56442, 2, 1, 567 },
+	{ 0x00B27848, 56468, 1, 1, 498 },
+	{ 0x00B2784C, 56491, 2, 1, 567 },
+	{ 0x00B27850, 56517, 1, 1, 569 },
+	{ 0x00B27854, 56541, 1, 1, 569 },
+	{ 0x00B27858, 56565, 1, 1, 569 },
+	{ 0x00B2785C, 56589, 1, 1, 569 },
+	{ 0x00B27860, 56613, 1, 1, 569 },
+	{ 0x00B27864, 56637, 1, 1, 569 },
+	{ 0x00B27868, 56661, 1, 1, 569 },
+	{ 0x00B2786C, 56685, 1, 1, 569 },
+	{ 0x00B27880, 56709, 1, 1, 498 },
+	{ 0x00B27884, 56733, 1, 1, 570 },
+	{ 0x00B27888, 56757, 1, 1, 498 },
+	{ 0x00B2788C, 56779, 1, 1, 570 },
+	{ 0x00B27890, 56801, 1, 1, 498 },
+	{ 0x00B27894, 56827, 2, 1, 571 },
+	{ 0x00B27898, 56853, 1, 1, 498 },
+	{ 0x00B2789C, 56879, 1, 1, 570 },
+	{ 0x00B278F8, 56905, 26, 1, 573 },
+	{ 0x00B278FC, 56924, 29, 1, 599 },
+	{ 0x00B27900, 56945, 7, 1, 628 },
+	{ 0x00B27904, 56961, 2, 1, 635 },
+	{ 0x00B27908, 56978, 2, 1, 637 },
+	{ 0x00B2790C, 56996, 1, 1, 639 },
+	{ 0x00B27940, 57013, 8, 1, 640 },
+	{ 0x00B27944, 57032, 12, 1, 997 },
+	{ 0x00B27948, 57053, 12, 1, 997 },
+	{ 0x00B2794C, 57073, 3, 1, 1009 },
+	{ 0x00B2797C, 57095, 7, 1, 668 },
+	{ 0x00B27984, 57113, 1, 1, 675 },
+	{ 0x00B27A00, 57134, 1, 1, 770 },
+	{ 0x00B27C00, 57155, 29, 1, 599 },
+	{ 0x00B27C20, 57175, 7, 1, 676 },
+	{ 0x00B27C24, 57190, 4, 1, 683 },
+	{ 0x00B27C40, 57208, 1, 1, 687 },
+	{ 0x00B27C80, 57230, 3, 1, 688 },
+	{ 0x00B27C84, 57249, 7, 1, 691 },
+	{ 0x00B27C88, 57268, 2, 1, 698 },
+	{ 0x00B27D00, 57287, 1, 1, 700 },
+	{ 0x00B27D04, 57309, 2, 1, 701 },
+	{ 0x00B27D08, 57331, 1, 1, 703 },
+	{ 0x00B27D0C, 57353, 1, 1, 704 },
+	{ 0x00B27D10, 57375, 1, 1, 705 },
+	{ 0x00B27D14, 57401, 1, 1, 706 },
+	{ 0x00B27D18, 57427, 1, 1, 707 },
+	{ 0x00B27D1C, 57450, 1, 1, 708 },
+	{ 0x00B27D20, 57473, 1, 1, 709 },
+	{ 0x00B27D24, 57494, 1, 1, 710 },
+	{ 0x00B27D28, 57513, 1, 1, 711 },
+	{ 0x00B27D30, 57538, 1, 1, 712 },
+	{ 0x00B27D34, 57563, 1, 1, 712 },
+	{ 0x00B27D38, 57588, 1, 1, 712 },
+	{ 0x00B27D3C, 57613, 1, 1, 712 },
+	{ 0x00B27E00, 57638, 23, 1, 1012 },
+	{ 0x00B27E04, 57661, 2, 1, 737 },
+	{ 0x00B27E08, 57684, 23, 1, 1012 },
+	{ 0x00B27E0C, 57707, 2, 1, 737 },
+	{ 0x00B27E10, 57730, 23, 1, 1012 },
+	{ 0x00B27E14, 57753, 2, 1, 737 },
+	{ 0x00B27E18, 57776, 23, 1, 1012 },
+	{ 0x00B27E1C, 57799, 2, 1, 737 },
+	{ 0x00B27E20, 57822, 23, 1, 1012 },
+	{ 0x00B27E24, 57845, 2, 1, 737 },
+	{ 0x00B27E28, 57868, 23, 1, 1012 },
+	{ 0x00B27E2C, 57891, 2, 1, 737 },
+	{ 0x00B27E30, 57914, 23, 1, 1012 },
+	{ 0x00B27E34, 57937, 2, 1, 737 },
+	{ 0x00B27E38, 57960, 23, 1, 1012 },
+	{ 0x00B27E3C, 57983, 2, 1, 737 },
+	{ 0x00B27E40, 58006, 23, 1, 1012 },
+	{ 0x00B27E44, 58029, 2, 1, 737 },
+	{ 0x00B27E48, 58052, 23, 1, 1012 },
+	{ 0x00B27E4C, 58075, 2, 1, 737 },
+	{ 0x00B27E50, 58098, 23, 1, 1012 },
+	{ 0x00B27E54, 58122, 2, 1, 737 },
+	{ 0x00B27E58, 58146, 23, 1, 1012 },
+	{ 0x00B27E5C, 58170, 2, 1, 737 },
+	{ 0x00B27E60, 58194, 23, 1, 1012 },
+	{ 0x00B27E64, 58218, 2, 1, 737 },
+	{ 0x00B27E68, 58242, 23, 1, 1012 },
+	{ 0x00B27E6C, 58266, 2, 1, 737 },
+	{ 0x00B27E70, 58290, 23, 1, 1012 },
+	{ 0x00B27E74, 58314, 2, 1, 737 },
+	{ 0x00B27E78, 58338, 23, 1, 1012 },
+	{ 0x00B27E7C, 58362, 2, 1, 737 },
+	{ 0x00B27FFC, 58386, 1, 1, 739 },
+	{ 0x00B28000, 58408, 1, 1, 740 },
+	{ 0x00B28004, 58449, 1, 1, 740 },
+	{ 0x00B28008, 58490, 1, 1, 740 },
+	{ 0x00B2800C, 58510, 1, 1, 740 },
+	{ 0x00B28010, 58530, 1, 1, 740 },
+	{ 0x00B28014, 58569, 1, 1, 740 },
+	{ 0x00B28018, 58608, 1, 1, 740 },
+	{ 0x00B2801C, 58636, 1, 1, 740 },
+	{ 0x00B28080, 58664, 1, 1, 740 },
+	{ 0x00B28084, 58705, 1, 1, 740 },
+	{ 0x00B28088, 58746, 1, 1, 740 },
+	{ 0x00B2808C, 58766, 1, 1, 740 },
+	{ 0x00B28090, 58786, 1, 1, 740 },
+	{ 0x00B28094, 58825, 1, 1, 740 },
+	{ 0x00B28098, 58864, 1, 1, 740 },
+	{ 0x00B2809C, 58892, 1, 1, 740 },
+	{ 0x00B28100, 58920, 1, 1, 740 },
+	{ 0x00B28104, 58961, 1, 1, 740 },
+	{ 0x00B28108, 59002, 1, 1, 740 },
+	{ 0x00B2810C, 59022, 1, 1, 740 },
+	{ 0x00B28110, 59042, 1, 1, 740 },
+	{ 0x00B28114, 59081, 1, 1, 740 },
+	{ 0x00B28118, 59120, 1, 1, 740 },
+	{ 0x00B2811C, 59148, 1, 1, 740 },
+	{ 0x00B28180, 59176, 1, 1, 740 },
+	{ 0x00B28184, 59217, 1, 1, 740 },
+	{ 0x00B28188, 59258, 1, 1, 740 },
+	{ 0x00B2818C, 59278, 1, 1, 740 },
+	{ 0x00B28190, 59298, 1, 1, 740 },
+	{ 0x00B28194, 59337, 1, 1, 740 },
+	{ 0x00B28198, 59376, 1, 1, 740 },
+	{ 0x00B2819C, 59404, 1, 1, 740 },
+	{ 0x00B28200, 59432, 1, 1, 740 },
+	{ 0x00B28204, 59473, 1, 1, 740 },
+	{ 0x00B28208, 59514, 1, 1, 740 },
+	{ 0x00B2820C, 59534, 1, 1, 740 },
+	{ 0x00B28210, 59554, 1, 1, 740 },
+	{ 0x00B28214, 59593, 1, 1, 740 },
+	{ 0x00B28218, 59632, 1, 1, 740 },
+	{ 0x00B2821C, 59660, 1, 1, 740 },
+	{ 0x00B28280, 59688, 1, 1, 740 },
+	{ 0x00B28284, 59729, 1, 1, 740 },
+	{ 0x00B28288, 59770, 1, 1, 740 },
+	{ 0x00B2828C, 59790, 1, 1, 740 },
+	{ 0x00B28290, 59810, 1, 1, 740 },
+	{ 0x00B28294, 59849, 1, 1, 740 },
+	{ 0x00B28298, 59888, 1, 1, 740 },
+	{ 0x00B2829C, 59916, 1, 1, 740 },
+	{ 0x00B28300, 59944, 1, 1, 740 },
+	{ 0x00B28304, 59985, 1, 1, 740 },
+	{ 0x00B28308, 60026, 1, 1, 740 },
+	{ 0x00B2830C, 60046, 1, 1, 740 },
+	{ 0x00B28310, 60066, 1, 1, 740 },
+	{ 0x00B28314, 60105, 1, 1, 740 },
+	{ 0x00B28318, 60144, 1, 1, 740 },
+	{ 0x00B2831C, 60172, 1, 1, 740 },
+	{ 0x00B28380, 60200, 1, 1, 740 },
+	{ 0x00B28384, 60241, 1, 1, 740 },
+	{ 0x00B28388, 60282, 1, 1, 740 },
+	{ 0x00B2838C, 60302, 1, 1, 740 },
+	{ 0x00B28390, 60322, 1, 1, 740 },
+	{ 0x00B28394, 60361, 1, 1, 740 },
+	{ 0x00B28398, 60400, 1, 1, 740 },
+	{ 0x00B2839C, 60428, 1, 1, 740 },
+	{ 0x00B28400, 60456, 1, 1, 740 },
+	{ 0x00B28404, 60497, 1, 1, 740 },
+	{ 0x00B28408, 60538, 1, 1, 740 },
+	{ 0x00B2840C, 60558, 1, 1, 740 },
+	{ 0x00B28410, 60578, 1, 1, 740 },
+	{ 0x00B28414, 60617, 1, 1, 740 },
+	{ 0x00B28418, 60656, 1, 1, 740 },
+	{ 0x00B2841C, 60684, 1, 1, 740 },
+	{ 0x00B28480, 60712, 1, 1, 740 },
+	{ 0x00B28484, 60753, 1, 1, 740 },
+	{ 0x00B28488, 60794, 1, 1, 740 },
+	{ 0x00B2848C, 60814, 1, 1, 740 },
+	{ 0x00B28490, 60834, 1, 1, 740 },
+	{ 0x00B28494, 60873, 1, 1, 740 },
+	{ 0x00B28498, 60912, 1, 1, 740 },
+	{ 0x00B2849C, 60940, 1, 1, 740 },
+	{ 0x00B28500, 60968, 1, 1, 740 },
+	{ 0x00B28504, 61010, 1, 1, 740 },
+	{ 0x00B28508, 61052, 1, 1, 740 },
+	{ 0x00B2850C, 61073, 1, 1, 740 },
+	{ 0x00B28510, 61094, 1, 1, 740 },
+	{ 0x00B28514, 61134, 1, 1, 740 },
+	{ 0x00B28518, 61174, 1, 1, 740 },
+	{ 0x00B2851C, 61203, 1, 1, 740 },
+	{ 0x00B28580, 61232, 1, 1, 740 },
+	{ 0x00B28584, 61274, 1, 1, 740 },
+	{ 0x00B28588, 61316, 1, 1, 740 },
+	{ 0x00B2858C, 61337, 1, 1, 740 },
+	{ 0x00B28590, 61358, 1, 1, 740 },
+	{ 0x00B28594, 61398, 1, 1, 740 },
+	{ 0x00B28598, 61438, 1, 1, 740 },
+	{ 0x00B2859C, 61467, 1, 1, 740 },
+	{ 0x00B28600, 61496, 1, 1, 740 },
+	{ 0x00B28604, 61538, 1, 1, 740 },
+	{ 0x00B28608, 61580, 1, 1, 740 },
+	{ 0x00B2860C, 61601, 1, 1, 740 },
+	{ 0x00B28610, 61622, 1, 1, 740 },
+	{ 0x00B28614, 61662, 1, 1, 740 },
+	{ 0x00B28618, 61702, 1, 1, 740 },
+	{ 0x00B2861C, 61731, 1, 1, 740 },
+	{ 0x00B28680, 61760, 1, 1, 740 },
+	{ 0x00B28684, 61802, 1, 1, 740 },
+	{ 0x00B28688, 61844, 1, 1, 740 },
+	{ 0x00B2868C, 61865, 1, 1, 740 },
+	{ 0x00B28690, 61886, 1, 1, 740 },
+	{ 0x00B28694, 61926, 1, 1, 740 },
+	{ 0x00B28698, 61966, 1, 1, 740 },
+	{ 0x00B2869C, 61995, 1, 1, 740 },
+	{ 0x00B28700, 62024, 1, 1, 740 },
+	{ 0x00B28704, 62066, 1, 1, 740 },
+	{ 0x00B28708, 62108, 1, 1, 740 },
+	{ 0x00B2870C, 62129, 1, 1, 740 },
+	{ 0x00B28710, 62150, 1, 1, 740 },
+	{ 0x00B28714, 62190, 1, 1, 740 },
+	{ 0x00B28718, 62230, 1, 1, 740 },
+	{ 0x00B2871C, 62259, 1, 1, 740 },
+	{ 0x00B28780, 62288, 1, 1, 740 },
+	{ 0x00B28784, 62330, 1, 1, 740 },
+	{ 0x00B28788, 62372, 1, 1, 740 },
+	{ 0x00B2878C, 62393, 1, 1, 740 },
+	{ 0x00B28790, 62414, 1, 1, 740 },
+	{ 0x00B28794, 62454, 1, 1, 740 },
+	{ 0x00B28798, 62494, 1, 1, 740 },
+	{ 0x00B2879C, 62523, 1, 1, 740 },
+	{ 0x00B28800, 62552, 1, 1, 740 },
+	{ 0x00B28804, 62594, 1, 1, 740 },
+	{ 0x00B28808, 62636, 1, 1, 740 },
+	{ 0x00B2880C, 62657, 1, 1, 740 },
+	{ 0x00B28810, 62678, 1, 1, 740 },
+	{ 0x00B28814, 62718, 1, 1, 740 },
+	{ 0x00B28818, 62758, 1, 1, 740 },
+	{ 0x00B2881C, 62787, 1, 1, 740 },
+	{ 0x00B28880, 62816, 1, 1, 740 },
+	{ 0x00B28884, 62858, 1, 1, 740 },
+	{ 0x00B28888, 62900, 1, 1, 740 },
+	{ 0x00B2888C, 62921, 1, 1, 740 },
+	{ 0x00B28890, 62942, 1, 1, 740 },
+	{ 0x00B28894, 62982, 1, 1, 740 },
+	{ 0x00B28898, 63022, 1, 1, 740 },
+	{ 0x00B2889C, 63051, 1, 1, 740 },
+	{ 0x00B28900, 63080, 1, 1, 740 },
+	{ 0x00B28904, 63122, 1, 1, 740 },
+	{ 0x00B28908, 63164, 1, 1, 740 },
+	{ 0x00B2890C, 63185, 1, 1, 740 },
+	{ 0x00B28910, 63206, 1, 1, 740 },
+	{ 0x00B28914, 63246, 1, 1, 740 },
+	{ 0x00B28918, 63286, 1, 1, 740 },
+	{ 0x00B2891C, 63315, 1, 1, 740 },
+	{ 0x00B28980, 63344, 1, 1, 740 },
+	{ 0x00B28984, 63386, 1, 1, 740 },
+	{ 0x00B28988, 63428, 1, 1, 740 },
+	{ 0x00B2898C, 63449, 1, 1, 740 },
+	{ 0x00B28990, 63470, 1, 1, 740 },
+	{ 0x00B28994, 63510, 1, 1, 740 },
+	{ 0x00B28998, 63550, 1, 1, 740 },
+	{ 0x00B2899C, 63579, 1, 1, 740 },
+	{ 0x00B28A00, 63608, 1, 1, 740 },
+	{ 0x00B28A04, 63650, 1, 1, 740 },
+	{ 0x00B28A08, 63692, 1, 1, 740 },
+	{ 0x00B28A0C, 63713, 1, 1, 740 },
+	{ 0x00B28A10, 63734, 1, 1, 740 },
+	{ 0x00B28A14, 63774, 1, 1, 740 },
+	{ 0x00B28A18, 63814, 1, 1, 740 },
+	{ 0x00B28A1C, 63843, 1, 1, 740 },
+	{ 0x00B28A80, 63872, 1, 1, 740 },
+	{ 0x00B28A84, 63914, 1, 1, 740 },
+	{ 0x00B28A88, 63956, 1, 1, 740 },
+	{ 0x00B28A8C, 63977, 1, 1, 740 },
+	{ 0x00B28A90, 63998, 1, 1, 740 },
+	{ 0x00B28A94, 64038, 1, 1, 740 },
+	{ 0x00B28A98, 64078, 1, 1, 740 },
+	{ 0x00B28A9C, 64107, 1, 1, 740 },
+	{ 0x00B28B00, 64136, 1, 1, 740 },
+	{ 0x00B28B04, 64178, 1, 1, 740 },
+	{ 0x00B28B08, 64220, 1, 1, 740 },
+	{ 0x00B28B0C, 64241, 1, 1, 740 },
+	{ 0x00B28B10, 64262, 1, 1, 740 },
+	{ 0x00B28B14, 64302, 1, 1, 740 },
+	{ 0x00B28B18, 64342, 1, 1, 740 },
+	{ 0x00B28B1C, 64371, 1, 1, 740 },
+	{ 0x00B28B80, 64400, 1, 1, 740 },
+	{ 0x00B28B84, 64442, 1, 1, 740 },
+	{ 0x00B28B88, 64484, 1, 1, 740 },
+	{ 0x00B28B8C, 64505, 1, 1, 740 },
+	{ 0x00B28B90, 64526, 1, 1, 740 },
+	{ 0x00B28B94, 64566, 1, 1, 740 },
+	{ 0x00B28B98, 64606, 1, 1, 740 },
+	{ 0x00B28B9C, 64635, 1, 1, 740 },
+	{ 0x00B28C00, 64664, 1, 1, 740 },
+	{ 0x00B28C04, 64706, 1, 1, 740 },
+	{ 0x00B28C08, 64748, 1, 1, 740 },
+	{ 0x00B28C0C, 64769, 1, 1, 740 },
+	{ 0x00B28C10, 64790, 1, 1, 740 },
+	{ 0x00B28C14, 64830, 1, 1, 740 },
+	{ 0x00B28C18, 64870, 1, 1, 740 },
+	{ 0x00B28C1C, 64899, 1, 1, 740 },
+	{ 0x00B28C80, 64928, 1, 1, 740 },
+	{ 0x00B28C84, 64970, 1, 1, 740 },
+	{ 0x00B28C88, 65012, 1, 1, 740 },
+	{ 0x00B28C8C, 65033, 1, 1, 740 },
+	{ 0x00B28C90, 65054, 1, 1, 740 },
+	{ 0x00B28C94, 65094, 1, 1, 740 },
+	{ 0x00B28C98, 65134, 1, 1, 740 },
+	{ 0x00B28C9C, 65163, 1, 1, 740 },
+	{ 0x00B28D00, 65192, 1, 1, 740 },
+	{ 0x00B28D04, 65234, 1, 1, 740 },
+	{ 0x00B28D08, 65276, 1, 1, 740 },
+	{ 0x00B28D0C, 65297, 1, 1, 740 },
+	{ 0x00B28D10, 65318, 1, 1, 740 },
+	{ 0x00B28D14, 65358, 1, 1, 740 },
+	{ 0x00B28D18, 65398, 1, 1, 740 },
+	{ 0x00B28D1C, 65427, 1, 1, 740 },
+	{ 0x00B28D80, 65456, 1, 1, 740 },
+	{ 0x00B28D84, 65498, 1, 1, 740 },
+	{ 0x00B28D88, 65540, 1, 1, 740 },
+	{ 0x00B28D8C, 65561, 1, 1, 740 },
+	{ 0x00B28D90, 65582, 1, 1, 740 },
+	{ 0x00B28D94, 65622, 1, 1, 740 },
+	{ 0x00B28D98, 65662, 1, 1, 740 },
+	{ 0x00B28D9C, 65691, 1, 1, 740 },
+	{ 0x00B28E00, 65720, 1, 1, 740 },
+	{ 0x00B28E04, 65762, 1, 1, 740 },
+	{ 0x00B28E08, 65804, 1, 1, 740 },
+	{ 0x00B28E0C, 65825, 1, 1, 740 },
+	{ 0x00B28E10, 65846, 1, 1, 740 },
+	{ 0x00B28E14, 65886, 1, 1, 740 },
+	{ 0x00B28E18, 65926, 1, 1, 740 },
+	{ 0x00B28E1C, 65955, 1, 1, 740 },
+	{ 0x00B28E80, 65984, 1, 1, 740 },
+	{ 0x00B28E84, 66026, 1, 1, 740 },
+	{ 0x00B28E88, 66068, 1, 1, 740 },
+	{ 0x00B28E8C, 66089, 1, 1, 740 },
+	{ 0x00B28E90, 66110, 1, 1, 740 },
+	{ 0x00B28E94, 66150, 1, 1, 740 },
+	{ 0x00B28E98, 66190, 1, 1, 740 },
+	{ 0x00B28E9C, 66219, 1, 1, 740 },
+	{ 0x00B28F00, 66248, 1, 1, 740 },
+	{ 0x00B28F04, 66290, 1, 1, 740 },
+	{ 0x00B28F08, 66332, 1, 1, 740 },
+	{ 0x00B28F0C, 66353, 1, 1, 740 },
+	{ 0x00B28F10, 66374, 1, 1, 740 },
+	{ 0x00B28F14, 66414, 1, 1, 740 },
+	{ 0x00B28F18, 66454, 1, 1, 740 },
+	{ 0x00B28F1C, 66483, 1, 1, 740 },
+	{ 0x00B28F80, 66512, 1, 1, 740 },
+	{ 0x00B28F84, 66554, 1, 1, 740 },
+	{ 0x00B28F88, 66596, 1, 1, 740 },
+	{ 0x00B28F8C, 66617, 1, 1, 740 },
+	{ 0x00B28F90, 66638, 1, 1, 740 },
+	{ 0x00B28F94, 66678, 1, 1, 740 },
+	{ 0x00B28F98, 66718, 1, 1, 740 },
+	{ 0x00B28F9C, 66747, 1, 1, 740 },
+	{ 0x00B2C000, 66776, 1, 1, 740 },
+	{ 0x00B2C004, 66806, 1, 1, 740 },
+	{ 0x00B2C008, 66836, 1, 1, 740 },
+	{ 0x00B2C00C, 66861, 1, 1, 740 },
+	{ 0x00B2C010, 66886, 1, 1, 740 },
+	{ 0x00B2C014, 66914, 1, 1, 740 },
+	{ 0x00B2C018, 66942, 1, 1, 740 },
+	{ 0x00B2C01C, 66977, 1, 1, 740 },
+	{ 0x00B2C020, 67012, 1, 1, 740 },
+	{ 0x00B2C024, 67048, 1, 1, 740 },
+	{ 0x00B2C080, 67084, 1, 1, 740 },
+	{ 0x00B2C084, 67114, 1, 1, 740 },
+	{ 0x00B2C088, 67144, 1, 1, 740 },
+	{ 0x00B2C08C, 67169, 1, 1, 740 },
+	{ 0x00B2C090, 67194, 1, 1, 740 },
+	{ 0x00B2C094, 67222, 1, 1, 740 },
+	{ 0x00B2C098, 67250, 1, 1, 740 },
+	{ 0x00B2C09C, 67285, 1, 1, 740 },
+	{ 0x00B2C0A0, 67320, 1, 1, 740 },
+	{ 0x00B2C0A4, 67356, 1, 1, 740 },
+	{ 0x00B2C100, 67392, 1, 1, 740 },
+	{ 0x00B2C104, 67422, 1, 1, 740 },
+	{ 0x00B2C108, 67452, 1, 1, 740 },
+	{ 0x00B2C10C, 67477, 1, 1, 740 },
+	{ 0x00B2C110, 67502, 1, 1, 740 },
+	{ 0x00B2C114, 67530, 1, 1, 740 },
+	{ 0x00B2C118, 67558, 1, 1, 740 },
+	{ 0x00B2C11C, 67593, 1, 1, 740 },
+	{ 0x00B2C120, 67628, 1, 1, 740 },
+	{ 0x00B2C124, 67664, 1, 1, 740 },
+	{ 0x00B2C180, 67700, 1, 1, 740 },
+	{ 0x00B2C184, 67730, 1, 1, 740 },
+	{ 0x00B2C188, 67760, 1, 1, 740 },
+	{ 0x00B2C18C, 67785, 1, 1, 740 },
+	{ 0x00B2C190, 67810, 1, 1, 740 },
+	{ 0x00B2C194, 67838, 1, 1, 740 },
+	{ 0x00B2C198, 67866, 1, 1, 740 },
+	{ 0x00B2C19C, 67901, 1, 1, 740 },
+	{ 0x00B2C1A0, 67936, 1, 1, 740 },
+	{ 0x00B2C1A4, 67972, 1, 1, 740 },
+	{ 0x00B2C200, 68008, 1, 1, 740 },
+	{ 0x00B2C204, 68038, 1, 1, 740 },
+	{ 0x00B2C208, 68068, 1, 1, 740 },
+	{ 0x00B2C20C, 68093, 1, 1, 740 },
+	{ 0x00B2C210, 68118, 1, 1, 740 },
+	{ 0x00B2C214, 68146, 1, 1, 740 },
+	{ 0x00B2C218, 68174, 1, 1, 740 },
+	{ 0x00B2C21C, 68209, 1, 1, 740 },
+	{ 0x00B2C220, 68244, 1, 1, 740 },
+	{ 0x00B2C224, 68280, 1, 1, 740 },
+	{ 0x00B2C280, 68316, 1, 1, 740 },
+	{ 0x00B2C284, 68346, 1, 1, 740 },
+	{ 0x00B2C288, 68376, 1, 1, 740 },
+	{ 0x00B2C28C, 68401, 1, 1, 740 },
+	{ 0x00B2C290, 68426, 1, 1, 740 },
+	{ 0x00B2C294, 68454, 1, 1, 740 },
+	{ 0x00B2C298, 68482, 1, 1, 740 },
+	{ 0x00B2C29C, 68517, 1, 1, 740 },
+	{ 0x00B2C2A0, 68552, 1, 1, 740 },
+	{ 0x00B2C2A4, 68588, 1, 1, 740 },
+	{ 0x00B2C300, 68624, 1, 1, 740 },
+	{ 0x00B2C304, 68654, 1, 1, 740 },
+	{ 0x00B2C308, 68684, 1, 1, 740 },
+	{ 0x00B2C30C, 68709, 1, 1, 740 },
+	{ 0x00B2C310, 68734, 1, 1, 740 },
+	{ 0x00B2C314, 68762, 1, 1, 740 },
+	{ 0x00B2C318, 68790, 1, 1, 740 },
+	{ 0x00B2C31C, 68825, 1, 1, 740 },
+	{ 0x00B2C320, 68860, 1, 1, 740 },
+	{ 0x00B2C324, 68896, 1, 1, 740 },
+	{ 0x00B2C380, 68932, 1, 1, 740 },
+	{ 0x00B2C384, 68962, 1, 1, 740 },
+	{ 0x00B2C388, 68992, 1, 1, 740 },
+	{ 0x00B2C38C, 69017, 1, 1, 740 },
+	{ 0x00B2C390, 69042, 1, 1, 740 },
+	{ 0x00B2C394, 69070, 1, 1, 740 },
+	{ 0x00B2C398, 69098, 1, 1, 740 },
+	{ 0x00B2C39C, 69133, 1, 1, 740 },
+	{ 0x00B2C3A0, 69168, 1, 1, 740 },
+	{ 0x00B2C3A4, 69204, 1, 1, 740 },
+	{ 0x00B2C400, 69240, 1, 1, 740 },
+	{ 0x00B2C404, 69267, 1, 1, 740 },
+	{ 0x00B2C408, 69294, 1, 1, 740 },
+	{ 0x00B2C40C, 69314, 1, 1, 740 },
+	{ 0x00B2C410, 69334, 1, 1, 740 },
+	{ 0x00B2C414, 69359, 1, 1, 740 },
+	{ 0x00B2C418, 69384, 1, 1, 740 },
+	{ 0x00B2C41C, 69408, 1, 1, 740 },
+	{ 0x00B2C420, 69432, 1, 1, 740 },
+	{ 0x00B2C424, 69456, 1, 1, 740 },
+	{ 0x00B2C800, 69480, 2, 1, 1035 },
+	{ 0x00B2C804, 69498, 2, 1, 743 },
+	{ 0x00B2C808, 69516, 1, 1, 1037 },
+	{ 0x00B2C80C, 69534, 6, 1, 746 },
+	{ 0x00B2C810, 69552, 5, 1, 752 },
+	{ 0x00B2C814, 69571, 2, 1, 1038 },
+	{ 0x00B2C818, 69589, 1, 1, 1040 },
+	{ 0x00B2C820, 69607, 1, 1, 760 },
+	{ 0x00B2C824, 69629, 1, 1, 761 },
+	{ 0x00B2C830, 69651, 1, 1, 762 },
+	{ 0x00B2C834, 69673, 1, 1, 763 },
+	{ 0x00B2C840, 69695, 1, 1, 1041 },
+	{ 0x00B2C844, 69717, 3, 1, 1042 },
+	{ 0x00B2C848, 69740, 1, 1, 769 },
+	{ 0x00B2C850, 69763, 1, 1, 770 },
+	{ 0x00B2C900, 69787, 1, 1, 1045 },
+	{ 0x00B2C904, 69810, 1, 1, 1045 },
+	{ 0x00B2C908, 69833, 1, 1, 1045 },
+	{ 0x00B2C90C, 69856, 1, 1, 1045 },
+	{ 0x00B2C910, 69879, 1, 1, 1045 },
+	{ 0x00B2C914, 69902, 1, 1, 1045 },
+	{ 0x00B2C918, 69925, 1, 1, 1045 },
+	{ 0x00B2C91C, 69948, 1, 1, 1045 },
+	{ 0x00B2C920, 69971, 1, 1, 1045 },
+	{ 0x00B2C924, 69994, 1, 1, 1045 },
+	{ 0x00B2C928, 70017, 1, 1, 1045 },
+	{ 0x00B2C92C, 70041, 1, 1, 1045 },
+	{ 0x00B2C930, 70065, 1, 1, 1045 },
+	{ 0x00B2C934, 70089, 1, 1, 1045 },
+	{ 0x00B2C938, 70113, 1, 1, 1045 },
+	{ 0x00B2C93C, 70137, 1, 1, 1045 },
+	{ 0x00B2C940, 70161, 1, 1, 1045 },
+	{ 0x00B2C944, 70185, 1, 1, 1045 },
+	{ 0x00B2C948, 70209, 1, 1, 1045 },
+	{ 0x00B2C94C, 70233, 1, 1, 1045 },
+	{ 0x00B2C950, 70257, 1, 1, 1045 },
+	{ 0x00B2C954, 70281, 1, 1, 1045 },
+	{ 0x00B2C958, 70305, 1, 1, 1045 },
+	{ 0x00B2C95C, 70329, 1, 1, 1045 },
+	{ 0x00B2C960, 70353, 1, 1, 1045 },
+	{ 0x00B2C964, 70377, 1, 1, 1045 },
+	{ 0x00B2C968, 70401, 1, 1, 1045 },
+	{ 0x00B2C96C, 70425, 1, 1, 1045 },
+	{ 0x00B2C970, 70449, 1, 1, 1045 },
+	{ 0x00B2C974, 70473, 1, 1, 1045 },
+	{ 0x00B2C978, 70497, 1, 1, 1045 },
+	{ 0x00B2C97C, 70521, 1, 1, 1045 },
+	{ 0x00B2F000, 70545, 1, 1, 770 },
+	{ 0x00B2F100, 70569, 2, 1, 830 },
+	{ 0x00B2F104, 70591, 2, 1, 830 },
+	{ 0x00B2F108, 70613, 2, 1, 830 },
+	{ 0x00B2F10C, 70635, 2, 1, 830 },
+	{ 0x00B2F110, 70657, 2, 1, 830 },
+	{ 0x00B2F114, 70679, 2, 1, 830 },
+	{ 0x00B2F118, 70701, 2, 1, 830 },
+	{ 0x00B2F11C, 70723, 2, 1, 830 },
+	{ 0x00B2F120, 70745, 2, 1, 830 },
+	{ 0x00B2F124, 70769, 3, 1, 1046 },
+	{ 0x00B2F128, 70789, 1, 1, 1049 },
+	{ 0x00B2F130, 70809, 1, 1, 837 },
+	{ 0x00B2F134, 70834, 1, 1, 837 },
+	{ 0x00B2F138, 70859, 1, 1, 837 },
+	{ 0x00B2F13C, 70884, 2, 1, 838 },
+	{ 0x00B2F140, 70907, 3, 1, 840 },
+	{ 0x00B2F144, 70931, 5, 1, 843 },
+	{ 0x00B2F400, 70955, 1, 1, 848 },
+	{ 0x00B2F404, 70982, 15, 1, 849 },
+	{ 0x00B2F408, 71005, 4, 1, 864 },
+	{ 0x00B2F40C, 71029, 7, 1, 868 },
+	{ 0x00B2F410, 71053, 16, 1, 875 },
+	{ 0x00B2F414, 71078, 1, 1, 891 },
+	{ 0x00B2F420, 71102, 0, 1, 71 },
+	{ 0x00B2F424, 71131, 0, 1, 71 },
+	{ 0x00B2F428, 71165, 0, 1, 71 },
+	{ 0x00B2F430, 71199, 1, 1, 892 },
+	{ 0x00B2F480, 71227, 0, 1, 71 },
+	{ 0x00B2F484, 71248, 0, 1, 71 },
+	{ 0x00B2F488, 71269, 0, 1, 71 },
+	{ 0x00B2F48C, 71294, 4, 1, 893 },
+	{ 0x00B2F4C0, 71317, 2, 1, 897 },
+	{ 0x00B2F7F8, 71340, 16, 1, 899 },
+	{ 0x00B2F7FC, 71360, 5, 1, 915 },
+	{ 0x00B2F800, 71379, 10, 1, 920 },
+	{ 0x00B2F804, 71397, 10, 1, 930 },
+	{ 0x00B2F808, 71416, 1, 1, 940 },
+	{ 0x00B2F80C, 71437, 1, 1, 941 },
+	{ 0x00B2F810, 71466, 1, 1, 942 },
+	{ 0x00B2F814, 71492, 1, 1, 943 },
+	{ 0x00B2F818, 71512, 1, 1, 944 },
+	{ 0x00B2F81C, 71529, 5, 1, 915 },
+	{ 0x00B2FFF4, 71546, 11, 1, 945 },
+	{ 0x00B2FFF8, 71566, 3, 1, 956 },
+	{ 0x00B2FFFC, 71585, 5, 1, 915 },
+	{ 0x00D28880, 71611, 1, 1, 1050 },
+	{ 0x00D28884, 71643, 3, 1, 1051 },
+	{ 0x00D28888, 71680, 3, 1, 1054 },
+	{ 0x00D2888C, 71712, 3, 1, 1057 },
+	{ 0x00D28890, 71747, 2, 1, 1060 },
+	{ 0x00D28894, 71797, 3, 1, 1062 },
+	{ 0x00D28898, 71825, 1, 1, 1065 },
+	{ 0x00D2889C, 71851, 1, 1, 1066 },
+	{ 0x00D288A0, 71877, 1, 1, 1067 },
+	{ 0x00D288A4, 71910, 2, 1, 1068 },
+	{ 0x00D288A8, 71938, 1, 1, 1070 },
+	{ 0x00D288AC, 71968, 1, 1, 1071 },
+	{ 0x00D288B0, 71998, 1, 1, 1072 },
+	{ 0x00D288B4, 72023, 1, 1, 1073 },
+	{ 0x00D288B8, 72046, 1, 1, 1074 },
+	{ 0x00D288BC, 72073, 1, 1, 1075 },
+	{ 0x00D288C0, 72245, 15, 1, 1076 },
+	{ 0x00D288C8, 72277, 4, 1, 1091 },
+	{ 0x00D288CC, 72301, 1, 1, 1095 },
+	{ 0x00D288D0, 72319, 1, 1, 1095 },
+	{ 0x00D288D4, 72337, 1, 1, 1095 },
+	{ 0x00D288D8, 72355, 1, 1, 1095 },
+	{ 0x00D288DC, 72373, 1, 1, 1095 },
+	{ 0x00D288E0, 72391, 1, 1, 1095 },
+	{ 0x00D288E4, 72409, 1, 1, 1095 },
+	{ 0x00D288E8, 72427, 1, 1, 1095 },
+	{ 0x00D288EC, 72445, 1, 1, 1095 },
+	{ 0x00D288F0, 72485, 2, 1, 1096 },
+	{ 0x00D288F4, 72533, 3, 1, 1098 },
+	{ 0x00D28C00, 72671, 16, 1, 1101 },
+	{ 0x00D28C04, 72805, 15, 1, 1117 },
+	{ 0x00D28C08, 72866, 5, 1, 1132 },
+	{ 0x00D28C0C, 72906, 2, 1, 1137 },
+	{ 0x00D28C10, 72945, 2, 1, 1139 },
+	{ 0x00D28C14, 72989, 2, 1, 1141 },
+	{ 0x00D28C18, 73025, 2, 1, 1143 },
+	{ 0x00D28C1C, 73052, 1, 1, 1145 },
+	{ 0x00D28C20, 73073, 1, 1, 1146 },
+	{ 0x00D28C24, 73103, 1, 1, 1147 },
+	{ 0x00D28C28, 73133, 2, 1, 1148 },
+	{ 0x00D28C2C, 73170, 1, 1, 1150 },
+	{ 0x00D28C30, 73202, 1, 1, 1150 },
+	{ 0x00D28C34, 73239, 1, 1, 1151 },
+	{ 0x00D28C38, 73272, 1, 1, 1152 },
+	{ 0x00D28C3C, 73311, 1, 1, 1153 },
+	{ 0x00D28C40, 73390, 6, 1, 1154 },
+	{ 0x00D28C44, 73450, 4, 1, 1160 },
+	{ 0x00D28C48, 73484, 1, 1, 1164 },
+	{ 0x00D28C4C, 73512, 1, 1, 1164 },
+	{ 0x00D28C50, 73540, 1, 1, 1164 },
+	{ 0x00D28C54, 73568, 1, 1, 1164 },
+	{ 0x00D28C58, 73596, 1, 1, 1164 },
+	{ 0x00D28C5C, 73624, 1, 1, 1164 },
+	{ 0x00D28C60, 73652, 1, 1, 1164 },
+	{ 0x00D28C64, 73680, 1, 1, 1164 },
+	{ 0x00D28C68, 73708, 1, 1, 1164 },
+	{ 0x00D28C6C, 73736, 1, 1, 1164 },
+	{ 0x00D28C70, 73764, 1, 1, 1164 },
+	{ 0x00D28C74, 73831, 3, 1, 1165 },
+	{ 0x00D28C78, 73874, 2, 1, 1168 },
+	{ 0x00D28C7C, 74066, 13, 1, 1170 },
+	{ 0x00D29000, 74132, 4, 1, 1183 },
+	{ 0x00D29004, 74169, 2, 1, 1187 },
+	{ 0x00D29008, 74195, 2, 1, 1189 },
+	{ 0x00D2900C, 74213, 2, 1, 1189 },
+	{ 0x00D29010, 74231, 2, 1, 1189 },
+	{ 0x00D29014, 74258, 1, 1, 1191 },
+	{ 0x00D29018, 74289, 1, 1, 1192 },
+	{ 0x00D2901C, 74311, 1, 1, 1191 },
+	{ 0x00D29020, 74333, 1, 1, 1192 },
+	{ 0x00D29024, 74364, 1, 1, 1193 },
+	{ 0x00D29028, 74395, 1, 1, 1194 },
+	{ 0x00D2902C, 74417, 1, 1, 1193 },
+	{ 0x00D29030, 74439, 1, 1, 1194 },
+	{ 0x00D29034, 74511, 6, 1, 1195 },
+	{ 0x00D29038, 74548, 2, 1, 1201 },
+	{ 0x00D30000, 74609, 13, 1, 1203 },
+	{ 0x00D30004, 74701, 12, 1, 1216 },
+	{ 0x00D30008, 74747, 2, 1, 1228 },
+	{ 0x00D3000C, 74847, 8, 1, 1230 },
+	{ 0x00D30010, 74956, 11, 1, 1238 },
+	{ 0x00D30014, 75048, 6, 1, 1249 },
+	{ 0x00D30018, 75109, 4, 1, 1255 },
+	{ 0x00D3001C, 75138, 1, 1, 1259 },
+	{ 0x00D300A0, 75170, 1, 1, 1260 },
+	{ 0x00D300A4, 75272, 12, 1, 1261 },
+	{ 0x00D300E0, 75341, 6, 1, 1273 },
+	{ 0x00D300E4, 75369, 1, 1, 1279 },
+	{ 0x00D30120, 75431, 5, 1, 1280 },
+	{ 0x00D30124, 75456, 1, 1, 1259 },
+	{ 0x00D30160, 75653, 15, 1, 1285 },
+	{ 0x00D30164, 75758, 5, 1, 1300 },
+	{ 0x00D30168, 75904, 10, 1, 1305 },
+	{ 0x00D3016C, 75979, 3, 1, 1315 },
+	{ 0x00D30170, 76090, 9, 1, 1318 },
+	{ 0x00D30174, 76115, 1, 1, 1259 },
+	{ 0x00D301A0, 76197, 8, 1, 1327 },
+	{ 0x00D301A4, 76290, 7, 1, 1335 },
+	{ 0x00D301A8, 76325, 1, 1, 1342 },
+	{ 0x00D301AC, 76375, 2, 1, 1343 },
+	{ 0x00D301B0, 76425, 2, 1, 1345 },
+	{ 0x00D301B4, 76468, 2, 1, 1347 },
+	{ 0x00D301B8, 76524, 2, 1, 1349 },
+	{ 0x00D301BC, 76552, 1, 1, 1351 },
+	{ 0x00D30220, 76596, 2, 1, 1352 },
+	{ 0x00D30224, 76631, 1, 1, 1354 },
+	{ 0x00D30228, 76681, 3, 1, 1355 },
+	{ 0x00D3022C, 76713, 3, 1, 1358 },
+	{ 0x00D30238, 76841, 14, 1, 1361 },
+	{ 0x00D3023C, 76940, 7, 1, 1375 },
+	{ 0x00D30240, 77021, 7, 1, 1382 },
+	{ 0x00D30244, 77110, 9, 1, 1389 },
+	{ 0x00D30248, 77169, 5, 1, 1398 },
+	{ 0x00D3024C, 77252, 5, 1, 1403 },
+	{ 0x00D30250, 77311, 7, 1, 1408 },
+	{ 0x00D30254, 77393, 7, 1, 1415 },
+	{ 0x00D30460, 77449, 4, 1, 1422 },
+	{ 0x00D30464, 77473, 1, 1, 1259 },
+	{ 0x00D30600, 77497, 1, 1, 1426 },
+	{ 0x00D30604, 77553, 3, 1, 1427 },
+	{ 0x00D30608, 77579, 1, 1, 396 },
+	{ 0x00D3060C, 77604, 1, 1, 396 },
+	{ 0x00D30E00, 77688, 9, 1, 1430 },
+	{ 0x00D30E04, 77708, 1, 1, 1259 },
+	{ 0x00D30E08, 78036, 16, 1, 1439 },
+	{ 0x00D30E0C, 78287, 13, 1, 1455 },
+	{ 0x00D30E10, 78645, 16, 1, 1468 },
+	{ 0x00D30E14, 78869, 13, 1, 1484 },
+	{ 0x00D30E18, 79202, 16, 1, 1497 },
+	{ 0x00D30E1C, 79458, 13, 1, 1513 },
+	{ 0x00D30E20, 79821, 16, 1, 1526 },
+	{ 0x00D30E24, 80050, 13, 1, 1542 },
+	{ 0x00D30E30, 80088, 1, 1, 1555 },
+	{ 0x00D30E34, 80121, 1, 1, 1555 },
+	{ 0x00D30E90, 80164, 1, 1, 1556 },
+	{ 0x00D30E94, 80199, 1, 1, 1556 },
+	{ 0x00D30ED0, 80241, 1, 1, 1557 },
+	{ 0x00D30ED4, 80270, 1, 1, 1557 },
+	{ 0x00D30EF0, 80307, 1, 1, 1558 },
+	{ 0x00D30EF4, 80337, 1, 1, 1558 },
+	{ 0x00D30F00, 80375, 1, 1, 1559 },
+	{ 0x00D30F04, 80409, 1, 1, 1559 },
+	{ 0x00D30F28, 80452, 1, 1, 1560 },
+	{ 0x00D30F2C, 80481, 1, 1, 1560 },
+	{ 0x00D30F48, 80521, 1, 1, 1561 },
+	{ 0x00D30F4C, 80555, 1, 1, 1561 },
+	{ 0x00D30F50, 80599, 1, 1, 1562 },
+	{ 0x00D30F54, 80632, 1, 1, 1562 },
+	{ 0x00D30FD8, 80674, 1, 1, 1563 },
+	{ 0x00D30FDC, 80699, 1, 1, 1563 },
+	{ 0x00D30FE0, 80733, 1, 1, 1564 },
+	{ 0x00D30FE4, 80758, 1, 1, 1564 },
+	{ 0x00D30FE8, 80792, 1, 1, 1565 },
+	{ 0x00D30FEC, 80817, 1, 1, 1565 },
+	{ 0x00D30FF0, 80851, 1, 1, 1566 },
+	{ 0x00D30FF4, 80876, 1, 1, 1566 },
+	{ 0x00D31600, 81031, 15, 1, 1567 },
+	{ 0x00D31604, 81168, 9, 1, 1582 },
+	{ 0x00D31608, 81218, 2, 1, 1591 },
+	{ 0x00D3160C, 81272, 2, 1, 1593 },
+	{ 0x00D31610, 81309, 1, 1, 1595 },
+	{ 0x00D31614, 81341, 1, 1, 1595 },
+	{ 0x00D31618, 81378, 1, 1, 1596 },
+	{ 0x00D3161C, 81414, 1, 1, 1597 },
+	{ 0x00D31620, 81450, 1, 1, 1595 },
+	{ 0x00D31624, 81489, 1, 1, 1595 },
+	{ 0x00D31628, 81528, 1, 1, 1596 },
+	{ 0x00D3162C, 81578, 2, 1, 1598 },
+	{ 0x00D31630, 81626, 1, 1, 1600 },
+	{ 0x00D31634, 81655, 1, 1, 1600 },
+	{ 0x00D31638, 81690, 1, 1, 1601 },
+	{ 0x00D3163C, 81734, 1, 1, 1354 },
+	{ 0x00D31640, 81898, 12, 1, 1602 },
+	{ 0x00D31644, 81962, 5, 1, 1614 },
+	{ 0x00D31660, 81999, 1, 1, 1619 },
+	{ 0x00D31664, 82052, 2, 1, 1620 },
+	{ 0x00D31668, 82104, 1, 1, 1622 },
+	{ 0x00D3166C, 82144, 1, 1, 1622 },
+	{ 0x00D31680, 82245, 7, 1, 1623 },
+	{ 0x00D31684, 82275, 1, 1, 1630 },
+	{ 0x00D31690, 82313, 1, 1, 1631 },
+	{ 0x00D31694, 82357, 1, 1, 1632 },
+	{ 0x00D31698, 82409, 1, 1, 1633 },
+	{ 0x00D3169C, 82449, 1, 1, 1633 },
+	{ 0x00D316A0, 82496, 1, 1, 1634 },
+	{ 0x00D316A4, 82536, 1, 1, 1634 },
+	{ 0x00D316A8, 82583, 1, 1, 1635 },
+	{ 0x00D316AC, 82622, 1, 1, 1635 },
+	{ 0x00D316B0, 82666, 1, 1, 1636 },
+	{ 0x00D316B4, 82712, 1, 1, 1636 },
+	{ 0x00D316B8, 82763, 1, 1, 1637 },
+	{ 0x00D316BC, 82808, 1, 1, 1637 },
+	{ 0x00D316C0, 82861, 2, 1, 1638 },
+	{ 0x00D316C4, 82907, 1, 1, 1354 },
+	{ 0x00D316C8, 82961, 2, 1, 1640 },
+	{ 0x00D316CC, 83006, 1, 1, 1354 },
+	{ 0x00D316E0, 83138, 6, 1, 1642 },
+	{ 0x00D316E4, 83268, 6, 1, 1648 },
+	{ 0x00D31700, 83299, 1, 1, 1654 },
+	{ 0x00D31704, 83336, 1, 1, 1654 },
+	{ 0x00D31708, 83379, 1, 1, 1655 },
+	{ 0x00D3170C, 83430, 2, 1, 1656 },
+	{ 0x00D31710, 83479, 1, 1, 1658 },
+	{ 0x00D31714, 83505, 1, 1, 1658 },
+	{ 0x00D31718, 83541, 1, 1, 1659 },
+	{ 0x00D3171C, 83564, 1, 1, 1659 },
+	{ 0x00D31780, 83642, 8, 1, 1660 },
+	{ 0x00D31784, 83666, 1, 1, 1354 },
+	{ 0x00D31788, 83695, 1, 1, 1668 },
+	{ 0x00D3178C, 83729, 1, 1, 1668 },
+	{ 0x00D31790, 83768, 1, 1, 1669 },
+	{ 0x00D31794, 83802, 1, 1, 1669 },
+	{ 0x00D31798, 83841, 1, 1, 1670 },
+	{ 0x00D3179C, 83875, 1, 1, 1354 },
+	{ 0x00D317A0, 83936, 3, 1, 1671 },
+	{ 0x00D317A4, 83976, 2, 1, 1674 },
+	{ 0x00D32000, 84009, 13, 1, 1203 },
+	{ 0x00D32004, 84035, 12, 1, 1216 },
+	{ 0x00D32008, 84061, 2, 1, 1228 },
+	{ 0x00D3200C, 84091, 8, 1, 1230 },
+	{ 0x00D32010, 84121, 11, 1, 1238 },
+	{ 0x00D32014, 84147, 6, 1, 1249 },
+	{ 0x00D32018, 84173, 4, 1, 1255 },
+	{ 0x00D3201C, 84202, 1, 1, 1259 },
+	{ 0x00D320A0, 84231, 1, 1, 1260 },
+	{ 0x00D320A4, 84252, 12, 1, 1261 },
+	{ 0x00D320E0, 84273, 6, 1, 1273 },
+	{ 0x00D320E4, 84301, 1, 1, 1279 },
+	{ 0x00D32120, 84329, 5, 1, 1280 },
+	{ 0x00D32124, 84354, 1, 1, 1259 },
+	{ 0x00D32160, 84428, 15, 1, 1676 },
+	{ 0x00D32164, 84457, 5, 1, 1300 },
+	{ 0x00D32168, 84486, 10, 1, 1305 },
+	{ 0x00D3216C, 84515, 3, 1, 1315 },
+	{ 0x00D32170, 84544, 9, 1, 1318 },
+	{ 0x00D32174, 84569, 1, 1, 1259 },
+	{ 0x00D321A0, 84594, 8, 1, 1327 },
+	{ 0x00D321A4, 84625, 7, 1, 1335 },
+	{ 0x00D321A8, 84656, 1, 1, 1342 },
+	{ 0x00D321AC, 84687, 2, 1, 1343 },
+	{ 0x00D321B0, 84718, 2, 1, 1345 },
+	{ 0x00D321B4, 84746, 2, 1, 1347 },
+	{ 0x00D321B8, 84774, 2, 1, 1349 },
+	{ 0x00D321BC, 84802, 1, 1, 1351 },
+	{ 0x00D32220, 84830, 2, 1, 1352 },
+	{ 0x00D32224, 84850, 1, 1, 1354 },
+	{ 0x00D32228, 84870, 3, 1, 1355 },
+	{ 0x00D3222C, 84888, 3, 1, 1358 },
+	{ 0x00D32238, 84906, 14, 1, 1361 },
+	{ 0x00D3223C, 84930, 7, 1, 1375 },
+	{ 0x00D32240, 84954, 7, 1, 1382 },
+	{ 0x00D32244, 84978, 9, 1, 1389 },
+	{ 0x00D32248, 85002, 5, 1, 1398 },
+	{ 0x00D3224C, 85026, 5, 1, 1403 },
+	{ 0x00D32250, 85050, 7, 1, 1408 },
+	{ 0x00D32254, 85074, 7, 1, 1415 },
+	{ 0x00D32460, 85098, 4, 1, 1422 },
+	{ 0x00D32464, 85122, 1, 1, 1259 },
+	{ 0x00D32600, 85146, 1, 1, 1426 },
+	{ 0x00D32604, 85172, 3, 1, 1427 },
+	{ 0x00D32608, 85198, 1, 1, 396 },
+	{ 0x00D3260C, 85223, 1, 1, 396 },
+	{ 0x00D33600, 85255, 15, 1, 1691 },
+	{ 0x00D33604, 85285, 9, 1, 1582 },
+	{ 0x00D33608, 85331, 2, 1, 1706 },
+	{ 0x00D3360C, 85364, 2, 1, 1593 },
+	{ 0x00D33610, 85397, 1, 1, 1595 },
+	{ 0x00D33614, 85429, 1, 1, 1595 },
+	{ 0x00D33618, 85461, 1, 1, 1596 },
+	{ 0x00D3361C, 85497, 1, 1, 1597 },
+	{ 0x00D33620, 85533, 1, 1, 1595 },
+	{ 0x00D33624, 85572, 1, 1, 1595 },
+	{ 0x00D33628, 85611, 1, 1, 1596 },
+	{ 0x00D3362C, 85654, 2, 1, 1598 },
+	{ 0x00D33630, 85697, 1, 1, 1600 },
+	{ 0x00D33634, 85726, 1, 1, 1600 },
+	{ 0x00D33640, 85791, 12, 1, 1708 },
+	{ 0x00D33644, 85867, 5, 1, 1720 },
+	{ 0x00D336B0, 85896, 1, 1, 1636 },
+	{ 0x00D336B4, 85942, 1, 1, 1636 },
+	{ 0x00D336B8, 85988, 1, 1, 1637 },
+	{ 0x00D336BC, 86033, 1, 1, 1637 },
+	{ 0x00D336E0, 86115, 6, 1, 1725 },
+	{ 0x00D336E4, 86139, 6, 1, 1648 },
+	{ 0x00D33700, 86163, 1, 1, 1654 },
+	{ 0x00D33704, 86200, 1, 1, 1654 },
+	{ 0x00D33708, 86237, 1, 1, 1655 },
+	{ 0x00D3370C, 86278, 2, 1, 1656 },
+	{ 0x00D38000, 86472, 16, 1, 1731 },
+	{ 0x00D38004, 86544, 5, 1, 1747 },
+	{ 0x00D38008, 86633, 6, 1, 1752 },
+	{ 0x00D3800C, 86657, 1, 1, 1758 },
+	{ 0x00D38010, 86678, 1, 1, 1758 },
+	{ 0x00D38014, 86706, 1, 1, 1759 },
+	{ 0x00D38018, 86727, 1, 1, 1759 },
+	{ 0x00D3801C, 86748, 1, 1, 1759 },
+	{ 0x00D38020, 86769, 1, 1, 1759 },
+	{ 0x00D38024, 86790, 1, 1, 1759 },
+	{ 0x00D38028, 86811, 1, 1, 1759 },
+	{ 0x00D3802C, 86832, 1, 1, 1759 },
+	{ 0x00D38030, 86853, 1, 1, 1758 },
+	{ 0x00D38034, 86875, 1, 1, 1758 },
+	{ 0x00D38038, 86897, 1, 1, 1759 },
+	{ 0x00D3803C, 86919, 1, 1, 1759 },
+	{ 0x00D38040, 86941, 1, 1, 1759 },
+	{ 0x00D38044, 86963, 1, 1, 1759 },
+	{ 0x00D38048, 86985, 1, 1, 1759 },
+	{ 0x00D3804C, 87007, 1, 1, 1759 },
+	{ 0x00D38050, 87029, 1, 1, 1759 },
+	{ 0x00D38054, 87070, 2, 1, 1760 },
+	{ 0x00D38058, 87179, 9, 1, 1762 },
+	{ 0x00D3805C, 87245, 6, 1, 1771 },
+	{ 0x00D38060, 87284, 2, 1, 1777 },
+	{ 0x00D38064, 87310, 1, 1, 1779 },
+	{ 0x00D38068, 87330, 1, 1, 1780 },
+	{ 0x00D3806C, 87355, 1, 1, 1780 },
+	{ 0x00D38070, 87380, 1, 1, 1780 },
+	{ 0x00D38074, 87405, 1, 1, 1780 },
+	{ 0x00D38078, 87436, 1, 1, 1781 },
+	{ 0x00D3807C, 87468, 1, 1, 1782 },
+	{ 0x00D38080, 87494, 1, 1, 1780 },
+	{ 0x00D38084, 87520, 1, 1, 1780 },
+	{ 0x00D38088, 87546, 1, 1, 1780 },
+	{ 0x00D3808C, 87572, 1, 1, 1780 },
+	{ 0x00D38090, 87605, 1, 1, 1783 },
+	{ 0x00D38094, 87630, 1, 1, 1783 },
+	{ 0x00D38098, 87655, 1, 1, 1783 },
+	{ 0x00D3809C, 87680, 1, 1, 1783 },
+	{ 0x00D380A0, 87705, 1, 1, 1781 },
+	{ 0x00D380A4, 87731, 1, 1, 1782 },
+	{ 0x00D380A8, 87757, 1, 1, 1783 },
+	{ 0x00D380AC, 87783, 1, 1, 1783 },
+	{ 0x00D380B0, 87809, 1, 1, 1783 },
+	{ 0x00D380B4, 87835, 1, 1, 1783 },
+	{ 0x00D380B8, 87869, 1, 1, 1784 },
+	{ 0x00D380BC, 87889, 1, 1, 1784 },
+	{ 0x00D380C0, 87909, 1, 1, 1784 },
+	{ 0x00D380C4, 87929, 1, 1, 1784 },
+	{ 0x00D380C8, 87956, 1, 1, 1785 },
+	{ 0x00D380CC, 87982, 1, 1, 1785 },
+	{ 0x00D380D0, 88008, 1, 1, 1785 },
+	{ 0x00D380D4, 88034, 1, 1, 1785 },
+	{ 0x00D380D8, 88060, 1, 1, 1785 },
+	{ 0x00D380DC, 88087, 1, 1, 1785 },
+	{ 0x00D380E0, 88114, 1, 1, 1785 },
+	{ 0x00D380E4, 88141, 1, 1, 1785 },
+	{ 0x00D380E8, 88302, 12, 1, 1786 },
+	{ 0x00D380EC, 88317, 1, 1, 1798 },
+	{ 0x00D380F0, 88334, 1, 1, 1798 },
+	{ 0x00D380F4, 88355, 1, 1, 1799 },
+	{ 0x00D380F8, 88370, 1, 1, 1799 },
+	{ 0x00D380FC, 88394, 1, 1, 1800 },
+	{ 0x00D38100, 88419, 1, 1, 1801 },
+	{ 0x00D38104, 88444, 1, 1, 1802 },
+	{ 0x00D38108, 88469, 1, 1, 1803 },
+	{ 0x00D3810C, 88493, 1, 1, 1804 },
+	{ 0x00D38110, 88513, 1, 1, 1804 },
+	{ 0x00D38114, 88533, 1, 1, 1804 },
+	{ 0x00D38118, 88553, 1, 1, 1804 },
+	{ 0x00D3811C, 88583, 1, 1, 1805 },
+	{ 0x00D38120, 88604, 1, 1, 1805 },
+	{ 0x00D38124, 88625, 1, 1, 395 },
+	{ 0x00D38128, 88649, 1, 1, 395 },
+	{ 0x00D3812C, 88673, 1, 1, 395 },
+	{ 0x00D38130, 88697, 1, 1, 395 },
+	{ 0x00D38134, 88721, 1, 1, 395 },
+	{ 0x00D38138, 88745, 1, 1, 395 },
+	{ 0x00D3813C, 88769, 1, 1, 395 },
+	{ 0x00D38140, 88793, 1, 1, 395 },
+	{ 0x00D38144, 88830, 5, 1, 1806 },
+	{ 0x00D38148, 88852, 1, 1, 395 },
+	{ 0x00D3814C, 88876, 1, 1, 395 },
+	{ 0x00D38150, 88900, 1, 1, 395 },
+	{ 0x00D38154, 88924, 1, 1, 395 },
+	{ 0x00D38158, 88948, 1, 1, 395 },
+	{ 0x00D3815C, 88972, 1, 1, 395 },
+	{ 0x00D38160, 88996, 1, 1, 395 },
+	{ 0x00D38164, 89020, 1, 1, 395 },
+	{ 0x00D38168, 89044, 5, 1, 1806 },
+	{ 0x00D3816C, 89066, 1, 1, 395 },
+	{ 0x00D38170, 89090, 1, 1, 395 },
+	{ 0x00D38174, 89114, 1, 1, 395 },
+	{ 0x00D38178, 89138, 1, 1, 395 },
+	{ 0x00D3817C, 89162, 1, 1, 395 },
+	{ 0x00D38180, 89186, 1, 1, 395 },
+	{ 0x00D38184, 89210, 1, 1, 395 },
+	{ 0x00D38188, 89234, 1, 1, 395 },
+	{ 0x00D3818C, 89258, 5, 1, 1806 },
+	{ 0x00D38190, 89280, 1, 1, 395 },
+	{ 0x00D38194, 89304, 1, 1, 395 },
+	{ 0x00D38198, 89328, 1, 1, 395 },
+	{ 0x00D3819C, 89352, 1, 1, 395 },
+	{ 0x00D381A0, 89376, 1, 1, 395 },
+	{ 0x00D381A4, 89400, 1, 1, 395 },
+	{ 0x00D381A8, 89424, 1, 1, 395 },
+	{ 0x00D381AC, 89448, 1, 1, 395 },
+	{ 0x00D381B0, 89472, 5, 1, 1806 },
+	{ 0x00D381B4, 89506, 1, 1, 1811 },
+	{ 0x00D381B8, 89541, 1, 1, 1812 },
+	{ 0x00D381BC, 89577, 2, 1, 1813 },
+	{ 0x00D381C0, 89595, 1, 1, 1815 },
+	{ 0x00D381C4, 89614, 1, 1, 1816 },
+	{ 0x00D381C8, 89633, 1, 1, 1817 },
+	{ 0x00D381CC, 89652, 1, 1, 1818 },
+	{ 0x00D3CE00, 89670, 1, 1, 1819 },
+	{ 0x00D3CE04, 89698, 1, 1, 1819 },
+	{ 0x00D3CE08, 89725, 1, 1, 1819 },
+	{ 0x00D3CE0C, 89753, 1, 1, 1819 },
+	{ 0x00D3CE10, 89785, 1, 1, 1819 },
+	{ 0x00D3CE14, 89817, 1, 1, 1819 },
+	{ 0x00D3CE18, 89844, 1, 1, 1819 },
+	{ 0x00D3CE1C, 89875, 1, 1, 1819 },
+	{ 0x00D3CE20, 89905, 1, 1, 1820 },
+	{ 0x00D3CE24, 89934, 1, 1, 1820 },
+	{ 0x00D3CE28, 89962, 1, 1, 1820 },
+	{ 0x00D3CE2C, 89991, 1, 1, 1820 },
+	{ 0x00D3CE30, 90024, 1, 1, 1820 },
+	{ 0x00D3CE34, 90057, 1, 1, 1820 },
+	{ 0x00D3CE38, 90085, 1, 1, 1820 },
+	{ 0x00D3CE3C, 90117, 1, 1, 1820 },
+	{ 0x00D3CE40, 90148, 1, 1, 1819 },
+	{ 0x00D3CE44, 90183, 1, 1, 1819 },
+	{ 0x00D3CE48, 90218, 1, 1, 1819 },
+	{ 0x00D3CE4C, 90259, 1, 1, 1821 },
+	{ 0x00D3CE50, 90297, 1, 1, 1822 },
+	{ 0x00D3CE54, 90333, 1, 1, 1822 },
+	{ 0x00D3CE58, 90369, 1, 1, 1822 },
+	{ 0x00D3CF80, 90471, 13, 1, 1823 },
+	{ 0x00D3CF84, 90541, 5, 1, 1836 },
+	{ 0x00D3CF88, 90605, 4, 1, 1841 },
+	{ 0x00D3D200, 90657, 5, 1, 1845 },
+	{ 0x00D3D204, 90693, 1, 1, 1151 },
+	{ 0x00D3DA00, 90755, 5, 1, 1850 },
+	{ 0x00D3DA04, 90786, 1, 1, 1855 },
+	{ 0x00D3DA08, 90818, 1, 1, 1856 },
+	{ 0x00D3DA0C, 90863, 2, 1, 1857 },
+	{ 0x00D3DA10, 90894, 1, 1, 323 },
+	{ 0x0001E800, 5448, 4, 0, 482 },
+	{ 0x0001E810, 5493, 4, 0, 486 },
+	{ 0x0001E812, 5523, 1, 0, 490 },
+	{ 0x0001E814, 5553, 1, 0, 491 },
+	{ 0x0001E818, 5583, 2, 0, 492 },
+	{ 0x00040000, 90959, 7, 1, 1859 },
+	{ 0x00040004, 91003, 5, 1, 1866 },
+	{ 0x00040008, 91040, 1, 1, 1871 },
+	{ 0x0004000C, 91110, 3, 1, 1872 },
+	{ 0x00040010, 91152, 4, 1, 1875 },
+	{ 0x00040014, 91189, 9, 1, 1879 },
+	{ 0x00040018, 91234, 3, 1, 1888 },
+	{ 0x0004001C, 91278, 2, 1, 1891 },
+	{ 0x00040020, 91386, 15, 1, 1893 },
+	{ 0x00040024, 91438, 4, 1, 1908 },
+	{ 0x00040028, 91492, 4, 1, 1912 },
+	{ 0x0004002C, 91624, 10, 1, 1916 },
+	{ 0x00040038, 91661, 1, 1, 1926 },
+	{ 0x0004003C, 91727, 3, 1, 1927 },
+	{ 0x00040054, 91798, 5, 1, 1930 },
+	{ 0x00040258, 91852, 3, 1, 1935 },
+	{ 0x0004025C, 91910, 5, 1, 1938 },
+	{ 0x00040260, 91986, 7, 1, 1943 },
+	{ 0x00040264, 92065, 5, 1, 1950 },
+	{ 0x00040268, 92120, 7, 1, 1955 },
+	{ 0x0004026C, 92173, 5, 1, 1962 },
+	{ 0x00040280, 92215, 2, 1, 1967 },
+	{ 0x00040284, 92264, 8, 1, 1969 },
+	{ 0x000402A8, 92317, 3, 1, 1977 },
+	{ 0x000402AC, 92358, 3, 1, 1980 },
+	{ 0x000402B0, 92394, 1, 1, 1983 },
+	{ 0x000402B4, 92435, 1, 1, 1984 },
+	{ 0x000402B8, 92477, 1, 1, 1985 },
+	{ 0x000402BC, 92520, 1, 1, 1986 },
+	{ 0x00041C20, 92580, 3, 1, 1987 },
+	{ 0x00041C24, 92629, 1, 1, 1990 },
+	{ 0x00041C28, 92685, 1, 1, 1991 },
+	{ 0x00041C2C, 92741, 1, 1, 1992 },
+	{ 0x00041C30, 92797, 1, 1, 1993 },
+	{ 0x00041C34, 92853, 1, 1, 1994 },
+	{ 0x00041C38, 92909, 1, 1, 1995 },
+	{ 0x00041C3C, 92965, 1, 1, 1996 },
+	{ 0x00041C40, 93021, 1, 1, 1997 },
+	{ 0x00060000, 93144, 9, 1, 1998 },
+	{ 0x0006000C, 93189, 3, 1, 2007 },
+	{ 0x00060010, 93230, 1, 1, 2010 },
+	{ 0x00060014, 93271, 1, 1, 2011 },
+	{ 0x00060018, 93313, 1, 1, 2012 },
+	{ 0x0006001C, 93352, 1, 1, 2013 },
+	{ 0x00060020, 93395, 1, 1, 2014 },
+	{ 0x00060024, 93454, 8, 1, 2015 },
+	{ 0x0006002C, 93501, 5, 1, 2023 },
+	{ 0x00060030, 93551, 7, 1, 2028 },
+	{ 0x00060034, 93636, 8, 1, 2035 },
+	{ 0x00060038, 93705, 8, 1, 2043 },
+	{ 0x00060040, 93752, 3, 1, 2051 },
+	{ 0x00060080, 93863, 7, 1, 2054 },
+	{ 0x000600C0, 93974, 8, 1, 2061 },
+	{ 0x000600C4, 94114, 7, 1, 2069 },
+	{ 0x000600C8, 94241, 8, 1, 2076 },
+	{ 0x000600CC, 94328, 4, 1, 2084 },
+	{ 0x000600D0, 94413, 4, 1, 2088 },
+	{ 0x000600D4, 94548, 7, 1, 2092 },
+	{ 0x000600D8, 94624, 4, 1, 2099 },
+	{ 0x000600DC, 94721, 5, 1, 2103 },
+	{ 0x000600E0, 94807, 4, 1, 2108 },
+	{ 0x000600E4, 94878, 4, 1, 2112 },
+	{ 0x000600E8, 94945, 3, 1, 2116 },
+	{ 0x000600EC, 95004, 2, 1, 2119 },
+	{ 0x00060100, 95101, 5, 1, 2121 },
+	{ 0x00060140, 95251, 8, 1, 2126 },
+	{ 0x00060144, 95412, 8, 1, 2134 },
+	{ 0x00060148, 95539, 8, 1, 2142 },
+	{ 0x0006014C, 95664, 6, 1, 2150 },
+	{ 0x00060150, 95743, 4, 1, 2156 },
+	{ 0x00060154, 95876, 8, 1, 2160 },
+	{ 0x00060158, 96023, 7, 1, 2168 },
+	{ 0x0006015C, 96130, 4, 1, 2175 },
+	{ 0x00060160, 96227, 4, 1, 2179 },
+	{ 0x00060170, 96403, 10, 1, 2183 },
+	{ 0x00060174, 96490, 5, 1, 2193 },
+	{ 0x00060178, 96555, 2, 1, 2198 },
+	{ 0x00060180, 96660, 7, 1, 2200 },
+	{ 0x000601C0, 96750, 5, 1, 2207 },
+	{ 0x000601C4, 96876, 6, 1, 2212 },
+	{ 0x000601C8, 96965, 4, 1, 2218 },
+	{ 0x000601CC, 97150, 8, 1, 2222 },
+	{ 0x000601D0, 97246, 6, 1, 2230 },
+	{ 0x000601D4, 97335, 4, 1, 2236 },
+	{ 0x000601D8, 97481, 6, 1, 2240 },
+	{ 0x000601DC, 97540, 2, 1, 2246 },
+	{ 0x000601E0, 97595, 2, 1, 2248 },
+	{ 0x00060240, 97738, 8, 1, 2250 },
+	{ 0x00060244, 97918, 10, 1, 2258 },
+	{ 0x00060248, 97979, 2, 1, 2268 },
+	{ 0x00060258, 98052, 3, 1, 2270 },
+	{ 0x00060260, 98156, 7, 1, 2273 },
+	{ 0x00060264, 98215, 1, 1, 2280 },
+	{ 0x00060268, 98277, 2, 1, 2281 },
+	{ 0x0006026C, 98348, 4, 1, 2283 },
+	{ 0x00060280, 98406, 3, 1, 2287 },
+	{ 0x00060284, 98442, 1, 1, 2290 },
+	{ 0x00060288, 98470, 1, 1, 395 },
+	{ 0x000C0000, 98544, 10, 1, 2291 },
+	{ 0x000C0004, 98606, 10, 1, 2301 },
+	{ 0x000C0008, 98643, 1, 1, 2311 },
+	{ 0x000C000C, 98715, 3, 1, 2312 },
+	{ 0x000C0010, 98738, 2, 1, 2315 },
+	{ 0x000C0014, 98761, 9, 1, 1879 },
+	{ 0x000C0018, 98785, 3, 1, 1888 },
+	{ 0x000C001C, 98809, 2, 1, 2317 },
+	{ 0x000C0020, 98899, 9, 1, 2319 },
+	{ 0x000C0024, 98958, 5, 1, 2328 },
+	{ 0x000C0038, 98995, 1, 1, 2333 },
+	{ 0x000C003C, 99064, 3, 1, 2334 },
+	{ 0x000C0050, 99145, 8, 1, 2337 },
+	{ 0x000C0054, 99217, 7, 1, 2345 },
+	{ 0x000C0058, 99249, 1, 1, 2352 },
+	{ 0x000C0060, 99289, 6, 1, 2353 },
+	{ 0x000C0064, 99316, 3, 1, 2359 },
+	{ 0x000C0080, 99395, 7, 1, 2362 },
+	{ 0x000C0084, 99450, 4, 1, 2369 },
+	{ 0x000C0088, 99480, 1, 1, 2373 },
+	{ 0x000C008C, 99508, 1, 1, 2374 },
+	{ 0x000C0090, 99536, 1, 1, 2375 },
+	{ 0x000C0094, 99564, 2, 1, 2376 },
+	{ 0x000C0098, 99592, 1, 1, 2378 },
+	{ 0x000C009C, 99620, 1, 1, 2379 },
+	{ 0x000C00A0, 99648, 1, 1, 2380 },
+	{ 0x000C00A4, 99676, 2, 1, 2381 },
+	{ 0x000C00A8, 99757, 8, 1, 2383 },
+	{ 0x000C00AC, 99791, 1, 1, 2391 },
+	{ 0x000C1C20, 99846, 3, 1, 2392 },
+	{ 0x000C1C24, 99895, 1, 1, 2395 },
+	{ 0x000C1C28, 99951, 1, 1, 2396 },
+	{ 0x000C1C2C, 100007, 1, 1, 2397 },
+	{ 0x000C1C30, 100063, 1, 1, 2398 },
+	{ 0x000C1C34, 100119, 1, 1, 2399 },
+	{ 0x000C1C38, 100175, 1, 1, 2400 },
+	{ 0x000C1C3C, 100231, 1, 1, 2401 },
+	{ 0x000C1C40, 100287, 1, 1, 2402 },
+	{ 0x000E0000, 100393, 14, 1, 2403 },
+	{ 0x000E0004, 100504, 6, 1, 2417 },
+	{ 0x000E0008, 100577, 7, 1, 2423 },
+	{ 0x000E0010, 100628, 3, 1, 2430 },
+	{ 0x000E0014, 100768, 9, 1, 2433 },
+	{ 0x000E0018, 100899, 10, 1, 2442 },
+	{ 0x000E001C, 101005, 9, 1, 2452 },
+	{ 0x000E0020, 101052, 4, 1, 2461 },
+	{ 0x000E0024, 101096, 3, 1, 2465 },
+	{ 0x000E0028, 101132, 1, 1, 2468 },
+	{ 0x000E002C, 101163, 2, 1, 2469 },
+	{ 0x000E0040, 101267, 9, 1, 2471 },
+	{ 0x000E0044, 101298, 2, 1, 2480 },
+	{ 0x000E0054, 101342, 2, 1, 2482 },
+	{ 0x001C0000, 101408, 6, 1, 2484 },
+	{ 0x001C0004, 101464, 9, 1, 2490 },
+	{ 0x001C0008, 101495, 1, 1, 2499 },
+	{ 0x001C000C, 101560, 3, 1, 2500 },
+	{ 0x001C0014, 101579, 9, 1, 1879 },
+	{ 0x001C0018, 101599, 3, 1, 1888 },
+	{ 0x001C0038, 101635, 1, 1, 2503 },
+	{ 0x001C003C, 101697, 3, 1, 2504 },
+	{ 0x001C0040, 101757, 5, 1, 2507 },
+	{ 0x001C0044, 101784, 1, 1, 2512 },
+	{ 0x001C0048, 101811, 1, 1, 2513 },
+	{ 0x001C004C, 101880, 5, 1, 2514 },
+	{ 0x001C0050, 101899, 1, 1, 2512 },
+	{ 0x001C0054, 101918, 1, 1, 2513 },
+	{ 0x001C0058, 101972, 5, 1, 2519 },
+	{ 0x001C005C, 101997, 1, 1, 2524 },
+	{ 0x001C0060, 102022, 1, 1, 2525 },
+	{ 0x001C0064, 102096, 6, 1, 2526 },
+	{ 0x001C0068, 102119, 1, 1, 361 },
+	{ 0x001C006C, 102142, 1, 1, 362 },
+	{ 0x001C00C0, 102260, 8, 1, 2532 },
+	{ 0x001C00F0, 102280, 7, 1, 2540 },
+	{ 0x001C00F4, 102356, 7, 1, 2547 },
+	{ 0x001C00F8, 102379, 5, 1, 2554 },
+	{ 0x001C00FC, 102424, 4, 1, 2559 },
+	{ 0x001E0000, 102493, 7, 1, 2563 },
+	{ 0x001E0004, 102558, 4, 1, 2570 },
+	{ 0x001E0008, 102613, 4, 1, 2574 },
+	{ 0x001E000C, 102637, 2, 1, 2578 },
+	{ 0x001E0010, 102675, 1, 1, 2580 },
+	{ 0x001E0014, 102717, 1, 1, 2581 },
+	{ 0x00680000, 102790, 10, 1, 2582 },
+	{ 0x00680004, 102929, 15, 1, 2592 },
+	{ 0x00680008, 102967, 1, 1, 2607 },
+	{ 0x0068000C, 103047, 3, 1, 2608 },
+	{ 0x00680010, 103095, 7, 1, 2611 },
+	{ 0x00680014, 103156, 8, 1, 2618 },
+	{ 0x00680018, 103196, 3, 1, 2626 },
+	{ 0x0068003C, 103280, 5, 1, 2629 },
+	{ 0x006A0000, 103365, 16, 1, 2634 },
+	{ 0x006A0004, 103460, 7, 1, 2650 },
+	{ 0x006A0008, 103548, 5, 1, 2657 },
+	{ 0x006A0014, 103586, 7, 1, 2662 },
+	{ 0x006A0028, 103624, 1, 1, 2669 },
+	{ 0x006A0040, 103654, 9, 1, 2471 },
+	{ 0x006A0044, 103676, 2, 1, 2670 },
+	{ 0x006A0388, 103702, 4, 1, 2672 },
+	{ 0x006C0000, 103731, 10, 1, 2582 },
+	{ 0x006C0004, 103750, 15, 1, 2592 },
+	{ 0x006C0008, 103768, 1, 1, 2607 },
+	{ 0x006C000C, 103790, 3, 1, 2608 },
+	{ 0x006C0010, 103812, 7, 1, 2611 },
+	{ 0x006C0014, 103833, 8, 1, 2618 },
+	{ 0x006C0018, 103855, 3, 1, 2626 },
+	{ 0x006C003C, 103877, 5, 1, 2629 },
+	{ 0x006E0000, 103899, 16, 1, 2634 },
+	{ 0x006E0004, 103923, 7, 1, 2650 },
+	{ 0x006E0008, 103945, 5, 1, 2657 },
+	{ 0x006E0014, 103971, 7, 1, 2662 },
+	{ 0x006E0028, 103994, 1, 1, 2669 },
+	{ 0x006E0040, 104024, 9, 1, 2471 },
+	{ 0x006E0044, 104046, 2, 1, 2670 },
+	{ 0x006E0388, 104072, 4, 1, 2672 },
+	{ 0x00700000, 104101, 10, 1, 2582 },
+	{ 0x00700004, 104120, 15, 1, 2592 },
+	{ 0x00700008, 104138, 1, 1, 2607 },
+	{ 0x0070000C, 104160, 3, 1, 2608 },
+	{ 0x00700010, 104182, 7, 1, 2611 },
+	{ 0x00700014, 104203, 8, 1, 2618 },
+	{ 0x00700018, 104225, 3, 1, 2626 },
+	{ 0x0070003C, 104247, 5, 1, 2629 },
+	{ 0x00720000, 104269, 16, 1, 2634 },
+	{ 0x00720004, 104293, 7, 1, 2650 },
+	{ 0x00720008, 104315, 5, 1, 2657 },
+	{ 0x00720014, 104341, 7, 1, 2662 },
+	{ 0x00720028, 104364, 1, 1, 2669 },
+	{ 0x00720040, 104394, 9, 1, 2471 },
+	{ 0x00720044, 104416, 2, 1, 2670 },
+	{ 0x00720388, 104442, 4, 1, 2672 },
+	{ 0x00780000, 104484, 1, 1, 2676 },
+	{ 0x00780004, 104543, 3, 1, 2677 },
+	{ 0x00780008, 104577, 1, 1, 2680 },
+	{ 0x0078000C, 104633, 3, 1, 2681 },
+	{ 0x00780010, 104668, 1, 1, 2684 },
+	{ 0x00780014, 104727, 3, 1, 2685 },
+	{ 0x00780018, 104761, 1, 1, 2688 },
+	{ 0x0078001C, 104816, 3, 1, 2689 },
+	{ 0x00780020, 104842, 2, 1, 2692 },
+	{ 0x00780024, 104922, 7, 1, 2694 },
+	{ 0x00780038, 104954, 1, 1, 2701 },
+	{ 0x0078003C, 105012, 3, 1, 2702 },
+	{ 0x007C0000, 105033, 10, 1, 2582 },
+	{ 0x007C0004, 105050, 15, 1, 2592 },
+	{ 0x007C0008, 105066, 1, 1, 2607 },
+	{ 0x007C000C, 105086, 3, 1, 2608 },
+	{ 0x007C0010, 105106, 7, 1, 2611 },
+	{ 0x007C0014, 105125, 8, 1, 2618 },
+	{ 0x007C0018, 105145, 3, 1, 2626 },
+	{ 0x007C003C, 105165, 5, 1, 2629 },
+	{ 0x007E0000, 105185, 15, 1, 2705 },
+	{ 0x007E0004, 105207, 7, 1, 2650 },
+	{ 0x007E0008, 105227, 5, 1, 2657 },
+	{ 0x007E0028, 105251, 1, 1, 2669 },
+	{ 0x00A30000, 105321, 9, 1, 2720 },
+	{ 0x00A30004, 105420, 9, 1, 2729 },
+	{ 0x00A30008, 105454, 14, 1, 2738 },
+	{ 0x00A3000C, 105497, 3, 1, 2752 },
+	{ 0x00A30010, 105553, 11, 1, 2755 },
+	{ 0x00A30014, 105608, 7, 1, 2766 },
+	{ 0x00A30018, 105634, 4, 1, 1255 },
+	{ 0x00A3001C, 105663, 1, 1, 1259 },
+	{ 0x00A300A0, 105696, 1, 1, 2773 },
+	{ 0x00A300A4, 105780, 12, 1, 2774 },
+	{ 0x00A300D8, 105804, 1, 1, 2786 },
+	{ 0x00A300DC, 105834, 1, 1, 1354 },
+	{ 0x00A300E0, 105868, 6, 1, 2787 },
+	{ 0x00A300E4, 105896, 1, 1, 1279 },
+	{ 0x00A30120, 105924, 5, 1, 1280 },
+	{ 0x00A30124, 105949, 1, 1, 1259 },
+	{ 0x00A30160, 106011, 12, 1, 2793 },
+	{ 0x00A30164, 106055, 3, 1, 2805 },
+	{ 0x00A30168, 106113, 8, 1, 2808 },
+	{ 0x00A3016C, 106142, 1, 1, 2816 },
+	{ 0x00A30170, 106171, 4, 1, 2817 },
+	{ 0x00A30174, 106196, 1, 1, 1259 },
+	{ 0x00A301A0, 106235, 10, 1, 2821 },
+	{ 0x00A301A4, 106281, 7, 1, 2831 },
+	{ 0x00A301A8, 106312, 1, 1, 1342 },
+	{ 0x00A301AC, 106343, 2, 1, 1343 },
+	{ 0x00A301B0, 106374, 2, 1, 1345 },
+	{ 0x00A301B4, 106407, 2, 1, 1347 },
+	{ 0x00A301B8, 106440, 2, 1, 1349 },
+	{ 0x00A301BC, 106468, 1, 1, 1351 },
+	{ 0x00A30220, 106502, 2, 1, 2838 },
+	{ 0x00A30224, 106522, 2, 1, 2840 },
+	{ 0x00A30228, 106542, 3, 1, 1355 },
+	{ 0x00A3022C, 106560, 3, 1, 1358 },
+	{ 0x00A30238, 106587, 14, 1, 2842 },
+	{ 0x00A3023C, 106643, 8, 1, 2856 },
+	{ 0x00A30240, 106673, 7, 1, 2864 },
+	{ 0x00A30244, 106709, 8, 1, 2871 },
+	{ 0x00A30248, 106733, 5, 1, 1398 },
+	{ 0x00A3024C, 106757, 5, 1, 1403 },
+	{ 0x00A30250, 106781, 7, 1, 2879 },
+	{ 0x00A30254, 106811, 2, 1, 2886 },
+	{ 0x00A30280, 106835, 2, 1, 2888 },
+	{ 0x00A30284, 106902, 2, 1, 2890 },
+	{ 0x00A30600, 106937, 1, 1, 1426 },
+	{ 0x00A30604, 106963, 2, 1, 2892 },
+	{ 0x00A30608, 106989, 1, 1, 396 },
+	{ 0x00A3060C, 107014, 1, 1, 396 },
+	{ 0x00A31000, 107043, 7, 1, 2894 },
+	{ 0x00A31004, 107081, 2, 1, 2901 },
+	{ 0x00A31008, 107263, 16, 1, 2903 },
+	{ 0x00A3100C, 107419, 14, 1, 2919 },
+	{ 0x00A31010, 107615, 16, 1, 2933 },
+	{ 0x00A31014, 107686, 6, 1, 2949 },
+	{ 0x00A31018, 108026, 16, 1, 2955 },
+	{ 0x00A3101C, 108318, 14, 1, 2971 },
+	{ 0x00A31020, 108666, 16, 1, 2985 },
+	{ 0x00A31024, 108793, 6, 1, 3001 },
+	{ 0x00A31028, 108841, 1, 1, 3007 },
+	{ 0x00A3102C, 108877, 1, 1, 3007 },
+	{ 0x00A31030, 108923, 1, 1, 3008 },
+	{ 0x00A31034, 108960, 1, 1, 3008 },
+	{ 0x00A31038, 109007, 1, 1, 3009 },
+	{ 0x00A3103C, 109044, 1, 1, 3009 },
+	{ 0x00A31108, 109090, 1, 1, 3010 },
+	{ 0x00A3110C, 109122, 1, 1, 3010 },
+	{ 0x00A31110, 109163, 1, 1, 3011 },
+	{ 0x00A31114, 109196, 1, 1, 3011 },
+	{ 0x00A31118, 109238, 1, 1, 3012 },
+	{ 0x00A3111C, 109271, 1, 1, 3012 },
+	{ 0x00A31128, 109315, 1, 1, 3013 },
+	{ 0x00A3112C, 109344, 1, 1, 3013 },
+	{ 0x00A31200, 109383, 1, 1, 3014 },
+	{ 0x00A31204, 109420, 1, 1, 3014 },
+	{ 0x00A31210, 109467, 1, 1, 3015 },
+	{ 0x00A31214, 109503, 1, 1, 3015 },
+	{ 0x00A31218, 109549, 1, 1, 3016 },
+	{ 0x00A3121C, 109586, 1, 1, 3016 },
+	{ 0x00A31220, 109632, 1, 1, 3017 },
+	{ 0x00A31224, 109664, 1, 1, 3017 },
+	{ 0x00A31228, 109705, 1, 1, 3018 },
+	{ 0x00A3122C, 109738, 1, 1, 3018 },
+	{ 0x00A31250, 109781, 1, 1, 3019 },
+	{ 0x00A31254, 109814, 1, 1, 3019 },
+	{ 0x00A31A00, 109847, 15, 1, 1691 },
+	{ 0x00A31A04, 109877, 9, 1, 1582 },
+	{ 0x00A31A08, 109907, 2, 1, 1706 },
+	{ 0x00A31A0C, 109940, 2, 1, 1593 },
+	{ 0x00A31A10, 109973, 1, 1, 1595 },
+	{ 0x00A31A14, 110005, 1, 1, 1595 },
+	{ 0x00A31A18, 110037, 1, 1, 1596 },
+	{ 0x00A31A1C, 110073, 1, 1, 1597 },
+	{ 0x00A31A20, 110109, 1, 1, 1595 },
+	{ 0x00A31A24, 110148, 1, 1, 1595 },
+	{ 0x00A31A28, 110187, 1, 1, 1596 },
+	{ 0x00A31A2C, 110230, 2, 1, 1598 },
+	{ 0x00A31A30, 110273, 1, 1, 1600 },
+	{ 0x00A31A34, 110302, 1, 1, 1600 },
+	{ 0x00A31A40, 110343, 12, 1, 3020 },
+	{ 0x00A31A44, 110372, 5, 1, 1614 },
+	{ 0x00A31A58, 110407, 1, 1, 3032 },
+	{ 0x00A31A5C, 110447, 1, 1, 3032 },
+	{ 0x00A31A60, 110487, 1, 1, 1619 },
+	{ 0x00A31A64, 110531, 2, 1, 1620 },
+	{ 0x00A31A68, 110585, 1, 1, 3033 },
+	{ 0x00A31A6C, 110625, 1, 1, 3033 },
+	{ 0x00A31A70, 110686, 2, 1, 3034 },
+	{ 0x00A31A74, 110724, 1, 1, 3036 },
+	{ 0x00A31AA0, 110762, 1, 1, 1634 },
+	{ 0x00A31AA4, 110802, 1, 1, 1634 },
+	{ 0x00A31AA8, 110842, 1, 1, 1635 },
+	{ 0x00A31AAC, 110881, 1, 1, 1635 },
+	{ 0x00A31AB0, 110920, 1, 1, 1636 },
+	{ 0x00A31AB4, 110966, 1, 1, 1636 },
+	{ 0x00A31AC0, 111012, 1, 1, 1637 },
+	{ 0x00A31AC4, 111057, 1, 1, 1637 },
+	{ 0x00A31AE0, 111119, 6, 1, 3037 },
+	{ 0x00A31AE4, 111143, 6, 1, 1648 },
+	{ 0x00A31B00, 111167, 1, 1, 1654 },
+	{ 0x00A31B04, 111204, 1, 1, 1654 },
+	{ 0x00A31B08, 111241, 1, 1, 1655 },
+	{ 0x00A31B0C, 111282, 2, 1, 1656 },
+	{ 0x00A381D0, 5611, 1, 1, 494 },
+	{ 0x00A381D4, 5641, 1, 1, 494 },
+	{ 0x00A381D8, 5671, 1, 1, 494 },
+	{ 0x00A381DC, 5701, 1, 1, 494 },
+	{ 0x00A381E0, 5731, 1, 1, 494 },
+	{ 0x00A381E4, 5756, 1, 1, 494 },
+	{ 0x00A49000, 111323, 4, 1, 1183 },
+	{ 0x00A49004, 111341, 3, 1, 3043 },
+	{ 0x00A49008, 111366, 1, 1, 1191 },
+	{ 0x00A4900C, 111394, 1, 1, 1192 },
+	{ 0x00A49010, 111422, 1, 1, 1191 },
+	{ 0x00A49014, 111450, 1, 1, 1192 },
+	{ 0x00A49018, 111478, 1, 1, 1193 },
+	{ 0x00A4901C, 111506, 1, 1, 1194 },
+	{ 0x00A49020, 111534, 1, 1, 1193 },
+	{ 0x00A49024, 111562, 1, 1, 1194 },
+	{ 0x00A49028, 111590, 6, 1, 1195 },
+	{ 0x00A4902C, 111613, 2, 1, 1201 },
+	{ 0x00B04000, 5800, 1, 1, 495 },
+	{ 0x00B04004, 5856, 2, 1, 496 },
+	{ 0x00B04008, 5902, 1, 1, 498 },
+	{ 0x00B0400C, 5955, 2, 1, 499 },
+	{ 0x00B04010, 6122, 13, 1, 501 },
+	{ 0x00B04014, 6171, 1, 1, 514 },
+	{ 0x00B04018, 6217, 1, 1, 515 },
+	{ 0x00B0401C, 6608, 25, 1, 516 },
+	{ 0x00B04020, 6663, 3, 1, 541 },
+	{ 0x00B04040, 6684, 1, 1, 495 },
+	{ 0x00B04044, 6711, 2, 1, 496 },
+	{ 0x00B04048, 6738, 1, 1, 498 },
+	{ 0x00B0404C, 6765, 2, 1, 499 },
+	{ 0x00B04050, 6792, 13, 1, 501 },
+	{ 0x00B04054, 6818, 1, 1, 514 },
+	{ 0x00B04058, 6842, 1, 1, 515 },
+	{ 0x00B0405C, 6866, 25, 1, 516 },
+	{ 0x00B04060, 6882, 3, 1, 541 },
+	{ 0x00B04080, 6903, 1, 1, 495 },
+	{ 0x00B04084, 6930, 2, 1, 496 },
+	{ 0x00B04088, 6957, 1, 1, 498 },
+	{ 0x00B0408C, 6984, 2, 1, 499 },
+	{ 0x00B04090, 7011, 13, 1, 501 },
+	{ 0x00B04094, 7037, 1, 1, 514 },
+	{ 0x00B04098, 7061, 1, 1, 515 },
+	{ 0x00B0409C, 7085, 25, 1, 516 },
+	{ 0x00B040A0, 7101, 3, 1, 541 },
+	{ 0x00B040C0, 7122, 1, 1, 495 },
+	{ 0x00B040C4, 7149, 2, 1, 496 },
+	{ 0x00B040C8, 7176, 1, 1, 498 },
+	{ 0x00B040CC, 7203, 2, 1, 499 },
+	{ 0x00B040D0, 7230, 13, 1, 501 },
+	{ 0x00B040D4, 7256, 1, 1, 514 },
+	{ 0x00B040D8, 7280, 1, 1, 515 },
+	{ 0x00B040DC, 7304, 25, 1, 516 },
+	{ 0x00B040E0, 7320, 3, 1, 541 },
+	{ 0x00B04100, 7341, 1, 1, 495 },
+	{ 0x00B04104, 7368, 2, 1, 496 },
+	{ 0x00B04108, 7395, 1, 1, 498 },
+	{ 0x00B0410C, 7422, 2, 1, 499 },
+	{ 0x00B04110, 7449, 13, 1, 501 },
+	{ 0x00B04114, 7475, 1, 1, 514 },
+	{ 0x00B04118, 7499, 1, 1, 515 },
+	{ 0x00B0411C, 7523, 25, 1, 516 },
+	{ 0x00B04120, 7539, 3, 1, 541 },
+	{ 0x00B04140, 7560, 1, 1, 495 },
+	{ 0x00B04144, 7587, 2, 1, 496 },
+	{ 0x00B04148, 7614, 1, 1, 498 },
+	{ 0x00B0414C, 7641, 2, 1, 499 },
+	{ 0x00B04150, 7668, 13, 1, 501 },
+	{ 0x00B04154, 7694, 1, 1, 514 },
+	{ 0x00B04158, 7718, 1, 1, 515 },
+	{ 0x00B0415C, 7742, 25, 1, 516 },
+	{ 0x00B04160, 7758, 3, 1, 541 },
+	{ 0x00B04180, 7779, 1, 1, 495 },
+	{ 0x00B04184, 7806, 2, 1, 496 },
+	{ 0x00B04188, 7833, 1, 1, 498 },
+	{ 0x00B0418C, 7860, 2, 1, 499 },
+	{ 0x00B04190, 7887, 13, 1, 501 },
+	{ 0x00B04194, 7913, 1, 1, 514 },
+	{ 0x00B04198, 7937, 1, 1, 515 },
+	{ 0x00B0419C, 7961, 25, 1, 516 },
+	{ 0x00B041A0, 7977, 3, 1, 541 },
+	{ 0x00B041C0, 7998, 1, 1, 495 },
+	{ 0x00B041C4, 8025, 2, 1, 496 },
+	{ 0x00B041C8, 8052, 1, 1, 498 },
+	{ 0x00B041CC, 8079, 2, 1, 499 },
+	{ 0x00B041D0, 8106, 13, 1, 501 },
+	{ 0x00B041D4, 8132, 1, 1, 514 },
+	{ 0x00B041D8, 8156, 1, 1, 515 },
+	{ 0x00B041DC, 8180, 25, 1, 516 },
+	{ 0x00B041E0, 8196, 3, 1, 541 },
+	{ 0x00B04200, 8217, 1, 1, 495 },
+	{ 0x00B04204, 8244, 2, 1, 496 },
+	{ 0x00B04208, 8271, 1, 1, 498 },
+	{ 0x00B0420C, 8298, 2, 1, 499 },
+	{ 0x00B04210, 8325, 13, 1, 501 },
+	{ 0x00B04214, 8351, 1, 1, 514 },
+	{ 0x00B04218, 8375, 1, 1, 515 },
+	{ 0x00B0421C, 8399, 25, 1, 516 },
+	{ 0x00B04220, 8415, 3, 1, 541 },
+	{ 0x00B04240, 8436, 1, 1, 495 },
+	{ 0x00B04244, 8463, 2, 1, 496 },
+	{ 0x00B04248, 8490, 1, 1, 498 },
+	{ 0x00B0424C, 8517, 2, 1, 499 },
+	{ 0x00B04250, 8544, 13, 1, 501 },
+	{ 0x00B04254, 8570, 1, 1, 514 },
+	{ 0x00B04258, 8594, 1, 1, 515 },
+	{ 0x00B0425C, 8618, 25, 1, 516 },
+	{ 0x00B04260, 8634, 3, 1, 541 },
+	{ 0x00B04280, 8655, 1, 1, 495 },
+	{ 0x00B04284, 8683, 2, 1, 496 },
+	{ 0x00B04288, 8711, 1, 1, 498 },
+	{ 0x00B0428C, 8739, 2, 1, 499 },
+	{ 0x00B04290, 8767, 13, 1, 501 },
+	{ 0x00B04294, 8794, 1, 1, 514 },
+	{ 0x00B04298, 8819, 1, 1, 515 },
+	{ 0x00B0429C, 8844, 25, 1, 516 },
+	{ 0x00B042A0, 8861, 3, 1, 541 },
+	{ 0x00B042C0, 8883, 1, 1, 495 },
+	{ 0x00B042C4, 8911, 2, 1, 496 },
+	{ 0x00B042C8, 8939, 1, 1, 498 },
+	{ 0x00B042CC, 8967, 2, 1, 499 },
+	{ 0x00B042D0, 8995, 13, 1, 501 },
+	{ 0x00B042D4, 9022, 1, 1, 514 },
+	{ 0x00B042D8, 9047, 1, 1, 515 },
+	{ 0x00B042DC, 9072, 25, 1, 516 },
+	{ 0x00B042E0, 9089, 3, 1, 541 },
+	{ 0x00B04300, 9111, 1, 1, 495 },
+	{ 0x00B04304, 9139, 2, 1, 496 },
+	{ 0x00B04308, 9167, 1, 1, 498 },
+	{ 0x00B0430C, 9195, 2, 1, 499 },
+	{ 0x00B04310, 9223, 13, 1, 501 },
+	{ 0x00B04314, 9250, 1, 1, 514 },
+	{ 0x00B04318, 9275, 1, 1, 515 },
+	{ 0x00B0431C, 9300, 25, 1, 516 },
+	{ 0x00B04320, 9317, 3, 1, 541 },
+	{ 0x00B04340, 9339, 1, 1, 495 },
+	{ 0x00B04344, 9367, 2, 1, 496 },
+	{ 0x00B04348, 9395, 1, 1, 498 },
+	{ 0x00B0434C, 9423, 2, 1, 499 },
+	{ 0x00B04350, 9451, 13, 1, 501 },
+	{ 0x00B04354, 9478, 1, 1, 514 },
+	{ 0x00B04358, 9503, 1, 1, 515 },
+	{ 0x00B0435C, 9528, 25, 1, 516 },
+	{ 0x00B04360, 9545, 3, 1, 541 },
+	{ 0x00B04380, 9567, 1, 1, 495 },
+	{ 0x00B04384, 9595, 2, 1, 496 },
+	{ 0x00B04388, 9623, 1, 1, 498 },
+	{ 0x00B0438C, 9651, 2, 1, 499 },
+	{ 0x00B04390, 9679, 13, 1, 501 },
+	{ 0x00B04394, 9706, 1, 1, 514 },
+	{ 0x00B04398, 9731, 1, 1, 515 },
+	{ 0x00B0439C, 9756, 25, 1, 516 },
+	{ 0x00B043A0, 9773, 3, 1, 541 },
+	{ 0x00B043C0, 9795, 1, 1, 495 },
+	{ 0x00B043C4, 9823, 2, 1, 496 },
+	{ 0x00B043C8, 9851, 1, 1, 498 },
+	{ 0x00B043CC, 9879, 2, 1, 499 },
+	{ 0x00B043D0, 9907, 13, 1, 501 },
+	{ 0x00B043D4, 9934, 1, 1, 514 },
+	{ 0x00B043D8, 9959, 1, 1, 515 },
+	{ 0x00B043DC, 9984, 25, 1, 516 },
+	{ 0x00B043E0, 10001, 3, 1, 541 },
+	{ 0x00B04400, 10023, 1, 1, 495 },
+	{ 0x00B04404, 10051, 2, 1, 496 },
+	{ 0x00B04408, 10079, 1, 1, 498 },
+	{ 0x00B0440C, 10107, 2, 1, 499 },
+	{ 0x00B04410, 10135, 13, 1, 501 },
+	{ 0x00B04414, 10162, 1, 1, 514 },
+	{ 0x00B04418, 10187, 1, 1, 515 },
+	{ 0x00B0441C, 10212, 25, 1, 516 },
+	{ 0x00B04420, 10229, 3, 1, 541 },
+	{ 0x00B04440, 10251, 1, 1, 495 },
+	{ 0x00B04444, 10279, 2, 1, 496 },
+	{ 0x00B04448, 10307, 1, 1, 498 },
+	{ 0x00B0444C, 10335, 2, 1, 499 },
+	{ 0x00B04450, 10363, 13, 1, 501 },
+	{ 0x00B04454, 10390, 1, 1, 514 },
+	{ 0x00B04458, 10415, 1, 1, 515 },
+	{ 0x00B0445C, 10440, 25, 1, 516 },
+	{ 0x00B04460, 10457, 3, 1, 541 },
+	{ 0x00B04480, 10479, 1, 1, 495 },
+	{ 0x00B04484, 10507, 2, 1, 496 },
+	{ 0x00B04488, 10535, 1, 1, 498 },
+	{ 0x00B0448C, 10563, 2, 1, 499 },
+	{ 0x00B04490, 10591, 13, 1, 501 },
+	{ 0x00B04494, 10618, 1, 1, 514 },
+	{ 0x00B04498, 10643, 1, 1, 515 },
+	{ 0x00B0449C, 10668, 25, 1, 516 },
+	{ 0x00B044A0, 10685, 3, 1, 541 },
+	{ 0x00B044C0, 10707, 1, 1, 495 },
+	{ 0x00B044C4, 10735, 2, 1, 496 },
+	{ 0x00B044C8, 10763, 1, 1, 498 },
+	{ 0x00B044CC, 10791, 2, 1, 499 },
+	{ 0x00B044D0, 10819, 13, 1, 501 },
+	{ 0x00B044D4, 10846, 1, 1, 514 },
+	{ 0x00B044D8, 10871, 1, 1, 515 },
+	{ 0x00B044DC, 10896, 25, 1, 516 },
+	{ 0x00B044E0, 10913, 3, 1, 541 },
+	{ 0x00B04500, 10935, 1, 1, 495 },
+	{ 0x00B04504, 10963, 2, 1, 496 },
+	{ 0x00B04508, 10991, 1, 1, 498 },
+	{ 0x00B0450C, 11019, 2, 1, 499 },
+	{ 0x00B04510, 11047, 13, 1, 501 },
+	{ 0x00B04514, 11074, 1, 1, 514 },
+	{ 0x00B04518, 11099, 1, 1, 515 },
+	{ 0x00B0451C, 11124, 25, 1, 516 },
+	{ 0x00B04520, 11141, 3, 1, 541 },
+	{ 0x00B04540, 11163, 1, 1, 495 },
+	{ 0x00B04544, 11191, 2, 1, 496 },
+	{ 0x00B04548, 11219, 1, 1, 498 },
+	{ 0x00B0454C, 11247, 2, 1, 499 },
+	{ 0x00B04550, 11275, 13, 1, 501 },
+	{ 0x00B04554, 11302, 1, 1, 514 },
+	{ 0x00B04558, 11327, 1, 1, 515 },
+	{ 0x00B0455C, 11352, 25, 1, 516 },
+	{ 0x00B04560, 11369, 3, 1, 541 },
+	{ 0x00B04580, 11391, 1, 1, 495 },
+	{ 0x00B04584, 11419, 2, 1, 496 },
+	{ 0x00B04588, 11447, 1, 1, 498 },
+	{ 0x00B0458C, 11475, 2, 1, 499 },
+	{ 0x00B04590, 11503, 13, 1, 501 },
+	{ 0x00B04594, 11530, 1, 1, 514 },
+	{ 0x00B04598, 11555, 1, 1, 515 },
+	{ 0x00B0459C, 11580, 25, 1, 516 },
+	{ 0x00B045A0, 11597, 3, 1, 541 },
+	{ 0x00B045C0, 11619, 1, 1, 495 },
+	{ 0x00B045C4, 11647, 2, 1, 496 },
+	{ 0x00B045C8, 11675, 1, 1, 498 },
+	{ 0x00B045CC, 11703, 2, 1, 499 },
+	{ 0x00B045D0, 11731, 13, 1, 501 },
+	{ 0x00B045D4, 11758, 1, 1, 514 },
+	{ 0x00B045D8, 11783, 1, 1, 515 },
+	{ 0x00B045DC, 11808, 25, 1, 516 },
+	{ 0x00B045E0, 11825, 3, 1, 541 },
+	{ 0x00B04600, 11847, 1, 1, 495 },
+	{ 0x00B04604, 11875, 2, 1, 496 },
+	{ 0x00B04608, 11903, 1, 1, 498 },
+	{ 0x00B0460C, 11931, 2, 1, 499 },
+	{ 0x00B04610, 11959, 13, 1, 501 },
+	{ 0x00B04614, 11986, 1, 1, 514 },
+	{ 0x00B04618, 12011, 1, 1, 515 },
+	{ 0x00B0461C, 12036, 25, 1, 516 },
+	{ 0x00B04620, 12053, 3, 1, 541 },
+	{ 0x00B04640, 12075, 1, 1, 495 },
+	{ 0x00B04644, 12103, 2, 1, 496 },
+	{ 0x00B04648, 12131, 1, 1, 498 },
+	{ 0x00B0464C, 12159, 2, 1, 499 },
+	{ 0x00B04650, 12187, 13, 1, 501 },
+	{ 0x00B04654, 12214, 1, 1, 514 },
+	{ 0x00B04658, 12239, 1, 1, 515 },
+	{ 0x00B0465C, 12264, 25, 1, 516 },
+	{ 0x00B04660, 12281, 3, 1, 541 },
+	{ 0x00B04680, 12303, 1, 1, 495 },
+	{ 0x00B04684, 12331, 2, 1, 496 },
+	{ 0x00B04688, 12359, 1, 1, 498 },
+	{ 0x00B0468C, 12387, 2, 1, 499 },
+	{ 0x00B04690, 12415, 13, 1, 501 },
+	{ 0x00B04694, 12442, 1, 1, 514 },
+	{ 0x00B04698, 12467, 1, 1, 515 },
+	{ 0x00B0469C, 12492, 25, 1, 516 },
+	{ 0x00B046A0, 12509, 3, 1, 541 },
+	{ 0x00B046C0, 12531, 1, 1, 495 },
+	{ 0x00B046C4, 12559, 2, 1, 496 },
+	{ 0x00B046C8, 12587, 1, 1, 498 },
+	{ 0x00B046CC, 12615, 2, 1, 499 },
+	{ 0x00B046D0, 12643, 13, 1, 501 },
+	{ 0x00B046D4, 12670, 1, 1, 514 },
+	{ 0x00B046D8, 12695, 1, 1, 515 },
+	{ 0x00B046DC, 12720, 25, 1, 516 },
+	{ 0x00B046E0, 12737, 3, 1, 541 },
+	{ 0x00B04700, 12759, 1, 1, 495 },
+	{ 0x00B04704, 12787, 2, 1, 496 },
+	{ 0x00B04708, 12815, 1, 1, 498 },
+	{ 0x00B0470C, 12843, 2, 1, 499 },
+	{ 0x00B04710, 12871, 13, 1, 501 },
+	{ 0x00B04714, 12898, 1, 1, 514 },
+	{ 0x00B04718, 12923, 1, 1, 515 },
+	{ 0x00B0471C, 12948, 25, 1, 516 },
+	{ 0x00B04720, 12965, 3, 1, 541 },
+	{ 0x00B04740, 12987, 1, 1, 495 },
+	{ 0x00B04744, 13015, 2, 1, 496 },
+	{ 0x00B04748, 13043, 1, 1, 498 },
+	{ 0x00B0474C, 13071, 2, 1, 499 },
+	{ 0x00B04750, 13099, 13, 1, 501 },
+	{ 0x00B04754, 13126, 1, 1, 514 },
+	{ 0x00B04758, 13151, 1, 1, 515 },
+	{ 0x00B0475C, 13176, 25, 1, 516 },
+	{ 0x00B04760, 13193, 3, 1, 541 },
+	{ 0x00B04780, 13215, 1, 1, 495 },
+	{ 0x00B04784, 13243, 2, 1, 496 },
+	{ 0x00B04788, 13271, 1, 1, 498 },
+	{ 0x00B0478C, 13299, 2, 1, 499 },
+	{ 0x00B04790, 13327, 13, 1, 501 },
+	{ 0x00B04794, 13354, 1, 1, 514 },
+	{ 0x00B04798, 13379, 1, 1, 515 },
+	{ 0x00B0479C, 13404, 25, 1, 516 },
+	{ 0x00B047A0, 13421, 3, 1, 541 },
+	{ 0x00B047C0, 13443, 1, 1, 495 },
+	{ 0x00B047C4, 13471, 2, 1, 496 },
+	{ 0x00B047C8, 13499, 1, 1, 498 },
+	{ 0x00B047CC, 13527, 2, 1, 499 },
+	{ 0x00B047D0, 13555, 13, 1, 501 },
+	{ 0x00B047D4, 13582, 1, 1, 514 },
+	{ 0x00B047D8, 13607, 1, 1, 515 },
+	{ 0x00B047DC, 13632, 25, 1, 516 },
+	{ 0x00B047E0, 13649, 3, 1, 541 },
+	{ 0x00B06000, 13683, 1, 1, 544 },
+	{ 0x00B06040, 13718, 1, 1, 545 },
+	{ 0x00B06080, 13750, 1, 1, 546 },
+	{ 0x00B060C0, 13781, 1, 1, 547 },
+	{ 0x00B06100, 13875, 6, 1, 548 },
+	{ 0x00B06104, 13931, 3, 1, 554 },
+	{ 0x00B07000, 14089, 10, 1, 557 },
+	{ 0x00B07004, 14110, 10, 1, 557 },
+	{ 0x00B07008, 14131, 10, 1, 557 },
+	{ 0x00B0700C, 14152, 10, 1, 557 },
+	{ 0x00B07010, 14173, 10, 1, 557 },
+	{ 0x00B07014, 14194, 10, 1, 557 },
+	{ 0x00B07018, 14215, 10, 1, 557 },
+	{ 0x00B0701C, 14236, 10, 1, 557 },
+	{ 0x00B07020, 14257, 10, 1, 557 },
+	{ 0x00B07024, 14278, 10, 1, 557 },
+	{ 0x00B07028, 14299, 10, 1, 557 },
+	{ 0x00B0702C, 14321, 10, 1, 557 },
+	{ 0x00B07030, 14343, 10, 1, 557 },
+	{ 0x00B07034, 14365, 10, 1, 557 },
+	{ 0x00B07038, 14387, 10, 1, 557 },
+	{ 0x00B0703C, 14409, 10, 1, 557 },
+	{ 0x00B07040, 14431, 10, 1, 557 },
+	{ 0x00B07044, 14453, 10, 1, 557 },
+	{ 0x00B07048, 14475, 10, 1, 557 },
+	{ 0x00B0704C, 14497, 10, 1, 557 },
+	{ 0x00B07050, 14519, 10, 1, 557 },
+	{ 0x00B07054, 14541, 10, 1, 557 },
+	{ 0x00B07058, 14563, 10, 1, 557 },
+	{ 0x00B0705C, 14585, 10, 1, 557 },
+	{ 0x00B07060, 14607, 10, 1, 557 },
+	{ 0x00B07064, 14629, 10, 1, 557 },
+	{ 0x00B07068, 14651, 10, 1, 557 },
+	{ 0x00B0706C, 14673, 10, 1, 557 },
+	{ 0x00B07070, 14695, 10, 1, 557 },
+	{ 0x00B07074, 14717, 10, 1, 557 },
+	{ 0x00B07078, 14739, 10, 1, 557 },
+	{ 0x00B0707C, 14761, 10, 1, 557 },
+	{ 0x00B07800, 14783, 1, 1, 498 },
+	{ 0x00B07804, 14823, 2, 1, 567 },
+	{ 0x00B07808, 14849, 1, 1, 498 },
+	{ 0x00B0780C, 14872, 2, 1, 567 },
+	{ 0x00B07810, 14898, 1, 1, 498 },
+	{ 0x00B07814, 14921, 2, 1, 567 },
+	{ 0x00B07818, 14947, 1, 1, 498 },
+	{ 0x00B0781C, 14970, 2, 1, 567 },
+	{ 0x00B07820, 14996, 1, 1, 498 },
+	{ 0x00B07824, 15019, 2, 1, 567 },
+	{ 0x00B07828, 15045, 1, 1, 498 },
+	{ 0x00B0782C, 15068, 2, 1, 567 },
+	{ 0x00B07830, 15094, 1, 1, 498 },
+	{ 0x00B07834, 15117, 2, 1, 567 },
+	{ 0x00B07838, 15143, 1, 1, 498 },
+	{ 0x00B0783C, 15166, 2, 1, 567 },
+	{ 0x00B07840, 15192, 1, 1, 498 },
+	{ 0x00B07844, 15215, 2, 1, 567 },
+	{ 0x00B07848, 15241, 1, 1, 498 },
+	{ 0x00B0784C, 15264, 2, 1, 567 },
+	{ 0x00B07850, 15290, 1, 1, 569 },
+	{ 0x00B07854, 15314, 1, 1, 569 },
+	{ 0x00B07858, 15338, 1, 1, 569 },
+	{ 0x00B0785C, 15362, 1, 1, 569 },
+	{ 0x00B07860, 15386, 1, 1, 569 },
+	{ 0x00B07864, 15410, 1, 1, 569 },
+	{ 0x00B07868, 15434, 1, 1, 569 },
+	{ 0x00B0786C, 15458, 1, 1, 569 },
+	{ 0x00B07880, 15482, 1, 1, 498 },
+	{ 0x00B07884, 15506, 1, 1, 570 },
+	{ 0x00B07888, 15530, 1, 1, 498 },
+	{ 0x00B0788C, 15552, 1, 1, 570 },
+	{ 0x00B07890, 15574, 1, 1, 498 },
+	{ 0x00B07894, 15635, 2, 1, 571 },
+	{ 0x00B07898, 15661, 1, 1, 498 },
+	{ 0x00B0789C, 15687, 1, 1, 570 },
+	{ 0x00B078F8, 16043, 26, 1, 573 },
+	{ 0x00B078FC, 16324, 29, 1, 599 },
+	{ 0x00B07900, 16415, 7, 1, 628 },
+	{ 0x00B07904, 16453, 2, 1, 635 },
+	{ 0x00B07908, 16494, 2, 1, 637 },
+	{ 0x00B0790C, 16521, 1, 1, 639 },
+	{ 0x00B07940, 16619, 8, 1, 640 },
+	{ 0x00B07944, 16854, 16, 1, 648 },
+	{ 0x00B07948, 16875, 16, 1, 648 },
+	{ 0x00B0794C, 16895, 4, 1, 664 },
+	{ 0x00B0797C, 17016, 7, 1, 668 },
+	{ 0x00B07984, 17045, 1, 1, 675 },
+	{ 0x00B07C00, 17066, 29, 1, 599 },
+	{ 0x00B07C20, 17129, 7, 1, 676 },
+	{ 0x00B07C24, 17198, 4, 1, 683 },
+	{ 0x00B07C40, 17227, 1, 1, 687 },
+	{ 0x00B07C80, 17288, 3, 1, 688 },
+	{ 0x00B07C84, 17346, 7, 1, 691 },
+	{ 0x00B07C88, 17399, 2, 1, 698 },
+	{ 0x00B07D00, 17437, 1, 1, 700 },
+	{ 0x00B07D04, 17493, 2, 1, 701 },
+	{ 0x00B07D08, 17534, 1, 1, 703 },
+	{ 0x00B07D0C, 17576, 1, 1, 704 },
+	{ 0x00B07D10, 17617, 1, 1, 705 },
+	{ 0x00B07D14, 17663, 1, 1, 706 },
+	{ 0x00B07D18, 17705, 1, 1, 707 },
+	{ 0x00B07D1C, 17745, 1, 1, 708 },
+	{ 0x00B07D20, 17784, 1, 1, 709 },
+	{ 0x00B07D24, 17825, 1, 1, 710 },
+	{ 0x00B07D28, 17854, 1, 1, 711 },
+	{ 0x00B07D30, 17899, 1, 1, 712 },
+	{ 0x00B07D34, 17924, 1, 1, 712 },
+	{ 0x00B07D38, 17949, 1, 1, 712 },
+	{ 0x00B07D3C, 17974, 1, 1, 712 },
+	{ 0x00B07E00, 18368, 24, 1, 713 },
+	{ 0x00B07E04, 18431, 2, 1, 737 },
+	{ 0x00B07E08, 18454, 24, 1, 713 },
+	{ 0x00B07E0C, 18477, 2, 1, 737 },
+	{ 0x00B07E10, 18500, 24, 1, 713 },
+	{ 0x00B07E14, 18523, 2, 1, 737 },
+	{ 0x00B07E18, 18546, 24, 1, 713 },
+	{ 0x00B07E1C, 18569, 2, 1, 737 },
+	{ 0x00B07E20, 18592, 24, 1, 713 },
+	{ 0x00B07E24, 18615, 2, 1, 737 },
+	{ 0x00B07E28, 18638, 24, 1, 713 },
+	{ 0x00B07E2C, 18661, 2, 1, 737 },
+	{ 0x00B07E30, 18684, 24, 1, 713 },
+	{ 0x00B07E34, 18707, 2, 1, 737 },
+	{ 0x00B07E38, 18730, 24, 1, 713 },
+	{ 0x00B07E3C, 18753, 2, 1, 737 },
+	{ 0x00B07E40, 18776, 24, 1, 713 },
+	{ 0x00B07E44, 18799, 2, 1, 737 },
+	{ 0x00B07E48, 18822, 24, 1, 713 },
+	{ 0x00B07E4C, 18845, 2, 1, 737 },
+	{ 0x00B07E50, 18868, 24, 1, 713 },
+	{ 0x00B07E54, 18892, 2, 1, 737 },
+	{ 0x00B07E58, 18916, 24, 1, 713 },
+	{ 0x00B07E5C, 18940, 2, 1, 737 },
+	{ 0x00B07E60, 18964, 24, 1, 713 },
+	{ 0x00B07E64, 18988, 2, 1, 737 },
+	{ 0x00B07E68, 19012, 24, 1, 713 },
+	{ 0x00B07E6C, 19036, 2, 1, 737 },
+	{ 0x00B07E70, 19060, 24, 1, 713 },
+	{ 0x00B07E74, 19084, 2, 1, 737 },
+	{ 0x00B07E78, 19108, 24, 1, 713 },
+	{ 0x00B07E7C, 19132, 2, 1, 737 },
+	{ 0x00B07FFC, 19171, 1, 1, 739 },
+	{ 0x00B08000, 19201, 1, 1, 740 },
+	{ 0x00B08004, 19241, 1, 1, 740 },
+	{ 0x00B08008, 19281, 1, 1, 740 },
+	{ 0x00B0800C, 19301, 1, 1, 740 },
+	{ 0x00B08010, 19321, 1, 1, 740 },
+	{ 0x00B08014, 19350, 1, 1, 740 },
+	{ 0x00B08018, 19379, 1, 1, 740 },
+	{ 0x00B0801C, 19406, 1, 1, 740 },
+	{ 0x00B08020, 19433, 1, 1, 740 },
+	{ 0x00B08024, 19457, 1, 1, 740 },
+	{ 0x00B08028, 19481, 1, 1, 740 },
+	{ 0x00B0802C, 19503, 1, 1, 740 },
+	{ 0x00B08030, 19525, 1, 1, 740 },
+	{ 0x00B08034, 19552, 1, 1, 740 },
+	{ 0x00B08038, 19579, 1, 1, 740 },
+	{ 0x00B0803C, 19607, 1, 1, 740 },
+	{ 0x00B08040, 19635, 1, 1, 740 },
+	{ 0x00B08044, 19665, 1, 1, 740 },
+	{ 0x00B08048, 19695, 1, 1, 740 },
+	{ 0x00B0804C, 19723, 1, 1, 740 },
+	{ 0x00B08050, 19751, 1, 1, 740 },
+	{ 0x00B08054, 19782, 1, 1, 740 },
+	{ 0x00B08080, 19813, 1, 1, 740 },
+	{ 0x00B08084, 19853, 1, 1, 740 },
+	{ 0x00B08088, 19893, 1, 1, 740 },
+	{ 0x00B0808C, 19913, 1, 1, 740 },
+	{ 0x00B08090, 19933, 1, 1, 740 },
+	{ 0x00B08094, 19962, 1, 1, 740 },
+	{ 0x00B08098, 19991, 1, 1, 740 },
+	{ 0x00B0809C, 20018, 1, 1, 740 },
+	{ 0x00B080A0, 20045, 1, 1, 740 },
+	{ 0x00B080A4, 20069, 1, 1, 740 },
+	{ 0x00B080A8, 20093, 1, 1, 740 },
+	{ 0x00B080AC, 20115, 1, 1, 740 },
+	{ 0x00B080B0, 20137, 1, 1, 740 },
+	{ 0x00B080B4, 20164, 1, 1, 740 },
+	{ 0x00B080B8, 20191, 1, 1, 740 },
+	{ 0x00B080BC, 20219, 1, 1, 740 },
+	{ 0x00B080C0, 20247, 1, 1, 740 },
+	{ 0x00B080C4, 20277, 1, 1, 740 },
+	{ 0x00B080C8, 20307, 1, 1, 740 },
+	{ 0x00B080CC, 20335, 1, 1, 740 },
+	{ 0x00B080D0, 20363, 1, 1, 740 },
+	{ 0x00B080D4, 20394, 1, 1, 740 },
+	{ 0x00B08100, 20425, 1, 1, 740 },
+	{ 0x00B08104, 20465, 1, 1, 740 },
+	{ 0x00B08108, 20505, 1, 1, 740 },
+	{ 0x00B0810C, 20525, 1, 1, 740 },
+	{ 0x00B08110, 20545, 1, 1, 740 },
+	{ 0x00B08114, 20574, 1, 1, 740 },
+	{ 0x00B08118, 20603, 1, 1, 740 },
+	{ 0x00B0811C, 20630, 1, 1, 740 },
+	{ 0x00B08120, 20657, 1, 1, 740 },
+	{ 0x00B08124, 20681, 1, 1, 740 },
+	{ 0x00B08128, 20705, 1, 1, 740 },
+	{ 0x00B0812C, 20727, 1, 1, 740 },
+	{ 0x00B08130, 20749, 1, 1, 740 },
+	{ 0x00B08134, 20776, 1, 1, 740 },
+	{ 0x00B08138, 20803, 1, 1, 740 },
+	{ 0x00B0813C, 20831, 1, 1, 740 },
+	{ 0x00B08140, 20859, 1, 1, 740 },
+	{ 0x00B08144, 20889, 1, 1, 740 },
+	{ 0x00B08148, 20919, 1, 1, 740 },
+	{ 0x00B0814C, 20947, 1, 1, 740 },
+	{ 0x00B08150, 20975, 1, 1, 740 },
+	{ 0x00B08154, 21006, 1, 1, 740 },
+	{ 0x00B08180, 21037, 1, 1, 740 },
+	{ 0x00B08184, 21077, 1, 1, 740 },
+	{ 0x00B08188, 21117, 1, 1, 740 },
+	{ 0x00B0818C, 21137, 1, 1, 740 },
+	{ 0x00B08190, 21157, 1, 1, 740 },
+	{ 0x00B08194, 21186, 1, 1, 740 },
+	{ 0x00B08198, 21215, 1, 1, 740 },
+	{ 0x00B0819C, 21242, 1, 1, 740 },
+	{ 0x00B081A0, 21269, 1, 1, 740 },
+	{ 0x00B081A4, 21293, 1, 1, 740 },
+	{ 0x00B081A8, 21317, 1, 1, 740 },
+	{ 0x00B081AC, 21339, 1, 1, 740 },
+	{ 0x00B081B0, 21361, 1, 1, 740 },
+	{ 0x00B081B4, 21388, 1, 1, 740 },
+	{ 0x00B081B8, 21415, 1, 1, 740 },
+	{ 0x00B081BC, 21443, 1, 1, 740 },
+	{ 0x00B081C0, 21471, 1, 1, 740 },
+	{ 0x00B081C4, 21501, 1, 1, 740 },
+	{ 0x00B081C8, 21531, 1, 1, 740 },
+	{ 0x00B081CC, 21559, 1, 1, 740 },
+	{ 0x00B081D0, 21587, 1, 1, 740 },
+	{ 0x00B081D4, 21618, 1, 1, 740 },
+	{ 0x00B08200, 21649, 1, 1, 740 },
+	{ 0x00B08204, 21689, 1, 1, 740 },
+	{ 0x00B08208, 21729, 1, 1, 740 },
+	{ 0x00B0820C, 21749, 1, 1, 740 },
+	{ 0x00B08210, 21769, 1, 1, 740 },
+	{ 0x00B08214, 21798, 1, 1, 740 },
+	{ 0x00B08218, 21827, 1, 1, 740 },
+	{ 0x00B0821C, 21854, 1, 1, 740 },
+	{ 0x00B08220, 21881, 1, 1, 740 },
+	{ 0x00B08224, 21905, 1, 1, 740 },
+	{ 0x00B08228, 21929, 1, 1, 740 },
+	{ 0x00B0822C, 21951, 1, 1, 740 },
+	{ 0x00B08230, 21973, 1, 1, 740 },
+	{ 0x00B08234, 22000, 1, 1, 740 },
+	{ 0x00B08238, 22027, 1, 1, 740 },
+	{ 0x00B0823C, 22055, 1, 1, 740 },
+	{ 0x00B08240, 22083, 1, 1, 740 },
+	{ 0x00B08244, 22113, 1, 1, 740 },
+	{ 0x00B08248, 22143, 1, 1, 740 },
+	{ 0x00B0824C, 22171, 1, 1, 740 },
+	{ 0x00B08250, 22199, 1, 1, 740 },
+	{ 0x00B08254, 22230, 1, 1, 740 },
+	{ 0x00B08280, 22261, 1, 1, 740 },
+	{ 0x00B08284, 22301, 1, 1, 740 },
+	{ 0x00B08288, 22341, 1, 1, 740 },
+	{ 0x00B0828C, 22361, 1, 1, 740 },
+	{ 0x00B08290, 22381, 1, 1, 740 },
+	{ 0x00B08294, 22410, 1, 1, 740 },
+	{ 0x00B08298, 22439, 1, 1, 740 },
+	{ 0x00B0829C, 22466, 1, 1, 740 },
+	{ 0x00B082A0, 22493, 1, 1, 740 },
+	{ 0x00B082A4, 22517, 1, 1, 740 },
+	{ 0x00B082A8, 22541, 1, 1, 740 },
+	{ 0x00B082AC, 22563, 1, 1, 740 },
+	{ 0x00B082B0, 22585, 1, 1, 740 },
+	{ 0x00B082B4, 22612, 1, 1, 740 },
+	{ 0x00B082B8, 22639, 1, 1, 740 },
+	{ 0x00B082BC, 22667, 1, 1, 740 },
+	{ 0x00B082C0, 22695, 1, 1, 740 },
+	{ 0x00B082C4, 22725, 1, 1, 740 },
+	{ 0x00B082C8, 22755, 1, 1, 740 },
+	{ 0x00B082CC, 22783, 1, 1, 740 },
+	{ 0x00B082D0, 22811, 1, 1, 740 },
+	{ 0x00B082D4, 22842, 1, 1, 740 },
+	{ 0x00B08300, 22873, 1, 1, 740 },
+	{ 0x00B08304, 22913, 1, 1, 740 },
+	{ 0x00B08308, 22953, 1, 1, 740 },
+	{ 0x00B0830C, 22973, 1, 1, 740 },
+	{ 0x00B08310, 22993, 1, 1, 740 },
+	{ 0x00B08314, 23022, 1, 1, 740 },
+	{ 0x00B08318, 23051, 1, 1, 740 },
+	{ 0x00B0831C, 23078, 1, 1, 740 },
+	{ 0x00B08320, 23105, 1, 1, 740 },
+	{ 0x00B08324, 23129, 1, 1, 740 },
+	{ 0x00B08328, 23153, 1, 1, 740 },
+	{ 0x00B0832C, 23175, 1, 1, 740 },
+	{ 0x00B08330, 23197, 1, 1, 740 },
+	{ 0x00B08334, 23224, 1, 1, 740 },
+	{ 0x00B08338, 23251, 1, 1, 740 },
+	{ 0x00B0833C, 23279, 1, 1, 740 },
+	{ 0x00B08340, 23307, 1, 1, 740 },
+	{ 0x00B08344, 23337, 1, 1, 740 },
+	{ 0x00B08348, 23367, 1, 1, 740 },
+	{ 0x00B0834C, 23395, 1, 1, 740 },
+	{ 0x00B08350, 23423, 1, 1, 740 },
+	{ 0x00B08354, 23454, 1, 1, 740 },
+	{ 0x00B08380, 23485, 1, 1, 740 },
+	{ 0x00B08384, 23525, 1, 1, 740 },
+	{ 0x00B08388, 23565, 1, 1, 740 },
+	{ 0x00B0838C, 23585, 1, 1, 740 },
+	{ 0x00B08390, 23605, 1, 1, 740 },
+	{ 0x00B08394, 23634, 1, 1, 740 },
+	{ 0x00B08398, 23663, 1, 1, 740 },
+	{ 0x00B0839C, 23690, 1, 1, 740 },
+	{ 0x00B083A0, 23717, 1, 1, 740 },
+	{ 0x00B083A4, 23741, 1, 1, 740 },
+	{ 0x00B083A8, 23765, 1, 1, 740 },
+	{ 0x00B083AC, 23787, 1, 1, 740 },
+	{ 0x00B083B0, 23809, 1, 1, 740 },
+	{ 0x00B083B4, 23836, 1, 1, 740 },
+	{ 0x00B083B8, 23863, 1, 1, 740 },
+	{ 0x00B083BC, 23891, 1, 1, 740 },
+	{ 0x00B083C0, 23919, 1, 1, 740 },
+	{ 0x00B083C4, 23949, 1, 1, 740 },
+	{ 0x00B083C8, 23979, 1, 1, 740 },
+	{ 0x00B083CC, 24007, 1, 1, 740 },
+	{ 0x00B083D0, 24035, 1, 1, 740 },
+	{ 0x00B083D4, 24066, 1, 1, 740 },
+	{ 0x00B08400, 24097, 1, 1, 740 },
+	{ 0x00B08404, 24137, 1, 1, 740 },
+	{ 0x00B08408, 24177, 1, 1, 740 },
+	{ 0x00B0840C, 24197, 1, 1, 740 },
+	{ 0x00B08410, 24217, 1, 1, 740 },
+	{ 0x00B08414, 24246, 1, 1, 740 },
+	{ 0x00B08418, 24275, 1, 1, 740 },
+	{ 0x00B0841C, 24302, 1, 1, 740 },
+	{ 0x00B08420, 24329, 1, 1, 740 },
+	{ 0x00B08424, 24353, 1, 1, 740 },
+	{ 0x00B08428, 24377, 1, 1, 740 },
+	{ 0x00B0842C, 24399, 1, 1, 740 },
+	{ 0x00B08430, 24421, 1, 1, 740 },
+	{ 0x00B08434, 24448, 1, 1, 740 },
+	{ 0x00B08438, 24475, 1, 1, 740 },
+	{ 0x00B0843C, 24503, 1, 1, 740 },
+	{ 0x00B08440, 24531, 1, 1, 740 },
+	{ 0x00B08444, 24561, 1, 1, 740 },
+	{ 0x00B08448, 24591, 1, 1, 740 },
+	{ 0x00B0844C, 24619, 1, 1, 740 },
+	{ 0x00B08450, 24647, 1, 1, 740 },
+	{ 0x00B08454, 24678, 1, 1, 740 },
+	{ 0x00B08480, 24709, 1, 1, 740 },
+	{ 0x00B08484, 24749, 1, 1, 740 },
+	{ 0x00B08488, 24789, 1, 1, 740 },
+	{ 0x00B0848C, 24809, 1, 1, 740 },
+	{ 0x00B08490, 24829, 1, 1, 740 },
+	{ 0x00B08494, 24858, 1, 1, 740 },
+	{ 0x00B08498, 24887, 1, 1, 740 },
+	{ 0x00B0849C, 24914, 1, 1, 740 },
+	{ 0x00B084A0, 24941, 1, 1, 740 },
+	{ 0x00B084A4, 24965, 1, 1, 740 },
+	{ 0x00B084A8, 24989, 1, 1, 740 },
+	{ 0x00B084AC, 25011, 1, 1, 740 },
+	{ 0x00B084B0, 25033, 1, 1, 740 },
+	{ 0x00B084B4, 25060, 1, 1, 740 },
+	{ 0x00B084B8, 25087, 1, 1, 740 },
+	{ 0x00B084BC, 25115, 1, 1, 740 },
+	{ 0x00B084C0, 25143, 1, 1, 740 },
+	{ 0x00B084C4, 25173, 1, 1, 740 },
+	{ 0x00B084C8, 25203, 1, 1, 740 },
+	{ 0x00B084CC, 25231, 1, 1, 740 },
+	{ 0x00B084D0, 25259, 1, 1, 740 },
+	{ 0x00B084D4, 25290, 1, 1, 740 },
+	{ 0x00B08500, 25321, 1, 1, 740 },
+	{ 0x00B08504, 25362, 1, 1, 740 },
+	{ 0x00B08508, 25403, 1, 1, 740 },
+	{ 0x00B0850C, 25424, 1, 1, 740 },
+	{ 0x00B08510, 25445, 1, 1, 740 },
+	{ 0x00B08514, 25475, 1, 1, 740 },
+	{ 0x00B08518, 25505, 1, 1, 740 },
+	{ 0x00B0851C, 25533, 1, 1, 740 },
+	{ 0x00B08520, 25561, 1, 1, 740 },
+	{ 0x00B08524, 25586, 1, 1, 740 },
+	{ 0x00B08528, 25611, 1, 1, 740 },
+	{ 0x00B0852C, 25634, 1, 1, 740 },
+	{ 0x00B08530, 25657, 1, 1, 740 },
+	{ 0x00B08534, 25685, 1, 1, 740 },
+	{ 0x00B08538, 25713, 1, 1, 740 },
+	{ 0x00B0853C, 25742, 1, 1, 740 },
+	{ 0x00B08540, 25771, 1, 1, 740 },
+	{ 0x00B08544, 25802, 1, 1, 740 },
+	{ 0x00B08548, 25833, 1, 1, 740 },
+	{ 0x00B0854C, 25862, 1, 1, 740 },
+	{ 0x00B08550, 25891, 1, 1, 740 },
+	{ 0x00B08554, 25923, 1, 1, 740 },
+	{ 0x00B08580, 25955, 1, 1, 740 },
+	{ 0x00B08584, 25996, 1, 1, 740 },
+	{ 0x00B08588, 26037, 1, 1, 740 },
+	{ 0x00B0858C, 26058, 1, 1, 740 },
+	{ 0x00B08590, 26079, 1, 1, 740 },
+	{ 0x00B08594, 26109, 1, 1, 740 },
+	{ 0x00B08598, 26139, 1, 1, 740 },
+	{ 0x00B0859C, 26167, 1, 1, 740 },
+	{ 0x00B085A0, 26195, 1, 1, 740 },
+	{ 0x00B085A4, 26220, 1, 1, 740 },
+	{ 0x00B085A8, 26245, 1, 1, 740 },
+	{ 0x00B085AC, 26268, 1, 1, 740 },
+	{ 0x00B085B0, 26291, 1, 1, 740 },
+	{ 0x00B085B4, 26319, 1, 1, 740 },
+	{ 0x00B085B8, 26347, 1, 1, 740 },
+	{ 0x00B085BC, 26376, 1, 1, 740 },
+	{ 0x00B085C0, 26405, 1, 1, 740 },
+	{ 0x00B085C4, 26436, 1, 1, 740 },
+	{ 0x00B085C8, 26467, 1, 1, 740 },
+	{ 0x00B085CC, 26496, 1, 1, 740 },
+	{ 0x00B085D0, 26525, 1, 1, 740 },
+	{ 0x00B085D4, 26557, 1, 1, 740 },
+	{ 0x00B08600, 26589, 1, 1, 740 },
+	{ 0x00B08604, 26630, 1, 1, 740 },
+	{ 0x00B08608, 26671, 1, 1, 740 },
+	{ 0x00B0860C, 26692, 1, 1, 740 },
+	{ 0x00B08610, 26713, 1, 1, 740 },
+	{ 0x00B08614, 26743, 1, 1, 740 },
+	{ 0x00B08618, 26773, 1, 1, 740 },
+	{ 0x00B0861C, 26801, 1, 1, 740 },
+	{ 0x00B08620, 26829, 1, 1, 740 },
+	{ 0x00B08624, 26854, 1, 1, 740 },
+	{ 0x00B08628, 26879, 1, 1, 740 },
+	{ 0x00B0862C, 26902, 1, 1, 740 },
+	{ 0x00B08630, 26925, 1, 1, 740 },
+	{ 0x00B08634, 26953, 1, 1, 740 },
+	{ 0x00B08638, 26981, 1, 1, 740 },
+	{ 0x00B0863C, 27010, 1, 1, 740 },
+	{ 0x00B08640, 27039, 1, 1, 740 },
+	{ 0x00B08644, 27070, 1, 1, 740 },
+	{ 0x00B08648, 27101, 1, 1, 740 },
+	{ 0x00B0864C, 27130, 1, 1, 740 },
+	{ 0x00B08650, 27159, 1, 1, 740 },
+	{ 0x00B08654, 27191, 1, 1, 740 },
+	{ 0x00B08680, 27223, 1, 1, 740 },
+	{ 0x00B08684, 27264, 1, 1, 740 },
+	{ 0x00B08688, 27305, 1, 1, 740 },
+	{ 0x00B0868C, 27326, 1, 1, 740 },
+	{ 0x00B08690, 27347, 1, 1, 740 },
+	{ 0x00B08694, 27377, 1, 1, 740 },
+	{ 0x00B08698, 27407, 1, 1, 740 },
+	{ 0x00B0869C, 27435, 1, 1, 740 },
+	{ 0x00B086A0, 27463, 1, 1, 740 },
+	{ 0x00B086A4, 27488, 1, 1, 740 },
+	{ 0x00B086A8, 27513, 1, 1, 740 },
+	{ 0x00B086AC, 27536, 1, 1, 740 },
+	{ 0x00B086B0, 27559, 1, 1, 740 },
+	{ 0x00B086B4, 27587, 1, 1, 740 },
+	{ 0x00B086B8, 27615, 1, 1, 740 },
+	{ 0x00B086BC, 27644, 1, 1, 740 },
+	{ 0x00B086C0, 27673, 1, 1, 740 },
+	{ 0x00B086C4, 27704, 1, 1, 740 },
+	{ 0x00B086C8, 27735, 1, 1, 740 },
+	{ 0x00B086CC, 27764, 1, 1, 740 },
+	{ 0x00B086D0, 27793, 1, 1, 740 },
+	{ 0x00B086D4, 27825, 1, 1, 740 },
+	{ 0x00B08700, 27857, 1, 1, 740 },
+	{ 0x00B08704, 27898, 1, 1, 740 },
+	{ 0x00B08708, 27939, 1, 1, 740 },
+	{ 0x00B0870C, 27960, 1, 1, 740 },
+	{ 0x00B08710, 27981, 1, 1, 740 },
+	{ 0x00B08714, 28011, 1, 1, 740 },
+	{ 0x00B08718, 28041, 1, 1, 740 },
+	{ 0x00B0871C, 28069, 1, 1, 740 },
+	{ 0x00B08720, 28097, 1, 1, 740 },
+	{ 0x00B08724, 28122, 1, 1, 740 },
+	{ 0x00B08728, 28147, 1, 1, 740 },
+	{ 0x00B0872C, 28170, 1, 1, 740 },
+	{ 0x00B08730, 28193, 1, 1, 740 },
+	{ 0x00B08734, 28221, 1, 1, 740 },
+	{ 0x00B08738, 28249, 1, 1, 740 },
+	{ 0x00B0873C, 28278, 1, 1, 740 },
+	{ 0x00B08740, 28307, 1, 1, 740 },
+	{ 0x00B08744, 28338, 1, 1, 740 },
+	{ 0x00B08748, 28369, 1, 1, 740 },
+	{ 0x00B0874C, 28398, 1, 1, 740 },
+	{ 0x00B08750, 28427, 1, 1, 740 },
+	{ 0x00B08754, 28459, 1, 1, 740 },
+	{ 0x00B08780, 28491, 1, 1, 740 },
+	{ 0x00B08784, 28532, 1, 1, 740 },
+	{ 0x00B08788, 28573, 1, 1, 740 },
+	{ 0x00B0878C, 28594, 1, 1, 740 },
+	{ 0x00B08790, 28615, 1, 1, 740 },
+	{ 0x00B08794, 28645, 1, 1, 740 },
+	{ 0x00B08798, 28675, 1, 1, 740 },
+	{ 0x00B0879C, 28703, 1, 1, 740 },
+	{ 0x00B087A0, 28731, 1, 1, 740 },
+	{ 0x00B087A4, 28756, 1, 1, 740 },
+	{ 0x00B087A8, 28781, 1, 1, 740 },
+	{ 0x00B087AC, 28804, 1, 1, 740 },
+	{ 0x00B087B0, 28827, 1, 1, 740 },
+	{ 0x00B087B4, 28855, 1, 1, 740 },
+	{ 0x00B087B8, 28883, 1, 1, 740 },
+	{ 0x00B087BC, 28912, 1, 1, 740 },
+	{ 0x00B087C0, 28941, 1, 1, 740 },
+	{ 0x00B087C4, 28972, 1, 1, 740 },
+	{ 0x00B087C8, 29003, 1, 1, 740 },
+	{ 0x00B087CC, 29032, 1, 1, 740 },
+	{ 0x00B087D0, 29061, 1, 1, 740 },
+	{ 0x00B087D4, 29093, 1, 1, 740 },
+	{ 0x00B08800, 29125, 1, 1, 740 },
+	{ 0x00B08804, 29166, 1, 1, 740 },
+	{ 0x00B08808, 29207, 1, 1, 740 },
+	{ 0x00B0880C, 29228, 1, 1, 740 },
+	{ 0x00B08810, 29249, 1, 1, 740 },
+	{ 0x00B08814, 29279, 1, 1, 740 },
+	{ 0x00B08818, 29309, 1, 1, 740 },
+	{ 0x00B0881C, 29337, 1, 1, 740 },
+	{ 0x00B08820, 29365, 1, 1, 740 },
+	{ 0x00B08824, 29390, 1, 1, 740 },
+	{ 0x00B08828, 29415, 1, 1, 740 },
+	{ 0x00B0882C, 29438, 1, 1, 740 },
+	{ 0x00B08830, 29461, 1, 1, 740 },
+	{ 0x00B08834, 29489, 1, 1, 740 },
+	{ 0x00B08838, 29517, 1, 1, 740 },
+	{ 0x00B0883C, 29546, 1, 1, 740 },
+	{ 0x00B08840, 29575, 1, 1, 740 },
+	{ 0x00B08844, 29606, 1, 1, 740 },
+	{ 0x00B08848, 29637, 1, 1, 740 },
+	{ 0x00B0884C, 29666, 1, 1, 740 },
+	{ 0x00B08850, 29695, 1, 1, 740 },
+	{ 0x00B08854, 29727, 1, 1, 740 },
+	{ 0x00B08880, 29759, 1, 1, 740 },
+	{ 0x00B08884, 29800, 1, 1, 740 },
+	{ 0x00B08888, 29841, 1, 1, 740 },
+	{ 0x00B0888C, 29862, 1, 1, 740 },
+	{ 0x00B08890, 29883, 1, 1, 740 },
+	{ 0x00B08894, 29913, 1, 1, 740 },
+	{ 0x00B08898, 29943, 1, 1, 740 },
+	{ 0x00B0889C, 29971, 1, 1, 740 },
+	{ 0x00B088A0, 29999, 1, 1, 740 },
+	{ 0x00B088A4, 30024, 1, 1, 740 },
+	{ 0x00B088A8, 30049, 1, 1, 740 },
+	{ 0x00B088AC, 30072, 1, 1, 740 },
+	{ 0x00B088B0, 30095, 1, 1, 740 },
+	{ 0x00B088B4, 30123, 1, 1, 740 },
+	{ 0x00B088B8, 30151, 1, 1, 740 },
+	{ 0x00B088BC, 30180, 1, 1, 740 },
+	{ 0x00B088C0, 30209, 1, 1, 740 },
+	{ 0x00B088C4, 30240, 1, 1, 740 },
+	{ 0x00B088C8, 30271, 1, 1, 740 },
+	{ 0x00B088CC, 30300, 1, 1, 740 },
+	{ 0x00B088D0, 30329, 1, 1, 740 },
+	{ 0x00B088D4, 30361, 1, 1, 740 },
+	{ 0x00B08900, 30393, 1, 1, 740 },
+	{ 0x00B08904, 30434, 1, 1, 740 },
+	{ 0x00B08908, 30475, 1, 1, 740 },
+	{ 0x00B0890C, 30496, 1, 1, 740 },
+	{ 0x00B08910, 30517, 1, 1, 740 },
+	{ 0x00B08914, 30547, 1, 1, 740 },
+	{ 0x00B08918, 30577, 1, 1, 740 },
+	{ 0x00B0891C, 30605, 1, 1, 740 },
+	{ 0x00B08920, 30633, 1, 1, 740 },
+	{ 0x00B08924, 30658, 1, 1, 740 },
+	{ 0x00B08928, 30683, 1, 1, 740 },
+	{ 0x00B0892C, 30706, 1, 1, 740 },
+	{ 0x00B08930, 30729, 1, 1, 740 },
+	{ 0x00B08934, 30757, 1, 1, 740 },
+	{ 0x00B08938, 30785, 1, 1, 740 },
+	{ 0x00B0893C, 30814, 1, 1, 740 },
+	{ 0x00B08940, 30843, 1, 1, 740 },
+	{ 0x00B08944, 30874, 1, 1, 740 },
+	{ 0x00B08948, 30905, 1, 1, 740 },
+	{ 0x00B0894C, 30934, 1, 1, 740 },
+	{ 0x00B08950, 30963, 1, 1, 740 },
+	{ 0x00B08954, 30995, 1, 1, 740 },
+	{ 0x00B08980, 31027, 1, 1, 740 },
+	{ 0x00B08984, 31068, 1, 1, 740 },
+	{ 0x00B08988, 31109, 1, 1, 740 },
+	{ 0x00B0898C, 31130, 1, 1, 740 },
+	{ 0x00B08990, 31151, 1, 1, 740 },
+	{ 0x00B08994, 31181, 1, 1, 740 },
+	{ 0x00B08998, 31211, 1, 1, 740 },
+	{ 0x00B0899C, 31239, 1, 1, 740 },
+	{ 0x00B089A0, 31267, 1, 1, 740 },
+	{ 0x00B089A4, 31292, 1, 1, 740 },
+	{ 0x00B089A8, 31317, 1, 1, 740 },
+	{ 0x00B089AC, 31340, 1, 1, 740 },
+	{ 0x00B089B0, 31363, 1, 1, 740 },
+	{ 0x00B089B4, 31391, 1, 1, 740 },
+	{ 0x00B089B8, 31419, 1, 1, 740 },
+	{ 0x00B089BC, 31448, 1, 1, 740 },
+	{ 0x00B089C0, 31477, 1, 1, 740 },
+	{ 0x00B089C4, 31508, 1, 1, 740 },
+	{ 0x00B089C8, 31539, 1, 1, 740 },
+	{ 0x00B089CC, 31568, 1, 1, 740 },
+	{ 0x00B089D0, 31597, 1, 1, 740 },
+	{ 0x00B089D4, 31629, 1, 1, 740 },
+	{ 0x00B08A00, 31661, 1, 1, 740 },
+	{ 0x00B08A04, 31702, 1, 1, 740 },
+	{ 0x00B08A08, 31743, 1, 1, 740 },
+	{ 0x00B08A0C, 31764, 1, 1, 740 },
+	{ 0x00B08A10, 31785, 1, 1, 740 },
+	{ 0x00B08A14, 31815, 1, 1, 740 },
+	{ 0x00B08A18, 31845, 1, 1, 740 },
+	{ 0x00B08A1C, 31873, 1, 1, 740 },
+	{ 0x00B08A20, 31901, 1, 1, 740 },
+	{ 0x00B08A24, 31926, 1, 1, 740 },
+	{ 0x00B08A28, 31951, 1, 1, 740 },
+	{ 0x00B08A2C, 31974, 1, 1, 740 },
+	{ 0x00B08A30, 31997, 1, 1, 740 },
+	{ 0x00B08A34, 32025, 1, 1, 740 },
+	{ 0x00B08A38, 32053, 1, 1, 740 },
+	{ 0x00B08A3C, 32082, 1, 1, 740 },
+	{ 0x00B08A40, 32111, 1, 1, 740 },
+	{ 0x00B08A44, 32142, 1, 1, 740 },
+	{ 0x00B08A48, 32173, 1, 1, 740 },
+	{ 0x00B08A4C, 32202, 1, 1, 740 },
+	{ 0x00B08A50, 32231, 1, 1, 740 },
+	{ 0x00B08A54, 32263, 1, 1, 740 },
+	{ 0x00B08A80, 32295, 1, 1, 740 },
+	{ 0x00B08A84, 32336, 1, 1, 740 },
+	{ 0x00B08A88, 32377, 1, 1, 740 },
+	{ 0x00B08A8C, 32398, 1, 1, 740 },
+	{ 0x00B08A90, 32419, 1, 1, 740 },
+	{ 0x00B08A94, 32449, 1, 1, 740 },
+	{ 0x00B08A98, 32479, 1, 1, 740 },
+	{ 0x00B08A9C, 32507, 1, 1, 740 },
+	{ 0x00B08AA0, 32535, 1, 1, 740 },
+	{ 0x00B08AA4, 32560, 1, 1, 740 },
+	{ 0x00B08AA8, 32585, 1, 1, 740 },
+	{ 0x00B08AAC, 32608, 1, 1, 740 },
+	{ 0x00B08AB0, 32631, 1, 1, 740 },
+	{ 0x00B08AB4, 32659, 1, 1, 740 },
+	{ 0x00B08AB8, 32687, 1, 1, 740 },
+	{ 0x00B08ABC, 32716, 1, 1, 740 },
+	{ 0x00B08AC0, 32745, 1, 1, 740 },
+	{ 0x00B08AC4, 32776, 1, 1, 740 },
+	{ 0x00B08AC8, 32807, 1, 1, 740 },
+	{ 0x00B08ACC, 32836, 1, 1, 740 },
+	{ 0x00B08AD0, 32865, 1, 1, 740 },
+	{ 0x00B08AD4, 32897, 1, 1, 740 },
+	{ 0x00B08B00, 32929, 1, 1, 740 },
+	{ 0x00B08B04, 32970, 1, 1, 740 },
+	{ 0x00B08B08, 33011, 1, 1, 740 },
+	{ 0x00B08B0C, 33032, 1, 1, 740 },
+	{ 0x00B08B10, 33053, 1, 1, 740 },
+	{ 0x00B08B14, 33083, 1, 1, 740 },
+	{ 0x00B08B18, 33113, 1, 1, 740 },
+	{ 0x00B08B1C, 33141, 1, 1, 740 },
+	{ 0x00B08B20, 33169, 1, 1, 740 },
+	{ 0x00B08B24, 33194, 1, 1, 740 },
+	{ 0x00B08B28, 33219, 1, 1, 740 },
+	{ 0x00B08B2C, 33242, 1, 1, 740 },
+	{ 0x00B08B30, 33265, 1, 1, 740 },
+	{ 0x00B08B34, 33293, 1, 1, 740 },
+	{ 0x00B08B38, 33321, 1, 1, 740 },
+	{ 0x00B08B3C, 33350, 1, 1, 740 },
+	{ 0x00B08B40, 33379, 1, 1, 740 },
+	{ 0x00B08B44, 33410, 1, 1, 740 },
+	{ 0x00B08B48, 33441, 1, 1, 740 },
+	{ 0x00B08B4C, 33470, 1, 1, 740 },
+	{ 0x00B08B50, 33499, 1, 1, 740 },
+	{ 0x00B08B54, 33531, 1, 1, 740 },
+	{ 0x00B08B80, 33563, 1, 1, 740 },
+	{ 0x00B08B84, 33604, 1, 1, 740 },
+	{ 0x00B08B88, 33645, 1, 1, 740 },
+	{ 0x00B08B8C, 33666, 1, 1, 740 },
+	{ 0x00B08B90, 33687, 1, 1, 740 },
+	{ 0x00B08B94, 33717, 1, 1, 740 },
+	{ 0x00B08B98, 33747, 1, 1, 740 },
+	{ 0x00B08B9C, 33775, 1, 1, 740 },
+	{ 0x00B08BA0, 33803, 1, 1, 740 },
+	{ 0x00B08BA4, 33828, 1, 1, 740 },
+	{ 0x00B08BA8, 33853, 1, 1, 740 },
+	{ 0x00B08BAC, 33876, 1, 1, 740 },
+	{ 0x00B08BB0, 33899, 1, 1, 740 },
+	{ 0x00B08BB4, 33927, 1, 1, 740 },
+	{ 0x00B08BB8, 33955, 1, 1, 740 },
+	{ 0x00B08BBC, 33984, 1, 1, 740 },
+	{ 0x00B08BC0, 34013, 1, 1, 740 },
+	{ 0x00B08BC4, 34044, 1, 1, 740 },
+	{ 0x00B08BC8, 34075, 1, 1, 740 },
+	{ 0x00B08BCC, 34104, 1, 1, 740 },
+	{ 0x00B08BD0, 34133, 1, 1, 740 },
+	{ 0x00B08BD4, 34165, 1, 1, 740 },
+	{ 0x00B08C00, 34197, 1, 1, 740 },
+	{ 0x00B08C04, 34238, 1, 1, 740 },
+	{ 0x00B08C08, 34279, 1, 1, 740 },
+	{ 0x00B08C0C, 34300, 1, 1, 740 },
+	{ 0x00B08C10, 34321, 1, 1, 740 },
+	{ 0x00B08C14, 34351, 1, 1, 740 },
+	{ 0x00B08C18, 34381, 1, 1, 740 },
+	{ 0x00B08C1C, 34409, 1, 1, 740 },
+	{ 0x00B08C20, 34437, 1, 1, 740 },
+	{ 0x00B08C24, 34462, 1, 1, 740 },
+	{ 0x00B08C28, 34487, 1, 1, 740 },
+	{ 0x00B08C2C, 34510, 1, 1, 740 },
+	{ 0x00B08C30, 34533, 1, 1, 740 },
+	{ 0x00B08C34, 34561, 1, 1, 740 },
+	{ 0x00B08C38, 34589, 1, 1, 740 },
+	{ 0x00B08C3C, 34618, 1, 1, 740 },
+	{ 0x00B08C40, 34647, 1, 1, 740 },
+	{ 0x00B08C44, 34678, 1, 1, 740 },
+	{ 0x00B08C48, 34709, 1, 1, 740 },
+	{ 0x00B08C4C, 34738, 1, 1, 740 },
+	{ 0x00B08C50, 34767, 1, 1, 740 },
+	{ 0x00B08C54, 34799, 1, 1, 740 },
+	{ 0x00B08C80, 34831, 1, 1, 740 },
+	{ 0x00B08C84, 34872, 1, 1, 740 },
+	{ 0x00B08C88, 34913, 1, 1, 740 },
+	{ 0x00B08C8C, 34934, 1, 1, 740 },
+	{ 0x00B08C90, 34955, 1, 1, 740 },
+	{ 0x00B08C94, 34985, 1, 1, 740 },
+	{ 0x00B08C98, 35015, 1, 1, 740 },
+	{ 0x00B08C9C, 35043, 1, 1, 740 },
+	{ 0x00B08CA0, 35071, 1, 1, 740 },
+	{ 0x00B08CA4, 35096, 1, 1, 740 },
+	{ 0x00B08CA8, 35121, 1, 1, 740 },
+	{ 0x00B08CAC, 35144, 1, 1, 740 },
+	{ 0x00B08CB0, 35167, 1, 1, 740 },
+	{ 0x00B08CB4, 35195, 1, 1, 740 },
+	{ 0x00B08CB8, 35223, 1, 1, 740 },
+	{ 0x00B08CBC, 35252, 1, 1, 740 },
+	{ 0x00B08CC0, 35281, 1, 1, 740 },
+	{ 0x00B08CC4, 35312, 1, 1, 740 },
+	{ 0x00B08CC8, 35343, 1, 1, 740 },
+	{ 0x00B08CCC, 35372, 1, 1, 740 },
+	{ 0x00B08CD0, 35401, 1, 1, 740 },
+	{ 0x00B08CD4, 35433, 1, 1, 740 },
+	{ 0x00B08D00, 35465, 1, 1, 740 },
+	{ 0x00B08D04, 35506, 1, 1, 740 },
+	{ 0x00B08D08, 35547, 1, 1, 740 },
+	{ 0x00B08D0C, 35568, 1, 1, 740 },
+	{ 0x00B08D10, 35589, 1, 1, 740 },
+	{ 0x00B08D14, 35619, 1, 1, 740 },
+	{ 0x00B08D18, 35649, 1, 1, 740 },
+	{ 0x00B08D1C, 35677, 1, 1, 740 },
+	{ 0x00B08D20, 35705, 1, 1, 740 },
+	{ 0x00B08D24, 35730, 1, 1, 740 },
+	{ 0x00B08D28, 35755, 1, 1, 740 },
+	{ 0x00B08D2C, 35778, 1, 1, 740 },
+	{ 0x00B08D30, 35801, 1, 1, 740 },
+	{ 0x00B08D34, 35829, 1, 1, 740 },
+	{ 0x00B08D38, 35857, 1, 1, 740 },
+	{ 0x00B08D3C, 35886, 1, 1, 740 },
+	{ 0x00B08D40, 35915, 1, 1, 740 },
+	{ 0x00B08D44, 35946, 1, 1, 740 },
+	{ 0x00B08D48, 35977, 1, 1, 740 },
+	{ 0x00B08D4C, 36006, 1, 1, 740 },
+	{ 0x00B08D50, 36035, 1, 1, 740 },
+	{ 0x00B08D54, 36067, 1, 1, 740 },
+	{ 0x00B08D80, 36099, 1, 1, 740 },
+	{ 0x00B08D84, 36140, 1, 1, 740 },
+	{ 0x00B08D88, 36181, 1, 1, 740 },
+	{ 0x00B08D8C, 36202, 1, 1, 740 },
+	{ 0x00B08D90, 36223, 1, 1, 740 },
+	{ 0x00B08D94, 36253, 1, 1, 740 },
+	{ 0x00B08D98, 36283, 1, 1, 740 },
+	{ 0x00B08D9C, 36311, 1, 1, 740 },
+	{ 0x00B08DA0, 36339, 1, 1, 740 },
+	{ 0x00B08DA4, 36364, 1, 1, 740 },
+	{ 0x00B08DA8, 36389, 1, 1, 740 },
+	{ 0x00B08DAC, 36412, 1, 1, 740 },
+	{ 0x00B08DB0, 36435, 1, 1, 740 },
+	{ 0x00B08DB4, 36463, 1, 1, 740 },
+	{ 0x00B08DB8, 36491, 1, 1, 740 },
+	{ 0x00B08DBC, 36520, 1, 1, 740 },
+	{ 0x00B08DC0, 36549, 1, 1, 740 },
+	{ 0x00B08DC4, 36580, 1, 1, 740 },
+	{ 0x00B08DC8, 36611, 1, 1, 740 },
+	{ 0x00B08DCC, 36640, 1, 1, 740 },
+	{ 0x00B08DD0, 36669, 1, 1, 740 },
+	{ 0x00B08DD4, 36701, 1, 1, 740 },
+	{ 0x00B08E00, 36733, 1, 1, 740 },
+	{ 0x00B08E04, 36774, 1, 1, 740 },
+	{ 0x00B08E08, 36815, 1, 1, 740 },
+	{ 0x00B08E0C, 36836, 1, 1, 740 },
+	{ 0x00B08E10, 36857, 1, 1, 740 },
+	{ 0x00B08E14, 36887, 1, 1, 740 },
+	{ 0x00B08E18, 36917, 1, 1, 740 },
+	{ 0x00B08E1C, 36945, 1, 1, 740 },
+	{ 0x00B08E20, 36973, 1, 1, 740 },
+	{ 0x00B08E24, 36998, 1, 1, 740 },
+	{ 0x00B08E28, 37023, 1, 1, 740 },
+	{ 0x00B08E2C, 37046, 1, 1, 740 },
+	{ 0x00B08E30, 37069, 1, 1, 740 },
+	{ 0x00B08E34, 37097, 1, 1, 740 },
+	{ 0x00B08E38, 37125, 1, 1, 740 },
+	{ 0x00B08E3C, 37154, 1, 1, 740 },
+	{ 0x00B08E40, 37183, 1, 1, 740 },
+	{ 0x00B08E44, 37214, 1, 1, 740 },
+	{ 0x00B08E48, 37245, 1, 1, 740 },
+	{ 0x00B08E4C, 37274, 1, 1, 740 },
+	{ 0x00B08E50, 37303, 1, 1, 740 },
+	{ 0x00B08E54, 37335, 1, 1, 740 },
+	{ 0x00B08E80, 37367, 1, 1, 740 },
+	{ 0x00B08E84, 37408, 1, 1, 740 },
+	{ 0x00B08E88, 37449, 1, 1, 740 },
+	{ 0x00B08E8C, 37470, 1, 1, 740 },
+	{ 0x00B08E90, 37491, 1, 1, 740 },
+	{ 0x00B08E94, 37521, 1, 1, 740 },
+	{ 0x00B08E98, 37551, 1, 1, 740 },
+	{ 0x00B08E9C, 37579, 1, 1, 740 },
+	{ 0x00B08EA0, 37607, 1, 1, 740 },
+	{ 0x00B08EA4, 37632, 1, 1, 740 },
+	{ 0x00B08EA8, 37657, 1, 1, 740 },
+	{ 0x00B08EAC, 37680, 1, 1, 740 },
+	{ 0x00B08EB0, 37703, 1, 1, 740 },
+	{ 0x00B08EB4, 37731, 1, 1, 740 },
+	{ 0x00B08EB8, 37759, 1, 1, 740 },
+	{ 0x00B08EBC, 37788, 1, 1, 740 },
+	{ 0x00B08EC0, 37817, 1, 1, 740 },
+	{ 0x00B08EC4, 37848, 1, 1, 740 },
+	{ 0x00B08EC8, 37879, 1, 1, 740 },
+	{ 0x00B08ECC, 37908, 1, 1, 740 },
+	{ 0x00B08ED0, 37937, 1, 1, 740 },
+	{ 0x00B08ED4, 37969, 1, 1, 740 },
+	{ 0x00B08F00, 38001, 1, 1, 740 },
+	{ 0x00B08F04, 38042, 1, 1, 740 },
+	{ 0x00B08F08, 38083, 1, 1, 740 },
+	{ 0x00B08F0C, 38104, 1, 1, 740 },
+	{ 0x00B08F10, 38125, 1, 1, 740 },
+	{ 0x00B08F14, 38155, 1, 1, 740 },
+	{ 0x00B08F18, 38185, 1, 1, 740 },
+	{ 0x00B08F1C, 38213, 1, 1, 740 },
+	{ 0x00B08F20, 38241, 1, 1, 740 },
+	{ 0x00B08F24, 38266, 1, 1, 740 },
+	{ 0x00B08F28, 38291, 1, 1, 740 },
+	{ 0x00B08F2C, 38314, 1, 1, 740 },
+	{ 0x00B08F30, 38337, 1, 1, 740 },
+	{ 0x00B08F34, 38365, 1, 1, 740 },
+	{ 0x00B08F38, 38393, 1, 1, 740 },
+	{ 0x00B08F3C, 38422, 1, 1, 740 },
+	{ 0x00B08F40, 38451, 1, 1, 740 },
+	{ 0x00B08F44, 38482, 1, 1, 740 },
+	{ 0x00B08F48, 38513, 1, 1, 740 },
+	{ 0x00B08F4C, 38542, 1, 1, 740 },
+	{ 0x00B08F50, 38571, 1, 1, 740 },
+	{ 0x00B08F54, 38603, 1, 1, 740 },
+	{ 0x00B08F80, 38635, 1, 1, 740 },
+	{ 0x00B08F84, 38676, 1, 1, 740 },
+	{ 0x00B08F88, 38717, 1, 1, 740 },
+	{ 0x00B08F8C, 38738, 1, 1, 740 },
+	{ 0x00B08F90, 38759, 1, 1, 740 },
+	{ 0x00B08F94, 38789, 1, 1, 740 },
+	{ 0x00B08F98, 38819, 1, 1, 740 },
+	{ 0x00B08F9C, 38847, 1, 1, 740 },
+	{ 0x00B08FA0, 38875, 1, 1, 740 },
+	{ 0x00B08FA4, 38900, 1, 1, 740 },
+	{ 0x00B08FA8, 38925, 1, 1, 740 },
+	{ 0x00B08FAC, 38948, 1, 1, 740 },
+	{ 0x00B08FB0, 38971, 1, 1, 740 },
+	{ 0x00B08FB4, 38999, 1, 1, 740 },
+	{ 0x00B08FB8, 39027, 1, 1, 740 },
+	{ 0x00B08FBC, 39056, 1, 1, 740 },
+	{ 0x00B08FC0, 39085, 1, 1, 740 },
+	{ 0x00B08FC4, 39116, 1, 1, 740 },
+	{ 0x00B08FC8, 39147, 1, 1, 740 },
+	{ 0x00B08FCC, 39176, 1, 1, 740 },
+	{ 0x00B08FD0, 39205, 1, 1, 740 },
+	{ 0x00B08FD4, 39237, 1, 1, 740 },
+	{ 0x00B0C000, 39269, 1, 1, 740 },
+	{ 0x00B0C004, 39298, 1, 1, 740 },
+	{ 0x00B0C008, 39327, 1, 1, 740 },
+	{ 0x00B0C00C, 39352, 1, 1, 740 },
+	{ 0x00B0C010, 39377, 1, 1, 740 },
+	{ 0x00B0C014, 39404, 1, 1, 740 },
+	{ 0x00B0C018, 39431, 1, 1, 740 },
+	{ 0x00B0C01C, 39465, 1, 1, 740 },
+	{ 0x00B0C020, 39499, 1, 1, 740 },
+	{ 0x00B0C024, 39534, 1, 1, 740 },
+	{ 0x00B0C080, 39569, 1, 1, 740 },
+	{ 0x00B0C084, 39598, 1, 1, 740 },
+	{ 0x00B0C088, 39627, 1, 1, 740 },
+	{ 0x00B0C08C, 39652, 1, 1, 740 },
+	{ 0x00B0C090, 39677, 1, 1, 740 },
+	{ 0x00B0C094, 39704, 1, 1, 740 },
+	{ 0x00B0C098, 39731, 1, 1, 740 },
+	{ 0x00B0C09C, 39765, 1, 1, 740 },
+	{ 0x00B0C0A0, 39799, 1, 1, 740 },
+	{ 0x00B0C0A4, 39834, 1, 1, 740 },
+	{ 0x00B0C100, 39869, 1, 1, 740 },
+	{ 0x00B0C104, 39898, 1, 1, 740 },
+	{ 0x00B0C108, 39927, 1, 1, 740 },
+	{ 0x00B0C10C, 39952, 1, 1, 740 },
+	{ 0x00B0C110, 39977, 1, 1, 740 },
+	{ 0x00B0C114, 40004, 1, 1, 740 },
+	{ 0x00B0C118, 40031, 1, 1, 740 },
+	{ 0x00B0C11C, 40065, 1, 1, 740 },
+	{ 0x00B0C120, 40099, 1, 1, 740 },
+	{ 0x00B0C124, 40134, 1, 1, 740 },
+	{ 0x00B0C180, 40169, 1, 1, 740 },
+	{ 0x00B0C184, 40198, 1, 1, 740 },
+	{ 0x00B0C188, 40227, 1, 1, 740 },
+	{ 0x00B0C18C, 40252, 1, 1, 740 },
+	{ 0x00B0C190, 40277, 1, 1, 740 },
+	{ 0x00B0C194, 40304, 1, 1, 740 },
+	{ 0x00B0C198, 40331, 1, 1, 740 },
+	{ 0x00B0C19C, 40365, 1, 1, 740 },
+	{ 0x00B0C1A0, 40399, 1, 1, 740 },
+	{ 0x00B0C1A4, 40434, 1, 1, 740 },
+	{ 0x00B0C200, 40469, 1, 1, 740 },
+	{ 0x00B0C204, 40498, 1, 1, 740 },
+	{ 0x00B0C208, 40527, 1, 1, 740 },
+	{ 0x00B0C20C, 40552, 1, 1, 740 },
+	{ 0x00B0C210, 40577, 1, 1, 740 },
+	{ 0x00B0C214, 40604, 1, 1, 740 },
+	{ 0x00B0C218, 40631, 1, 1, 740 },
+	{ 0x00B0C21C, 40665, 1, 1, 740 },
+	{ 0x00B0C220, 40699, 1, 1, 740 },
+	{ 0x00B0C224, 40734, 1, 1, 740 },
+	{ 0x00B0C280, 40769, 1, 1, 740 },
+	{ 0x00B0C284, 40798, 1, 1, 740 },
+	{ 0x00B0C288, 40827, 1, 1, 740 },
+	{ 0x00B0C28C, 40852, 1, 1, 740 },
+	{ 0x00B0C290, 40877, 1, 1, 740 },
+	{ 0x00B0C294, 40904, 1, 1, 740 },
+	{ 0x00B0C298, 40931, 1, 1, 740 },
+	{ 0x00B0C29C, 40965, 1, 1, 740 },
+	{ 0x00B0C2A0, 40999, 1, 1, 740 },
+	{ 0x00B0C2A4, 41034, 1, 1, 740 },
+	{ 0x00B0C300, 41069, 1, 1, 740 },
+	{ 0x00B0C304, 41098, 1, 1, 740 },
+	{ 0x00B0C308, 41127, 1, 1, 740 },
+	{ 0x00B0C30C, 41152, 1, 1, 740 },
+	{ 0x00B0C310, 41177, 1, 1, 740 },
+	{ 0x00B0C314, 41204, 1, 1, 740 },
+	{ 0x00B0C318, 41231, 1, 1, 740 },
+	{ 0x00B0C31C, 41265, 1, 1, 740 },
+	{ 0x00B0C320, 41299, 1, 1, 740 },
+	{ 0x00B0C324, 41334, 1, 1, 740 },
+	{ 0x00B0C380, 41369, 1, 1, 740 },
+	{ 0x00B0C384, 41398, 1, 1, 740 },
+	{ 0x00B0C388, 41427, 1, 1, 740 },
+	{ 0x00B0C38C, 41452, 1, 1, 740 },
+	{ 0x00B0C390, 41477, 1, 1, 740 },
+	{ 0x00B0C394, 41504, 1, 1, 740 },
+	{ 0x00B0C398, 41531, 1, 1, 740 },
+	{ 0x00B0C39C, 41565, 1, 1, 740 },
+	{ 0x00B0C3A0, 41599, 1, 1, 740 },
+	{ 0x00B0C3A4, 41634, 1, 1, 740 },
+	{ 0x00B0C400, 41669, 1, 1, 740 },
+	{ 0x00B0C404, 41696, 1, 1, 740 },
+	{ 0x00B0C408, 41723, 1, 1, 740 },
+	{ 0x00B0C40C, 41742, 1, 1, 740 },
+	{ 0x00B0C410, 41761, 1, 1, 740 },
+	{ 0x00B0C414, 41781, 1, 1, 740 },
+	{ 0x00B0C418, 41801, 1, 1, 740 },
+	{ 0x00B0C41C, 41824, 1, 1, 740 },
+	{ 0x00B0C420, 41847, 1, 1, 740 },
+	{ 0x00B0C424, 41868, 1, 1, 740 },
+	{ 0x00B0C428, 41889, 1, 1, 740 },
+	{ 0x00B0C42C, 41910, 1, 1, 740 },
+	{ 0x00B0C430, 41931, 1, 1, 740 },
+	{ 0x00B0C434, 41958, 1, 1, 740 },
+	{ 0x00B0C438, 41985, 1, 1, 740 },
+	{ 0x00B0C43C, 42005, 1, 1, 740 },
+	{ 0x00B0C440, 42025, 1, 1, 740 },
+	{ 0x00B0C444, 42050, 1, 1, 740 },
+	{ 0x00B0C448, 42075, 1, 1, 740 },
+	{ 0x00B0C44C, 42115, 1, 1, 740 },
+	{ 0x00B0C450, 42155, 1, 1, 740 },
+	{ 0x00B0C454, 42197, 1, 1, 740 },
+	{ 0x00B0C458, 42239, 1, 1, 740 },
+	{ 0x00B0C45C, 42276, 1, 1, 740 },
+	{ 0x00B0C460, 42313, 1, 1, 740 },
+	{ 0x00B0C464, 42352, 1, 1, 740 },
+	{ 0x00B0C468, 42391, 1, 1, 740 },
+	{ 0x00B0C46C, 42414, 1, 1, 740 },
+	{ 0x00B0C800, 42474, 2, 1, 741 },
+	{ 0x00B0C804, 42533, 2, 1, 743 },
+	{ 0x00B0C808, 42573, 1, 1, 745 },
+	{ 0x00B0C80C, 42644, 6, 1, 746 },
+	{ 0x00B0C810, 42730, 5, 1, 752 },
+	{ 0x00B0C814, 42791, 2, 1, 757 },
+	{ 0x00B0C818, 42833, 1, 1, 759 },
+	{ 0x00B0C820, 42872, 1, 1, 760 },
+	{ 0x00B0C824, 42916, 1, 1, 761 },
+	{ 0x00B0C830, 42959, 1, 1, 762 },
+	{ 0x00B0C834, 43003, 1, 1, 763 },
+	{ 0x00B0C840, 43036, 1, 1, 764 },
+	{ 0x00B0C844, 43098, 4, 1, 765 },
+	{ 0x00B0C848, 43131, 1, 1, 769 },
+	{ 0x00B0C850, 43162, 1, 1, 770 },
+	{ 0x00B0C900, 43193, 1, 1, 771 },
+	{ 0x00B0C904, 43216, 1, 1, 771 },
+	{ 0x00B0C908, 43239, 1, 1, 771 },
+	{ 0x00B0C90C, 43262, 1, 1, 771 },
+	{ 0x00B0C910, 43285, 1, 1, 771 },
+	{ 0x00B0C914, 43308, 1, 1, 771 },
+	{ 0x00B0C918, 43331, 1, 1, 771 },
+	{ 0x00B0C91C, 43354, 1, 1, 771 },
+	{ 0x00B0C920, 43377, 1, 1, 771 },
+	{ 0x00B0C924, 43400, 1, 1, 771 },
+	{ 0x00B0C928, 43423, 1, 1, 771 },
+	{ 0x00B0C92C, 43447, 1, 1, 771 },
+	{ 0x00B0C930, 43471, 1, 1, 771 },
+	{ 0x00B0C934, 43495, 1, 1, 771 },
+	{ 0x00B0C938, 43519, 1, 1, 771 },
+	{ 0x00B0C93C, 43543, 1, 1, 771 },
+	{ 0x00B0C940, 43567, 1, 1, 771 },
+	{ 0x00B0C944, 43591, 1, 1, 771 },
+	{ 0x00B0C948, 43615, 1, 1, 771 },
+	{ 0x00B0C94C, 43639, 1, 1, 771 },
+	{ 0x00B0C950, 43663, 1, 1, 771 },
+	{ 0x00B0C954, 43687, 1, 1, 771 },
+	{ 0x00B0C958, 43711, 1, 1, 771 },
+	{ 0x00B0C95C, 43735, 1, 1, 771 },
+	{ 0x00B0C960, 43759, 1, 1, 771 },
+	{ 0x00B0C964, 43783, 1, 1, 771 },
+	{ 0x00B0C968, 43807, 1, 1, 771 },
+	{ 0x00B0C96C, 43831, 1, 1, 771 },
+	{ 0x00B0C970, 43855, 1, 1, 771 },
+	{ 0x00B0C974, 43879, 1, 1, 771 },
+	{ 0x00B0C978, 43903, 1, 1, 771 },
+	{ 0x00B0C97C, 43927, 1, 1, 771 },
+	{ 0x00B0E000, 43966, 2, 1, 772 },
+	{ 0x00B0E004, 44146, 19, 1, 774 },
+	{ 0x00B0E008, 44168, 2, 1, 793 },
+	{ 0x00B0E010, 44188, 2, 1, 772 },
+	{ 0x00B0E014, 44210, 19, 1, 774 },
+	{ 0x00B0E018, 44232, 2, 1, 793 },
+	{ 0x00B0E020, 44252, 2, 1, 772 },
+	{ 0x00B0E024, 44274, 19, 1, 774 },
+	{ 0x00B0E028, 44296, 2, 1, 793 },
+	{ 0x00B0E030, 44316, 2, 1, 772 },
+	{ 0x00B0E034, 44338, 19, 1, 774 },
+	{ 0x00B0E038, 44360, 2, 1, 793 },
+	{ 0x00B0E040, 44380, 2, 1, 772 },
+	{ 0x00B0E044, 44402, 19, 1, 774 },
+	{ 0x00B0E048, 44424, 2, 1, 793 },
+	{ 0x00B0E050, 44444, 2, 1, 772 },
+	{ 0x00B0E054, 44466, 19, 1, 774 },
+	{ 0x00B0E058, 44488, 2, 1, 793 },
+	{ 0x00B0E060, 44508, 2, 1, 772 },
+	{ 0x00B0E064, 44530, 19, 1, 774 },
+	{ 0x00B0E068, 44552, 2, 1, 793 },
+	{ 0x00B0E070, 44572, 2, 1, 772 },
+	{ 0x00B0E074, 44594, 19, 1, 774 },
+	{ 0x00B0E078, 44616, 2, 1, 793 },
+	{ 0x00B0E080, 44636, 2, 1, 772 },
+	{ 0x00B0E084, 44658, 19, 1, 774 },
+	{ 0x00B0E088, 44680, 2, 1, 793 },
+	{ 0x00B0E090, 44700, 2, 1, 772 },
+	{ 0x00B0E094, 44722, 19, 1, 774 },
+	{ 0x00B0E098, 44744, 2, 1, 793 },
+	{ 0x00B0E0A0, 44764, 2, 1, 772 },
+	{ 0x00B0E0A4, 44787, 19, 1, 774 },
+	{ 0x00B0E0A8, 44810, 2, 1, 793 },
+	{ 0x00B0E0B0, 44831, 2, 1, 772 },
+	{ 0x00B0E0B4, 44854, 19, 1, 774 },
+	{ 0x00B0E0B8, 44877, 2, 1, 793 },
+	{ 0x00B0E0C0, 44898, 2, 1, 772 },
+	{ 0x00B0E0C4, 44921, 19, 1, 774 },
+	{ 0x00B0E0C8, 44944, 2, 1, 793 },
+	{ 0x00B0E0D0, 44965, 2, 1, 772 },
+	{ 0x00B0E0D4, 44988, 19, 1, 774 },
+	{ 0x00B0E0D8, 45011, 2, 1, 793 },
+	{ 0x00B0E0E0, 45032, 2, 1, 772 },
+	{ 0x00B0E0E4, 45055, 19, 1, 774 },
+	{ 0x00B0E0E8, 45078, 2, 1, 793 },
+	{ 0x00B0E0F0, 45099, 2, 1, 772 },
+	{ 0x00B0E0F4, 45122, 19, 1, 774 },
+	{ 0x00B0E0F8, 45145, 2, 1, 793 },
+	{ 0x00B0E100, 45166, 2, 1, 772 },
+	{ 0x00B0E104, 45189, 19, 1, 774 },
+	{ 0x00B0E108, 45212, 2, 1, 793 },
+	{ 0x00B0E110, 45233, 2, 1, 772 },
+	{ 0x00B0E114, 45256, 19, 1, 774 },
+	{ 0x00B0E118, 45279, 2, 1, 793 },
+	{ 0x00B0E120, 45300, 2, 1, 772 },
+	{ 0x00B0E124, 45323, 19, 1, 774 },
+	{ 0x00B0E128, 45346, 2, 1, 793 },
+	{ 0x00B0E130, 45367, 2, 1, 772 },
+	{ 0x00B0E134, 45390, 19, 1, 774 },
+	{ 0x00B0E138, 45413, 2, 1, 793 },
+	{ 0x00B0E140, 45434, 2, 1, 772 },
+	{ 0x00B0E144, 45457, 19, 1, 774 },
+	{ 0x00B0E148, 45480, 2, 1, 793 },
+	{ 0x00B0E150, 45501, 2, 1, 772 },
+	{ 0x00B0E154, 45524, 19, 1, 774 },
+	{ 0x00B0E158, 45547, 2, 1, 793 },
+	{ 0x00B0E160, 45568, 2, 1, 772 },
+	{ 0x00B0E164, 45591, 19, 1, 774 },
+	{ 0x00B0E168, 45614, 2, 1, 793 },
+	{ 0x00B0E170, 45635, 2, 1, 772 },
+	{ 0x00B0E174, 45658, 19, 1, 774 },
+	{ 0x00B0E178, 45681, 2, 1, 793 },
+	{ 0x00B0E180, 45702, 2, 1, 772 },
+	{ 0x00B0E184, 45725, 19, 1, 774 },
+	{ 0x00B0E188, 45748, 2, 1, 793 },
+	{ 0x00B0E190, 45769, 2, 1, 772 },
+	{ 0x00B0E194, 45792, 19, 1, 774 },
+	{ 0x00B0E198, 45815, 2, 1, 793 },
+	{ 0x00B0E1A0, 45836, 2, 1, 772 },
+	{ 0x00B0E1A4, 45859, 19, 1, 774 },
+	{ 0x00B0E1A8, 45882, 2, 1, 793 },
+	{ 0x00B0E1B0, 45903, 2, 1, 772 },
+	{ 0x00B0E1B4, 45926, 19, 1, 774 },
+	{ 0x00B0E1B8, 45949, 2, 1, 793 },
+	{ 0x00B0E1C0, 45970, 2, 1, 772 },
+	{ 0x00B0E1C4, 45993, 19, 1, 774 },
+	{ 0x00B0E1C8, 46016, 2, 1, 793 },
+	{ 0x00B0E1D0, 46037, 2, 1, 772 },
+	{ 0x00B0E1D4, 46060, 19, 1, 774 },
+	{ 0x00B0E1D8, 46083, 2, 1, 793 },
+	{ 0x00B0E1E0, 46104, 2, 1, 772 },
+	{ 0x00B0E1E4, 46127, 19, 1, 774 },
+	{ 0x00B0E1E8, 46150, 2, 1, 793 },
+	{ 0x00B0E1F0, 46171, 2, 1, 772 },
+	{ 0x00B0E1F4, 46194, 19, 1, 774 },
+	{ 0x00B0E1F8, 46217, 2, 1, 793 },
+	{ 0x00B0E800, 46238, 1, 1, 544 },
+	{ 0x00B0E840, 46290, 2, 1, 795 },
+	{ 0x00B0E844, 46326, 1, 1, 797 },
+	{ 0x00B0E848, 46370, 6, 1, 798 },
+	{ 0x00B0E850, 46407, 7, 1, 804 },
+	{ 0x00B0E854, 46422, 2, 1, 635 },
+	{ 0x00B0E858, 46438, 2, 1, 637 },
+	{ 0x00B0E85C, 46455, 1, 1, 639 },
+	{ 0x00B0EC00, 46471, 3, 1, 811 },
+	{ 0x00B0EC04, 46553, 13, 1, 814 },
+	{ 0x00B0EC08, 46578, 3, 1, 827 },
+	{ 0x00B0EC40, 46597, 1, 1, 687 },
+	{ 0x00B0F100, 46647, 2, 1, 830 },
+	{ 0x00B0F104, 46669, 2, 1, 830 },
+	{ 0x00B0F108, 46691, 2, 1, 830 },
+	{ 0x00B0F10C, 46713, 2, 1, 830 },
+	{ 0x00B0F110, 46735, 2, 1, 830 },
+	{ 0x00B0F114, 46757, 2, 1, 830 },
+	{ 0x00B0F118, 46779, 2, 1, 830 },
+	{ 0x00B0F11C, 46801, 2, 1, 830 },
+	{ 0x00B0F120, 46823, 2, 1, 830 },
+	{ 0x00B0F124, 46907, 4, 1, 832 },
+	{ 0x00B0F128, 46947, 1, 1, 836 },
+	{ 0x00B0F130, 46986, 1, 1, 837 },
+	{ 0x00B0F134, 47011, 1, 1, 837 },
+	{ 0x00B0F138, 47036, 1, 1, 837 },
+	{ 0x00B0F13C, 47090, 2, 1, 838 },
+	{ 0x00B0F140, 47158, 3, 1, 840 },
+	{ 0x00B0F144, 47253, 5, 1, 843 },
+	{ 0x00B0F400, 47302, 1, 1, 848 },
+	{ 0x00B0F404, 47499, 15, 1, 849 },
+	{ 0x00B0F408, 47578, 4, 1, 864 },
+	{ 0x00B0F40C, 47706, 7, 1, 868 },
+	{ 0x00B0F410, 47992, 16, 1, 875 },
+	{ 0x00B0F414, 48030, 1, 1, 891 },
+	{ 0x00B0F420, 48054, 0, 1, 71 },
+	{ 0x00B0F424, 48083, 0, 1, 71 },
+	{ 0x00B0F428, 48117, 0, 1, 71 },
+	{ 0x00B0F430, 48173, 1, 1, 892 },
+	{ 0x00B0F480, 48201, 0, 1, 71 },
+	{ 0x00B0F484, 48222, 0, 1, 71 },
+	{ 0x00B0F488, 48243, 0, 1, 71 },
+	{ 0x00B0F48C, 48341, 4, 1, 893 },
+	{ 0x00B0F4C0, 48394, 2, 1, 897 },
+	{ 0x00B0F7F8, 48608, 16, 1, 899 },
+	{ 0x00B0F7FC, 48668, 5, 1, 915 },
+	{ 0x00B0F800, 48877, 10, 1, 920 },
+	{ 0x00B0F804, 49045, 10, 1, 930 },
+	{ 0x00B0F808, 49079, 1, 1, 940 },
+	{ 0x00B0F80C, 49122, 1, 1, 941 },
+	{ 0x00B0F810, 49170, 1, 1, 942 },
+	{ 0x00B0F814, 49207, 1, 1, 943 },
+	{ 0x00B0F818, 49240, 1, 1, 944 },
+	{ 0x00B0F81C, 49257, 5, 1, 915 },
+	{ 0x00B0FFF4, 49394, 11, 1, 945 },
+	{ 0x00B0FFF8, 49449, 3, 1, 956 },
+	{ 0x00B0FFFC, 49468, 5, 1, 915 },
+	{ 0x00B24000, 49488, 1, 1, 495 },
+	{ 0x00B24004, 49515, 2, 1, 496 },
+	{ 0x00B24008, 49542, 1, 1, 498 },
+	{ 0x00B2400C, 49569, 2, 1, 499 },
+	{ 0x00B24010, 49596, 13, 1, 501 },
+	{ 0x00B2401C, 49622, 24, 1, 959 },
+	{ 0x00B24020, 49638, 3, 1, 541 },
+	{ 0x00B24040, 49659, 1, 1, 495 },
+	{ 0x00B24044, 49686, 2, 1, 496 },
+	{ 0x00B24048, 49713, 1, 1, 498 },
+	{ 0x00B2404C, 49740, 2, 1, 499 },
+	{ 0x00B24050, 49767, 13, 1, 501 },
+	{ 0x00B2405C, 49793, 24, 1, 959 },
+	{ 0x00B24060, 49809, 3, 1, 541 },
+	{ 0x00B24080, 49830, 1, 1, 495 },
+	{ 0x00B24084, 49857, 2, 1, 496 },
+	{ 0x00B24088, 49884, 1, 1, 498 },
+	{ 0x00B2408C, 49911, 2, 1, 499 },
+	{ 0x00B24090, 49938, 13, 1, 501 },
+	{ 0x00B2409C, 49964, 24, 1, 959 },
+	{ 0x00B240A0, 49980, 3, 1, 541 },
+	{ 0x00B240C0, 50001, 1, 1, 495 },
+	{ 0x00B240C4, 50028, 2, 1, 496 },
+	{ 0x00B240C8, 50055, 1, 1, 498 },
+	{ 0x00B240CC, 50082, 2, 1, 499 },
+	{ 0x00B240D0, 50109, 13, 1, 501 },
+	{ 0x00B240DC, 50135, 24, 1, 959 },
+	{ 0x00B240E0, 50151, 3, 1, 541 },
+	{ 0x00B24100, 50172, 1, 1, 495 },
+	{ 0x00B24104, 50199, 2, 1, 496 },
+	{ 0x00B24108, 50226, 1, 1, 498 },
+	{ 0x00B2410C, 50253, 2, 1, 499 },
+	{ 0x00B24110, 50280, 13, 1, 501 },
+	{ 0x00B2411C, 50306, 24, 1, 959 },
+	{ 0x00B24120, 50322, 3, 1, 541 },
+	{ 0x00B24140, 50343, 1, 1, 495 },
+	{ 0x00B24144, 50370, 2, 1, 496 },
+	{ 0x00B24148, 50397, 1, 1, 498 },
+	{ 0x00B2414C, 50424, 2, 1, 499 },
+	{ 0x00B24150, 50451, 13, 1, 501 },
+	{ 0x00B2415C, 50477, 24, 1, 959 },
+	{ 0x00B24160, 50493, 3, 1, 541 },
+	{ 0x00B24180, 50514, 1, 1, 495 },
+	{ 0x00B24184, 50541, 2, 1, 496 },
+	{ 0x00B24188, 50568, 1, 1, 498 },
+	{ 0x00B2418C, 50595, 2, 1, 499 },
+	{ 0x00B24190, 50622, 13, 1, 501 },
+	{ 0x00B2419C, 50648, 24, 1, 959 },
+	{ 0x00B241A0, 50664, 3, 1, 541 },
+	{ 0x00B241C0, 50685, 1, 1, 495 },
+	{ 0x00B241C4, 50712, 2, 1, 496 },
+	{ 0x00B241C8, 50739, 1, 1, 498 },
+	{ 0x00B241CC, 50766, 2, 1, 499 },
+	{ 0x00B241D0, 50793, 13, 1, 501 },
+	{ 0x00B241DC, 50819, 24, 1, 959 },
+	{ 0x00B241E0, 50835, 3, 1, 541 },
+	{ 0x00B24200, 50856, 1, 1, 495 },
+	{ 0x00B24204, 50883, 2, 1, 496 },
+	{ 0x00B24208, 50910, 1, 1, 498 },
+	{ 0x00B2420C, 50937, 2, 1, 499 },
+	{ 0x00B24210, 50964, 13, 1, 501 },
+	{ 0x00B2421C, 50990, 24, 1, 959 },
+	{ 0x00B24220, 51006, 3, 1, 541 },
+	{ 0x00B24240, 51027, 1, 1, 495 },
+	{ 0x00B24244, 51054, 2, 1, 496 },
+	{ 0x00B24248, 51081, 1, 1, 498 },
+	{ 0x00B2424C, 51108, 2, 1, 499 },
+	{ 0x00B24250, 51135, 13, 1, 501 },
+	{ 0x00B2425C, 51161, 24, 1, 959 },
+	{ 0x00B24260, 51177, 3, 1, 541 },
+	{ 0x00B24280, 51198, 1, 1, 495 },
+	{ 0x00B24284, 51226, 2, 1, 496 },
+	{ 0x00B24288, 51254, 1, 1, 498 },
+	{ 0x00B2428C, 51282, 2, 1, 499 },
+	{ 0x00B24290, 51310, 13, 1, 501 },
+	{ 0x00B2429C, 51337, 24, 1, 959 },
+	{ 0x00B242A0, 51354, 3, 1, 541 },
+	{ 0x00B242C0, 51376, 1, 1, 495 },
+	{ 0x00B242C4, 51404, 2, 1, 496 },
+	{ 0x00B242C8, 51432, 1, 1, 498 },
+	{ 0x00B242CC, 51460, 2, 1, 499 },
+	{ 0x00B242D0, 51488, 13, 1, 501 },
+	{ 0x00B242DC, 51515, 24, 1, 959 },
+	{ 0x00B242E0, 51532, 3, 1, 541 },
+	{ 0x00B24300, 51554, 1, 1, 495 },
+	{ 0x00B24304, 51582, 2, 1, 496 },
+	{ 0x00B24308, 51610, 1, 1, 498 },
+	{ 0x00B2430C, 51638, 2, 1, 499 },
+	{ 0x00B24310, 51666, 13, 1, 501 },
+	{ 0x00B2431C, 51693, 24, 1, 959 },
+	{ 0x00B24320, 51710, 3, 1, 541 },
+	{ 0x00B24340, 51732, 1, 1, 495 },
+	{ 0x00B24344, 51760, 2, 1, 496 },
+	{ 0x00B24348, 51788, 1, 1, 498 },
+	{ 0x00B2434C, 51816, 2, 1, 499 },
+	{ 0x00B24350, 51844, 13, 1, 501 },
+	{ 0x00B2435C, 51871, 24, 1, 959 },
+	{ 0x00B24360, 51888, 3, 1, 541 },
+	{ 0x00B24380, 51910, 1, 1, 495 },
+	{ 0x00B24384, 51938, 2, 1, 496 },
+	{ 0x00B24388, 51966, 1, 1, 498 },
+	{ 0x00B2438C, 51994, 2, 1, 499 },
+	{ 0x00B24390, 52022, 13, 1, 501 },
+	{ 0x00B2439C, 52049, 24, 1, 959 },
+	{ 0x00B243A0, 52066, 3, 1, 541 },
+	{ 0x00B243C0, 52088, 1, 1, 495 },
+	{ 0x00B243C4, 52116, 2, 1, 496 },
+	{ 0x00B243C8, 52144, 1, 1, 498 },
+	{ 0x00B243CC, 52172, 2, 1, 499 },
+	{ 0x00B243D0, 52200, 13, 1, 501 },
+	{ 0x00B243DC, 52227, 24, 1, 959 },
+	{ 0x00B243E0, 52244, 3, 1, 541 },
+	{ 0x00B24400, 52266, 1, 1, 495 },
+	{ 0x00B24404, 52294, 2, 1, 496 },
+	{ 0x00B24408, 52322, 1, 1, 498 },
+	{ 0x00B2440C, 52350, 2, 1, 499 },
+	{ 0x00B24410, 52378, 13, 1, 501 },
+	{ 0x00B2441C, 52405, 24, 1, 959 },
+	{ 0x00B24420, 52422, 3, 1, 541 },
+	{ 0x00B24440, 52444, 1, 1, 495 },
+	{ 0x00B24444, 52472, 2, 1, 496 },
+	{ 0x00B24448, 52500, 1, 1, 498 },
+	{ 0x00B2444C, 52528, 2, 1, 499 },
+	{ 0x00B24450, 52556, 13, 1, 501 },
+	{ 0x00B2445C, 52583, 24, 1, 959 },
+	{ 0x00B24460, 52600, 3, 1, 541 },
+	{ 0x00B24480, 52622, 1, 1, 495 },
+	{ 0x00B24484, 52650, 2, 1, 496 },
+	{ 0x00B24488, 52678, 1, 1, 498 },
+	{ 0x00B2448C, 52706, 2, 1, 499 },
+	{ 0x00B24490, 52734, 13, 1, 501 },
+	{ 0x00B2449C, 52761, 24, 1, 959 },
+	{ 0x00B244A0, 52778, 3, 1, 541 },
+	{ 0x00B244C0, 52800, 1, 1, 495 },
+	{ 0x00B244C4, 52828, 2, 1, 496 },
+	{ 0x00B244C8, 52856, 1, 1, 498 },
+	{ 0x00B244CC, 52884, 2, 1, 499 },
+	{ 0x00B244D0, 52912, 13, 1, 501 },
+	{ 0x00B244DC, 52939, 24, 1, 959 },
+	{ 0x00B244E0, 52956, 3, 1, 541 },
+	{ 0x00B24500, 52978, 1, 1, 495 },
+	{ 0x00B24504, 53006, 2, 1, 496 },
+	{ 0x00B24508, 53034, 1, 1, 498 },
+	{ 0x00B2450C, 53062, 2, 1, 499 },
+	{ 0x00B24510, 53090, 13, 1, 501 },
+	{ 0x00B2451C, 53117, 24, 1, 959 },
+	{ 0x00B24520, 53134, 3, 1, 541 },
+	{ 0x00B24540, 53156, 1, 1, 495 },
+	{ 0x00B24544, 53184, 2, 1, 496 },
+	{ 0x00B24548, 53212, 1, 1, 498 },
+	{ 0x00B2454C, 53240, 2, 1, 499 },
+	{ 0x00B24550, 53268, 13, 1, 501 },
+	{ 0x00B2455C, 53295, 24, 1, 959 },
+	{ 0x00B24560, 53312, 3, 1, 541 },
+	{ 0x00B24580, 53334, 1, 1, 495 },
+	{ 0x00B24584, 53362, 2, 1, 496 },
+	{ 0x00B24588, 53390, 1, 1, 498 },
+	{ 0x00B2458C, 53418, 2, 1, 499 },
+	{ 0x00B24590, 53446, 13, 1, 501 },
+	{ 0x00B2459C, 53473, 24, 1, 959 },
+	{ 0x00B245A0, 53490, 3, 1, 541 },
+	{ 0x00B245C0, 53512, 1, 1, 495 },
+	{ 0x00B245C4, 53540, 2, 1, 496 },
+	{ 0x00B245C8, 53568, 1, 1, 498 },
+	{ 0x00B245CC, 53596, 2, 1, 499 },
+	{ 0x00B245D0, 53624, 13, 1, 501 },
+	{ 0x00B245DC, 53651, 24, 1, 959 },
+	{ 0x00B245E0, 53668, 3, 1, 541 },
+	{ 0x00B24600, 53690, 1, 1, 495 },
+	{ 0x00B24604, 53718, 2, 1, 496 },
+	{ 0x00B24608, 53746, 1, 1, 498 },
+	{ 0x00B2460C, 53774, 2, 1, 499 },
+	{ 0x00B24610, 53802, 13, 1, 501 },
+	{ 0x00B2461C, 53829, 24, 1, 959 },
+	{ 0x00B24620, 53846, 3, 1, 541 },
+	{ 0x00B24640, 53868, 1, 1, 495 },
+	{ 0x00B24644, 53896, 2, 1, 496 },
+	{ 0x00B24648, 53924, 1, 1, 498 },
+	{ 0x00B2464C, 53952, 2, 1, 499 },
+	{ 0x00B24650, 53980, 13, 1, 501 },
+	{ 0x00B2465C, 54007, 24, 1, 959 },
+	{ 0x00B24660, 54024, 3, 1, 541 },
+	{ 0x00B24680, 54046, 1, 1, 495 },
+	{ 0x00B24684, 54074, 2, 1, 496 },
+	{ 0x00B24688, 54102, 1, 1, 498 },
+	{ 0x00B2468C, 54130, 2, 1, 499 },
+	{ 0x00B24690, 54158, 13, 1, 501 },
+	{ 0x00B2469C, 54185, 24, 1, 959 },
+	{ 0x00B246A0, 54202, 3, 1, 541 },
+	{ 0x00B246C0, 54224, 1, 1, 495 },
+	{ 0x00B246C4, 54252, 2, 1, 496 },
+	{ 0x00B246C8, 54280, 1, 1, 498 },
+	{ 0x00B246CC, 54308, 2, 1, 499 },
+	{ 0x00B246D0, 54336, 13, 1, 501 },
+	{ 0x00B246DC, 54363, 24, 1, 959 },
+	{ 0x00B246E0, 54380, 3, 1, 541 },
+	{ 0x00B24700, 54402, 1, 1, 495 },
+	{ 0x00B24704, 54430, 2, 1, 496 },
+	{ 0x00B24708, 54458, 1, 1, 498 },
+	{ 0x00B2470C, 54486, 2, 1, 499 },
+	{ 0x00B24710, 54514, 13, 1, 501 },
+	{ 0x00B2471C, 54541, 24, 1, 959 },
+	{ 0x00B24720, 54558, 3, 1, 541 },
+	{ 0x00B24740, 54580, 1, 1, 495 },
+	{ 0x00B24744, 54608, 2, 1, 496 },
+	{ 0x00B24748, 54636, 1, 1, 498 },
+	{ 0x00B2474C, 54664, 2, 1, 499 },
+	{ 0x00B24750, 54692, 13, 1, 501 },
+	{ 0x00B2475C, 54719, 24, 1, 959 },
+	{ 0x00B24760, 54736, 3, 1, 541 },
+	{ 0x00B24780, 54758, 1, 1, 495 },
+	{ 0x00B24784, 54786, 2, 1, 496 },
+	{ 0x00B24788, 54814, 1, 1, 498 },
+	{ 0x00B2478C, 54842, 2, 1, 499 },
+	{ 0x00B24790, 54870, 13, 1, 501 },
+	{ 0x00B2479C, 54897, 24, 1, 959 },
+	{ 0x00B247A0, 54914, 3, 1, 541 },
+	{ 0x00B247C0, 54936, 1, 1, 495 },
+	{ 0x00B247C4, 54964, 2, 1, 496 },
+	{ 0x00B247C8, 54992, 1, 1, 498 },
+	{ 0x00B247CC, 55020, 2, 1, 499 },
+	{ 0x00B247D0, 55048, 13, 1, 501 },
+	{ 0x00B247DC, 55075, 24, 1, 959 },
+	{ 0x00B247E0, 55092, 3, 1, 541 },
+	{ 0x00B26000, 55114, 1, 1, 544 },
+	{ 0x00B26040, 55137, 1, 1, 545 },
+	{ 0x00B26080, 55160, 1, 1, 546 },
+	{ 0x00B260C0, 55180, 1, 1, 547 },
+	{ 0x00B26100, 55202, 6, 1, 548 },
+	{ 0x00B26104, 55229, 3, 1, 554 },
+	{ 0x00B27000, 55333, 14, 1, 983 },
+	{ 0x00B27004, 55354, 14, 1, 983 },
+	{ 0x00B27008, 55375, 14, 1, 983 },
+	{ 0x00B2700C, 55396, 14, 1, 983 },
+	{ 0x00B27010, 55417, 14, 1, 983 },
+	{ 0x00B27014, 55438, 14, 1, 983 },
+	{ 0x00B27018, 55459, 14, 1, 983 },
+	{ 0x00B2701C, 55480, 14, 1, 983 },
+	{ 0x00B27020, 55501, 14, 1, 983 },
+	{ 0x00B27024, 55522, 14, 1, 983 },
+	{ 0x00B27028, 55543, 14, 1, 983 },
+	{ 0x00B2702C, 55565, 14, 1, 983 },
+	{ 0x00B27030, 55587, 14, 1, 983 },
+	{ 0x00B27034, 55609, 14, 1, 983 },
+	{ 0x00B27038, 55631, 14, 1, 983 },
+	{ 0x00B2703C, 55653, 14, 1, 983 },
+	{ 0x00B27040, 55675, 14, 1, 983 },
+	{ 0x00B27044, 55697, 14, 1, 983 },
+	{ 0x00B27048, 55719, 14, 1, 983 },
+	{ 0x00B2704C, 55741, 14, 1, 983 },
+	{ 0x00B27050, 55763, 14, 1, 983 },
+	{ 0x00B27054, 55785, 14, 1, 983 },
+	{ 0x00B27058, 55807, 14, 1, 983 },
+	{ 0x00B2705C, 55829, 14, 1, 983 },
+	{ 0x00B27060, 55851, 14, 1, 983 },
+	{ 0x00B27064, 55873, 14, 1, 983 },
+	{ 0x00B27068, 55895, 14, 1, 983 },
+	{ 0x00B2706C, 55917, 14, 1, 983 },
+	{ 0x00B27070, 55939, 14, 1, 983 },
+	{ 0x00B27074, 55961, 14, 1, 983 },
+	{ 0x00B27078, 55983, 14, 1, 983 },
+	{ 0x00B2707C, 56005, 14, 1, 983 },
+	{ 0x00B27800, 56027, 1, 1, 498 },
+	{ 0x00B27804, 56050, 2, 1, 567 },
+	{ 0x00B27808, 56076, 1, 1, 498 },
+	{ 0x00B2780C, 56099, 2, 1, 567 },
+	{ 0x00B27810, 56125, 1, 1, 498 },
+	{ 0x00B27814, 56148, 2, 1, 567 },
+	{ 0x00B27818, 56174, 1, 1, 498 },
+	{ 0x00B2781C, 56197, 2, 1, 567 },
+	{ 0x00B27820, 56223, 1, 1, 498 },
+	{ 0x00B27824, 56246, 2, 1, 567 },
+	{ 0x00B27828, 56272, 1, 1, 498 },
+	{ 0x00B2782C, 56295, 2, 1, 567 },
+	{ 0x00B27830, 56321, 1, 1, 498 },
+	{ 0x00B27834, 56344, 2, 1, 567 },
+	{ 0x00B27838, 56370, 1, 1, 498 },
+	{ 0x00B2783C, 56393, 2, 1, 567 },
+	{ 0x00B27840, 56419, 1, 1, 498 },
+	{ 0x00B27844, 56442, 2, 1, 567 },
+	{ 0x00B27848, 56468, 1, 1, 498 },
+	{ 0x00B2784C, 56491, 2, 1, 567 },
+	{ 0x00B27850, 56517, 1, 1, 569 },
+	{ 0x00B27854, 56541, 1, 1, 569 },
+	{ 0x00B27858, 56565, 1, 1, 569 },
+	{ 0x00B2785C, 56589, 1, 1, 569 },
+	{ 0x00B27860, 56613, 1, 1, 569 },
+	{ 0x00B27864, 56637, 1, 1, 569 },
+	{ 0x00B27868, 56661, 1, 1, 569 },
+	{ 0x00B2786C, 56685, 1, 1, 569 },
+	{ 0x00B27880, 56709, 1, 1, 498 },
+	{ 0x00B27884, 56733, 1, 1, 570 },
+	{ 0x00B27888, 56757, 1, 1, 498 },
+	{ 0x00B2788C, 56779, 1, 1, 570 },
+	{ 0x00B27890, 56801, 1, 1, 498 },
+	{ 0x00B27894, 56827, 2, 1, 571 },
+	{ 0x00B27898, 56853, 1, 1, 498 },
+	{ 0x00B2789C, 56879, 1, 1, 570 },
+	{ 0x00B278F8, 56905, 26, 1, 573 },
+	{ 0x00B278FC, 56924, 29, 1, 599 },
+	{ 0x00B27900, 56945, 7, 1, 628 },
+	{ 0x00B27904, 56961, 2, 1, 635 },
+	{ 0x00B27908, 56978, 2, 1, 637 },
+	{ 0x00B2790C, 56996, 1, 1, 639 },
+	{ 0x00B27940, 57013, 8, 1, 640 },
+	{ 0x00B27944, 57032, 12, 1, 997 },
+	{ 0x00B27948, 57053, 12, 1, 997 },
+	{ 0x00B2794C, 57073, 3, 1, 1009 },
+	{ 0x00B2797C, 57095, 7, 1, 668 },
+	{ 0x00B27984, 57113, 1, 1, 675 },
+	{ 0x00B27A00, 57134, 1, 1, 770 },
+	{ 0x00B27C00, 57155, 29, 1, 599 },
+	{ 0x00B27C20, 57175, 7, 1, 676 },
+	{ 0x00B27C24, 57190, 4, 1, 683 },
+	{ 0x00B27C40, 57208, 1, 1, 687 },
+	{ 0x00B27C80, 57230, 3, 1, 688 },
+	{ 0x00B27C84, 57249, 7, 1, 691 },
+	{ 0x00B27C88, 57268, 2, 1, 698 },
+	{ 0x00B27D00, 57287, 1, 1, 700 },
+	{ 0x00B27D04, 57309, 2, 1, 701 },
+	{ 0x00B27D08, 57331, 1, 1, 703 },
+	{ 0x00B27D0C, 57353, 1, 1, 704 },
+	{ 0x00B27D10, 57375, 1, 1, 705 },
+	{ 0x00B27D14, 57401, 1, 1, 706 },
+	{ 0x00B27D18, 57427, 1, 1, 707 },
+	{ 0x00B27D1C, 57450, 1, 1, 708 },
+	{ 0x00B27D20, 57473, 1, 1, 709 },
+	{ 0x00B27D24, 57494, 1, 1, 710 },
+	{ 0x00B27D28, 57513, 1, 1, 711 },
+	{ 0x00B27D30, 57538, 1, 1, 712 },
+	{ 0x00B27D34, 57563, 1, 1, 712 },
+	{ 0x00B27D38, 57588, 1, 1, 712 },
+	{ 0x00B27D3C, 57613, 1, 1, 712 },
+	{ 0x00B27E00, 57638, 23, 1, 1012 },
+	{ 0x00B27E04, 57661, 2, 1, 737 },
+	{ 0x00B27E08, 57684, 23, 1, 1012 },
+	{ 0x00B27E0C, 57707, 2, 1, 737 },
+	{ 0x00B27E10, 57730, 23, 1, 1012 },
+	{ 0x00B27E14, 57753, 2, 1, 737 },
+	{ 0x00B27E18, 57776, 23, 1, 1012 },
+	{ 0x00B27E1C, 57799, 2, 1, 737 },
+	{ 0x00B27E20, 57822, 23, 1, 1012 },
+	{ 0x00B27E24, 57845, 2, 1, 737 },
+	{ 0x00B27E28, 57868, 23, 1, 1012 },
+	{ 0x00B27E2C, 57891, 2, 1, 737 },
+	{ 0x00B27E30, 57914, 23, 1, 1012 },
+	{ 0x00B27E34, 57937, 2, 1, 737 },
+	{ 0x00B27E38, 57960, 23, 1, 1012 },
+	{ 0x00B27E3C, 57983, 2, 1, 737 },
+	{ 0x00B27E40, 58006, 23, 1, 1012 },
+	{ 0x00B27E44, 58029, 2, 1, 737 },
+	{ 0x00B27E48, 58052, 23, 1, 1012 },
+	{ 0x00B27E4C, 58075, 2, 1, 737 },
+	{ 0x00B27E50, 58098, 23, 1, 1012 },
+	{ 0x00B27E54, 58122, 2, 1, 737 },
+	{ 0x00B27E58, 58146, 23, 1, 1012 },
+	{ 0x00B27E5C, 58170, 2, 1, 737 },
+	{ 0x00B27E60, 58194, 23, 1, 1012 },
+	{ 0x00B27E64, 58218, 2, 1, 737 },
+	{ 0x00B27E68, 58242, 23, 1, 1012 },
+	{ 0x00B27E6C, 58266, 2, 1, 737 },
+	{ 0x00B27E70, 58290, 23, 1, 1012 },
+	{ 0x00B27E74, 58314, 2, 1, 737 },
+	{ 0x00B27E78, 58338, 23, 1, 1012 },
+	{ 0x00B27E7C, 58362, 2, 1, 737 },
+	{ 0x00B27FFC, 58386, 1, 1, 739 },
+	{ 0x00B28000, 58408, 1, 1, 740 },
+	{ 0x00B28004, 58449, 1, 1, 740 },
+	{ 0x00B28008, 58490, 1, 1, 740 },
+	{ 0x00B2800C, 58510, 1, 1, 740 },
+	{ 0x00B28010, 58530, 1, 1, 740 },
+	{ 0x00B28014, 58569, 1, 1, 740 },
+	{ 0x00B28018, 58608, 1, 1, 740 },
+	{ 0x00B2801C, 58636, 1, 1, 740 },
+	{ 0x00B28080, 58664, 1, 1, 740 },
+	{ 0x00B28084, 58705, 1, 1, 740 },
+	{ 0x00B28088, 58746, 1, 1, 740 },
+	{ 0x00B2808C, 58766, 1, 1, 740 },
+	{ 0x00B28090, 58786, 1, 1, 740 },
+	{ 0x00B28094, 58825, 1, 1, 740 },
+	{ 0x00B28098, 58864, 1, 1, 740 },
+	{ 0x00B2809C, 58892, 1, 1, 740 },
+	{ 0x00B28100, 58920, 1, 1, 740 },
+	{ 0x00B28104, 58961, 1, 1, 740 },
+	{ 0x00B28108, 59002, 1, 1, 740 },
+	{ 0x00B2810C, 59022, 1, 1, 740 },
+	{ 0x00B28110, 59042, 1, 1, 740 },
+	{ 0x00B28114, 59081, 1, 1, 740 },
+	{ 0x00B28118, 59120, 1, 1, 740 },
+	{ 0x00B2811C, 59148, 1, 1, 740 },
+	{ 0x00B28180, 59176, 1, 1, 740 },
+	{ 0x00B28184, 59217, 1, 1, 740 },
+	{ 0x00B28188, 59258, 1, 1, 740 },
+	{ 0x00B2818C, 59278, 1, 1, 740 },
+	{ 0x00B28190, 59298, 1, 1, 740 },
+	{ 0x00B28194, 59337, 1, 1, 740 },
+	{ 0x00B28198, 59376, 1, 1, 740 },
+	{ 0x00B2819C, 59404, 1, 1, 740 },
+	{ 0x00B28200, 59432, 1, 1, 740 },
+	{ 0x00B28204, 59473, 1, 1, 740 },
+	{ 0x00B28208, 59514, 1, 1, 740 },
+	{ 0x00B2820C, 59534, 1, 1, 740 },
+	{ 0x00B28210, 59554, 1, 1, 740 },
+	{ 0x00B28214, 59593, 1, 1, 740 },
+	{ 0x00B28218, 59632, 1, 1, 740 },
+	{ 0x00B2821C, 59660, 1, 1, 740 },
+	{ 0x00B28280, 59688, 1, 1, 740 },
+	{ 0x00B28284, 59729, 1, 1, 740 },
+	{ 0x00B28288, 59770, 1, 1, 740 },
+	{ 0x00B2828C, 59790, 1, 1, 740 },
+	{ 0x00B28290, 59810, 1, 1, 740 },
+	{ 0x00B28294, 59849, 1, 1, 740 },
+	{ 0x00B28298, 59888, 1, 1, 740 },
+	{ 0x00B2829C, 59916, 1, 1, 740 },
+	{ 0x00B28300, 59944, 1, 1, 740 },
+	{ 0x00B28304, 59985, 1, 1, 740 },
+	{ 0x00B28308, 60026, 1, 1, 740 },
+	{ 0x00B2830C, 60046, 1, 1, 740 },
+	{ 0x00B28310, 60066, 1, 1, 740 },
+	{ 0x00B28314, 60105, 1, 1, 740 },
+	{ 0x00B28318, 60144, 1, 1, 740 },
+	{ 0x00B2831C, 60172, 1, 1, 740 },
+	{ 0x00B28380, 60200, 1, 1, 740 },
+	{ 0x00B28384, 60241, 1, 1, 740 },
+	{ 0x00B28388, 60282, 1, 1, 740 },
+	{ 0x00B2838C, 60302, 1, 1, 740 },
+	{ 0x00B28390, 60322, 1, 1, 740 },
+	{ 0x00B28394, 60361, 1, 1, 740 },
+	{ 0x00B28398, 60400, 1, 1, 740 },
+	{ 0x00B2839C, 60428, 1, 1, 740 },
+	{ 0x00B28400, 60456, 1, 1, 740 },
+	{ 0x00B28404, 60497, 1, 1, 740 },
+	{ 0x00B28408, 60538, 1, 1, 740 },
+	{ 0x00B2840C, 60558, 1, 1, 740 },
+	{ 0x00B28410, 60578, 1, 1, 740 },
+	{ 0x00B28414, 60617, 1, 1, 740 },
+	{ 0x00B28418, 60656, 1, 1, 740 },
+	{ 0x00B2841C, 60684, 1, 1, 740 },
+	{ 0x00B28480, 60712, 1, 1, 740 },
+	{ 0x00B28484, 60753, 1, 1, 740 },
+	{ 0x00B28488, 60794, 1, 1, 740 },
+	{ 0x00B2848C, 60814, 1, 1, 740 },
+	{ 0x00B28490, 60834, 1, 1, 740 },
+	{ 0x00B28494, 60873, 1, 1, 740 },
+	{ 0x00B28498, 60912, 1, 1, 740 },
+	{ 0x00B2849C, 60940, 1, 1, 740 },
+	{ 0x00B28500, 60968, 1, 1, 740 },
+	{ 0x00B28504, 61010, 1, 1, 740 },
+	{ 0x00B28508, 61052, 1, 1, 740 },
+	{ 0x00B2850C, 61073, 1, 1, 740 },
+	{ 0x00B28510, 61094, 1, 1, 740 },
+	{ 0x00B28514, 61134, 1, 1, 740 },
+	{ 0x00B28518, 61174, 1, 1, 740 },
+	{ 0x00B2851C, 61203, 1, 1, 740 },
+	{ 0x00B28580, 61232, 1, 1, 740 },
+	{ 0x00B28584, 61274, 1, 1, 740 },
+	{ 0x00B28588, 61316, 1, 1, 740 },
+	{ 0x00B2858C, 61337, 1, 1, 740 },
+	{ 0x00B28590, 61358, 1, 1, 740 },
+	{ 0x00B28594, 61398, 1, 1, 740 },
+	{ 0x00B28598, 61438, 1, 1, 740 },
+	{ 0x00B2859C, 61467, 1, 1, 740 },
+	{ 0x00B28600, 61496, 1, 1, 740 },
+	{ 0x00B28604, 61538, 1, 1, 740 },
+	{ 0x00B28608, 61580, 1, 1, 740 },
+	{ 0x00B2860C, 61601, 1, 1, 740 },
+	{ 0x00B28610, 61622, 1, 1, 740 },
+	{ 0x00B28614, 61662, 1, 1, 740 },
+	{ 0x00B28618, 61702, 1, 1, 740 },
+	{ 0x00B2861C, 61731, 1, 1, 740 },
+	{ 0x00B28680, 61760, 1, 1, 740 },
+	{ 0x00B28684, 61802, 1, 1, 740 },
+	{ 0x00B28688, 61844, 1, 1, 740 },
+	{ 0x00B2868C, 61865, 1, 1, 740 },
+	{ 0x00B28690, 61886, 1, 1, 740 },
+	{ 0x00B28694, 61926, 1, 1, 740 },
+	{ 0x00B28698, 61966, 1, 1, 740 },
+	{ 0x00B2869C, 61995, 1, 1, 740 },
+	{ 0x00B28700, 62024, 1, 1, 740 },
+	{ 0x00B28704, 62066, 1, 1, 740 },
+	{ 0x00B28708, 62108, 1, 1, 740 },
+	{ 0x00B2870C, 62129, 1, 1, 740 },
+	{ 0x00B28710, 62150, 1, 1, 740 },
+	{ 0x00B28714, 62190, 1, 1, 740 },
+	{ 0x00B28718, 62230, 1, 1, 740 },
+	{ 0x00B2871C, 62259, 1, 1, 740 },
+	{ 0x00B28780, 62288, 1, 1, 740 },
+	{ 0x00B28784, 62330, 1, 1, 740 },
+	{ 0x00B28788, 62372, 1, 1, 740 },
+	{ 0x00B2878C, 62393, 1, 1, 740 },
+	{ 0x00B28790, 62414, 1, 1, 740 },
+	{ 0x00B28794, 62454, 1, 1, 740 },
+	{ 0x00B28798, 62494, 1, 1, 740 },
+	{ 0x00B2879C, 62523, 1, 1, 740 },
+	{ 0x00B28800, 62552, 1, 1, 740 },
+	{ 0x00B28804, 62594, 1, 1, 740 },
+	{ 0x00B28808, 62636, 1, 1, 740 },
+	{ 0x00B2880C, 62657, 1, 1, 740 },
+	{ 0x00B28810, 62678, 1, 1, 740 },
+	{ 0x00B28814, 62718, 1, 1, 740 },
+	{ 0x00B28818, 62758, 1, 1, 740 },
+	{ 0x00B2881C, 62787, 1, 1, 740 },
+	{ 0x00B28880, 62816, 1, 1, 740 },
+	{ 0x00B28884, 62858, 1, 1, 740 },
+	{ 0x00B28888, 62900, 1, 1, 740 },
+	{ 0x00B2888C, 62921, 1, 1, 740 },
+	{ 0x00B28890, 62942, 1, 1, 740 },
+	{ 0x00B28894, 62982, 1, 1, 740 },
+	{ 0x00B28898, 63022, 1, 1, 740 },
+	{ 0x00B2889C, 63051, 1, 1, 740 },
+	{ 0x00B28900, 63080, 1, 1, 740 },
+	{ 0x00B28904, 63122, 1, 1, 740 },
+	{ 0x00B28908, 63164, 1, 1, 740 },
+	{ 0x00B2890C, 63185, 1, 1, 740 },
+	{ 0x00B28910, 63206, 1, 1, 740 },
+	{ 0x00B28914, 63246, 1, 1, 740 },
+	{ 0x00B28918, 63286, 1, 1, 740 },
+	{ 0x00B2891C, 63315, 1, 1, 740 },
+	{ 0x00B28980, 63344, 1, 1, 740 },
+	{ 0x00B28984, 63386, 1, 1, 740 },
+	{ 0x00B28988, 63428, 1, 1, 740 },
+	{ 0x00B2898C, 63449, 1, 1, 740 },
+	{ 0x00B28990, 63470, 1, 1, 740 },
+	{ 0x00B28994, 63510, 1, 1, 740 },
+	{ 0x00B28998, 63550, 1, 1, 740 },
+	{ 0x00B2899C, 63579, 1, 1, 740 },
+	{ 0x00B28A00, 63608, 1, 1, 740 },
+	{ 0x00B28A04, 63650, 1, 1, 740 },
+	{ 0x00B28A08, 63692, 1, 1, 740 },
+	{ 0x00B28A0C, 63713, 1, 1, 740 },
+	{ 0x00B28A10, 63734, 1, 1, 740 },
+	{ 0x00B28A14, 63774, 1, 1, 740 },
+	{ 0x00B28A18, 63814, 1, 1, 740 },
+	{ 0x00B28A1C, 63843, 1, 1, 740 },
+	{ 0x00B28A80, 63872, 1, 1, 740 },
+	{ 0x00B28A84, 63914, 1, 1, 740 },
+	{ 0x00B28A88, 63956, 1, 1, 740 },
+	{ 0x00B28A8C, 63977, 1, 1, 740 },
+	{ 0x00B28A90, 63998, 1, 1, 740 },
+	{ 0x00B28A94, 64038, 1, 1, 740 },
+	{ 0x00B28A98, 64078, 1, 1, 740 },
+	{ 0x00B28A9C, 64107, 1, 1, 740 },
+	{ 0x00B28B00, 64136, 1, 1, 740 },
+	{ 0x00B28B04, 64178, 1, 1, 740 },
+	{ 0x00B28B08, 64220, 1, 1, 740 },
+	{ 0x00B28B0C, 64241, 1, 1, 740 },
+	{ 0x00B28B10, 64262, 1, 1, 740 },
+	{ 0x00B28B14, 64302, 1, 1, 740 },
+	{ 0x00B28B18, 64342, 1, 1, 740 },
+	{ 0x00B28B1C, 64371, 1, 1, 740 },
+	{ 0x00B28B80, 64400, 1, 1, 740 },
+	{ 0x00B28B84, 64442, 1, 1, 740 },
+	{ 0x00B28B88, 64484, 1, 1, 740 },
+	{ 0x00B28B8C, 64505, 1, 1, 740 },
+	{ 0x00B28B90, 64526, 1, 1, 740 },
+	{ 0x00B28B94, 64566, 1, 1, 740 },
+	{ 0x00B28B98, 64606, 1, 1, 740 },
+	{ 0x00B28B9C, 64635, 1, 1, 740 },
+	{ 0x00B28C00, 64664, 1, 1, 740 },
+	{ 0x00B28C04, 64706, 1, 1, 740 },
+	{ 0x00B28C08, 64748, 1, 1, 740 },
+	{ 0x00B28C0C, 64769, 1, 1, 740 },
+	{ 0x00B28C10, 64790, 1, 1, 740 },
+	{ 0x00B28C14, 64830, 1, 1, 740 },
+	{ 0x00B28C18, 64870, 1, 1, 740 },
+	{ 0x00B28C1C, 64899, 1, 1, 740 },
+	{ 0x00B28C80, 64928, 1, 1, 740 },
+	{ 0x00B28C84, 64970, 1, 1, 740 },
+	{ 0x00B28C88, 65012, 1, 1, 740 },
+	{ 0x00B28C8C, 65033, 1, 1, 740 },
+	{ 0x00B28C90, 65054, 1, 1, 740 },
+	{ 0x00B28C94, 65094, 1, 1, 740 },
+	{ 0x00B28C98, 65134, 1, 1, 740 },
+	{ 0x00B28C9C, 65163, 1, 1, 740 },
+	{ 0x00B28D00, 65192, 1, 1, 740 },
+	{ 0x00B28D04, 65234, 1, 1, 740 },
+	{ 0x00B28D08, 65276, 1, 1, 740 },
+	{ 0x00B28D0C, 65297, 1, 1, 740 },
+	{ 0x00B28D10, 65318, 1, 1, 740 },
+	{ 0x00B28D14, 65358, 1, 1, 740 },
+	{ 0x00B28D18, 65398, 1, 1, 740 },
+	{ 0x00B28D1C, 65427, 1, 1, 740 },
+	{ 0x00B28D80, 65456, 1, 1, 740 },
+	{ 0x00B28D84, 65498, 1, 1, 740 },
+	{ 0x00B28D88, 65540, 1, 1, 740 },
+	{ 0x00B28D8C, 65561, 1, 1, 740 },
+	{ 0x00B28D90, 65582, 1, 1, 740 },
+	{ 0x00B28D94, 65622, 1, 1, 740 },
+	{ 0x00B28D98, 65662, 1, 1, 740 },
+	{ 0x00B28D9C, 65691, 1, 1, 740 },
+	{ 0x00B28E00, 65720, 1, 1, 740 },
+	{ 0x00B28E04, 65762, 1, 1, 740 },
+	{ 0x00B28E08, 65804, 1, 1, 740 },
+	{ 0x00B28E0C, 65825, 1, 1, 740 },
+	{ 0x00B28E10, 65846, 1, 1, 740 },
+	{ 0x00B28E14, 65886, 1, 1, 740 },
+	{ 0x00B28E18, 65926, 1, 1, 740 },
+	{ 0x00B28E1C, 65955, 1, 1, 740 },
+	{ 0x00B28E80, 65984, 1, 1, 740 },
+	{ 0x00B28E84, 66026, 1, 1, 740 },
+	{ 0x00B28E88, 66068, 1, 1, 740 },
+	{ 0x00B28E8C, 66089, 1, 1, 740 },
+	{ 0x00B28E90, 66110, 1, 1, 740 },
+	{ 0x00B28E94, 66150, 1, 1, 740 },
+	{ 0x00B28E98, 66190, 1, 1, 740 },
+	{ 0x00B28E9C, 66219, 1, 1, 740 },
+	{ 0x00B28F00, 66248, 1, 1, 740 },
+	{ 0x00B28F04, 66290, 1, 1, 740 },
+	{ 0x00B28F08, 66332, 1, 1, 740 },
+	{ 0x00B28F0C, 66353, 1, 1, 740 },
+	{ 0x00B28F10, 66374, 1, 1, 740 },
+	{ 0x00B28F14, 66414, 1, 1, 740 },
+	{ 0x00B28F18, 66454, 1, 1, 740 },
+	{ 0x00B28F1C, 66483, 1, 1, 740 },
+	{ 0x00B28F80, 66512, 1, 1, 740 },
+	{ 0x00B28F84, 66554, 1, 1, 740 },
+	{ 0x00B28F88, 66596, 1, 1, 740 },
+	{ 0x00B28F8C, 66617, 1, 1, 740 },
+	{ 0x00B28F90, 66638, 1, 1, 740 },
+	{ 0x00B28F94, 66678, 1, 1, 740 },
+	{ 0x00B28F98, 66718, 1, 1, 740 },
+	{ 0x00B28F9C, 66747, 1, 1, 740 },
+	{ 0x00B2C000, 66776, 1, 1, 740 },
+	{ 0x00B2C004, 66806, 1, 1, 740 },
+	{ 0x00B2C008, 66836, 1, 1, 740 },
+	{ 0x00B2C00C, 66861, 1, 1, 740 },
+	{ 0x00B2C010, 66886, 1, 1, 740 },
+	{ 0x00B2C014, 66914, 1, 1, 740 },
+	{ 0x00B2C018, 66942, 1, 1, 740 },
+	{ 0x00B2C01C, 66977, 1, 1, 740 },
+	{ 0x00B2C020, 67012, 1, 1, 740 },
+	{ 0x00B2C024, 67048, 1, 1, 740 },
+	{ 0x00B2C080, 67084, 1, 1, 740 },
+	{ 0x00B2C084, 67114, 1, 1, 740 },
+	{ 0x00B2C088, 67144, 1, 1, 740 },
+	{ 0x00B2C08C, 67169, 1, 1, 740 },
+	{ 0x00B2C090, 67194, 1, 1, 740 },
+	{ 0x00B2C094, 67222, 1, 1, 740 },
+	{ 0x00B2C098, 67250, 1, 1, 740 },
+	{ 0x00B2C09C, 67285, 1, 1, 740 },
+	{ 0x00B2C0A0, 67320, 1, 1, 740 },
+	{ 0x00B2C0A4, 67356, 1, 1, 740 },
+	{ 0x00B2C100, 67392, 1, 1, 740 },
+	{ 0x00B2C104, 67422, 1, 1, 740 },
+	{ 0x00B2C108, 67452, 1, 1, 740 },
+	{ 0x00B2C10C, 67477, 1, 1, 740 },
+	{ 0x00B2C110, 67502, 1, 1, 740 },
+	{ 0x00B2C114, 67530, 1, 1, 740 },
+	{ 0x00B2C118, 67558, 1, 1, 740 },
+	{ 0x00B2C11C, 67593, 1, 1, 740 },
+	{ 0x00B2C120, 67628, 1, 1, 740 },
+	{ 0x00B2C124, 67664, 1, 1, 740 },
+	{ 0x00B2C180, 67700, 1, 1, 740 },
+	{ 0x00B2C184, 67730, 1, 1, 740 },
+	{ 0x00B2C188, 67760, 1, 1, 740 },
+	{ 0x00B2C18C, 67785, 1, 1, 740 },
+	{ 0x00B2C190, 67810, 1, 1, 740 },
+	{ 0x00B2C194, 67838, 1, 1, 740 },
+	{ 0x00B2C198, 67866, 1, 1, 740 },
+	{ 0x00B2C19C, 67901, 1, 1, 740 },
+	{ 0x00B2C1A0, 67936, 1, 1, 740 },
+	{ 0x00B2C1A4, 67972, 1, 1, 740 },
+	{ 0x00B2C200, 68008, 1, 1, 740 },
+	{ 0x00B2C204, 68038, 1, 1, 740 },
+	{ 0x00B2C208, 68068, 1, 1, 740 },
+	{ 0x00B2C20C, 68093, 1, 1, 740 },
+	{ 0x00B2C210, 68118, 1, 1, 740 },
+	{ 0x00B2C214, 68146, 1, 1, 740 },
+	{ 0x00B2C218, 68174, 1, 1, 740 },
+	{ 0x00B2C21C, 68209, 1, 1, 740 },
+	{ 0x00B2C220, 68244, 1, 1, 740 },
+	{ 0x00B2C224, 68280, 1, 1, 740 },
+	{ 0x00B2C280, 68316, 1, 1, 740 },
+	{ 0x00B2C284, 68346, 1, 1, 740 },
+	{ 0x00B2C288, 68376, 1, 1, 740 },
+	{ 0x00B2C28C, 68401, 1, 1, 740 },
+	{ 0x00B2C290, 68426, 1, 1, 740 },
+	{ 0x00B2C294, 68454, 1, 1, 740 },
+	{ 0x00B2C298, 68482, 1, 1, 740 },
+	{ 0x00B2C29C, 68517, 1, 1, 740 },
+	{ 0x00B2C2A0, 68552, 1, 1, 740 },
+	{ 0x00B2C2A4, 68588, 1, 1, 740 },
+	{ 0x00B2C300, 68624, 1, 1, 740 },
+	{ 0x00B2C304, 68654, 1, 1, 740 },
+	{ 0x00B2C308, 68684, 1, 1, 740 },
+	{ 0x00B2C30C, 68709, 1, 1, 740 },
+	{ 0x00B2C310, 68734, 1, 1, 740 },
+	{ 0x00B2C314, 68762, 1, 1, 740 },
+	{ 0x00B2C318, 68790, 1, 1, 740 },
+	{ 0x00B2C31C, 68825, 1, 1, 740 },
+	{ 0x00B2C320, 68860, 1, 1, 740 },
+	{ 0x00B2C324, 68896, 1, 1, 740 },
+	{ 0x00B2C380, 68932, 1, 1, 740 },
+	{ 0x00B2C384, 68962, 1, 1, 740 },
+	{ 0x00B2C388, 68992, 1, 1, 740 },
+	{ 0x00B2C38C, 69017, 1, 1, 740 },
+	{ 0x00B2C390, 69042, 1, 1, 740 },
+	{ 0x00B2C394, 69070, 1, 1, 740 },
+	{ 0x00B2C398, 69098, 1, 1, 740 },
+	{ 0x00B2C39C, 69133, 1, 1, 740 },
+	{ 0x00B2C3A0, 69168, 1, 1, 740 },
+	{ 0x00B2C3A4, 69204, 1, 1, 740 },
+	{ 0x00B2C400, 69240, 1, 1, 740 },
+	{ 0x00B2C404, 69267, 1, 1, 740 },
+	{ 0x00B2C408, 69294, 1, 1, 740 },
+	{ 0x00B2C40C, 69314, 1, 1, 740 },
+	{ 0x00B2C410, 69334, 1, 1, 740 },
+	{ 0x00B2C414, 69359, 1, 1, 740 },
+	{ 0x00B2C418, 69384, 1, 1, 740 },
+	{ 0x00B2C41C, 69408, 1, 1, 740 },
+	{ 0x00B2C420, 69432, 1, 1, 740 },
+	{ 0x00B2C424, 69456, 1, 1, 740 },
+	{ 0x00B2C800, 69480, 2, 1, 1035 },
+	{ 0x00B2C804, 69498, 2, 1, 743 },
+	{ 0x00B2C808, 69516, 1, 1, 1037 },
+	{ 0x00B2C80C, 69534, 6, 1, 746 },
+	{ 0x00B2C810, 69552, 5, 1, 752 },
+	{ 0x00B2C814, 69571, 2, 1, 1038 },
+	{ 0x00B2C818, 69589, 1, 1, 1040 },
+	{ 0x00B2C820, 69607, 1, 1, 760 },
+	{ 0x00B2C824, 69629, 1, 1, 761 },
+	{ 0x00B2C830, 69651, 1, 1, 762 },
+	{ 0x00B2C834, 69673, 1, 1, 763 },
+	{ 0x00B2C840, 69695, 1, 1, 1041 },
+	{ 0x00B2C844, 69717, 3, 1, 1042 },
+	{ 0x00B2C848, 69740, 1, 1, 769 },
+	{ 0x00B2C850, 69763, 1, 1, 770 },
+	{ 0x00B2C900, 69787, 1, 1, 1045 },
+	{ 0x00B2C904, 69810, 1, 1, 1045 },
+	{ 0x00B2C908, 69833, 1, 1, 1045 },
+	{ 0x00B2C90C, 69856, 1, 1, 1045 },
+	{ 0x00B2C910, 69879, 1, 1, 1045 },
+	{ 0x00B2C914, 69902, 1, 1, 1045 },
+	{ 0x00B2C918, 69925, 1, 1, 1045 },
+	{ 0x00B2C91C, 69948, 1, 1, 1045 },
+	{ 0x00B2C920, 69971, 1, 1, 1045 },
+	{ 0x00B2C924, 69994, 1, 1, 1045 },
+	{ 0x00B2C928, 70017, 1, 1, 1045 },
+	{ 0x00B2C92C, 70041, 1, 1, 1045 },
+	{ 0x00B2C930, 70065, 1, 1, 1045 },
+	{ 0x00B2C934, 70089, 1, 1, 1045 },
+	{ 0x00B2C938, 70113, 1, 1, 1045 },
+	{ 0x00B2C93C, 70137, 1, 1, 1045 },
+	{ 0x00B2C940, 70161, 1, 1, 1045 },
+	{ 0x00B2C944, 70185, 1, 1, 1045 },
+	{ 0x00B2C948, 70209, 1, 1, 1045 },
+	{ 0x00B2C94C, 70233, 1, 1, 1045 },
+	{ 0x00B2C950, 70257, 1, 1, 1045 },
+	{ 0x00B2C954, 70281, 1, 1, 1045 },
+	{ 0x00B2C958, 70305, 1, 1, 1045 },
+	{ 0x00B2C95C, 70329, 1, 1, 1045 },
+	{ 0x00B2C960, 70353, 1, 1, 1045 },
+	{ 0x00B2C964, 70377, 1, 1, 1045 },
+	{ 0x00B2C968, 70401, 1, 1, 1045 },
+	{ 0x00B2C96C, 70425, 1, 1, 1045 },
+	{ 0x00B2C970, 70449, 1, 1, 1045 },
+	{ 0x00B2C974, 70473, 1, 1, 1045 },
+	{ 0x00B2C978, 70497, 1, 1, 1045 },
+	{ 0x00B2C97C, 70521, 1, 1, 1045 },
+	{ 0x00B2F000, 70545, 1, 1, 770 },
+	{ 0x00B2F100, 70569, 2, 1, 830 },
+	{ 0x00B2F104, 70591, 2, 1, 830 },
+	{ 0x00B2F108, 70613, 2, 1, 830 },
+	{ 0x00B2F10C, 70635, 2, 1, 830 },
+	{ 0x00B2F110, 70657, 2, 1, 830 },
+	{ 0x00B2F114, 70679, 2, 1, 830 },
+	{ 0x00B2F118, 70701, 2, 1, 830 },
+	{ 0x00B2F11C, 70723, 2, 1, 830 },
+	{ 0x00B2F120, 70745, 2, 1, 830 },
+	{ 0x00B2F124, 70769, 3, 1, 1046 },
+	{ 0x00B2F128, 70789, 1, 1, 1049 },
+	{ 0x00B2F130, 70809, 1, 1, 837 },
+	{ 0x00B2F134, 70834, 1, 1, 837 },
+	{ 0x00B2F138, 70859, 1, 1, 837 },
+	{ 0x00B2F13C, 70884, 2, 1, 838 },
+	{ 0x00B2F140, 70907, 3, 1, 840 },
+	{ 0x00B2F144, 70931, 5, 1, 843 },
+	{ 0x00B2F400, 70955, 1, 1, 848 },
+	{ 0x00B2F404, 70982, 15, 1, 849 },
+	{ 0x00B2F408, 71005, 4, 1, 864 },
+	{ 0x00B2F40C, 71029, 7, 1, 868 },
+	{ 0x00B2F410, 71053, 16, 1, 875 },
+	{ 0x00B2F414, 71078, 1, 1, 891 },
+	{ 0x00B2F420, 71102, 0, 1, 71 },
+	{ 0x00B2F424, 71131, 0, 1, 71 },
+	{ 0x00B2F428, 71165, 0, 1, 71 },
+	{ 0x00B2F430, 71199, 1, 1, 892 },
+	{ 0x00B2F480, 71227, 0, 1, 71 },
+	{ 0x00B2F484, 71248, 0, 1, 71 },
+	{ 0x00B2F488, 71269, 0, 1, 71 },
+	{ 0x00B2F48C, 71294, 4, 1, 893 },
+	{ 0x00B2F4C0, 71317, 2, 1, 897 },
+	{ 0x00B2F7F8, 71340, 16, 1, 899 },
+	{ 0x00B2F7FC, 71360, 5, 1, 915 },
+	{ 0x00B2F800, 71379, 10, 1, 920 },
+	{ 0x00B2F804, 71397, 10, 1, 930 },
+	{ 0x00B2F808, 71416, 1, 1, 940 },
+	{ 0x00B2F80C, 71437, 1, 1, 941 },
+	{ 0x00B2F810, 71466, 1, 1, 942 },
+	{ 0x00B2F814, 71492, 1, 1, 943 },
+	{ 0x00B2F818, 71512, 1, 1, 944 },
+	{ 0x00B2F81C, 71529, 5, 1, 915 },
+	{ 0x00B2FFF4, 71546, 11, 1, 945 },
+	{ 0x00B2FFF8, 71566, 3, 1, 956 },
+	{ 0x00B2FFFC, 71585, 5, 1, 915 },
+	{ 0x00D28800, 111663, 2, 1, 3046 },
+	{ 0x00D28804, 111768, 8, 1, 3048 },
+	{ 0x00D28808, 111824, 5, 1, 3056 },
+	{ 0x00D2880C, 111849, 2, 1, 3061 },
+	{ 0x00D28810, 111864, 1, 1, 3063 },
+	{ 0x00D28814, 111872, 3, 1, 3064 },
+	{ 0x00D28818, 111899, 1, 1, 3067 },
+	{ 0x00D28880, 71611, 1, 1, 1050 },
+	{ 0x00D28884, 71643, 3, 1, 1051 },
+	{ 0x00D28888, 71680, 3, 1, 1054 },
+	{ 0x00D2888C, 71712, 3, 1, 1057 },
+	{ 0x00D28890, 71747, 2, 1, 1060 },
+	{ 0x00D28894, 71797, 3, 1, 1062 },
+	{ 0x00D28898, 71825, 1, 1, 1065 },
+	{ 0x00D2889C, 71851, 1, 1, 1066 },
+	{ 0x00D288A0, 71877, 1, 1, 1067 },
+	{ 0x00D288A4, 71910, 2, 1, 1068 },
+	{ 0x00D288A8, 71938, 1, 1, 1070 },
+	{ 0x00D288AC, 71968, 1, 1, 1071 },
+	{ 0x00D288B0, 71998, 1, 1, 1072 },
+	{ 0x00D288B4, 72023, 1, 1, 1073 },
+	{ 0x00D288B8, 72046, 1, 1, 1074 },
+	{ 0x00D288BC, 72073, 1, 1, 1075 },
+	{ 0x00D288C0, 72245, 15, 1, 1076 },
+	{ 0x00D288C8, 72277, 4, 1, 1091 },
+	{ 0x00D288CC, 72301, 1, 1, 1095 },
+	{ 0x00D288D0, 72319, 1, 1, 1095 },
+	{ 0x00D288D4, 72337, 1, 1, 1095 },
+	{ 0x00D288D8, 72355, 1, 1, 1095 },
+	{ 0x00D288DC, 72373, 1, 1, 1095 },
+	{ 0x00D288E0, 72391, 1, 1, 1095 },
+	{ 0x00D288E4, 72409, 1, 1, 1095 },
+	{ 0x00D288E8, 72427, 1, 1, 1095 },
+	{ 0x00D288EC, 72445, 1, 1, 1095 },
+	{ 0x00D288F0, 72485, 2, 1, 1096 },
+	{ 0x00D288F4, 72533, 3, 1, 1098 },
+	{ 0x00D28C00, 72671, 16, 1, 1101 },
+	{ 0x00D28C04, 72805, 15, 1, 1117 },
+	{ 0x00D28C08, 72866, 5, 1, 1132 },
+	{ 0x00D28C0C, 72906, 2, 1, 1137 },
+	{ 0x00D28C10, 72945, 2, 1, 1139 },
+	{ 0x00D28C14, 72989, 2, 1, 1141 },
+	{ 0x00D28C18, 73025, 2, 1, 1143 },
+	{ 0x00D28C1C, 73052, 1, 1, 1145 },
+	{ 0x00D28C20, 73073, 1, 1, 1146 },
+	{ 0x00D28C24, 73103, 1, 1, 1147 },
+	{ 0x00D28C28, 73133, 2, 1, 1148 },
+	{ 0x00D28C2C, 73170, 1, 1, 1150 },
+	{ 0x00D28C30, 73202, 1, 1, 1150 },
+	{ 0x00D28C34, 73239, 1, 1, 1151 },
+	{ 0x00D28C38, 73272, 1, 1, 1152 },
+	{ 0x00D28C3C, 73311, 1, 1, 1153 },
+	{ 0x00D28C40, 73390, 6, 1, 1154 },
+	{ 0x00D28C44, 73450, 4, 1, 1160 },
+	{ 0x00D28C48, 73484, 1, 1, 1164 },
+	{ 0x00D28C4C, 73512, 1, 1, 1164 },
+	{ 0x00D28C50, 73540, 1, 1, 1164 },
+	{ 0x00D28C54, 73568, 1, 1, 1164 },
+	{ 0x00D28C58, 73596, 1, 1, 1164 },
+	{ 0x00D28C5C, 73624, 1, 1, 1164 },
+	{ 0x00D28C60, 73652, 1, 1, 1164 },
+	{ 0x00D28C64, 73680, 1, 1, 1164 },
+	{ 0x00D28C68, 73708, 1, 1, 1164 },
+	{ 0x00D28C6C, 73736, 1, 1, 1164 },
+	{ 0x00D28C70, 73764, 1, 1, 1164 },
+	{ 0x00D28C74, 73831, 3, 1, 1165 },
+	{ 0x00D28C78, 73874, 2, 1, 1168 },
+	{ 0x00D28C7C, 74066, 13, 1, 1170 },
+	{ 0x00D29000, 111916, 1, 1, 3068 },
+	{ 0x00D29004, 111938, 1, 1, 3068 },
+	{ 0x00D29008, 111960, 1, 1, 3068 },
+	{ 0x00D2900C, 111999, 3, 1, 3069 },
+	{ 0x00D29010, 112044, 4, 1, 3072 },
+	{ 0x00D29014, 112111, 5, 1, 3076 },
+	{ 0x00D29018, 112202, 8, 1, 3081 },
+	{ 0x00D2901C, 112220, 1, 1, 3089 },
+	{ 0x00D29020, 112281, 6, 1, 3090 },
+	{ 0x00D29024, 112312, 2, 1, 3096 },
+	{ 0x00D29028, 112381, 5, 1, 3098 },
+	{ 0x00D2902C, 112431, 6, 1, 3103 },
+	{ 0x00D29030, 112484, 3, 1, 3109 },
+	{ 0x00D29034, 112500, 1, 1, 3068 },
+	{ 0x00D29038, 112539, 1, 1, 3112 },
+	{ 0x00D30000, 74609, 13, 1, 1203 },
+	{ 0x00D30004, 74701, 12, 1, 1216 },
+	{ 0x00D30008, 74747, 2, 1, 1228 },
+	{ 0x00D3000C, 74847, 8, 1, 1230 },
+	{ 0x00D30010, 74956, 11, 1, 1238 },
+	{ 0x00D30014, 75048, 6, 1, 1249 },
+	{ 0x00D30018, 75109, 4, 1, 1255 },
+	{ 0x00D3001C, 75138, 1, 1, 1259 },
+	{ 0x00D300A0, 75170, 1, 1, 1260 },
+	{ 0x00D300A4, 75272, 12, 1, 1261 },
+	{ 0x00D300E0, 75341, 6, 1, 1273 },
+	{ 0x00D300E4, 75369, 1, 1, 1279 },
+	{ 0x00D30120, 75431, 5, 1, 1280 },
+	{ 0x00D30124, 75456, 1, 1, 1259 },
+	{ 0x00D30160, 75653, 15, 1, 1285 },
+	{ 0x00D30164, 75758, 5, 1, 1300 },
+	{ 0x00D30168, 75904, 10, 1, 1305 },
+	{ 0x00D3016C, 75979, 3, 1, 1315 },
+	{ 0x00D30170, 76090, 9, 1, 1318 },
+	{ 0x00D30174, 76115, 1, 1, 1259 },
+	{ 0x00D301A0, 76197, 8, 1, 1327 },
+	{ 0x00D301A4, 76290, 7, 1, 1335 },
+	{ 0x00D301A8, 76325, 1, 1, 1342 },
+	{ 0x00D301AC, 76375, 2, 1, 1343 },
+	{ 0x00D301B0, 76425, 2, 1, 1345 },
+	{ 0x00D301B4, 76468, 2, 1, 1347 },
+	{ 0x00D301B8, 76524, 2, 1, 1349 },
+	{ 0x00D301BC, 76552, 1, 1, 1351 },
+	{ 0x00D30220, 76596, 2, 1, 1352 },
+	{ 0x00D30224, 76631, 1, 1, 1354 },
+	{ 0x00D30228, 76681, 3, 1, 1355 },
+	{ 0x00D3022C, 76713, 3, 1, 1358 },
+	{ 0x00D30238, 76841, 14, 1, 1361 },
+	{ 0x00D3023C, 76940, 7, 1, 1375 },
+	{ 0x00D30240, 77021, 7, 1, 1382 },
+	{ 0x00D30244, 77110, 9, 1, 1389 },
+	{ 0x00D30248, 77169, 5, 1, 1398 },
+	{ 0x00D3024C, 77252, 5, 1, 1403 },
+	{ 0x00D30250, 77311, 7, 1, 1408 },
+	{ 0x00D30254, 77393, 7, 1, 1415 },
+	{ 0x00D30460, 77449, 4, 1, 1422 },
+	{ 0x00D30464, 77473, 1, 1, 1259 },
+	{ 0x00D30600, 77497, 1, 1, 1426 },
+	{ 0x00D30604, 77553, 3, 1, 1427 },
+	{ 0x00D30608, 77579, 1, 1, 396 },
+	{ 0x00D3060C, 77604, 1, 1, 396 },
+	{ 0x00D30E00, 77688, 9, 1, 1430 },
+	{ 0x00D30E04, 77708, 1, 1, 1259 },
+	{ 0x00D30E08, 78036, 16, 1, 1439 },
+	{ 0x00D30E0C, 78287, 13, 1, 1455 },
+	{ 0x00D30E10, 78645, 16, 1, 1468 },
+	{ 0x00D30E14, 78869, 13, 1, 1484 },
+	{ 0x00D30E18, 79202, 16, 1, 1497 },
+	{ 0x00D30E1C, 79458, 13, 1, 1513 },
+	{ 0x00D30E20, 79821, 16, 1, 1526 },
+	{ 0x00D30E24, 80050, 13, 1, 1542 },
+	{ 0x00D30E30, 80088, 1, 1, 1555 },
+	{ 0x00D30E34, 80121, 1, 1, 1555 },
+	{ 0x00D30E90, 80164, 1, 1, 1556 },
+	{ 0x00D30E94, 80199, 1, 1, 1556 },
+	{ 0x00D30ED0, 80241, 1, 1, 1557 },
+	{ 0x00D30ED4, 80270, 1, 1, 1557 },
+	{ 0x00D30EF0, 80307, 1, 1, 1558 },
+	{ 0x00D30EF4, 80337, 1, 1, 1558 },
+	{ 0x00D30F00, 80375, 1, 1, 1559 },
+	{ 0x00D30F04, 80409, 1, 1, 1559 },
+	{ 0x00D30F28, 80452, 1, 1, 1560 },
+	{ 0x00D30F2C, 80481, 1, 1, 1560 },
+	{ 0x00D30F48, 80521, 1, 1, 1561 },
+	{ 0x00D30F4C, 80555, 1, 1, 1561 },
+	{ 0x00D30F50, 80599, 1, 1, 1562 },
+	{ 0x00D30F54, 80632, 1, 1, 1562 },
+	{ 0x00D30FD8, 80674, 1, 1, 1563 },
+	{ 0x00D30FDC, 80699, 1, 1, 1563 },
+	{ 0x00D30FE0, 80733, 1, 1, 1564 },
+	{ 0x00D30FE4, 80758, 1, 1, 1564 },
+	{ 0x00D30FE8, 80792, 1, 1, 1565 },
+	{ 0x00D30FEC, 80817, 1, 1, 1565 },
+	{ 0x00D30FF0, 80851, 1, 1, 1566 },
+	{ 0x00D30FF4, 80876, 1, 1, 1566 },
+	{ 0x00D31600, 81031, 15, 1, 1567 },
+	{ 0x00D31604, 81168, 9, 1, 1582 },
+	{ 0x00D31608, 81218, 2, 1, 1591 },
+	{ 0x00D3160C, 81272, 2, 1, 1593 },
+	{ 0x00D31610, 81309, 1, 1, 1595 },
+	{ 0x00D31614, 81341, 1, 1, 1595 },
+	{ 0x00D31618, 81378, 1, 1, 1596 },
+	{ 0x00D3161C, 81414, 1, 1, 1597 },
+	{ 0x00D31620, 81450, 1, 1, 1595 },
+	{ 0x00D31624, 81489, 1, 1, 1595 },
+	{ 0x00D31628, 81528, 1, 1, 1596 },
+	{ 0x00D3162C, 81578, 2, 1, 1598 },
+	{ 0x00D31630, 81626, 1, 1, 1600 },
+	{ 0x00D31634, 81655, 1, 1, 1600 },
+	{ 0x00D31638, 81690, 1, 1, 1601 },
+	{ 0x00D3163C, 81734, 1, 1, 1354 },
+	{ 0x00D31640, 81898, 12, 1, 1602 },
+	{ 0x00D31644, 81962, 5, 1, 1614 },
+	{ 0x00D31660, 81999, 1, 1, 1619 },
+	{ 0x00D31664, 82052, 2, 1, 1620 },
+	{ 0x00D31668, 82104, 1, 1, 1622 },
+	{ 0x00D3166C, 82144, 1, 1, 1622 },
+	{ 0x00D31680, 82245, 7, 1, 1623 },
+	{ 0x00D31684, 82275, 1, 1, 1630 },
+	{ 0x00D31690, 82313, 1, 1, 1631 },
+	{ 0x00D31694, 82357, 1, 1, 1632 },
+	{ 0x00D31698, 82409, 1, 1, 1633 },
+	{ 0x00D3169C, 82449, 1, 1, 1633 },
+	{ 0x00D316A0, 82496, 1, 1, 1634 },
+	{ 0x00D316A4, 82536, 1, 1, 1634 },
+	{ 0x00D316A8, 82583, 1, 1, 1635 },
+	{ 0x00D316AC, 82622, 1, 1, 1635 },
+	{ 0x00D316B0, 82666, 1, 1, 1636 },
+	{ 0x00D316B4, 82712, 1, 1, 1636 },
+	{ 0x00D316B8, 82763, 1, 1, 1637 },
+	{ 0x00D316BC, 82808, 1, 1, 1637 },
+	{ 0x00D316C0, 82861, 2, 1, 1638 },
+	{ 0x00D316C4, 82907, 1, 1, 1354 },
+	{ 0x00D316C8, 82961, 2, 1, 1640 },
+	{ 0x00D316CC, 83006, 1, 1, 1354 },
+	{ 0x00D316E0, 83138, 6, 1, 1642 },
+	{ 0x00D316E4, 83268, 6, 1, 1648 },
+	{ 0x00D31700, 83299, 1, 1, 1654 },
+	{ 0x00D31704, 83336, 1, 1, 1654 },
+	{ 0x00D31708, 83379, 1, 1, 1655 },
+	{ 0x00D3170C, 83430, 2, 1, 1656 },
+	{ 0x00D31710, 83479, 1, 1, 1658 },
+	{ 0x00D31714, 83505, 1, 1, 1658 },
+	{ 0x00D31718, 83541, 1, 1, 1659 },
+	{ 0x00D3171C, 83564, 1, 1, 1659 },
+	{ 0x00D31780, 83642, 8, 1, 1660 },
+	{ 0x00D31784, 83666, 1, 1, 1354 },
+	{ 0x00D31788, 83695, 1, 1, 1668 },
+	{ 0x00D3178C, 83729, 1, 1, 1668 },
+	{ 0x00D31790, 83768, 1, 1, 1669 },
+	{ 0x00D31794, 83802, 1, 1, 1669 },
+	{ 0x00D31798, 83841, 1, 1, 1670 },
+	{ 0x00D3179C, 83875, 1, 1, 1354 },
+	{ 0x00D317A0, 83936, 3, 1, 1671 },
+	{ 0x00D317A4, 83976, 2, 1, 1674 },
+	{ 0x00D32000, 84009, 13, 1, 1203 },
+	{ 0x00D32004, 84035, 12, 1, 1216 },
+	{ 0x00D32008, 84061, 2, 1, 1228 },
+	{ 0x00D3200C, 84091, 8, 1, 1230 },
+	{ 0x00D32010, 84121, 11, 1, 1238 },
+	{ 0x00D32014, 84147, 6, 1, 1249 },
+	{ 0x00D32018, 84173, 4, 1, 1255 },
+	{ 0x00D3201C, 84202, 1, 1, 1259 },
+	{ 0x00D320A0, 84231, 1, 1, 1260 },
+	{ 0x00D320A4, 84252, 12, 1, 1261 },
+	{ 0x00D320E0, 84273, 6, 1, 1273 },
+	{ 0x00D320E4, 84301, 1, 1, 1279 },
+	{ 0x00D32120, 84329, 5, 1, 1280 },
+	{ 0x00D32124, 84354, 1, 1, 1259 },
+	{ 0x00D32160, 84428, 15, 1, 1676 },
+	{ 0x00D32164, 84457, 5, 1, 1300 },
+	{ 0x00D32168, 84486, 10, 1, 1305 },
+	{ 0x00D3216C, 84515, 3, 1, 1315 },
+	{ 0x00D32170, 84544, 9, 1, 1318 },
+	{ 0x00D32174, 84569, 1, 1, 1259 },
+	{ 0x00D321A0, 84594, 8, 1, 1327 },
+	{ 0x00D321A4, 84625, 7, 1, 1335 },
+	{ 0x00D321A8, 84656, 1, 1, 1342 },
+	{ 0x00D321AC, 84687, 2, 1, 1343 },
+	{ 0x00D321B0, 84718, 2, 1, 1345 },
+	{ 0x00D321B4, 84746, 2, 1, 1347 },
+	{ 0x00D321B8, 84774, 2, 1, 1349 },
+	{ 0x00D321BC, 84802, 1, 1, 1351 },
+	{ 0x00D32220, 84830, 2, 1, 1352 },
+	{ 0x00D32224, 84850, 1, 1, 1354 },
+	{ 0x00D32228, 84870, 3, 1, 1355 },
+	{ 0x00D3222C, 84888, 3, 1, 1358 },
+	{ 0x00D32238, 84906, 14, 1, 1361 },
+	{ 0x00D3223C, 84930, 7, 1, 1375 },
+	{ 0x00D32240, 84954, 7, 1, 1382 },
+	{ 0x00D32244, 84978, 9, 1, 1389 },
+	{ 0x00D32248, 85002, 5, 1, 1398 },
+	{ 0x00D3224C, 85026, 5, 1, 1403 },
+	{ 0x00D32250, 85050, 7, 1, 1408 },
+	{ 0x00D32254, 85074, 7, 1, 1415 },
+	{ 0x00D32460, 85098, 4, 1, 1422 },
+	{ 0x00D32464, 85122, 1, 1, 1259 },
+	{ 0x00D32600, 85146, 1, 1, 1426 },
+	{ 0x00D32604, 85172, 3, 1, 1427 },
+	{ 0x00D32608, 85198, 1, 1, 396 },
+	{ 0x00D3260C, 85223, 1, 1, 396 },
+	{ 0x00D33600, 85255, 15, 1, 1691 },
+	{ 0x00D33604, 85285, 9, 1, 1582 },
+	{ 0x00D33608, 85331, 2, 1, 1706 },
+	{ 0x00D3360C, 85364, 2, 1, 1593 },
+	{ 0x00D33610, 85397, 1, 1, 1595 },
+	{ 0x00D33614, 85429, 1, 1, 1595 },
+	{ 0x00D33618, 85461, 1, 1, 1596 },
+	{ 0x00D3361C, 85497, 1, 1, 1597 },
+	{ 0x00D33620, 85533, 1, 1, 1595 },
+	{ 0x00D33624, 85572, 1, 1, 1595 },
+	{ 0x00D33628, 85611, 1, 1, 1596 },
+	{ 0x00D3362C, 85654, 2, 1, 1598 },
+	{ 0x00D33630, 85697, 1, 1, 1600 },
+	{ 0x00D33634, 85726, 1, 1, 1600 },
+	{ 0x00D33640, 85791, 12, 1, 1708 },
+	{ 0x00D33644, 85867, 5, 1, 1720 },
+	{ 0x00D336B0, 85896, 1, 1, 1636 },
+	{ 0x00D336B4, 85942, 1, 1, 1636 },
+	{ 0x00D336B8, 85988, 1, 1, 1637 },
+	{ 0x00D336BC, 86033, 1, 1, 1637 },
+	{ 0x00D336E0, 86115, 6, 1, 1725 },
+	{ 0x00D336E4, 86139, 6, 1, 1648 },
+	{ 0x00D33700, 86163, 1, 1, 1654 },
+	{ 0x00D33704, 86200, 1, 1, 1654 },
+	{ 0x00D33708, 86237, 1, 1, 1655 },
+	{ 0x00D3370C, 86278, 2, 1, 1656 },
+	{ 0x00D38000, 86472, 16, 1, 1731 },
+	{ 0x00D38004, 86544, 5, 1, 1747 },
+	{ 0x00D38008, 86633, 6, 1, 1752 },
+	{ 0x00D3800C, 86657, 1, 1, 1758 },
+	{ 0x00D38010, 86678, 1, 1, 1758 },
+	{ 0x00D38014, 86706, 1, 1, 1759 },
+	{ 0x00D38018, 86727, 1, 1, 1759 },
+	{ 0x00D3801C, 86748, 1, 1, 1759 },
+	{ 0x00D38020, 86769, 1, 1, 1759 },
+	{ 0x00D38024, 86790, 1, 1, 1759 },
+	{ 0x00D38028, 86811, 1, 1, 1759 },
+	{ 0x00D3802C, 86832, 1, 1, 1759 },
+	{ 0x00D38030, 86853, 1, 1, 1758 },
+	{ 0x00D38034, 86875, 1, 1, 1758 },
+	{ 0x00D38038, 86897, 1, 1, 1759 },
+	{ 0x00D3803C, 86919, 1, 1, 1759 },
+	{ 0x00D38040, 86941, 1, 1, 1759 },
+	{ 0x00D38044, 86963, 1, 1, 1759 },
+	{ 0x00D38048, 86985, 1, 1, 1759 },
+	{ 0x00D3804C, 87007, 1, 1, 1759 },
+	{ 0x00D38050, 87029, 1, 1, 1759 },
+	{ 0x00D38054, 87070, 2, 1, 1760 },
+	{ 0x00D38058, 87179, 9, 1, 1762 },
+	{ 0x00D3805C, 87245, 6, 1, 1771 },
+	{ 0x00D38060, 87284, 2, 1, 1777 },
+	{ 0x00D38064, 87310, 1, 1, 1779 },
+	{ 0x00D38068, 87330, 1, 1, 1780 },
+	{ 0x00D3806C, 87355, 1, 1, 1780 },
+	{ 0x00D38070, 87380, 1, 1, 1780 },
+	{ 0x00D38074, 87405, 1, 1, 1780 },
+	{ 0x00D38078, 87436, 1, 1, 1781 },
+	{ 0x00D3807C, 87468, 1, 1, 1782 },
+	{ 0x00D38080, 87494, 1, 1, 1780 },
+	{ 0x00D38084, 87520, 1, 1, 1780 },
+	{ 0x00D38088, 87546, 1, 1, 1780 },
+	{ 0x00D3808C, 87572, 1, 1, 1780 },
+	{ 0x00D38090, 87605, 1, 1, 1783 },
+	{ 0x00D38094, 87630, 1, 1, 1783 },
+	{ 0x00D38098, 87655, 1, 1, 1783 },
+	{ 0x00D3809C, 87680, 1, 1, 1783 },
+	{ 0x00D380A0, 87705, 1, 1, 1781 },
+	{ 0x00D380A4, 87731, 1, 1, 1782 },
+	{ 0x00D380A8, 87757, 1, 1, 1783 },
+	{ 0x00D380AC, 87783, 1, 1, 1783 },
+	{ 0x00D380B0, 87809, 1, 1, 1783 },
+	{ 0x00D380B4, 87835, 1, 1, 1783 },
+	{ 0x00D380B8, 87869, 1, 1, 1784 },
+	{ 0x00D380BC, 87889, 1, 1, 1784 },
+	{ 0x00D380C0, 87909, 1, 1, 1784 },
+	{ 0x00D380C4, 87929, 1, 1, 1784 },
+	{ 0x00D380C8, 87956, 1, 1, 1785 },
+	{ 0x00D380CC, 87982, 1, 1, 1785 },
+	{ 0x00D380D0, 88008, 1, 1, 1785 },
+	{ 0x00D380D4, 88034, 1, 1, 1785 },
+	{ 0x00D380D8, 88060, 1, 1, 1785 },
+	{ 0x00D380DC, 88087, 1, 1, 1785 },
+	{ 0x00D380E0, 88114, 1, 1, 1785 },
+	{ 0x00D380E4, 88141, 1, 1, 1785 },
+	{ 0x00D380E8, 88302, 12, 1, 1786 },
+	{ 0x00D380EC, 88317, 1, 1, 1798 },
+	{ 0x00D380F0, 88334, 1, 1, 1798 },
+	{ 0x00D380F4, 88355, 1, 1, 1799 },
+	{ 0x00D380F8, 88370, 1, 1, 1799 },
+	{ 0x00D380FC, 88394, 1, 1, 1800 },
+	{ 0x00D38100, 88419, 1, 1, 1801 },
+	{ 0x00D38104, 88444, 1, 1, 1802 },
+	{ 0x00D38108, 88469, 1, 1, 1803 },
+	{ 0x00D3810C, 88493, 1, 1, 1804 },
+	{ 0x00D38110, 88513, 1, 1, 1804 },
+	{ 0x00D38114, 88533, 1, 1, 1804 },
+	{ 0x00D38118, 88553, 1, 1, 1804 },
+	{ 0x00D3811C, 88583, 1, 1, 1805 },
+	{ 0x00D38120, 88604, 1, 1, 1805 },
+	{ 0x00D38124, 88625, 1, 1, 395 },
+	{ 0x00D38128, 88649, 1, 1, 395 },
+	{ 0x00D3812C, 88673, 1, 1, 395 },
+	{ 0x00D38130, 88697, 1, 1, 395 },
+	{ 0x00D38134, 88721, 1, 1, 395 },
+	{ 0x00D38138, 88745, 1, 1, 395 },
+	{ 0x00D3813C, 88769, 1, 1, 395 },
+	{ 0x00D38140, 88793, 1, 1, 395 },
+	{ 0x00D38144, 88830, 5, 1, 1806 },
+	{ 0x00D38148, 88852, 1, 1, 395 },
+	{ 0x00D3814C, 88876, 1, 1, 395 },
+	{ 0x00D38150, 88900, 1, 1, 395 },
+	{ 0x00D38154, 88924, 1, 1, 395 },
+	{ 0x00D38158, 88948, 1, 1, 395 },
+	{ 0x00D3815C, 88972, 1, 1, 395 },
+	{ 0x00D38160, 88996, 1, 1, 395 },
+	{ 0x00D38164, 89020, 1, 1, 395 },
+	{ 0x00D38168, 89044, 5, 1, 1806 },
+	{ 0x00D3816C, 89066, 1, 1, 395 },
+	{ 0x00D38170, 89090, 1, 1, 395 },
+	{ 0x00D38174, 89114, 1, 1, 395 },
+	{ 0x00D38178, 89138, 1, 1, 395 },
+	{ 0x00D3817C, 89162, 1, 1, 395 },
+	{ 0x00D38180, 89186, 1, 1, 395 },
+	{ 0x00D38184, 89210, 1, 1, 395 },
+	{ 0x00D38188, 89234, 1, 1, 395 },
+	{ 0x00D3818C, 89258, 5, 1, 1806 },
+	{ 0x00D38190, 89280, 1, 1, 395 },
+	{ 0x00D38194, 89304, 1, 1, 395 },
+	{ 0x00D38198, 89328, 1, 1, 395 },
+	{ 0x00D3819C, 89352, 1, 1, 395 },
+	{ 0x00D381A0, 89376, 1, 1, 395 },
+	{ 0x00D381A4, 89400, 1, 1, 395 },
+	{ 0x00D381A8, 89424, 1, 1, 395 },
+	{ 0x00D381AC, 89448, 1, 1, 395 },
+	{ 0x00D381B0, 89472, 5, 1, 1806 },
+	{ 0x00D381B4, 89506, 1, 1, 1811 },
+	{ 0x00D381B8, 89541, 1, 1, 1812 },
+	{ 0x00D381BC, 89577, 2, 1, 1813 },
+	{ 0x00D381C0, 89595, 1, 1, 1815 },
+	{ 0x00D381C4, 89614, 1, 1, 1816 },
+	{ 0x00D381C8, 89633, 1, 1, 1817 },
+	{ 0x00D381CC, 89652, 1, 1, 1818 },
+	{ 0x00D3CE00, 89670, 1, 1, 1819 },
+	{ 0x00D3CE04, 89698, 1, 1, 1819 },
+	{ 0x00D3CE08, 89725, 1, 1, 1819 },
+	{ 0x00D3CE0C, 89753, 1, 1, 1819 },
+	{ 0x00D3CE10, 89785, 1, 1, 1819 },
+	{ 0x00D3CE14, 89817, 1, 1, 1819 },
+	{ 0x00D3CE18, 89844, 1, 1, 1819 },
+	{ 0x00D3CE1C, 89875, 1, 1, 1819 },
+	{ 0x00D3CE20, 89905, 1, 1, 1820 },
+	{ 0x00D3CE24, 89934, 1, 1, 1820 },
+	{ 0x00D3CE28, 89962, 1, 1, 1820 },
+	{ 0x00D3CE2C, 89991, 1, 1, 1820 },
+	{ 0x00D3CE30, 90024, 1, 1, 1820 },
+	{ 0x00D3CE34, 90057, 1, 1, 1820 },
+	{ 0x00D3CE38, 90085, 1, 1, 1820 },
+	{ 0x00D3CE3C, 90117, 1, 1, 1820 },
+	{ 0x00D3CE40, 90148, 1, 1, 1819 },
+	{ 0x00D3CE44, 90183, 1, 1, 1819 },
+	{ 0x00D3CE48, 90218, 1, 1, 1819 },
+	{ 0x00D3CE4C, 90259, 1, 1, 1821 },
+	{ 0x00D3CE50, 90297, 1, 1, 1822 },
+	{ 0x00D3CE54, 90333, 1, 1, 1822 },
+	{ 0x00D3CE58, 90369, 1, 1, 1822 },
+	{ 0x00D3CF80, 90471, 13, 1, 1823 },
+	{ 0x00D3CF84, 90541, 5, 1, 1836 },
+	{ 0x00D3CF88, 90605, 4, 1, 1841 },
+	{ 0x00D3D200, 90657, 5, 1, 1845 },
+	{ 0x00D3D204, 90693, 1, 1, 1151 },
+	{ 0x00D3DA00, 90755, 5, 1, 1850 },
+	{ 0x00D3DA04, 90786, 1, 1, 1855 },
+	{ 0x00D3DA08, 90818, 1, 1, 1856 },
+	{ 0x00D3DA0C, 90863, 2, 1, 1857 },
+	{ 0x00D3DA10, 90894, 1, 1, 323 },
+	{ 0x00D3DC00, 112566, 2, 1, 3113 },
+	{ 0x00D3DC04, 112589, 2, 1, 3113 },
+	{ 0x00D3DC08, 112612, 2, 1, 3113 },
+	{ 0x00D3DC0C, 112635, 2, 1, 3113 },
+	{ 0x00D3DC10, 112658, 2, 1, 3113 },
+	{ 0x00D3DC14, 112681, 2, 1, 3113 },
+	{ 0x00D3DC18, 112704, 2, 1, 3113 },
+	{ 0x00D3DC1C, 112727, 2, 1, 3113 },
+	{ 0x00D3DC20, 112750, 2, 1, 3113 },
+	{ 0x00D3DC24, 112773, 2, 1, 3113 },
+	{ 0x00D3DC28, 112796, 2, 1, 3113 },
+	{ 0x00D3DC2C, 112820, 2, 1, 3113 },
+	{ 0x00D3DC30, 112844, 2, 1, 3113 },
+	{ 0x00D3DC34, 112868, 2, 1, 3113 },
+	{ 0x00D3DC38, 112892, 2, 1, 3113 },
+	{ 0x00D3DC3C, 112916, 2, 1, 3113 },
+	{ 0x00D3DC40, 112940, 2, 1, 3113 },
+	{ 0x00D3DC44, 112964, 2, 1, 3113 },
+	{ 0x00D3DC48, 112988, 2, 1, 3113 },
+	{ 0x00D3DC4C, 113012, 2, 1, 3113 },
+	{ 0x00D3DC50, 113036, 2, 1, 3113 },
+	{ 0x00D3DC54, 113060, 2, 1, 3113 },
+	{ 0x00D3DC58, 113084, 2, 1, 3113 },
+	{ 0x00D3DC5C, 113108, 2, 1, 3113 },
+	{ 0x00D3DC60, 113132, 2, 1, 3113 },
+	{ 0x00D3DC64, 113156, 2, 1, 3113 },
+	{ 0x00D3DC68, 113180, 2, 1, 3113 },
+	{ 0x00D3DC6C, 113204, 2, 1, 3113 },
+	{ 0x00D3DC70, 113228, 2, 1, 3113 },
+	{ 0x00D3DC74, 113252, 2, 1, 3113 },
+	{ 0x00D3DC78, 113276, 2, 1, 3113 },
+	{ 0x00D3DC7C, 113300, 2, 1, 3113 },
+	{ 0x00D3DC80, 113324, 2, 1, 3113 },
+	{ 0x00D3DC84, 113348, 2, 1, 3113 },
+	{ 0x00D3DC88, 113372, 2, 1, 3113 },
+	{ 0x00D3DC8C, 113396, 2, 1, 3113 },
+	{ 0x00D3DC90, 113420, 2, 1, 3113 },
+	{ 0x00D3DC94, 113444, 2, 1, 3113 },
+	{ 0x00D3DC98, 113468, 2, 1, 3113 },
+	{ 0x00D3DC9C, 113492, 2, 1, 3113 },
+	{ 0x00D3DCA0, 113516, 2, 1, 3113 },
+	{ 0x00D3DCA4, 113540, 2, 1, 3113 },
+	{ 0x00D3DCA8, 113564, 2, 1, 3113 },
+	{ 0x00D3DCAC, 113588, 2, 1, 3113 },
+	{ 0x00D3DCB0, 113612, 2, 1, 3113 },
+	{ 0x00D3DCB4, 113636, 2, 1, 3113 },
+	{ 0x00D3DCB8, 113660, 2, 1, 3113 },
+	{ 0x00D3DCBC, 113684, 2, 1, 3113 },
+	{ 0x00D3DCC0, 113708, 2, 1, 3113 },
+	{ 0x00D3DCC4, 113732, 2, 1, 3113 },
+	{ 0x00D3DCC8, 113756, 2, 1, 3113 },
+	{ 0x00D3DCCC, 113780, 2, 1, 3113 },
+	{ 0x00D3DCD0, 113804, 2, 1, 3113 },
+	{ 0x00D3DCD4, 113828, 2, 1, 3113 },
+	{ 0x00D3DCD8, 113852, 2, 1, 3113 },
+	{ 0x00D3DCDC, 113876, 2, 1, 3113 },
+	{ 0x00D3DCE0, 113900, 2, 1, 3113 },
+	{ 0x00D3DCE4, 113924, 2, 1, 3113 },
+	{ 0x00D3DCE8, 113948, 2, 1, 3113 },
+	{ 0x00D3DCEC, 113972, 2, 1, 3113 },
+	{ 0x00D3DCF0, 113996, 2, 1, 3113 },
+	{ 0x00D3DCF4, 114020, 2, 1, 3113 },
+	{ 0x00D3DCF8, 114044, 2, 1, 3113 },
+	{ 0x00D3DCFC, 114068, 2, 1, 3113 },
+	{ 0x00D3DD00, 114092, 2, 1, 3113 },
+	{ 0x00D3DD04, 114116, 2, 1, 3113 },
+	{ 0x00D3DD08, 114140, 2, 1, 3113 },
+	{ 0x00D3DD0C, 114164, 2, 1, 3113 },
+	{ 0x00D3DD10, 114188, 2, 1, 3113 },
+	{ 0x00D3DD14, 114212, 2, 1, 3113 },
+	{ 0x00D3DD18, 114236, 2, 1, 3113 },
+	{ 0x00D3DD1C, 114260, 2, 1, 3113 },
+	{ 0x00D3DD20, 114284, 2, 1, 3113 },
+	{ 0x00D3DD24, 114308, 2, 1, 3113 },
+	{ 0x00D3DD28, 114332, 2, 1, 3113 },
+	{ 0x00D3DD2C, 114356, 2, 1, 3113 },
+	{ 0x00D3DD30, 114380, 2, 1, 3113 },
+	{ 0x00D3DD34, 114404, 2, 1, 3113 },
+	{ 0x00D3DD38, 114428, 2, 1, 3113 },
+	{ 0x00D3DD3C, 114452, 2, 1, 3113 },
+	{ 0x00D3DD40, 114476, 2, 1, 3113 },
+	{ 0x00D3DD44, 114500, 2, 1, 3113 },
+	{ 0x00D3DD48, 114524, 2, 1, 3113 },
+	{ 0x00D3DD4C, 114548, 2, 1, 3113 },
+	{ 0x00D3DD50, 114572, 2, 1, 3113 },
+	{ 0x00D3DD54, 114596, 2, 1, 3113 },
+	{ 0x00D3DD58, 114620, 2, 1, 3113 },
+	{ 0x00D3DD5C, 114644, 2, 1, 3113 },
+	{ 0x00D3DD60, 114668, 2, 1, 3113 },
+	{ 0x00D3DD64, 114692, 2, 1, 3113 },
+	{ 0x00D3DD68, 114716, 2, 1, 3113 },
+	{ 0x00D3DD6C, 114740, 2, 1, 3113 },
+	{ 0x00D3DD70, 114764, 2, 1, 3113 },
+	{ 0x00D3DD74, 114788, 2, 1, 3113 },
+	{ 0x00D3DD78, 114812, 2, 1, 3113 },
+	{ 0x00D3DD7C, 114836, 2, 1, 3113 },
+	{ 0x00D3DD80, 114860, 2, 1, 3113 },
+	{ 0x00D3DD84, 114884, 2, 1, 3113 },
+	{ 0x00D3DD88, 114908, 2, 1, 3113 },
+	{ 0x00D3DD8C, 114932, 2, 1, 3113 },
+	{ 0x00D3DD90, 114956, 2, 1, 3113 },
+	{ 0x00D3DD94, 114981, 2, 1, 3113 },
+	{ 0x00D3DD98, 115006, 2, 1, 3113 },
+	{ 0x00D3DD9C, 115031, 2, 1, 3113 },
+	{ 0x00D3DDA0, 115056, 2, 1, 3113 },
+	{ 0x00D3DDA4, 115081, 2, 1, 3113 },
+	{ 0x00D3DDA8, 115106, 2, 1, 3113 },
+	{ 0x00D3DDAC, 115131, 2, 1, 3113 },
+	{ 0x00D3DDB0, 115156, 2, 1, 3113 },
+	{ 0x00D3DDB4, 115181, 2, 1, 3113 },
+	{ 0x00D3DDB8, 115206, 2, 1, 3113 },
+	{ 0x00D3DDBC, 115231, 2, 1, 3113 },
+	{ 0x00D3DDC0, 115256, 2, 1, 3113 },
+	{ 0x00D3DDC4, 115281, 2, 1, 3113 },
+	{ 0x00D3DDC8, 115306, 2, 1, 3113 },
+	{ 0x00D3DDCC, 115331, 2, 1, 3113 },
+	{ 0x00D3DDD0, 115356, 2, 1, 3113 },
+	{ 0x00D3DDD4, 115381, 2, 1, 3113 },
+	{ 0x00D3DDD8, 115406, 2, 1, 3113 },
+	{ 0x00D3DDDC, 115431, 2, 1, 3113 },
+	{ 0x00D3DDE0, 115456, 2, 1, 3113 },
+	{ 0x00D3DDE4, 115481, 2, 1, 3113 },
+	{ 0x00D3DDE8, 115506, 2, 1, 3113 },
+	{ 0x00D3DDEC, 115531, 2, 1, 3113 },
+	{ 0x00D3DDF0, 115556, 2, 1, 3113 },
+	{ 0x00D3DDF4, 115581, 2, 1, 3113 },
+	{ 0x00D3DDF8, 115606, 2, 1, 3113 },
+	{ 0x00D3DDFC, 115631, 2, 1, 3113 },
+	{ 0x00D3DE00, 115656, 2, 1, 3113 },
+	{ 0x00D3DE04, 115681, 2, 1, 3113 },
+	{ 0x00D3DE08, 115706, 2, 1, 3113 },
+	{ 0x00D3DE0C, 115731, 2, 1, 3113 },
+	{ 0x00D3DE10, 115756, 2, 1, 3113 },
+	{ 0x00D3DE14, 115781, 2, 1, 3113 },
+	{ 0x00D3DE18, 115806, 2, 1, 3113 },
+	{ 0x00D3DE1C, 115831, 2, 1, 3113 },
+	{ 0x00D3DE20, 115856, 2, 1, 3113 },
+	{ 0x00D3DE24, 115881, 2, 1, 3113 },
+	{ 0x00D3DE28, 115906, 2, 1, 3113 },
+	{ 0x00D3DE2C, 115931, 2, 1, 3113 },
+	{ 0x00D3DE30, 115956, 2, 1, 3113 },
+	{ 0x00D3DE34, 115981, 2, 1, 3113 },
+	{ 0x00D3DE38, 116006, 2, 1, 3113 },
+	{ 0x00D3DE3C, 116031, 2, 1, 3113 },
+	{ 0x00D3DE40, 116056, 2, 1, 3113 },
+	{ 0x00D3DE44, 116081, 2, 1, 3113 },
+	{ 0x00D3DE48, 116106, 2, 1, 3113 },
+	{ 0x00D3DE4C, 116131, 2, 1, 3113 },
+	{ 0x00D3DE50, 116156, 2, 1, 3113 },
+	{ 0x00D3DE54, 116181, 2, 1, 3113 },
+	{ 0x00D3DE58, 116206, 2, 1, 3113 },
+	{ 0x00D3DE5C, 116231, 2, 1, 3113 },
+	{ 0x00D3DE60, 116256, 2, 1, 3113 },
+	{ 0x00D3DE64, 116281, 2, 1, 3113 },
+	{ 0x00D3DE68, 116306, 2, 1, 3113 },
+	{ 0x00D3DE6C, 116331, 2, 1, 3113 },
+	{ 0x00D3DE70, 116356, 2, 1, 3113 },
+	{ 0x00D3DE74, 116381, 2, 1, 3113 },
+	{ 0x00D3DE78, 116406, 2, 1, 3113 },
+	{ 0x00D3DE7C, 116431, 2, 1, 3113 },
+	{ 0x00D3DE80, 116456, 2, 1, 3113 },
+	{ 0x00D3DE84, 116481, 2, 1, 3113 },
+	{ 0x00D3DE88, 116506, 2, 1, 3113 },
+	{ 0x00D3DE8C, 116531, 2, 1, 3113 },
+	{ 0x00D3DE90, 116556, 2, 1, 3113 },
+	{ 0x00D3DE94, 116581, 2, 1, 3113 },
+	{ 0x00D3DE98, 116606, 2, 1, 3113 },
+	{ 0x00D3DE9C, 116631, 2, 1, 3113 },
+	{ 0x00D3DEA0, 116656, 2, 1, 3113 },
+	{ 0x00D3DEA4, 116681, 2, 1, 3113 },
+	{ 0x00D3DEA8, 116706, 2, 1, 3113 },
+	{ 0x00D3DEAC, 116731, 2, 1, 3113 },
+	{ 0x00D3DEB0, 116756, 2, 1, 3113 },
+	{ 0x00D3DEB4, 116781, 2, 1, 3113 },
+	{ 0x00D3DEB8, 116806, 2, 1, 3113 },
+	{ 0x00D3DEBC, 116831, 2, 1, 3113 },
+	{ 0x00D3DEC0, 116856, 2, 1, 3113 },
+	{ 0x00D3DEC4, 116881, 2, 1, 3113 },
+	{ 0x00D3DEC8, 116906, 2, 1, 3113 },
+	{ 0x00D3DECC, 116931, 2, 1, 3113 },
+	{ 0x00D3DED0, 116956, 2, 1, 3113 },
+	{ 0x00D3DED4, 116981, 2, 1, 3113 },
+	{ 0x00D3DED8, 117006, 2, 1, 3113 },
+	{ 0x00D3DEDC, 117031, 2, 1, 3113 },
+	{ 0x00D3DEE0, 117056, 2, 1, 3113 },
+	{ 0x00D3DEE4, 117081, 2, 1, 3113 },
+	{ 0x00D3DEE8, 117106, 2, 1, 3113 },
+	{ 0x00D3DEEC, 117131, 2, 1, 3113 },
+	{ 0x00D3DEF0, 117156, 2, 1, 3113 },
+	{ 0x00D3DEF4, 117181, 2, 1, 3113 },
+	{ 0x00D3DEF8, 117206, 2, 1, 3113 },
+	{ 0x00D3DEFC, 117231, 2, 1, 3113 },
+	{ 0x00D3DF00, 117256, 2, 1, 3113 },
+	{ 0x00D3DF04, 117281, 2, 1, 3113 },
+	{ 0x00D3DF08, 117306, 2, 1, 3113 },
+	{ 0x00D3DF0C, 117331, 2, 1, 3113 },
+	{ 0x00D3DF10, 117356, 2, 1, 3113 },
+	{ 0x00D3DF14, 117381, 2, 1, 3113 },
+	{ 0x00D3DF18, 117406, 2, 1, 3113 },
+	{ 0x00D3DF1C, 117431, 2, 1, 3113 },
+	{ 0x00D3DF20, 117456, 2, 1, 3113 },
+	{ 0x00D3DF24, 117481, 2, 1, 3113 },
+	{ 0x00D3DF28, 117506, 2, 1, 3113 },
+	{ 0x00D3DF2C, 117531, 2, 1, 3113 },
+	{ 0x00D3DF30, 117556, 2, 1, 3113 },
+	{ 0x00D3DF34, 117581, 2, 1, 3113 },
+	{ 0x00D3DF38, 117606, 2, 1, 3113 },
+	{ 0x00D3DF3C, 117631, 2, 1, 3113 },
+	{ 0x00D3DF40, 117656, 2, 1, 3113 },
+	{ 0x00D3DF44, 117681, 2, 1, 3113 },
+	{ 0x00D3DF48, 117706, 2, 1, 3113 },
+	{ 0x00D3DF4C, 117731, 2, 1, 3113 },
+	{ 0x00D3DF50, 117756, 2, 1, 3113 },
+	{ 0x00D3DF54, 117781, 2, 1, 3113 },
+	{ 0x00D3DF58, 117806, 2, 1, 3113 },
+	{ 0x00D3DF5C, 117831, 2, 1, 3113 },
+	{ 0x00D3DF60, 117856, 2, 1, 3113 },
+	{ 0x00D3DF64, 117881, 2, 1, 3113 },
+	{ 0x00D3DF68, 117906, 2, 1, 3113 },
+	{ 0x00D3DF6C, 117931, 2, 1, 3113 },
+	{ 0x00D3DF70, 117956, 2, 1, 3113 },
+	{ 0x00D3DF74, 117981, 2, 1, 3113 },
+	{ 0x00D3DF78, 118006, 2, 1, 3113 },
+	{ 0x00D3DF7C, 118031, 2, 1, 3113 },
+	{ 0x00D3DF80, 118056, 2, 1, 3113 },
+	{ 0x00D3DF84, 118081, 2, 1, 3113 },
+	{ 0x00D3DF88, 118106, 2, 1, 3113 },
+	{ 0x00D3DF8C, 118131, 2, 1, 3113 },
+	{ 0x00D3DF90, 118156, 2, 1, 3113 },
+	{ 0x00D3DF94, 118181, 2, 1, 3113 },
+	{ 0x00D3DF98, 118206, 2, 1, 3113 },
+	{ 0x00D3DF9C, 118231, 2, 1, 3113 },
+	{ 0x00D3DFA0, 118256, 2, 1, 3113 },
+	{ 0x00D3DFA4, 118281, 2, 1, 3113 },
+	{ 0x00D3DFA8, 118306, 2, 1, 3113 },
+	{ 0x00D3DFAC, 118331, 2, 1, 3113 },
+	{ 0x00D3DFB0, 118356, 2, 1, 3113 },
+	{ 0x00D3DFB4, 118381, 2, 1, 3113 },
+	{ 0x00D3DFB8, 118406, 2, 1, 3113 },
+	{ 0x00D3DFBC, 118431, 2, 1, 3113 },
+	{ 0x00D3DFC0, 118456, 2, 1, 3113 },
+	{ 0x00D3DFC4, 118481, 2, 1, 3113 },
+	{ 0x00D3DFC8, 118506, 2, 1, 3113 },
+	{ 0x00D3DFCC, 118531, 2, 1, 3113 },
+	{ 0x00D3DFD0, 118556, 2, 1, 3113 },
+	{ 0x00D3DFD4, 118581, 2, 1, 3113 },
+	{ 0x00D3DFD8, 118606, 2, 1, 3113 },
+	{ 0x00D3DFDC, 118631, 2, 1, 3113 },
+	{ 0x00D3DFE0, 118656, 2, 1, 3113 },
+	{ 0x00D3DFE4, 118681, 2, 1, 3113 },
+	{ 0x00D3DFE8, 118706, 2, 1, 3113 },
+	{ 0x00D3DFEC, 118731, 2, 1, 3113 },
+	{ 0x00D3DFF0, 118756, 2, 1, 3113 },
+	{ 0x00D3DFF4, 118781, 2, 1, 3113 },
+	{ 0x00D3DFF8, 118806, 2, 1, 3113 },
+	{ 0x00D3DFFC, 118837, 1, 1, 3115 },
+};
+
+const unsigned int gpy2xx_regmap_nr[GPY2XX_REGMAP_SPACES] = { 134, 2694, 3344 };
@@ -0,0 +1,535 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Loopback line-rate self-test, without external traffic generator.
+
+   For each speed the port is forced to the speed (full duplex) and put in
+   a loopback: a PHY test loop (loop=<n>, gpy211_test_loop, default GMII
+   near end immediate) or, with usx=1, the USXGMII Rx to Tx loopback of
+   GPY24X. Traffic is driven from the host interface for time ms:
+     - ifname=<netdev>: built-in generator, a raw socket sends test frames
+       of size bytes at rate frames/s (0: as fast as possible) and receives
+       them back. Lost, duplicated and reordered frames and the round trip
+       latency (host to PHY and back, min/avg/max) are measured per frame.
+     - load=<cmd>: an external generator on the host (e.g. a kernel pktgen
+       script), only the PHY counters are used.
+   The GMAC-F counters (64-bit accumulator) give the packets seen by the
+   PHY, CRC errors and Tx underflows over the window.
+
+   A speed passes with no lost frame, no CRC error, no underflow and, if
+   minRate is set, a throughput of at least minRate percent of line rate
+   at the frame size. The link settings are restored at the end.
+
+   gpy2xx_selftest phyId=<n> [speeds=<s,s,...>] [loop=<n>] [usx=0|1]
+                   [ifname=<netdev>] [size=<bytes>] [rate=<fps>]
+                   [load=<cmd>] [time=<ms>] [settle=<ms>] [minRate=<%>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <linux/if_packet.h>
+#include <linux/if_ether.h>
+
+#include "gpy2xx_mdio.h"
+
+/* IEEE 802 local experimental EtherType */
+#define ST_ETH_TYPE 0x88B5
+#define ST_MAGIC 0x47535431 /* "GST1" */
+#define ST_MAX_SPEEDS 6
+/* Frames still in flight after the window, ms */
+#define ST_DRAIN_MS 200
+/* Preamble, SFD and IPG per frame on the wire */
+#define ST_WIRE_OVERHEAD 20
+
+struct st_cfg {
+	int phy_id;
+	int speed[ST_MAX_SPEEDS];
+	u32 nr_speed;
+	int loop;
+	u32 usx;
+	const char *ifname;
+	u32 size;
+	u32 rate;
+	const char *load;
+	u32 time_ms;
+	u32 settle_ms;
+	u32 min_rate;
+};
+
+/* Test frame payload after the Ethernet header */
+struct st_frame {
+	u32 magic;
+	u32 seq;
+	u64 ts;
+};
+
+struct st_result {
+	int speed;
+	int ret;
+	/* Built-in generator */
+	u64 sent;
+	u64 received;
+	u64 reordered;
+	u64 duplicated;
+	u64 lat_min_ns;
+	u64 lat_max_ns;
+	u64 lat_sum_ns;
+	/* PHY counters */
+	struct gmacf_counters64 cnt;
+	/* Frames per second and percent of line rate */
+	u64 fps;
+	u32 pct;
+	int pass;
+};
+
+/* Built-in generator state */
+struct st_gen {
+	const struct st_cfg *cfg;
+	int sock;
+	struct sockaddr_ll addr;
+	u8 mac[ETH_ALEN];
+	volatile int stop;
+	u64 sent;
+};
+
+static struct gpy211_device phy;
+static struct gpy2xx_mdio mdio;
+
+static u64 st_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+static int st_gen_open(struct st_gen *gen, const char *ifname)
+{
+	struct ifreq ifr;
+	struct timeval tv = {.tv_sec = 0, .tv_usec = 50000};
+
+	gen->sock = socket(AF_PACKET, SOCK_RAW, htons(ST_ETH_TYPE));
+
+	if (gen->sock < 0) {
+		printf("ERROR: raw socket failed (%d)\n", -errno);
+		return -errno;
+	}
+
+	memset(&ifr, 0, sizeof(ifr));
+	snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", ifname);
+
+	if (ioctl(gen->sock, SIOCGIFHWADDR, &ifr) < 0) {
+		printf("ERROR: no interface \"%s\"\n", ifname);
+		return -ENODEV;
+	}
+
+	memcpy(gen->mac, ifr.ifr_hwaddr.sa_data, ETH_ALEN);
+
+	memset(&gen->addr, 0, sizeof(gen->addr));
+	gen->addr.sll_family = AF_PACKET;
+	gen->addr.sll_protocol = htons(ST_ETH_TYPE);
+	gen->addr.sll_ifindex = (int)if_nametoindex(ifname);
+	gen->addr.sll_halen = ETH_ALEN;
+	memcpy(gen->addr.sll_addr, gen->mac, ETH_ALEN);
+
+	if (bind(gen->sock, (struct sockaddr *)&gen->addr, sizeof(gen->addr)) < 0 ||
+	    setsockopt(gen->sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0) {
+		printf("ERROR: bind to \"%s\" failed (%d)\n", ifname, -errno);
+		return -errno;
+	}
+
+	return 0;
+}
+
+/* Sender thread: frames to the own MAC, so that the looped frames are
+   accepted back without promiscuous mode */
+static void *st_gen_tx(void *arg)
+{
+	struct st_gen *gen = arg;
+	u8 buf[ETH_FRAME_LEN];
+	struct ethhdr *eh = (struct ethhdr *)buf;
+	struct st_frame fr = {.magic = ST_MAGIC};
+	u64 t0 = st_now(), gap_ns;
+	u32 len = gen->cfg->size - ETH_FCS_LEN;
+
+	memset(buf, 0, sizeof(buf));
+	memcpy(eh->h_dest, gen->mac, ETH_ALEN);
+	memcpy(eh->h_source, gen->mac, ETH_ALEN);
+	eh->h_proto = htons(ST_ETH_TYPE);
+	gap_ns = gen->cfg->rate ? 1000000000ull / gen->cfg->rate : 0;
+
+	while (!gen->stop) {
+		/* Sleep until the next send time, same clock as st_now() */
+		if (gap_ns) {
+			u64 next = t0 + gen->sent * gap_ns;
+			struct timespec ts = {
+				.tv_sec = next / 1000000000ull,
+				.tv_nsec = next % 1000000000ull,
+			};
+
+			if (st_now() < next &&
+			    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0)
+				continue;
+		}
+
+		/* Payload is not aligned */
+		fr.seq = (u32)gen->sent;
+		fr.ts = st_now();
+		memcpy(buf + ETH_HLEN, &fr, sizeof(fr));
+
+		if (send(gen->sock, buf, len, 0) == (ssize_t)len)
+			gen->sent++;
+	}
+
+	return NULL;
+}
+
+/* Receive until the window and the drain time are over */
+static void st_gen_rx(struct st_gen *gen, struct st_result *res, u64 end)
+{
+	u8 buf[ETH_FRAME_LEN];
+	struct st_frame fr;
+	struct sockaddr_ll from;
+	socklen_t alen;
+	u32 next = 0;
+	u64 lat;
+	ssize_t n;
+
+	res->lat_min_ns = ~0ull;
+
+	while (st_now() < end + (u64)ST_DRAIN_MS * 1000000ull) {
+		if (st_now() >= end)
+			gen->stop = 1;
+
+		alen = sizeof(from);
+		n = recvfrom(gen->sock, buf, sizeof(buf), 0, (struct sockaddr *)&from, &alen);
+
+		/* Own frames on the way out are seen too */
+		if (n < (ssize_t)(ETH_HLEN + sizeof(fr)) || from.sll_pkttype == PACKET_OUTGOING)
+			continue;
+
+		memcpy(&fr, buf + ETH_HLEN, sizeof(fr));
+
+		if (fr.magic != ST_MAGIC)
+			continue;
+
+		if (fr.seq + 1 == next) {
+			res->duplicated++;
+			continue;
+		}
+
+		lat = st_now() - fr.ts;
+
+		if (lat < res->lat_min_ns)
+			res->lat_min_ns = lat;
+
+		if (lat > res->lat_max_ns)
+			res->lat_max_ns = lat;
+
+		res->lat_sum_ns += lat;
+		res->received++;
+
+		if (fr.seq != next)
+			res->reordered++;
+
+		if (fr.seq >= next)
+			next = fr.seq + 1;
+	}
+}
+
+static int st_window(const struct st_cfg *cfg, struct st_gen *gen, struct st_result *res)
+{
+	struct gmacf_count_acc acc = {0};
+	pthread_t tx;
+	pid_t pid = 0;
+	u64 t0, end;
+	int ret, status;
+
+	ret = gpy2xx_gmacf_count_acc_init(&phy, &acc);
+
+	if (ret < 0)
+		return ret;
+
+	t0 = st_now();
+	end = t0 + (u64)cfg->time_ms * 1000000ull;
+
+	if (gen != NULL) {
+		gen->stop = 0;
+		gen->sent = 0;
+
+		if (pthread_create(&tx, NULL, st_gen_tx, gen) != 0)
+			return -ENOMEM;
+
+		st_gen_rx(gen, res, end);
+		gen->stop = 1;
+		pthread_join(tx, NULL);
+		res->sent = gen->sent;
+	} else {
+		pid = fork();
+
+		if (pid == 0) {
+			execl("/bin/sh", "sh", "-c", cfg->load, (char *)NULL);
+			_exit(127);
+		}
+
+		if (pid < 0)
+			return -errno;
+
+		while (st_now() < end && waitpid(pid, &status, WNOHANG) == 0)
+			usleep(10000);
+
+		if (waitpid(pid, &status, WNOHANG) == 0) {
+			kill(pid, SIGTERM);
+			waitpid(pid, &status, 0);
+		}
+
+		end = st_now();
+	}
+
+	ret = gpy2xx_gmacf_count_acc_update(&phy, &acc);
+
+	if (ret < 0)
+		return ret;
+
+	res->cnt = acc.total;
+
+	/* End to end with the built-in generator, else as seen by the PHY */
+	if (gen != NULL)
+		res->fps = res->received * 1000000000ull / (end - t0);
+	else
+		res->fps = (res->cnt.rx_good_bad > res->cnt.tx_good_bad ? res->cnt.rx_good_bad :
+			    res->cnt.tx_good_bad) * 1000000000ull / (end - t0);
+
+	return 0;
+}
+
+/* Force the speed and close the loop */
+static int st_setup(const struct st_cfg *cfg, int speed)
+{
+	int ret;
+
+	phy.link.autoneg = 0;
+	phy.link.speed = speed;
+	phy.link.duplex = DUPLEX_FULL;
+
+	ret = gpy2xx_config_aneg(&phy);
+
+	if (ret < 0)
+		return ret;
+
+	if (cfg->usx)
+		ret = gpy2xx_usxgmii_loopback_cfg(&phy, USXGMII_LOOPBACK_RX2TX);
+	else
+		ret = gpy2xx_loopback_cfg(&phy, (enum gpy211_test_loop)cfg->loop);
+
+	if (ret < 0)
+		return ret;
+
+	usleep(cfg->settle_ms * 1000);
+
+	return 0;
+}
+
+static void st_report(const struct st_cfg *cfg, const struct st_result *res, u32 nr)
+{
+	u32 i;
+
+	printf("\n%-6s %-5s %-12s %-12s %-10s %-8s %-8s %-6s %-22s\n", "speed", "pass",
+	       "sent", "phy rx", "lost", "crc", "uflow", "rate%", "latency us min/avg/max");
+
+	for (i = 0; i < nr; i++) {
+		const struct st_result *r = &res[i];
+
+		if (r->ret < 0) {
+			printf("%-6d %-5s error %d\n", r->speed, "FAIL", r->ret);
+			continue;
+		}
+
+		printf("%-6d %-5s %-12llu %-12llu %-10lld %-8llu %-8llu %-6u", r->speed,
+		       r->pass ? "PASS" : "FAIL",
+		       (unsigned long long)(cfg->ifname ? r->sent : r->cnt.tx_good_bad),
+		       (unsigned long long)r->cnt.rx_good_bad,
+		       cfg->ifname ? (long long)(r->sent - r->received) : -1LL,
+		       (unsigned long long)r->cnt.rx_crc_err,
+		       (unsigned long long)r->cnt.tx_uflow_err, r->pct);
+
+		if (cfg->ifname && r->received)
+			printf(" %llu/%llu/%llu", (unsigned long long)r->lat_min_ns / 1000,
+			       (unsigned long long)(r->lat_sum_ns / r->received) / 1000,
+			       (unsigned long long)r->lat_max_ns / 1000);
+
+		printf("\n");
+	}
+}
+
+static int st_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int st_parse(int argc, char *argv[], struct st_cfg *cfg)
+{
+	int i;
+	const char *v;
+	char *end;
+
+	for (i = 1; i < argc; i++) {
+		if (st_arg(argv[i], "phyId", &v)) {
+			cfg->phy_id = (int)strtol(v, NULL, 0);
+		} else if (st_arg(argv[i], "speeds", &v)) {
+			for (cfg->nr_speed = 0; *v && cfg->nr_speed < ST_MAX_SPEEDS; v = end) {
+				cfg->speed[cfg->nr_speed++] = (int)strtol(v, &end, 0);
+
+				if (*end == ',')
+					end++;
+				else if (*end)
+					return -1;
+			}
+		} else if (st_arg(argv[i], "loop", &v)) {
+			cfg->loop = (int)strtol(v, NULL, 0);
+		} else if (st_arg(argv[i], "usx", &v)) {
+			cfg->usx = (u32)strtoul(v, NULL, 0);
+		} else if (st_arg(argv[i], "ifname", &v)) {
+			cfg->ifname = v;
+		} else if (st_arg(argv[i], "size", &v)) {
+			cfg->size = (u32)strtoul(v, NULL, 0);
+		} else if (st_arg(argv[i], "rate", &v)) {
+			cfg->rate = (u32)strtoul(v, NULL, 0);
+		} else if (st_arg(argv[i], "load", &v)) {
+			cfg->load = v;
+		} else if (st_arg(argv[i], "time", &v)) {
+			cfg->time_ms = (u32)strtoul(v, NULL, 0);
+		} else if (st_arg(argv[i], "settle", &v)) {
+			cfg->settle_ms = (u32)strtoul(v, NULL, 0);
+		} else if (st_arg(argv[i], "minRate", &v)) {
+			cfg->min_rate = (u32)strtoul(v, NULL, 0);
+		} else {
+			return -1;
+		}
+	}
+
+	/* One traffic source */
+	if (cfg->phy_id < 0 || cfg->nr_speed == 0 || cfg->time_ms == 0 ||
+	    (cfg->ifname == NULL) == (cfg->load == NULL) ||
+	    cfg->size < ETH_ZLEN + ETH_FCS_LEN || cfg->size > ETH_FRAME_LEN + ETH_FCS_LEN)
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct st_gen gen;
+	struct st_result res[ST_MAX_SPEEDS];
+	struct gpy211_link link;
+	u64 line_fps;
+	u32 i, failed = 0;
+	int ret;
+	struct st_cfg cfg = {
+		.phy_id = -1,
+		.speed = {SPEED_2500, SPEED_1000, SPEED_100},
+		.nr_speed = 3,
+		.loop = TLOOP_NETLI,
+		.size = 64,
+		.time_ms = 10000,
+		.settle_ms = 3000,
+	};
+
+	if (st_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s phyId=<n> [speeds=<s,s,...>] [loop=<n>] [usx=0|1]\n"
+		       "\tifname=<netdev> [size=<bytes>] [rate=<fps>] | load=<cmd>\n"
+		       "\t[time=<ms>] [settle=<ms>] [minRate=<%%>]\n", argv[0]);
+		return -1;
+	}
+
+	gen.cfg = &cfg;
+	gen.sock = -1;
+	ret = gpy2xx_mdio_phy_init(&phy, &mdio, cfg.phy_id);
+
+	if (ret < 0)
+		goto end;
+
+	if (cfg.usx && phy.id.family != ID_P34X) {
+		printf("ERROR: USXGMII loopback only on GPY24X\n");
+		ret = -1;
+		goto end;
+	}
+
+	if (cfg.ifname != NULL && st_gen_open(&gen, cfg.ifname) < 0) {
+		ret = -1;
+		goto end;
+	}
+
+	link = phy.link;
+	memset(res, 0, sizeof(res));
+
+	for (i = 0; i < cfg.nr_speed; i++) {
+		struct st_result *r = &res[i];
+
+		r->speed = cfg.speed[i];
+		printf("speed %d: loopback, %u ms ...\n", r->speed, cfg.time_ms);
+
+		r->ret = st_setup(&cfg, r->speed);
+
+		if (r->ret == 0)
+			r->ret = st_window(&cfg, cfg.ifname ? &gen : NULL, r);
+
+		if (r->ret < 0) {
+			failed++;
+			continue;
+		}
+
+		line_fps = (u64)r->speed * 1000000ull / ((cfg.size + ST_WIRE_OVERHEAD) * 8);
+		r->pct = (u32)(r->fps * 100 / line_fps);
+		r->pass = r->cnt.rx_crc_err == 0 && r->cnt.tx_uflow_err == 0 &&
+			  (cfg.ifname == NULL || r->received == r->sent) &&
+			  r->fps != 0 && r->pct >= cfg.min_rate;
+		failed += !r->pass;
+	}
+
+	/* Restore */
+	if (cfg.usx)
+		gpy2xx_usxgmii_loopback_cfg(&phy, USXGMII_LOOPBACK_DISABLE);
+	else
+		gpy2xx_loopback_cfg(&phy, TLOOP_OFF);
+
+	phy.link.autoneg = link.autoneg;
+	phy.link.speed = link.speed;
+	phy.link.duplex = link.duplex;
+	phy.link.advertising = link.advertising;
+	gpy2xx_config_aneg(&phy);
+
+	st_report(&cfg, res, cfg.nr_speed);
+	printf("\n%s\n", failed ? "FAIL" : "PASS");
+	ret = failed ? -1 : 0;
+
+end:
+	if (gen.sock >= 0)
+		close(gen.sock);
+
+	if (mdio.fd >= 0)
+		close(mdio.fd);
+
+	return ret;
+}
@@ -0,0 +1,538 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Collects PHY health data on a fixed schedule and exports it.
+
+   Each metric group is polled with its own period (ms, 0 disables it), the
+   first polls of the groups are staggered over their periods so that MDIO
+   accesses are spread instead of bunched. After each round the results are
+   published to the shared-memory snapshot (see gpy2xx_telemetry.h) and,
+   if prom is given, to a Prometheus text file (node_exporter textfile
+   collector format), replaced atomically.
+
+   MDIO load is set here once; consumers read the snapshot instead of
+   calling the CLI.
+
+   gpy2xx_telemetry phyId=<n> [temp=<ms>] [link=<ms>] [errcnt=<ms>]
+                    [pcs=<ms>] [gmacf=<ms>] [bert=<ms>] [msec=<ms>]
+                    [shm=<file>] [prom=<file>] [prom_period=<ms>]
+                    [count=<n>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#include "gpy2xx_telemetry.h"
+
+#define TELEM_NSEC_PER_MSEC 1000000LL
+/* Value of the 8-bit error counter at saturation */
+#define TELEM_ERRCNT_SAT 255
+
+struct telem_cfg {
+	int phy_id;
+	u32 period_ms[GPY2XX_TELEM_GRP_NUM];
+	const char *shm;
+	const char *prom;
+	u32 prom_period_ms;
+	u32 count;
+};
+
+/* Collector state */
+struct telem {
+	struct gpy2xx_telem_data data;
+	struct gmacf_count_acc gmacf;
+	s64 next[GPY2XX_TELEM_GRP_NUM];
+	struct gpy2xx_telem_shm *shm;
+};
+
+static const char *const telem_grp_name[GPY2XX_TELEM_GRP_NUM] = {
+	"temp", "link", "errcnt", "pcs", "gmacf", "bert", "msec",
+};
+
+static struct gpy211_device phy;
+static struct gpy2xx_mdio mdio;
+static volatile sig_atomic_t telem_stop;
+
+static void telem_sig(int sig)
+{
+	(void)sig;
+	telem_stop = 1;
+}
+
+static s64 telem_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (s64)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int telem_poll_gmacf(struct telem *t)
+{
+	int ret;
+
+	ret = gpy2xx_gmacf_count_acc_update(&phy, &t->gmacf);
+
+	if (ret < 0)
+		return ret;
+
+	t->data.gmacf = t->gmacf.total;
+	t->data.gmacf_torn = t->gmacf.torn;
+
+	return 0;
+}
+
+static int telem_poll(struct telem *t, enum gpy2xx_telem_grp grp)
+{
+	int ret = 0;
+	struct gpy2xx_telem_data *d = &t->data;
+
+	switch (grp) {
+	case GPY2XX_TELEM_TEMP: {
+		struct gpy211_pvt pvt;
+
+		ret = gpy2xx_pvt_get(&phy, &pvt);
+
+		if (ret == 0)
+			d->temperature = pvt.temperature;
+
+		break;
+	}
+
+	case GPY2XX_TELEM_LINK:
+		ret = gpy2xx_read_status(&phy);
+
+		if (ret < 0)
+			break;
+
+		if (phy.link.link != d->link || phy.link.speed != d->speed)
+			d->link_changes++;
+
+		d->link = phy.link.link;
+		d->speed = phy.link.speed;
+		d->duplex = phy.link.duplex;
+		break;
+
+	case GPY2XX_TELEM_ERRCNT:
+		/* Cleared on read */
+		ret = gpy2xx_errcnt_read(&phy);
+
+		if (ret < 0)
+			break;
+
+		if (ret >= TELEM_ERRCNT_SAT)
+			d->errcnt_saturated++;
+
+		d->errcnt += (u32)ret;
+		ret = 0;
+		break;
+
+	case GPY2XX_TELEM_PCS: {
+		struct gpy211_pcs_status pcs;
+
+		/* BER and errored block counters are cleared on read */
+		ret = gpy2xx_pcs_status_read(&phy, &pcs);
+
+		if (ret < 0)
+			break;
+
+		d->pcs_ber += pcs.ber;
+		d->pcs_errored_block += pcs.errored_block;
+		d->pcs_high_ber = pcs.high_ber;
+		d->pcs_block_lock = pcs.block_lock;
+		d->pcs_rcv_link_up = pcs.rcv_link_up;
+		break;
+	}
+
+	case GPY2XX_TELEM_GMACF:
+		ret = telem_poll_gmacf(t);
+		break;
+
+	case GPY2XX_TELEM_BERT: {
+		struct gpy211_usxgmii_rx_bert_statistics bert;
+
+		/* Counters are cleared on read */
+		ret = gpy2xx_usxgmii_rx_bert_stat(&phy, &bert);
+
+		if (ret < 0)
+			break;
+
+		d->bert_tp_error += (u32)bert.tp_error_count;
+		d->bert_error_block += (u32)bert.error_block_count;
+		d->bert_ber += (u32)bert.bit_error_rate_counter;
+		break;
+	}
+
+	case GPY2XX_TELEM_MSEC:
+		ret = gpy2xx_msec_get_ing_global_stats(&phy, &d->msec_ing);
+
+		if (ret < 0)
+			break;
+
+		ret = gpy2xx_msec_get_egr_global_stats(&phy, &d->msec_egr);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	return ret;
+}
+
+static void telem_publish(struct telem *t)
+{
+	struct gpy2xx_telem_shm *shm = t->shm;
+	u32 seq;
+
+	if (shm == NULL)
+		return;
+
+	seq = shm->seq;
+	__atomic_store_n(&shm->seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy(&shm->data, &t->data, sizeof(shm->data));
+	__atomic_store_n(&shm->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+static struct gpy2xx_telem_shm *telem_map(const char *path)
+{
+	int fd;
+	void *p;
+
+	/* No O_TRUNC, readers may still map the file of a previous run */
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+
+	if (fd < 0) {
+		printf("ERROR: Could not open \"%s\"\n", path);
+		return NULL;
+	}
+
+	if (ftruncate(fd, sizeof(struct gpy2xx_telem_shm)) < 0) {
+		printf("ERROR: Could not size \"%s\"\n", path);
+		close(fd);
+		return NULL;
+	}
+
+	p = mmap(NULL, sizeof(struct gpy2xx_telem_shm), PROT_READ | PROT_WRITE,
+		 MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (p == MAP_FAILED) {
+		printf("ERROR: Could not map \"%s\"\n", path);
+		return NULL;
+	}
+
+	return p;
+}
+
+#define TELEM_PROM(f, name, type, help, fmt, val) \
+	fprintf(f, "# HELP " name " " help "\n# TYPE " name " " type "\n" \
+		name "{phy=\"%d\"} " fmt "\n", cfg->phy_id, val)
+
+static int telem_prom(const struct telem_cfg *cfg, const struct telem *t)
+{
+	const struct gpy2xx_telem_data *d = &t->data;
+	char tmp[256];
+	FILE *f;
+	int i;
+
+	snprintf(tmp, sizeof(tmp), "%s.tmp", cfg->prom);
+	f = fopen(tmp, "w");
+
+	if (f == NULL)
+		return -1;
+
+	if (d->grp[GPY2XX_TELEM_TEMP].ts)
+		TELEM_PROM(f, "gpy2xx_temperature_celsius", "gauge",
+			   "On-chip sensor temperature.", "%d", d->temperature);
+
+	if (d->grp[GPY2XX_TELEM_LINK].ts) {
+		TELEM_PROM(f, "gpy2xx_link_up", "gauge", "Link state.", "%d", d->link);
+		TELEM_PROM(f, "gpy2xx_link_speed_mbps", "gauge", "Link speed.", "%d", d->speed);
+		TELEM_PROM(f, "gpy2xx_link_changes_total", "counter",
+			   "Link state or speed changes seen.", "%u", d->link_changes);
+	}
+
+	if (d->grp[GPY2XX_TELEM_ERRCNT].ts) {
+		TELEM_PROM(f, "gpy2xx_errcnt_total", "counter",
+			   "Error/event counter (gpy2xx_errcnt_cfg source).",
+			   "%llu", (unsigned long long)d->errcnt);
+		TELEM_PROM(f, "gpy2xx_errcnt_saturated_total", "counter",
+			   "Error counter reads at saturation.", "%u", d->errcnt_saturated);
+	}
+
+	if (d->grp[GPY2XX_TELEM_PCS].ts) {
+		TELEM_PROM(f, "gpy2xx_pcs_ber_total", "counter", "PCS BER counter.",
+			   "%llu", (unsigned long long)d->pcs_ber);
+		TELEM_PROM(f, "gpy2xx_pcs_errored_blocks_total", "counter",
+			   "PCS errored blocks.", "%llu",
+			   (unsigned long long)d->pcs_errored_block);
+		TELEM_PROM(f, "gpy2xx_pcs_high_ber", "gauge", "PCS high BER.", "%u",
+			   d->pcs_high_ber);
+		TELEM_PROM(f, "gpy2xx_pcs_block_lock", "gauge", "PCS block lock.", "%u",
+			   d->pcs_block_lock);
+	}
+
+	if (d->grp[GPY2XX_TELEM_GMACF].ts) {
+		TELEM_PROM(f, "gpy2xx_gmacf_tx_packets_total", "counter",
+			   "GMAC-F good and bad Tx packets.", "%llu",
+			   (unsigned long long)d->gmacf.tx_good_bad);
+		TELEM_PROM(f, "gpy2xx_gmacf_tx_underflow_total", "counter",
+			   "GMAC-F Tx underflow errors.", "%llu",
+			   (unsigned long long)d->gmacf.tx_uflow_err);
+		TELEM_PROM(f, "gpy2xx_gmacf_rx_packets_total", "counter",
+			   "GMAC-F good and bad Rx packets.", "%llu",
+			   (unsigned long long)d->gmacf.rx_good_bad);
+		TELEM_PROM(f, "gpy2xx_gmacf_rx_crc_errors_total", "counter",
+			   "GMAC-F Rx CRC errors.", "%llu",
+			   (unsigned long long)d->gmacf.rx_crc_err);
+	}
+
+	if (d->grp[GPY2XX_TELEM_BERT].ts) {
+		TELEM_PROM(f, "gpy2xx_bert_pattern_errors_total", "counter",
+			   "USXGMII BERT test pattern errors.", "%llu",
+			   (unsigned long long)d->bert_tp_error);
+		TELEM_PROM(f, "gpy2xx_bert_errored_blocks_total", "counter",
+			   "USXGMII BERT errored blocks.", "%llu",
+			   (unsigned long long)d->bert_error_block);
+	}
+
+	if (d->grp[GPY2XX_TELEM_MSEC].ts) {
+		TELEM_PROM(f, "gpy2xx_msec_ing_transform_errors_total", "counter",
+			   "MACsec ingress transform errors.", "%llu",
+			   (unsigned long long)d->msec_ing.TransformErrorPkts);
+		TELEM_PROM(f, "gpy2xx_msec_ing_unknown_sci_total", "counter",
+			   "MACsec ingress packets with unknown SCI.", "%llu",
+			   (unsigned long long)d->msec_ing.InPktsUnknownSCI);
+		TELEM_PROM(f, "gpy2xx_msec_egr_transform_errors_total", "counter",
+			   "MACsec egress transform errors.", "%llu",
+			   (unsigned long long)d->msec_egr.TransformErrorPkts);
+	}
+
+	fprintf(f, "# HELP gpy2xx_telem_poll_errors_total Failed polls per group.\n"
+		"# TYPE gpy2xx_telem_poll_errors_total counter\n");
+
+	for (i = 0; i < GPY2XX_TELEM_GRP_NUM; i++) {
+		if (d->grp[i].period_ms)
+			fprintf(f, "gpy2xx_telem_poll_errors_total{phy=\"%d\",group=\"%s\"} %u\n",
+				cfg->phy_id, telem_grp_name[i], d->grp[i].errors);
+	}
+
+	if (fclose(f) != 0 || rename(tmp, cfg->prom) != 0) {
+		unlink(tmp);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int telem_arg(const char *arg, const char *name, const char **val)
+{
+	size_t len = strlen(name);
+
+	if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return 0;
+
+	*val = arg + len + 1;
+	return 1;
+}
+
+static int telem_parse(int argc, char *argv[], struct telem_cfg *cfg)
+{
+	int i, g;
+	const char *v;
+
+	for (i = 1; i < argc; i++) {
+		for (g = 0; g < GPY2XX_TELEM_GRP_NUM; g++) {
+			if (telem_arg(argv[i], telem_grp_name[g], &v))
+				break;
+		}
+
+		if (g < GPY2XX_TELEM_GRP_NUM) {
+			cfg->period_ms[g] = (u32)strtoul(v, NULL, 0);
+		} else if (telem_arg(argv[i], "phyId", &v)) {
+			cfg->phy_id = (int)strtol(v, NULL, 0);
+		} else if (telem_arg(argv[i], "shm", &v)) {
+			cfg->shm = v;
+		} else if (telem_arg(argv[i], "prom", &v)) {
+			cfg->prom = v;
+		} else if (telem_arg(argv[i], "prom_period", &v)) {
+			cfg->prom_period_ms = (u32)strtoul(v, NULL, 0);
+		} else if (telem_arg(argv[i], "count", &v)) {
+			cfg->count = (u32)strtoul(v, NULL, 0);
+		} else {
+			return -1;
+		}
+	}
+
+	if (cfg->phy_id < 0 || cfg->prom_period_ms == 0)
+		return -1;
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int ret, g;
+	u32 rounds = 0;
+	s64 now, start, next, next_prom;
+	struct timespec ts;
+	char shm_path[64];
+	static struct telem t;
+	struct telem_cfg cfg = {
+		.phy_id = -1,
+		.period_ms = {
+			[GPY2XX_TELEM_TEMP] = 1000,
+			[GPY2XX_TELEM_LINK] = 1000,
+			[GPY2XX_TELEM_ERRCNT] = 100,
+			[GPY2XX_TELEM_PCS] = 1000,
+			[GPY2XX_TELEM_GMACF] = 1000,
+			[GPY2XX_TELEM_BERT] = 0,
+			[GPY2XX_TELEM_MSEC] = 1000,
+		},
+		.prom_period_ms = 10000,
+	};
+
+	if (telem_parse(argc, argv, &cfg) < 0) {
+		printf("Usage: %s phyId=<n> [temp=<ms>] [link=<ms>] [errcnt=<ms>]\n"
+		       "\t[pcs=<ms>] [gmacf=<ms>] [bert=<ms>] [msec=<ms>]\n"
+		       "\t[shm=<file>] [prom=<file>] [prom_period=<ms>] [count=<n>]\n"
+		       "\tperiod 0 disables a group\n",
+		       argv[0]);
+		return -1;
+	}
+
+	ret = gpy2xx_mdio_phy_init(&phy, &mdio, cfg.phy_id);
+
+	if (ret < 0)
+		goto end;
+
+	if (!phy.macsec_supported)
+		cfg.period_ms[GPY2XX_TELEM_MSEC] = 0;
+
+	if (phy.id.family != ID_P34X)
+		cfg.period_ms[GPY2XX_TELEM_BERT] = 0;
+
+	if (cfg.period_ms[GPY2XX_TELEM_GMACF]) {
+		/* Baseline, and the longest period that catches every wrap */
+		if (cfg.period_ms[GPY2XX_TELEM_LINK])
+			gpy2xx_read_status(&phy);
+
+		ret = gpy2xx_gmacf_count_acc_init(&phy, &t.gmacf);
+
+		if (ret < 0) {
+			printf("WARN: GMAC-F counters not available (%d)\n", ret);
+			cfg.period_ms[GPY2XX_TELEM_GMACF] = 0;
+		} else if (cfg.period_ms[GPY2XX_TELEM_GMACF] > t.gmacf.poll_ms) {
+			cfg.period_ms[GPY2XX_TELEM_GMACF] = t.gmacf.poll_ms;
+		}
+	}
+
+	if (cfg.shm == NULL) {
+		snprintf(shm_path, sizeof(shm_path), "/dev/shm/gpy2xx_telem%d", cfg.phy_id);
+		cfg.shm = shm_path;
+	}
+
+	t.shm = telem_map(cfg.shm);
+
+	if (t.shm == NULL) {
+		ret = -1;
+		goto end;
+	}
+
+	t.shm->phy_addr = phy.phy_addr;
+	t.shm->version = GPY2XX_TELEM_VERSION;
+	__atomic_store_n(&t.shm->magic, GPY2XX_TELEM_MAGIC, __ATOMIC_RELEASE);
+
+	signal(SIGINT, telem_sig);
+	signal(SIGTERM, telem_sig);
+
+	/* Stagger the first polls over the periods */
+	start = telem_now();
+
+	for (g = 0; g < GPY2XX_TELEM_GRP_NUM; g++) {
+		t.data.grp[g].period_ms = cfg.period_ms[g];
+		t.next[g] = start + (s64)cfg.period_ms[g] * TELEM_NSEC_PER_MSEC * g /
+			    GPY2XX_TELEM_GRP_NUM;
+	}
+
+	next_prom = start;
+
+	while (!telem_stop) {
+		now = telem_now();
+
+		for (g = 0; g < GPY2XX_TELEM_GRP_NUM; g++) {
+			struct gpy2xx_telem_grp_stat *st = &t.data.grp[g];
+			s64 period = (s64)cfg.period_ms[g] * TELEM_NSEC_PER_MSEC;
+			s64 t0;
+
+			if (!period || now < t.next[g])
+				continue;
+
+			t0 = telem_now();
+			st->last_ret = telem_poll(&t, g);
+			st->last_us = (u32)((telem_now() - t0) / 1000);
+			st->polls++;
+
+			if (st->last_ret < 0)
+				st->errors++;
+			else
+				st->ts = (u64)t0;
+
+			t.next[g] += period;
+
+			/* Keep the phase, skip the missed slots */
+			if (t.next[g] <= now) {
+				st->overruns++;
+				t.next[g] += ((now - t.next[g]) / period + 1) * period;
+			}
+		}
+
+		t.data.ts = (u64)telem_now();
+		telem_publish(&t);
+
+		if (cfg.prom != NULL && now >= next_prom) {
+			if (telem_prom(&cfg, &t) < 0)
+				printf("WARN: Could not write \"%s\"\n", cfg.prom);
+
+			next_prom = now + (s64)cfg.prom_period_ms * TELEM_NSEC_PER_MSEC;
+		}
+
+		if (cfg.count && ++rounds >= cfg.count)
+			break;
+
+		next = cfg.prom != NULL ? next_prom : 0;
+
+		for (g = 0; g < GPY2XX_TELEM_GRP_NUM; g++) {
+			if (cfg.period_ms[g] && (next == 0 || t.next[g] < next))
+				next = t.next[g];
+		}
+
+		if (next == 0)
+			break;
+
+		ts.tv_sec = next / 1000000000LL;
+		ts.tv_nsec = next % 1000000000LL;
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+	}
+
+	ret = 0;
+
+end:
+
+	if (mdio.fd >= 0)
+		close(mdio.fd);
+
+	return ret;
+}
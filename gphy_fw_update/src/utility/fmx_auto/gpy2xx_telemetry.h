@@ -0,0 +1,139 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+#ifndef _GPY2XX_TELEMETRY_H_
+#define _GPY2XX_TELEMETRY_H_
+
+#include <string.h>
+#include <errno.h>
+
+#include "gpy2xx_mdio.h"
+
+/* Shared-memory export of gpy2xx_telemetry.
+
+   The collector is the only writer of the file it maps (default
+   /dev/shm/gpy2xx_telem<phyId>). Consumers map the same file read-only and
+   take a consistent copy with gpy2xx_telem_snapshot, no MDIO access and no
+   lock are involved. The snapshot is guarded by a sequence counter: odd
+   while an update is in progress, incremented by 2 per update.
+
+   Counters are 64-bit totals since the collector started. Hardware
+   counters cleared on read are summed, the free-running GMAC-F counters
+   are extended with gpy2xx_gmacf_count_acc_update. */
+
+#define GPY2XX_TELEM_MAGIC 0x47543243 /* "GT2C" */
+#define GPY2XX_TELEM_VERSION 1
+
+/* Metric groups, each polled with its own period */
+enum gpy2xx_telem_grp {
+	GPY2XX_TELEM_TEMP = 0,
+	GPY2XX_TELEM_LINK,
+	GPY2XX_TELEM_ERRCNT,
+	GPY2XX_TELEM_PCS,
+	GPY2XX_TELEM_GMACF,
+	GPY2XX_TELEM_BERT,
+	GPY2XX_TELEM_MSEC,
+	GPY2XX_TELEM_GRP_NUM,
+};
+
+/* Poll statistics of a group */
+struct gpy2xx_telem_grp_stat {
+	/* Monotonic time of the last successful poll in ns, 0 if never */
+	u64 ts;
+	/* Poll period in ms, 0 if disabled */
+	u32 period_ms;
+	u32 polls;
+	u32 errors;
+	/* Polls started late by more than one period */
+	u32 overruns;
+	/* Duration of the last poll in us */
+	u32 last_us;
+	/* Result of the last poll */
+	int last_ret;
+};
+
+struct gpy2xx_telem_data {
+	/* Monotonic time of the update in ns */
+	u64 ts;
+	struct gpy2xx_telem_grp_stat grp[GPY2XX_TELEM_GRP_NUM];
+
+	/* GPY2XX_TELEM_TEMP */
+	int temperature;
+
+	/* GPY2XX_TELEM_LINK */
+	int link;
+	int speed;
+	int duplex;
+	u32 link_changes;
+
+	/* GPY2XX_TELEM_ERRCNT, source set by gpy2xx_errcnt_cfg */
+	u64 errcnt;
+	/* Reads of the 8-bit counter at saturation, errcnt is a lower bound */
+	u32 errcnt_saturated;
+
+	/* GPY2XX_TELEM_PCS */
+	u64 pcs_ber;
+	u64 pcs_errored_block;
+	u8 pcs_high_ber;
+	u8 pcs_block_lock;
+	u8 pcs_rcv_link_up;
+
+	/* GPY2XX_TELEM_GMACF */
+	struct gmacf_counters64 gmacf;
+	/* Corrected torn counter reads */
+	u32 gmacf_torn;
+
+	/* GPY2XX_TELEM_BERT */
+	u64 bert_tp_error;
+	u64 bert_error_block;
+	u64 bert_ber;
+
+	/* GPY2XX_TELEM_MSEC */
+	struct ing_global_stats msec_ing;
+	struct egr_global_stats msec_egr;
+};
+
+struct gpy2xx_telem_shm {
+	u32 magic;
+	u32 version;
+	u32 phy_addr;
+	/* Sequence counter, odd while data is updated */
+	u32 seq;
+	struct gpy2xx_telem_data data;
+};
+
+/* Copy a consistent snapshot, retried while the collector updates it.
+   Returns 0, -EAGAIN if no consistent copy in retries attempts, or
+   -EINVAL if shm is not a collector export */
+static inline int gpy2xx_telem_snapshot(const struct gpy2xx_telem_shm *shm,
+					struct gpy2xx_telem_data *data,
+					u32 retries)
+{
+	u32 s0, s1;
+
+	if (shm->magic != GPY2XX_TELEM_MAGIC ||
+	    shm->version != GPY2XX_TELEM_VERSION)
+		return -EINVAL;
+
+	do {
+		s0 = __atomic_load_n(&shm->seq, __ATOMIC_ACQUIRE);
+
+		if (s0 & 1)
+			continue;
+
+		memcpy(data, (const void *)&shm->data, sizeof(*data));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		s1 = __atomic_load_n(&shm->seq, __ATOMIC_RELAXED);
+
+		if (s0 == s1)
+			return 0;
+	} while (retries--);
+
+	return -EAGAIN;
+}
+
+#endif /* _GPY2XX_TELEMETRY_H_ */
@@ -35,10 +35,21 @@ ALL_INC="-I../../src/os/linux -I${GPY211_INC}"
 #echo ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c "${PHY_SRC}/gpy211_phy.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_phy_static.o "${PHY_SRC}/gpy211_phy.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_chip_static.o "${PHY_SRC}/gpy211_chip.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_ptp_static.o "${PHY_SRC}/gpy211_ptp.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_mon_static.o "${PHY_SRC}/gpy211_mon.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_static.o "${MACSEC_SRC}/gpy211_macsec.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_harvest_static.o "${MACSEC_SRC}/gpy211_macsec_harvest.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_rekey_static.o "${MACSEC_SRC}/gpy211_macsec_rekey.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_aes_static.o "${MACSEC_SRC}/gpy211_macsec_aes.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_alloc_static.o "${MACSEC_SRC}/gpy211_macsec_alloc.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_sw_static.o "${MACSEC_SRC}/gpy211_macsec_sw.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy211_macsec_pol_static.o "${MACSEC_SRC}/gpy211_macsec_pol.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy2xx_mdio_static.o "gpy2xx_mdio.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy2xx_mgr_static.o "gpy2xx_mgr.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy2xx_regmap_static.o "gpy2xx_regmap.c"
+${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -o gpy2xx_regmap_tab_static.o "gpy2xx_regmap_tab.c"
 ${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -pie -fstack-protector-all -I${DDKAES_INC} ${ALL_INC} -c -o aes_static.o "${DDKAES_SRC}/aes.c"
-${AR} rcs libgpy2xx_static.a gpy211_phy_static.o gpy211_chip_static.o gpy211_macsec_static.o gpy2xx_mdio_static.o aes_static.o
+${AR} rcs libgpy2xx_static.a gpy211_phy_static.o gpy211_chip_static.o gpy211_ptp_static.o gpy211_mon_static.o gpy211_macsec_static.o gpy211_macsec_harvest_static.o gpy211_macsec_rekey_static.o gpy211_macsec_aes_static.o gpy211_macsec_alloc_static.o gpy211_macsec_sw_static.o gpy211_macsec_pol_static.o gpy2xx_mdio_static.o gpy2xx_mgr_static.o gpy2xx_regmap_static.o gpy2xx_regmap_tab_static.o aes_static.o
 
 #dynamic library creation
 #${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-all ${ALL_INC} -c -fPIC -o gpy211_phy.o "${PHY_SRC}/gpy211_phy.c"
@@ -49,7 +60,15 @@ ${AR} rcs libgpy2xx_static.a gpy211_phy_static.o gpy211_chip_static.o gpy211_mac
 #${GCC} -shared -o libgpy2xx_dynamic.so gpy211_phy.o gpy211_chip.o gpy211_macsec.o aes.o
 
 if [[ "lib" != "$1" ]]; then
-	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_cli.c -L. -lgpy2xx_static -o gpy2xx_cli
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_cli.c -L. -lgpy2xx_static -lpthread -o gpy2xx_cli
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_ptp_servo.c -L. -lgpy2xx_static -lm -lpthread -o gpy2xx_ptp_servo
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_telemetry.c -L. -lgpy2xx_static -lm -lpthread -o gpy2xx_telemetry
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_eq_opt.c -L. -lgpy2xx_static -lm -lpthread -o gpy2xx_eq_opt
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_cdiag_sched.c -L. -lgpy2xx_static -lpthread -o gpy2xx_cdiag_sched
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_bm_tune.c -L. -lgpy2xx_static -lpthread -o gpy2xx_bm_tune
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_power.c -L. -lgpy2xx_static -lpthread -o gpy2xx_power
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong ${ALL_INC} gpy2xx_selftest.c -L. -lgpy2xx_static -lpthread -o gpy2xx_selftest
+	${GCC} ${UART_FLAG} ${OPTINAL_TFLAGS} -Wall -fstack-protector-strong -I${DDKAES_INC} ${ALL_INC} gpy2xx_aes_check.c -L. -lgpy2xx_static -lpthread -o gpy2xx_aes_check
 fi
 
 rm -f *.o *.a
@@ -0,0 +1,146 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Measures the software MACsec engine throughput per cipher suite and frame
+   size, to size how many SAs can be offloaded to software.
+
+   gpy2xx_msec_bench [frames=<n>] [size=<bytes>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_sw.h"
+
+#define BENCH_DEF_FRAMES 200000
+#define BENCH_MAX_FRAME 9000
+
+static const u32 bench_sizes[] = {64, 512, 1500};
+
+static const char *const bench_ca_name[] = {
+	"", "GCM-AES-128", "GCM-AES-256", "GCM-AES-XPN-128", "GCM-AES-XPN-256"
+};
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void bench_report(const char *op, enum crypto_algorithm ca, u32 size,
+			 u32 frames, double sec)
+{
+	double pps = frames / sec;
+
+	printf("%-16s %-4s %5u B  %8.3f Mpps  %8.3f Gbit/s\n",
+	       bench_ca_name[ca], op, size, pps / 1e6, pps * size * 8 / 1e9);
+}
+
+static int bench_one(enum crypto_algorithm ca, u32 size, u32 frames)
+{
+	u32 i;
+	int n = 0, m;
+	double t0;
+	struct transform_rec tr;
+	struct msec_sw_sa egr, ing;
+	static u8 frame[BENCH_MAX_FRAME], enc[BENCH_MAX_FRAME + MSEC_SW_MAX_OVERHEAD],
+	       dec[BENCH_MAX_FRAME + MSEC_SW_MAX_OVERHEAD];
+
+	memset(&tr, 0, sizeof(tr));
+	tr.ccw.ca_type = ca;
+
+	for (i = 0; i < sizeof(tr.cp.key); i++)
+		tr.cp.key[i] = (u8)(i * 7 + 1);
+
+	for (i = 0; i < MACSEC_SCI_LEN_BYTE; i++)
+		tr.cp.sci[i] = (u8)(0x10 + i);
+
+	for (i = 0; i < size; i++)
+		frame[i] = (u8)i;
+
+	/* Window covers the whole run, frames are replayed */
+	tr.pn_rc.mask = 0xFFFFFFFF;
+
+	if (gpy2xx_msec_sw_sa_init(&egr, EGRESS_DIR, &tr, NULL) < 0 ||
+	    gpy2xx_msec_sw_sa_init(&ing, INGRESS_DIR, &tr, NULL) < 0)
+		return -1;
+
+	t0 = bench_now();
+
+	for (i = 0; i < frames; i++) {
+		n = gpy2xx_msec_sw_encrypt(&egr, frame, size, enc, sizeof(enc));
+
+		if (n < 0)
+			return n;
+	}
+
+	bench_report("enc", ca, size, frames, bench_now() - t0);
+
+	t0 = bench_now();
+
+	for (i = 0; i < frames; i++) {
+		m = gpy2xx_msec_sw_decrypt(&ing, enc, (u32)n, dec, sizeof(dec));
+
+		if (m < 0)
+			return m;
+	}
+
+	bench_report("dec", ca, size, frames, bench_now() - t0);
+
+	if (memcmp(dec, frame, size) != 0) {
+		printf("ERROR: Decrypted frame mismatch\n");
+		return -1;
+	}
+
+	gpy2xx_msec_sw_sa_clear(&egr);
+	gpy2xx_msec_sw_sa_clear(&ing);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int i, ret;
+	u32 j, frames = BENCH_DEF_FRAMES, size = 0;
+	enum crypto_algorithm ca;
+
+	for (i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "frames=", 7) == 0) {
+			frames = (u32)strtoul(argv[i] + 7, NULL, 0);
+		} else if (strncmp(argv[i], "size=", 5) == 0) {
+			size = (u32)strtoul(argv[i] + 5, NULL, 0);
+		} else {
+			printf("Usage: %s [frames=<n>] [size=<14~%u>]\n", argv[0], BENCH_MAX_FRAME);
+			return -1;
+		}
+	}
+
+	if ((frames == 0) || (size != 0 && (size < 14 || size > BENCH_MAX_FRAME))) {
+		printf("ERROR: Invalid frames/size\n");
+		return -1;
+	}
+
+	for (ca = GCM_AES_128; ca <= GCM_AES_XPN_256; ca++) {
+		for (j = 0; j < sizeof(bench_sizes) / sizeof(bench_sizes[0]); j++) {
+			ret = bench_one(ca, size ? size : bench_sizes[j], frames);
+
+			if (ret < 0) {
+				printf("ERROR: %s failed (%d)\n", bench_ca_name[ca], ret);
+				return ret;
+			}
+
+			if (size)
+				break;
+		}
+	}
+
+	return 0;
+}
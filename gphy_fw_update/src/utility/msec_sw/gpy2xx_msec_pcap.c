@@ -0,0 +1,336 @@
+/******************************************************************************
+         Copyright 2020 - 2021 MaxLinear Inc.
+
+  SPDX-License-Identifier: (BSD-3-Clause OR GPL-2.0-only)
+
+******************************************************************************/
+
+/* Encrypts or decrypts the frames of a pcap capture with the software MACsec
+   engine, e.g. to check a capture taken on the line side of the PHY.
+
+   gpy2xx_msec_pcap mode=<enc|dec> in=<file> out=<file> key=<hex>
+		    [sci=<16 hex>] [an=<0~3>] [pn=<n>] [ca_type=<1~4>]
+		    [salt=<24 hex>] [ssci=<8 hex>] [encrypt=<0|1>]
+		    [include_sci=<0|1>] [conf_offset=<n>] [window=<n>]
+		    [validate=<0~2>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gpy211_common.h"
+#include "gpy211_macsec_sw.h"
+
+#define PCAP_MAGIC 0xA1B2C3D4
+#define PCAP_MAGIC_NS 0xA1B23C4D
+#define PCAP_LINKTYPE_ETHERNET 1
+#define PCAP_MAX_FRAME 16384
+
+struct pcap_file_hdr {
+	u32 magic;
+	u16 ver_major;
+	u16 ver_minor;
+	s32 thiszone;
+	u32 sigfigs;
+	u32 snaplen;
+	u32 linktype;
+};
+
+struct pcap_rec_hdr {
+	u32 ts_sec;
+	u32 ts_frac;
+	u32 incl_len;
+	u32 orig_len;
+};
+
+static u8 swapped;
+
+static u32 pcap_u32(u32 val)
+{
+	if (!swapped)
+		return val;
+
+	return ((val & 0xFF) << 24) | ((val & 0xFF00) << 8) |
+	       ((val >> 8) & 0xFF00) | (val >> 24);
+}
+
+static char *find_arg(int argc, char *argv[], const char *name)
+{
+	int i;
+	size_t len = strlen(name);
+
+	for (i = 1; i < argc; i++) {
+		if (strncmp(argv[i], name, len) == 0 && argv[i][len] == '=')
+			return argv[i] + len + 1;
+	}
+
+	return NULL;
+}
+
+static int scan_num(int argc, char *argv[], const char *name, u64 *val)
+{
+	char *endptr;
+	char *ptr = find_arg(argc, argv, name);
+
+	if (ptr == NULL)
+		return 0;
+
+	*val = strtoull(ptr, &endptr, 0);
+
+	if (*endptr != '\0') {
+		printf("ERROR: Invalid number \"%s\" for %s\n", ptr, name);
+		return -1;
+	}
+
+	return 1;
+}
+
+/* Hex string (optionally 0x prefixed) in wire order */
+static int scan_hex(int argc, char *argv[], const char *name, u8 *buf, u32 size)
+{
+	u32 i;
+	char tmp[3] = {0};
+	char *endptr;
+	char *ptr = find_arg(argc, argv, name);
+
+	if (ptr == NULL)
+		return 0;
+
+	if (strncmp(ptr, "0x", 2) == 0 || strncmp(ptr, "0X", 2) == 0)
+		ptr += 2;
+
+	if (strlen(ptr) != size * 2) {
+		printf("ERROR: %s needs %u hex digits\n", name, size * 2);
+		return -1;
+	}
+
+	for (i = 0; i < size; i++) {
+		tmp[0] = ptr[2 * i];
+		tmp[1] = ptr[2 * i + 1];
+		buf[i] = (u8)strtoul(tmp, &endptr, 16);
+
+		if (*endptr != '\0') {
+			printf("ERROR: Invalid hex string for %s\n", name);
+			return -1;
+		}
+	}
+
+	return 1;
+}
+
+static void usage(const char *prog)
+{
+	printf("Usage: %s mode=<enc|dec> in=<pcap> out=<pcap> key=<hex>\n"
+	       "\t[sci=<16 hex>] [an=<0~3>] [pn=<n>] [ca_type=<1:GCM_AES_128 2:GCM_AES_256 3:GCM_AES_XPN_128 4:GCM_AES_XPN_256>]\n"
+	       "\t[salt=<24 hex>] [ssci=<8 hex>] [encrypt=<0|1>] [include_sci=<0|1>]\n"
+	       "\t[conf_offset=<n>] [window=<n>] [validate=<0:disabled 1:check 2:strict>]\n",
+	       prog);
+}
+
+int main(int argc, char *argv[])
+{
+	int ret = -1, n, enc;
+	u64 val;
+	u32 keylen, incl, nr_in = 0, nr_out = 0, nr_skip = 0, nr_err = 0;
+	char *mode, *in_name, *out_name;
+	FILE *fin = NULL, *fout = NULL;
+	struct pcap_file_hdr fhdr;
+	struct pcap_rec_hdr rhdr;
+	struct transform_rec tr;
+	struct sa_match_fca fca;
+	struct msec_sw_sa sa;
+	static u8 frame[PCAP_MAX_FRAME], res[PCAP_MAX_FRAME + MSEC_SW_MAX_OVERHEAD];
+
+	mode = find_arg(argc, argv, "mode");
+	in_name = find_arg(argc, argv, "in");
+	out_name = find_arg(argc, argv, "out");
+
+	if (mode == NULL || in_name == NULL || out_name == NULL) {
+		usage(argv[0]);
+		return -1;
+	}
+
+	enc = (strcmp(mode, "enc") == 0);
+
+	if (!enc && strcmp(mode, "dec") != 0) {
+		usage(argv[0]);
+		return -1;
+	}
+
+	memset(&tr, 0, sizeof(tr));
+	memset(&fca, 0, sizeof(fca));
+	tr.ccw.ca_type = GCM_AES_128;
+	fca.conf_protect = 1;
+	fca.include_sci = 1;
+	fca.validate_frames = SAM_FCA_VALIDATE_STRICT;
+	fca.replay_protect = 1;
+
+	if (scan_num(argc, argv, "ca_type", &val) < 0)
+		return -1;
+	else if (find_arg(argc, argv, "ca_type") != NULL)
+		tr.ccw.ca_type = (enum crypto_algorithm)val;
+
+	keylen = ((tr.ccw.ca_type == GCM_AES_128) ||
+		  (tr.ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32;
+
+	if (scan_hex(argc, argv, "key", tr.cp.key, keylen) <= 0) {
+		printf("ERROR: key=<%u hex digits> missing\n", keylen * 2);
+		return -1;
+	}
+
+	if ((scan_hex(argc, argv, "sci", tr.cp.sci, MACSEC_SCI_LEN_BYTE) < 0) ||
+	    (scan_hex(argc, argv, "salt", tr.cp.c_salt.salt, MACSEC_SALT_LEN_BYTE) < 0) ||
+	    (scan_hex(argc, argv, "ssci", tr.cp.c_salt.s_sci, MACSEC_SSCI_LEN_BYTE) < 0))
+		return -1;
+
+	if (scan_num(argc, argv, "an", &val) > 0)
+		tr.ccw.an = (u8)val;
+
+	if (scan_num(argc, argv, "pn", &val) > 0)
+		tr.pn_rc.seq_num = val;
+
+	if (scan_num(argc, argv, "window", &val) > 0)
+		tr.pn_rc.mask = (u32)val;
+
+	if (scan_num(argc, argv, "encrypt", &val) > 0)
+		fca.conf_protect = (u8)val;
+
+	if (scan_num(argc, argv, "include_sci", &val) > 0)
+		fca.include_sci = (u8)val;
+
+	if (scan_num(argc, argv, "conf_offset", &val) > 0)
+		fca.conf_offset = (u8)val;
+
+	if (scan_num(argc, argv, "validate", &val) > 0)
+		fca.validate_frames = (enum sam_fca_fvt)val;
+
+	if (gpy2xx_msec_sw_sa_init(&sa, enc ? EGRESS_DIR : INGRESS_DIR, &tr, &fca) < 0) {
+		printf("ERROR: Invalid SA parameters\n");
+		return -1;
+	}
+
+	fin = fopen(in_name, "rb");
+
+	if (fin == NULL) {
+		printf("ERROR: Cannot open %s\n", in_name);
+		goto END;
+	}
+
+	if (fread(&fhdr, sizeof(fhdr), 1, fin) != 1) {
+		printf("ERROR: %s is not a pcap file\n", in_name);
+		goto END;
+	}
+
+	if (fhdr.magic == PCAP_MAGIC || fhdr.magic == PCAP_MAGIC_NS) {
+		swapped = 0;
+	} else {
+		swapped = 1;
+
+		if (pcap_u32(fhdr.magic) != PCAP_MAGIC &&
+		    pcap_u32(fhdr.magic) != PCAP_MAGIC_NS) {
+			printf("ERROR: %s is not a pcap file (pcapng is not supported)\n", in_name);
+			goto END;
+		}
+	}
+
+	if (pcap_u32(fhdr.linktype) != PCAP_LINKTYPE_ETHERNET) {
+		printf("ERROR: Link type %u is not Ethernet\n", pcap_u32(fhdr.linktype));
+		goto END;
+	}
+
+	fout = fopen(out_name, "wb");
+
+	if (fout == NULL) {
+		printf("ERROR: Cannot create %s\n", out_name);
+		goto END;
+	}
+
+	/* Keep byte order and timestamp resolution of the input */
+	fhdr.snaplen = pcap_u32(PCAP_MAX_FRAME + MSEC_SW_MAX_OVERHEAD);
+
+	if (fwrite(&fhdr, sizeof(fhdr), 1, fout) != 1)
+		goto END;
+
+	while (fread(&rhdr, sizeof(rhdr), 1, fin) == 1) {
+		incl = pcap_u32(rhdr.incl_len);
+
+		if (incl > PCAP_MAX_FRAME) {
+			printf("ERROR: Frame %u too long (%u)\n", nr_in + 1, incl);
+			goto END;
+		}
+
+		if (fread(frame, 1, incl, fin) != incl) {
+			printf("ERROR: Truncated frame %u\n", nr_in + 1);
+			goto END;
+		}
+
+		nr_in++;
+
+		if (incl != pcap_u32(rhdr.orig_len)) {
+			/* Snapped frames cannot be processed, pass through */
+			nr_skip++;
+			n = (int)incl;
+			memcpy(res, frame, incl);
+		} else if (enc) {
+			n = gpy2xx_msec_sw_encrypt(&sa, frame, incl, res, sizeof(res));
+		} else if (incl < 14 || frame[12] != (MSEC_SW_ETHERTYPE >> 8) ||
+			   frame[13] != (MSEC_SW_ETHERTYPE & 0xFF)) {
+			/* Uncontrolled port traffic */
+			nr_skip++;
+			n = (int)incl;
+			memcpy(res, frame, incl);
+		} else {
+			n = gpy2xx_msec_sw_decrypt(&sa, frame, incl, res, sizeof(res));
+		}
+
+		if (n < 0) {
+			nr_err++;
+
+			if (n == -EOVERFLOW) {
+				printf("ERROR: PN exhausted at frame %u\n", nr_in);
+				break;
+			}
+
+			continue;
+		}
+
+		rhdr.incl_len = pcap_u32((u32)n);
+		rhdr.orig_len = rhdr.incl_len;
+
+		if (fwrite(&rhdr, sizeof(rhdr), 1, fout) != 1 ||
+		    fwrite(res, 1, (size_t)n, fout) != (size_t)n) {
+			printf("ERROR: Cannot write %s\n", out_name);
+			goto END;
+		}
+
+		nr_out++;
+	}
+
+	printf("frames in:          %u\n", nr_in);
+	printf("frames out:         %u\n", nr_out);
+	printf("passed through:     %u\n", nr_skip);
+	printf("dropped:            %u\n", nr_err);
+	printf("ok:                 %llu\n", (unsigned long long)sa.stats.pkts_ok);
+	printf("octets:             %llu\n", (unsigned long long)sa.stats.octets);
+
+	if (!enc) {
+		printf("invalid:            %llu\n", (unsigned long long)sa.stats.pkts_invalid);
+		printf("late:               %llu\n", (unsigned long long)sa.stats.pkts_late);
+		printf("bad tag:            %llu\n", (unsigned long long)sa.stats.pkts_bad_tag);
+		printf("not using SA:       %llu\n", (unsigned long long)sa.stats.pkts_not_using_sa);
+	}
+
+	printf("next PN:            %llu\n", (unsigned long long)sa.next_pn);
+	ret = 0;
+
+END:
+	if (fin != NULL)
+		fclose(fin);
+
+	if (fout != NULL)
+		fclose(fout);
+
+	gpy2xx_msec_sw_sa_clear(&sa);
+	return ret;
+}
@@ -0,0 +1,24 @@
+#!/bin/bash
+
+if [[ "clean" = "$1" ]]; then
+	rm -f *.o gpy2xx_msec_pcap gpy2xx_msec_bench
+	exit 0
+fi
+
+# Host tools by default, override COMPILER_PREFIX for target builds
+COMPILER_PREFIX=${COMPILER_PREFIX:-}
+GCC="${COMPILER_PREFIX}gcc"
+
+PC_TOOL=`pwd`/../..
+GPY211_INC=${PC_TOOL}/src/inc
+MACSEC_SRC=${PC_TOOL}/src/api/macsec
+
+ALL_INC="-I../../src/os/linux -I${GPY211_INC}"
+CFLAGS="-O2 -Wall -fstack-protector-strong"
+
+${GCC} ${CFLAGS} ${ALL_INC} -c -o gpy211_macsec_aes.o "${MACSEC_SRC}/gpy211_macsec_aes.c"
+${GCC} ${CFLAGS} ${ALL_INC} -c -o gpy211_macsec_sw.o "${MACSEC_SRC}/gpy211_macsec_sw.c"
+${GCC} ${CFLAGS} ${ALL_INC} gpy2xx_msec_pcap.c gpy211_macsec_aes.o gpy211_macsec_sw.o -o gpy2xx_msec_pcap
+${GCC} ${CFLAGS} ${ALL_INC} gpy2xx_msec_bench.c gpy211_macsec_aes.o gpy211_macsec_sw.o -o gpy2xx_msec_bench
+
+rm -f *.o
@@ -11,6 +11,8 @@
 
 #include <windows.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <signal.h>
 #include <gpy211.h>
@@ -295,2878 +297,3771 @@ static int split_buffer(char *buffer, char *array[], int max_param_num)
 	return res;
 }
 
-static struct {
-	const char *cmd;
-	const char *brief;
-	const char *desc;
-} help_text[] = {
-	{
-		"exit",
-		"Exit GPY211 utility tool",
-		NULL
-	},
-	{
-		"help",
-		"Print this help page",
-		NULL
-	},
-	{
-		"en_debug",
-		"Enable debugging codes",
-		"en_debug <option>\n"
-		"  option: 0 - disable, 1 -enable\n"
-	},
-	{
-		"gpy2xx_init",
-		"Initialize GPY211 API",
-		NULL
-	},
-	{
-		"gpy2xx_uninit",
-		"Clean up GPY211 API",
-		NULL
-	},
-	{
-		"gpy2xx_get_phy_id",
-		"Read PHY/Chip/Firmware/Driver version number",
-		NULL
-	},
-	{
-		"gpy2xx_soft_reset",
-		"Trigger soft reset via MDIO STD_CTRL",
-		NULL
-	},
-	{
-		"gpy2xx_poll_reset",
-		"Poll soft reset status",
-		NULL
-	},
-#if defined(EN_SMDIO_RW) && EN_SMDIO_RW
-	{
-		"smdio_read",
-		"Read internal register (may be disabled by PHY firmware)",
-		"smdio_read <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"smdio_write",
-		"Write internal register (may be disabled by PHY firmware)",
-		"smdio_write <regaddr=?> <data=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-#endif
-	{
-		"gpy2xx_read",
-		"Read MDIO Clause 22 registers",
-		"gpy2xx_read <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_write",
-		"Write MDIO Clause 22 registers",
-		"gpy2xx_write <regaddr=?> <data=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_read_mmd",
-		"Read MDIO Clause 45 MMD registers",
-		"gpy2xx_read_mmd <devtype=?> <regaddr=?>\n"
-		"  devtype: MMD device type\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_write_mmd",
-		"Write MDIO Clause 45 MMD registers",
-		"gpy2xx_write_mmd <devtype=?> <regaddr=?> <data=?>\n"
-		"  devtype: MMD device type\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-#if defined(P31G_IND_RW) && P31G_IND_RW
-	{
-		"pm_ind_read",
-		"PM's indirect register read",
-		"pm_ind_read <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"pm_ind_write",
-		"PM's indirect register write",
-		"pm_ind_write <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-#endif
-	{
-		"gpy2xx_mbox_read16",
-		"PHY's Mbox 16-bit wide register read",
-		"gpy2xx_mbox_read16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_mbox_write16",
-		"PHY's Mbox 16-bit wide register write",
-		"gpy2xx_mbox_write16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_mbox_read32",
-		"PHY's Mbox 32-bit wide register read",
-		"gpy2xx_mbox_read32 <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_mbox_write32",
-		"PHY's Mbox 32-bit wide register write",
-		"gpy2xx_mbox_write32 <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_xpcs_read16",
-		"PHY's XPCS 16-bit wide register read",
-		"gpy2xx_xpcs_read16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-	},
-	{
-		"gpy2xx_xpcs_write16",
-		"PHY's XPCS 16-bit wide register write",
-		"gpy2xx_xpcs_write16 <regaddr=?>\n"
-		"  regaddr: register address\n"
-		"  data:    value\n"
-	},
-	{
-		"gpy2xx_config_advert",
-		"Advertise auto-negotiation parameters",
-		"gpy2xx_config_advert <advertising=?>\n"
-		"  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n"
-		"               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n"
-		"               Autoneg|Pause|Asym_Pause\n"
-	},
-	{
-		"gpy2xx_setup_forced",
-		"Configures/forces speed/duplex",
-		"gpy2xx_setup_forced <speed=?> <duplex=?> <pause=?> <asym_pause=?> <mstr_slave=?>\n"
-		"  speed:      10/100/1000/2500\n"
-		"  duplex:     full/half\n"
-		"  pause:      true/false\n"
-		"  asym_pause: true/false\n"
-		"  mstr_slave: true/false\n"
-	},
-	{
-		"gpy2xx_restart_aneg",
-		"Enable and restart auto-negotiation",
-		NULL
-	},
-	{
-		"gpy2xx_config_aneg",
-		"Restart auto-negotiation or force link",
-		"gpy2xx_config_aneg <autoneg=?> [advertising=?] [<speed=?> <duplex=?> <pause=?> <asym_pause=?>]\n"
-		"  autoneg:     true/false\n"
-		"  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n"
-		"               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n"
-		"               Autoneg|Pause|Asym_Pause\n"
-		"  speed:       10/100/1000/2500\n"
-		"  duplex:      full/half\n"
-		"  pause:       true/false\n"
-		"  asym_pause:  true/false\n"
-	},
-	{
-		"gpy2xx_aneg_done",
-		"Get auto-negotiation status",
-		NULL
-	},
-	{
-		"gpy2xx_update_link",
-		"Get link status (up/down)",
-		NULL
-	},
-	{
-		"gpy2xx_read_status",
-		"Get link status (detail)",
-		NULL
-	},
-	{
-		"gpy2xx_read_fw_info",
-		"Get FW info (detail)",
-		NULL
-	},
-	{
-		"gpy2xx_gpio_cfg",
-		"Configure GPIO pin",
-		"For internal use.\n"
-		"gpy2xx_gpio_cfg <pinid=?> <gpioflags=?>\n"
-		"  pinid:     16-bit pin ID\n"
-		"  gpioflags: GPIO configuration flags\n"
-	},
-	{
-		"gpy2xx_gpio_get",
-		"Get GPIO pin configuration",
-		"For internal use.\n"
-		"gpy2xx_gpio_get <pinid=?>\n"
-		"  pinid:     16-bit pin ID\n"
-	},
-	{
-		"gpy2xx_gpio_output",
-		"Configure GPIO pin output value (low/high)",
-		"For internal use.\n"
-		"gpy2xx_gpio_output <pinid=?> <gpioflags=?>\n"
-		"  pinid:     16-bit pin ID\n"
-		"  gpioflags: 0 - low, 2 - high\n"
-	},
-	{
-		"gpy2xx_gpio_input",
-		"Get GPIO pin input value (low/high)",
-		"For internal use.\n"
-		"gpy2xx_gpio_input <pinid=?>\n"
-		"  pinid:     16-bit pin ID\n"
-	},
-	{
-		"gpy2xx_led_br_cfg",
-		"Configure LED brightness",
-		"For internal use.\n"
-		"gpy2xx_led_br_cfg <brightMode=?> <brightlvlMin=?> <brightlvlMax=?> <swEdgeDetect=?>\n"
-		"  brightMode: 0 - constant level at max brightness\n"
-		"              1 - constant level given by brightlvlmax\n"
-		"  brightlvlMin: (0 to 15) - min level of brightness\n"
-		"  brightlvlMax: (0 to 15) - max level of brightness\n"
-		"  swEdgeDetect: 0 - LED switch edge detection on falling edge\n"
-		"				 1 - LED switch edge detection on rising edge\n"
-	},
-	{
-		"gpy2xx_led_br_get",
-		"Get LED brightness configuration",
-		"For internal use.\n"
-	},
-#if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
-	{
-		"gpy2xx_led_top_cfg",
-		"LED general configuration",
-		"For internal use.\n"
-		"gpy2xx_led_top_cfg <complexscan=?> <complexblink=?> <inversescan=?> <fastblinkfreq=?> <slowblinkfreq=?>\n"
-		"  complexscan:  in which state the 'inverse complex SCAN' is activated, refer to below state table\n"
-		"  complexblink: in which state the 'complex blinking' is activated, refer to below state table\n"
-		"  inversescan:  in which state the 'complex SCAN' is activated, refer to below state table\n"
-		"  fastblinkfreq:the slow-blinking frequency, refer to below frequency table\n"
-		"  slowblinkfreq:the fast-blinking frequency, refer to below frequency table\n"
-		"state table\n"
-		"	0 - disable\n"
-		"	1 - Link is UP\n"
-		"	2 - Device is in power down\n"
-		"	3 - Device is in EEE mode\n"
-		"	4 - ANEG is running\n"
-		"	5 - ABIST is running\n"
-		"	6 - CDIAG is running\n"
-		"	7 - TEST mode is running\n"
-		"frequency table\n"
-		"	0 - 2 Hz blinking frequency\n"
-		"	1 - 4 Hz blinking frequency\n"
-		"	2 - 8 Hz blinking frequency\n"
-		"	3 - 16 Hz blinking frequency\n"
-	},
-	{
-		"gpy2xx_led_top_get",
-		"Get LED general configuration",
-		"For internal use.\n"
-	},
-#endif
-	{
-		"gpy2xx_led_if_cfg",
-		"Configure LED",
-		"gpy2xx_led_if_cfg <ledid=?> <colormode=?> <slowblinksrc=?> <fastblinksrc=?> <constantlyon=?> <pulseflags=?>\n"
-		"  ledid:        0~3\n"
-		"  colormode:    internal use\n"
-		"  slowblinksrc: event to trigger slow blink, refer to below trigger table\n"
-		"  fastblinksrc: event to trigger fast blink, refer to below trigger table\n"
-		"  constantlyon: event to trigger constant on, refer to below trigger table\n"
-		"  pulseflags:   pulse on LED trigger by combination of following events\n"
-		"                1 - transmit activity\n"
-		"                2 - receive activity\n"
-		"                4 - collision\n"
-		"Trigger Table\n"
-		"   0 - disable\n"
-		"   1 - 10Mbps\n"
-		"   2 - 100Mbps\n"
-		"   4 - 1000Mbps\n"
-		"   8 - 2500Mbps link\n"
-	},
-	{
-		"gpy2xx_led_if_get",
-		"Get LED configuration",
-		"gpy2xx_led_if_get <ledid=?>\n"
-		"  ledid:        0~3\n"
-	},
-#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
-	{
-		"gpy2xx_topin_cfg",
-		"Configure external interrupt",
-		"For internal use."
-	},
-	{
-		"gpy2xx_topin_get",
-		"Get external interrupt configuration",
-		"For internal use.\n"
-	},
-	{
-		"gpy2xx_topin_clr",
-		"Clear external interrupt events",
-		"For internal use.\n"
-	},
-#endif /* EN_SUPPORT_TOP_INT */
-	{
-		"gpy2xx_extin_mask",
-		"Enable/disable external interrupt event",
-		"gpy2xx_extin_mask <stdImask=?> <extImask=?>\n"
-		"  stdImask: 	0x0001 - link state change\n"
-		"               0x0002 - link speed change\n"
-		"               0x0004 - duplex mode change\n"
-		"               0x0008 - MDI/MDIX crossover change\n"
-		"               0x0010 - MDI polarity change\n"
-		"               0x0020 - link's auto-downspeed change\n"
-		"               0x0100 - SyncE lost of reference clock\n"
-		"               0x0200 - mailbox transaction complete\n"
-		"               0x0400 - auto-negotiation complete\n"
-		"               0x0800 - auto-negotiation error\n"
-		"               0x1000 - next page transmitted\n"
-		"               0x2000 - next page received\n"
-		"               0x4000 - master/slave resolution error\n"
-		"               0x8000 - wake-on-lan event\n"
-		"  extImask:	0x0002 - LPI interrupt\n"
-		"  				0x0008 - time stamp FIFO interrupt\n"
-		" 				0x0010 - MACSEC egress/ingress Interrupt\n"
-	},
-	{
-		"gpy2xx_extin_get",
-		"Get external interrupt event mask",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_extin_clr",
-		"Clear external interrupt event",
-		"gpy2xx_extin_clr <std_istat=?>\n"
-		"  std_istat:   0x0001 - link state change\n"
-		"               0x0002 - link speed change\n"
-		"               0x0004 - duplex mode change\n"
-		"               0x0008 - MDI/MDIX crossover change\n"
-		"               0x0020 - MDI polarity change\n"
-		"               0x0040 - link's auto-downspeed change\n"
-		"               0x0100 - SyncE lost of reference clock\n"
-		"               0x0200 - mailbox transaction complete\n"
-		"               0x0400 - auto-negotiation complete\n"
-		"               0x0800 - auto-negotiation error\n"
-		"               0x1000 - next page transmitted\n"
-		"               0x2000 - next page received\n"
-		"               0x4000 - master/slave resolution error\n"
-		"               0x8000 - wake-on-lan event\n"
-	},
-#endif
-	{
-		"gpy2xx_test_mode_cfg",
-		"Set test mode",
-		"gpy2xx_test_mode_cfg <testtxmode=?>\n"
-		"  testtxmode: 0 - normal operation\n"
-		"              1 - Test Mode 1 (Transmit Waveform Test)\n"
-		"              2 - Test Mode 2 (Transmit Jitter Test in MASTER Mode)\n"
-		"              3 - Test Mode 3 (Transmit Jitter Test in SLAVE Mode)\n"
-		"              4 - Test Mode 4 (Transmitter Distortion Test)\n"
-	},
-	{
-		"gpy2xx_cdiag_start",
-		"Start cable diagnostic - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_cdiag_read",
-		"Read cable diagnostic result - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_cdiag_stop",
-		"Stop cable diagnostic test",
-		NULL
-	},
-	{
-		"gpy2xx_abist_start",
-		"Start analog self-test (ABIST) - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_abist_read",
-		"Read analog self-test (ABIST) result - Check with firwmare developer for more detail.",
-		NULL
-	},
-	{
-		"gpy2xx_loopback_cfg",
-		"Configure near/far end loopback",
-		"gpy2xx_loopback_cfg <loopbackmode=?>\n"
-		"  loopbackmode: 0 - disable test loop\n"
-		"                1 - GMII near end test loop\n"
-		"                2 - PCS far end test loop\n"
-		"                3 - DEC (Digital Echo Canceler) test loop\n"
-		"                4 - MDI (RJ45 near end) test loop\n"
-		"                5 - far end test loop\n"
-		"                8 - GMII near end test loop - LB=1\n"
-	},
-	{
-		"gpy2xx_errcnt_cfg",
-		"Configure errors/events to be counted",
-		"gpy2xx_errcnt_cfg <errcountmode=?>\n"
-		"  errcountmode: 0 - receive errors\n"
-		"                1 - receive frames\n"
-		"                2 - ESD errors\n"
-		"                3 - SSD errors\n"
-		"                4 - transmit errors\n"
-		"                5 - transmit frames\n"
-		"                6 - collision events\n"
-		"                8 - link down events\n"
-		"                9 - auto-downspeed events\n"
-	},
-	{
-		"gpy2xx_errcnt_read",
-		"Read error/event counter",
-		NULL
-	},
-	{
-		"gpy2xx_pcs_status_read",
-		"Get PCS status",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_adjfreq",
-		"Adjust frequency of hardware clock",
-		"gpy2xx_ptp_adjfreq <pbbTime=?>\n"
-		"  pbbTime: value\n"
-	},
-	{
-		"gpy2xx_ptp_adjtime",
-		"Adjust the system timestamp",
-		"gpy2xx_ptp_adjtime <deltaTime=?>\n"
-		"  deltaTime: 	value\n"
-	},
-	{
-		"gpy2xx_ptp_settime",
-		"Initialize the system timestamp",
-		"gpy2xx_ptp_settime <initSec=?> <initNsec=?>\n"
-		"  initSec: value\n"
-		"  initNsec:value\n"
-	},
-	{
-		"gpy2xx_ptp_set_tsctrl",
-		"Configures the timestamp control, second/sub-second increment value",
-		"gpy2xx_ptp_set_tsctrl <enEvntMsg=?> <enMstrMsg=?> <snapType=? <gpcSel=?>\n"
-		"  enEvntMsg:  	dis/en\n"
-		"  enMstrMsg: 	dis/en\n"
-		"  snapType: 	value\n"
-		"  gpcSel: 	value\n"
-	},
-	{
-		"gpy2xx_ptp_set_ppsctrl",
-		"Configures the timestamp PPS control params",
-		"gpy2xx_ptp_set_ppsctrl <ppsCtrlLow=?> <targetSec=?> <targetNsc=?> <ppsInterval=?> <ppsWidth=?>\n"
-		"  ppsCtrlLow: 	value\n"
-		"  targetSec:  	value\n"
-		"  targetNsc: 	value\n"
-		"  ppsInterval:	value\n"
-		"  ppsWidth: 	value\n"
-	},
-	{
-		"gpy2xx_ptp_set_ptoctrl",
-		"Configures the timestamp PTO control params",
-		"gpy2xx_ptp_set_ptoctrl <ptoCtrlLow=?> <srcPortID=?> <logmLvlLow=?> <logmLvlHi=?>\n"
-		"  ptoCtrlLow: 	value\n"
-		"  srcPortID:  	value\n"
-		"  logmLvlLow: 	value\n"
-		"  logmLvlHi:	value\n"
-	},
-	{
-		"gpy2xx_ptp_gettime",
-		"Provides the system timestamp",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_enable",
-		"Enable and configure PTP (1588) function",
-		"gpy2xx_ptp_enable <enPhyTxTs=?> <enPhyRxTs=?> <enTxOstcEn=?> <txPtpOffset=?> <txPtpProto=?> <txOstCorTime=?>\n"
-		"  enPhyTxTs: 	 value\n"
-		"  enPhyRxTs: 	 value\n"
-		"  enTxOstcEn: 	 value\n"
-		"  txPtpOffset:  value\n"
-		"  txPtpProto: 	 value\n"
-		"  txOstCorTime: value\n"
-	},
-	{
-		"gpy2xx_ptp_disable",
-		"Disable and configure PTP (1588) function",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_getcfg",
-		"Get PTP (1588) configuration",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_fifostat",
-		"Get timestamp FIFO status",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_resetfifo",
-		"Resets the timestamp FIFO status",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_ptp_txtsstat",
-		"Get Tx timestamp status",
-		NULL
-	},
-#endif
-	{
-		"gpy2xx_ptp_getrxts",
-		"Get RX packet timestamp status and CRC",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_aux_cfg",
-		"Configure PTP Auxiliary timestamp function",
-		"gpy2xx_ptp_aux_cfg <enAux=?> <auxTrigPort=?>\n"
-		"  enAux:    	0 - disable,   1 - enable\n"
-		"  auxTrigPort: 0 - OUT_TIMER, 1 - GPC0, 2 - GPC1, 3 - GPC2\n"
-	},
-	{
-		"gpy2xx_ptp_gettxts",
-		"Get TX packet timestamp and CRC status and CRC",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_getauxts",
-		"Get Auxiliary timestamp",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_auxfifostat",
-		"Get auxiliary timestamp FIFO status",
-		NULL
-	},
-	{
-		"gpy2xx_ptp_resetauxfifo",
-		"Reset auxiliary timestamp FIFO status",
-		NULL
-	},
-	{
-		"gpy2xx_synce_cfg",
-		"Configure SyncE function",
-		"gpy2xx_synce_cfg <enSyncE=?> <synceRefClk=?> <masterSlave=?> <dataRate=?> <gpcSel=?>\n"
-		"  enSyncE:    0 - disable,    1 - enable\n"
-		"  synceRefClk: 0-8KHz,   1-2.048MHz,	2-1.544MHz\n"
-		"  masterSlave:	0-slave mode, 1-master mode\n"
-		"  dataRate: 	0-1G,		  1-2.5G\n"
-		"  gpcSel:		0-GPC1,	1-GPC1,	2-GPC2\n"
-	},
-	{
-		"gpy2xx_synce_get",
-		"Get SyncE configuration",
-		NULL
-	},
-	{
-		"gpy2xx_wol_cfg",
-		"Configure Wake-On-Lan function",
-		"gpy2xx_wol_cfg <woloptions=?> <wolmac=?> <wolpassword=?>\n"
-		"  woloptions:  combination of following flags\n"
-		"               0x20 - wake up when receiving magic packet\n"
-		"               0x40 - password enabled\n"
-		"  wolmac:      6-byte MAC address of magic packet\n"
-		"  wolpassword: 6-byte password\n"
-	},
-	{
-		"gpy2xx_wol_get",
-		"Get Wake-On-Lan configuration",
-		NULL
-	},
-	{
-		"gpy2xx_ads_cfg",
-		"Configure Auto-Down-Speed",
-		"gpy2xx_ads_cfg [<advertise_enable=?>] [<NBaseT_ds_enable=?>] [<downshift_cnt_thr=?>] [<force_reset=?>] [<rst_cntdown_timer=?>]\n"
-		"advertise_enable:  0 Disable / 1 Enable\n"
-		"NBaseT_ds_enable:  0 Disable / 1 Enable\n"
-		"downshift_cnt_thr: value (5bits)\n"
-		"force_reset:       0/1\n"
-		"rst_cntdown_timer: value (8bits)\n"
-	},
-	{
-		"gpy2xx_ads_get",
-		"Get Auto-Down-Speed",
-		NULL
-	},
-	{
-		"gpy2xx_ulp_cfg",
-		"Configure Ultra Low Power",
-		"gpy2xx_ulp_cfg [<ulp_enable=?>] [<ulp_sta_block=?>] [<ulp_exit=?>] [<master_slice=?>]\n"
-		"ulp_enable:  0 Disable / 1 Enable\n"
-		"ulp_sta_block:  0 Disable / 1 Enable\n"
-		"ulp_exit:  0 Not Exit / 1 Exit ULP\n"
-		"master_slice:  Slice to become master <0 to 3>\n"
-	},
-	{
-		"gpy2xx_ulp_get",
-		"Get Ultra Low Power",
-		NULL
-	},
-	{
-		"gpy2xx_ads_detected",
-		"Get auto-downspeed event",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_restart_aneg",
-		"Restart SGMII auto-negotiation",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_config_aneg",
-		"Configure SGMII auto-negotiation",
-		"gpy2xx_sgmii_config_aneg <linkcfg_dir=?> [<aneg_mode=?>] [<eee_enable=?>] [<autoneg=?>] [<speed=?>] [fixed2G5=?] [<duplex=?>]\n"
-		"  linkcfg_dir: 0 - SGMII_LINKCFG_TPI / 1 - SGMII_LINKCFG_SGMII\n"
-		"  aneg_mode:   1 - SGMII_ANEG_1000BX\n"
-		"               2 - SGMII_ANEG_CISCO_PHY\n"
-		"               3 - SGMII_ANEG_CISCO_MAC\n"
-		"  eee_enable:  0 - disable / 1 - enable\n"
-		"  autoneg:     0 - disable / 1 - enable\n"
-		"  speed:       10/100/1000/2500\n"
-		"  fixed2G5:    0 - TPI speed / 1 - force 2.5G\n"
-		"  duplex:      DUPLEX_FULL/DUPLEX_HALF\n"
-	},
-	{
-		"gpy2xx_sgmii_aneg_done",
-		"Check SGMII auto-negotiation status",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_read_status",
-		"Get SGMII link status (detail)",
-		NULL
-	},
-	{
-		"gpy2xx_sgmii_opmode",
-		"Configure SGMII operation mode",
-		"gpy211_sgmii_opmode <opMode=?>\n"
-		"  opMode: 0 - normal oeration\n"
-		"		   1 - power down\n"
-		"		   2 - loopback\n"
-		"		   3 - reset\n"
-	},
-	{
-		"gpy2xx_pvt_get",
-		"Get SENSOR temparature",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacx_pm_hw_reset",
-		"Set PM lavel HW reset",
-		NULL
-	},
-#endif
-	{
-		"gpy2xx_macsec_enable",
-		"Configure Smart-AZ to enable MACsec",
-		"gpy2xx_macsec_enable [dropCrc=?] [dropPerr=?] [dropSfail=?] [dropClass=?]\n"
-		"  dropCrc:    dis/en\n"
-		"  dropPerr:   dis/en\n"
-		"  dropSfail:  dis/en\n"
-		"  dropClass:  dis/en\n"
-	},
-	{
-		"gpy2xx_macsec_disable",
-		"Unconfigure Smart-AZ to disable MACsec",
-		NULL
-	},
-	{
-		"gpy2xx_gmacx_pm_pdi_cfg",
-		"Set PM PDI configuration",
-		"gpy2xx_gmacx_pm_pdi_cfg <bpMac=?> <bpMsec=?> [dropCrc=?] [dropPerr=?] [dropSfail=?] [dropClass=?] [cust3gEn=?] [sgmiiLb=?]\n"
-		"  bpMac:      dis/en\n"
-		"  bpMsec:     dis/en\n"
-		"  dropCrc:    dis/en\n"
-		"  dropPerr:   dis/en\n"
-		"  dropSfail:  dis/en\n"
-		"  dropClass:  dis/en\n"
-		"  cust3gEn:   dis/en\n"
-		"  sgmiiLb:    dis/en\n"
-	},
-	{
-		"gpy2xx_gmacx_pm_pdi_get",
-		"Get PM PDI configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_pm_cfg",
-		"Set PM GMAC-Full configuration",
-		"gpy2xx_gmacf_pm_cfg <crcPad=?> [txErr=?] [bigEndian=?]\n"
-		"  crcPad:     0 - Insert both CRC and Paddding\n"
-		"			   1 - Insert CRC only but no Paddding\n"
-		"			   2 - Do not insert CRC or Paddding\n"
-		"			   3 - Replace CRC but no Paddding\n"
-		"  txErr:      dis/en\n"
-		"  bigEndian:  dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_pm_get",
-		"Get PM GMAC-Full configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pm_cfg",
-		"Set PM GMAC-Lite configuration",
-		"gpy2xx_gmacl_pm_cfg <crcPad=?> [txErr=?] [bigEndian=?]\n"
-		"  crcPad:     0 - Insert both CRC and Paddding\n"
-		"			   1 - Insert CRC only but no Paddding\n"
-		"			   2 - Do not insert CRC or Paddding\n"
-		"			   3 - Replace CRC but no Paddding\n"
-		"  txErr:      dis/en\n"
-		"  bigEndian:  dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacl_pm_get",
-		"Get PM GMAC-Lite configuration",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacf_lpi_cfg",
-		"Set PM GMAC-Full LPI configuration",
-		"gpy2xx_gmacf_lpi_cfg <lpintEn=?> <lpiEn=?> <linkUp=?> [txautoEn=?] [timerEn=?] [clkStop=?] [ticTime=0196] [twTime=?] [lsTime=?] [entryTime=?]\n"
-		"  lpintEn:    dis/en\n"
-		"  lpiEn:      dis/en\n"
-		"  linkUp:     dis/en\n"
-		"  txautoEn:   dis/en\n"
-		"  timerEn:    dis/en\n"
-		"  clkStop:    dis/en\n"
-		"  ticTime:    value\n"
-		"  twTime:     value\n"
-		"  lsTime:     value\n"
-		"  entryTime:  value\n"
-	},
-	{
-		"gpy2xx_gmacf_lpi_get",
-		"Get PM GMAC-Full LPI configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_lpi_cfg",
-		"Set PM GMAC-Lite LPI configuration",
-		"gpy2xx_gmacl_lpi_cfg <lpintEn=?> <lpiEn=?> <linkUp=?> [txautoEn=?] [timerEn=?] [clkStop=?] [ticTime=0196] [twTime=?] [lsTime=?] [entryTime=?]\n"
-		"  lpintEn:    dis/en\n"
-		"  lpiEn:      dis/en\n"
-		"  linkUp:     dis/en\n"
-		"  txautoEn:   dis/en\n"
-		"  timerEn:    dis/en\n"
-		"  clkStop:    dis/en\n"
-		"  ticTime:    value\n"
-		"  twTime:     value\n"
-		"  lsTime:     value\n"
-		"  entryTime:  value\n"
-	},
-	{
-		"gpy2xx_gmacl_lpi_get",
-		"Get PM GMAC-Lite LPI configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_stat_get",
-		"Get GMAC-Full LPI status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_lpi_stat_get",
-		"Get GMAC-Lite LPI status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_imask_cfg",
-		"Set GMAC-Full's LPI interrupt mask",
-		"gpy2xx_gmacf_lpi_imask_cfg <rxUsc=?> <rxTrc=?> <txUsc=?> <txTrc=?>\n"
-		"  rxUsc:  dis/en\n"
-		"  rxTrc:  dis/en\n"
-		"  txUsc:  dis/en\n"
-		"  txTrc:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_lpi_imask_get",
-		"Get GMAC-Full's LPI interrupt mask",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_istat_get",
-		"Get GMAC-Full's LPI interrupt status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_lpi_count_get",
-		"Get GMAC-Full's LPI counters",
-		NULL
-	},
-#endif
-	{
-		"gpy2xx_gmacx_bm_cfg",
-		"Set PM's Buffer configuration",
-		"gpy2xx_gmacx_bm_cfg [sb0Start=?] [sb0End=?] [sb0Pthresh=?] [sb1Start=?] [sb1End=?] [sb1Pthresh=?]\n"
-		"  sb0Start:   value\n"
-		"  sb0End:     value\n"
-		"  sb0Pthresh: value\n"
-		"  sb1Start:   value\n"
-		"  sb1End:	   value\n"
-		"  sb1Pthresh: value\n"
-	},
-	{
-		"gpy2xx_gmacx_bm_status_get",
-		"Get PMs buffer status",
-		NULL
-	},
-	{
-		"gpy2xx_gmacx_bm_get",
-		"Get PM's Buffer configuration",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pause_cfg",
-		"Set GMAC-Lite's Pause configuration",
-		"gpy2xx_gmacl_pause_cfg <fcBusy=?> <gmaclFc=?> <txfcEn=?> <pauseTime=?> <pauseMac=?> [plThresh=?] [zqPause=?] [paThresh=?] [pdThresh=?]\n"
-		"  fcBusy:   dis/en\n"
-		"  gmaclFc:  dis/en\n"
-		"  txfcEn:   dis/en\n"
-		"  plThresh: 0 - PT-4 slot times\n"
-		"			 1 - PT-28 slot times\n"
-		"			 2 - PT-36 slot times\n"
-		"			 3 - PT-144 slot times\n"
-		"			 4 - PT-256 slot times\n"
-		"			 5 - PT-512 slot times\n"
-		"  zqPause:	 dis/en\n"
-		"  pauseTime:value\n"
-		"  pauseMac: value\n"
-		"  paThresh: value\n"
-		"  pdThresh: value\n"
-	},
-	{
-		"gpy2xx_gmacl_pause_get",
-		"Get GMAC-Lite's Pause configuration",
-		NULL
-	},
-	{
-		"gpy2xx_pm_freq_tune",
-		"Tune the frequency of MACs within GPY in USXGMII Mode",
-		"gpy2xx_pm_freq_tune <ppm=?>\n"
-		"  ppm: 0 - MACs operate at frequency+000ppm\n"
-		"		1 - MACs operate at frequency+100ppm\n"
-		"		2 - MACs operate at frequency+300ppm\n"
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacf_pkt_filter_cfg",
-		"Set GMAC-Full's packet filter control info",
-		"gpy2xx_gmacf_pkt_filter_cfg <prEn=?> [passAmc=?] [blockBc=?] [passCtrl=?] [safltrEn=?] [rxAll=?]\n"
-		"  prEn:       dis/en\n"
-		"  passAmc:    dis/en\n"
-		"  blockBc:    dis/en\n"
-		"  passCtrl:   0 - Block all control packets\n"
-		"			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n"
-		"			   2 - Forwards all control packets even if they fail the Address filter\n"
-		"			   3 - Forwards the control packets that pass the Address filter\n"
-		"  safltrEn:   dis/en\n"
-		"  rxAll:      dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_pkt_filter_get",
-		"Get GMAC-Full's packet filter control info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pkt_filter_cfg",
-		"Set GMAC-Lite's packet filter control info",
-		"gpy2xx_gmacl_pkt_filter_cfg <prEn=?> [passAmc=?] [blockBc=?] [passCtrl=?] [safltrEn=?] [rxAll=?]\n"
-		"  prEn:       dis/en\n"
-		"  passAmc:    dis/en\n"
-		"  blockBc:    dis/en\n"
-		"  passCtrl:   0 - Block all control packets\n"
-		"			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n"
-		"			   2 - Forwards all control packets even if they fail the Address filter\n"
-		"			   3 - Forwards the control packets that pass the Address filter\n"
-		"  safltrEn:   dis/en\n"
-		"  rxAll:      dis/en\n"
-	},
-	{
-		"gpy2xx_gmacl_pkt_filter_get",
-		"Get GMAC-Lite's packet filter control info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_debug_info_get",
-		"Get GMAC-Full's debug info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_pkt_cfg",
-		"Set GMAC-Lite's packet config info",
-		"gpy2xx_gmacl_pkt_cfg <pcStrip=?> <crcStrip=?> [jumboEn=?] [jabberDis=?] [wdogDis=?] [sup2kp=?] [macIpg=?]\n"
-		"  jumboEn:    dis/en\n"
-		"  jabberDis:  dis/en\n"
-		"  wdogDis:    dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-		"  sup2kp:     dis/en\n"
-		"  macIpg:     0 - 12 Bytes\n"
-		"  	           1 - 11 Bytes\n"
-		"  	           2 - 10 Bytes\n"
-		"  	           3 - 09 Bytes\n"
-		"  	           4 - 08 Bytes\n"
-		"			   5 - 07 Bytes\n"
-		"			   6 - 06 Bytes\n"
-		"			   7 - 05 Bytes\n"
-	},
-	{
-		"gpy2xx_gmacl_pkt_get",
-		"Get GMAC-Lite's packet config info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_cfg",
-		"Set GMAC-Full's basic config info",
-		"gpy2xx_gmacf_cfg [reEn=?] [teEn=?] [preambLen=<enum>] [lbmEn=?] [fdupEn=?] [macSpeed=<enum>] [rcWrite1=?]\n"
-		"  reEn:       dis/en\n"
-		"  teEn:       dis/en\n"
-		"  preambLen:  0 - 7 bytes of preamble\n"
-		"			   1 - 5 bytes of preamble\n"
-		"			   2 - 3 bytes of preamble\n"
-		"  lbmEn:      dis/en\n"
-		"  fdupEn:     dis/en\n"
-		"  macSpeed:   0 - 1G\n"
-		"			   1 - 2.5G\n"
-		"			   2 - 10M\n"
-		"			   3 - 100MG\n"
-		"  rcWrite1:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_get",
-		"Get GMAC-Full's basic config info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacl_cfg",
-		"Set GMAC-Lite's basic config info",
-		"gpy2xx_gmacl_cfg [reEn=?] [teEn=?] [preambLen=<enum>] [lbmEn=?] [fdupEn=?] [macSpeed=<enum>] [rcWrite1=?]\n"
-		"  reEn:       dis/en\n"
-		"  teEn:       dis/en\n"
-		"  preambLen:  0 - 7 bytes of preamble\n"
-		"			   1 - 5 bytes of preamble\n"
-		"			   2 - 3 bytes of preamble\n"
-		"  lbmEn:      dis/en\n"
-		"  fdupEn:     dis/en\n"
-		"  macSpeed:   0 - 1G\n"
-		"			   1 - 2.5G\n"
-		"			   2 - 10M\n"
-		"			   3 - 100MG\n"
-		"  rcWrite1:   dis/en\n"
-	},
-	{
-		"gpy2xx_gmacl_get",
-		"Get GMAC-Lite's basic config info",
-		NULL
-	},
-#endif
-	{
-		"gpy2xx_gmacf_pkt_cfg",
-		"Set GMAC-Full's packet config info",
-		"gpy2xx_gmacf_pkt_cfg <pcStrip=?> <crcStrip=?> [jumboEn=?] [jabberDis=?] [wdogDis=?] [sup2kp=?] [macIpg=?]\n"
-		"  jumboEn:    dis/en\n"
-		"  jabberDis:  dis/en\n"
-		"  wdogDis:    dis/en\n"
-		"  pcStrip:    dis/en\n"
-		"  crcStrip:   dis/en\n"
-		"  sup2kp:     dis/en\n"
-		"  macIpg:     0 - 12 Bytes\n"
-		"  	           1 - 11 Bytes\n"
-		"  	           2 - 10 Bytes\n"
-		"  	           3 - 09 Bytes\n"
-		"  	           4 - 08 Bytes\n"
-		"  	           5 - 07 Bytes\n"
-		"  	           6 - 06 Bytes\n"
-		"  	           7 - 05 Bytes\n"
-	},
-	{
-		"gpy2xx_gmacf_pkt_get",
-		"Get GMAC-Full's packet config info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_count_ctrl_cfg",
-		"Set GMAC-Full's Rx/Tx counters control info",
-		"gpy2xx_gmacf_count_ctrl_cfg <rstCnt=?> <stopRoll=?> <conRead=?> <frzCnt=?> <pstCnt=?> <psthFull=?> <cntbcDrop=?>\n"
-		"  rstCnt:     dis/en\n"
-		"  stopRoll:   dis/en\n"
-		"  conRead:    dis/en\n"
-		"  frzCnt:     dis/en\n"
-		"  pstCnt:     dis/en\n"
-		"  psthFull:   dis/en\n"
-		"  cntbcDrop:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_count_ctrl_get",
-		"Get GMAC-Full's counters control info",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_count_get",
-		"Get GMAC-Full's Rx/Tx counters",
-		NULL
-	},
-#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	{
-		"gpy2xx_gmacf_count_imask_cfg",
-		"Set GMAC-Full's counters interrupt mask",
-		"gpy2xx_gmacf_count_imask_cfg <txGb=?> <txUflow=?> <txGood=?> <txOsize=?> <rxGb=?> <rxCrc=?> <rxUsize=?> <rxOsize=?>\n"
-		"  txGb:     dis/en\n"
-		"  txUflow:  dis/en\n"
-		"  txGood:   dis/en\n"
-		"  txOsize:  dis/en\n"
-		"  rxGb:     dis/en\n"
-		"  rxCrc:    dis/en\n"
-		"  rxUsize:  dis/en\n"
-		"  rxOsize:  dis/en\n"
-	},
-	{
-		"gpy2xx_gmacf_count_imask_get",
-		"Get GMAC-Full's counters interrupt mask",
-		NULL
-	},
-	{
-		"gpy2xx_gmacf_count_istat_get",
-		"Get GMAC-Full's counters interrupt status",
-		NULL
-	},
+static unsigned int t_olower(u32 ch)
+{
+	if (ch >= 'A' && ch <= 'Z')
+		return ch + 'a' - 'A';
+
+	return ch;
+}
+
+static unsigned int xstrncasecmp(const char *s1, const char *s2, unsigned int n)
+{
+	int c1, c2;
+
+	if (!s1 || !s2) return 1;
+
+	for (; n > 0; s1++, s2++, --n) {
+		c1 = t_olower(*s1);
+		c2 = t_olower(*s2);
+
+		if (c1 != c2) {
+			return (c1 - c2);
+		} else if (c1 == '\0') {
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+unsigned uart_hang = 1;
+DWORD WINAPI check_uart_hang(LPVOID lpParam)
+{
+	Sleep(10000);
+
+	if (uart_hang) {
+		system("color 0c");
+		printf("ALERT :Selected COMPORT not functioning properly\n\n");
+		printf("1. Please Check whether the Device Under Test is ON\n");
+		printf("2. Please Check whether you have selected the correct COMPORT\n");
+		printf("3. Please Check whether you have selected the correct BAUDRATE\n\n");
+		printf("Application exit in 10 seconds\n");
+		Sleep(10000);
+		exit(0);
+	}
+
+	return 0;
+}
+
+static void SignalHandler(int signal)
+{
+	if (signal == SIGINT) {
+		sig_cap = 1;
+	}
+}
+
+char *var_list[MAX_PARAM];
+char *param_list1[MAX_PARAM];
+
+int system_restart = 0;
+
+unsigned int str_to_hex(unsigned char *str)
+{
+	unsigned int n = 0;
+	int i = 0;
+
+	if (!str)
+		return 0;
+
+	if (str[0] == 0)
+		return 0;
+
+	while (str[i]) {
+		n = n * 16;
+
+		if (('0' <= str[i] && str[i] <= '9')) {
+			n += str[i] - '0';
+		} else if (('A' <= str[i] && str[i] <= 'F')) {
+			n += str[i] - 'A' + 10;
+			;
+		} else if (('a' <= str[i] && str[i] <= 'f')) {
+			n += str[i] - 'a' + 10;
+			;
+		} else
+			printf("Wrong value:%u\n", str[i]);
+
+		i++;
+	}
+
+	return n;
+}
+
+static inline unsigned int hex2int(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (unsigned int)(c - '0');
+	else
+		return (unsigned int)(c - 'a' + 10);
+}
+
+#define UNIX_EPOCH 1970
+int dayofweek(int d, int m, int y)
+{
+	char day;
+	static int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+	y -= m < 3;
+	day = (y + y / 4 - y / 100 + y / 400 + t[m - 1] + d) % 7;
+
+	//If leap year it will be the remainder-1
+	if (y % 4 == 0)
+		day -= 1;
+
+	return day;
+}
+
+static int print_sys_time(u32 sec, u32 nsec)
+{
+	int year, act_leap = 0, leap_days = 0, act_mnum, mnum = 0, act_day, day, hour, minute, is_leap = UNIX_EPOCH;
+	char *monName = "January";
+	//PTP Unix time starts from 1st Jan 1970, Thirsday
+	char *dayName[] = {"Thursday", "Friday", "Saturday", "Sunday", "Monday", "Tuesday", "Wednesday"};
+	char *weekDay;
+
+	minute = sec / 60;
+	sec = sec % 60;
+
+	hour = minute / 60;
+	minute = minute % 60;
+
+	day = act_day = hour / 24;
+	weekDay = dayName[day % 7];
+	hour = hour % 24;
+
+	year  = day / 365;
+	//printf("\n\tYrs %d days %d hours %d mins %d secs %d\n", year, day, hour, minute, sec);
+
+	while ((is_leap < (UNIX_EPOCH + year))) {
+		if (is_leap % 4 == 0)
+			act_leap++;
+
+		is_leap++;
+	};
+
+	//printf("\n\tLeap days %d\n", act_leap);
+
+	year = (act_day - act_leap) / 365;
+
+	act_day -= act_leap;
+
+	day = act_day % 365;
+
+	mnum = act_mnum = day / 30;
+
+	//printf("\n\tAct yrs %d, act days %d\n", year, act_day);
+
+	leap_days = 0;
+
+	is_leap = UNIX_EPOCH;
+
+	while ((is_leap < (UNIX_EPOCH + year))) {
+		if (is_leap % 4 == 0)
+			leap_days++;
+
+		is_leap++;
+	};
+
+	day += ((act_leap - leap_days) + 1); //+1 for the current day
+
+	//printf("\n\tAct yrs %d leap days %d days %d month num %d\n", year, leap_days, day, mnum);
+
+	switch (act_mnum) {
+	case 1:
+		if (day > 31) {
+			monName = "February";
+			mnum += 1;
+			day -= 31;
+		}
+
+		break;
+
+	case 2:
+	case 3:
+		monName = "March";
+
+		if (day > 90) {
+			monName = "April";
+			mnum += 1;
+			day -= 90;
+		} else
+			day -= 59;
+
+		break;
+
+	case 4:
+		monName = "April";
+
+		if (day > 120) {
+			monName = "May";
+			mnum += 1;
+			day -= 120;
+		} else
+			day -= 90;
+
+		break;
+
+	case 5:
+		monName = "May";
+
+		if (day > 151) {
+			monName = "June";
+			mnum += 1;
+			day -= 151;
+		} else
+			day -= 120;
+
+		break;
+
+	case 6:
+		monName = "June";
+
+		if (day > 181) {
+			monName = "July";
+			mnum += 1;
+			day -= 181;
+		} else
+			day -= 151;
+
+		break;
+
+	case 7:
+		monName = "July";
+
+		if (day > 212) {
+			monName = "August";
+			mnum += 1;
+			day -= 212;
+		} else
+			day -= 181;
+
+		break;
+
+	case 8:
+		monName = "August";
+
+		if (day > 243) {
+			monName = "September";
+			mnum += 1;
+			day -= 243;
+		} else
+			day -= 212;
+
+		break;
+
+	case 9:
+		monName = "September";
+
+		if (day > 273) {
+			monName = "October";
+			mnum += 1;
+			day -= 273;
+		} else
+			day -= 243;
+
+		break;
+
+	case 10:
+		monName = "October";
+
+		if (day > 304) {
+			monName = "November";
+			mnum += 1;
+			day -= 304;
+		} else
+			day -= 273;
+
+		break;
+
+	case 11:
+		monName = "November";
+
+		if (day > 334) {
+			monName = "December";
+			mnum += 1;
+			day -= 334;
+		} else
+			day -= 304;
+
+		break;
+
+	case 12:
+		monName = "December";
+		day -= 334;
+		break;
+
+	default:
+		break;
+	}
+
+	//If the current year is leap and beyond feb?
+	if (((UNIX_EPOCH + year) % 4 == 0) && (act_mnum > 1)) {
+		//printf("\n\tThe current year %d is leap", (UNIX_EPOCH + year));
+		day -= 1;
+	}
+
+	//printf("\n\tYr %d day %d mon %d\n", (UNIX_EPOCH + year), day, mnum);
+	printf("\n\tUnix system time: %s %s %d %d %02d:%02d:%02d GMT\n", weekDay, monName, day, (UNIX_EPOCH + year), hour, minute, sec);
+	return 0;
+}
+
+int pc_uart_dataread(u32 Offset, u32 *value)
+{
+#if RAPID_UART
+	char txbuf[256];
+	char rxbuf[1024];
+	DWORD written;
+	int size;
+	DWORD read;
+	DWORD totalread;
+	DWORD retry;
+	unsigned int val;
+	char *ptr;
+
+	PurgeComm(hComm, PURGE_RXCLEAR);
+
+	size = snprintf(txbuf, ARRAY_SIZE(txbuf), "r %04x\n", Offset & 0xFFFF);
+
+	if (debugenable) {
+		LOG_CRIT("%s", txbuf);
+	}
+
+	written = 0;
+
+	if (!WriteFile(hComm,
+		       txbuf,
+		       (DWORD)size,
+		       &written,
+		       NULL)) {
+		printf("\nWrite COM fail\n");
+		return -1;
+	}
+
+	FlushFileBuffers(hComm);
+
+	if (size > 0) {
+		size--;
+		txbuf[size] = 0;
+	}
+
+	totalread = 0;
+	retry = 100;
+
+	do {
+		read = 0;
+
+		if (!ReadFile(hComm,
+			      rxbuf + totalread,
+			      ARRAY_SIZE(rxbuf) - 1 - totalread,
+			      &read,
+			      NULL))
+			return -1;
+
+		totalread += read;
+		rxbuf[totalread] = 0;
+
+		ptr = strstr(rxbuf, txbuf);
+	} while ((ptr == NULL || strlen(ptr) < 12) && --retry > 0);
+
+	if (retry == 0) {
+		printf("\nUART reading timeout, raw data is \"%s\"\n", rxbuf);
+		return -1;
+	}
+
+	while (totalread > 0) {
+		totalread--;
+
+		if (rxbuf[totalread] >= '0' && rxbuf[totalread] <= '9')
+			break;
+
+		if (rxbuf[totalread] >= 'a' && rxbuf[totalread] <= 'f')
+			break;
+	}
+
+	if (totalread < 3) {
+		printf("\nUART reading is wrong, raw data is \"%s\"\n", rxbuf);
+		return -1;
+	}
+
+	val = hex2int(rxbuf[totalread - 3]) * 0x1000;
+	val += hex2int(rxbuf[totalread - 2]) * 0x0100;
+	val += hex2int(rxbuf[totalread - 1]) * 0x0010;
+	val += hex2int(rxbuf[totalread]);
+
+	*value = val;
+	return 1;
+#else
+	DWORD BytestoWrite;
+	DWORD BytesWritten = 0;
+	DWORD dwEventMask;
+	unsigned char Temp_Char;
+	unsigned char uart_Buffer[256];
+	char writebuffer[16];
+	unsigned char readbuffer[16];
+	unsigned int i = 0;
+	unsigned int h = 0;
+
+	DWORD No_BytesRead;
+
+	if (debugenable) {
+		printf("\n\n#############");
+		printf("\nread original offset  -> %x", Offset);
+	}
+
+	BytestoWrite = sizeof(writebuffer);
+
+	memset(uart_Buffer, 0, sizeof(uart_Buffer));
+	memset(writebuffer, 0, sizeof(writebuffer));
+	memset(readbuffer, 0, sizeof(readbuffer));
+
+#if !(defined(GPY211_PC_TEST) && GPY211_PC_TEST)
+	BytestoWrite = snprintf(writebuffer, ARRAY_SIZE(writebuffer), "r %05x\n", (Offset & 0xfffff));
+#else
+	BytestoWrite = snprintf(writebuffer, ARRAY_SIZE(writebuffer), "r %04x\n", (Offset & 0xffff));
+#endif /* GPY211_PC_TEST */
+
+	if (debugenable) {
+		printf(", read  -> \"%s\"\n", writebuffer);
+	}
+
+	WriteFile(hComm,
+		  writebuffer,
+		  BytestoWrite,
+		  &BytesWritten,
+		  NULL);
+	i = 0;
+	SetCommMask(hComm, EV_RXCHAR);
+	WaitCommEvent(hComm, &dwEventMask, NULL);
+
+	do {
+		ReadFile(hComm,
+			 &Temp_Char,
+			 sizeof(Temp_Char),
+			 &No_BytesRead,
+			 NULL);
+
+		uart_Buffer[i] = Temp_Char;
+		i++;
+	} while (No_BytesRead > 0);
+
+	if (debugenable) {
+		uart_Buffer[i] = 0;
+		printf("\nraw (etc read) from uart\n%s\n", uart_Buffer);
+	}
+
+	if (uart_Buffer[0] == 'r' && uart_Buffer[1] == ' ') {
+#if !(defined(GPY211_PC_TEST) && GPY211_PC_TEST)
+		readbuffer[0] = uart_Buffer[9];
+		readbuffer[1] = uart_Buffer[10];
+		readbuffer[2] = uart_Buffer[11];
+		readbuffer[3] = uart_Buffer[12];
+#else
+		readbuffer[0] = uart_Buffer[8];
+		readbuffer[1] = uart_Buffer[9];
+		readbuffer[2] = uart_Buffer[10];
+		readbuffer[3] = uart_Buffer[11];
+#endif /* GPY211_PC_TEST */
+	} else {
+		system("color 0c");
+		printf("\n\nALERT :Selected COMPORT not functioning properly (Reg read fail)\n\n");
+		printf("1. Please Check whether the Device Under Test is ON\n");
+		printf("2. Please Check the COMPORT connection\n");
+		printf("\nApplication exit in 10 seconds\n");
+		Sleep(10000);
+		scanf("%u", &h);
+
+		//exit(0);
+		return -1;
+	}
+
+	*value = str_to_hex(readbuffer);
+
+	if (debugenable) {
+		printf("Read Back Value = %04x\n\n", *value);
+	}
+
+	return 1;
 #endif
-	{
-		"gpy2xx_msec_init_ing_dev",
-		"Init macsec ING device",
-		NULL
-	},
-	{
-		"gpy2xx_msec_init_egr_dev",
-		"Init macsec EGR device",
-		NULL
-	},
+}
 
-	{
-		"gpy2xx_msec_config_ing_tr",
-		"Configure ingress transform record",
-		"gpy2xx_msec_config_ing_tr [sa_index=?] [ca_type=?] [key=?] [sci=?] [seq_num=?] [rep_window=?] [salt=?] [short_sci=?]\n"
-		"  sa_index:   value\n"
-		"  ca_type:    value\n"
-		"  key:        value\n"
-		"  sci:        value\n"
-		"  seq_num     value\n"
-		"  salt:       value\n"
-		"  short_sci:  value\n"
-		"  rep_window: value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_tr",
-		"Configure egress transform record",
-		"gpy2xx_msec_config_egr_tr [sa_index=?] [ca_type=?] [an=?] [key=?] [sci=?] [seq_num=?] [salt=?] [short_sci=?] [next_sa_ind=?] [sa_expirq=?] [sa_indvalid=?] [flow_index=?] [sa_indupen=?]\n"
-		"  sa_index:    value\n"
-		"  ca_type:     value\n"
-		"  an:          value\n"
-		"  key:         value\n"
-		"  sci:         value\n"
-		"  seq_num:        value\n"
-		"  salt:        value\n"
-		"  short_sci:    value\n"
-		"  next_sa_ind:   value\n"
-		"  sa_expirq: value\n"
-		"  sa_indvalid:  value\n"
-		"  flow_index:  value\n"
-		"  sa_indupen:  value\n",
-	},
-	{
-		"gpy2xx_msec_update_egr_sa_cw",
-		"Update egress SA control word",
-		"gpy2xx_msec_update_egr_sa_cw [sa_index=?] [ca_type=?] [sn_type=?] [next_sa_ind=?] [sa_expirq=?] [sa_indvalid=?] [flow_index=?] [sa_indupen=?]\n"
-		"  sa_index:    value\n"
-		"  ca_type:     value\n"
-		"  sn_type:     value\n"
-		"  next_sa_ind: value\n"
-		"  sa_expirq:   value\n"
-		"  sa_indvalid: value\n"
-		"  flow_index:  value\n"
-		"  sa_indupen:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_tr",
-		"Get ingress transform record",
-		"gpy2xx_msec_get_ing_tr sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_tr",
-		"Get egress transform record",
-		"gpy2xx_msec_get_egr_tr sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_pn",
-		"Get ingress current SN from transform record",
-		"gpy2xx_msec_get_ing_pn sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_pn",
-		"Get egress current SN from transform record",
-		"gpy2xx_msec_get_egr_pn sa_index=0\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_rule",
-		"Configure ingress SA match rule parameters",
-		"gpy2xx_msec_config_ing_sam_rule [rule_index=?] [sa_mac=?] [da_mac=?] [eth_type=?] [vlan_id=?] [misc=?] [sci=?] [mask=?] [flow_index=?]\n"
-		"  rule_index:value\n"
-		"  sa_mac:    value\n"
-		"  da_mac:    value\n"
-		"  eth_type:  value\n"
-		"  vlan_id:   value\n"
-		"  misc:      value\n"
-		"  sci:       value\n"
-		"  mask:      value\n"
-		"  flow_index:value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_rule",
-		"Configure egress SA match rule parameters",
-		"gpy2xx_msec_config_egr_sam_rule [rule_index=?] [sa_mac=?] [da_mac=?] [eth_type=?] [vlan_id=?] [misc=?] [sci=?] [mask=?] [flow_index=?]\n"
-		"  rule_index:value\n"
-		"  sa_mac:    value\n"
-		"  da_mac:    value\n"
-		"  eth_type:  value\n"
-		"  vlan_id:   value\n"
-		"  misc:      value\n"
-		"  sci:       value\n"
-		"  mask:      value\n"
-		"  flow_index:value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sam_rule",
-		"Get ingress SA match rule parameters",
-		"gpy2xx_msec_get_ing_sam_rule [rule_index=?]\n"
-		"  rule_index: value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sam_rule",
-		"Get egress SA match rule parameters",
-		"gpy2xx_msec_get_egr_sam_rule [rule_index=?]\n"
-		"  rule_index: value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_fca",
-		"Configure ingress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_config_ing_sam_fca [flow_index=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [crypt_auth=?] [drop_act=?] [sa_index=?] [rep_protect=?] [sa_inuse=?] [validate_level=?] [conf_offset=?]\n"
-		"  flow_index: 	 value\n"
-		"  flow_type:    value\n"
-		"  dest_port:    value\n"
-		"  drop_nonres:  value\n"
-		"  crypt_auth:   value\n"
-		"  drop_act:   	 value\n"
-		"  sa_index:     value\n"
-		"  rep_protect:  value\n"
-		"  sa_inuse:     value\n"
-		"  validate_level:value\n"
-		"  conf_offset:  value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_fca",
-		"Configure egress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_config_egr_sam_fca [flow_index=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [crypt_auth=?] [drop_act=?] [sa_index=?] [frame_protect=?] [sa_inuse=?] [include_sci=?] [use_es=?] [use_scb=?] [tag_bpsize=?] [sa_indup=?] [conf_offset=?] [conf_protect=?]\n"
-		"  flow_index:	 value\n"
-		"  flow_type:	 value\n"
-		"  dest_port:	 value\n"
-		"  drop_nonres:  value\n"
-		"  crypt_auth:	 value\n"
-		"  drop_act:	 value\n"
-		"  sa_index:	 value\n"
-		"  frame_protect:value\n"
-		"  sa_inuse:	 value\n"
-		"  include_sci:  value\n"
-		"  use_es:		 value\n"
-		"  use_scb: 	 value\n"
-		"  tag_bpsize:	 value\n"
-		"  sa_indup:	 value\n"
-		"  conf_offset:  value\n"
-		"  conf_protect: value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sam_fca",
-		"Get ingress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_get_ing_sam_fca [flow_index=?]\n"
-		"  flow_index: 	value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sam_fca",
-		"Get ingress SA matching rule's flow control action parameters",
-		"gpy2xx_msec_get_egr_sam_fca [flow_index=?]\n"
-		"  flow_index: 	value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_tr",
-		"Clears ingress transform record",
-		"gpy2xx_msec_clear_ing_tr [sa_index=?]\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_tr",
-		"Clears egress transform record",
-		"gpy2xx_msec_clear_egr_tr [sa_index=?]\n"
-		"  sa_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_sam_rule",
-		"Clears ingress SAM rule parameters",
-		"gpy2xx_msec_clear_ing_sam_rule [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_sam_rule",
-		"Clears egress SAM rule parameters",
-		"gpy2xx_msec_clear_egr_sam_rule [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_sam_fca",
-		"Clears ingress SAM flow control parameters",
-		"gpy2xx_msec_clear_ing_sam_fca [flow_index=?]\n"
-		"  flow_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_sam_fca",
-		"Clears egress SAM flow control parameters",
-		"gpy2xx_msec_clear_egr_sam_fca [flow_index=?]\n"
-		"  flow_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_vlan_parse",
-		"Configure ingress SA match VLAN control parameters",
-		"gpy2xx_msec_config_ing_vlan_parse [qinq_en=?] [stag_en=?] [qtag_en=?]\n"
-		"  qinq_en: value\n"
-		"  stag_en: value\n"
-		"  qtag_en: value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_vlan_parse",
-		"Configure egress SA match VLAN control parameters",
-		"gpy2xx_msec_config_egr_vlan_parse [qinq_en=?] [stag_en=?] [qtag_en=?]\n"
-		"  qinq_en: value\n"
-		"  stag_en: value\n"
-		"  qtag_en: value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_eex",
-		"Configure ingress SA match entry enable flags",
-		"gpy2xx_msec_config_ing_sam_eex [eex_type=?] [eex_word0=?]\n"
-		"  eex_type:  value\n"
-		"  eex_word0: value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_eex",
-		"Configure egress SA match entry enable flags",
-		"gpy2xx_msec_config_egr_sam_eex [eex_type=?] [eex_word0=?]\n"
-		"  eex_type:  value\n"
-		"  eex_word0: value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sam_eef",
-		"Get ingress SA match entry enable flags",
-		"gpy2xx_msec_get_ing_sam_eef [word_num=?]\n"
-		"  word_num: value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sam_eef",
-		"Get egress SA match entry enable flags",
-		"gpy2xx_msec_get_egr_sam_eef [word_num=?]\n"
-		"  word_num: value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sam_eec",
-		"Configure ingress SA match entry enable clear",
-		"gpy2xx_msec_config_ing_sam_eec [sam_ind_set=?] [set_single=?] [set_all=?] [sam_ind_clr=?] [clr_single=?] [clr_all=?]\n"
-		"  sam_ind_set: value\n"
-		"  set_single:  value\n"
-		"  set_all:     value\n"
-		"  sam_ind_clr: value\n"
-		"  clr_single:  value\n"
-		"  clr_all:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sam_eec",
-		"Configure egress SA match entry enable clear",
-		"gpy2xx_msec_config_egr_sam_eec [sam_ind_set=?] [set_single=?] [set_all=?] [sam_ind_clr=?] [clr_single=?] [clr_all=?]\n"
-		"  sam_ind_set: value\n"
-		"  set_single:  value\n"
-		"  set_all:     value\n"
-		"  sam_ind_clr: value\n"
-		"  clr_single:  value\n"
-		"  clr_all:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_rule",
-		"Configure ingress consistency check match parameters",
-		"gpy2xx_msec_config_ing_cc_rule [icc_index=?] [eth_type=?] [misc=?] \n"
-		"  icc_index:   value\n"
-		"  eth_type: 	value\n"
-		"  misc:        value\n"
-	},
-	{
-		"gpy2xx_msec_get_ing_cc_rule",
-		"Configure ingress consistency check match parameters",
-		"gpy2xx_msec_get_ing_cc_rule [icc_index=?]\n"
-		"  icc_index:	value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_eef",
-		"Configure ingress consistency check entry enable flags",
-		"gpy2xx_msec_config_ing_cc_eef [eec_word0=?]\n"
-		"  eec_word0:	value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_cc_eef",
-		"Get ingress consistency check entry enable flags",
-		"gpy2xx_msec_get_ing_cc_eef \n"
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_eec",
-		"Configure ingress CC match entry enable clear",
-		"gpy2xx_msec_config_ing_cc_eec [icc_ind_set=?] [set_single=?] [set_all=?] [icc_ind_clr=?] [clr_single=?] [clr_all=?]\n"
-		"  icc_ind_set:value\n"
-		"  set_single: value\n"
-		"  set_all:    value\n"
-		"  icc_ind_clr:value\n"
-		"  clr_single: value\n"
-		"  clr_all:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cc_ctrl",
-		"Configure ingress consistency check control",
-		"gpy2xx_msec_config_ing_cc_ctrl [nm_act=?] [nm_ctrl_act=?] [etype_max_len=?]\n"
-		"  nm_act:        value\n"
-		"  nm_ctrl_act:   value\n"
-		"  etype_max_len: value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sa_stats",
-		"Get ingress SA statistics",
-		"gpy2xx_msec_get_ing_sa_stats [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sa_stats",
-		"Get egress SA statistics",
-		"gpy2xx_msec_get_egr_sa_stats [rule_index=?]\n"
-		"  rule_index:  value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_global_stats",
-		"Get ingress global statistics",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_global_stats",
-		"Get egress global statistics",
-		NULL
-	},
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-	{
-		"gpy2xx_msec_get_ing_debug_stats",
-		"Get ingress debug statistics",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_debug_stats",
-		"Get egress debug statistics",
-		NULL
-	},
+int pc_uart_datawrite(u32 Offset, u32 value)
+{
+#if RAPID_UART
+	char buf[256];
+	DWORD written;
+	int size;
+
+	size = snprintf(buf, ARRAY_SIZE(buf), "w %04x %04x\n", Offset & 0xFFFF, value & 0xFFFF);
+
+	if (debugenable) {
+		LOG_CRIT("%s", buf);
+	}
+
+	written = 0;
+
+	if (!WriteFile(hComm,
+		       buf,
+		       (DWORD)size,
+		       &written,
+		       NULL)) {
+		printf("\nWrite COM fail\n");
+		return -1;
+	}
+
+	return 1;
+#else
+	DWORD BytestoWrite;
+	DWORD BytesWritten = 0;
+	DWORD dwEventMask;
+	unsigned char Temp_Char;
+	unsigned char uart_Buffer[256];
+	char writebuffer[15];
+	unsigned char readbuffer[15];
+	unsigned int i;
+	unsigned int h = 0;
+	DWORD No_BytesRead;
+	BytestoWrite = sizeof(writebuffer);
+
+	if (debugenable) {
+		printf("\n\n#############");
+		printf("\nwrite original offset  -> %x", Offset);
+	}
+
+	memset(uart_Buffer, 0, 256);
+	memset(writebuffer, 0, 15);
+	memset(readbuffer, 0, 15);
+
+#if !(defined(GPY211_PC_TEST) && GPY211_PC_TEST)
+	snprintf(writebuffer, ARRAY_SIZE(writebuffer), "w %x %04x\n", (Offset & 0xfffff), value);
+#else
+	snprintf(writebuffer, ARRAY_SIZE(writebuffer), "w %x %04x\n", (Offset & 0xffff), value);
 #endif
-	{
-		"gpy2xx_msec_config_ing_count_ctrl",
-		"Configure ingress count control",
-		"gpy2xx_msec_config_ing_count_ctrl [rst_all=?] [ctr_saturate=?] [ctr_conr=?] [rst_summary=?]\n"
-		"  rst_all:       value\n"
-		"  ctr_saturate:  value\n"
-		"  ctr_conr:      value\n"
-		"  rst_summary:   value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_count_ctrl",
-		"Configure egress count controls",
-		"gpy2xx_msec_config_egr_count_ctrl [rst_all=?] [ctr_saturate=?] [ctr_conr=?] [rst_summary=?]\n"
-		"  rst_all:       value\n"
-		"  ctr_saturate:  value\n"
-		"  ctr_conr:      value\n"
-		"  rst_summary:   value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_count_incen",
-		"Configure ingress counter increment enables",
-		"gpy2xx_msec_config_ing_count_incen [sa_inc=?] [vlan_inc=?] [global_inc=?]\n"
-		"  sa_inc:        value\n"
-		"  vlan_inc:      value\n"
-		"  global_inc: 	  value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_count_incen",
-		"Configure egress counter increment enables",
-		"gpy2xx_msec_config_egr_count_incen [sa_inc=?] [vlan_inc=?] [global_inc=?]\n"
-		"  sa_inc:        value\n"
-		"  vlan_inc:	  value\n"
-		"  global_inc: 	  value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_count_secfail",
-		"Configure ingress secfail event trigger enables",
-		"gpy2xx_msec_config_ing_count_secfail [misc_secfail=?] [global_secfail=?]\n"
-		"  misc_secfail:    value\n"
-		"  global_secfail:	value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_count_secfail",
-		"Configure egress secfail event trigger enables",
-		"gpy2xx_msec_config_egr_count_secfail [misc_secfail=?] [global_secfail=?]\n"
-		"  misc_secfail:    value\n"
-		"  global_secfail:	value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_count_thresh",
-		"Configure ingress counter packet and octet thresholds",
-		"gpy2xx_msec_config_ing_count_thresh [frame_thr=?] [octet_thr=?]\n"
-		"  frame_thr:	 value\n"
-		"  octet_thr:	 value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_count_thresh",
-		"Get ingress counter packet and octet thresholds",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_egr_count_thresh",
-		"Configure egress counter packet and octet thresholds",
-		"gpy2xx_msec_config_egr_count_thresh [frame_thr=?] [octet_thr=?]\n"
-		"  frame_thr:	 value\n"
-		"  octet_thr:	 value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_count_thresh",
-		"GEt egress counter packet and octet thresholds",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_ing_misc_ctrl",
-		"Configure ingress misc control",
-		"gpy2xx_msec_config_ing_misc_ctrl [mc_latency=?] [static_bp=?] [nm_macsec=?] [validate_frames=?] [sectag_avlan=?]\n"
-		"  mc_latency:       value\n"
-		"  static_bp         value\n"
-		"  nm_macsec:        value\n"
-		"  validate_frames:  value\n"
-		"  sectag_avlan:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_misc_ctrl",
-		"Configure egress misc control",
-		"gpy2xx_msec_config_egr_misc_ctrl [mc_latency=?] [static_bp=?] [nm_macsec=?] [validate_frames=?] [sectag_avlan=?]\n"
-		"  mc_latency:       value\n"
-		"  static_bp         value\n"
-		"  nm_macsec:        value\n"
-		"  validate_frames:  value\n"
-		"  sectag_avlan:     value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_ctrl",
-		"Configure ingress no-match classifier control",
-		"gpy2xx_msec_config_ing_sa_nm_ctrl [comp_etype=?] [check_ver=?] [check_kay=?] [check_ce=?] [check_sc=?] [check_sl=?] [check_pn=?] [msec_eth=?]\n"
-		"  comp_etype:      dis/en\n"
-		"  check_ver        dis/en\n"
-		"  check_kay:       dis/en\n"
-		"  check_ce:  		dis/en\n"
-		"  check_sc:     	dis/en\n"
-		"  check_sl:     	dis/en\n"
-		"  check_pn:     	dis/en\n"
-		"  msec_eth:        value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_ctrl",
-		"Configure egress no-match classifier control",
-		"gpy2xx_msec_config_egr_sa_nm_ctrl [comp_etype=?] [check_ver=?] [check_kay=?] [check_ce=?] [check_sc=?] [check_sl=?] [check_pn=?] [msec_eth=?]\n"
-		"  comp_etype:		dis/en\n"
-		"  check_ver 		dis/en\n"
-		"  check_kay:		dis/en\n"
-		"  check_ce: 		dis/en\n"
-		"  check_sc: 		dis/en\n"
-		"  check_sl: 		dis/en\n"
-		"  check_pn: 		dis/en\n"
-		"  msec_eth: 		value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_ncp",
-		"Configure ingress SA non-match flow control action for non-control packet",
-		"gpy2xx_msec_config_ing_sa_nm_ncp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_nonres:    value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_ncp",
-		"Configure egress SA non-match flow control action for non-control packet",
-		"gpy2xx_msec_config_egr_sa_nm_ncp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_sa_nm_cp",
-		"Configure ingress SA non-match flow control action for control packet",
-		"gpy2xx_msec_config_ing_sa_nm_cp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_nonres=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_nonres:    value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_sa_nm_cp",
-		"Configure egress SA non-match flow control action for control packet",
-		"gpy2xx_msec_config_egr_sa_nm_cp [pkt_type=?] [flow_type=?] [dest_port=?] [drop_action=?]\n"
-		"  pkt_type:       value\n"
-		"  flow_type       value\n"
-		"  dest_port:      value\n"
-		"  drop_action:    value\n",
-	},
-	{
-		"gpy2xx_msec_clear_ing_stats_summ",
-		"Configure ingress SA expired/pn-thr/psa summary",
-		"gpy2xx_msec_clear_ing_stats_summ [psa_summ0=?] [glb_summ=?]\n"
-		"  psa_summ0:       value\n"
-		"  glb_summ:        value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_stats_summ",
-		"Configure egress SA expired/pn-thr/psa summary",
-		"gpy2xx_msec_clear_egr_stats_summ [psa_summ0=?] [glb_summ=?]\n"
-		"  psa_summ0:       value\n"
-		"  glb_summ:        value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_stats_summ",
-		"Get ingress SA expired/pn-thr/psa summary",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_stats_summ",
-		"Get egress SA expired/pn-thr/psa summary",
-		NULL
-	},
-	{
-		"gpy2xx_msec_clear_ing_psa_stats_summ",
-		"Clears ingress per-SA statistics summary",
-		"gpy2xx_msec_clear_ing_psa_stats_summ [psa_type=?] [rule_index=?] [psa_summ0=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n"
-		"  psa_summ0:        value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_psa_stats_summ",
-		"Get ingress per-SA statistics summary",
-		"gpy2xx_msec_get_ing_psa_stats_summ [psa_type=?] [rule_index=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n",
-	},
-	{
-		"gpy2xx_msec_clear_egr_psa_stats_summ",
-		"Clears egress per-SA statistics summary",
-		"gpy2xx_msec_clear_egr_psa_stats_summ [psa_type=?] [rule_index=?] [psa_summ0=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n"
-		"  psa_summ0:        value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_psa_stats_summ",
-		"Get egress per-SA statistics summary",
-		"gpy2xx_msec_get_egr_psa_stats_summ [psa_type=?] [rule_index=?]\n"
-		"  psa_type:         value\n"
-		"  rule_index:       value\n",
-	},
-	{
-		"gpy2xx_msec_config_ing_cp_rule",
-		"Configure ingress control packet classification rule",
-		"gpy2xx_msec_config_ing_cp_rule [cpc_index=?] [entry_type=?] [da_mac=?] [da_end=?] [eth_type=?] [cpm_mode=?] [cpm_en=?]\n"
-		"  cpc_index:       value\n"
-		"  entry_type:      value\n"
-		"  da_mac:          value\n"
-		"  da_end:          value\n"
-		"  eth_type:        value\n"
-		"  cpm_mode:        value\n"
-		"  cpm_en:          value\n",
-	},
-	{
-		"gpy2xx_msec_config_egr_cp_rule",
-		"Configure engress control packet classification rule",
-		"gpy2xx_msec_config_egr_cp_rule [cpc_index=?] [entry_type=?] [da_mac=?] [da_end=?] [eth_type=?] [cpm_mode=?] [cpm_en=?]\n"
-		"  cpc_index:       value\n"
-		"  entry_type:      value\n"
-		"  da_mac:          value\n"
-		"  da_end:          value\n"
-		"  eth_type:        value\n"
-		"  cpm_mode:        value\n"
-		"  cpm_en:          value\n",
-	},
-	{
-		"gpy2xx_msec_clear_sa_pn_thr_summ",
-		"Clear OPP's SA PN threshold summary flags",
-		"gpy2xx_msec_clear_sa_pn_thr_summ [pnthr_summ0=?]\n"
-		"  pnthr_summ0:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_sa_pn_thr_summ",
-		"Get OPP's SA PN threshold summary flags",
-		NULL
-	},
-	{
-		"gpy2xx_msec_clear_egr_sa_exp_summ",
-		"Clear SA expired summary flags",
-		"gpy2xx_msec_clear_egr_sa_exp_summ [saexp_summ0=?]\n"
-		"  saexp_summ0:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sa_exp_summ",
-		"Gets SA expired summary flags",
-		NULL
-	},
-	{
-		"gpy2xx_msec_clear_ing_cc_int_stat",
-		"Clear crypto-cores's context, HW / SW interrupt status",
-		"gpy2xx_msec_clear_ing_cc_int_stat [ctx_stat=?] [int_stat=?]\n"
-		"  ctx_stat:     value\n"
-		"  int_stat:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_cc_int_stat",
-		"Get crypto-cores's context, HW / SW interrupt status",
-		NULL
-	},
-	{
-		"gpy2xx_msec_clear_egr_cc_int_stat",
-		"Clear crypto-cores's context, HW / SW interrupt status",
-		"gpy2xx_msec_clear_egr_cc_int_stat [ctx_stat=?] [int_stat=?]\n"
-		"  ctx_stat:     value\n"
-		"  int_stat:     value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_cc_int_stat",
-		"Get crypto-cores's context, HW / SW interrupt status",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_ing_sn_thresh",
-		"Configures the ingress sequence number threshold",
-		"gpy2xx_msec_config_ing_sn_thresh [sn_type=?] [sn_thr=?]\n"
-		"  sn_type:    	value\n"
-		"  sn_thr:     	value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_sn_thresh",
-		"Gets the ingress Sequence Number threshold",
-		"gpy2xx_msec_get_ing_sn_thresh [sn_type=?]\n"
-		"sn_type:    1 - SN_32_BIT / 2 - SN_64_BIT",
-	},
-	{
-		"gpy2xx_msec_config_egr_sn_thresh",
-		"Configures the egress sequence number threshold",
-		"gpy2xx_msec_config_egr_sn_thresh [sn_type=?] [sn_thr=?]\n"
-		"  sn_type:    	value\n"
-		"  sn_thr:     	value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_sn_thresh",
-		"Gets the ingress squence number threshold",
-		"gpy2xx_msec_get_egr_sn_thresh [sn_type=?]\n"
-		"sn_type:	 1 - SN_32_BIT / 2 - SN_64_BIT",
 
-	},
-	{
-		"gpy2xx_msec_config_ing_aic_csr",
-		"Configures the ingress interrupt  controll and status options",
-		"gpy2xx_msec_config_ing_aic_csr [enable_ctrl=?] [ack=?] [enable_set=?] [enable_clr=?]\n"
-		"  enable_ctrl:		value\n"
-		"  ack:    			value\n"
-		"  enable_set:    	value\n"
-		"  enable_clr:     	value\n",
-	},
-	{
-		"gpy2xx_msec_get_ing_aic_csr",
-		"Gets the ingress interrupt  controll and status options",
-		NULL
-	},
-	{
-		"gpy2xx_msec_config_egr_aic_csr",
-		"Configures the egress interrupt  controll and status options",
-		"gpy2xx_msec_config_egr_aic_csr [enable_ctrl=?] [ack=?] [enable_set=?] [enable_clr=?]\n"
-		"  enable_ctrl:		value\n"
-		"  ack:    			value\n"
-		"  enable_set:    	value\n"
-		"  enable_clr:     	value\n",
-	},
-	{
-		"gpy2xx_msec_get_egr_aic_csr",
-		"Gets the egress interrupt  controll and status options",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_ing_cap",
-		"Gets the ingress HW capabilities",
-		NULL
-	},
-	{
-		"gpy2xx_msec_get_egr_cap",
-		"Gets the egress HW capabilities",
-		NULL
-	},
-	{
-		"gpy2xx_usxgmii_reach_cfg",
-		"Configures the USXGMII reach customer setting according to master slice (slice 0)",
-		"gpy2xx_usxgmii_reach_cfg trace_len=? [tx_eq_main=?] [tx_eq_pre=?] [tx_eq_post=?] [tx_vboost_en=?] [tx_vboost_lvl=?] [tx_iboost_lvl=?] [rx_eq_att_lvl=?] [rx_eq_vga1_gain=?] [rx_eq_vga2_gain=?] [rx_eq_ctle_boost=?] [rx_eq_ctle_pole=?] [rx_eq_dfe_tap1=?] [rx_afe_adapt_en=?] [rx_dfe_adapt_en=?]\n"
-		"trace_len:         0-short, 1-medium, 2-long, 3-custom\n"
-		"tx_eq_main:        0x00 - 0x3F\n"
-		"tx_eq_pre:         0x00 - 0x3F\n"
-		"tx_eq_post:        0x00 - 0x3F\n"
-		"tx_vboost_en:      0 - disable, 1 - enable\n"
-		"tx_vboost_lvl:     0x00 - 0x07\n"
-		"tx_iboost_lvl:     0x00 - 0x07\n"
-		"rx_eq_att_lvl:     0x00 - 0x07\n"
-		"rx_eq_vga1_gain:   0x00 - 0x0F\n"
-		"rx_eq_vga2_gain:   0x00 - 0x0F\n"
-		"rx_eq_ctle_boost:  0x00 - 0x1F\n"
-		"rx_eq_ctle_pole:   0x00 - 0x07\n"
-		"rx_eq_dfe_tap1:    0x00 - 0xFF\n"
-		"rx_afe_adapt_en:	0 - disable, 1 - enable\n"
-		"rx_dfe_adapt_en:	0 - disable, 1 - enable\n",
-	},
-	{
-		"gpy2xx_usxgmii_reach_get",
-		"Get the USXGMII reach setting",
-		NULL
-	},
+	if (debugenable) {
+		printf(", write ->\"%s\"\n", writebuffer);
+	}
+
+	WriteFile(hComm,
+		  writebuffer,
+		  BytestoWrite,
+		  &BytesWritten,
+		  NULL);
+	i = 0;
+	SetCommMask(hComm, EV_RXCHAR);
+	WaitCommEvent(hComm, &dwEventMask, NULL);
+
+	do {
+		ReadFile(hComm,
+			 &Temp_Char,
+			 sizeof(Temp_Char),
+			 &No_BytesRead,
+			 NULL);
+
+		uart_Buffer[i] = Temp_Char;
+		i++;
+	} while (No_BytesRead > 0);
+
+	//printf("\nraw (etc write )read from uar\n%s\n",uart_Buffer);
+	if (uart_Buffer[0] == 'w' && uart_Buffer[1] == ' ') {
+	} else {
+		system("color 0c");
+		printf("\n\nALERT :Selected COMPORT not functioning properly ( Reg Write fail)\n\n");
+		printf("1. Please Check whether the Device Under Test is ON\n");
+		printf("2. Please Check the COMPORT connection\n");
+		printf("\nApplication exit in 10 seconds\n");
+		Sleep(10000);
+		scanf("%u", &h);
+		//exit(0);
+		return -1;
+	}
+
+	return 1;
+#endif
+}
+
+#if ENABLE_UART_32BIT_ACCESS
+int pc_uart_dataread_32(u32 Offset, u32 *value)
+{
+	DWORD BytestoWrite;
+	DWORD BytesWritten = 0;
+	DWORD dwEventMask;
+	unsigned char Temp_Char;
+	unsigned char uart_Buffer[100];
+	char writebuffer[50];
+	unsigned char readbuffer[50];
+	unsigned int i = 0;
+	unsigned int h = 0;
+
+	DWORD No_BytesRead;
+
+	if (debugenable) {
+		printf("\n\n#############");
+		printf("\nread original offset  -> %x", Offset);
+	}
+
+	BytestoWrite = sizeof(writebuffer);
+
+	memset(uart_Buffer, 0, 100);
+	memset(writebuffer, 0, 50);
+	memset(readbuffer, 0, 50);
+
+	sprintf(writebuffer, "r %05x\n", (Offset));
+
+	if (debugenable) {
+		printf("read  -> %s\n", writebuffer);
+	}
+
+	WriteFile(hComm,
+		  writebuffer,
+		  BytestoWrite,
+		  &BytesWritten,
+		  NULL);
+	i = 0;
+	SetCommMask(hComm, EV_RXCHAR);
+	WaitCommEvent(hComm, &dwEventMask, NULL);
+
+	do {
+		ReadFile(hComm,
+			 &Temp_Char,
+			 sizeof(Temp_Char),
+			 &No_BytesRead,
+			 NULL);
+
+		uart_Buffer[i] = Temp_Char;
+		i++;
+	} while (No_BytesRead > 0);
+
+	//printf("\nraw (etc read) from uart\n%s\n",uart_Buffer);
+
+	if (uart_Buffer[0] == 'r' && uart_Buffer[1] == ' ') {
+		readbuffer[0] = uart_Buffer[9];
+		readbuffer[1] = uart_Buffer[10];
+		readbuffer[2] = uart_Buffer[11];
+		readbuffer[3] = uart_Buffer[12];
+		readbuffer[4] = uart_Buffer[13];
+		readbuffer[5] = uart_Buffer[14];
+		readbuffer[6] = uart_Buffer[15];
+		readbuffer[7] = uart_Buffer[16];
+	} else {
+		system("color 0c");
+		printf("\n\nALERT :Selected COMPORT not functioning properly (Reg read fail)\n\n");
+		printf("1. Please Check whether the Device Under Test is ON\n");
+		printf("2. Please Check the COMPORT connection\n");
+		printf("\nApplication exit in 10 seconds\n");
+		Sleep(10000);
+		scanf("%u", &h);
+
+		//exit(0);
+		return -1;
+	}
+
+	//printf("\nread buffer= %s\n",readbuffer);
+
+	*value = str_to_hex(readbuffer);
+
+	if (debugenable) {
+		printf("Read Back Value = %08x\n\n", *value);
+	}
+
+	return 1;
+}
+
+int pc_uart_datawrite_32(u32 Offset, u32 value)
+{
+	DWORD BytestoWrite;
+	DWORD BytesWritten = 0;
+	DWORD dwEventMask;
+	unsigned char Temp_Char;
+	unsigned char uart_Buffer[100];
+	char writebuffer[50];
+	unsigned char readbuffer[50];
+	unsigned int i;
+	unsigned int h = 0;
+	DWORD No_BytesRead;
+	BytestoWrite = sizeof(writebuffer);
+
+	if (debugenable) {
+		printf("\n\n#############");
+		printf("\nwrite original offset  -> %x", Offset);
+	}
+
+	memset(uart_Buffer, 0, 100);
+	memset(writebuffer, 0, 50);
+	memset(readbuffer, 0, 50);
+
+	sprintf(writebuffer, "w %05x %08x\n", (Offset), value);
+
+	if (debugenable) {
+		printf("write ->%s\n", writebuffer);
+	}
+
+	WriteFile(hComm,
+		  writebuffer,
+		  BytestoWrite,
+		  &BytesWritten,
+		  NULL);
+	i = 0;
+	SetCommMask(hComm, EV_RXCHAR);
+	WaitCommEvent(hComm, &dwEventMask, NULL);
 
-	{
-		"gpy2xx_usxgmii_loopback_cfg",
-		"Configures the USXGMII serial and parrallel loop back",
-		"gpy2xx_usxgmii_loopback_cfg [mode=?]\n"
-		"Loopback Mode\n"
-		"enum mode\n"
-		"	USXGMII_LOOPBACK_DISABLE = 0,\n"
-		"	USXGMII_LOOPBACK_TX2RX   = 1,\n"
-		"	USXGMII_LOOPBACK_RX2TX   = 2,\n",
-	},
+	do {
+		ReadFile(hComm,
+			 &Temp_Char,
+			 sizeof(Temp_Char),
+			 &No_BytesRead,
+			 NULL);
 
-	{
-		"gpy2xx_usxgmii_loopback_get",
-		"Get the USXGMII reach loop back setting",
-		NULL
-	},
+		uart_Buffer[i] = Temp_Char;
+		i++;
+	} while (No_BytesRead > 0);
 
-	{
-		"gpy2xx_usxgmii_tx_bert_cfg",
-		"Configures TX bert",
-		"gpy2xx_usxgmii_tx_bert_cfg  [mode=?] [nval_sel=?]\n"
-		"tx bert mode configuration\n"
-		"enum mode\n"
-		"	BERT_SQUAREWAVE_TX = 0\n"
-		"	BERT_PSEUDO_RANDOM_TX = 1\n"
-		"	BERT_PRBS31_TX = 2\n"
-		"	BERT_PRBS9_TX = 3\n"
-		"	BERT_TX_MODE_DISABLE = 4\n"
-		"Square Wave Control When square wave test pattern generation is enabled\n"
-		"enum nval_sel\n"
-		"	BERT_TX_NVAL_SEL_4 = 0\n"
-		"	BERT_TX_NVAL_SEL_5 = 1\n"
-		"	BERT_TX_NVAL_SEL_6 = 2\n"
-		"	BERT_TX_NVAL_SEL_7 = 3\n"
-		"	BERT_TX_NVAL_SEL_8 = 4\n"
-		"	BERT_TX_NVAL_SEL_9 = 5\n"
-		"	BERT_TX_NVAL_SEL_10 = 6\n"
-		"	BERT_TX_NVAL_SEL_11 = 7\n"
-		"	BERT_TX_NVAL_SEL_UNSUPPORTED = 8\n",
-	},
+	//printf("\nraw (etc write )read from uar\n%s\n",uart_Buffer);
+	if (uart_Buffer[0] == 'w' && uart_Buffer[1] == ' ') {
+	} else {
+		system("color 0c");
+		printf("\n\nALERT :Selected COMPORT not functioning properly ( Reg Write fail)\n\n");
+		printf("1. Please Check whether the Device Under Test is ON\n");
+		printf("2. Please Check the COMPORT connection\n");
+		printf("\nApplication exit in 10 seconds\n");
+		Sleep(10000);
+		scanf("%u", &h);
+		//exit(0);
+		return -1;
+	}
 
-	{
-		"gpy2xx_usxgmii_rx_bert_cfg",
-		"Configures RX bert",
-		"gpy2xx_usxgmii_rx_bert_cfg  [mode=?]\n"
-		"rx bert mode configuration\n"
-		"enum mode\n"
-		"	BERT_PSEUDO_RANDOM_RX = 0\n"
-		"	BERT_PRBS31_RX = 1\n"
-		"	BERT_PRBS9_RX = 2\n"
-		"	BERT_RX_MODE_DISABLE = 3\n",
-	},
+	return 1;
+}
+#endif
 
-	{
-		"gpy2xx_usxgmii_tx_bert_get",
-		"Get TX bert configuration setting",
-		NULL
-	},
+#if (defined(GPY211_PC_TEST) && GPY211_PC_TEST)
+static char *findArgParam(int argc, char *argv[], char *name)
+{
+	int i = 0;
+	size_t len;
 
-	{
-		"gpy2xx_usxgmii_rx_bert_get",
-		"Get RX bert configuration setting",
-		NULL
-	},
+	len = strlen(name);
 
-	{
-		"gpy2xx_usxgmii_mii_linksts",
-		"Get Port mii linkstatus (port 0 to 3 link status based on the phy address)",
-		NULL
-	},
+	for (i = 0; i < argc; i++) {
+		if (xstrncasecmp(name, argv[i], len) == 0) {
+			if (strlen(argv[i]) > (len + 1)) {
 
-	{
-		"gpy2xx_usxgmii_aneg_sts",
-		"Get Port ANEG status (port 0 to 3 ANEG status based on the phy address)",
-		NULL
-	},
+				if ('=' == argv[i][len]) {
+					return argv[i] + len + 1;
+				}
+			}
+		}
+	}
 
-	{
-		"gpy2xx_usxgmii_pcs_pma_linksts",
-		"Get PMA and PCS link status",
-		NULL
-	},
+	return NULL;
+}
 
-	{
-		"gpy2xx_usxgmii_vr_reset",
-		"Trigger VR reset",
-		NULL
-	},
+/* Parse a number or one of the boolean words, 0 if ptr is not a value */
+static int parse_num(char *ptr, unsigned long long int *val)
+{
+	char *endptr;
 
-	{
-		"gpy2xx_usxgmii_vr_reset_sts",
-		"Get VR reset complete status",
-		NULL
-	},
+	/* check if the given parameter value are the boolean "LTQ_TRUE" / "LTQ_FALSE" */
 
-	{
-		"gpy2xx_usxgmii_aneg_rst",
-		"Configures ANEG for Port 0 to 3 (based on phy address)",
-		"gpy2xx_usxgmii_aneg_rst  [usxgmii_aneg_disable=?] [usxgmii_force_linkspeed_enable=?] [usxgmii_force_linkspeed=?]  [usxgmii_force_duplex=?] [usxgmii_restart_aneg=?]\n"
-		"ANEG configuration\n"
-		"aneg enable/disable for port 0 to 3 based on phy addr\n"
-		"Valid 1 - disabled / 0 - enabled\n"
-		"	usxgmii_aneg_disable\n"
-		"restart aneg for port 0 to 3 based on phy addr\n"
-		"	usxgmii_restart_aneg\n"
-		"force link enable for port 0 to 3 based on phy addr\n"
-		"Valid 0 - disabled / 1 - enabled\n"
-		"	usxgmii_force_linkspeed\n"
-		"force link speed for port 0 to 3 based on phy addr\n"
-		"	usxgmii_force_linkspeed\n"
-		"		SPEED_10	10\n"
-		"		SPEED_100	100\n"
-		"		SPEED_1000	1000\n"
-		"		SPEED_2500	2500\n"
-		"		SPEED_UNKNOWN	-1\n"
-		"force duplex for port 0 to 3 based on phy addr\n"
-		"Valid 0 - Half duplex / 1 - Full duplex\n"
-		"	usxgmii_force_duplex\n",
-	},
+	if (0 == xstrncasecmp(ptr, "LTQ_TRUE", strlen(ptr))
+	    || 0 == xstrncasecmp(ptr, "TRUE", strlen(ptr))
+	    || 0 == xstrncasecmp(ptr, "FULL", strlen(ptr))) {
+		*val = 1;
+	} else if (0 == xstrncasecmp(ptr, "LTQ_FALSE", strlen(ptr))
+		   || 0 == xstrncasecmp(ptr, "FALSE", strlen(ptr))
+		   || 0 == xstrncasecmp(ptr, "HALF", strlen(ptr))) {
+		*val = 0;
+	} else {
+		/* scan for a number */
+		*val = strtoull(ptr, &endptr, 0);
 
-	{
-		"gpy2xx_usxgmii_alignmentmarker_get",
-		"Get AM_COUNT",
-		NULL
-	},
+		/* parameter detection does not work in case there are more character after the provided number */
+		if (*endptr != '\0')
+			return 0;
+	}
 
-	{
-		"gpy2xx_usxgmii_alignmentmarker_set",
-		"Configures AM count",
-		"gpy2xx_usxgmii_alignmentmarker_set [usxgmii_am_count=?]\n"
-		"AM Count\n"
-		"Valid 0x00 - 0x7FFF\n"
-		"	usxgmii_am_count\n",
-	},
+	return 1;
+}
 
-	{
-		"gpy2xx_usxgmii_rx_bert_stat",
-		"Get BERT stats",
-		NULL
-	},
+/* Store val into a field of size bytes */
+static void store_num(unsigned long long int val, unsigned int size, void *param)
+{
+	if (size == 1)
+		*((char *)param) = (char)val;
+	else if (size == 2)
+		*((short *)param) = (short)val;
+	else if (size == 4)
+		*((int *)param) = (int)val;
+	else if (size == 8)
+		*((long long *)param) = (long long)val;
+}
 
-};
+int scanParamArg(int argc, char *argv[], char *name, int size, void *param)
+{
+	unsigned long long int tmp;
+
+	char *ptr = findArgParam(argc, argv, name);
+
+	if (ptr == NULL) return 0;
+
+	if (!parse_num(ptr, &tmp))
+		return 0;
+
+	/* size is in bytes up to 4, in bits beyond */
+	store_num(tmp, size <= 4 ? size : size / 8, param);
 
-static void gpy211_menu(const char *cmd)
+	return 1;
+}
+
+int scanMAC_Arg(int argc, char *argv[], char *name, unsigned char *param)
 {
-	unsigned int len, max_len;
-	unsigned int i;
+	char *ptr = findArgParam(argc, argv, name);
 
-	if (cmd == NULL) {
-		printf("\n\n\n\tGPY211 Utility Tool Version   : %s", TOOL_VERSION);
-		printf("\n\t*************************************\n\n");
+	if (ptr == NULL) return 0;
 
-		max_len = 0;
+	return convert_mac_adr_str(ptr, param);
+}
 
-		for (i = 0; i < ARRAY_SIZE(help_text); i++) {
-			len = strlen(help_text[i].cmd);
+int scanKey_Arg(int argc, char *argv[], char *name, u8 size, char *param)
+{
+	char *ptr = findArgParam(argc, argv, name);
 
-			if (max_len < len)
-				max_len = len;
-		}
+	if (ptr == NULL) return 0;
 
-		for (i = 0; i < ARRAY_SIZE(help_text); i++) {
-			printf("\t %-*s : %s\n", max_len, help_text[i].cmd, help_text[i].brief);
-		}
+	return copy_key_to_dst(ptr, size, param);
+}
 
-		printf("\n\nIMPORTANT NOTE:\n");
-		printf("\nFor hex decimal input param please add 0x before the hex decimal number or just give decimal number");
-		printf("\nPrefix hex decimal value with 0x or GPY211 command execution will lead to wrong setting or malfunction\n");
-		printf("\n");
-	} else {
-		for (i = 0; i < ARRAY_SIZE(help_text) && strcasecmp(cmd, help_text[i].cmd) != 0; i++);
+static struct {
+	const char *name;
+	enum link_mode_bit_indices bit;
+} phy_advert[] = {
+	{"10baseT_Half", LINK_MODE_10baseT_Half_BIT},
+	{"10baseT_Full", LINK_MODE_10baseT_Full_BIT},
+	{"100baseT_Half", LINK_MODE_100baseT_Half_BIT},
+	{"100baseT_Full", LINK_MODE_100baseT_Full_BIT},
+	{"1000baseT_Half", LINK_MODE_1000baseT_Half_BIT},
+	{"1000baseT_Full", LINK_MODE_1000baseT_Full_BIT},
+	{"2500baseT_Full", LINK_MODE_2500baseT_Full_BIT},
+	{"2500baseT_FR", LINK_MODE_2500baseT_FR_BIT},
+	{"5000baseT_Full", LINK_MODE_5000baseT_Full_BIT},
+	{"5000baseT_FR", LINK_MODE_5000baseT_FR_BIT},
+	{"Autoneg", LINK_MODE_Autoneg_BIT},
+	{"Pause", LINK_MODE_Pause_BIT},
+	{"Asym_Pause", LINK_MODE_Asym_Pause_BIT},
+};
 
-		if (i >= ARRAY_SIZE(help_text))
-			return;
+/* Parse link mode names separated by '|', ',' or ';', p is modified */
+static void parse_advert(char *p, u64 *param)
+{
+	char *p1, *p2;
+	unsigned int i;
 
-		if (help_text[i].desc == NULL) {
-			printf("%s does not have parameter.\n", help_text[i].cmd);
-		} else {
-			printf("%s", help_text[i].desc);
+	*param = 0;
+
+	for (p1 = p; *p1 != 0; p1 = p2) {
+		for (p2 = p1; *p2 != 0 && *p2 != ',' && *p2 != '|' && *p2 != ';'; p2++);
+
+		if (*p2 != 0) {
+			*p2 = 0;
+			p2++;
+		}
+
+		if (*p1 == 0)
+			continue;
+
+		for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
+			if (strcasecmp(p1, phy_advert[i].name) == 0) {
+				*param |= (u64)1 << phy_advert[i].bit;
+				break;
+			}
 		}
 	}
 }
 
-static unsigned int t_olower(u32 ch)
+static int print_advert(char *buf, unsigned int size, u64 param)
 {
-	if (ch >= 'A' && ch <= 'Z')
-		return ch + 'a' - 'A';
+	char *p = buf;
+	unsigned int flag = 0;
+	unsigned int total_len = 0;
+	unsigned int len;
+	unsigned int i;
 
-	return ch;
-}
+	strncpy(buf, "none", size);
+	buf[size - 1] = 0;
 
-static unsigned int xstrncasecmp(const char *s1, const char *s2, unsigned int n)
-{
-	int c1, c2;
+	for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
+		if ((param & ((u64)1 << phy_advert[i].bit))) {
+			len = strlen(phy_advert[i].name);
 
-	if (!s1 || !s2) return 1;
+			if (flag == 0) {
+				if (total_len + len + 1 >= size)
+					break;
 
-	for (; n > 0; s1++, s2++, --n) {
-		c1 = t_olower(*s1);
-		c2 = t_olower(*s2);
+				flag++;
+			} else {
+				if (total_len + len + 4 >= size)
+					break;
 
-		if (c1 != c2) {
-			return (c1 - c2);
-		} else if (c1 == '\0') {
-			return 0;
+				p[0] = ' ';
+				p[1] = '|';
+				p[2] = ' ';
+				p += 3;
+				total_len += 3;
+			}
+
+			strcpy(p, phy_advert[i].name);
+			p += len;
+			total_len += len;
 		}
 	}
 
-	return 0;
+	return (int)total_len;
 }
 
-unsigned uart_hang = 1;
-DWORD WINAPI check_uart_hang(LPVOID lpParam)
-{
-	Sleep(10000);
+/*
+ * Command parameter schemas. Each command lists its name=value parameters
+ * with the type and the offset of the field they fill; cli_parse() walks
+ * argv once and stores every known parameter into the handler's struct.
+ * The same table generates the command synopsis printed by help.
+ */
+enum cli_ptype {
+	CLI_P_NUM,	/* number, TRUE/FALSE or FULL/HALF */
+	CLI_P_MAC,	/* xx:xx:xx:xx:xx:xx */
+	CLI_P_KEY,	/* hex string of exactly size bytes */
+	CLI_P_AESKEY,	/* hex string of 16 or 32 bytes */
+	CLI_P_ADVERT,	/* link modes separated by '|', ',' or ';' */
+	CLI_P_STR,	/* pointer to the value in argv */
+};
 
-	if (uart_hang) {
-		system("color 0c");
-		printf("ALERT :Selected COMPORT not functioning properly\n\n");
-		printf("1. Please Check whether the Device Under Test is ON\n");
-		printf("2. Please Check whether you have selected the correct COMPORT\n");
-		printf("3. Please Check whether you have selected the correct BAUDRATE\n\n");
-		printf("Application exit in 10 seconds\n");
-		Sleep(10000);
-		exit(0);
-	}
+struct cli_param {
+	const char *name;
+	u8 type;
+	u8 has_def;
+	u16 size;
+	u32 offset;
+	long long def;
+};
 
-	return 0;
-}
+#define CLI_FIELD_SIZE(type, field)	sizeof(((type *)0)->field)
+#define CLI_PARAM(t, type, field, name, has_def, def) \
+	{ name, t, has_def, CLI_FIELD_SIZE(type, field), offsetof(type, field), def }
+
+#define CLI_NUM(type, field, name)	CLI_PARAM(CLI_P_NUM, type, field, name, 0, 0)
+#define CLI_NUM_DEF(type, field, name, def) \
+	CLI_PARAM(CLI_P_NUM, type, field, name, 1, def)
+#define CLI_MAC(type, field, name)	CLI_PARAM(CLI_P_MAC, type, field, name, 0, 0)
+#define CLI_KEY(type, field, name)	CLI_PARAM(CLI_P_KEY, type, field, name, 0, 0)
+#define CLI_AESKEY(type, field, name)	CLI_PARAM(CLI_P_AESKEY, type, field, name, 0, 0)
+#define CLI_ADVERT(type, field, name)	CLI_PARAM(CLI_P_ADVERT, type, field, name, 0, 0)
+#define CLI_STR(type, field, name)	CLI_PARAM(CLI_P_STR, type, field, name, 0, 0)
+/* The handler passes a single variable of the given type */
+#define CLI_VAL(type, name)		{ name, CLI_P_NUM, 0, sizeof(type), 0, 0 }
+#define CLI_PARAM_END			{ NULL }
+
+static const struct cli_param cli_p_gpy2xx_abist_start[] = {
+	CLI_NUM(struct gpy211_abist_param, restart, "enRestart"),
+	CLI_NUM(struct gpy211_abist_param, uart_report, "enUartReport"),
+	CLI_NUM(struct gpy211_abist_param, test, "txTestMode"),
+	CLI_PARAM_END
+};
 
-static void SignalHandler(int signal)
-{
-	if (signal == SIGINT) {
-		sig_cap = 1;
-	}
-}
+static const struct cli_param cli_p_gpy2xx_ads_cfg[] = {
+	CLI_NUM(struct gpy211_ads_ctrl, no_nrg_rst, "advertise_enable"),
+	CLI_NUM(struct gpy211_ads_ctrl, downshift_en, "NBaseT_ds_enable"),
+	CLI_NUM(struct gpy211_ads_ctrl, downshift_thr, "downshift_cnt_thr"),
+	CLI_NUM(struct gpy211_ads_ctrl, force_rst, "force_reset"),
+	CLI_NUM(struct gpy211_ads_ctrl, nrg_rst_cnt, "rst_cntdown_timer"),
+	CLI_PARAM_END
+};
 
-char *var_list[MAX_PARAM];
-char *param_list1[MAX_PARAM];
+static const struct cli_param cli_p_gpy2xx_config_advert[] = {
+	CLI_ADVERT(struct gpy211_device, link.advertising, "advertising"),
+	CLI_PARAM_END
+};
 
-int system_restart = 0;
+static const struct cli_param cli_p_gpy2xx_config_aneg[] = {
+	CLI_NUM_DEF(struct gpy211_device, link.autoneg, "autoneg", 1),
+	CLI_ADVERT(struct gpy211_device, link.advertising, "advertising"),
+	CLI_NUM_DEF(struct gpy211_device, link.speed, "speed", SPEED_2500),
+	CLI_NUM_DEF(struct gpy211_device, link.duplex, "duplex", DUPLEX_FULL),
+	CLI_NUM_DEF(struct gpy211_device, link.pause, "pause", 1),
+	CLI_NUM_DEF(struct gpy211_device, link.asym_pause, "asym_pause", 1),
+	CLI_PARAM_END
+};
 
-unsigned int str_to_hex(unsigned char *str)
-{
-	unsigned int n = 0;
-	int i = 0;
+static const struct cli_param cli_p_gpy2xx_errcnt_cfg[] = {
+	CLI_VAL(enum gpy211_errcnt_event, "errCountMode"),
+	CLI_PARAM_END
+};
 
-	if (!str)
-		return 0;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_extin_clr[] = {
+	CLI_NUM(struct gpy211_phy_extin, std_istat, "stdIstat"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_extin_clr NULL
+#endif
 
-	if (str[0] == 0)
-		return 0;
+static const struct cli_param cli_p_gpy2xx_extin_mask[] = {
+	CLI_NUM(struct gpy211_phy_extin, std_imask, "stdImask"),
+	CLI_NUM(struct gpy211_phy_extin, ext_imask, "extImask"),
+	CLI_PARAM_END
+};
 
-	while (str[i]) {
-		n = n * 16;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_cfg[] = {
+	CLI_NUM(struct gmac_cfg, re_en, "reEn"),
+	CLI_NUM(struct gmac_cfg, te_en, "teEn"),
+	CLI_NUM(struct gmac_cfg, preamble_len, "preambLen"),
+	CLI_NUM(struct gmac_cfg, loopback_en, "lbmEn"),
+	CLI_NUM(struct gmac_cfg, fulldup_en, "fdupEn"),
+	CLI_NUM(struct gmac_cfg, mac_speed, "macSpeed"),
+	CLI_NUM(struct gmac_cfg, rc_write1_en, "rcWrite1"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_cfg NULL
+#endif
 
-		if (('0' <= str[i] && str[i] <= '9')) {
-			n += str[i] - '0';
-		} else if (('A' <= str[i] && str[i] <= 'F')) {
-			n += str[i] - 'A' + 10;
-			;
-		} else if (('a' <= str[i] && str[i] <= 'f')) {
-			n += str[i] - 'a' + 10;
-			;
-		} else
-			printf("Wrong value:%u\n", str[i]);
+static const struct cli_param cli_p_gpy2xx_gmacf_count_ctrl_cfg[] = {
+	CLI_NUM(struct gmacf_counter_ctrl, reset_counters, "rstCnt"),
+	CLI_NUM(struct gmacf_counter_ctrl, stop_rollover, "stopRoll"),
+	CLI_NUM(struct gmacf_counter_ctrl, clear_on_read, "conRead"),
+	CLI_NUM(struct gmacf_counter_ctrl, freeze_counters, "frzCnt"),
+	CLI_NUM(struct gmacf_counter_ctrl, preset_counters, "pstCnt"),
+	CLI_NUM(struct gmacf_counter_ctrl, preset_half_full, "psthFull"),
+	CLI_NUM(struct gmacf_counter_ctrl, count_dropped_bc, "cntbcDrop"),
+	CLI_PARAM_END
+};
 
-		i++;
-	}
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_count_imask_cfg[] = {
+	CLI_NUM(struct counter_imask, tx_good_bad_im, "txGb"),
+	CLI_NUM(struct counter_imask, tx_uflow_err_im, "txUflow"),
+	CLI_NUM(struct counter_imask, tx_good_im, "txGood"),
+	CLI_NUM(struct counter_imask, tx_osize_good_im, "txOsize"),
+	CLI_NUM(struct counter_imask, rx_good_bad_im, "rxGb"),
+	CLI_NUM(struct counter_imask, rx_crc_err_im, "rxCrc"),
+	CLI_NUM(struct counter_imask, rx_usize_good_im, "rxUsize"),
+	CLI_NUM(struct counter_imask, rx_osize_good_im, "rxOsize"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_count_imask_cfg NULL
+#endif
 
-	return n;
-}
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_lpi_cfg[] = {
+	CLI_NUM(struct lpi_cfg, lpi_int_en, "lpintEn"),
+	CLI_NUM(struct lpi_cfg, lpi_en, "lpiEn"),
+	CLI_NUM(struct lpi_cfg, phy_link_status, "linkUp"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_auto, "txautoEn"),
+	CLI_NUM(struct lpi_cfg, lpi_timer_en, "timerEn"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_clk_stop_en, "clkStop"),
+	CLI_NUM(struct lpi_cfg, ous_tic_time, "ticTime"),
+	CLI_NUM(struct lpi_cfg, lpi_tw_time, "twTime"),
+	CLI_NUM(struct lpi_cfg, lpi_ls_time, "lsTime"),
+	CLI_NUM(struct lpi_cfg, lpi_entry_time, "entryTime"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_lpi_cfg NULL
+#endif
 
-static inline unsigned int hex2int(char c)
-{
-	if (c >= '0' && c <= '9')
-		return (unsigned int)(c - '0');
-	else
-		return (unsigned int)(c - 'a' + 10);
-}
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_lpi_imask_cfg[] = {
+	CLI_NUM(struct lpi_int_mask, rx_lpi_usc_im, "rxUsc"),
+	CLI_NUM(struct lpi_int_mask, rx_lpi_tc_im, "rxTrc"),
+	CLI_NUM(struct lpi_int_mask, tx_lpi_usc_im, "txUsc"),
+	CLI_NUM(struct lpi_int_mask, tx_lpi_tc_im, "txTrc"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_lpi_imask_cfg NULL
+#endif
 
-#define UNIX_EPOCH 1970
-int dayofweek(int d, int m, int y)
-{
-	char day;
-	static int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
-	y -= m < 3;
-	day = (y + y / 4 - y / 100 + y / 400 + t[m - 1] + d) % 7;
+static const struct cli_param cli_p_gpy2xx_gmacf_pkt_cfg[] = {
+	CLI_NUM(struct gmac_pkt_cfg, jumbo_en, "jumboEn"),
+	CLI_NUM(struct gmac_pkt_cfg, tx_jabber_dis, "jabberDis"),
+	CLI_NUM(struct gmac_pkt_cfg, watchdog_dis, "wdogDis"),
+	CLI_NUM(struct gmac_pkt_cfg, pad_crc_strip_en, "pcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, crc_strip_en, "crcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, support_2kp, "sup2kp"),
+	CLI_NUM(struct gmac_pkt_cfg, mac_ipg, "macIpg"),
+	CLI_PARAM_END
+};
 
-	//If leap year it will be the remainder-1
-	if (y % 4 == 0)
-		day -= 1;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacf_pkt_filter_cfg[] = {
+	CLI_NUM(struct gmac_pktflt_cfg, promiscuous_en, "prEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_all_mc, "passAmc"),
+	CLI_NUM(struct gmac_pktflt_cfg, block_bc, "blockBc"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_ctrl_pkts, "passCtrl"),
+	CLI_NUM(struct gmac_pktflt_cfg, sa_filter_en, "safltrEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, rx_all_en, "rxAll"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacf_pkt_filter_cfg NULL
+#endif
 
-	return day;
-}
+static const struct cli_param cli_p_gpy2xx_gmacf_pm_cfg[] = {
+	CLI_NUM(struct pm_gmac_cfg, crc_pad_ctrl, "crcPad"),
+	CLI_NUM(struct pm_gmac_cfg, tx_err_input, "txErr"),
+	CLI_NUM(struct pm_gmac_cfg, big_endian, "bigEndian"),
+	CLI_PARAM_END
+};
 
-static int print_sys_time(u32 sec, u32 nsec)
-{
-	int year, act_leap = 0, leap_days = 0, act_mnum, mnum = 0, act_day, day, hour, minute, is_leap = UNIX_EPOCH;
-	char *monName = "January";
-	//PTP Unix time starts from 1st Jan 1970, Thirsday
-	char *dayName[] = {"Thursday", "Friday", "Saturday", "Sunday", "Monday", "Tuesday", "Wednesday"};
-	char *weekDay;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_cfg[] = {
+	CLI_NUM(struct gmac_cfg, re_en, "reEn"),
+	CLI_NUM(struct gmac_cfg, te_en, "teEn"),
+	CLI_NUM(struct gmac_cfg, preamble_len, "preambLen"),
+	CLI_NUM(struct gmac_cfg, loopback_en, "lbmEn"),
+	CLI_NUM(struct gmac_cfg, fulldup_en, "fdupEn"),
+	CLI_NUM(struct gmac_cfg, mac_speed, "macSpeed"),
+	CLI_NUM(struct gmac_cfg, rc_write1_en, "rcWrite1"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_cfg NULL
+#endif
 
-	minute = sec / 60;
-	sec = sec % 60;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_lpi_cfg[] = {
+	CLI_NUM(struct lpi_cfg, lpi_int_en, "lpintEn"),
+	CLI_NUM(struct lpi_cfg, lpi_en, "lpiEn"),
+	CLI_NUM(struct lpi_cfg, phy_link_status, "linkUp"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_auto, "txautoEn"),
+	CLI_NUM(struct lpi_cfg, lpi_timer_en, "timerEn"),
+	CLI_NUM(struct lpi_cfg, lpi_tx_clk_stop_en, "clkStop"),
+	CLI_NUM(struct lpi_cfg, ous_tic_time, "ticTime"),
+	CLI_NUM(struct lpi_cfg, lpi_tw_time, "twTime"),
+	CLI_NUM(struct lpi_cfg, lpi_ls_time, "lsTime"),
+	CLI_NUM(struct lpi_cfg, lpi_entry_time, "entryTime"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_lpi_cfg NULL
+#endif
 
-	hour = minute / 60;
-	minute = minute % 60;
+static const struct cli_param cli_p_gpy2xx_gmacl_pause_cfg[] = {
+	CLI_NUM(struct pause_cfg, flow_ctrl_busy, "fcBusy"),
+	CLI_NUM(struct pause_cfg, pm_gmacl_fc, "gmaclFc"),
+	CLI_NUM(struct pause_cfg, tx_flow_ctrl, "txfcEn"),
+	CLI_NUM(struct pause_cfg, pause_low_thresh, "plThresh"),
+	CLI_NUM(struct pause_cfg, dis_zquanta_pause, "zqPause"),
+	CLI_NUM(struct pause_cfg, pause_time, "pauseTime"),
+	CLI_MAC(struct pause_cfg, tx_fc_mac, "pauseMac"),
+	CLI_NUM(struct pause_cfg, pause_assert_thresh, "paThresh"),
+	CLI_NUM(struct pause_cfg, pause_deassert_thresh, "pdThresh"),
+	CLI_PARAM_END
+};
 
-	day = act_day = hour / 24;
-	weekDay = dayName[day % 7];
-	hour = hour % 24;
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_pkt_cfg[] = {
+	CLI_NUM(struct gmac_pkt_cfg, jumbo_en, "jumboEn"),
+	CLI_NUM(struct gmac_pkt_cfg, tx_jabber_dis, "jabberDis"),
+	CLI_NUM(struct gmac_pkt_cfg, watchdog_dis, "wdogDis"),
+	CLI_NUM(struct gmac_pkt_cfg, pad_crc_strip_en, "pcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, crc_strip_en, "crcStrip"),
+	CLI_NUM(struct gmac_pkt_cfg, support_2kp, "sup2kp"),
+	CLI_NUM(struct gmac_pkt_cfg, mac_ipg, "macIpg"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_pkt_cfg NULL
+#endif
 
-	year  = day / 365;
-	//printf("\n\tYrs %d days %d hours %d mins %d secs %d\n", year, day, hour, minute, sec);
+#if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
+static const struct cli_param cli_p_gpy2xx_gmacl_pkt_filter_cfg[] = {
+	CLI_NUM(struct gmac_pktflt_cfg, promiscuous_en, "prEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_all_mc, "passAmc"),
+	CLI_NUM(struct gmac_pktflt_cfg, block_bc, "blockBc"),
+	CLI_NUM(struct gmac_pktflt_cfg, pass_ctrl_pkts, "passCtrl"),
+	CLI_NUM(struct gmac_pktflt_cfg, sa_filter_en, "safltrEn"),
+	CLI_NUM(struct gmac_pktflt_cfg, rx_all_en, "rxAll"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_gmacl_pkt_filter_cfg NULL
+#endif
 
-	while ((is_leap < (UNIX_EPOCH + year))) {
-		if (is_leap % 4 == 0)
-			act_leap++;
+static const struct cli_param cli_p_gpy2xx_gmacl_pm_cfg[] = {
+	CLI_NUM(struct pm_gmac_cfg, crc_pad_ctrl, "crcPad"),
+	CLI_NUM(struct pm_gmac_cfg, tx_err_input, "txErr"),
+	CLI_NUM(struct pm_gmac_cfg, big_endian, "bigEndian"),
+	CLI_PARAM_END
+};
 
-		is_leap++;
-	};
+static const struct cli_param cli_p_gpy2xx_gmacx_bm_cfg[] = {
+	CLI_NUM(struct bm_cfg, sb0_start, "sb0Start"),
+	CLI_NUM(struct bm_cfg, sb0_end, "sb0End"),
+	CLI_NUM(struct bm_cfg, sb0_pkt_thresh, "sb0Pthresh"),
+	CLI_NUM(struct bm_cfg, sb1_start, "sb1Start"),
+	CLI_NUM(struct bm_cfg, sb1_end, "sb1End"),
+	CLI_NUM(struct bm_cfg, sb1_pkt_thresh, "sb1Pthresh"),
+	CLI_PARAM_END
+};
 
-	//printf("\n\tLeap days %d\n", act_leap);
+static const struct cli_param cli_p_gpy2xx_gmacx_pm_pdi_cfg[] = {
+	CLI_NUM(struct pm_config, bypass_gmac, "bpMac"),
+	CLI_NUM(struct pm_config, bypass_macsec, "bpMsec"),
+	CLI_NUM(struct pm_config, drop_on_crc_err, "dropCrc"),
+	CLI_NUM(struct pm_config, drop_on_pkt_err, "dropPerr"),
+	CLI_NUM(struct pm_config, drop_on_sec_fail, "dropSfail"),
+	CLI_NUM(struct pm_config, class_drop, "dropClass"),
+	CLI_NUM(struct pm_config, cust_3g_en, "cust3gEn"),
+	CLI_NUM(struct pm_config, sgmii_lb_en, "sgmiiLb"),
+	CLI_PARAM_END
+};
 
-	year = (act_day - act_leap) / 365;
+static const struct cli_param cli_p_gpy2xx_gpio_cfg[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_NUM(struct gpy211_gpio, flags, "gpioFlags"),
+	CLI_PARAM_END
+};
 
-	act_day -= act_leap;
+static const struct cli_param cli_p_gpy2xx_gpio_get[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_PARAM_END
+};
 
-	day = act_day % 365;
+static const struct cli_param cli_p_gpy2xx_gpio_input[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_PARAM_END
+};
 
-	mnum = act_mnum = day / 30;
+static const struct cli_param cli_p_gpy2xx_gpio_output[] = {
+	CLI_NUM(struct gpy211_gpio, pin, "pinId"),
+	CLI_PARAM_END
+};
 
-	//printf("\n\tAct yrs %d, act days %d\n", year, act_day);
+static const struct cli_param cli_p_gpy2xx_led_br_cfg[] = {
+	CLI_NUM(struct gpy211_led_brlvl_cfg, mode, "brightMode"),
+	CLI_NUM(struct gpy211_led_brlvl_cfg, lvl_min, "brightLvlMin"),
+	CLI_NUM(struct gpy211_led_brlvl_cfg, lvl_max, "brightLvlMax"),
+	CLI_NUM(struct gpy211_led_brlvl_cfg, sw_edge, "swEdgeDetect"),
+	CLI_PARAM_END
+};
 
-	leap_days = 0;
+static const struct cli_param cli_p_gpy2xx_led_if_cfg[] = {
+	CLI_NUM(struct gpy211_led_cfg, id, "ledId"),
+	CLI_NUM(struct gpy211_led_cfg, color_mode, "colorMode"),
+	CLI_NUM(struct gpy211_led_cfg, slow_blink_src, "slowBlinkSrc"),
+	CLI_NUM(struct gpy211_led_cfg, fast_blink_src, "fastBlinkSrc"),
+	CLI_NUM(struct gpy211_led_cfg, const_on, "constantlyOn"),
+	CLI_NUM(struct gpy211_led_cfg, pulse, "pulseFlags"),
+	CLI_PARAM_END
+};
 
-	is_leap = UNIX_EPOCH;
+static const struct cli_param cli_p_gpy2xx_led_if_get[] = {
+	CLI_NUM(struct gpy211_led_cfg, id, "ledId"),
+	CLI_PARAM_END
+};
 
-	while ((is_leap < (UNIX_EPOCH + year))) {
-		if (is_leap % 4 == 0)
-			leap_days++;
+#if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
+static const struct cli_param cli_p_gpy2xx_led_top_cfg[] = {
+	CLI_NUM(struct gpy211_led_gcfg, complex_scan, "complexScan"),
+	CLI_NUM(struct gpy211_led_gcfg, complex_blink, "complexBlink"),
+	CLI_NUM(struct gpy211_led_gcfg, inverse_scan, "inverseScan"),
+	CLI_NUM(struct gpy211_led_gcfg, fast_blink_freq, "fastBlinkFreq"),
+	CLI_NUM(struct gpy211_led_gcfg, slow_blink_freq, "slowBlinkFreq"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_led_top_cfg NULL
+#endif
 
-		is_leap++;
-	};
+static const struct cli_param cli_p_gpy2xx_loopback_cfg[] = {
+	CLI_VAL(enum gpy211_test_loop, "loopbackMode"),
+	CLI_PARAM_END
+};
 
-	day += ((act_leap - leap_days) + 1); //+1 for the current day
+static const struct cli_param cli_p_gpy2xx_macsec_enable[] = {
+	CLI_NUM(struct gpy211_macsec, drop_on_crc_err, "dropCrc"),
+	CLI_NUM(struct gpy211_macsec, drop_on_pkt_err, "dropPerr"),
+	CLI_NUM(struct gpy211_macsec, drop_on_sec_fail, "dropSfail"),
+	CLI_NUM(struct gpy211_macsec, class_drop, "dropClass"),
+	CLI_PARAM_END
+};
 
-	//printf("\n\tAct yrs %d leap days %d days %d month num %d\n", year, leap_days, day, mnum);
+static const struct cli_param cli_p_gpy2xx_mbox_read16[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
 
-	switch (act_mnum) {
-	case 1:
-		if (day > 31) {
-			monName = "February";
-			mnum += 1;
-			day -= 31;
-		}
+static const struct cli_param cli_p_gpy2xx_mbox_read32[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
 
-		break;
+static const struct cli_param cli_p_gpy2xx_pm_freq_tune[] = {
+	CLI_NUM(struct tune_freq, ppm, "ppm"),
+	CLI_PARAM_END
+};
 
-	case 2:
-	case 3:
-		monName = "March";
+static const struct cli_param cli_p_gpy2xx_ptp_adjfreq[] = {
+	CLI_VAL(s32, "pbbTime"),
+	CLI_PARAM_END
+};
 
-		if (day > 90) {
-			monName = "April";
-			mnum += 1;
-			day -= 90;
-		} else
-			day -= 59;
+static const struct cli_param cli_p_gpy2xx_ptp_adjtime[] = {
+	CLI_VAL(s64, "deltaTime"),
+	CLI_PARAM_END
+};
 
-		break;
+static const struct cli_param cli_p_gpy2xx_ptp_aux_cfg[] = {
+	CLI_NUM(struct gpy211_aux_cfg, aux_enable, "enAux"),
+	CLI_NUM(struct gpy211_aux_cfg, aux_trigger_port, "auxTrigPort"),
+	CLI_PARAM_END
+};
 
-	case 4:
-		monName = "April";
+/* The gpy211_ptp_ctrl fields are bit-fields */
+struct cli_ptp_enable_args {
+	u16 enPhyTxTs;
+	u16 enPhyRxTs;
+	u16 txPtpOffset;
+	u16 txPtpProto;
+	u16 enTxOstcEn;
+	time64_t txOstCorTime;
+	u16 auxTrigPort;
+};
 
-		if (day > 120) {
-			monName = "May";
-			mnum += 1;
-			day -= 120;
-		} else
-			day -= 90;
+static const struct cli_param cli_p_gpy2xx_ptp_enable[] = {
+	CLI_NUM(struct cli_ptp_enable_args, enPhyTxTs, "enPhyTxTs"),
+	CLI_NUM(struct cli_ptp_enable_args, enPhyRxTs, "enPhyRxTs"),
+	CLI_NUM(struct cli_ptp_enable_args, txPtpOffset, "txPtpOffset"),
+	CLI_NUM(struct cli_ptp_enable_args, txPtpProto, "txPtpProto"),
+	CLI_NUM(struct cli_ptp_enable_args, enTxOstcEn, "enTxOstcEn"),
+	CLI_NUM(struct cli_ptp_enable_args, txOstCorTime, "txOstCorTime"),
+	CLI_NUM(struct cli_ptp_enable_args, auxTrigPort, "auxTrigPort"),
+	CLI_PARAM_END
+};
 
-		break;
+static const struct cli_param cli_p_gpy2xx_ptp_set_ppsctrl[] = {
+	CLI_NUM(struct gpy2xx_pps_ctrl, ppsctrl_low.raw_pps_ctrl_low, "ppsCtrlLow"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, sec_tgttime, "targetSec"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, nsec_tgttime, "targetNsc"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, pps0_interal, "ppsInterval"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, pps0_width, "ppsWidth"),
+	CLI_NUM(struct gpy2xx_pps_ctrl, gpc_sel, "gpcSel"),
+	CLI_PARAM_END
+};
 
-	case 5:
-		monName = "May";
+static const struct cli_param cli_p_gpy2xx_ptp_set_ptoctrl[] = {
+	CLI_NUM(struct gpy2xx_pto_ctrl, ptoctrl_low.raw_pto_ctrl_low, "ptoCtrlLow"),
+	CLI_KEY(struct gpy2xx_pto_ctrl, sport_id, "srcPortID"),
+	CLI_NUM(struct gpy2xx_pto_ctrl, logmsg_lvl.raw_logm_lvl_low, "logmLvlLow"),
+	CLI_NUM(struct gpy2xx_pto_ctrl, logmsg_lvl.raw_logm_lvl_hi, "logmLvlHi"),
+	CLI_PARAM_END
+};
 
-		if (day > 151) {
-			monName = "June";
-			mnum += 1;
-			day -= 151;
-		} else
-			day -= 120;
+/* The gpy2xx_ts_ctrl fields are bit-fields */
+struct cli_ptp_tsctrl_args {
+	u16 enEvntMsg;
+	u16 enMstrMsg;
+	u16 snapType;
+};
 
-		break;
+static const struct cli_param cli_p_gpy2xx_ptp_set_tsctrl[] = {
+	CLI_NUM(struct cli_ptp_tsctrl_args, enEvntMsg, "enEvntMsg"),
+	CLI_NUM(struct cli_ptp_tsctrl_args, enMstrMsg, "enMstrMsg"),
+	CLI_NUM(struct cli_ptp_tsctrl_args, snapType, "snapType"),
+	CLI_PARAM_END
+};
 
-	case 6:
-		monName = "June";
+static const struct cli_param cli_p_gpy2xx_ptp_settime[] = {
+	CLI_NUM(struct timespec64, tv_sec, "initSec"),
+	CLI_NUM(struct timespec64, tv_nsec, "initNsec"),
+	CLI_PARAM_END
+};
 
-		if (day > 181) {
-			monName = "July";
-			mnum += 1;
-			day -= 181;
-		} else
-			day -= 151;
+static const struct cli_param cli_p_gpy2xx_read[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
 
-		break;
+/* Parameters of the register access commands */
+struct cli_reg_args {
+	u32 devtype;
+	u32 regaddr;
+	u32 data;
+};
 
-	case 7:
-		monName = "July";
+static const struct cli_param cli_p_reg_read_mmd[] = {
+	CLI_NUM(struct cli_reg_args, devtype, "devtype"),
+	CLI_NUM(struct cli_reg_args, regaddr, "regaddr"),
+	CLI_PARAM_END
+};
 
-		if (day > 212) {
-			monName = "August";
-			mnum += 1;
-			day -= 212;
-		} else
-			day -= 181;
+static const struct cli_param cli_p_reg_write[] = {
+	CLI_NUM(struct cli_reg_args, regaddr, "regaddr"),
+	CLI_NUM(struct cli_reg_args, data, "data"),
+	CLI_PARAM_END
+};
 
-		break;
+static const struct cli_param cli_p_reg_write_mmd[] = {
+	CLI_NUM(struct cli_reg_args, devtype, "devtype"),
+	CLI_NUM(struct cli_reg_args, regaddr, "regaddr"),
+	CLI_NUM(struct cli_reg_args, data, "data"),
+	CLI_PARAM_END
+};
 
-	case 8:
-		monName = "August";
+static const struct cli_param cli_p_gpy2xx_setup_forced[] = {
+	CLI_NUM_DEF(struct gpy211_device, link.speed, "speed", SPEED_2500),
+	CLI_NUM_DEF(struct gpy211_device, link.duplex, "duplex", DUPLEX_FULL),
+	CLI_NUM_DEF(struct gpy211_device, link.pause, "pause", 1),
+	CLI_NUM_DEF(struct gpy211_device, link.asym_pause, "asym_pause", 1),
+	CLI_NUM_DEF(struct gpy211_device, mstr_slave, "mstr_slave", 1),
+	CLI_PARAM_END
+};
 
-		if (day > 243) {
-			monName = "September";
-			mnum += 1;
-			day -= 243;
-		} else
-			day -= 212;
+static const struct cli_param cli_p_gpy2xx_sgmii_config_aneg[] = {
+	CLI_NUM_DEF(struct gpy211_sgmii, linkcfg_dir, "linkcfg_dir", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, aneg_mode, "aneg_mode", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, eee_enable, "eee_enable", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, link.autoneg, "autoneg", 1),
+	CLI_NUM_DEF(struct gpy211_sgmii, link.speed, "speed", SPEED_2500),
+	CLI_NUM(struct gpy211_sgmii, link.fixed2g5, "fixed2G5"),
+	CLI_NUM_DEF(struct gpy211_sgmii, link.duplex, "duplex", DUPLEX_FULL),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_sgmii_opmode[] = {
+	CLI_VAL(enum gpy211_sgmii_operation, "opMode"),
+	CLI_PARAM_END
+};
 
-		break;
+#if defined(EN_SMDIO_RW) && EN_SMDIO_RW
+static const struct cli_param cli_p_gpy2xx_smdio_read[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_smdio_read NULL
+#endif
 
-	case 9:
-		monName = "September";
+static const struct cli_param cli_p_gpy2xx_synce_cfg[] = {
+	CLI_NUM(struct gpy211_synce, synce_enable, "enSyncE"),
+	CLI_NUM(struct gpy211_synce, synce_refclk, "synceRefClk"),
+	CLI_NUM(struct gpy211_synce, master_sel, "masterSlave"),
+	CLI_NUM(struct gpy211_synce, data_rate, "dataRate"),
+	CLI_NUM(struct gpy211_synce, gpc_sel, "gpcSel"),
+	CLI_PARAM_END
+};
 
-		if (day > 273) {
-			monName = "October";
-			mnum += 1;
-			day -= 273;
-		} else
-			day -= 243;
+static const struct cli_param cli_p_gpy2xx_test_mode_cfg[] = {
+	CLI_VAL(enum gpy211_test_mode, "testTxMode"),
+	CLI_PARAM_END
+};
 
-		break;
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+static const struct cli_param cli_p_gpy2xx_topin_cfg[] = {
+	CLI_NUM(struct gpy211_extin, id, "intId"),
+	CLI_NUM(struct gpy211_extin, gpio_flags, "gpioFlags"),
+	CLI_NUM(struct gpy211_extin, ip_char, "ipChar"),
+	CLI_NUM(struct gpy211_extin, im0, "intMod0"),
+	CLI_NUM(struct gpy211_extin, im1, "intMod1"),
+	CLI_NUM(struct gpy211_extin, im2, "intMod2"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_topin_cfg NULL
+#endif
 
-	case 10:
-		monName = "October";
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+static const struct cli_param cli_p_gpy2xx_topin_clr[] = {
+	CLI_NUM(struct gpy211_extin, id, "intId"),
+	CLI_NUM(struct gpy211_extin, im0, "intMod0"),
+	CLI_NUM(struct gpy211_extin, im1, "intMod1"),
+	CLI_NUM(struct gpy211_extin, im2, "intMod2"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_topin_clr NULL
+#endif
 
-		if (day > 304) {
-			monName = "November";
-			mnum += 1;
-			day -= 304;
-		} else
-			day -= 273;
+#if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
+static const struct cli_param cli_p_gpy2xx_topin_get[] = {
+	CLI_NUM(struct gpy211_extin, id, "intId"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_gpy2xx_topin_get NULL
+#endif
 
-		break;
+static const struct cli_param cli_p_gpy2xx_ulp_cfg[] = {
+	CLI_NUM(struct gpy211_ulp_ctrl, ulp_en, "ulp_enable"),
+	CLI_NUM(struct gpy211_ulp_ctrl, ulp_sta_block, "ulp_sta_block"),
+	CLI_NUM(struct gpy211_ulp_ctrl, ulp_exit, "ulp_exit"),
+	CLI_NUM(struct gpy211_ulp_ctrl, master_slice, "master_slice"),
+	CLI_PARAM_END
+};
 
-	case 11:
-		monName = "November";
+static const struct cli_param cli_p_gpy2xx_usxgmii_alignmentmarker_set[] = {
+	CLI_VAL(u32, "usxgmii_am_count"),
+	CLI_PARAM_END
+};
 
-		if (day > 334) {
-			monName = "December";
-			mnum += 1;
-			day -= 334;
-		} else
-			day -= 304;
+static const struct cli_param cli_p_gpy2xx_usxgmii_loopback_cfg[] = {
+	CLI_VAL(enum gpy211_usxgmii_loopback_mode, "mode"),
+	CLI_PARAM_END
+};
 
-		break;
+static const struct cli_param cli_p_gpy2xx_usxgmii_reach_cfg[] = {
+	CLI_NUM_DEF(struct gpy211_usxgmii_reach, trace_len, "trace_len", -1),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_eq_main, "tx_eq_main"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_eq_pre, "tx_eq_pre"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_eq_post, "tx_eq_post"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_vboost_en, "tx_vboost_en"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_vboost_lvl, "tx_vboost_lvl"),
+	CLI_NUM(struct gpy211_usxgmii_reach, tx_iboost_lvl, "tx_iboost_lvl"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_att_lvl, "rx_eq_att_lvl"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_vga1_gain, "rx_eq_vga1_gain"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_vga2_gain, "rx_eq_vga2_gain"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_ctle_boost, "rx_eq_ctle_boost"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_ctle_pole, "rx_eq_ctle_pole"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_eq_dfe_tap1, "rx_eq_dfe_tap1"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_afe_adapt_en, "rx_afe_adapt_en"),
+	CLI_NUM(struct gpy211_usxgmii_reach, rx_dfe_adapt_en, "rx_dfe_adapt_en"),
+	CLI_PARAM_END
+};
 
-	case 12:
-		monName = "December";
-		day -= 334;
-		break;
+static const struct cli_param cli_p_gpy2xx_usxgmii_rx_bert_cfg[] = {
+	CLI_NUM(struct gpy211_usxgmii_rx_bert_config, mode, "mode"),
+	CLI_PARAM_END
+};
 
-	default:
-		break;
-	}
+static const struct cli_param cli_p_gpy2xx_usxgmii_tx_bert_cfg[] = {
+	CLI_NUM(struct gpy211_usxgmii_tx_bert_config, mode, "mode"),
+	CLI_NUM(struct gpy211_usxgmii_tx_bert_config, nval_sel, "nval_sel"),
+	CLI_PARAM_END
+};
 
-	//If the current year is leap and beyond feb?
-	if (((UNIX_EPOCH + year) % 4 == 0) && (act_mnum > 1)) {
-		//printf("\n\tThe current year %d is leap", (UNIX_EPOCH + year));
-		day -= 1;
-	}
+static const struct cli_param cli_p_gpy2xx_wol_cfg[] = {
+	CLI_NUM(struct gpy211_wolinfo, wolopts, "wolOptions"),
+	CLI_MAC(struct gpy211_wolinfo, mac, "wolMAC"),
+	CLI_MAC(struct gpy211_wolinfo, sopass, "wolPassword"),
+	CLI_PARAM_END
+};
 
-	//printf("\n\tYr %d day %d mon %d\n", (UNIX_EPOCH + year), day, mnum);
-	printf("\n\tUnix system time: %s %s %d %d %02d:%02d:%02d GMT\n", weekDay, monName, day, (UNIX_EPOCH + year), hour, minute, sec);
-	return 0;
-}
+static const struct cli_param cli_p_gpy2xx_xpcs_read16[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
 
-int pc_uart_dataread(u32 Offset, u32 *value)
-{
-#if RAPID_UART
-	char txbuf[256];
-	char rxbuf[1024];
-	DWORD written;
-	int size;
-	DWORD read;
-	DWORD totalread;
-	DWORD retry;
-	unsigned int val;
-	char *ptr;
+#if defined(P31G_IND_RW) && P31G_IND_RW
+static const struct cli_param cli_p_pm_ind_read[] = {
+	CLI_VAL(u32, "regaddr"),
+	CLI_PARAM_END
+};
+#else
+#define cli_p_pm_ind_read NULL
+#endif
 
-	PurgeComm(hComm, PURGE_RXCLEAR);
+static const struct cli_param cli_p_test_gpy2xx_ptp_set_ppsctrl[] = {
+	CLI_NUM(struct gpy2xx_pps_ctrl, gpc_sel, "gpcSel"),
+	CLI_PARAM_END
+};
 
-	size = snprintf(txbuf, ARRAY_SIZE(txbuf), "r %04x\n", Offset & 0xFFFF);
+static const struct cli_param cli_p_msec_clear_cc_int_stat[] = {
+#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
+	CLI_NUM(struct crypto_core_stat, ctx_stat.raw_ctx_stat, "ctx_stat"),
+#endif
+	CLI_NUM(struct crypto_core_stat, int_stat.raw_int_stat, "int_stat"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		LOG_CRIT("%s", txbuf);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_NUM(struct psa_summary, count_summ_psa[0], "psa_summ0"),
+	CLI_PARAM_END
+};
 
-	written = 0;
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_sa_exp_summ[] = {
+	CLI_NUM(struct sa_exp_summ, sa_expsum_word[0], "saexp_summ0"),
+	CLI_PARAM_END
+};
 
-	if (!WriteFile(hComm,
-		       txbuf,
-		       (DWORD)size,
-		       &written,
-		       NULL)) {
-		printf("\nWrite COM fail\n");
-		return -1;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
 
-	FlushFileBuffers(hComm);
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_sam_rule[] = {
+	CLI_NUM(struct sa_match_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-	if (size > 0) {
-		size--;
-		txbuf[size] = 0;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_stats_summ[] = {
+	CLI_NUM(struct stats_summary, psa_sum_word[0], "psa_summ0"),
+	CLI_NUM(struct stats_summary, glb_summ_word, "glb_summ"),
+	CLI_PARAM_END
+};
 
-	totalread = 0;
-	retry = 100;
+static const struct cli_param cli_p_gpy2xx_msec_clear_egr_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
 
-	do {
-		read = 0;
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_NUM(struct psa_summary, count_summ_psa[0], "psa_summ0"),
+	CLI_PARAM_END
+};
 
-		if (!ReadFile(hComm,
-			      rxbuf + totalread,
-			      ARRAY_SIZE(rxbuf) - 1 - totalread,
-			      &read,
-			      NULL))
-			return -1;
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
 
-		totalread += read;
-		rxbuf[totalread] = 0;
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_sam_rule[] = {
+	CLI_NUM(struct sa_match_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-		ptr = strstr(rxbuf, txbuf);
-	} while ((ptr == NULL || strlen(ptr) < 12) && --retry > 0);
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_stats_summ[] = {
+	CLI_NUM(struct stats_summary, psa_sum_word[0], "psa_summ0"),
+	CLI_NUM(struct stats_summary, glb_summ_word, "glb_summ"),
+	CLI_PARAM_END
+};
 
-	if (retry == 0) {
-		printf("\nUART reading timeout, raw data is \"%s\"\n", rxbuf);
-		return -1;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_clear_ing_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
 
-	while (totalread > 0) {
-		totalread--;
+static const struct cli_param cli_p_gpy2xx_msec_clear_sa_pn_thr_summ[] = {
+	CLI_NUM(struct sa_pn_thr_summ, pnthr_sum_word[0], "pnthr_summ0"),
+	CLI_PARAM_END
+};
 
-		if (rxbuf[totalread] >= '0' && rxbuf[totalread] <= '9')
-			break;
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_aic_csr[] = {
+	CLI_NUM(struct aic_control_stat, enable_ctrl.raw_aic_bits, "enable_ctrl"),
+	CLI_NUM(struct aic_control_stat, ack.raw_aic_bits, "ack"),
+	CLI_NUM(struct aic_control_stat, enable_set.raw_aic_bits, "enable_set"),
+	CLI_NUM(struct aic_control_stat, enable_clr.raw_aic_bits, "enable_clr"),
+	CLI_PARAM_END
+};
 
-		if (rxbuf[totalread] >= 'a' && rxbuf[totalread] <= 'f')
-			break;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_ctrl[] = {
+	CLI_NUM(struct count_control, reset_all, "rst_all"),
+	CLI_NUM(struct count_control, saturate_cntrs, "ctr_saturate"),
+	CLI_NUM(struct count_control, auto_cntr_reset, "ctr_conr"),
+	CLI_NUM(struct count_control, reset_summary, "rst_summary"),
+	CLI_PARAM_END
+};
 
-	if (totalread < 3) {
-		printf("\nUART reading is wrong, raw data is \"%s\"\n", rxbuf);
-		return -1;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_incen[] = {
+	CLI_NUM(struct count_incen, sa_inc_en, "sa_inc"),
+	CLI_NUM(struct count_incen, vlan_inc_en, "vlan_inc"),
+	CLI_NUM(struct count_incen, global_inc_en, "global_inc"),
+	CLI_PARAM_END
+};
 
-	val = hex2int(rxbuf[totalread - 3]) * 0x1000;
-	val += hex2int(rxbuf[totalread - 2]) * 0x0100;
-	val += hex2int(rxbuf[totalread - 1]) * 0x0010;
-	val += hex2int(rxbuf[totalread]);
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_secfail[] = {
+	CLI_NUM(struct count_secfail, secfail_1.raw_secfail1, "misc_secfail"),
+	CLI_NUM(struct count_secfail, global_secfaill_mask, "global_secfail"),
+	CLI_PARAM_END
+};
 
-	*value = val;
-	return 1;
-#else
-	DWORD BytestoWrite;
-	DWORD BytesWritten = 0;
-	DWORD dwEventMask;
-	unsigned char Temp_Char;
-	unsigned char uart_Buffer[256];
-	char writebuffer[16];
-	unsigned char readbuffer[16];
-	unsigned int i = 0;
-	unsigned int h = 0;
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_count_thresh[] = {
+	CLI_NUM(struct frame_octet_thr, frame_threshold, "frame_thr"),
+	CLI_NUM(struct frame_octet_thr, octet_threshold, "octet_thr"),
+	CLI_PARAM_END
+};
 
-	DWORD No_BytesRead;
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_cp_rule[] = {
+	CLI_NUM(struct cp_class_param, cpc_index, "cpc_index"),
+	CLI_NUM(struct cp_class_param, cpc_type, "entry_type"),
+	CLI_MAC(struct cp_class_param, mac_da, "da_mac"),
+	CLI_MAC(struct cp_class_param, mac_da_end, "da_end"),
+	CLI_NUM(struct cp_class_param, ether_type, "eth_type"),
+	CLI_NUM(struct cp_class_param, cpm_mode, "cpm_mode"),
+	CLI_NUM(struct cp_class_param, cpm_enable, "cpm_en"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("\n\n#############");
-		printf("\nread original offset  -> %x", Offset);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_misc_ctrl[] = {
+	CLI_NUM(struct misc_control, mc_latency_fix, "mc_latency"),
+	CLI_NUM(struct misc_control, static_bypass, "static_bp"),
+	CLI_NUM(struct misc_control, nm_macsec_en, "nm_macsec"),
+	CLI_NUM(struct misc_control, validate_frames, "validate_level"),
+	CLI_NUM(struct misc_control, sectag_after_vlan, "sectag_avlan"),
+	CLI_PARAM_END
+};
 
-	BytestoWrite = sizeof(writebuffer);
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sa_nm_cp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
 
-	memset(uart_Buffer, 0, sizeof(uart_Buffer));
-	memset(writebuffer, 0, sizeof(writebuffer));
-	memset(readbuffer, 0, sizeof(readbuffer));
+/* The sa_nm_params fields are bit-fields */
+struct cli_sa_nm_ctrl_args {
+	u16 comp_etype;
+	u16 check_ver;
+	u16 check_kay;
+	u16 check_ce;
+	u16 check_sc;
+	u16 check_sl;
+	u16 check_pn;
+	u16 msec_eth;
+};
 
-#if !(defined(GPY211_PC_TEST) && GPY211_PC_TEST)
-	BytestoWrite = snprintf(writebuffer, ARRAY_SIZE(writebuffer), "r %05x\n", (Offset & 0xfffff));
-#else
-	BytestoWrite = snprintf(writebuffer, ARRAY_SIZE(writebuffer), "r %04x\n", (Offset & 0xffff));
-#endif /* GPY211_PC_TEST */
+static const struct cli_param cli_p_msec_sa_nm_ctrl[] = {
+	CLI_NUM(struct cli_sa_nm_ctrl_args, comp_etype, "comp_etype"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_ver, "check_ver"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_kay, "check_kay"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_ce, "check_ce"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_sc, "check_sc"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_sl, "check_sl"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, check_pn, "check_pn"),
+	CLI_NUM(struct cli_sa_nm_ctrl_args, msec_eth, "msec_eth"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf(", read  -> \"%s\"\n", writebuffer);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sa_nm_ncp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
 
-	WriteFile(hComm,
-		  writebuffer,
-		  BytestoWrite,
-		  &BytesWritten,
-		  NULL);
-	i = 0;
-	SetCommMask(hComm, EV_RXCHAR);
-	WaitCommEvent(hComm, &dwEventMask, NULL);
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sam_eec[] = {
+	CLI_NUM(struct sam_ee_ctrl, sam_index_set, "sam_ind_set"),
+	CLI_NUM(struct sam_ee_ctrl, set_enable, "set_single"),
+	CLI_NUM(struct sam_ee_ctrl, set_all, "set_all"),
+	CLI_NUM(struct sam_ee_ctrl, sam_index_clear, "sam_ind_clr"),
+	CLI_NUM(struct sam_ee_ctrl, clear_enable, "clr_single"),
+	CLI_NUM(struct sam_ee_ctrl, clear_all, "clr_all"),
+	CLI_PARAM_END
+};
 
-	do {
-		ReadFile(hComm,
-			 &Temp_Char,
-			 sizeof(Temp_Char),
-			 &No_BytesRead,
-			 NULL);
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sam_eex[] = {
+	CLI_NUM(struct raw_sam_ee, eex_type, "eex_type"),
+	CLI_NUM(struct raw_sam_ee, raw_sam_ee[0], "eex_word0"),
+	CLI_PARAM_END
+};
 
-		uart_Buffer[i] = Temp_Char;
-		i++;
-	} while (No_BytesRead > 0);
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_NUM(struct sa_match_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_match_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_match_fca, flow_crypt_auth, "crypt_auth"),
+	CLI_NUM(struct sa_match_fca, drop_action, "drop_act"),
+	CLI_NUM(struct sa_match_fca, sa_index, "sa_index"),
+	CLI_NUM(struct sa_match_fca, protect_frame, "frame_protect"),
+	CLI_NUM(struct sa_match_fca, sa_in_use, "sa_inuse"),
+	CLI_NUM(struct sa_match_fca, include_sci, "include_sci"),
+	CLI_NUM(struct sa_match_fca, use_es, "use_es"),
+	CLI_NUM(struct sa_match_fca, use_scb, "use_scb"),
+	CLI_NUM(struct sa_match_fca, tag_bypass_size, "tag_bpsize"),
+	CLI_NUM(struct sa_match_fca, sa_index_update, "sa_indup"),
+	CLI_NUM(struct sa_match_fca, conf_offset, "conf_offset"),
+	CLI_NUM(struct sa_match_fca, conf_protect, "conf_protect"),
+	CLI_NUM(struct sa_match_fca, iv, "ivl_mode"),
+	CLI_NUM(struct sa_match_fca, icv_append, "append_icv"),
+	CLI_NUM(struct sa_match_fca, crypt_auth_bypass_len, "ca_bp_len"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		uart_Buffer[i] = 0;
-		printf("\nraw (etc read) from uart\n%s\n", uart_Buffer);
-	}
+struct cli_sam_rule_args {
+	struct sa_match_param match;
+	/* extn_par.flow_index is a bit-field */
+	u8 flow_index;
+};
 
-	if (uart_Buffer[0] == 'r' && uart_Buffer[1] == ' ') {
-#if !(defined(GPY211_PC_TEST) && GPY211_PC_TEST)
-		readbuffer[0] = uart_Buffer[9];
-		readbuffer[1] = uart_Buffer[10];
-		readbuffer[2] = uart_Buffer[11];
-		readbuffer[3] = uart_Buffer[12];
-#else
-		readbuffer[0] = uart_Buffer[8];
-		readbuffer[1] = uart_Buffer[9];
-		readbuffer[2] = uart_Buffer[10];
-		readbuffer[3] = uart_Buffer[11];
-#endif /* GPY211_PC_TEST */
-	} else {
-		system("color 0c");
-		printf("\n\nALERT :Selected COMPORT not functioning properly (Reg read fail)\n\n");
-		printf("1. Please Check whether the Device Under Test is ON\n");
-		printf("2. Please Check the COMPORT connection\n");
-		printf("\nApplication exit in 10 seconds\n");
-		Sleep(10000);
-		scanf("%u", &h);
+static const struct cli_param cli_p_msec_sam_rule[] = {
+	CLI_NUM(struct cli_sam_rule_args, match.rule_index, "rule_index"),
+	CLI_MAC(struct cli_sam_rule_args, match.sa_mac, "sa_mac"),
+	CLI_MAC(struct cli_sam_rule_args, match.da_mac, "da_mac"),
+	CLI_NUM(struct cli_sam_rule_args, match.eth_type, "eth_type"),
+	CLI_NUM(struct cli_sam_rule_args, match.vlan_id, "vlan_id"),
+	CLI_NUM(struct cli_sam_rule_args, match.misc_par.misc, "misc"),
+	CLI_KEY(struct cli_sam_rule_args, match.sci, "sci"),
+	CLI_NUM(struct cli_sam_rule_args, match.mask_par.mask, "mask"),
+	CLI_NUM(struct cli_sam_rule_args, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
 
-		//exit(0);
-		return -1;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_NUM(struct seq_num_thr, sn_threshold, "sn_thr"),
+	CLI_PARAM_END
+};
 
-	*value = str_to_hex(readbuffer);
+static const struct cli_param cli_p_gpy2xx_msec_config_egr_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_NUM(struct transform_rec, ccw.ca_type, "ca_type"),
+	CLI_NUM(struct transform_rec, ccw.an, "an"),
+	CLI_AESKEY(struct transform_rec, cp.key, "key"),
+	CLI_KEY(struct transform_rec, cp.sci, "sci"),
+	CLI_NUM(struct transform_rec, pn_rc.seq_num, "seq_num"),
+	CLI_KEY(struct transform_rec, cp.c_salt.salt, "salt"),
+	CLI_KEY(struct transform_rec, cp.c_salt.s_sci, "short_sci"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index, "next_sa_ind"),
+	CLI_NUM(struct transform_rec, sa_update.sa_expired_irq, "sa_expirq"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index_valid, "sa_indvalid"),
+	CLI_NUM(struct transform_rec, sa_update.flow_index, "flow_index"),
+	CLI_NUM(struct transform_rec, sa_update.sa_ind_update_en, "sa_indupen"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("Read Back Value = %04x\n\n", *value);
-	}
+/* The sam_vlan_parse fields are bit-fields */
+struct cli_vlan_parse_args {
+	u8 qinq_en;
+	u8 stag_en;
+	u8 qtag_en;
+};
 
-	return 1;
-#endif
-}
+static const struct cli_param cli_p_msec_vlan_parse[] = {
+	CLI_NUM(struct cli_vlan_parse_args, qinq_en, "qinq_en"),
+	CLI_NUM(struct cli_vlan_parse_args, stag_en, "stag_en"),
+	CLI_NUM(struct cli_vlan_parse_args, qtag_en, "qtag_en"),
+	CLI_PARAM_END
+};
+
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_aic_csr[] = {
+	CLI_NUM(struct aic_control_stat, enable_ctrl.raw_aic_bits, "enable_ctrl"),
+	CLI_NUM(struct aic_control_stat, ack.raw_aic_bits, "ack"),
+	CLI_NUM(struct aic_control_stat, enable_set.raw_aic_bits, "enable_set"),
+	CLI_NUM(struct aic_control_stat, enable_clr.raw_aic_bits, "enable_clr"),
+	CLI_PARAM_END
+};
 
-int pc_uart_datawrite(u32 Offset, u32 value)
-{
-#if RAPID_UART
-	char buf[256];
-	DWORD written;
-	int size;
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_ctrl[] = {
+	CLI_NUM(struct ing_cc_ctrl, nm_act, "nm_act"),
+	CLI_NUM(struct ing_cc_ctrl, nm_ctrl_act, "nm_ctrl_act"),
+	CLI_PARAM_END
+};
 
-	size = snprintf(buf, ARRAY_SIZE(buf), "w %04x %04x\n", Offset & 0xFFFF, value & 0xFFFF);
+/* The icc_ee_ctrl fields are bit-fields */
+struct cli_cc_eec_args {
+	u32 icc_ind_set;
+	u32 set_single;
+	u32 set_all;
+	u32 icc_ind_clr;
+	u32 clr_single;
+	u32 clr_all;
+};
 
-	if (debugenable) {
-		LOG_CRIT("%s", buf);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_eec[] = {
+	CLI_NUM(struct cli_cc_eec_args, icc_ind_set, "icc_ind_set"),
+	CLI_NUM(struct cli_cc_eec_args, set_single, "set_single"),
+	CLI_NUM(struct cli_cc_eec_args, set_all, "set_all"),
+	CLI_NUM(struct cli_cc_eec_args, icc_ind_clr, "icc_ind_clr"),
+	CLI_NUM(struct cli_cc_eec_args, clr_single, "clr_single"),
+	CLI_NUM(struct cli_cc_eec_args, clr_all, "clr_all"),
+	CLI_PARAM_END
+};
 
-	written = 0;
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_eef[] = {
+	CLI_NUM(struct raw_icc_ee, raw_icc_ee[0], "eec_word0"),
+	CLI_PARAM_END
+};
 
-	if (!WriteFile(hComm,
-		       buf,
-		       (DWORD)size,
-		       &written,
-		       NULL)) {
-		printf("\nWrite COM fail\n");
-		return -1;
-	}
+struct cli_cc_rule_args {
+	struct icc_match_param match;
+	/* vlan_eth.payload_e_type and icc_misc are bit-fields */
+	u32 eth_type;
+	u32 misc;
+};
 
-	return 1;
-#else
-	DWORD BytestoWrite;
-	DWORD BytesWritten = 0;
-	DWORD dwEventMask;
-	unsigned char Temp_Char;
-	unsigned char uart_Buffer[256];
-	char writebuffer[15];
-	unsigned char readbuffer[15];
-	unsigned int i;
-	unsigned int h = 0;
-	DWORD No_BytesRead;
-	BytestoWrite = sizeof(writebuffer);
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cc_rule[] = {
+	CLI_NUM(struct cli_cc_rule_args, match.icc_index, "icc_index"),
+	CLI_NUM(struct cli_cc_rule_args, eth_type, "eth_type"),
+	CLI_NUM(struct cli_cc_rule_args, misc, "misc"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("\n\n#############");
-		printf("\nwrite original offset  -> %x", Offset);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_ctrl[] = {
+	CLI_NUM(struct count_control, reset_all, "rst_all"),
+	CLI_NUM(struct count_control, saturate_cntrs, "ctr_saturate"),
+	CLI_NUM(struct count_control, auto_cntr_reset, "ctr_conr"),
+	CLI_NUM(struct count_control, reset_summary, "rst_summary"),
+	CLI_PARAM_END
+};
 
-	memset(uart_Buffer, 0, 256);
-	memset(writebuffer, 0, 15);
-	memset(readbuffer, 0, 15);
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_incen[] = {
+	CLI_NUM(struct count_incen, sa_inc_en, "sa_inc"),
+	CLI_NUM(struct count_incen, vlan_inc_en, "vlan_inc"),
+	CLI_NUM(struct count_incen, global_inc_en, "global_inc"),
+	CLI_PARAM_END
+};
 
-#if !(defined(GPY211_PC_TEST) && GPY211_PC_TEST)
-	snprintf(writebuffer, ARRAY_SIZE(writebuffer), "w %x %04x\n", (Offset & 0xfffff), value);
-#else
-	snprintf(writebuffer, ARRAY_SIZE(writebuffer), "w %x %04x\n", (Offset & 0xffff), value);
-#endif
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_secfail[] = {
+	CLI_NUM(struct count_secfail, secfail_1.raw_secfail1, "misc_secfail"),
+	CLI_NUM(struct count_secfail, global_secfaill_mask, "global_secfail"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf(", write ->\"%s\"\n", writebuffer);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_count_thresh[] = {
+	CLI_NUM(struct frame_octet_thr, frame_threshold, "frame_thr"),
+	CLI_NUM(struct frame_octet_thr, octet_threshold, "octet_thr"),
+	CLI_PARAM_END
+};
 
-	WriteFile(hComm,
-		  writebuffer,
-		  BytestoWrite,
-		  &BytesWritten,
-		  NULL);
-	i = 0;
-	SetCommMask(hComm, EV_RXCHAR);
-	WaitCommEvent(hComm, &dwEventMask, NULL);
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_cp_rule[] = {
+	CLI_NUM(struct cp_class_param, cpc_index, "cpc_index"),
+	CLI_NUM(struct cp_class_param, cpc_type, "entry_type"),
+	CLI_MAC(struct cp_class_param, mac_da, "da_mac"),
+	CLI_MAC(struct cp_class_param, mac_da_end, "da_end"),
+	CLI_NUM(struct cp_class_param, ether_type, "eth_type"),
+	CLI_NUM(struct cp_class_param, cpm_mode, "cpm_mode"),
+	CLI_NUM(struct cp_class_param, cpm_enable, "cpm_en"),
+	CLI_PARAM_END
+};
 
-	do {
-		ReadFile(hComm,
-			 &Temp_Char,
-			 sizeof(Temp_Char),
-			 &No_BytesRead,
-			 NULL);
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_misc_ctrl[] = {
+	CLI_NUM(struct misc_control, mc_latency_fix, "mc_latency"),
+	CLI_NUM(struct misc_control, static_bypass, "static_bp"),
+	CLI_NUM(struct misc_control, nm_macsec_en, "nm_macsec"),
+	CLI_NUM(struct misc_control, validate_frames, "validate_level"),
+	CLI_NUM(struct misc_control, sectag_after_vlan, "sectag_avlan"),
+	CLI_PARAM_END
+};
 
-		uart_Buffer[i] = Temp_Char;
-		i++;
-	} while (No_BytesRead > 0);
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sa_nm_cp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_non_reserved, "drop_nonres"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
 
-	//printf("\nraw (etc write )read from uar\n%s\n",uart_Buffer);
-	if (uart_Buffer[0] == 'w' && uart_Buffer[1] == ' ') {
-	} else {
-		system("color 0c");
-		printf("\n\nALERT :Selected COMPORT not functioning properly ( Reg Write fail)\n\n");
-		printf("1. Please Check whether the Device Under Test is ON\n");
-		printf("2. Please Check the COMPORT connection\n");
-		printf("\nApplication exit in 10 seconds\n");
-		Sleep(10000);
-		scanf("%u", &h);
-		//exit(0);
-		return -1;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sa_nm_ncp[] = {
+	CLI_NUM(struct sa_nonmatch_fca, pkt_type, "pkt_type"),
+	CLI_NUM(struct sa_nonmatch_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_nonmatch_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_non_reserved, "drop_nonres"),
+	CLI_NUM(struct sa_nonmatch_fca, drop_action, "drop_action"),
+	CLI_PARAM_END
+};
 
-	return 1;
-#endif
-}
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sam_eec[] = {
+	CLI_NUM(struct sam_ee_ctrl, sam_index_set, "sam_ind_set"),
+	CLI_NUM(struct sam_ee_ctrl, set_enable, "set_single"),
+	CLI_NUM(struct sam_ee_ctrl, set_all, "set_all"),
+	CLI_NUM(struct sam_ee_ctrl, sam_index_clear, "sam_ind_clr"),
+	CLI_NUM(struct sam_ee_ctrl, clear_enable, "clr_single"),
+	CLI_NUM(struct sam_ee_ctrl, clear_all, "clr_all"),
+	CLI_PARAM_END
+};
 
-#if ENABLE_UART_32BIT_ACCESS
-int pc_uart_dataread_32(u32 Offset, u32 *value)
-{
-	DWORD BytestoWrite;
-	DWORD BytesWritten = 0;
-	DWORD dwEventMask;
-	unsigned char Temp_Char;
-	unsigned char uart_Buffer[100];
-	char writebuffer[50];
-	unsigned char readbuffer[50];
-	unsigned int i = 0;
-	unsigned int h = 0;
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sam_eex[] = {
+	CLI_NUM(struct raw_sam_ee, eex_type, "eex_type"),
+	CLI_NUM(struct raw_sam_ee, raw_sam_ee[0], "eex_word0"),
+	CLI_PARAM_END
+};
 
-	DWORD No_BytesRead;
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sam_fca[] = {
+	CLI_NUM(struct sa_match_fca, flow_index, "flow_index"),
+	CLI_NUM(struct sa_match_fca, flow_type, "flow_type"),
+	CLI_NUM(struct sa_match_fca, dest_port, "dest_port"),
+	CLI_NUM(struct sa_match_fca, drop_non_reserved, "drop_nonres"),
+	CLI_NUM(struct sa_match_fca, flow_crypt_auth, "crypt_auth"),
+	CLI_NUM(struct sa_match_fca, drop_action, "drop_act"),
+	CLI_NUM(struct sa_match_fca, sa_index, "sa_index"),
+	CLI_NUM(struct sa_match_fca, replay_protect, "rep_protect"),
+	CLI_NUM(struct sa_match_fca, sa_in_use, "sa_inuse"),
+	CLI_NUM(struct sa_match_fca, validate_frames, "validate_level"),
+	CLI_NUM(struct sa_match_fca, iv, "ivl_mode"),
+	CLI_NUM(struct sa_match_fca, icv_verify, "verify_icv"),
+	CLI_NUM(struct sa_match_fca, crypt_auth_bypass_len, "ca_bp_len"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("\n\n#############");
-		printf("\nread original offset  -> %x", Offset);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_NUM(struct seq_num_thr, sn_threshold, "sn_thr"),
+	CLI_PARAM_END
+};
 
-	BytestoWrite = sizeof(writebuffer);
+static const struct cli_param cli_p_gpy2xx_msec_config_ing_tr[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_NUM(struct transform_rec, ccw.ca_type, "ca_type"),
+	CLI_AESKEY(struct transform_rec, cp.key, "key"),
+	CLI_KEY(struct transform_rec, cp.sci, "sci"),
+	CLI_NUM(struct transform_rec, pn_rc.seq_num, "seq_num"),
+	CLI_KEY(struct transform_rec, cp.c_salt.salt, "salt"),
+	CLI_KEY(struct transform_rec, cp.c_salt.s_sci, "short_sci"),
+	CLI_NUM(struct transform_rec, pn_rc.mask, "rep_window"),
+	CLI_PARAM_END
+};
 
-	memset(uart_Buffer, 0, 100);
-	memset(writebuffer, 0, 50);
-	memset(readbuffer, 0, 50);
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_pn[] = {
+	CLI_NUM(struct sa_current_pn, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
 
-	sprintf(writebuffer, "r %05x\n", (Offset));
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("read  -> %s\n", writebuffer);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sa_stats[] = {
+	CLI_NUM(struct egr_sa_stats, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-	WriteFile(hComm,
-		  writebuffer,
-		  BytestoWrite,
-		  &BytesWritten,
-		  NULL);
-	i = 0;
-	SetCommMask(hComm, EV_RXCHAR);
-	WaitCommEvent(hComm, &dwEventMask, NULL);
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sam_fca[] = {
+	CLI_NUM(struct sam_pkt_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
 
-	do {
-		ReadFile(hComm,
-			 &Temp_Char,
-			 sizeof(Temp_Char),
-			 &No_BytesRead,
-			 NULL);
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sam_rule[] = {
+	CLI_NUM(struct raw_sam_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-		uart_Buffer[i] = Temp_Char;
-		i++;
-	} while (No_BytesRead > 0);
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_PARAM_END
+};
 
-	//printf("\nraw (etc read) from uart\n%s\n",uart_Buffer);
+static const struct cli_param cli_p_gpy2xx_msec_get_egr_tr[] = {
+	CLI_NUM(struct raw_trans_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
 
-	if (uart_Buffer[0] == 'r' && uart_Buffer[1] == ' ') {
-		readbuffer[0] = uart_Buffer[9];
-		readbuffer[1] = uart_Buffer[10];
-		readbuffer[2] = uart_Buffer[11];
-		readbuffer[3] = uart_Buffer[12];
-		readbuffer[4] = uart_Buffer[13];
-		readbuffer[5] = uart_Buffer[14];
-		readbuffer[6] = uart_Buffer[15];
-		readbuffer[7] = uart_Buffer[16];
-	} else {
-		system("color 0c");
-		printf("\n\nALERT :Selected COMPORT not functioning properly (Reg read fail)\n\n");
-		printf("1. Please Check whether the Device Under Test is ON\n");
-		printf("2. Please Check the COMPORT connection\n");
-		printf("\nApplication exit in 10 seconds\n");
-		Sleep(10000);
-		scanf("%u", &h);
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_cc_rule[] = {
+	CLI_NUM(struct icc_match_param, icc_index, "icc_index"),
+	CLI_PARAM_END
+};
 
-		//exit(0);
-		return -1;
-	}
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_pn[] = {
+	CLI_NUM(struct sa_current_pn, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
 
-	//printf("\nread buffer= %s\n",readbuffer);
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_psa_stats_summ[] = {
+	CLI_NUM(struct psa_summary, psa_type, "psa_type"),
+	CLI_NUM(struct psa_summary, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-	*value = str_to_hex(readbuffer);
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sa_stats[] = {
+	CLI_NUM(struct ing_sa_stats, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("Read Back Value = %08x\n\n", *value);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sam_fca[] = {
+	CLI_NUM(struct sam_pkt_fca, flow_index, "flow_index"),
+	CLI_PARAM_END
+};
 
-	return 1;
-}
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sam_rule[] = {
+	CLI_NUM(struct raw_sam_param, rule_index, "rule_index"),
+	CLI_PARAM_END
+};
 
-int pc_uart_datawrite_32(u32 Offset, u32 value)
-{
-	DWORD BytestoWrite;
-	DWORD BytesWritten = 0;
-	DWORD dwEventMask;
-	unsigned char Temp_Char;
-	unsigned char uart_Buffer[100];
-	char writebuffer[50];
-	unsigned char readbuffer[50];
-	unsigned int i;
-	unsigned int h = 0;
-	DWORD No_BytesRead;
-	BytestoWrite = sizeof(writebuffer);
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_sn_thresh[] = {
+	CLI_NUM(struct seq_num_thr, sn_type, "sn_type"),
+	CLI_PARAM_END
+};
 
-	if (debugenable) {
-		printf("\n\n#############");
-		printf("\nwrite original offset  -> %x", Offset);
-	}
+static const struct cli_param cli_p_gpy2xx_msec_get_ing_tr[] = {
+	CLI_NUM(struct raw_trans_rec, sa_index, "sa_index"),
+	CLI_PARAM_END
+};
 
-	memset(uart_Buffer, 0, 100);
-	memset(writebuffer, 0, 50);
-	memset(readbuffer, 0, 50);
+static const struct cli_param cli_p_gpy2xx_msec_update_egr_sa_cw[] = {
+	CLI_NUM(struct transform_rec, sa_index, "sa_index"),
+	CLI_NUM(struct transform_rec, ccw.ca_type, "ca_type"),
+	CLI_NUM(struct transform_rec, ccw.sn_type, "sn_type"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index, "next_sa_ind"),
+	CLI_NUM(struct transform_rec, sa_update.sa_expired_irq, "sa_expirq"),
+	CLI_NUM(struct transform_rec, sa_update.sa_index_valid, "sa_indvalid"),
+	CLI_NUM(struct transform_rec, sa_update.flow_index, "flow_index"),
+	CLI_NUM(struct transform_rec, sa_update.sa_ind_update_en, "sa_indupen"),
+	CLI_PARAM_END
+};
 
-	sprintf(writebuffer, "w %05x %08x\n", (Offset), value);
+/*
+ * Command registry. Commands are dispatched by exact, case-insensitive
+ * name with a binary search over these tables, so a command whose name
+ * is a prefix of another (gpy2xx_usxgmii_vr_reset vs.
+ * gpy2xx_usxgmii_vr_reset_sts) can no longer shadow it. Keep the lists
+ * sorted; each entry needs a matching case in gpy211_main() or
+ * gpy2xx_msec_main(), entries compiled out fall to "Command Not Supported".
+ * X(name, params, brief, desc): params is the cli_param schema or NULL when
+ * the handler takes no or hand-parsed parameters, brief is the help line
+ * and desc the parameter description shown below the generated synopsis.
+ */
+#define GPY211_CMD_LIST(X) \
+	X(gpy2xx_abist_read, NULL, \
+	  "Read analog self-test (ABIST) result - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_abist_start, cli_p_gpy2xx_abist_start, \
+	  "Start analog self-test (ABIST) - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_ads_cfg, cli_p_gpy2xx_ads_cfg, \
+	  "Configure Auto-Down-Speed", \
+	  "advertise_enable:  0 Disable / 1 Enable\n" \
+	  "NBaseT_ds_enable:  0 Disable / 1 Enable\n" \
+	  "downshift_cnt_thr: value (5bits)\n" \
+	  "force_reset:       0/1\n" \
+	  "rst_cntdown_timer: value (8bits)\n") \
+	X(gpy2xx_ads_detected, NULL, \
+	  "Get auto-downspeed event", \
+	  NULL) \
+	X(gpy2xx_ads_get, NULL, \
+	  "Get Auto-Down-Speed", \
+	  NULL) \
+	X(gpy2xx_aneg_done, NULL, \
+	  "Get auto-negotiation status", \
+	  NULL) \
+	X(gpy2xx_cdiag_read, NULL, \
+	  "Read cable diagnostic result - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_cdiag_start, NULL, \
+	  "Start cable diagnostic - Check with firwmare developer for more detail.", \
+	  NULL) \
+	X(gpy2xx_cdiag_stop, NULL, \
+	  "Stop cable diagnostic test", \
+	  NULL) \
+	X(gpy2xx_config_advert, cli_p_gpy2xx_config_advert, \
+	  "Advertise auto-negotiation parameters", \
+	  "  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n" \
+	  "               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n" \
+	  "               Autoneg|Pause|Asym_Pause\n") \
+	X(gpy2xx_config_aneg, cli_p_gpy2xx_config_aneg, \
+	  "Restart auto-negotiation or force link", \
+	  "  autoneg:     true/false\n" \
+	  "  advertising: 10baseT_Half|10baseT_Full|100baseT_Half|100baseT_Full\n" \
+	  "               1000baseT_Half|1000baseT_Full|2500baseT_Full|2500baseT_FR\n" \
+	  "               Autoneg|Pause|Asym_Pause\n" \
+	  "  speed:       10/100/1000/2500\n" \
+	  "  duplex:      full/half\n" \
+	  "  pause:       true/false\n" \
+	  "  asym_pause:  true/false\n") \
+	X(gpy2xx_errcnt_cfg, cli_p_gpy2xx_errcnt_cfg, \
+	  "Configure errors/events to be counted", \
+	  "  errcountmode: 0 - receive errors\n" \
+	  "                1 - receive frames\n" \
+	  "                2 - ESD errors\n" \
+	  "                3 - SSD errors\n" \
+	  "                4 - transmit errors\n" \
+	  "                5 - transmit frames\n" \
+	  "                6 - collision events\n" \
+	  "                8 - link down events\n" \
+	  "                9 - auto-downspeed events\n") \
+	X(gpy2xx_errcnt_read, NULL, \
+	  "Read error/event counter", \
+	  NULL) \
+	X(gpy2xx_extin_clr, cli_p_gpy2xx_extin_clr, \
+	  "Clear external interrupt event", \
+	  "  std_istat:   0x0001 - link state change\n" \
+	  "               0x0002 - link speed change\n" \
+	  "               0x0004 - duplex mode change\n" \
+	  "               0x0008 - MDI/MDIX crossover change\n" \
+	  "               0x0020 - MDI polarity change\n" \
+	  "               0x0040 - link's auto-downspeed change\n" \
+	  "               0x0100 - SyncE lost of reference clock\n" \
+	  "               0x0200 - mailbox transaction complete\n" \
+	  "               0x0400 - auto-negotiation complete\n" \
+	  "               0x0800 - auto-negotiation error\n" \
+	  "               0x1000 - next page transmitted\n" \
+	  "               0x2000 - next page received\n" \
+	  "               0x4000 - master/slave resolution error\n" \
+	  "               0x8000 - wake-on-lan event\n") \
+	X(gpy2xx_extin_get, NULL, \
+	  "Get external interrupt event mask", \
+	  NULL) \
+	X(gpy2xx_extin_mask, cli_p_gpy2xx_extin_mask, \
+	  "Enable/disable external interrupt event", \
+	  "  stdImask: 	0x0001 - link state change\n" \
+	  "               0x0002 - link speed change\n" \
+	  "               0x0004 - duplex mode change\n" \
+	  "               0x0008 - MDI/MDIX crossover change\n" \
+	  "               0x0010 - MDI polarity change\n" \
+	  "               0x0020 - link's auto-downspeed change\n" \
+	  "               0x0100 - SyncE lost of reference clock\n" \
+	  "               0x0200 - mailbox transaction complete\n" \
+	  "               0x0400 - auto-negotiation complete\n" \
+	  "               0x0800 - auto-negotiation error\n" \
+	  "               0x1000 - next page transmitted\n" \
+	  "               0x2000 - next page received\n" \
+	  "               0x4000 - master/slave resolution error\n" \
+	  "               0x8000 - wake-on-lan event\n" \
+	  "  extImask:	0x0002 - LPI interrupt\n" \
+	  "  				0x0008 - time stamp FIFO interrupt\n" \
+	  " 				0x0010 - MACSEC egress/ingress Interrupt\n") \
+	X(gpy2xx_get_phy_id, NULL, \
+	  "Read PHY/Chip/Firmware/Driver version number", \
+	  NULL) \
+	X(gpy2xx_gmacf_cfg, cli_p_gpy2xx_gmacf_cfg, \
+	  "Set GMAC-Full's basic config info", \
+	  "  reEn:       dis/en\n" \
+	  "  teEn:       dis/en\n" \
+	  "  preambLen:  0 - 7 bytes of preamble\n" \
+	  "			   1 - 5 bytes of preamble\n" \
+	  "			   2 - 3 bytes of preamble\n" \
+	  "  lbmEn:      dis/en\n" \
+	  "  fdupEn:     dis/en\n" \
+	  "  macSpeed:   0 - 1G\n" \
+	  "			   1 - 2.5G\n" \
+	  "			   2 - 10M\n" \
+	  "			   3 - 100MG\n" \
+	  "  rcWrite1:   dis/en\n") \
+	X(gpy2xx_gmacf_count_ctrl_cfg, cli_p_gpy2xx_gmacf_count_ctrl_cfg, \
+	  "Set GMAC-Full's Rx/Tx counters control info", \
+	  "  rstCnt:     dis/en\n" \
+	  "  stopRoll:   dis/en\n" \
+	  "  conRead:    dis/en\n" \
+	  "  frzCnt:     dis/en\n" \
+	  "  pstCnt:     dis/en\n" \
+	  "  psthFull:   dis/en\n" \
+	  "  cntbcDrop:  dis/en\n") \
+	X(gpy2xx_gmacf_count_ctrl_get, NULL, \
+	  "Get GMAC-Full's counters control info", \
+	  NULL) \
+	X(gpy2xx_gmacf_count_get, NULL, \
+	  "Get GMAC-Full's Rx/Tx counters", \
+	  NULL) \
+	X(gpy2xx_gmacf_count_imask_cfg, cli_p_gpy2xx_gmacf_count_imask_cfg, \
+	  "Set GMAC-Full's counters interrupt mask", \
+	  "  txGb:     dis/en\n" \
+	  "  txUflow:  dis/en\n" \
+	  "  txGood:   dis/en\n" \
+	  "  txOsize:  dis/en\n" \
+	  "  rxGb:     dis/en\n" \
+	  "  rxCrc:    dis/en\n" \
+	  "  rxUsize:  dis/en\n" \
+	  "  rxOsize:  dis/en\n") \
+	X(gpy2xx_gmacf_count_imask_get, NULL, \
+	  "Get GMAC-Full's counters interrupt mask", \
+	  NULL) \
+	X(gpy2xx_gmacf_count_istat_get, NULL, \
+	  "Get GMAC-Full's counters interrupt status", \
+	  NULL) \
+	X(gpy2xx_gmacf_debug_info_get, NULL, \
+	  "Get GMAC-Full's debug info", \
+	  NULL) \
+	X(gpy2xx_gmacf_get, NULL, \
+	  "Get GMAC-Full's basic config info", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_cfg, cli_p_gpy2xx_gmacf_lpi_cfg, \
+	  "Set PM GMAC-Full LPI configuration", \
+	  "  lpintEn:    dis/en\n" \
+	  "  lpiEn:      dis/en\n" \
+	  "  linkUp:     dis/en\n" \
+	  "  txautoEn:   dis/en\n" \
+	  "  timerEn:    dis/en\n" \
+	  "  clkStop:    dis/en\n" \
+	  "  ticTime:    value\n" \
+	  "  twTime:     value\n" \
+	  "  lsTime:     value\n" \
+	  "  entryTime:  value\n") \
+	X(gpy2xx_gmacf_lpi_count_get, NULL, \
+	  "Get GMAC-Full's LPI counters", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_get, NULL, \
+	  "Get PM GMAC-Full LPI configuration", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_imask_cfg, cli_p_gpy2xx_gmacf_lpi_imask_cfg, \
+	  "Set GMAC-Full's LPI interrupt mask", \
+	  "  rxUsc:  dis/en\n" \
+	  "  rxTrc:  dis/en\n" \
+	  "  txUsc:  dis/en\n" \
+	  "  txTrc:  dis/en\n") \
+	X(gpy2xx_gmacf_lpi_imask_get, NULL, \
+	  "Get GMAC-Full's LPI interrupt mask", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_istat_get, NULL, \
+	  "Get GMAC-Full's LPI interrupt status", \
+	  NULL) \
+	X(gpy2xx_gmacf_lpi_stat_get, NULL, \
+	  "Get GMAC-Full LPI status", \
+	  NULL) \
+	X(gpy2xx_gmacf_pkt_cfg, cli_p_gpy2xx_gmacf_pkt_cfg, \
+	  "Set GMAC-Full's packet config info", \
+	  "  jumboEn:    dis/en\n" \
+	  "  jabberDis:  dis/en\n" \
+	  "  wdogDis:    dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n" \
+	  "  sup2kp:     dis/en\n" \
+	  "  macIpg:     0 - 12 Bytes\n" \
+	  "  	           1 - 11 Bytes\n" \
+	  "  	           2 - 10 Bytes\n" \
+	  "  	           3 - 09 Bytes\n" \
+	  "  	           4 - 08 Bytes\n" \
+	  "  	           5 - 07 Bytes\n" \
+	  "  	           6 - 06 Bytes\n" \
+	  "  	           7 - 05 Bytes\n") \
+	X(gpy2xx_gmacf_pkt_filter_cfg, cli_p_gpy2xx_gmacf_pkt_filter_cfg, \
+	  "Set GMAC-Full's packet filter control info", \
+	  "  prEn:       dis/en\n" \
+	  "  passAmc:    dis/en\n" \
+	  "  blockBc:    dis/en\n" \
+	  "  passCtrl:   0 - Block all control packets\n" \
+	  "			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n" \
+	  "			   2 - Forwards all control packets even if they fail the Address filter\n" \
+	  "			   3 - Forwards the control packets that pass the Address filter\n" \
+	  "  safltrEn:   dis/en\n" \
+	  "  rxAll:      dis/en\n") \
+	X(gpy2xx_gmacf_pkt_filter_get, NULL, \
+	  "Get GMAC-Full's packet filter control info", \
+	  NULL) \
+	X(gpy2xx_gmacf_pkt_get, NULL, \
+	  "Get GMAC-Full's packet config info", \
+	  NULL) \
+	X(gpy2xx_gmacf_pm_cfg, cli_p_gpy2xx_gmacf_pm_cfg, \
+	  "Set PM GMAC-Full configuration", \
+	  "  crcPad:     0 - Insert both CRC and Paddding\n" \
+	  "			   1 - Insert CRC only but no Paddding\n" \
+	  "			   2 - Do not insert CRC or Paddding\n" \
+	  "			   3 - Replace CRC but no Paddding\n" \
+	  "  txErr:      dis/en\n" \
+	  "  bigEndian:  dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n") \
+	X(gpy2xx_gmacf_pm_get, NULL, \
+	  "Get PM GMAC-Full configuration", \
+	  NULL) \
+	X(gpy2xx_gmacl_cfg, cli_p_gpy2xx_gmacl_cfg, \
+	  "Set GMAC-Lite's basic config info", \
+	  "  reEn:       dis/en\n" \
+	  "  teEn:       dis/en\n" \
+	  "  preambLen:  0 - 7 bytes of preamble\n" \
+	  "			   1 - 5 bytes of preamble\n" \
+	  "			   2 - 3 bytes of preamble\n" \
+	  "  lbmEn:      dis/en\n" \
+	  "  fdupEn:     dis/en\n" \
+	  "  macSpeed:   0 - 1G\n" \
+	  "			   1 - 2.5G\n" \
+	  "			   2 - 10M\n" \
+	  "			   3 - 100MG\n" \
+	  "  rcWrite1:   dis/en\n") \
+	X(gpy2xx_gmacl_get, NULL, \
+	  "Get GMAC-Lite's basic config info", \
+	  NULL) \
+	X(gpy2xx_gmacl_lpi_cfg, cli_p_gpy2xx_gmacl_lpi_cfg, \
+	  "Set PM GMAC-Lite LPI configuration", \
+	  "  lpintEn:    dis/en\n" \
+	  "  lpiEn:      dis/en\n" \
+	  "  linkUp:     dis/en\n" \
+	  "  txautoEn:   dis/en\n" \
+	  "  timerEn:    dis/en\n" \
+	  "  clkStop:    dis/en\n" \
+	  "  ticTime:    value\n" \
+	  "  twTime:     value\n" \
+	  "  lsTime:     value\n" \
+	  "  entryTime:  value\n") \
+	X(gpy2xx_gmacl_lpi_get, NULL, \
+	  "Get PM GMAC-Lite LPI configuration", \
+	  NULL) \
+	X(gpy2xx_gmacl_lpi_stat_get, NULL, \
+	  "Get GMAC-Lite LPI status", \
+	  NULL) \
+	X(gpy2xx_gmacl_pause_cfg, cli_p_gpy2xx_gmacl_pause_cfg, \
+	  "Set GMAC-Lite's Pause configuration", \
+	  "  fcBusy:   dis/en\n" \
+	  "  gmaclFc:  dis/en\n" \
+	  "  txfcEn:   dis/en\n" \
+	  "  plThresh: 0 - PT-4 slot times\n" \
+	  "			 1 - PT-28 slot times\n" \
+	  "			 2 - PT-36 slot times\n" \
+	  "			 3 - PT-144 slot times\n" \
+	  "			 4 - PT-256 slot times\n" \
+	  "			 5 - PT-512 slot times\n" \
+	  "  zqPause:	 dis/en\n" \
+	  "  pauseTime:value\n" \
+	  "  pauseMac: value\n" \
+	  "  paThresh: value\n" \
+	  "  pdThresh: value\n") \
+	X(gpy2xx_gmacl_pause_get, NULL, \
+	  "Get GMAC-Lite's Pause configuration", \
+	  NULL) \
+	X(gpy2xx_gmacl_pkt_cfg, cli_p_gpy2xx_gmacl_pkt_cfg, \
+	  "Set GMAC-Lite's packet config info", \
+	  "  jumboEn:    dis/en\n" \
+	  "  jabberDis:  dis/en\n" \
+	  "  wdogDis:    dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n" \
+	  "  sup2kp:     dis/en\n" \
+	  "  macIpg:     0 - 12 Bytes\n" \
+	  "  	           1 - 11 Bytes\n" \
+	  "  	           2 - 10 Bytes\n" \
+	  "  	           3 - 09 Bytes\n" \
+	  "  	           4 - 08 Bytes\n" \
+	  "			   5 - 07 Bytes\n" \
+	  "			   6 - 06 Bytes\n" \
+	  "			   7 - 05 Bytes\n") \
+	X(gpy2xx_gmacl_pkt_filter_cfg, cli_p_gpy2xx_gmacl_pkt_filter_cfg, \
+	  "Set GMAC-Lite's packet filter control info", \
+	  "  prEn:       dis/en\n" \
+	  "  passAmc:    dis/en\n" \
+	  "  blockBc:    dis/en\n" \
+	  "  passCtrl:   0 - Block all control packets\n" \
+	  "			   1 - Forwards all control packets except Pause packets even if they fail the Address filter\n" \
+	  "			   2 - Forwards all control packets even if they fail the Address filter\n" \
+	  "			   3 - Forwards the control packets that pass the Address filter\n" \
+	  "  safltrEn:   dis/en\n" \
+	  "  rxAll:      dis/en\n") \
+	X(gpy2xx_gmacl_pkt_filter_get, NULL, \
+	  "Get GMAC-Lite's packet filter control info", \
+	  NULL) \
+	X(gpy2xx_gmacl_pkt_get, NULL, \
+	  "Get GMAC-Lite's packet config info", \
+	  NULL) \
+	X(gpy2xx_gmacl_pm_cfg, cli_p_gpy2xx_gmacl_pm_cfg, \
+	  "Set PM GMAC-Lite configuration", \
+	  "  crcPad:     0 - Insert both CRC and Paddding\n" \
+	  "			   1 - Insert CRC only but no Paddding\n" \
+	  "			   2 - Do not insert CRC or Paddding\n" \
+	  "			   3 - Replace CRC but no Paddding\n" \
+	  "  txErr:      dis/en\n" \
+	  "  bigEndian:  dis/en\n" \
+	  "  pcStrip:    dis/en\n" \
+	  "  crcStrip:   dis/en\n") \
+	X(gpy2xx_gmacl_pm_get, NULL, \
+	  "Get PM GMAC-Lite configuration", \
+	  NULL) \
+	X(gpy2xx_gmacx_bm_cfg, cli_p_gpy2xx_gmacx_bm_cfg, \
+	  "Set PM's Buffer configuration", \
+	  "  sb0Start:   value\n" \
+	  "  sb0End:     value\n" \
+	  "  sb0Pthresh: value\n" \
+	  "  sb1Start:   value\n" \
+	  "  sb1End:	   value\n" \
+	  "  sb1Pthresh: value\n") \
+	X(gpy2xx_gmacx_bm_get, NULL, \
+	  "Get PM's Buffer configuration", \
+	  NULL) \
+	X(gpy2xx_gmacx_bm_status_get, NULL, \
+	  "Get PMs buffer status", \
+	  NULL) \
+	X(gpy2xx_gmacx_pm_hw_reset, NULL, \
+	  "Set PM lavel HW reset", \
+	  NULL) \
+	X(gpy2xx_gmacx_pm_pdi_cfg, cli_p_gpy2xx_gmacx_pm_pdi_cfg, \
+	  "Set PM PDI configuration", \
+	  "  bpMac:      dis/en\n" \
+	  "  bpMsec:     dis/en\n" \
+	  "  dropCrc:    dis/en\n" \
+	  "  dropPerr:   dis/en\n" \
+	  "  dropSfail:  dis/en\n" \
+	  "  dropClass:  dis/en\n" \
+	  "  cust3gEn:   dis/en\n" \
+	  "  sgmiiLb:    dis/en\n") \
+	X(gpy2xx_gmacx_pm_pdi_get, NULL, \
+	  "Get PM PDI configuration", \
+	  NULL) \
+	X(gpy2xx_gpio_cfg, cli_p_gpy2xx_gpio_cfg, \
+	  "Configure GPIO pin", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n" \
+	  "  gpioflags: GPIO configuration flags\n") \
+	X(gpy2xx_gpio_get, cli_p_gpy2xx_gpio_get, \
+	  "Get GPIO pin configuration", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n") \
+	X(gpy2xx_gpio_input, cli_p_gpy2xx_gpio_input, \
+	  "Get GPIO pin input value (low/high)", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n") \
+	X(gpy2xx_gpio_output, cli_p_gpy2xx_gpio_output, \
+	  "Configure GPIO pin output value (low/high)", \
+	  "For internal use.\n" \
+	  "  pinid:     16-bit pin ID\n" \
+	  "  gpioflags: 0 - low, 2 - high\n") \
+	X(gpy2xx_init, NULL, \
+	  "Initialize GPY211 API", \
+	  NULL) \
+	X(gpy2xx_led_br_cfg, cli_p_gpy2xx_led_br_cfg, \
+	  "Configure LED brightness", \
+	  "For internal use.\n" \
+	  "  brightMode: 0 - constant level at max brightness\n" \
+	  "              1 - constant level given by brightlvlmax\n" \
+	  "  brightlvlMin: (0 to 15) - min level of brightness\n" \
+	  "  brightlvlMax: (0 to 15) - max level of brightness\n" \
+	  "  swEdgeDetect: 0 - LED switch edge detection on falling edge\n" \
+	  "				 1 - LED switch edge detection on rising edge\n") \
+	X(gpy2xx_led_br_get, NULL, \
+	  "Get LED brightness configuration", \
+	  "For internal use.\n") \
+	X(gpy2xx_led_if_cfg, cli_p_gpy2xx_led_if_cfg, \
+	  "Configure LED", \
+	  "  ledid:        0~3\n" \
+	  "  colormode:    internal use\n" \
+	  "  slowblinksrc: event to trigger slow blink, refer to below trigger table\n" \
+	  "  fastblinksrc: event to trigger fast blink, refer to below trigger table\n" \
+	  "  constantlyon: event to trigger constant on, refer to below trigger table\n" \
+	  "  pulseflags:   pulse on LED trigger by combination of following events\n" \
+	  "                1 - transmit activity\n" \
+	  "                2 - receive activity\n" \
+	  "                4 - collision\n" \
+	  "Trigger Table\n" \
+	  "   0 - disable\n" \
+	  "   1 - 10Mbps\n" \
+	  "   2 - 100Mbps\n" \
+	  "   4 - 1000Mbps\n" \
+	  "   8 - 2500Mbps link\n") \
+	X(gpy2xx_led_if_get, cli_p_gpy2xx_led_if_get, \
+	  "Get LED configuration", \
+	  "  ledid:        0~3\n") \
+	X(gpy2xx_led_top_cfg, cli_p_gpy2xx_led_top_cfg, \
+	  "LED general configuration", \
+	  "For internal use.\n" \
+	  "  complexscan:  in which state the 'inverse complex SCAN' is activated, refer to below state table\n" \
+	  "  complexblink: in which state the 'complex blinking' is activated, refer to below state table\n" \
+	  "  inversescan:  in which state the 'complex SCAN' is activated, refer to below state table\n" \
+	  "  fastblinkfreq:the slow-blinking frequency, refer to below frequency table\n" \
+	  "  slowblinkfreq:the fast-blinking frequency, refer to below frequency table\n" \
+	  "state table\n" \
+	  "	0 - disable\n" \
+	  "	1 - Link is UP\n" \
+	  "	2 - Device is in power down\n" \
+	  "	3 - Device is in EEE mode\n" \
+	  "	4 - ANEG is running\n" \
+	  "	5 - ABIST is running\n" \
+	  "	6 - CDIAG is running\n" \
+	  "	7 - TEST mode is running\n" \
+	  "frequency table\n" \
+	  "	0 - 2 Hz blinking frequency\n" \
+	  "	1 - 4 Hz blinking frequency\n" \
+	  "	2 - 8 Hz blinking frequency\n" \
+	  "	3 - 16 Hz blinking frequency\n") \
+	X(gpy2xx_led_top_get, NULL, \
+	  "Get LED general configuration", \
+	  "For internal use.\n") \
+	X(gpy2xx_loopback_cfg, cli_p_gpy2xx_loopback_cfg, \
+	  "Configure near/far end loopback", \
+	  "  loopbackmode: 0 - disable test loop\n" \
+	  "                1 - GMII near end test loop\n" \
+	  "                2 - PCS far end test loop\n" \
+	  "                3 - DEC (Digital Echo Canceler) test loop\n" \
+	  "                4 - MDI (RJ45 near end) test loop\n" \
+	  "                5 - far end test loop\n" \
+	  "                8 - GMII near end test loop - LB=1\n") \
+	X(gpy2xx_macsec_disable, NULL, \
+	  "Unconfigure Smart-AZ to disable MACsec", \
+	  NULL) \
+	X(gpy2xx_macsec_enable, cli_p_gpy2xx_macsec_enable, \
+	  "Configure Smart-AZ to enable MACsec", \
+	  "  dropCrc:    dis/en\n" \
+	  "  dropPerr:   dis/en\n" \
+	  "  dropSfail:  dis/en\n" \
+	  "  dropClass:  dis/en\n") \
+	X(gpy2xx_mbox_read16, cli_p_gpy2xx_mbox_read16, \
+	  "PHY's Mbox 16-bit wide register read", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_mbox_read32, cli_p_gpy2xx_mbox_read32, \
+	  "PHY's Mbox 32-bit wide register read", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_mbox_write16, cli_p_reg_write, \
+	  "PHY's Mbox 16-bit wide register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_mbox_write32, cli_p_reg_write, \
+	  "PHY's Mbox 32-bit wide register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_pcs_status_read, NULL, \
+	  "Get PCS status", \
+	  NULL) \
+	X(gpy2xx_pm_freq_tune, cli_p_gpy2xx_pm_freq_tune, \
+	  "Tune the frequency of MACs within GPY in USXGMII Mode", \
+	  "  ppm: 0 - MACs operate at frequency+000ppm\n" \
+	  "		1 - MACs operate at frequency+100ppm\n" \
+	  "		2 - MACs operate at frequency+300ppm\n") \
+	X(gpy2xx_poll_reset, NULL, \
+	  "Poll soft reset status", \
+	  NULL) \
+	X(gpy2xx_ptp_adjfreq, cli_p_gpy2xx_ptp_adjfreq, \
+	  "Adjust frequency of hardware clock", \
+	  "  pbbTime: value\n") \
+	X(gpy2xx_ptp_adjtime, cli_p_gpy2xx_ptp_adjtime, \
+	  "Adjust the system timestamp", \
+	  "  deltaTime: 	value\n") \
+	X(gpy2xx_ptp_aux_cfg, cli_p_gpy2xx_ptp_aux_cfg, \
+	  "Configure PTP Auxiliary timestamp function", \
+	  "  enAux:    	0 - disable,   1 - enable\n" \
+	  "  auxTrigPort: 0 - OUT_TIMER, 1 - GPC0, 2 - GPC1, 3 - GPC2\n") \
+	X(gpy2xx_ptp_auxfifostat, NULL, \
+	  "Get auxiliary timestamp FIFO status", \
+	  NULL) \
+	X(gpy2xx_ptp_disable, NULL, \
+	  "Disable and configure PTP (1588) function", \
+	  NULL) \
+	X(gpy2xx_ptp_enable, cli_p_gpy2xx_ptp_enable, \
+	  "Enable and configure PTP (1588) function", \
+	  "  enPhyTxTs: 	 value\n" \
+	  "  enPhyRxTs: 	 value\n" \
+	  "  enTxOstcEn: 	 value\n" \
+	  "  txPtpOffset:  value\n" \
+	  "  txPtpProto: 	 value\n" \
+	  "  txOstCorTime: value\n") \
+	X(gpy2xx_ptp_fifostat, NULL, \
+	  "Get timestamp FIFO status", \
+	  NULL) \
+	X(gpy2xx_ptp_getauxts, NULL, \
+	  "Get Auxiliary timestamp", \
+	  NULL) \
+	X(gpy2xx_ptp_getcfg, NULL, \
+	  "Get PTP (1588) configuration", \
+	  NULL) \
+	X(gpy2xx_ptp_getrxts, NULL, \
+	  "Get RX packet timestamp status and CRC", \
+	  NULL) \
+	X(gpy2xx_ptp_gettime, NULL, \
+	  "Provides the system timestamp", \
+	  NULL) \
+	X(gpy2xx_ptp_gettxts, NULL, \
+	  "Get TX packet timestamp and CRC status and CRC", \
+	  NULL) \
+	X(gpy2xx_ptp_resetauxfifo, NULL, \
+	  "Reset auxiliary timestamp FIFO status", \
+	  NULL) \
+	X(gpy2xx_ptp_resetfifo, NULL, \
+	  "Resets the timestamp FIFO status", \
+	  NULL) \
+	X(gpy2xx_ptp_set_ppsctrl, cli_p_gpy2xx_ptp_set_ppsctrl, \
+	  "Configures the timestamp PPS control params", \
+	  "  ppsCtrlLow: 	value\n" \
+	  "  targetSec:  	value\n" \
+	  "  targetNsc: 	value\n" \
+	  "  ppsInterval:	value\n" \
+	  "  ppsWidth: 	value\n") \
+	X(gpy2xx_ptp_set_ptoctrl, cli_p_gpy2xx_ptp_set_ptoctrl, \
+	  "Configures the timestamp PTO control params", \
+	  "  ptoCtrlLow: 	value\n" \
+	  "  srcPortID:  	value\n" \
+	  "  logmLvlLow: 	value\n" \
+	  "  logmLvlHi:	value\n") \
+	X(gpy2xx_ptp_set_tsctrl, cli_p_gpy2xx_ptp_set_tsctrl, \
+	  "Configures the timestamp control, second/sub-second increment value", \
+	  "  enEvntMsg:  	dis/en\n" \
+	  "  enMstrMsg: 	dis/en\n" \
+	  "  snapType: 	value\n" \
+	  "  gpcSel: 	value\n") \
+	X(gpy2xx_ptp_settime, cli_p_gpy2xx_ptp_settime, \
+	  "Initialize the system timestamp", \
+	  "  initSec: value\n" \
+	  "  initNsec:value\n") \
+	X(gpy2xx_ptp_txtsstat, NULL, \
+	  "Get Tx timestamp status", \
+	  NULL) \
+	X(gpy2xx_pvt_get, NULL, \
+	  "Get SENSOR temparature", \
+	  NULL) \
+	X(gpy2xx_read, cli_p_gpy2xx_read, \
+	  "Read MDIO Clause 22 registers", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_read_fw_info, NULL, \
+	  "Get FW info (detail)", \
+	  NULL) \
+	X(gpy2xx_read_mmd, cli_p_reg_read_mmd, \
+	  "Read MDIO Clause 45 MMD registers", \
+	  "  devtype: MMD device type\n" \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_read_status, NULL, \
+	  "Get link status (detail)", \
+	  NULL) \
+	X(gpy2xx_restart_aneg, NULL, \
+	  "Enable and restart auto-negotiation", \
+	  NULL) \
+	X(gpy2xx_setup_forced, cli_p_gpy2xx_setup_forced, \
+	  "Configures/forces speed/duplex", \
+	  "  speed:      10/100/1000/2500\n" \
+	  "  duplex:     full/half\n" \
+	  "  pause:      true/false\n" \
+	  "  asym_pause: true/false\n" \
+	  "  mstr_slave: true/false\n") \
+	X(gpy2xx_sgmii_aneg_done, NULL, \
+	  "Check SGMII auto-negotiation status", \
+	  NULL) \
+	X(gpy2xx_sgmii_config_aneg, cli_p_gpy2xx_sgmii_config_aneg, \
+	  "Configure SGMII auto-negotiation", \
+	  "  linkcfg_dir: 0 - SGMII_LINKCFG_TPI / 1 - SGMII_LINKCFG_SGMII\n" \
+	  "  aneg_mode:   1 - SGMII_ANEG_1000BX\n" \
+	  "               2 - SGMII_ANEG_CISCO_PHY\n" \
+	  "               3 - SGMII_ANEG_CISCO_MAC\n" \
+	  "  eee_enable:  0 - disable / 1 - enable\n" \
+	  "  autoneg:     0 - disable / 1 - enable\n" \
+	  "  speed:       10/100/1000/2500\n" \
+	  "  fixed2G5:    0 - TPI speed / 1 - force 2.5G\n" \
+	  "  duplex:      DUPLEX_FULL/DUPLEX_HALF\n") \
+	X(gpy2xx_sgmii_opmode, cli_p_gpy2xx_sgmii_opmode, \
+	  "Configure SGMII operation mode", \
+	  "gpy211_sgmii_opmode <opMode=?>\n" \
+	  "  opMode: 0 - normal oeration\n" \
+	  "		   1 - power down\n" \
+	  "		   2 - loopback\n" \
+	  "		   3 - reset\n") \
+	X(gpy2xx_sgmii_read_status, NULL, \
+	  "Get SGMII link status (detail)", \
+	  NULL) \
+	X(gpy2xx_sgmii_restart_aneg, NULL, \
+	  "Restart SGMII auto-negotiation", \
+	  NULL) \
+	X(gpy2xx_smdio_read, cli_p_gpy2xx_smdio_read, \
+	  "Read internal register (may be disabled by PHY firmware)", \
+	  "smdio_read <regaddr=?>\n" \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_smdio_write, cli_p_reg_write, \
+	  "Write internal register (may be disabled by PHY firmware)", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_soft_reset, NULL, \
+	  "Trigger soft reset via MDIO STD_CTRL", \
+	  NULL) \
+	X(gpy2xx_synce_cfg, cli_p_gpy2xx_synce_cfg, \
+	  "Configure SyncE function", \
+	  "  enSyncE:    0 - disable,    1 - enable\n" \
+	  "  synceRefClk: 0-8KHz,   1-2.048MHz,	2-1.544MHz\n" \
+	  "  masterSlave:	0-slave mode, 1-master mode\n" \
+	  "  dataRate: 	0-1G,		  1-2.5G\n" \
+	  "  gpcSel:		0-GPC1,	1-GPC1,	2-GPC2\n") \
+	X(gpy2xx_synce_get, NULL, \
+	  "Get SyncE configuration", \
+	  NULL) \
+	X(gpy2xx_test_mode_cfg, cli_p_gpy2xx_test_mode_cfg, \
+	  "Set test mode", \
+	  "  testtxmode: 0 - normal operation\n" \
+	  "              1 - Test Mode 1 (Transmit Waveform Test)\n" \
+	  "              2 - Test Mode 2 (Transmit Jitter Test in MASTER Mode)\n" \
+	  "              3 - Test Mode 3 (Transmit Jitter Test in SLAVE Mode)\n" \
+	  "              4 - Test Mode 4 (Transmitter Distortion Test)\n") \
+	X(gpy2xx_topin_cfg, cli_p_gpy2xx_topin_cfg, \
+	  "Configure external interrupt", \
+	  "For internal use.") \
+	X(gpy2xx_topin_clr, cli_p_gpy2xx_topin_clr, \
+	  "Clear external interrupt events", \
+	  "For internal use.\n") \
+	X(gpy2xx_topin_get, cli_p_gpy2xx_topin_get, \
+	  "Get external interrupt configuration", \
+	  "For internal use.\n") \
+	X(gpy2xx_ulp_cfg, cli_p_gpy2xx_ulp_cfg, \
+	  "Configure Ultra Low Power", \
+	  "ulp_enable:  0 Disable / 1 Enable\n" \
+	  "ulp_sta_block:  0 Disable / 1 Enable\n" \
+	  "ulp_exit:  0 Not Exit / 1 Exit ULP\n" \
+	  "master_slice:  Slice to become master <0 to 3>\n") \
+	X(gpy2xx_ulp_get, NULL, \
+	  "Get Ultra Low Power", \
+	  NULL) \
+	X(gpy2xx_uninit, NULL, \
+	  "Clean up GPY211 API", \
+	  NULL) \
+	X(gpy2xx_update_link, NULL, \
+	  "Get link status (up/down)", \
+	  NULL) \
+	X(gpy2xx_usxgmii_alignmentmarker_get, NULL, \
+	  "Get AM_COUNT", \
+	  NULL) \
+	X(gpy2xx_usxgmii_alignmentmarker_set, cli_p_gpy2xx_usxgmii_alignmentmarker_set, \
+	  "Configures AM count", \
+	  "AM Count\n" \
+	  "Valid 0x00 - 0x7FFF\n" \
+	  "	usxgmii_am_count\n") \
+	X(gpy2xx_usxgmii_aneg_rst, NULL, \
+	  "Configures ANEG for Port 0 to 3 (based on phy address)", \
+	  "gpy2xx_usxgmii_aneg_rst  [usxgmii_aneg_disable=?] [usxgmii_force_linkspeed_enable=?] [usxgmii_force_linkspeed=?]  [usxgmii_force_duplex=?] [usxgmii_restart_aneg=?]\n" \
+	  "ANEG configuration\n" \
+	  "aneg enable/disable for port 0 to 3 based on phy addr\n" \
+	  "Valid 1 - disabled / 0 - enabled\n" \
+	  "	usxgmii_aneg_disable\n" \
+	  "restart aneg for port 0 to 3 based on phy addr\n" \
+	  "	usxgmii_restart_aneg\n" \
+	  "force link enable for port 0 to 3 based on phy addr\n" \
+	  "Valid 0 - disabled / 1 - enabled\n" \
+	  "	usxgmii_force_linkspeed\n" \
+	  "force link speed for port 0 to 3 based on phy addr\n" \
+	  "	usxgmii_force_linkspeed\n" \
+	  "		SPEED_10	10\n" \
+	  "		SPEED_100	100\n" \
+	  "		SPEED_1000	1000\n" \
+	  "		SPEED_2500	2500\n" \
+	  "		SPEED_UNKNOWN	-1\n" \
+	  "force duplex for port 0 to 3 based on phy addr\n" \
+	  "Valid 0 - Half duplex / 1 - Full duplex\n" \
+	  "	usxgmii_force_duplex\n") \
+	X(gpy2xx_usxgmii_aneg_sts, NULL, \
+	  "Get Port ANEG status (port 0 to 3 ANEG status based on the phy address)", \
+	  NULL) \
+	X(gpy2xx_usxgmii_loopback_cfg, cli_p_gpy2xx_usxgmii_loopback_cfg, \
+	  "Configures the USXGMII serial and parrallel loop back", \
+	  "Loopback Mode\n" \
+	  "enum mode\n" \
+	  "	USXGMII_LOOPBACK_DISABLE = 0,\n" \
+	  "	USXGMII_LOOPBACK_TX2RX   = 1,\n" \
+	  "	USXGMII_LOOPBACK_RX2TX   = 2,\n") \
+	X(gpy2xx_usxgmii_loopback_get, NULL, \
+	  "Get the USXGMII reach loop back setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_mii_linksts, NULL, \
+	  "Get Port mii linkstatus (port 0 to 3 link status based on the phy address)", \
+	  NULL) \
+	X(gpy2xx_usxgmii_pcs_pma_linksts, NULL, \
+	  "Get PMA and PCS link status", \
+	  NULL) \
+	X(gpy2xx_usxgmii_reach_cfg, cli_p_gpy2xx_usxgmii_reach_cfg, \
+	  "Configures the USXGMII reach customer setting according to master slice (slice 0)", \
+	  "trace_len:         0-short, 1-medium, 2-long, 3-custom\n" \
+	  "tx_eq_main:        0x00 - 0x3F\n" \
+	  "tx_eq_pre:         0x00 - 0x3F\n" \
+	  "tx_eq_post:        0x00 - 0x3F\n" \
+	  "tx_vboost_en:      0 - disable, 1 - enable\n" \
+	  "tx_vboost_lvl:     0x00 - 0x07\n" \
+	  "tx_iboost_lvl:     0x00 - 0x07\n" \
+	  "rx_eq_att_lvl:     0x00 - 0x07\n" \
+	  "rx_eq_vga1_gain:   0x00 - 0x0F\n" \
+	  "rx_eq_vga2_gain:   0x00 - 0x0F\n" \
+	  "rx_eq_ctle_boost:  0x00 - 0x1F\n" \
+	  "rx_eq_ctle_pole:   0x00 - 0x07\n" \
+	  "rx_eq_dfe_tap1:    0x00 - 0xFF\n" \
+	  "rx_afe_adapt_en:	0 - disable, 1 - enable\n" \
+	  "rx_dfe_adapt_en:	0 - disable, 1 - enable\n") \
+	X(gpy2xx_usxgmii_reach_get, NULL, \
+	  "Get the USXGMII reach setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_rx_bert_cfg, cli_p_gpy2xx_usxgmii_rx_bert_cfg, \
+	  "Configures RX bert", \
+	  "rx bert mode configuration\n" \
+	  "enum mode\n" \
+	  "	BERT_PSEUDO_RANDOM_RX = 0\n" \
+	  "	BERT_PRBS31_RX = 1\n" \
+	  "	BERT_PRBS9_RX = 2\n" \
+	  "	BERT_RX_MODE_DISABLE = 3\n") \
+	X(gpy2xx_usxgmii_rx_bert_get, NULL, \
+	  "Get RX bert configuration setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_rx_bert_stat, NULL, \
+	  "Get BERT stats", \
+	  NULL) \
+	X(gpy2xx_usxgmii_tx_bert_cfg, cli_p_gpy2xx_usxgmii_tx_bert_cfg, \
+	  "Configures TX bert", \
+	  "tx bert mode configuration\n" \
+	  "enum mode\n" \
+	  "	BERT_SQUAREWAVE_TX = 0\n" \
+	  "	BERT_PSEUDO_RANDOM_TX = 1\n" \
+	  "	BERT_PRBS31_TX = 2\n" \
+	  "	BERT_PRBS9_TX = 3\n" \
+	  "	BERT_TX_MODE_DISABLE = 4\n" \
+	  "Square Wave Control When square wave test pattern generation is enabled\n" \
+	  "enum nval_sel\n" \
+	  "	BERT_TX_NVAL_SEL_4 = 0\n" \
+	  "	BERT_TX_NVAL_SEL_5 = 1\n" \
+	  "	BERT_TX_NVAL_SEL_6 = 2\n" \
+	  "	BERT_TX_NVAL_SEL_7 = 3\n" \
+	  "	BERT_TX_NVAL_SEL_8 = 4\n" \
+	  "	BERT_TX_NVAL_SEL_9 = 5\n" \
+	  "	BERT_TX_NVAL_SEL_10 = 6\n" \
+	  "	BERT_TX_NVAL_SEL_11 = 7\n" \
+	  "	BERT_TX_NVAL_SEL_UNSUPPORTED = 8\n") \
+	X(gpy2xx_usxgmii_tx_bert_get, NULL, \
+	  "Get TX bert configuration setting", \
+	  NULL) \
+	X(gpy2xx_usxgmii_vr_reset, NULL, \
+	  "Trigger VR reset", \
+	  NULL) \
+	X(gpy2xx_usxgmii_vr_reset_sts, NULL, \
+	  "Get VR reset complete status", \
+	  NULL) \
+	X(gpy2xx_wol_cfg, cli_p_gpy2xx_wol_cfg, \
+	  "Configure Wake-On-Lan function", \
+	  "  woloptions:  combination of following flags\n" \
+	  "               0x20 - wake up when receiving magic packet\n" \
+	  "               0x40 - password enabled\n" \
+	  "  wolmac:      6-byte MAC address of magic packet\n" \
+	  "  wolpassword: 6-byte password\n") \
+	X(gpy2xx_wol_get, NULL, \
+	  "Get Wake-On-Lan configuration", \
+	  NULL) \
+	X(gpy2xx_write, cli_p_reg_write, \
+	  "Write MDIO Clause 22 registers", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_write_mmd, cli_p_reg_write_mmd, \
+	  "Write MDIO Clause 45 MMD registers", \
+	  "  devtype: MMD device type\n" \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(gpy2xx_xpcs_read16, cli_p_gpy2xx_xpcs_read16, \
+	  "PHY's XPCS 16-bit wide register read", \
+	  "  regaddr: register address\n") \
+	X(gpy2xx_xpcs_write16, cli_p_reg_write, \
+	  "PHY's XPCS 16-bit wide register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(pm_ind_read, cli_p_pm_ind_read, \
+	  "PM's indirect register read", \
+	  "  regaddr: register address\n") \
+	X(pm_ind_write, cli_p_reg_write, \
+	  "PM's indirect register write", \
+	  "  regaddr: register address\n" \
+	  "  data:    value\n") \
+	X(test_gpy2xx_ptp_set_ppsctrl, cli_p_test_gpy2xx_ptp_set_ppsctrl, \
+	  "Arms a PPS pulse 15s after the current PTP time", \
+	  NULL)
+
+#define MSEC_CMD_LIST(X) \
+	X(gpy2xx_msec_add_rxsc, NULL, \
+	  "FCON test: add an RX SC", \
+	  NULL) \
+	X(gpy2xx_msec_clear_egr_cc_int_stat, cli_p_msec_clear_cc_int_stat, \
+	  "Clear crypto-cores's context, HW / SW interrupt status", \
+	  "  ctx_stat:     value\n" \
+	  "  int_stat:     value\n") \
+	X(gpy2xx_msec_clear_egr_psa_stats_summ, cli_p_gpy2xx_msec_clear_egr_psa_stats_summ, \
+	  "Clears egress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n" \
+	  "  psa_summ0:        value\n") \
+	X(gpy2xx_msec_clear_egr_sa_exp_summ, cli_p_gpy2xx_msec_clear_egr_sa_exp_summ, \
+	  "Clear SA expired summary flags", \
+	  "  saexp_summ0:     value\n") \
+	X(gpy2xx_msec_clear_egr_sam_fca, cli_p_gpy2xx_msec_clear_egr_sam_fca, \
+	  "Clears egress SAM flow control parameters", \
+	  "  flow_index:  value\n") \
+	X(gpy2xx_msec_clear_egr_sam_rule, cli_p_gpy2xx_msec_clear_egr_sam_rule, \
+	  "Clears egress SAM rule parameters", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_clear_egr_stats_summ, cli_p_gpy2xx_msec_clear_egr_stats_summ, \
+	  "Configure egress SA expired/pn-thr/psa summary", \
+	  "  psa_summ0:       value\n" \
+	  "  glb_summ:        value\n") \
+	X(gpy2xx_msec_clear_egr_tr, cli_p_gpy2xx_msec_clear_egr_tr, \
+	  "Clears egress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_clear_ing_cc_int_stat, cli_p_msec_clear_cc_int_stat, \
+	  "Clear crypto-cores's context, HW / SW interrupt status", \
+	  "  ctx_stat:     value\n" \
+	  "  int_stat:     value\n") \
+	X(gpy2xx_msec_clear_ing_psa_stats_summ, cli_p_gpy2xx_msec_clear_ing_psa_stats_summ, \
+	  "Clears ingress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n" \
+	  "  psa_summ0:        value\n") \
+	X(gpy2xx_msec_clear_ing_sam_fca, cli_p_gpy2xx_msec_clear_ing_sam_fca, \
+	  "Clears ingress SAM flow control parameters", \
+	  "  flow_index:  value\n") \
+	X(gpy2xx_msec_clear_ing_sam_rule, cli_p_gpy2xx_msec_clear_ing_sam_rule, \
+	  "Clears ingress SAM rule parameters", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_clear_ing_stats_summ, cli_p_gpy2xx_msec_clear_ing_stats_summ, \
+	  "Configure ingress SA expired/pn-thr/psa summary", \
+	  "  psa_summ0:       value\n" \
+	  "  glb_summ:        value\n") \
+	X(gpy2xx_msec_clear_ing_tr, cli_p_gpy2xx_msec_clear_ing_tr, \
+	  "Clears ingress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_clear_sa_pn_thr_summ, cli_p_gpy2xx_msec_clear_sa_pn_thr_summ, \
+	  "Clear OPP's SA PN threshold summary flags", \
+	  "  pnthr_summ0:     value\n") \
+	X(gpy2xx_msec_config_egr_aic_csr, cli_p_gpy2xx_msec_config_egr_aic_csr, \
+	  "Configures the egress interrupt  controll and status options", \
+	  "  enable_ctrl:		value\n" \
+	  "  ack:    			value\n" \
+	  "  enable_set:    	value\n" \
+	  "  enable_clr:     	value\n") \
+	X(gpy2xx_msec_config_egr_count_ctrl, cli_p_gpy2xx_msec_config_egr_count_ctrl, \
+	  "Configure egress count controls", \
+	  "  rst_all:       value\n" \
+	  "  ctr_saturate:  value\n" \
+	  "  ctr_conr:      value\n" \
+	  "  rst_summary:   value\n") \
+	X(gpy2xx_msec_config_egr_count_incen, cli_p_gpy2xx_msec_config_egr_count_incen, \
+	  "Configure egress counter increment enables", \
+	  "  sa_inc:        value\n" \
+	  "  vlan_inc:	  value\n" \
+	  "  global_inc: 	  value\n") \
+	X(gpy2xx_msec_config_egr_count_secfail, cli_p_gpy2xx_msec_config_egr_count_secfail, \
+	  "Configure egress secfail event trigger enables", \
+	  "  misc_secfail:    value\n" \
+	  "  global_secfail:	value\n") \
+	X(gpy2xx_msec_config_egr_count_thresh, cli_p_gpy2xx_msec_config_egr_count_thresh, \
+	  "Configure egress counter packet and octet thresholds", \
+	  "  frame_thr:	 value\n" \
+	  "  octet_thr:	 value\n") \
+	X(gpy2xx_msec_config_egr_cp_rule, cli_p_gpy2xx_msec_config_egr_cp_rule, \
+	  "Configure engress control packet classification rule", \
+	  "  cpc_index:       value\n" \
+	  "  entry_type:      value\n" \
+	  "  da_mac:          value\n" \
+	  "  da_end:          value\n" \
+	  "  eth_type:        value\n" \
+	  "  cpm_mode:        value\n" \
+	  "  cpm_en:          value\n") \
+	X(gpy2xx_msec_config_egr_misc_ctrl, cli_p_gpy2xx_msec_config_egr_misc_ctrl, \
+	  "Configure egress misc control", \
+	  "  mc_latency:       value\n" \
+	  "  static_bp         value\n" \
+	  "  nm_macsec:        value\n" \
+	  "  validate_frames:  value\n" \
+	  "  sectag_avlan:     value\n") \
+	X(gpy2xx_msec_config_egr_sa_nm_cp, cli_p_gpy2xx_msec_config_egr_sa_nm_cp, \
+	  "Configure egress SA non-match flow control action for control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_egr_sa_nm_ctrl, cli_p_msec_sa_nm_ctrl, \
+	  "Configure egress no-match classifier control", \
+	  "  comp_etype:		dis/en\n" \
+	  "  check_ver 		dis/en\n" \
+	  "  check_kay:		dis/en\n" \
+	  "  check_ce: 		dis/en\n" \
+	  "  check_sc: 		dis/en\n" \
+	  "  check_sl: 		dis/en\n" \
+	  "  check_pn: 		dis/en\n" \
+	  "  msec_eth: 		value\n") \
+	X(gpy2xx_msec_config_egr_sa_nm_ncp, cli_p_gpy2xx_msec_config_egr_sa_nm_ncp, \
+	  "Configure egress SA non-match flow control action for non-control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_egr_sam_eec, cli_p_gpy2xx_msec_config_egr_sam_eec, \
+	  "Configure egress SA match entry enable clear", \
+	  "  sam_ind_set: value\n" \
+	  "  set_single:  value\n" \
+	  "  set_all:     value\n" \
+	  "  sam_ind_clr: value\n" \
+	  "  clr_single:  value\n" \
+	  "  clr_all:     value\n") \
+	X(gpy2xx_msec_config_egr_sam_eex, cli_p_gpy2xx_msec_config_egr_sam_eex, \
+	  "Configure egress SA match entry enable flags", \
+	  "  eex_type:  value\n" \
+	  "  eex_word0: value\n") \
+	X(gpy2xx_msec_config_egr_sam_fca, cli_p_gpy2xx_msec_config_egr_sam_fca, \
+	  "Configure egress SA matching rule's flow control action parameters", \
+	  "  flow_index:	 value\n" \
+	  "  flow_type:	 value\n" \
+	  "  dest_port:	 value\n" \
+	  "  drop_nonres:  value\n" \
+	  "  crypt_auth:	 value\n" \
+	  "  drop_act:	 value\n" \
+	  "  sa_index:	 value\n" \
+	  "  frame_protect:value\n" \
+	  "  sa_inuse:	 value\n" \
+	  "  include_sci:  value\n" \
+	  "  use_es:		 value\n" \
+	  "  use_scb: 	 value\n" \
+	  "  tag_bpsize:	 value\n" \
+	  "  sa_indup:	 value\n" \
+	  "  conf_offset:  value\n" \
+	  "  conf_protect: value\n") \
+	X(gpy2xx_msec_config_egr_sam_rule, cli_p_msec_sam_rule, \
+	  "Configure egress SA match rule parameters", \
+	  "  rule_index:value\n" \
+	  "  sa_mac:    value\n" \
+	  "  da_mac:    value\n" \
+	  "  eth_type:  value\n" \
+	  "  vlan_id:   value\n" \
+	  "  misc:      value\n" \
+	  "  sci:       value\n" \
+	  "  mask:      value\n" \
+	  "  flow_index:value\n") \
+	X(gpy2xx_msec_config_egr_sn_thresh, cli_p_gpy2xx_msec_config_egr_sn_thresh, \
+	  "Configures the egress sequence number threshold", \
+	  "  sn_type:    	value\n" \
+	  "  sn_thr:     	value\n") \
+	X(gpy2xx_msec_config_egr_tr, cli_p_gpy2xx_msec_config_egr_tr, \
+	  "Configure egress transform record", \
+	  "  sa_index:    value\n" \
+	  "  ca_type:     value\n" \
+	  "  an:          value\n" \
+	  "  key:         value\n" \
+	  "  sci:         value\n" \
+	  "  seq_num:        value\n" \
+	  "  salt:        value\n" \
+	  "  short_sci:    value\n" \
+	  "  next_sa_ind:   value\n" \
+	  "  sa_expirq: value\n" \
+	  "  sa_indvalid:  value\n" \
+	  "  flow_index:  value\n" \
+	  "  sa_indupen:  value\n") \
+	X(gpy2xx_msec_config_egr_vlan_parse, cli_p_msec_vlan_parse, \
+	  "Configure egress SA match VLAN control parameters", \
+	  "  qinq_en: value\n" \
+	  "  stag_en: value\n" \
+	  "  qtag_en: value\n") \
+	X(gpy2xx_msec_config_ing_aic_csr, cli_p_gpy2xx_msec_config_ing_aic_csr, \
+	  "Configures the ingress interrupt  controll and status options", \
+	  "  enable_ctrl:		value\n" \
+	  "  ack:    			value\n" \
+	  "  enable_set:    	value\n" \
+	  "  enable_clr:     	value\n") \
+	X(gpy2xx_msec_config_ing_cc_ctrl, cli_p_gpy2xx_msec_config_ing_cc_ctrl, \
+	  "Configure ingress consistency check control", \
+	  "  nm_act:        value\n" \
+	  "  nm_ctrl_act:   value\n" \
+	  "  etype_max_len: value\n") \
+	X(gpy2xx_msec_config_ing_cc_eec, cli_p_gpy2xx_msec_config_ing_cc_eec, \
+	  "Configure ingress CC match entry enable clear", \
+	  "  icc_ind_set:value\n" \
+	  "  set_single: value\n" \
+	  "  set_all:    value\n" \
+	  "  icc_ind_clr:value\n" \
+	  "  clr_single: value\n" \
+	  "  clr_all:    value\n") \
+	X(gpy2xx_msec_config_ing_cc_eef, cli_p_gpy2xx_msec_config_ing_cc_eef, \
+	  "Configure ingress consistency check entry enable flags", \
+	  "  eec_word0:	value\n") \
+	X(gpy2xx_msec_config_ing_cc_rule, cli_p_gpy2xx_msec_config_ing_cc_rule, \
+	  "Configure ingress consistency check match parameters", \
+	  "  icc_index:   value\n" \
+	  "  eth_type: 	value\n" \
+	  "  misc:        value\n") \
+	X(gpy2xx_msec_config_ing_count_ctrl, cli_p_gpy2xx_msec_config_ing_count_ctrl, \
+	  "Configure ingress count control", \
+	  "  rst_all:       value\n" \
+	  "  ctr_saturate:  value\n" \
+	  "  ctr_conr:      value\n" \
+	  "  rst_summary:   value\n") \
+	X(gpy2xx_msec_config_ing_count_incen, cli_p_gpy2xx_msec_config_ing_count_incen, \
+	  "Configure ingress counter increment enables", \
+	  "  sa_inc:        value\n" \
+	  "  vlan_inc:      value\n" \
+	  "  global_inc: 	  value\n") \
+	X(gpy2xx_msec_config_ing_count_secfail, cli_p_gpy2xx_msec_config_ing_count_secfail, \
+	  "Configure ingress secfail event trigger enables", \
+	  "  misc_secfail:    value\n" \
+	  "  global_secfail:	value\n") \
+	X(gpy2xx_msec_config_ing_count_thresh, cli_p_gpy2xx_msec_config_ing_count_thresh, \
+	  "Configure ingress counter packet and octet thresholds", \
+	  "  frame_thr:	 value\n" \
+	  "  octet_thr:	 value\n") \
+	X(gpy2xx_msec_config_ing_cp_rule, cli_p_gpy2xx_msec_config_ing_cp_rule, \
+	  "Configure ingress control packet classification rule", \
+	  "  cpc_index:       value\n" \
+	  "  entry_type:      value\n" \
+	  "  da_mac:          value\n" \
+	  "  da_end:          value\n" \
+	  "  eth_type:        value\n" \
+	  "  cpm_mode:        value\n" \
+	  "  cpm_en:          value\n") \
+	X(gpy2xx_msec_config_ing_misc_ctrl, cli_p_gpy2xx_msec_config_ing_misc_ctrl, \
+	  "Configure ingress misc control", \
+	  "  mc_latency:       value\n" \
+	  "  static_bp         value\n" \
+	  "  nm_macsec:        value\n" \
+	  "  validate_frames:  value\n" \
+	  "  sectag_avlan:     value\n") \
+	X(gpy2xx_msec_config_ing_sa_nm_cp, cli_p_gpy2xx_msec_config_ing_sa_nm_cp, \
+	  "Configure ingress SA non-match flow control action for control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_nonres:    value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_ing_sa_nm_ctrl, cli_p_msec_sa_nm_ctrl, \
+	  "Configure ingress no-match classifier control", \
+	  "  comp_etype:      dis/en\n" \
+	  "  check_ver        dis/en\n" \
+	  "  check_kay:       dis/en\n" \
+	  "  check_ce:  		dis/en\n" \
+	  "  check_sc:     	dis/en\n" \
+	  "  check_sl:     	dis/en\n" \
+	  "  check_pn:     	dis/en\n" \
+	  "  msec_eth:        value\n") \
+	X(gpy2xx_msec_config_ing_sa_nm_ncp, cli_p_gpy2xx_msec_config_ing_sa_nm_ncp, \
+	  "Configure ingress SA non-match flow control action for non-control packet", \
+	  "  pkt_type:       value\n" \
+	  "  flow_type       value\n" \
+	  "  dest_port:      value\n" \
+	  "  drop_nonres:    value\n" \
+	  "  drop_action:    value\n") \
+	X(gpy2xx_msec_config_ing_sam_eec, cli_p_gpy2xx_msec_config_ing_sam_eec, \
+	  "Configure ingress SA match entry enable clear", \
+	  "  sam_ind_set: value\n" \
+	  "  set_single:  value\n" \
+	  "  set_all:     value\n" \
+	  "  sam_ind_clr: value\n" \
+	  "  clr_single:  value\n" \
+	  "  clr_all:     value\n") \
+	X(gpy2xx_msec_config_ing_sam_eex, cli_p_gpy2xx_msec_config_ing_sam_eex, \
+	  "Configure ingress SA match entry enable flags", \
+	  "  eex_type:  value\n" \
+	  "  eex_word0: value\n") \
+	X(gpy2xx_msec_config_ing_sam_fca, cli_p_gpy2xx_msec_config_ing_sam_fca, \
+	  "Configure ingress SA matching rule's flow control action parameters", \
+	  "  flow_index: 	 value\n" \
+	  "  flow_type:    value\n" \
+	  "  dest_port:    value\n" \
+	  "  drop_nonres:  value\n" \
+	  "  crypt_auth:   value\n" \
+	  "  drop_act:   	 value\n" \
+	  "  sa_index:     value\n" \
+	  "  rep_protect:  value\n" \
+	  "  sa_inuse:     value\n" \
+	  "  validate_level:value\n" \
+	  "  conf_offset:  value\n") \
+	X(gpy2xx_msec_config_ing_sam_rule, cli_p_msec_sam_rule, \
+	  "Configure ingress SA match rule parameters", \
+	  "  rule_index:value\n" \
+	  "  sa_mac:    value\n" \
+	  "  da_mac:    value\n" \
+	  "  eth_type:  value\n" \
+	  "  vlan_id:   value\n" \
+	  "  misc:      value\n" \
+	  "  sci:       value\n" \
+	  "  mask:      value\n" \
+	  "  flow_index:value\n") \
+	X(gpy2xx_msec_config_ing_sn_thresh, cli_p_gpy2xx_msec_config_ing_sn_thresh, \
+	  "Configures the ingress sequence number threshold", \
+	  "  sn_type:    	value\n" \
+	  "  sn_thr:     	value\n") \
+	X(gpy2xx_msec_config_ing_tr, cli_p_gpy2xx_msec_config_ing_tr, \
+	  "Configure ingress transform record", \
+	  "  sa_index:   value\n" \
+	  "  ca_type:    value\n" \
+	  "  key:        value\n" \
+	  "  sci:        value\n" \
+	  "  seq_num     value\n" \
+	  "  salt:       value\n" \
+	  "  short_sci:  value\n" \
+	  "  rep_window: value\n") \
+	X(gpy2xx_msec_config_ing_vlan_parse, cli_p_msec_vlan_parse, \
+	  "Configure ingress SA match VLAN control parameters", \
+	  "  qinq_en: value\n" \
+	  "  stag_en: value\n" \
+	  "  qtag_en: value\n") \
+	X(gpy2xx_msec_cp_stats, NULL, \
+	  "FCON test: get crypto core statistics", \
+	  NULL) \
+	X(gpy2xx_msec_dbg_get, NULL, \
+	  "FCON test: get debug information", \
+	  NULL) \
+	X(gpy2xx_msec_dbg_init_dis, NULL, \
+	  "FCON test: disable debug mode", \
+	  NULL) \
+	X(gpy2xx_msec_dbg_init_enc, NULL, \
+	  "FCON test: debug init of the encrypt side", \
+	  NULL) \
+	X(gpy2xx_msec_dbg_rmon_dec, NULL, \
+	  "FCON test: debug RMON on the decrypt side", \
+	  NULL) \
+	X(gpy2xx_msec_dbg_rmon_enc, NULL, \
+	  "FCON test: debug RMON on the encrypt side", \
+	  NULL) \
+	X(gpy2xx_msec_dbg_sa, NULL, \
+	  "FCON test: debug one word of an SA record", \
+	  NULL) \
+	X(gpy2xx_msec_delete_rxsa, NULL, \
+	  "FCON test: delete an RX SA", \
+	  NULL) \
+	X(gpy2xx_msec_delete_rxsc, NULL, \
+	  "FCON test: delete an RX SC", \
+	  NULL) \
+	X(gpy2xx_msec_delete_txsa, NULL, \
+	  "FCON test: delete a TX SA", \
+	  NULL) \
+	X(gpy2xx_msec_flow_read, NULL, \
+	  "FCON test: dump a range of flow control entries", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_aic_csr, NULL, \
+	  "Gets the egress interrupt  controll and status options", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_cap, NULL, \
+	  "Gets the egress HW capabilities", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_cc_int_stat, NULL, \
+	  "Get crypto-cores's context, HW / SW interrupt status", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_count_thresh, NULL, \
+	  "GEt egress counter packet and octet thresholds", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_debug_stats, NULL, \
+	  "Get egress debug statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_global_stats, NULL, \
+	  "Get egress global statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_pn, cli_p_gpy2xx_msec_get_egr_pn, \
+	  "Get egress current SN from transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_egr_psa_stats_summ, cli_p_gpy2xx_msec_get_egr_psa_stats_summ, \
+	  "Get egress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n") \
+	X(gpy2xx_msec_get_egr_sa_exp_summ, NULL, \
+	  "Gets SA expired summary flags", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_sa_stats, cli_p_gpy2xx_msec_get_egr_sa_stats, \
+	  "Get egress SA statistics", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_get_egr_sam_eef, NULL, \
+	  "Get egress SA match entry enable flags", \
+	  "gpy2xx_msec_get_egr_sam_eef [word_num=?]\n" \
+	  "  word_num: value\n") \
+	X(gpy2xx_msec_get_egr_sam_fca, cli_p_gpy2xx_msec_get_egr_sam_fca, \
+	  "Get ingress SA matching rule's flow control action parameters", \
+	  "  flow_index: 	value\n") \
+	X(gpy2xx_msec_get_egr_sam_rule, cli_p_gpy2xx_msec_get_egr_sam_rule, \
+	  "Get egress SA match rule parameters", \
+	  "  rule_index: value\n") \
+	X(gpy2xx_msec_get_egr_sn_thresh, cli_p_gpy2xx_msec_get_egr_sn_thresh, \
+	  "Gets the ingress squence number threshold", \
+	  "sn_type:	 1 - SN_32_BIT / 2 - SN_64_BIT") \
+	X(gpy2xx_msec_get_egr_stats_summ, NULL, \
+	  "Get egress SA expired/pn-thr/psa summary", \
+	  NULL) \
+	X(gpy2xx_msec_get_egr_tr, cli_p_gpy2xx_msec_get_egr_tr, \
+	  "Get egress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_ing_aic_csr, NULL, \
+	  "Gets the ingress interrupt  controll and status options", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_cap, NULL, \
+	  "Gets the ingress HW capabilities", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_cc_eef, NULL, \
+	  "Get ingress consistency check entry enable flags", \
+	  "gpy2xx_msec_get_ing_cc_eef \n") \
+	X(gpy2xx_msec_get_ing_cc_int_stat, NULL, \
+	  "Get crypto-cores's context, HW / SW interrupt status", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_cc_rule, cli_p_gpy2xx_msec_get_ing_cc_rule, \
+	  "Configure ingress consistency check match parameters", \
+	  "  icc_index:	value\n") \
+	X(gpy2xx_msec_get_ing_count_thresh, NULL, \
+	  "Get ingress counter packet and octet thresholds", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_debug_stats, NULL, \
+	  "Get ingress debug statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_global_stats, NULL, \
+	  "Get ingress global statistics", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_pn, cli_p_gpy2xx_msec_get_ing_pn, \
+	  "Get ingress current SN from transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_ing_psa_stats_summ, cli_p_gpy2xx_msec_get_ing_psa_stats_summ, \
+	  "Get ingress per-SA statistics summary", \
+	  "  psa_type:         value\n" \
+	  "  rule_index:       value\n") \
+	X(gpy2xx_msec_get_ing_sa_stats, cli_p_gpy2xx_msec_get_ing_sa_stats, \
+	  "Get ingress SA statistics", \
+	  "  rule_index:  value\n") \
+	X(gpy2xx_msec_get_ing_sam_eef, NULL, \
+	  "Get ingress SA match entry enable flags", \
+	  "gpy2xx_msec_get_ing_sam_eef [word_num=?]\n" \
+	  "  word_num: value\n") \
+	X(gpy2xx_msec_get_ing_sam_fca, cli_p_gpy2xx_msec_get_ing_sam_fca, \
+	  "Get ingress SA matching rule's flow control action parameters", \
+	  "  flow_index: 	value\n") \
+	X(gpy2xx_msec_get_ing_sam_rule, cli_p_gpy2xx_msec_get_ing_sam_rule, \
+	  "Get ingress SA match rule parameters", \
+	  "  rule_index: value\n") \
+	X(gpy2xx_msec_get_ing_sn_thresh, cli_p_gpy2xx_msec_get_ing_sn_thresh, \
+	  "Gets the ingress Sequence Number threshold", \
+	  "sn_type:    1 - SN_32_BIT / 2 - SN_64_BIT") \
+	X(gpy2xx_msec_get_ing_stats_summ, NULL, \
+	  "Get ingress SA expired/pn-thr/psa summary", \
+	  NULL) \
+	X(gpy2xx_msec_get_ing_tr, cli_p_gpy2xx_msec_get_ing_tr, \
+	  "Get ingress transform record", \
+	  "  sa_index:  value\n") \
+	X(gpy2xx_msec_get_sa_pn_thr_summ, NULL, \
+	  "Get OPP's SA PN threshold summary flags", \
+	  NULL) \
+	X(gpy2xx_msec_init, NULL, \
+	  "FCON test: initialize the MACsec device", \
+	  NULL) \
+	X(gpy2xx_msec_init_egr_dev, NULL, \
+	  "Init macsec EGR device", \
+	  NULL) \
+	X(gpy2xx_msec_init_ing_dev, NULL, \
+	  "Init macsec ING device", \
+	  NULL) \
+	X(gpy2xx_msec_install_rxsa, NULL, \
+	  "FCON test: install an RX SA", \
+	  NULL) \
+	X(gpy2xx_msec_install_txsa, NULL, \
+	  "FCON test: install a TX SA", \
+	  NULL) \
+	X(gpy2xx_msec_mti_en, NULL, \
+	  "FCON test: enable or disable meta information", \
+	  NULL) \
+	X(gpy2xx_msec_mti_get, NULL, \
+	  "FCON test: get the meta information setting", \
+	  NULL) \
+	X(gpy2xx_msec_print_pdata, NULL, \
+	  "FCON test: print the driver private data", \
+	  NULL) \
+	X(gpy2xx_msec_read, NULL, \
+	  "FCON test: read a MACsec register", \
+	  NULL) \
+	X(gpy2xx_msec_rmon_clear, NULL, \
+	  "FCON test: clear RMON counters", \
+	  NULL) \
+	X(gpy2xx_msec_rmon_get, NULL, \
+	  "FCON test: get RMON counters for a range of SAs", \
+	  NULL) \
+	X(gpy2xx_msec_sa_read, NULL, \
+	  "FCON test: dump a range of SA records", \
+	  NULL) \
+	X(gpy2xx_msec_secy_info, NULL, \
+	  "FCON test: set the SecY parameters", \
+	  NULL) \
+	X(gpy2xx_msec_sptag_en, NULL, \
+	  "FCON test: enable or disable the special tag", \
+	  NULL) \
+	X(gpy2xx_msec_sptag_get, NULL, \
+	  "FCON test: get the special tag setting", \
+	  NULL) \
+	X(gpy2xx_msec_stat_kat1, NULL, \
+	  "FCON test: get known-answer test 1 status", \
+	  NULL) \
+	X(gpy2xx_msec_stat_kat2, NULL, \
+	  "FCON test: get known-answer test 2 status", \
+	  NULL) \
+	X(gpy2xx_msec_stat_kat3, NULL, \
+	  "FCON test: get known-answer test 3 status", \
+	  NULL) \
+	X(gpy2xx_msec_test_kat1, NULL, \
+	  "FCON test: run known-answer test 1", \
+	  NULL) \
+	X(gpy2xx_msec_test_kat2, NULL, \
+	  "FCON test: run known-answer test 2", \
+	  NULL) \
+	X(gpy2xx_msec_test_kat3, NULL, \
+	  "FCON test: run known-answer test 3", \
+	  NULL) \
+	X(gpy2xx_msec_uninit, NULL, \
+	  "FCON test: uninitialize the MACsec device", \
+	  NULL) \
+	X(gpy2xx_msec_update_egr_sa_cw, cli_p_gpy2xx_msec_update_egr_sa_cw, \
+	  "Update egress SA control word", \
+	  "  sa_index:    value\n" \
+	  "  ca_type:     value\n" \
+	  "  sn_type:     value\n" \
+	  "  next_sa_ind: value\n" \
+	  "  sa_expirq:   value\n" \
+	  "  sa_indvalid: value\n" \
+	  "  flow_index:  value\n" \
+	  "  sa_indupen:  value\n") \
+	X(gpy2xx_msec_update_rxsa, NULL, \
+	  "FCON test: update an RX SA", \
+	  NULL) \
+	X(gpy2xx_msec_update_txsa, NULL, \
+	  "FCON test: update a TX SA", \
+	  NULL) \
+	X(gpy2xx_msec_write, NULL, \
+	  "FCON test: write a MACsec register", \
+	  NULL)
+
+#define CLI_CMD_ENUM(name, params, brief, desc)	CLI_CMD_##name,
+#define CLI_CMD_ENTRY(name, params, brief, desc) \
+	{ #name, CLI_CMD_##name, brief, desc, params },
+
+enum cli_cmd_id {
+	CLI_CMD_NONE = -1,
+	GPY211_CMD_LIST(CLI_CMD_ENUM)
+	MSEC_CMD_LIST(CLI_CMD_ENUM)
+};
 
-	if (debugenable) {
-		printf("write ->%s\n", writebuffer);
-	}
+struct cli_cmd {
+	const char *name;
+	int id;
+	const char *brief;
+	const char *desc;
+	const struct cli_param *params;
+};
 
-	WriteFile(hComm,
-		  writebuffer,
-		  BytestoWrite,
-		  &BytesWritten,
-		  NULL);
-	i = 0;
-	SetCommMask(hComm, EV_RXCHAR);
-	WaitCommEvent(hComm, &dwEventMask, NULL);
+static const struct cli_cmd gpy211_cmds[] = {
+	GPY211_CMD_LIST(CLI_CMD_ENTRY)
+};
 
-	do {
-		ReadFile(hComm,
-			 &Temp_Char,
-			 sizeof(Temp_Char),
-			 &No_BytesRead,
-			 NULL);
+static const struct cli_cmd msec_cmds[] = {
+	MSEC_CMD_LIST(CLI_CMD_ENTRY)
+};
 
-		uart_Buffer[i] = Temp_Char;
-		i++;
-	} while (No_BytesRead > 0);
+static int cli_cmd_cmp(const void *a, const void *b)
+{
+	return strcasecmp(((const struct cli_cmd *)a)->name, ((const struct cli_cmd *)b)->name);
+}
 
-	//printf("\nraw (etc write )read from uar\n%s\n",uart_Buffer);
-	if (uart_Buffer[0] == 'w' && uart_Buffer[1] == ' ') {
-	} else {
-		system("color 0c");
-		printf("\n\nALERT :Selected COMPORT not functioning properly ( Reg Write fail)\n\n");
-		printf("1. Please Check whether the Device Under Test is ON\n");
-		printf("2. Please Check the COMPORT connection\n");
-		printf("\nApplication exit in 10 seconds\n");
-		Sleep(10000);
-		scanf("%u", &h);
-		//exit(0);
-		return -1;
-	}
+static const struct cli_cmd *cli_cmd_lookup(const struct cli_cmd *tab, size_t size, const char *name)
+{
+	struct cli_cmd key = { name, CLI_CMD_NONE };
 
-	return 1;
+	if (name == NULL)
+		return NULL;
+
+	return bsearch(&key, tab, size, sizeof(*tab), cli_cmd_cmp);
 }
-#endif
 
-#if (defined(GPY211_PC_TEST) && GPY211_PC_TEST)
-static char *findArgParam(int argc, char *argv[], char *name)
+/* Store one parameter value, 0 if the value does not fit the type */
+static int cli_store(const struct cli_param *p, char *val, void *dst)
 {
-	int i = 0;
+	unsigned long long int num;
 	size_t len;
 
-	len = strlen(name);
+	switch (p->type) {
+	case CLI_P_NUM:
+		if (!parse_num(val, &num))
+			return 0;
 
-	for (i = 0; i < argc; i++) {
-		if (xstrncasecmp(name, argv[i], len) == 0) {
-			if (strlen(argv[i]) > (len + 1)) {
+		store_num(num, p->size, dst);
+		return 1;
 
-				if ('=' == argv[i][len]) {
-					return argv[i] + len + 1;
-				}
-			}
-		}
+	case CLI_P_MAC:
+		return convert_mac_adr_str(val, dst);
+
+	case CLI_P_KEY:
+		copy_key_to_dst(val, p->size, dst);
+		return strlen(val) == (size_t)p->size * 2;
+
+	case CLI_P_AESKEY:
+		/* 128 or 256 bit key, the length selects the key size */
+		len = strlen(val);
+		copy_key_to_dst(val, (len == 32 || len == 64) ? len / 2 : p->size, dst);
+		return len == 32 || len == 64;
+
+	case CLI_P_ADVERT:
+		parse_advert(val, dst);
+		return 1;
+
+	case CLI_P_STR:
+		*(char **)dst = val;
+		return 1;
 	}
 
-	return NULL;
+	return 0;
 }
 
-int scanParamArg(int argc, char *argv[], char *name, int size, void *param)
+/*
+ * Fill the handler's struct at base from the name=value arguments in a
+ * single pass over argv. Names match case-insensitively and the first
+ * occurrence of a name is used, as with findArgParam(). Parameters not
+ * given keep their value or get their schema default. Returns a mask
+ * with bit n set if params[n] was given with a valid value, so a schema
+ * holds at most 32 parameters.
+ */
+static u32 cli_parse(const struct cli_cmd *cmd, int argc, char *argv[], void *base)
 {
-	unsigned long long int tmp;
-	char *endptr;
-
-	char *ptr = findArgParam(argc, argv, name);
+	const struct cli_param *p;
+	u32 seen = 0, tried = 0;
+	size_t len;
+	char *eq;
+	int i, n;
 
-	if (ptr == NULL) return 0;
+	if (cmd == NULL || cmd->params == NULL)
+		return 0;
 
-	/* check if the given parameter value are the boolean "LTQ_TRUE" / "LTQ_FALSE" */
+	for (i = 0; i < argc; i++) {
+		eq = strchr(argv[i], '=');
 
-	if (0 == xstrncasecmp(ptr, "LTQ_TRUE", strlen(ptr))
-	    || 0 == xstrncasecmp(ptr, "TRUE", strlen(ptr))
-	    || 0 == xstrncasecmp(ptr, "FULL", strlen(ptr))) {
-		tmp = 1;
-	} else if (0 == xstrncasecmp(ptr, "LTQ_FALSE", strlen(ptr))
-		   || 0 == xstrncasecmp(ptr, "FALSE", strlen(ptr))
-		   || 0 == xstrncasecmp(ptr, "HALF", strlen(ptr))) {
-		tmp = 0;
-	} else {
-		/* scan for a number */
-		tmp = strtoull(ptr, &endptr, 0);
+		if (eq == NULL || eq == argv[i] || eq[1] == 0)
+			continue;
 
-		/* parameter detection does not work in case there are more character after the provided number */
-		if (*endptr != '\0')
-			return 0;
-	}
+		len = eq - argv[i];
 
-	if (size <= 4)
-		size *= 8;
+		for (p = cmd->params, n = 0; p->name != NULL; p++, n++) {
+			if (strlen(p->name) == len && xstrncasecmp(p->name, argv[i], len) == 0)
+				break;
+		}
 
-	if (size == 8)
-		*((char *)param) = (char)tmp;
-	else if (size == 16)
-		*((short *)param) = (short)tmp;
-	else if (size == 32)
-		*((int *)param) = (int)tmp;
-	else if (size == 64)
-		*((long long *)param) = (long long)tmp;
+		if (p->name == NULL || (tried & (1u << n)))
+			continue;
 
-	return 1;
-}
+		tried |= 1u << n;
 
-int scanMAC_Arg(int argc, char *argv[], char *name, unsigned char *param)
-{
-	char *ptr = findArgParam(argc, argv, name);
+		if (cli_store(p, eq + 1, (u8 *)base + p->offset))
+			seen |= 1u << n;
+	}
 
-	if (ptr == NULL) return 0;
+	for (p = cmd->params, n = 0; p->name != NULL; p++, n++) {
+		if (p->has_def && !(seen & (1u << n)))
+			store_num(p->def, p->size, (u8 *)base + p->offset);
+	}
 
-	return convert_mac_adr_str(ptr, param);
+	return seen;
 }
 
-int scanKey_Arg(int argc, char *argv[], char *name, u8 size, char *param)
+/* Check in the cli_parse() result if the parameter name was given */
+static int cli_given(const struct cli_cmd *cmd, u32 seen, const char *name)
 {
-	char *ptr = findArgParam(argc, argv, name);
+	const struct cli_param *p;
+	int n;
 
-	if (ptr == NULL) return 0;
+	for (p = cmd->params, n = 0; p->name != NULL; p++, n++) {
+		if (strcasecmp(p->name, name) == 0)
+			return (seen >> n) & 1;
+	}
 
-	return copy_key_to_dst(ptr, size, param);
+	return 0;
 }
 
-static struct {
-	const char *name;
-	enum link_mode_bit_indices bit;
-} phy_advert[] = {
-	{"10baseT_Half", LINK_MODE_10baseT_Half_BIT},
-	{"10baseT_Full", LINK_MODE_10baseT_Full_BIT},
-	{"100baseT_Half", LINK_MODE_100baseT_Half_BIT},
-	{"100baseT_Full", LINK_MODE_100baseT_Full_BIT},
-	{"1000baseT_Half", LINK_MODE_1000baseT_Half_BIT},
-	{"1000baseT_Full", LINK_MODE_1000baseT_Full_BIT},
-	{"2500baseT_Full", LINK_MODE_2500baseT_Full_BIT},
-	{"2500baseT_FR", LINK_MODE_2500baseT_FR_BIT},
-	{"5000baseT_Full", LINK_MODE_5000baseT_Full_BIT},
-	{"5000baseT_FR", LINK_MODE_5000baseT_FR_BIT},
-	{"Autoneg", LINK_MODE_Autoneg_BIT},
-	{"Pause", LINK_MODE_Pause_BIT},
-	{"Asym_Pause", LINK_MODE_Asym_Pause_BIT},
+/* Commands handled outside gpy211_main(), listed first by help */
+static const struct cli_cmd cli_builtins[] = {
+	{
+		"exit", CLI_CMD_NONE,
+		"Exit GPY211 utility tool",
+		NULL,
+		NULL
+	},
+	{
+		"help", CLI_CMD_NONE,
+		"Print this help page",
+		NULL,
+		NULL
+	},
+	{
+		"en_debug", CLI_CMD_NONE,
+		"Enable debugging codes",
+		"en_debug <option>\n"
+		"  option: 0 - disable, 1 -enable\n",
+		NULL
+	},
 };
 
-static int scan_advert(int argc, char *argv[], char *name, u64 *param)
+/* Print "name [param=type] ..." for the schema, wrapped at 80 columns */
+static void cli_print_synopsis(const struct cli_cmd *cmd)
 {
-	char *p, *p1, *p2;
-	unsigned int i;
+	const struct cli_param *p;
+	unsigned int col;
+	char buf[80];
+	int ndef = 0;
 
-	p = findArgParam(argc, argv, name);
+	col = printf("%s", cmd->name);
 
-	if (p == NULL)
-		return 0;
+	for (p = cmd->params; p->name != NULL; p++) {
+		switch (p->type) {
+		case CLI_P_MAC:
+			snprintf(buf, sizeof(buf), "[%s=xx:xx:xx:xx:xx:xx]", p->name);
+			break;
 
-	*param = 0;
+		case CLI_P_KEY:
+			snprintf(buf, sizeof(buf), "[%s=hex%u]", p->name, p->size * 2);
+			break;
 
-	for (p1 = p; *p1 != 0; p1 = p2) {
-		for (p2 = p1; *p2 != 0 && *p2 != ',' && *p2 != '|' && *p2 != ';'; p2++);
+		case CLI_P_AESKEY:
+			snprintf(buf, sizeof(buf), "[%s=hex32|hex64]", p->name);
+			break;
 
-		if (*p2 != 0) {
-			*p2 = 0;
-			p2++;
-		}
+		case CLI_P_ADVERT:
+			snprintf(buf, sizeof(buf), "[%s=mode|...]", p->name);
+			break;
 
-		if (*p1 == 0)
-			continue;
+		case CLI_P_STR:
+			snprintf(buf, sizeof(buf), "[%s=str]", p->name);
+			break;
 
-		for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
-			if (strcasecmp(p1, phy_advert[i].name) == 0) {
-				*param |= (u64)1 << phy_advert[i].bit;
-				break;
-			}
+		default:
+			snprintf(buf, sizeof(buf), "[%s=num]", p->name);
+			break;
+		}
+
+		if (col + 1 + strlen(buf) > 79) {
+			printf("\n   ");
+			col = 3;
 		}
+
+		col += printf(" %s", buf);
+		ndef += p->has_def;
 	}
 
-	return 1;
+	printf("\n");
+
+	if (ndef == 0)
+		return;
+
+	printf("  defaults:");
+
+	for (p = cmd->params; p->name != NULL; p++) {
+		if (p->has_def)
+			printf(" %s=%lld", p->name, p->def);
+	}
+
+	printf("\n");
 }
 
-static int print_advert(char *buf, unsigned int size, u64 param)
+static const struct cli_cmd *cli_help_lookup(const char *name)
 {
-	char *p = buf;
-	unsigned int flag = 0;
-	unsigned int total_len = 0;
-	unsigned int len;
+	const struct cli_cmd *cmd;
 	unsigned int i;
 
-	strncpy(buf, "none", size);
-	buf[size - 1] = 0;
+	for (i = 0; i < ARRAY_SIZE(cli_builtins); i++) {
+		if (strcasecmp(name, cli_builtins[i].name) == 0)
+			return &cli_builtins[i];
+	}
 
-	for (i = 0; i < ARRAY_SIZE(phy_advert); i++) {
-		if ((param & ((u64)1 << phy_advert[i].bit))) {
-			len = strlen(phy_advert[i].name);
+	cmd = cli_cmd_lookup(gpy211_cmds, ARRAY_SIZE(gpy211_cmds), name);
 
-			if (flag == 0) {
-				if (total_len + len + 1 >= size)
-					break;
+	if (cmd == NULL)
+		cmd = cli_cmd_lookup(msec_cmds, ARRAY_SIZE(msec_cmds), name);
 
-				flag++;
-			} else {
-				if (total_len + len + 4 >= size)
-					break;
+	return cmd;
+}
 
-				p[0] = ' ';
-				p[1] = '|';
-				p[2] = ' ';
-				p += 3;
-				total_len += 3;
+static void gpy211_menu(const char *name)
+{
+	static const struct {
+		const struct cli_cmd *tab;
+		unsigned int size;
+	} tabs[] = {
+		{ cli_builtins, ARRAY_SIZE(cli_builtins) },
+		{ gpy211_cmds, ARRAY_SIZE(gpy211_cmds) },
+		{ msec_cmds, ARRAY_SIZE(msec_cmds) },
+	};
+	const struct cli_cmd *cmd;
+	unsigned int len, max_len;
+	unsigned int i, j;
+
+	if (name == NULL) {
+		printf("\n\n\n\tGPY211 Utility Tool Version   : %s", TOOL_VERSION);
+		printf("\n\t*************************************\n\n");
+
+		max_len = 0;
+
+		for (i = 0; i < ARRAY_SIZE(tabs); i++) {
+			for (j = 0; j < tabs[i].size; j++) {
+				len = strlen(tabs[i].tab[j].name);
+
+				if (max_len < len)
+					max_len = len;
 			}
+		}
 
-			strcpy(p, phy_advert[i].name);
-			p += len;
-			total_len += len;
+		for (i = 0; i < ARRAY_SIZE(tabs); i++) {
+			for (j = 0; j < tabs[i].size; j++)
+				printf("\t %-*s : %s\n", max_len, tabs[i].tab[j].name, tabs[i].tab[j].brief);
 		}
-	}
 
-	return (int)total_len;
+		printf("\n\nIMPORTANT NOTE:\n");
+		printf("\nFor hex decimal input param please add 0x before the hex decimal number or just give decimal number");
+		printf("\nPrefix hex decimal value with 0x or GPY211 command execution will lead to wrong setting or malfunction\n");
+		printf("\n");
+	} else {
+		cmd = cli_help_lookup(name);
+
+		if (cmd == NULL)
+			return;
+
+		if (cmd->params != NULL)
+			cli_print_synopsis(cmd);
+		else if (cmd->desc == NULL)
+			printf("%s does not have parameter.\n", cmd->name);
+
+		if (cmd->desc != NULL)
+			printf("%s", cmd->desc);
+	}
 }
 
 int gpy2xx_msec_main(int argc, char *argv[])
 {
 	s32 ret = 0;
+#if FCON_MSEC_TEST
+	/* The FCON_MSEC_TEST commands still parse their arguments by hand */
 	s32 cnt = 0;
+#endif
+	const struct cli_cmd *cmd = cli_cmd_lookup(msec_cmds, ARRAY_SIZE(msec_cmds), argv[0]);
 
 	if (xstrncasecmp(argv[0], "gpy2xx_init", strlen("gpy2xx_init")) != 0) {
 		if (phy.priv_data == 0) {
@@ -3175,14 +4070,17 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 	}
 
-	if (xstrncasecmp(argv[0], "gpy2xx_msec_init_ing_dev", strlen("gpy2xx_msec_init_ing_dev")) == 0) {
+	switch (cmd != NULL ? cmd->id : CLI_CMD_NONE) {
+	case CLI_CMD_gpy2xx_msec_init_ing_dev: {
 		ret = gpy2xx_msec_init_ing_dev(&phy);
 
 		if (ret < 0) {
 			printf("\nERROR: Init ING dev failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_init_egr_dev", strlen("gpy2xx_msec_init_egr_dev")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_init_egr_dev: {
 		ret = gpy2xx_msec_init_egr_dev(&phy);
 
 		if (ret < 0) {
@@ -3191,7 +4089,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 
 #if FCON_MSEC_TEST
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_init", strlen("gpy2xx_msec_init")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_init: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3211,7 +4111,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_init failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_uninit", strlen("gpy2xx_msec_uninit")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_uninit: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3231,7 +4133,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_uninit failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_read", strlen("gpy2xx_msec_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_read: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3253,7 +4157,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_read failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_write", strlen("gpy2xx_msec_write")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_write: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3277,7 +4183,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_write failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_sa_read", strlen("gpy2xx_msec_sa_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_sa_read: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3300,7 +4208,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_sa_read failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_flow_read", strlen("gpy2xx_msec_flow_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_flow_read: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3323,7 +4233,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_flow_read failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_sptag_en", strlen("gpy2xx_msec_sptag_en")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_sptag_en: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3344,7 +4256,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_sptag_en failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_sptag_get", strlen("gpy2xx_msec_sptag_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_sptag_get: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3363,7 +4277,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_sptag_get failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_mti_en", strlen("gpy2xx_msec_mti_en")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_mti_en: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3384,7 +4300,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_meta_en failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_mti_get", strlen("gpy2xx_msec_mti_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_mti_get: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3403,7 +4321,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_mtu_get failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_rmon_get", strlen("gpy2xx_msec_rmon_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_rmon_get: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3426,7 +4346,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_rmon_get failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_rmon_clear", strlen("gpy2xx_msec_rmon_clear")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_rmon_clear: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3445,7 +4367,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_rmon_clear failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_dbg_rmon_enc", strlen("gpy2xx_msec_dbg_rmon_enc")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_dbg_rmon_enc: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3464,7 +4388,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_dbg_rmon_enc failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_dbg_rmon_dec", strlen("gpy2xx_msec_dbg_rmon_dec")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_dbg_rmon_dec: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3483,7 +4409,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_dbg_rmon_dec failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_dbg_init_enc", strlen("gpy2xx_msec_dbg_init_enc")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_dbg_init_enc: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3502,7 +4430,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_dbg_init_enc failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_dbg_init_dis", strlen("gpy2xx_msec_dbg_init_dis")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_dbg_init_dis: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3521,7 +4451,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_dbg_init_dis failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_dbg_get", strlen("gpy2xx_msec_dbg_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_dbg_get: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3540,7 +4472,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_dbg_get failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_dbg_sa", strlen("gpy2xx_msec_dbg_sa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_dbg_sa: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3563,7 +4497,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_dbg_sa failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_test_kat1", strlen("gpy2xx_msec_test_kat1")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_test_kat1: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3584,7 +4520,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_test_kat1 failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_stat_kat1", strlen("gpy2xx_msec_stat_kat1")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_stat_kat1: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3605,7 +4543,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_stat_kat1 failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_test_kat2", strlen("gpy2xx_msec_test_kat2")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_test_kat2: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3626,7 +4566,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_test_kat2 failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_stat_kat2", strlen("gpy2xx_msec_stat_kat2")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_stat_kat2: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3647,7 +4589,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_stat_kat2 failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_test_kat3", strlen("gpy2xx_msec_test_kat3")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_test_kat3: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3668,7 +4612,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_test_kat3 failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_stat_kat3", strlen("gpy2xx_msec_stat_kat3")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_stat_kat3: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3689,7 +4635,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_stat_kat3 failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_cp_stats", strlen("gpy2xx_msec_cp_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_cp_stats: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3708,7 +4656,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_cp_stats failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_print_pdata", strlen("gpy2xx_msec_print_pdata")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_print_pdata: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3727,7 +4677,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_print_pdata failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_secy_info", strlen("gpy2xx_msec_secy_info")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_secy_info: {
 		GSW_MACSec_cfg_t param;
 
 		memset(&param, 0x00, sizeof(param));
@@ -3768,7 +4720,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 				    &pdata->cipher_type);
 		cnt += scanParamArg(argc, argv, "seqType", sizeof(pdata->seq_type),
 				    &pdata->seq_type);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_install_txsa", strlen("gpy2xx_msec_install_txsa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_install_txsa: {
 		GSW_MACSec_cfg_t param;
 
 		struct e160_macsec_secy *secy;
@@ -3824,7 +4778,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_install_txsa failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_update_txsa", strlen("gpy2xx_msec_update_txsa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_update_txsa: {
 		u8 assoc_num;
 		GSW_MACSec_cfg_t param;
 
@@ -3876,7 +4832,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_update_txsa failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_delete_txsa", strlen("gpy2xx_msec_delete_txsa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_delete_txsa: {
 		u8 assoc_num;
 		GSW_MACSec_cfg_t param;
 		struct e160_macsec_tx_sa *tx_sa;
@@ -3916,7 +4874,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		pdata->macsec_dev.secy.tx_sc.sa[assoc_num] = NULL;
 		tx_sa->active = false; //Won't it crash?
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_add_rxsc", strlen("gpy2xx_msec_add_rxsc")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_add_rxsc: {
 		struct e160_macsec_rx_sc *rx_sc;
 		//struct e160_macsec_dev *macsec;
 		sci_t sci;
@@ -3929,7 +4889,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: gpy2xx_msec_add_rxsc failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_delete_rxsc", strlen("gpy2xx_msec_delete_rxsc")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_delete_rxsc: {
 		GSW_MACSec_cfg_t param;
 
 		struct e160_macsec_secy *secy;
@@ -3954,7 +4916,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 
 		e160_free_rx_sc(rx_sc);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_install_rxsa", strlen("gpy2xx_msec_install_rxsa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_install_rxsa: {
 		GSW_MACSec_cfg_t param;
 
 		struct e160_macsec_secy *secy;
@@ -4019,7 +4983,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_install_rxsa failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_update_rxsa", strlen("gpy2xx_msec_update_rxsa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_update_rxsa: {
 		u8 assoc_num;
 		GSW_MACSec_cfg_t param;
 
@@ -4075,7 +5041,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: gpy2xx_msec_update_rxsa failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_delete_rxsa", strlen("gpy2xx_msec_delete_rxsa")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_delete_rxsa: {
 		u8 assoc_num;
 		GSW_MACSec_cfg_t param;
 		struct e160_macsec_secy *secy;
@@ -4130,20 +5098,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		rx_sc->sa[assoc_num] = NULL;
 		rx_sa->active = false;
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_tr", strlen("gpy2xx_msec_config_ing_tr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_tr: {
 		struct transform_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
-		cnt += scanParamArg(argc, argv, "ca_type", sizeof(raw_tr.ccw.ca_type), &raw_tr.ccw.ca_type);
-		cnt += scanKey_Arg(argc, argv, "key", (((raw_tr.ccw.ca_type == GCM_AES_128) || (raw_tr.ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32), (char *)raw_tr.cp.key);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(raw_tr.cp.sci), (char *)raw_tr.cp.sci);
-		//cnt += scanParamArg(argc, argv, "seq0", sizeof(raw_tr.pn_rc.seq0), &raw_tr.pn_rc.seq0);
-		//cnt += scanParamArg(argc, argv, "seq1", sizeof(raw_tr.pn_rc.seq1), &raw_tr.pn_rc.seq1);
-		cnt += scanParamArg(argc, argv, "seq_num", 64, &raw_tr.pn_rc.seq_num);
-		cnt += scanKey_Arg(argc, argv, "salt", sizeof(raw_tr.cp.c_salt.salt), (char *)raw_tr.cp.c_salt.salt);
-		cnt += scanKey_Arg(argc, argv, "short_sci", sizeof(raw_tr.cp.c_salt.s_sci), (char *)raw_tr.cp.c_salt.s_sci);
-		cnt += scanParamArg(argc, argv, "rep_window", sizeof(raw_tr.pn_rc.mask), &raw_tr.pn_rc.mask);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_config_ing_tr(&phy, &raw_tr);
 
@@ -4151,25 +5112,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress TR set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_tr", strlen("gpy2xx_msec_config_egr_tr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_tr: {
 		struct transform_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
-		cnt += scanParamArg(argc, argv, "ca_type", sizeof(raw_tr.ccw.ca_type), &raw_tr.ccw.ca_type);
-		cnt += scanParamArg(argc, argv, "an", sizeof(raw_tr.ccw.an), &raw_tr.ccw.an);
-		cnt += scanKey_Arg(argc, argv, "key", (((raw_tr.ccw.ca_type == GCM_AES_128) || (raw_tr.ccw.ca_type == GCM_AES_XPN_128)) ? 16 : 32), (char *)raw_tr.cp.key);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(raw_tr.cp.sci), (char *)raw_tr.cp.sci);
-		//cnt += scanParamArg(argc, argv, "seq0", sizeof(raw_tr.pn_rc.seq0), &raw_tr.pn_rc.seq0);
-		//cnt += scanParamArg(argc, argv, "seq1", sizeof(raw_tr.pn_rc.seq1), &raw_tr.pn_rc.seq1);
-		cnt += scanParamArg(argc, argv, "seq_num", 64, &raw_tr.pn_rc.seq_num);
-		cnt += scanKey_Arg(argc, argv, "salt", sizeof(raw_tr.cp.c_salt.salt), (char *)raw_tr.cp.c_salt.salt);
-		cnt += scanKey_Arg(argc, argv, "short_sci", sizeof(raw_tr.cp.c_salt.s_sci), (char *)raw_tr.cp.c_salt.s_sci);
-		cnt += scanParamArg(argc, argv, "next_sa_ind", sizeof(raw_tr.sa_update.sa_index), &raw_tr.sa_update.sa_index);
-		cnt += scanParamArg(argc, argv, "sa_expirq", sizeof(raw_tr.sa_update.sa_expired_irq), &raw_tr.sa_update.sa_expired_irq);
-		cnt += scanParamArg(argc, argv, "sa_indvalid", sizeof(raw_tr.sa_update.sa_index_valid), &raw_tr.sa_update.sa_index_valid);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(raw_tr.sa_update.flow_index), &raw_tr.sa_update.flow_index);
-		cnt += scanParamArg(argc, argv, "sa_indupen", sizeof(raw_tr.sa_update.sa_ind_update_en), &raw_tr.sa_update.sa_ind_update_en);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_config_egr_tr(&phy, &raw_tr);
 
@@ -4177,18 +5126,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress TR set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_update_egr_sa_cw", strlen("gpy2xx_msec_update_egr_sa_cw")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_update_egr_sa_cw: {
 		struct transform_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
-		cnt += scanParamArg(argc, argv, "ca_type", sizeof(raw_tr.ccw.ca_type), &raw_tr.ccw.ca_type);
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(raw_tr.ccw.sn_type), &raw_tr.ccw.sn_type);
-		cnt += scanParamArg(argc, argv, "next_sa_ind", sizeof(raw_tr.sa_update.sa_index), &raw_tr.sa_update.sa_index);
-		cnt += scanParamArg(argc, argv, "sa_expirq", sizeof(raw_tr.sa_update.sa_expired_irq), &raw_tr.sa_update.sa_expired_irq);
-		cnt += scanParamArg(argc, argv, "sa_indvalid", sizeof(raw_tr.sa_update.sa_index_valid), &raw_tr.sa_update.sa_index_valid);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(raw_tr.sa_update.flow_index), &raw_tr.sa_update.flow_index);
-		cnt += scanParamArg(argc, argv, "sa_indupen", sizeof(raw_tr.sa_update.sa_ind_update_en), &raw_tr.sa_update.sa_ind_update_en);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_update_egr_sa_cw(&phy, &raw_tr);
 
@@ -4196,13 +5140,15 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SA update set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_tr", strlen("gpy2xx_msec_get_ing_tr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_tr: {
 		char buf[256];
 		u32 _ca_type, _sn_type;
 		struct raw_trans_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_get_ing_tr(&phy, &raw_tr);
 
@@ -4279,13 +5225,15 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		} else {
 			printf("\nERROR: Invalid Crypto-Algorithm type.\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_tr", strlen("gpy2xx_msec_get_egr_tr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_tr: {
 		char buf[256];
 		u32 _ca_type, _sn_type;
 		struct raw_trans_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_get_egr_tr(&phy, &raw_tr);
 
@@ -4389,11 +5337,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		} else {
 			printf("\nERROR: Invalid Crypto-Algorithm type.\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_pn", strlen("gpy2xx_msec_get_ing_pn")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_pn: {
 		struct sa_current_pn curr_sn;
 		memset(&curr_sn, 0, sizeof(struct sa_current_pn));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(curr_sn.sa_index), &curr_sn.sa_index);
+		cli_parse(cmd, argc, argv, &curr_sn);
 
 		ret = gpy2xx_msec_get_ing_pn(&phy, &curr_sn);
 
@@ -4403,11 +5353,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 
 		printf("\nCurrent SN = 0x%I64x", curr_sn.curr_pn);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_pn", strlen("gpy2xx_msec_get_egr_pn")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_pn: {
 		struct sa_current_pn curr_sn;
 		memset(&curr_sn, 0, sizeof(struct sa_current_pn));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(curr_sn.sa_index), &curr_sn.sa_index);
+		cli_parse(cmd, argc, argv, &curr_sn);
 
 		ret = gpy2xx_msec_get_egr_pn(&phy, &curr_sn);
 
@@ -4417,11 +5369,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 
 		printf("\nCurrent SN = 0x%I64x", curr_sn.curr_pn);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_ing_tr", strlen("gpy2xx_msec_clear_ing_tr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_tr: {
 		struct transform_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_clear_ing_tr(&phy, &raw_tr);
 
@@ -4429,11 +5383,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress TR clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_tr", strlen("gpy2xx_msec_clear_egr_tr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_tr: {
 		struct transform_rec raw_tr;
 		memset(&raw_tr, 0, sizeof(struct raw_trans_rec));
 
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(raw_tr.sa_index), &raw_tr.sa_index);
+		cli_parse(cmd, argc, argv, &raw_tr);
 
 		ret = gpy2xx_msec_clear_egr_tr(&phy, &raw_tr);
 
@@ -4441,13 +5397,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress TR clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sam_eex", strlen("gpy2xx_msec_config_ing_sam_eex")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_eex: {
 		struct raw_sam_ee raw_ee;
 		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "eex_type", sizeof(raw_ee.eex_type), &raw_ee.eex_type);
-		cnt += scanParamArg(argc, argv, "eex_word0", sizeof(raw_ee.raw_sam_ee[0]), &raw_ee.raw_sam_ee[0]);
+		cli_parse(cmd, argc, argv, &raw_ee);
 
 		ret = gpy2xx_msec_config_ing_sam_eex(&phy, &raw_ee);
 
@@ -4455,13 +5411,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress SAM EE type set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sam_eex", strlen("gpy2xx_msec_config_egr_sam_eex")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_eex: {
 		struct raw_sam_ee raw_ee;
 		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "eex_type", sizeof(raw_ee.eex_type), &raw_ee.eex_type);
-		cnt += scanParamArg(argc, argv, "eex_word0", sizeof(raw_ee.raw_sam_ee[0]), &raw_ee.raw_sam_ee[0]);
+		cli_parse(cmd, argc, argv, &raw_ee);
 
 		ret = gpy2xx_msec_config_egr_sam_eex(&phy, &raw_ee);
 
@@ -4469,7 +5425,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SAM EE type set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_sam_eef", strlen("gpy2xx_msec_get_ing_sam_eef")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sam_eef: {
 		int i;
 		struct raw_sam_ee raw_ee;
 		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
@@ -4486,7 +5444,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
 			printf("\nSAM EE flags[%02d] = 0x%08x", i, raw_ee.raw_sam_ee[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_sam_eef", strlen("gpy2xx_msec_get_egr_sam_eef")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sam_eef: {
 		int i;
 		struct raw_sam_ee raw_ee;
 		memset(&raw_ee, 0, sizeof(struct raw_sam_ee));
@@ -4503,16 +5463,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
 			printf("\nSAM EE flags[%02d] = 0x%08x", i, raw_ee.raw_sam_ee[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sam_eec", strlen("gpy2xx_msec_config_ing_sam_eec")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_eec: {
 		struct sam_ee_ctrl ee_ctrl;
 		memset(&ee_ctrl, 0, sizeof(struct sam_ee_ctrl));
 
-		cnt += scanParamArg(argc, argv, "sam_ind_set", sizeof(ee_ctrl.sam_index_set), &ee_ctrl.sam_index_set);
-		cnt += scanParamArg(argc, argv, "set_single", sizeof(ee_ctrl.set_enable), &ee_ctrl.set_enable);
-		cnt += scanParamArg(argc, argv, "set_all", sizeof(ee_ctrl.set_all), &ee_ctrl.set_all);
-		cnt += scanParamArg(argc, argv, "sam_ind_clr", sizeof(ee_ctrl.sam_index_clear), &ee_ctrl.sam_index_clear);
-		cnt += scanParamArg(argc, argv, "clr_single", sizeof(ee_ctrl.clear_enable), &ee_ctrl.clear_enable);
-		cnt += scanParamArg(argc, argv, "clr_all", sizeof(ee_ctrl.clear_all), &ee_ctrl.clear_all);
+		cli_parse(cmd, argc, argv, &ee_ctrl);
 
 		ret = gpy2xx_msec_config_ing_sam_eec(&phy, &ee_ctrl);
 
@@ -4520,16 +5477,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress SAM EE control set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sam_eec", strlen("gpy2xx_msec_config_egr_sam_eec")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_eec: {
 		struct sam_ee_ctrl ee_ctrl;
 		memset(&ee_ctrl, 0, sizeof(struct sam_ee_ctrl));
 
-		cnt += scanParamArg(argc, argv, "sam_ind_set", sizeof(ee_ctrl.sam_index_set), &ee_ctrl.sam_index_set);
-		cnt += scanParamArg(argc, argv, "set_single", sizeof(ee_ctrl.set_enable), &ee_ctrl.set_enable);
-		cnt += scanParamArg(argc, argv, "set_all", sizeof(ee_ctrl.set_all), &ee_ctrl.set_all);
-		cnt += scanParamArg(argc, argv, "sam_ind_clr", sizeof(ee_ctrl.sam_index_clear), &ee_ctrl.sam_index_clear);
-		cnt += scanParamArg(argc, argv, "clr_single", sizeof(ee_ctrl.clear_enable), &ee_ctrl.clear_enable);
-		cnt += scanParamArg(argc, argv, "clr_all", sizeof(ee_ctrl.clear_all), &ee_ctrl.clear_all);
+		cli_parse(cmd, argc, argv, &ee_ctrl);
 
 		ret = gpy2xx_msec_config_egr_sam_eec(&phy, &ee_ctrl);
 
@@ -4537,23 +5491,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SAM EE control set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sam_fca", strlen("gpy2xx_msec_config_ing_sam_fca")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_fca: {
 		struct sa_match_fca sam_fca;
 		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(sam_fca.flow_type), &sam_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(sam_fca.dest_port), &sam_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(sam_fca.drop_non_reserved), &sam_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "crypt_auth", sizeof(sam_fca.flow_crypt_auth), &sam_fca.flow_crypt_auth);
-		cnt += scanParamArg(argc, argv, "drop_act", sizeof(sam_fca.drop_action), &sam_fca.drop_action);
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(sam_fca.sa_index), &sam_fca.sa_index);
-		cnt += scanParamArg(argc, argv, "rep_protect", sizeof(sam_fca.replay_protect), &sam_fca.replay_protect);
-		cnt += scanParamArg(argc, argv, "sa_inuse", sizeof(sam_fca.sa_in_use), &sam_fca.sa_in_use);
-		cnt += scanParamArg(argc, argv, "validate_level", sizeof(sam_fca.validate_frames), &sam_fca.validate_frames);
-		cnt += scanParamArg(argc, argv, "ivl_mode", sizeof(sam_fca.iv), &sam_fca.iv);
-		cnt += scanParamArg(argc, argv, "verify_icv", sizeof(sam_fca.icv_verify), &sam_fca.icv_verify);
-		cnt += scanParamArg(argc, argv, "ca_bp_len", sizeof(sam_fca.crypt_auth_bypass_len), &sam_fca.crypt_auth_bypass_len);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
 		ret = gpy2xx_msec_config_ing_sam_fca(&phy, &sam_fca);
 
@@ -4561,28 +5505,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress SAM flow control action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sam_fca", strlen("gpy2xx_msec_config_egr_sam_fca")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_fca: {
 		struct sa_match_fca sam_fca;
 		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(sam_fca.flow_type), &sam_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(sam_fca.dest_port), &sam_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "crypt_auth", sizeof(sam_fca.flow_crypt_auth), &sam_fca.flow_crypt_auth);
-		cnt += scanParamArg(argc, argv, "drop_act", sizeof(sam_fca.drop_action), &sam_fca.drop_action);
-		cnt += scanParamArg(argc, argv, "sa_index", sizeof(sam_fca.sa_index), &sam_fca.sa_index);
-		cnt += scanParamArg(argc, argv, "frame_protect", sizeof(sam_fca.protect_frame), &sam_fca.protect_frame);
-		cnt += scanParamArg(argc, argv, "sa_inuse", sizeof(sam_fca.sa_in_use), &sam_fca.sa_in_use);
-		cnt += scanParamArg(argc, argv, "include_sci", sizeof(sam_fca.include_sci), &sam_fca.include_sci);
-		cnt += scanParamArg(argc, argv, "use_es", sizeof(sam_fca.use_es), &sam_fca.use_es);
-		cnt += scanParamArg(argc, argv, "use_scb", sizeof(sam_fca.use_scb), &sam_fca.use_scb);
-		cnt += scanParamArg(argc, argv, "tag_bpsize", sizeof(sam_fca.tag_bypass_size), &sam_fca.tag_bypass_size);
-		cnt += scanParamArg(argc, argv, "sa_indup", sizeof(sam_fca.sa_index_update), &sam_fca.sa_index_update);
-		cnt += scanParamArg(argc, argv, "conf_offset", sizeof(sam_fca.conf_offset), &sam_fca.conf_offset);
-		cnt += scanParamArg(argc, argv, "conf_protect", sizeof(sam_fca.conf_protect), &sam_fca.conf_protect);
-		cnt += scanParamArg(argc, argv, "ivl_mode", sizeof(sam_fca.iv), &sam_fca.iv);
-		cnt += scanParamArg(argc, argv, "append_icv", sizeof(sam_fca.icv_append), &sam_fca.icv_append);
-		cnt += scanParamArg(argc, argv, "ca_bp_len", sizeof(sam_fca.crypt_auth_bypass_len), &sam_fca.crypt_auth_bypass_len);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
 		ret = gpy2xx_msec_config_egr_sam_fca(&phy, &sam_fca);
 
@@ -4590,11 +5519,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SAM flow control action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_sam_fca", strlen("gpy2xx_msec_get_ing_sam_fca")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sam_fca: {
 		struct sam_pkt_fca sam_fca;
 		memset(&sam_fca, 0, sizeof(struct sam_pkt_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
 		ret = gpy2xx_msec_get_ing_sam_fca(&phy, &sam_fca);
 
@@ -4628,11 +5559,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		printf("\nDst port %x, Drop NR %x, Drop act %x, SA ind %x",
 		       sam_fca.dec_enc.dest_port, sam_fca.dec_enc.drop_non_reserved, sam_fca.dec_enc.drop_action, sam_fca.dec_enc.sa_index);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_sam_fca", strlen("gpy2xx_msec_get_egr_sam_fca")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sam_fca: {
 		struct sam_pkt_fca sam_fca;
 		memset(&sam_fca, 0, sizeof(struct sam_pkt_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
 		ret = gpy2xx_msec_get_egr_sam_fca(&phy, &sam_fca);
 
@@ -4667,11 +5600,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		printf("\nDst port %x, Drop act %x, SA ind %x",
 		       sam_fca.dec_enc.dest_port, sam_fca.dec_enc.drop_action, sam_fca.dec_enc.sa_index);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_ing_sam_fca", strlen("gpy2xx_msec_clear_ing_sam_fca")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_sam_fca: {
 		struct sa_match_fca sam_fca;
 		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
 		ret = gpy2xx_msec_clear_ing_sam_fca(&phy, &sam_fca);
 
@@ -4679,11 +5614,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress SAM flow control clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_sam_fca", strlen("gpy2xx_msec_clear_egr_sam_fca")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_sam_fca: {
 		struct sa_match_fca sam_fca;
 		memset(&sam_fca, 0, sizeof(struct sa_match_fca));
 
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(sam_fca.flow_index), &sam_fca.flow_index);
+		cli_parse(cmd, argc, argv, &sam_fca);
 
 		ret = gpy2xx_msec_clear_egr_sam_fca(&phy, &sam_fca);
 
@@ -4691,55 +5628,43 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SAM flow control clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sam_rule", strlen("gpy2xx_msec_config_ing_sam_rule")) == 0) {
-		u8 in_data;
-		struct sa_match_param match_par;
-		memset(&match_par, 0, sizeof(struct sa_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sam_rule: {
+		struct cli_sam_rule_args a;
+		memset(&a, 0, sizeof(struct cli_sam_rule_args));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
-		cnt += scanMAC_Arg(argc, argv, "sa_mac", match_par.sa_mac);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", match_par.da_mac);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(match_par.eth_type), &match_par.eth_type);
-		cnt += scanParamArg(argc, argv, "vlan_id", sizeof(match_par.vlan_id), &match_par.vlan_id);
-		cnt += scanParamArg(argc, argv, "misc", sizeof(match_par.misc_par.misc), &match_par.misc_par.misc);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(match_par.sci), (char *)match_par.sci);
-		cnt += scanParamArg(argc, argv, "mask", sizeof(match_par.mask_par.mask), &match_par.mask_par.mask);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(in_data), &in_data);
-		match_par.extn_par.flow_index = in_data;
+		cli_parse(cmd, argc, argv, &a);
+		a.match.extn_par.flow_index = a.flow_index;
 
-		ret = gpy2xx_msec_config_ing_sam_rule(&phy, &match_par);
+		ret = gpy2xx_msec_config_ing_sam_rule(&phy, &a.match);
 
 		if (ret < 0) {
 			printf("\nERROR: Ingress SAM set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sam_rule", strlen("gpy2xx_msec_config_egr_sam_rule")) == 0) {
-		u8 in_data;
-		struct sa_match_param match_par;
-		memset(&match_par, 0, sizeof(struct sa_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sam_rule: {
+		struct cli_sam_rule_args a;
+		memset(&a, 0, sizeof(struct cli_sam_rule_args));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
-		cnt += scanMAC_Arg(argc, argv, "sa_mac", match_par.sa_mac);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", match_par.da_mac);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(match_par.eth_type), &match_par.eth_type);
-		cnt += scanParamArg(argc, argv, "vlan_id", sizeof(match_par.vlan_id), &match_par.vlan_id);
-		cnt += scanParamArg(argc, argv, "misc", sizeof(match_par.misc_par.misc), &match_par.misc_par.misc);
-		cnt += scanKey_Arg(argc, argv, "sci", sizeof(match_par.sci), (char *)match_par.sci);
-		cnt += scanParamArg(argc, argv, "mask", sizeof(match_par.mask_par.mask), &match_par.mask_par.mask);
-		cnt += scanParamArg(argc, argv, "flow_index", sizeof(in_data), &in_data);
-		match_par.extn_par.flow_index = in_data;
+		cli_parse(cmd, argc, argv, &a);
+		a.match.extn_par.flow_index = a.flow_index;
 
-		ret = gpy2xx_msec_config_egr_sam_rule(&phy, &match_par);
+		ret = gpy2xx_msec_config_egr_sam_rule(&phy, &a.match);
 
 		if (ret < 0) {
 			printf("\nERROR: Egress SAM set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_ing_sam_rule", strlen("gpy2xx_msec_clear_ing_sam_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_sam_rule: {
 		struct sa_match_param match_par;
 		memset(&match_par, 0, sizeof(struct sa_match_param));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
+		cli_parse(cmd, argc, argv, &match_par);
 
 		ret = gpy2xx_msec_clear_ing_sam_rule(&phy, &match_par);
 
@@ -4747,11 +5672,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress SAM clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_sam_rule", strlen("gpy2xx_msec_clear_egr_sam_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_sam_rule: {
 		struct sa_match_param match_par;
 		memset(&match_par, 0, sizeof(struct sa_match_param));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(match_par.rule_index), &match_par.rule_index);
+		cli_parse(cmd, argc, argv, &match_par);
 
 		ret = gpy2xx_msec_clear_egr_sam_rule(&phy, &match_par);
 
@@ -4759,17 +5686,18 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SAM clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_vlan_parse", strlen("gpy2xx_msec_config_ing_vlan_parse")) == 0) {
-		u8 in_data;
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_vlan_parse: {
+		struct cli_vlan_parse_args a;
 		struct sam_vlan_parse match_par;
+		memset(&a, 0, sizeof(struct cli_vlan_parse_args));
 		memset(&match_par, 0, sizeof(struct sam_vlan_parse));
 
-		cnt += scanParamArg(argc, argv, "qinq_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qinq = in_data;
-		cnt += scanParamArg(argc, argv, "stag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_stag = in_data;
-		cnt += scanParamArg(argc, argv, "qtag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qtag = in_data;
+		cli_parse(cmd, argc, argv, &a);
+		match_par.outer_tag.parse_qinq = a.qinq_en;
+		match_par.outer_tag.parse_stag = a.stag_en;
+		match_par.outer_tag.parse_qtag = a.qtag_en;
 
 		ret = gpy2xx_msec_config_ing_vlan_parse(&phy, &match_par);
 
@@ -4777,17 +5705,18 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress SAM VLAN control set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_vlan_parse", strlen("gpy2xx_msec_config_egr_vlan_parse")) == 0) {
-		u8 in_data;
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_vlan_parse: {
+		struct cli_vlan_parse_args a;
 		struct sam_vlan_parse match_par;
+		memset(&a, 0, sizeof(struct cli_vlan_parse_args));
 		memset(&match_par, 0, sizeof(struct sam_vlan_parse));
 
-		cnt += scanParamArg(argc, argv, "qinq_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qinq = in_data;
-		cnt += scanParamArg(argc, argv, "stag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_stag = in_data;
-		cnt += scanParamArg(argc, argv, "qtag_en", sizeof(in_data), &in_data);
-		match_par.outer_tag.parse_qtag = in_data;
+		cli_parse(cmd, argc, argv, &a);
+		match_par.outer_tag.parse_qinq = a.qinq_en;
+		match_par.outer_tag.parse_stag = a.stag_en;
+		match_par.outer_tag.parse_qtag = a.qtag_en;
 
 		ret = gpy2xx_msec_config_egr_vlan_parse(&phy, &match_par);
 
@@ -4795,12 +5724,14 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Egress SAM VLAN control set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_sam_rule", strlen("gpy2xx_msec_get_ing_sam_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sam_rule: {
 		int i;
 		struct raw_sam_param raw_sam;
 		memset(&raw_sam, 0, sizeof(struct raw_sam_param));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(raw_sam.rule_index), &raw_sam.rule_index);
+		cli_parse(cmd, argc, argv, &raw_sam);
 
 		ret = gpy2xx_msec_get_ing_sam_rule(&phy, &raw_sam);
 
@@ -4812,12 +5743,14 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < IE_MAX_SAM_SIZE_WORDS; i++) {
 			printf("\nSAMParam[%02d] = 0x%08x", i, raw_sam.raw_sam_param[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_sam_rule", strlen("gpy2xx_msec_get_egr_sam_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sam_rule: {
 		int i;
 		struct raw_sam_param raw_sam;
 		memset(&raw_sam, 0, sizeof(struct raw_sam_param));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(raw_sam.rule_index), &raw_sam.rule_index);
+		cli_parse(cmd, argc, argv, &raw_sam);
 
 		ret = gpy2xx_msec_get_egr_sam_rule(&phy, &raw_sam);
 
@@ -4829,34 +5762,29 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < IE_MAX_SAM_SIZE_WORDS; i++) {
 			printf("\nSAMParam[%02d] = 0x%08x", i, raw_sam.raw_sam_param[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_cc_rule", strlen("gpy2xx_msec_config_ing_cc_rule")) == 0) {
-		u32 data;
-		struct icc_match_param cc_match;
-		memset(&cc_match, 0, sizeof(struct icc_match_param));
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_rule: {
+		struct cli_cc_rule_args a;
+		memset(&a, 0, sizeof(struct cli_cc_rule_args));
 
-		cnt += scanParamArg(argc, argv, "icc_index", sizeof(cc_match.icc_index), &cc_match.icc_index);
-		//cnt += scanParamArg(argc, argv, "ovlan_id", sizeof(data), &data);
-		//cc_match.vlan_eth.vlan_id = data;
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(data), &data);
-		cc_match.vlan_eth.payload_e_type = data;
-		cnt += scanParamArg(argc, argv, "misc", sizeof(data), &data);
-		cc_match.icc_misc.raw_iccm_misc = data;
-		//cnt += scanParamArg(argc, argv, "ivlan_id", sizeof(data), &data);
-		//cc_match.icc_ivl.vlan_id_inner = data;
-		//cnt += scanParamArg(argc, argv, "ivlan_up", sizeof(data), &data);
-		//cc_match.icc_ivl.vlan_up_inner = data;
+		cli_parse(cmd, argc, argv, &a);
+		a.match.vlan_eth.payload_e_type = a.eth_type;
+		a.match.icc_misc.raw_iccm_misc = a.misc;
 
-		ret = gpy2xx_msec_config_ing_cc_rule(&phy, &cc_match);
+		ret = gpy2xx_msec_config_ing_cc_rule(&phy, &a.match);
 
 		if (ret < 0) {
 			printf("\nERROR: Ingress CC rule set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_cc_rule", strlen("gpy2xx_msec_get_ing_cc_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cc_rule: {
 		struct icc_match_param cc_match;
 		memset(&cc_match, 0, sizeof(struct icc_match_param));
 
-		cnt += scanParamArg(argc, argv, "icc_index", sizeof(cc_match.icc_index), &cc_match.icc_index);
+		cli_parse(cmd, argc, argv, &cc_match);
 
 		ret = gpy2xx_msec_get_ing_cc_rule(&phy, &cc_match);
 
@@ -4869,12 +5797,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\nICCParam[00] = 0x%08x", cc_match.vlan_eth.raw_iccm_vleth);
 		printf("\nICCParam[01] = 0x%08x", cc_match.icc_misc.raw_iccm_misc);
 		//printf("\nICCParam[02] = 0x%08x", cc_match.icc_ivl.raw_iccm_ivl);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_cc_eef", strlen("gpy2xx_msec_config_ing_cc_eef")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_eef: {
 		struct raw_icc_ee raw_cc;
 		memset(&raw_cc, 0, sizeof(struct raw_icc_ee));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "eec_word0", sizeof(raw_cc.raw_icc_ee[0]), &raw_cc.raw_icc_ee[0]);
+		cli_parse(cmd, argc, argv, &raw_cc);
 
 		ret = gpy2xx_msec_config_ing_cc_eef(&phy, &raw_cc);
 
@@ -4882,7 +5811,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: ICC EE flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_cc_eef", strlen("gpy2xx_msec_get_ing_cc_eef")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cc_eef: {
 		int i;
 		struct raw_icc_ee raw_cc;
 		memset(&raw_cc, 0, sizeof(struct raw_icc_ee));
@@ -4899,23 +5830,21 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
 			printf("\nICC EE flags[%02d] = 0x%08x", i, raw_cc.raw_icc_ee[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_cc_eec", strlen("gpy2xx_msec_config_ing_cc_eec")) == 0) {
-		u32 data;
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_eec: {
+		struct cli_cc_eec_args a;
 		struct icc_ee_ctrl ee_ctrl;
+		memset(&a, 0, sizeof(struct cli_cc_eec_args));
 		memset(&ee_ctrl, 0, sizeof(struct icc_ee_ctrl));
 
-		cnt += scanParamArg(argc, argv, "icc_ind_set", sizeof(data), &data);
-		ee_ctrl.cc_index_set = data;
-		cnt += scanParamArg(argc, argv, "set_single", sizeof(data), &data);
-		ee_ctrl.set_enable = data;
-		cnt += scanParamArg(argc, argv, "set_all", sizeof(data), &data);
-		ee_ctrl.set_all = data;
-		cnt += scanParamArg(argc, argv, "icc_ind_clr", sizeof(data), &data);
-		ee_ctrl.cc_index_clear = data;
-		cnt += scanParamArg(argc, argv, "clr_single", sizeof(data), &data);
-		ee_ctrl.clear_enable = data;
-		cnt += scanParamArg(argc, argv, "clr_all", sizeof(data), &data);
-		ee_ctrl.clear_all = data;
+		cli_parse(cmd, argc, argv, &a);
+		ee_ctrl.cc_index_set = a.icc_ind_set;
+		ee_ctrl.set_enable = a.set_single;
+		ee_ctrl.set_all = a.set_all;
+		ee_ctrl.cc_index_clear = a.icc_ind_clr;
+		ee_ctrl.clear_enable = a.clr_single;
+		ee_ctrl.clear_all = a.clr_all;
 
 		ret = gpy2xx_msec_config_ing_cc_eec(&phy, &ee_ctrl);
 
@@ -4923,12 +5852,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress CC EE control set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_cc_ctrl", strlen("gpy2xx_msec_config_ing_cc_ctrl")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cc_ctrl: {
 		struct ing_cc_ctrl cc_ctrl;
 		memset(&cc_ctrl, 0, sizeof(struct ing_cc_ctrl));
 
-		cnt += scanParamArg(argc, argv, "nm_act", sizeof(cc_ctrl.nm_act), &cc_ctrl.nm_act);
-		cnt += scanParamArg(argc, argv, "nm_ctrl_act", sizeof(cc_ctrl.nm_ctrl_act), &cc_ctrl.nm_ctrl_act);
+		cli_parse(cmd, argc, argv, &cc_ctrl);
 
 		ret = gpy2xx_msec_config_ing_cc_ctrl(&phy, &cc_ctrl);
 
@@ -4936,7 +5866,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Ingress CC Control flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_stats_summ", strlen("gpy2xx_msec_get_ing_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_stats_summ: {
 		int i;
 		struct stats_summary xxx_summ;
 		struct ing_global_bmap counter_bmap;
@@ -4999,7 +5931,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (counter_bmap.InOverSizePkts)
 			printf("\nInOverSizePkts counter expired");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_stats_summ", strlen("gpy2xx_msec_get_egr_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_stats_summ: {
 		int i;
 		struct stats_summary xxx_summ;
 		struct egr_global_bmap counter_bmap;
@@ -5035,11 +5969,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (counter_bmap.OutOverSizePkts)
 			printf("\nOutOverSizePkts counter expired");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_sa_stats", strlen("gpy2xx_msec_get_ing_sa_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sa_stats: {
 		struct ing_sa_stats sa_ctrs;
 		memset(&sa_ctrs, 0, sizeof(struct ing_sa_stats));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(sa_ctrs.rule_index), &sa_ctrs.rule_index);
+		cli_parse(cmd, argc, argv, &sa_ctrs);
 
 		ret = gpy2xx_msec_get_ing_sa_stats(&phy, &sa_ctrs);
 
@@ -5060,11 +5996,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%I64x\n", "InPktsNotUsingSA", sa_ctrs.InPktsNotUsingSA);
 		printf("\t%40s:\t0x%I64x\n", "InPktsUnusedSA", sa_ctrs.InPktsUnusedSA);
 		printf("\t%40s:\t0x%I64x\n", "InPktsUntaggedHit", sa_ctrs.InPktsUntaggedHit);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_sa_stats", strlen("gpy2xx_msec_get_egr_sa_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sa_stats: {
 		struct egr_sa_stats sa_ctrs;
 		memset(&sa_ctrs, 0, sizeof(struct egr_sa_stats));
 
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(sa_ctrs.rule_index), &sa_ctrs.rule_index);
+		cli_parse(cmd, argc, argv, &sa_ctrs);
 
 		ret = gpy2xx_msec_get_egr_sa_stats(&phy, &sa_ctrs);
 
@@ -5078,7 +6016,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%I64x\n", "OutOctetsEncrypted2", sa_ctrs.OutOctetsEncrypted2);
 		printf("\t%40s:\t0x%I64x\n", "OutPktsEncrypted", sa_ctrs.OutPktsEncrypted);
 		printf("\t%40s:\t0x%I64x\n", "OutPktsTooLong", sa_ctrs.OutPktsTooLong);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_global_stats", strlen("gpy2xx_msec_get_ing_global_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_global_stats: {
 		struct ing_global_stats global_ctrs;
 		memset(&global_ctrs, 0, sizeof(struct ing_global_stats));
 
@@ -5104,7 +6044,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%I64x\n", "InConsistCheckControlledPass", global_ctrs.InConsistCheckControlledPass);
 		printf("\t%40s:\t0x%I64x\n", "InConsistCheckUncontrolledPass", global_ctrs.InConsistCheckUncontrolledPass);
 		printf("\t%40s:\t0x%I64x\n", "InOverSizePkts", global_ctrs.InOverSizePkts);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_global_stats", strlen("gpy2xx_msec_get_egr_global_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_global_stats: {
 		struct egr_global_stats global_ctrs;
 		memset(&global_ctrs, 0, sizeof(struct egr_global_stats));
 
@@ -5122,7 +6064,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%I64x\n", "OutPktsUntagged", global_ctrs.OutPktsUntagged);
 		printf("\t%40s:\t0x%I64x\n", "OutOverSizePkts", global_ctrs.OutOverSizePkts);
 #if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_debug_stats", strlen("gpy2xx_msec_get_ing_debug_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_debug_stats: {
 		struct stats_debug_regs dbg_ctrs;
 		memset(&dbg_ctrs, 0, sizeof(struct stats_debug_regs));
 
@@ -5151,7 +6095,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "SA num for which counters were incremented", dbg_ctrs.cdb4.sa_nr);
 		printf("\t%40s:\t0x%x\n", "VLAN UP for which counters were incremented", dbg_ctrs.cdb4.vlan_up);
 		printf("\t%40s:\t0x%x\n", "Raw CDB4", dbg_ctrs.cdb4.raw_cdb4);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_debug_stats", strlen("gpy2xx_msec_get_egr_debug_stats")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_debug_stats: {
 		struct stats_debug_regs dbg_ctrs;
 		memset(&dbg_ctrs, 0, sizeof(struct stats_debug_regs));
 
@@ -5181,14 +6127,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "VLAN UP for which counters were incremented", dbg_ctrs.cdb4.vlan_up);
 		printf("\t%40s:\t0x%x\n", "Raw CDB4", dbg_ctrs.cdb4.raw_cdb4);
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_count_ctrl", strlen("gpy2xx_msec_config_ing_count_ctrl")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_ctrl: {
 		struct count_control cnt_ctrl;
 		memset(&cnt_ctrl, 0, sizeof(struct count_control));
 
-		cnt += scanParamArg(argc, argv, "rst_all", sizeof(cnt_ctrl.reset_all), &cnt_ctrl.reset_all);
-		cnt += scanParamArg(argc, argv, "ctr_saturate", sizeof(cnt_ctrl.saturate_cntrs), &cnt_ctrl.saturate_cntrs);
-		cnt += scanParamArg(argc, argv, "ctr_conr", sizeof(cnt_ctrl.auto_cntr_reset), &cnt_ctrl.auto_cntr_reset);
-		cnt += scanParamArg(argc, argv, "rst_summary", sizeof(cnt_ctrl.reset_summary), &cnt_ctrl.reset_summary);
+		cli_parse(cmd, argc, argv, &cnt_ctrl);
 
 		ret = gpy2xx_msec_config_ing_count_ctrl(&phy, &cnt_ctrl);
 
@@ -5196,14 +6141,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Count Control flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_count_ctrl", strlen("gpy2xx_msec_config_egr_count_ctrl")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_ctrl: {
 		struct count_control cnt_ctrl;
 		memset(&cnt_ctrl, 0, sizeof(struct count_control));
 
-		cnt += scanParamArg(argc, argv, "rst_all", sizeof(cnt_ctrl.reset_all), &cnt_ctrl.reset_all);
-		cnt += scanParamArg(argc, argv, "ctr_saturate", sizeof(cnt_ctrl.saturate_cntrs), &cnt_ctrl.saturate_cntrs);
-		cnt += scanParamArg(argc, argv, "ctr_conr", sizeof(cnt_ctrl.auto_cntr_reset), &cnt_ctrl.auto_cntr_reset);
-		cnt += scanParamArg(argc, argv, "rst_summary", sizeof(cnt_ctrl.reset_summary), &cnt_ctrl.reset_summary);
+		cli_parse(cmd, argc, argv, &cnt_ctrl);
 
 		ret = gpy2xx_msec_config_egr_count_ctrl(&phy, &cnt_ctrl);
 
@@ -5211,13 +6155,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Count Control flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_count_incen", strlen("gpy2xx_msec_config_ing_count_incen")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_incen: {
 		struct count_incen cnt_inx;
 		memset(&cnt_inx, 0, sizeof(struct count_incen));
 
-		cnt += scanParamArg(argc, argv, "sa_inc", sizeof(cnt_inx.sa_inc_en), &cnt_inx.sa_inc_en);
-		cnt += scanParamArg(argc, argv, "vlan_inc", sizeof(cnt_inx.vlan_inc_en), &cnt_inx.vlan_inc_en);
-		cnt += scanParamArg(argc, argv, "global_inc", sizeof(cnt_inx.global_inc_en), &cnt_inx.global_inc_en);
+		cli_parse(cmd, argc, argv, &cnt_inx);
 
 		ret = gpy2xx_msec_config_ing_count_incen(&phy, &cnt_inx);
 
@@ -5225,13 +6169,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Count Incx flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_count_incen", strlen("gpy2xx_msec_config_egr_count_incen")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_incen: {
 		struct count_incen cnt_inx;
 		memset(&cnt_inx, 0, sizeof(struct count_incen));
 
-		cnt += scanParamArg(argc, argv, "sa_inc", sizeof(cnt_inx.sa_inc_en), &cnt_inx.sa_inc_en);
-		cnt += scanParamArg(argc, argv, "vlan_inc", sizeof(cnt_inx.vlan_inc_en), &cnt_inx.vlan_inc_en);
-		cnt += scanParamArg(argc, argv, "global_inc", sizeof(cnt_inx.global_inc_en), &cnt_inx.global_inc_en);
+		cli_parse(cmd, argc, argv, &cnt_inx);
 
 		ret = gpy2xx_msec_config_egr_count_incen(&phy, &cnt_inx);
 
@@ -5239,12 +6183,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Count Incx flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_count_secfail", strlen("gpy2xx_msec_config_ing_count_secfail")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_secfail: {
 		struct count_secfail cnt_sfail;
 		memset(&cnt_sfail, 0, sizeof(struct count_secfail));
 
-		cnt += scanParamArg(argc, argv, "misc_secfail", sizeof(cnt_sfail.secfail_1.raw_secfail1), &cnt_sfail.secfail_1.raw_secfail1);
-		cnt += scanParamArg(argc, argv, "global_secfail", sizeof(cnt_sfail.global_secfaill_mask), &cnt_sfail.global_secfaill_mask);
+		cli_parse(cmd, argc, argv, &cnt_sfail);
 
 		ret = gpy2xx_msec_config_ing_count_secfail(&phy, &cnt_sfail);
 
@@ -5252,12 +6197,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Count secfail event flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_count_secfail", strlen("gpy2xx_msec_config_egr_count_secfail")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_secfail: {
 		struct count_secfail cnt_sfail;
 		memset(&cnt_sfail, 0, sizeof(struct count_secfail));
 
-		cnt += scanParamArg(argc, argv, "misc_secfail", sizeof(cnt_sfail.secfail_1.raw_secfail1), &cnt_sfail.secfail_1.raw_secfail1);
-		cnt += scanParamArg(argc, argv, "global_secfail", sizeof(cnt_sfail.global_secfaill_mask), &cnt_sfail.global_secfaill_mask);
+		cli_parse(cmd, argc, argv, &cnt_sfail);
 
 		ret = gpy2xx_msec_config_egr_count_secfail(&phy, &cnt_sfail);
 
@@ -5265,12 +6211,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Count secfail event flags set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_count_thresh", strlen("gpy2xx_msec_config_ing_count_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_count_thresh: {
 		struct frame_octet_thr cnt_thr;
 		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		cnt += scanParamArg(argc, argv, "frame_thr", 64, &cnt_thr.frame_threshold);
-		cnt += scanParamArg(argc, argv, "octet_thr", 64, &cnt_thr.octet_threshold);
+		cli_parse(cmd, argc, argv, &cnt_thr);
 
 		ret = gpy2xx_msec_config_ing_count_thresh(&phy, &cnt_thr);
 
@@ -5278,12 +6225,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Counters threshold summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_count_thresh", strlen("gpy2xx_msec_config_egr_count_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_count_thresh: {
 		struct frame_octet_thr cnt_thr;
 		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
-		cnt += scanParamArg(argc, argv, "frame_thr", 64, &cnt_thr.frame_threshold);
-		cnt += scanParamArg(argc, argv, "octet_thr", 64, &cnt_thr.octet_threshold);
+		cli_parse(cmd, argc, argv, &cnt_thr);
 
 		ret = gpy2xx_msec_config_egr_count_thresh(&phy, &cnt_thr);
 
@@ -5291,7 +6239,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Counters threshold summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_count_thresh", strlen("gpy2xx_msec_get_ing_count_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_count_thresh: {
 		struct frame_octet_thr cnt_thr;
 		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
@@ -5304,7 +6254,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		printf("\nFrame threshold summary = %I64x", cnt_thr.frame_threshold);
 		printf("\nOctet threshold summary = %I64x", cnt_thr.octet_threshold);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_count_thresh", strlen("gpy2xx_msec_get_egr_count_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_count_thresh: {
 		struct frame_octet_thr cnt_thr;
 		memset(&cnt_thr, 0, sizeof(struct frame_octet_thr));
 
@@ -5317,15 +6269,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		printf("\nFrame threshold summary = %I64x", cnt_thr.frame_threshold);
 		printf("\nOctet threshold summary = %I64x", cnt_thr.octet_threshold);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_misc_ctrl", strlen("gpy2xx_msec_config_ing_misc_ctrl")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_misc_ctrl: {
 		struct misc_control mics_ctrl;
 		memset(&mics_ctrl, 0, sizeof(struct misc_control));
 
-		cnt += scanParamArg(argc, argv, "mc_latency", sizeof(mics_ctrl.mc_latency_fix), &mics_ctrl.mc_latency_fix);
-		cnt += scanParamArg(argc, argv, "static_bp", sizeof(mics_ctrl.static_bypass), &mics_ctrl.static_bypass);
-		cnt += scanParamArg(argc, argv, "nm_macsec", sizeof(mics_ctrl.nm_macsec_en), &mics_ctrl.nm_macsec_en);
-		cnt += scanParamArg(argc, argv, "validate_level", sizeof(mics_ctrl.validate_frames), &mics_ctrl.validate_frames);
-		cnt += scanParamArg(argc, argv, "sectag_avlan", sizeof(mics_ctrl.sectag_after_vlan), &mics_ctrl.sectag_after_vlan);
+		cli_parse(cmd, argc, argv, &mics_ctrl);
 
 		ret = gpy2xx_msec_config_ing_misc_ctrl(&phy, &mics_ctrl);
 
@@ -5333,15 +6283,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Misc ctrl param set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_misc_ctrl", strlen("gpy2xx_msec_config_egr_misc_ctrl")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_misc_ctrl: {
 		struct misc_control mics_ctrl;
 		memset(&mics_ctrl, 0, sizeof(struct misc_control));
 
-		cnt += scanParamArg(argc, argv, "mc_latency", sizeof(mics_ctrl.mc_latency_fix), &mics_ctrl.mc_latency_fix);
-		cnt += scanParamArg(argc, argv, "static_bp", sizeof(mics_ctrl.static_bypass), &mics_ctrl.static_bypass);
-		cnt += scanParamArg(argc, argv, "nm_macsec", sizeof(mics_ctrl.nm_macsec_en), &mics_ctrl.nm_macsec_en);
-		cnt += scanParamArg(argc, argv, "validate_level", sizeof(mics_ctrl.validate_frames), &mics_ctrl.validate_frames);
-		cnt += scanParamArg(argc, argv, "sectag_avlan", sizeof(mics_ctrl.sectag_after_vlan), &mics_ctrl.sectag_after_vlan);
+		cli_parse(cmd, argc, argv, &mics_ctrl);
 
 		ret = gpy2xx_msec_config_egr_misc_ctrl(&phy, &mics_ctrl);
 
@@ -5349,27 +6297,23 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Misc ctrl param set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sa_nm_ctrl", strlen("gpy2xx_msec_config_ing_sa_nm_ctrl")) == 0) {
-		u16 in_data;
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sa_nm_ctrl: {
+		struct cli_sa_nm_ctrl_args a;
 		struct sa_nm_params nm_ctrl;
+		memset(&a, 0, sizeof(struct cli_sa_nm_ctrl_args));
 		memset(&nm_ctrl, 0, sizeof(struct sa_nm_params));
 
-		cnt += scanParamArg(argc, argv, "comp_etype", sizeof(in_data), &in_data);
-		nm_ctrl.comp_etype = in_data;
-		cnt += scanParamArg(argc, argv, "check_ver", sizeof(in_data), &in_data);
-		nm_ctrl.check_v = in_data;
-		cnt += scanParamArg(argc, argv, "check_kay", sizeof(in_data), &in_data);
-		nm_ctrl.check_kay = in_data;
-		cnt += scanParamArg(argc, argv, "check_ce", sizeof(in_data), &in_data);
-		nm_ctrl.check_c_e = in_data;
-		cnt += scanParamArg(argc, argv, "check_sc", sizeof(in_data), &in_data);
-		nm_ctrl.check_sc = in_data;
-		cnt += scanParamArg(argc, argv, "check_sl", sizeof(in_data), &in_data);
-		nm_ctrl.check_sl = in_data;
-		cnt += scanParamArg(argc, argv, "check_pn", sizeof(in_data), &in_data);
-		nm_ctrl.check_pn = in_data;
-		cnt += scanParamArg(argc, argv, "msec_eth", sizeof(in_data), &in_data);
-		nm_ctrl.msec_tag_value = in_data;
+		cli_parse(cmd, argc, argv, &a);
+		nm_ctrl.comp_etype = a.comp_etype;
+		nm_ctrl.check_v = a.check_ver;
+		nm_ctrl.check_kay = a.check_kay;
+		nm_ctrl.check_c_e = a.check_ce;
+		nm_ctrl.check_sc = a.check_sc;
+		nm_ctrl.check_sl = a.check_sl;
+		nm_ctrl.check_pn = a.check_pn;
+		nm_ctrl.msec_tag_value = a.msec_eth;
 		//printf("Utility raw %x\n", nm_ctrl.raw_sanm_ctrl);
 
 		ret = gpy2xx_msec_config_ing_sa_nm_ctrl(&phy, &nm_ctrl);
@@ -5378,27 +6322,23 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA Non-Match ctrl param set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sa_nm_ctrl", strlen("gpy2xx_msec_config_egr_sa_nm_ctrl")) == 0) {
-		u16 in_data;
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sa_nm_ctrl: {
+		struct cli_sa_nm_ctrl_args a;
 		struct sa_nm_params nm_ctrl;
+		memset(&a, 0, sizeof(struct cli_sa_nm_ctrl_args));
 		memset(&nm_ctrl, 0, sizeof(struct sa_nm_params));
 
-		cnt += scanParamArg(argc, argv, "comp_etype", sizeof(in_data), &in_data);
-		nm_ctrl.comp_etype = in_data;
-		cnt += scanParamArg(argc, argv, "check_ver", sizeof(in_data), &in_data);
-		nm_ctrl.check_v = in_data;
-		cnt += scanParamArg(argc, argv, "check_kay", sizeof(in_data), &in_data);
-		nm_ctrl.check_kay = in_data;
-		cnt += scanParamArg(argc, argv, "check_ce", sizeof(in_data), &in_data);
-		nm_ctrl.check_c_e = in_data;
-		cnt += scanParamArg(argc, argv, "check_sc", sizeof(in_data), &in_data);
-		nm_ctrl.check_sc = in_data;
-		cnt += scanParamArg(argc, argv, "check_sl", sizeof(in_data), &in_data);
-		nm_ctrl.check_sl = in_data;
-		cnt += scanParamArg(argc, argv, "check_pn", sizeof(in_data), &in_data);
-		nm_ctrl.check_pn = in_data;
-		cnt += scanParamArg(argc, argv, "msec_eth", sizeof(in_data), &in_data);
-		nm_ctrl.msec_tag_value = in_data;
+		cli_parse(cmd, argc, argv, &a);
+		nm_ctrl.comp_etype = a.comp_etype;
+		nm_ctrl.check_v = a.check_ver;
+		nm_ctrl.check_kay = a.check_kay;
+		nm_ctrl.check_c_e = a.check_ce;
+		nm_ctrl.check_sc = a.check_sc;
+		nm_ctrl.check_sl = a.check_sl;
+		nm_ctrl.check_pn = a.check_pn;
+		nm_ctrl.msec_tag_value = a.msec_eth;
 		//printf("Utility raw %x\n", nm_ctrl.raw_sanm_ctrl);
 
 		ret = gpy2xx_msec_config_egr_sa_nm_ctrl(&phy, &nm_ctrl);
@@ -5407,15 +6347,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA Non-Match ctrl param set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sa_nm_ncp", strlen("gpy2xx_msec_config_ing_sa_nm_ncp")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sa_nm_ncp: {
 		struct sa_nonmatch_fca nm_fca;
 		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		cli_parse(cmd, argc, argv, &nm_fca);
 
 		ret = gpy2xx_msec_config_ing_sa_nm_ncp(&phy, &nm_fca);
 
@@ -5423,15 +6361,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA Non-Match NCP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sa_nm_ncp", strlen("gpy2xx_msec_config_egr_sa_nm_ncp")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sa_nm_ncp: {
 		struct sa_nonmatch_fca nm_fca;
 		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		//cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		cli_parse(cmd, argc, argv, &nm_fca);
 
 		ret = gpy2xx_msec_config_egr_sa_nm_ncp(&phy, &nm_fca);
 
@@ -5439,15 +6375,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA Non-Match NCP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sa_nm_cp", strlen("gpy2xx_msec_config_ing_sa_nm_cp")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sa_nm_cp: {
 		struct sa_nonmatch_fca nm_fca;
 		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		cli_parse(cmd, argc, argv, &nm_fca);
 
 		ret = gpy2xx_msec_config_ing_sa_nm_cp(&phy, &nm_fca);
 
@@ -5455,15 +6389,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA Non-Match CP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sa_nm_cp", strlen("gpy2xx_msec_config_egr_sa_nm_cp")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sa_nm_cp: {
 		struct sa_nonmatch_fca nm_fca;
 		memset(&nm_fca, 0, sizeof(struct sa_nonmatch_fca));
 
-		cnt += scanParamArg(argc, argv, "pkt_type", sizeof(nm_fca.pkt_type), &nm_fca.pkt_type);
-		cnt += scanParamArg(argc, argv, "flow_type", sizeof(nm_fca.flow_type), &nm_fca.flow_type);
-		cnt += scanParamArg(argc, argv, "dest_port", sizeof(nm_fca.dest_port), &nm_fca.dest_port);
-		//cnt += scanParamArg(argc, argv, "drop_nonres", sizeof(nm_fca.drop_non_reserved), &nm_fca.drop_non_reserved);
-		cnt += scanParamArg(argc, argv, "drop_action", sizeof(nm_fca.drop_action), &nm_fca.drop_action);
+		cli_parse(cmd, argc, argv, &nm_fca);
 
 		ret = gpy2xx_msec_config_egr_sa_nm_cp(&phy, &nm_fca);
 
@@ -5471,12 +6403,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA Non-Match CP pkt action set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_ing_stats_summ", strlen("gpy2xx_msec_clear_ing_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_stats_summ: {
 		struct stats_summary xxx_summ;
 		memset(&xxx_summ, 0, sizeof(struct stats_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(xxx_summ.psa_sum_word[0]), &xxx_summ.psa_sum_word[0]);
-		cnt += scanParamArg(argc, argv, "glb_summ", sizeof(xxx_summ.glb_summ_word), &xxx_summ.glb_summ_word);
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
 		ret = gpy2xx_msec_clear_ing_stats_summ(&phy, &xxx_summ);
 
@@ -5484,12 +6417,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA stats summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_stats_summ", strlen("gpy2xx_msec_clear_egr_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_stats_summ: {
 		struct stats_summary xxx_summ;
 		memset(&xxx_summ, 0, sizeof(struct stats_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(xxx_summ.psa_sum_word[0]), &xxx_summ.psa_sum_word[0]);
-		cnt += scanParamArg(argc, argv, "glb_summ", sizeof(xxx_summ.glb_summ_word), &xxx_summ.glb_summ_word);
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
 		ret = gpy2xx_msec_clear_egr_stats_summ(&phy, &xxx_summ);
 
@@ -5497,13 +6431,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA stats summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_ing_psa_stats_summ", strlen("gpy2xx_msec_clear_ing_psa_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_psa_stats_summ: {
 		struct psa_summary psa_summ;
 		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(psa_summ.count_summ_psa[0]), &psa_summ.count_summ_psa[0]);
+		cli_parse(cmd, argc, argv, &psa_summ);
 
 		ret = gpy2xx_msec_clear_ing_psa_stats_summ(&phy, &psa_summ);
 
@@ -5511,14 +6445,15 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Per-SA stats summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_psa_stats_summ", strlen("gpy2xx_msec_get_ing_psa_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_psa_stats_summ: {
 		int i;
 		struct psa_summary psa_summ;
 		struct ing_psa_bmap counter_bmap;
 		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
+		cli_parse(cmd, argc, argv, &psa_summ);
 
 		ret = gpy2xx_msec_get_ing_psa_stats_summ(&phy, &psa_summ);
 
@@ -5566,13 +6501,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			if (psa_summ.psa_type == PSA_SUMM_GET_GIVEN)
 				break;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_psa_stats_summ", strlen("gpy2xx_msec_clear_egr_psa_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_psa_stats_summ: {
 		struct psa_summary psa_summ;
 		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
-		cnt += scanParamArg(argc, argv, "psa_summ0", sizeof(psa_summ.count_summ_psa[0]), &psa_summ.count_summ_psa[0]);
+		cli_parse(cmd, argc, argv, &psa_summ);
 
 		ret = gpy2xx_msec_clear_egr_psa_stats_summ(&phy, &psa_summ);
 
@@ -5580,14 +6515,15 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Per-SA stats summary set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_psa_stats_summ", strlen("gpy2xx_msec_get_egr_psa_stats_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_psa_stats_summ: {
 		int i;
 		struct psa_summary psa_summ;
 		struct egr_psa_bmap counter_bmap;
 		memset(&psa_summ, 0, sizeof(struct psa_summary));
 
-		cnt += scanParamArg(argc, argv, "psa_type", sizeof(psa_summ.psa_type), &psa_summ.psa_type);
-		cnt += scanParamArg(argc, argv, "rule_index", sizeof(psa_summ.rule_index), &psa_summ.rule_index);
+		cli_parse(cmd, argc, argv, &psa_summ);
 
 		ret = gpy2xx_msec_get_egr_psa_stats_summ(&phy, &psa_summ);
 
@@ -5614,20 +6550,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			if (psa_summ.psa_type == PSA_SUMM_GET_GIVEN)
 				break;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_cp_rule", strlen("gpy2xx_msec_config_ing_cp_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_cp_rule: {
 		struct cp_class_param cpc_rule;
 		memset(&cpc_rule, 0, sizeof(struct cp_class_param));
 
-		cnt += scanParamArg(argc, argv, "cpc_index", sizeof(cpc_rule.cpc_index), &cpc_rule.cpc_index);
-		cnt += scanParamArg(argc, argv, "entry_type", sizeof(cpc_rule.cpc_type), &cpc_rule.cpc_type);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", cpc_rule.mac_da);
-		//cnt += scanMAC_Arg(argc, argv, "da_start", cpc_rule.mac_da_start);
-		cnt += scanMAC_Arg(argc, argv, "da_end", cpc_rule.mac_da_end);
-		//cnt += scanMAC_Arg(argc, argv, "da_const44", cpc_rule.mac_da_const44);
-		//cnt += scanMAC_Arg(argc, argv, "da_const48", cpc_rule.mac_da_const48);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(cpc_rule.ether_type), &cpc_rule.ether_type);
-		cnt += scanParamArg(argc, argv, "cpm_mode", sizeof(cpc_rule.cpm_mode), &cpc_rule.cpm_mode);
-		cnt += scanParamArg(argc, argv, "cpm_en", sizeof(cpc_rule.cpm_enable), &cpc_rule.cpm_enable);
+		cli_parse(cmd, argc, argv, &cpc_rule);
 
 		ret = gpy2xx_msec_config_ing_cp_rule(&phy, &cpc_rule);
 
@@ -5635,20 +6564,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: CPC rule set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_cp_rule", strlen("gpy2xx_msec_config_egr_cp_rule")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_cp_rule: {
 		struct cp_class_param cpc_rule;
 		memset(&cpc_rule, 0, sizeof(struct cp_class_param));
 
-		cnt += scanParamArg(argc, argv, "cpc_index", sizeof(cpc_rule.cpc_index), &cpc_rule.cpc_index);
-		cnt += scanParamArg(argc, argv, "entry_type", sizeof(cpc_rule.cpc_type), &cpc_rule.cpc_type);
-		cnt += scanMAC_Arg(argc, argv, "da_mac", cpc_rule.mac_da);
-		//cnt += scanMAC_Arg(argc, argv, "da_start", cpc_rule.mac_da_start);
-		cnt += scanMAC_Arg(argc, argv, "da_end", cpc_rule.mac_da_end);
-		//cnt += scanMAC_Arg(argc, argv, "da_const44", cpc_rule.mac_da_const44);
-		//cnt += scanMAC_Arg(argc, argv, "da_const48", cpc_rule.mac_da_const48);
-		cnt += scanParamArg(argc, argv, "eth_type", sizeof(cpc_rule.ether_type), &cpc_rule.ether_type);
-		cnt += scanParamArg(argc, argv, "cpm_mode", sizeof(cpc_rule.cpm_mode), &cpc_rule.cpm_mode);
-		cnt += scanParamArg(argc, argv, "cpm_en", sizeof(cpc_rule.cpm_enable), &cpc_rule.cpm_enable);
+		cli_parse(cmd, argc, argv, &cpc_rule);
 
 		ret = gpy2xx_msec_config_egr_cp_rule(&phy, &cpc_rule);
 
@@ -5656,12 +6578,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: CPC rule set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_sa_pn_thr_summ", strlen("gpy2xx_msec_clear_sa_pn_thr_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_sa_pn_thr_summ: {
 		struct sa_pn_thr_summ xxx_summ;
 		memset(&xxx_summ, 0, sizeof(struct sa_pn_thr_summ));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "pnthr_summ0", sizeof(xxx_summ.pnthr_sum_word[0]), &xxx_summ.pnthr_sum_word[0]);
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
 		ret = gpy2xx_msec_clear_sa_pn_thr_summ(&phy, &xxx_summ);
 
@@ -5669,7 +6592,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA PN Threshold summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_sa_pn_thr_summ", strlen("gpy2xx_msec_get_sa_pn_thr_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_sa_pn_thr_summ: {
 		int i;
 		struct sa_pn_thr_summ xxx_summ;
 		memset(&xxx_summ, 0, sizeof(struct sa_pn_thr_summ));
@@ -5687,12 +6612,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
 			printf("\nPN threshold summary[%02d] = 0x%08x", i, xxx_summ.pnthr_sum_word[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_sa_exp_summ", strlen("gpy2xx_msec_clear_egr_sa_exp_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_sa_exp_summ: {
 		struct sa_exp_summ xxx_summ;
 		memset(&xxx_summ, 0, sizeof(struct sa_exp_summ));
 
-		//cnt += scanParamArg(argc, argv, "word_num", sizeof(raw_ee.word_num), &raw_ee.word_num);
-		cnt += scanParamArg(argc, argv, "saexp_summ0", sizeof(xxx_summ.sa_expsum_word[0]), &xxx_summ.sa_expsum_word[0]);
+		cli_parse(cmd, argc, argv, &xxx_summ);
 
 		ret = gpy2xx_msec_clear_egr_sa_exp_summ(&phy, &xxx_summ);
 
@@ -5700,7 +6626,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SA expired summary clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_sa_exp_summ", strlen("gpy2xx_msec_get_egr_sa_exp_summ")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sa_exp_summ: {
 		int i;
 		struct sa_exp_summ xxx_summ;
 		memset(&xxx_summ, 0, sizeof(struct sa_exp_summ));
@@ -5718,14 +6646,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		for (i = 0; i < (MACSEC_MAX_SA_RULES / 32); i++) {
 			printf("\nPN threshold summary[%02d] = 0x%08x", i, xxx_summ.sa_expsum_word[i]);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_ing_cc_int_stat", strlen("gpy2xx_msec_clear_ing_cc_int_stat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_ing_cc_int_stat: {
 		struct crypto_core_stat cc_stat;
 		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-		cnt += scanParamArg(argc, argv, "ctx_stat", sizeof(cc_stat.ctx_stat.raw_ctx_stat), &cc_stat.ctx_stat.raw_ctx_stat);
-#endif
-		cnt += scanParamArg(argc, argv, "int_stat", sizeof(cc_stat.int_stat.raw_int_stat), &cc_stat.int_stat.raw_int_stat);
+		cli_parse(cmd, argc, argv, &cc_stat);
 
 		ret = gpy2xx_msec_clear_ing_cc_int_stat(&phy, &cc_stat);
 
@@ -5733,7 +6660,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Crpypto cores interrupt status clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_cc_int_stat", strlen("gpy2xx_msec_get_ing_cc_int_stat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cc_int_stat: {
 		struct crypto_core_stat cc_stat;
 		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
@@ -5763,13 +6692,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (cc_stat.int_stat.seq_rollover)
 			printf("\nIf a sequence number roll-over (increment from maximum to zero) due to an outbound sequence number increment this interrupt is triggered (e10 egress only)");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_clear_egr_cc_int_stat", strlen("gpy2xx_msec_clear_egr_cc_int_stat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_clear_egr_cc_int_stat: {
 		struct crypto_core_stat cc_stat;
 		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
-#if defined(EN_MSEC_DEBUG_ACCESS) && EN_MSEC_DEBUG_ACCESS
-		cnt += scanParamArg(argc, argv, "ctx_stat", sizeof(cc_stat.ctx_stat.raw_ctx_stat), &cc_stat.ctx_stat.raw_ctx_stat);
-#endif
-		cnt += scanParamArg(argc, argv, "int_stat", sizeof(cc_stat.int_stat.raw_int_stat), &cc_stat.int_stat.raw_int_stat);
+
+		cli_parse(cmd, argc, argv, &cc_stat);
 
 		ret = gpy2xx_msec_clear_egr_cc_int_stat(&phy, &cc_stat);
 
@@ -5777,7 +6706,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: Crpypto cores interrupt status clear failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_cc_int_stat", strlen("gpy2xx_msec_get_egr_cc_int_stat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_cc_int_stat: {
 		struct crypto_core_stat cc_stat;
 		memset(&cc_stat, 0, sizeof(struct crypto_core_stat));
 
@@ -5807,12 +6738,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 
 		if (cc_stat.int_stat.seq_rollover)
 			printf("\nIf a sequence number roll-over (increment from maximum to zero) due to an outbound sequence number increment this interrupt is triggered (e10 egress only)");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_sn_thresh", strlen("gpy2xx_msec_config_ing_sn_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_sn_thresh: {
 		struct seq_num_thr sn_thr;
 		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
-		cnt += scanParamArg(argc, argv, "sn_thr", 64, &sn_thr.sn_threshold);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
 		ret = gpy2xx_msec_config_ing_sn_thresh(&phy, &sn_thr);
 
@@ -5820,11 +6752,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SN Threshold set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_sn_thresh", strlen("gpy2xx_msec_get_ing_sn_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_sn_thresh: {
 		struct seq_num_thr sn_thr;
 		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
 		ret = gpy2xx_msec_get_ing_sn_thresh(&phy, &sn_thr);
 
@@ -5834,12 +6768,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 
 		printf("\nSN threshold = %I64x", sn_thr.sn_threshold);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_sn_thresh", strlen("gpy2xx_msec_config_egr_sn_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_sn_thresh: {
 		struct seq_num_thr sn_thr;
 		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
-		cnt += scanParamArg(argc, argv, "sn_thr", 64, &sn_thr.sn_threshold);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
 		ret = gpy2xx_msec_config_egr_sn_thresh(&phy, &sn_thr);
 
@@ -5847,11 +6782,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR: SN Threshold set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_sn_thresh", strlen("gpy2xx_msec_get_egr_sn_thresh")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_sn_thresh: {
 		struct seq_num_thr sn_thr;
 		memset(&sn_thr, 0, sizeof(struct seq_num_thr));
 
-		cnt += scanParamArg(argc, argv, "sn_type", sizeof(sn_thr.sn_type), &sn_thr.sn_type);
+		cli_parse(cmd, argc, argv, &sn_thr);
 
 		ret = gpy2xx_msec_get_egr_sn_thresh(&phy, &sn_thr);
 
@@ -5861,14 +6798,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		}
 
 		printf("\nSN threshold = %I64x", sn_thr.sn_threshold);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_ing_aic_csr", strlen("gpy2xx_msec_config_ing_aic_csr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_ing_aic_csr: {
 		struct aic_control_stat aic_csr;
 		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
-		cnt += scanParamArg(argc, argv, "enable_ctrl", sizeof(aic_csr.enable_ctrl.raw_aic_bits), &aic_csr.enable_ctrl.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "ack", sizeof(aic_csr.ack.raw_aic_bits), &aic_csr.ack.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_set", sizeof(aic_csr.enable_set.raw_aic_bits), &aic_csr.enable_set.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_clr", sizeof(aic_csr.enable_clr.raw_aic_bits), &aic_csr.enable_clr.raw_aic_bits);
+		cli_parse(cmd, argc, argv, &aic_csr);
 
 		ret = gpy2xx_msec_config_ing_aic_csr(&phy, &aic_csr);
 
@@ -5876,7 +6812,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR:AIC's CSR set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_aic_csr", strlen("gpy2xx_msec_get_ing_aic_csr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_aic_csr: {
 		struct aic_control_stat aic_csr;
 		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
@@ -5909,14 +6847,13 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\n   Raw Interrupt Pending Status (i.e before masking) = 0x%08x (0b = inactive, 1b = pending)", aic_csr.raw_stat.raw_aic_bits);
 		printf("\n Masked Interrupt Pending Status (i.e after masking) = 0x%08x (0b = inactive, 1b = pending)", aic_csr.enabled_stat.raw_aic_bits);
 		printf("\n                            Interrupt Enable Control = 0x%08x (0b = disabled, 1b = enabled)", aic_csr.enable_ctrl.raw_aic_bits);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_config_egr_aic_csr", strlen("gpy2xx_msec_config_egr_aic_csr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_config_egr_aic_csr: {
 		struct aic_control_stat aic_csr;
 		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
-		cnt += scanParamArg(argc, argv, "enable_ctrl", sizeof(aic_csr.enable_ctrl.raw_aic_bits), &aic_csr.enable_ctrl.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "ack", sizeof(aic_csr.ack.raw_aic_bits), &aic_csr.ack.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_set", sizeof(aic_csr.enable_set.raw_aic_bits), &aic_csr.enable_set.raw_aic_bits);
-		cnt += scanParamArg(argc, argv, "enable_clr", sizeof(aic_csr.enable_clr.raw_aic_bits), &aic_csr.enable_clr.raw_aic_bits);
+		cli_parse(cmd, argc, argv, &aic_csr);
 
 		ret = gpy2xx_msec_config_egr_aic_csr(&phy, &aic_csr);
 
@@ -5924,7 +6861,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 			printf("\nERROR:AIC's CSR set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_aic_csr", strlen("gpy2xx_msec_get_egr_aic_csr")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_aic_csr: {
 		struct aic_control_stat aic_csr;
 		memset(&aic_csr, 0, sizeof(struct aic_control_stat));
 
@@ -5957,7 +6896,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\n   Raw Interrupt Pending Status (i.e before masking) = 0x%08x (0b = inactive, 1b = pending)", aic_csr.raw_stat.raw_aic_bits);
 		printf("\n Masked Interrupt Pending Status (i.e after masking) = 0x%08x (0b = inactive, 1b = pending)", aic_csr.enabled_stat.raw_aic_bits);
 		printf("\n                            Interrupt Enable Control = 0x%08x (0b = disabled, 1b = enabled)", aic_csr.enable_ctrl.raw_aic_bits);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_ing_cap", strlen("gpy2xx_msec_get_ing_cap")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_ing_cap: {
 		struct eip160_hwcap hw_cap;
 		memset(&hw_cap, 0, sizeof(struct eip160_hwcap));
 
@@ -5980,7 +6921,9 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\nAIC's number of interrupt inputs %x ", hw_cap.aic_opt.number_of_inputs);
 		printf("\nAIC num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
 		       hw_cap.aic_ver.eip_nr, hw_cap.aic_ver.eip_nr_complement, hw_cap.aic_ver.patch_level, hw_cap.aic_ver.minor_version, hw_cap.aic_ver.major_version);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_msec_get_egr_cap", strlen("gpy2xx_msec_get_egr_cap")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_msec_get_egr_cap: {
 		struct eip160_hwcap hw_cap;
 		memset(&hw_cap, 0, sizeof(struct eip160_hwcap));
 
@@ -6002,8 +6945,12 @@ int gpy2xx_msec_main(int argc, char *argv[])
 		printf("\nAIC's number of interrupt inputs %x ", hw_cap.aic_opt.number_of_inputs);
 		printf("\nAIC num %x compliment %x, patch-level %x, minor-ver %x, major-ver %x",
 		       hw_cap.aic_ver.eip_nr, hw_cap.aic_ver.eip_nr_complement, hw_cap.aic_ver.patch_level, hw_cap.aic_ver.minor_version, hw_cap.aic_ver.major_version);
-	} else	{
+		break;
+	}
+	default: {
 		printf("Command Not Supported\n");
+		break;
+	}
 	}
 
 	return ret;
@@ -6012,6 +6959,7 @@ int gpy2xx_msec_main(int argc, char *argv[])
 int gpy211_main(int argc, char *argv[])
 {
 	s32 ret = 0;
+	const struct cli_cmd *cmd = cli_cmd_lookup(gpy211_cmds, ARRAY_SIZE(gpy211_cmds), argv[0]);
 
 	if (xstrncasecmp(argv[0], "gpy2xx_init", strlen("gpy2xx_init")) != 0) {
 		if (phy.priv_data == 0) {
@@ -6020,7 +6968,8 @@ int gpy211_main(int argc, char *argv[])
 		}
 	}
 
-	if (xstrncasecmp(argv[0], "gpy2xx_init", strlen("gpy2xx_init")) == 0) {
+	switch (cmd != NULL ? cmd->id : CLI_CMD_NONE) {
+	case CLI_CMD_gpy2xx_init: {
 #if DELETE
 
 		if (phy.priv_data != 0) {
@@ -6042,12 +6991,16 @@ int gpy211_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: GPY211 init failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_uninit", strlen("gpy2xx_uninit")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_uninit: {
 		ret = gpy2xx_uninit(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: GPY211 uinit failed.\n");
-	}  else if (xstrncasecmp(argv[0], "gpy2xx_get_phy_id", strlen("gpy2xx_get_phy_id")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_get_phy_id: {
 		struct gpy211_id phyId = phy.id;
 
 		printf("\nPopulated PHY ID parameters:\n----------------\n");
@@ -6066,7 +7019,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Driver Minor Version Number", phyId.drv_minor);
 		printf("\t%40s:\t0x%x\n", "Driver Release Indication", phyId.drv_release);
 		printf("\t%40s:\t0x%x\n", "Driver Patch Indication", phyId.drv_patch);
-	}	else if (xstrncasecmp(argv[0], "gpy2xx_read_fw_info", strlen("gpy2xx_read_fw_info")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_read_fw_info: {
 		ret = gpy2xx_read_fw_info(&phy);
 
 		if (ret < 0)
@@ -6079,12 +7034,16 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Firmware Minor Version Number", phyId.fw_minor);
 		printf("\t%40s:\t0x%x\n", "Firmware Release Indication", phyId.fw_release);
 		printf("\t%40s:\t%s\n", "The memory target used for firmware execution", (phyId.fw_memory ? ((phyId.fw_memory == 1) ? "OTP" : ((phyId.fw_memory == 2) ? "FLASH" : "SRAM")) : "ROM"));
-	} else if (xstrncasecmp(argv[0], "gpy2xx_soft_reset", strlen("gpy2xx_soft_reset")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_soft_reset: {
 		ret = gpy2xx_soft_reset(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: SW reset failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_poll_reset", strlen("gpy2xx_poll_reset")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_poll_reset: {
 		ret = gpy2xx_poll_reset(&phy);
 
 		if (ret > 0)
@@ -6095,11 +7054,12 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: SW reset polling failed.\n");
 
 #if defined(EN_SMDIO_RW) && EN_SMDIO_RW
-	} else if (xstrncasecmp(argv[0], "gpy2xx_smdio_read", strlen("gpy2xx_smdio_read")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_smdio_read: {
 		u32 reg_off;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &reg_off);
 
 		ret = gpy2xx_smdio_read(&phy, reg_off);
 
@@ -6108,52 +7068,52 @@ int gpy211_main(int argc, char *argv[])
 		} else {
 			printf("\nSmdio rd vale = 0x%x\n", ret);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_smdio_write", strlen("gpy2xx_smdio_write")) == 0) {
-		int cnt = 0;
-		u32 reg_off;
-		u16 data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_smdio_write: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_smdio_write(&phy, reg_off, data_val);
+		ret = gpy2xx_smdio_write(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: SMDIO write failed\n");
 		}
 
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_read_mmd", strlen("gpy2xx_read_mmd")) == 0) {
-		int cnt = 0;
-		int dev_id;
-		u32 reg_off;
+		break;
+	}
+	case CLI_CMD_gpy2xx_read_mmd: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "devtype", sizeof(dev_id), &dev_id);
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_read_mmd(&phy, dev_id, reg_off);
+		ret = gpy2xx_read_mmd(&phy, a.devtype, a.regaddr);
 
 		if (ret < 0) {
 			printf("\nERROR: MMD read failed.\n");
 		} else {
 			printf("\nMmd rd vale = 0x%x\n", ret);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_write_mmd", strlen("gpy2xx_write_mmd")) == 0) {
-		int cnt = 0;
-		int dev_id;
-		u32 reg_off;
-		u16 data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_write_mmd: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "devtype", sizeof(dev_id), &dev_id);
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_write_mmd(&phy, dev_id, reg_off, data_val);
+		ret = gpy2xx_write_mmd(&phy, a.devtype, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: MMD write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_read_status", strlen("gpy2xx_read_status")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_read_status: {
 		ret = gpy2xx_read_status(&phy);
 
 		if (ret < 0)
@@ -6176,11 +7136,12 @@ int gpy211_main(int argc, char *argv[])
 			print_advert(buf, sizeof(buf), linkConfig.lp_advertising);
 			printf("\t%40s:\t0x%I64x (%s)\n", "Link partner advertising modes", linkConfig.lp_advertising, buf);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_read", strlen("gpy2xx_read")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_read: {
 		u32 reg_off;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &reg_off);
 
 		ret = gpy2xx_read(&phy, reg_off);
 
@@ -6189,26 +7150,27 @@ int gpy211_main(int argc, char *argv[])
 		} else {
 			printf("\nMdio rd vale = 0x%x\n", ret);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_write", strlen("gpy2xx_write")) == 0) {
-		int cnt = 0;
-		u32 reg_off;
-		u16 data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_write: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_write(&phy, reg_off, data_val);
+		ret = gpy2xx_write(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: MDIO write failed.\n");
 		}
 
 #if defined(P31G_IND_RW) && P31G_IND_RW
-	} else if (xstrncasecmp(argv[0], "pm_ind_read", strlen("pm_ind_read")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_pm_ind_read: {
 		u32 reg_off, data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &reg_off);
 
 		ret = pm_indirect_read(&phy, reg_off, &data_val);
 
@@ -6217,25 +7179,27 @@ int gpy211_main(int argc, char *argv[])
 		} else {
 			printf("\nPM rd vale = 0x%x\n", data_val);
 		}
-	} else if (xstrncasecmp(argv[0], "pm_ind_write", strlen("pm_ind_write")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		break;
+	}
+	case CLI_CMD_pm_ind_write: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = pm_indirect_write(&phy, reg_off, data_val);
+		ret = pm_indirect_write(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: PM write failed.\n");
 		}
 
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_mbox_read16", strlen("gpy2xx_mbox_read16")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_read16: {
 		u32 reg_off, data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &reg_off);
 
 		ret = gpy2xx_mbox_read16(&phy, reg_off, &data_val);
 
@@ -6244,23 +7208,25 @@ int gpy211_main(int argc, char *argv[])
 		} else {
 			printf("\nMBOX rd vale = 0x%x\n", data_val);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_mbox_write16", strlen("gpy2xx_mbox_write16")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_write16: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_mbox_write16(&phy, reg_off, data_val);
+		ret = gpy2xx_mbox_write16(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: MBOX write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_mbox_read32", strlen("gpy2xx_mbox_read32")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_read32: {
 		u32 reg_off, data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &reg_off);
 
 		ret = gpy2xx_mbox_read32(&phy, reg_off, &data_val);
 
@@ -6269,23 +7235,25 @@ int gpy211_main(int argc, char *argv[])
 		} else {
 			printf("\nMBOX rd vale = 0x%x\n", data_val);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_mbox_write32", strlen("gpy2xx_mbox_write32")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_mbox_write32: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = gpy2xx_mbox_write32(&phy, reg_off, data_val);
+		ret = gpy2xx_mbox_write32(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: MBOX write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_xpcs_read16", strlen("gpy2xx_xpcs_read16")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_xpcs_read16: {
 		u32 reg_off, data_val;
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
+		cli_parse(cmd, argc, argv, &reg_off);
 
 		ret = PHY_XPCS_HWRD(&phy, reg_off, &data_val);
 
@@ -6294,22 +7262,25 @@ int gpy211_main(int argc, char *argv[])
 		} else {
 			printf("\nPHY XPCS rd vale = 0x%x\n", data_val);
 		}
-	} else if (xstrncasecmp(argv[2], "gpy2xx_xpcs_write16", strlen("gpy2xx_xpcs_write16")) == 0) {
-		int cnt = 0;
-		u32 reg_off, data_val;
+		break;
+	}
+	case CLI_CMD_gpy2xx_xpcs_write16: {
+		struct cli_reg_args a;
+		memset(&a, 0, sizeof(struct cli_reg_args));
 
-		cnt += scanParamArg(argc, argv, "regaddr", sizeof(reg_off), &reg_off);
-		cnt += scanParamArg(argc, argv, "data", sizeof(data_val), &data_val);
+		cli_parse(cmd, argc, argv, &a);
 
-		ret = PHY_XPCS_HWWR(&phy, reg_off, data_val);
+		ret = PHY_XPCS_HWWR(&phy, a.regaddr, a.data);
 
 		if (ret < 0) {
 			printf("\nERROR: PHY XPCS write failed.\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_config_advert", strlen("gpy2xx_config_advert")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_config_advert: {
 		char buf[256];
 
-		if (scan_advert(argc, argv, "advertising", &phy.link.advertising) == 0)
+		if (!(cli_parse(cmd, argc, argv, &phy) & (1u << 0)))
 			phy.link.advertising = phy.link.supported;
 
 		print_advert(buf, sizeof(buf), phy.link.supported);
@@ -6321,52 +7292,30 @@ int gpy211_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: Setting Auto-Negotiation's advertisement conf failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_setup_forced", strlen("gpy2xx_setup_forced")) == 0) {
-		if (scanParamArg(argc, argv, "speed", sizeof(phy.link.speed), &phy.link.speed) == 0)
-			phy.link.speed = SPEED_2500;
-
-		if (scanParamArg(argc, argv, "duplex", sizeof(phy.link.duplex), &phy.link.duplex) == 0)
-			phy.link.duplex = DUPLEX_FULL;
-
-		if (scanParamArg(argc, argv, "pause", sizeof(phy.link.pause), &phy.link.pause) == 0)
-			phy.link.pause = 1;
-
-		if (scanParamArg(argc, argv, "asym_pause", sizeof(phy.link.asym_pause), &phy.link.asym_pause) == 0)
-			phy.link.asym_pause = 1;
-
-		if (scanParamArg(argc, argv, "mstr_slave", sizeof(phy.mstr_slave), &phy.mstr_slave) == 0)
-			phy.mstr_slave = 1;
+		break;
+	}
+	case CLI_CMD_gpy2xx_setup_forced: {
+		cli_parse(cmd, argc, argv, &phy);
 
 		ret = gpy2xx_setup_forced(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: Setting forceful link speed failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_restart_aneg", strlen("gpy2xx_restart_aneg")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_restart_aneg: {
 		ret = gpy2xx_restart_aneg(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: Restarting Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_config_aneg", strlen("gpy2xx_config_aneg")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_config_aneg: {
 		char buf[256];
 
-		if (scanParamArg(argc, argv, "autoneg", sizeof(phy.link.autoneg), &phy.link.autoneg) == 0)
-			phy.link.autoneg = 1;
-
-		if (scan_advert(argc, argv, "advertising", &phy.link.advertising) == 0)
+		if (!(cli_parse(cmd, argc, argv, &phy) & (1u << 1)))
 			phy.link.advertising = phy.link.supported;
 
-		if (scanParamArg(argc, argv, "speed", sizeof(phy.link.speed), &phy.link.speed) == 0)
-			phy.link.speed = SPEED_2500;
-
-		if (scanParamArg(argc, argv, "duplex", sizeof(phy.link.duplex), &phy.link.duplex) == 0)
-			phy.link.duplex = DUPLEX_FULL;
-
-		if (scanParamArg(argc, argv, "pause", sizeof(phy.link.pause), &phy.link.pause) == 0)
-			phy.link.pause = 1;
-
-		if (scanParamArg(argc, argv, "asym_pause", sizeof(phy.link.asym_pause), &phy.link.asym_pause) == 0)
-			phy.link.asym_pause = 1;
-
 		print_advert(buf, sizeof(buf), phy.link.supported);
 		printf("\t%24s:\t0x%I64x (%s)\n", "GPHY supported modes", phy.link.supported, buf);
 		print_advert(buf, sizeof(buf), phy.link.advertising);
@@ -6376,7 +7325,9 @@ int gpy211_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: Configuring Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_aneg_done", strlen("gpy2xx_aneg_done")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_aneg_done: {
 		ret = gpy2xx_aneg_done(&phy);
 
 		if (ret == 0)
@@ -6385,7 +7336,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nAuto-Negotiation completed.\n");
 		else
 			printf("\nERROR: Auto-Negotiation polling failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_update_link", strlen("gpy2xx_update_link")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_update_link: {
 		ret = gpy2xx_update_link(&phy);
 
 		if (ret < 0)
@@ -6395,26 +7348,25 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nLink Down.\n");
 		else
 			printf("\nLink Up.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gpio_cfg", strlen("gpy2xx_gpio_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_cfg: {
 		struct gpy211_gpio gpioCfg;
 		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
-		cnt += scanParamArg(argc, argv, "gpioFlags", sizeof(gpioCfg.flags), &gpioCfg.flags);
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
 		ret = gpy2xx_gpio_cfg(&phy, &gpioCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set GPIO configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gpio_get", strlen("gpy2xx_gpio_get")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_get: {
 		struct gpy211_gpio gpioCfg;
 		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
 		ret = gpy2xx_gpio_get(&phy, &gpioCfg);
 
@@ -6435,25 +7387,25 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%60s:\t0x%x\n", "gpioAltFunc: 0 = , 1 = , 2 = , 3 =", (gpioCfg.flags >> 10) & 0x3);
 		printf("\t%60s:\t0x%x\n", "gpioPadStrength: 0 = 2mA, 1 = 4mA, 2 = 8mA, 3 = 12mA", (gpioCfg.flags >> 12) & 0x3);
 		printf("\t%60s:\t0x%x\n", "gpioSlewRate: 0 = Slow, 3 = Fast", (gpioCfg.flags >> 15) & 0x1);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gpio_output", strlen("gpy2xx_gpio_output")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_output: {
 		struct gpy211_gpio gpioCfg;
 		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
 		ret = gpy2xx_gpio_output(&phy, &gpioCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set GPIO pin as output failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gpio_input", strlen("gpy2xx_gpio_input")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gpio_input: {
 		struct gpy211_gpio gpioCfg;
 		memset(&gpioCfg, 0, sizeof(struct gpy211_gpio));
 
-		//cnt += scanParamArg(argc, argv, "portId", sizeof(gpioCfg.port), &gpioCfg.port);
-		cnt += scanParamArg(argc, argv, "pinId", sizeof(gpioCfg.pin), &gpioCfg.pin);
+		cli_parse(cmd, argc, argv, &gpioCfg);
 
 		ret = gpy2xx_gpio_input(&phy, &gpioCfg);
 
@@ -6463,8 +7415,9 @@ int gpy211_main(int argc, char *argv[])
 		}
 
 		printf("\t%40s:\t0x%x\n", "gpioFlags", gpioCfg.flags);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_led_br_cfg", strlen("gpy2xx_led_br_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_br_cfg: {
 		struct gpy211_led_brlvl_cfg brightnessCfg;
 		memset(&brightnessCfg, 0, sizeof(struct gpy211_led_brlvl_cfg));
 
@@ -6475,16 +7428,15 @@ int gpy211_main(int argc, char *argv[])
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "brightMode", sizeof(brightnessCfg.mode), &brightnessCfg.mode);
-		cnt += scanParamArg(argc, argv, "brightLvlMin", sizeof(brightnessCfg.lvl_min), &brightnessCfg.lvl_min);
-		cnt += scanParamArg(argc, argv, "brightLvlMax", sizeof(brightnessCfg.lvl_max), &brightnessCfg.lvl_max);
-		cnt += scanParamArg(argc, argv, "swEdgeDetect", sizeof(brightnessCfg.sw_edge), &brightnessCfg.sw_edge);
+		cli_parse(cmd, argc, argv, &brightnessCfg);
 
 		ret = gpy2xx_led_br_cfg(&phy, &brightnessCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set LED Brigtness configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_led_br_get", strlen("gpy2xx_led_br_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_br_get: {
 		struct gpy211_led_brlvl_cfg brightnessCfg;
 		memset(&brightnessCfg, 0, sizeof(struct gpy211_led_brlvl_cfg));
 
@@ -6500,8 +7452,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "brightLvlMax", brightnessCfg.lvl_max);
 		printf("\t%40s:\t0x%x\n", "swEdgeDetect", brightnessCfg.sw_edge);
 #if defined(EN_LED_TOP_CFG) && EN_LED_TOP_CFG
-	} else if (xstrncasecmp(argv[0], "gpy2xx_led_top_cfg", strlen("gpy2xx_led_top_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_top_cfg: {
 		struct gpy211_led_gcfg genLedCfg;
 		memset(&genLedCfg, 0, sizeof(struct gpy211_led_gcfg));
 
@@ -6512,17 +7465,15 @@ int gpy211_main(int argc, char *argv[])
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "complexScan", sizeof(genLedCfg.complex_scan), &genLedCfg.complex_scan);
-		cnt += scanParamArg(argc, argv, "complexBlink", sizeof(genLedCfg.complex_blink), &genLedCfg.complex_blink);
-		cnt += scanParamArg(argc, argv, "inverseScan", sizeof(genLedCfg.inverse_scan), &genLedCfg.inverse_scan);
-		cnt += scanParamArg(argc, argv, "fastBlinkFreq", sizeof(genLedCfg.fast_blink_freq), &genLedCfg.fast_blink_freq);
-		cnt += scanParamArg(argc, argv, "slowBlinkFreq", sizeof(genLedCfg.slow_blink_freq), &genLedCfg.slow_blink_freq);
+		cli_parse(cmd, argc, argv, &genLedCfg);
 
 		ret = gpy2xx_led_top_cfg(&phy, &genLedCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set LED's General configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_led_top_get", strlen("gpy2xx_led_top_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_top_get: {
 		struct gpy211_led_gcfg genLedCfg;
 		memset(&genLedCfg, 0, sizeof(struct gpy211_led_gcfg));
 
@@ -6539,12 +7490,14 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "fastBlinkFreq", genLedCfg.fast_blink_freq);
 		printf("\t%40s:\t0x%x\n", "slowBlinkFreq", genLedCfg.slow_blink_freq);
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_led_if_cfg", strlen("gpy2xx_led_if_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_if_cfg: {
 		struct gpy211_led_cfg genIfCfg;
 		memset(&genIfCfg, 0, sizeof(struct gpy211_led_cfg));
 
-		cnt += scanParamArg(argc, argv, "ledId", sizeof(genIfCfg.id), &genIfCfg.id);
+		/* ledId selects the LED, the other parameters update its configuration */
+		cli_parse(cmd, argc, argv, &genIfCfg);
 
 		ret = gpy2xx_led_if_get(&phy, &genIfCfg);
 
@@ -6553,22 +7506,19 @@ int gpy211_main(int argc, char *argv[])
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "colorMode", sizeof(genIfCfg.color_mode), &genIfCfg.color_mode);
-		cnt += scanParamArg(argc, argv, "slowBlinkSrc", sizeof(genIfCfg.slow_blink_src), &genIfCfg.slow_blink_src);
-		cnt += scanParamArg(argc, argv, "fastBlinkSrc", sizeof(genIfCfg.fast_blink_src), &genIfCfg.fast_blink_src);
-		cnt += scanParamArg(argc, argv, "constantlyOn", sizeof(genIfCfg.const_on), &genIfCfg.const_on);
-		cnt += scanParamArg(argc, argv, "pulseFlags", sizeof(genIfCfg.pulse), &genIfCfg.pulse);
+		cli_parse(cmd, argc, argv, &genIfCfg);
 
 		ret = gpy2xx_led_if_cfg(&phy, &genIfCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set LED's IF configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_led_if_get", strlen("gpy2xx_led_if_get")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_led_if_get: {
 		struct gpy211_led_cfg genIfCfg;
 		memset(&genIfCfg, 0, sizeof(struct gpy211_led_cfg));
 
-		cnt += scanParamArg(argc, argv, "ledId", sizeof(genIfCfg.id), &genIfCfg.id);
+		cli_parse(cmd, argc, argv, &genIfCfg);
 
 		ret = gpy2xx_led_if_get(&phy, &genIfCfg);
 
@@ -6584,12 +7534,14 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "constantlyOn", genIfCfg.const_on);
 		printf("\t%40s:\t0x%x\n", "pulseFlags", genIfCfg.pulse);
 #if defined(EN_SUPPORT_TOP_INT) && EN_SUPPORT_TOP_INT
-	} else if (xstrncasecmp(argv[0], "gpy2xx_topin_cfg", strlen("gpy2xx_topin_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_topin_cfg: {
 		struct gpy211_extin intTopCfg;
 		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
 
-		cnt += scanParamArg(argc, argv, "intId", sizeof(intTopCfg.id), &intTopCfg.id);
+		/* intId selects the interrupt, the other parameters update its configuration */
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
 		ret = gpy2xx_topin_get(&phy, &intTopCfg);
 
@@ -6598,22 +7550,19 @@ int gpy211_main(int argc, char *argv[])
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "gpioFlags", sizeof(intTopCfg.gpio_flags), &intTopCfg.gpio_flags);
-		cnt += scanParamArg(argc, argv, "ipChar", sizeof(intTopCfg.ip_char), &intTopCfg.ip_char);
-		cnt += scanParamArg(argc, argv, "intMod0", sizeof(intTopCfg.im0), &intTopCfg.im0);
-		cnt += scanParamArg(argc, argv, "intMod1", sizeof(intTopCfg.im1), &intTopCfg.im1);
-		cnt += scanParamArg(argc, argv, "intMod2", sizeof(intTopCfg.im2), &intTopCfg.im2);
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
 		ret = gpy2xx_topin_cfg(&phy, &intTopCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set Global/Top Interrupt configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_topin_get", strlen("gpy2xx_topin_get")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_topin_get: {
 		struct gpy211_extin intTopCfg;
 		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
 
-		cnt += scanParamArg(argc, argv, "intId", sizeof(intTopCfg.id), &intTopCfg.id);
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
 		ret = gpy2xx_topin_get(&phy, &intTopCfg);
 
@@ -6628,15 +7577,13 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "intMod0", intTopCfg.im0);
 		printf("\t%40s:\t0x%x\n", "intMod1", intTopCfg.im1);
 		printf("\t%40s:\t0x%x\n", "intMod2", intTopCfg.im2);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_topin_clr", strlen("gpy2xx_topin_clr")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_topin_clr: {
 		struct gpy211_extin intTopCfg;
 		memset(&intTopCfg, 0, sizeof(struct gpy211_extin));
 
-		cnt += scanParamArg(argc, argv, "intId", sizeof(intTopCfg.id), &intTopCfg.id);
-		cnt += scanParamArg(argc, argv, "intMod0", sizeof(intTopCfg.im0), &intTopCfg.im0);
-		cnt += scanParamArg(argc, argv, "intMod1", sizeof(intTopCfg.im1), &intTopCfg.im1);
-		cnt += scanParamArg(argc, argv, "intMod2", sizeof(intTopCfg.im2), &intTopCfg.im2);
+		cli_parse(cmd, argc, argv, &intTopCfg);
 
 		ret = gpy2xx_topin_clr(&phy, &intTopCfg);
 
@@ -6644,19 +7591,21 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: Clear Global/Top Interrupt status failed.\n");
 
 #endif /* EN_SUPPORT_TOP_INT */
-	} else if (xstrncasecmp(argv[0], "gpy2xx_extin_mask", strlen("gpy2xx_extin_mask")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_extin_mask: {
 		struct gpy211_phy_extin extInterrupt;
 		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
 
-		cnt += scanParamArg(argc, argv, "stdImask", sizeof(extInterrupt.std_imask), &extInterrupt.std_imask);
-		cnt += scanParamArg(argc, argv, "extImask", sizeof(extInterrupt.ext_imask), &extInterrupt.ext_imask);
+		cli_parse(cmd, argc, argv, &extInterrupt);
 
 		ret = gpy2xx_extin_mask(&phy, &extInterrupt);
 
 		if (ret < 0)
 			printf("\nERROR: Set External Interrupt configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_extin_get", strlen("gpy2xx_extin_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_extin_get: {
 		struct gpy211_phy_extin extInterrupt;
 		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
 
@@ -6672,12 +7621,13 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Exntended interrupt mask", extInterrupt.ext_imask);
 		printf("\t%40s:\t0x%x\n", "Exntended interrupt status", extInterrupt.ext_istat);
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[0], "gpy2xx_extin_clr", strlen("gpy2xx_extin_clr")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_extin_clr: {
 		struct gpy211_phy_extin extInterrupt;
 		memset(&extInterrupt, 0, sizeof(struct gpy211_phy_extin));
 
-		cnt += scanParamArg(argc, argv, "stdIstat", sizeof(extInterrupt.std_istat), &extInterrupt.std_istat);
+		cli_parse(cmd, argc, argv, &extInterrupt);
 
 		ret = gpy2xx_extin_clr(&phy, &extInterrupt);
 
@@ -6685,26 +7635,33 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: Clear External Interrupt Status failed.\n");
 
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_test_mode_cfg", strlen("gpy2xx_test_mode_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_test_mode_cfg: {
 		enum gpy211_test_mode testMode;
 
-		cnt += scanParamArg(argc, argv, "testTxMode", sizeof(testMode), &testMode);
+		cli_parse(cmd, argc, argv, &testMode);
 		ret = gpy2xx_test_mode_cfg(&phy, testMode);
 
 		if (ret < 0)
 			printf("\nERROR: Set Test Transmitter mode failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_cdiag_start", strlen("gpy2xx_cdiag_start")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_cdiag_start: {
 		ret = gpy2xx_cdiag_start(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: Set Cable diagnostic (CDIAG) start failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_cdiag_stop", strlen("gpy2xx_cdiag_stop")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_cdiag_stop: {
 		ret = gpy2xx_cdiag_stop(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: Cable diagnostic (CDIAG) test stop failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_cdiag_read", strlen("gpy2xx_cdiag_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_cdiag_read: {
 		u8 pairState, cableLength, validResults;
 		int i = 0;
 		struct gpy211_cdiag_report cdiagReport;
@@ -6745,20 +7702,21 @@ int gpy211_main(int argc, char *argv[])
 
 //#endif
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_abist_start", strlen("gpy2xx_abist_start")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_abist_start: {
 		struct gpy211_abist_param abisTest;
 		memset(&abisTest, 0, sizeof(struct gpy211_abist_param));
 
-		cnt += scanParamArg(argc, argv, "enRestart", sizeof(abisTest.restart), &abisTest.restart);
-		cnt += scanParamArg(argc, argv, "enUartReport", sizeof(abisTest.uart_report), &abisTest.uart_report);
-		cnt += scanParamArg(argc, argv, "txTestMode", sizeof(abisTest.test), &abisTest.test);
+		cli_parse(cmd, argc, argv, &abisTest);
 
 		ret = gpy2xx_abist_start(&phy, &abisTest);
 
 		if (ret < 0)
 			printf("\nERROR: ABIS test start failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_abist_read", strlen("gpy2xx_abist_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_abist_read: {
 		int i = 0, j = 0;
 		struct gpy211_abist_report abistReport;
 		memset(&abistReport, 0, sizeof(struct gpy211_abist_report));
@@ -6842,32 +7800,38 @@ int gpy211_main(int argc, char *argv[])
 			printf("\t%38s:\t0x%x\n", "Harmonics K3", abistReport.pair[i].nohyb_2500bt.k3_mag);
 			printf("\t%38s:\t0x%x\n", "Harmonics K4", abistReport.pair[i].nohyb_2500bt.k4_mag);
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_loopback_cfg", strlen("gpy2xx_loopback_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_loopback_cfg: {
 		enum gpy211_test_loop loopMode;
 
-		cnt += scanParamArg(argc, argv, "loopbackMode", sizeof(loopMode), &loopMode);
+		cli_parse(cmd, argc, argv, &loopMode);
 		ret = gpy2xx_loopback_cfg(&phy, loopMode);
 
 		if (ret < 0)
 			printf("\nERROR: Set Loopback test mode failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_errcnt_cfg", strlen("gpy2xx_errcnt_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_errcnt_cfg: {
 		enum gpy211_errcnt_event cntMode;
 
-		cnt += scanParamArg(argc, argv, "errCountMode", sizeof(cntMode), &cntMode);
+		cli_parse(cmd, argc, argv, &cntMode);
 		ret = gpy2xx_errcnt_cfg(&phy, cntMode);
 
 		if (ret < 0)
 			printf("\nERROR: Set Error or Event count mode failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_errcnt_read", strlen("gpy2xx_errcnt_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_errcnt_read: {
 		ret = gpy2xx_errcnt_read(&phy);
 
 		if (ret >= 0)
 			printf("\nError or Event counter = 0x%x.\n", ret);
 		else
 			printf("\nERROR: Get Error or Event count failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_pcs_status_read", strlen("gpy2xx_pcs_status_read")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_pcs_status_read: {
 		struct gpy211_pcs_status pcsStatus;
 		memset(&pcsStatus, 0, sizeof(struct gpy211_pcs_status));
 
@@ -6884,27 +7848,31 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Reporting high BER status", pcsStatus.high_ber);
 		printf("\t%40s:\t0x%x\n", "Received Block Lock status", pcsStatus.block_lock);
 		printf("\t%40s:\t0x%x\n", "Receive link status", pcsStatus.rcv_link_up);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_adjfreq", strlen("gpy2xx_ptp_adjfreq")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_adjfreq: {
 		s32 pbb = 0;
 
-		cnt += scanParamArg(argc, argv, "pbbTime", sizeof(int), &pbb);
+		cli_parse(cmd, argc, argv, &pbb);
 
 		ret = gpy2xx_ptp_adjfreq(&phy, pbb);
 
 		if (ret < 0)
 			printf("\nERROR: Set PTP Frequency adjusting/modify failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_adjtime", strlen("gpy2xx_ptp_adjtime")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_adjtime: {
 		s64 delta;
 
-		cnt += scanParamArg(argc, argv, "deltaTime", sizeof(delta), &delta);
+		cli_parse(cmd, argc, argv, &delta);
 
 		ret = gpy2xx_ptp_adjtime(&phy, delta);
 
 		if (ret < 0)
 			printf("\nERROR: Adjust PTP System Time failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_gettime", strlen("gpy2xx_ptp_gettime")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_gettime: {
 		struct timespec64 refTime;
 		memset(&refTime, 0, sizeof(struct timespec64));
 
@@ -6920,13 +7888,13 @@ int gpy211_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: Print sys time failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_settime", strlen("gpy2xx_ptp_settime")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_settime: {
 		struct timespec64 ts;
 		memset(&ts, 0, sizeof(struct timespec64));
 
-		cnt += scanParamArg(argc, argv, "initSec", 64, &ts.tv_sec);
-		cnt += scanParamArg(argc, argv, "initNsec", sizeof(ts.tv_nsec), &ts.tv_nsec);
+		cli_parse(cmd, argc, argv, &ts);
 
 		ret = gpy2xx_ptp_settime(&phy, &ts);
 
@@ -6934,38 +7902,37 @@ int gpy211_main(int argc, char *argv[])
 
 		if (ret < 0)
 			printf("\nERROR: Set PTP System Time failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_enable", strlen("gpy2xx_ptp_enable")) == 0) {
-		u16 data;
-		time64_t corr_time;
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_enable: {
+		struct cli_ptp_enable_args a;
 		struct gpy211_ptp_ctrl ptpCfg;
+		memset(&a, 0, sizeof(struct cli_ptp_enable_args));
 		memset(&ptpCfg, 0, sizeof(struct gpy211_ptp_ctrl));
 
-		cnt += scanParamArg(argc, argv, "enPhyTxTs", sizeof(data), &data);
-		ptpCfg.tx_ts_phy = data;
-		cnt += scanParamArg(argc, argv, "enPhyRxTs", sizeof(data), &data);
-		ptpCfg.rx_ts_phy = data;
-		cnt += scanParamArg(argc, argv, "txPtpOffset", sizeof(data), &data);
-		ptpCfg.tx_ptp_off = data;
-		cnt += scanParamArg(argc, argv, "txPtpProto", sizeof(data), &data);
-		ptpCfg.tx_ptp_tpt = data;
-		cnt += scanParamArg(argc, argv, "enTxOstcEn", sizeof(data), &data);
-		ptpCfg.ts_ostc_en = data;
-		cnt += scanParamArg(argc, argv, "txOstCorTime", sizeof(corr_time), &corr_time);
-		ptpCfg.tx_ost_corr = corr_time;
-		cnt += scanParamArg(argc, argv, "auxTrigPort", sizeof(data), &data);
-		ptpCfg.aux_trig_port = data;
+		cli_parse(cmd, argc, argv, &a);
+		ptpCfg.tx_ts_phy = a.enPhyTxTs;
+		ptpCfg.rx_ts_phy = a.enPhyRxTs;
+		ptpCfg.tx_ptp_off = a.txPtpOffset;
+		ptpCfg.tx_ptp_tpt = a.txPtpProto;
+		ptpCfg.ts_ostc_en = a.enTxOstcEn;
+		ptpCfg.tx_ost_corr = a.txOstCorTime;
+		ptpCfg.aux_trig_port = a.auxTrigPort;
 
 		ret = gpy2xx_ptp_enable(&phy, &ptpCfg);
 
 		if (ret < 0)
 			printf("\nERROR: PTP enable failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_disable", strlen("gpy2xx_ptp_disable")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_disable: {
 		ret = gpy2xx_ptp_disable(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: PTP disable failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_getcfg", strlen("gpy2xx_ptp_getcfg")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_getcfg: {
 		struct gpy211_ptp_cfg ptpCfg;
 		memset(&ptpCfg, 0, sizeof(struct gpy211_ptp_cfg));
 
@@ -6997,25 +7964,26 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t%2x%2x%2x%2x%2x%2x%2x%2x%2x%2x\n", "srcPortID", ptpCfg.pto_ctrl.sport_id[0], ptpCfg.pto_ctrl.sport_id[1], ptpCfg.pto_ctrl.sport_id[2], ptpCfg.pto_ctrl.sport_id[3], ptpCfg.pto_ctrl.sport_id[4], ptpCfg.pto_ctrl.sport_id[5], ptpCfg.pto_ctrl.sport_id[6], ptpCfg.pto_ctrl.sport_id[7], ptpCfg.pto_ctrl.sport_id[8], ptpCfg.pto_ctrl.sport_id[9]);
 		printf("\t%40s:\t0x%x\n", "logmLvlLow", ptpCfg.pto_ctrl.logmsg_lvl.raw_logm_lvl_low);
 		printf("\t%40s:\t0x%x\n", "logmLvlHi", ptpCfg.pto_ctrl.logmsg_lvl.raw_logm_lvl_hi);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_set_tsctrl", strlen("gpy2xx_ptp_set_tsctrl")) == 0) {
-		u16 data;
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_set_tsctrl: {
+		struct cli_ptp_tsctrl_args a;
 		struct gpy2xx_ts_ctrl tsCfg;
+		memset(&a, 0, sizeof(struct cli_ptp_tsctrl_args));
 		memset(&tsCfg, 0, sizeof(struct gpy2xx_ts_ctrl));
 
-		cnt += scanParamArg(argc, argv, "enEvntMsg", sizeof(data), &data);
-		tsCfg.ts_evtmsg_en = data;
-		cnt += scanParamArg(argc, argv, "enMstrMsg", sizeof(data), &data);
-		tsCfg.ts_master_en = data;
-		cnt += scanParamArg(argc, argv, "snapType", sizeof(data), &data);
-		tsCfg.snap_type = data;
+		cli_parse(cmd, argc, argv, &a);
+		tsCfg.ts_evtmsg_en = a.enEvntMsg;
+		tsCfg.ts_master_en = a.enMstrMsg;
+		tsCfg.snap_type = a.snapType;
 
 		ret = gpy2xx_ptp_set_tsctrl(&phy, &tsCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set PTP TS configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_set_ppsctrl", strlen("gpy2xx_ptp_set_ppsctrl")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_set_ppsctrl: {
 		struct gpy2xx_pps_ctrl ppsCfg;
 		memset(&ppsCfg, 0, sizeof(struct gpy2xx_pps_ctrl));
 
@@ -7026,19 +7994,15 @@ int gpy211_main(int argc, char *argv[])
 			return ret;
 		}
 
-		cnt += scanParamArg(argc, argv, "ppsCtrlLow", sizeof(ppsCfg.ppsctrl_low.raw_pps_ctrl_low), &ppsCfg.ppsctrl_low.raw_pps_ctrl_low);
-		cnt += scanParamArg(argc, argv, "targetSec", sizeof(ppsCfg.sec_tgttime), &ppsCfg.sec_tgttime);
-		cnt += scanParamArg(argc, argv, "targetNsc", sizeof(ppsCfg.nsec_tgttime), &ppsCfg.nsec_tgttime);
-		cnt += scanParamArg(argc, argv, "ppsInterval", sizeof(ppsCfg.pps0_interal), &ppsCfg.pps0_interal);
-		cnt += scanParamArg(argc, argv, "ppsWidth", sizeof(ppsCfg.pps0_width), &ppsCfg.pps0_width);
-		cnt += scanParamArg(argc, argv, "gpcSel", sizeof(ppsCfg.gpc_sel), &ppsCfg.gpc_sel);
+		cli_parse(cmd, argc, argv, &ppsCfg);
 
 		ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppsCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Set PPS configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "test_gpy2xx_ptp_set_ppsctrl", strlen("test_gpy2xx_ptp_set_ppsctrl")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_test_gpy2xx_ptp_set_ppsctrl: {
 		struct gpy2xx_pps_ctrl ppsCfg;
 		memset(&ppsCfg, 0, sizeof(struct gpy2xx_pps_ctrl));
 		struct timespec64 refTime;
@@ -7061,20 +8025,18 @@ int gpy211_main(int argc, char *argv[])
 		ppsCfg.sec_tgttime = refTime.tv_sec + 25;
 		ppsCfg.nsec_tgttime = 0x0; //refTime.tv_nsec;
 		printf("\n\t%s: %x, \t%x\n", "Set time sec n nsec", ppsCfg.sec_tgttime, ppsCfg.nsec_tgttime);
-		cnt += scanParamArg(argc, argv, "gpcSel", sizeof(ppsCfg.gpc_sel), &ppsCfg.gpc_sel);
+		cli_parse(cmd, argc, argv, &ppsCfg);
 		ret = gpy2xx_ptp_set_ppsctrl(&phy, &ppsCfg);
 
 		if (ret < 0)
 			printf("\nERROR: Test PPS configuration feature failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_set_ptoctrl", strlen("gpy2xx_ptp_set_ptoctrl")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_set_ptoctrl: {
 		struct gpy2xx_pto_ctrl ptoCfg;
 		memset(&ptoCfg, 0, sizeof(struct gpy2xx_pto_ctrl));
 
-		cnt += scanParamArg(argc, argv, "ptoCtrlLow", sizeof(ptoCfg.ptoctrl_low.raw_pto_ctrl_low), &ptoCfg.ptoctrl_low.raw_pto_ctrl_low);
-		cnt += scanKey_Arg(argc, argv, "srcPortID", 10, (char *)ptoCfg.sport_id);
-		cnt += scanParamArg(argc, argv, "logmLvlLow", sizeof(ptoCfg.logmsg_lvl.raw_logm_lvl_low), &ptoCfg.logmsg_lvl.raw_logm_lvl_low);
-		cnt += scanParamArg(argc, argv, "logmLvlHi", sizeof(ptoCfg.logmsg_lvl.raw_logm_lvl_hi), &ptoCfg.logmsg_lvl.raw_logm_lvl_hi);
+		cli_parse(cmd, argc, argv, &ptoCfg);
 
 		ret = gpy2xx_ptp_set_ptoctrl(&phy, &ptoCfg);
 
@@ -7082,7 +8044,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: Set PTO configuration failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_fifostat", strlen("gpy2xx_ptp_fifostat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_fifostat: {
 		struct gpy211_ts_fifo_stat fifoStatus;
 		memset(&fifoStatus, 0, sizeof(struct gpy211_ts_fifo_stat));
 
@@ -7099,14 +8063,18 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "txFillLevel", fifoStatus.tx_fill_lvl);
 		printf("\t%40s:\t0x%x\n", "txOverflow", fifoStatus.tx_ovfl);
 		printf("\t%40s:\t0x%x\n", "txUnderflow", fifoStatus.tx_udfl);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_resetfifo", strlen("gpy2xx_ptp_resetfifo")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_resetfifo: {
 		ret = gpy2xx_ptp_resetfifo(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: TS's FIFO reset failed.\n");
 
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_txtsstat", strlen("gpy2xx_ptp_txtsstat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_txtsstat: {
 		struct gpy211_ts_stat tsStatus;
 		memset(&tsStatus, 0, sizeof(struct gpy211_ts_stat));
 
@@ -7122,7 +8090,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%I64x\n", "Tx TS (in nsec)", (u64)(tsStatus.txts_stat.txtss_sec * 0x3B9ACA00 + tsStatus.txts_stat.txtss_nsec));
 		printf("\t%40s:\t0x%x\n", "Tx TS Stat missed", tsStatus.txts_stat.txtss_mis);
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_getrxts", strlen("gpy2xx_ptp_getrxts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_getrxts: {
 		struct gpy211_rx_ts rxTs;
 		memset(&rxTs, 0, sizeof(struct gpy211_rx_ts));
 
@@ -7136,14 +8106,14 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%s:\t0x%I64x\n", "PTP Receive Packet TimeStamp status", rxTs.rx_ts_stat);
 		print_sys_time(rxTs.rx_ts_stat / 1000000000ULL, rxTs.rx_ts_stat % 1000000000ULL);
 		printf("\t%s:\t0x%x\n", "PTP Receive Packet CRC ", rxTs.rx_crc_stat);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_aux_cfg", strlen("gpy2xx_ptp_aux_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_aux_cfg: {
 		struct gpy211_aux_cfg aux_cfg;
 		memset(&aux_cfg, 0, sizeof(struct gpy211_aux_cfg));
 
 
-		cnt += scanParamArg(argc, argv, "enAux", sizeof(aux_cfg.aux_enable), &aux_cfg.aux_enable);
-		cnt += scanParamArg(argc, argv, "auxTrigPort", sizeof(aux_cfg.aux_trigger_port), &aux_cfg.aux_trigger_port);
+		cli_parse(cmd, argc, argv, &aux_cfg);
 
 		ret = gpy2xx_ptp_aux_cfg(&phy, &aux_cfg);
 
@@ -7151,7 +8121,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: Configure Auxiliary timestamp feature failed.\n");
 			return ret;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_gettxts", strlen("gpy2xx_ptp_gettxts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_gettxts: {
 		struct gpy211_tx_ts txTs;
 		memset(&txTs, 0, sizeof(struct gpy211_tx_ts));
 
@@ -7165,7 +8137,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%s:\t0x%I64x\n", "PTP Trasmit Packet TimeStamp status", txTs.tx_ts_stat);
 		print_sys_time(txTs.tx_ts_stat / 1000000000ULL, txTs.tx_ts_stat % 1000000000ULL);
 		printf("\t%s:\t0x%x\n", "PTP Trasmit Packet CRC ", txTs.tx_crc_stat);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_getauxts", strlen("gpy2xx_ptp_getauxts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_getauxts: {
 		struct timespec64 ts;
 		memset(&ts, 0, sizeof(struct timespec64));
 
@@ -7179,7 +8153,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%s:\t0x%I64x\n", "Auxiliary TimeStamp Second ", ts.tv_sec);
 		printf("\t%s:\t0x%ld\n", "Auxiliary TimeStamp nanosecond ", ts.tv_nsec);
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_auxfifostat", strlen("gpy2xx_ptp_auxfifostat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_auxfifostat: {
 		struct gpy211_aux_fifo_stat aux_fifo_sts;
 		memset(&aux_fifo_sts, 0, sizeof(struct gpy211_aux_fifo_stat));
 
@@ -7193,7 +8169,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%s:\t0x%s\n", "Timestamp Seconds ", (aux_fifo_sts.ovfl > 0 ? "Overflow" : "Normal"));
 		printf("\t%s:\t0x%x\n", "Number of Auxiliary Timestamp Snapshots is ", aux_fifo_sts.fill_lvl);
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ptp_resetauxfifo", strlen("gpy2xx_ptp_resetauxfifo")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ptp_resetauxfifo: {
 
 		ret = gpy2xx_ptp_resetauxfifo(&phy);
 
@@ -7201,16 +8179,13 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR:  Reset Auxiliary TimeStamp FIFO status failed.\n");
 			return ret;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_synce_cfg", strlen("gpy2xx_synce_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_synce_cfg: {
 		struct gpy211_synce synceCfg;
 		memset(&synceCfg, 0, sizeof(struct gpy211_synce));
 
-		cnt += scanParamArg(argc, argv, "enSyncE", sizeof(synceCfg.synce_enable), &synceCfg.synce_enable);
-		cnt += scanParamArg(argc, argv, "synceRefClk", sizeof(synceCfg.synce_refclk), &synceCfg.synce_refclk);
-		cnt += scanParamArg(argc, argv, "masterSlave", sizeof(synceCfg.master_sel), &synceCfg.master_sel);
-		cnt += scanParamArg(argc, argv, "dataRate", sizeof(synceCfg.data_rate), &synceCfg.data_rate);
-		cnt += scanParamArg(argc, argv, "gpcSel", sizeof(synceCfg.gpc_sel), &synceCfg.gpc_sel);
+		cli_parse(cmd, argc, argv, &synceCfg);
 
 
 		ret = gpy2xx_synce_cfg(&phy, &synceCfg);
@@ -7219,7 +8194,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: Set SyncE configuration failed.\n");
 			return ret;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_synce_get", strlen("gpy2xx_synce_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_synce_get: {
 		struct gpy211_synce synceCfg;
 		memset(&synceCfg, 0, sizeof(struct gpy211_synce));
 
@@ -7235,20 +8212,21 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "masterSlave", synceCfg.master_sel);
 		printf("\t%40s:\t0x%x\n", "dataRate", synceCfg.data_rate);
 		printf("\t%40s:\t0x%x\n", "gpcSel", synceCfg.gpc_sel);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_wol_cfg", strlen("gpy2xx_wol_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_wol_cfg: {
 		struct gpy211_wolinfo wolInfo;
 		memset(&wolInfo, 0, sizeof(struct gpy211_wolinfo));
 
-		cnt += scanParamArg(argc, argv, "wolOptions", sizeof(wolInfo.wolopts), &wolInfo.wolopts);
-		cnt += scanMAC_Arg(argc, argv, "wolMAC", wolInfo.mac);
-		cnt += scanMAC_Arg(argc, argv, "wolPassword", wolInfo.sopass);
+		cli_parse(cmd, argc, argv, &wolInfo);
 
 		ret = gpy2xx_wol_cfg(&phy, &wolInfo);
 
 		if (ret < 0)
 			printf("\nERROR: Set WOL configuration failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_wol_get", strlen("gpy2xx_wol_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_wol_get: {
 		struct gpy211_wolinfo wolInfo;
 		memset(&wolInfo, 0, sizeof(struct gpy211_wolinfo));
 
@@ -7268,31 +8246,21 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%s:\t", "WOL device SecureOn password");
 		printMAC_Address(wolInfo.sopass);
 		printf("\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ads_cfg", strlen("gpy2xx_ads_cfg")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ads_cfg: {
 		struct gpy211_ads_ctrl ads;
 		memset(&ads, 0, sizeof(struct gpy211_ads_ctrl));
 
-		if (scanParamArg(argc, argv, "advertise_enable", sizeof(ads.no_nrg_rst), &ads.no_nrg_rst) == 0)
-			ads.no_nrg_rst = 0;
-
-		if (scanParamArg(argc, argv, "NBaseT_ds_enable", sizeof(ads.downshift_en), &ads.downshift_en) == 0)
-			ads.downshift_en = 0;
-
-
-		if (scanParamArg(argc, argv, "downshift_cnt_thr", sizeof(ads.downshift_thr), &ads.downshift_thr) == 0)
-			ads.downshift_thr = 0;
-
-		if (scanParamArg(argc, argv, "force_reset", sizeof(ads.force_rst), &ads.force_rst) == 0)
-			ads.force_rst = 0;
-
-		if (scanParamArg(argc, argv, "rst_cntdown_timer", sizeof(ads.nrg_rst_cnt), &ads.nrg_rst_cnt) == 0)
-			ads.nrg_rst_cnt = 0;
+		cli_parse(cmd, argc, argv, &ads);
 
 		ret = gpy2xx_ads_cfg(&phy, &ads);
 
 		if (ret < 0)
 			printf("\nERROR: Set Link's Auto Down Speed (ADS) mode failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ads_get", strlen("gpy2xx_ads_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ads_get: {
 		struct gpy211_ads_sta ads;
 		memset(&ads, 0, sizeof(struct gpy211_ads_sta));
 
@@ -7314,21 +8282,21 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "ADS Training attempt counter = ", ads.downshift_cnt);
 		printf("\t%40s:\t0x%x\n", "ADS Downshift from 2G5 to lower speed = ", ads.downshift_2G5);
 		printf("\t%40s:\t0x%x\n", "ADS Downshift from 1G to lower speed = ", ads.downshift_1G);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ulp_cfg", strlen("gpy2xx_ulp_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_ulp_cfg: {
 		struct gpy211_ulp_ctrl ulp;
 		memset(&ulp, 0, sizeof(struct gpy211_ulp_ctrl));
 
-		cnt += scanParamArg(argc, argv, "ulp_enable", sizeof(ulp.ulp_en), &ulp.ulp_en);
-		cnt += scanParamArg(argc, argv, "ulp_sta_block", sizeof(ulp.ulp_sta_block), &ulp.ulp_sta_block);
-		cnt += scanParamArg(argc, argv, "ulp_exit", sizeof(ulp.ulp_exit), &ulp.ulp_exit);
-		cnt += scanParamArg(argc, argv, "master_slice", sizeof(ulp.master_slice), &ulp.master_slice);
+		cli_parse(cmd, argc, argv, &ulp);
 
 		ret = gpy2xx_ulp_cfg(&phy, &ulp);
 
 		if (ret < 0)
 			printf("\nERROR: Set ULP mode failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ulp_get", strlen("gpy2xx_ulp_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ulp_get: {
 		struct gpy211_ulp_ctrl ulp;
 		memset(&ulp, 0, sizeof(struct gpy211_ulp_ctrl));
 
@@ -7341,7 +8309,9 @@ int gpy211_main(int argc, char *argv[])
 
 		printf("\t%40s:\t%s\n", "ULP enable = ", ((ulp.ulp_en == 0) ? "Disable" : "Enable"));
 		printf("\t%40s:\t%s\n", "ULP station block = ", ((ulp.ulp_sta_block == 0) ? "Disable" : "Enable"));
-	} else if (xstrncasecmp(argv[0], "gpy2xx_ads_detected", strlen("gpy2xx_ads_detected")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_ads_detected: {
 		ret = gpy2xx_ads_detected(&phy);
 
 		if (ret == 1)
@@ -7351,14 +8321,18 @@ int gpy211_main(int argc, char *argv[])
 		else
 			printf("\nERROR: Link ADS detected state get failed.\n");
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_sgmii_restart_aneg", strlen("gpy2xx_sgmii_restart_aneg")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_restart_aneg: {
 		int ret;
 
 		ret = gpy2xx_sgmii_restart_aneg(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: Restarting SGMII Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_sgmii_aneg_done", strlen("gpy2xx_sgmii_aneg_done")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_aneg_done: {
 		ret = gpy2xx_sgmii_aneg_done(&phy);
 
 		if (ret == 0)
@@ -7367,37 +8341,22 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nSGMII Auto-Negotiation completed.\n");
 		else
 			printf("\nERROR: SGMII Auto-Negotiation polling failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_sgmii_config_aneg", strlen("gpy2xx_sgmii_config_aneg")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_config_aneg: {
 		//char buf[256];
 		struct gpy211_sgmii sgmiiConfig;
 		memset(&sgmiiConfig, 0, sizeof(struct gpy211_sgmii));
 
-		if (scanParamArg(argc, argv, "linkcfg_dir", sizeof(sgmiiConfig.linkcfg_dir), &sgmiiConfig.linkcfg_dir) == 0)
-			sgmiiConfig.linkcfg_dir = 1;
-
-		if (scanParamArg(argc, argv, "aneg_mode", sizeof(sgmiiConfig.aneg_mode), &sgmiiConfig.aneg_mode) == 0)
-			sgmiiConfig.aneg_mode = 1;
-
-		if (scanParamArg(argc, argv, "eee_enable", sizeof(sgmiiConfig.eee_enable), &sgmiiConfig.eee_enable) == 0)
-			sgmiiConfig.eee_enable = 1;
-
-		if (scanParamArg(argc, argv, "autoneg", sizeof(sgmiiConfig.link.autoneg), &sgmiiConfig.link.autoneg) == 0)
-			sgmiiConfig.link.autoneg = 1;
-
-		if (scanParamArg(argc, argv, "speed", sizeof(sgmiiConfig.link.speed), &sgmiiConfig.link.speed) == 0)
-			sgmiiConfig.link.speed = SPEED_2500;
-
-		if (scanParamArg(argc, argv, "fixed2G5", sizeof(sgmiiConfig.link.fixed2g5), &sgmiiConfig.link.fixed2g5) == 0)
-			sgmiiConfig.link.fixed2g5 = 0;
-
-		if (scanParamArg(argc, argv, "duplex", sizeof(sgmiiConfig.link.duplex), &sgmiiConfig.link.duplex) == 0)
-			sgmiiConfig.link.duplex = DUPLEX_FULL;
+		cli_parse(cmd, argc, argv, &sgmiiConfig);
 
 		ret = gpy2xx_sgmii_config_aneg(&phy, &sgmiiConfig);
 
 		if (ret < 0)
 			printf("\nERROR: Configuring SGMII Auto-Negotiation failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_sgmii_read_status", strlen("gpy2xx_sgmii_read_status")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_read_status: {
 		char buf[256];
 		struct gpy211_sgmii sgmiiConfig;
 		memset(&sgmiiConfig, 0, sizeof(struct gpy211_sgmii));
@@ -7422,16 +8381,19 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t%s\n", "Most recently read link state", sgmiiConfig.link.link ? "Up" : "Down");
 		print_advert(buf, sizeof(buf), sgmiiConfig.link.supported);
 		printf("\t%40s:\t0x%I64x (%s)\n", "GPHY supported modes", sgmiiConfig.link.supported, buf);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_sgmii_opmode", strlen("gpy2xx_sgmii_opmode")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_sgmii_opmode: {
 		enum gpy211_sgmii_operation opMode = 0;
 
-		cnt += scanParamArg(argc, argv, "opMode", sizeof(opMode), &opMode);
+		cli_parse(cmd, argc, argv, &opMode);
 		ret = gpy2xx_sgmii_opmode(&phy, opMode);
 
 		if (ret < 0)
 			printf("\nERROR: Set SGMII operation mode failed.\n");
-	} else if (xstrncasecmp(argv[0], "gpy2xx_pvt_get", strlen("gpy2xx_pvt_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_pvt_get: {
 		struct gpy211_pvt sensInfo;
 
 		memset(&sensInfo, 0, sizeof(struct gpy211_pvt));
@@ -7442,22 +8404,22 @@ int gpy211_main(int argc, char *argv[])
 
 		printf("\t%s:\t%d\n", "Sensor temparature", sensInfo.temperature);
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacx_pm_hw_reset", strlen("gpy2xx_gmacx_pm_hw_reset")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_pm_hw_reset: {
 		ret = gpy2xx_gmacx_pm_hw_reset(&phy);
 
 		if (ret < 0)
 			printf("\nERROR: PM level HW reset failed.\n");
 
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_macsec_enable", strlen("gpy2xx_macsec_enable")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_macsec_enable: {
 		struct gpy211_macsec msec_cfg;
 		memset(&msec_cfg, 0, sizeof(struct gpy211_macsec));
 
-		cnt += scanParamArg(argc, argv, "dropCrc", sizeof(msec_cfg.drop_on_crc_err), &msec_cfg.drop_on_crc_err);
-		cnt += scanParamArg(argc, argv, "dropPerr", sizeof(msec_cfg.drop_on_pkt_err), &msec_cfg.drop_on_pkt_err);
-		cnt += scanParamArg(argc, argv, "dropSfail", sizeof(msec_cfg.drop_on_sec_fail), &msec_cfg.drop_on_sec_fail);
-		cnt += scanParamArg(argc, argv, "dropClass", sizeof(msec_cfg.class_drop), &msec_cfg.class_drop);
+		cli_parse(cmd, argc, argv, &msec_cfg);
 
 		ret = gpy2xx_macsec_enable(&phy, &msec_cfg);
 
@@ -7465,15 +8427,18 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: MACsec enable failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_macsec_disable", strlen("gpy2xx_macsec_disable")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_macsec_disable: {
 		ret = gpy2xx_macsec_disable(&phy);
 
 		if (ret < 0) {
 			printf("\nERROR: MACsec disable set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacx_pm_pdi_cfg", strlen("gpy2xx_gmacx_pm_pdi_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_pm_pdi_cfg: {
 		struct pm_config pm_cfg;
 		memset(&pm_cfg, 0, sizeof(struct pm_config));
 
@@ -7484,14 +8449,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "bpMac", sizeof(pm_cfg.bypass_gmac), &pm_cfg.bypass_gmac);
-		cnt += scanParamArg(argc, argv, "bpMsec", sizeof(pm_cfg.bypass_macsec), &pm_cfg.bypass_macsec);
-		cnt += scanParamArg(argc, argv, "dropCrc", sizeof(pm_cfg.drop_on_crc_err), &pm_cfg.drop_on_crc_err);
-		cnt += scanParamArg(argc, argv, "dropPerr", sizeof(pm_cfg.drop_on_pkt_err), &pm_cfg.drop_on_pkt_err);
-		cnt += scanParamArg(argc, argv, "dropSfail", sizeof(pm_cfg.drop_on_sec_fail), &pm_cfg.drop_on_sec_fail);
-		cnt += scanParamArg(argc, argv, "dropClass", sizeof(pm_cfg.class_drop), &pm_cfg.class_drop);
-		cnt += scanParamArg(argc, argv, "cust3gEn", sizeof(pm_cfg.cust_3g_en), &pm_cfg.cust_3g_en);
-		cnt += scanParamArg(argc, argv, "sgmiiLb", sizeof(pm_cfg.sgmii_lb_en), &pm_cfg.sgmii_lb_en);
+		cli_parse(cmd, argc, argv, &pm_cfg);
 
 		ret = gpy2xx_gmacx_pm_pdi_cfg(&phy, &pm_cfg);
 
@@ -7499,7 +8457,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full MAC cfg info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacx_pm_pdi_get", strlen("gpy2xx_gmacx_pm_pdi_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_pm_pdi_get: {
 		struct pm_config pm_cfg;
 		memset(&pm_cfg, 0, sizeof(struct pm_config));
 
@@ -7518,8 +8478,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Classification Drop pkts", pm_cfg.class_drop);
 		printf("\t%40s:\t0x%x\n", "Custom3G Speed enable", pm_cfg.cust_3g_en);
 		printf("\t%40s:\t0x%x\n", "SGMII Loopback enable", pm_cfg.sgmii_lb_en);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_pm_cfg", strlen("gpy2xx_gmacf_pm_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pm_cfg: {
 		struct pm_gmac_cfg gmac_ctrl;
 		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
@@ -7530,9 +8491,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "crcPad", sizeof(gmac_ctrl.crc_pad_ctrl), &gmac_ctrl.crc_pad_ctrl);
-		cnt += scanParamArg(argc, argv, "txErr", sizeof(gmac_ctrl.tx_err_input), &gmac_ctrl.tx_err_input);
-		cnt += scanParamArg(argc, argv, "bigEndian", sizeof(gmac_ctrl.big_endian), &gmac_ctrl.big_endian);
+		cli_parse(cmd, argc, argv, &gmac_ctrl);
 
 		ret = gpy2xx_gmacf_pm_cfg(&phy, &gmac_ctrl);
 
@@ -7540,7 +8499,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM GMAC-Full info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_pm_get", strlen("gpy2xx_gmacf_pm_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pm_get: {
 		struct pm_gmac_cfg gmac_ctrl;
 		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
@@ -7554,8 +8515,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "GMAC CRC and Pad Control", gmac_ctrl.crc_pad_ctrl);
 		printf("\t%40s:\t0x%x\n", "GMAC Tx Error Input", gmac_ctrl.tx_err_input);
 		printf("\t%40s:\t0x%x\n", "Data Endianness", gmac_ctrl.big_endian);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pm_cfg", strlen("gpy2xx_gmacl_pm_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pm_cfg: {
 		struct pm_gmac_cfg gmac_ctrl;
 		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
@@ -7566,9 +8528,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "crcPad", sizeof(gmac_ctrl.crc_pad_ctrl), &gmac_ctrl.crc_pad_ctrl);
-		cnt += scanParamArg(argc, argv, "txErr", sizeof(gmac_ctrl.tx_err_input), &gmac_ctrl.tx_err_input);
-		cnt += scanParamArg(argc, argv, "bigEndian", sizeof(gmac_ctrl.big_endian), &gmac_ctrl.big_endian);
+		cli_parse(cmd, argc, argv, &gmac_ctrl);
 
 		ret = gpy2xx_gmacl_pm_cfg(&phy, &gmac_ctrl);
 
@@ -7576,7 +8536,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM GMAC-Full info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pm_get", strlen("gpy2xx_gmacl_pm_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pm_get: {
 		struct pm_gmac_cfg gmac_ctrl;
 		memset(&gmac_ctrl, 0, sizeof(struct pm_gmac_cfg));
 
@@ -7591,8 +8553,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "GMAC Tx Error Input", gmac_ctrl.tx_err_input);
 		printf("\t%40s:\t0x%x\n", "Data Endianness", gmac_ctrl.big_endian);
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_cfg", strlen("gpy2xx_gmacf_lpi_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_cfg: {
 		struct lpi_cfg lpi_ctrl;
 		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
@@ -7603,16 +8566,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "lpintEn", sizeof(lpi_ctrl.lpi_int_en), &lpi_ctrl.lpi_int_en);
-		cnt += scanParamArg(argc, argv, "lpiEn", sizeof(lpi_ctrl.lpi_en), &lpi_ctrl.lpi_en);
-		cnt += scanParamArg(argc, argv, "linkUp", sizeof(lpi_ctrl.phy_link_status), &lpi_ctrl.phy_link_status);
-		cnt += scanParamArg(argc, argv, "txautoEn", sizeof(lpi_ctrl.lpi_tx_auto), &lpi_ctrl.lpi_tx_auto);
-		cnt += scanParamArg(argc, argv, "timerEn", sizeof(lpi_ctrl.lpi_timer_en), &lpi_ctrl.lpi_timer_en);
-		cnt += scanParamArg(argc, argv, "clkStop", sizeof(lpi_ctrl.lpi_tx_clk_stop_en), &lpi_ctrl.lpi_tx_clk_stop_en);
-		cnt += scanParamArg(argc, argv, "ticTime", sizeof(lpi_ctrl.ous_tic_time), &lpi_ctrl.ous_tic_time);
-		cnt += scanParamArg(argc, argv, "twTime", sizeof(lpi_ctrl.lpi_tw_time), &lpi_ctrl.lpi_tw_time);
-		cnt += scanParamArg(argc, argv, "lsTime", sizeof(lpi_ctrl.lpi_ls_time), &lpi_ctrl.lpi_ls_time);
-		cnt += scanParamArg(argc, argv, "entryTime", sizeof(lpi_ctrl.lpi_entry_time), &lpi_ctrl.lpi_entry_time);
+		cli_parse(cmd, argc, argv, &lpi_ctrl);
 
 		ret = gpy2xx_gmacf_lpi_cfg(&phy, &lpi_ctrl);
 
@@ -7620,7 +8574,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM GMAC-Full LPI info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_get", strlen("gpy2xx_gmacf_lpi_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_get: {
 		struct lpi_cfg lpi_ctrl;
 		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
@@ -7641,8 +8597,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "LPI TW Timer (in milliseconds)", lpi_ctrl.lpi_tw_time);
 		printf("\t%40s:\t0x%x\n", "LPI LS Timer (in milliseconds)", lpi_ctrl.lpi_ls_time);
 		printf("\t%40s:\t0x%x\n", "LPI Entry Timer (in milliseconds)", lpi_ctrl.lpi_entry_time);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_lpi_cfg", strlen("gpy2xx_gmacl_lpi_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_lpi_cfg: {
 		struct lpi_cfg lpi_ctrl;
 		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
@@ -7653,16 +8610,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "lpintEn", sizeof(lpi_ctrl.lpi_int_en), &lpi_ctrl.lpi_int_en);
-		cnt += scanParamArg(argc, argv, "lpiEn", sizeof(lpi_ctrl.lpi_en), &lpi_ctrl.lpi_en);
-		cnt += scanParamArg(argc, argv, "linkUp", sizeof(lpi_ctrl.phy_link_status), &lpi_ctrl.phy_link_status);
-		cnt += scanParamArg(argc, argv, "txautoEn", sizeof(lpi_ctrl.lpi_tx_auto), &lpi_ctrl.lpi_tx_auto);
-		cnt += scanParamArg(argc, argv, "timerEn", sizeof(lpi_ctrl.lpi_timer_en), &lpi_ctrl.lpi_timer_en);
-		cnt += scanParamArg(argc, argv, "clkStop", sizeof(lpi_ctrl.lpi_tx_clk_stop_en), &lpi_ctrl.lpi_tx_clk_stop_en);
-		cnt += scanParamArg(argc, argv, "ticTime", sizeof(lpi_ctrl.ous_tic_time), &lpi_ctrl.ous_tic_time);
-		cnt += scanParamArg(argc, argv, "twTime", sizeof(lpi_ctrl.lpi_tw_time), &lpi_ctrl.lpi_tw_time);
-		cnt += scanParamArg(argc, argv, "lsTime", sizeof(lpi_ctrl.lpi_ls_time), &lpi_ctrl.lpi_ls_time);
-		cnt += scanParamArg(argc, argv, "entryTime", sizeof(lpi_ctrl.lpi_entry_time), &lpi_ctrl.lpi_entry_time);
+		cli_parse(cmd, argc, argv, &lpi_ctrl);
 
 		ret = gpy2xx_gmacl_lpi_cfg(&phy, &lpi_ctrl);
 
@@ -7670,7 +8618,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM GMAC-Lite LPI info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_lpi_get", strlen("gpy2xx_gmacl_lpi_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_lpi_get: {
 		struct lpi_cfg lpi_ctrl;
 		memset(&lpi_ctrl, 0, sizeof(struct lpi_cfg));
 
@@ -7691,7 +8641,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "LPI TW Timer (in milliseconds)", lpi_ctrl.lpi_tw_time);
 		printf("\t%40s:\t0x%x\n", "LPI LS Timer (in milliseconds)", lpi_ctrl.lpi_ls_time);
 		printf("\t%40s:\t0x%x\n", "LPI Entry Timer (in milliseconds)", lpi_ctrl.lpi_entry_time);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_stat_get", strlen("gpy2xx_gmacf_lpi_stat_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_stat_get: {
 		struct lpi_status lpi_stat;
 		memset(&lpi_stat, 0, sizeof(struct lpi_status));
 
@@ -7710,7 +8662,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Tx LPI State", lpi_stat.tx_lpi_state);
 		printf("\t%40s:\t0x%x\n", "Rx LPI State", lpi_stat.rx_lpi_state);
 		printf("\t%40s:\t0x%x\n", "GMAC-Full's LPI state", lpi_stat.full_lpi_status);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_lpi_stat_get", strlen("gpy2xx_gmacl_lpi_stat_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_lpi_stat_get: {
 		struct lpi_status lpi_stat;
 		memset(&lpi_stat, 0, sizeof(struct lpi_status));
 
@@ -7729,8 +8683,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Tx LPI State", lpi_stat.tx_lpi_state);
 		printf("\t%40s:\t0x%x\n", "Rx LPI State", lpi_stat.rx_lpi_state);
 		printf("\t%40s:\t0x%x\n", "GMAC-Lite's LPI state", lpi_stat.lite_lpi_status);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_imask_cfg", strlen("gpy2xx_gmacf_lpi_imask_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_imask_cfg: {
 		struct lpi_int_mask lpi_imask;
 		memset(&lpi_imask, 0, sizeof(struct lpi_int_mask));
 
@@ -7741,10 +8696,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "rxUsc", sizeof(lpi_imask.rx_lpi_usc_im), &lpi_imask.rx_lpi_usc_im);
-		cnt += scanParamArg(argc, argv, "rxTrc", sizeof(lpi_imask.rx_lpi_tc_im), &lpi_imask.rx_lpi_tc_im);
-		cnt += scanParamArg(argc, argv, "txUsc", sizeof(lpi_imask.tx_lpi_usc_im), &lpi_imask.tx_lpi_usc_im);
-		cnt += scanParamArg(argc, argv, "txTrc", sizeof(lpi_imask.tx_lpi_tc_im), &lpi_imask.tx_lpi_tc_im);
+		cli_parse(cmd, argc, argv, &lpi_imask);
 
 		ret = gpy2xx_gmacf_lpi_imask_cfg(&phy, &lpi_imask);
 
@@ -7752,7 +8704,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full LPI interrupt mask set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_imask_get", strlen("gpy2xx_gmacf_lpi_imask_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_imask_get: {
 		struct lpi_int_mask lpi_imask;
 		memset(&lpi_imask, 0, sizeof(struct lpi_int_mask));
 
@@ -7767,7 +8721,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Rx LPI transition counter interrupt mask", lpi_imask.rx_lpi_tc_im);
 		printf("\t%40s:\t0x%x\n", "Tx LPI microsecond counter interrupt mask", lpi_imask.tx_lpi_usc_im);
 		printf("\t%40s:\t0x%x\n", "Tx LPI transition counter interrupt mask", lpi_imask.tx_lpi_tc_im);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_istat_get", strlen("gpy2xx_gmacf_lpi_istat_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_istat_get: {
 		struct lpi_int_status lpi_istat;
 		memset(&lpi_istat, 0, sizeof(struct lpi_int_status));
 
@@ -7782,7 +8738,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Rx LPI transition counter interrupt status", lpi_istat.rx_lpi_tc_is);
 		printf("\t%40s:\t0x%x\n", "Tx LPI microsecond counter interrupt status", lpi_istat.tx_lpi_usc_is);
 		printf("\t%40s:\t0x%x\n", "Tx LPI transition counter interrupt status", lpi_istat.tx_lpi_tc_is);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_lpi_count_get", strlen("gpy2xx_gmacf_lpi_count_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_lpi_count_get: {
 		struct lpi_counters lpi_cntr;
 		memset(&lpi_cntr, 0, sizeof(struct lpi_counters));
 
@@ -7797,8 +8755,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Tx LPI Transition Counters", lpi_cntr.tx_lpi_usc);
 		printf("\t%40s:\t0x%x\n", "Rx LPI Microseconds Counter", lpi_cntr.rx_lpi_usc);
 		printf("\t%40s:\t0x%x\n", "Rx LPI Transition Counter", lpi_cntr.rx_lpi_trc);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_cfg", strlen("gpy2xx_gmacf_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_cfg: {
 		struct gmac_cfg mac_cfg;
 		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
@@ -7809,13 +8768,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "reEn", sizeof(mac_cfg.re_en), &mac_cfg.re_en);
-		cnt += scanParamArg(argc, argv, "teEn", sizeof(mac_cfg.te_en), &mac_cfg.te_en);
-		cnt += scanParamArg(argc, argv, "preambLen", sizeof(mac_cfg.preamble_len), &mac_cfg.preamble_len);
-		cnt += scanParamArg(argc, argv, "lbmEn", sizeof(mac_cfg.loopback_en), &mac_cfg.loopback_en);
-		cnt += scanParamArg(argc, argv, "fdupEn", sizeof(mac_cfg.fulldup_en), &mac_cfg.fulldup_en);
-		cnt += scanParamArg(argc, argv, "macSpeed", sizeof(mac_cfg.mac_speed), &mac_cfg.mac_speed);
-		cnt += scanParamArg(argc, argv, "rcWrite1", sizeof(mac_cfg.rc_write1_en), &mac_cfg.rc_write1_en);
+		cli_parse(cmd, argc, argv, &mac_cfg);
 
 		ret = gpy2xx_gmacf_cfg(&phy, &mac_cfg);
 
@@ -7823,7 +8776,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full MAC cfg info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_get", strlen("gpy2xx_gmacf_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_get: {
 		struct gmac_cfg mac_cfg;
 		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
@@ -7841,8 +8796,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Full-duplex Enable", mac_cfg.fulldup_en);
 		printf("\t%40s:\t0x%x\n", "MAC speed", mac_cfg.mac_speed);
 		printf("\t%40s:\t0x%x\n", "Register Clear on Write 1 Enable", mac_cfg.rc_write1_en);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_cfg", strlen("gpy2xx_gmacl_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_cfg: {
 		struct gmac_cfg mac_cfg;
 		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
@@ -7853,13 +8809,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "reEn", sizeof(mac_cfg.re_en), &mac_cfg.re_en);
-		cnt += scanParamArg(argc, argv, "teEn", sizeof(mac_cfg.te_en), &mac_cfg.te_en);
-		cnt += scanParamArg(argc, argv, "preambLen", sizeof(mac_cfg.preamble_len), &mac_cfg.preamble_len);
-		cnt += scanParamArg(argc, argv, "lbmEn", sizeof(mac_cfg.loopback_en), &mac_cfg.loopback_en);
-		cnt += scanParamArg(argc, argv, "fdupEn", sizeof(mac_cfg.fulldup_en), &mac_cfg.fulldup_en);
-		cnt += scanParamArg(argc, argv, "macSpeed", sizeof(mac_cfg.mac_speed), &mac_cfg.mac_speed);
-		cnt += scanParamArg(argc, argv, "rcWrite1", sizeof(mac_cfg.rc_write1_en), &mac_cfg.rc_write1_en);
+		cli_parse(cmd, argc, argv, &mac_cfg);
 
 		ret = gpy2xx_gmacl_cfg(&phy, &mac_cfg);
 
@@ -7867,7 +8817,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Lite MAC cfg info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_get", strlen("gpy2xx_gmacl_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_get: {
 		struct gmac_cfg mac_cfg;
 		memset(&mac_cfg, 0, sizeof(struct gmac_cfg));
 
@@ -7885,8 +8837,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Full-duplex Enable", mac_cfg.fulldup_en);
 		printf("\t%40s:\t0x%x\n", "MAC speed", mac_cfg.mac_speed);
 		printf("\t%40s:\t0x%x\n", "Register Clear on Write 1 Enable", mac_cfg.rc_write1_en);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pkt_cfg", strlen("gpy2xx_gmacl_pkt_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_cfg: {
 		struct gmac_pkt_cfg pkt_cfg;
 		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
@@ -7897,13 +8850,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "jumboEn", sizeof(pkt_cfg.jumbo_en), &pkt_cfg.jumbo_en);
-		cnt += scanParamArg(argc, argv, "jabberDis", sizeof(pkt_cfg.tx_jabber_dis), &pkt_cfg.tx_jabber_dis);
-		cnt += scanParamArg(argc, argv, "wdogDis", sizeof(pkt_cfg.watchdog_dis), &pkt_cfg.watchdog_dis);
-		cnt += scanParamArg(argc, argv, "pcStrip", sizeof(pkt_cfg.pad_crc_strip_en), &pkt_cfg.pad_crc_strip_en);
-		cnt += scanParamArg(argc, argv, "crcStrip", sizeof(pkt_cfg.crc_strip_en), &pkt_cfg.crc_strip_en);
-		cnt += scanParamArg(argc, argv, "sup2kp", sizeof(pkt_cfg.support_2kp), &pkt_cfg.support_2kp);
-		cnt += scanParamArg(argc, argv, "macIpg", sizeof(pkt_cfg.mac_ipg), &pkt_cfg.mac_ipg);
+		cli_parse(cmd, argc, argv, &pkt_cfg);
 
 		ret = gpy2xx_gmacl_pkt_cfg(&phy, &pkt_cfg);
 
@@ -7911,7 +8858,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Lite packet cfg info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pkt_get", strlen("gpy2xx_gmacl_pkt_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_get: {
 		struct gmac_pkt_cfg pkt_cfg;
 		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
@@ -7929,8 +8878,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "CRC Stripping for Ether 'Type' packets", pkt_cfg.crc_strip_en);
 		printf("\t%40s:\t0x%x\n", "802.3as Support for 2K Packets", pkt_cfg.support_2kp);
 		printf("\t%40s:\t0x%x\n", "Inter-Packet Gap in Bytes", (12 - pkt_cfg.mac_ipg));
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_pkt_filter_cfg", strlen("gpy2xx_gmacf_pkt_filter_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_filter_cfg: {
 		struct gmac_pktflt_cfg flt_cfg;
 		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
@@ -7941,12 +8891,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "prEn", sizeof(flt_cfg.promiscuous_en), &flt_cfg.promiscuous_en);
-		cnt += scanParamArg(argc, argv, "passAmc", sizeof(flt_cfg.pass_all_mc), &flt_cfg.pass_all_mc);
-		cnt += scanParamArg(argc, argv, "blockBc", sizeof(flt_cfg.block_bc), &flt_cfg.block_bc);
-		cnt += scanParamArg(argc, argv, "passCtrl", sizeof(flt_cfg.pass_ctrl_pkts), &flt_cfg.pass_ctrl_pkts);
-		cnt += scanParamArg(argc, argv, "safltrEn", sizeof(flt_cfg.sa_filter_en), &flt_cfg.sa_filter_en);
-		cnt += scanParamArg(argc, argv, "rxAll", sizeof(flt_cfg.rx_all_en), &flt_cfg.rx_all_en);
+		cli_parse(cmd, argc, argv, &flt_cfg);
 
 		ret = gpy2xx_gmacf_pkt_filter_cfg(&phy, &flt_cfg);
 
@@ -7954,7 +8899,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full packet filter info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_pkt_filter_get", strlen("gpy2xx_gmacf_pkt_filter_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_filter_get: {
 		struct gmac_pktflt_cfg flt_cfg;
 		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
@@ -7971,8 +8918,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Pass Control Packets mode", flt_cfg.pass_ctrl_pkts);
 		printf("\t%40s:\t0x%x\n", "Source Address Filter Enable", flt_cfg.sa_filter_en);
 		printf("\t%40s:\t0x%x\n", "Receive All", flt_cfg.rx_all_en);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pkt_filter_cfg", strlen("gpy2xx_gmacl_pkt_filter_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_filter_cfg: {
 		struct gmac_pktflt_cfg flt_cfg;
 		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
@@ -7983,12 +8931,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "prEn", sizeof(flt_cfg.promiscuous_en), &flt_cfg.promiscuous_en);
-		cnt += scanParamArg(argc, argv, "passAmc", sizeof(flt_cfg.pass_all_mc), &flt_cfg.pass_all_mc);
-		cnt += scanParamArg(argc, argv, "blockBc", sizeof(flt_cfg.block_bc), &flt_cfg.block_bc);
-		cnt += scanParamArg(argc, argv, "passCtrl", sizeof(flt_cfg.pass_ctrl_pkts), &flt_cfg.pass_ctrl_pkts);
-		cnt += scanParamArg(argc, argv, "safltrEn", sizeof(flt_cfg.sa_filter_en), &flt_cfg.sa_filter_en);
-		cnt += scanParamArg(argc, argv, "rxAll", sizeof(flt_cfg.rx_all_en), &flt_cfg.rx_all_en);
+		cli_parse(cmd, argc, argv, &flt_cfg);
 
 		ret = gpy2xx_gmacl_pkt_filter_cfg(&phy, &flt_cfg);
 
@@ -7996,7 +8939,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Lite packet filter info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pkt_filter_get", strlen("gpy2xx_gmacl_pkt_filter_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pkt_filter_get: {
 		struct gmac_pktflt_cfg flt_cfg;
 		memset(&flt_cfg, 0, sizeof(struct gmac_pktflt_cfg));
 
@@ -8013,7 +8958,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Pass Control Packets mode", flt_cfg.pass_ctrl_pkts);
 		printf("\t%40s:\t0x%x\n", "Source Address Filter Enable", flt_cfg.sa_filter_en);
 		printf("\t%40s:\t0x%x\n", "Receive All", flt_cfg.rx_all_en);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_debug_info_get", strlen("gpy2xx_gmacf_debug_info_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_debug_info_get: {
 		struct gmac_debug_info dbg_info;
 		memset(&dbg_info, 0, sizeof(struct gmac_debug_info));
 
@@ -8033,8 +8980,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "GMII or MII Transmit Protocol Engine Status", dbg_info.gmii_tpe_stat);
 		printf("\t%40s:\t0x%x\n", "Transmit Packet Controller FIFO Status", dbg_info.tpc_fifo_stat);
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_pkt_cfg", strlen("gpy2xx_gmacf_pkt_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_cfg: {
 		struct gmac_pkt_cfg pkt_cfg;
 		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
@@ -8045,13 +8993,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "jumboEn", sizeof(pkt_cfg.jumbo_en), &pkt_cfg.jumbo_en);
-		cnt += scanParamArg(argc, argv, "jabberDis", sizeof(pkt_cfg.tx_jabber_dis), &pkt_cfg.tx_jabber_dis);
-		cnt += scanParamArg(argc, argv, "wdogDis", sizeof(pkt_cfg.watchdog_dis), &pkt_cfg.watchdog_dis);
-		cnt += scanParamArg(argc, argv, "pcStrip", sizeof(pkt_cfg.pad_crc_strip_en), &pkt_cfg.pad_crc_strip_en);
-		cnt += scanParamArg(argc, argv, "crcStrip", sizeof(pkt_cfg.crc_strip_en), &pkt_cfg.crc_strip_en);
-		cnt += scanParamArg(argc, argv, "sup2kp", sizeof(pkt_cfg.support_2kp), &pkt_cfg.support_2kp);
-		cnt += scanParamArg(argc, argv, "macIpg", sizeof(pkt_cfg.mac_ipg), &pkt_cfg.mac_ipg);
+		cli_parse(cmd, argc, argv, &pkt_cfg);
 
 		ret = gpy2xx_gmacf_pkt_cfg(&phy, &pkt_cfg);
 
@@ -8059,7 +9001,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full packet cfg info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_pkt_get", strlen("gpy2xx_gmacf_pkt_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_pkt_get: {
 		struct gmac_pkt_cfg pkt_cfg;
 		memset(&pkt_cfg, 0, sizeof(struct gmac_pkt_cfg));
 
@@ -8077,8 +9021,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "CRC Stripping for Ether 'Type' packets", pkt_cfg.crc_strip_en);
 		printf("\t%40s:\t0x%x\n", "802.3as Support for 2K Packets", pkt_cfg.support_2kp);
 		printf("\t%40s:\t0x%x\n", "Inter-Packet Gap in Bytes", pkt_cfg.mac_ipg);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_count_ctrl_cfg", strlen("gpy2xx_gmacf_count_ctrl_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_ctrl_cfg: {
 		struct gmacf_counter_ctrl cnt_ctrl;
 		memset(&cnt_ctrl, 0, sizeof(struct gmacf_counter_ctrl));
 
@@ -8089,13 +9034,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "rstCnt", sizeof(cnt_ctrl.reset_counters), &cnt_ctrl.reset_counters);
-		cnt += scanParamArg(argc, argv, "stopRoll", sizeof(cnt_ctrl.stop_rollover), &cnt_ctrl.stop_rollover);
-		cnt += scanParamArg(argc, argv, "conRead", sizeof(cnt_ctrl.clear_on_read), &cnt_ctrl.clear_on_read);
-		cnt += scanParamArg(argc, argv, "frzCnt", sizeof(cnt_ctrl.freeze_counters), &cnt_ctrl.freeze_counters);
-		cnt += scanParamArg(argc, argv, "pstCnt", sizeof(cnt_ctrl.preset_counters), &cnt_ctrl.preset_counters);
-		cnt += scanParamArg(argc, argv, "psthFull", sizeof(cnt_ctrl.preset_half_full), &cnt_ctrl.preset_half_full);
-		cnt += scanParamArg(argc, argv, "cntbcDrop", sizeof(cnt_ctrl.count_dropped_bc), &cnt_ctrl.count_dropped_bc);
+		cli_parse(cmd, argc, argv, &cnt_ctrl);
 
 		ret = gpy2xx_gmacf_count_ctrl_cfg(&phy, &cnt_ctrl);
 
@@ -8103,7 +9042,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full counters control info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_count_ctrl_get", strlen("gpy2xx_gmacf_count_ctrl_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_ctrl_get: {
 		struct gmacf_counter_ctrl cnt_ctrl;
 		memset(&cnt_ctrl, 0, sizeof(struct gmacf_counter_ctrl));
 
@@ -8121,7 +9062,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Counters Preset", cnt_ctrl.preset_counters);
 		printf("\t%40s:\t0x%x\n", "Full-Half Preset", cnt_ctrl.preset_half_full);
 		printf("\t%40s:\t0x%x\n", "Update Counters for Dropped BC Packets", cnt_ctrl.count_dropped_bc);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_count_get", strlen("gpy2xx_gmacf_count_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_get: {
 		struct gmacf_counters full_ctrs;
 		memset(&full_ctrs, 0, sizeof(struct gmacf_counters));
 
@@ -8143,8 +9086,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame count", full_ctrs.rx_usize_good);
 		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame count", full_ctrs.rx_osize_good);
 #if defined(EN_GMAC_DEBUG_ACCESS) && EN_GMAC_DEBUG_ACCESS
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_count_imask_cfg", strlen("gpy2xx_gmacf_count_imask_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_imask_cfg: {
 		struct counter_imask cnt_imask;
 		memset(&cnt_imask, 0, sizeof(struct counter_imask));
 
@@ -8155,15 +9099,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "txGb", sizeof(cnt_imask.tx_good_bad_im), &cnt_imask.tx_good_bad_im);
-		cnt += scanParamArg(argc, argv, "txUflow", sizeof(cnt_imask.tx_uflow_err_im), &cnt_imask.tx_uflow_err_im);
-		cnt += scanParamArg(argc, argv, "txGood", sizeof(cnt_imask.tx_good_im), &cnt_imask.tx_good_im);
-		cnt += scanParamArg(argc, argv, "txOsize", sizeof(cnt_imask.tx_osize_good_im), &cnt_imask.tx_osize_good_im);
-
-		cnt += scanParamArg(argc, argv, "rxGb", sizeof(cnt_imask.rx_good_bad_im), &cnt_imask.rx_good_bad_im);
-		cnt += scanParamArg(argc, argv, "rxCrc", sizeof(cnt_imask.rx_crc_err_im), &cnt_imask.rx_crc_err_im);
-		cnt += scanParamArg(argc, argv, "rxUsize", sizeof(cnt_imask.rx_usize_good_im), &cnt_imask.rx_usize_good_im);
-		cnt += scanParamArg(argc, argv, "rxOsize", sizeof(cnt_imask.rx_osize_good_im), &cnt_imask.rx_osize_good_im);
+		cli_parse(cmd, argc, argv, &cnt_imask);
 
 		ret = gpy2xx_gmacf_count_imask_cfg(&phy, &cnt_imask);
 
@@ -8171,7 +9107,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: GMAC-Full counters interrupt mask set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_count_imask_get", strlen("gpy2xx_gmacf_count_imask_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_imask_get: {
 		struct counter_imask cnt_imask;
 		memset(&cnt_imask, 0, sizeof(struct counter_imask));
 
@@ -8192,7 +9130,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Rx CRC error frame imask", cnt_imask.rx_crc_err_im);
 		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame imask", cnt_imask.rx_usize_good_im);
 		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame imask", cnt_imask.rx_osize_good_im);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacf_count_istat_get", strlen("gpy2xx_gmacf_count_istat_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacf_count_istat_get: {
 		struct counter_istat cnt_istat;
 		memset(&cnt_istat, 0, sizeof(struct counter_istat));
 
@@ -8214,8 +9154,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "Rx Undesize Good frame istatus", cnt_istat.rx_usize_good_is);
 		printf("\t%40s:\t0x%x\n", "Rx Oversize Good frame istatus", cnt_istat.rx_osize_good_is);
 #endif
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacx_bm_cfg", strlen("gpy2xx_gmacx_bm_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_bm_cfg: {
 		struct bm_cfg bmcfg;
 		memset(&bmcfg, 0, sizeof(struct bm_cfg));
 
@@ -8226,12 +9167,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "sb0Start", sizeof(bmcfg.sb0_start), &bmcfg.sb0_start);
-		cnt += scanParamArg(argc, argv, "sb0End", sizeof(bmcfg.sb0_end), &bmcfg.sb0_end);
-		cnt += scanParamArg(argc, argv, "sb0Pthresh", sizeof(bmcfg.sb0_pkt_thresh), &bmcfg.sb0_pkt_thresh);
-		cnt += scanParamArg(argc, argv, "sb1Start", sizeof(bmcfg.sb1_start), &bmcfg.sb1_start);
-		cnt += scanParamArg(argc, argv, "sb1End", sizeof(bmcfg.sb1_end), &bmcfg.sb1_end);
-		cnt += scanParamArg(argc, argv, "sb1Pthresh", sizeof(bmcfg.sb1_pkt_thresh), &bmcfg.sb1_pkt_thresh);
+		cli_parse(cmd, argc, argv, &bmcfg);
 
 		ret = gpy2xx_gmacx_bm_cfg(&phy, &bmcfg);
 
@@ -8239,7 +9175,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM's Buffer info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacx_bm_get", strlen("gpy2xx_gmacx_bm_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_bm_get: {
 		struct bm_cfg bmcfg;
 		memset(&bmcfg, 0, sizeof(struct bm_cfg));
 
@@ -8256,7 +9194,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "SB 1 Start location", bmcfg.sb1_start);
 		printf("\t%40s:\t0x%x\n", "SB 1 End location", bmcfg.sb1_end);
 		printf("\t%40s:\t0x%x\n", "SB 1 Packet Threshold to start the dequeue", bmcfg.sb1_pkt_thresh);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacx_bm_status_get", strlen("gpy2xx_gmacx_bm_status_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacx_bm_status_get: {
 		struct pm_bm_status bm_stat;
 		memset(&bm_stat, 0, sizeof(struct pm_bm_status));
 
@@ -8282,8 +9222,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "SB 1 Retry Indicator", bm_stat.sb1_retry);
 		printf("\t%40s:\t0x%x\n", "SB 1 Sent Indicator", bm_stat.sb1_sent);
 		printf("\t%40s:\t0x%x\n", "SB 1 Complete Indicator", bm_stat.sb1_complete);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pause_cfg", strlen("gpy2xx_gmacl_pause_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pause_cfg: {
 		struct pause_cfg pcfg;
 		memset(&pcfg, 0, sizeof(struct pause_cfg));
 
@@ -8294,15 +9235,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		cnt += scanParamArg(argc, argv, "fcBusy", sizeof(pcfg.flow_ctrl_busy), &pcfg.flow_ctrl_busy);
-		cnt += scanParamArg(argc, argv, "gmaclFc", sizeof(pcfg.pm_gmacl_fc), &pcfg.pm_gmacl_fc);
-		cnt += scanParamArg(argc, argv, "txfcEn", sizeof(pcfg.tx_flow_ctrl), &pcfg.tx_flow_ctrl);
-		cnt += scanParamArg(argc, argv, "plThresh", sizeof(pcfg.pause_low_thresh), &pcfg.pause_low_thresh);
-		cnt += scanParamArg(argc, argv, "zqPause", sizeof(pcfg.dis_zquanta_pause), &pcfg.dis_zquanta_pause);
-		cnt += scanParamArg(argc, argv, "pauseTime", sizeof(pcfg.pause_time), &pcfg.pause_time);
-		cnt += scanMAC_Arg(argc, argv, "pauseMac", pcfg.tx_fc_mac);
-		cnt += scanParamArg(argc, argv, "paThresh", sizeof(pcfg.pause_assert_thresh), &pcfg.pause_assert_thresh);
-		cnt += scanParamArg(argc, argv, "pdThresh", sizeof(pcfg.pause_deassert_thresh), &pcfg.pause_deassert_thresh);
+		cli_parse(cmd, argc, argv, &pcfg);
 
 		ret = gpy2xx_gmacl_pause_cfg(&phy, &pcfg);
 
@@ -8310,7 +9243,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM's Buffer info set failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_gmacl_pause_get", strlen("gpy2xx_gmacl_pause_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_gmacl_pause_get: {
 		struct pause_cfg pcfg;
 		memset(&pcfg, 0, sizeof(struct pause_cfg));
 
@@ -8332,12 +9267,13 @@ int gpy211_main(int argc, char *argv[])
 		printf("\n");
 		printf("\t%40s:\t0x%x\n", "Pause Assesrt Threshold", pcfg.pause_assert_thresh);
 		printf("\t%40s:\t0x%x\n", "Pause De-Assesrt Threshold", pcfg.pause_deassert_thresh);
-	} else if (xstrncasecmp(argv[0], "gpy2xx_pm_freq_tune", strlen("gpy2xx_pm_freq_tune")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_pm_freq_tune: {
 		struct tune_freq freq;
 		memset(&freq, 0, sizeof(struct tune_freq));
 
-		cnt += scanParamArg(argc, argv, "ppm", sizeof(freq.ppm), &freq.ppm);
+		cli_parse(cmd, argc, argv, &freq);
 
 		ret = gpy2xx_pm_freq_tune(&phy, &freq);
 
@@ -8345,8 +9281,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR: PM's frequency tuning failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_reach_cfg", strlen("gpy2xx_usxgmii_reach_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_reach_cfg: {
 		struct gpy211_usxgmii_reach reach_cfg;
 		memset(&reach_cfg, 0, sizeof(struct gpy211_usxgmii_reach));
 
@@ -8357,23 +9294,7 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-		if (scanParamArg(argc, argv, "trace_len", sizeof(reach_cfg.trace_len), &reach_cfg.trace_len) == 0)
-			reach_cfg.trace_len = -1;
-
-		cnt += scanParamArg(argc, argv, "tx_eq_main", sizeof(reach_cfg.tx_eq_main), &reach_cfg.tx_eq_main);
-		cnt += scanParamArg(argc, argv, "tx_eq_pre", sizeof(reach_cfg.tx_eq_pre), &reach_cfg.tx_eq_pre);
-		cnt += scanParamArg(argc, argv, "tx_eq_post", sizeof(reach_cfg.tx_eq_post), &reach_cfg.tx_eq_post);
-		cnt += scanParamArg(argc, argv, "tx_vboost_en", sizeof(reach_cfg.tx_vboost_en), &reach_cfg.tx_vboost_en);
-		cnt += scanParamArg(argc, argv, "tx_vboost_lvl", sizeof(reach_cfg.tx_vboost_lvl), &reach_cfg.tx_vboost_lvl);
-		cnt += scanParamArg(argc, argv, "tx_iboost_lvl", sizeof(reach_cfg.tx_iboost_lvl), &reach_cfg.tx_iboost_lvl);
-		cnt += scanParamArg(argc, argv, "rx_eq_att_lvl", sizeof(reach_cfg.rx_eq_att_lvl), &reach_cfg.rx_eq_att_lvl);
-		cnt += scanParamArg(argc, argv, "rx_eq_vga1_gain", sizeof(reach_cfg.rx_eq_vga1_gain), &reach_cfg.rx_eq_vga1_gain);
-		cnt += scanParamArg(argc, argv, "rx_eq_vga2_gain", sizeof(reach_cfg.rx_eq_vga2_gain), &reach_cfg.rx_eq_vga2_gain);
-		cnt += scanParamArg(argc, argv, "rx_eq_ctle_boost", sizeof(reach_cfg.rx_eq_ctle_boost), &reach_cfg.rx_eq_ctle_boost);
-		cnt += scanParamArg(argc, argv, "rx_eq_ctle_pole", sizeof(reach_cfg.rx_eq_ctle_pole), &reach_cfg.rx_eq_ctle_pole);
-		cnt += scanParamArg(argc, argv, "rx_eq_dfe_tap1", sizeof(reach_cfg.rx_eq_dfe_tap1), &reach_cfg.rx_eq_dfe_tap1);
-		cnt += scanParamArg(argc, argv, "rx_afe_adapt_en", sizeof(reach_cfg.rx_afe_adapt_en), &reach_cfg.rx_afe_adapt_en);
-		cnt += scanParamArg(argc, argv, "rx_dfe_adapt_en", sizeof(reach_cfg.rx_dfe_adapt_en), &reach_cfg.rx_dfe_adapt_en);
+		cli_parse(cmd, argc, argv, &reach_cfg);
 
 		ret = gpy2xx_usxgmii_reach_cfg(&phy, &reach_cfg);
 
@@ -8381,7 +9302,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR:Egr USXGMII reach configure failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_reach_get", strlen("gpy2xx_usxgmii_getch_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_reach_get: {
 		struct gpy211_usxgmii_reach reach_cfg;
 		memset(&reach_cfg, 0, sizeof(struct gpy211_usxgmii_reach));
 
@@ -8407,7 +9330,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "rx_eq_dfe_tap1", reach_cfg.rx_eq_dfe_tap1);
 		printf("\t%40s:\t%s\n", "rx_afe_adapt_en", (reach_cfg.rx_afe_adapt_en == 0) ? "Disabled" : "Enabled");
 		printf("\t%40s:\t%s\n", "rx_dfe_adapt_en", (reach_cfg.rx_dfe_adapt_en == 0) ? "Disabled" : "Enabled");
-	}  else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_aneg_sts", strlen("gpy2xx_usxgmii_aneg_sts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_aneg_sts: {
 		struct gpy211_usxgmii_aneg_status status;
 		memset(&status, 0, sizeof(struct gpy211_usxgmii_aneg_status));
 
@@ -8430,7 +9355,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t%d\n", "mii_speed", status.mii_speed);
 		printf("\t%40s:\t%s\n", "mii_duplex", status.mii_duplex ? "Full Duplex" : "Half Duplex");
 
-	}  else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_aneg_rst", strlen("gpy2xx_usxgmii_aneg_rst")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_aneg_rst: {
 		ret = gpy2xx_usxgmii_aneg_rst(&phy);
 
 		if (ret < 0) {
@@ -8440,7 +9367,9 @@ int gpy211_main(int argc, char *argv[])
 
 		printf("\t%40s:\t0x%x\n", "Usxgmii Aneg configuration applied for phy_addr", phy.phy_addr);
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_pcs_pma_linksts", strlen("gpy2xx_usxgmii_pcs_pma_linksts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_pcs_pma_linksts: {
 		struct gpy211_usxgmii_pcs_pma_linksts linkstatus;
 		memset(&linkstatus, 0, sizeof(struct gpy211_usxgmii_pcs_pma_linksts));
 
@@ -8456,7 +9385,9 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t%s\n", "pcs_latched_linksts", linkstatus.pcs_latched_linksts ? "Link Up" : "Link Down");
 		printf("\t%40s:\t%s\n", "pcs_linksts", linkstatus.pcs_linksts ? "Link Up" : "Link Down");
 
-	}  else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_mii_linksts", strlen("gpy2xx_usxgmii_mii_linksts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_mii_linksts: {
 		struct gpy211_usxgmii_mii_linksts linkstatus;
 		memset(&linkstatus, 0, sizeof(struct gpy211_usxgmii_mii_linksts));
 
@@ -8471,11 +9402,12 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t%s\n", "latched_linksts", linkstatus.latched_linksts ? "Link Up" : "Link Down");
 		printf("\t%40s:\t%s\n", "linksts", linkstatus.linksts ? "Link Up" : "Link Down");
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_alignmentmarker_set", strlen("gpy2xx_usxgmii_alignmentmarker_set")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_alignmentmarker_set: {
 		u32 am = 0;
 
-		cnt += scanParamArg(argc, argv, "usxgmii_am_count", sizeof(am), &am);
+		cli_parse(cmd, argc, argv, &am);
 		ret = gpy2xx_usxgmii_alignmentmarker_set(&phy, am);
 
 		if (ret < 0) {
@@ -8483,7 +9415,9 @@ int gpy211_main(int argc, char *argv[])
 			return -1;
 		}
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_alignmentmarker_get", strlen("gpy2xx_usxgmii_alignmentmarker_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_alignmentmarker_get: {
 		u32 am = 0;
 
 		ret = gpy2xx_usxgmii_alignmentmarker_get(&phy, &am);
@@ -8495,14 +9429,18 @@ int gpy211_main(int argc, char *argv[])
 
 		printf("\t%40s:\t0x%x\n", "usxgmii_am_count", am);
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_vr_reset", strlen("gpy2xx_usxgmii_vr_reset")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_vr_reset: {
 		ret = gpy2xx_usxgmii_vr_reset(&phy);
 
 		if (ret < 0) {
 			printf("\nERROR:Egr gpy2xx_usxgmii_vr_reset failed.\n");
 			return -1;
 		}
-	}  else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_vr_reset_sts", strlen("gpy2xx_usxgmii_vr_reset_sts")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_vr_reset_sts: {
 		int success = 0;
 
 		ret = gpy2xx_usxgmii_vr_reset_sts(&phy, &success);
@@ -8514,13 +9452,13 @@ int gpy211_main(int argc, char *argv[])
 
 		printf("\t%40s:\t%s\n", "VR reset ", success ? "complete/sucessfull" : "not complete/unsucessfull");
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_tx_bert_cfg", strlen("gpy2xx_usxgmii_tx_bert_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_tx_bert_cfg: {
 		struct gpy211_usxgmii_tx_bert_config bert_tx_config;
 		memset(&bert_tx_config, 0, sizeof(struct gpy211_usxgmii_tx_bert_config));
 
-		cnt += scanParamArg(argc, argv, "mode", sizeof(bert_tx_config.mode), &bert_tx_config.mode);
-		cnt += scanParamArg(argc, argv, "nval_sel", sizeof(bert_tx_config.nval_sel), &bert_tx_config.nval_sel);
+		cli_parse(cmd, argc, argv, &bert_tx_config);
 
 		ret = gpy2xx_usxgmii_tx_bert_cfg(&phy, &bert_tx_config);
 
@@ -8528,7 +9466,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR:Egr gpy2xx_usxgmii_tx_bert_cfg failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_tx_bert_get", strlen("gpy2xx_usxgmii_tx_bert_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_tx_bert_get: {
 		struct gpy211_usxgmii_tx_bert_config bert_tx_config;
 		memset(&bert_tx_config, 0, sizeof(struct gpy211_usxgmii_tx_bert_config));
 
@@ -8583,12 +9523,13 @@ int gpy211_main(int argc, char *argv[])
 		default:
 			printf("ERROR: Un-supported TX BERT mode\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_rx_bert_cfg", strlen("gpy2xx_usxgmii_rx_bert_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_rx_bert_cfg: {
 		struct gpy211_usxgmii_rx_bert_config bert_rx_config;
 		memset(&bert_rx_config, 0, sizeof(struct gpy211_usxgmii_rx_bert_config));
 
-		cnt += scanParamArg(argc, argv, "mode", sizeof(bert_rx_config.mode), &bert_rx_config.mode);
+		cli_parse(cmd, argc, argv, &bert_rx_config);
 
 		ret = gpy2xx_usxgmii_rx_bert_cfg(&phy, &bert_rx_config);
 
@@ -8596,7 +9537,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR:Egr gpy2xx_usxgmii_rx_bert_cfg failed.\n");
 			return -1;
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_rx_bert_get", strlen("gpy2xx_usxgmii_rx_bert_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_rx_bert_get: {
 		struct gpy211_usxgmii_rx_bert_config bert_rx_config;
 		memset(&bert_rx_config, 0, sizeof(struct gpy211_usxgmii_rx_bert_config));
 
@@ -8627,7 +9570,9 @@ int gpy211_main(int argc, char *argv[])
 		default:
 			printf("ERROR: Un-supported RX BERT mode\n");
 		}
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_rx_bert_stat", strlen("gpy2xx_usxgmii_rx_bert_stat")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_rx_bert_stat: {
 		struct gpy211_usxgmii_rx_bert_statistics rx_bert_statistics;
 		memset(&rx_bert_statistics, 0, sizeof(struct gpy211_usxgmii_rx_bert_statistics));
 		ret = gpy2xx_usxgmii_rx_bert_stat(&phy, &rx_bert_statistics);
@@ -8643,11 +9588,12 @@ int gpy211_main(int argc, char *argv[])
 		printf("\t%40s:\t0x%x\n", "latched_high_bit_err_rate", rx_bert_statistics.latched_high_bit_err_rate);
 		printf("\t%40s:\t0x%x\n", "latched_block_lock", rx_bert_statistics.latched_block_lock);
 
-	} else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_loopback_cfg", strlen("gpy2xx_usxgmii_loopback_cfg")) == 0) {
-		int cnt = 0;
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_loopback_cfg: {
 		enum gpy211_usxgmii_loopback_mode mode = USXGMII_LOOPBACK_DISABLE;
 
-		cnt += scanParamArg(argc, argv, "mode", sizeof(mode), &mode);
+		cli_parse(cmd, argc, argv, &mode);
 
 		ret = gpy2xx_usxgmii_loopback_cfg(&phy, mode);
 
@@ -8655,7 +9601,9 @@ int gpy211_main(int argc, char *argv[])
 			printf("\nERROR:Egr gpy2xx_usxgmii_loopback_cfg failed.\n");
 			return -1;
 		}
-	}  else if (xstrncasecmp(argv[0], "gpy2xx_usxgmii_loopback_get", strlen("gpy2xx_usxgmii_loopback_get")) == 0) {
+		break;
+	}
+	case CLI_CMD_gpy2xx_usxgmii_loopback_get: {
 		enum gpy211_usxgmii_loopback_mode mode = USXGMII_LOOPBACK_INVALID;
 
 		ret = gpy2xx_usxgmii_loopback_get(&phy, &mode);
@@ -8684,8 +9632,12 @@ int gpy211_main(int argc, char *argv[])
 			printf("invalid configuration\n");
 		}
 
-	} else	{
+		break;
+	}
+	default: {
 		printf("Command Not Supported\n");
+		break;
+	}
 	}
 
 	return ret;
@@ -37,6 +37,10 @@ help_pm () {
 	echo "                                               4: LP mode disable"
 	echo "                                               5: LP mode enable"
 	echo ""
+	echo "GPHY power agent (gpy2xx_power):                  gphy_agent"
+	echo "            2nd parameter:                        performance, balance, lowpower"
+	echo "                                                  none: show agent state"
+	echo ""
 	echo "PCIE:                                             pcie"
 	echo ""
 	echo "ADP:                                              adp"
@@ -462,6 +466,20 @@ gphy_pm () {
 }
 ############################################################
 
+############################################################
+# GPHY power agent mode, read by gpy2xx_power every period
+gphy_agent () {
+	if [ "$level_pm" = "performance" -o "$level_pm" = "balance" -o "$level_pm" = "lowpower" ]; then
+		mkdir -p /tmp/ppmd
+		echo $level_pm > /tmp/ppmd/gpy2xx_power.policy
+	elif [ -f /tmp/ppmd/gpy2xx_power.json ]; then
+		cat /tmp/ppmd/gpy2xx_power.json
+	else
+		echo "GPHY power agent not running"
+	fi
+}
+############################################################
+
 ############################################################
 # PCIe power saving helper
 #this function search for GEN4 interface (16GT/s) and limit L-State to L0s
@@ -1040,6 +1058,8 @@ case "$sel_pm" in
 		;;
 	"eth0_5") gphy_pm 5
 		;;
+	"gphy_agent") gphy_agent
+		;;
 	"pcie") pcie_pm
 		;;
 	"cpu") cpu_pm